@@ -0,0 +1,12888 @@
+#include "globals.h"
+
+/* This is src/lua/_prologue.lua */
+static const char file_1[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 61, 0, 0, 
+0, 6, 0, 64, 0, 27, 0, 0, 0, 23, 192, 2, 128, 6, 64, 64, 
+0, 70, 64, 64, 0, 71, 128, 192, 0, 129, 192, 0, 0, 86, 128, 128, 
+0, 10, 64, 0, 129, 6, 64, 64, 0, 70, 64, 64, 0, 71, 0, 193, 
+0, 129, 64, 1, 0, 86, 128, 128, 0, 10, 64, 0, 130, 6, 128, 65, 
+0, 27, 64, 0, 0, 23, 192, 0, 128, 6, 192, 65, 0, 65, 128, 1, 
+0, 29, 128, 0, 1, 8, 0, 0, 131, 6, 0, 66, 0, 27, 64, 0, 
+0, 23, 0, 3, 128, 11, 0, 1, 0, 70, 128, 66, 0, 71, 64, 194, 
+0, 10, 64, 128, 132, 70, 128, 66, 0, 71, 192, 194, 0, 10, 64, 128, 
+133, 70, 128, 66, 0, 71, 0, 195, 0, 10, 64, 0, 134, 101, 0, 0, 
+0, 10, 64, 128, 134, 8, 0, 0, 132, 6, 128, 67, 0, 27, 0, 0, 
+0, 23, 0, 4, 128, 11, 64, 2, 0, 10, 0, 196, 135, 10, 0, 196, 
+136, 10, 0, 68, 137, 10, 0, 196, 137, 10, 0, 68, 138, 10, 0, 196, 
+138, 10, 0, 68, 139, 10, 0, 196, 139, 10, 0, 68, 140, 70, 64, 70, 
+0, 134, 128, 70, 0, 203, 64, 0, 0, 37, 65, 0, 0, 202, 0, 129, 
+141, 93, 64, 128, 1, 87, 192, 255, 127, 11, 0, 0, 0, 8, 0, 0, 
+142, 31, 0, 128, 0, 29, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 106, 105, 116, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 112, 
+97, 99, 107, 97, 103, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+112, 97, 116, 104, 0, 4, 56, 0, 0, 0, 0, 0, 0, 0, 59, 47, 
+117, 115, 114, 47, 115, 104, 97, 114, 101, 47, 108, 117, 97, 47, 53, 46, 
+49, 47, 63, 46, 108, 117, 97, 59, 47, 117, 115, 114, 47, 115, 104, 97, 
+114, 101, 47, 108, 117, 97, 47, 53, 46, 49, 47, 63, 47, 105, 110, 105, 
+116, 46, 108, 117, 97, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 99, 
+112, 97, 116, 104, 0, 4, 96, 0, 0, 0, 0, 0, 0, 0, 59, 47, 
+117, 115, 114, 47, 108, 105, 98, 47, 120, 56, 54, 95, 54, 52, 45, 108, 
+105, 110, 117, 120, 45, 103, 110, 117, 47, 108, 117, 97, 47, 53, 46, 49, 
+47, 63, 46, 115, 111, 59, 47, 117, 115, 114, 47, 108, 105, 98, 47, 108, 
+117, 97, 47, 53, 46, 49, 47, 63, 46, 115, 111, 59, 47, 117, 115, 114, 
+47, 108, 111, 99, 97, 108, 47, 108, 105, 98, 47, 108, 117, 97, 47, 53, 
+46, 49, 47, 108, 111, 97, 100, 97, 108, 108, 46, 115, 111, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 108, 102, 115, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 114, 101, 113, 117, 105, 114, 101, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 98, 105, 116, 51, 50, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 98, 120, 111, 114, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 98, 105, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 
+97, 110, 100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 98, 111, 114, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 98, 116, 101, 115, 116, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 68, 69, 66, 85, 71, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 88, 49, 49, 95, 66, 76, 65, 67, 
+75, 95, 67, 79, 76, 79, 85, 82, 0, 1, 1, 4, 18, 0, 0, 0, 
+0, 0, 0, 0, 88, 49, 49, 95, 66, 79, 76, 68, 95, 77, 79, 68, 
+73, 70, 73, 69, 82, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 88, 
+49, 49, 95, 66, 82, 73, 71, 72, 84, 95, 67, 79, 76, 79, 85, 82, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 88, 49, 49, 95, 68, 73, 
+77, 95, 67, 79, 76, 79, 85, 82, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 88, 49, 49, 95, 70, 79, 78, 84, 0, 4, 24, 0, 0, 0, 
+0, 0, 0, 0, 88, 49, 49, 95, 71, 76, 89, 80, 72, 95, 67, 65, 
+67, 72, 69, 95, 69, 78, 84, 82, 73, 69, 83, 0, 4, 19, 0, 0, 
+0, 0, 0, 0, 0, 88, 49, 49, 95, 71, 76, 89, 80, 72, 95, 67, 
+65, 67, 72, 69, 95, 75, 66, 0, 4, 20, 0, 0, 0, 0, 0, 0, 
+0, 88, 49, 49, 95, 73, 84, 65, 76, 73, 67, 95, 77, 79, 68, 73, 
+70, 73, 69, 82, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 88, 49, 
+49, 95, 78, 79, 82, 77, 65, 76, 95, 67, 79, 76, 79, 85, 82, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 109, 101, 116, 97, 
+116, 97, 98, 108, 101, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 95, 
+71, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 100, 
+101, 120, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 
+2, 0, 0, 0, 29, 0, 0, 0, 31, 0, 0, 0, 2, 0, 5, 11, 
+0, 0, 0, 134, 0, 64, 0, 135, 64, 64, 1, 192, 0, 0, 0, 0, 
+1, 128, 0, 157, 128, 128, 1, 24, 128, 64, 1, 23, 0, 0, 128, 131, 
+64, 0, 0, 131, 0, 128, 0, 159, 0, 0, 1, 31, 0, 128, 0, 3, 
+0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 98, 105, 116, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 97, 110, 100, 0, 3, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 54, 0, 0, 0, 59, 0, 0, 0, 2, 0, 6, 
+15, 0, 0, 0, 134, 64, 0, 0, 155, 64, 0, 0, 23, 64, 1, 128, 
+134, 0, 192, 0, 193, 64, 0, 0, 0, 1, 128, 0, 65, 129, 0, 0, 
+214, 64, 129, 1, 157, 64, 0, 1, 134, 192, 192, 0, 198, 0, 193, 0, 
+0, 1, 128, 0, 158, 0, 128, 1, 159, 0, 0, 0, 31, 0, 128, 0, 
+5, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 101, 114, 114, 
+111, 114, 0, 4, 28, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 100, 
+32, 102, 114, 111, 109, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 
+108, 111, 99, 97, 108, 32, 39, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 39, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 97, 119, 103, 
+101, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 95, 71, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/ffi.lua */
+static const char file_2[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 11, 53, 0, 0, 
+0, 6, 0, 64, 0, 70, 64, 64, 0, 129, 128, 0, 0, 29, 128, 128, 
+1, 27, 0, 0, 0, 23, 64, 1, 128, 6, 192, 64, 0, 7, 0, 65, 
+0, 65, 64, 1, 0, 29, 128, 0, 1, 27, 0, 0, 0, 23, 0, 0, 
+128, 31, 0, 128, 0, 6, 128, 65, 0, 70, 192, 65, 0, 129, 0, 2, 
+0, 29, 192, 128, 1, 27, 64, 0, 0, 23, 0, 0, 128, 31, 0, 128, 
+0, 135, 64, 194, 0, 193, 128, 2, 0, 157, 64, 0, 1, 135, 192, 194, 
+0, 198, 128, 65, 0, 37, 1, 0, 0, 221, 128, 0, 1, 219, 64, 0, 
+0, 23, 0, 0, 128, 31, 0, 128, 0, 199, 0, 195, 0, 7, 65, 67, 
+1, 71, 129, 67, 1, 135, 193, 67, 1, 199, 1, 196, 0, 1, 66, 4, 
+0, 221, 129, 0, 1, 6, 130, 68, 0, 101, 66, 0, 0, 10, 66, 130, 
+137, 6, 130, 68, 0, 101, 130, 0, 0, 10, 66, 2, 138, 6, 66, 69, 
+0, 70, 130, 68, 0, 71, 130, 197, 4, 129, 194, 5, 0, 93, 2, 0, 
+1, 29, 130, 0, 0, 7, 2, 70, 4, 101, 194, 0, 0, 10, 66, 130, 
+140, 31, 0, 128, 0, 26, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 114, 97, 119, 103, 101, 116, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 95, 71, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 106, 105, 
+116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 111, 115, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 101, 110, 118, 0, 4, 19, 
+0, 0, 0, 0, 0, 0, 0, 87, 79, 82, 68, 71, 82, 73, 78, 68, 
+69, 82, 95, 78, 79, 95, 70, 70, 73, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 112, 99, 97, 108, 108, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 114, 101, 113, 117, 105, 114, 101, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 102, 102, 105, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+99, 100, 101, 102, 0, 4, 233, 0, 0, 0, 0, 0, 0, 0, 9, 105, 
+110, 116, 32, 115, 99, 114, 101, 101, 110, 95, 103, 101, 116, 115, 116, 114, 
+105, 110, 103, 119, 105, 100, 116, 104, 40, 99, 111, 110, 115, 116, 32, 99, 
+104, 97, 114, 42, 32, 115, 44, 32, 115, 105, 122, 101, 95, 116, 32, 115, 
+105, 122, 101, 41, 59, 10, 9, 105, 110, 116, 32, 119, 111, 114, 100, 95, 
+119, 114, 105, 116, 101, 115, 116, 121, 108, 101, 100, 40, 105, 110, 116, 32, 
+120, 44, 32, 105, 110, 116, 32, 121, 44, 32, 99, 111, 110, 115, 116, 32, 
+99, 104, 97, 114, 42, 32, 115, 44, 32, 115, 105, 122, 101, 95, 116, 32, 
+115, 105, 122, 101, 44, 10, 9, 9, 105, 110, 116, 32, 111, 97, 116, 116, 
+114, 44, 32, 105, 110, 116, 32, 114, 101, 118, 111, 110, 44, 32, 105, 110, 
+116, 32, 114, 101, 118, 111, 102, 102, 44, 32, 105, 110, 116, 32, 115, 111, 
+114, 41, 59, 10, 9, 115, 116, 114, 117, 99, 116, 32, 98, 117, 102, 102, 
+101, 114, 59, 10, 9, 115, 105, 122, 101, 95, 116, 32, 98, 117, 102, 102, 
+101, 114, 95, 97, 112, 112, 101, 110, 100, 117, 56, 40, 115, 116, 114, 117, 
+99, 116, 32, 98, 117, 102, 102, 101, 114, 42, 32, 98, 44, 32, 105, 110, 
+116, 32, 99, 41, 59, 10, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+67, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 99, 97, 115, 116, 0, 
+4, 22, 0, 0, 0, 0, 0, 0, 0, 115, 99, 114, 101, 101, 110, 95, 
+103, 101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 104, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 119, 111, 114, 100, 95, 119, 114, 105, 
+116, 101, 115, 116, 121, 108, 101, 100, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 98, 117, 102, 102, 101, 114, 95, 97, 112, 112, 101, 110, 100, 117, 
+56, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 116, 121, 112, 101, 111, 
+102, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 117, 99, 
+116, 32, 98, 117, 102, 102, 101, 114, 42, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 119, 103, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 103, 
+101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 104, 0, 4, 12, 
+0, 0, 0, 0, 0, 0, 0, 119, 114, 105, 116, 101, 115, 116, 121, 108, 
+101, 100, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 109, 
+101, 116, 97, 116, 97, 98, 108, 101, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 99, 114, 101, 97, 116, 101, 98, 117, 102, 102, 101, 114, 0, 3, 
+0, 0, 0, 0, 0, 0, 48, 64, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 95, 95, 105, 110, 100, 101, 120, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 97, 112, 112, 101, 110, 100, 117, 56, 0, 4, 0, 0, 0, 32, 
+0, 0, 0, 32, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 6, 0, 
+64, 0, 31, 0, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 98, 117, 102, 102, 101, 114, 95, 97, 112, 
+112, 101, 110, 100, 117, 56, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 
+2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 42, 0, 0, 0, 44, 0, 0, 0, 1, 0, 4, 
+6, 0, 0, 0, 69, 0, 0, 0, 128, 0, 0, 0, 213, 0, 0, 0, 
+94, 0, 128, 1, 95, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 
+0, 0, 48, 0, 0, 0, 7, 0, 16, 18, 0, 0, 0, 197, 1, 0, 
+0, 0, 2, 0, 0, 64, 2, 128, 0, 128, 2, 0, 1, 213, 2, 0, 
+1, 0, 3, 128, 1, 92, 67, 0, 2, 23, 0, 0, 128, 65, 3, 0, 
+0, 156, 67, 128, 2, 23, 0, 0, 128, 129, 3, 0, 0, 220, 67, 0, 
+3, 23, 0, 0, 128, 193, 3, 0, 0, 222, 1, 128, 4, 223, 1, 0, 
+0, 31, 0, 128, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 5, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+54, 0, 0, 0, 60, 0, 0, 0, 2, 0, 6, 17, 0, 0, 0, 133, 
+0, 0, 0, 197, 0, 128, 0, 5, 1, 0, 1, 64, 1, 0, 0, 221, 
+128, 128, 1, 0, 1, 128, 0, 157, 128, 128, 1, 24, 0, 64, 1, 23, 
+128, 0, 128, 198, 64, 192, 1, 1, 129, 0, 0, 221, 64, 0, 1, 198, 
+192, 192, 1, 0, 1, 0, 1, 222, 0, 0, 1, 223, 0, 0, 0, 31, 
+0, 128, 0, 4, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 101, 114, 114, 111, 114, 0, 4, 
+14, 0, 0, 0, 0, 0, 0, 0, 111, 117, 116, 32, 111, 102, 32, 109, 
+101, 109, 111, 114, 121, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 116, 
+111, 110, 117, 109, 98, 101, 114, 0, 0, 0, 0, 0, 4, 0, 0, 0, 
+1, 6, 1, 3, 1, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/events.lua */
+static const char file_3[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 48, 0, 0, 
+0, 11, 0, 0, 0, 75, 0, 0, 0, 139, 0, 0, 0, 8, 128, 0, 
+128, 134, 0, 64, 0, 203, 0, 0, 0, 138, 192, 128, 128, 134, 0, 64, 
+0, 203, 0, 0, 0, 138, 192, 0, 129, 134, 0, 64, 0, 203, 0, 0, 
+0, 138, 192, 128, 129, 134, 0, 64, 0, 203, 0, 0, 0, 138, 192, 0, 
+130, 134, 0, 64, 0, 203, 0, 0, 0, 138, 192, 128, 130, 134, 0, 64, 
+0, 203, 0, 0, 0, 138, 192, 0, 131, 134, 0, 64, 0, 203, 0, 0, 
+0, 138, 192, 128, 131, 134, 0, 64, 0, 203, 0, 0, 0, 138, 192, 0, 
+132, 134, 0, 64, 0, 203, 0, 0, 0, 138, 192, 128, 132, 134, 0, 64, 
+0, 203, 0, 0, 0, 138, 192, 0, 133, 134, 0, 64, 0, 203, 0, 0, 
+0, 138, 192, 128, 133, 165, 0, 0, 0, 8, 128, 0, 134, 165, 64, 0, 
+0, 8, 128, 128, 134, 165, 128, 0, 0, 8, 128, 0, 135, 165, 192, 0, 
+0, 8, 128, 128, 135, 165, 0, 1, 0, 8, 128, 0, 136, 31, 0, 128, 
+0, 17, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 
+101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 66, 117, 105, 
+108, 100, 83, 116, 97, 116, 117, 115, 66, 97, 114, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 67, 104, 97, 110, 103, 101, 100, 0, 4, 16, 0, 
+0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 67, 114, 
+101, 97, 116, 101, 100, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 76, 111, 97, 100, 101, 100, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 85, 
+112, 103, 114, 97, 100, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+73, 100, 108, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 87, 111, 
+114, 100, 77, 111, 100, 105, 102, 105, 101, 100, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 77, 111, 118, 101, 100, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 82, 101, 100, 114, 97, 119, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 
+115, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 87, 97, 105, 116, 105, 
+110, 103, 70, 111, 114, 85, 115, 101, 114, 0, 4, 17, 0, 0, 0, 0, 
+0, 0, 0, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 
+110, 101, 114, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 82, 101, 109, 
+111, 118, 101, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 70, 105, 114, 101, 69, 118, 
+101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 70, 105, 114, 
+101, 65, 115, 121, 110, 99, 69, 118, 101, 110, 116, 0, 4, 17, 0, 0, 
+0, 0, 0, 0, 0, 70, 108, 117, 115, 104, 65, 115, 121, 110, 99, 69, 
+118, 101, 110, 116, 115, 0, 5, 0, 0, 0, 33, 0, 0, 0, 45, 0, 
+0, 0, 2, 0, 4, 12, 0, 0, 0, 134, 0, 0, 0, 155, 64, 0, 
+0, 23, 64, 0, 128, 139, 0, 0, 0, 8, 128, 0, 0, 139, 0, 128, 
+0, 192, 0, 0, 0, 164, 64, 128, 0, 198, 0, 0, 0, 202, 64, 0, 
+1, 159, 0, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 56, 
+0, 0, 0, 1, 0, 3, 4, 0, 0, 0, 71, 0, 64, 0, 134, 64, 
+0, 0, 138, 64, 64, 0, 31, 0, 128, 0, 2, 0, 0, 0, 3, 0, 
+0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 73, 0, 0, 0, 1, 1, 
+11, 16, 0, 0, 0, 70, 0, 0, 0, 91, 64, 0, 0, 23, 0, 0, 
+128, 31, 0, 128, 0, 134, 0, 192, 0, 192, 0, 128, 0, 157, 0, 1, 
+1, 23, 0, 1, 128, 192, 1, 0, 3, 0, 2, 0, 0, 64, 2, 128, 
+2, 166, 2, 0, 0, 221, 65, 0, 0, 162, 128, 0, 0, 35, 1, 254, 
+127, 31, 0, 128, 0, 1, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 112, 97, 105, 114, 115, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 83, 0, 0, 0, 
+1, 0, 2, 2, 0, 0, 0, 8, 0, 64, 0, 31, 0, 128, 0, 1, 
+0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 89, 0, 0, 0, 99, 0, 0, 0, 0, 0, 3, 11, 0, 
+0, 0, 6, 0, 64, 0, 69, 0, 128, 0, 29, 128, 0, 1, 27, 0, 
+0, 0, 23, 0, 1, 128, 72, 64, 64, 0, 70, 128, 64, 0, 128, 0, 
+0, 0, 93, 64, 0, 1, 23, 64, 253, 127, 31, 0, 128, 0, 3, 0, 
+0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 101, 120, 116, 0, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 70, 105, 114, 101, 69, 118, 
+101, 110, 116, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/main.lua */
+static const char file_4[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 30, 100, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 91, 64, 0, 
+0, 23, 64, 0, 128, 70, 192, 64, 0, 71, 128, 192, 0, 134, 0, 65, 
+0, 135, 64, 65, 1, 198, 0, 65, 0, 199, 128, 193, 1, 6, 1, 65, 
+0, 7, 193, 65, 2, 70, 1, 65, 0, 71, 1, 194, 2, 134, 1, 65, 
+0, 135, 65, 66, 3, 198, 1, 65, 0, 199, 129, 194, 3, 6, 2, 65, 
+0, 7, 194, 66, 4, 70, 2, 65, 0, 71, 2, 195, 4, 134, 2, 65, 
+0, 135, 66, 67, 5, 198, 2, 65, 0, 199, 130, 195, 5, 6, 3, 65, 
+0, 7, 195, 67, 6, 67, 3, 128, 0, 129, 3, 4, 0, 193, 3, 4, 
+0, 11, 196, 1, 0, 10, 4, 196, 136, 10, 4, 68, 137, 10, 4, 196, 
+137, 10, 4, 68, 138, 10, 4, 196, 138, 10, 4, 68, 139, 10, 4, 196, 
+139, 70, 68, 70, 0, 71, 132, 198, 8, 129, 4, 6, 0, 93, 132, 0, 
+1, 91, 68, 0, 0, 23, 192, 0, 128, 70, 68, 70, 0, 71, 132, 198, 
+8, 129, 196, 6, 0, 93, 132, 0, 1, 8, 64, 4, 140, 70, 4, 70, 
+0, 129, 4, 7, 0, 86, 132, 132, 8, 132, 4, 0, 1, 101, 5, 0, 
+0, 8, 64, 133, 142, 101, 69, 0, 0, 8, 64, 5, 143, 101, 133, 0, 
+0, 165, 197, 0, 0, 229, 5, 1, 0, 6, 198, 71, 0, 70, 6, 72, 
+0, 71, 70, 200, 12, 128, 6, 128, 11, 29, 70, 128, 1, 229, 69, 1, 
+0, 8, 192, 5, 145, 229, 133, 1, 0, 6, 198, 71, 0, 70, 6, 72, 
+0, 71, 198, 200, 12, 128, 6, 128, 11, 29, 70, 128, 1, 6, 198, 71, 
+0, 70, 6, 72, 0, 71, 6, 201, 12, 128, 6, 128, 11, 29, 70, 128, 
+1, 196, 5, 0, 0, 37, 198, 1, 0, 101, 6, 2, 0, 165, 70, 2, 
+0, 198, 198, 71, 0, 6, 7, 72, 0, 7, 71, 73, 14, 64, 7, 128, 
+12, 221, 70, 128, 1, 198, 198, 71, 0, 6, 7, 72, 0, 7, 71, 72, 
+14, 64, 7, 0, 13, 221, 70, 128, 1, 23, 198, 255, 127, 229, 133, 2, 
+0, 8, 192, 5, 147, 229, 197, 2, 0, 8, 192, 133, 147, 31, 0, 128, 
+0, 40, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 97, 
+116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 102, 108, 111, 111, 
+114, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 117, 110, 112, 97, 99, 
+107, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 98, 108, 101, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 119, 114, 105, 116, 101, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 115, 101, 116, 110, 111, 114, 109, 97, 108, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 98, 111, 108, 100, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 117, 110, 100, 101, 
+114, 108, 105, 110, 101, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 
+101, 116, 114, 101, 118, 101, 114, 115, 101, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 103, 101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 
+104, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 104, 97, 115, 112, 101, 
+110, 100, 105, 110, 103, 105, 110, 112, 117, 116, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 103, 101, 116, 99, 104, 97, 114, 115, 0, 4, 14, 0, 
+0, 0, 0, 0, 0, 0, 103, 101, 116, 112, 97, 115, 116, 101, 100, 116, 
+101, 120, 116, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+99, 104, 97, 114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 105, 
+109, 101, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 114, 101, 113, 117, 101, 115, 116, 115, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 102, 114, 97, 109, 101, 115, 0, 4, 13, 
+0, 0, 0, 0, 0, 0, 0, 100, 101, 102, 101, 114, 114, 101, 100, 107, 
+101, 121, 115, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 108, 97, 115, 
+116, 102, 114, 97, 109, 101, 116, 105, 109, 101, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 108, 97, 115, 116, 108, 97, 116, 101, 110, 99, 121, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 109, 97, 120, 108, 97, 116, 101, 
+110, 99, 121, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 116, 111, 116, 
+97, 108, 108, 97, 116, 101, 110, 99, 121, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 72, 79, 77, 69, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 111, 115, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+101, 110, 118, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 85, 83, 69, 
+82, 80, 82, 79, 70, 73, 76, 69, 0, 4, 18, 0, 0, 0, 0, 0, 
+0, 0, 47, 46, 119, 111, 114, 100, 103, 114, 105, 110, 100, 101, 114, 46, 
+108, 117, 97, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 
+117, 101, 82, 101, 100, 114, 97, 119, 0, 4, 15, 0, 0, 0, 0, 0, 
+0, 0, 71, 101, 116, 82, 101, 100, 114, 97, 119, 83, 116, 97, 116, 115, 
+0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 65, 100, 100, 69, 118, 101, 
+110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 
+115, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 82, 101, 115, 101, 116, 
+68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 76, 111, 97, 
+100, 101, 100, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 67, 114, 101, 97, 116, 101, 100, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 73, 100, 108, 101, 0, 4, 14, 0, 0, 0, 
+0, 0, 0, 0, 87, 111, 114, 100, 80, 114, 111, 99, 101, 115, 115, 111, 
+114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 77, 97, 105, 110, 0, 
+12, 0, 0, 0, 46, 0, 0, 0, 65, 0, 0, 0, 0, 0, 2, 49, 
+0, 0, 0, 5, 0, 0, 0, 27, 64, 0, 0, 23, 0, 1, 128, 3, 
+0, 128, 0, 9, 0, 0, 0, 5, 0, 0, 1, 29, 128, 128, 0, 9, 
+0, 128, 0, 6, 0, 192, 1, 13, 64, 64, 0, 200, 0, 0, 128, 6, 
+128, 64, 2, 27, 0, 0, 0, 23, 64, 8, 128, 5, 0, 128, 2, 70, 
+128, 64, 2, 71, 192, 192, 0, 24, 64, 0, 0, 23, 64, 2, 128, 5, 
+0, 0, 3, 70, 128, 64, 2, 71, 0, 193, 0, 24, 64, 0, 0, 23, 
+0, 1, 128, 5, 0, 128, 3, 70, 128, 64, 2, 71, 64, 193, 0, 88, 
+64, 0, 0, 23, 0, 3, 128, 6, 128, 64, 2, 7, 192, 64, 0, 9, 
+0, 128, 2, 6, 128, 64, 2, 7, 0, 65, 0, 9, 0, 0, 3, 6, 
+128, 64, 2, 7, 64, 65, 0, 9, 0, 128, 3, 6, 128, 65, 2, 70, 
+192, 65, 2, 71, 0, 194, 0, 29, 64, 0, 1, 6, 128, 64, 2, 7, 
+64, 66, 0, 27, 64, 0, 0, 23, 64, 0, 128, 6, 128, 66, 2, 29, 
+64, 128, 0, 31, 0, 128, 0, 11, 0, 0, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 114, 101, 113, 117, 101, 115, 116, 115, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 70, 105, 114, 101, 69, 118, 101, 110, 116, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 77, 111, 118, 101, 100, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 119, 114, 97, 112, 119, 105, 100, 116, 104, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 115, 105, 122, 101, 83, 
+99, 114, 101, 101, 110, 0, 0, 0, 0, 0, 8, 0, 0, 0, 1, 13, 
+1, 14, 1, 12, 1, 16, 0, 0, 1, 18, 1, 19, 1, 20, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 69, 0, 0, 0, 76, 0, 0, 0, 0, 0, 7, 20, 0, 0, 
+0, 11, 0, 0, 0, 70, 0, 64, 0, 133, 0, 128, 0, 93, 0, 1, 
+1, 23, 0, 0, 128, 10, 64, 1, 2, 98, 128, 0, 0, 227, 0, 255, 
+127, 71, 128, 64, 0, 25, 64, 128, 129, 23, 0, 1, 128, 71, 0, 65, 
+0, 135, 128, 64, 0, 80, 128, 128, 0, 91, 64, 0, 0, 23, 0, 0, 
+128, 65, 192, 0, 0, 10, 64, 128, 128, 31, 0, 0, 1, 31, 0, 128, 
+0, 5, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+105, 114, 115, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 97, 118, 101, 
+114, 97, 103, 101, 108, 97, 116, 101, 110, 99, 121, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 102, 114, 97, 109, 101, 115, 0, 3, 0, 0, 0, 
+0, 0, 0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 116, 111, 
+116, 97, 108, 108, 97, 116, 101, 110, 99, 121, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 0, 0, 1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 92, 
+0, 0, 0, 0, 0, 6, 27, 0, 0, 0, 5, 0, 0, 0, 29, 128, 
+128, 0, 70, 0, 192, 0, 93, 64, 128, 0, 69, 0, 0, 0, 93, 128, 
+128, 0, 133, 0, 0, 1, 142, 128, 128, 0, 198, 64, 192, 1, 205, 128, 
+192, 1, 200, 192, 128, 128, 206, 0, 128, 0, 200, 192, 128, 129, 200, 128, 
+0, 130, 198, 128, 193, 0, 199, 192, 193, 1, 6, 65, 193, 1, 64, 1, 
+0, 1, 221, 128, 128, 1, 200, 192, 128, 130, 198, 0, 194, 1, 205, 128, 
+128, 1, 200, 192, 0, 132, 195, 0, 0, 0, 201, 0, 0, 2, 73, 0, 
+128, 2, 31, 0, 128, 0, 9, 0, 0, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 102, 114, 97, 109, 101, 115, 0, 
+3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 14, 0, 0, 0, 0, 0, 
+0, 0, 108, 97, 115, 116, 102, 114, 97, 109, 101, 116, 105, 109, 101, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 108, 97, 115, 116, 108, 97, 116, 
+101, 110, 99, 121, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 109, 97, 
+120, 108, 97, 116, 101, 110, 99, 121, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 109, 97, 116, 104, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+109, 97, 120, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 116, 111, 116, 
+97, 108, 108, 97, 116, 101, 110, 99, 121, 0, 0, 0, 0, 0, 6, 0, 
+0, 0, 1, 12, 0, 0, 1, 14, 1, 16, 1, 13, 1, 15, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 99, 0, 0, 0, 120, 0, 0, 0, 0, 0, 4, 37, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 69, 0, 128, 0, 91, 0, 0, 
+0, 23, 128, 4, 128, 69, 0, 0, 1, 135, 128, 64, 0, 144, 128, 128, 
+129, 77, 128, 128, 0, 133, 0, 128, 1, 157, 128, 128, 0, 78, 128, 128, 
+0, 26, 0, 193, 0, 23, 128, 0, 128, 133, 0, 0, 2, 157, 64, 128, 
+0, 23, 0, 252, 127, 133, 0, 128, 2, 192, 0, 128, 0, 157, 128, 0, 
+1, 88, 64, 65, 1, 23, 192, 250, 127, 159, 0, 0, 1, 23, 64, 250, 
+127, 69, 0, 128, 2, 134, 128, 65, 0, 135, 192, 65, 1, 93, 128, 0, 
+1, 88, 64, 193, 0, 23, 0, 0, 128, 95, 0, 0, 1, 134, 0, 66, 
+0, 198, 64, 66, 0, 199, 128, 194, 1, 157, 64, 0, 1, 23, 64, 247, 
+127, 31, 0, 128, 0, 11, 0, 0, 0, 4, 15, 0, 0, 0, 0, 0, 
+0, 0, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 100, 114, 97, 119, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 109, 97, 120, 102, 112, 115, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 3, 0, 0, 0, 0, 0, 
+0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 
+84, 73, 77, 69, 79, 85, 84, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 105, 100, 108, 101, 116, 105, 109, 101, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 70, 105, 114, 101, 69, 118, 101, 110, 
+116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 73, 100, 108, 101, 0, 0, 
+0, 0, 0, 6, 0, 0, 0, 0, 0, 1, 13, 1, 15, 1, 12, 1, 
+21, 1, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0, 128, 0, 0, 0, 0, 
+0, 2, 20, 0, 0, 0, 6, 0, 64, 0, 70, 0, 64, 0, 71, 64, 
+192, 0, 91, 64, 0, 0, 23, 0, 0, 128, 75, 0, 0, 0, 10, 64, 
+128, 128, 6, 0, 64, 0, 7, 64, 64, 0, 71, 128, 64, 0, 91, 64, 
+0, 0, 23, 0, 0, 128, 65, 192, 0, 0, 10, 64, 0, 129, 71, 0, 
+65, 0, 91, 64, 0, 0, 23, 0, 0, 128, 65, 64, 1, 0, 10, 64, 
+0, 130, 31, 0, 128, 0, 6, 0, 0, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 
+115, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 100, 114, 97, 
+119, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 109, 97, 120, 102, 112, 
+115, 0, 3, 0, 0, 0, 0, 0, 0, 62, 64, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 109, 97, 120, 108, 97, 116, 101, 110, 99, 121, 0, 3, 
+0, 0, 0, 0, 0, 0, 208, 63, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 133, 0, 0, 0, 145, 0, 0, 0, 0, 0, 
+4, 39, 0, 0, 0, 6, 64, 64, 0, 29, 128, 128, 0, 8, 0, 0, 
+128, 6, 0, 64, 0, 70, 192, 64, 0, 93, 128, 128, 0, 10, 64, 0, 
+129, 6, 64, 65, 0, 29, 128, 128, 0, 8, 0, 0, 130, 6, 0, 64, 
+0, 12, 128, 65, 0, 134, 64, 65, 0, 157, 128, 128, 0, 193, 192, 1, 
+0, 29, 64, 0, 2, 6, 0, 66, 0, 70, 0, 64, 0, 71, 64, 194, 
+0, 29, 64, 0, 1, 6, 128, 66, 0, 70, 0, 64, 0, 71, 192, 194, 
+0, 29, 64, 0, 1, 6, 0, 64, 0, 12, 0, 67, 0, 29, 64, 0, 
+1, 6, 0, 64, 0, 12, 64, 67, 0, 29, 64, 0, 1, 6, 128, 67, 
+0, 70, 192, 67, 0, 71, 0, 196, 0, 29, 64, 0, 1, 6, 128, 67, 
+0, 70, 192, 67, 0, 71, 64, 196, 0, 29, 64, 0, 1, 31, 0, 128, 
+0, 18, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 18, 0, 0, 0, 0, 
+0, 0, 0, 67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 101, 
+110, 117, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 
+116, 101, 77, 101, 110, 117, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 
+0, 0, 67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 109, 101, 110, 116, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 
+97, 105, 110, 0, 4, 27, 0, 0, 0, 0, 0, 0, 0, 82, 101, 98, 
+117, 105, 108, 100, 80, 97, 114, 97, 103, 114, 97, 112, 104, 83, 116, 121, 
+108, 101, 115, 77, 101, 110, 117, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 115, 116, 121, 108, 101, 115, 0, 4, 21, 0, 0, 0, 0, 0, 0, 
+0, 82, 101, 98, 117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 110, 116, 
+115, 77, 101, 110, 117, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 100, 
+111, 99, 117, 109, 101, 110, 116, 115, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 112, 117, 114, 103, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 99, 108, 101, 97, 110, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+70, 105, 114, 101, 69, 118, 101, 110, 116, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 67, 114, 101, 97, 116, 101, 
+100, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 82, 101, 103, 105, 115, 
+116, 101, 114, 65, 100, 100, 111, 110, 115, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 148, 0, 0, 0, 153, 0, 0, 0, 
+2, 0, 5, 11, 0, 0, 0, 129, 0, 0, 0, 137, 0, 0, 0, 129, 
+0, 0, 0, 137, 0, 128, 0, 129, 0, 0, 0, 137, 0, 0, 1, 134, 
+64, 192, 1, 193, 128, 0, 0, 1, 129, 0, 0, 157, 64, 128, 1, 31, 
+0, 128, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 20, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 67, 117, 114, 114, 
+101, 110, 116, 83, 116, 121, 108, 101, 72, 105, 110, 116, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 1, 18, 
+1, 19, 1, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 169, 0, 0, 0, 173, 0, 
+0, 0, 0, 0, 4, 11, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 
+0, 70, 128, 64, 0, 129, 192, 0, 0, 199, 0, 65, 0, 93, 64, 128, 
+1, 70, 128, 64, 0, 129, 64, 1, 0, 199, 128, 65, 0, 93, 64, 128, 
+1, 31, 0, 128, 0, 7, 0, 0, 0, 4, 15, 0, 0, 0, 0, 0, 
+0, 0, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 103, 99, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 99, 111, 108, 108, 101, 99, 116, 103, 97, 114, 
+98, 97, 103, 101, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+116, 112, 97, 117, 115, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+112, 97, 117, 115, 101, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 
+101, 116, 115, 116, 101, 112, 109, 117, 108, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 101, 112, 109, 117, 108, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 175, 0, 0, 0, 192, 0, 0, 
+0, 1, 0, 6, 40, 0, 0, 0, 70, 0, 64, 0, 71, 64, 192, 0, 
+133, 0, 128, 0, 157, 64, 128, 0, 133, 0, 0, 1, 155, 0, 0, 0, 
+23, 128, 1, 128, 134, 128, 64, 0, 193, 192, 0, 0, 157, 128, 0, 1, 
+197, 0, 0, 1, 26, 192, 0, 1, 23, 0, 0, 128, 31, 0, 128, 0, 
+133, 0, 128, 1, 157, 128, 128, 0, 199, 0, 193, 0, 141, 192, 0, 1, 
+197, 0, 0, 2, 221, 128, 128, 0, 219, 64, 0, 0, 23, 0, 4, 128, 
+198, 128, 64, 0, 1, 65, 1, 0, 71, 129, 193, 0, 221, 128, 128, 1, 
+219, 0, 0, 0, 23, 0, 1, 128, 198, 128, 64, 0, 1, 193, 0, 0, 
+221, 128, 0, 1, 201, 0, 0, 1, 31, 0, 128, 0, 197, 0, 128, 1, 
+221, 128, 128, 0, 26, 192, 0, 1, 23, 0, 251, 127, 31, 0, 128, 0, 
+23, 128, 250, 127, 31, 0, 128, 0, 7, 0, 0, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 
+110, 103, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 103, 99, 0, 
+4, 15, 0, 0, 0, 0, 0, 0, 0, 99, 111, 108, 108, 101, 99, 116, 
+103, 97, 114, 98, 97, 103, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 99, 111, 117, 110, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+98, 117, 100, 103, 101, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+115, 116, 101, 112, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+101, 112, 115, 105, 122, 101, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+0, 1, 24, 1, 23, 1, 12, 1, 8, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 194, 0, 0, 
+0, 202, 0, 0, 0, 0, 0, 2, 32, 0, 0, 0, 6, 0, 64, 0, 
+70, 0, 64, 0, 71, 64, 192, 0, 91, 64, 0, 0, 23, 0, 0, 128, 
+75, 0, 0, 0, 10, 64, 128, 128, 6, 0, 64, 0, 7, 64, 64, 0, 
+71, 128, 64, 0, 91, 64, 0, 0, 23, 0, 0, 128, 65, 192, 0, 0, 
+10, 64, 0, 129, 71, 0, 65, 0, 91, 64, 0, 0, 23, 0, 0, 128, 
+65, 192, 0, 0, 10, 64, 0, 130, 71, 64, 65, 0, 91, 64, 0, 0, 
+23, 0, 0, 128, 65, 128, 1, 0, 10, 64, 128, 130, 71, 192, 65, 0, 
+91, 64, 0, 0, 23, 0, 0, 128, 65, 0, 2, 0, 10, 64, 128, 131, 
+69, 0, 128, 0, 93, 64, 128, 0, 31, 0, 128, 0, 9, 0, 0, 0, 
+4, 15, 0, 0, 0, 0, 0, 0, 0, 71, 108, 111, 98, 97, 108, 83, 
+101, 116, 116, 105, 110, 103, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 103, 99, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 112, 97, 117, 
+115, 101, 0, 3, 0, 0, 0, 0, 0, 0, 105, 64, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 115, 116, 101, 112, 109, 117, 108, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 101, 112, 115, 105, 122, 101, 0, 3, 
+0, 0, 0, 0, 0, 0, 80, 64, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 98, 117, 100, 103, 101, 116, 0, 3, 154, 153, 153, 153, 153, 153, 169, 
+63, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 24, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 211, 0, 0, 0, 74, 1, 0, 0, 1, 0, 13, 91, 0, 0, 0, 
+70, 0, 64, 0, 93, 64, 128, 0, 70, 64, 64, 0, 133, 0, 128, 0, 
+93, 192, 0, 1, 155, 0, 0, 0, 23, 64, 2, 128, 204, 128, 64, 1, 
+65, 193, 0, 0, 221, 128, 128, 1, 219, 64, 0, 0, 23, 0, 1, 128, 
+198, 0, 65, 0, 1, 65, 1, 0, 64, 1, 0, 1, 22, 65, 1, 2, 
+221, 64, 0, 1, 155, 64, 0, 0, 23, 192, 0, 128, 198, 128, 65, 0, 
+0, 1, 128, 0, 70, 1, 65, 0, 221, 64, 128, 1, 70, 192, 65, 0, 
+71, 0, 194, 0, 93, 64, 128, 0, 70, 64, 66, 0, 93, 64, 128, 0, 
+69, 0, 128, 1, 93, 128, 128, 0, 73, 0, 0, 1, 69, 0, 0, 2, 
+93, 64, 128, 0, 27, 0, 0, 0, 23, 0, 1, 128, 70, 128, 66, 0, 
+71, 192, 194, 0, 128, 0, 0, 0, 93, 64, 0, 1, 23, 192, 0, 128, 
+70, 0, 67, 0, 134, 64, 67, 0, 135, 128, 67, 1, 93, 64, 0, 1, 
+75, 128, 1, 0, 165, 0, 0, 0, 74, 128, 128, 135, 165, 64, 0, 0, 
+74, 128, 0, 136, 139, 0, 128, 1, 198, 128, 66, 0, 199, 128, 196, 1, 
+6, 129, 66, 0, 7, 193, 68, 2, 70, 129, 66, 0, 71, 1, 197, 2, 
+164, 64, 128, 1, 74, 128, 128, 136, 139, 0, 128, 1, 198, 128, 66, 0, 
+199, 128, 196, 1, 6, 129, 66, 0, 7, 193, 68, 2, 70, 129, 66, 0, 
+71, 129, 197, 2, 164, 64, 128, 1, 74, 128, 128, 138, 134, 128, 66, 0, 
+135, 0, 70, 1, 74, 128, 128, 139, 165, 128, 0, 0, 74, 128, 128, 140, 
+165, 192, 0, 0, 229, 0, 1, 0, 6, 129, 65, 0, 64, 1, 128, 1, 
+134, 129, 70, 0, 29, 193, 128, 1, 27, 65, 0, 0, 23, 64, 254, 127, 
+134, 193, 70, 0, 193, 1, 7, 0, 1, 66, 7, 0, 65, 130, 7, 0, 
+129, 194, 7, 0, 193, 2, 8, 0, 0, 3, 128, 2, 22, 2, 3, 4, 
+157, 65, 128, 1, 23, 192, 251, 127, 31, 0, 128, 0, 33, 0, 0, 0, 
+4, 19, 0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 71, 108, 111, 
+98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 108, 111, 97, 100, 102, 105, 108, 101, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 26, 0, 0, 
+0, 0, 0, 0, 0, 78, 111, 32, 115, 117, 99, 104, 32, 102, 105, 108, 
+101, 32, 111, 114, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 69, 114, 114, 111, 114, 
+0, 4, 32, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 103, 
+32, 102, 105, 108, 101, 32, 99, 111, 109, 112, 105, 108, 97, 116, 105, 111, 
+110, 32, 101, 114, 114, 111, 114, 58, 32, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 120, 112, 99, 97, 108, 108, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 119, 103, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 105, 
+110, 105, 116, 115, 99, 114, 101, 101, 110, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 16, 0, 
+0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 70, 
+105, 114, 101, 69, 118, 101, 110, 116, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 69, 118, 101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 76, 111, 97, 100, 101, 100, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 69, 83, 
+73, 90, 69, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 
+95, 82, 69, 68, 82, 65, 87, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 32, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 67, 104, 101, 99, 
+107, 112, 111, 105, 110, 116, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 
+84, 121, 112, 101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 99, 116, 101, 
+100, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 83, 112, 108, 105, 116, 
+67, 117, 114, 114, 101, 110, 116, 87, 111, 114, 100, 0, 4, 11, 0, 0, 
+0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 0, 
+4, 22, 0, 0, 0, 0, 0, 0, 0, 83, 112, 108, 105, 116, 67, 117, 
+114, 114, 101, 110, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 
+11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 69, 83, 67, 65, 
+80, 69, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 65, 99, 116, 105, 
+118, 97, 116, 101, 77, 101, 110, 117, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 75, 69, 89, 95, 80, 65, 83, 84, 69, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 84, 114, 97, 99, 101, 98, 97, 99, 107, 0, 4, 
+13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 
+115, 97, 103, 101, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 73, 110, 
+116, 101, 114, 110, 97, 108, 32, 101, 114, 114, 111, 114, 33, 0, 4, 55, 
+0, 0, 0, 0, 0, 0, 0, 83, 111, 109, 101, 116, 104, 105, 110, 103, 
+32, 119, 101, 110, 116, 32, 119, 114, 111, 110, 103, 32, 105, 110, 115, 105, 
+100, 101, 32, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 33, 32, 
+73, 39, 108, 108, 32, 116, 114, 121, 32, 97, 110, 100, 32, 0, 4, 61, 
+0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 116, 105, 110, 117, 101, 32, 
+98, 117, 116, 32, 121, 111, 117, 32, 115, 104, 111, 117, 108, 100, 32, 115, 
+97, 118, 101, 32, 121, 111, 117, 114, 32, 119, 111, 114, 107, 32, 105, 109, 
+109, 101, 100, 105, 97, 116, 101, 108, 121, 32, 40, 117, 110, 100, 101, 114, 
+32, 97, 32, 0, 4, 61, 0, 0, 0, 0, 0, 0, 0, 100, 105, 102, 
+102, 101, 114, 101, 110, 116, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 
+44, 32, 101, 120, 105, 116, 44, 32, 97, 110, 100, 32, 115, 101, 110, 100, 
+32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 105, 110, 103, 32, 116, 
+101, 99, 104, 110, 105, 99, 97, 108, 32, 0, 4, 29, 0, 0, 0, 0, 
+0, 0, 0, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 32, 116, 
+111, 32, 116, 104, 101, 32, 97, 117, 116, 104, 111, 114, 58, 10, 10, 0, 
+5, 0, 0, 0, 239, 0, 0, 0, 242, 0, 0, 0, 0, 0, 2, 5, 
+0, 0, 0, 6, 0, 64, 0, 29, 64, 128, 0, 6, 64, 64, 0, 29, 
+64, 128, 0, 31, 0, 128, 0, 2, 0, 0, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 
+83, 99, 114, 101, 101, 110, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 244, 0, 0, 0, 247, 0, 0, 0, 0, 0, 2, 
+5, 0, 0, 0, 6, 0, 64, 0, 29, 64, 128, 0, 6, 64, 64, 0, 
+29, 64, 128, 0, 31, 0, 128, 0, 2, 0, 0, 0, 4, 17, 0, 0, 
+0, 0, 0, 0, 0, 73, 110, 118, 97, 108, 105, 100, 97, 116, 101, 83, 
+99, 114, 101, 101, 110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 
+101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 5, 1, 
+0, 0, 0, 0, 2, 13, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 
+0, 29, 64, 128, 0, 6, 0, 64, 0, 7, 128, 64, 0, 29, 64, 128, 
+0, 6, 0, 64, 0, 7, 192, 64, 0, 69, 0, 128, 0, 93, 0, 128, 
+0, 30, 0, 0, 0, 31, 0, 0, 0, 31, 0, 128, 0, 4, 0, 0, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 67, 104, 101, 99, 107, 112, 111, 105, 110, 
+116, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 84, 121, 112, 101, 87, 
+104, 105, 108, 101, 83, 101, 108, 101, 99, 116, 101, 100, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 73, 110, 115, 101, 114, 116, 84, 101, 120, 116, 
+0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 8, 1, 0, 0, 30, 1, 0, 0, 1, 0, 7, 44, 0, 0, 0, 
+70, 0, 0, 0, 91, 0, 0, 0, 23, 192, 0, 128, 134, 0, 192, 0, 
+192, 0, 128, 0, 157, 64, 0, 1, 23, 192, 8, 128, 140, 64, 64, 0, 
+1, 129, 0, 0, 157, 128, 128, 1, 155, 64, 0, 0, 23, 128, 2, 128, 
+134, 192, 192, 0, 135, 0, 65, 1, 157, 64, 128, 0, 134, 192, 192, 0, 
+135, 64, 65, 1, 157, 64, 128, 0, 134, 192, 192, 0, 135, 128, 65, 1, 
+192, 0, 0, 0, 157, 64, 0, 1, 23, 192, 4, 128, 134, 192, 193, 0, 
+135, 0, 66, 1, 140, 64, 66, 1, 0, 1, 0, 0, 157, 128, 128, 1, 
+64, 0, 0, 1, 91, 0, 0, 0, 23, 192, 0, 128, 134, 0, 192, 0, 
+192, 0, 128, 0, 157, 64, 0, 1, 23, 192, 1, 128, 134, 128, 194, 0, 
+204, 192, 66, 0, 65, 129, 0, 0, 129, 1, 3, 0, 221, 128, 0, 2, 
+1, 65, 3, 0, 214, 0, 129, 1, 157, 64, 0, 1, 31, 0, 128, 0, 
+14, 0, 0, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 
+77, 101, 110, 117, 65, 99, 116, 105, 111, 110, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 109, 97, 116, 99, 104, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 94, 75, 69, 89, 95, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 67, 109, 100, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 67, 
+104, 101, 99, 107, 112, 111, 105, 110, 116, 0, 4, 18, 0, 0, 0, 0, 
+0, 0, 0, 84, 121, 112, 101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 
+99, 116, 101, 100, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 73, 110, 
+115, 101, 114, 116, 83, 116, 114, 105, 110, 103, 73, 110, 116, 111, 87, 111, 
+114, 100, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 
+109, 101, 110, 116, 83, 101, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 109, 101, 110, 117, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 108, 
+111, 111, 107, 117, 112, 65, 99, 99, 101, 108, 101, 114, 97, 116, 111, 114, 
+0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 
+97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 103, 115, 117, 98, 0, 4, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 4, 40, 0, 0, 0, 0, 0, 0, 0, 32, 105, 115, 32, 110, 
+111, 116, 32, 98, 111, 117, 110, 100, 32, 45, 45, 45, 32, 116, 114, 121, 
+32, 69, 83, 67, 65, 80, 69, 32, 102, 111, 114, 32, 97, 32, 109, 101, 
+110, 117, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 32, 1, 0, 0, 62, 1, 0, 0, 0, 0, 10, 62, 0, 
+0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 65, 128, 0, 0, 29, 128, 
+0, 1, 70, 192, 64, 0, 71, 0, 193, 0, 91, 0, 0, 0, 23, 64, 
+1, 128, 70, 64, 65, 0, 134, 128, 65, 0, 135, 192, 65, 1, 93, 64, 
+0, 1, 70, 192, 64, 0, 74, 0, 66, 130, 70, 64, 66, 0, 93, 64, 
+128, 0, 70, 64, 65, 0, 134, 128, 65, 0, 135, 128, 66, 1, 93, 64, 
+0, 1, 69, 0, 128, 0, 93, 128, 128, 0, 134, 192, 66, 0, 157, 64, 
+128, 0, 133, 0, 0, 1, 192, 0, 128, 0, 157, 64, 0, 1, 134, 0, 
+67, 0, 135, 64, 67, 1, 135, 128, 67, 1, 197, 0, 128, 1, 221, 128, 
+128, 0, 219, 0, 0, 0, 23, 64, 248, 127, 197, 0, 0, 2, 219, 0, 
+0, 0, 23, 64, 1, 128, 197, 0, 128, 2, 221, 128, 128, 0, 5, 1, 
+0, 3, 206, 0, 129, 1, 25, 128, 128, 1, 23, 0, 246, 127, 198, 192, 
+67, 0, 5, 1, 128, 3, 29, 1, 128, 0, 221, 0, 1, 0, 23, 0, 
+2, 128, 5, 2, 0, 1, 64, 2, 128, 3, 29, 66, 0, 1, 5, 2, 
+0, 2, 27, 2, 0, 0, 23, 128, 0, 128, 6, 2, 68, 4, 13, 66, 
+68, 4, 8, 2, 2, 136, 226, 128, 0, 0, 99, 1, 253, 127, 23, 64, 
+248, 127, 23, 128, 241, 127, 31, 0, 128, 0, 18, 0, 0, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 114, 0, 3, 0, 0, 0, 
+0, 0, 0, 42, 64, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 106, 117, 115, 116, 99, 104, 97, 110, 103, 101, 100, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 70, 105, 114, 101, 69, 118, 101, 110, 
+116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 67, 104, 97, 110, 103, 101, 
+100, 0, 1, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 70, 108, 117, 
+115, 104, 65, 115, 121, 110, 99, 69, 118, 101, 110, 116, 115, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 87, 97, 105, 116, 105, 110, 103, 70, 111, 
+114, 85, 115, 101, 114, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 82, 
+101, 115, 101, 116, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 
+97, 103, 101, 115, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 71, 108, 
+111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 114, 101, 100, 114, 97, 119, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 109, 97, 120, 108, 97, 116, 101, 110, 99, 121, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 100, 101, 102, 101, 114, 114, 
+101, 100, 107, 101, 121, 115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 6, 1, 2, 0, 7, 
+0, 8, 0, 3, 0, 2, 0, 9, 0, 10, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 
+0, 0, 0, 0, 1, 17, 1, 14, 1, 12, 1, 21, 1, 10, 1, 22, 
+1, 8, 1, 13, 1, 9, 1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 1, 0, 0, 
+252, 1, 0, 0, 0, 1, 20, 123, 0, 0, 0, 6, 0, 64, 0, 29, 
+64, 128, 0, 4, 0, 0, 0, 70, 64, 64, 0, 71, 128, 192, 0, 134, 
+64, 64, 0, 135, 192, 64, 1, 229, 0, 0, 0, 37, 65, 0, 0, 101, 
+129, 0, 0, 165, 193, 0, 0, 229, 1, 1, 0, 11, 130, 1, 0, 10, 
+194, 0, 130, 10, 194, 128, 130, 10, 2, 1, 131, 10, 66, 129, 131, 10, 
+66, 1, 132, 10, 130, 129, 132, 70, 130, 66, 0, 91, 2, 0, 0, 23, 
+192, 255, 127, 101, 66, 1, 0, 139, 2, 0, 0, 230, 2, 0, 0, 164, 
+66, 0, 0, 193, 194, 2, 0, 21, 3, 0, 5, 26, 0, 131, 5, 151, 
+128, 17, 128, 7, 195, 2, 5, 68, 3, 0, 0, 140, 3, 67, 6, 1, 
+68, 3, 0, 157, 131, 128, 1, 24, 128, 67, 7, 23, 128, 13, 128, 140, 
+3, 67, 6, 1, 196, 2, 0, 157, 131, 128, 1, 24, 128, 67, 7, 23, 
+192, 4, 128, 140, 195, 67, 6, 1, 4, 4, 0, 157, 131, 128, 1, 0, 
+3, 0, 7, 135, 3, 3, 4, 155, 67, 0, 0, 23, 0, 1, 128, 192, 
+3, 128, 4, 1, 68, 4, 0, 64, 4, 0, 6, 22, 68, 4, 8, 221, 
+67, 0, 1, 192, 3, 0, 7, 5, 4, 0, 1, 64, 4, 0, 5, 141, 
+68, 195, 5, 29, 4, 128, 1, 221, 131, 0, 0, 205, 194, 131, 5, 23, 
+192, 8, 128, 140, 195, 67, 6, 1, 196, 2, 0, 65, 196, 2, 0, 157, 
+131, 0, 2, 199, 131, 3, 4, 219, 67, 0, 0, 23, 0, 1, 128, 0, 
+4, 128, 4, 65, 132, 4, 0, 128, 4, 0, 7, 86, 132, 132, 8, 29, 
+68, 0, 1, 12, 196, 67, 6, 129, 4, 4, 0, 29, 132, 128, 1, 64, 
+3, 0, 8, 24, 192, 196, 6, 23, 192, 1, 128, 0, 4, 128, 7, 69, 
+4, 0, 1, 128, 4, 0, 5, 205, 68, 195, 5, 93, 4, 128, 1, 29, 
+132, 0, 0, 205, 2, 132, 5, 23, 64, 2, 128, 0, 4, 128, 7, 64, 
+4, 128, 6, 29, 68, 0, 1, 23, 64, 1, 128, 27, 0, 0, 0, 23, 
+128, 0, 128, 134, 3, 69, 0, 193, 67, 5, 0, 157, 67, 0, 1, 0, 
+0, 0, 6, 205, 66, 195, 5, 23, 128, 237, 127, 151, 192, 255, 127, 27, 
+0, 0, 0, 23, 192, 3, 128, 76, 128, 69, 0, 193, 192, 5, 0, 93, 
+128, 128, 1, 91, 64, 0, 0, 23, 128, 2, 128, 76, 128, 69, 0, 193, 
+0, 6, 0, 93, 128, 128, 1, 91, 64, 0, 0, 23, 64, 1, 128, 70, 
+64, 70, 0, 71, 128, 198, 0, 93, 128, 128, 0, 129, 192, 6, 0, 192, 
+0, 0, 0, 22, 192, 128, 0, 70, 0, 71, 0, 128, 0, 0, 0, 93, 
+64, 0, 1, 31, 0, 128, 0, 29, 0, 0, 0, 4, 17, 0, 0, 0, 
+0, 0, 0, 0, 82, 101, 115, 101, 116, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 105, 111, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 100, 111, 117, 116, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 100, 101, 114, 114, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 104, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 104, 101, 108, 112, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 108, 117, 97, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+99, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 118, 101, 
+114, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 
+105, 103, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 68, 69, 66, 85, 
+71, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 98, 121, 116, 101, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 3, 0, 0, 0, 0, 0, 128, 70, 64, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 115, 117, 98, 0, 3, 0, 0, 0, 0, 0, 0, 8, 
+64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 45, 0, 4, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 69, 114, 
+114, 111, 114, 0, 4, 34, 0, 0, 0, 0, 0, 0, 0, 121, 111, 117, 
+32, 109, 97, 121, 32, 111, 110, 108, 121, 32, 115, 112, 101, 99, 105, 102, 
+121, 32, 111, 110, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 94, 47, 0, 4, 15, 0, 0, 0, 0, 0, 
+0, 0, 94, 91, 97, 45, 122, 65, 45, 90, 93, 58, 91, 47, 92, 93, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 108, 102, 115, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 114, 101, 110, 116, 100, 105, 
+114, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 47, 0, 4, 14, 0, 
+0, 0, 0, 0, 0, 0, 87, 111, 114, 100, 80, 114, 111, 99, 101, 115, 
+115, 111, 114, 0, 6, 0, 0, 0, 89, 1, 0, 0, 129, 1, 0, 0, 
+1, 0, 6, 28, 0, 0, 0, 69, 0, 0, 0, 76, 0, 192, 0, 193, 
+64, 0, 0, 6, 129, 192, 0, 65, 193, 0, 0, 93, 64, 128, 2, 70, 
+0, 193, 0, 91, 0, 0, 0, 23, 192, 0, 128, 69, 0, 0, 0, 76, 
+0, 192, 0, 193, 64, 1, 0, 93, 64, 128, 1, 69, 0, 0, 0, 76, 
+0, 192, 0, 193, 128, 1, 0, 5, 1, 0, 1, 65, 193, 1, 0, 214, 
+64, 129, 1, 93, 64, 128, 1, 70, 0, 193, 0, 91, 0, 0, 0, 23, 
+192, 255, 127, 70, 0, 194, 0, 71, 64, 194, 0, 129, 128, 2, 0, 93, 
+64, 0, 1, 31, 0, 128, 0, 11, 0, 0, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 119, 114, 105, 116, 101, 0, 4, 21, 0, 0, 0, 0, 
+0, 0, 0, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 32, 118, 
+101, 114, 115, 105, 111, 110, 32, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 86, 69, 82, 83, 73, 79, 78, 0, 4, 27, 0, 0, 0, 0, 0, 
+0, 0, 32, 194, 169, 32, 50, 48, 48, 55, 45, 50, 48, 48, 56, 32, 
+68, 97, 118, 105, 100, 32, 71, 105, 118, 101, 110, 10, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 68, 69, 66, 85, 71, 0, 4, 58, 0, 0, 
+0, 0, 0, 0, 0, 40, 84, 104, 105, 115, 32, 118, 101, 114, 115, 105, 
+111, 110, 32, 104, 97, 115, 32, 98, 101, 101, 110, 32, 99, 111, 109, 112, 
+105, 108, 101, 100, 32, 119, 105, 116, 104, 32, 100, 101, 98, 117, 103, 103, 
+105, 110, 103, 32, 101, 110, 97, 98, 108, 101, 100, 46, 41, 10, 0, 4, 
+72, 4, 0, 0, 0, 0, 0, 0, 83, 121, 110, 116, 97, 120, 58, 32, 
+119, 111, 114, 100, 103, 114, 105, 110, 100, 101, 114, 32, 91, 60, 111, 112, 
+116, 105, 111, 110, 115, 46, 46, 46, 62, 93, 32, 91, 60, 102, 105, 108, 
+101, 110, 97, 109, 101, 62, 93, 10, 79, 112, 116, 105, 111, 110, 115, 58, 
+10, 32, 32, 32, 45, 104, 32, 32, 32, 32, 45, 45, 104, 101, 108, 112, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+68, 105, 115, 112, 108, 97, 121, 115, 32, 116, 104, 105, 115, 32, 109, 101, 
+115, 115, 97, 103, 101, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+45, 45, 108, 117, 97, 32, 102, 105, 108, 101, 46, 108, 117, 97, 32, 32, 
+32, 32, 32, 32, 32, 32, 76, 111, 97, 100, 115, 32, 97, 110, 100, 32, 
+101, 120, 101, 99, 117, 116, 101, 115, 32, 102, 105, 108, 101, 46, 108, 117, 
+97, 32, 97, 110, 100, 32, 116, 104, 101, 110, 32, 101, 120, 105, 116, 115, 
+10, 9, 9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 111, 114, 32, 102, 105, 
+108, 101, 46, 108, 117, 97, 32, 99, 97, 110, 32, 98, 101, 32, 115, 111, 
+109, 101, 32, 76, 117, 97, 32, 115, 116, 97, 116, 101, 109, 101, 110, 116, 
+115, 41, 10, 32, 32, 32, 45, 99, 32, 32, 32, 32, 45, 45, 99, 111, 
+110, 118, 101, 114, 116, 32, 115, 114, 99, 32, 100, 101, 115, 116, 46, 46, 
+46, 32, 67, 111, 110, 118, 101, 114, 116, 115, 32, 102, 114, 111, 109, 32, 
+111, 110, 101, 32, 102, 105, 108, 101, 32, 102, 111, 114, 109, 97, 116, 32, 
+116, 111, 32, 111, 116, 104, 101, 114, 115, 10, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 45, 45, 99, 111, 110, 102, 105, 103, 32, 102, 105, 108, 101, 
+46, 108, 117, 97, 32, 32, 32, 32, 32, 83, 101, 116, 115, 32, 116, 104, 
+101, 32, 110, 97, 109, 101, 32, 111, 102, 32, 116, 104, 101, 32, 117, 115, 
+101, 114, 32, 99, 111, 110, 102, 105, 103, 32, 102, 105, 108, 101, 10, 10, 
+79, 110, 108, 121, 32, 111, 110, 101, 32, 102, 105, 108, 101, 110, 97, 109, 
+101, 32, 109, 97, 121, 32, 98, 101, 32, 115, 112, 101, 99, 105, 102, 105, 
+101, 100, 44, 32, 119, 104, 105, 99, 104, 32, 105, 115, 32, 116, 104, 101, 
+32, 110, 97, 109, 101, 32, 111, 102, 32, 97, 32, 87, 111, 114, 100, 71, 
+114, 105, 110, 100, 101, 114, 10, 102, 105, 108, 101, 32, 116, 111, 32, 108, 
+111, 97, 100, 32, 111, 110, 32, 115, 116, 97, 114, 116, 117, 112, 46, 32, 
+73, 102, 32, 110, 111, 116, 32, 103, 105, 118, 101, 110, 44, 32, 121, 111, 
+117, 32, 103, 101, 116, 32, 97, 32, 98, 108, 97, 110, 107, 32, 100, 111, 
+99, 117, 109, 101, 110, 116, 32, 105, 110, 115, 116, 101, 97, 100, 46, 10, 
+10, 84, 111, 32, 99, 111, 110, 118, 101, 114, 116, 32, 100, 111, 99, 117, 
+109, 101, 110, 116, 115, 44, 32, 117, 115, 101, 32, 45, 45, 99, 111, 110, 
+118, 101, 114, 116, 46, 32, 84, 104, 101, 32, 102, 105, 108, 101, 32, 116, 
+121, 112, 101, 32, 105, 115, 32, 97, 117, 116, 111, 100, 101, 116, 101, 99, 
+116, 101, 100, 32, 102, 114, 111, 109, 32, 116, 104, 101, 10, 101, 120, 116, 
+101, 110, 115, 105, 111, 110, 46, 32, 84, 111, 32, 115, 112, 101, 99, 105, 
+102, 121, 32, 97, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 110, 97, 
+109, 101, 44, 32, 117, 115, 101, 32, 58, 110, 97, 109, 101, 32, 97, 115, 
+32, 97, 32, 115, 117, 102, 102, 105, 120, 46, 32, 101, 46, 103, 46, 58, 
+10, 10, 32, 32, 32, 32, 119, 111, 114, 100, 103, 114, 105, 110, 100, 101, 
+114, 32, 45, 45, 99, 111, 110, 118, 101, 114, 116, 32, 102, 105, 108, 101, 
+110, 97, 109, 101, 46, 119, 103, 58, 34, 67, 104, 97, 112, 116, 101, 114, 
+32, 49, 34, 32, 99, 104, 97, 112, 116, 101, 114, 49, 46, 111, 100, 116, 
+10, 10, 73, 102, 32, 115, 101, 118, 101, 114, 97, 108, 32, 100, 101, 115, 
+116, 105, 110, 97, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 103, 105, 
+118, 101, 110, 44, 32, 116, 104, 101, 32, 100, 111, 99, 117, 109, 101, 110, 
+116, 32, 105, 115, 32, 114, 101, 97, 100, 32, 111, 110, 99, 101, 32, 97, 
+110, 100, 32, 97, 108, 108, 32, 116, 104, 101, 10, 101, 120, 112, 111, 114, 
+116, 101, 100, 32, 102, 105, 108, 101, 115, 32, 97, 114, 101, 32, 119, 114, 
+105, 116, 116, 101, 110, 32, 105, 110, 32, 97, 32, 115, 105, 110, 103, 108, 
+101, 32, 112, 97, 115, 115, 32, 111, 118, 101, 114, 32, 105, 116, 58, 10, 
+10, 32, 32, 32, 32, 119, 111, 114, 100, 103, 114, 105, 110, 100, 101, 114, 
+32, 45, 45, 99, 111, 110, 118, 101, 114, 116, 32, 102, 105, 108, 101, 110, 
+97, 109, 101, 46, 119, 103, 32, 99, 104, 97, 112, 116, 101, 114, 49, 46, 
+111, 100, 116, 32, 99, 104, 97, 112, 116, 101, 114, 49, 46, 104, 116, 109, 
+108, 32, 99, 104, 97, 112, 116, 101, 114, 49, 46, 116, 120, 116, 10, 10, 
+84, 104, 101, 32, 117, 115, 101, 114, 32, 99, 111, 110, 102, 105, 103, 32, 
+102, 105, 108, 101, 32, 105, 115, 32, 97, 32, 76, 117, 97, 32, 102, 105, 
+108, 101, 32, 119, 104, 105, 99, 104, 32, 105, 115, 32, 108, 111, 97, 100, 
+101, 100, 32, 97, 110, 100, 32, 101, 120, 101, 99, 117, 116, 101, 100, 32, 
+98, 101, 102, 111, 114, 101, 10, 116, 104, 101, 32, 112, 114, 111, 103, 114, 
+97, 109, 32, 115, 116, 97, 114, 116, 115, 32, 117, 112, 32, 40, 98, 117, 
+116, 32, 97, 102, 116, 101, 114, 32, 97, 110, 121, 32, 45, 45, 108, 117, 
+97, 32, 102, 105, 108, 101, 115, 41, 46, 32, 73, 116, 32, 100, 101, 102, 
+97, 117, 108, 116, 115, 32, 116, 111, 58, 10, 10, 32, 32, 32, 32, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 10, 10, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 111, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 101, 120, 105, 116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 3, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 131, 1, 0, 0, 146, 1, 0, 0, 2, 0, 7, 35, 0, 0, 0, 
+27, 64, 0, 0, 23, 128, 0, 128, 134, 0, 64, 0, 193, 64, 0, 0, 
+157, 64, 0, 1, 134, 128, 64, 0, 192, 0, 0, 0, 157, 192, 0, 1, 
+219, 0, 0, 0, 23, 64, 2, 128, 12, 193, 192, 1, 129, 1, 1, 0, 
+29, 129, 128, 1, 27, 1, 0, 0, 23, 0, 1, 128, 6, 65, 65, 0, 
+64, 1, 0, 0, 29, 193, 0, 1, 192, 0, 128, 2, 128, 0, 0, 2, 
+219, 0, 0, 0, 23, 0, 1, 128, 6, 1, 64, 0, 65, 129, 1, 0, 
+128, 1, 128, 1, 86, 129, 129, 2, 29, 65, 0, 1, 0, 1, 0, 1, 
+64, 1, 128, 0, 29, 65, 0, 1, 6, 193, 65, 0, 7, 1, 66, 2, 
+65, 65, 2, 0, 29, 65, 0, 1, 31, 0, 128, 0, 10, 0, 0, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 69, 114, 114, 111, 
+114, 0, 4, 28, 0, 0, 0, 0, 0, 0, 0, 45, 45, 108, 117, 97, 
+32, 109, 117, 115, 116, 32, 104, 97, 118, 101, 32, 97, 110, 32, 97, 114, 
+103, 117, 109, 101, 110, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+108, 111, 97, 100, 102, 105, 108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 102, 105, 110, 100, 0, 4, 26, 0, 0, 0, 0, 0, 0, 0, 
+78, 111, 32, 115, 117, 99, 104, 32, 102, 105, 108, 101, 32, 111, 114, 32, 
+100, 105, 114, 101, 99, 116, 111, 114, 121, 0, 4, 11, 0, 0, 0, 0, 
+0, 0, 0, 108, 111, 97, 100, 115, 116, 114, 105, 110, 103, 0, 4, 32, 
+0, 0, 0, 0, 0, 0, 0, 117, 115, 101, 114, 32, 115, 99, 114, 105, 
+112, 116, 32, 99, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 32, 101, 
+114, 114, 111, 114, 58, 32, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+111, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 101, 120, 105, 116, 
+0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 148, 1, 0, 0, 165, 1, 0, 0, 
+1, 1, 10, 32, 0, 0, 0, 75, 0, 0, 0, 134, 0, 64, 0, 203, 
+0, 0, 0, 38, 1, 0, 0, 228, 64, 0, 0, 157, 0, 1, 1, 23, 
+192, 1, 128, 204, 65, 64, 3, 65, 130, 0, 0, 221, 129, 128, 1, 88, 
+192, 192, 3, 23, 0, 1, 128, 213, 1, 128, 0, 205, 129, 192, 3, 74, 
+128, 129, 3, 162, 128, 0, 0, 35, 65, 253, 127, 27, 0, 0, 0, 23, 
+128, 0, 128, 149, 0, 128, 0, 24, 0, 65, 1, 23, 128, 0, 128, 134, 
+64, 65, 0, 193, 128, 1, 0, 157, 64, 0, 1, 134, 192, 65, 0, 192, 
+0, 0, 0, 5, 1, 128, 0, 64, 1, 128, 0, 29, 1, 0, 1, 157, 
+64, 0, 0, 31, 0, 128, 0, 8, 0, 0, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 98, 121, 116, 101, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 3, 0, 0, 0, 0, 0, 128, 70, 64, 3, 0, 0, 0, 0, 
+0, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 
+69, 114, 114, 111, 114, 0, 4, 43, 0, 0, 0, 0, 0, 0, 0, 45, 
+45, 99, 111, 110, 118, 101, 114, 116, 32, 109, 117, 115, 116, 32, 104, 97, 
+118, 101, 32, 97, 116, 32, 108, 101, 97, 115, 116, 32, 116, 119, 111, 32, 
+97, 114, 103, 117, 109, 101, 110, 116, 115, 0, 4, 11, 0, 0, 0, 0, 
+0, 0, 0, 67, 108, 105, 67, 111, 110, 118, 101, 114, 116, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 1, 
+0, 0, 174, 1, 0, 0, 2, 0, 4, 9, 0, 0, 0, 27, 64, 0, 
+0, 23, 128, 0, 128, 134, 0, 64, 0, 193, 64, 0, 0, 157, 64, 0, 
+1, 9, 0, 128, 0, 129, 128, 0, 0, 159, 0, 0, 1, 31, 0, 128, 
+0, 3, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 76, 
+73, 69, 114, 114, 111, 114, 0, 4, 31, 0, 0, 0, 0, 0, 0, 0, 
+45, 45, 99, 111, 110, 102, 105, 103, 32, 109, 117, 115, 116, 32, 104, 97, 
+118, 101, 32, 97, 110, 32, 97, 114, 103, 117, 109, 101, 110, 116, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 2, 0, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 176, 1, 0, 0, 180, 1, 0, 0, 
+1, 0, 3, 6, 0, 0, 0, 27, 64, 0, 0, 23, 128, 0, 128, 70, 
+0, 64, 0, 129, 64, 0, 0, 93, 64, 0, 1, 31, 0, 128, 0, 2, 
+0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 69, 
+114, 114, 111, 114, 0, 4, 25, 0, 0, 0, 0, 0, 0, 0, 109, 105, 
+115, 115, 105, 110, 103, 32, 111, 112, 116, 105, 111, 110, 32, 112, 97, 114, 
+97, 109, 101, 116, 101, 114, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 198, 1, 0, 0, 200, 1, 0, 0, 1, 0, 5, 
+6, 0, 0, 0, 70, 0, 64, 0, 129, 64, 0, 0, 192, 0, 0, 0, 
+1, 129, 0, 0, 93, 64, 0, 2, 31, 0, 128, 0, 3, 0, 0, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 69, 114, 114, 111, 
+114, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 117, 110, 114, 101, 99, 
+111, 103, 110, 105, 115, 101, 100, 32, 111, 112, 116, 105, 111, 110, 32, 39, 
+0, 4, 26, 0, 0, 0, 0, 0, 0, 0, 39, 32, 45, 45, 45, 32, 
+116, 114, 121, 32, 45, 45, 104, 101, 108, 112, 32, 102, 111, 114, 32, 104, 
+101, 108, 112, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 3, 0, 0, 0, 0, 0, 1, 17, 1, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/xml.lua */
+static const char file_5[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 9, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 165, 0, 0, 0, 8, 128, 0, 130, 165, 64, 0, 0, 8, 128, 128, 
+130, 31, 0, 128, 0, 6, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 119, 103, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 116, 111, 
+107, 101, 110, 105, 115, 101, 120, 109, 108, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 102, 105, 110, 100, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 84, 111, 107, 101, 110, 105, 115, 101, 88, 77, 76, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 80, 97, 114, 115, 101, 88, 77, 76, 0, 2, 
+0, 0, 0, 18, 0, 0, 0, 57, 0, 0, 0, 1, 0, 4, 7, 0, 
+0, 0, 69, 0, 0, 0, 128, 0, 0, 0, 93, 128, 0, 1, 165, 0, 
+0, 0, 229, 64, 0, 0, 223, 0, 0, 1, 31, 0, 128, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 21, 0, 0, 0, 39, 0, 0, 0, 1, 0, 
+15, 26, 0, 0, 0, 75, 0, 0, 0, 134, 0, 64, 0, 192, 0, 0, 
+0, 157, 0, 1, 1, 23, 0, 4, 128, 193, 65, 0, 0, 0, 2, 128, 
+2, 69, 2, 128, 0, 128, 2, 128, 2, 193, 130, 0, 0, 93, 66, 129, 
+1, 219, 2, 0, 0, 23, 64, 0, 128, 192, 1, 128, 5, 0, 2, 0, 
+6, 85, 3, 128, 0, 77, 195, 192, 6, 139, 195, 0, 0, 138, 195, 1, 
+130, 138, 3, 130, 130, 138, 131, 1, 131, 74, 128, 131, 6, 162, 128, 0, 
+0, 35, 1, 251, 127, 95, 0, 0, 1, 31, 0, 128, 0, 7, 0, 0, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 112, 97, 105, 114, 115, 0, 
+4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 94, 40, 46, 42, 41, 32, 40, 91, 94, 32, 93, 42, 41, 
+36, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 110, 97, 109, 101, 115, 112, 97, 99, 101, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 56, 
+0, 0, 0, 0, 0, 7, 51, 0, 0, 0, 5, 0, 0, 0, 29, 64, 
+129, 0, 24, 0, 64, 0, 23, 64, 2, 128, 11, 1, 1, 0, 10, 1, 
+128, 128, 10, 65, 0, 129, 10, 129, 128, 129, 69, 1, 128, 0, 128, 1, 
+128, 1, 93, 129, 0, 1, 10, 65, 1, 130, 31, 1, 0, 1, 23, 64, 
+8, 128, 24, 64, 65, 0, 23, 64, 1, 128, 11, 193, 0, 0, 10, 1, 
+128, 128, 10, 65, 0, 129, 10, 129, 128, 129, 31, 1, 0, 1, 23, 64, 
+6, 128, 88, 128, 65, 0, 23, 64, 0, 128, 24, 192, 65, 0, 23, 0, 
+1, 128, 11, 129, 0, 0, 10, 129, 193, 128, 10, 65, 0, 131, 31, 1, 
+0, 1, 23, 0, 4, 128, 24, 0, 66, 0, 23, 0, 2, 128, 11, 193, 
+0, 0, 10, 1, 128, 128, 10, 65, 128, 129, 69, 1, 128, 0, 128, 1, 
+0, 1, 93, 129, 0, 1, 10, 65, 1, 130, 31, 1, 0, 1, 23, 64, 
+1, 128, 24, 64, 66, 0, 23, 192, 0, 128, 11, 129, 0, 0, 10, 1, 
+128, 128, 10, 65, 0, 131, 31, 1, 0, 1, 4, 1, 0, 0, 31, 1, 
+0, 1, 31, 0, 128, 0, 10, 0, 0, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 111, 112, 101, 110, 116, 97, 103, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 101, 118, 101, 110, 116, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 110, 97, 109, 101, 115, 112, 97, 99, 101, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 97, 116, 116, 114, 115, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 99, 108, 111, 115, 101, 116, 97, 103, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 116, 101, 120, 116, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 99, 100, 97, 116, 97, 0, 4, 11, 0, 0, 0, 0, 0, 
+0, 0, 112, 114, 111, 99, 101, 115, 115, 105, 110, 103, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 101, 114, 114, 111, 114, 0, 0, 0, 0, 0, 
+2, 0, 0, 0, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 98, 0, 
+0, 0, 1, 0, 11, 22, 0, 0, 0, 69, 0, 0, 0, 128, 0, 0, 
+0, 93, 128, 0, 1, 165, 0, 0, 0, 192, 0, 128, 0, 221, 64, 129, 
+0, 24, 0, 192, 1, 23, 64, 1, 128, 192, 1, 0, 1, 0, 2, 0, 
+2, 64, 2, 128, 2, 128, 2, 0, 3, 222, 1, 0, 2, 223, 1, 0, 
+0, 219, 0, 0, 0, 23, 64, 0, 128, 24, 64, 192, 1, 23, 64, 252, 
+127, 203, 1, 0, 0, 223, 1, 0, 1, 23, 128, 251, 127, 31, 0, 128, 
+0, 2, 0, 0, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 111, 112, 
+101, 110, 116, 97, 103, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 101, 
+114, 114, 111, 114, 0, 1, 0, 0, 0, 67, 0, 0, 0, 85, 0, 0, 
+0, 3, 0, 13, 40, 0, 0, 0, 192, 0, 0, 1, 88, 0, 64, 0, 
+23, 64, 1, 128, 0, 1, 0, 0, 65, 129, 0, 0, 128, 1, 128, 0, 
+22, 129, 1, 2, 202, 0, 129, 128, 23, 0, 0, 128, 202, 64, 128, 128, 
+5, 1, 0, 0, 29, 65, 129, 0, 24, 192, 64, 2, 23, 0, 2, 128, 
+21, 2, 128, 1, 13, 2, 65, 4, 69, 2, 128, 0, 128, 2, 128, 2, 
+192, 2, 0, 3, 0, 3, 128, 3, 93, 130, 0, 2, 202, 64, 2, 4, 
+23, 128, 252, 127, 88, 64, 65, 2, 23, 64, 0, 128, 24, 128, 65, 2, 
+23, 192, 0, 128, 21, 2, 128, 1, 13, 2, 65, 4, 202, 64, 1, 4, 
+23, 128, 250, 127, 88, 192, 65, 2, 23, 192, 0, 128, 27, 1, 0, 0, 
+23, 64, 0, 128, 24, 0, 66, 2, 23, 0, 249, 127, 223, 0, 0, 1, 
+23, 128, 248, 127, 31, 0, 128, 0, 9, 0, 0, 0, 4, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 95, 
+110, 97, 109, 101, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 111, 112, 101, 110, 116, 97, 103, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 116, 101, 120, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 99, 100, 97, 116, 97, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+99, 108, 111, 115, 101, 116, 97, 103, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 101, 114, 114, 111, 114, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/utils.lua */
+static const char file_6[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 30, 0, 0, 
+0, 37, 0, 0, 0, 8, 0, 0, 128, 37, 64, 0, 0, 8, 0, 128, 
+128, 37, 128, 0, 0, 8, 0, 0, 129, 37, 192, 0, 0, 8, 0, 128, 
+129, 37, 0, 1, 0, 8, 0, 0, 130, 37, 64, 1, 0, 8, 0, 128, 
+130, 37, 128, 1, 0, 8, 0, 0, 131, 37, 192, 1, 0, 8, 0, 128, 
+131, 6, 0, 66, 0, 75, 0, 0, 0, 139, 64, 0, 0, 229, 0, 2, 
+0, 138, 192, 128, 132, 29, 128, 128, 1, 21, 0, 0, 0, 88, 128, 66, 
+0, 23, 0, 0, 128, 3, 64, 0, 0, 3, 0, 128, 0, 101, 64, 2, 
+0, 8, 64, 128, 133, 31, 0, 128, 0, 12, 0, 0, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 109, 97, 120, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 109, 105, 110, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 
+67, 97, 110, 111, 110, 105, 99, 97, 108, 105, 115, 101, 83, 116, 114, 105, 
+110, 103, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 80, 108, 117, 114, 
+97, 108, 105, 115, 101, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 76, 
+101, 97, 102, 110, 97, 109, 101, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 84, 114, 97, 99, 101, 98, 97, 99, 107, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 83, 112, 108, 105, 116, 83, 116, 114, 105, 110, 103, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 84, 97, 98, 108, 101, 84, 111, 
+83, 116, 114, 105, 110, 103, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 95, 95, 108, 101, 110, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 
+109, 117, 116, 97, 98, 108, 105, 115, 101, 65, 114, 114, 97, 121, 0, 10, 
+0, 0, 0, 5, 0, 0, 0, 11, 0, 0, 0, 2, 0, 2, 6, 0, 
+0, 0, 25, 0, 128, 0, 23, 64, 0, 128, 31, 0, 0, 1, 23, 0, 
+0, 128, 95, 0, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 19, 0, 
+0, 0, 2, 0, 2, 6, 0, 0, 0, 25, 64, 0, 0, 23, 64, 0, 
+128, 31, 0, 0, 1, 23, 0, 0, 128, 95, 0, 0, 1, 31, 0, 128, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 27, 0, 0, 0, 29, 0, 0, 0, 1, 0, 3, 6, 0, 0, 0, 
+70, 0, 64, 0, 71, 64, 192, 0, 128, 0, 0, 0, 94, 0, 0, 1, 
+95, 0, 0, 0, 31, 0, 128, 0, 2, 0, 0, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 119, 103, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 116, 114, 97, 110, 115, 99, 111, 100, 101, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 44, 0, 0, 
+0, 3, 0, 3, 6, 0, 0, 0, 24, 0, 64, 0, 23, 64, 0, 128, 
+95, 0, 0, 1, 23, 0, 0, 128, 159, 0, 0, 1, 31, 0, 128, 0, 
+1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 57, 0, 0, 
+0, 1, 0, 4, 8, 0, 0, 0, 76, 0, 64, 0, 193, 64, 0, 0, 
+93, 0, 129, 1, 219, 0, 0, 0, 23, 0, 0, 128, 223, 0, 0, 1, 
+31, 0, 0, 1, 31, 0, 128, 0, 2, 0, 0, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 40, 91, 94, 47, 92, 93, 43, 41, 36, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 77, 0, 0, 
+0, 1, 0, 8, 28, 0, 0, 0, 65, 0, 0, 0, 139, 0, 128, 0, 
+193, 64, 0, 0, 0, 1, 0, 0, 214, 0, 129, 1, 164, 64, 128, 0, 
+198, 128, 64, 0, 199, 192, 192, 1, 0, 1, 128, 0, 221, 128, 0, 1, 
+219, 0, 0, 0, 23, 0, 2, 128, 21, 1, 0, 1, 13, 1, 64, 2, 
+71, 1, 193, 1, 129, 65, 1, 0, 199, 129, 193, 1, 86, 193, 129, 2, 
+138, 64, 1, 2, 77, 0, 192, 0, 23, 0, 252, 127, 198, 192, 65, 0, 
+199, 0, 194, 1, 0, 1, 0, 1, 65, 65, 2, 0, 222, 0, 128, 1, 
+223, 0, 0, 0, 31, 0, 128, 0, 10, 0, 0, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 12, 0, 0, 0, 0, 0, 0, 0, 69, 120, 
+99, 101, 112, 116, 105, 111, 110, 58, 32, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 100, 101, 98, 117, 103, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 103, 101, 116, 105, 110, 102, 111, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 115, 104, 111, 114, 116, 95, 115, 114, 99, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 58, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 99, 117, 114, 114, 101, 110, 116, 108, 105, 110, 101, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 99, 111, 110, 99, 97, 116, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 85, 0, 0, 0, 108, 0, 0, 0, 2, 0, 12, 
+38, 0, 0, 0, 140, 0, 64, 0, 0, 1, 128, 0, 157, 128, 128, 1, 
+155, 64, 0, 0, 23, 192, 0, 128, 139, 0, 128, 0, 192, 0, 0, 0, 
+164, 64, 128, 0, 159, 0, 0, 1, 139, 0, 0, 0, 193, 64, 0, 0, 
+0, 1, 128, 0, 65, 129, 0, 0, 214, 64, 129, 1, 1, 193, 0, 0, 
+68, 1, 0, 0, 140, 1, 65, 0, 0, 2, 128, 1, 157, 1, 129, 1, 
+23, 64, 1, 128, 13, 65, 65, 2, 138, 64, 2, 2, 64, 1, 0, 5, 
+198, 130, 65, 0, 88, 192, 2, 2, 23, 64, 0, 128, 162, 129, 0, 0, 
+35, 194, 253, 127, 134, 129, 65, 0, 88, 128, 1, 2, 23, 0, 1, 128, 
+141, 65, 65, 2, 204, 193, 65, 0, 64, 2, 128, 2, 221, 129, 128, 1, 
+138, 192, 1, 3, 159, 0, 0, 1, 31, 0, 128, 0, 8, 0, 0, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 40, 46, 45, 41, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 40, 41, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 103, 109, 97, 116, 99, 104, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 109, 97, 120, 78, 98, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 115, 117, 98, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 115, 0, 0, 0, 132, 0, 0, 0, 1, 0, 11, 52, 
+0, 0, 0, 75, 0, 0, 0, 134, 0, 64, 0, 192, 0, 0, 0, 157, 
+0, 1, 1, 23, 128, 8, 128, 196, 1, 0, 0, 6, 66, 64, 0, 64, 
+2, 0, 3, 29, 130, 0, 1, 24, 128, 64, 4, 23, 128, 1, 128, 6, 
+130, 64, 0, 7, 194, 64, 4, 65, 2, 1, 0, 128, 2, 0, 3, 29, 
+130, 128, 1, 192, 1, 0, 4, 23, 128, 4, 128, 6, 66, 64, 0, 64, 
+2, 0, 3, 29, 130, 0, 1, 24, 64, 65, 4, 23, 0, 1, 128, 6, 
+130, 65, 0, 64, 2, 0, 3, 29, 130, 0, 1, 192, 1, 0, 4, 23, 
+0, 2, 128, 24, 192, 65, 3, 23, 64, 0, 128, 196, 1, 0, 0, 23, 
+0, 1, 128, 1, 2, 2, 0, 70, 66, 64, 0, 128, 2, 0, 3, 93, 
+130, 0, 1, 214, 65, 2, 4, 21, 2, 128, 0, 13, 66, 66, 4, 74, 
+192, 1, 4, 162, 128, 0, 0, 35, 129, 246, 127, 129, 128, 2, 0, 198, 
+192, 66, 0, 199, 0, 195, 1, 0, 1, 128, 0, 65, 65, 3, 0, 221, 
+128, 128, 1, 1, 129, 3, 0, 150, 0, 1, 1, 159, 0, 0, 1, 31, 
+0, 128, 0, 15, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+105, 112, 97, 105, 114, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+116, 121, 112, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+114, 105, 110, 103, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 102, 111, 
+114, 109, 97, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 37, 113, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 110, 117, 109, 98, 101, 114, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 115, 116, 114, 105, 
+110, 103, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 117, 110, 107, 
+110, 111, 119, 110, 32, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 123, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 99, 111, 110, 99, 97, 116, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 44, 32, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 125, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143, 0, 
+0, 0, 143, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 1, 0, 0, 
+0, 31, 0, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 145, 0, 0, 0, 179, 0, 0, 0, 1, 0, 6, 21, 0, 0, 
+0, 69, 0, 0, 0, 91, 64, 0, 0, 23, 0, 0, 128, 31, 0, 0, 
+1, 75, 0, 0, 0, 134, 0, 192, 0, 192, 0, 128, 0, 11, 65, 1, 
+0, 101, 1, 0, 0, 10, 65, 129, 128, 101, 65, 0, 0, 10, 65, 1, 
+129, 101, 129, 0, 0, 10, 65, 129, 129, 101, 193, 0, 0, 10, 65, 1, 
+130, 101, 1, 1, 0, 10, 65, 129, 130, 157, 64, 128, 1, 95, 0, 0, 
+1, 31, 0, 128, 0, 6, 0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 100, 101, 120, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 95, 95, 110, 101, 119, 105, 110, 
+100, 101, 120, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 95, 95, 108, 
+101, 110, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 112, 
+97, 105, 114, 115, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
+116, 82, 97, 119, 65, 114, 114, 97, 121, 0, 5, 0, 0, 0, 153, 0, 
+0, 0, 155, 0, 0, 0, 2, 0, 3, 3, 0, 0, 0, 134, 64, 0, 
+0, 159, 0, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 0, 163, 
+0, 0, 0, 3, 0, 5, 11, 0, 0, 0, 198, 0, 64, 0, 0, 1, 
+128, 0, 221, 128, 0, 1, 24, 64, 192, 1, 23, 192, 0, 128, 198, 128, 
+64, 0, 1, 193, 0, 0, 221, 64, 0, 1, 23, 0, 0, 128, 72, 128, 
+128, 0, 31, 0, 128, 0, 4, 0, 0, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 116, 121, 112, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 110, 117, 109, 98, 101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 101, 114, 114, 111, 114, 0, 4, 25, 0, 0, 0, 0, 0, 0, 0, 
+119, 114, 105, 116, 101, 32, 116, 111, 32, 105, 109, 109, 117, 116, 97, 98, 
+108, 101, 32, 116, 97, 98, 108, 101, 0, 0, 0, 0, 0, 2, 0, 0, 
+0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 165, 0, 0, 0, 167, 0, 0, 
+0, 1, 0, 2, 4, 0, 0, 0, 69, 0, 0, 0, 85, 0, 128, 0, 
+95, 0, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 169, 0, 0, 0, 171, 0, 
+0, 0, 1, 0, 3, 5, 0, 0, 0, 70, 0, 64, 0, 133, 0, 128, 
+0, 94, 0, 0, 1, 95, 0, 0, 0, 31, 0, 128, 0, 1, 0, 0, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 
+0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 173, 0, 0, 0, 175, 0, 0, 0, 1, 0, 2, 3, 0, 0, 0, 
+69, 0, 0, 0, 95, 0, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 
+};
+
+/* This is src/lua/redraw.lua */
+static const char file_7[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 50, 86, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 134, 128, 64, 0, 135, 0, 65, 1, 198, 128, 64, 0, 199, 64, 193, 
+1, 6, 129, 64, 0, 7, 129, 65, 2, 70, 129, 64, 0, 71, 193, 193, 
+2, 134, 129, 64, 0, 135, 1, 66, 3, 198, 129, 64, 0, 199, 65, 194, 
+3, 6, 130, 64, 0, 7, 130, 66, 4, 70, 130, 64, 0, 71, 194, 194, 
+4, 134, 130, 64, 0, 135, 2, 67, 5, 198, 130, 64, 0, 199, 66, 195, 
+5, 6, 131, 64, 0, 7, 131, 67, 6, 70, 131, 64, 0, 71, 195, 195, 
+6, 134, 131, 64, 0, 135, 3, 68, 7, 203, 3, 0, 0, 1, 68, 4, 
+0, 101, 4, 0, 0, 8, 64, 4, 137, 101, 68, 0, 0, 8, 64, 132, 
+137, 101, 132, 0, 0, 8, 64, 4, 138, 101, 196, 0, 0, 165, 4, 1, 
+0, 203, 68, 0, 0, 202, 132, 197, 138, 37, 69, 1, 0, 101, 133, 1, 
+0, 139, 5, 128, 0, 193, 197, 5, 0, 164, 69, 128, 0, 192, 5, 128, 
+5, 7, 6, 70, 11, 221, 133, 0, 1, 37, 198, 1, 0, 75, 6, 128, 
+0, 129, 198, 5, 0, 100, 70, 128, 0, 128, 6, 128, 5, 199, 6, 198, 
+12, 157, 134, 0, 1, 229, 6, 2, 0, 11, 7, 0, 0, 75, 7, 0, 
+0, 139, 7, 0, 0, 203, 7, 0, 0, 11, 8, 0, 0, 75, 8, 0, 
+0, 139, 8, 0, 0, 196, 8, 128, 0, 67, 9, 128, 0, 139, 9, 0, 
+0, 203, 9, 0, 0, 11, 10, 0, 0, 75, 10, 0, 0, 139, 10, 0, 
+0, 193, 74, 4, 0, 37, 75, 2, 0, 8, 0, 139, 140, 37, 139, 2, 
+0, 101, 203, 2, 0, 165, 11, 3, 0, 8, 128, 11, 141, 165, 75, 3, 
+0, 198, 203, 70, 0, 6, 12, 71, 0, 7, 76, 71, 24, 64, 12, 0, 
+23, 221, 75, 128, 1, 31, 0, 128, 0, 30, 0, 0, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 109, 97, 116, 104, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 102, 108, 111, 111, 114, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 119, 103, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 
+114, 105, 116, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 103, 111, 
+116, 111, 120, 121, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 99, 108, 
+101, 97, 114, 97, 114, 101, 97, 0, 4, 11, 0, 0, 0, 0, 0, 0, 
+0, 115, 99, 114, 111, 108, 108, 97, 114, 101, 97, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 115, 101, 116, 110, 111, 114, 109, 97, 108, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 98, 111, 108, 100, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 98, 114, 105, 103, 
+104, 116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 117, 
+110, 100, 101, 114, 108, 105, 110, 101, 0, 4, 11, 0, 0, 0, 0, 0, 
+0, 0, 115, 101, 116, 114, 101, 118, 101, 114, 115, 101, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 115, 101, 116, 100, 105, 109, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 103, 101, 116, 115, 116, 114, 105, 110, 103, 119, 
+105, 100, 116, 104, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
+116, 100, 114, 97, 119, 99, 111, 117, 110, 116, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 116, 105, 109, 101, 0, 4, 14, 0, 0, 0, 0, 0, 
+0, 0, 97, 100, 100, 114, 101, 100, 114, 97, 119, 116, 105, 109, 101, 0, 
+3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 
+101, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 82, 101, 115, 101, 116, 
+78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 115, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 115, 105, 122, 101, 
+83, 99, 114, 101, 101, 110, 0, 1, 1, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 67, 72, 65, 78, 71, 69, 68, 0, 4, 166, 0, 0, 0, 0, 
+0, 0, 0, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 
+226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 
+226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 
+226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 110, 118, 97, 108, 
+105, 100, 97, 116, 101, 83, 99, 114, 101, 101, 110, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 
+110, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 65, 100, 100, 69, 118, 
+101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 67, 104, 97, 110, 103, 101, 100, 0, 14, 0, 0, 0, 
+24, 0, 0, 0, 27, 0, 0, 0, 1, 0, 2, 7, 0, 0, 0, 69, 
+0, 0, 0, 85, 0, 128, 0, 77, 0, 192, 0, 8, 0, 128, 0, 70, 
+64, 192, 0, 93, 64, 128, 0, 31, 0, 128, 0, 2, 0, 0, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 
+0, 2, 0, 0, 0, 1, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 
+0, 31, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 11, 0, 0, 0, 
+9, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 1, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 39, 0, 
+0, 0, 0, 0, 5, 28, 0, 0, 0, 6, 128, 64, 0, 7, 192, 64, 
+0, 29, 192, 128, 0, 8, 64, 128, 128, 8, 0, 0, 128, 6, 0, 65, 
+0, 70, 0, 64, 0, 29, 128, 0, 1, 70, 64, 65, 0, 71, 128, 193, 
+0, 78, 64, 0, 0, 78, 192, 193, 0, 134, 0, 66, 0, 135, 64, 66, 
+1, 198, 0, 64, 0, 208, 128, 194, 1, 16, 129, 194, 0, 206, 0, 129, 
+1, 157, 128, 0, 1, 137, 0, 128, 0, 134, 64, 65, 0, 140, 192, 66, 
+1, 6, 65, 65, 0, 7, 129, 65, 2, 14, 1, 1, 0, 14, 193, 65, 
+2, 157, 64, 128, 1, 31, 0, 128, 0, 12, 0, 0, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 
+104, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 
+110, 72, 101, 105, 103, 104, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 119, 103, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+115, 99, 114, 101, 101, 110, 115, 105, 122, 101, 0, 4, 23, 0, 0, 0, 
+0, 0, 0, 0, 71, 101, 116, 77, 97, 120, 105, 109, 117, 109, 65, 108, 
+108, 111, 119, 101, 100, 87, 105, 100, 116, 104, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 109, 97, 114, 103, 105, 110, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 
+97, 116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 102, 108, 111, 
+111, 114, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 119, 114, 97, 112, 0, 0, 0, 0, 0, 2, 0, 
+0, 0, 0, 0, 1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 47, 0, 
+0, 0, 2, 0, 7, 18, 0, 0, 0, 134, 0, 64, 0, 198, 64, 64, 
+0, 199, 128, 192, 1, 135, 192, 0, 1, 199, 192, 64, 1, 219, 0, 0, 
+0, 23, 192, 1, 128, 204, 192, 64, 1, 64, 1, 0, 0, 128, 1, 128, 
+0, 221, 128, 0, 2, 219, 64, 0, 0, 23, 0, 0, 128, 195, 0, 0, 
+0, 223, 0, 0, 1, 195, 0, 0, 0, 223, 0, 0, 1, 31, 0, 128, 
+0, 4, 0, 0, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 77, 97, 
+114, 103, 105, 110, 67, 111, 110, 116, 114, 111, 108, 108, 101, 114, 115, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 118, 105, 101, 119, 109, 
+111, 100, 101, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+99, 111, 110, 116, 101, 110, 116, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 64, 0, 0, 0, 3, 0, 
+10, 37, 0, 0, 0, 91, 0, 0, 0, 23, 192, 2, 128, 197, 0, 0, 
+0, 221, 64, 128, 0, 198, 0, 192, 0, 5, 1, 0, 1, 64, 1, 0, 
+0, 134, 65, 192, 0, 135, 129, 64, 3, 142, 193, 64, 3, 192, 1, 128, 
+0, 221, 64, 128, 2, 197, 0, 128, 1, 221, 64, 128, 0, 199, 0, 65, 
+1, 199, 64, 193, 1, 219, 0, 0, 0, 23, 64, 4, 128, 5, 1, 0, 
+2, 64, 1, 128, 1, 29, 129, 0, 1, 13, 193, 64, 2, 71, 1, 65, 
+1, 71, 129, 193, 2, 26, 64, 1, 2, 23, 64, 2, 128, 133, 1, 128, 
+2, 197, 1, 0, 1, 6, 66, 192, 0, 7, 130, 64, 4, 205, 1, 130, 
+3, 205, 65, 129, 3, 206, 1, 129, 3, 0, 2, 0, 0, 64, 2, 128, 
+1, 157, 65, 0, 2, 31, 0, 128, 0, 7, 0, 0, 0, 4, 14, 0, 
+0, 0, 0, 0, 0, 0, 82, 65, 108, 105, 103, 110, 73, 110, 70, 105, 
+101, 108, 100, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 109, 
+97, 114, 103, 105, 110, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 98, 117, 108, 108, 101, 116, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 101, 110, 116, 0, 0, 0, 
+0, 0, 6, 0, 0, 0, 1, 10, 0, 0, 1, 16, 1, 5, 1, 11, 
+1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 80, 0, 0, 0, 0, 0, 
+2, 9, 0, 0, 0, 5, 0, 0, 0, 21, 0, 0, 0, 70, 0, 192, 
+0, 71, 64, 192, 0, 91, 0, 0, 0, 23, 0, 0, 128, 13, 128, 64, 
+0, 31, 0, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 
+116, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 116, 97, 116, 117, 
+115, 98, 97, 114, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 
+0, 0, 2, 0, 0, 0, 1, 15, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 
+0, 0, 128, 0, 0, 0, 0, 0, 11, 133, 0, 0, 0, 6, 0, 64, 
+0, 14, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 0, 91, 0, 0, 
+0, 23, 128, 24, 128, 75, 0, 128, 2, 134, 0, 65, 0, 198, 128, 64, 
+0, 199, 64, 193, 1, 219, 64, 0, 0, 23, 0, 0, 128, 193, 128, 1, 
+0, 157, 128, 0, 1, 193, 192, 1, 0, 6, 1, 66, 0, 7, 65, 65, 
+2, 27, 65, 0, 0, 23, 0, 0, 128, 1, 65, 2, 0, 65, 129, 2, 
+0, 134, 129, 64, 0, 135, 193, 66, 3, 134, 129, 129, 0, 155, 65, 0, 
+0, 23, 0, 0, 128, 129, 65, 2, 0, 100, 64, 128, 2, 133, 0, 0, 
+1, 157, 64, 128, 0, 133, 0, 128, 1, 193, 0, 3, 0, 6, 1, 64, 
+0, 14, 65, 64, 2, 70, 65, 67, 0, 78, 65, 192, 2, 134, 1, 64, 
+0, 142, 65, 64, 3, 157, 64, 128, 2, 134, 128, 67, 0, 193, 0, 3, 
+0, 6, 1, 64, 0, 14, 65, 64, 2, 70, 65, 67, 0, 134, 193, 67, 
+0, 135, 1, 68, 3, 192, 1, 128, 0, 1, 66, 2, 0, 157, 1, 128, 
+1, 157, 64, 0, 0, 139, 0, 0, 0, 198, 64, 68, 0, 6, 129, 68, 
+0, 7, 193, 68, 2, 64, 1, 0, 1, 221, 64, 128, 1, 198, 192, 67, 
+0, 199, 0, 197, 1, 0, 1, 0, 1, 101, 1, 0, 0, 221, 64, 128, 
+1, 203, 0, 128, 0, 1, 65, 5, 0, 228, 64, 128, 0, 6, 129, 69, 
+0, 64, 1, 0, 1, 29, 1, 1, 1, 23, 192, 0, 128, 85, 2, 128, 
+1, 77, 66, 192, 4, 135, 194, 69, 4, 202, 128, 130, 4, 34, 129, 0, 
+0, 163, 65, 254, 127, 6, 193, 67, 0, 7, 1, 68, 2, 64, 1, 128, 
+1, 129, 1, 6, 0, 29, 129, 128, 1, 192, 0, 0, 2, 6, 65, 70, 
+0, 7, 129, 70, 2, 64, 1, 128, 1, 149, 1, 128, 1, 29, 129, 128, 
+1, 24, 64, 69, 2, 23, 192, 1, 128, 6, 65, 70, 0, 7, 129, 70, 
+2, 64, 1, 128, 1, 129, 65, 0, 0, 213, 1, 128, 1, 206, 65, 192, 
+3, 29, 129, 0, 2, 192, 0, 0, 2, 6, 193, 70, 0, 65, 1, 3, 
+0, 134, 1, 64, 0, 142, 65, 64, 3, 198, 65, 67, 0, 0, 2, 128, 
+1, 29, 65, 128, 2, 5, 1, 0, 2, 29, 65, 128, 0, 14, 64, 64, 
+0, 69, 0, 128, 2, 85, 0, 128, 0, 25, 64, 0, 134, 23, 128, 5, 
+128, 69, 0, 0, 1, 93, 64, 128, 0, 69, 0, 128, 2, 85, 0, 128, 
+0, 129, 64, 0, 0, 193, 0, 7, 0, 97, 0, 3, 128, 69, 1, 128, 
+1, 129, 1, 3, 0, 192, 1, 0, 0, 6, 66, 67, 0, 14, 66, 64, 
+4, 64, 2, 0, 0, 93, 65, 128, 2, 69, 1, 0, 3, 129, 1, 3, 
+0, 192, 1, 0, 0, 6, 2, 129, 2, 93, 65, 0, 2, 14, 64, 64, 
+0, 96, 64, 252, 127, 69, 0, 0, 2, 93, 64, 128, 0, 31, 0, 128, 
+0, 29, 0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 83, 99, 
+114, 101, 101, 110, 72, 101, 105, 103, 104, 116, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 115, 116, 97, 116, 117, 115, 98, 97, 114, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 76, 101, 97, 102, 110, 97, 109, 101, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 40, 117, 110, 110, 97, 109, 101, 100, 41, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 91, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 93, 
+32, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 110, 103, 
+101, 100, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 
+0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 76, 65, 108, 105, 103, 110, 
+73, 110, 70, 105, 101, 108, 100, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+99, 111, 110, 99, 97, 116, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+70, 105, 114, 101, 69, 118, 101, 110, 116, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 
+0, 0, 66, 117, 105, 108, 100, 83, 116, 97, 116, 117, 115, 66, 97, 114, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 115, 111, 114, 116, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 32, 226, 148, 130, 32, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 115, 116, 114, 105, 110, 103, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 115, 117, 98, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 82, 65, 
+108, 105, 103, 110, 73, 110, 70, 105, 101, 108, 100, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 191, 1, 0, 0, 0, 100, 0, 0, 0, 100, 0, 0, 
+0, 2, 0, 4, 8, 0, 0, 0, 135, 0, 64, 0, 199, 0, 192, 0, 
+89, 192, 0, 1, 23, 0, 0, 128, 131, 64, 0, 0, 131, 0, 128, 0, 
+159, 0, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 112, 114, 105, 111, 114, 105, 116, 121, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
+1, 19, 1, 9, 1, 3, 1, 5, 1, 15, 1, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+136, 0, 0, 0, 148, 0, 0, 0, 1, 0, 10, 25, 0, 0, 0, 69, 
+0, 0, 0, 134, 0, 192, 0, 197, 0, 0, 1, 142, 192, 0, 1, 144, 
+64, 64, 1, 93, 128, 0, 1, 133, 0, 128, 1, 157, 64, 128, 0, 133, 
+0, 0, 2, 149, 0, 0, 1, 193, 128, 0, 0, 1, 193, 0, 0, 161, 
+192, 1, 128, 26, 0, 0, 130, 23, 0, 1, 128, 133, 1, 128, 2, 192, 
+1, 128, 0, 0, 2, 0, 0, 70, 66, 1, 2, 157, 65, 0, 2, 14, 
+128, 64, 0, 160, 128, 253, 127, 133, 0, 0, 3, 157, 64, 128, 0, 31, 
+0, 128, 0, 5, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 
+83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 0, 3, 0, 0, 0, 
+0, 0, 0, 0, 64, 3, 0, 0, 0, 0, 0, 0, 240, 63, 3, 0, 
+0, 0, 0, 0, 0, 240, 191, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 7, 0, 0, 0, 1, 0, 0, 0, 1, 23, 1, 10, 
+1, 22, 1, 1, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 168, 0, 
+0, 0, 1, 0, 10, 26, 0, 0, 0, 69, 0, 0, 0, 134, 0, 192, 
+0, 197, 0, 0, 1, 142, 192, 0, 1, 144, 64, 64, 1, 93, 128, 0, 
+1, 133, 0, 128, 1, 157, 64, 128, 0, 129, 128, 0, 0, 197, 0, 0, 
+2, 213, 0, 128, 1, 1, 129, 0, 0, 161, 0, 2, 128, 134, 193, 192, 
+0, 26, 128, 1, 0, 23, 0, 1, 128, 133, 1, 128, 2, 192, 1, 128, 
+0, 0, 2, 0, 0, 70, 66, 1, 2, 157, 65, 0, 2, 13, 128, 64, 
+0, 160, 64, 253, 127, 133, 0, 0, 3, 157, 64, 128, 0, 31, 0, 128, 
+0, 4, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 83, 99, 
+114, 101, 101, 110, 87, 105, 100, 116, 104, 0, 3, 0, 0, 0, 0, 0, 
+0, 0, 64, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 110, 72, 101, 105, 103, 104, 
+116, 0, 0, 0, 0, 0, 7, 0, 0, 0, 1, 0, 0, 0, 1, 26, 
+1, 10, 1, 25, 1, 1, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 201, 0, 0, 0, 
+203, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 3, 0, 128, 0, 9, 
+0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 1, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 0, 0, 0, 243, 0, 0, 
+0, 1, 0, 13, 63, 0, 0, 0, 68, 0, 0, 0, 129, 0, 0, 0, 
+206, 64, 64, 0, 1, 65, 0, 0, 161, 192, 4, 128, 134, 65, 1, 0, 
+197, 1, 128, 0, 88, 192, 1, 3, 23, 192, 3, 128, 198, 65, 1, 1, 
+1, 2, 0, 0, 78, 66, 64, 0, 129, 66, 0, 0, 33, 194, 1, 128, 
+6, 195, 130, 1, 24, 128, 1, 6, 23, 0, 1, 128, 6, 195, 2, 2, 
+24, 192, 1, 6, 23, 64, 0, 128, 78, 64, 129, 5, 23, 0, 0, 128, 
+32, 130, 253, 127, 91, 64, 0, 0, 23, 0, 0, 128, 160, 128, 250, 127, 
+91, 0, 0, 0, 23, 64, 0, 128, 24, 0, 192, 0, 23, 64, 0, 128, 
+129, 0, 0, 0, 159, 0, 0, 1, 129, 0, 0, 0, 193, 0, 0, 0, 
+14, 65, 64, 0, 65, 65, 0, 0, 225, 64, 4, 128, 205, 65, 0, 3, 
+26, 192, 1, 128, 23, 128, 3, 128, 25, 0, 128, 3, 23, 0, 3, 128, 
+6, 194, 129, 1, 70, 130, 1, 0, 24, 64, 2, 4, 23, 0, 2, 128, 
+6, 194, 1, 2, 70, 130, 1, 1, 24, 64, 2, 4, 23, 0, 1, 128, 
+6, 194, 129, 2, 70, 130, 1, 3, 24, 64, 2, 4, 23, 0, 0, 128, 
+141, 64, 64, 1, 224, 0, 251, 127, 207, 128, 64, 1, 26, 0, 128, 1, 
+23, 64, 0, 128, 193, 0, 0, 0, 223, 0, 0, 1, 95, 0, 0, 1, 
+31, 0, 128, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 3, 0, 0, 0, 0, 0, 
+0, 0, 64, 0, 0, 0, 0, 7, 0, 0, 0, 1, 38, 1, 28, 1, 
+39, 1, 32, 1, 33, 1, 34, 1, 40, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 245, 0, 0, 
+0, 215, 1, 0, 0, 0, 0, 29, 154, 1, 0, 0, 6, 0, 64, 0, 
+7, 64, 64, 0, 70, 0, 64, 0, 71, 128, 192, 0, 134, 0, 64, 0, 
+135, 192, 64, 1, 197, 0, 128, 0, 6, 1, 65, 0, 16, 65, 65, 2, 
+221, 128, 0, 1, 6, 1, 64, 0, 7, 129, 65, 2, 70, 1, 64, 0, 
+71, 193, 193, 2, 134, 1, 66, 0, 193, 65, 2, 0, 6, 2, 65, 0, 
+65, 130, 2, 0, 133, 2, 0, 1, 193, 130, 2, 0, 0, 3, 0, 2, 
+65, 195, 2, 0, 134, 3, 67, 0, 198, 3, 64, 0, 199, 67, 195, 7, 
+157, 131, 0, 1, 150, 129, 3, 3, 197, 1, 128, 1, 219, 65, 0, 0, 
+23, 192, 2, 128, 220, 65, 128, 2, 23, 64, 2, 128, 197, 1, 0, 2, 
+221, 129, 128, 0, 5, 2, 128, 2, 24, 0, 130, 3, 23, 192, 0, 128, 
+197, 1, 0, 3, 24, 192, 1, 3, 23, 0, 0, 128, 195, 65, 0, 0, 
+195, 1, 128, 0, 3, 2, 0, 0, 9, 2, 128, 1, 137, 1, 0, 3, 
+5, 2, 128, 3, 13, 130, 67, 4, 9, 2, 128, 3, 6, 2, 65, 0, 
+69, 2, 0, 4, 93, 130, 128, 0, 14, 66, 2, 4, 101, 2, 0, 0, 
+134, 2, 64, 0, 135, 2, 0, 5, 192, 2, 128, 0, 12, 3, 68, 5, 
+128, 3, 128, 0, 29, 195, 128, 1, 64, 0, 128, 6, 8, 0, 131, 135, 
+6, 195, 67, 0, 27, 67, 0, 0, 23, 128, 1, 128, 6, 67, 68, 0, 
+65, 131, 4, 0, 128, 3, 128, 5, 193, 195, 4, 0, 21, 4, 0, 5, 
+86, 3, 132, 6, 29, 67, 0, 1, 6, 3, 64, 0, 7, 131, 64, 6, 
+71, 3, 3, 5, 133, 3, 0, 7, 197, 3, 0, 1, 205, 3, 129, 7, 
+7, 4, 69, 5, 7, 4, 3, 8, 205, 3, 132, 7, 6, 68, 69, 0, 
+64, 4, 128, 6, 134, 4, 64, 0, 135, 196, 64, 9, 29, 132, 128, 1, 
+205, 3, 132, 7, 7, 132, 69, 5, 7, 196, 69, 8, 27, 68, 0, 0, 
+23, 0, 0, 128, 1, 4, 6, 0, 205, 3, 132, 7, 14, 132, 195, 1, 
+157, 67, 128, 1, 14, 131, 67, 0, 70, 195, 67, 0, 78, 67, 131, 1, 
+78, 131, 195, 6, 134, 3, 64, 0, 140, 67, 70, 7, 0, 4, 0, 0, 
+157, 131, 128, 1, 78, 131, 131, 6, 134, 3, 64, 0, 138, 195, 70, 141, 
+134, 3, 64, 0, 138, 195, 70, 142, 26, 64, 3, 140, 23, 192, 11, 128, 
+134, 3, 64, 0, 135, 3, 3, 7, 155, 3, 0, 0, 23, 192, 10, 128, 
+204, 67, 71, 7, 221, 131, 0, 1, 5, 4, 128, 7, 64, 4, 0, 6, 
+128, 4, 0, 7, 29, 132, 128, 1, 85, 4, 128, 7, 129, 132, 3, 0, 
+193, 132, 7, 0, 97, 68, 6, 128, 71, 5, 133, 7, 24, 128, 67, 10, 
+23, 192, 1, 128, 128, 5, 128, 4, 192, 5, 128, 6, 0, 6, 0, 7, 
+64, 6, 128, 10, 128, 6, 0, 8, 192, 6, 0, 6, 157, 69, 0, 3, 
+23, 128, 1, 128, 128, 5, 128, 4, 192, 5, 128, 6, 0, 6, 0, 7, 
+64, 6, 128, 10, 132, 6, 0, 0, 192, 6, 0, 6, 157, 69, 0, 3, 
+134, 5, 64, 0, 138, 5, 3, 141, 134, 5, 64, 0, 199, 197, 199, 10, 
+138, 197, 5, 142, 78, 131, 195, 6, 89, 0, 198, 6, 23, 0, 0, 128, 
+96, 4, 249, 127, 70, 4, 64, 0, 76, 68, 198, 8, 192, 4, 0, 6, 
+93, 132, 128, 1, 78, 67, 132, 6, 14, 131, 67, 6, 23, 64, 243, 127, 
+26, 64, 3, 140, 23, 64, 1, 128, 128, 3, 128, 4, 192, 3, 128, 6, 
+5, 4, 0, 8, 69, 4, 0, 8, 132, 4, 0, 0, 157, 67, 128, 2, 
+134, 195, 67, 0, 78, 131, 131, 1, 0, 3, 0, 0, 134, 3, 65, 0, 
+25, 128, 131, 6, 23, 128, 14, 128, 134, 3, 64, 0, 135, 3, 3, 7, 
+155, 3, 0, 0, 23, 128, 13, 128, 197, 3, 128, 7, 0, 4, 0, 6, 
+64, 4, 0, 7, 221, 131, 128, 1, 6, 4, 72, 0, 76, 68, 71, 7, 
+93, 4, 0, 1, 29, 4, 1, 0, 23, 0, 9, 128, 24, 128, 195, 9, 
+23, 192, 1, 128, 64, 5, 128, 4, 128, 5, 128, 6, 192, 5, 0, 7, 
+0, 6, 0, 10, 64, 6, 128, 7, 128, 6, 0, 6, 93, 69, 0, 3, 
+23, 128, 1, 128, 64, 5, 128, 4, 128, 5, 128, 6, 192, 5, 0, 7, 
+0, 6, 0, 10, 68, 6, 0, 0, 128, 6, 0, 6, 93, 69, 0, 3, 
+70, 5, 64, 0, 71, 133, 198, 10, 91, 69, 0, 0, 23, 128, 1, 128, 
+24, 0, 198, 6, 23, 0, 1, 128, 70, 5, 64, 0, 74, 5, 3, 141, 
+70, 5, 64, 0, 135, 197, 71, 10, 74, 133, 5, 142, 70, 5, 64, 0, 
+74, 5, 131, 144, 70, 5, 64, 0, 135, 197, 71, 10, 74, 133, 5, 145, 
+77, 131, 195, 6, 70, 5, 65, 0, 89, 64, 131, 10, 23, 64, 0, 128, 
+34, 132, 0, 0, 163, 4, 246, 127, 6, 4, 64, 0, 12, 196, 72, 8, 
+128, 4, 0, 6, 29, 132, 128, 1, 77, 3, 132, 6, 13, 131, 67, 6, 
+23, 64, 240, 127, 134, 3, 64, 0, 135, 131, 70, 7, 155, 67, 0, 0, 
+23, 192, 0, 128, 134, 3, 64, 0, 138, 131, 67, 141, 134, 3, 64, 0, 
+138, 131, 67, 142, 134, 3, 65, 0, 26, 128, 131, 6, 23, 64, 1, 128, 
+128, 3, 128, 4, 192, 3, 128, 6, 5, 4, 128, 8, 69, 4, 128, 8, 
+132, 4, 0, 0, 157, 67, 128, 2, 129, 3, 6, 0, 206, 131, 67, 4, 
+1, 132, 3, 0, 161, 67, 2, 128, 134, 68, 132, 6, 197, 4, 128, 3, 
+88, 192, 4, 9, 23, 64, 1, 128, 128, 4, 128, 4, 192, 4, 128, 8, 
+5, 5, 0, 9, 69, 5, 0, 9, 132, 5, 0, 0, 157, 68, 128, 2, 
+160, 3, 253, 127, 219, 1, 0, 0, 23, 192, 0, 128, 134, 3, 73, 0, 
+135, 67, 73, 7, 157, 67, 128, 0, 23, 64, 10, 128, 133, 3, 128, 9, 
+192, 3, 0, 4, 157, 131, 0, 1, 88, 0, 70, 7, 23, 0, 9, 128, 
+197, 3, 0, 10, 1, 4, 6, 0, 78, 132, 67, 4, 128, 4, 0, 7, 
+221, 67, 0, 2, 193, 3, 6, 0, 14, 132, 67, 4, 65, 132, 3, 0, 
+25, 0, 70, 7, 23, 0, 1, 128, 128, 4, 0, 8, 192, 4, 128, 7, 
+65, 132, 7, 0, 0, 4, 128, 9, 192, 3, 0, 9, 128, 4, 128, 7, 
+192, 4, 0, 8, 0, 5, 128, 8, 161, 4, 4, 128, 141, 133, 131, 10, 
+26, 128, 5, 140, 23, 0, 2, 128, 25, 0, 2, 11, 23, 128, 1, 128, 
+198, 133, 133, 10, 72, 197, 133, 10, 198, 133, 5, 11, 136, 197, 133, 10, 
+198, 133, 133, 11, 200, 197, 133, 10, 23, 0, 1, 128, 197, 5, 0, 9, 
+72, 197, 133, 10, 197, 5, 0, 9, 136, 197, 133, 10, 200, 197, 198, 10, 
+160, 68, 251, 127, 129, 3, 6, 0, 206, 131, 67, 4, 1, 132, 3, 0, 
+161, 67, 18, 128, 134, 68, 132, 4, 198, 68, 4, 5, 6, 69, 132, 5, 
+219, 65, 0, 0, 23, 0, 2, 128, 70, 69, 132, 10, 24, 128, 132, 10, 
+23, 64, 1, 128, 70, 69, 4, 11, 24, 192, 132, 10, 23, 128, 0, 128, 
+70, 69, 132, 11, 88, 0, 133, 10, 23, 192, 14, 128, 72, 133, 132, 8, 
+136, 197, 132, 8, 200, 5, 133, 8, 219, 65, 0, 0, 23, 128, 1, 128, 
+69, 5, 0, 12, 129, 5, 6, 0, 192, 5, 128, 8, 6, 6, 66, 0, 
+14, 134, 67, 12, 64, 6, 128, 8, 93, 69, 128, 2, 69, 5, 0, 8, 
+24, 64, 5, 9, 23, 192, 0, 128, 69, 5, 128, 12, 128, 5, 128, 8, 
+93, 69, 0, 1, 23, 0, 10, 128, 69, 5, 128, 8, 24, 64, 5, 9, 
+23, 192, 0, 128, 69, 5, 0, 13, 128, 5, 128, 8, 93, 69, 0, 1, 
+23, 64, 8, 128, 69, 5, 0, 9, 88, 64, 5, 9, 23, 128, 7, 128, 
+71, 133, 69, 9, 71, 197, 197, 10, 91, 69, 0, 0, 23, 0, 0, 128, 
+65, 5, 6, 0, 91, 65, 0, 0, 23, 192, 1, 128, 140, 133, 73, 9, 
+0, 6, 128, 9, 69, 6, 0, 1, 77, 6, 129, 12, 77, 70, 133, 12, 
+128, 6, 128, 8, 157, 69, 128, 2, 23, 0, 2, 128, 140, 197, 73, 9, 
+0, 6, 128, 9, 69, 6, 0, 1, 77, 6, 129, 12, 77, 70, 133, 12, 
+128, 6, 128, 8, 196, 6, 0, 0, 6, 71, 4, 6, 157, 69, 128, 3, 
+88, 192, 70, 10, 23, 0, 1, 128, 133, 5, 128, 13, 192, 5, 128, 8, 
+0, 6, 0, 10, 64, 6, 0, 9, 157, 69, 0, 2, 160, 3, 237, 127, 
+128, 3, 0, 4, 198, 3, 65, 0, 206, 131, 195, 7, 1, 132, 3, 0, 
+161, 3, 1, 128, 133, 4, 0, 14, 72, 133, 132, 8, 133, 4, 0, 14, 
+136, 133, 132, 8, 200, 197, 198, 8, 160, 67, 254, 127, 133, 3, 128, 14, 
+157, 67, 128, 0, 134, 3, 74, 0, 198, 67, 74, 0, 199, 131, 202, 7, 
+157, 67, 0, 1, 133, 3, 0, 2, 157, 131, 128, 0, 137, 3, 128, 2, 
+31, 0, 128, 0, 43, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 4, 13, 
+0, 0, 0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 110, 72, 101, 105, 
+103, 104, 116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 109, 97, 114, 103, 105, 110, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 120, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 43, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 115, 116, 114, 105, 110, 103, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 118, 105, 101, 119, 109, 111, 
+100, 101, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 99, 108, 0, 4, 14, 0, 0, 0, 0, 0, 0, 
+0, 103, 101, 116, 76, 105, 110, 101, 79, 102, 87, 111, 114, 100, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 101, 114, 114, 111, 114, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 119, 111, 114, 100, 32, 0, 4, 21, 0, 
+0, 0, 0, 0, 0, 0, 32, 110, 111, 116, 32, 105, 110, 32, 112, 97, 
+114, 97, 32, 111, 102, 32, 108, 101, 110, 32, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 120, 115, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 
+71, 101, 116, 87, 105, 100, 116, 104, 70, 114, 111, 109, 79, 102, 102, 115, 
+101, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 
+101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 101, 110, 
+116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 115, 112, 97, 99, 101, 65, 98, 111, 118, 101, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 116, 111, 112, 112, 0, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 116, 111, 112, 119, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 119, 114, 97, 112, 0, 3, 0, 0, 0, 0, 0, 
+0, 240, 191, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 110, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 98, 111, 116, 112, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 98, 111, 116, 119, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 115, 112, 97, 99, 101, 66, 101, 108, 111, 119, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 99, 108, 101, 97, 114, 115, 99, 114, 101, 101, 110, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 114, 101, 110, 100, 101, 114, 76, 
+105, 110, 101, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 114, 101, 110, 
+100, 101, 114, 77, 97, 114, 107, 101, 100, 76, 105, 110, 101, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 70, 105, 114, 101, 69, 118, 101, 110, 116, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 0, 
+1, 0, 0, 0, 12, 1, 0, 0, 20, 1, 0, 0, 5, 0, 6, 12, 
+0, 0, 0, 26, 0, 0, 128, 23, 0, 2, 128, 69, 1, 0, 0, 25, 
+64, 1, 0, 23, 64, 1, 128, 72, 64, 0, 0, 136, 128, 0, 0, 200, 
+192, 0, 0, 8, 1, 1, 0, 69, 1, 0, 3, 72, 65, 1, 0, 31, 
+0, 128, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 7, 0, 0, 0, 1, 8, 0, 9, 0, 10, 0, 11, 
+0, 12, 0, 13, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 
+1, 0, 1, 16, 1, 37, 1, 12, 1, 35, 1, 36, 1, 43, 1, 20, 
+1, 38, 1, 39, 1, 40, 1, 41, 1, 42, 1, 2, 1, 17, 1, 29, 
+1, 30, 1, 28, 1, 44, 1, 4, 1, 32, 1, 33, 1, 34, 1, 3, 
+1, 24, 1, 27, 1, 18, 1, 31, 1, 21, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 1, 
+0, 0, 224, 1, 0, 0, 0, 0, 3, 10, 0, 0, 0, 5, 0, 0, 
+0, 29, 128, 128, 0, 69, 0, 128, 0, 93, 64, 128, 0, 69, 0, 0, 
+1, 133, 0, 0, 0, 157, 128, 128, 0, 142, 0, 0, 1, 93, 64, 0, 
+1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+0, 1, 13, 1, 45, 1, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 0, 0, 238, 
+1, 0, 0, 2, 0, 9, 12, 0, 0, 0, 129, 0, 0, 0, 198, 64, 
+64, 0, 6, 129, 64, 0, 221, 0, 1, 1, 23, 64, 0, 128, 21, 2, 
+128, 3, 141, 0, 2, 1, 226, 128, 0, 0, 99, 193, 254, 127, 198, 128, 
+64, 0, 202, 128, 128, 129, 31, 0, 128, 0, 4, 0, 0, 0, 3, 0, 
+0, 0, 0, 0, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+105, 112, 97, 105, 114, 115, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 119, 111, 114, 100, 99, 111, 117, 110, 116, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 
+};
+
+/* This is src/lua/settings.lua */
+static const char file_8[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 10, 0, 0, 
+0, 11, 0, 0, 0, 8, 0, 0, 128, 6, 64, 64, 0, 65, 128, 0, 
+0, 22, 64, 0, 0, 101, 0, 0, 0, 8, 64, 128, 129, 101, 64, 0, 
+0, 8, 64, 0, 130, 31, 0, 128, 0, 5, 0, 0, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 
+105, 110, 103, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 72, 79, 
+77, 69, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 47, 46, 119, 111, 
+114, 100, 103, 114, 105, 110, 100, 101, 114, 46, 115, 101, 116, 116, 105, 110, 
+103, 115, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 
+71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 4, 
+19, 0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 71, 108, 111, 98, 
+97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 2, 0, 0, 0, 9, 
+0, 0, 0, 15, 0, 0, 0, 0, 0, 3, 11, 0, 0, 0, 6, 0, 
+64, 0, 69, 0, 128, 0, 29, 128, 0, 1, 27, 0, 0, 0, 23, 0, 
+1, 128, 8, 0, 128, 128, 70, 128, 64, 0, 134, 192, 64, 0, 135, 0, 
+65, 1, 93, 64, 0, 1, 31, 0, 128, 0, 5, 0, 0, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 70, 114, 111, 109, 83, 
+116, 114, 101, 97, 109, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 71, 
+108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 70, 105, 114, 101, 69, 118, 101, 110, 116, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 
+4, 15, 0, 0, 0, 0, 0, 0, 0, 82, 101, 103, 105, 115, 116, 101, 
+114, 65, 100, 100, 111, 110, 115, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 20, 0, 0, 0, 
+0, 0, 3, 6, 0, 0, 0, 6, 0, 64, 0, 69, 0, 128, 0, 134, 
+64, 64, 0, 29, 192, 128, 1, 31, 0, 0, 1, 31, 0, 128, 0, 2, 
+0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 
+84, 111, 83, 116, 114, 101, 97, 109, 0, 4, 15, 0, 0, 0, 0, 0, 
+0, 0, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 
+0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/document.lua */
+static const char file_9[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 23, 135, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 128, 192, 
+0, 134, 0, 64, 0, 135, 192, 64, 1, 198, 0, 65, 0, 199, 64, 193, 
+1, 6, 1, 65, 0, 7, 129, 65, 2, 70, 1, 65, 0, 71, 193, 193, 
+2, 134, 1, 65, 0, 135, 1, 66, 3, 198, 1, 65, 0, 199, 65, 194, 
+3, 6, 2, 65, 0, 7, 130, 66, 4, 70, 2, 65, 0, 71, 194, 194, 
+4, 134, 2, 65, 0, 135, 2, 67, 5, 198, 2, 65, 0, 199, 66, 195, 
+5, 6, 3, 65, 0, 7, 131, 67, 6, 70, 3, 65, 0, 71, 195, 195, 
+6, 134, 3, 65, 0, 135, 3, 68, 7, 198, 3, 65, 0, 199, 67, 196, 
+7, 6, 4, 65, 0, 7, 132, 68, 8, 70, 4, 65, 0, 71, 196, 196, 
+8, 134, 4, 65, 0, 135, 4, 69, 9, 198, 4, 65, 0, 199, 68, 197, 
+9, 11, 5, 1, 0, 77, 133, 132, 7, 77, 133, 131, 10, 77, 5, 132, 
+10, 10, 69, 5, 139, 77, 133, 3, 9, 77, 5, 132, 10, 10, 69, 133, 
+139, 77, 133, 132, 7, 77, 133, 131, 10, 10, 69, 5, 140, 77, 133, 3, 
+9, 10, 69, 133, 140, 75, 69, 3, 0, 165, 5, 0, 0, 74, 133, 133, 
+141, 165, 69, 0, 0, 74, 133, 5, 142, 165, 133, 0, 0, 74, 133, 133, 
+142, 165, 197, 0, 0, 74, 133, 5, 143, 165, 5, 1, 0, 74, 133, 133, 
+143, 165, 69, 1, 0, 74, 133, 5, 144, 165, 133, 1, 0, 74, 133, 133, 
+144, 165, 197, 1, 0, 74, 133, 5, 145, 165, 5, 2, 0, 74, 133, 133, 
+145, 165, 69, 2, 0, 74, 133, 5, 146, 165, 133, 2, 0, 74, 133, 133, 
+146, 165, 197, 2, 0, 74, 133, 5, 147, 165, 5, 3, 0, 74, 133, 133, 
+147, 8, 64, 5, 141, 75, 5, 2, 0, 165, 69, 3, 0, 74, 133, 133, 
+148, 165, 133, 3, 0, 74, 133, 5, 149, 165, 197, 3, 0, 74, 133, 133, 
+149, 165, 5, 4, 0, 74, 133, 5, 150, 165, 69, 4, 0, 74, 133, 133, 
+150, 165, 133, 4, 0, 74, 133, 133, 141, 165, 197, 4, 0, 74, 133, 5, 
+151, 165, 5, 5, 0, 74, 133, 133, 151, 8, 64, 5, 148, 75, 133, 2, 
+0, 165, 69, 5, 0, 74, 133, 133, 152, 165, 133, 5, 0, 74, 133, 5, 
+142, 165, 197, 5, 0, 74, 133, 5, 150, 165, 5, 6, 0, 74, 133, 5, 
+153, 165, 69, 6, 0, 74, 133, 133, 153, 165, 133, 6, 0, 74, 133, 5, 
+154, 165, 197, 6, 0, 74, 133, 133, 154, 165, 5, 7, 0, 74, 133, 5, 
+155, 165, 69, 7, 0, 74, 133, 133, 155, 165, 133, 7, 0, 74, 133, 5, 
+156, 8, 64, 5, 152, 101, 197, 7, 0, 8, 64, 133, 156, 101, 5, 8, 
+0, 8, 64, 5, 157, 101, 69, 8, 0, 8, 64, 133, 157, 101, 133, 8, 
+0, 165, 197, 8, 0, 8, 128, 5, 158, 165, 5, 9, 0, 8, 128, 133, 
+158, 165, 69, 9, 0, 8, 128, 5, 159, 31, 0, 128, 0, 63, 0, 0, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 98, 108, 101, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 109, 111, 118, 101, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 110, 115, 101, 114, 116, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 99, 97, 116, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 119, 114, 105, 116, 101, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 119, 114, 105, 116, 101, 115, 116, 121, 108, 101, 100, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 99, 108, 101, 97, 114, 116, 111, 
+101, 111, 108, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 
+110, 111, 114, 109, 97, 108, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+115, 101, 116, 98, 111, 108, 100, 0, 4, 13, 0, 0, 0, 0, 0, 0, 
+0, 115, 101, 116, 117, 110, 100, 101, 114, 108, 105, 110, 101, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 114, 101, 118, 101, 114, 115, 
+101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 100, 105, 
+109, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 115, 116, 
+114, 105, 110, 103, 119, 105, 100, 116, 104, 0, 4, 20, 0, 0, 0, 0, 
+0, 0, 0, 103, 101, 116, 98, 121, 116, 101, 115, 111, 102, 99, 104, 97, 
+114, 97, 99, 116, 101, 114, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 
+103, 101, 116, 119, 111, 114, 100, 116, 101, 120, 116, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 66, 79, 76, 68, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 73, 84, 65, 76, 73, 67, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 85, 78, 68, 69, 82, 76, 73, 78, 69, 0, 4, 8, 0, 
+0, 0, 0, 0, 0, 0, 82, 69, 86, 69, 82, 83, 69, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 66, 82, 73, 71, 72, 84, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 68, 73, 77, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 72, 49, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+72, 50, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 51, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 72, 52, 0, 4, 17, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 67, 
+108, 97, 115, 115, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 112, 117, 
+114, 103, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 117, 
+99, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 99, 108, 101, 97, 
+110, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 68, 111, 
+99, 117, 109, 101, 110, 116, 76, 105, 115, 116, 0, 4, 14, 0, 0, 0, 
+0, 0, 0, 0, 95, 102, 105, 110, 100, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 97, 100, 100, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 20, 0, 
+0, 0, 0, 0, 0, 0, 109, 111, 118, 101, 68, 111, 99, 117, 109, 101, 
+110, 116, 73, 110, 100, 101, 120, 84, 111, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 100, 101, 108, 101, 116, 101, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 67, 117, 
+114, 114, 101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 114, 
+101, 110, 97, 109, 101, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 13, 
+0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 67, 108, 105, 112, 98, 111, 
+97, 114, 100, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+67, 108, 105, 112, 98, 111, 97, 114, 100, 0, 4, 14, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 67, 108, 97, 115, 115, 
+0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 97, 112, 112, 101, 110, 100, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 22, 0, 0, 0, 0, 
+0, 0, 0, 105, 110, 115, 101, 114, 116, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 66, 101, 102, 111, 114, 101, 0, 4, 18, 0, 0, 0, 0, 0, 
+0, 0, 100, 101, 108, 101, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 65, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 
+112, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 77, 97, 
+114, 107, 115, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 112, 97, 
+99, 101, 65, 98, 111, 118, 101, 0, 4, 11, 0, 0, 0, 0, 0, 0, 
+0, 115, 112, 97, 99, 101, 66, 101, 108, 111, 119, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 80, 97, 114, 97, 103, 114, 97, 112, 104, 67, 108, 
+97, 115, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 99, 111, 112, 
+121, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 114, 101, 110, 100, 101, 
+114, 76, 105, 110, 101, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 114, 
+101, 110, 100, 101, 114, 77, 97, 114, 107, 101, 100, 76, 105, 110, 101, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 76, 105, 110, 101, 
+79, 102, 87, 111, 114, 100, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 
+103, 101, 116, 87, 111, 114, 100, 79, 102, 76, 105, 110, 101, 0, 4, 17, 
+0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 88, 79, 102, 102, 115, 101, 
+116, 79, 102, 87, 111, 114, 100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 115, 117, 98, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 97, 115, 
+83, 116, 114, 105, 110, 103, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 
+67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 
+4, 19, 0, 0, 0, 0, 0, 0, 0, 71, 101, 116, 87, 105, 100, 116, 
+104, 70, 114, 111, 109, 79, 102, 102, 115, 101, 116, 0, 4, 19, 0, 0, 
+0, 0, 0, 0, 0, 71, 101, 116, 79, 102, 102, 115, 101, 116, 70, 114, 
+111, 109, 87, 105, 100, 116, 104, 0, 4, 21, 0, 0, 0, 0, 0, 0, 
+0, 82, 101, 115, 101, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 83, 
+116, 121, 108, 101, 115, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 67, 
+114, 101, 97, 116, 101, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 
+68, 111, 99, 117, 109, 101, 110, 116, 0, 38, 0, 0, 0, 37, 0, 0, 
+0, 41, 0, 0, 0, 1, 0, 8, 9, 0, 0, 0, 70, 0, 64, 0, 
+135, 64, 64, 0, 93, 0, 1, 1, 23, 64, 0, 128, 140, 129, 192, 2, 
+157, 65, 0, 1, 98, 128, 0, 0, 227, 192, 254, 127, 31, 0, 128, 0, 
+3, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 
+105, 114, 115, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 100, 111, 99, 
+117, 109, 101, 110, 116, 115, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+112, 117, 114, 103, 101, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 43, 0, 0, 0, 46, 0, 0, 0, 1, 0, 2, 3, 
+0, 0, 0, 10, 64, 64, 128, 10, 64, 64, 129, 31, 0, 128, 0, 3, 
+0, 0, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 110, 
+103, 101, 100, 0, 1, 1, 4, 12, 0, 0, 0, 0, 0, 0, 0, 106, 
+117, 115, 116, 99, 104, 97, 110, 103, 101, 100, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 51, 0, 0, 0, 1, 
+0, 2, 3, 0, 0, 0, 10, 64, 64, 128, 10, 64, 64, 129, 31, 0, 
+128, 0, 3, 0, 0, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 
+104, 97, 110, 103, 101, 100, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 106, 117, 115, 116, 99, 104, 97, 110, 103, 101, 100, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 55, 0, 0, 
+0, 1, 0, 2, 3, 0, 0, 0, 71, 0, 64, 0, 95, 0, 0, 1, 
+31, 0, 128, 0, 1, 0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 100, 111, 99, 117, 109, 101, 110, 116, 115, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 64, 0, 0, 0, 2, 
+0, 8, 13, 0, 0, 0, 134, 0, 64, 0, 199, 64, 64, 0, 157, 0, 
+1, 1, 23, 192, 0, 128, 199, 129, 64, 3, 24, 64, 128, 3, 23, 0, 
+0, 128, 95, 1, 0, 1, 162, 128, 0, 0, 35, 65, 254, 127, 132, 0, 
+0, 0, 159, 0, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 100, 111, 99, 117, 109, 101, 110, 116, 115, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0, 0, 
+0, 77, 0, 0, 0, 2, 0, 8, 22, 0, 0, 0, 135, 0, 64, 0, 
+135, 64, 0, 1, 155, 64, 0, 0, 23, 192, 3, 128, 199, 0, 64, 0, 
+12, 65, 64, 0, 128, 1, 128, 0, 29, 129, 128, 1, 135, 0, 129, 1, 
+155, 0, 0, 0, 23, 0, 2, 128, 198, 128, 64, 0, 1, 193, 0, 0, 
+65, 1, 1, 0, 128, 1, 128, 0, 193, 65, 1, 0, 86, 193, 129, 2, 
+221, 64, 128, 1, 199, 0, 64, 0, 202, 128, 128, 0, 159, 0, 0, 1, 
+31, 0, 128, 0, 6, 0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 100, 111, 99, 117, 109, 101, 110, 116, 115, 0, 4, 14, 0, 0, 0, 
+0, 0, 0, 0, 95, 102, 105, 110, 100, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 97, 108, 
+77, 101, 115, 115, 97, 103, 101, 0, 4, 39, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 32, 105, 110, 100, 101, 120, 32, 
+105, 110, 99, 111, 110, 115, 105, 115, 116, 101, 110, 99, 121, 32, 99, 111, 
+114, 114, 101, 99, 116, 101, 100, 0, 4, 31, 0, 0, 0, 0, 0, 0, 
+0, 83, 111, 109, 101, 116, 104, 105, 110, 103, 32, 102, 114, 101, 97, 107, 
+121, 32, 104, 97, 112, 112, 101, 110, 101, 100, 32, 116, 111, 32, 39, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 39, 46, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0, 91, 0, 
+0, 0, 4, 0, 8, 29, 0, 0, 0, 74, 128, 0, 128, 12, 65, 64, 
+0, 128, 1, 0, 1, 29, 129, 128, 1, 27, 65, 0, 0, 23, 128, 0, 
+128, 7, 129, 64, 0, 21, 1, 0, 2, 13, 193, 64, 2, 71, 129, 64, 
+0, 74, 65, 0, 2, 71, 129, 64, 0, 74, 65, 0, 1, 71, 1, 65, 
+0, 91, 1, 0, 0, 23, 192, 0, 128, 71, 1, 65, 0, 71, 1, 192, 
+2, 24, 128, 128, 2, 23, 128, 0, 128, 76, 65, 65, 0, 192, 1, 0, 
+1, 93, 65, 128, 1, 76, 129, 65, 0, 93, 65, 0, 1, 70, 193, 65, 
+0, 135, 129, 64, 0, 93, 65, 0, 1, 31, 0, 128, 0, 8, 0, 0, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 
+14, 0, 0, 0, 0, 0, 0, 0, 95, 102, 105, 110, 100, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 100, 
+111, 99, 117, 109, 101, 110, 116, 115, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 114, 101, 
+110, 116, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 67, 
+117, 114, 114, 101, 110, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+116, 111, 117, 99, 104, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 82, 
+101, 98, 117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 110, 116, 115, 77, 
+101, 110, 117, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 93, 0, 0, 0, 104, 0, 0, 0, 3, 0, 9, 23, 0, 0, 
+0, 204, 0, 64, 0, 64, 1, 128, 0, 221, 128, 128, 1, 219, 64, 0, 
+0, 23, 0, 0, 128, 31, 0, 128, 0, 7, 65, 64, 0, 7, 193, 0, 
+2, 69, 1, 0, 0, 135, 65, 64, 0, 192, 1, 128, 1, 93, 65, 128, 
+1, 69, 1, 128, 0, 135, 65, 64, 0, 192, 1, 0, 1, 0, 2, 0, 
+2, 93, 65, 0, 2, 76, 129, 64, 0, 93, 65, 0, 1, 70, 193, 64, 
+1, 135, 65, 64, 0, 93, 65, 0, 1, 31, 0, 128, 0, 4, 0, 0, 
+0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 95, 102, 105, 110, 100, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 100, 111, 99, 117, 109, 101, 110, 116, 115, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 4, 21, 0, 0, 0, 0, 
+0, 0, 0, 82, 101, 98, 117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 
+110, 116, 115, 77, 101, 110, 117, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 0, 0, 0, 133, 0, 
+0, 0, 2, 0, 7, 42, 0, 0, 0, 135, 0, 64, 0, 149, 0, 0, 
+1, 24, 64, 64, 1, 23, 64, 0, 128, 131, 0, 0, 0, 159, 0, 0, 
+1, 140, 128, 64, 0, 0, 1, 128, 0, 157, 128, 128, 1, 155, 64, 0, 
+0, 23, 0, 0, 128, 31, 0, 128, 0, 199, 0, 64, 0, 199, 128, 128, 
+1, 5, 1, 0, 0, 71, 1, 64, 0, 128, 1, 0, 1, 29, 65, 128, 
+1, 7, 1, 64, 0, 10, 193, 192, 0, 12, 1, 65, 0, 29, 65, 0, 
+1, 6, 65, 193, 0, 71, 1, 64, 0, 29, 65, 0, 1, 6, 129, 193, 
+0, 24, 192, 0, 2, 23, 128, 2, 128, 7, 1, 64, 0, 199, 128, 0, 
+2, 219, 64, 0, 0, 23, 192, 0, 128, 7, 1, 64, 0, 71, 1, 64, 
+0, 85, 1, 128, 2, 199, 64, 1, 2, 12, 193, 65, 0, 135, 1, 194, 
+1, 29, 65, 128, 1, 3, 1, 128, 0, 31, 1, 0, 1, 31, 0, 128, 
+0, 9, 0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 100, 111, 
+99, 117, 109, 101, 110, 116, 115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 
+63, 4, 14, 0, 0, 0, 0, 0, 0, 0, 95, 102, 105, 110, 100, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 116, 111, 117, 99, 104, 0, 4, 21, 0, 0, 0, 0, 0, 0, 
+0, 82, 101, 98, 117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 110, 116, 
+115, 77, 101, 110, 117, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 11, 0, 0, 0, 0, 0, 0, 
+0, 115, 101, 116, 67, 117, 114, 114, 101, 110, 116, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 0, 0, 0, 0, 2, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 0, 0, 0, 149, 0, 
+0, 0, 2, 0, 4, 22, 0, 0, 0, 134, 0, 64, 0, 135, 64, 64, 
+1, 155, 0, 0, 0, 23, 192, 0, 128, 134, 128, 64, 0, 198, 192, 64, 
+0, 199, 0, 193, 1, 157, 64, 0, 1, 135, 64, 65, 0, 135, 64, 0, 
+1, 8, 128, 0, 128, 134, 0, 64, 0, 155, 64, 0, 0, 23, 128, 0, 
+128, 135, 64, 65, 0, 135, 128, 65, 1, 8, 128, 0, 128, 134, 0, 64, 
+0, 10, 128, 128, 131, 134, 0, 66, 0, 157, 64, 128, 0, 31, 0, 128, 
+0, 9, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 
+99, 117, 109, 101, 110, 116, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+99, 104, 97, 110, 103, 101, 100, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 70, 105, 114, 101, 69, 118, 101, 110, 116, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 67, 104, 97, 110, 103, 101, 100, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 100, 111, 99, 117, 109, 101, 110, 116, 115, 0, 3, 0, 
+0, 0, 0, 0, 0, 240, 63, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+99, 117, 114, 114, 101, 110, 116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 
+0, 82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 0, 0, 0, 
+164, 0, 0, 0, 3, 0, 6, 21, 0, 0, 0, 199, 0, 64, 0, 199, 
+128, 128, 1, 219, 0, 0, 0, 23, 64, 0, 128, 195, 0, 0, 0, 223, 
+0, 0, 1, 199, 0, 64, 0, 199, 64, 128, 1, 7, 1, 64, 0, 10, 
+65, 192, 0, 7, 1, 64, 0, 10, 193, 0, 1, 202, 128, 0, 129, 12, 
+193, 64, 0, 29, 65, 0, 1, 6, 1, 65, 0, 71, 1, 64, 0, 29, 
+65, 0, 1, 3, 1, 128, 0, 31, 1, 0, 1, 31, 0, 128, 0, 5, 
+0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 100, 111, 99, 117, 
+109, 101, 110, 116, 115, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+110, 97, 109, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 
+117, 99, 104, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 82, 101, 98, 
+117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 110, 116, 115, 77, 101, 110, 
+117, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+166, 0, 0, 0, 168, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 10, 
+64, 0, 128, 31, 0, 128, 0, 1, 0, 0, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 99, 108, 105, 112, 98, 111, 97, 114, 100, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 172, 0, 
+0, 0, 1, 0, 2, 3, 0, 0, 0, 71, 0, 64, 0, 95, 0, 0, 
+1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 99, 108, 105, 112, 98, 111, 97, 114, 100, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 177, 0, 0, 0, 179, 0, 0, 0, 
+2, 0, 3, 4, 0, 0, 0, 149, 0, 0, 0, 141, 0, 64, 1, 10, 
+64, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+181, 0, 0, 0, 183, 0, 0, 0, 3, 0, 7, 7, 0, 0, 0, 198, 
+0, 64, 0, 199, 64, 192, 1, 0, 1, 0, 0, 64, 1, 0, 1, 128, 
+1, 128, 0, 221, 64, 0, 2, 31, 0, 128, 0, 2, 0, 0, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 98, 108, 101, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 105, 110, 115, 101, 114, 116, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 185, 0, 0, 0, 
+187, 0, 0, 0, 2, 0, 5, 6, 0, 0, 0, 134, 0, 64, 0, 135, 
+64, 64, 1, 192, 0, 0, 0, 0, 1, 128, 0, 157, 64, 128, 1, 31, 
+0, 128, 0, 2, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 
+101, 109, 111, 118, 101, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 189, 0, 0, 0, 191, 0, 0, 0, 2, 0, 2, 2, 
+0, 0, 0, 10, 64, 0, 128, 31, 0, 128, 0, 1, 0, 0, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 112, 119, 105, 100, 116, 
+104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 193, 0, 
+0, 0, 213, 0, 0, 0, 1, 0, 13, 35, 0, 0, 0, 71, 0, 64, 
+0, 91, 64, 0, 0, 23, 0, 0, 128, 31, 0, 128, 0, 71, 0, 64, 
+0, 135, 64, 64, 0, 199, 128, 64, 0, 7, 193, 64, 0, 71, 1, 65, 
+0, 135, 65, 65, 0, 89, 64, 0, 2, 23, 192, 1, 128, 24, 0, 129, 
+0, 23, 0, 3, 128, 89, 128, 128, 2, 23, 192, 0, 128, 24, 64, 1, 
+1, 23, 0, 2, 128, 25, 192, 0, 3, 23, 128, 1, 128, 192, 1, 0, 
+2, 0, 2, 128, 2, 64, 2, 0, 3, 128, 2, 128, 0, 192, 2, 0, 
+1, 0, 3, 128, 1, 223, 1, 128, 3, 192, 1, 128, 0, 0, 2, 0, 
+1, 64, 2, 128, 1, 128, 2, 0, 2, 192, 2, 128, 2, 0, 3, 0, 
+3, 223, 1, 128, 3, 31, 0, 128, 0, 6, 0, 0, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 109, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 111, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 99, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 216, 0, 0, 0, 232, 0, 0, 0, 1, 0, 8, 16, 0, 0, 0, 
+70, 0, 64, 0, 128, 0, 0, 0, 93, 0, 1, 1, 23, 64, 0, 128, 
+140, 65, 192, 2, 157, 65, 0, 1, 98, 128, 0, 0, 227, 192, 254, 127, 
+10, 192, 64, 129, 10, 192, 64, 130, 10, 192, 192, 130, 10, 192, 64, 131, 
+10, 192, 192, 131, 10, 192, 64, 132, 10, 192, 192, 132, 31, 0, 128, 0, 
+10, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 
+105, 114, 115, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 117, 
+99, 104, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 111, 112, 112, 
+0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 111, 112, 119, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 111, 116, 112, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 98, 111, 116, 119, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 119, 114, 97, 112, 119, 105, 100, 116, 104, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 117, 110, 100, 111, 115, 116, 97, 99, 
+107, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 114, 101, 100, 111, 115, 
+116, 97, 99, 107, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 235, 0, 0, 0, 250, 0, 0, 0, 2, 0, 7, 22, 0, 
+0, 0, 135, 64, 0, 0, 206, 0, 192, 0, 199, 192, 0, 0, 7, 65, 
+64, 1, 7, 129, 64, 2, 27, 65, 0, 0, 23, 0, 0, 128, 1, 193, 
+0, 0, 65, 193, 0, 0, 219, 0, 0, 0, 23, 0, 1, 128, 135, 65, 
+192, 1, 135, 1, 65, 3, 92, 65, 0, 3, 23, 0, 0, 128, 65, 193, 
+0, 0, 25, 0, 129, 2, 23, 64, 0, 128, 31, 1, 0, 1, 23, 0, 
+0, 128, 95, 1, 0, 1, 31, 0, 128, 0, 5, 0, 0, 0, 3, 0, 
+0, 0, 0, 0, 0, 240, 63, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+115, 116, 121, 108, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 97, 
+98, 111, 118, 101, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 98, 101, 108, 111, 119, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 0, 0, 0, 12, 1, 0, 
+0, 2, 0, 7, 22, 0, 0, 0, 135, 64, 0, 0, 205, 0, 192, 0, 
+199, 192, 0, 0, 7, 65, 64, 1, 7, 129, 64, 2, 27, 65, 0, 0, 
+23, 0, 0, 128, 1, 193, 0, 0, 65, 193, 0, 0, 219, 0, 0, 0, 
+23, 0, 1, 128, 135, 65, 192, 1, 135, 1, 65, 3, 92, 65, 0, 3, 
+23, 0, 0, 128, 65, 193, 0, 0, 25, 64, 1, 2, 23, 64, 0, 128, 
+95, 1, 0, 1, 23, 0, 0, 128, 31, 1, 0, 1, 31, 0, 128, 0, 
+5, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 98, 101, 108, 111, 119, 0, 3, 0, 0, 0, 0, 
+0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 97, 98, 111, 
+118, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 
+1, 0, 0, 24, 1, 0, 0, 1, 0, 8, 16, 0, 0, 0, 75, 0, 
+0, 0, 134, 0, 64, 0, 192, 0, 0, 0, 157, 0, 1, 1, 23, 128, 
+0, 128, 213, 1, 128, 0, 205, 65, 192, 3, 74, 128, 129, 3, 162, 128, 
+0, 0, 35, 129, 254, 127, 134, 128, 64, 0, 199, 192, 64, 0, 0, 1, 
+128, 0, 158, 0, 128, 1, 159, 0, 0, 0, 31, 0, 128, 0, 4, 0, 
+0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 
+115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 16, 0, 0, 0, 
+0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 
+97, 112, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 
+108, 101, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 26, 1, 0, 0, 30, 1, 0, 0, 1, 0, 2, 4, 0, 0, 0, 
+10, 64, 64, 128, 10, 64, 64, 129, 10, 64, 192, 129, 31, 0, 128, 0, 
+4, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 105, 110, 
+101, 115, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 
+112, 119, 105, 100, 116, 104, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+120, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 
+1, 0, 0, 68, 1, 0, 0, 2, 0, 13, 55, 0, 0, 0, 91, 64, 
+0, 0, 23, 64, 0, 128, 134, 0, 64, 0, 71, 64, 64, 1, 135, 128, 
+64, 0, 135, 192, 64, 1, 155, 64, 0, 0, 23, 0, 0, 128, 129, 0, 
+1, 0, 78, 128, 128, 0, 135, 64, 64, 0, 88, 64, 0, 1, 23, 128, 
+9, 128, 139, 0, 0, 0, 203, 64, 0, 0, 202, 128, 193, 130, 1, 1, 
+1, 0, 75, 1, 0, 0, 10, 64, 129, 131, 134, 1, 66, 0, 192, 1, 
+0, 0, 157, 1, 1, 1, 23, 128, 4, 128, 197, 2, 128, 0, 0, 3, 
+0, 5, 221, 130, 0, 1, 205, 130, 193, 5, 74, 1, 129, 4, 13, 193, 
+2, 2, 26, 0, 129, 0, 23, 192, 1, 128, 21, 3, 0, 1, 13, 131, 
+65, 6, 138, 192, 0, 6, 11, 67, 0, 0, 10, 67, 130, 130, 192, 0, 
+0, 6, 0, 1, 128, 5, 74, 1, 193, 4, 21, 3, 128, 1, 13, 131, 
+65, 6, 202, 64, 2, 6, 162, 129, 0, 0, 35, 130, 250, 127, 149, 1, 
+128, 1, 25, 128, 1, 130, 23, 128, 0, 128, 149, 1, 0, 1, 141, 129, 
+65, 3, 138, 192, 0, 3, 10, 64, 128, 128, 10, 128, 128, 132, 135, 64, 
+66, 0, 159, 0, 0, 1, 31, 0, 128, 0, 10, 0, 0, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 112, 119, 105, 100, 
+116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 
+101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 101, 110, 
+116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 119, 110, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 115, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 108, 105, 110, 101, 115, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 0, 0, 1, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 1, 0, 0, 78, 
+1, 0, 0, 4, 0, 21, 26, 0, 0, 0, 7, 1, 64, 0, 7, 65, 
+64, 2, 6, 1, 1, 0, 27, 65, 0, 0, 23, 0, 0, 128, 1, 129, 
+0, 0, 65, 129, 0, 0, 135, 193, 64, 0, 198, 1, 193, 0, 0, 2, 
+128, 0, 221, 1, 1, 1, 23, 128, 2, 128, 7, 195, 2, 0, 69, 3, 
+0, 1, 135, 195, 2, 3, 141, 131, 3, 1, 192, 3, 128, 1, 0, 4, 
+0, 6, 64, 4, 128, 2, 132, 4, 128, 0, 0, 5, 0, 2, 93, 131, 
+0, 4, 64, 1, 128, 6, 226, 129, 0, 0, 99, 130, 252, 127, 31, 0, 
+128, 0, 5, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 
+116, 121, 108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+109, 101, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 120, 115, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 105, 112, 97, 105, 114, 115, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+1, 20, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 1, 0, 0, 128, 1, 
+0, 0, 6, 0, 30, 93, 0, 0, 0, 27, 65, 0, 0, 23, 64, 0, 
+128, 134, 1, 64, 0, 14, 129, 0, 3, 135, 65, 192, 0, 198, 129, 64, 
+0, 204, 193, 192, 3, 221, 193, 1, 1, 71, 3, 65, 0, 71, 67, 193, 
+6, 70, 67, 131, 0, 91, 67, 0, 0, 23, 0, 0, 128, 65, 131, 1, 
+0, 129, 131, 1, 0, 198, 195, 65, 0, 0, 4, 128, 0, 221, 3, 1, 
+1, 23, 128, 17, 128, 4, 5, 128, 0, 141, 133, 4, 3, 142, 4, 66, 
+11, 89, 192, 129, 2, 23, 64, 0, 128, 25, 64, 1, 5, 23, 64, 0, 
+128, 4, 5, 0, 0, 23, 64, 12, 128, 25, 64, 129, 3, 23, 192, 0, 
+128, 25, 128, 130, 2, 23, 64, 0, 128, 1, 5, 2, 0, 23, 192, 10, 
+128, 24, 192, 129, 2, 23, 192, 5, 128, 24, 128, 130, 2, 23, 64, 5, 
+128, 24, 0, 2, 9, 23, 0, 1, 128, 24, 192, 2, 9, 23, 128, 0, 
+128, 0, 5, 128, 4, 64, 5, 0, 6, 23, 0, 8, 128, 24, 0, 2, 
+9, 23, 64, 0, 128, 0, 5, 128, 4, 23, 0, 7, 128, 24, 192, 2, 
+9, 23, 128, 0, 128, 1, 5, 2, 0, 64, 5, 0, 6, 23, 192, 5, 
+128, 25, 128, 4, 4, 23, 64, 5, 128, 25, 192, 2, 9, 23, 192, 4, 
+128, 1, 5, 2, 0, 23, 64, 4, 128, 24, 192, 129, 2, 23, 192, 1, 
+128, 25, 128, 4, 4, 23, 64, 0, 128, 1, 5, 2, 0, 23, 192, 2, 
+128, 24, 0, 2, 9, 23, 64, 2, 128, 0, 5, 128, 4, 23, 192, 1, 
+128, 1, 5, 2, 0, 25, 128, 132, 5, 23, 64, 0, 128, 4, 5, 0, 
+0, 23, 128, 0, 128, 24, 192, 2, 9, 23, 0, 0, 128, 64, 5, 0, 
+6, 133, 5, 0, 1, 199, 69, 66, 0, 199, 197, 132, 11, 205, 197, 5, 
+1, 0, 6, 128, 1, 71, 198, 4, 0, 128, 6, 0, 7, 192, 6, 0, 
+10, 0, 7, 128, 10, 64, 7, 128, 6, 157, 133, 0, 4, 128, 3, 0, 
+11, 226, 131, 0, 0, 99, 132, 237, 127, 31, 0, 128, 0, 10, 0, 0, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 110, 
+87, 105, 100, 116, 104, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 
+110, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+77, 97, 114, 107, 115, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 
+116, 121, 108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+109, 101, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 115, 
+0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 20, 1, 4, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 131, 1, 0, 0, 142, 1, 0, 0, 2, 0, 10, 19, 0, 
+0, 0, 140, 0, 64, 0, 157, 128, 0, 1, 198, 64, 64, 0, 0, 1, 
+0, 1, 221, 0, 1, 1, 23, 192, 1, 128, 21, 2, 128, 3, 26, 0, 
+130, 0, 23, 128, 0, 128, 0, 2, 0, 3, 64, 2, 128, 0, 31, 2, 
+128, 1, 21, 2, 128, 3, 78, 0, 130, 0, 226, 128, 0, 0, 99, 65, 
+253, 127, 196, 0, 128, 0, 223, 0, 128, 1, 31, 0, 128, 0, 2, 0, 
+0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 112, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 1, 
+0, 0, 148, 1, 0, 0, 2, 0, 4, 6, 0, 0, 0, 140, 0, 64, 
+0, 157, 128, 0, 1, 199, 64, 0, 1, 199, 64, 192, 1, 223, 0, 0, 
+1, 31, 0, 128, 0, 2, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 119, 114, 97, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+119, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 
+1, 0, 0, 156, 1, 0, 0, 2, 0, 9, 12, 0, 0, 0, 140, 0, 
+64, 0, 157, 128, 0, 1, 199, 64, 64, 0, 199, 64, 128, 1, 12, 129, 
+64, 0, 128, 1, 128, 0, 29, 193, 128, 1, 128, 1, 128, 1, 192, 1, 
+0, 2, 0, 2, 128, 2, 159, 1, 0, 2, 31, 0, 128, 0, 3, 0, 
+0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 112, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 115, 0, 4, 14, 0, 0, 
+0, 0, 0, 0, 0, 103, 101, 116, 76, 105, 110, 101, 79, 102, 87, 111, 
+114, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 158, 
+1, 0, 0, 170, 1, 0, 0, 3, 0, 10, 26, 0, 0, 0, 155, 64, 
+0, 0, 23, 192, 0, 128, 213, 0, 0, 0, 206, 64, 128, 1, 141, 0, 
+192, 1, 23, 128, 1, 128, 198, 64, 64, 0, 0, 1, 0, 1, 85, 1, 
+0, 0, 78, 65, 128, 2, 77, 1, 192, 2, 221, 128, 128, 1, 128, 0, 
+128, 1, 203, 0, 0, 0, 0, 1, 128, 0, 77, 129, 128, 0, 78, 1, 
+192, 2, 129, 1, 0, 0, 33, 193, 0, 128, 21, 2, 128, 1, 13, 2, 
+64, 4, 71, 194, 1, 0, 202, 64, 2, 4, 32, 129, 254, 127, 223, 0, 
+0, 1, 31, 0, 128, 0, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+0, 240, 63, 4, 4, 0, 0, 0, 0, 0, 0, 0, 109, 105, 110, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 173, 1, 
+0, 0, 180, 1, 0, 0, 1, 0, 10, 19, 0, 0, 0, 75, 0, 0, 
+0, 134, 0, 64, 0, 192, 0, 0, 0, 157, 0, 1, 1, 23, 64, 1, 
+128, 213, 1, 128, 0, 205, 65, 192, 3, 5, 2, 128, 0, 64, 2, 0, 
+3, 29, 130, 0, 1, 74, 0, 130, 3, 162, 128, 0, 0, 35, 193, 253, 
+127, 133, 0, 0, 1, 192, 0, 128, 0, 1, 129, 0, 0, 158, 0, 128, 
+1, 159, 0, 0, 0, 31, 0, 128, 0, 3, 0, 0, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 4, 2, 0, 0, 0, 0, 0, 0, 0, 32, 
+0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 13, 1, 2, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 183, 1, 0, 0, 203, 1, 0, 0, 1, 1, 13, 56, 0, 
+0, 0, 75, 0, 0, 0, 8, 64, 0, 128, 70, 64, 64, 0, 139, 0, 
+0, 0, 230, 0, 0, 0, 164, 64, 0, 0, 93, 0, 1, 1, 23, 64, 
+5, 128, 134, 129, 64, 0, 192, 1, 128, 2, 157, 129, 0, 1, 24, 192, 
+64, 3, 23, 192, 2, 128, 134, 65, 64, 0, 192, 1, 128, 2, 157, 1, 
+1, 1, 23, 0, 1, 128, 198, 2, 64, 0, 6, 3, 64, 0, 21, 3, 
+0, 6, 13, 3, 65, 6, 202, 130, 2, 6, 162, 129, 0, 0, 35, 2, 
+254, 127, 23, 0, 1, 128, 134, 1, 64, 0, 198, 1, 64, 0, 213, 1, 
+128, 3, 205, 1, 193, 3, 138, 65, 129, 3, 98, 128, 0, 0, 227, 192, 
+249, 127, 70, 0, 64, 0, 156, 64, 0, 0, 23, 128, 0, 128, 134, 128, 
+65, 0, 135, 192, 65, 1, 135, 0, 66, 1, 74, 128, 128, 130, 70, 64, 
+66, 0, 134, 0, 64, 0, 203, 64, 0, 0, 6, 193, 66, 0, 202, 0, 
+1, 133, 93, 64, 128, 1, 70, 0, 67, 0, 91, 0, 0, 0, 23, 0, 
+1, 128, 70, 64, 67, 0, 134, 0, 64, 0, 94, 0, 0, 1, 95, 0, 
+0, 0, 23, 64, 0, 128, 70, 0, 64, 0, 95, 0, 0, 1, 31, 0, 
+128, 0, 14, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 
+111, 114, 100, 115, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 
+97, 105, 114, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 121, 
+112, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 98, 108, 
+101, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 115, 116, 121, 108, 101, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 115, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 100, 101, 120, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 80, 97, 114, 97, 103, 114, 
+97, 112, 104, 67, 108, 97, 115, 115, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 68, 69, 66, 85, 71, 0, 4, 17, 0, 0, 0, 0, 0, 0, 
+0, 73, 109, 109, 117, 116, 97, 98, 108, 105, 115, 101, 65, 114, 114, 97, 
+121, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+206, 1, 0, 0, 208, 1, 0, 0, 2, 0, 7, 8, 0, 0, 0, 133, 
+0, 0, 0, 204, 0, 64, 0, 65, 65, 0, 0, 142, 65, 192, 0, 221, 
+0, 0, 2, 158, 0, 0, 0, 159, 0, 0, 0, 31, 0, 128, 0, 2, 
+0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 117, 98, 0, 
+3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 1, 0, 0, 
+0, 1, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 211, 1, 0, 0, 231, 1, 0, 0, 2, 
+0, 9, 31, 0, 0, 0, 149, 0, 0, 0, 193, 0, 0, 0, 26, 128, 
+128, 1, 23, 192, 5, 128, 24, 64, 192, 0, 23, 0, 0, 128, 223, 0, 
+0, 1, 5, 1, 0, 0, 70, 129, 192, 0, 71, 193, 192, 2, 128, 1, 
+0, 0, 192, 1, 128, 1, 93, 1, 128, 1, 29, 129, 0, 0, 76, 1, 
+65, 0, 192, 1, 128, 1, 13, 2, 129, 1, 14, 2, 64, 4, 93, 129, 
+0, 2, 133, 1, 0, 1, 192, 1, 128, 2, 157, 129, 0, 1, 25, 128, 
+129, 0, 23, 0, 0, 128, 223, 0, 0, 1, 78, 128, 129, 0, 205, 0, 
+129, 1, 23, 64, 249, 127, 13, 1, 64, 1, 31, 1, 0, 1, 31, 0, 
+128, 0, 5, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 3, 
+0, 0, 0, 0, 0, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 115, 116, 114, 105, 110, 103, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 98, 121, 116, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+117, 98, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 12, 0, 0, 1, 
+11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 233, 1, 0, 0, 71, 2, 0, 0, 0, 0, 12, 
+85, 0, 0, 0, 11, 0, 128, 5, 75, 64, 1, 0, 74, 64, 64, 128, 
+74, 192, 64, 129, 74, 192, 64, 130, 74, 128, 193, 130, 74, 128, 193, 131, 
+139, 64, 1, 0, 138, 0, 66, 128, 138, 64, 66, 129, 138, 64, 66, 130, 
+138, 128, 194, 130, 138, 128, 193, 131, 203, 64, 1, 0, 202, 192, 66, 128, 
+202, 0, 67, 129, 202, 0, 67, 130, 202, 64, 195, 130, 202, 128, 193, 131, 
+11, 65, 1, 0, 10, 129, 67, 128, 10, 193, 67, 129, 10, 193, 67, 130, 
+10, 129, 193, 130, 10, 129, 193, 131, 75, 65, 1, 0, 74, 1, 68, 128, 
+74, 65, 68, 129, 74, 65, 68, 130, 74, 129, 193, 130, 74, 129, 193, 131, 
+139, 129, 1, 0, 138, 129, 68, 128, 138, 193, 68, 129, 138, 1, 69, 130, 
+138, 129, 197, 138, 138, 129, 193, 130, 138, 129, 193, 131, 203, 193, 1, 0, 
+202, 193, 69, 128, 202, 1, 70, 129, 202, 65, 70, 130, 202, 129, 193, 130, 
+202, 129, 193, 131, 202, 129, 197, 138, 202, 193, 70, 141, 11, 130, 1, 0, 
+10, 2, 71, 128, 10, 66, 71, 129, 10, 66, 70, 130, 10, 130, 193, 130, 
+10, 130, 193, 131, 10, 130, 197, 138, 75, 130, 1, 0, 74, 130, 71, 128, 
+74, 194, 71, 129, 74, 2, 69, 130, 74, 130, 197, 138, 74, 2, 200, 130, 
+74, 2, 200, 131, 139, 130, 1, 0, 138, 66, 72, 128, 138, 130, 72, 129, 
+138, 130, 72, 130, 138, 130, 197, 138, 138, 2, 200, 130, 138, 2, 200, 131, 
+203, 130, 1, 0, 202, 194, 72, 128, 202, 2, 73, 129, 202, 66, 73, 130, 
+202, 2, 200, 138, 202, 2, 200, 130, 202, 2, 200, 131, 36, 64, 128, 5, 
+70, 128, 73, 0, 128, 0, 0, 0, 93, 0, 1, 1, 23, 64, 0, 128, 
+135, 129, 192, 2, 10, 64, 1, 3, 98, 128, 0, 0, 227, 192, 254, 127, 
+31, 0, 0, 1, 31, 0, 128, 0, 39, 0, 0, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 100, 101, 115, 99, 0, 4, 11, 0, 0, 0, 0, 
+0, 0, 0, 80, 108, 97, 105, 110, 32, 116, 101, 120, 116, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 80, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+104, 116, 109, 108, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 97, 98, 
+111, 118, 101, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 98, 101, 108, 111, 119, 0, 4, 11, 0, 0, 
+0, 0, 0, 0, 0, 72, 101, 97, 100, 105, 110, 103, 32, 35, 49, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 49, 0, 3, 0, 0, 0, 
+0, 0, 0, 8, 64, 4, 11, 0, 0, 0, 0, 0, 0, 0, 72, 101, 
+97, 100, 105, 110, 103, 32, 35, 50, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 72, 50, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 72, 101, 97, 100, 105, 110, 103, 32, 35, 
+51, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 51, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 72, 101, 97, 100, 105, 110, 103, 32, 35, 
+52, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 52, 0, 4, 14, 
+0, 0, 0, 0, 0, 0, 0, 73, 110, 100, 101, 110, 116, 101, 100, 32, 
+116, 101, 120, 116, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 81, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 66, 76, 79, 67, 75, 81, 85, 
+79, 84, 69, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 
+101, 110, 116, 0, 3, 0, 0, 0, 0, 0, 0, 16, 64, 4, 22, 0, 
+0, 0, 0, 0, 0, 0, 76, 105, 115, 116, 32, 105, 116, 101, 109, 32, 
+119, 105, 116, 104, 32, 98, 117, 108, 108, 101, 116, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 76, 66, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 76, 73, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 98, 117, 108, 
+108, 101, 116, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 45, 0, 4, 
+25, 0, 0, 0, 0, 0, 0, 0, 76, 105, 115, 116, 32, 105, 116, 101, 
+109, 32, 119, 105, 116, 104, 111, 117, 116, 32, 98, 117, 108, 108, 101, 116, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 76, 0, 4, 28, 0, 0, 
+0, 0, 0, 0, 0, 73, 110, 100, 101, 110, 116, 101, 100, 32, 116, 101, 
+120, 116, 44, 32, 114, 117, 110, 32, 116, 111, 103, 101, 116, 104, 101, 114, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 86, 0, 3, 0, 0, 0, 
+0, 0, 0, 0, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 80, 114, 
+101, 102, 111, 114, 109, 97, 116, 116, 101, 100, 32, 116, 101, 120, 116, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 80, 82, 69, 0, 4, 33, 0, 
+0, 0, 0, 0, 0, 0, 82, 97, 119, 32, 100, 97, 116, 97, 32, 101, 
+120, 112, 111, 114, 116, 101, 100, 32, 116, 111, 32, 111, 117, 116, 112, 117, 
+116, 32, 102, 105, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+82, 65, 87, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 
+97, 105, 114, 115, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 73, 2, 0, 0, 75, 2, 0, 0, 0, 0, 2, 5, 0, 
+0, 0, 6, 0, 64, 0, 69, 0, 128, 0, 93, 128, 128, 0, 10, 64, 
+128, 128, 31, 0, 128, 0, 2, 0, 0, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 115, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 21, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 
+2, 0, 0, 90, 2, 0, 0, 0, 0, 5, 20, 0, 0, 0, 11, 128, 
+1, 0, 70, 64, 64, 0, 10, 64, 0, 128, 10, 192, 64, 129, 10, 64, 
+65, 130, 75, 0, 0, 0, 10, 64, 0, 131, 69, 0, 128, 0, 93, 128, 
+128, 0, 10, 64, 128, 131, 75, 0, 0, 0, 10, 64, 0, 132, 70, 64, 
+66, 0, 128, 0, 0, 0, 203, 64, 0, 0, 6, 193, 66, 0, 202, 0, 
+1, 133, 93, 64, 128, 1, 31, 0, 0, 1, 31, 0, 128, 0, 12, 0, 
+0, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 102, 105, 108, 101, 102, 
+111, 114, 109, 97, 116, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 70, 
+73, 76, 69, 70, 79, 82, 77, 65, 84, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 97, 116, 117, 115, 98, 97, 114, 0, 1, 1, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 105, 100, 108, 101, 116, 105, 109, 101, 
+0, 3, 0, 0, 0, 0, 0, 0, 8, 64, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 100, 111, 99, 117, 109, 101, 110, 116, 115, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 115, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 97, 100, 100, 111, 110, 115, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 
+108, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 
+100, 101, 120, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 67, 108, 97, 115, 115, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 0, 0, 1, 21, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 2, 
+0, 0, 108, 2, 0, 0, 0, 0, 5, 26, 0, 0, 0, 11, 128, 1, 
+0, 10, 64, 64, 128, 10, 192, 64, 129, 10, 64, 65, 130, 10, 192, 64, 
+131, 10, 192, 192, 131, 10, 192, 64, 132, 70, 64, 66, 0, 128, 0, 0, 
+0, 203, 64, 0, 0, 6, 193, 66, 0, 202, 0, 1, 133, 93, 64, 128, 
+1, 70, 0, 67, 0, 134, 64, 67, 0, 135, 128, 67, 1, 135, 192, 67, 
+1, 203, 0, 128, 0, 1, 1, 4, 0, 228, 64, 128, 0, 93, 128, 128, 
+1, 140, 64, 68, 0, 0, 1, 128, 0, 157, 64, 128, 1, 31, 0, 0, 
+1, 31, 0, 128, 0, 18, 0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 119, 114, 97, 112, 119, 105, 100, 116, 104, 0, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 118, 105, 101, 119, 109, 111, 100, 101, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 109, 97, 114, 103, 105, 110, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 99, 111, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 95, 95, 105, 110, 100, 101, 120, 0, 4, 14, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 67, 108, 97, 
+115, 115, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 
+116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 115, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 97, 
+112, 112, 101, 110, 100, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/forms.lua */
+static const char file_10[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 145, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 134, 128, 64, 0, 135, 0, 65, 1, 198, 128, 64, 0, 199, 64, 193, 
+1, 6, 129, 64, 0, 7, 129, 65, 2, 70, 129, 64, 0, 71, 193, 193, 
+2, 134, 129, 64, 0, 135, 1, 66, 3, 198, 129, 64, 0, 199, 65, 194, 
+3, 6, 130, 64, 0, 7, 130, 66, 4, 70, 130, 64, 0, 71, 194, 194, 
+4, 134, 130, 64, 0, 135, 2, 67, 5, 198, 66, 67, 0, 199, 130, 195, 
+5, 11, 3, 0, 0, 8, 0, 131, 135, 6, 195, 67, 0, 75, 3, 0, 
+0, 10, 67, 3, 136, 6, 195, 67, 0, 75, 3, 0, 0, 10, 67, 131, 
+136, 6, 195, 67, 0, 75, 3, 0, 0, 10, 67, 3, 137, 6, 195, 67, 
+0, 70, 195, 67, 0, 71, 131, 196, 6, 10, 67, 131, 137, 6, 195, 67, 
+0, 75, 3, 0, 0, 10, 67, 3, 138, 37, 3, 0, 0, 101, 67, 0, 
+0, 165, 131, 0, 0, 198, 195, 67, 0, 0, 4, 0, 7, 75, 68, 0, 
+0, 165, 196, 0, 0, 74, 132, 4, 139, 29, 132, 0, 1, 202, 3, 132, 
+138, 198, 195, 67, 0, 0, 4, 0, 7, 75, 132, 0, 0, 165, 4, 1, 
+0, 74, 132, 4, 139, 165, 68, 1, 0, 74, 132, 4, 140, 29, 132, 0, 
+1, 202, 3, 132, 139, 198, 195, 67, 0, 0, 4, 0, 7, 75, 132, 0, 
+0, 134, 196, 67, 0, 135, 132, 68, 9, 74, 132, 4, 141, 165, 132, 1, 
+0, 74, 132, 4, 139, 29, 132, 0, 1, 202, 3, 132, 140, 229, 195, 1, 
+0, 6, 196, 67, 0, 64, 4, 0, 7, 139, 68, 1, 0, 138, 68, 71, 
+142, 138, 196, 70, 143, 138, 4, 200, 143, 229, 4, 2, 0, 138, 196, 4, 
+139, 138, 196, 131, 144, 93, 132, 0, 1, 10, 68, 132, 141, 6, 196, 67, 
+0, 64, 4, 0, 7, 139, 196, 2, 0, 138, 4, 200, 143, 229, 68, 2, 
+0, 138, 196, 132, 145, 229, 132, 2, 0, 138, 196, 4, 139, 229, 196, 2, 
+0, 138, 196, 4, 146, 229, 4, 3, 0, 138, 196, 132, 146, 229, 68, 3, 
+0, 138, 196, 4, 147, 229, 132, 3, 0, 138, 196, 132, 147, 229, 196, 3, 
+0, 138, 196, 4, 148, 229, 4, 4, 0, 138, 196, 132, 148, 229, 68, 4, 
+0, 138, 196, 4, 149, 229, 132, 4, 0, 138, 196, 132, 149, 93, 132, 0, 
+1, 10, 68, 4, 145, 6, 196, 67, 0, 64, 4, 0, 7, 139, 68, 2, 
+0, 138, 4, 200, 143, 229, 196, 4, 0, 138, 196, 132, 145, 229, 4, 5, 
+0, 138, 196, 132, 150, 229, 68, 5, 0, 138, 196, 4, 151, 229, 132, 5, 
+0, 138, 196, 4, 139, 229, 196, 5, 0, 138, 196, 132, 151, 229, 4, 6, 
+0, 138, 196, 4, 152, 229, 68, 6, 0, 138, 196, 132, 152, 229, 132, 6, 
+0, 138, 196, 4, 153, 93, 132, 0, 1, 10, 68, 4, 150, 11, 132, 0, 
+0, 101, 196, 6, 0, 10, 68, 132, 151, 101, 4, 7, 0, 10, 68, 4, 
+152, 101, 68, 7, 0, 165, 132, 7, 0, 198, 196, 67, 0, 37, 197, 7, 
+0, 202, 4, 133, 153, 198, 196, 67, 0, 37, 5, 8, 0, 202, 4, 5, 
+154, 31, 0, 128, 0, 53, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 109, 97, 116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+102, 108, 111, 111, 114, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 
+103, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 114, 105, 116, 101, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 103, 111, 116, 111, 120, 121, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 115, 116, 114, 
+105, 110, 103, 119, 105, 100, 116, 104, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 103, 101, 116, 98, 111, 117, 110, 100, 101, 100, 115, 116, 114, 105, 
+110, 103, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 98, 
+121, 116, 101, 115, 111, 102, 99, 104, 97, 114, 97, 99, 116, 101, 114, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 110, 111, 114, 109, 
+97, 108, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 98, 
+111, 108, 100, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 
+98, 114, 105, 103, 104, 116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+115, 101, 116, 117, 110, 100, 101, 114, 108, 105, 110, 101, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 115, 101, 116, 114, 101, 118, 101, 114, 115, 101, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 114, 101, 112, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 76, 101, 102, 116, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 82, 105, 103, 104, 116, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 67, 101, 110, 116, 114, 101, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 67, 101, 110, 116, 101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 76, 97, 114, 103, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 68, 105, 118, 105, 100, 101, 114, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 100, 114, 97, 119, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+87, 114, 97, 112, 112, 101, 100, 76, 97, 98, 101, 108, 0, 4, 17, 0, 
+0, 0, 0, 0, 0, 0, 99, 97, 108, 99, 117, 108, 97, 116, 101, 95, 
+104, 101, 105, 103, 104, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+76, 97, 98, 101, 108, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 97, 
+108, 105, 103, 110, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 104, 
+101, 99, 107, 98, 111, 120, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+118, 97, 108, 117, 101, 0, 1, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 108, 97, 98, 101, 108, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+102, 111, 99, 117, 115, 97, 98, 108, 101, 0, 1, 1, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 32, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+84, 101, 120, 116, 70, 105, 101, 108, 100, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 105, 110, 105, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 75, 69, 89, 95, 76, 69, 70, 84, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 75, 69, 89, 95, 82, 73, 71, 72, 84, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 72, 79, 77, 69, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 69, 78, 68, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 66, 65, 67, 
+75, 83, 80, 65, 67, 69, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 
+75, 69, 89, 95, 68, 69, 76, 69, 84, 69, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 75, 69, 89, 95, 94, 85, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 107, 101, 121, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 66, 114, 111, 119, 115, 101, 114, 0, 4, 14, 0, 0, 0, 0, 0, 
+0, 0, 95, 97, 100, 106, 117, 115, 116, 79, 102, 102, 115, 101, 116, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 110, 103, 101, 100, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 85, 80, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 68, 79, 
+87, 78, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 
+80, 71, 85, 80, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 75, 69, 
+89, 95, 80, 71, 68, 78, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+82, 117, 110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 84, 101, 115, 
+116, 0, 33, 0, 0, 0, 29, 0, 0, 0, 35, 0, 0, 0, 2, 0, 
+2, 6, 0, 0, 0, 25, 64, 0, 0, 23, 64, 0, 128, 31, 0, 0, 
+1, 23, 0, 0, 128, 95, 0, 0, 1, 31, 0, 128, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 
+0, 43, 0, 0, 0, 2, 0, 2, 6, 0, 0, 0, 25, 0, 128, 0, 
+23, 64, 0, 128, 31, 0, 0, 1, 23, 0, 0, 128, 95, 0, 0, 1, 
+31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 45, 0, 0, 0, 51, 0, 0, 0, 1, 0, 2, 3, 
+0, 0, 0, 101, 0, 0, 0, 95, 0, 0, 1, 31, 0, 128, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 46, 0, 0, 0, 50, 0, 0, 0, 1, 
+0, 5, 10, 0, 0, 0, 70, 0, 64, 0, 128, 0, 0, 0, 203, 64, 
+0, 0, 5, 1, 128, 0, 202, 0, 129, 128, 93, 64, 128, 1, 69, 0, 
+128, 0, 10, 64, 0, 129, 31, 0, 0, 1, 31, 0, 128, 0, 3, 0, 
+0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 109, 101, 
+116, 97, 116, 97, 98, 108, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 95, 95, 105, 110, 100, 101, 120, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 99, 108, 97, 115, 115, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 55, 0, 0, 0, 57, 0, 0, 0, 1, 0, 7, 9, 0, 0, 
+0, 69, 0, 0, 0, 135, 0, 64, 0, 199, 64, 64, 0, 5, 1, 128, 
+0, 65, 129, 0, 0, 135, 193, 64, 0, 29, 1, 128, 1, 93, 64, 0, 
+0, 31, 0, 128, 0, 4, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 114, 101, 97, 108, 120, 49, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 114, 101, 97, 108, 121, 49, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 226, 148, 128, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 114, 
+101, 97, 108, 119, 105, 100, 116, 104, 0, 0, 0, 0, 0, 2, 0, 0, 
+0, 1, 1, 1, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 70, 0, 0, 
+0, 1, 0, 13, 23, 0, 0, 0, 70, 0, 64, 0, 135, 64, 64, 0, 
+93, 128, 0, 1, 134, 128, 64, 0, 196, 0, 0, 0, 0, 1, 128, 0, 
+157, 128, 128, 1, 204, 192, 64, 1, 71, 1, 65, 0, 221, 128, 128, 1, 
+1, 65, 1, 0, 85, 1, 128, 1, 129, 65, 1, 0, 33, 129, 1, 128, 
+12, 130, 65, 1, 135, 194, 129, 1, 199, 194, 65, 0, 7, 3, 66, 0, 
+13, 195, 1, 6, 14, 67, 65, 6, 29, 66, 128, 2, 32, 193, 253, 127, 
+31, 0, 128, 0, 9, 0, 0, 0, 4, 21, 0, 0, 0, 0, 0, 0, 
+0, 80, 97, 114, 115, 101, 83, 116, 114, 105, 110, 103, 73, 110, 116, 111, 
+87, 111, 114, 100, 115, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 
+97, 108, 117, 101, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 67, 114, 
+101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 112, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 114, 101, 97, 108, 119, 105, 100, 116, 104, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 11, 0, 0, 0, 0, 0, 0, 
+0, 114, 101, 110, 100, 101, 114, 76, 105, 110, 101, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 114, 101, 97, 108, 120, 49, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 114, 101, 97, 108, 121, 49, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 77, 0, 
+0, 0, 1, 0, 6, 13, 0, 0, 0, 70, 0, 64, 0, 135, 64, 64, 
+0, 93, 128, 0, 1, 134, 128, 64, 0, 196, 0, 0, 0, 0, 1, 128, 
+0, 157, 128, 128, 1, 204, 192, 64, 1, 71, 1, 65, 0, 221, 128, 128, 
+1, 21, 1, 128, 1, 31, 1, 0, 1, 31, 0, 128, 0, 5, 0, 0, 
+0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 80, 97, 114, 115, 101, 83, 
+116, 114, 105, 110, 103, 73, 110, 116, 111, 87, 111, 114, 100, 115, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+119, 114, 97, 112, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
+97, 108, 119, 105, 100, 116, 104, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 95, 0, 0, 0, 1, 0, 
+8, 48, 0, 0, 0, 68, 0, 0, 0, 135, 0, 64, 0, 198, 64, 64, 
+0, 199, 128, 192, 1, 24, 192, 0, 1, 23, 64, 2, 128, 133, 0, 128, 
+0, 199, 192, 64, 0, 5, 1, 0, 1, 71, 1, 65, 0, 29, 129, 0, 
+1, 206, 0, 129, 1, 208, 64, 193, 1, 157, 128, 0, 1, 64, 0, 0, 
+1, 23, 0, 4, 128, 135, 0, 64, 0, 198, 64, 64, 0, 199, 128, 193, 
+1, 24, 192, 0, 1, 23, 64, 0, 128, 65, 192, 1, 0, 23, 64, 2, 
+128, 135, 0, 64, 0, 198, 64, 64, 0, 199, 0, 194, 1, 24, 192, 0, 
+1, 23, 0, 1, 128, 135, 192, 64, 0, 197, 0, 0, 1, 7, 1, 65, 
+0, 221, 128, 0, 1, 78, 192, 0, 1, 133, 0, 128, 1, 199, 64, 66, 
+0, 7, 129, 66, 0, 69, 1, 0, 2, 129, 193, 2, 0, 199, 193, 64, 
+0, 93, 1, 128, 1, 157, 64, 0, 0, 133, 0, 128, 1, 199, 64, 66, 
+0, 205, 64, 128, 1, 7, 129, 66, 0, 71, 1, 65, 0, 157, 64, 0, 
+2, 31, 0, 128, 0, 12, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 97, 108, 105, 103, 110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 70, 111, 114, 109, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 67, 
+101, 110, 116, 114, 101, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 114, 
+101, 97, 108, 119, 105, 100, 116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 118, 97, 108, 117, 101, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+64, 4, 5, 0, 0, 0, 0, 0, 0, 0, 76, 101, 102, 116, 0, 3, 
+0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 82, 105, 103, 104, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+114, 101, 97, 108, 120, 49, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+114, 101, 97, 108, 121, 49, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+32, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 1, 0, 1, 3, 
+1, 1, 1, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 101, 0, 0, 0, 
+2, 0, 4, 6, 0, 0, 0, 135, 0, 64, 0, 148, 0, 0, 1, 10, 
+128, 0, 128, 140, 64, 64, 0, 157, 64, 0, 1, 31, 0, 128, 0, 2, 
+0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 
+101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 0, 0, 0, 
+125, 0, 0, 0, 1, 0, 8, 33, 0, 0, 0, 68, 0, 0, 0, 135, 
+0, 64, 0, 155, 0, 0, 0, 23, 64, 0, 128, 65, 64, 0, 0, 23, 
+0, 0, 128, 65, 128, 0, 0, 133, 0, 0, 0, 199, 192, 64, 0, 7, 
+1, 65, 0, 69, 1, 128, 0, 135, 65, 65, 0, 199, 129, 65, 0, 206, 
+193, 193, 3, 93, 1, 128, 1, 157, 64, 0, 0, 133, 0, 0, 1, 157, 
+64, 128, 0, 133, 0, 0, 0, 199, 0, 66, 0, 7, 1, 65, 0, 64, 
+1, 128, 0, 157, 64, 0, 2, 133, 0, 128, 1, 157, 64, 128, 0, 135, 
+64, 66, 0, 155, 0, 0, 0, 23, 192, 0, 128, 133, 0, 0, 2, 199, 
+0, 66, 0, 7, 1, 65, 0, 157, 64, 128, 1, 31, 0, 128, 0, 10, 
+0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 
+101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 62, 32, 89, 69, 83, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 62, 32, 78, 79, 32, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 120, 49, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 121, 49, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 97, 98, 101, 108, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 119, 105, 100, 116, 
+104, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 114, 101, 97, 108, 120, 50, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 102, 111, 99, 117, 115, 0, 0, 0, 0, 0, 5, 0, 
+0, 0, 1, 1, 1, 4, 1, 8, 1, 6, 1, 2, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+133, 0, 0, 0, 136, 0, 0, 0, 1, 0, 3, 14, 0, 0, 0, 71, 
+0, 64, 0, 91, 64, 0, 0, 23, 192, 0, 128, 71, 64, 64, 0, 76, 
+128, 192, 0, 93, 128, 0, 1, 77, 192, 192, 0, 10, 64, 0, 128, 71, 
+0, 65, 0, 91, 64, 0, 0, 23, 0, 0, 128, 65, 192, 0, 0, 10, 
+64, 0, 130, 31, 0, 128, 0, 5, 0, 0, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 108, 101, 110, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 111, 102, 102, 115, 101, 116, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0, 
+174, 0, 0, 0, 1, 0, 10, 80, 0, 0, 0, 69, 0, 0, 0, 93, 
+64, 128, 0, 69, 0, 128, 0, 135, 0, 64, 0, 199, 64, 64, 0, 205, 
+128, 192, 1, 5, 1, 0, 1, 65, 193, 0, 0, 135, 1, 65, 0, 29, 
+1, 128, 1, 93, 64, 0, 0, 69, 0, 128, 0, 135, 0, 64, 0, 199, 
+64, 64, 0, 5, 1, 0, 1, 65, 65, 1, 0, 135, 1, 65, 0, 29, 
+1, 128, 1, 93, 64, 0, 0, 69, 0, 128, 1, 93, 64, 128, 0, 71, 
+128, 65, 0, 135, 192, 65, 0, 25, 128, 128, 0, 23, 64, 0, 128, 71, 
+128, 65, 0, 10, 64, 128, 131, 69, 0, 0, 2, 135, 0, 66, 0, 140, 
+64, 66, 1, 7, 193, 65, 0, 71, 129, 65, 0, 157, 0, 0, 2, 93, 
+128, 0, 0, 135, 0, 65, 0, 90, 128, 128, 0, 23, 64, 2, 128, 133, 
+0, 128, 2, 199, 0, 66, 0, 204, 128, 194, 1, 71, 193, 65, 0, 221, 
+0, 128, 1, 157, 128, 0, 0, 199, 192, 65, 0, 205, 128, 128, 1, 10, 
+192, 128, 131, 23, 192, 250, 127, 69, 0, 0, 3, 135, 0, 66, 0, 140, 
+64, 66, 1, 7, 193, 65, 0, 157, 128, 128, 1, 199, 0, 65, 0, 93, 
+128, 128, 1, 133, 0, 0, 0, 157, 64, 128, 0, 133, 0, 128, 0, 199, 
+0, 64, 0, 7, 65, 64, 0, 64, 1, 128, 0, 157, 64, 0, 2, 133, 
+0, 128, 1, 157, 64, 128, 0, 135, 192, 66, 0, 155, 0, 0, 0, 23, 
+0, 3, 128, 133, 0, 128, 3, 199, 0, 64, 0, 5, 1, 0, 2, 76, 
+65, 194, 0, 193, 129, 0, 0, 7, 130, 65, 0, 71, 194, 65, 0, 14, 
+66, 2, 4, 93, 1, 0, 2, 29, 129, 0, 0, 205, 0, 129, 1, 7, 
+65, 64, 0, 157, 64, 128, 1, 31, 0, 128, 0, 12, 0, 0, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 120, 49, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 121, 49, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 150, 148, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
+97, 108, 119, 105, 100, 116, 104, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 32, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 115, 
+111, 114, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 111, 102, 102, 115, 
+101, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 
+101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 117, 98, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 98, 121, 116, 101, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 102, 111, 99, 117, 115, 0, 0, 0, 0, 0, 
+8, 0, 0, 0, 1, 8, 1, 1, 1, 11, 1, 6, 1, 3, 1, 5, 
+1, 4, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 176, 0, 0, 0, 188, 0, 0, 0, 
+2, 0, 6, 20, 0, 0, 0, 135, 0, 64, 0, 25, 128, 128, 128, 23, 
+64, 3, 128, 135, 0, 64, 0, 142, 64, 64, 1, 10, 128, 0, 128, 133, 
+0, 0, 0, 199, 128, 64, 0, 204, 192, 192, 1, 71, 1, 64, 0, 221, 
+0, 128, 1, 157, 128, 0, 0, 24, 0, 65, 1, 23, 0, 0, 128, 23, 
+192, 252, 127, 140, 64, 65, 0, 157, 64, 0, 1, 129, 128, 1, 0, 159, 
+0, 0, 1, 31, 0, 128, 0, 7, 0, 0, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 
+117, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 121, 116, 101, 
+0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 100, 114, 97, 119, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 110, 111, 112, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 5, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 190, 0, 0, 0, 197, 0, 0, 0, 2, 0, 7, 20, 0, 
+0, 0, 135, 0, 64, 0, 199, 64, 64, 0, 204, 128, 192, 1, 221, 128, 
+0, 1, 26, 192, 0, 1, 23, 128, 2, 128, 135, 0, 64, 0, 197, 0, 
+0, 0, 7, 65, 64, 0, 12, 193, 64, 2, 135, 1, 64, 0, 29, 1, 
+128, 1, 221, 128, 0, 0, 141, 192, 0, 1, 10, 128, 0, 128, 140, 0, 
+65, 0, 157, 64, 0, 1, 129, 64, 1, 0, 159, 0, 0, 1, 31, 0, 
+128, 0, 6, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 
+117, 114, 115, 111, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 
+97, 108, 117, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 108, 101, 
+110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 121, 116, 101, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 110, 111, 112, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 199, 0, 0, 0, 204, 0, 0, 
+0, 2, 0, 4, 6, 0, 0, 0, 10, 64, 64, 128, 140, 128, 64, 0, 
+157, 64, 0, 1, 129, 192, 0, 0, 159, 0, 0, 1, 31, 0, 128, 0, 
+4, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 
+115, 111, 114, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 110, 111, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 206, 0, 0, 0, 211, 0, 0, 0, 2, 0, 4, 10, 
+0, 0, 0, 135, 64, 64, 0, 140, 128, 64, 1, 157, 128, 0, 1, 141, 
+192, 64, 1, 10, 128, 0, 128, 140, 0, 65, 0, 157, 64, 0, 1, 129, 
+64, 1, 0, 159, 0, 0, 1, 31, 0, 128, 0, 6, 0, 0, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 108, 101, 110, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 
+119, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 110, 111, 112, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 213, 0, 0, 0, 230, 
+0, 0, 0, 2, 0, 7, 35, 0, 0, 0, 135, 0, 64, 0, 25, 128, 
+128, 128, 23, 0, 7, 128, 132, 0, 0, 0, 199, 0, 64, 0, 206, 64, 
+192, 1, 10, 192, 0, 128, 197, 0, 0, 0, 7, 129, 64, 0, 12, 193, 
+64, 2, 135, 1, 64, 0, 29, 1, 128, 1, 221, 128, 0, 0, 128, 0, 
+128, 1, 24, 0, 65, 1, 23, 0, 0, 128, 23, 128, 252, 127, 199, 128, 
+64, 0, 204, 64, 193, 1, 65, 65, 0, 0, 135, 1, 64, 0, 142, 65, 
+64, 3, 221, 128, 0, 2, 7, 129, 64, 0, 12, 65, 65, 2, 135, 1, 
+64, 0, 141, 129, 0, 3, 29, 129, 128, 1, 214, 0, 129, 1, 10, 192, 
+0, 129, 204, 128, 65, 0, 221, 64, 0, 1, 129, 192, 1, 0, 159, 0, 
+0, 1, 31, 0, 128, 0, 8, 0, 0, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 3, 0, 0, 0, 0, 0, 
+0, 240, 63, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 
+101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 121, 116, 101, 0, 
+3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 115, 117, 98, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 
+114, 97, 119, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 110, 111, 112, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 5, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 
+0, 0, 0, 242, 0, 0, 0, 2, 0, 8, 30, 0, 0, 0, 135, 0, 
+64, 0, 140, 64, 64, 1, 7, 129, 64, 0, 157, 128, 128, 1, 155, 0, 
+0, 0, 23, 0, 5, 128, 197, 0, 0, 0, 7, 1, 64, 0, 12, 65, 
+64, 2, 135, 129, 64, 0, 29, 1, 128, 1, 221, 128, 0, 0, 7, 1, 
+64, 0, 12, 193, 64, 2, 129, 1, 1, 0, 199, 129, 64, 0, 206, 1, 
+193, 3, 29, 129, 0, 2, 71, 1, 64, 0, 76, 193, 192, 2, 199, 129, 
+64, 0, 205, 193, 128, 3, 93, 129, 128, 1, 22, 65, 1, 2, 10, 0, 
+1, 128, 12, 65, 65, 0, 29, 65, 0, 1, 193, 128, 1, 0, 223, 0, 
+0, 1, 31, 0, 128, 0, 7, 0, 0, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 98, 121, 116, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+99, 117, 114, 115, 111, 114, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+115, 117, 98, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 110, 111, 112, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 244, 0, 0, 0, 251, 0, 0, 0, 2, 0, 
+4, 8, 0, 0, 0, 10, 64, 64, 128, 10, 64, 64, 129, 10, 0, 193, 
+129, 140, 64, 65, 0, 157, 64, 0, 1, 129, 128, 1, 0, 159, 0, 0, 
+1, 31, 0, 128, 0, 7, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 99, 117, 114, 115, 111, 114, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 4, 7, 0, 0, 0, 0, 0, 0, 0, 111, 102, 102, 115, 101, 
+116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 
+0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 100, 114, 97, 119, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 110, 111, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 253, 0, 0, 0, 5, 1, 0, 0, 2, 0, 7, 31, 0, 0, 
+0, 140, 0, 192, 0, 1, 65, 0, 0, 157, 128, 128, 1, 155, 64, 0, 
+0, 23, 0, 6, 128, 135, 128, 64, 0, 140, 192, 64, 1, 1, 1, 1, 
+0, 71, 65, 65, 0, 78, 1, 193, 2, 157, 128, 0, 2, 192, 0, 128, 
+0, 7, 129, 64, 0, 12, 193, 64, 2, 135, 65, 65, 0, 29, 129, 128, 
+1, 150, 0, 1, 1, 10, 128, 0, 129, 135, 64, 65, 0, 197, 0, 0, 
+0, 12, 129, 193, 0, 129, 1, 1, 0, 29, 1, 128, 1, 221, 128, 0, 
+0, 141, 192, 0, 1, 10, 128, 128, 130, 140, 192, 65, 0, 157, 64, 0, 
+1, 129, 0, 2, 0, 159, 0, 0, 1, 31, 0, 128, 0, 9, 0, 0, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 109, 97, 116, 99, 104, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 94, 75, 69, 89, 95, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 115, 117, 98, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 
+115, 111, 114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 121, 116, 
+101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 110, 111, 112, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 1, 0, 0, 14, 
+1, 0, 0, 1, 0, 2, 11, 0, 0, 0, 71, 0, 64, 0, 91, 64, 
+0, 0, 23, 0, 0, 128, 65, 64, 0, 0, 10, 64, 0, 128, 71, 128, 
+64, 0, 91, 64, 0, 0, 23, 0, 0, 128, 65, 192, 0, 0, 10, 64, 
+0, 129, 31, 0, 128, 0, 4, 0, 0, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 3, 0, 0, 0, 0, 0, 
+0, 240, 63, 4, 7, 0, 0, 0, 0, 0, 0, 0, 111, 102, 102, 115, 
+101, 116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 16, 1, 0, 0, 27, 1, 0, 0, 
+1, 0, 6, 36, 0, 0, 0, 71, 0, 64, 0, 135, 64, 64, 0, 24, 
+128, 64, 1, 23, 64, 1, 128, 135, 192, 64, 0, 197, 0, 0, 0, 16, 
+1, 193, 0, 221, 128, 0, 1, 142, 192, 0, 1, 10, 128, 128, 128, 133, 
+0, 128, 0, 199, 64, 64, 0, 7, 193, 64, 0, 157, 128, 128, 1, 10, 
+128, 128, 128, 133, 0, 0, 1, 199, 64, 64, 0, 7, 193, 64, 0, 78, 
+1, 193, 0, 14, 65, 1, 2, 157, 128, 128, 1, 10, 128, 128, 128, 133, 
+0, 128, 0, 199, 64, 64, 0, 7, 65, 65, 0, 21, 1, 0, 2, 78, 
+1, 193, 0, 14, 65, 1, 2, 157, 128, 128, 1, 10, 128, 128, 128, 133, 
+0, 0, 1, 199, 64, 64, 0, 1, 129, 1, 0, 157, 128, 128, 1, 10, 
+128, 128, 128, 31, 0, 128, 0, 7, 0, 0, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 114, 101, 97, 108, 104, 101, 105, 103, 104, 116, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 111, 102, 102, 115, 101, 116, 0, 3, 
+0, 0, 0, 0, 0, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 99, 117, 114, 115, 111, 114, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+64, 4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 3, 0, 0, 0, 
+1, 0, 1, 12, 1, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 1, 0, 0, 31, 1, 
+0, 0, 1, 0, 2, 3, 0, 0, 0, 65, 0, 0, 0, 95, 0, 0, 
+1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 110, 111, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 33, 1, 0, 0, 92, 1, 0, 0, 1, 0, 18, 138, 0, 0, 
+0, 71, 0, 64, 0, 135, 64, 64, 0, 199, 128, 64, 0, 7, 193, 64, 
+0, 69, 1, 0, 0, 129, 1, 1, 0, 206, 65, 193, 1, 93, 129, 128, 
+1, 133, 1, 128, 0, 157, 65, 128, 0, 133, 1, 0, 1, 192, 1, 128, 
+0, 0, 2, 0, 1, 65, 130, 1, 0, 157, 65, 0, 2, 133, 1, 0, 
+1, 205, 193, 193, 0, 0, 2, 0, 1, 64, 2, 128, 2, 157, 65, 0, 
+2, 133, 1, 0, 1, 205, 193, 128, 0, 206, 193, 193, 3, 0, 2, 0, 
+1, 65, 2, 2, 0, 157, 65, 0, 2, 129, 193, 1, 0, 206, 193, 65, 
+2, 1, 194, 1, 0, 161, 129, 2, 128, 133, 2, 0, 1, 192, 2, 128, 
+0, 13, 67, 2, 1, 65, 67, 2, 0, 157, 66, 0, 2, 133, 2, 0, 
+1, 205, 194, 128, 0, 206, 194, 193, 5, 13, 67, 2, 1, 65, 67, 2, 
+0, 157, 66, 0, 2, 160, 193, 252, 127, 133, 1, 0, 1, 192, 1, 128, 
+0, 13, 2, 1, 1, 65, 130, 2, 0, 157, 65, 0, 2, 133, 1, 0, 
+1, 205, 193, 193, 0, 13, 2, 1, 1, 64, 2, 128, 2, 157, 65, 0, 
+2, 133, 1, 0, 1, 205, 193, 128, 0, 206, 193, 193, 3, 13, 2, 1, 
+1, 65, 194, 2, 0, 157, 65, 0, 2, 133, 1, 128, 1, 157, 65, 128, 
+0, 76, 1, 67, 0, 93, 65, 0, 1, 69, 1, 0, 0, 129, 65, 3, 
+0, 206, 65, 193, 1, 93, 129, 128, 1, 129, 129, 3, 0, 206, 65, 65, 
+2, 1, 194, 1, 0, 161, 193, 15, 128, 135, 194, 67, 0, 141, 66, 2, 
+5, 199, 2, 68, 0, 199, 130, 130, 5, 219, 2, 0, 0, 23, 128, 14, 
+128, 7, 67, 68, 0, 24, 0, 3, 5, 23, 128, 0, 128, 5, 3, 0, 
+2, 29, 67, 128, 0, 23, 64, 0, 128, 5, 3, 128, 1, 29, 67, 128, 
+0, 5, 3, 0, 1, 77, 195, 193, 0, 141, 195, 65, 1, 141, 67, 2, 
+7, 192, 3, 128, 2, 29, 67, 0, 2, 5, 3, 128, 2, 71, 131, 196, 
+5, 142, 195, 196, 1, 29, 131, 128, 1, 69, 3, 0, 1, 141, 67, 193, 
+0, 205, 195, 65, 1, 205, 67, 130, 7, 0, 4, 0, 6, 93, 67, 0, 
+2, 71, 3, 68, 0, 85, 3, 128, 6, 142, 67, 65, 2, 25, 64, 3, 
+7, 23, 128, 6, 128, 69, 3, 128, 1, 93, 67, 128, 0, 69, 3, 128, 
+0, 93, 67, 128, 0, 1, 67, 2, 0, 77, 195, 193, 4, 135, 3, 68, 
+0, 149, 3, 0, 7, 79, 131, 131, 6, 142, 195, 65, 2, 80, 131, 131, 
+6, 135, 195, 67, 0, 26, 64, 3, 7, 23, 64, 1, 128, 135, 195, 67, 
+0, 141, 3, 1, 7, 142, 67, 65, 7, 26, 128, 131, 6, 23, 0, 0, 
+128, 1, 3, 5, 0, 133, 3, 0, 1, 205, 195, 128, 0, 206, 195, 193, 
+7, 13, 196, 65, 1, 13, 68, 2, 8, 64, 4, 0, 6, 157, 67, 0, 
+2, 69, 3, 128, 1, 93, 67, 128, 0, 160, 129, 239, 127, 133, 1, 128, 
+1, 157, 65, 128, 0, 31, 0, 128, 0, 21, 0, 0, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 120, 49, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 121, 49, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 119, 105, 100, 116, 104, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 104, 101, 105, 
+103, 104, 116, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 148, 128, 
+0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 226, 148, 140, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 148, 144, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 148, 130, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 226, 148, 148, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+226, 148, 152, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 95, 97, 100, 
+106, 117, 115, 116, 79, 102, 102, 115, 101, 116, 0, 4, 2, 0, 0, 0, 
+0, 0, 0, 0, 32, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 111, 102, 102, 115, 101, 116, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 108, 97, 98, 101, 108, 0, 3, 0, 0, 0, 
+0, 0, 0, 16, 64, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 149, 
+145, 0, 0, 0, 0, 0, 6, 0, 0, 0, 1, 11, 1, 8, 1, 1, 
+1, 6, 1, 10, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 1, 0, 0, 102, 1, 
+0, 0, 2, 0, 4, 14, 0, 0, 0, 135, 0, 64, 0, 25, 128, 128, 
+128, 23, 192, 1, 128, 135, 0, 64, 0, 142, 64, 64, 1, 10, 128, 0, 
+128, 140, 128, 64, 0, 157, 64, 0, 1, 140, 192, 64, 0, 158, 0, 0, 
+1, 159, 0, 0, 0, 129, 0, 1, 0, 159, 0, 0, 1, 31, 0, 128, 
+0, 5, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 117, 
+114, 115, 111, 114, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 99, 104, 97, 110, 103, 101, 100, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 110, 111, 112, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 104, 1, 0, 0, 112, 1, 0, 0, 2, 0, 
+4, 16, 0, 0, 0, 135, 0, 64, 0, 199, 64, 64, 0, 213, 0, 128, 
+1, 25, 192, 0, 1, 23, 192, 1, 128, 135, 0, 64, 0, 141, 128, 64, 
+1, 10, 128, 0, 128, 140, 192, 64, 0, 157, 64, 0, 1, 140, 0, 65, 
+0, 158, 0, 0, 1, 159, 0, 0, 0, 129, 64, 1, 0, 159, 0, 0, 
+1, 31, 0, 128, 0, 6, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 99, 117, 114, 115, 111, 114, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 100, 97, 116, 97, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 110, 103, 101, 100, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 110, 111, 112, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 114, 1, 0, 0, 126, 1, 0, 0, 
+2, 0, 5, 22, 0, 0, 0, 135, 0, 64, 0, 197, 0, 0, 0, 7, 
+65, 64, 0, 16, 129, 64, 2, 221, 128, 0, 1, 206, 192, 0, 1, 10, 
+192, 0, 128, 199, 0, 64, 0, 25, 192, 192, 1, 23, 0, 0, 128, 10, 
+192, 64, 128, 199, 0, 64, 0, 88, 128, 128, 1, 23, 0, 1, 128, 204, 
+0, 65, 0, 221, 64, 0, 1, 204, 64, 65, 0, 222, 0, 0, 1, 223, 
+0, 0, 0, 193, 128, 1, 0, 223, 0, 0, 1, 31, 0, 128, 0, 7, 
+0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 115, 
+111, 114, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 
+104, 101, 105, 103, 104, 116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 
+3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 100, 114, 97, 119, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+99, 104, 97, 110, 103, 101, 100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 110, 111, 112, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 128, 1, 0, 0, 140, 1, 0, 0, 2, 0, 5, 26, 0, 
+0, 0, 135, 0, 64, 0, 197, 0, 0, 0, 7, 65, 64, 0, 16, 129, 
+64, 2, 221, 128, 0, 1, 205, 192, 0, 1, 10, 192, 0, 128, 199, 0, 
+64, 0, 7, 193, 64, 0, 21, 1, 0, 2, 25, 192, 0, 2, 23, 128, 
+0, 128, 199, 192, 64, 0, 213, 0, 128, 1, 10, 192, 0, 128, 199, 0, 
+64, 0, 88, 128, 128, 1, 23, 0, 1, 128, 204, 0, 65, 0, 221, 64, 
+0, 1, 204, 64, 65, 0, 222, 0, 0, 1, 223, 0, 0, 0, 193, 128, 
+1, 0, 223, 0, 0, 1, 31, 0, 128, 0, 7, 0, 0, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 104, 101, 105, 103, 104, 
+116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 100, 97, 116, 97, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 100, 114, 97, 119, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+99, 104, 97, 110, 103, 101, 100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 110, 111, 112, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 145, 1, 0, 0, 164, 1, 0, 0, 2, 0, 5, 23, 0, 
+0, 0, 135, 0, 64, 0, 155, 0, 0, 0, 23, 0, 4, 128, 135, 0, 
+64, 0, 142, 64, 64, 1, 199, 0, 64, 0, 88, 192, 0, 1, 23, 192, 
+2, 128, 24, 128, 64, 1, 23, 0, 0, 128, 149, 0, 0, 0, 199, 128, 
+0, 0, 7, 193, 192, 1, 27, 1, 0, 0, 23, 128, 0, 128, 10, 128, 
+0, 128, 1, 1, 1, 0, 31, 1, 0, 1, 142, 64, 64, 1, 23, 0, 
+252, 127, 129, 64, 1, 0, 159, 0, 0, 1, 31, 0, 128, 0, 6, 0, 
+0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 102, 111, 99, 117, 115, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 3, 0, 0, 0, 0, 0, 
+0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 102, 111, 99, 117, 
+115, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 
+101, 100, 114, 97, 119, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 110, 
+111, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 
+1, 0, 0, 185, 1, 0, 0, 2, 0, 5, 24, 0, 0, 0, 135, 0, 
+64, 0, 155, 0, 0, 0, 23, 64, 4, 128, 135, 0, 64, 0, 141, 64, 
+64, 1, 199, 0, 64, 0, 88, 192, 0, 1, 23, 0, 3, 128, 213, 0, 
+0, 0, 25, 128, 128, 1, 23, 0, 0, 128, 129, 64, 0, 0, 199, 128, 
+0, 0, 7, 129, 192, 1, 27, 1, 0, 0, 23, 128, 0, 128, 10, 128, 
+0, 128, 1, 193, 0, 0, 31, 1, 0, 1, 141, 64, 64, 1, 23, 192, 
+251, 127, 129, 0, 1, 0, 159, 0, 0, 1, 31, 0, 128, 0, 5, 0, 
+0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 102, 111, 99, 117, 115, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 102, 111, 99, 117, 115, 97, 98, 108, 101, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 114, 101, 100, 114, 97, 119, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 110, 111, 112, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 188, 1, 0, 0, 194, 1, 0, 0, 2, 0, 
+3, 7, 0, 0, 0, 25, 0, 64, 0, 23, 128, 0, 128, 141, 64, 0, 
+0, 159, 0, 0, 1, 23, 0, 0, 128, 31, 0, 0, 1, 31, 0, 128, 
+0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196, 1, 0, 0, 205, 1, 
+0, 0, 3, 0, 7, 25, 0, 0, 0, 199, 128, 0, 0, 219, 0, 0, 
+0, 23, 64, 2, 128, 6, 1, 64, 0, 64, 1, 128, 1, 29, 129, 0, 
+1, 24, 64, 64, 2, 23, 0, 1, 128, 0, 1, 128, 1, 64, 1, 128, 
+0, 128, 1, 0, 1, 29, 129, 128, 1, 192, 0, 0, 2, 219, 64, 0, 
+0, 23, 192, 1, 128, 7, 129, 64, 0, 27, 1, 0, 0, 23, 0, 1, 
+128, 7, 129, 64, 0, 64, 1, 128, 0, 128, 1, 0, 1, 29, 129, 128, 
+1, 192, 0, 0, 2, 223, 0, 0, 1, 31, 0, 128, 0, 3, 0, 0, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 121, 112, 101, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 102, 117, 110, 99, 116, 105, 111, 110, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 107, 101, 121, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 207, 1, 0, 0, 
+87, 2, 0, 0, 3, 0, 11, 10, 1, 0, 0, 198, 0, 64, 0, 221, 
+64, 128, 0, 199, 64, 64, 0, 219, 64, 0, 0, 23, 128, 2, 128, 198, 
+128, 64, 0, 0, 1, 0, 0, 221, 0, 1, 1, 23, 0, 1, 128, 7, 
+194, 192, 3, 27, 2, 0, 0, 23, 64, 0, 128, 10, 128, 129, 128, 23, 
+64, 0, 128, 226, 128, 0, 0, 99, 1, 254, 127, 198, 128, 64, 0, 0, 
+1, 0, 0, 221, 0, 1, 1, 23, 0, 1, 128, 7, 2, 193, 3, 27, 
+2, 0, 0, 23, 64, 0, 128, 12, 2, 193, 3, 29, 66, 0, 1, 226, 
+128, 0, 0, 99, 1, 254, 127, 91, 0, 0, 0, 23, 64, 0, 128, 192, 
+0, 128, 0, 221, 64, 128, 0, 199, 64, 65, 0, 6, 129, 65, 0, 7, 
+193, 65, 2, 24, 0, 129, 1, 23, 128, 1, 128, 197, 0, 128, 0, 6, 
+65, 66, 0, 15, 129, 66, 2, 16, 193, 66, 2, 221, 128, 0, 1, 10, 
+192, 0, 132, 23, 64, 0, 128, 199, 64, 65, 0, 10, 192, 0, 132, 199, 
+0, 67, 0, 6, 129, 65, 0, 7, 193, 65, 2, 24, 0, 129, 1, 23, 
+128, 1, 128, 197, 0, 128, 0, 6, 129, 67, 0, 15, 193, 67, 2, 16, 
+129, 66, 2, 221, 128, 0, 1, 10, 192, 128, 134, 23, 64, 0, 128, 199, 
+0, 67, 0, 10, 192, 128, 134, 199, 0, 68, 0, 219, 0, 0, 0, 23, 
+0, 9, 128, 198, 128, 64, 0, 0, 1, 0, 0, 221, 0, 1, 1, 23, 
+128, 7, 128, 7, 66, 196, 3, 25, 0, 2, 137, 23, 192, 6, 128, 7, 
+194, 196, 3, 25, 128, 68, 4, 23, 0, 6, 128, 5, 2, 0, 1, 71, 
+66, 197, 3, 135, 2, 66, 0, 29, 130, 128, 1, 202, 1, 2, 138, 5, 
+2, 0, 1, 71, 194, 197, 3, 135, 2, 66, 0, 29, 130, 128, 1, 202, 
+1, 2, 139, 7, 130, 197, 3, 71, 2, 197, 3, 14, 66, 2, 4, 202, 
+1, 2, 132, 1, 2, 6, 0, 71, 66, 198, 3, 91, 2, 0, 0, 23, 
+128, 0, 128, 76, 66, 198, 3, 93, 130, 0, 1, 0, 2, 128, 4, 71, 
+2, 67, 0, 77, 2, 130, 4, 10, 64, 130, 134, 23, 64, 0, 128, 226, 
+128, 0, 0, 99, 129, 247, 127, 197, 0, 128, 0, 6, 65, 66, 0, 16, 
+193, 70, 2, 71, 1, 66, 0, 80, 193, 198, 2, 14, 65, 1, 2, 221, 
+128, 0, 1, 10, 192, 0, 141, 197, 0, 128, 0, 6, 129, 67, 0, 16, 
+193, 70, 2, 71, 65, 67, 0, 80, 193, 198, 2, 14, 65, 1, 2, 221, 
+128, 0, 1, 10, 192, 0, 142, 198, 128, 64, 0, 0, 1, 0, 0, 221, 
+0, 1, 1, 23, 192, 8, 128, 5, 2, 0, 1, 71, 66, 197, 3, 135, 
+2, 66, 0, 29, 130, 128, 1, 71, 130, 70, 0, 13, 66, 2, 4, 202, 
+1, 2, 138, 5, 2, 0, 1, 71, 66, 196, 3, 135, 66, 67, 0, 29, 
+130, 128, 1, 71, 2, 71, 0, 13, 66, 2, 4, 202, 1, 130, 142, 5, 
+2, 0, 1, 71, 194, 197, 3, 135, 2, 66, 0, 29, 130, 128, 1, 71, 
+130, 70, 0, 13, 66, 2, 4, 202, 1, 2, 139, 5, 2, 0, 1, 71, 
+194, 196, 3, 135, 66, 67, 0, 29, 130, 128, 1, 71, 2, 71, 0, 13, 
+66, 2, 4, 202, 1, 2, 143, 7, 130, 197, 3, 71, 2, 197, 3, 14, 
+66, 2, 4, 202, 1, 2, 132, 7, 130, 199, 3, 71, 66, 199, 3, 14, 
+66, 2, 4, 202, 1, 130, 134, 226, 128, 0, 0, 99, 65, 246, 127, 193, 
+128, 4, 0, 155, 0, 0, 0, 23, 0, 0, 128, 193, 0, 6, 0, 6, 
+193, 71, 0, 71, 129, 70, 0, 78, 1, 198, 2, 135, 1, 71, 0, 142, 
+1, 70, 3, 199, 1, 66, 0, 7, 66, 67, 0, 13, 194, 0, 4, 71, 
+2, 72, 0, 29, 65, 0, 3, 155, 0, 0, 0, 23, 128, 2, 128, 6, 
+65, 72, 0, 71, 129, 70, 0, 135, 1, 71, 0, 199, 65, 67, 0, 141, 
+193, 1, 3, 199, 1, 66, 0, 1, 130, 8, 0, 64, 2, 0, 1, 129, 
+194, 8, 0, 22, 130, 2, 4, 29, 65, 128, 2, 197, 0, 128, 1, 6, 
+65, 66, 0, 14, 1, 70, 2, 70, 129, 67, 0, 78, 1, 198, 2, 221, 
+64, 128, 1, 198, 128, 64, 0, 0, 1, 0, 0, 221, 0, 1, 1, 23, 
+192, 1, 128, 7, 66, 64, 0, 88, 0, 2, 3, 23, 0, 0, 128, 3, 
+66, 0, 0, 3, 2, 128, 0, 202, 1, 130, 128, 12, 2, 201, 3, 29, 
+66, 0, 1, 226, 128, 0, 0, 99, 65, 253, 127, 198, 64, 73, 0, 199, 
+128, 201, 1, 221, 128, 128, 0, 24, 192, 201, 1, 23, 0, 2, 128, 6, 
+1, 64, 0, 29, 65, 128, 0, 6, 129, 65, 0, 7, 1, 74, 2, 64, 
+1, 0, 0, 128, 1, 128, 0, 192, 1, 0, 1, 30, 1, 0, 2, 31, 
+1, 0, 0, 4, 1, 0, 0, 71, 65, 64, 0, 91, 1, 0, 0, 23, 
+192, 1, 128, 71, 65, 64, 0, 71, 65, 1, 0, 133, 1, 0, 2, 192, 
+1, 128, 2, 0, 2, 128, 2, 64, 2, 128, 1, 157, 129, 0, 2, 0, 
+1, 0, 3, 27, 65, 0, 0, 23, 0, 3, 128, 69, 1, 0, 2, 128, 
+1, 0, 0, 192, 1, 0, 0, 0, 2, 128, 1, 93, 129, 0, 2, 28, 
+65, 128, 2, 23, 64, 1, 128, 69, 1, 0, 2, 133, 1, 128, 2, 192, 
+1, 0, 0, 0, 2, 128, 1, 93, 129, 0, 2, 0, 1, 128, 2, 24, 
+64, 74, 2, 23, 192, 1, 128, 70, 129, 65, 0, 71, 1, 202, 2, 128, 
+1, 0, 0, 192, 1, 128, 0, 0, 2, 0, 1, 94, 1, 0, 2, 95, 
+1, 0, 0, 23, 0, 243, 127, 24, 128, 74, 2, 23, 128, 0, 128, 67, 
+1, 0, 0, 95, 1, 0, 1, 23, 192, 241, 127, 24, 192, 74, 2, 23, 
+64, 241, 127, 67, 1, 128, 0, 95, 1, 0, 1, 23, 128, 240, 127, 31, 
+0, 128, 0, 44, 0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 102, 111, 99, 117, 115, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 102, 111, 99, 117, 115, 97, 98, 108, 101, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 105, 110, 105, 116, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 104, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 76, 97, 114, 103, 101, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 114, 101, 97, 108, 119, 105, 100, 116, 104, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 
+0, 3, 0, 0, 0, 0, 0, 0, 24, 64, 3, 0, 0, 0, 0, 0, 
+0, 28, 64, 4, 7, 0, 0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 
+104, 116, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 108, 
+104, 101, 105, 103, 104, 116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+83, 99, 114, 101, 101, 110, 72, 101, 105, 103, 104, 116, 0, 3, 0, 0, 
+0, 0, 0, 0, 20, 64, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 
+116, 114, 101, 116, 99, 104, 121, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 121, 49, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 121, 50, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 114, 101, 97, 108, 120, 49, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 120, 49, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
+97, 108, 120, 50, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 50, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 17, 0, 0, 0, 0, 
+0, 0, 0, 99, 97, 108, 99, 117, 108, 97, 116, 101, 95, 104, 101, 105, 
+103, 104, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 
+108, 120, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 114, 101, 97, 108, 121, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 114, 101, 97, 108, 121, 49, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 114, 101, 97, 108, 121, 50, 0, 4, 14, 0, 0, 0, 
+0, 0, 0, 0, 68, 114, 97, 119, 84, 105, 116, 108, 101, 100, 66, 111, 
+120, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 105, 116, 108, 101, 
+0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 67, 101, 110, 116, 114, 101, 
+73, 110, 70, 105, 101, 108, 100, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 60, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 62, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 119, 103, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 103, 101, 116, 99, 104, 97, 114, 0, 4, 11, 0, 0, 0, 0, 0, 
+0, 0, 75, 69, 89, 95, 82, 69, 83, 73, 90, 69, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 114, 101, 100, 114, 97, 119, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 99, 97, 110, 99, 101, 108, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 0, 0, 0, 0, 0, 6, 
+0, 0, 0, 0, 0, 1, 0, 1, 17, 1, 2, 1, 18, 1, 16, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 91, 2, 0, 0, 93, 2, 0, 0, 0, 0, 4, 6, 0, 
+0, 0, 6, 0, 64, 0, 65, 64, 0, 0, 129, 128, 0, 0, 195, 0, 
+0, 0, 29, 64, 0, 2, 31, 0, 128, 0, 3, 0, 0, 0, 4, 12, 
+0, 0, 0, 0, 0, 0, 0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 
+101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 84, 105, 116, 108, 
+101, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 32, 
+102, 105, 108, 101, 58, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/ui.lua */
+static const char file_11[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 14, 51, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 134, 128, 64, 0, 135, 0, 65, 1, 198, 128, 64, 0, 199, 64, 193, 
+1, 6, 129, 64, 0, 7, 129, 65, 2, 70, 129, 64, 0, 71, 193, 193, 
+2, 134, 129, 64, 0, 135, 1, 66, 3, 198, 129, 64, 0, 199, 65, 194, 
+3, 6, 130, 64, 0, 7, 130, 66, 4, 70, 130, 64, 0, 71, 194, 194, 
+4, 134, 130, 64, 0, 135, 2, 67, 5, 198, 130, 64, 0, 199, 66, 195, 
+5, 6, 131, 64, 0, 7, 131, 67, 6, 101, 3, 0, 0, 8, 64, 131, 
+135, 101, 67, 0, 0, 8, 64, 3, 136, 101, 131, 0, 0, 8, 64, 131, 
+136, 101, 195, 0, 0, 8, 64, 3, 137, 101, 3, 1, 0, 8, 64, 131, 
+137, 101, 67, 1, 0, 8, 64, 3, 138, 101, 131, 1, 0, 8, 64, 131, 
+138, 101, 195, 1, 0, 8, 64, 3, 139, 101, 3, 2, 0, 8, 64, 131, 
+139, 101, 67, 2, 0, 8, 64, 3, 140, 101, 131, 2, 0, 8, 64, 131, 
+140, 101, 195, 2, 0, 8, 64, 3, 141, 31, 0, 128, 0, 27, 0, 0, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 97, 116, 104, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 102, 108, 111, 111, 114, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 119, 114, 105, 116, 101, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 103, 111, 116, 111, 120, 121, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 99, 108, 101, 97, 114, 97, 114, 101, 97, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 115, 101, 116, 110, 111, 114, 109, 97, 108, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 98, 111, 108, 100, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 98, 114, 105, 103, 
+104, 116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 117, 
+110, 100, 101, 114, 108, 105, 110, 101, 0, 4, 11, 0, 0, 0, 0, 0, 
+0, 0, 115, 101, 116, 114, 101, 118, 101, 114, 115, 101, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 115, 101, 116, 100, 105, 109, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 103, 101, 116, 115, 116, 114, 105, 110, 103, 119, 
+105, 100, 116, 104, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
+116, 98, 121, 116, 101, 115, 111, 102, 99, 104, 97, 114, 97, 99, 116, 101, 
+114, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 98, 111, 
+117, 110, 100, 101, 100, 115, 116, 114, 105, 110, 103, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 68, 114, 97, 119, 83, 116, 97, 116, 117, 115, 76, 
+105, 110, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 68, 114, 97, 
+119, 66, 111, 120, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 67, 101, 
+110, 116, 114, 101, 73, 110, 70, 105, 101, 108, 100, 0, 4, 14, 0, 0, 
+0, 0, 0, 0, 0, 76, 65, 108, 105, 103, 110, 73, 110, 70, 105, 101, 
+108, 100, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 82, 65, 108, 105, 
+103, 110, 73, 110, 70, 105, 101, 108, 100, 0, 4, 14, 0, 0, 0, 0, 
+0, 0, 0, 68, 114, 97, 119, 84, 105, 116, 108, 101, 100, 66, 111, 120, 
+0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 109, 101, 100, 105, 
+97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 80, 114, 111, 109, 112, 116, 
+70, 111, 114, 89, 101, 115, 78, 111, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 80, 114, 111, 109, 112, 116, 70, 111, 114, 83, 116, 114, 105, 110, 
+103, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 70, 105, 110, 100, 65, 
+110, 100, 82, 101, 112, 108, 97, 99, 101, 68, 105, 97, 108, 111, 103, 117, 
+101, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 65, 98, 111, 117, 116, 
+68, 105, 97, 108, 111, 103, 117, 101, 0, 12, 0, 0, 0, 19, 0, 0, 
+0, 24, 0, 0, 0, 1, 0, 6, 20, 0, 0, 0, 69, 0, 0, 0, 
+93, 64, 128, 0, 69, 0, 128, 0, 129, 0, 0, 0, 198, 64, 64, 1, 
+206, 128, 192, 1, 6, 193, 64, 1, 14, 129, 64, 2, 70, 65, 64, 1, 
+78, 129, 192, 2, 93, 64, 128, 2, 69, 0, 128, 1, 129, 0, 0, 0, 
+198, 64, 64, 1, 206, 128, 192, 1, 0, 1, 0, 0, 93, 64, 0, 2, 
+69, 0, 0, 2, 93, 64, 128, 0, 31, 0, 128, 0, 4, 0, 0, 0, 
+3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 83, 99, 114, 101, 101, 110, 72, 101, 105, 103, 104, 116, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 0, 0, 0, 0, 
+0, 5, 0, 0, 0, 1, 8, 1, 3, 0, 0, 1, 1, 1, 4, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 26, 0, 0, 0, 42, 0, 0, 0, 4, 0, 14, 67, 0, 
+0, 0, 6, 1, 64, 0, 7, 65, 64, 2, 65, 129, 0, 0, 128, 1, 
+0, 1, 29, 129, 128, 1, 70, 1, 64, 0, 71, 65, 192, 2, 129, 193, 
+0, 0, 192, 1, 0, 1, 93, 129, 128, 1, 133, 1, 128, 0, 206, 1, 
+65, 0, 0, 2, 128, 0, 65, 66, 1, 0, 157, 65, 0, 2, 133, 1, 
+128, 0, 205, 129, 0, 0, 205, 1, 193, 3, 0, 2, 128, 0, 65, 130, 
+1, 0, 157, 65, 0, 2, 133, 1, 128, 0, 206, 1, 65, 0, 13, 194, 
+128, 0, 13, 2, 65, 4, 65, 194, 1, 0, 157, 65, 0, 2, 133, 1, 
+128, 0, 205, 129, 0, 0, 205, 1, 193, 3, 13, 194, 128, 0, 13, 2, 
+65, 4, 65, 2, 2, 0, 157, 65, 0, 2, 133, 1, 128, 0, 205, 1, 
+65, 0, 0, 2, 128, 0, 64, 2, 0, 2, 157, 65, 0, 2, 133, 1, 
+128, 0, 205, 1, 65, 0, 13, 194, 128, 0, 13, 2, 65, 4, 64, 2, 
+0, 2, 157, 65, 0, 2, 141, 1, 193, 0, 205, 193, 128, 0, 1, 2, 
+1, 0, 161, 193, 3, 128, 133, 2, 128, 0, 206, 2, 65, 0, 0, 3, 
+128, 4, 65, 67, 2, 0, 157, 66, 0, 2, 133, 2, 128, 0, 205, 130, 
+0, 0, 205, 2, 193, 5, 0, 3, 128, 4, 65, 131, 2, 0, 157, 66, 
+0, 2, 133, 2, 128, 0, 205, 2, 65, 0, 0, 3, 128, 4, 64, 3, 
+128, 2, 157, 66, 0, 2, 160, 129, 251, 127, 31, 0, 128, 0, 11, 0, 
+0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 
+103, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 114, 101, 112, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 226, 148, 128, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 32, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 32, 226, 148, 140, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 226, 148, 144, 32, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 32, 226, 148, 148, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 226, 148, 152, 32, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 32, 226, 148, 130, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 226, 
+148, 130, 32, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 44, 0, 0, 0, 48, 0, 0, 0, 4, 0, 9, 18, 
+0, 0, 0, 5, 1, 0, 0, 64, 1, 128, 1, 128, 1, 0, 1, 29, 
+129, 128, 1, 192, 0, 0, 2, 5, 1, 128, 0, 69, 1, 0, 1, 128, 
+1, 128, 1, 93, 129, 0, 1, 78, 65, 1, 1, 80, 1, 192, 2, 29, 
+129, 0, 1, 69, 1, 128, 1, 141, 1, 1, 0, 192, 1, 128, 0, 0, 
+2, 128, 1, 93, 65, 0, 2, 31, 0, 128, 0, 1, 0, 0, 0, 3, 
+0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 4, 0, 0, 0, 
+1, 12, 1, 0, 1, 10, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 
+53, 0, 0, 0, 4, 0, 8, 11, 0, 0, 0, 5, 1, 0, 0, 64, 
+1, 128, 1, 128, 1, 0, 1, 29, 129, 128, 1, 192, 0, 0, 2, 5, 
+1, 128, 0, 64, 1, 0, 0, 128, 1, 128, 0, 192, 1, 128, 1, 29, 
+65, 0, 2, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 1, 12, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 59, 
+0, 0, 0, 4, 0, 9, 15, 0, 0, 0, 5, 1, 0, 0, 64, 1, 
+128, 1, 128, 1, 0, 1, 29, 129, 128, 1, 192, 0, 0, 2, 5, 1, 
+128, 0, 64, 1, 128, 1, 29, 129, 0, 1, 14, 1, 1, 1, 69, 1, 
+0, 1, 141, 1, 1, 0, 192, 1, 128, 0, 0, 2, 128, 1, 93, 65, 
+0, 2, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 
+0, 0, 1, 12, 1, 10, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0, 
+70, 0, 0, 0, 6, 0, 11, 28, 0, 0, 0, 133, 1, 0, 0, 157, 
+65, 128, 0, 134, 1, 192, 0, 192, 1, 0, 0, 0, 2, 128, 0, 64, 
+2, 0, 1, 128, 2, 128, 1, 157, 65, 128, 2, 134, 65, 192, 0, 205, 
+129, 64, 0, 0, 2, 128, 0, 64, 2, 0, 1, 128, 2, 0, 2, 157, 
+65, 128, 2, 91, 1, 0, 0, 23, 0, 2, 128, 133, 1, 0, 1, 157, 
+65, 128, 0, 134, 65, 192, 0, 205, 129, 64, 0, 13, 194, 128, 0, 13, 
+130, 64, 4, 64, 2, 0, 1, 128, 2, 128, 2, 157, 65, 128, 2, 133, 
+1, 128, 1, 157, 65, 128, 0, 31, 0, 128, 0, 3, 0, 0, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 68, 114, 97, 119, 66, 111, 120, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 67, 101, 110, 116, 114, 101, 73, 
+110, 70, 105, 101, 108, 100, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+0, 0, 0, 0, 4, 0, 0, 0, 1, 6, 0, 0, 1, 5, 1, 4, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 72, 0, 0, 0, 80, 0, 0, 0, 1, 0, 9, 27, 
+0, 0, 0, 69, 0, 0, 0, 128, 0, 0, 0, 93, 128, 0, 1, 133, 
+0, 128, 0, 198, 0, 64, 1, 206, 64, 128, 1, 208, 64, 192, 1, 157, 
+128, 0, 1, 197, 0, 128, 0, 6, 129, 64, 1, 16, 65, 64, 2, 221, 
+128, 0, 1, 6, 193, 64, 1, 78, 65, 64, 1, 142, 1, 193, 1, 205, 
+65, 192, 0, 1, 2, 1, 0, 29, 65, 128, 2, 5, 1, 128, 1, 64, 
+1, 0, 1, 128, 1, 128, 1, 192, 1, 0, 0, 29, 65, 0, 2, 6, 
+65, 65, 1, 7, 129, 65, 2, 29, 65, 128, 0, 31, 0, 128, 0, 7, 
+0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 83, 99, 114, 101, 
+101, 110, 87, 105, 100, 116, 104, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+64, 4, 13, 0, 0, 0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 110, 
+72, 101, 105, 103, 104, 116, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+68, 114, 97, 119, 66, 111, 120, 0, 3, 0, 0, 0, 0, 0, 0, 240, 
+63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 115, 121, 110, 99, 0, 0, 0, 0, 0, 4, 
+0, 0, 0, 1, 10, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 
+0, 0, 0, 102, 0, 0, 0, 2, 0, 7, 31, 0, 0, 0, 139, 128, 
+1, 0, 220, 64, 0, 0, 23, 0, 0, 128, 193, 64, 0, 0, 138, 192, 
+0, 128, 198, 192, 64, 0, 199, 0, 193, 1, 138, 192, 0, 129, 138, 128, 
+193, 130, 138, 0, 194, 131, 138, 128, 194, 132, 138, 0, 195, 133, 198, 192, 
+64, 0, 199, 64, 195, 1, 11, 65, 1, 0, 10, 65, 0, 135, 10, 1, 
+196, 135, 10, 1, 196, 136, 10, 193, 68, 137, 10, 65, 69, 138, 221, 0, 
+0, 1, 164, 64, 0, 0, 198, 192, 64, 0, 199, 128, 197, 1, 0, 1, 
+0, 1, 70, 193, 69, 0, 129, 1, 6, 0, 221, 64, 0, 2, 198, 64, 
+70, 0, 221, 64, 128, 0, 31, 0, 128, 0, 26, 0, 0, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 116, 105, 116, 108, 101, 0, 4, 8, 0, 
+0, 0, 0, 0, 0, 0, 77, 101, 115, 115, 97, 103, 101, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 104, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 76, 97, 114, 103, 101, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 104, 101, 105, 103, 104, 116, 0, 3, 0, 0, 0, 0, 0, 
+0, 0, 64, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 101, 
+116, 99, 104, 121, 0, 1, 1, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+75, 69, 89, 95, 94, 67, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+99, 97, 110, 99, 101, 108, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+32, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 
+114, 109, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 87, 114, 97, 112, 
+112, 101, 100, 76, 97, 98, 101, 108, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 118, 97, 108, 117, 101, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 121, 49, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 120, 50, 0, 3, 0, 0, 0, 0, 0, 0, 240, 191, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 121, 50, 0, 3, 0, 0, 0, 0, 0, 
+0, 8, 192, 4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 
+99, 114, 101, 101, 110, 0, 4, 24, 0, 0, 0, 0, 0, 0, 0, 112, 
+114, 101, 115, 115, 32, 83, 80, 65, 67, 69, 32, 116, 111, 32, 99, 111, 
+110, 116, 105, 110, 117, 101, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 
+81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 140, 0, 
+0, 0, 2, 0, 10, 38, 0, 0, 0, 132, 0, 0, 0, 229, 0, 0, 
+0, 37, 65, 0, 0, 75, 65, 2, 0, 156, 65, 0, 0, 23, 0, 0, 
+128, 129, 65, 0, 0, 74, 129, 1, 128, 134, 193, 64, 0, 135, 1, 65, 
+3, 74, 129, 1, 129, 74, 129, 193, 130, 74, 1, 194, 131, 74, 129, 194, 
+132, 74, 1, 129, 133, 74, 1, 1, 134, 74, 193, 128, 134, 74, 193, 0, 
+135, 134, 193, 64, 0, 135, 193, 67, 3, 203, 65, 1, 0, 202, 65, 0, 
+136, 202, 129, 196, 136, 202, 129, 196, 137, 202, 65, 69, 138, 202, 193, 69, 
+139, 157, 1, 0, 1, 100, 65, 0, 0, 134, 193, 64, 0, 135, 1, 70, 
+3, 192, 1, 128, 2, 6, 66, 70, 0, 65, 130, 6, 0, 157, 65, 0, 
+2, 134, 193, 70, 0, 157, 65, 128, 0, 159, 0, 0, 1, 31, 0, 128, 
+0, 28, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 105, 
+116, 108, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 77, 101, 115, 
+115, 97, 103, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 105, 
+100, 116, 104, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 70, 111, 114, 
+109, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 101, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 116, 
+0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 114, 101, 116, 99, 104, 121, 0, 1, 1, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 94, 67, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 99, 101, 108, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 110, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 78, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 121, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 89, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 87, 114, 97, 112, 112, 101, 100, 76, 97, 98, 101, 108, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 50, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 191, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 50, 
+0, 3, 0, 0, 0, 0, 0, 0, 8, 192, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 82, 117, 110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 4, 41, 0, 
+0, 0, 0, 0, 0, 0, 89, 32, 102, 111, 114, 32, 121, 101, 115, 44, 
+32, 78, 32, 102, 111, 114, 32, 110, 111, 44, 32, 111, 114, 32, 67, 84, 
+82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 0, 4, 
+12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 
+114, 97, 119, 0, 2, 0, 0, 0, 107, 0, 0, 0, 110, 0, 0, 0, 
+0, 0, 2, 5, 0, 0, 0, 3, 0, 128, 0, 9, 0, 0, 0, 1, 
+0, 0, 0, 31, 0, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 0, 
+0, 0, 115, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 3, 0, 0, 
+0, 9, 0, 0, 0, 1, 0, 0, 0, 31, 0, 0, 1, 31, 0, 128, 
+0, 1, 0, 0, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 
+110, 102, 105, 114, 109, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 2, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142, 0, 
+0, 0, 182, 0, 0, 0, 3, 0, 9, 53, 0, 0, 0, 155, 64, 0, 
+0, 23, 0, 0, 128, 129, 0, 0, 0, 198, 64, 64, 0, 199, 128, 192, 
+1, 11, 129, 1, 0, 10, 129, 128, 129, 76, 65, 65, 1, 93, 129, 0, 
+1, 77, 129, 193, 2, 10, 65, 1, 130, 10, 129, 193, 131, 10, 65, 66, 
+132, 10, 193, 66, 133, 10, 65, 67, 134, 221, 128, 0, 1, 11, 193, 1, 
+1, 10, 1, 0, 135, 70, 65, 64, 0, 71, 1, 196, 2, 10, 65, 129, 
+135, 10, 129, 196, 136, 10, 1, 197, 137, 10, 129, 197, 138, 10, 1, 198, 
+139, 10, 1, 198, 140, 70, 65, 64, 0, 71, 129, 198, 2, 139, 65, 1, 
+0, 138, 65, 128, 129, 138, 129, 193, 131, 138, 129, 65, 132, 138, 193, 66, 
+133, 138, 193, 70, 134, 93, 129, 0, 1, 128, 1, 128, 1, 36, 65, 0, 
+1, 70, 65, 64, 0, 71, 1, 199, 2, 128, 1, 0, 2, 198, 65, 71, 
+0, 1, 130, 7, 0, 93, 129, 0, 2, 134, 193, 71, 0, 157, 65, 128, 
+0, 91, 1, 0, 0, 23, 128, 0, 128, 135, 193, 192, 1, 159, 1, 0, 
+1, 23, 64, 0, 128, 132, 1, 0, 0, 159, 1, 0, 1, 31, 0, 128, 
+0, 32, 0, 0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 84, 101, 120, 116, 70, 105, 101, 108, 100, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 108, 101, 110, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 49, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 3, 0, 0, 
+0, 0, 0, 0, 16, 192, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 
+50, 0, 3, 0, 0, 0, 0, 0, 0, 240, 191, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 121, 50, 0, 3, 0, 0, 0, 0, 0, 0, 8, 192, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 105, 116, 108, 101, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 104, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 101, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 116, 0, 3, 0, 0, 
+0, 0, 0, 0, 16, 64, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 
+116, 114, 101, 116, 99, 104, 121, 0, 1, 1, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 75, 69, 89, 95, 94, 67, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 99, 97, 110, 99, 101, 108, 0, 4, 11, 0, 0, 0, 0, 
+0, 0, 0, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 69, 78, 84, 69, 
+82, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 87, 114, 97, 112, 112, 
+101, 100, 76, 97, 98, 101, 108, 0, 3, 0, 0, 0, 0, 0, 0, 24, 
+192, 4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 4, 13, 
+0, 0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 
+101, 101, 110, 0, 4, 36, 0, 0, 0, 0, 0, 0, 0, 82, 69, 84, 
+85, 82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 
+67, 84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 
+101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 184, 0, 0, 0, 235, 0, 0, 0, 2, 0, 9, 85, 
+0, 0, 0, 27, 64, 0, 0, 23, 0, 0, 128, 1, 0, 0, 0, 91, 
+64, 0, 0, 23, 0, 0, 128, 65, 0, 0, 0, 134, 64, 64, 0, 135, 
+128, 64, 1, 203, 128, 1, 0, 202, 0, 128, 129, 12, 65, 65, 0, 29, 
+129, 0, 1, 13, 129, 65, 2, 202, 0, 1, 130, 202, 0, 194, 131, 202, 
+128, 193, 132, 202, 192, 66, 133, 202, 64, 67, 134, 157, 128, 0, 1, 198, 
+64, 64, 0, 199, 128, 192, 1, 11, 129, 1, 0, 10, 65, 128, 129, 76, 
+65, 193, 0, 93, 129, 0, 1, 77, 129, 193, 2, 10, 65, 1, 130, 10, 
+1, 194, 131, 10, 129, 195, 132, 10, 193, 66, 133, 10, 193, 67, 134, 221, 
+128, 0, 1, 11, 129, 1, 2, 10, 65, 68, 136, 70, 65, 64, 0, 71, 
+193, 196, 2, 10, 65, 1, 137, 10, 65, 69, 138, 10, 193, 69, 139, 10, 
+65, 70, 140, 10, 65, 70, 141, 70, 65, 64, 0, 71, 193, 198, 2, 139, 
+129, 1, 0, 138, 1, 199, 129, 138, 129, 193, 131, 138, 129, 193, 132, 138, 
+65, 71, 133, 138, 129, 65, 134, 198, 65, 64, 0, 199, 193, 199, 3, 138, 
+193, 1, 143, 93, 129, 0, 1, 134, 65, 64, 0, 135, 193, 70, 3, 203, 
+129, 1, 0, 202, 1, 200, 129, 202, 129, 193, 131, 202, 129, 195, 132, 202, 
+65, 71, 133, 202, 129, 67, 134, 6, 66, 64, 0, 7, 194, 71, 4, 202, 
+1, 2, 143, 157, 129, 0, 1, 192, 1, 0, 1, 0, 2, 128, 1, 36, 
+65, 0, 2, 70, 65, 64, 0, 71, 65, 200, 2, 128, 1, 0, 2, 198, 
+129, 72, 0, 1, 194, 8, 0, 93, 129, 0, 2, 134, 1, 73, 0, 157, 
+65, 128, 0, 91, 1, 0, 0, 23, 192, 0, 128, 135, 193, 64, 1, 199, 
+193, 192, 1, 159, 1, 128, 1, 23, 64, 0, 128, 132, 1, 0, 0, 159, 
+1, 0, 1, 31, 0, 128, 0, 37, 0, 0, 0, 4, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 70, 111, 
+114, 109, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 84, 101, 120, 116, 
+70, 105, 101, 108, 100, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 
+97, 108, 117, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 117, 
+114, 115, 111, 114, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 108, 101, 
+110, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 38, 64, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 120, 50, 0, 3, 0, 0, 0, 0, 0, 0, 240, 
+191, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 50, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 64, 3, 0, 0, 0, 0, 0, 0, 8, 64, 3, 
+0, 0, 0, 0, 0, 0, 16, 64, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 116, 105, 116, 108, 101, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 
+70, 105, 110, 100, 32, 97, 110, 100, 32, 82, 101, 112, 108, 97, 99, 101, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 104, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 101, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 116, 0, 3, 
+0, 0, 0, 0, 0, 0, 20, 64, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 75, 69, 89, 95, 94, 67, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 99, 97, 110, 99, 101, 108, 0, 4, 11, 0, 0, 0, 0, 0, 0, 
+0, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 69, 78, 84, 69, 82, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 98, 101, 108, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 70, 105, 110, 100, 58, 0, 3, 0, 
+0, 0, 0, 0, 0, 36, 64, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+97, 108, 105, 103, 110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 76, 
+101, 102, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 82, 101, 112, 
+108, 97, 99, 101, 58, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 
+117, 110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 
+97, 119, 83, 99, 114, 101, 101, 110, 0, 4, 36, 0, 0, 0, 0, 0, 
+0, 0, 82, 69, 84, 85, 82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 
+105, 114, 109, 44, 32, 67, 84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 
+97, 110, 99, 101, 108, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 
+117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 237, 0, 0, 0, 41, 1, 0, 
+0, 0, 0, 10, 112, 0, 0, 0, 11, 192, 1, 3, 10, 64, 64, 128, 
+70, 192, 64, 0, 71, 0, 193, 0, 10, 64, 0, 129, 10, 128, 193, 130, 
+10, 0, 194, 131, 10, 128, 194, 132, 10, 128, 194, 133, 10, 128, 66, 134, 
+70, 192, 64, 0, 71, 64, 195, 0, 139, 128, 1, 0, 193, 192, 3, 0, 
+6, 1, 68, 0, 214, 0, 129, 1, 138, 192, 0, 135, 138, 128, 196, 136, 
+138, 128, 196, 137, 138, 64, 69, 138, 138, 128, 68, 139, 198, 192, 64, 0, 
+199, 0, 198, 1, 138, 192, 128, 139, 93, 128, 0, 1, 134, 192, 64, 0, 
+135, 64, 67, 1, 203, 128, 1, 0, 202, 64, 70, 135, 202, 128, 196, 136, 
+202, 128, 198, 137, 202, 64, 69, 138, 202, 128, 70, 139, 6, 193, 64, 0, 
+7, 1, 70, 2, 202, 0, 129, 139, 157, 128, 0, 1, 198, 192, 64, 0, 
+199, 64, 195, 1, 11, 129, 1, 0, 65, 193, 6, 0, 134, 1, 71, 0, 
+86, 129, 129, 2, 10, 65, 1, 135, 10, 129, 196, 136, 10, 65, 199, 137, 
+10, 65, 69, 138, 10, 65, 71, 139, 70, 193, 64, 0, 71, 1, 198, 2, 
+10, 65, 129, 139, 221, 128, 0, 1, 6, 193, 64, 0, 7, 65, 67, 2, 
+75, 129, 1, 0, 74, 129, 71, 135, 74, 129, 196, 136, 74, 193, 199, 137, 
+74, 65, 69, 138, 74, 193, 71, 139, 134, 193, 64, 0, 135, 1, 70, 3, 
+74, 129, 129, 139, 29, 129, 0, 1, 70, 193, 64, 0, 71, 65, 195, 2, 
+139, 129, 1, 0, 138, 1, 72, 135, 138, 129, 196, 136, 138, 65, 200, 137, 
+138, 65, 69, 138, 138, 65, 72, 139, 198, 193, 64, 0, 199, 1, 198, 3, 
+138, 193, 129, 139, 93, 129, 0, 1, 134, 193, 64, 0, 135, 65, 67, 3, 
+203, 129, 1, 0, 202, 129, 72, 135, 202, 129, 196, 136, 202, 193, 200, 137, 
+202, 65, 69, 138, 202, 193, 72, 139, 6, 194, 64, 0, 7, 2, 70, 4, 
+202, 1, 130, 139, 157, 129, 0, 1, 198, 193, 64, 0, 199, 65, 195, 3, 
+11, 130, 1, 0, 10, 2, 73, 135, 10, 130, 196, 136, 10, 66, 201, 137, 
+10, 66, 69, 138, 10, 66, 73, 139, 70, 194, 64, 0, 71, 2, 198, 4, 
+10, 66, 130, 139, 221, 1, 0, 1, 36, 64, 0, 0, 70, 192, 64, 0, 
+71, 128, 201, 0, 128, 0, 0, 0, 198, 192, 73, 0, 1, 1, 10, 0, 
+93, 128, 0, 2, 134, 64, 74, 0, 157, 64, 128, 0, 132, 0, 0, 0, 
+159, 0, 0, 1, 31, 0, 128, 0, 42, 0, 0, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 116, 105, 116, 108, 101, 0, 4, 18, 0, 0, 0, 
+0, 0, 0, 0, 65, 98, 111, 117, 116, 32, 87, 111, 114, 100, 71, 114, 
+105, 110, 100, 101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 
+105, 100, 116, 104, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 70, 111, 
+114, 109, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 
+101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 
+116, 0, 3, 0, 0, 0, 0, 0, 0, 40, 64, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 75, 69, 89, 95, 94, 67, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 99, 97, 110, 99, 101, 108, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 69, 78, 84, 
+69, 82, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 76, 97, 98, 101, 108, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 
+32, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 86, 69, 82, 83, 73, 
+79, 78, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 49, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 121, 49, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 50, 0, 
+3, 0, 0, 0, 0, 0, 0, 240, 191, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 121, 50, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 97, 108, 
+105, 103, 110, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 67, 101, 110, 
+116, 114, 101, 0, 4, 25, 0, 0, 0, 0, 0, 0, 0, 194, 169, 32, 
+50, 48, 48, 55, 45, 50, 48, 49, 51, 32, 68, 97, 118, 105, 100, 32, 
+71, 105, 118, 101, 110, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 
+21, 0, 0, 0, 0, 0, 0, 0, 70, 105, 108, 101, 32, 102, 111, 114, 
+109, 97, 116, 32, 118, 101, 114, 115, 105, 111, 110, 32, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 70, 73, 76, 69, 70, 79, 82, 77, 65, 84, 
+0, 3, 0, 0, 0, 0, 0, 0, 16, 64, 4, 54, 0, 0, 0, 0, 
+0, 0, 0, 67, 97, 116, 32, 118, 97, 99, 117, 117, 109, 105, 110, 103, 
+32, 40, 110, 41, 58, 32, 112, 111, 105, 110, 116, 108, 101, 115, 115, 32, 
+111, 114, 32, 111, 116, 104, 101, 114, 119, 105, 115, 101, 32, 105, 110, 101, 
+102, 102, 105, 99, 105, 101, 110, 116, 0, 3, 0, 0, 0, 0, 0, 0, 
+24, 64, 4, 54, 0, 0, 0, 0, 0, 0, 0, 32, 32, 32, 32, 100, 
+105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 32, 97, 99, 116, 105, 
+118, 105, 116, 121, 32, 116, 111, 32, 97, 118, 111, 105, 100, 32, 104, 97, 
+118, 105, 110, 103, 32, 116, 111, 32, 115, 101, 116, 116, 108, 101, 32, 32, 
+0, 3, 0, 0, 0, 0, 0, 0, 28, 64, 4, 54, 0, 0, 0, 0, 
+0, 0, 0, 32, 32, 32, 32, 100, 111, 119, 110, 32, 97, 110, 100, 32, 
+100, 111, 32, 115, 111, 109, 101, 32, 114, 101, 97, 108, 32, 119, 114, 105, 
+116, 105, 110, 103, 46, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 0, 3, 0, 0, 0, 0, 0, 0, 
+32, 64, 4, 62, 0, 0, 0, 0, 0, 0, 0, 70, 111, 114, 32, 109, 
+111, 114, 101, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 44, 
+32, 115, 101, 101, 32, 104, 116, 116, 112, 58, 47, 47, 119, 111, 114, 100, 
+103, 114, 105, 110, 100, 101, 114, 46, 115, 111, 117, 114, 99, 101, 102, 111, 
+114, 103, 101, 46, 110, 101, 116, 46, 0, 3, 0, 0, 0, 0, 0, 0, 
+36, 64, 4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 4, 
+13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 
+114, 101, 101, 110, 0, 4, 24, 0, 0, 0, 0, 0, 0, 0, 112, 114, 
+101, 115, 115, 32, 83, 80, 65, 67, 69, 32, 116, 111, 32, 99, 111, 110, 
+116, 105, 110, 117, 101, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 
+117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 
+};
+
+/* This is src/lua/browser.lua */
+static const char file_12[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 14, 29, 0, 0, 
+0, 6, 0, 64, 0, 70, 64, 64, 0, 134, 128, 64, 0, 135, 192, 64, 
+1, 198, 0, 65, 0, 199, 64, 193, 1, 6, 129, 65, 0, 7, 193, 65, 
+2, 70, 129, 65, 0, 71, 1, 194, 2, 134, 129, 65, 0, 135, 65, 66, 
+3, 198, 129, 65, 0, 199, 129, 194, 3, 6, 130, 65, 0, 7, 194, 66, 
+4, 70, 130, 65, 0, 71, 2, 195, 4, 134, 130, 65, 0, 135, 66, 67, 
+5, 198, 130, 65, 0, 199, 130, 195, 5, 6, 131, 65, 0, 7, 195, 67, 
+6, 101, 3, 0, 0, 8, 64, 3, 136, 101, 67, 0, 0, 8, 64, 131, 
+136, 31, 0, 128, 0, 18, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 109, 105, 110, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 109, 
+97, 120, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 97, 116, 104, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 102, 108, 111, 111, 114, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 114, 101, 112, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 119, 114, 105, 116, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 103, 111, 116, 111, 120, 121, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 115, 101, 116, 110, 111, 114, 109, 97, 108, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 115, 101, 116, 98, 111, 108, 100, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 115, 101, 116, 117, 110, 100, 101, 114, 108, 105, 110, 
+101, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 114, 101, 
+118, 101, 114, 115, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 
+101, 116, 100, 105, 109, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 103, 
+101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 104, 0, 4, 20, 
+0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 98, 121, 116, 101, 115, 111, 
+102, 99, 104, 97, 114, 97, 99, 116, 101, 114, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 66, 114, 111, 119, 115, 101, 114, 
+0, 2, 0, 0, 0, 19, 0, 0, 0, 101, 0, 0, 0, 4, 0, 17, 
+170, 0, 0, 0, 11, 1, 0, 0, 70, 1, 64, 0, 71, 65, 192, 2, 
+129, 129, 0, 0, 93, 1, 1, 1, 23, 128, 4, 128, 88, 128, 64, 4, 
+23, 0, 4, 128, 88, 192, 64, 4, 23, 0, 1, 128, 76, 2, 65, 4, 
+193, 66, 1, 0, 93, 130, 128, 1, 91, 66, 0, 0, 23, 64, 2, 128, 
+70, 2, 64, 0, 71, 130, 193, 4, 128, 2, 0, 4, 93, 130, 0, 1, 
+91, 2, 0, 0, 23, 192, 0, 128, 74, 2, 130, 131, 149, 2, 0, 2, 
+141, 2, 66, 5, 10, 65, 2, 5, 98, 65, 0, 0, 227, 129, 250, 127, 
+70, 65, 66, 0, 71, 129, 194, 2, 128, 1, 0, 2, 229, 1, 0, 0, 
+93, 65, 128, 1, 75, 1, 0, 0, 129, 1, 2, 0, 198, 193, 66, 0, 
+0, 2, 0, 2, 221, 1, 1, 1, 23, 128, 4, 128, 1, 3, 3, 0, 
+71, 67, 195, 5, 24, 128, 195, 6, 23, 0, 0, 128, 1, 195, 3, 0, 
+85, 3, 128, 2, 77, 3, 194, 6, 139, 131, 0, 0, 199, 195, 193, 5, 
+138, 195, 3, 136, 192, 3, 0, 6, 7, 196, 193, 5, 214, 3, 132, 7, 
+138, 195, 131, 136, 74, 129, 131, 6, 71, 195, 193, 5, 24, 192, 128, 6, 
+23, 0, 0, 128, 149, 1, 128, 2, 226, 129, 0, 0, 99, 130, 250, 127, 
+213, 1, 128, 2, 24, 128, 196, 3, 23, 64, 1, 128, 213, 1, 128, 2, 
+205, 1, 194, 3, 11, 130, 0, 0, 10, 194, 64, 136, 10, 194, 196, 136, 
+74, 1, 130, 3, 198, 1, 69, 0, 0, 2, 0, 0, 70, 2, 64, 0, 
+71, 66, 197, 4, 93, 130, 128, 0, 128, 2, 128, 0, 192, 2, 128, 2, 
+0, 3, 128, 1, 64, 3, 0, 3, 221, 129, 128, 3, 219, 65, 0, 0, 
+23, 64, 0, 128, 4, 2, 0, 0, 31, 2, 0, 1, 6, 130, 69, 0, 
+24, 192, 69, 4, 23, 192, 1, 128, 12, 2, 193, 3, 129, 2, 6, 0, 
+29, 130, 128, 1, 27, 2, 0, 0, 23, 128, 0, 128, 0, 2, 128, 3, 
+65, 66, 6, 0, 214, 65, 2, 4, 6, 2, 64, 0, 7, 130, 65, 4, 
+64, 2, 128, 3, 29, 194, 0, 1, 155, 64, 0, 0, 23, 192, 3, 128, 
+91, 2, 0, 0, 23, 64, 3, 128, 134, 130, 70, 0, 193, 194, 6, 0, 
+1, 3, 7, 0, 64, 3, 128, 3, 129, 67, 7, 0, 192, 3, 128, 4, 
+22, 195, 3, 6, 157, 66, 128, 1, 134, 130, 71, 0, 192, 2, 0, 0, 
+0, 3, 128, 0, 64, 3, 0, 1, 158, 2, 0, 2, 159, 2, 0, 0, 
+27, 2, 0, 0, 23, 0, 3, 128, 135, 66, 67, 4, 24, 128, 67, 5, 
+23, 64, 2, 128, 134, 2, 64, 0, 135, 194, 71, 5, 192, 2, 128, 3, 
+157, 66, 0, 1, 134, 130, 71, 0, 192, 2, 0, 0, 0, 3, 128, 0, 
+64, 3, 0, 1, 158, 2, 0, 2, 159, 2, 0, 0, 155, 0, 0, 0, 
+23, 64, 7, 128, 91, 66, 0, 0, 23, 192, 6, 128, 134, 2, 72, 0, 
+193, 66, 8, 0, 1, 3, 7, 0, 64, 3, 128, 3, 129, 131, 8, 0, 
+22, 131, 3, 6, 157, 130, 128, 1, 24, 192, 72, 5, 23, 128, 0, 128, 
+196, 2, 0, 0, 223, 2, 0, 1, 23, 192, 3, 128, 155, 2, 0, 0, 
+23, 192, 1, 128, 198, 2, 64, 0, 199, 66, 197, 5, 221, 130, 128, 0, 
+1, 67, 6, 0, 64, 3, 128, 3, 214, 66, 131, 5, 223, 2, 0, 1, 
+23, 64, 1, 128, 198, 130, 71, 0, 0, 3, 0, 0, 64, 3, 128, 0, 
+128, 3, 0, 1, 222, 2, 0, 2, 223, 2, 0, 0, 134, 2, 64, 0, 
+135, 66, 69, 5, 157, 130, 128, 0, 193, 66, 6, 0, 0, 3, 128, 3, 
+150, 2, 3, 5, 159, 2, 0, 1, 31, 0, 128, 0, 36, 0, 0, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 108, 102, 115, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 100, 105, 114, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 46, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 46, 46, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 109, 97, 116, 99, 104, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 94, 37, 46, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 97, 116, 116, 114, 105, 98, 117, 116, 101, 115, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 116, 97, 98, 108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+115, 111, 114, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 
+97, 105, 114, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 32, 32, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 111, 100, 101, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 100, 105, 114, 101, 99, 116, 111, 114, 
+121, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 226, 151, 135, 32, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 108, 97, 98, 101, 108, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 226, 
+151, 135, 32, 46, 46, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 66, 
+114, 111, 119, 115, 101, 114, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 
+99, 117, 114, 114, 101, 110, 116, 100, 105, 114, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 65, 82, 67, 72, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 119, 105, 110, 100, 111, 119, 115, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 94, 37, 97, 58, 36, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 47, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 
+97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 18, 0, 0, 0, 0, 
+0, 0, 0, 70, 105, 108, 101, 32, 105, 110, 97, 99, 99, 101, 115, 115, 
+105, 98, 108, 101, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 84, 104, 
+101, 32, 102, 105, 108, 101, 32, 39, 0, 4, 26, 0, 0, 0, 0, 0, 
+0, 0, 39, 32, 99, 111, 117, 108, 100, 32, 110, 111, 116, 32, 98, 101, 
+32, 97, 99, 99, 101, 115, 115, 101, 100, 58, 32, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 99, 104, 100, 105, 114, 0, 
+4, 15, 0, 0, 0, 0, 0, 0, 0, 80, 114, 111, 109, 112, 116, 70, 
+111, 114, 89, 101, 115, 78, 111, 0, 4, 16, 0, 0, 0, 0, 0, 0, 
+0, 79, 118, 101, 114, 119, 114, 105, 116, 101, 32, 102, 105, 108, 101, 63, 
+0, 4, 47, 0, 0, 0, 0, 0, 0, 0, 39, 32, 97, 108, 114, 101, 
+97, 100, 121, 32, 101, 120, 105, 115, 116, 115, 46, 32, 68, 111, 32, 121, 
+111, 117, 32, 119, 97, 110, 116, 32, 116, 111, 32, 111, 118, 101, 114, 119, 
+114, 105, 116, 101, 32, 105, 116, 63, 0, 0, 1, 0, 0, 0, 30, 0, 
+0, 0, 38, 0, 0, 0, 2, 0, 4, 19, 0, 0, 0, 135, 0, 64, 
+0, 199, 0, 192, 0, 24, 192, 0, 1, 23, 128, 1, 128, 135, 64, 64, 
+0, 199, 64, 192, 0, 89, 192, 0, 1, 23, 0, 0, 128, 131, 64, 0, 
+0, 131, 0, 128, 0, 159, 0, 0, 1, 135, 0, 64, 0, 24, 128, 64, 
+1, 23, 64, 0, 128, 131, 0, 128, 0, 159, 0, 0, 1, 131, 0, 0, 
+0, 159, 0, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 109, 111, 100, 101, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 100, 105, 114, 101, 99, 116, 111, 114, 121, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 103, 0, 0, 0, 181, 0, 0, 0, 6, 0, 18, 108, 0, 0, 
+0, 134, 1, 64, 0, 135, 65, 64, 3, 203, 1, 2, 0, 202, 193, 64, 
+129, 6, 2, 64, 0, 7, 66, 64, 4, 202, 1, 2, 130, 202, 129, 193, 
+130, 202, 1, 194, 131, 202, 129, 194, 132, 202, 1, 195, 133, 202, 193, 128, 
+134, 28, 66, 128, 2, 23, 0, 0, 128, 1, 130, 1, 0, 202, 1, 2, 
+135, 157, 129, 0, 1, 198, 1, 64, 0, 199, 193, 195, 3, 11, 66, 1, 
+0, 69, 2, 128, 0, 128, 2, 0, 1, 93, 130, 0, 1, 77, 2, 196, 
+4, 10, 66, 130, 130, 10, 66, 196, 131, 10, 130, 194, 132, 10, 130, 196, 
+133, 92, 66, 0, 2, 23, 64, 0, 128, 71, 130, 193, 1, 71, 66, 195, 
+4, 10, 66, 130, 137, 221, 129, 0, 1, 37, 2, 0, 0, 68, 2, 0, 
+0, 134, 2, 69, 0, 24, 64, 69, 5, 23, 64, 0, 128, 65, 130, 5, 
+0, 23, 0, 0, 128, 65, 194, 5, 0, 139, 194, 2, 2, 138, 2, 0, 
+140, 198, 2, 64, 0, 199, 130, 198, 5, 138, 194, 130, 140, 198, 2, 64, 
+0, 199, 130, 198, 5, 138, 194, 130, 141, 138, 194, 64, 142, 138, 130, 199, 
+142, 138, 2, 200, 143, 138, 2, 200, 144, 138, 2, 2, 145, 138, 2, 130, 
+145, 138, 2, 2, 146, 138, 2, 130, 146, 198, 2, 64, 0, 199, 130, 201, 
+5, 11, 67, 1, 0, 10, 131, 193, 130, 10, 131, 193, 131, 10, 131, 194, 
+132, 10, 131, 193, 133, 10, 67, 128, 137, 221, 130, 0, 1, 0, 3, 128, 
+3, 64, 3, 0, 3, 134, 3, 64, 0, 135, 131, 73, 7, 203, 67, 1, 
+0, 202, 131, 193, 130, 202, 67, 196, 131, 5, 4, 128, 0, 64, 4, 0, 
+1, 29, 132, 0, 1, 13, 132, 65, 8, 202, 3, 132, 132, 202, 67, 196, 
+133, 202, 131, 128, 137, 157, 131, 0, 1, 198, 3, 64, 0, 199, 131, 201, 
+7, 11, 68, 1, 0, 10, 132, 193, 130, 10, 132, 194, 131, 10, 132, 194, 
+132, 10, 132, 194, 133, 10, 68, 130, 137, 221, 3, 0, 1, 164, 66, 0, 
+0, 198, 2, 64, 0, 199, 194, 201, 5, 0, 3, 0, 5, 70, 3, 74, 
+0, 129, 67, 10, 0, 221, 130, 0, 2, 6, 131, 74, 0, 29, 67, 128, 
+0, 219, 2, 0, 0, 23, 128, 0, 128, 7, 195, 196, 3, 31, 3, 0, 
+1, 23, 64, 0, 128, 4, 3, 0, 0, 31, 3, 0, 1, 31, 0, 128, 
+0, 43, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 70, 111, 
+114, 109, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 66, 114, 111, 119, 
+115, 101, 114, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 102, 111, 99, 
+117, 115, 97, 98, 108, 101, 0, 1, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 116, 121, 112, 101, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 121, 49, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 50, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 191, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 
+50, 0, 3, 0, 0, 0, 0, 0, 0, 20, 192, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 100, 97, 116, 97, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 99, 117, 114, 115, 111, 114, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 84, 101, 120, 116, 70, 105, 101, 108, 100, 0, 3, 0, 0, 0, 
+0, 0, 0, 8, 64, 3, 0, 0, 0, 0, 0, 0, 8, 192, 3, 0, 
+0, 0, 0, 0, 0, 0, 192, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+118, 97, 108, 117, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 65, 
+82, 67, 72, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 119, 105, 110, 
+100, 111, 119, 115, 0, 4, 58, 0, 0, 0, 0, 0, 0, 0, 101, 110, 
+116, 101, 114, 32, 97, 110, 32, 97, 98, 115, 111, 108, 117, 116, 101, 32, 
+112, 97, 116, 104, 32, 111, 114, 32, 100, 114, 105, 118, 101, 32, 108, 101, 
+116, 116, 101, 114, 32, 40, 39, 99, 58, 39, 41, 32, 116, 111, 32, 103, 
+111, 32, 116, 104, 101, 114, 101, 0, 4, 35, 0, 0, 0, 0, 0, 0, 
+0, 101, 110, 116, 101, 114, 32, 97, 110, 32, 97, 98, 115, 111, 108, 117, 
+116, 101, 32, 112, 97, 116, 104, 32, 116, 111, 32, 103, 111, 32, 116, 104, 
+101, 114, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 105, 116, 
+108, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 
+104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 101, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 116, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 101, 116, 99, 
+104, 121, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 
+94, 67, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 99, 
+101, 108, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 
+82, 69, 84, 85, 82, 78, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+99, 111, 110, 102, 105, 114, 109, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 75, 69, 89, 95, 69, 78, 84, 69, 82, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 75, 69, 89, 95, 85, 80, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 75, 69, 89, 95, 68, 79, 87, 78, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 80, 71, 68, 78, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 80, 71, 85, 80, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 98, 101, 108, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 
+101, 110, 0, 4, 36, 0, 0, 0, 0, 0, 0, 0, 82, 69, 84, 85, 
+82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 
+84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 
+100, 114, 97, 119, 0, 1, 0, 0, 0, 119, 0, 0, 0, 126, 0, 0, 
+0, 2, 0, 5, 18, 0, 0, 0, 134, 64, 0, 0, 197, 0, 0, 0, 
+157, 128, 0, 1, 198, 64, 64, 0, 198, 192, 0, 1, 199, 128, 192, 1, 
+72, 192, 0, 128, 198, 0, 192, 0, 204, 192, 192, 1, 221, 128, 0, 1, 
+205, 0, 193, 1, 72, 192, 128, 128, 72, 0, 193, 130, 197, 0, 128, 0, 
+204, 128, 193, 1, 221, 64, 0, 1, 159, 0, 0, 1, 31, 0, 128, 0, 
+7, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 
+117, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 117, 114, 115, 
+111, 114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 108, 101, 110, 0, 3, 0, 
+0, 0, 0, 0, 0, 240, 63, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+111, 102, 102, 115, 101, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+100, 114, 97, 119, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 6, 1, 
+7, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 11, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/html.lua */
+static const char file_13[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 2, 2, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 139, 0, 12, 0, 138, 128, 193, 130, 138, 0, 194, 131, 138, 128, 194, 
+132, 138, 0, 195, 133, 138, 128, 195, 134, 138, 0, 196, 135, 138, 128, 196, 
+136, 138, 0, 197, 137, 138, 128, 197, 138, 138, 0, 198, 139, 138, 128, 198, 
+140, 138, 0, 199, 141, 138, 128, 199, 142, 138, 0, 200, 143, 138, 128, 200, 
+144, 138, 0, 201, 145, 138, 128, 201, 146, 138, 0, 202, 147, 138, 128, 202, 
+148, 138, 0, 203, 149, 138, 128, 203, 150, 138, 0, 204, 151, 138, 128, 204, 
+152, 138, 0, 205, 153, 138, 128, 205, 154, 138, 0, 206, 155, 138, 128, 206, 
+156, 138, 0, 207, 157, 138, 128, 207, 158, 138, 0, 208, 159, 138, 128, 208, 
+160, 138, 0, 209, 161, 138, 128, 209, 162, 138, 0, 210, 163, 138, 128, 210, 
+164, 138, 0, 211, 165, 138, 128, 211, 166, 138, 0, 212, 167, 138, 128, 212, 
+168, 138, 0, 213, 169, 138, 128, 213, 170, 138, 0, 214, 171, 138, 128, 214, 
+172, 138, 0, 215, 173, 138, 128, 215, 174, 138, 0, 216, 175, 138, 128, 216, 
+176, 138, 0, 217, 177, 138, 128, 217, 178, 138, 0, 218, 179, 138, 128, 218, 
+180, 138, 0, 219, 181, 138, 128, 219, 182, 138, 0, 220, 183, 138, 128, 220, 
+184, 138, 0, 221, 185, 138, 128, 221, 186, 138, 0, 222, 187, 138, 128, 222, 
+188, 138, 0, 223, 189, 138, 128, 223, 190, 138, 0, 224, 191, 138, 128, 224, 
+192, 138, 0, 225, 193, 138, 128, 225, 194, 138, 0, 226, 195, 138, 128, 226, 
+196, 138, 0, 227, 197, 138, 128, 227, 198, 138, 0, 228, 199, 138, 128, 228, 
+200, 138, 0, 229, 201, 138, 128, 229, 202, 138, 0, 230, 203, 138, 128, 230, 
+204, 138, 0, 231, 205, 138, 128, 231, 206, 138, 0, 232, 207, 138, 128, 232, 
+208, 138, 0, 233, 209, 138, 128, 233, 210, 138, 0, 234, 211, 138, 128, 234, 
+212, 138, 0, 235, 213, 138, 128, 235, 214, 138, 0, 236, 215, 138, 128, 236, 
+216, 138, 0, 237, 217, 138, 128, 237, 218, 138, 0, 238, 219, 138, 128, 238, 
+220, 138, 0, 239, 221, 138, 128, 239, 222, 138, 0, 240, 223, 138, 128, 240, 
+224, 138, 0, 241, 225, 138, 128, 241, 226, 138, 0, 242, 227, 138, 128, 242, 
+228, 138, 0, 243, 229, 138, 128, 243, 230, 138, 0, 244, 231, 138, 128, 244, 
+232, 138, 0, 245, 233, 138, 128, 245, 234, 138, 0, 246, 235, 138, 0, 240, 
+236, 138, 192, 118, 237, 138, 64, 119, 238, 138, 192, 119, 239, 138, 64, 120, 
+240, 138, 192, 120, 241, 138, 64, 121, 242, 138, 192, 121, 243, 138, 64, 122, 
+244, 138, 192, 122, 245, 138, 64, 123, 246, 138, 192, 123, 247, 138, 64, 124, 
+248, 138, 192, 124, 249, 138, 64, 125, 250, 138, 192, 125, 251, 138, 64, 126, 
+252, 138, 192, 126, 253, 138, 64, 127, 254, 138, 192, 127, 255, 193, 0, 64, 
+0, 1, 65, 64, 0, 138, 0, 129, 1, 193, 128, 64, 0, 1, 193, 64, 
+0, 138, 0, 129, 1, 193, 0, 65, 0, 1, 65, 65, 0, 138, 0, 129, 
+1, 193, 128, 65, 0, 1, 193, 65, 0, 138, 0, 129, 1, 193, 0, 66, 
+0, 1, 65, 66, 0, 138, 0, 129, 1, 193, 128, 66, 0, 1, 193, 66, 
+0, 138, 0, 129, 1, 193, 0, 67, 0, 1, 65, 67, 0, 138, 0, 129, 
+1, 193, 128, 67, 0, 1, 193, 67, 0, 138, 0, 129, 1, 193, 0, 68, 
+0, 1, 65, 68, 0, 138, 0, 129, 1, 193, 128, 68, 0, 1, 193, 68, 
+0, 138, 0, 129, 1, 193, 0, 69, 0, 1, 65, 69, 0, 138, 0, 129, 
+1, 193, 128, 69, 0, 1, 193, 69, 0, 138, 0, 129, 1, 193, 0, 70, 
+0, 1, 65, 70, 0, 138, 0, 129, 1, 193, 128, 70, 0, 1, 193, 70, 
+0, 138, 0, 129, 1, 193, 0, 71, 0, 1, 65, 71, 0, 138, 0, 129, 
+1, 193, 128, 71, 0, 1, 193, 71, 0, 138, 0, 129, 1, 193, 0, 72, 
+0, 1, 65, 72, 0, 138, 0, 129, 1, 193, 128, 72, 0, 1, 193, 72, 
+0, 138, 0, 129, 1, 193, 0, 73, 0, 1, 65, 73, 0, 138, 0, 129, 
+1, 193, 128, 73, 0, 1, 193, 73, 0, 138, 0, 129, 1, 193, 0, 74, 
+0, 1, 65, 74, 0, 138, 0, 129, 1, 193, 128, 74, 0, 1, 193, 74, 
+0, 138, 0, 129, 1, 193, 0, 75, 0, 1, 65, 75, 0, 138, 0, 129, 
+1, 193, 128, 75, 0, 1, 193, 75, 0, 138, 0, 129, 1, 193, 0, 76, 
+0, 1, 65, 76, 0, 138, 0, 129, 1, 193, 128, 76, 0, 1, 193, 76, 
+0, 138, 0, 129, 1, 193, 0, 77, 0, 1, 65, 77, 0, 138, 0, 129, 
+1, 193, 128, 77, 0, 1, 193, 77, 0, 138, 0, 129, 1, 193, 0, 78, 
+0, 1, 65, 78, 0, 138, 0, 129, 1, 193, 128, 78, 0, 1, 193, 78, 
+0, 138, 0, 129, 1, 193, 0, 79, 0, 1, 65, 79, 0, 138, 0, 129, 
+1, 193, 128, 79, 0, 1, 193, 79, 0, 138, 0, 129, 1, 193, 0, 80, 
+0, 1, 65, 80, 0, 138, 0, 129, 1, 193, 128, 80, 0, 1, 193, 80, 
+0, 138, 0, 129, 1, 193, 0, 81, 0, 1, 65, 81, 0, 138, 0, 129, 
+1, 193, 128, 81, 0, 1, 193, 81, 0, 138, 0, 129, 1, 193, 0, 82, 
+0, 1, 65, 82, 0, 138, 0, 129, 1, 193, 128, 82, 0, 1, 193, 82, 
+0, 138, 0, 129, 1, 193, 0, 83, 0, 1, 65, 83, 0, 138, 0, 129, 
+1, 193, 128, 83, 0, 1, 193, 83, 0, 138, 0, 129, 1, 193, 0, 84, 
+0, 1, 65, 84, 0, 138, 0, 129, 1, 193, 128, 84, 0, 1, 193, 84, 
+0, 138, 0, 129, 1, 193, 0, 85, 0, 1, 65, 85, 0, 138, 0, 129, 
+1, 193, 128, 85, 0, 1, 193, 85, 0, 138, 0, 129, 1, 193, 0, 86, 
+0, 1, 65, 86, 0, 138, 0, 129, 1, 193, 128, 86, 0, 1, 193, 86, 
+0, 138, 0, 129, 1, 193, 0, 87, 0, 1, 65, 87, 0, 138, 0, 129, 
+1, 193, 128, 87, 0, 1, 193, 87, 0, 138, 0, 129, 1, 193, 0, 88, 
+0, 1, 65, 88, 0, 138, 0, 129, 1, 193, 128, 88, 0, 1, 193, 88, 
+0, 138, 0, 129, 1, 193, 0, 89, 0, 1, 65, 89, 0, 138, 0, 129, 
+1, 193, 128, 89, 0, 1, 193, 89, 0, 138, 0, 129, 1, 193, 0, 90, 
+0, 1, 65, 90, 0, 138, 0, 129, 1, 193, 128, 90, 0, 1, 193, 90, 
+0, 138, 0, 129, 1, 193, 0, 91, 0, 1, 65, 91, 0, 138, 0, 129, 
+1, 193, 128, 91, 0, 1, 193, 91, 0, 138, 0, 129, 1, 193, 0, 92, 
+0, 1, 65, 92, 0, 138, 0, 129, 1, 193, 128, 92, 0, 1, 193, 92, 
+0, 138, 0, 129, 1, 193, 0, 93, 0, 1, 65, 93, 0, 138, 0, 129, 
+1, 193, 128, 93, 0, 1, 193, 93, 0, 138, 0, 129, 1, 193, 0, 94, 
+0, 1, 65, 94, 0, 138, 0, 129, 1, 193, 128, 94, 0, 1, 193, 94, 
+0, 138, 0, 129, 1, 193, 0, 95, 0, 1, 65, 95, 0, 138, 0, 129, 
+1, 193, 128, 95, 0, 1, 193, 95, 0, 138, 0, 129, 1, 193, 0, 96, 
+0, 1, 65, 96, 0, 138, 0, 129, 1, 193, 128, 96, 0, 1, 193, 96, 
+0, 138, 0, 129, 1, 193, 0, 97, 0, 1, 65, 97, 0, 138, 0, 129, 
+1, 193, 128, 97, 0, 1, 193, 97, 0, 138, 0, 129, 1, 193, 0, 98, 
+0, 1, 65, 98, 0, 138, 0, 129, 1, 193, 128, 98, 0, 1, 193, 98, 
+0, 138, 0, 129, 1, 193, 0, 99, 0, 1, 65, 99, 0, 138, 0, 129, 
+1, 193, 128, 99, 0, 1, 193, 99, 0, 138, 0, 129, 1, 193, 0, 100, 
+0, 1, 65, 100, 0, 138, 0, 129, 1, 193, 128, 100, 0, 1, 193, 100, 
+0, 138, 0, 129, 1, 193, 0, 101, 0, 1, 65, 101, 0, 138, 0, 129, 
+1, 193, 128, 101, 0, 1, 193, 101, 0, 138, 0, 129, 1, 193, 0, 102, 
+0, 1, 65, 102, 0, 138, 0, 129, 1, 193, 128, 102, 0, 1, 193, 102, 
+0, 138, 0, 129, 1, 193, 0, 103, 0, 1, 65, 103, 0, 138, 0, 129, 
+1, 193, 128, 103, 0, 1, 193, 103, 0, 138, 0, 129, 1, 193, 0, 104, 
+0, 1, 65, 104, 0, 138, 0, 129, 1, 193, 128, 104, 0, 1, 193, 104, 
+0, 138, 0, 129, 1, 193, 0, 105, 0, 1, 65, 105, 0, 138, 0, 129, 
+1, 193, 128, 105, 0, 1, 193, 105, 0, 138, 0, 129, 1, 193, 0, 106, 
+0, 1, 65, 106, 0, 138, 0, 129, 1, 193, 128, 106, 0, 1, 193, 106, 
+0, 138, 0, 129, 1, 193, 0, 107, 0, 1, 65, 107, 0, 138, 0, 129, 
+1, 193, 128, 107, 0, 1, 193, 107, 0, 138, 0, 129, 1, 193, 0, 108, 
+0, 1, 65, 108, 0, 138, 0, 129, 1, 193, 128, 108, 0, 1, 193, 108, 
+0, 138, 0, 129, 1, 193, 0, 109, 0, 1, 65, 109, 0, 138, 0, 129, 
+1, 193, 128, 109, 0, 1, 193, 109, 0, 138, 0, 129, 1, 193, 0, 110, 
+0, 1, 65, 110, 0, 138, 0, 129, 1, 193, 128, 110, 0, 1, 193, 110, 
+0, 138, 0, 129, 1, 193, 0, 111, 0, 1, 65, 111, 0, 138, 0, 129, 
+1, 193, 128, 111, 0, 1, 193, 111, 0, 138, 0, 129, 1, 193, 0, 112, 
+0, 1, 65, 112, 0, 138, 0, 129, 1, 193, 128, 112, 0, 1, 193, 112, 
+0, 138, 0, 129, 1, 193, 0, 113, 0, 1, 65, 113, 0, 138, 0, 129, 
+1, 193, 128, 113, 0, 1, 193, 113, 0, 138, 0, 129, 1, 193, 0, 114, 
+0, 1, 65, 114, 0, 138, 0, 129, 1, 193, 128, 114, 0, 1, 193, 114, 
+0, 138, 0, 129, 1, 193, 0, 115, 0, 1, 65, 115, 0, 138, 0, 129, 
+1, 193, 128, 115, 0, 1, 193, 115, 0, 138, 0, 129, 1, 193, 0, 116, 
+0, 1, 65, 116, 0, 138, 0, 129, 1, 193, 128, 116, 0, 1, 193, 116, 
+0, 138, 0, 129, 1, 193, 0, 117, 0, 1, 65, 117, 0, 138, 0, 129, 
+1, 193, 128, 117, 0, 1, 193, 117, 0, 138, 0, 129, 1, 193, 0, 118, 
+0, 1, 65, 118, 0, 138, 0, 129, 1, 193, 128, 118, 0, 1, 193, 118, 
+0, 138, 0, 129, 1, 193, 0, 119, 0, 1, 65, 119, 0, 138, 0, 129, 
+1, 193, 128, 119, 0, 1, 193, 119, 0, 138, 0, 129, 1, 193, 0, 120, 
+0, 1, 65, 120, 0, 138, 0, 129, 1, 193, 128, 120, 0, 1, 193, 120, 
+0, 138, 0, 129, 1, 193, 0, 121, 0, 1, 65, 121, 0, 138, 0, 129, 
+1, 193, 128, 121, 0, 1, 193, 121, 0, 138, 0, 129, 1, 193, 0, 122, 
+0, 1, 65, 122, 0, 138, 0, 129, 1, 193, 128, 122, 0, 1, 193, 122, 
+0, 138, 0, 129, 1, 193, 0, 123, 0, 1, 65, 123, 0, 138, 0, 129, 
+1, 193, 128, 123, 0, 1, 193, 123, 0, 138, 0, 129, 1, 193, 0, 124, 
+0, 1, 65, 124, 0, 138, 0, 129, 1, 193, 128, 124, 0, 1, 193, 124, 
+0, 138, 0, 129, 1, 193, 0, 125, 0, 1, 65, 125, 0, 138, 0, 129, 
+1, 193, 128, 125, 0, 1, 193, 125, 0, 138, 0, 129, 1, 193, 0, 126, 
+0, 1, 65, 126, 0, 138, 0, 129, 1, 193, 128, 126, 0, 1, 193, 126, 
+0, 138, 0, 129, 1, 8, 128, 0, 130, 129, 0, 127, 0, 229, 0, 0, 
+0, 8, 192, 0, 1, 31, 0, 128, 0, 253, 1, 0, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 119, 114, 105, 116, 101, 117, 56, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 102, 105, 110, 100, 0, 4, 13, 0, 0, 0, 0, 0, 0, 
+0, 72, 84, 77, 76, 69, 110, 116, 105, 116, 105, 101, 115, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 38, 97, 109, 112, 59, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 38, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 38, 103, 116, 59, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 62, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 108, 116, 59, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 60, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 38, 113, 117, 111, 116, 59, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 34, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 97, 
+99, 117, 116, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 
+180, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 99, 101, 100, 105, 
+108, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 184, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 38, 99, 105, 114, 99, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 203, 134, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 38, 109, 97, 99, 114, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 194, 175, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+38, 109, 105, 100, 100, 111, 116, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 194, 183, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 116, 
+105, 108, 100, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 203, 
+156, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 117, 109, 108, 59, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 168, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 38, 65, 97, 99, 117, 116, 101, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 195, 129, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 38, 97, 97, 99, 117, 116, 101, 59, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 195, 161, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 38, 65, 99, 105, 114, 99, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 195, 130, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 
+97, 99, 105, 114, 99, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+195, 162, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 65, 69, 108, 
+105, 103, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 134, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 97, 101, 108, 105, 103, 59, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 166, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 38, 65, 103, 114, 97, 118, 101, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 195, 128, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 38, 97, 103, 114, 97, 118, 101, 59, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 195, 160, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 38, 65, 114, 105, 110, 103, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 195, 133, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 
+97, 114, 105, 110, 103, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+195, 165, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 65, 116, 105, 
+108, 100, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 131, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 97, 116, 105, 108, 100, 
+101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 163, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 38, 65, 117, 109, 108, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 195, 132, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 38, 97, 117, 109, 108, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 195, 164, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+38, 67, 99, 101, 100, 105, 108, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 195, 135, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 99, 
+99, 101, 100, 105, 108, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+195, 167, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 69, 97, 99, 
+117, 116, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 137, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 101, 97, 99, 117, 116, 
+101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 169, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 38, 69, 99, 105, 114, 99, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 138, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 38, 101, 99, 105, 114, 99, 59, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 195, 170, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 38, 69, 103, 114, 97, 118, 101, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 195, 136, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+38, 101, 103, 114, 97, 118, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 195, 168, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 69, 
+84, 72, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 144, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 101, 116, 104, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 195, 176, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 38, 69, 117, 109, 108, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 195, 139, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+38, 101, 117, 109, 108, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+195, 171, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 73, 97, 99, 
+117, 116, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 141, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 105, 97, 99, 117, 116, 
+101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 173, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 38, 73, 99, 105, 114, 99, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 142, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 38, 105, 99, 105, 114, 99, 59, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 195, 174, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 38, 73, 103, 114, 97, 118, 101, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 195, 140, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+38, 105, 103, 114, 97, 118, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 195, 172, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 73, 
+117, 109, 108, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 143, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 105, 117, 109, 108, 59, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 175, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 38, 78, 116, 105, 108, 100, 101, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 195, 145, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 38, 110, 116, 105, 108, 100, 101, 59, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 195, 177, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 38, 79, 97, 99, 117, 116, 101, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 195, 147, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+38, 111, 97, 99, 117, 116, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 195, 179, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 79, 
+99, 105, 114, 99, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 
+148, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 111, 99, 105, 114, 
+99, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 180, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 38, 79, 69, 108, 105, 103, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 197, 146, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 38, 111, 101, 108, 105, 103, 59, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 197, 147, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 38, 79, 103, 114, 97, 118, 101, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 195, 146, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+38, 111, 103, 114, 97, 118, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 195, 178, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 79, 
+115, 108, 97, 115, 104, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+195, 152, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 111, 115, 108, 
+97, 115, 104, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 184, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 79, 116, 105, 108, 100, 
+101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 149, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 38, 111, 116, 105, 108, 100, 101, 59, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 181, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 38, 79, 117, 109, 108, 59, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 195, 150, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 38, 111, 117, 109, 108, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 195, 182, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 83, 
+99, 97, 114, 111, 110, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+197, 160, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 115, 99, 97, 
+114, 111, 110, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 197, 161, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 115, 122, 108, 105, 103, 
+59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 159, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 38, 84, 72, 79, 82, 78, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 195, 158, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 38, 116, 104, 111, 114, 110, 59, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 195, 190, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 38, 85, 97, 99, 117, 116, 101, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 195, 154, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 
+117, 97, 99, 117, 116, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 195, 186, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 85, 99, 
+105, 114, 99, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 155, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 117, 99, 105, 114, 99, 
+59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 187, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 38, 85, 103, 114, 97, 118, 101, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 153, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 38, 117, 103, 114, 97, 118, 101, 59, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 195, 185, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 38, 85, 117, 109, 108, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 195, 156, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 
+117, 117, 109, 108, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 
+188, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 89, 97, 99, 117, 
+116, 101, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 157, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 121, 97, 99, 117, 116, 101, 
+59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 195, 189, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 38, 121, 117, 109, 108, 59, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 195, 191, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 38, 89, 117, 109, 108, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 197, 184, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 
+99, 101, 110, 116, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 
+162, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 99, 117, 114, 114, 
+101, 110, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 164, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 101, 117, 114, 111, 59, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 130, 172, 0, 4, 8, 0, 
+0, 0, 0, 0, 0, 0, 38, 112, 111, 117, 110, 100, 59, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 194, 163, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 38, 121, 101, 110, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 194, 165, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 98, 
+114, 118, 98, 97, 114, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+194, 166, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 98, 117, 108, 
+108, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 162, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 99, 111, 112, 121, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 169, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 38, 100, 97, 103, 103, 101, 114, 59, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 226, 128, 160, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 38, 68, 97, 103, 103, 101, 114, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 128, 161, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 38, 102, 114, 97, 115, 108, 59, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 226, 129, 132, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 38, 104, 101, 108, 108, 105, 112, 59, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 226, 128, 166, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+38, 105, 101, 120, 99, 108, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 194, 161, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 105, 109, 
+97, 103, 101, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 132, 
+145, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 105, 113, 117, 101, 
+115, 116, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 191, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 108, 114, 109, 59, 0, 4, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 38, 109, 100, 97, 115, 104, 59, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 226, 128, 148, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+38, 110, 100, 97, 115, 104, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 128, 147, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 110, 
+111, 116, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 172, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 111, 108, 105, 110, 101, 59, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 190, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 38, 111, 114, 100, 102, 59, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 194, 170, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 38, 111, 114, 100, 109, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 194, 186, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 
+112, 97, 114, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 
+182, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 112, 101, 114, 109, 
+105, 108, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 176, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 112, 114, 105, 109, 101, 
+59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 178, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 38, 80, 114, 105, 109, 101, 59, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 179, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 38, 114, 101, 97, 108, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 132, 156, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 38, 114, 101, 103, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 194, 174, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 114, 
+108, 109, 59, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 115, 101, 
+99, 116, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 167, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 115, 104, 121, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 194, 173, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 38, 115, 117, 112, 49, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 194, 185, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+38, 116, 114, 97, 100, 101, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 132, 162, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 119, 
+101, 105, 101, 114, 112, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+226, 132, 152, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 98, 100, 
+113, 117, 111, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 
+158, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 108, 97, 113, 117, 
+111, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 171, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 38, 108, 100, 113, 117, 111, 59, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 156, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 38, 108, 115, 97, 113, 117, 111, 59, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 185, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 38, 108, 115, 113, 117, 111, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 128, 152, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 38, 114, 97, 113, 117, 111, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 194, 187, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+38, 114, 100, 113, 117, 111, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 128, 157, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 114, 
+115, 97, 113, 117, 111, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+226, 128, 186, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 114, 115, 
+113, 117, 111, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 
+153, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 115, 98, 113, 117, 
+111, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 154, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 101, 109, 115, 112, 59, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 131, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 38, 101, 110, 115, 112, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 128, 130, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 38, 110, 98, 115, 112, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 194, 160, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 
+116, 104, 105, 110, 115, 112, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 128, 137, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 122, 
+119, 106, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 141, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 122, 119, 110, 106, 59, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 140, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 38, 100, 101, 103, 59, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 194, 176, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 38, 100, 105, 118, 105, 100, 101, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 195, 183, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+38, 102, 114, 97, 99, 49, 50, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 194, 189, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 102, 
+114, 97, 99, 49, 52, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+194, 188, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 102, 114, 97, 
+99, 51, 52, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 190, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 103, 101, 59, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 226, 137, 165, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 38, 108, 101, 59, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 226, 137, 164, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+38, 109, 105, 110, 117, 115, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 136, 146, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 115, 
+117, 112, 50, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 178, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 115, 117, 112, 51, 59, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 194, 179, 0, 4, 8, 0, 
+0, 0, 0, 0, 0, 0, 38, 116, 105, 109, 101, 115, 59, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 195, 151, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 38, 97, 108, 101, 102, 115, 121, 109, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 132, 181, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 38, 97, 110, 100, 59, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 226, 136, 167, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 
+97, 110, 103, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 136, 
+160, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 97, 115, 121, 109, 
+112, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 137, 136, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 99, 97, 112, 59, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 226, 136, 169, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 38, 99, 111, 110, 103, 59, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 226, 137, 133, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 38, 99, 117, 112, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 136, 170, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 101, 
+109, 112, 116, 121, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 
+136, 133, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 101, 113, 117, 
+105, 118, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 137, 161, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 101, 120, 105, 115, 116, 
+59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 136, 131, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 38, 102, 110, 111, 102, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 198, 146, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 38, 102, 111, 114, 97, 108, 108, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 136, 128, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 38, 105, 110, 102, 105, 110, 59, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 226, 136, 158, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 38, 105, 110, 116, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+226, 136, 171, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 105, 115, 
+105, 110, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 136, 136, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 108, 97, 110, 103, 59, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 140, 169, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 38, 108, 99, 101, 105, 108, 59, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 226, 140, 136, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 38, 108, 102, 108, 111, 111, 114, 59, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 226, 140, 138, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 38, 108, 111, 119, 97, 115, 116, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 136, 151, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 38, 109, 105, 99, 114, 111, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 194, 181, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+38, 110, 97, 98, 108, 97, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 136, 135, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 110, 
+101, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 137, 160, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 110, 105, 59, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 226, 136, 139, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 38, 110, 111, 116, 105, 110, 59, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 226, 136, 137, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 38, 110, 115, 117, 98, 59, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 226, 138, 132, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 
+111, 112, 108, 117, 115, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+226, 138, 149, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 111, 114, 
+59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 136, 168, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 38, 111, 116, 105, 109, 101, 115, 59, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 138, 151, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 38, 112, 97, 114, 116, 59, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 226, 136, 130, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 38, 112, 101, 114, 112, 59, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 226, 138, 165, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 38, 112, 108, 117, 115, 109, 110, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 194, 177, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 
+112, 114, 111, 100, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 
+136, 143, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 112, 114, 111, 
+112, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 136, 157, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 114, 97, 100, 105, 99, 59, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 136, 154, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 38, 114, 97, 110, 103, 59, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 226, 140, 170, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 38, 114, 99, 101, 105, 108, 59, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 226, 140, 137, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 38, 114, 102, 108, 111, 111, 114, 59, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 226, 140, 139, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 38, 115, 100, 111, 116, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 139, 133, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 115, 
+105, 109, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 136, 188, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 115, 117, 98, 59, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 138, 130, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 38, 115, 117, 98, 101, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 138, 134, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 38, 115, 117, 109, 59, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 226, 136, 145, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 
+115, 117, 112, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 138, 
+131, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 115, 117, 112, 101, 
+59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 138, 135, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 38, 116, 104, 101, 114, 101, 52, 59, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 136, 180, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 38, 65, 108, 112, 104, 97, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 206, 145, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 38, 97, 108, 112, 104, 97, 59, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 206, 177, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 38, 66, 101, 116, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 206, 146, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 98, 101, 
+116, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 178, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 67, 104, 105, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 206, 167, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 38, 99, 104, 105, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 207, 135, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 
+68, 101, 108, 116, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+206, 148, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 100, 101, 108, 
+116, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 180, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 38, 69, 112, 115, 105, 108, 111, 
+110, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 149, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 38, 101, 112, 115, 105, 108, 111, 110, 
+59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 181, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 38, 69, 116, 97, 59, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 206, 151, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 38, 101, 116, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 206, 183, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 71, 97, 
+109, 109, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 147, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 103, 97, 109, 109, 97, 
+59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 179, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 38, 73, 111, 116, 97, 59, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 206, 153, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 38, 105, 111, 116, 97, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 206, 185, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 
+75, 97, 112, 112, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+206, 154, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 107, 97, 112, 
+112, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 186, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 38, 76, 97, 109, 98, 100, 97, 
+59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 155, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 38, 108, 97, 109, 98, 100, 97, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 187, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 38, 77, 117, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 206, 156, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 
+109, 117, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 188, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 78, 117, 59, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 206, 157, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 38, 110, 117, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 206, 189, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 79, 109, 
+101, 103, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 169, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 111, 109, 101, 103, 97, 
+59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 207, 137, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 38, 79, 109, 105, 99, 114, 111, 110, 59, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 159, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 38, 111, 109, 105, 99, 114, 111, 110, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 191, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 38, 80, 104, 105, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 206, 166, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+38, 112, 104, 105, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 207, 
+134, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 80, 105, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 160, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 38, 112, 105, 59, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 207, 128, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 
+112, 105, 118, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 207, 150, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 80, 115, 105, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 168, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 38, 112, 115, 105, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 207, 136, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+38, 82, 104, 111, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 
+161, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 114, 104, 111, 59, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 207, 129, 0, 4, 8, 0, 
+0, 0, 0, 0, 0, 0, 38, 83, 105, 103, 109, 97, 59, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 206, 163, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 38, 115, 105, 103, 109, 97, 59, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 207, 131, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+38, 115, 105, 103, 109, 97, 102, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 207, 130, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 84, 
+97, 117, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 164, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 116, 97, 117, 59, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 207, 132, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 38, 84, 104, 101, 116, 97, 59, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 206, 152, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 38, 116, 104, 101, 116, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 206, 184, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 38, 116, 
+104, 101, 116, 97, 115, 121, 109, 59, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 207, 145, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 38, 117, 
+112, 115, 105, 104, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 207, 
+146, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 38, 85, 112, 115, 105, 
+108, 111, 110, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 165, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 38, 117, 112, 115, 105, 108, 
+111, 110, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 207, 133, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 88, 105, 59, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 206, 158, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 38, 120, 105, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 206, 190, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 90, 101, 
+116, 97, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 150, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 122, 101, 116, 97, 59, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 206, 182, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 38, 99, 114, 97, 114, 114, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 134, 181, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 38, 100, 97, 114, 114, 59, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 226, 134, 147, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+38, 100, 65, 114, 114, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+226, 135, 147, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 104, 97, 
+114, 114, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 134, 148, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 104, 65, 114, 114, 59, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 135, 148, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 38, 108, 97, 114, 114, 59, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 226, 134, 144, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 38, 108, 65, 114, 114, 59, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 226, 135, 144, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 38, 114, 97, 114, 114, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 226, 134, 146, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 114, 
+65, 114, 114, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 135, 
+146, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 38, 117, 97, 114, 114, 
+59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 134, 145, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 38, 117, 65, 114, 114, 59, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 226, 135, 145, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 38, 99, 108, 117, 98, 115, 59, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 226, 153, 163, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 38, 100, 105, 97, 109, 115, 59, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 226, 153, 166, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 38, 104, 101, 97, 114, 116, 115, 59, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 226, 153, 165, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+38, 115, 112, 97, 100, 101, 115, 59, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 226, 153, 160, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 
+108, 111, 122, 59, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 151, 
+138, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 68, 101, 99, 111, 100, 
+101, 72, 84, 77, 76, 69, 110, 116, 105, 116, 121, 0, 1, 0, 0, 0, 
+9, 1, 0, 0, 26, 1, 0, 0, 1, 0, 8, 28, 0, 0, 0, 70, 
+0, 64, 0, 71, 0, 128, 0, 91, 0, 0, 0, 23, 0, 0, 128, 95, 
+0, 0, 1, 133, 0, 128, 0, 192, 0, 0, 0, 1, 65, 0, 0, 157, 
+0, 129, 1, 27, 65, 0, 0, 23, 64, 0, 128, 68, 1, 0, 0, 95, 
+1, 0, 1, 70, 129, 64, 0, 129, 193, 0, 0, 192, 1, 0, 2, 150, 
+193, 1, 3, 93, 129, 0, 1, 0, 1, 128, 2, 27, 65, 0, 0, 23, 
+64, 0, 128, 68, 1, 0, 0, 95, 1, 0, 1, 69, 1, 0, 1, 128, 
+1, 0, 2, 94, 1, 0, 1, 95, 1, 0, 0, 31, 0, 128, 0, 4, 
+0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 72, 84, 77, 76, 
+69, 110, 116, 105, 116, 105, 101, 115, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 94, 38, 35, 40, 37, 119, 42, 41, 59, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 116, 111, 110, 117, 109, 98, 101, 114, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 3, 0, 0, 
+0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/margin.lua */
+static const char file_14[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 8, 38, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 139, 128, 0, 0, 229, 0, 0, 0, 138, 192, 0, 130, 229, 64, 0, 
+0, 138, 192, 128, 130, 203, 128, 0, 0, 37, 129, 0, 0, 202, 0, 1, 
+130, 37, 193, 0, 0, 202, 0, 129, 130, 11, 193, 0, 0, 101, 1, 1, 
+0, 10, 65, 1, 130, 101, 65, 1, 0, 10, 65, 1, 131, 101, 129, 1, 
+0, 10, 65, 129, 130, 75, 129, 0, 0, 165, 193, 1, 0, 74, 129, 1, 
+130, 165, 1, 2, 0, 74, 129, 129, 130, 139, 1, 1, 0, 138, 129, 0, 
+132, 138, 193, 128, 132, 138, 1, 1, 133, 138, 65, 129, 133, 8, 128, 129, 
+131, 165, 65, 2, 0, 8, 128, 1, 134, 134, 65, 67, 0, 229, 129, 2, 
+0, 138, 193, 1, 135, 31, 0, 128, 0, 15, 0, 0, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 109, 97, 116, 104, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 102, 108, 111, 111, 114, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 119, 103, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 103, 
+101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 104, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 97, 116, 116, 97, 99, 104, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 99, 111, 110, 116, 101, 110, 
+116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 100, 101, 116, 97, 99, 
+104, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 77, 97, 114, 103, 105, 
+110, 67, 111, 110, 116, 114, 111, 108, 108, 101, 114, 115, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 3, 0, 0, 0, 0, 0, 0, 0, 64, 3, 
+0, 0, 0, 0, 0, 0, 8, 64, 3, 0, 0, 0, 0, 0, 0, 16, 
+64, 4, 14, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 77, 97, 114, 
+103, 105, 110, 77, 111, 100, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 67, 109, 100, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 83, 101, 
+116, 86, 105, 101, 119, 77, 111, 100, 101, 0, 11, 0, 0, 0, 14, 0, 
+0, 0, 17, 0, 0, 0, 1, 0, 3, 6, 0, 0, 0, 70, 0, 64, 
+0, 74, 128, 192, 128, 70, 192, 64, 0, 129, 0, 1, 0, 93, 64, 0, 
+1, 31, 0, 128, 0, 5, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 109, 97, 114, 103, 105, 110, 0, 3, 0, 0, 0, 0, 
+0, 0, 0, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 
+109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 72, 105, 100, 105, 110, 103, 32, 109, 97, 114, 
+103, 105, 110, 46, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 19, 0, 0, 0, 21, 0, 0, 0, 3, 0, 4, 3, 0, 
+0, 0, 196, 0, 0, 0, 223, 0, 0, 1, 31, 0, 128, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 
+0, 0, 38, 0, 0, 0, 1, 0, 9, 21, 0, 0, 0, 65, 0, 0, 
+0, 134, 64, 64, 0, 198, 128, 64, 0, 199, 192, 192, 1, 157, 0, 1, 
+1, 23, 64, 1, 128, 197, 1, 128, 0, 7, 2, 65, 3, 221, 129, 0, 
+1, 25, 192, 129, 0, 23, 0, 0, 128, 64, 0, 128, 3, 162, 128, 0, 
+0, 35, 193, 253, 127, 134, 64, 65, 0, 205, 192, 193, 0, 138, 192, 0, 
+131, 134, 0, 66, 0, 193, 64, 2, 0, 157, 64, 0, 1, 31, 0, 128, 
+0, 10, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 112, 97, 105, 114, 115, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 
+116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 
+115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 109, 97, 114, 103, 105, 
+110, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 16, 0, 0, 0, 
+0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 
+97, 103, 101, 0, 4, 38, 0, 0, 0, 0, 0, 0, 0, 77, 97, 114, 
+103, 105, 110, 32, 110, 111, 119, 32, 100, 105, 115, 112, 108, 97, 121, 115, 
+32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 32, 115, 116, 121, 108, 101, 
+115, 46, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 40, 0, 0, 0, 42, 0, 0, 0, 3, 0, 4, 4, 0, 
+0, 0, 199, 0, 64, 1, 199, 64, 192, 1, 223, 0, 0, 1, 31, 0, 
+128, 0, 2, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 
+116, 121, 108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+109, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 
+0, 0, 0, 55, 0, 0, 0, 1, 0, 5, 13, 0, 0, 0, 101, 0, 
+0, 0, 134, 64, 64, 0, 198, 128, 64, 0, 199, 192, 192, 1, 0, 1, 
+128, 0, 157, 128, 128, 1, 10, 128, 0, 128, 128, 0, 128, 0, 157, 64, 
+128, 0, 134, 0, 65, 0, 193, 64, 1, 0, 157, 64, 0, 1, 31, 0, 
+128, 0, 6, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 
+111, 107, 101, 110, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 65, 100, 
+100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 67, 104, 97, 110, 103, 101, 100, 0, 4, 
+16, 0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 
+77, 101, 115, 115, 97, 103, 101, 0, 4, 39, 0, 0, 0, 0, 0, 0, 
+0, 77, 97, 114, 103, 105, 110, 32, 110, 111, 119, 32, 100, 105, 115, 112, 
+108, 97, 121, 115, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 32, 110, 
+117, 109, 98, 101, 114, 115, 46, 0, 1, 0, 0, 0, 48, 0, 0, 0, 
+50, 0, 0, 0, 0, 0, 4, 11, 0, 0, 0, 6, 0, 64, 0, 69, 
+0, 128, 0, 134, 128, 64, 0, 135, 192, 64, 1, 198, 0, 64, 0, 213, 
+0, 128, 1, 157, 0, 0, 1, 93, 128, 0, 0, 77, 0, 193, 0, 10, 
+64, 128, 128, 31, 0, 128, 0, 5, 0, 0, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 109, 97, 114, 103, 105, 110, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 109, 97, 116, 104, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 108, 111, 103, 49, 48, 0, 3, 0, 0, 0, 0, 0, 
+0, 8, 64, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 
+0, 0, 0, 60, 0, 0, 0, 1, 0, 3, 5, 0, 0, 0, 70, 0, 
+64, 0, 135, 64, 64, 0, 93, 64, 0, 1, 10, 128, 192, 128, 31, 0, 
+128, 0, 3, 0, 0, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 82, 
+101, 109, 111, 118, 101, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 
+101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 107, 101, 
+110, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 62, 0, 0, 0, 64, 0, 0, 0, 3, 0, 5, 5, 0, 0, 0, 
+198, 0, 64, 0, 0, 1, 128, 0, 222, 0, 0, 1, 223, 0, 0, 0, 
+31, 0, 128, 0, 1, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 116, 111, 115, 116, 114, 105, 110, 103, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 72, 0, 0, 0, 
+1, 0, 3, 6, 0, 0, 0, 70, 0, 64, 0, 74, 128, 192, 128, 70, 
+192, 64, 0, 129, 0, 1, 0, 93, 64, 0, 1, 31, 0, 128, 0, 5, 
+0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 109, 97, 
+114, 103, 105, 110, 0, 3, 0, 0, 0, 0, 0, 0, 20, 64, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 
+101, 115, 115, 97, 103, 101, 0, 4, 33, 0, 0, 0, 0, 0, 0, 0, 
+77, 97, 114, 103, 105, 110, 32, 110, 111, 119, 32, 100, 105, 115, 112, 108, 
+97, 121, 115, 32, 119, 111, 114, 100, 32, 99, 111, 117, 110, 116, 115, 46, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 
+0, 0, 0, 76, 0, 0, 0, 3, 0, 5, 5, 0, 0, 0, 198, 0, 
+64, 0, 21, 1, 0, 1, 222, 0, 0, 1, 223, 0, 0, 0, 31, 0, 
+128, 0, 1, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 116, 
+111, 115, 116, 114, 105, 110, 103, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 91, 0, 0, 0, 105, 0, 0, 0, 1, 0, 
+4, 26, 0, 0, 0, 70, 0, 64, 0, 134, 64, 64, 0, 135, 128, 64, 
+1, 71, 128, 128, 0, 135, 192, 192, 0, 155, 0, 0, 0, 23, 64, 0, 
+128, 140, 192, 192, 0, 157, 64, 0, 1, 134, 64, 64, 0, 138, 0, 0, 
+129, 134, 0, 64, 0, 198, 64, 64, 0, 199, 128, 192, 1, 71, 192, 0, 
+1, 135, 0, 193, 0, 155, 0, 0, 0, 23, 64, 0, 128, 140, 0, 193, 
+0, 157, 64, 0, 1, 134, 64, 65, 0, 140, 128, 65, 1, 157, 64, 0, 
+1, 134, 192, 65, 0, 157, 64, 128, 0, 31, 0, 128, 0, 8, 0, 0, 
+0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 77, 97, 114, 103, 105, 110, 
+67, 111, 110, 116, 114, 111, 108, 108, 101, 114, 115, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 118, 105, 101, 119, 109, 111, 100, 101, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 100, 101, 116, 97, 99, 104, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 116, 116, 97, 99, 104, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 
+117, 99, 104, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 115, 
+105, 122, 101, 83, 99, 114, 101, 101, 110, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 0, 0, 111, 0, 0, 0, 
+1, 0, 3, 8, 0, 0, 0, 70, 0, 64, 0, 128, 0, 0, 0, 93, 
+64, 0, 1, 70, 64, 64, 0, 93, 64, 128, 0, 67, 0, 128, 0, 95, 
+0, 0, 1, 31, 0, 128, 0, 2, 0, 0, 0, 4, 14, 0, 0, 0, 
+0, 0, 0, 0, 83, 101, 116, 77, 97, 114, 103, 105, 110, 77, 111, 100, 
+101, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/fileio.lua */
+static const char file_15[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 33, 63, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 134, 128, 64, 0, 135, 0, 65, 1, 198, 128, 64, 0, 199, 64, 193, 
+1, 6, 129, 64, 0, 7, 129, 65, 2, 70, 1, 64, 0, 71, 193, 193, 
+2, 134, 1, 64, 0, 135, 1, 66, 3, 198, 1, 64, 0, 199, 65, 194, 
+3, 6, 2, 64, 0, 7, 130, 66, 4, 70, 2, 64, 0, 71, 194, 194, 
+4, 134, 2, 64, 0, 135, 2, 67, 5, 198, 2, 64, 0, 199, 66, 195, 
+5, 1, 131, 3, 0, 65, 195, 3, 0, 129, 3, 4, 0, 193, 67, 4, 
+0, 1, 132, 4, 0, 65, 196, 4, 0, 129, 4, 5, 0, 193, 68, 5, 
+0, 1, 133, 5, 0, 65, 197, 5, 0, 129, 5, 6, 0, 193, 69, 6, 
+0, 1, 134, 6, 0, 65, 198, 6, 0, 129, 6, 7, 0, 193, 70, 7, 
+0, 37, 7, 0, 0, 101, 71, 0, 0, 8, 64, 7, 143, 101, 135, 0, 
+0, 8, 64, 135, 143, 70, 7, 72, 0, 165, 199, 0, 0, 74, 135, 135, 
+144, 70, 7, 72, 0, 165, 7, 1, 0, 74, 135, 7, 145, 101, 71, 1, 
+0, 165, 135, 1, 0, 8, 128, 135, 145, 165, 199, 1, 0, 8, 128, 7, 
+146, 165, 7, 2, 0, 198, 7, 72, 0, 37, 72, 2, 0, 202, 7, 136, 
+146, 229, 135, 2, 0, 8, 192, 7, 147, 31, 0, 128, 0, 39, 0, 0, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 112, 97, 114, 115, 101, 119, 111, 114, 100, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 98, 105, 116, 51, 50, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 98, 97, 110, 100, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 98, 111, 114, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 98, 120, 111, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 98, 116, 101, 115, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+116, 105, 109, 101, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 99, 111, 
+109, 112, 114, 101, 115, 115, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 
+100, 101, 99, 111, 109, 112, 114, 101, 115, 115, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 114, 101, 97, 100, 117, 56, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 98, 117, 102, 102, 101, 114, 
+0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 98, 101, 103, 105, 110, 97, 
+114, 101, 110, 97, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 101, 110, 
+100, 97, 114, 101, 110, 97, 0, 4, 50, 0, 0, 0, 0, 0, 0, 0, 
+87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 32, 100, 117, 109, 112, 
+102, 105, 108, 101, 32, 118, 49, 58, 32, 116, 104, 105, 115, 32, 105, 115, 
+32, 110, 111, 116, 32, 97, 32, 116, 101, 120, 116, 32, 102, 105, 108, 101, 
+33, 0, 4, 50, 0, 0, 0, 0, 0, 0, 0, 87, 111, 114, 100, 71, 
+114, 105, 110, 100, 101, 114, 32, 100, 117, 109, 112, 102, 105, 108, 101, 32, 
+118, 50, 58, 32, 116, 104, 105, 115, 32, 105, 115, 32, 110, 111, 116, 32, 
+97, 32, 116, 101, 120, 116, 32, 102, 105, 108, 101, 33, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 3, 
+0, 0, 0, 0, 0, 0, 0, 64, 3, 0, 0, 0, 0, 0, 0, 8, 
+64, 3, 0, 0, 0, 0, 0, 0, 16, 64, 3, 0, 0, 0, 0, 0, 
+0, 20, 64, 3, 0, 0, 0, 0, 0, 0, 24, 64, 3, 0, 0, 0, 
+0, 0, 0, 28, 64, 3, 0, 0, 0, 0, 0, 0, 32, 64, 3, 0, 
+0, 0, 0, 0, 0, 89, 64, 3, 0, 0, 0, 0, 0, 64, 89, 64, 
+3, 0, 0, 0, 0, 0, 128, 89, 64, 3, 0, 0, 0, 0, 0, 192, 
+89, 64, 3, 0, 0, 0, 0, 0, 0, 90, 64, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 83, 97, 118, 101, 84, 111, 83, 116, 114, 101, 97, 109, 
+0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 82, 97, 119, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 22, 0, 0, 0, 0, 
+0, 0, 0, 83, 97, 118, 101, 67, 117, 114, 114, 101, 110, 116, 68, 111, 
+99, 117, 109, 101, 110, 116, 65, 115, 0, 4, 20, 0, 0, 0, 0, 0, 
+0, 0, 83, 97, 118, 101, 67, 117, 114, 114, 101, 110, 116, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 108, 
+111, 97, 100, 102, 114, 111, 109, 115, 116, 114, 101, 97, 109, 122, 0, 4, 
+15, 0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 70, 114, 111, 109, 
+83, 116, 114, 101, 97, 109, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 
+76, 111, 97, 100, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 
+4, 16, 0, 0, 0, 0, 0, 0, 0, 85, 112, 103, 114, 97, 100, 101, 
+68, 111, 99, 117, 109, 101, 110, 116, 0, 11, 0, 0, 0, 37, 0, 0, 
+0, 124, 0, 0, 0, 3, 0, 9, 22, 0, 0, 0, 203, 0, 1, 0, 
+6, 1, 64, 0, 69, 1, 128, 0, 202, 64, 1, 2, 6, 65, 64, 0, 
+69, 1, 0, 1, 202, 64, 1, 2, 6, 129, 64, 0, 69, 1, 128, 1, 
+202, 64, 1, 2, 6, 193, 64, 0, 69, 1, 0, 2, 202, 64, 1, 2, 
+11, 1, 0, 0, 65, 1, 1, 0, 165, 1, 0, 0, 192, 1, 0, 3, 
+0, 2, 0, 0, 221, 65, 0, 1, 195, 1, 128, 0, 223, 1, 0, 1, 
+31, 0, 128, 0, 5, 0, 0, 0, 4, 17, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 67, 108, 97, 115, 
+115, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 67, 108, 97, 115, 115, 0, 4, 15, 0, 0, 0, 0, 0, 
+0, 0, 80, 97, 114, 97, 103, 114, 97, 112, 104, 67, 108, 97, 115, 115, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 77, 101, 110, 117, 67, 108, 
+97, 115, 115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 1, 0, 0, 
+0, 47, 0, 0, 0, 119, 0, 0, 0, 1, 0, 10, 162, 0, 0, 0, 
+70, 0, 0, 0, 91, 0, 0, 0, 23, 128, 1, 128, 69, 0, 128, 0, 
+133, 0, 0, 1, 93, 64, 0, 1, 69, 0, 128, 0, 134, 0, 0, 0, 
+93, 64, 0, 1, 31, 0, 128, 0, 69, 0, 128, 1, 8, 64, 0, 0, 
+69, 0, 128, 1, 77, 0, 192, 0, 73, 0, 128, 1, 70, 64, 64, 2, 
+128, 0, 0, 0, 93, 128, 0, 1, 24, 128, 192, 0, 23, 128, 20, 128, 
+70, 192, 64, 2, 128, 0, 0, 0, 93, 128, 0, 1, 91, 0, 0, 0, 
+23, 192, 2, 128, 135, 0, 193, 0, 70, 128, 128, 2, 91, 64, 0, 0, 
+23, 0, 2, 128, 134, 192, 64, 2, 192, 0, 0, 0, 157, 128, 0, 1, 
+140, 64, 65, 1, 157, 128, 0, 1, 0, 0, 0, 1, 69, 0, 0, 3, 
+23, 0, 0, 128, 69, 0, 0, 3, 133, 0, 128, 3, 24, 128, 128, 0, 
+23, 128, 1, 128, 133, 0, 128, 0, 197, 0, 0, 4, 157, 64, 0, 1, 
+133, 0, 128, 4, 192, 0, 0, 0, 157, 64, 0, 1, 23, 0, 28, 128, 
+133, 0, 128, 0, 192, 0, 128, 0, 157, 64, 0, 1, 133, 0, 128, 0, 
+213, 0, 0, 0, 157, 64, 0, 1, 134, 128, 65, 2, 192, 0, 0, 0, 
+157, 0, 1, 1, 23, 128, 0, 128, 197, 1, 128, 4, 0, 2, 0, 3, 
+221, 65, 0, 1, 162, 128, 0, 0, 35, 129, 254, 127, 139, 0, 0, 0, 
+198, 192, 65, 2, 0, 1, 0, 0, 221, 0, 1, 1, 23, 0, 3, 128, 
+198, 65, 64, 2, 0, 2, 0, 3, 221, 129, 0, 1, 88, 0, 194, 3, 
+23, 192, 1, 128, 204, 65, 66, 3, 65, 130, 2, 0, 221, 129, 128, 1, 
+219, 65, 0, 0, 23, 128, 0, 128, 213, 1, 0, 1, 205, 1, 192, 3, 
+138, 128, 129, 3, 226, 64, 0, 0, 99, 1, 252, 127, 198, 128, 64, 2, 
+199, 192, 194, 1, 0, 1, 0, 1, 221, 64, 0, 1, 198, 128, 65, 2, 
+0, 1, 0, 1, 221, 0, 1, 1, 23, 64, 1, 128, 5, 2, 128, 4, 
+64, 2, 128, 3, 29, 66, 0, 1, 5, 2, 128, 4, 71, 194, 1, 0, 
+29, 66, 0, 1, 226, 128, 0, 0, 99, 193, 253, 127, 197, 0, 128, 0, 
+5, 1, 0, 5, 221, 64, 0, 1, 23, 64, 14, 128, 70, 64, 64, 2, 
+128, 0, 0, 0, 93, 128, 0, 1, 24, 0, 195, 0, 23, 64, 2, 128, 
+27, 0, 0, 0, 23, 192, 0, 128, 69, 0, 128, 0, 133, 0, 128, 5, 
+93, 64, 0, 1, 23, 128, 11, 128, 69, 0, 128, 0, 133, 0, 0, 6, 
+93, 64, 0, 1, 23, 128, 10, 128, 70, 64, 64, 2, 128, 0, 0, 0, 
+93, 128, 0, 1, 24, 64, 195, 0, 23, 64, 2, 128, 69, 0, 128, 0, 
+133, 0, 128, 6, 93, 64, 0, 1, 69, 0, 128, 0, 149, 0, 0, 0, 
+93, 64, 0, 1, 69, 0, 0, 7, 128, 0, 0, 0, 93, 64, 0, 1, 
+23, 192, 6, 128, 70, 64, 64, 2, 128, 0, 0, 0, 93, 128, 0, 1, 
+24, 0, 194, 0, 23, 192, 3, 128, 26, 0, 0, 135, 23, 128, 1, 128, 
+69, 0, 128, 0, 133, 0, 128, 7, 93, 64, 0, 1, 69, 0, 128, 0, 
+128, 0, 0, 0, 93, 64, 0, 1, 23, 64, 3, 128, 69, 0, 128, 0, 
+133, 0, 0, 8, 93, 64, 0, 1, 69, 0, 128, 0, 147, 0, 0, 0, 
+93, 64, 0, 1, 23, 128, 1, 128, 70, 192, 67, 2, 129, 0, 4, 0, 
+198, 64, 64, 2, 0, 1, 0, 0, 221, 128, 0, 1, 150, 192, 0, 1, 
+93, 64, 0, 1, 31, 0, 128, 0, 17, 0, 0, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 121, 
+112, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 98, 108, 
+101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 109, 101, 
+116, 97, 116, 97, 98, 108, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 95, 95, 105, 110, 100, 101, 120, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 103, 101, 116, 82, 97, 119, 65, 114, 114, 97, 121, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 112, 97, 105, 114, 115, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 110, 117, 109, 98, 101, 114, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 94, 95, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+115, 111, 114, 116, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 98, 111, 
+111, 108, 101, 97, 110, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 
+116, 114, 105, 110, 103, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 101, 114, 114, 111, 114, 0, 4, 18, 
+0, 0, 0, 0, 0, 0, 0, 117, 110, 115, 117, 112, 112, 111, 114, 116, 
+101, 100, 32, 116, 121, 112, 101, 32, 0, 0, 0, 0, 0, 17, 0, 0, 
+0, 1, 4, 1, 2, 0, 5, 1, 5, 0, 0, 1, 3, 0, 6, 0, 
+7, 0, 8, 1, 6, 0, 9, 0, 10, 0, 11, 0, 12, 1, 1, 0, 
+13, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 1, 23, 1, 
+24, 1, 25, 1, 27, 1, 20, 1, 15, 1, 26, 1, 22, 1, 14, 1, 
+16, 1, 17, 1, 18, 1, 19, 1, 21, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0, 
+0, 179, 0, 0, 0, 2, 0, 17, 78, 0, 0, 0, 134, 0, 64, 0, 
+135, 64, 64, 1, 192, 0, 0, 0, 1, 129, 0, 0, 157, 192, 128, 1, 
+155, 64, 0, 0, 23, 128, 0, 128, 4, 1, 0, 0, 64, 1, 128, 1, 
+31, 1, 128, 1, 12, 193, 64, 1, 29, 65, 0, 1, 6, 1, 64, 0, 
+7, 65, 64, 2, 64, 1, 0, 0, 129, 1, 1, 0, 86, 129, 129, 2, 
+129, 129, 0, 0, 29, 193, 128, 1, 192, 0, 128, 2, 128, 0, 0, 2, 
+155, 64, 0, 0, 23, 128, 0, 128, 4, 1, 0, 0, 64, 1, 128, 1, 
+31, 1, 128, 1, 5, 1, 128, 0, 29, 129, 128, 0, 71, 65, 65, 2, 
+135, 129, 65, 2, 229, 1, 0, 0, 37, 66, 0, 0, 69, 2, 0, 1, 
+128, 2, 128, 0, 192, 2, 128, 3, 0, 3, 0, 4, 93, 130, 0, 2, 
+133, 2, 128, 1, 192, 2, 0, 2, 157, 130, 0, 1, 4, 1, 0, 0, 
+196, 2, 0, 0, 91, 2, 0, 0, 23, 128, 1, 128, 12, 195, 65, 1, 
+133, 3, 0, 2, 193, 3, 2, 0, 0, 4, 0, 5, 29, 195, 128, 2, 
+192, 2, 128, 6, 64, 2, 0, 6, 91, 2, 0, 0, 23, 192, 0, 128, 
+12, 195, 64, 1, 29, 195, 0, 1, 192, 2, 128, 6, 64, 2, 0, 6, 
+91, 2, 0, 0, 23, 128, 3, 128, 6, 67, 66, 0, 7, 131, 66, 6, 
+64, 3, 0, 0, 129, 3, 1, 0, 86, 131, 131, 6, 128, 3, 0, 0, 
+29, 195, 128, 1, 192, 2, 128, 6, 64, 2, 0, 6, 6, 67, 66, 0, 
+7, 195, 66, 6, 64, 3, 0, 0, 129, 3, 1, 0, 86, 131, 131, 6, 
+29, 67, 0, 1, 0, 3, 128, 4, 64, 3, 128, 5, 31, 3, 128, 1, 
+31, 0, 128, 0, 12, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 105, 111, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 111, 112, 101, 
+110, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 98, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 99, 108, 111, 115, 101, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 46, 110, 101, 119, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 97, 112, 112, 101, 110, 100, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 97, 112, 112, 101, 110, 100, 117, 56, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 119, 114, 105, 116, 101, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 10, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+111, 115, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 110, 97, 
+109, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 109, 111, 
+118, 101, 0, 2, 0, 0, 0, 146, 0, 0, 0, 152, 0, 0, 0, 1, 
+0, 4, 15, 0, 0, 0, 70, 0, 64, 0, 128, 0, 0, 0, 93, 128, 
+0, 1, 24, 64, 192, 0, 23, 0, 1, 128, 69, 0, 128, 0, 133, 0, 
+0, 1, 192, 0, 0, 0, 93, 64, 128, 1, 23, 192, 0, 128, 69, 0, 
+128, 1, 133, 0, 0, 1, 192, 0, 0, 0, 93, 64, 128, 1, 31, 0, 
+128, 0, 2, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 
+121, 112, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 110, 117, 109, 
+98, 101, 114, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 1, 6, 
+1, 4, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 154, 0, 0, 0, 156, 0, 0, 0, 
+1, 0, 4, 5, 0, 0, 0, 69, 0, 0, 0, 133, 0, 128, 0, 192, 
+0, 0, 0, 93, 64, 128, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 1, 6, 1, 4, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 
+0, 0, 0, 0, 0, 1, 9, 1, 28, 1, 6, 1, 13, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 181, 0, 0, 0, 184, 0, 0, 0, 1, 0, 4, 9, 0, 0, 0, 
+70, 0, 64, 0, 76, 64, 192, 0, 93, 64, 0, 1, 70, 128, 64, 0, 
+128, 0, 0, 0, 198, 0, 64, 0, 94, 0, 128, 1, 95, 0, 0, 0, 
+31, 0, 128, 0, 3, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 112, 117, 114, 103, 101, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 83, 97, 118, 101, 84, 111, 83, 116, 114, 101, 97, 
+109, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+186, 0, 0, 0, 207, 0, 0, 0, 1, 0, 7, 46, 0, 0, 0, 27, 
+64, 0, 0, 23, 64, 4, 128, 70, 0, 64, 0, 129, 64, 0, 0, 193, 
+128, 0, 0, 3, 1, 128, 0, 93, 128, 0, 2, 0, 0, 128, 0, 27, 
+64, 0, 0, 23, 64, 0, 128, 67, 0, 0, 0, 95, 0, 0, 1, 76, 
+192, 64, 0, 193, 0, 1, 0, 93, 128, 128, 1, 91, 0, 0, 0, 23, 
+128, 0, 128, 64, 0, 0, 0, 129, 64, 1, 0, 22, 128, 128, 0, 70, 
+128, 65, 0, 74, 0, 128, 131, 70, 0, 66, 0, 129, 64, 2, 0, 93, 
+64, 0, 1, 70, 128, 65, 0, 76, 128, 194, 0, 93, 64, 0, 1, 70, 
+192, 66, 0, 134, 128, 65, 0, 135, 192, 65, 1, 93, 192, 0, 1, 91, 
+64, 0, 0, 23, 128, 1, 128, 198, 0, 67, 0, 1, 65, 3, 0, 65, 
+129, 3, 0, 128, 1, 0, 1, 86, 129, 129, 2, 221, 64, 128, 1, 23, 
+128, 0, 128, 198, 192, 67, 0, 1, 1, 4, 0, 221, 64, 0, 1, 95, 
+0, 0, 1, 31, 0, 128, 0, 17, 0, 0, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 0, 
+4, 18, 0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 32, 68, 111, 
+99, 117, 109, 101, 110, 116, 32, 83, 101, 116, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 83, 97, 118, 101, 32, 97, 115, 58, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 47, 91, 94, 46, 93, 42, 36, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 46, 119, 103, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 17, 0, 0, 
+0, 0, 0, 0, 0, 73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 
+115, 115, 97, 103, 101, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 83, 
+97, 118, 105, 110, 103, 46, 46, 46, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 99, 108, 101, 97, 110, 0, 4, 19, 0, 0, 0, 0, 0, 0, 
+0, 83, 97, 118, 101, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+82, 97, 119, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 
+97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 83, 97, 118, 101, 32, 102, 97, 105, 108, 101, 100, 0, 4, 
+34, 0, 0, 0, 0, 0, 0, 0, 84, 104, 101, 32, 100, 111, 99, 117, 
+109, 101, 110, 116, 32, 99, 111, 117, 108, 100, 32, 110, 111, 116, 32, 98, 
+101, 32, 115, 97, 118, 101, 100, 58, 32, 0, 4, 16, 0, 0, 0, 0, 
+0, 0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 
+103, 101, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 
+32, 115, 117, 99, 99, 101, 101, 100, 101, 100, 46, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 0, 0, 0, 223, 0, 
+0, 0, 0, 0, 5, 30, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 
+0, 27, 64, 0, 0, 23, 192, 4, 128, 70, 128, 64, 0, 129, 192, 0, 
+0, 193, 0, 1, 0, 3, 1, 128, 0, 93, 128, 0, 2, 0, 0, 128, 
+0, 27, 64, 0, 0, 23, 64, 0, 128, 67, 0, 0, 0, 95, 0, 0, 
+1, 76, 64, 65, 0, 193, 128, 1, 0, 93, 128, 128, 1, 91, 0, 0, 
+0, 23, 128, 0, 128, 64, 0, 0, 0, 129, 192, 1, 0, 22, 128, 128, 
+0, 70, 0, 64, 0, 74, 0, 128, 128, 70, 0, 66, 0, 71, 64, 194, 
+0, 128, 0, 0, 0, 94, 0, 0, 1, 95, 0, 0, 0, 31, 0, 128, 
+0, 10, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 110, 97, 109, 101, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 0, 4, 18, 0, 
+0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 32, 68, 111, 99, 117, 109, 
+101, 110, 116, 32, 83, 101, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 83, 97, 118, 101, 32, 97, 115, 58, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 102, 105, 110, 100, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 47, 91, 94, 46, 93, 42, 36, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 46, 119, 103, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 
+109, 100, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 
+67, 117, 114, 114, 101, 110, 116, 68, 111, 99, 117, 109, 101, 110, 116, 65, 
+115, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+225, 0, 0, 0, 86, 1, 0, 0, 1, 0, 6, 30, 0, 0, 0, 75, 
+0, 0, 0, 132, 0, 0, 0, 229, 0, 0, 0, 11, 129, 2, 0, 101, 
+65, 0, 0, 10, 65, 1, 128, 101, 129, 0, 0, 10, 65, 129, 128, 101, 
+193, 0, 0, 10, 65, 1, 129, 101, 1, 1, 0, 10, 65, 129, 129, 101, 
+65, 1, 0, 10, 65, 1, 130, 101, 129, 1, 0, 10, 65, 129, 130, 101, 
+193, 1, 0, 10, 65, 1, 131, 101, 1, 2, 0, 10, 65, 129, 131, 101, 
+65, 2, 0, 10, 65, 1, 132, 101, 129, 2, 0, 10, 65, 129, 132, 101, 
+193, 2, 0, 128, 0, 128, 2, 64, 1, 0, 1, 94, 1, 128, 0, 95, 
+1, 0, 0, 31, 0, 128, 0, 10, 0, 0, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 68, 83, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+68, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 87, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 77, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 84, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 83, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 78, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 66, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 46, 0, 12, 0, 0, 0, 229, 0, 
+0, 0, 245, 0, 0, 0, 1, 0, 7, 24, 0, 0, 0, 70, 0, 64, 
+0, 133, 0, 128, 0, 140, 64, 64, 1, 1, 129, 0, 0, 157, 0, 128, 
+1, 93, 128, 0, 0, 129, 192, 0, 0, 192, 0, 128, 0, 1, 193, 0, 
+0, 161, 128, 0, 128, 133, 1, 0, 1, 157, 129, 128, 0, 10, 128, 129, 
+2, 160, 192, 254, 127, 133, 0, 0, 1, 157, 128, 128, 0, 155, 0, 0, 
+0, 23, 192, 0, 128, 197, 0, 0, 1, 221, 128, 128, 0, 10, 192, 0, 
+1, 23, 192, 253, 127, 31, 0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 110, 117, 109, 98, 
+101, 114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 100, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 42, 108, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+1, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 248, 0, 0, 0, 253, 0, 0, 0, 
+0, 0, 5, 16, 0, 0, 0, 11, 0, 0, 0, 70, 0, 64, 0, 128, 
+0, 0, 0, 203, 64, 0, 0, 6, 129, 64, 0, 202, 0, 129, 128, 93, 
+64, 128, 1, 69, 0, 128, 0, 85, 0, 128, 0, 77, 192, 192, 0, 72, 
+0, 128, 0, 69, 0, 0, 1, 128, 0, 0, 0, 94, 0, 0, 1, 95, 
+0, 0, 0, 31, 0, 128, 0, 4, 0, 0, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 100, 101, 
+120, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 67, 108, 97, 115, 115, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 
+1, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 4, 1, 0, 0, 0, 
+0, 5, 16, 0, 0, 0, 11, 0, 0, 0, 70, 0, 64, 0, 128, 0, 
+0, 0, 203, 64, 0, 0, 6, 129, 64, 0, 202, 0, 129, 128, 93, 64, 
+128, 1, 69, 0, 128, 0, 85, 0, 128, 0, 77, 192, 192, 0, 72, 0, 
+128, 0, 69, 0, 0, 1, 128, 0, 0, 0, 94, 0, 0, 1, 95, 0, 
+0, 0, 31, 0, 128, 0, 4, 0, 0, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 100, 101, 120, 
+0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 67, 108, 97, 115, 115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 
+63, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 1, 1, 3, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 6, 1, 0, 0, 11, 1, 0, 0, 0, 0, 5, 16, 0, 
+0, 0, 11, 0, 0, 0, 70, 0, 64, 0, 128, 0, 0, 0, 203, 64, 
+0, 0, 6, 129, 64, 0, 202, 0, 129, 128, 93, 64, 128, 1, 69, 0, 
+128, 0, 85, 0, 128, 0, 77, 192, 192, 0, 72, 0, 128, 0, 69, 0, 
+0, 1, 128, 0, 0, 0, 94, 0, 0, 1, 95, 0, 0, 0, 31, 0, 
+128, 0, 4, 0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 
+101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 95, 95, 105, 110, 100, 101, 120, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 80, 97, 114, 97, 103, 114, 97, 112, 104, 67, 
+108, 97, 115, 115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 
+0, 0, 3, 0, 0, 0, 0, 0, 1, 1, 1, 3, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+13, 1, 0, 0, 28, 1, 0, 0, 0, 0, 4, 14, 0, 0, 0, 11, 
+0, 0, 0, 69, 0, 0, 0, 85, 0, 128, 0, 77, 0, 192, 0, 139, 
+0, 0, 0, 8, 128, 128, 0, 133, 0, 128, 0, 192, 0, 0, 0, 157, 
+64, 0, 1, 135, 64, 64, 0, 8, 128, 128, 0, 135, 64, 64, 0, 159, 
+0, 0, 1, 31, 0, 128, 0, 2, 0, 0, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 101, 120, 
+116, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 1, 1, 3, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 30, 1, 0, 0, 35, 1, 0, 0, 0, 0, 5, 16, 0, 0, 
+0, 11, 0, 0, 0, 70, 0, 64, 0, 128, 0, 0, 0, 203, 64, 0, 
+0, 6, 129, 64, 0, 202, 0, 129, 128, 93, 64, 128, 1, 69, 0, 128, 
+0, 85, 0, 128, 0, 77, 192, 192, 0, 72, 0, 128, 0, 69, 0, 0, 
+1, 128, 0, 0, 0, 94, 0, 0, 1, 95, 0, 0, 0, 31, 0, 128, 
+0, 4, 0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 95, 95, 105, 110, 100, 101, 120, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 77, 101, 110, 117, 67, 108, 97, 115, 115, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 3, 0, 0, 0, 
+0, 0, 1, 1, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 1, 0, 0, 41, 1, 
+0, 0, 0, 0, 3, 10, 0, 0, 0, 11, 0, 0, 0, 69, 0, 0, 
+0, 85, 0, 128, 0, 77, 0, 192, 0, 8, 0, 128, 0, 69, 0, 128, 
+0, 128, 0, 0, 0, 94, 0, 0, 1, 95, 0, 0, 0, 31, 0, 128, 
+0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 
+0, 0, 2, 0, 0, 0, 1, 1, 1, 3, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 1, 
+0, 0, 47, 1, 0, 0, 0, 0, 3, 10, 0, 0, 0, 5, 0, 0, 
+0, 12, 0, 64, 0, 129, 64, 0, 0, 29, 128, 128, 1, 69, 0, 128, 
+0, 85, 0, 128, 0, 77, 128, 192, 0, 72, 0, 128, 0, 31, 0, 0, 
+1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 114, 101, 97, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+42, 108, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 
+2, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 1, 0, 0, 
+53, 1, 0, 0, 0, 0, 4, 12, 0, 0, 0, 6, 0, 64, 0, 69, 
+0, 128, 0, 76, 64, 192, 0, 193, 128, 0, 0, 93, 0, 128, 1, 29, 
+128, 0, 0, 69, 0, 0, 1, 85, 0, 128, 0, 77, 192, 192, 0, 136, 
+0, 128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 110, 117, 109, 98, 101, 114, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 100, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 42, 108, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 
+1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 55, 1, 0, 0, 60, 1, 0, 0, 0, 0, 
+3, 14, 0, 0, 0, 5, 0, 0, 0, 12, 0, 64, 0, 129, 64, 0, 
+0, 29, 128, 128, 1, 88, 128, 64, 0, 23, 0, 0, 128, 3, 64, 0, 
+0, 3, 0, 128, 0, 69, 0, 128, 0, 85, 0, 128, 0, 77, 192, 192, 
+0, 72, 0, 128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 100, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 42, 108, 0, 4, 2, 0, 0, 0, 
+0, 0, 0, 0, 84, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 
+0, 0, 0, 2, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 
+1, 0, 0, 64, 1, 0, 0, 0, 0, 2, 3, 0, 0, 0, 4, 0, 
+0, 0, 31, 0, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 1, 0, 0, 83, 1, 
+0, 0, 0, 0, 6, 28, 0, 0, 0, 5, 0, 0, 0, 12, 0, 64, 
+0, 129, 64, 0, 0, 29, 128, 128, 1, 27, 64, 0, 0, 23, 128, 0, 
+128, 70, 128, 192, 0, 129, 192, 0, 0, 93, 64, 0, 1, 70, 0, 193, 
+0, 128, 0, 0, 0, 93, 128, 0, 1, 91, 0, 0, 0, 23, 64, 0, 
+128, 134, 64, 0, 1, 159, 0, 0, 1, 134, 0, 128, 1, 155, 64, 0, 
+0, 23, 0, 1, 128, 198, 128, 192, 0, 1, 65, 1, 0, 64, 1, 0, 
+0, 22, 65, 1, 2, 221, 64, 0, 1, 192, 0, 0, 1, 222, 0, 128, 
+0, 223, 0, 0, 0, 31, 0, 128, 0, 6, 0, 0, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 114, 101, 97, 100, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 42, 108, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+101, 114, 114, 111, 114, 0, 4, 33, 0, 0, 0, 0, 0, 0, 0, 117, 
+110, 101, 120, 112, 101, 99, 116, 101, 100, 32, 69, 79, 70, 32, 119, 104, 
+101, 110, 32, 114, 101, 97, 100, 105, 110, 103, 32, 102, 105, 108, 101, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 110, 117, 109, 98, 101, 
+114, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 39, 116, 
+32, 108, 111, 97, 100, 32, 116, 121, 112, 101, 32, 0, 0, 0, 0, 0, 
+4, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 4, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 1, 0, 0, 231, 1, 
+0, 0, 1, 0, 9, 58, 0, 0, 0, 75, 0, 0, 0, 132, 0, 0, 
+0, 197, 0, 0, 0, 12, 1, 64, 0, 129, 65, 0, 0, 29, 1, 128, 
+1, 221, 128, 0, 0, 1, 129, 0, 0, 101, 1, 0, 0, 139, 129, 3, 
+0, 197, 1, 0, 1, 37, 66, 0, 0, 138, 1, 130, 3, 197, 1, 128, 
+1, 37, 130, 0, 0, 138, 1, 130, 3, 197, 1, 128, 2, 37, 194, 0, 
+0, 138, 1, 130, 3, 197, 1, 0, 3, 37, 2, 1, 0, 138, 1, 130, 
+3, 197, 1, 128, 3, 37, 66, 1, 0, 138, 1, 130, 3, 197, 1, 0, 
+4, 37, 130, 1, 0, 138, 1, 130, 3, 197, 1, 128, 4, 37, 194, 1, 
+0, 138, 1, 130, 3, 197, 1, 0, 5, 37, 2, 2, 0, 138, 1, 130, 
+3, 197, 1, 128, 5, 37, 66, 2, 0, 138, 1, 130, 3, 197, 1, 0, 
+6, 37, 130, 2, 0, 138, 1, 130, 3, 197, 1, 128, 6, 37, 194, 2, 
+0, 138, 1, 130, 3, 197, 1, 0, 7, 37, 2, 3, 0, 138, 1, 130, 
+3, 197, 1, 128, 7, 37, 66, 3, 0, 138, 1, 130, 3, 197, 1, 0, 
+8, 37, 130, 3, 0, 138, 1, 130, 3, 229, 193, 3, 0, 128, 0, 128, 
+3, 192, 1, 0, 1, 222, 1, 128, 0, 223, 1, 0, 0, 31, 0, 128, 
+0, 3, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
+97, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 42, 97, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 16, 0, 0, 0, 94, 1, 0, 0, 
+111, 1, 0, 0, 1, 0, 7, 25, 0, 0, 0, 68, 0, 0, 0, 133, 
+0, 128, 0, 197, 0, 0, 1, 5, 1, 0, 0, 157, 192, 128, 1, 201, 
+0, 0, 0, 64, 0, 0, 1, 129, 0, 0, 0, 192, 0, 128, 0, 1, 
+1, 0, 0, 161, 128, 0, 128, 133, 1, 128, 1, 157, 129, 128, 0, 10, 
+128, 129, 2, 160, 192, 254, 127, 133, 0, 128, 1, 157, 128, 128, 0, 155, 
+0, 0, 0, 23, 192, 0, 128, 197, 0, 128, 1, 221, 128, 128, 0, 10, 
+192, 0, 1, 23, 192, 253, 127, 31, 0, 0, 1, 31, 0, 128, 0, 1, 
+0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 
+4, 0, 0, 0, 1, 4, 0, 1, 1, 3, 1, 2, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+114, 1, 0, 0, 118, 1, 0, 0, 0, 0, 4, 10, 0, 0, 0, 4, 
+0, 0, 0, 69, 0, 128, 0, 133, 0, 0, 1, 197, 0, 0, 0, 93, 
+192, 128, 1, 137, 0, 0, 0, 0, 0, 128, 0, 70, 0, 128, 1, 95, 
+0, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+0, 0, 0, 1, 4, 0, 1, 1, 3, 1, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 
+1, 0, 0, 125, 1, 0, 0, 0, 0, 5, 16, 0, 0, 0, 11, 0, 
+0, 0, 70, 0, 64, 0, 128, 0, 0, 0, 203, 64, 0, 0, 6, 129, 
+64, 0, 202, 0, 129, 128, 93, 64, 128, 1, 69, 0, 128, 0, 85, 0, 
+128, 0, 77, 192, 192, 0, 72, 0, 128, 0, 69, 0, 0, 1, 128, 0, 
+0, 0, 94, 0, 0, 1, 95, 0, 0, 0, 31, 0, 128, 0, 4, 0, 
+0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 109, 101, 
+116, 97, 116, 97, 98, 108, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 95, 95, 105, 110, 100, 101, 120, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 67, 108, 97, 
+115, 115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 
+3, 0, 0, 0, 0, 4, 1, 1, 1, 5, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 1, 
+0, 0, 132, 1, 0, 0, 0, 0, 5, 16, 0, 0, 0, 11, 0, 0, 
+0, 70, 0, 64, 0, 128, 0, 0, 0, 203, 64, 0, 0, 6, 129, 64, 
+0, 202, 0, 129, 128, 93, 64, 128, 1, 69, 0, 128, 0, 85, 0, 128, 
+0, 77, 192, 192, 0, 72, 0, 128, 0, 69, 0, 0, 1, 128, 0, 0, 
+0, 94, 0, 0, 1, 95, 0, 0, 0, 31, 0, 128, 0, 4, 0, 0, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 109, 101, 116, 
+97, 116, 97, 98, 108, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+95, 95, 105, 110, 100, 101, 120, 0, 4, 14, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 67, 108, 97, 115, 115, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 3, 0, 0, 0, 
+0, 4, 1, 1, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 1, 0, 0, 139, 1, 
+0, 0, 0, 0, 5, 16, 0, 0, 0, 11, 0, 0, 0, 70, 0, 64, 
+0, 128, 0, 0, 0, 203, 64, 0, 0, 6, 129, 64, 0, 202, 0, 129, 
+128, 93, 64, 128, 1, 69, 0, 128, 0, 85, 0, 128, 0, 77, 192, 192, 
+0, 72, 0, 128, 0, 69, 0, 0, 1, 128, 0, 0, 0, 94, 0, 0, 
+1, 95, 0, 0, 0, 31, 0, 128, 0, 4, 0, 0, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 
+108, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 
+100, 101, 120, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 67, 108, 97, 115, 115, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4, 1, 
+1, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 141, 1, 0, 0, 155, 1, 0, 0, 0, 
+0, 4, 14, 0, 0, 0, 11, 0, 0, 0, 69, 0, 0, 0, 85, 0, 
+128, 0, 77, 0, 192, 0, 139, 0, 0, 0, 8, 128, 128, 0, 133, 0, 
+128, 0, 192, 0, 0, 0, 157, 64, 0, 1, 135, 64, 64, 0, 8, 128, 
+128, 0, 135, 64, 64, 0, 159, 0, 0, 1, 31, 0, 128, 0, 2, 0, 
+0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 116, 101, 120, 116, 0, 0, 0, 0, 0, 2, 0, 0, 
+0, 1, 1, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 1, 0, 0, 164, 1, 0, 
+0, 0, 0, 2, 8, 0, 0, 0, 5, 0, 0, 0, 29, 128, 128, 0, 
+69, 0, 128, 0, 85, 0, 128, 0, 77, 0, 192, 0, 72, 0, 128, 0, 
+31, 0, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 0, 0, 0, 0, 2, 0, 0, 0, 1, 2, 1, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 166, 1, 0, 0, 171, 1, 0, 0, 0, 0, 5, 
+16, 0, 0, 0, 11, 0, 0, 0, 70, 0, 64, 0, 128, 0, 0, 0, 
+203, 64, 0, 0, 6, 129, 64, 0, 202, 0, 129, 128, 93, 64, 128, 1, 
+69, 0, 128, 0, 85, 0, 128, 0, 77, 192, 192, 0, 72, 0, 128, 0, 
+69, 0, 0, 1, 128, 0, 0, 0, 94, 0, 0, 1, 95, 0, 0, 0, 
+31, 0, 128, 0, 4, 0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 
+0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 100, 101, 120, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 77, 101, 110, 117, 67, 108, 97, 115, 
+115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 3, 
+0, 0, 0, 0, 4, 1, 1, 1, 5, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 173, 1, 0, 
+0, 177, 1, 0, 0, 0, 0, 3, 10, 0, 0, 0, 11, 0, 0, 0, 
+69, 0, 0, 0, 85, 0, 128, 0, 77, 0, 192, 0, 8, 0, 128, 0, 
+69, 0, 128, 0, 128, 0, 0, 0, 94, 0, 0, 1, 95, 0, 0, 0, 
+31, 0, 128, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 
+63, 0, 0, 0, 0, 2, 0, 0, 0, 1, 1, 1, 5, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 179, 1, 0, 0, 187, 1, 0, 0, 0, 0, 5, 23, 0, 0, 0, 
+4, 0, 0, 0, 69, 0, 128, 0, 133, 0, 0, 1, 197, 0, 0, 0, 
+93, 192, 128, 1, 137, 0, 0, 0, 0, 0, 128, 0, 69, 0, 0, 1, 
+76, 0, 192, 0, 197, 0, 0, 0, 5, 1, 0, 0, 13, 1, 0, 2, 
+14, 65, 64, 2, 93, 128, 0, 2, 133, 0, 0, 0, 141, 0, 0, 1, 
+137, 0, 0, 0, 133, 0, 128, 1, 149, 0, 0, 1, 141, 64, 64, 1, 
+200, 64, 0, 1, 95, 0, 0, 1, 31, 0, 128, 0, 2, 0, 0, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 117, 98, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 4, 0, 0, 0, 1, 4, 
+0, 1, 1, 3, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 189, 1, 0, 0, 194, 1, 
+0, 0, 0, 0, 4, 13, 0, 0, 0, 4, 0, 0, 0, 69, 0, 128, 
+0, 133, 0, 0, 1, 197, 0, 0, 0, 93, 192, 128, 1, 137, 0, 0, 
+0, 0, 0, 128, 0, 69, 0, 128, 1, 85, 0, 128, 0, 77, 0, 192, 
+0, 200, 0, 128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 1, 0, 0, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 4, 0, 
+0, 0, 1, 4, 0, 1, 1, 3, 1, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196, 1, 
+0, 0, 202, 1, 0, 0, 0, 0, 4, 14, 0, 0, 0, 4, 0, 0, 
+0, 69, 0, 128, 0, 133, 0, 0, 1, 197, 0, 0, 0, 93, 192, 128, 
+1, 137, 0, 0, 0, 0, 0, 128, 0, 19, 0, 0, 0, 69, 0, 128, 
+1, 85, 0, 128, 0, 77, 0, 192, 0, 200, 0, 128, 0, 31, 0, 0, 
+1, 31, 0, 128, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 0, 0, 0, 0, 4, 0, 0, 0, 1, 4, 0, 1, 1, 3, 
+1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 204, 1, 0, 0, 207, 1, 0, 0, 0, 0, 
+2, 7, 0, 0, 0, 5, 0, 0, 0, 21, 0, 0, 0, 13, 0, 64, 
+0, 8, 64, 64, 0, 3, 0, 128, 0, 31, 0, 0, 1, 31, 0, 128, 
+0, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 1, 1, 
+0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 1, 
+0, 0, 212, 1, 0, 0, 0, 0, 2, 7, 0, 0, 0, 5, 0, 0, 
+0, 21, 0, 0, 0, 13, 0, 64, 0, 8, 64, 64, 0, 3, 0, 0, 
+0, 31, 0, 0, 1, 31, 0, 128, 0, 2, 0, 0, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 214, 1, 0, 0, 216, 1, 0, 0, 0, 0, 
+2, 3, 0, 0, 0, 4, 0, 0, 0, 31, 0, 0, 1, 31, 0, 128, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 219, 1, 0, 0, 228, 1, 0, 0, 0, 0, 7, 21, 0, 0, 0, 
+4, 0, 0, 0, 69, 0, 128, 0, 133, 0, 0, 1, 197, 0, 0, 0, 
+93, 192, 128, 1, 137, 0, 0, 0, 0, 0, 128, 0, 70, 0, 128, 1, 
+91, 64, 0, 0, 23, 128, 1, 128, 134, 0, 64, 2, 193, 64, 0, 0, 
+0, 1, 0, 0, 65, 129, 0, 0, 133, 1, 0, 0, 214, 128, 129, 1, 
+157, 64, 0, 1, 128, 0, 128, 0, 158, 0, 128, 0, 159, 0, 0, 0, 
+31, 0, 128, 0, 3, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 101, 114, 114, 111, 114, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 
+99, 97, 110, 39, 116, 32, 108, 111, 97, 100, 32, 116, 121, 112, 101, 32, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 32, 97, 116, 32, 111, 102, 
+102, 115, 101, 116, 32, 0, 0, 0, 0, 0, 5, 0, 0, 0, 1, 4, 
+0, 1, 1, 3, 1, 6, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 
+1, 7, 1, 8, 1, 20, 1, 23, 0, 0, 1, 24, 1, 25, 1, 26, 
+1, 22, 1, 27, 1, 15, 1, 18, 1, 19, 1, 21, 1, 16, 1, 17, 
+1, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 233, 1, 0, 0, 8, 2, 0, 0, 1, 0, 
+11, 57, 0, 0, 0, 70, 0, 64, 0, 71, 64, 192, 0, 128, 0, 0, 
+0, 193, 128, 0, 0, 93, 192, 128, 1, 91, 64, 0, 0, 23, 128, 1, 
+128, 196, 0, 0, 0, 1, 193, 0, 0, 64, 1, 0, 0, 129, 1, 1, 
+0, 192, 1, 0, 1, 22, 193, 1, 2, 223, 0, 128, 1, 196, 0, 0, 
+0, 12, 65, 193, 0, 129, 129, 1, 0, 29, 129, 128, 1, 69, 1, 128, 
+0, 24, 64, 1, 2, 23, 64, 0, 128, 197, 0, 0, 1, 23, 0, 3, 
+128, 69, 1, 128, 1, 24, 64, 1, 2, 23, 64, 0, 128, 198, 192, 65, 
+0, 23, 192, 1, 128, 76, 1, 194, 0, 93, 65, 0, 1, 68, 1, 0, 
+0, 129, 193, 0, 0, 192, 1, 0, 0, 1, 66, 2, 0, 150, 1, 2, 
+3, 95, 1, 128, 1, 69, 1, 0, 2, 93, 65, 128, 0, 70, 129, 66, 
+0, 128, 1, 128, 1, 198, 193, 66, 0, 0, 2, 128, 0, 93, 1, 1, 
+2, 5, 2, 128, 2, 29, 66, 128, 0, 12, 2, 194, 0, 29, 66, 0, 
+1, 91, 65, 0, 0, 23, 192, 0, 128, 6, 2, 67, 0, 64, 2, 0, 
+3, 129, 66, 3, 0, 29, 66, 128, 1, 0, 2, 0, 3, 64, 2, 128, 
+3, 31, 2, 128, 1, 31, 0, 128, 0, 14, 0, 0, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 105, 111, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 111, 112, 101, 110, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+114, 98, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 39, 0, 4, 24, 
+0, 0, 0, 0, 0, 0, 0, 39, 32, 99, 111, 117, 108, 100, 32, 110, 
+111, 116, 32, 98, 101, 32, 111, 112, 101, 110, 101, 100, 58, 32, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 100, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 42, 108, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 108, 111, 97, 100, 102, 114, 111, 109, 115, 116, 114, 101, 97, 109, 
+122, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 99, 108, 111, 115, 101, 
+0, 4, 35, 0, 0, 0, 0, 0, 0, 0, 39, 32, 105, 115, 32, 110, 
+111, 116, 32, 97, 32, 118, 97, 108, 105, 100, 32, 87, 111, 114, 100, 71, 
+114, 105, 110, 100, 101, 114, 32, 102, 105, 108, 101, 46, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 120, 112, 99, 97, 108, 108, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 84, 114, 97, 99, 101, 98, 97, 99, 107, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 101, 114, 114, 111, 114, 0, 3, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 
+0, 0, 1, 12, 1, 29, 1, 13, 1, 10, 1, 11, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+10, 2, 0, 0, 22, 2, 0, 0, 1, 0, 5, 13, 0, 0, 0, 70, 
+0, 64, 0, 128, 0, 0, 0, 93, 192, 0, 1, 155, 0, 0, 0, 23, 
+128, 0, 128, 196, 0, 0, 0, 0, 1, 0, 1, 223, 0, 128, 1, 204, 
+64, 192, 0, 221, 64, 0, 1, 74, 0, 0, 129, 95, 0, 0, 1, 31, 
+0, 128, 0, 3, 0, 0, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 
+76, 111, 97, 100, 70, 114, 111, 109, 83, 116, 114, 101, 97, 109, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 99, 108, 101, 97, 110, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 86, 2, 
+0, 0, 1, 0, 11, 116, 0, 0, 0, 70, 0, 64, 0, 93, 128, 128, 
+0, 91, 64, 0, 0, 23, 64, 0, 128, 67, 0, 0, 0, 95, 0, 0, 
+1, 27, 64, 0, 0, 23, 64, 2, 128, 70, 64, 64, 0, 129, 128, 0, 
+0, 193, 192, 0, 0, 3, 1, 0, 0, 93, 128, 0, 2, 0, 0, 128, 
+0, 27, 64, 0, 0, 23, 64, 0, 128, 67, 0, 0, 0, 95, 0, 0, 
+1, 70, 0, 65, 0, 129, 64, 1, 0, 93, 64, 0, 1, 69, 0, 128, 
+0, 128, 0, 0, 0, 93, 192, 0, 1, 91, 64, 0, 0, 23, 128, 2, 
+128, 155, 64, 0, 0, 23, 0, 0, 128, 129, 128, 1, 0, 198, 192, 65, 
+0, 1, 1, 2, 0, 64, 1, 0, 1, 221, 64, 128, 1, 198, 64, 66, 
+0, 221, 64, 128, 0, 195, 0, 0, 0, 223, 0, 0, 1, 199, 128, 194, 
+0, 219, 64, 0, 0, 23, 0, 0, 128, 193, 192, 2, 0, 6, 1, 67, 
+0, 25, 192, 0, 2, 23, 64, 2, 128, 6, 193, 65, 0, 65, 65, 3, 
+0, 129, 129, 3, 0, 193, 193, 3, 0, 150, 193, 1, 3, 29, 65, 128, 
+1, 6, 65, 66, 0, 29, 65, 128, 0, 3, 1, 0, 0, 31, 1, 0, 
+1, 8, 64, 0, 136, 7, 129, 196, 0, 8, 0, 129, 136, 6, 1, 67, 
+0, 25, 0, 129, 1, 23, 128, 5, 128, 6, 193, 68, 0, 64, 1, 128, 
+1, 29, 65, 0, 1, 6, 1, 69, 0, 70, 65, 69, 0, 71, 129, 197, 
+2, 128, 1, 128, 1, 198, 1, 67, 0, 29, 65, 0, 2, 6, 1, 69, 
+0, 70, 65, 69, 0, 71, 193, 197, 2, 29, 65, 0, 1, 6, 1, 68, 
+0, 70, 1, 67, 0, 10, 65, 1, 133, 6, 1, 68, 0, 70, 65, 70, 
+0, 93, 129, 128, 0, 10, 65, 1, 140, 6, 1, 68, 0, 12, 129, 70, 
+2, 29, 65, 0, 1, 6, 193, 70, 0, 29, 65, 128, 0, 6, 1, 69, 
+0, 70, 65, 69, 0, 71, 1, 199, 2, 29, 65, 0, 1, 6, 65, 71, 
+0, 29, 65, 128, 0, 6, 129, 71, 0, 70, 1, 68, 0, 71, 193, 199, 
+2, 29, 65, 0, 1, 6, 1, 72, 0, 70, 1, 68, 0, 71, 65, 200, 
+2, 29, 65, 0, 1, 6, 65, 66, 0, 29, 65, 128, 0, 6, 1, 67, 
+0, 25, 0, 129, 1, 23, 0, 2, 128, 6, 193, 65, 0, 65, 129, 8, 
+0, 129, 193, 8, 0, 193, 1, 9, 0, 1, 66, 9, 0, 65, 130, 9, 
+0, 129, 194, 9, 0, 150, 129, 2, 3, 29, 65, 128, 1, 3, 1, 128, 
+0, 31, 1, 0, 1, 31, 0, 128, 0, 40, 0, 0, 0, 4, 23, 0, 
+0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 105, 114, 109, 68, 111, 99, 
+117, 109, 101, 110, 116, 69, 114, 97, 115, 117, 114, 101, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 
+114, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 32, 
+68, 111, 99, 117, 109, 101, 110, 116, 32, 83, 101, 116, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 32, 102, 105, 108, 101, 58, 
+0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 109, 101, 100, 105, 
+97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 76, 111, 97, 100, 105, 110, 103, 46, 46, 46, 0, 4, 
+64, 0, 0, 0, 0, 0, 0, 0, 84, 104, 101, 32, 108, 111, 97, 100, 
+32, 102, 97, 105, 108, 101, 100, 44, 32, 112, 114, 111, 98, 97, 98, 108, 
+121, 32, 98, 101, 99, 97, 117, 115, 101, 32, 116, 104, 101, 32, 102, 105, 
+108, 101, 32, 99, 111, 117, 108, 100, 32, 110, 111, 116, 32, 98, 101, 32, 
+111, 112, 101, 110, 101, 100, 46, 0, 4, 13, 0, 0, 0, 0, 0, 0, 
+0, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 12, 
+0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 32, 102, 97, 105, 108, 
+101, 100, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 
+101, 82, 101, 100, 114, 97, 119, 0, 4, 11, 0, 0, 0, 0, 0, 0, 
+0, 102, 105, 108, 101, 102, 111, 114, 109, 97, 116, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 11, 0, 0, 0, 0, 0, 0, 0, 70, 73, 
+76, 69, 70, 79, 82, 77, 65, 84, 0, 4, 21, 0, 0, 0, 0, 0, 
+0, 0, 67, 97, 110, 110, 111, 116, 32, 108, 111, 97, 100, 32, 100, 111, 
+99, 117, 109, 101, 110, 116, 0, 4, 45, 0, 0, 0, 0, 0, 0, 0, 
+84, 104, 105, 115, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 98, 101, 
+108, 111, 110, 103, 115, 32, 116, 111, 32, 97, 32, 110, 101, 119, 101, 114, 
+32, 118, 101, 114, 115, 105, 111, 110, 32, 111, 102, 32, 0, 4, 41, 0, 
+0, 0, 0, 0, 0, 0, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 
+114, 32, 97, 110, 100, 32, 99, 97, 110, 110, 111, 116, 32, 98, 101, 32, 
+108, 111, 97, 100, 101, 100, 46, 32, 83, 111, 114, 114, 121, 46, 0, 4, 
+12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 
+117, 114, 114, 101, 110, 116, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 
+85, 112, 103, 114, 97, 100, 101, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 70, 105, 114, 101, 69, 118, 101, 
+110, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 
+116, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 85, 112, 103, 114, 97, 100, 101, 0, 4, 15, 0, 0, 0, 
+0, 0, 0, 0, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 
+110, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 101, 110, 117, 
+0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 
+77, 101, 110, 117, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 
+117, 99, 104, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 115, 
+105, 122, 101, 83, 99, 114, 101, 101, 110, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 76, 111, 97, 100, 101, 
+100, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 82, 101, 115, 101, 116, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 83, 116, 121, 108, 101, 115, 0, 
+4, 27, 0, 0, 0, 0, 0, 0, 0, 82, 101, 98, 117, 105, 108, 100, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 83, 116, 121, 108, 101, 115, 77, 
+101, 110, 117, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 
+108, 101, 115, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 82, 101, 98, 
+117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 110, 116, 115, 77, 101, 110, 
+117, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 100, 111, 99, 117, 109, 
+101, 110, 116, 115, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 68, 111, 
+99, 117, 109, 101, 110, 116, 32, 117, 112, 103, 114, 97, 100, 101, 100, 0, 
+4, 55, 0, 0, 0, 0, 0, 0, 0, 89, 111, 117, 32, 97, 114, 101, 
+32, 116, 114, 121, 105, 110, 103, 32, 116, 111, 32, 111, 112, 101, 110, 32, 
+97, 32, 102, 105, 108, 101, 32, 98, 101, 108, 111, 110, 103, 105, 110, 103, 
+32, 116, 111, 32, 97, 110, 32, 101, 97, 114, 108, 105, 101, 114, 32, 0, 
+4, 58, 0, 0, 0, 0, 0, 0, 0, 118, 101, 114, 115, 105, 111, 110, 
+32, 111, 102, 32, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 46, 
+32, 84, 104, 97, 116, 39, 115, 32, 110, 111, 116, 32, 97, 32, 112, 114, 
+111, 98, 108, 101, 109, 44, 32, 98, 117, 116, 32, 105, 102, 32, 121, 111, 
+117, 32, 0, 4, 57, 0, 0, 0, 0, 0, 0, 0, 115, 97, 118, 101, 
+32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 97, 103, 97, 105, 110, 32, 
+105, 116, 32, 109, 97, 121, 32, 110, 111, 116, 32, 119, 111, 114, 107, 32, 
+111, 110, 32, 116, 104, 101, 32, 111, 108, 100, 32, 118, 101, 114, 115, 105, 
+111, 110, 46, 32, 0, 4, 59, 0, 0, 0, 0, 0, 0, 0, 65, 108, 
+115, 111, 44, 32, 97, 108, 108, 32, 107, 101, 121, 98, 105, 110, 100, 105, 
+110, 103, 115, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 110, 32, 116, 
+104, 105, 115, 32, 102, 105, 108, 101, 32, 119, 105, 108, 108, 32, 103, 101, 
+116, 32, 114, 101, 115, 101, 116, 32, 0, 4, 25, 0, 0, 0, 0, 0, 
+0, 0, 116, 111, 32, 116, 104, 101, 105, 114, 32, 100, 101, 102, 97, 117, 
+108, 116, 32, 118, 97, 108, 117, 101, 115, 46, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 0, 0, 1, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 2, 0, 0, 126, 
+2, 0, 0, 1, 0, 13, 34, 0, 0, 0, 70, 0, 64, 0, 134, 0, 
+64, 0, 135, 64, 64, 1, 155, 64, 0, 0, 23, 0, 0, 128, 139, 0, 
+0, 0, 74, 128, 128, 128, 25, 128, 64, 0, 23, 64, 4, 128, 70, 192, 
+64, 0, 134, 0, 64, 0, 93, 0, 1, 1, 23, 64, 2, 128, 129, 1, 
+1, 0, 198, 193, 64, 0, 0, 2, 128, 2, 221, 1, 1, 1, 23, 64, 
+0, 128, 21, 3, 128, 5, 141, 1, 3, 3, 226, 129, 0, 0, 99, 194, 
+254, 127, 74, 129, 129, 130, 98, 128, 0, 0, 227, 192, 252, 127, 70, 0, 
+64, 0, 74, 192, 65, 131, 25, 0, 66, 0, 23, 64, 0, 128, 70, 0, 
+64, 0, 74, 0, 194, 132, 25, 128, 66, 0, 23, 192, 255, 127, 31, 0, 
+128, 0, 11, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 97, 100, 100, 111, 110, 115, 0, 3, 0, 0, 0, 0, 
+0, 0, 0, 64, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 
+105, 114, 115, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 119, 111, 114, 100, 99, 111, 117, 110, 116, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 116, 97, 116, 117, 115, 98, 
+97, 114, 0, 1, 1, 3, 0, 0, 0, 0, 0, 0, 8, 64, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 105, 100, 108, 101, 116, 105, 109, 101, 0, 
+3, 0, 0, 0, 0, 0, 0, 24, 64, 0, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 
+};
+
+/* This is src/lua/export.lua */
+static const char file_16[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 18, 49, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 128, 192, 
+0, 134, 0, 64, 0, 135, 192, 64, 1, 198, 0, 64, 0, 199, 0, 193, 
+1, 6, 65, 65, 0, 7, 129, 65, 2, 70, 65, 65, 0, 71, 193, 193, 
+2, 134, 65, 65, 0, 135, 1, 66, 3, 198, 65, 65, 0, 199, 65, 194, 
+3, 6, 130, 66, 0, 7, 194, 66, 4, 70, 2, 64, 0, 71, 2, 195, 
+4, 134, 2, 64, 0, 135, 66, 67, 5, 193, 130, 3, 0, 6, 195, 67, 
+0, 75, 3, 0, 0, 139, 67, 0, 0, 138, 67, 68, 136, 29, 131, 128, 
+1, 65, 131, 4, 0, 129, 131, 4, 0, 229, 3, 0, 0, 37, 68, 0, 
+0, 8, 0, 132, 137, 37, 132, 0, 0, 8, 0, 4, 138, 37, 196, 0, 
+0, 8, 0, 132, 138, 11, 4, 0, 0, 101, 4, 1, 0, 8, 64, 4, 
+139, 101, 68, 1, 0, 8, 64, 132, 139, 101, 132, 1, 0, 8, 64, 4, 
+140, 101, 196, 1, 0, 8, 64, 132, 140, 101, 4, 2, 0, 8, 64, 4, 
+141, 31, 0, 128, 0, 27, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 119, 103, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 73, 84, 
+65, 76, 73, 67, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 85, 78, 
+68, 69, 82, 76, 73, 78, 69, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 66, 79, 76, 68, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 112, 
+97, 114, 115, 101, 119, 111, 114, 100, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 98, 105, 116, 51, 50, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 98, 97, 110, 100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 98, 
+111, 114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 120, 111, 114, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 98, 116, 101, 115, 116, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 111, 119, 101, 114, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 116, 105, 109, 101, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 98, 117, 102, 102, 
+101, 114, 0, 3, 0, 0, 0, 0, 0, 0, 240, 64, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 
+101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 95, 95, 109, 111, 100, 
+101, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 107, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 0, 4, 28, 0, 0, 0, 0, 0, 0, 0, 71, 
+101, 116, 69, 120, 112, 111, 114, 116, 70, 114, 97, 103, 109, 101, 110, 116, 
+67, 97, 99, 104, 101, 83, 116, 97, 116, 115, 0, 4, 33, 0, 0, 0, 
+0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 85, 115, 
+105, 110, 103, 77, 117, 108, 116, 105, 112, 108, 101, 67, 97, 108, 108, 98, 
+97, 99, 107, 115, 0, 4, 25, 0, 0, 0, 0, 0, 0, 0, 69, 120, 
+112, 111, 114, 116, 70, 105, 108, 101, 85, 115, 105, 110, 103, 67, 97, 108, 
+108, 98, 97, 99, 107, 115, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 
+79, 112, 101, 110, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 82, 101, 103, 105, 115, 116, 101, 114, 
+69, 120, 112, 111, 114, 116, 101, 114, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 71, 101, 116, 69, 120, 112, 111, 114, 116, 101, 114, 0, 4, 22, 
+0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 84, 111, 77, 
+117, 108, 116, 105, 112, 108, 101, 70, 105, 108, 101, 115, 0, 4, 17, 0, 
+0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 
+87, 105, 116, 104, 85, 73, 0, 9, 0, 0, 0, 30, 0, 0, 0, 46, 
+0, 0, 0, 3, 0, 9, 28, 0, 0, 0, 198, 0, 0, 0, 219, 64, 
+0, 0, 23, 128, 1, 128, 6, 1, 192, 0, 75, 1, 0, 0, 139, 65, 
+0, 0, 138, 129, 192, 128, 29, 129, 128, 1, 192, 0, 0, 2, 8, 192, 
+0, 0, 7, 65, 128, 1, 27, 1, 0, 0, 23, 192, 0, 128, 69, 1, 
+0, 1, 77, 193, 192, 2, 73, 1, 0, 1, 23, 0, 2, 128, 69, 1, 
+128, 1, 77, 193, 192, 2, 73, 1, 128, 1, 76, 1, 65, 0, 192, 1, 
+128, 0, 0, 2, 0, 1, 93, 129, 0, 2, 0, 1, 128, 2, 202, 0, 
+129, 0, 31, 1, 0, 1, 31, 0, 128, 0, 5, 0, 0, 0, 4, 13, 
+0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 
+98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 95, 95, 109, 
+111, 100, 101, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 107, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 114, 101, 110, 100, 101, 114, 119, 111, 114, 100, 115, 0, 0, 0, 0, 
+0, 4, 0, 0, 0, 1, 12, 0, 0, 1, 13, 1, 14, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 51, 0, 0, 0, 53, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 
+5, 0, 0, 0, 69, 0, 128, 0, 31, 0, 128, 1, 31, 0, 128, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 13, 1, 14, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 68, 0, 0, 0, 224, 0, 0, 0, 2, 0, 36, 163, 
+0, 0, 0, 139, 0, 0, 0, 203, 0, 0, 0, 6, 1, 64, 0, 64, 
+1, 128, 0, 29, 1, 1, 1, 23, 64, 2, 128, 71, 66, 64, 4, 91, 
+2, 0, 0, 23, 192, 0, 128, 85, 2, 0, 1, 77, 130, 192, 4, 138, 
+0, 130, 4, 23, 128, 0, 128, 85, 2, 128, 1, 77, 130, 192, 4, 202, 
+0, 130, 4, 34, 129, 0, 0, 163, 193, 252, 127, 37, 1, 0, 0, 101, 
+65, 0, 0, 139, 1, 0, 0, 198, 1, 64, 0, 11, 2, 0, 4, 65, 
+194, 0, 0, 129, 2, 1, 0, 193, 66, 1, 0, 1, 131, 1, 0, 65, 
+195, 1, 0, 129, 3, 2, 0, 193, 67, 2, 0, 1, 132, 2, 0, 36, 
+66, 0, 4, 221, 1, 1, 1, 23, 192, 0, 128, 0, 3, 128, 2, 64, 
+3, 128, 5, 29, 131, 0, 1, 138, 1, 131, 5, 226, 129, 0, 0, 99, 
+66, 254, 127, 192, 1, 0, 2, 1, 194, 2, 0, 221, 65, 0, 1, 195, 
+1, 0, 0, 3, 2, 0, 0, 68, 2, 0, 4, 165, 132, 0, 0, 198, 
+4, 64, 0, 0, 5, 0, 0, 221, 4, 1, 1, 23, 0, 25, 128, 7, 
+6, 195, 11, 71, 70, 67, 12, 88, 128, 195, 12, 23, 64, 0, 128, 24, 
+192, 195, 12, 23, 128, 1, 128, 219, 65, 0, 0, 23, 128, 2, 128, 128, 
+6, 0, 2, 193, 6, 4, 0, 157, 70, 0, 1, 195, 1, 128, 0, 23, 
+64, 1, 128, 219, 1, 0, 0, 23, 192, 0, 128, 128, 6, 0, 2, 193, 
+70, 4, 0, 157, 70, 0, 1, 195, 1, 0, 0, 88, 128, 196, 12, 23, 
+0, 0, 128, 3, 66, 0, 0, 3, 2, 128, 0, 128, 6, 0, 2, 193, 
+198, 4, 0, 0, 7, 128, 12, 157, 70, 128, 1, 149, 6, 128, 11, 24, 
+128, 64, 13, 23, 192, 1, 128, 135, 134, 192, 11, 149, 6, 0, 13, 24, 
+0, 69, 13, 23, 192, 0, 128, 128, 6, 0, 2, 193, 70, 5, 0, 157, 
+70, 0, 1, 23, 128, 14, 128, 129, 134, 0, 0, 213, 6, 0, 1, 1, 
+135, 0, 0, 161, 198, 1, 128, 135, 71, 7, 1, 199, 7, 65, 15, 5, 
+8, 128, 2, 71, 72, 64, 15, 128, 8, 128, 11, 192, 8, 0, 4, 29, 
+8, 0, 2, 221, 71, 0, 0, 160, 134, 253, 127, 149, 6, 128, 1, 25, 
+128, 6, 138, 23, 128, 10, 128, 195, 3, 128, 0, 3, 4, 0, 0, 3, 
+3, 0, 0, 67, 3, 0, 0, 131, 3, 0, 0, 134, 6, 64, 0, 192, 
+6, 128, 11, 157, 6, 1, 1, 23, 192, 4, 128, 219, 3, 0, 0, 23, 
+64, 0, 128, 195, 3, 0, 0, 23, 0, 0, 128, 3, 4, 128, 0, 67, 
+4, 128, 0, 67, 2, 0, 0, 131, 2, 0, 0, 195, 2, 0, 0, 197, 
+7, 0, 3, 0, 8, 0, 15, 65, 8, 5, 0, 128, 8, 0, 9, 221, 
+71, 0, 2, 91, 4, 0, 0, 23, 192, 0, 128, 192, 7, 0, 9, 1, 
+8, 5, 0, 65, 136, 5, 0, 221, 71, 128, 1, 162, 134, 0, 0, 35, 
+71, 250, 127, 91, 2, 0, 0, 23, 64, 0, 128, 135, 134, 65, 3, 157, 
+70, 128, 0, 155, 2, 0, 0, 23, 64, 0, 128, 135, 6, 66, 3, 157, 
+70, 128, 0, 219, 2, 0, 0, 23, 64, 0, 128, 135, 134, 66, 3, 157, 
+70, 128, 0, 128, 6, 0, 2, 193, 198, 5, 0, 0, 7, 128, 12, 157, 
+70, 128, 1, 226, 132, 0, 0, 99, 5, 230, 127, 219, 1, 0, 0, 23, 
+128, 0, 128, 192, 4, 0, 2, 1, 69, 4, 0, 221, 68, 0, 1, 192, 
+4, 0, 2, 1, 5, 6, 0, 221, 68, 0, 1, 31, 0, 128, 0, 25, 
+0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 
+114, 115, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 102, 111, 114, 109, 
+97, 116, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 116, 101, 120, 116, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 114, 97, 119, 116, 101, 120, 116, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 95, 111, 110, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 95, 111, 102, 
+102, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 117, 110, 100, 101, 114, 
+108, 105, 110, 101, 95, 111, 110, 0, 4, 14, 0, 0, 0, 0, 0, 0, 
+0, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 102, 102, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 95, 111, 110, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 95, 111, 102, 
+102, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 112, 114, 111, 108, 111, 
+103, 117, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 
+108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 76, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 76, 66, 0, 4, 11, 0, 0, 0, 0, 0, 0, 
+0, 108, 105, 115, 116, 95, 115, 116, 97, 114, 116, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 108, 105, 115, 116, 95, 101, 110, 100, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 82, 65, 87, 0, 4, 16, 0, 0, 0, 
+0, 0, 0, 0, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 115, 116, 
+97, 114, 116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 110, 111, 116, 101, 120, 116, 0, 4, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 
+112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 101, 112, 105, 108, 111, 103, 117, 101, 0, 
+3, 0, 0, 0, 79, 0, 0, 0, 83, 0, 0, 0, 1, 1, 7, 11, 
+0, 0, 0, 65, 0, 0, 0, 133, 0, 0, 0, 149, 0, 0, 1, 193, 
+0, 0, 0, 97, 192, 0, 128, 70, 1, 1, 0, 71, 1, 128, 2, 166, 
+1, 0, 0, 93, 65, 0, 0, 96, 128, 254, 127, 31, 0, 128, 0, 1, 
+0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 
+1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 94, 0, 
+0, 0, 1, 0, 2, 10, 0, 0, 0, 69, 0, 0, 0, 85, 0, 128, 
+0, 24, 0, 192, 0, 23, 128, 0, 128, 70, 0, 64, 0, 71, 0, 128, 
+0, 95, 0, 0, 1, 101, 0, 0, 0, 95, 0, 0, 1, 31, 0, 128, 
+0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 1, 0, 
+0, 0, 89, 0, 0, 0, 93, 0, 0, 0, 0, 1, 6, 12, 0, 0, 
+0, 1, 0, 0, 0, 69, 0, 0, 0, 85, 0, 128, 0, 129, 0, 0, 
+0, 33, 0, 1, 128, 6, 193, 0, 0, 69, 1, 128, 0, 7, 65, 1, 
+2, 102, 1, 0, 0, 29, 65, 0, 0, 32, 64, 254, 127, 31, 0, 128, 
+0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 
+0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 154, 0, 0, 0, 
+2, 0, 5, 90, 0, 0, 0, 133, 0, 128, 0, 192, 0, 0, 0, 5, 
+1, 0, 1, 157, 128, 128, 1, 137, 0, 0, 0, 133, 0, 128, 0, 192, 
+0, 0, 0, 5, 1, 0, 2, 157, 128, 128, 1, 137, 0, 128, 1, 133, 
+0, 128, 0, 192, 0, 0, 0, 5, 1, 0, 3, 157, 128, 128, 1, 137, 
+0, 128, 2, 132, 0, 0, 0, 197, 0, 128, 3, 219, 0, 0, 0, 23, 
+64, 0, 128, 134, 0, 64, 4, 23, 0, 0, 128, 134, 64, 64, 4, 197, 
+0, 0, 0, 219, 64, 0, 0, 23, 0, 1, 128, 197, 0, 128, 4, 219, 
+0, 0, 0, 23, 64, 0, 128, 198, 128, 64, 4, 221, 64, 128, 0, 197, 
+0, 128, 1, 219, 64, 0, 0, 23, 0, 1, 128, 197, 0, 0, 5, 219, 
+0, 0, 0, 23, 64, 0, 128, 198, 192, 64, 4, 221, 64, 128, 0, 197, 
+0, 128, 2, 219, 64, 0, 0, 23, 0, 1, 128, 197, 0, 128, 5, 219, 
+0, 0, 0, 23, 64, 0, 128, 198, 0, 65, 4, 221, 64, 128, 0, 197, 
+0, 0, 6, 219, 0, 0, 0, 23, 0, 1, 128, 192, 0, 0, 1, 1, 
+65, 1, 0, 221, 64, 0, 1, 195, 0, 0, 0, 201, 0, 0, 6, 197, 
+0, 128, 2, 219, 0, 0, 0, 23, 0, 1, 128, 197, 0, 128, 5, 219, 
+64, 0, 0, 23, 64, 0, 128, 198, 128, 65, 4, 221, 64, 128, 0, 197, 
+0, 128, 1, 219, 0, 0, 0, 23, 0, 1, 128, 197, 0, 0, 5, 219, 
+64, 0, 0, 23, 64, 0, 128, 198, 192, 65, 4, 221, 64, 128, 0, 197, 
+0, 0, 0, 219, 0, 0, 0, 23, 0, 1, 128, 197, 0, 128, 4, 219, 
+64, 0, 0, 23, 64, 0, 128, 198, 0, 66, 4, 221, 64, 128, 0, 192, 
+0, 0, 1, 0, 1, 128, 0, 221, 64, 0, 1, 195, 0, 0, 0, 201, 
+0, 128, 6, 197, 0, 0, 0, 201, 0, 128, 4, 197, 0, 128, 1, 201, 
+0, 0, 5, 197, 0, 128, 2, 201, 0, 128, 5, 31, 0, 128, 0, 9, 
+0, 0, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 114, 97, 119, 116, 
+101, 120, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 101, 120, 
+116, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 
+99, 95, 111, 102, 102, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 117, 
+110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 102, 102, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 95, 111, 102, 102, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 98, 111, 108, 100, 95, 111, 110, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 110, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 
+95, 111, 110, 0, 0, 0, 0, 0, 14, 0, 0, 0, 1, 9, 0, 1, 
+0, 2, 1, 10, 0, 3, 1, 11, 0, 4, 1, 8, 1, 6, 1, 12, 
+1, 13, 1, 14, 1, 16, 1, 17, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 
+0, 0, 1, 7, 1, 0, 1, 1, 1, 2, 1, 15, 1, 3, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 229, 0, 0, 0, 231, 0, 0, 0, 2, 0, 6, 8, 0, 0, 
+0, 134, 0, 64, 0, 192, 0, 0, 0, 11, 1, 128, 0, 64, 1, 128, 
+0, 36, 65, 128, 0, 158, 0, 128, 1, 159, 0, 0, 0, 31, 0, 128, 
+0, 1, 0, 0, 0, 4, 33, 0, 0, 0, 0, 0, 0, 0, 69, 120, 
+112, 111, 114, 116, 70, 105, 108, 101, 85, 115, 105, 110, 103, 77, 117, 108, 
+116, 105, 112, 108, 101, 67, 97, 108, 108, 98, 97, 99, 107, 115, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 245, 0, 0, 
+0, 24, 1, 0, 0, 1, 0, 11, 21, 0, 0, 0, 70, 0, 64, 0, 
+71, 64, 192, 0, 128, 0, 0, 0, 193, 128, 0, 0, 93, 192, 128, 1, 
+91, 64, 0, 0, 23, 128, 0, 128, 196, 0, 0, 0, 0, 1, 0, 1, 
+223, 0, 128, 1, 197, 0, 128, 0, 221, 128, 128, 0, 7, 193, 192, 1, 
+71, 1, 193, 1, 132, 1, 0, 0, 229, 1, 0, 0, 37, 66, 0, 0, 
+64, 2, 128, 3, 128, 2, 0, 4, 95, 2, 128, 1, 31, 0, 128, 0, 
+5, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 105, 111, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 111, 112, 101, 110, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 119, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 97, 112, 112, 101, 110, 100, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 102, 108, 117, 115, 104, 116, 111, 0, 2, 0, 0, 0, 255, 0, 
+0, 0, 9, 1, 0, 0, 0, 1, 3, 19, 0, 0, 0, 5, 0, 0, 
+0, 27, 0, 0, 0, 23, 0, 0, 128, 31, 0, 128, 0, 5, 0, 128, 
+0, 69, 0, 0, 1, 166, 0, 0, 0, 29, 128, 0, 0, 69, 0, 128, 
+1, 25, 0, 128, 0, 23, 128, 1, 128, 5, 0, 0, 2, 69, 0, 0, 
+1, 133, 0, 128, 2, 29, 192, 128, 1, 27, 64, 0, 0, 23, 0, 0, 
+128, 73, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 6, 0, 0, 0, 1, 6, 1, 4, 1, 3, 0, 2, 1, 5, 1, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 11, 1, 0, 0, 21, 1, 0, 0, 0, 0, 6, 
+25, 0, 0, 0, 4, 0, 0, 0, 69, 0, 0, 0, 133, 0, 0, 0, 
+155, 64, 0, 0, 23, 64, 1, 128, 133, 0, 128, 0, 197, 0, 0, 1, 
+5, 1, 128, 1, 157, 192, 128, 1, 64, 0, 128, 1, 0, 0, 0, 1, 
+133, 0, 128, 1, 140, 0, 64, 1, 157, 192, 0, 1, 27, 0, 0, 0, 
+23, 0, 1, 128, 155, 64, 0, 0, 23, 128, 0, 128, 4, 1, 0, 0, 
+64, 0, 128, 1, 0, 0, 0, 2, 0, 1, 0, 0, 64, 1, 128, 0, 
+31, 1, 128, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 99, 108, 111, 115, 101, 0, 0, 0, 0, 0, 4, 
+0, 0, 0, 1, 6, 1, 5, 1, 3, 1, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+0, 0, 0, 0, 0, 1, 10, 1, 11, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 1, 0, 
+0, 31, 1, 0, 0, 3, 0, 5, 8, 0, 0, 0, 203, 128, 0, 0, 
+202, 64, 0, 128, 28, 65, 0, 1, 23, 0, 0, 128, 6, 129, 192, 0, 
+202, 0, 129, 128, 8, 192, 0, 0, 31, 0, 128, 0, 3, 0, 0, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 99, 97, 108, 108, 98, 97, 99, 
+107, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 111, 112, 101, 110, 0, 
+4, 15, 0, 0, 0, 0, 0, 0, 0, 79, 112, 101, 110, 69, 120, 112, 
+111, 114, 116, 70, 105, 108, 101, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 33, 1, 0, 0, 35, 1, 0, 0, 
+1, 0, 2, 3, 0, 0, 0, 70, 0, 0, 0, 95, 0, 0, 1, 31, 
+0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 
+16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 41, 1, 0, 0, 75, 1, 0, 0, 2, 0, 20, 
+62, 0, 0, 0, 139, 0, 0, 0, 203, 0, 0, 0, 37, 1, 0, 0, 
+70, 1, 64, 0, 128, 1, 128, 0, 93, 1, 1, 1, 23, 0, 11, 128, 
+133, 2, 128, 0, 204, 66, 192, 4, 65, 131, 0, 0, 221, 130, 128, 1, 
+219, 66, 0, 0, 23, 0, 0, 128, 193, 194, 0, 0, 157, 130, 0, 1, 
+198, 130, 2, 1, 219, 66, 0, 0, 23, 192, 1, 128, 0, 3, 0, 2, 
+29, 67, 128, 0, 4, 3, 0, 0, 65, 3, 1, 0, 128, 3, 128, 4, 
+193, 67, 1, 0, 86, 195, 131, 6, 31, 3, 128, 1, 7, 131, 193, 5, 
+64, 3, 128, 4, 29, 195, 0, 1, 27, 67, 0, 0, 23, 128, 2, 128, 
+128, 3, 0, 2, 157, 67, 128, 0, 132, 3, 0, 0, 193, 195, 1, 0, 
+0, 4, 128, 4, 65, 4, 2, 0, 134, 68, 66, 0, 192, 4, 128, 6, 
+157, 132, 0, 1, 214, 131, 132, 7, 159, 3, 128, 1, 149, 3, 0, 1, 
+141, 131, 66, 7, 138, 64, 3, 7, 149, 3, 128, 1, 141, 131, 66, 7, 
+199, 195, 194, 5, 0, 4, 0, 6, 64, 4, 0, 0, 221, 131, 128, 1, 
+202, 192, 3, 7, 98, 129, 0, 0, 227, 1, 244, 127, 70, 1, 67, 0, 
+128, 1, 0, 0, 192, 1, 128, 1, 93, 65, 128, 1, 64, 1, 0, 2, 
+94, 1, 128, 0, 95, 1, 0, 0, 31, 0, 128, 0, 13, 0, 0, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 109, 97, 116, 99, 104, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 37, 46, 40, 37, 119, 42, 41, 36, 
+0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 27, 0, 0, 0, 
+0, 0, 0, 0, 100, 111, 110, 39, 116, 32, 107, 110, 111, 119, 32, 104, 
+111, 119, 32, 116, 111, 32, 101, 120, 112, 111, 114, 116, 32, 39, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 39, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 111, 112, 101, 110, 0, 4, 32, 0, 0, 0, 0, 0, 0, 
+0, 117, 110, 97, 98, 108, 101, 32, 116, 111, 32, 111, 112, 101, 110, 32, 
+116, 104, 101, 32, 111, 117, 116, 112, 117, 116, 32, 102, 105, 108, 101, 32, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 58, 32, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 116, 111, 115, 116, 114, 105, 110, 103, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 99, 97, 108, 108, 98, 97, 99, 107, 0, 4, 33, 0, 0, 0, 0, 
+0, 0, 0, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 85, 115, 105, 
+110, 103, 77, 117, 108, 116, 105, 112, 108, 101, 67, 97, 108, 108, 98, 97, 
+99, 107, 115, 0, 1, 0, 0, 0, 44, 1, 0, 0, 53, 1, 0, 0, 
+0, 0, 9, 21, 0, 0, 0, 3, 0, 128, 0, 68, 0, 0, 0, 129, 
+0, 0, 0, 197, 0, 0, 0, 213, 0, 128, 1, 1, 1, 0, 0, 161, 
+0, 2, 128, 134, 65, 1, 0, 157, 193, 128, 0, 155, 65, 0, 0, 23, 
+0, 1, 128, 27, 0, 0, 0, 23, 128, 0, 128, 4, 2, 0, 0, 64, 
+0, 128, 3, 0, 0, 0, 4, 160, 64, 253, 127, 128, 0, 0, 0, 192, 
+0, 128, 0, 159, 0, 128, 1, 31, 0, 128, 0, 1, 0, 0, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 8, 1, 16, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 81, 1, 0, 0, 126, 1, 0, 0, 4, 0, 16, 97, 
+0, 0, 0, 27, 64, 0, 0, 23, 128, 9, 128, 6, 1, 64, 0, 7, 
+64, 64, 2, 27, 0, 0, 0, 23, 128, 3, 128, 12, 129, 64, 0, 129, 
+193, 0, 0, 29, 129, 128, 1, 27, 65, 0, 0, 23, 192, 0, 128, 0, 
+1, 0, 0, 64, 1, 0, 1, 22, 64, 1, 2, 23, 128, 1, 128, 12, 
+1, 65, 0, 129, 193, 0, 0, 192, 1, 0, 1, 29, 129, 0, 2, 0, 
+0, 0, 2, 23, 0, 0, 128, 1, 64, 1, 0, 6, 129, 65, 0, 64, 
+1, 128, 0, 129, 193, 1, 0, 195, 1, 128, 0, 0, 2, 0, 0, 29, 
+129, 128, 2, 0, 0, 0, 2, 27, 64, 0, 0, 23, 64, 0, 128, 3, 
+1, 0, 0, 31, 1, 0, 1, 12, 129, 64, 0, 129, 1, 2, 0, 29, 
+129, 128, 1, 27, 1, 0, 0, 23, 128, 0, 128, 0, 1, 0, 0, 64, 
+1, 0, 1, 22, 64, 1, 2, 6, 65, 66, 0, 65, 129, 2, 0, 29, 
+65, 0, 1, 6, 193, 66, 0, 64, 1, 0, 0, 29, 193, 0, 1, 27, 
+65, 0, 0, 23, 128, 2, 128, 134, 1, 67, 0, 196, 1, 0, 0, 1, 
+66, 3, 0, 64, 2, 128, 2, 129, 130, 3, 0, 22, 130, 2, 4, 157, 
+65, 128, 1, 134, 193, 67, 0, 157, 65, 128, 0, 131, 1, 0, 0, 159, 
+1, 0, 1, 128, 1, 128, 1, 192, 1, 0, 2, 6, 2, 64, 0, 157, 
+129, 128, 1, 198, 1, 68, 0, 0, 2, 0, 3, 221, 129, 0, 1, 24, 
+64, 196, 3, 23, 192, 0, 128, 198, 129, 68, 0, 6, 2, 64, 0, 64, 
+2, 0, 3, 221, 65, 128, 1, 192, 1, 128, 2, 221, 193, 128, 0, 219, 
+65, 0, 0, 23, 128, 3, 128, 70, 2, 67, 0, 132, 2, 0, 0, 193, 
+194, 4, 0, 0, 3, 0, 0, 65, 3, 5, 0, 134, 67, 69, 0, 192, 
+3, 0, 4, 157, 131, 0, 1, 193, 131, 3, 0, 214, 194, 131, 5, 93, 
+66, 128, 1, 70, 194, 67, 0, 93, 66, 128, 0, 67, 2, 0, 0, 95, 
+2, 0, 1, 70, 194, 67, 0, 93, 66, 128, 0, 67, 2, 128, 0, 95, 
+2, 0, 1, 31, 0, 128, 0, 22, 0, 0, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 37, 46, 46, 45, 36, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 103, 115, 117, 98, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 40, 
+117, 110, 110, 97, 109, 101, 100, 41, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 32, 97, 115, 
+58, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 47, 91, 94, 46, 93, 
+42, 36, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 109, 101, 
+100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 105, 110, 103, 46, 
+46, 46, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 79, 112, 101, 110, 
+69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 
+0, 4, 32, 0, 0, 0, 0, 0, 0, 0, 85, 110, 97, 98, 108, 101, 
+32, 116, 111, 32, 111, 112, 101, 110, 32, 116, 104, 101, 32, 111, 117, 116, 
+112, 117, 116, 32, 102, 105, 108, 101, 32, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 46, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 
+101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 116, 121, 112, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 116, 97, 98, 108, 101, 0, 4, 25, 0, 0, 0, 0, 0, 0, 0, 
+69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 85, 115, 105, 110, 103, 67, 
+97, 108, 108, 98, 97, 99, 107, 115, 0, 4, 33, 0, 0, 0, 0, 0, 
+0, 0, 85, 110, 97, 98, 108, 101, 32, 116, 111, 32, 119, 114, 105, 116, 
+101, 32, 116, 104, 101, 32, 111, 117, 116, 112, 117, 116, 32, 102, 105, 108, 
+101, 32, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 58, 32, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 115, 116, 114, 105, 110, 103, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/export/text.lua */
+static const char file_17[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 13, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 75, 0, 0, 0, 29, 128, 0, 
+1, 101, 0, 0, 0, 134, 128, 64, 0, 229, 64, 0, 0, 138, 192, 128, 
+129, 134, 0, 65, 0, 193, 64, 1, 0, 0, 1, 128, 0, 157, 64, 128, 
+1, 31, 0, 128, 0, 6, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 119, 103, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 99, 114, 
+101, 97, 116, 101, 101, 120, 112, 111, 114, 116, 102, 111, 114, 109, 97, 116, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 84, 101, 120, 
+116, 70, 105, 108, 101, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 82, 
+101, 103, 105, 115, 116, 101, 114, 69, 120, 112, 111, 114, 116, 101, 114, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 116, 120, 116, 0, 2, 0, 0, 
+0, 7, 0, 0, 0, 37, 0, 0, 0, 2, 0, 4, 21, 0, 0, 0, 
+139, 64, 2, 0, 229, 0, 0, 0, 138, 192, 0, 128, 197, 0, 0, 0, 
+138, 192, 128, 128, 229, 64, 0, 0, 138, 192, 0, 129, 229, 128, 0, 0, 
+138, 192, 128, 129, 229, 192, 0, 0, 138, 192, 0, 130, 229, 0, 1, 0, 
+138, 192, 128, 130, 229, 64, 1, 0, 138, 192, 0, 131, 229, 128, 1, 0, 
+138, 192, 128, 131, 229, 192, 1, 0, 138, 192, 0, 132, 159, 0, 0, 1, 
+31, 0, 128, 0, 9, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 112, 114, 111, 108, 111, 103, 117, 101, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 102, 111, 114, 109, 97, 116, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 114, 97, 119, 116, 101, 120, 116, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 110, 111, 116, 101, 120, 116, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 108, 105, 115, 116, 95, 115, 116, 97, 114, 116, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 108, 105, 115, 116, 95, 101, 110, 100, 
+0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 97, 103, 114, 
+97, 112, 104, 95, 115, 116, 97, 114, 116, 0, 4, 14, 0, 0, 0, 0, 
+0, 0, 0, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 101, 112, 105, 108, 111, 103, 
+117, 101, 0, 8, 0, 0, 0, 9, 0, 0, 0, 10, 0, 0, 0, 0, 
+0, 2, 1, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 16, 0, 
+0, 0, 1, 0, 3, 4, 0, 0, 0, 69, 0, 0, 0, 128, 0, 0, 
+0, 93, 64, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 19, 
+0, 0, 0, 1, 0, 2, 1, 0, 0, 0, 31, 0, 128, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 
+0, 0, 22, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 31, 0, 128, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 24, 0, 0, 0, 25, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 
+31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 27, 0, 0, 0, 28, 0, 0, 0, 1, 0, 2, 1, 
+0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 32, 0, 0, 0, 1, 
+0, 3, 4, 0, 0, 0, 69, 0, 0, 0, 129, 0, 0, 0, 93, 64, 
+0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 10, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 34, 0, 0, 0, 35, 0, 0, 0, 0, 0, 2, 1, 0, 
+0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+39, 0, 0, 0, 42, 0, 0, 0, 1, 0, 6, 8, 0, 0, 0, 70, 
+0, 64, 0, 128, 0, 0, 0, 193, 64, 0, 0, 1, 129, 0, 0, 69, 
+1, 128, 0, 94, 0, 128, 2, 95, 0, 0, 0, 31, 0, 128, 0, 3, 
+0, 0, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 
+114, 116, 70, 105, 108, 101, 87, 105, 116, 104, 85, 73, 0, 4, 17, 0, 
+0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 32, 84, 101, 120, 
+116, 32, 70, 105, 108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+46, 116, 120, 116, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/export/html.lua */
+static const char file_18[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 12, 95, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 139, 192, 0, 0, 138, 64, 65, 130, 138, 192, 65, 131, 138, 64, 66, 
+132, 203, 192, 2, 0, 11, 1, 1, 0, 10, 1, 195, 133, 10, 1, 195, 
+134, 10, 193, 67, 135, 10, 65, 68, 136, 202, 0, 1, 133, 11, 1, 1, 
+0, 10, 1, 195, 133, 10, 1, 195, 134, 10, 193, 68, 135, 10, 1, 69, 
+136, 202, 0, 1, 137, 11, 1, 1, 0, 10, 1, 195, 133, 10, 1, 195, 
+134, 10, 129, 69, 135, 10, 193, 69, 136, 202, 0, 129, 138, 11, 1, 1, 
+0, 10, 1, 195, 133, 10, 1, 195, 134, 10, 65, 70, 135, 10, 129, 70, 
+136, 202, 0, 1, 140, 11, 1, 1, 0, 10, 1, 195, 133, 10, 1, 195, 
+134, 10, 1, 71, 135, 10, 65, 71, 136, 202, 0, 129, 141, 11, 1, 1, 
+0, 10, 1, 195, 133, 10, 193, 199, 134, 10, 1, 72, 135, 10, 65, 72, 
+136, 202, 0, 1, 143, 11, 1, 1, 0, 10, 1, 195, 133, 10, 193, 199, 
+134, 10, 193, 72, 135, 10, 65, 72, 136, 202, 0, 1, 145, 11, 1, 1, 
+0, 10, 1, 195, 133, 10, 1, 195, 134, 10, 65, 73, 135, 10, 129, 73, 
+136, 202, 0, 1, 146, 11, 1, 1, 0, 10, 1, 195, 133, 10, 1, 195, 
+134, 10, 65, 73, 135, 10, 129, 73, 136, 202, 0, 129, 147, 11, 1, 1, 
+0, 10, 1, 195, 133, 10, 1, 195, 134, 10, 65, 74, 135, 10, 65, 74, 
+136, 202, 0, 1, 148, 11, 1, 1, 0, 10, 193, 199, 133, 10, 1, 195, 
+134, 10, 193, 74, 135, 10, 1, 75, 136, 202, 0, 1, 149, 4, 1, 128, 
+0, 165, 1, 0, 0, 229, 65, 0, 0, 6, 66, 75, 0, 101, 130, 0, 
+0, 10, 66, 2, 151, 6, 194, 75, 0, 65, 2, 12, 0, 128, 2, 128, 
+3, 29, 66, 128, 1, 37, 194, 0, 0, 70, 66, 76, 0, 134, 130, 76, 
+0, 135, 194, 76, 5, 192, 2, 0, 4, 93, 66, 128, 1, 6, 66, 75, 
+0, 101, 2, 1, 0, 10, 66, 2, 154, 31, 0, 128, 0, 53, 0, 0, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 19, 0, 
+0, 0, 0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 101, 120, 112, 111, 
+114, 116, 102, 111, 114, 109, 97, 116, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 99, 111, 110, 99, 97, 116, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 38, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 38, 97, 109, 112, 
+59, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 60, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 38, 108, 116, 59, 0, 4, 2, 0, 0, 0, 
+0, 0, 0, 0, 62, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 
+103, 116, 59, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 49, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 112, 114, 101, 0, 1, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 108, 105, 115, 116, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 111, 110, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 60, 104, 49, 62, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+111, 102, 102, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 60, 47, 104, 
+49, 62, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 50, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 60, 104, 50, 62, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 60, 47, 104, 50, 62, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 72, 51, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 60, 104, 51, 62, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 60, 
+47, 104, 51, 62, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 52, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 60, 104, 52, 62, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 60, 47, 104, 52, 62, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 60, 112, 62, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 60, 
+47, 112, 62, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 76, 0, 1, 
+1, 4, 36, 0, 0, 0, 0, 0, 0, 0, 60, 108, 105, 32, 115, 116, 
+121, 108, 101, 61, 34, 108, 105, 115, 116, 45, 115, 116, 121, 108, 101, 45, 
+116, 121, 112, 101, 58, 32, 110, 111, 110, 101, 59, 34, 62, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 60, 47, 108, 105, 62, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 76, 66, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 60, 108, 105, 62, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+81, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 60, 98, 108, 111, 99, 
+107, 113, 117, 111, 116, 101, 62, 0, 4, 14, 0, 0, 0, 0, 0, 0, 
+0, 60, 47, 98, 108, 111, 99, 107, 113, 117, 111, 116, 101, 62, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 86, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 82, 65, 87, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 80, 82, 69, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 60, 112, 114, 101, 62, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 60, 47, 112, 114, 101, 62, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 69, 120, 112, 111, 114, 116, 72, 84, 77, 76, 70, 105, 108, 
+101, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 82, 101, 103, 105, 115, 
+116, 101, 114, 69, 120, 112, 111, 114, 116, 101, 114, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 104, 116, 109, 108, 0, 4, 17, 0, 0, 0, 0, 
+0, 0, 0, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 
+110, 101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 
+110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 82, 101, 103, 105, 
+115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 0, 4, 20, 0, 0, 0, 
+0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 72, 84, 77, 
+76, 69, 120, 112, 111, 114, 116, 0, 5, 0, 0, 0, 49, 0, 0, 0, 
+66, 0, 0, 0, 1, 0, 9, 36, 0, 0, 0, 69, 0, 0, 0, 139, 
+0, 0, 3, 199, 0, 64, 0, 7, 65, 64, 0, 71, 129, 64, 0, 135, 
+193, 64, 0, 199, 1, 65, 0, 7, 66, 65, 0, 164, 64, 0, 3, 193, 
+128, 1, 0, 93, 128, 128, 1, 133, 0, 128, 0, 88, 128, 128, 0, 23, 
+128, 4, 128, 133, 0, 128, 1, 203, 192, 1, 0, 7, 1, 64, 0, 202, 
+0, 1, 128, 7, 65, 64, 0, 202, 0, 129, 128, 7, 129, 64, 0, 202, 
+0, 1, 129, 7, 193, 64, 0, 202, 0, 129, 129, 7, 1, 65, 0, 202, 
+0, 1, 130, 7, 65, 65, 0, 202, 0, 129, 130, 5, 1, 0, 2, 202, 
+0, 129, 131, 157, 128, 0, 1, 137, 0, 0, 1, 73, 0, 128, 0, 133, 
+0, 0, 1, 159, 0, 0, 1, 31, 0, 128, 0, 8, 0, 0, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 95, 111, 
+110, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 
+99, 95, 111, 102, 102, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 117, 
+110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 110, 0, 4, 14, 0, 0, 
+0, 0, 0, 0, 0, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 
+102, 102, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 
+95, 111, 110, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 
+100, 95, 111, 102, 102, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 101, 115, 99, 97, 112, 101, 
+115, 0, 0, 0, 0, 0, 5, 0, 0, 0, 1, 1, 1, 5, 1, 4, 
+1, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 146, 0, 0, 0, 
+2, 0, 9, 29, 0, 0, 0, 134, 0, 64, 0, 135, 64, 64, 1, 135, 
+128, 64, 1, 196, 0, 0, 0, 3, 1, 0, 0, 69, 1, 128, 0, 128, 
+1, 0, 1, 93, 129, 0, 1, 165, 1, 0, 0, 203, 65, 2, 0, 37, 
+66, 0, 0, 202, 1, 130, 129, 202, 65, 1, 130, 37, 130, 0, 0, 202, 
+1, 130, 130, 37, 194, 0, 0, 202, 1, 2, 131, 37, 2, 1, 0, 202, 
+1, 130, 131, 37, 66, 1, 0, 202, 1, 2, 132, 37, 130, 1, 0, 202, 
+1, 130, 132, 37, 194, 1, 0, 202, 1, 2, 133, 37, 2, 2, 0, 202, 
+1, 130, 133, 223, 1, 0, 1, 31, 0, 128, 0, 12, 0, 0, 0, 4, 
+12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 
+111, 110, 115, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 104, 116, 109, 
+108, 101, 120, 112, 111, 114, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 112, 114, 111, 108, 111, 103, 117, 101, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 102, 111, 114, 109, 97, 116, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 114, 97, 119, 116, 101, 120, 116, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 110, 111, 116, 101, 120, 116, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 108, 105, 115, 116, 95, 115, 116, 97, 114, 116, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 108, 105, 115, 116, 95, 101, 110, 100, 
+0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 97, 103, 114, 
+97, 112, 104, 95, 115, 116, 97, 114, 116, 0, 4, 14, 0, 0, 0, 0, 
+0, 0, 0, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 101, 112, 105, 108, 111, 103, 
+117, 101, 0, 9, 0, 0, 0, 74, 0, 0, 0, 104, 0, 0, 0, 1, 
+0, 5, 59, 0, 0, 0, 69, 0, 128, 0, 70, 64, 0, 0, 134, 0, 
+0, 0, 197, 0, 128, 0, 24, 192, 0, 0, 23, 192, 1, 128, 27, 0, 
+0, 0, 23, 64, 1, 128, 199, 0, 192, 0, 219, 0, 0, 0, 23, 128, 
+0, 128, 199, 0, 64, 1, 219, 64, 0, 0, 23, 0, 10, 128, 91, 0, 
+0, 0, 23, 128, 0, 128, 197, 0, 0, 1, 7, 65, 192, 0, 221, 64, 
+0, 1, 197, 0, 0, 1, 1, 129, 0, 0, 221, 64, 0, 1, 155, 0, 
+0, 0, 23, 128, 0, 128, 199, 192, 64, 1, 219, 64, 0, 0, 23, 192, 
+1, 128, 197, 0, 128, 1, 219, 0, 0, 0, 23, 0, 1, 128, 197, 0, 
+0, 1, 1, 1, 1, 0, 221, 64, 0, 1, 195, 0, 0, 0, 201, 0, 
+128, 1, 155, 0, 0, 0, 23, 128, 2, 128, 199, 192, 64, 1, 219, 0, 
+0, 0, 23, 192, 1, 128, 197, 0, 128, 1, 219, 64, 0, 0, 23, 0, 
+1, 128, 197, 0, 0, 1, 1, 65, 1, 0, 221, 64, 0, 1, 195, 0, 
+128, 0, 201, 0, 128, 1, 155, 0, 0, 0, 23, 128, 0, 128, 197, 0, 
+0, 1, 7, 129, 65, 1, 221, 64, 0, 1, 9, 0, 128, 0, 23, 128, 
+0, 128, 197, 0, 0, 1, 1, 129, 0, 0, 221, 64, 0, 1, 31, 0, 
+128, 0, 7, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 112, 
+114, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 111, 102, 102, 0, 
+4, 2, 0, 0, 0, 0, 0, 0, 0, 10, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 108, 105, 115, 116, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 60, 47, 117, 108, 62, 10, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 60, 117, 108, 62, 10, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 111, 110, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 2, 1, 3, 
+1, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 0, 0, 113, 0, 0, 0, 
+0, 0, 5, 24, 0, 0, 0, 5, 0, 0, 0, 65, 0, 0, 0, 29, 
+64, 0, 1, 5, 0, 0, 0, 65, 64, 0, 0, 29, 64, 0, 1, 5, 
+0, 0, 0, 65, 128, 0, 0, 134, 192, 192, 0, 193, 0, 1, 0, 86, 
+192, 128, 0, 29, 64, 0, 1, 5, 0, 0, 0, 65, 64, 1, 0, 133, 
+0, 0, 1, 140, 128, 65, 1, 6, 193, 193, 1, 157, 128, 128, 1, 193, 
+0, 2, 0, 29, 64, 0, 2, 5, 0, 0, 0, 65, 64, 2, 0, 29, 
+64, 0, 1, 31, 0, 128, 0, 10, 0, 0, 0, 4, 51, 0, 0, 0, 
+0, 0, 0, 0, 60, 104, 116, 109, 108, 32, 120, 109, 108, 110, 115, 61, 
+34, 104, 116, 116, 112, 58, 47, 47, 119, 119, 119, 46, 119, 51, 46, 111, 
+114, 103, 47, 49, 57, 57, 57, 47, 120, 104, 116, 109, 108, 34, 62, 60, 
+104, 101, 97, 100, 62, 10, 0, 4, 69, 0, 0, 0, 0, 0, 0, 0, 
+60, 109, 101, 116, 97, 32, 104, 116, 116, 112, 45, 101, 113, 117, 105, 118, 
+61, 34, 67, 111, 110, 116, 101, 110, 116, 45, 84, 121, 112, 101, 34, 32, 
+99, 111, 110, 116, 101, 110, 116, 61, 34, 116, 101, 120, 116, 47, 104, 116, 
+109, 108, 59, 99, 104, 97, 114, 115, 101, 116, 61, 117, 116, 102, 45, 56, 
+34, 47, 62, 10, 0, 4, 45, 0, 0, 0, 0, 0, 0, 0, 60, 109, 
+101, 116, 97, 32, 110, 97, 109, 101, 61, 34, 103, 101, 110, 101, 114, 97, 
+116, 111, 114, 34, 32, 99, 111, 110, 116, 101, 110, 116, 61, 34, 87, 111, 
+114, 100, 71, 114, 105, 110, 100, 101, 114, 32, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 86, 69, 82, 83, 73, 79, 78, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 34, 47, 62, 10, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 60, 116, 105, 116, 108, 101, 62, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 101, 115, 99, 97, 112, 101, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 60, 47, 116, 105, 116, 108, 101, 62, 10, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 60, 47, 104, 101, 97, 100, 62, 60, 98, 111, 100, 
+121, 62, 10, 0, 0, 0, 0, 0, 4, 0, 0, 0, 1, 0, 0, 0, 
+1, 5, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0, 0, 119, 0, 0, 0, 
+1, 0, 3, 4, 0, 0, 0, 69, 0, 0, 0, 128, 0, 0, 0, 93, 
+64, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 0, 0, 0, 125, 0, 0, 
+0, 1, 0, 3, 7, 0, 0, 0, 69, 0, 0, 0, 88, 0, 192, 0, 
+23, 128, 0, 128, 69, 0, 128, 0, 129, 64, 0, 0, 93, 64, 0, 1, 
+31, 0, 128, 0, 2, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 80, 82, 69, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 60, 98, 
+114, 47, 62, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 3, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 127, 0, 0, 0, 128, 0, 0, 0, 0, 0, 2, 1, 
+0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 130, 0, 0, 0, 131, 0, 0, 0, 0, 
+0, 2, 1, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 0, 0, 0, 135, 0, 
+0, 0, 1, 0, 3, 4, 0, 0, 0, 69, 0, 0, 0, 128, 0, 0, 
+0, 93, 64, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 0, 0, 0, 138, 
+0, 0, 0, 1, 0, 2, 1, 0, 0, 0, 31, 0, 128, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 140, 0, 
+0, 0, 144, 0, 0, 0, 0, 0, 2, 10, 0, 0, 0, 5, 0, 0, 
+0, 68, 0, 0, 0, 29, 64, 0, 1, 5, 0, 128, 0, 65, 0, 0, 
+0, 29, 64, 0, 1, 5, 0, 128, 0, 65, 64, 0, 0, 29, 64, 0, 
+1, 31, 0, 128, 0, 2, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 60, 47, 98, 111, 100, 121, 62, 10, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 60, 47, 104, 116, 109, 108, 62, 10, 0, 0, 0, 0, 
+0, 2, 0, 0, 0, 1, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 
+0, 0, 0, 1, 6, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 148, 0, 0, 0, 151, 
+0, 0, 0, 1, 0, 6, 8, 0, 0, 0, 70, 0, 64, 0, 128, 0, 
+0, 0, 193, 64, 0, 0, 1, 129, 0, 0, 69, 1, 128, 0, 94, 0, 
+128, 2, 95, 0, 0, 0, 31, 0, 128, 0, 3, 0, 0, 0, 4, 17, 
+0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 70, 105, 108, 
+101, 87, 105, 116, 104, 85, 73, 0, 4, 17, 0, 0, 0, 0, 0, 0, 
+0, 69, 120, 112, 111, 114, 116, 32, 72, 84, 77, 76, 32, 70, 105, 108, 
+101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 46, 104, 116, 109, 108, 
+0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 7, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 159, 0, 0, 0, 170, 0, 0, 0, 0, 0, 2, 27, 0, 0, 0, 
+6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 64, 192, 0, 
+71, 128, 192, 0, 91, 64, 0, 0, 23, 0, 1, 128, 75, 0, 1, 0, 
+74, 0, 193, 129, 74, 128, 193, 130, 74, 0, 194, 131, 74, 128, 194, 132, 
+10, 64, 0, 129, 6, 0, 64, 0, 7, 64, 64, 0, 7, 128, 64, 0, 
+71, 192, 66, 0, 91, 64, 0, 0, 23, 0, 0, 128, 65, 0, 3, 0, 
+10, 64, 128, 133, 71, 64, 67, 0, 91, 64, 0, 0, 23, 0, 0, 128, 
+65, 128, 3, 0, 10, 64, 128, 134, 31, 0, 128, 0, 15, 0, 0, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 100, 
+100, 111, 110, 115, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 104, 116, 
+109, 108, 101, 120, 112, 111, 114, 116, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 110, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 60, 117, 62, 0, 4, 14, 0, 0, 
+0, 0, 0, 0, 0, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 
+102, 102, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 60, 47, 117, 62, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 
+95, 111, 110, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 60, 105, 62, 
+0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 
+95, 111, 102, 102, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 60, 47, 
+105, 62, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 
+95, 111, 110, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 60, 98, 62, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 95, 111, 
+102, 102, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 60, 47, 98, 62, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 
+0, 0, 0, 44, 1, 0, 0, 0, 0, 21, 180, 0, 0, 0, 6, 0, 
+64, 0, 7, 64, 64, 0, 7, 128, 64, 0, 70, 192, 64, 0, 71, 0, 
+193, 0, 139, 64, 1, 0, 138, 128, 193, 130, 138, 0, 194, 131, 138, 128, 
+194, 132, 138, 0, 194, 133, 199, 64, 67, 0, 138, 192, 0, 134, 93, 128, 
+0, 1, 134, 192, 64, 0, 135, 0, 65, 1, 203, 64, 1, 0, 202, 128, 
+193, 130, 202, 128, 195, 131, 202, 128, 194, 132, 202, 128, 195, 133, 7, 193, 
+67, 0, 202, 0, 1, 134, 157, 128, 0, 1, 198, 192, 64, 0, 199, 0, 
+193, 1, 11, 65, 1, 0, 10, 129, 193, 130, 10, 1, 196, 131, 10, 129, 
+194, 132, 10, 1, 196, 133, 71, 65, 68, 0, 10, 65, 1, 134, 221, 128, 
+0, 1, 6, 193, 64, 0, 7, 1, 65, 2, 75, 65, 1, 0, 74, 129, 
+193, 130, 74, 129, 196, 131, 74, 129, 194, 132, 74, 129, 196, 133, 135, 193, 
+68, 0, 74, 129, 1, 134, 29, 129, 0, 1, 70, 193, 64, 0, 71, 1, 
+193, 2, 139, 65, 1, 0, 138, 129, 193, 130, 138, 1, 197, 131, 138, 129, 
+194, 132, 138, 1, 197, 133, 199, 65, 69, 0, 138, 193, 1, 134, 93, 129, 
+0, 1, 134, 193, 64, 0, 135, 1, 65, 3, 203, 65, 1, 0, 202, 129, 
+193, 130, 202, 129, 197, 131, 202, 129, 194, 132, 202, 129, 197, 133, 7, 194, 
+69, 0, 202, 1, 2, 134, 157, 129, 0, 1, 203, 193, 1, 6, 202, 65, 
+70, 140, 6, 194, 64, 0, 7, 194, 70, 4, 202, 1, 2, 141, 202, 65, 
+71, 142, 202, 193, 71, 143, 202, 65, 72, 144, 202, 193, 72, 145, 202, 193, 
+72, 146, 6, 194, 64, 0, 7, 66, 73, 4, 75, 130, 1, 0, 74, 2, 
+194, 130, 74, 2, 194, 131, 74, 130, 201, 132, 74, 2, 194, 133, 134, 194, 
+64, 0, 135, 2, 74, 5, 74, 130, 130, 147, 74, 66, 74, 134, 29, 130, 
+0, 1, 64, 2, 128, 0, 134, 194, 64, 0, 135, 66, 73, 5, 203, 130, 
+1, 0, 202, 2, 194, 130, 202, 130, 195, 131, 202, 130, 201, 132, 202, 130, 
+195, 133, 6, 195, 64, 0, 7, 3, 74, 6, 202, 2, 131, 147, 202, 130, 
+74, 134, 157, 130, 0, 1, 192, 2, 0, 1, 6, 195, 64, 0, 7, 67, 
+73, 6, 75, 131, 1, 0, 74, 3, 194, 130, 74, 3, 196, 131, 74, 131, 
+201, 132, 74, 3, 196, 133, 134, 195, 64, 0, 135, 3, 74, 7, 74, 131, 
+131, 147, 74, 195, 74, 134, 29, 131, 0, 1, 64, 3, 128, 1, 134, 195, 
+64, 0, 135, 67, 73, 7, 203, 131, 1, 0, 202, 3, 194, 130, 202, 131, 
+196, 131, 202, 131, 201, 132, 202, 131, 196, 133, 6, 196, 64, 0, 7, 4, 
+74, 8, 202, 3, 132, 147, 202, 3, 75, 134, 157, 131, 0, 1, 192, 3, 
+0, 2, 6, 196, 64, 0, 7, 68, 73, 8, 75, 132, 1, 0, 74, 4, 
+194, 130, 74, 4, 197, 131, 74, 132, 201, 132, 74, 4, 197, 133, 134, 196, 
+64, 0, 135, 4, 74, 9, 74, 132, 132, 147, 74, 68, 75, 134, 29, 132, 
+0, 1, 64, 4, 128, 2, 134, 196, 64, 0, 135, 68, 73, 9, 203, 132, 
+1, 0, 202, 4, 194, 130, 202, 132, 197, 131, 202, 132, 201, 132, 202, 132, 
+197, 133, 6, 197, 64, 0, 7, 5, 74, 10, 202, 4, 133, 147, 202, 132, 
+75, 134, 157, 132, 0, 1, 192, 4, 0, 3, 228, 65, 0, 6, 6, 194, 
+64, 0, 7, 194, 75, 4, 64, 2, 128, 3, 134, 2, 76, 0, 193, 66, 
+12, 0, 29, 130, 0, 2, 27, 66, 0, 0, 23, 64, 0, 128, 67, 2, 
+0, 0, 95, 2, 0, 1, 71, 2, 195, 0, 10, 64, 130, 134, 71, 2, 
+67, 1, 10, 64, 130, 135, 71, 2, 195, 1, 10, 64, 130, 136, 71, 2, 
+67, 2, 10, 64, 130, 137, 71, 2, 195, 2, 10, 64, 130, 138, 71, 2, 
+67, 3, 10, 64, 130, 139, 67, 2, 128, 0, 95, 2, 0, 1, 23, 128, 
+249, 127, 3, 2, 0, 0, 31, 2, 0, 1, 31, 0, 128, 0, 50, 0, 
+0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+97, 100, 100, 111, 110, 115, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 
+104, 116, 109, 108, 101, 120, 112, 111, 114, 116, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 84, 101, 120, 116, 70, 105, 101, 108, 100, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 48, 
+64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 
+50, 0, 3, 0, 0, 0, 0, 0, 0, 240, 191, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 121, 50, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+118, 97, 108, 117, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 117, 
+110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 110, 0, 3, 0, 0, 0, 
+0, 0, 0, 8, 64, 4, 14, 0, 0, 0, 0, 0, 0, 0, 117, 110, 
+100, 101, 114, 108, 105, 110, 101, 95, 111, 102, 102, 0, 3, 0, 0, 0, 
+0, 0, 0, 20, 64, 4, 10, 0, 0, 0, 0, 0, 0, 0, 105, 116, 
+97, 108, 105, 99, 95, 111, 110, 0, 3, 0, 0, 0, 0, 0, 0, 28, 
+64, 4, 11, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 
+95, 111, 102, 102, 0, 3, 0, 0, 0, 0, 0, 0, 34, 64, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 95, 111, 110, 0, 3, 
+0, 0, 0, 0, 0, 0, 38, 64, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 98, 111, 108, 100, 95, 111, 102, 102, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 116, 105, 116, 108, 101, 0, 4, 22, 0, 0, 0, 0, 0, 
+0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 32, 72, 84, 77, 76, 
+32, 69, 120, 112, 111, 114, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 119, 105, 100, 116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+76, 97, 114, 103, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 104, 
+101, 105, 103, 104, 116, 0, 3, 0, 0, 0, 0, 0, 0, 42, 64, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 101, 116, 99, 104, 121, 
+0, 1, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 
+94, 67, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 99, 
+101, 108, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 
+82, 69, 84, 85, 82, 78, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+99, 111, 110, 102, 105, 114, 109, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 75, 69, 89, 95, 69, 78, 84, 69, 82, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 76, 97, 98, 101, 108, 0, 3, 0, 0, 0, 0, 0, 
+0, 64, 64, 4, 6, 0, 0, 0, 0, 0, 0, 0, 97, 108, 105, 103, 
+110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 76, 101, 102, 116, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 85, 110, 100, 101, 114, 108, 105, 
+110, 101, 32, 111, 110, 58, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 
+85, 110, 100, 101, 114, 108, 105, 110, 101, 32, 111, 102, 102, 58, 0, 4, 
+12, 0, 0, 0, 0, 0, 0, 0, 73, 116, 97, 108, 105, 99, 115, 32, 
+111, 110, 58, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 73, 116, 97, 
+108, 105, 99, 115, 32, 111, 102, 102, 58, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 66, 111, 108, 100, 32, 111, 110, 58, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 66, 111, 108, 100, 32, 111, 102, 102, 58, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 
+110, 0, 4, 53, 0, 0, 0, 0, 0, 0, 0, 83, 80, 65, 67, 69, 
+32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 84, 85, 
+82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 
+84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/export/latex.lua */
+static const char file_19[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 8, 90, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 75, 0, 3, 0, 74, 192, 64, 
+129, 74, 64, 65, 130, 74, 192, 65, 131, 74, 64, 66, 132, 74, 192, 66, 
+133, 74, 64, 67, 134, 74, 192, 67, 135, 74, 64, 68, 136, 74, 192, 68, 
+137, 74, 64, 69, 138, 74, 192, 69, 139, 74, 64, 70, 140, 128, 0, 0, 
+0, 203, 192, 1, 0, 202, 192, 70, 141, 202, 128, 66, 142, 202, 128, 199, 
+142, 202, 128, 194, 143, 202, 64, 72, 144, 202, 128, 66, 145, 202, 64, 128, 
+145, 157, 128, 0, 1, 203, 192, 2, 0, 11, 1, 0, 1, 65, 65, 9, 
+0, 129, 129, 2, 0, 36, 65, 0, 1, 202, 0, 1, 146, 11, 1, 0, 
+1, 65, 193, 9, 0, 129, 129, 2, 0, 36, 65, 0, 1, 202, 0, 1, 
+147, 11, 1, 0, 1, 65, 65, 10, 0, 129, 129, 2, 0, 36, 65, 0, 
+1, 202, 0, 1, 148, 11, 1, 0, 1, 65, 193, 10, 0, 129, 129, 2, 
+0, 36, 65, 0, 1, 202, 0, 1, 149, 11, 1, 0, 1, 65, 65, 11, 
+0, 129, 129, 11, 0, 36, 65, 0, 1, 202, 0, 1, 150, 11, 1, 0, 
+1, 65, 1, 12, 0, 129, 129, 2, 0, 36, 65, 0, 1, 202, 0, 129, 
+151, 11, 1, 0, 1, 65, 129, 12, 0, 129, 129, 2, 0, 36, 65, 0, 
+1, 202, 0, 129, 152, 11, 1, 0, 1, 65, 1, 13, 0, 129, 65, 13, 
+0, 36, 65, 0, 1, 202, 0, 129, 153, 11, 1, 0, 1, 65, 1, 13, 
+0, 129, 65, 13, 0, 36, 65, 0, 1, 202, 0, 1, 155, 11, 1, 0, 
+1, 65, 65, 11, 0, 129, 65, 11, 0, 36, 65, 0, 1, 202, 0, 129, 
+155, 11, 1, 0, 1, 65, 65, 14, 0, 129, 129, 14, 0, 36, 65, 0, 
+1, 202, 0, 1, 156, 37, 1, 0, 0, 70, 193, 78, 0, 165, 65, 0, 
+0, 74, 129, 1, 158, 70, 65, 79, 0, 129, 129, 15, 0, 192, 1, 0, 
+2, 93, 65, 128, 1, 31, 0, 128, 0, 63, 0, 0, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 19, 0, 0, 0, 0, 0, 
+0, 0, 99, 114, 101, 97, 116, 101, 101, 120, 112, 111, 114, 116, 102, 111, 
+114, 109, 97, 116, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 35, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 92, 35, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 36, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+92, 36, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 38, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 92, 38, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 123, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 92, 123, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 125, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 92, 125, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 95, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 92, 95, 123, 125, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 94, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 92, 94, 123, 125, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 126, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 92, 126, 
+123, 125, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 37, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 92, 37, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 60, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 36, 92, 
+108, 97, 110, 103, 108, 101, 36, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 62, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 36, 92, 114, 97, 
+110, 103, 108, 101, 36, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 92, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 36, 92, 98, 97, 99, 107, 
+115, 108, 97, 115, 104, 36, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+105, 116, 97, 108, 105, 99, 95, 111, 110, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 92, 116, 101, 120, 116, 105, 116, 123, 0, 4, 11, 0, 0, 
+0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 95, 111, 102, 102, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 95, 111, 110, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 92, 116, 101, 120, 116, 98, 
+102, 123, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 
+95, 111, 102, 102, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 117, 110, 
+100, 101, 114, 108, 105, 110, 101, 95, 111, 110, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 92, 117, 110, 100, 101, 114, 108, 105, 110, 101, 123, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 117, 110, 100, 101, 114, 108, 105, 
+110, 101, 95, 111, 102, 102, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+101, 115, 99, 97, 112, 101, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 72, 49, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 92, 115, 101, 
+99, 116, 105, 111, 110, 123, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+72, 50, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 92, 115, 117, 98, 
+115, 101, 99, 116, 105, 111, 110, 123, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 72, 51, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 92, 115, 
+117, 98, 115, 117, 98, 115, 101, 99, 116, 105, 111, 110, 123, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 72, 52, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 92, 112, 97, 114, 97, 103, 114, 97, 112, 104, 123, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 10, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 76, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 92, 105, 116, 101, 109, 91, 93, 123, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 76, 66, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 92, 105, 116, 101, 109, 123, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 81, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 92, 98, 101, 103, 
+105, 110, 123, 113, 117, 111, 116, 97, 116, 105, 111, 110, 125, 10, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 10, 92, 101, 110, 100, 123, 113, 117, 
+111, 116, 97, 116, 105, 111, 110, 125, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 86, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 65, 87, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 80, 82, 69, 0, 4, 18, 
+0, 0, 0, 0, 0, 0, 0, 92, 98, 101, 103, 105, 110, 123, 118, 101, 
+114, 98, 97, 116, 105, 109, 125, 10, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 10, 92, 101, 110, 100, 123, 118, 101, 114, 98, 97, 116, 105, 109, 
+125, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 
+16, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 76, 97, 
+116, 101, 120, 70, 105, 108, 101, 0, 4, 17, 0, 0, 0, 0, 0, 0, 
+0, 82, 101, 103, 105, 115, 116, 101, 114, 69, 120, 112, 111, 114, 116, 101, 
+114, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 116, 101, 120, 0, 2, 
+0, 0, 0, 47, 0, 0, 0, 93, 0, 0, 0, 2, 0, 4, 21, 0, 
+0, 0, 139, 64, 2, 0, 229, 0, 0, 0, 138, 192, 0, 128, 197, 0, 
+128, 0, 138, 192, 128, 128, 229, 64, 0, 0, 138, 192, 0, 129, 229, 128, 
+0, 0, 138, 192, 128, 129, 229, 192, 0, 0, 138, 192, 0, 130, 229, 0, 
+1, 0, 138, 192, 128, 130, 229, 64, 1, 0, 138, 192, 0, 131, 229, 128, 
+1, 0, 138, 192, 128, 131, 229, 192, 1, 0, 138, 192, 0, 132, 159, 0, 
+0, 1, 31, 0, 128, 0, 9, 0, 0, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 112, 114, 111, 108, 111, 103, 117, 101, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 102, 111, 114, 109, 97, 116, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 114, 97, 119, 116, 101, 120, 116, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 110, 111, 116, 101, 120, 116, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 108, 105, 115, 116, 95, 115, 116, 97, 114, 116, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 108, 105, 115, 116, 95, 101, 
+110, 100, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 97, 
+103, 114, 97, 112, 104, 95, 115, 116, 97, 114, 116, 0, 4, 14, 0, 0, 
+0, 0, 0, 0, 0, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 
+110, 100, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 101, 112, 105, 108, 
+111, 103, 117, 101, 0, 8, 0, 0, 0, 49, 0, 0, 0, 60, 0, 0, 
+0, 0, 0, 5, 38, 0, 0, 0, 5, 0, 0, 0, 65, 0, 0, 0, 
+129, 64, 0, 0, 198, 128, 192, 0, 1, 193, 0, 0, 86, 0, 129, 0, 
+29, 64, 0, 1, 5, 0, 0, 0, 65, 0, 1, 0, 29, 64, 0, 1, 
+5, 0, 0, 0, 65, 64, 1, 0, 29, 64, 0, 1, 5, 0, 0, 0, 
+65, 128, 1, 0, 29, 64, 0, 1, 5, 0, 0, 0, 65, 192, 1, 0, 
+29, 64, 0, 1, 5, 0, 0, 0, 65, 0, 2, 0, 29, 64, 0, 1, 
+5, 0, 0, 0, 65, 64, 2, 0, 133, 0, 0, 1, 140, 128, 66, 1, 
+6, 193, 194, 0, 7, 1, 67, 2, 157, 128, 128, 1, 193, 64, 3, 0, 
+29, 64, 0, 2, 5, 0, 0, 0, 65, 128, 3, 0, 29, 64, 0, 1, 
+5, 0, 0, 0, 65, 192, 3, 0, 29, 64, 0, 1, 31, 0, 128, 0, 
+16, 0, 0, 0, 4, 45, 0, 0, 0, 0, 0, 0, 0, 37, 37, 32, 
+84, 104, 105, 115, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 97, 117, 
+116, 111, 109, 97, 116, 105, 99, 97, 108, 108, 121, 32, 103, 101, 110, 101, 
+114, 97, 116, 101, 100, 32, 98, 121, 32, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 32, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 86, 69, 82, 83, 73, 79, 78, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 46, 10, 0, 4, 25, 0, 
+0, 0, 0, 0, 0, 0, 92, 100, 111, 99, 117, 109, 101, 110, 116, 99, 
+108, 97, 115, 115, 123, 97, 114, 116, 105, 99, 108, 101, 125, 10, 0, 4, 
+42, 0, 0, 0, 0, 0, 0, 0, 92, 117, 115, 101, 112, 97, 99, 107, 
+97, 103, 101, 123, 120, 117, 110, 105, 99, 111, 100, 101, 44, 32, 115, 101, 
+116, 115, 112, 97, 99, 101, 44, 32, 120, 108, 116, 120, 116, 114, 97, 125, 
+10, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 92, 115, 108, 111, 112, 
+112, 121, 10, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 92, 111, 110, 
+101, 104, 97, 108, 102, 115, 112, 97, 99, 105, 110, 103, 10, 0, 4, 18, 
+0, 0, 0, 0, 0, 0, 0, 92, 98, 101, 103, 105, 110, 123, 100, 111, 
+99, 117, 109, 101, 110, 116, 125, 10, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 92, 116, 105, 116, 108, 101, 123, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 101, 115, 99, 97, 112, 101, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 125, 10, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 92, 
+97, 117, 116, 104, 111, 114, 123, 40, 110, 111, 32, 97, 117, 116, 104, 111, 
+114, 41, 125, 10, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 92, 109, 
+97, 107, 101, 116, 105, 116, 108, 101, 10, 0, 0, 0, 0, 0, 3, 0, 
+0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 
+66, 0, 0, 0, 1, 0, 3, 4, 0, 0, 0, 69, 0, 0, 0, 128, 
+0, 0, 0, 93, 64, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 
+0, 70, 0, 0, 0, 1, 0, 3, 4, 0, 0, 0, 69, 0, 0, 0, 
+129, 0, 0, 0, 93, 64, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 92, 112, 97, 114, 97, 103, 114, 
+97, 112, 104, 123, 125, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 72, 0, 0, 0, 74, 0, 0, 0, 0, 0, 2, 4, 
+0, 0, 0, 5, 0, 0, 0, 65, 0, 0, 0, 29, 64, 0, 1, 31, 
+0, 128, 0, 1, 0, 0, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 
+92, 98, 101, 103, 105, 110, 123, 105, 116, 101, 109, 105, 122, 101, 125, 10, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 
+0, 0, 0, 78, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 5, 0, 
+0, 0, 65, 0, 0, 0, 29, 64, 0, 1, 31, 0, 128, 0, 1, 0, 
+0, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 92, 101, 110, 100, 123, 
+105, 116, 101, 109, 105, 122, 101, 125, 10, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 0, 82, 0, 0, 0, 
+1, 0, 3, 8, 0, 0, 0, 69, 0, 0, 0, 134, 0, 128, 0, 135, 
+0, 64, 1, 155, 64, 0, 0, 23, 0, 0, 128, 129, 64, 0, 0, 93, 
+64, 0, 1, 31, 0, 128, 0, 2, 0, 0, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 0, 
+0, 0, 87, 0, 0, 0, 1, 0, 3, 11, 0, 0, 0, 69, 0, 0, 
+0, 134, 0, 128, 0, 135, 0, 64, 1, 155, 64, 0, 0, 23, 0, 0, 
+128, 129, 64, 0, 0, 93, 64, 0, 1, 69, 0, 0, 0, 129, 128, 0, 
+0, 93, 64, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 64, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+4, 2, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 91, 
+0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 5, 0, 0, 0, 65, 0, 
+0, 0, 29, 64, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 92, 101, 110, 100, 123, 100, 111, 99, 117, 
+109, 101, 110, 116, 125, 10, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 2, 1, 3, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 95, 0, 0, 0, 98, 0, 0, 0, 1, 0, 6, 8, 0, 
+0, 0, 70, 0, 64, 0, 128, 0, 0, 0, 193, 64, 0, 0, 1, 129, 
+0, 0, 69, 1, 128, 0, 94, 0, 128, 2, 95, 0, 0, 0, 31, 0, 
+128, 0, 3, 0, 0, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 69, 
+120, 112, 111, 114, 116, 70, 105, 108, 101, 87, 105, 116, 104, 85, 73, 0, 
+4, 18, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 32, 
+76, 97, 84, 101, 88, 32, 70, 105, 108, 101, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 46, 116, 101, 120, 0, 0, 0, 0, 0, 2, 0, 0, 
+0, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 
+};
+
+/* This is src/lua/export/troff.lua */
+static const char file_20[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 10, 42, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 134, 128, 64, 0, 135, 0, 65, 1, 192, 0, 0, 0, 11, 129, 0, 
+0, 75, 65, 0, 0, 74, 193, 65, 131, 10, 65, 129, 130, 10, 65, 66, 
+132, 221, 128, 0, 1, 0, 1, 0, 0, 75, 129, 0, 0, 139, 129, 0, 
+0, 138, 193, 65, 131, 138, 193, 66, 133, 74, 129, 129, 130, 74, 65, 66, 
+132, 29, 129, 0, 1, 75, 193, 2, 0, 74, 65, 67, 134, 74, 193, 67, 
+135, 74, 65, 68, 136, 74, 193, 68, 137, 74, 65, 69, 138, 74, 193, 69, 
+139, 74, 65, 70, 140, 74, 193, 69, 141, 74, 193, 197, 141, 74, 65, 71, 
+142, 74, 193, 71, 143, 165, 1, 0, 0, 198, 1, 72, 0, 37, 66, 0, 
+0, 202, 1, 130, 144, 198, 129, 72, 0, 1, 194, 8, 0, 64, 2, 0, 
+3, 221, 65, 128, 1, 31, 0, 128, 0, 36, 0, 0, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 19, 0, 0, 0, 0, 0, 
+0, 0, 99, 114, 101, 97, 116, 101, 101, 120, 112, 111, 114, 116, 102, 111, 
+114, 109, 97, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+114, 105, 110, 103, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 102, 105, 
+110, 100, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 103, 115, 117, 98, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 101, 115, 99, 97, 112, 101, 
+115, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 92, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 92, 92, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 117, 110, 105, 99, 111, 100, 101, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 92, 91, 117, 37, 48, 52, 88, 93, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 34, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+92, 34, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 49, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 46, 78, 72, 32, 49, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 72, 50, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 46, 78, 72, 32, 50, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 72, 51, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 46, 78, 
+72, 32, 51, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 52, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 46, 78, 72, 32, 52, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 46, 76, 80, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+76, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 46, 73, 80, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 76, 66, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 46, 73, 80, 32, 92, 91, 98, 117, 93, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 81, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 86, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 65, 87, 
+0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 80, 82, 69, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 46, 76, 68, 32, 49, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+67, 109, 100, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 
+111, 114, 116, 84, 114, 111, 102, 102, 70, 105, 108, 101, 0, 4, 17, 0, 
+0, 0, 0, 0, 0, 0, 82, 101, 103, 105, 115, 116, 101, 114, 69, 120, 
+112, 111, 114, 116, 101, 114, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+116, 114, 0, 2, 0, 0, 0, 38, 0, 0, 0, 172, 0, 0, 0, 2, 
+0, 13, 41, 0, 0, 0, 132, 0, 0, 0, 195, 0, 0, 0, 3, 1, 
+0, 0, 67, 1, 0, 0, 131, 1, 0, 0, 195, 1, 128, 0, 37, 2, 
+0, 0, 101, 66, 0, 0, 165, 130, 0, 0, 203, 194, 3, 0, 37, 195, 
+0, 0, 202, 2, 3, 128, 202, 66, 130, 128, 37, 3, 1, 0, 202, 2, 
+3, 129, 37, 67, 1, 0, 202, 2, 131, 129, 37, 131, 1, 0, 202, 2, 
+3, 130, 37, 195, 1, 0, 202, 2, 131, 130, 37, 3, 2, 0, 202, 2, 
+3, 131, 37, 67, 2, 0, 202, 2, 131, 131, 37, 131, 2, 0, 202, 2, 
+3, 132, 37, 195, 2, 0, 202, 2, 131, 132, 37, 3, 3, 0, 202, 2, 
+3, 133, 37, 67, 3, 0, 202, 2, 131, 133, 37, 131, 3, 0, 202, 2, 
+3, 134, 37, 195, 3, 0, 202, 2, 131, 134, 37, 3, 4, 0, 202, 2, 
+3, 135, 223, 2, 0, 1, 31, 0, 128, 0, 15, 0, 0, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 112, 114, 111, 108, 111, 103, 117, 101, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 101, 120, 116, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 114, 97, 119, 116, 101, 120, 116, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 110, 111, 116, 101, 120, 116, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 95, 111, 
+110, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 
+99, 95, 111, 102, 102, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 117, 
+110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 110, 0, 4, 14, 0, 0, 
+0, 0, 0, 0, 0, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 
+102, 102, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 
+95, 111, 110, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 
+100, 95, 111, 102, 102, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 108, 
+105, 115, 116, 95, 115, 116, 97, 114, 116, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 108, 105, 115, 116, 95, 101, 110, 100, 0, 4, 16, 0, 0, 
+0, 0, 0, 0, 0, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 115, 
+116, 97, 114, 116, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+114, 97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 101, 112, 105, 108, 111, 103, 117, 101, 0, 17, 0, 
+0, 0, 46, 0, 0, 0, 51, 0, 0, 0, 0, 0, 2, 9, 0, 0, 
+0, 5, 0, 0, 0, 27, 64, 0, 0, 23, 128, 0, 128, 5, 0, 128, 
+0, 65, 0, 0, 0, 29, 64, 0, 1, 3, 0, 128, 0, 9, 0, 0, 
+0, 31, 0, 128, 0, 1, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 10, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 7, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 53, 0, 0, 0, 68, 0, 0, 0, 1, 0, 7, 38, 
+0, 0, 0, 65, 0, 0, 0, 133, 0, 0, 0, 155, 0, 0, 0, 23, 
+128, 3, 128, 133, 0, 128, 0, 192, 0, 0, 0, 1, 65, 0, 0, 65, 
+1, 0, 0, 157, 128, 0, 2, 0, 0, 0, 1, 133, 0, 0, 1, 192, 
+0, 0, 0, 1, 129, 0, 0, 157, 128, 128, 1, 155, 0, 0, 0, 23, 
+0, 0, 128, 65, 192, 0, 0, 131, 0, 0, 0, 137, 0, 0, 0, 133, 
+0, 128, 1, 155, 0, 0, 0, 23, 192, 1, 128, 133, 0, 0, 2, 192, 
+0, 128, 0, 5, 1, 128, 2, 12, 1, 65, 2, 128, 1, 0, 0, 29, 
+1, 128, 1, 157, 64, 0, 0, 23, 128, 1, 128, 133, 0, 0, 2, 192, 
+0, 128, 0, 5, 1, 0, 3, 12, 1, 65, 2, 128, 1, 0, 0, 29, 
+1, 128, 1, 157, 64, 0, 0, 31, 0, 128, 0, 5, 0, 0, 0, 4, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 94, 37, 115, 43, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+94, 91, 46, 39, 93, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 92, 
+38, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 101, 115, 99, 97, 112, 
+101, 0, 0, 0, 0, 0, 7, 0, 0, 0, 1, 7, 0, 0, 0, 1, 
+1, 6, 1, 0, 0, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 
+101, 0, 0, 0, 3, 0, 5, 75, 0, 0, 0, 91, 0, 0, 0, 23, 
+192, 2, 128, 197, 0, 0, 0, 219, 64, 0, 0, 23, 0, 2, 128, 197, 
+0, 128, 0, 221, 64, 128, 0, 197, 0, 0, 1, 1, 1, 0, 0, 221, 
+64, 0, 1, 195, 0, 128, 0, 201, 0, 128, 1, 195, 0, 0, 0, 201, 
+0, 0, 2, 27, 0, 0, 0, 23, 192, 1, 128, 155, 64, 0, 0, 23, 
+64, 1, 128, 197, 0, 0, 1, 1, 65, 0, 0, 221, 64, 0, 1, 195, 
+0, 0, 0, 201, 0, 0, 2, 23, 128, 8, 128, 27, 0, 0, 0, 23, 
+192, 1, 128, 155, 0, 0, 0, 23, 64, 1, 128, 197, 0, 0, 1, 1, 
+129, 0, 0, 221, 64, 0, 1, 195, 0, 0, 0, 201, 0, 0, 2, 23, 
+0, 6, 128, 27, 64, 0, 0, 23, 192, 1, 128, 155, 0, 0, 0, 23, 
+64, 1, 128, 197, 0, 0, 1, 1, 193, 0, 0, 221, 64, 0, 1, 195, 
+0, 0, 0, 201, 0, 0, 2, 23, 128, 3, 128, 27, 64, 0, 0, 23, 
+0, 3, 128, 155, 64, 0, 0, 23, 128, 2, 128, 197, 0, 128, 2, 219, 
+64, 0, 0, 23, 128, 0, 128, 197, 0, 0, 3, 219, 0, 0, 0, 23, 
+0, 1, 128, 197, 0, 0, 1, 1, 1, 1, 0, 221, 64, 0, 1, 195, 
+0, 0, 0, 201, 0, 0, 2, 91, 64, 0, 0, 23, 64, 2, 128, 197, 
+0, 0, 0, 219, 0, 0, 0, 23, 128, 1, 128, 197, 0, 0, 1, 1, 
+65, 1, 0, 221, 64, 0, 1, 195, 0, 0, 0, 201, 0, 128, 1, 195, 
+0, 128, 0, 201, 0, 0, 2, 9, 0, 128, 2, 73, 0, 0, 0, 137, 
+0, 0, 3, 31, 0, 128, 0, 6, 0, 0, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 46, 85, 76, 32, 34, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 92, 102, 73, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+92, 102, 40, 66, 73, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 92, 
+102, 66, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 92, 102, 82, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 34, 10, 0, 0, 0, 0, 0, 
+7, 0, 0, 0, 1, 3, 1, 8, 1, 0, 1, 6, 1, 7, 1, 4, 
+1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 112, 0, 0, 0, 0, 0, 
+5, 23, 0, 0, 0, 5, 0, 0, 0, 65, 0, 0, 0, 129, 64, 0, 
+0, 198, 128, 192, 0, 1, 193, 0, 0, 86, 0, 129, 0, 29, 64, 0, 
+1, 5, 0, 0, 0, 65, 0, 1, 0, 29, 64, 0, 1, 5, 0, 0, 
+0, 65, 64, 1, 0, 29, 64, 0, 1, 5, 0, 0, 1, 70, 128, 193, 
+0, 71, 192, 193, 0, 29, 64, 0, 1, 5, 0, 0, 0, 65, 0, 2, 
+0, 29, 64, 0, 1, 3, 0, 128, 0, 9, 0, 128, 1, 31, 0, 128, 
+0, 9, 0, 0, 0, 4, 46, 0, 0, 0, 0, 0, 0, 0, 46, 92, 
+34, 32, 84, 104, 105, 115, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 
+97, 117, 116, 111, 109, 97, 116, 105, 99, 97, 108, 108, 121, 32, 103, 101, 
+110, 101, 114, 97, 116, 101, 100, 32, 98, 121, 32, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 
+32, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 86, 69, 82, 83, 73, 
+79, 78, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 46, 10, 0, 4, 
+32, 0, 0, 0, 0, 0, 0, 0, 46, 92, 34, 32, 85, 115, 101, 32, 
+116, 104, 101, 32, 46, 109, 115, 32, 109, 97, 99, 114, 111, 32, 112, 97, 
+99, 107, 97, 103, 101, 33, 10, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 46, 84, 76, 10, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 110, 97, 109, 101, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 10, 
+0, 0, 0, 0, 0, 4, 0, 0, 0, 1, 0, 0, 4, 1, 9, 1, 
+7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 116, 0, 0, 0, 118, 0, 0, 0, 1, 0, 3, 
+4, 0, 0, 0, 69, 0, 0, 0, 128, 0, 0, 0, 93, 64, 0, 1, 
+31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 121, 0, 0, 0, 1, 0, 
+2, 1, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0, 125, 0, 0, 
+0, 0, 0, 4, 6, 0, 0, 0, 5, 0, 0, 0, 67, 0, 128, 0, 
+133, 0, 128, 0, 197, 0, 0, 1, 29, 64, 0, 2, 31, 0, 128, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 10, 1, 3, 
+1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 127, 0, 0, 0, 129, 0, 0, 0, 0, 0, 
+4, 6, 0, 0, 0, 5, 0, 0, 0, 67, 0, 0, 0, 133, 0, 128, 
+0, 197, 0, 0, 1, 29, 64, 0, 2, 31, 0, 128, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 10, 1, 3, 1, 5, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 131, 0, 0, 0, 133, 0, 0, 0, 0, 0, 4, 6, 0, 
+0, 0, 5, 0, 0, 0, 69, 0, 128, 0, 131, 0, 128, 0, 197, 0, 
+0, 1, 29, 64, 0, 2, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 3, 0, 0, 0, 1, 10, 1, 4, 1, 5, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+135, 0, 0, 0, 137, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 5, 
+0, 0, 0, 69, 0, 128, 0, 131, 0, 0, 0, 197, 0, 0, 1, 29, 
+64, 0, 2, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+0, 0, 0, 1, 10, 1, 4, 1, 5, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 0, 0, 
+0, 141, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 5, 0, 0, 0, 
+69, 0, 128, 0, 133, 0, 0, 1, 195, 0, 128, 0, 29, 64, 0, 2, 
+31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 
+1, 10, 1, 4, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143, 0, 0, 0, 145, 0, 
+0, 0, 0, 0, 4, 6, 0, 0, 0, 5, 0, 0, 0, 69, 0, 128, 
+0, 133, 0, 0, 1, 195, 0, 0, 0, 29, 64, 0, 2, 31, 0, 128, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 10, 1, 
+4, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 147, 0, 0, 0, 148, 0, 0, 0, 0, 
+0, 2, 1, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 151, 0, 
+0, 0, 0, 0, 2, 1, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 0, 0, 
+0, 163, 0, 0, 0, 1, 0, 3, 24, 0, 0, 0, 69, 0, 0, 0, 
+24, 0, 192, 0, 23, 64, 0, 128, 88, 0, 64, 0, 23, 128, 3, 128, 
+69, 0, 0, 0, 24, 0, 192, 0, 23, 128, 0, 128, 69, 0, 128, 0, 
+129, 64, 0, 0, 93, 64, 0, 1, 69, 0, 128, 0, 134, 0, 0, 1, 
+155, 64, 0, 0, 23, 0, 0, 128, 129, 128, 0, 0, 93, 64, 0, 1, 
+69, 0, 128, 0, 129, 192, 0, 0, 93, 64, 0, 1, 67, 0, 128, 0, 
+73, 0, 128, 1, 9, 0, 0, 0, 31, 0, 128, 0, 4, 0, 0, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 80, 82, 69, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 46, 68, 69, 10, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 46, 76, 80, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 10, 0, 0, 0, 0, 0, 4, 0, 0, 0, 1, 2, 1, 0, 0, 
+5, 1, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 165, 0, 0, 0, 167, 0, 0, 0, 1, 
+0, 2, 3, 0, 0, 0, 69, 0, 0, 0, 93, 64, 128, 0, 31, 0, 
+128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 8, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 169, 0, 0, 0, 170, 0, 0, 0, 0, 0, 2, 1, 
+0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 1, 2, 1, 1, 1, 
+4, 1, 3, 0, 0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 174, 0, 0, 0, 177, 
+0, 0, 0, 1, 0, 6, 8, 0, 0, 0, 70, 0, 64, 0, 128, 0, 
+0, 0, 193, 64, 0, 0, 1, 129, 0, 0, 69, 1, 128, 0, 94, 0, 
+128, 2, 95, 0, 0, 0, 31, 0, 128, 0, 3, 0, 0, 0, 4, 17, 
+0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 70, 105, 108, 
+101, 87, 105, 116, 104, 85, 73, 0, 4, 18, 0, 0, 0, 0, 0, 0, 
+0, 69, 120, 112, 111, 114, 116, 32, 84, 114, 111, 102, 102, 32, 70, 105, 
+108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 46, 116, 114, 0, 
+0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 6, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/export/opendocument.lua */
+static const char file_21[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13, 106, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 128, 192, 
+0, 129, 192, 0, 0, 198, 0, 64, 0, 199, 0, 193, 1, 0, 1, 128, 
+1, 75, 193, 1, 0, 74, 129, 193, 130, 74, 1, 194, 131, 74, 129, 194, 
+132, 74, 1, 194, 133, 74, 65, 67, 134, 74, 1, 66, 135, 139, 65, 2, 
+0, 138, 65, 68, 136, 138, 193, 68, 137, 138, 65, 69, 138, 138, 193, 69, 
+139, 138, 193, 69, 140, 138, 193, 197, 140, 138, 193, 69, 141, 138, 193, 197, 
+141, 138, 193, 69, 142, 74, 129, 129, 135, 29, 129, 0, 1, 75, 193, 2, 
+0, 139, 1, 128, 1, 195, 1, 0, 0, 1, 130, 7, 0, 65, 194, 7, 
+0, 164, 65, 128, 1, 74, 129, 129, 142, 139, 1, 128, 1, 195, 1, 0, 
+0, 1, 66, 8, 0, 65, 194, 7, 0, 164, 65, 128, 1, 74, 129, 1, 
+144, 139, 1, 128, 1, 195, 1, 0, 0, 1, 194, 8, 0, 65, 194, 7, 
+0, 164, 65, 128, 1, 74, 129, 1, 145, 139, 1, 128, 1, 195, 1, 0, 
+0, 1, 66, 9, 0, 65, 194, 7, 0, 164, 65, 128, 1, 74, 129, 1, 
+146, 139, 1, 128, 1, 195, 1, 0, 0, 1, 194, 9, 0, 65, 2, 10, 
+0, 164, 65, 128, 1, 74, 129, 1, 147, 139, 1, 128, 1, 195, 1, 0, 
+0, 1, 130, 10, 0, 65, 194, 10, 0, 164, 65, 128, 1, 74, 129, 129, 
+148, 139, 1, 128, 1, 195, 1, 0, 0, 1, 66, 11, 0, 65, 194, 10, 
+0, 164, 65, 128, 1, 74, 129, 1, 150, 139, 1, 128, 1, 195, 1, 0, 
+0, 1, 194, 11, 0, 65, 2, 10, 0, 164, 65, 128, 1, 74, 129, 1, 
+151, 139, 1, 128, 1, 195, 1, 0, 0, 1, 66, 12, 0, 65, 2, 10, 
+0, 164, 65, 128, 1, 74, 129, 1, 152, 139, 1, 128, 1, 195, 1, 0, 
+0, 1, 194, 12, 0, 65, 194, 12, 0, 164, 65, 128, 1, 74, 129, 1, 
+153, 139, 1, 128, 1, 195, 1, 0, 0, 1, 66, 13, 0, 65, 2, 10, 
+0, 164, 65, 128, 1, 74, 129, 1, 154, 165, 1, 0, 0, 229, 65, 0, 
+0, 37, 130, 0, 0, 70, 130, 77, 0, 165, 194, 0, 0, 74, 130, 130, 
+155, 70, 2, 78, 0, 129, 66, 14, 0, 192, 2, 0, 3, 0, 3, 128, 
+3, 93, 66, 0, 2, 31, 0, 128, 0, 58, 0, 0, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 99, 114, 101, 97, 116, 101, 122, 105, 112, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 98, 117, 102, 102, 101, 
+114, 0, 3, 0, 0, 0, 0, 0, 0, 240, 64, 4, 19, 0, 0, 0, 
+0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 101, 120, 112, 111, 114, 116, 
+102, 111, 114, 109, 97, 116, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+105, 116, 97, 108, 105, 99, 95, 111, 110, 0, 4, 32, 0, 0, 0, 0, 
+0, 0, 0, 60, 116, 101, 120, 116, 58, 115, 112, 97, 110, 32, 116, 101, 
+120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 73, 
+34, 62, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 
+105, 99, 95, 111, 102, 102, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+60, 47, 116, 101, 120, 116, 58, 115, 112, 97, 110, 62, 0, 4, 8, 0, 
+0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 95, 111, 110, 0, 4, 32, 
+0, 0, 0, 0, 0, 0, 0, 60, 116, 101, 120, 116, 58, 115, 112, 97, 
+110, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 
+101, 61, 34, 66, 34, 62, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+98, 111, 108, 100, 95, 111, 102, 102, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 110, 0, 4, 
+33, 0, 0, 0, 0, 0, 0, 0, 60, 116, 101, 120, 116, 58, 115, 112, 
+97, 110, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 
+109, 101, 61, 34, 85, 76, 34, 62, 0, 4, 14, 0, 0, 0, 0, 0, 
+0, 0, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 102, 102, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 101, 115, 99, 97, 112, 101, 115, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 38, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 38, 97, 109, 112, 59, 0, 4, 2, 0, 0, 0, 
+0, 0, 0, 0, 60, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 38, 
+108, 116, 59, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 62, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 38, 103, 116, 59, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 32, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 60, 116, 101, 120, 116, 58, 115, 47, 62, 0, 4, 2, 0, 0, 0, 
+0, 0, 0, 0, 9, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 10, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 13, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 12, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+11, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 49, 0, 4, 53, 
+0, 0, 0, 0, 0, 0, 0, 60, 116, 101, 120, 116, 58, 104, 32, 116, 
+101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 
+72, 49, 34, 32, 116, 101, 120, 116, 58, 111, 117, 116, 108, 105, 110, 101, 
+45, 108, 101, 118, 101, 108, 61, 34, 49, 34, 62, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 60, 47, 116, 101, 120, 116, 58, 104, 62, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 72, 50, 0, 4, 53, 0, 0, 0, 
+0, 0, 0, 0, 60, 116, 101, 120, 116, 58, 104, 32, 116, 101, 120, 116, 
+58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 72, 50, 34, 
+32, 116, 101, 120, 116, 58, 111, 117, 116, 108, 105, 110, 101, 45, 108, 101, 
+118, 101, 108, 61, 34, 50, 34, 62, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 72, 51, 0, 4, 53, 0, 0, 0, 0, 0, 0, 0, 60, 116, 
+101, 120, 116, 58, 104, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 
+45, 110, 97, 109, 101, 61, 34, 72, 51, 34, 32, 116, 101, 120, 116, 58, 
+111, 117, 116, 108, 105, 110, 101, 45, 108, 101, 118, 101, 108, 61, 34, 51, 
+34, 62, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 52, 0, 4, 
+53, 0, 0, 0, 0, 0, 0, 0, 60, 116, 101, 120, 116, 58, 104, 32, 
+116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 
+34, 72, 52, 34, 32, 116, 101, 120, 116, 58, 111, 117, 116, 108, 105, 110, 
+101, 45, 108, 101, 118, 101, 108, 61, 34, 52, 34, 62, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 80, 0, 4, 29, 0, 0, 0, 0, 0, 0, 
+0, 60, 116, 101, 120, 116, 58, 112, 32, 116, 101, 120, 116, 58, 115, 116, 
+121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 80, 34, 62, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 60, 47, 116, 101, 120, 116, 58, 112, 62, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 76, 0, 4, 76, 0, 0, 
+0, 0, 0, 0, 0, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 32, 
+116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 
+34, 76, 34, 62, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 105, 
+116, 101, 109, 62, 60, 116, 101, 120, 116, 58, 112, 32, 116, 101, 120, 116, 
+58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 80, 34, 62, 
+0, 4, 39, 0, 0, 0, 0, 0, 0, 0, 60, 47, 116, 101, 120, 116, 
+58, 112, 62, 60, 47, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 105, 
+116, 101, 109, 62, 60, 47, 116, 101, 120, 116, 58, 108, 105, 115, 116, 62, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 76, 66, 0, 4, 77, 0, 
+0, 0, 0, 0, 0, 0, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 
+32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 
+61, 34, 76, 66, 34, 62, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 
+45, 105, 116, 101, 109, 62, 60, 116, 101, 120, 116, 58, 112, 32, 116, 101, 
+120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 80, 
+34, 62, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 81, 0, 4, 29, 
+0, 0, 0, 0, 0, 0, 0, 60, 116, 101, 120, 116, 58, 112, 32, 116, 
+101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 
+81, 34, 62, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 86, 0, 4, 
+29, 0, 0, 0, 0, 0, 0, 0, 60, 116, 101, 120, 116, 58, 112, 32, 
+116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 
+34, 86, 34, 62, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 65, 
+87, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 80, 82, 69, 0, 4, 31, 0, 0, 0, 0, 0, 
+0, 0, 60, 116, 101, 120, 116, 58, 112, 32, 116, 101, 120, 116, 58, 115, 
+116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 80, 82, 69, 34, 62, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 14, 
+0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 79, 68, 84, 
+70, 105, 108, 101, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 82, 101, 
+103, 105, 115, 116, 101, 114, 69, 120, 112, 111, 114, 116, 101, 114, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 111, 100, 116, 0, 4, 0, 0, 0, 
+53, 0, 0, 0, 122, 0, 0, 0, 2, 0, 7, 26, 0, 0, 0, 134, 
+0, 64, 0, 135, 64, 64, 1, 135, 128, 64, 1, 196, 0, 0, 0, 37, 
+1, 0, 0, 75, 65, 2, 0, 165, 65, 0, 0, 74, 129, 129, 129, 165, 
+129, 0, 0, 74, 129, 1, 130, 133, 1, 0, 1, 74, 129, 129, 130, 165, 
+193, 0, 0, 74, 129, 1, 131, 165, 1, 1, 0, 74, 129, 129, 131, 165, 
+65, 1, 0, 74, 129, 1, 132, 165, 129, 1, 0, 74, 129, 129, 132, 165, 
+193, 1, 0, 74, 129, 1, 133, 165, 1, 2, 0, 74, 129, 129, 133, 95, 
+1, 0, 1, 31, 0, 128, 0, 12, 0, 0, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 111, 110, 115, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 104, 116, 109, 108, 101, 120, 112, 
+111, 114, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 112, 114, 111, 
+108, 111, 103, 117, 101, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 101, 
+112, 105, 108, 111, 103, 117, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 102, 111, 114, 109, 97, 116, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 114, 97, 119, 116, 101, 120, 116, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 110, 111, 116, 101, 120, 116, 0, 4, 11, 0, 0, 0, 0, 0, 
+0, 0, 108, 105, 115, 116, 95, 115, 116, 97, 114, 116, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 108, 105, 115, 116, 95, 101, 110, 100, 0, 4, 
+16, 0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 97, 103, 114, 97, 112, 
+104, 95, 115, 116, 97, 114, 116, 0, 4, 14, 0, 0, 0, 0, 0, 0, 
+0, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 0, 9, 
+0, 0, 0, 57, 0, 0, 0, 77, 0, 0, 0, 1, 0, 5, 33, 0, 
+0, 0, 69, 0, 128, 0, 70, 64, 0, 0, 134, 0, 0, 0, 197, 0, 
+128, 0, 24, 192, 0, 0, 23, 192, 1, 128, 27, 0, 0, 0, 23, 64, 
+1, 128, 199, 0, 192, 0, 219, 0, 0, 0, 23, 128, 0, 128, 199, 0, 
+64, 1, 219, 64, 0, 0, 23, 128, 3, 128, 91, 0, 0, 0, 23, 128, 
+0, 128, 197, 0, 0, 1, 7, 65, 192, 0, 221, 64, 0, 1, 197, 0, 
+0, 1, 1, 129, 0, 0, 221, 64, 0, 1, 155, 0, 0, 0, 23, 128, 
+0, 128, 197, 0, 0, 1, 7, 193, 64, 1, 221, 64, 0, 1, 9, 0, 
+128, 0, 23, 128, 0, 128, 197, 0, 0, 1, 1, 129, 0, 0, 221, 64, 
+0, 1, 31, 0, 128, 0, 4, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+0, 240, 63, 3, 0, 0, 0, 0, 0, 0, 8, 64, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 10, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 
+0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 1, 3, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 80, 0, 0, 0, 92, 0, 0, 0, 0, 0, 2, 4, 0, 0, 
+0, 5, 0, 0, 0, 65, 0, 0, 0, 29, 64, 0, 1, 31, 0, 128, 
+0, 1, 0, 0, 0, 4, 149, 1, 0, 0, 0, 0, 0, 0, 60, 63, 
+120, 109, 108, 32, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 
+34, 32, 101, 110, 99, 111, 100, 105, 110, 103, 61, 34, 85, 84, 70, 45, 
+56, 34, 63, 62, 10, 9, 9, 9, 9, 9, 60, 111, 102, 102, 105, 99, 
+101, 58, 100, 111, 99, 117, 109, 101, 110, 116, 45, 99, 111, 110, 116, 101, 
+110, 116, 32, 111, 102, 102, 105, 99, 101, 58, 118, 101, 114, 115, 105, 111, 
+110, 61, 34, 49, 46, 48, 34, 10, 9, 9, 9, 9, 9, 120, 109, 108, 
+110, 115, 58, 111, 102, 102, 105, 99, 101, 61, 34, 117, 114, 110, 58, 111, 
+97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 112, 
+101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 115, 
+58, 111, 102, 102, 105, 99, 101, 58, 49, 46, 48, 34, 10, 9, 9, 9, 
+9, 9, 120, 109, 108, 110, 115, 58, 116, 101, 120, 116, 61, 34, 117, 114, 
+110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 
+58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 
+108, 110, 115, 58, 116, 101, 120, 116, 58, 49, 46, 48, 34, 10, 9, 9, 
+9, 9, 9, 120, 109, 108, 110, 115, 58, 102, 111, 61, 34, 117, 114, 110, 
+58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 
+111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 
+110, 115, 58, 120, 115, 108, 45, 102, 111, 45, 99, 111, 109, 112, 97, 116, 
+105, 98, 108, 101, 58, 49, 46, 48, 34, 10, 9, 9, 9, 9, 9, 120, 
+109, 108, 110, 115, 58, 115, 116, 121, 108, 101, 61, 34, 117, 114, 110, 58, 
+111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 
+112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 
+115, 58, 115, 116, 121, 108, 101, 58, 49, 46, 48, 34, 62, 10, 9, 9, 
+9, 9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 98, 111, 100, 121, 62, 
+60, 111, 102, 102, 105, 99, 101, 58, 116, 101, 120, 116, 62, 10, 9, 9, 
+9, 9, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 94, 0, 0, 0, 97, 0, 0, 0, 0, 0, 2, 7, 0, 0, 0, 
+5, 0, 0, 0, 68, 0, 0, 0, 29, 64, 0, 1, 5, 0, 128, 0, 
+65, 0, 0, 0, 29, 64, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 
+4, 56, 0, 0, 0, 0, 0, 0, 0, 60, 47, 111, 102, 102, 105, 99, 
+101, 58, 116, 101, 120, 116, 62, 60, 47, 111, 102, 102, 105, 99, 101, 58, 
+98, 111, 100, 121, 62, 60, 47, 111, 102, 102, 105, 99, 101, 58, 100, 111, 
+99, 117, 109, 101, 110, 116, 45, 99, 111, 110, 116, 101, 110, 116, 62, 10, 
+0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 4, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 101, 0, 0, 0, 103, 0, 0, 0, 1, 0, 3, 4, 0, 0, 0, 
+69, 0, 0, 0, 128, 0, 0, 0, 93, 64, 0, 1, 31, 0, 128, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 105, 0, 0, 0, 106, 0, 0, 0, 1, 0, 2, 1, 0, 0, 
+0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 108, 0, 0, 0, 109, 0, 0, 0, 0, 0, 2, 
+1, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 111, 0, 0, 0, 112, 0, 0, 0, 
+0, 0, 2, 1, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 0, 0, 0, 116, 
+0, 0, 0, 1, 0, 3, 4, 0, 0, 0, 69, 0, 0, 0, 128, 0, 
+0, 0, 93, 64, 0, 1, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 0, 0, 0, 
+119, 0, 0, 0, 1, 0, 2, 1, 0, 0, 0, 31, 0, 128, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+0, 0, 0, 0, 0, 1, 5, 1, 4, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 
+0, 77, 1, 0, 0, 1, 0, 13, 57, 0, 0, 0, 75, 64, 1, 0, 
+74, 64, 64, 128, 74, 192, 64, 129, 74, 64, 65, 130, 74, 192, 65, 131, 
+74, 64, 66, 132, 133, 0, 0, 0, 192, 0, 0, 0, 157, 128, 0, 1, 
+220, 0, 0, 1, 23, 192, 0, 128, 204, 128, 66, 1, 65, 1, 0, 0, 
+135, 1, 192, 0, 221, 128, 0, 2, 6, 193, 194, 0, 75, 1, 0, 2, 
+129, 129, 0, 0, 193, 1, 1, 0, 1, 130, 1, 0, 65, 2, 2, 0, 
+100, 65, 0, 2, 29, 1, 1, 1, 23, 128, 1, 128, 219, 0, 0, 0, 
+23, 0, 1, 128, 76, 130, 66, 1, 192, 2, 0, 4, 7, 3, 130, 0, 
+93, 130, 0, 2, 192, 0, 128, 4, 34, 129, 0, 0, 163, 129, 253, 127, 
+219, 0, 0, 0, 23, 192, 0, 128, 12, 1, 67, 1, 129, 65, 3, 0, 
+29, 129, 128, 1, 192, 0, 0, 2, 219, 64, 0, 0, 23, 128, 1, 128, 
+155, 0, 0, 0, 23, 64, 0, 128, 12, 129, 67, 1, 29, 65, 0, 1, 
+4, 1, 0, 0, 64, 1, 0, 0, 31, 1, 128, 1, 5, 1, 0, 1, 
+29, 129, 128, 0, 71, 193, 67, 2, 165, 1, 0, 0, 229, 65, 0, 0, 
+0, 2, 0, 3, 64, 2, 128, 3, 31, 2, 128, 1, 31, 0, 128, 0, 
+16, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 109, 105, 109, 
+101, 116, 121, 112, 101, 0, 4, 40, 0, 0, 0, 0, 0, 0, 0, 97, 
+112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 47, 118, 110, 100, 46, 111, 
+97, 115, 105, 115, 46, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 
+116, 46, 116, 101, 120, 116, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 
+77, 69, 84, 65, 45, 73, 78, 70, 47, 109, 97, 110, 105, 102, 101, 115, 
+116, 46, 120, 109, 108, 0, 4, 174, 2, 0, 0, 0, 0, 0, 0, 60, 
+63, 120, 109, 108, 32, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 
+48, 34, 32, 101, 110, 99, 111, 100, 105, 110, 103, 61, 34, 85, 84, 70, 
+45, 56, 34, 63, 62, 10, 9, 9, 9, 60, 109, 97, 110, 105, 102, 101, 
+115, 116, 58, 109, 97, 110, 105, 102, 101, 115, 116, 32, 120, 109, 108, 110, 
+115, 58, 109, 97, 110, 105, 102, 101, 115, 116, 61, 34, 117, 114, 110, 58, 
+111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 
+112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 
+115, 58, 109, 97, 110, 105, 102, 101, 115, 116, 58, 49, 46, 48, 34, 62, 
+32, 10, 9, 9, 9, 9, 60, 109, 97, 110, 105, 102, 101, 115, 116, 58, 
+102, 105, 108, 101, 45, 101, 110, 116, 114, 121, 10, 9, 9, 9, 9, 9, 
+109, 97, 110, 105, 102, 101, 115, 116, 58, 109, 101, 100, 105, 97, 45, 116, 
+121, 112, 101, 61, 34, 97, 112, 112, 108, 105, 99, 97, 116, 105, 111, 110, 
+47, 118, 110, 100, 46, 111, 97, 115, 105, 115, 46, 111, 112, 101, 110, 100, 
+111, 99, 117, 109, 101, 110, 116, 46, 116, 101, 120, 116, 34, 10, 9, 9, 
+9, 9, 9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 102, 117, 108, 108, 
+45, 112, 97, 116, 104, 61, 34, 47, 34, 47, 62, 32, 10, 9, 9, 9, 
+9, 60, 109, 97, 110, 105, 102, 101, 115, 116, 58, 102, 105, 108, 101, 45, 
+101, 110, 116, 114, 121, 10, 9, 9, 9, 9, 9, 109, 97, 110, 105, 102, 
+101, 115, 116, 58, 109, 101, 100, 105, 97, 45, 116, 121, 112, 101, 61, 34, 
+116, 101, 120, 116, 47, 120, 109, 108, 34, 10, 9, 9, 9, 9, 9, 109, 
+97, 110, 105, 102, 101, 115, 116, 58, 102, 117, 108, 108, 45, 112, 97, 116, 
+104, 61, 34, 99, 111, 110, 116, 101, 110, 116, 46, 120, 109, 108, 34, 47, 
+62, 32, 10, 9, 9, 9, 9, 60, 109, 97, 110, 105, 102, 101, 115, 116, 
+58, 102, 105, 108, 101, 45, 101, 110, 116, 114, 121, 10, 9, 9, 9, 9, 
+9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 109, 101, 100, 105, 97, 45, 
+116, 121, 112, 101, 61, 34, 116, 101, 120, 116, 47, 120, 109, 108, 34, 10, 
+9, 9, 9, 9, 9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 102, 117, 
+108, 108, 45, 112, 97, 116, 104, 61, 34, 109, 101, 116, 97, 46, 120, 109, 
+108, 34, 47, 62, 32, 10, 9, 9, 9, 9, 60, 109, 97, 110, 105, 102, 
+101, 115, 116, 58, 102, 105, 108, 101, 45, 101, 110, 116, 114, 121, 10, 9, 
+9, 9, 9, 9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 109, 101, 100, 
+105, 97, 45, 116, 121, 112, 101, 61, 34, 116, 101, 120, 116, 47, 120, 109, 
+108, 34, 10, 9, 9, 9, 9, 9, 109, 97, 110, 105, 102, 101, 115, 116, 
+58, 102, 117, 108, 108, 45, 112, 97, 116, 104, 61, 34, 115, 101, 116, 116, 
+105, 110, 103, 115, 46, 120, 109, 108, 34, 47, 62, 32, 10, 9, 9, 9, 
+9, 60, 109, 97, 110, 105, 102, 101, 115, 116, 58, 102, 105, 108, 101, 45, 
+101, 110, 116, 114, 121, 10, 9, 9, 9, 9, 9, 109, 97, 110, 105, 102, 
+101, 115, 116, 58, 109, 101, 100, 105, 97, 45, 116, 121, 112, 101, 61, 34, 
+116, 101, 120, 116, 47, 120, 109, 108, 34, 10, 9, 9, 9, 9, 9, 109, 
+97, 110, 105, 102, 101, 115, 116, 58, 102, 117, 108, 108, 45, 112, 97, 116, 
+104, 61, 34, 115, 116, 121, 108, 101, 115, 46, 120, 109, 108, 34, 47, 62, 
+32, 10, 9, 9, 9, 60, 47, 109, 97, 110, 105, 102, 101, 115, 116, 58, 
+109, 97, 110, 105, 102, 101, 115, 116, 62, 10, 9, 9, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 115, 46, 120, 109, 108, 
+0, 4, 178, 21, 0, 0, 0, 0, 0, 0, 60, 63, 120, 109, 108, 32, 
+118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 34, 32, 101, 110, 
+99, 111, 100, 105, 110, 103, 61, 34, 85, 84, 70, 45, 56, 34, 63, 62, 
+10, 9, 9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 100, 111, 99, 117, 
+109, 101, 110, 116, 45, 115, 116, 121, 108, 101, 115, 32, 111, 102, 102, 105, 
+99, 101, 58, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 34, 
+10, 9, 9, 9, 9, 120, 109, 108, 110, 115, 58, 116, 101, 120, 116, 61, 
+34, 117, 114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 
+58, 116, 99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 
+58, 120, 109, 108, 110, 115, 58, 116, 101, 120, 116, 58, 49, 46, 48, 34, 
+10, 9, 9, 9, 9, 120, 109, 108, 110, 115, 58, 102, 111, 61, 34, 117, 
+114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 
+99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 
+109, 108, 110, 115, 58, 120, 115, 108, 45, 102, 111, 45, 99, 111, 109, 112, 
+97, 116, 105, 98, 108, 101, 58, 49, 46, 48, 34, 10, 9, 9, 9, 9, 
+120, 109, 108, 110, 115, 58, 115, 116, 121, 108, 101, 61, 34, 117, 114, 110, 
+58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 
+111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 
+110, 115, 58, 115, 116, 121, 108, 101, 58, 49, 46, 48, 34, 10, 9, 9, 
+9, 9, 120, 109, 108, 110, 115, 58, 115, 118, 103, 61, 34, 117, 114, 110, 
+58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 
+111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 
+110, 115, 58, 115, 118, 103, 45, 99, 111, 109, 112, 97, 116, 105, 98, 108, 
+101, 58, 49, 46, 48, 34, 10, 9, 9, 9, 9, 120, 109, 108, 110, 115, 
+58, 111, 102, 102, 105, 99, 101, 61, 34, 117, 114, 110, 58, 111, 97, 115, 
+105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 112, 101, 110, 
+100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 115, 58, 111, 
+102, 102, 105, 99, 101, 58, 49, 46, 48, 34, 62, 10, 9, 9, 9, 9, 
+10, 9, 9, 9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 102, 111, 110, 
+116, 45, 102, 97, 99, 101, 45, 100, 101, 99, 108, 115, 62, 10, 9, 9, 
+9, 9, 32, 32, 60, 115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 
+102, 97, 99, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 
+34, 109, 111, 110, 111, 115, 112, 97, 99, 101, 34, 32, 115, 118, 103, 58, 
+102, 111, 110, 116, 45, 102, 97, 109, 105, 108, 121, 61, 34, 109, 111, 110, 
+111, 115, 112, 97, 99, 101, 34, 32, 115, 116, 121, 108, 101, 58, 102, 111, 
+110, 116, 45, 102, 97, 109, 105, 108, 121, 45, 103, 101, 110, 101, 114, 105, 
+99, 61, 34, 109, 111, 100, 101, 114, 110, 34, 32, 115, 116, 121, 108, 101, 
+58, 102, 111, 110, 116, 45, 112, 105, 116, 99, 104, 61, 34, 102, 105, 120, 
+101, 100, 34, 47, 62, 10, 9, 9, 9, 9, 32, 32, 60, 115, 116, 121, 
+108, 101, 58, 102, 111, 110, 116, 45, 102, 97, 99, 101, 32, 115, 116, 121, 
+108, 101, 58, 110, 97, 109, 101, 61, 34, 115, 101, 114, 105, 102, 34, 32, 
+115, 118, 103, 58, 102, 111, 110, 116, 45, 102, 97, 109, 105, 108, 121, 61, 
+34, 115, 101, 114, 105, 102, 34, 32, 115, 116, 121, 108, 101, 58, 102, 111, 
+110, 116, 45, 102, 97, 109, 105, 108, 121, 45, 103, 101, 110, 101, 114, 105, 
+99, 61, 34, 114, 111, 109, 97, 110, 34, 32, 115, 116, 121, 108, 101, 58, 
+102, 111, 110, 116, 45, 112, 105, 116, 99, 104, 61, 34, 118, 97, 114, 105, 
+97, 98, 108, 101, 34, 47, 62, 10, 9, 9, 9, 9, 60, 47, 111, 102, 
+102, 105, 99, 101, 58, 102, 111, 110, 116, 45, 102, 97, 99, 101, 45, 100, 
+101, 99, 108, 115, 62, 10, 9, 9, 9, 9, 32, 10, 9, 9, 9, 9, 
+60, 111, 102, 102, 105, 99, 101, 58, 115, 116, 121, 108, 101, 115, 62, 10, 
+9, 9, 9, 9, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 
+101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 66, 34, 
+32, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 34, 116, 
+101, 120, 116, 34, 62, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 
+120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 102, 111, 
+58, 102, 111, 110, 116, 45, 119, 101, 105, 103, 104, 116, 61, 34, 98, 111, 
+108, 100, 34, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 9, 9, 115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 
+45, 119, 101, 105, 103, 104, 116, 45, 99, 111, 109, 112, 108, 101, 120, 61, 
+34, 98, 111, 108, 100, 34, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 101, 58, 
+102, 111, 110, 116, 45, 119, 101, 105, 103, 104, 116, 45, 97, 115, 105, 97, 
+110, 61, 34, 98, 111, 108, 100, 34, 47, 62, 10, 9, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 
+58, 115, 116, 121, 108, 101, 62, 10, 9, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 10, 9, 9, 9, 9, 9, 60, 115, 116, 121, 
+108, 101, 58, 115, 116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 
+97, 109, 101, 61, 34, 73, 34, 32, 115, 116, 121, 108, 101, 58, 102, 97, 
+109, 105, 108, 121, 61, 34, 116, 101, 120, 116, 34, 62, 10, 9, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 
+116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 114, 111, 112, 101, 114, 
+116, 105, 101, 115, 32, 102, 111, 58, 102, 111, 110, 116, 45, 115, 116, 121, 
+108, 101, 61, 34, 105, 116, 97, 108, 105, 99, 34, 10, 9, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 115, 116, 
+121, 108, 101, 58, 102, 111, 110, 116, 45, 115, 116, 121, 108, 101, 45, 97, 
+115, 105, 97, 110, 61, 34, 105, 116, 97, 108, 105, 99, 34, 10, 9, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+9, 115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 115, 116, 121, 108, 
+101, 45, 99, 111, 109, 112, 108, 101, 120, 61, 34, 105, 116, 97, 108, 105, 
+99, 34, 47, 62, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 
+62, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+10, 9, 9, 9, 9, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 121, 
+108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 85, 
+76, 34, 32, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 
+34, 116, 101, 120, 116, 34, 62, 10, 9, 9, 9, 9, 9, 9, 60, 115, 
+116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 114, 111, 112, 101, 114, 
+116, 105, 101, 115, 32, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 
+117, 110, 100, 101, 114, 108, 105, 110, 101, 45, 115, 116, 121, 108, 101, 61, 
+34, 115, 111, 108, 105, 100, 34, 10, 9, 9, 9, 9, 9, 9, 9, 115, 
+116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 117, 110, 100, 101, 114, 108, 
+105, 110, 101, 45, 119, 105, 100, 116, 104, 61, 34, 97, 117, 116, 111, 34, 
+10, 9, 9, 9, 9, 9, 9, 9, 115, 116, 121, 108, 101, 58, 116, 101, 
+120, 116, 45, 117, 110, 100, 101, 114, 108, 105, 110, 101, 45, 99, 111, 108, 
+111, 114, 61, 34, 102, 111, 110, 116, 45, 99, 111, 108, 111, 114, 34, 47, 
+62, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 62, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 32, 115, 
+116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 72, 49, 34, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+9, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 34, 112, 
+97, 114, 97, 103, 114, 97, 112, 104, 34, 32, 115, 116, 121, 108, 101, 58, 
+99, 108, 97, 115, 115, 61, 34, 116, 101, 120, 116, 34, 62, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 
+60, 115, 116, 121, 108, 101, 58, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 
+111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 111, 112, 61, 34, 53, 109, 
+109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 
+98, 111, 116, 116, 111, 109, 61, 34, 50, 109, 109, 34, 47, 62, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 114, 111, 
+112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 102, 111, 
+110, 116, 45, 115, 105, 122, 101, 61, 34, 49, 53, 48, 37, 34, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+9, 9, 115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 
+101, 61, 34, 115, 101, 114, 105, 102, 34, 10, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 
+102, 111, 110, 116, 45, 119, 101, 105, 103, 104, 116, 61, 34, 98, 111, 108, 
+100, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 
+121, 108, 101, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 60, 115, 116, 121, 108, 101, 58, 115, 
+116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 
+34, 72, 50, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 97, 109, 
+105, 108, 121, 61, 34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 34, 32, 
+115, 116, 121, 108, 101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 101, 120, 
+116, 34, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 
+115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 
+111, 112, 61, 34, 53, 109, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 
+97, 114, 103, 105, 110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 50, 109, 
+109, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 
+120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 
+9, 102, 111, 58, 102, 111, 110, 116, 45, 115, 105, 122, 101, 61, 34, 49, 
+51, 48, 37, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 9, 115, 116, 121, 108, 101, 58, 102, 111, 
+110, 116, 45, 110, 97, 109, 101, 61, 34, 115, 101, 114, 105, 102, 34, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 9, 9, 102, 111, 58, 102, 111, 110, 116, 45, 119, 101, 105, 103, 104, 
+116, 61, 34, 98, 111, 108, 100, 34, 47, 62, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 
+121, 108, 101, 58, 115, 116, 121, 108, 101, 62, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 115, 
+116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 
+58, 110, 97, 109, 101, 61, 34, 72, 51, 34, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 
+108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 34, 112, 97, 114, 97, 103, 
+114, 97, 112, 104, 34, 32, 115, 116, 121, 108, 101, 58, 99, 108, 97, 115, 
+115, 61, 34, 116, 101, 120, 116, 34, 62, 10, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 
+108, 101, 58, 112, 97, 114, 97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 
+112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 
+114, 103, 105, 110, 45, 116, 111, 112, 61, 34, 53, 109, 109, 34, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 98, 111, 116, 116, 
+111, 109, 61, 34, 50, 109, 109, 34, 47, 62, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 
+121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 
+105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 102, 111, 110, 116, 45, 115, 
+105, 122, 101, 61, 34, 49, 49, 48, 37, 34, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 115, 116, 
+121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 115, 
+101, 114, 105, 102, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 102, 111, 110, 116, 
+45, 119, 101, 105, 103, 104, 116, 61, 34, 98, 111, 108, 100, 34, 47, 62, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 62, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 
+32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 72, 52, 34, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 
+34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 34, 32, 115, 116, 121, 108, 
+101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 101, 120, 116, 34, 62, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 97, 114, 97, 103, 114, 97, 
+112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 
+9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 111, 112, 61, 34, 
+53, 109, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 
+110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 50, 109, 109, 34, 47, 62, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 
+114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 115, 116, 121, 
+108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 115, 101, 
+114, 105, 102, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 102, 111, 110, 116, 45, 
+119, 101, 105, 103, 104, 116, 61, 34, 98, 111, 108, 100, 34, 47, 62, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 62, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 32, 
+115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 80, 34, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+9, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 34, 112, 
+97, 114, 97, 103, 114, 97, 112, 104, 34, 32, 115, 116, 121, 108, 101, 58, 
+99, 108, 97, 115, 115, 61, 34, 116, 101, 120, 116, 34, 62, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 
+60, 115, 116, 121, 108, 101, 58, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 
+111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 111, 112, 61, 34, 49, 46, 
+53, 109, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 
+110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 49, 46, 53, 109, 109, 34, 
+47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 
+45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 115, 116, 121, 108, 
+101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 115, 101, 114, 
+105, 102, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 
+116, 121, 108, 101, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 115, 116, 121, 108, 101, 58, 
+115, 116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 
+61, 34, 81, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 97, 109, 
+105, 108, 121, 61, 34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 34, 32, 
+115, 116, 121, 108, 101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 101, 120, 
+116, 34, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 
+115, 10, 9, 9, 9, 9, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 
+105, 110, 45, 116, 111, 112, 61, 34, 49, 46, 53, 109, 109, 34, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 98, 111, 116, 116, 
+111, 109, 61, 34, 49, 46, 53, 109, 109, 34, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 
+58, 109, 97, 114, 103, 105, 110, 45, 108, 101, 102, 116, 61, 34, 49, 48, 
+109, 109, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 
+101, 120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 115, 
+116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 
+115, 101, 114, 105, 102, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 
+101, 58, 115, 116, 121, 108, 101, 62, 10, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 115, 116, 121, 
+108, 101, 58, 115, 116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 
+97, 109, 101, 61, 34, 86, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 101, 58, 
+102, 97, 109, 105, 108, 121, 61, 34, 112, 97, 114, 97, 103, 114, 97, 112, 
+104, 34, 32, 115, 116, 121, 108, 101, 58, 99, 108, 97, 115, 115, 61, 34, 
+116, 101, 120, 116, 34, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 
+112, 97, 114, 97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 112, 101, 114, 
+116, 105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 
+110, 45, 108, 101, 102, 116, 61, 34, 49, 48, 109, 109, 34, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 
+9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 111, 112, 61, 34, 
+48, 109, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 
+110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 48, 109, 109, 34, 47, 62, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 
+114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 115, 116, 121, 108, 101, 58, 
+102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 115, 101, 114, 105, 102, 
+34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 
+108, 101, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 
+121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 
+80, 82, 69, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 97, 109, 
+105, 108, 121, 61, 34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 34, 32, 
+115, 116, 121, 108, 101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 101, 120, 
+116, 34, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 
+115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 
+111, 112, 61, 34, 48, 109, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 
+97, 114, 103, 105, 110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 48, 109, 
+109, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 
+120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 115, 116, 
+121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 109, 
+111, 110, 111, 115, 112, 97, 99, 101, 34, 47, 62, 10, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 
+116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 62, 10, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 
+116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 115, 116, 121, 108, 101, 32, 
+115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 76, 66, 34, 62, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 108, 101, 
+118, 101, 108, 45, 115, 116, 121, 108, 101, 45, 98, 117, 108, 108, 101, 116, 
+32, 116, 101, 120, 116, 58, 108, 101, 118, 101, 108, 61, 34, 49, 34, 32, 
+116, 101, 120, 116, 58, 98, 117, 108, 108, 101, 116, 45, 99, 104, 97, 114, 
+61, 34, 226, 128, 162, 34, 62, 10, 9, 9, 9, 9, 9, 9, 9, 60, 
+115, 116, 121, 108, 101, 58, 108, 105, 115, 116, 45, 108, 101, 118, 101, 108, 
+45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 9, 9, 9, 9, 
+9, 9, 9, 9, 116, 101, 120, 116, 58, 115, 112, 97, 99, 101, 45, 98, 
+101, 102, 111, 114, 101, 61, 34, 53, 109, 109, 34, 10, 9, 9, 9, 9, 
+9, 9, 9, 9, 116, 101, 120, 116, 58, 109, 105, 110, 45, 108, 97, 98, 
+101, 108, 45, 119, 105, 100, 116, 104, 61, 34, 53, 109, 109, 34, 47, 62, 
+10, 9, 9, 9, 9, 9, 9, 60, 47, 116, 101, 120, 116, 58, 108, 105, 
+115, 116, 45, 108, 101, 118, 101, 108, 45, 115, 116, 121, 108, 101, 45, 98, 
+117, 108, 108, 101, 116, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 116, 101, 120, 116, 58, 108, 
+105, 115, 116, 45, 115, 116, 121, 108, 101, 62, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 116, 
+101, 120, 116, 58, 108, 105, 115, 116, 45, 115, 116, 121, 108, 101, 32, 115, 
+116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 76, 34, 62, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+9, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 108, 101, 118, 101, 
+108, 45, 115, 116, 121, 108, 101, 45, 98, 117, 108, 108, 101, 116, 32, 116, 
+101, 120, 116, 58, 108, 101, 118, 101, 108, 61, 34, 49, 34, 32, 116, 101, 
+120, 116, 58, 98, 117, 108, 108, 101, 116, 45, 99, 104, 97, 114, 61, 34, 
+32, 34, 62, 10, 9, 9, 9, 9, 9, 9, 9, 60, 115, 116, 121, 108, 
+101, 58, 108, 105, 115, 116, 45, 108, 101, 118, 101, 108, 45, 112, 114, 111, 
+112, 101, 114, 116, 105, 101, 115, 10, 9, 9, 9, 9, 9, 9, 9, 9, 
+116, 101, 120, 116, 58, 115, 112, 97, 99, 101, 45, 98, 101, 102, 111, 114, 
+101, 61, 34, 53, 109, 109, 34, 10, 9, 9, 9, 9, 9, 9, 9, 9, 
+116, 101, 120, 116, 58, 109, 105, 110, 45, 108, 97, 98, 101, 108, 45, 119, 
+105, 100, 116, 104, 61, 34, 53, 109, 109, 34, 47, 62, 10, 9, 9, 9, 
+9, 9, 9, 60, 47, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 108, 
+101, 118, 101, 108, 45, 115, 116, 121, 108, 101, 45, 98, 117, 108, 108, 101, 
+116, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 60, 47, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 
+115, 116, 121, 108, 101, 62, 10, 9, 9, 9, 9, 60, 47, 111, 102, 102, 
+105, 99, 101, 58, 115, 116, 121, 108, 101, 115, 62, 10, 9, 9, 9, 60, 
+47, 111, 102, 102, 105, 99, 101, 58, 100, 111, 99, 117, 109, 101, 110, 116, 
+45, 115, 116, 121, 108, 101, 115, 62, 10, 9, 9, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 115, 101, 116, 116, 105, 110, 103, 115, 46, 120, 109, 
+108, 0, 4, 162, 0, 0, 0, 0, 0, 0, 0, 60, 63, 120, 109, 108, 
+32, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 34, 32, 101, 
+110, 99, 111, 100, 105, 110, 103, 61, 34, 85, 84, 70, 45, 56, 34, 63, 
+62, 10, 9, 9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 100, 111, 99, 
+117, 109, 101, 110, 116, 45, 115, 101, 116, 116, 105, 110, 103, 115, 32, 111, 
+102, 102, 105, 99, 101, 58, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 
+46, 48, 34, 10, 9, 9, 9, 9, 120, 109, 108, 110, 115, 58, 111, 102, 
+102, 105, 99, 101, 61, 34, 117, 114, 110, 58, 111, 97, 115, 105, 115, 58, 
+110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 112, 101, 110, 100, 111, 99, 
+117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 115, 58, 111, 102, 102, 105, 
+99, 101, 58, 49, 46, 48, 34, 47, 62, 10, 9, 9, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 109, 101, 116, 97, 46, 120, 109, 108, 0, 4, 
+158, 0, 0, 0, 0, 0, 0, 0, 60, 63, 120, 109, 108, 32, 118, 101, 
+114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 34, 32, 101, 110, 99, 111, 
+100, 105, 110, 103, 61, 34, 85, 84, 70, 45, 56, 34, 63, 62, 10, 9, 
+9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 100, 111, 99, 117, 109, 101, 
+110, 116, 45, 109, 101, 116, 97, 32, 111, 102, 102, 105, 99, 101, 58, 118, 
+101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 34, 10, 9, 9, 9, 
+9, 120, 109, 108, 110, 115, 58, 111, 102, 102, 105, 99, 101, 61, 34, 117, 
+114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 
+99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 
+109, 108, 110, 115, 58, 111, 102, 102, 105, 99, 101, 58, 49, 46, 48, 34, 
+47, 62, 10, 9, 9, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 
+114, 105, 116, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 
+97, 105, 114, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 111, 112, 
+101, 110, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 116, 
+101, 110, 116, 46, 120, 109, 108, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 99, 108, 111, 115, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+97, 112, 112, 101, 110, 100, 0, 2, 0, 0, 0, 59, 1, 0, 0, 64, 
+1, 0, 0, 0, 1, 3, 15, 0, 0, 0, 5, 0, 0, 0, 69, 0, 
+128, 0, 166, 0, 0, 0, 29, 128, 0, 0, 69, 0, 0, 1, 25, 0, 
+128, 0, 23, 128, 1, 128, 5, 0, 128, 1, 12, 0, 64, 0, 133, 0, 
+128, 0, 29, 64, 128, 1, 5, 0, 128, 0, 12, 64, 64, 0, 29, 64, 
+0, 1, 31, 0, 128, 0, 2, 0, 0, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 97, 112, 112, 101, 110, 100, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 99, 108, 101, 97, 114, 0, 0, 0, 0, 0, 4, 0, 0, 
+0, 1, 5, 1, 4, 0, 3, 1, 2, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 1, 0, 
+0, 74, 1, 0, 0, 0, 0, 3, 20, 0, 0, 0, 5, 0, 0, 0, 
+12, 0, 64, 0, 133, 0, 128, 0, 29, 64, 128, 1, 5, 0, 0, 0, 
+12, 64, 64, 0, 29, 128, 0, 1, 69, 0, 0, 0, 76, 128, 192, 0, 
+93, 128, 0, 1, 28, 0, 128, 0, 23, 192, 255, 127, 27, 64, 0, 0, 
+23, 128, 0, 128, 68, 0, 0, 0, 133, 0, 0, 1, 95, 0, 128, 1, 
+67, 0, 128, 0, 95, 0, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 112, 112, 101, 110, 100, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 105, 115, 104, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 99, 108, 111, 115, 101, 0, 0, 
+0, 0, 0, 3, 0, 0, 0, 1, 2, 1, 4, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 4, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 2, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 79, 1, 0, 0, 119, 1, 0, 0, 3, 0, 11, 78, 0, 0, 0, 
+27, 64, 0, 0, 23, 128, 9, 128, 198, 0, 64, 0, 7, 64, 192, 1, 
+27, 0, 0, 0, 23, 128, 3, 128, 204, 128, 64, 0, 65, 193, 0, 0, 
+221, 128, 128, 1, 219, 64, 0, 0, 23, 192, 0, 128, 192, 0, 0, 0, 
+0, 1, 0, 1, 22, 0, 129, 1, 23, 128, 1, 128, 204, 0, 65, 0, 
+65, 193, 0, 0, 128, 1, 0, 1, 221, 128, 0, 2, 0, 0, 128, 1, 
+23, 0, 0, 128, 1, 64, 1, 0, 198, 128, 65, 0, 0, 1, 128, 0, 
+65, 193, 1, 0, 131, 1, 128, 0, 192, 1, 0, 0, 221, 128, 128, 2, 
+0, 0, 128, 1, 27, 64, 0, 0, 23, 64, 0, 128, 195, 0, 0, 0, 
+223, 0, 0, 1, 204, 128, 64, 0, 65, 1, 2, 0, 221, 128, 128, 1, 
+219, 0, 0, 0, 23, 128, 0, 128, 192, 0, 0, 0, 0, 1, 0, 1, 
+22, 0, 129, 1, 198, 64, 66, 0, 1, 129, 2, 0, 221, 64, 0, 1, 
+197, 0, 128, 0, 0, 1, 0, 0, 221, 192, 0, 1, 67, 1, 0, 0, 
+219, 0, 0, 0, 23, 64, 2, 128, 134, 193, 66, 0, 198, 1, 64, 0, 
+5, 2, 0, 1, 64, 2, 128, 1, 134, 2, 64, 0, 29, 2, 128, 1, 
+157, 65, 0, 0, 128, 1, 0, 2, 157, 129, 128, 0, 64, 1, 0, 3, 
+91, 65, 0, 0, 23, 128, 2, 128, 134, 1, 67, 0, 196, 1, 0, 0, 
+1, 66, 3, 0, 64, 2, 0, 0, 129, 130, 3, 0, 22, 130, 2, 4, 
+157, 65, 128, 1, 134, 193, 67, 0, 157, 65, 128, 0, 131, 1, 0, 0, 
+159, 1, 0, 1, 134, 193, 67, 0, 157, 65, 128, 0, 131, 1, 128, 0, 
+159, 1, 0, 1, 31, 0, 128, 0, 16, 0, 0, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 37, 46, 46, 45, 36, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 103, 115, 117, 98, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+40, 117, 110, 110, 97, 109, 101, 100, 41, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 0, 4, 
+11, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 32, 97, 
+115, 58, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 47, 91, 94, 46, 
+93, 42, 36, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 109, 
+101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 0, 4, 13, 
+0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 105, 110, 103, 
+46, 46, 46, 0, 4, 25, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 
+111, 114, 116, 70, 105, 108, 101, 85, 115, 105, 110, 103, 67, 97, 108, 108, 
+98, 97, 99, 107, 115, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 
+111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 32, 0, 0, 
+0, 0, 0, 0, 0, 85, 110, 97, 98, 108, 101, 32, 116, 111, 32, 111, 
+112, 101, 110, 32, 116, 104, 101, 32, 111, 117, 116, 112, 117, 116, 32, 102, 
+105, 108, 101, 32, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 46, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 
+100, 114, 97, 119, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 
+7, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 121, 1, 0, 0, 123, 1, 0, 0, 1, 
+0, 5, 7, 0, 0, 0, 69, 0, 0, 0, 128, 0, 0, 0, 193, 0, 
+0, 0, 1, 65, 0, 0, 94, 0, 0, 2, 95, 0, 0, 0, 31, 0, 
+128, 0, 2, 0, 0, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 69, 
+120, 112, 111, 114, 116, 32, 79, 68, 84, 32, 70, 105, 108, 101, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 46, 111, 100, 116, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 1, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/import.lua */
+static const char file_22[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 15, 35, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 128, 192, 
+0, 134, 0, 64, 0, 135, 192, 64, 1, 198, 0, 64, 0, 199, 0, 193, 
+1, 6, 1, 64, 0, 7, 65, 65, 2, 70, 1, 64, 0, 71, 129, 193, 
+2, 134, 193, 65, 0, 135, 1, 66, 3, 198, 193, 65, 0, 199, 65, 194, 
+3, 6, 194, 65, 0, 7, 130, 66, 4, 70, 194, 65, 0, 71, 194, 194, 
+4, 134, 2, 67, 0, 135, 66, 67, 5, 198, 2, 67, 0, 199, 130, 195, 
+5, 6, 3, 67, 0, 7, 195, 67, 6, 70, 3, 68, 0, 71, 67, 196, 
+6, 165, 3, 0, 0, 8, 128, 3, 137, 165, 67, 0, 0, 8, 128, 131, 
+137, 165, 131, 0, 0, 8, 128, 3, 138, 31, 0, 128, 0, 21, 0, 0, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 73, 84, 65, 76, 73, 67, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 85, 78, 68, 69, 82, 76, 73, 78, 69, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 115, 101, 119, 111, 
+114, 100, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 119, 114, 105, 116, 
+101, 117, 56, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 98, 101, 103, 
+105, 110, 97, 114, 101, 110, 97, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 101, 110, 100, 97, 114, 101, 110, 97, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 98, 105, 116, 51, 50, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 98, 97, 110, 100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+98, 111, 114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 120, 111, 
+114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 98, 116, 101, 115, 116, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 114, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 115, 117, 98, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 99, 111, 110, 99, 97, 116, 0, 4, 21, 0, 0, 0, 0, 0, 
+0, 0, 80, 97, 114, 115, 101, 83, 116, 114, 105, 110, 103, 73, 110, 116, 
+111, 87, 111, 114, 100, 115, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 
+67, 114, 101, 97, 116, 101, 73, 109, 112, 111, 114, 116, 101, 114, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 70, 105, 
+108, 101, 87, 105, 116, 104, 85, 73, 0, 3, 0, 0, 0, 20, 0, 0, 
+0, 29, 0, 0, 0, 1, 0, 8, 19, 0, 0, 0, 75, 0, 0, 0, 
+140, 0, 64, 0, 1, 65, 0, 0, 157, 0, 129, 1, 23, 128, 0, 128, 
+149, 1, 128, 0, 141, 129, 64, 3, 74, 64, 1, 3, 162, 64, 0, 0, 
+35, 129, 254, 127, 149, 0, 128, 0, 24, 192, 64, 1, 23, 192, 0, 128, 
+139, 0, 128, 0, 193, 0, 1, 0, 164, 64, 128, 0, 159, 0, 0, 1, 
+95, 0, 0, 1, 31, 0, 128, 0, 5, 0, 0, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 103, 109, 97, 116, 99, 104, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 91, 94, 32, 9, 13, 10, 93, 43, 0, 3, 0, 
+0, 0, 0, 0, 0, 240, 63, 3, 0, 0, 0, 0, 0, 0, 0, 0, 
+4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 89, 0, 0, 0, 1, 0, 
+7, 16, 0, 0, 0, 68, 0, 128, 1, 75, 129, 1, 0, 165, 1, 0, 
+0, 74, 129, 1, 128, 165, 65, 0, 0, 74, 129, 129, 128, 165, 129, 0, 
+0, 74, 129, 1, 129, 165, 193, 0, 0, 74, 129, 129, 129, 165, 1, 1, 
+0, 74, 129, 1, 130, 165, 65, 1, 0, 74, 129, 129, 130, 95, 1, 0, 
+1, 31, 0, 128, 0, 6, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 114, 101, 115, 101, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 115, 116, 121, 108, 101, 95, 111, 110, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 121, 108, 101, 95, 111, 102, 102, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 116, 101, 120, 116, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 102, 108, 117, 115, 104, 119, 111, 114, 100, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 102, 108, 117, 115, 104, 112, 97, 114, 97, 
+103, 114, 97, 112, 104, 0, 6, 0, 0, 0, 41, 0, 0, 0, 46, 0, 
+0, 0, 1, 0, 2, 9, 0, 0, 0, 75, 0, 0, 0, 73, 0, 0, 
+0, 75, 0, 0, 0, 73, 0, 128, 0, 65, 0, 0, 0, 73, 0, 0, 
+1, 65, 0, 0, 0, 73, 0, 128, 1, 31, 0, 128, 0, 1, 0, 0, 
+0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 
+0, 0, 1, 1, 1, 2, 1, 3, 1, 4, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 
+0, 0, 50, 0, 0, 0, 2, 0, 5, 6, 0, 0, 0, 133, 0, 128, 
+0, 197, 0, 0, 0, 0, 1, 128, 0, 157, 128, 128, 1, 137, 0, 0, 
+0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 
+0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 54, 0, 0, 
+0, 2, 0, 6, 9, 0, 0, 0, 133, 0, 128, 0, 197, 0, 0, 1, 
+5, 1, 0, 0, 64, 1, 128, 0, 221, 128, 128, 1, 0, 1, 128, 0, 
+157, 128, 128, 1, 137, 0, 0, 0, 31, 0, 128, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 3, 0, 0, 0, 1, 4, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 56, 0, 0, 0, 63, 0, 0, 0, 2, 0, 5, 19, 0, 0, 
+0, 133, 0, 0, 0, 197, 0, 128, 0, 88, 192, 0, 1, 23, 64, 2, 
+128, 133, 0, 0, 1, 149, 0, 0, 1, 141, 0, 64, 1, 197, 0, 128, 
+1, 5, 1, 128, 0, 13, 1, 129, 128, 221, 128, 0, 1, 136, 192, 0, 
+1, 133, 0, 128, 0, 137, 0, 0, 0, 133, 0, 0, 1, 149, 0, 0, 
+1, 141, 0, 64, 1, 136, 64, 0, 1, 31, 0, 128, 0, 2, 0, 0, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 3, 0, 0, 0, 0, 0, 
+0, 48, 64, 0, 0, 0, 0, 4, 0, 0, 0, 1, 3, 1, 4, 1, 
+2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 72, 0, 0, 0, 2, 
+0, 4, 18, 0, 0, 0, 133, 0, 0, 0, 149, 0, 0, 1, 89, 128, 
+0, 128, 23, 64, 0, 128, 91, 0, 0, 0, 23, 128, 2, 128, 133, 0, 
+128, 0, 197, 0, 0, 0, 157, 128, 0, 1, 197, 0, 0, 1, 213, 0, 
+128, 1, 205, 64, 192, 1, 136, 128, 128, 1, 203, 0, 0, 0, 201, 0, 
+0, 0, 193, 0, 0, 0, 201, 0, 128, 1, 31, 0, 128, 0, 2, 0, 
+0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 0, 0, 0, 0, 4, 0, 0, 0, 1, 2, 0, 3, 
+1, 1, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 87, 0, 0, 0, 
+2, 0, 6, 26, 0, 0, 0, 91, 64, 0, 0, 23, 0, 0, 128, 65, 
+0, 0, 0, 133, 0, 0, 0, 149, 0, 0, 1, 25, 128, 128, 128, 23, 
+64, 0, 128, 140, 128, 64, 0, 157, 64, 0, 1, 133, 0, 128, 0, 149, 
+0, 0, 1, 25, 128, 128, 128, 23, 192, 2, 128, 134, 192, 64, 1, 198, 
+0, 65, 1, 199, 64, 193, 1, 199, 64, 128, 1, 5, 1, 128, 0, 157, 
+128, 128, 1, 197, 0, 128, 1, 204, 128, 193, 1, 64, 1, 0, 1, 221, 
+64, 128, 1, 203, 0, 0, 0, 201, 0, 128, 0, 31, 0, 128, 0, 7, 
+0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 3, 0, 
+0, 0, 0, 0, 0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+102, 108, 117, 115, 104, 119, 111, 114, 100, 0, 4, 16, 0, 0, 0, 0, 
+0, 0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 
+109, 101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 115, 116, 121, 108, 101, 115, 0, 4, 16, 0, 0, 0, 0, 0, 0, 
+0, 97, 112, 112, 101, 110, 100, 80, 97, 114, 97, 103, 114, 97, 112, 104, 
+0, 0, 0, 0, 0, 4, 0, 0, 0, 1, 2, 1, 1, 0, 4, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 5, 0, 0, 0, 1, 7, 1, 8, 1, 10, 1, 
+13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 154, 0, 0, 0, 3, 
+0, 11, 93, 0, 0, 0, 27, 64, 0, 0, 23, 64, 2, 128, 198, 0, 
+64, 0, 0, 1, 128, 0, 65, 65, 0, 0, 131, 1, 0, 0, 221, 128, 
+0, 2, 0, 0, 128, 1, 27, 64, 0, 0, 23, 64, 0, 128, 195, 0, 
+0, 0, 223, 0, 0, 1, 198, 128, 64, 0, 1, 193, 0, 0, 221, 64, 
+0, 1, 198, 0, 65, 0, 199, 64, 193, 1, 0, 1, 0, 0, 221, 128, 
+0, 1, 219, 64, 0, 0, 23, 64, 0, 128, 4, 1, 0, 0, 31, 1, 
+0, 1, 5, 1, 128, 0, 29, 65, 128, 0, 6, 129, 65, 0, 64, 1, 
+0, 1, 134, 193, 65, 0, 192, 1, 128, 1, 29, 193, 0, 2, 133, 1, 
+0, 1, 157, 65, 128, 0, 27, 65, 0, 0, 23, 64, 1, 128, 140, 1, 
+194, 1, 157, 65, 0, 1, 134, 65, 66, 0, 192, 1, 128, 2, 1, 130, 
+2, 0, 157, 65, 128, 1, 91, 65, 0, 0, 23, 192, 1, 128, 134, 193, 
+66, 0, 196, 1, 0, 0, 1, 2, 3, 0, 157, 65, 128, 1, 134, 65, 
+67, 0, 157, 65, 128, 0, 131, 1, 0, 0, 159, 1, 0, 1, 140, 1, 
+194, 1, 157, 65, 0, 1, 149, 1, 128, 2, 25, 128, 1, 135, 23, 128, 
+0, 128, 140, 193, 195, 2, 1, 130, 3, 0, 157, 65, 128, 1, 134, 1, 
+68, 0, 192, 1, 0, 0, 157, 129, 0, 1, 198, 65, 68, 0, 199, 129, 
+196, 3, 199, 129, 129, 3, 219, 1, 0, 0, 23, 0, 3, 128, 193, 129, 
+3, 0, 0, 2, 0, 3, 65, 194, 4, 0, 128, 2, 128, 3, 22, 130, 
+2, 4, 70, 66, 68, 0, 71, 130, 196, 4, 71, 2, 130, 4, 91, 66, 
+0, 0, 23, 128, 253, 127, 128, 1, 0, 4, 23, 0, 0, 128, 23, 192, 
+252, 127, 198, 65, 68, 0, 204, 1, 197, 3, 64, 2, 128, 2, 128, 2, 
+0, 3, 221, 65, 0, 2, 198, 65, 68, 0, 204, 65, 197, 3, 64, 2, 
+0, 3, 221, 65, 128, 1, 198, 65, 67, 0, 221, 65, 128, 0, 195, 1, 
+128, 0, 223, 1, 0, 1, 31, 0, 128, 0, 22, 0, 0, 0, 4, 12, 
+0, 0, 0, 0, 0, 0, 0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 
+101, 114, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
+114, 116, 32, 102, 114, 111, 109, 58, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 
+103, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
+114, 116, 105, 110, 103, 46, 46, 46, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 105, 111, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 111, 112, 
+101, 110, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 120, 112, 99, 97, 
+108, 108, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 84, 114, 97, 99, 
+101, 98, 97, 99, 107, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 99, 
+108, 111, 115, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 101, 114, 
+114, 111, 114, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 
+103, 101, 0, 4, 65, 0, 0, 0, 0, 0, 0, 0, 84, 104, 101, 32, 
+105, 109, 112, 111, 114, 116, 32, 102, 97, 105, 108, 101, 100, 44, 32, 112, 
+114, 111, 98, 97, 98, 108, 121, 32, 98, 101, 99, 97, 117, 115, 101, 32, 
+116, 104, 101, 32, 102, 105, 108, 101, 32, 99, 111, 117, 108, 100, 32, 110, 
+111, 116, 32, 98, 101, 32, 102, 111, 117, 110, 100, 46, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 18, 0, 0, 0, 
+0, 0, 0, 0, 100, 101, 108, 101, 116, 101, 80, 97, 114, 97, 103, 114, 
+97, 112, 104, 65, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 76, 
+101, 97, 102, 110, 97, 109, 101, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 100, 111, 99, 117, 109, 101, 110, 116, 115, 0, 
+4, 2, 0, 0, 0, 0, 0, 0, 0, 45, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 97, 100, 100, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 67, 117, 114, 114, 
+101, 110, 116, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 4, 
+1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+};
+
+/* This is src/lua/import/html.lua */
+static const char file_23[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 17, 33, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 128, 192, 
+0, 134, 0, 64, 0, 135, 192, 64, 1, 198, 0, 64, 0, 199, 0, 193, 
+1, 6, 1, 64, 0, 7, 65, 65, 2, 70, 129, 65, 0, 71, 193, 193, 
+2, 134, 129, 65, 0, 135, 1, 66, 3, 198, 129, 65, 0, 199, 65, 194, 
+3, 6, 130, 65, 0, 7, 130, 66, 4, 70, 194, 66, 0, 71, 2, 195, 
+4, 134, 194, 66, 0, 135, 66, 67, 5, 198, 194, 66, 0, 199, 130, 195, 
+5, 6, 195, 67, 0, 7, 3, 68, 6, 70, 3, 64, 0, 71, 67, 196, 
+6, 165, 3, 0, 0, 198, 131, 68, 0, 37, 68, 0, 0, 202, 3, 132, 
+137, 31, 0, 128, 0, 20, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 119, 103, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 73, 84, 
+65, 76, 73, 67, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 85, 78, 
+68, 69, 82, 76, 73, 78, 69, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 66, 79, 76, 68, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 112, 
+97, 114, 115, 101, 119, 111, 114, 100, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 119, 114, 105, 116, 101, 117, 56, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 98, 105, 116, 51, 50, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 98, 97, 110, 100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+98, 111, 114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 120, 111, 
+114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 98, 116, 101, 115, 116, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 114, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 115, 117, 98, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 99, 111, 110, 99, 97, 116, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 116, 111, 107, 101, 110, 105, 115, 101, 104, 116, 109, 108, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 72, 84, 77, 76, 70, 
+105, 108, 101, 0, 2, 0, 0, 0, 23, 0, 0, 0, 129, 0, 0, 0, 
+1, 0, 23, 126, 0, 0, 0, 76, 0, 64, 0, 193, 64, 0, 0, 93, 
+128, 128, 1, 134, 128, 64, 0, 192, 0, 128, 0, 157, 128, 0, 1, 64, 
+0, 0, 1, 133, 0, 128, 0, 192, 0, 128, 0, 6, 193, 64, 0, 157, 
+128, 128, 1, 195, 0, 0, 0, 0, 1, 0, 1, 68, 1, 128, 0, 23, 
+64, 1, 128, 24, 0, 193, 3, 23, 192, 0, 128, 24, 64, 65, 4, 23, 
+64, 0, 128, 195, 0, 128, 0, 23, 64, 0, 128, 34, 129, 0, 0, 163, 
+193, 253, 127, 219, 64, 0, 0, 23, 0, 1, 128, 5, 1, 128, 0, 64, 
+1, 128, 0, 134, 193, 64, 0, 29, 129, 128, 1, 128, 0, 0, 2, 6, 
+129, 65, 0, 29, 129, 128, 0, 70, 193, 65, 0, 128, 1, 0, 2, 93, 
+129, 0, 1, 129, 1, 2, 0, 195, 1, 0, 0, 37, 2, 0, 0, 101, 
+66, 0, 0, 165, 130, 0, 0, 203, 2, 3, 0, 202, 2, 130, 132, 202, 
+130, 2, 133, 37, 195, 0, 0, 202, 2, 131, 133, 37, 3, 1, 0, 202, 
+2, 3, 134, 37, 67, 1, 0, 202, 2, 131, 134, 37, 131, 1, 0, 202, 
+2, 3, 135, 37, 195, 1, 0, 202, 2, 131, 135, 37, 3, 2, 0, 202, 
+2, 3, 136, 37, 67, 2, 0, 202, 2, 131, 136, 37, 131, 2, 0, 202, 
+2, 3, 137, 37, 195, 2, 0, 202, 2, 131, 137, 37, 3, 3, 0, 202, 
+2, 3, 138, 11, 67, 2, 0, 10, 3, 130, 133, 10, 3, 2, 134, 10, 
+3, 130, 134, 10, 3, 2, 135, 101, 67, 3, 0, 10, 67, 3, 136, 101, 
+131, 3, 0, 10, 67, 131, 136, 101, 195, 3, 0, 10, 67, 3, 137, 101, 
+3, 4, 0, 10, 67, 131, 137, 101, 67, 4, 0, 10, 67, 3, 138, 76, 
+67, 197, 2, 93, 67, 0, 1, 64, 3, 0, 1, 132, 3, 128, 0, 23, 
+0, 9, 128, 24, 128, 69, 8, 23, 192, 0, 128, 140, 132, 197, 2, 0, 
+5, 128, 8, 157, 68, 128, 1, 23, 128, 7, 128, 24, 192, 69, 8, 23, 
+192, 1, 128, 129, 4, 6, 0, 192, 4, 128, 8, 1, 5, 6, 0, 161, 
+68, 0, 128, 128, 5, 128, 4, 157, 69, 128, 0, 160, 4, 255, 127, 23, 
+0, 5, 128, 24, 64, 70, 8, 23, 0, 2, 128, 219, 1, 0, 0, 23, 
+192, 0, 128, 128, 4, 0, 4, 157, 68, 128, 0, 129, 129, 6, 0, 23, 
+0, 3, 128, 128, 4, 128, 4, 157, 68, 128, 0, 23, 64, 2, 128, 132, 
+4, 0, 0, 24, 0, 65, 8, 23, 64, 0, 128, 135, 68, 132, 5, 23, 
+0, 0, 128, 135, 68, 4, 6, 155, 4, 0, 0, 23, 64, 0, 128, 192, 
+4, 0, 9, 221, 68, 128, 0, 98, 131, 0, 0, 227, 3, 246, 127, 64, 
+3, 0, 4, 93, 67, 128, 0, 31, 1, 0, 1, 31, 0, 128, 0, 27, 
+0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 100, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 42, 97, 0, 4, 19, 0, 
+0, 0, 0, 0, 0, 0, 67, 97, 110, 111, 110, 105, 99, 97, 108, 105, 
+115, 101, 83, 116, 114, 105, 110, 103, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 72, 84, 77, 76, 69, 110, 116, 105, 116, 105, 101, 115, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 111, 112, 101, 110, 116, 97, 103, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 111, 100, 121, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 67, 
+114, 101, 97, 116, 101, 73, 109, 112, 111, 114, 116, 101, 114, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 98, 114, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 104, 49, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 104, 50, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 104, 51, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 104, 52, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 108, 105, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 105, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+101, 109, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 117, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 98, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 112, 114, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 114, 
+101, 115, 101, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 101, 
+120, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 112, 97, 99, 
+101, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 110, 101, 119, 108, 105, 110, 101, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 80, 82, 69, 0, 18, 0, 0, 0, 52, 0, 0, 
+0, 55, 0, 0, 0, 0, 0, 3, 7, 0, 0, 0, 5, 0, 0, 0, 
+12, 0, 64, 0, 133, 0, 128, 0, 29, 64, 128, 1, 1, 64, 0, 0, 
+9, 0, 128, 0, 31, 0, 128, 0, 2, 0, 0, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 102, 108, 117, 115, 104, 112, 97, 114, 97, 103, 114, 
+97, 112, 104, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 1, 5, 1, 6, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 
+0, 0, 0, 59, 0, 0, 0, 0, 0, 3, 5, 0, 0, 0, 5, 0, 
+0, 0, 12, 0, 64, 0, 133, 0, 128, 0, 29, 64, 128, 1, 31, 0, 
+128, 0, 1, 0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 102, 
+108, 117, 115, 104, 119, 111, 114, 100, 0, 0, 0, 0, 0, 2, 0, 0, 
+0, 1, 5, 1, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0, 66, 0, 0, 
+0, 0, 0, 2, 8, 0, 0, 0, 5, 0, 0, 0, 29, 64, 128, 0, 
+5, 0, 128, 0, 27, 0, 0, 0, 23, 64, 0, 128, 1, 0, 0, 0, 
+9, 0, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 80, 82, 69, 0, 0, 0, 0, 0, 3, 0, 0, 
+0, 1, 8, 1, 7, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 72, 
+0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 5, 0, 0, 0, 29, 64, 
+128, 0, 1, 0, 0, 0, 9, 0, 128, 0, 31, 0, 128, 0, 1, 0, 
+0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 49, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 1, 8, 1, 6, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 
+0, 0, 73, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 5, 0, 0, 
+0, 29, 64, 128, 0, 1, 0, 0, 0, 9, 0, 128, 0, 31, 0, 128, 
+0, 1, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 72, 50, 
+0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 8, 1, 6, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 74, 0, 0, 0, 74, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 
+5, 0, 0, 0, 29, 64, 128, 0, 1, 0, 0, 0, 9, 0, 128, 0, 
+31, 0, 128, 0, 1, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 72, 51, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 8, 1, 6, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 75, 0, 0, 0, 75, 0, 0, 0, 0, 0, 2, 5, 
+0, 0, 0, 5, 0, 0, 0, 29, 64, 128, 0, 1, 0, 0, 0, 9, 
+0, 128, 0, 31, 0, 128, 0, 1, 0, 0, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 72, 52, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 
+8, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 76, 0, 0, 0, 0, 
+0, 2, 5, 0, 0, 0, 5, 0, 0, 0, 29, 64, 128, 0, 1, 0, 
+0, 0, 9, 0, 128, 0, 31, 0, 128, 0, 1, 0, 0, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 76, 66, 0, 0, 0, 0, 0, 2, 0, 
+0, 0, 1, 8, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 77, 0, 
+0, 0, 0, 0, 3, 5, 0, 0, 0, 5, 0, 0, 0, 12, 0, 64, 
+0, 133, 0, 128, 0, 29, 64, 128, 1, 31, 0, 128, 0, 1, 0, 0, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 95, 
+111, 110, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 5, 0, 2, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 78, 0, 0, 0, 78, 0, 0, 0, 0, 0, 3, 5, 0, 
+0, 0, 5, 0, 0, 0, 12, 0, 64, 0, 133, 0, 128, 0, 29, 64, 
+128, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 121, 108, 101, 95, 111, 110, 0, 0, 0, 0, 0, 
+2, 0, 0, 0, 1, 5, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0, 
+79, 0, 0, 0, 0, 0, 3, 5, 0, 0, 0, 5, 0, 0, 0, 12, 
+0, 64, 0, 133, 0, 128, 0, 29, 64, 128, 1, 31, 0, 128, 0, 1, 
+0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 
+101, 95, 111, 110, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 5, 0, 
+3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 80, 0, 0, 0, 80, 0, 0, 0, 0, 0, 3, 
+5, 0, 0, 0, 5, 0, 0, 0, 12, 0, 64, 0, 133, 0, 128, 0, 
+29, 64, 128, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 95, 111, 110, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 1, 5, 0, 4, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 
+0, 0, 81, 0, 0, 0, 0, 0, 2, 7, 0, 0, 0, 5, 0, 0, 
+0, 29, 64, 128, 0, 1, 0, 0, 0, 9, 0, 128, 0, 3, 0, 128, 
+0, 9, 0, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 80, 82, 69, 0, 0, 0, 0, 0, 3, 0, 
+0, 0, 1, 8, 1, 6, 1, 7, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 
+90, 0, 0, 0, 0, 0, 3, 5, 0, 0, 0, 5, 0, 0, 0, 12, 
+0, 64, 0, 133, 0, 128, 0, 29, 64, 128, 1, 31, 0, 128, 0, 1, 
+0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 
+101, 95, 111, 102, 102, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 5, 
+0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 91, 0, 0, 0, 91, 0, 0, 0, 0, 0, 
+3, 5, 0, 0, 0, 5, 0, 0, 0, 12, 0, 64, 0, 133, 0, 128, 
+0, 29, 64, 128, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 95, 111, 102, 102, 0, 
+0, 0, 0, 0, 2, 0, 0, 0, 1, 5, 0, 2, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+92, 0, 0, 0, 92, 0, 0, 0, 0, 0, 3, 5, 0, 0, 0, 5, 
+0, 0, 0, 12, 0, 64, 0, 133, 0, 128, 0, 29, 64, 128, 1, 31, 
+0, 128, 0, 1, 0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+115, 116, 121, 108, 101, 95, 111, 102, 102, 0, 0, 0, 0, 0, 2, 0, 
+0, 0, 1, 5, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 93, 0, 
+0, 0, 0, 0, 3, 5, 0, 0, 0, 5, 0, 0, 0, 12, 0, 64, 
+0, 133, 0, 128, 0, 29, 64, 128, 1, 31, 0, 128, 0, 1, 0, 0, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 95, 
+111, 102, 102, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 5, 0, 4, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 94, 0, 0, 0, 94, 0, 0, 0, 0, 0, 2, 5, 
+0, 0, 0, 5, 0, 0, 0, 29, 64, 128, 0, 3, 0, 0, 0, 9, 
+0, 128, 0, 31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 1, 8, 1, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+0, 1, 13, 1, 0, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 0, 0, 
+0, 133, 0, 0, 0, 1, 0, 5, 7, 0, 0, 0, 70, 0, 64, 0, 
+128, 0, 0, 0, 193, 64, 0, 0, 5, 1, 128, 0, 94, 0, 0, 2, 
+95, 0, 0, 0, 31, 0, 128, 0, 2, 0, 0, 0, 4, 17, 0, 0, 
+0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 70, 105, 108, 101, 87, 
+105, 116, 104, 85, 73, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 
+109, 112, 111, 114, 116, 32, 72, 84, 77, 76, 32, 70, 105, 108, 101, 0, 
+0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 14, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/import/text.lua */
+static const char file_24[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 15, 29, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 128, 192, 
+0, 134, 0, 64, 0, 135, 192, 64, 1, 198, 0, 64, 0, 199, 0, 193, 
+1, 6, 65, 65, 0, 7, 129, 65, 2, 70, 65, 65, 0, 71, 193, 193, 
+2, 134, 65, 65, 0, 135, 1, 66, 3, 198, 65, 65, 0, 199, 65, 194, 
+3, 6, 130, 66, 0, 7, 194, 66, 4, 70, 130, 66, 0, 71, 2, 195, 
+4, 134, 130, 66, 0, 135, 66, 67, 5, 198, 130, 67, 0, 199, 194, 195, 
+5, 37, 3, 0, 0, 70, 3, 68, 0, 165, 67, 0, 0, 74, 131, 131, 
+136, 31, 0, 128, 0, 18, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 119, 103, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 73, 84, 
+65, 76, 73, 67, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 85, 78, 
+68, 69, 82, 76, 73, 78, 69, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 112, 97, 114, 115, 101, 119, 111, 114, 100, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 119, 114, 105, 116, 101, 117, 56, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 98, 105, 116, 51, 50, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 98, 97, 110, 100, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 98, 111, 114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 
+120, 111, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 98, 116, 101, 
+115, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 
+110, 103, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 114, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 115, 117, 98, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 99, 111, 110, 99, 97, 116, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 67, 109, 100, 0, 4, 15, 0, 0, 0, 0, 0, 0, 
+0, 73, 109, 112, 111, 114, 116, 84, 101, 120, 116, 70, 105, 108, 101, 0, 
+2, 0, 0, 0, 21, 0, 0, 0, 31, 0, 0, 0, 1, 0, 10, 29, 
+0, 0, 0, 70, 0, 64, 0, 93, 128, 128, 0, 140, 64, 64, 0, 157, 
+0, 1, 1, 23, 192, 4, 128, 134, 129, 64, 0, 192, 1, 128, 2, 157, 
+129, 0, 1, 64, 1, 0, 3, 140, 193, 192, 2, 1, 2, 1, 0, 65, 
+66, 1, 0, 157, 129, 0, 2, 64, 1, 0, 3, 134, 129, 65, 0, 198, 
+193, 65, 0, 199, 1, 194, 3, 199, 65, 194, 3, 6, 130, 66, 0, 64, 
+2, 128, 2, 29, 2, 0, 1, 157, 129, 0, 0, 204, 193, 194, 0, 64, 
+2, 0, 3, 221, 65, 128, 1, 162, 64, 0, 0, 35, 65, 250, 127, 95, 
+0, 0, 1, 31, 0, 128, 0, 12, 0, 0, 0, 4, 15, 0, 0, 0, 
+0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 109, 101, 
+110, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 105, 110, 101, 
+115, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 67, 97, 110, 111, 110, 
+105, 99, 97, 108, 105, 115, 101, 83, 116, 114, 105, 110, 103, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 103, 115, 117, 98, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 37, 99, 43, 0, 4, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 
+116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 115, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 21, 0, 0, 
+0, 0, 0, 0, 0, 80, 97, 114, 115, 101, 83, 116, 114, 105, 110, 103, 
+73, 110, 116, 111, 87, 111, 114, 100, 115, 0, 4, 16, 0, 0, 0, 0, 
+0, 0, 0, 97, 112, 112, 101, 110, 100, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 33, 0, 0, 0, 35, 0, 0, 0, 1, 0, 5, 7, 0, 0, 0, 
+70, 0, 64, 0, 128, 0, 0, 0, 193, 64, 0, 0, 5, 1, 128, 0, 
+94, 0, 0, 2, 95, 0, 0, 0, 31, 0, 128, 0, 2, 0, 0, 0, 
+4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 70, 
+105, 108, 101, 87, 105, 116, 104, 85, 73, 0, 4, 17, 0, 0, 0, 0, 
+0, 0, 0, 73, 109, 112, 111, 114, 116, 32, 84, 101, 120, 116, 32, 70, 
+105, 108, 101, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 12, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/import/opendocument.lua */
+static const char file_25[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 25, 43, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 128, 192, 
+0, 134, 0, 64, 0, 135, 192, 64, 1, 198, 0, 64, 0, 199, 0, 193, 
+1, 6, 1, 64, 0, 7, 65, 65, 2, 70, 1, 64, 0, 71, 129, 193, 
+2, 134, 1, 64, 0, 135, 193, 65, 3, 198, 1, 66, 0, 199, 65, 194, 
+3, 6, 2, 66, 0, 7, 130, 66, 4, 70, 2, 66, 0, 71, 194, 194, 
+4, 134, 2, 66, 0, 135, 2, 67, 5, 198, 66, 67, 0, 199, 130, 195, 
+5, 6, 67, 67, 0, 7, 195, 67, 6, 70, 67, 67, 0, 71, 3, 196, 
+6, 134, 67, 67, 0, 135, 67, 68, 7, 198, 131, 68, 0, 199, 195, 196, 
+7, 1, 4, 5, 0, 65, 68, 5, 0, 129, 132, 5, 0, 193, 196, 5, 
+0, 37, 5, 0, 0, 101, 69, 0, 0, 165, 133, 0, 0, 198, 5, 70, 
+0, 37, 198, 0, 0, 202, 5, 134, 140, 31, 0, 128, 0, 26, 0, 0, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 73, 84, 65, 76, 73, 67, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 85, 78, 68, 69, 82, 76, 73, 78, 69, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 66, 79, 76, 68, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 115, 101, 119, 111, 114, 100, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 119, 114, 105, 116, 101, 117, 
+56, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 111, 112, 101, 110, 122, 
+105, 112, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 116, 111, 107, 101, 
+110, 105, 115, 101, 120, 109, 108, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 98, 105, 116, 51, 50, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+98, 97, 110, 100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 98, 111, 
+114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 120, 111, 114, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 98, 116, 101, 115, 116, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 114, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 115, 117, 98, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 103, 109, 97, 116, 99, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+99, 111, 110, 99, 97, 116, 0, 4, 49, 0, 0, 0, 0, 0, 0, 0, 
+117, 114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 
+116, 99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 
+120, 109, 108, 110, 115, 58, 111, 102, 102, 105, 99, 101, 58, 49, 46, 48, 
+0, 4, 48, 0, 0, 0, 0, 0, 0, 0, 117, 114, 110, 58, 111, 97, 
+115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 112, 101, 
+110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 115, 58, 
+115, 116, 121, 108, 101, 58, 49, 46, 48, 0, 4, 60, 0, 0, 0, 0, 
+0, 0, 0, 117, 114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 
+101, 115, 58, 116, 99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 
+110, 116, 58, 120, 109, 108, 110, 115, 58, 120, 115, 108, 45, 102, 111, 45, 
+99, 111, 109, 112, 97, 116, 105, 98, 108, 101, 58, 49, 46, 48, 0, 4, 
+47, 0, 0, 0, 0, 0, 0, 0, 117, 114, 110, 58, 111, 97, 115, 105, 
+115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 112, 101, 110, 100, 
+111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 115, 58, 116, 101, 
+120, 116, 58, 49, 46, 48, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+67, 109, 100, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 
+111, 114, 116, 79, 68, 84, 70, 105, 108, 101, 0, 4, 0, 0, 0, 30, 
+0, 0, 0, 48, 0, 0, 0, 1, 0, 10, 28, 0, 0, 0, 101, 0, 
+0, 0, 134, 0, 64, 0, 192, 0, 0, 0, 157, 0, 1, 1, 23, 192, 
+4, 128, 192, 1, 128, 0, 0, 2, 128, 2, 65, 66, 0, 0, 221, 129, 
+128, 1, 138, 193, 129, 128, 192, 1, 128, 0, 0, 2, 128, 2, 65, 130, 
+0, 0, 221, 129, 128, 1, 138, 193, 1, 129, 192, 1, 128, 0, 0, 2, 
+128, 2, 65, 194, 0, 0, 221, 129, 128, 1, 138, 193, 129, 129, 192, 1, 
+128, 0, 0, 2, 128, 2, 65, 2, 1, 0, 221, 129, 128, 1, 138, 193, 
+1, 130, 162, 128, 0, 0, 35, 65, 250, 127, 31, 0, 128, 0, 5, 0, 
+0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 112, 97, 105, 114, 115, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 117, 110, 100, 101, 114, 108, 105, 110, 
+101, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 101, 110, 
+116, 101, 100, 0, 1, 0, 0, 0, 31, 0, 0, 0, 40, 0, 0, 0, 
+2, 0, 6, 17, 0, 0, 0, 134, 0, 0, 0, 199, 64, 0, 1, 219, 
+0, 0, 0, 23, 64, 0, 128, 195, 0, 128, 0, 223, 0, 0, 1, 199, 
+0, 64, 1, 219, 0, 0, 0, 23, 0, 1, 128, 197, 0, 128, 0, 7, 
+1, 64, 1, 64, 1, 128, 0, 222, 0, 128, 1, 223, 0, 0, 0, 196, 
+0, 0, 0, 223, 0, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 101, 110, 116, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 65, 0, 0, 
+0, 2, 0, 10, 34, 0, 0, 0, 131, 0, 0, 0, 197, 0, 0, 0, 
+0, 1, 128, 0, 65, 1, 0, 0, 221, 128, 128, 1, 219, 0, 0, 0, 
+23, 0, 0, 128, 131, 0, 128, 0, 197, 0, 128, 0, 0, 1, 128, 0, 
+65, 65, 0, 0, 221, 0, 129, 1, 23, 0, 2, 128, 155, 0, 0, 0, 
+23, 128, 0, 128, 204, 129, 64, 0, 67, 2, 0, 0, 221, 65, 128, 1, 
+204, 193, 64, 0, 64, 2, 0, 3, 221, 65, 128, 1, 131, 0, 128, 0, 
+226, 64, 0, 0, 99, 1, 253, 127, 197, 0, 0, 0, 0, 1, 128, 0, 
+65, 1, 1, 0, 221, 128, 128, 1, 219, 0, 0, 0, 23, 128, 0, 128, 
+204, 128, 64, 0, 67, 1, 0, 0, 221, 64, 128, 1, 31, 0, 128, 0, 
+5, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 94, 32, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 37, 83, 43, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 102, 108, 117, 115, 104, 119, 111, 114, 100, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 101, 120, 116, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 32, 36, 0, 0, 0, 0, 0, 2, 0, 
+0, 0, 1, 12, 1, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 234, 0, 
+0, 0, 3, 0, 48, 56, 1, 0, 0, 197, 0, 0, 0, 1, 1, 0, 
+0, 214, 0, 129, 1, 5, 1, 0, 0, 65, 65, 0, 0, 22, 65, 1, 
+2, 69, 1, 0, 0, 129, 129, 0, 0, 86, 129, 129, 2, 133, 1, 0, 
+0, 193, 193, 0, 0, 150, 193, 1, 3, 197, 1, 128, 0, 1, 2, 1, 
+0, 214, 1, 130, 3, 5, 2, 128, 0, 65, 66, 1, 0, 22, 66, 2, 
+4, 69, 2, 128, 0, 129, 130, 1, 0, 86, 130, 130, 4, 133, 2, 128, 
+0, 193, 194, 1, 0, 150, 194, 2, 5, 197, 2, 128, 0, 1, 3, 2, 
+0, 214, 2, 131, 5, 5, 3, 0, 1, 65, 67, 2, 0, 22, 67, 3, 
+6, 69, 3, 0, 1, 129, 131, 2, 0, 86, 131, 131, 6, 133, 3, 128, 
+0, 193, 195, 2, 0, 150, 195, 3, 7, 197, 3, 0, 1, 1, 4, 3, 
+0, 214, 3, 132, 7, 5, 4, 128, 1, 65, 68, 3, 0, 22, 68, 4, 
+8, 69, 4, 128, 1, 129, 132, 3, 0, 86, 132, 132, 8, 133, 4, 128, 
+1, 193, 196, 3, 0, 150, 196, 4, 9, 197, 4, 128, 1, 1, 5, 4, 
+0, 214, 4, 133, 9, 5, 5, 128, 1, 65, 69, 4, 0, 22, 69, 5, 
+10, 69, 5, 128, 1, 129, 133, 4, 0, 86, 133, 133, 10, 133, 5, 128, 
+1, 193, 197, 4, 0, 150, 197, 5, 11, 197, 5, 128, 1, 1, 6, 5, 
+0, 214, 5, 134, 11, 11, 6, 0, 0, 75, 6, 0, 0, 129, 70, 5, 
+0, 193, 70, 5, 0, 5, 7, 0, 2, 64, 7, 0, 1, 29, 7, 1, 
+1, 23, 64, 59, 128, 25, 192, 134, 138, 23, 192, 1, 128, 24, 128, 197, 
+15, 23, 64, 0, 128, 205, 198, 197, 13, 23, 192, 57, 128, 24, 0, 198, 
+15, 23, 64, 57, 128, 206, 198, 197, 13, 23, 192, 56, 128, 24, 128, 197, 
+15, 23, 0, 44, 128, 192, 8, 0, 16, 1, 73, 6, 0, 64, 9, 128, 
+16, 214, 72, 137, 17, 0, 9, 0, 17, 71, 137, 6, 12, 129, 137, 6, 
+0, 196, 9, 0, 0, 91, 73, 0, 0, 23, 64, 0, 128, 129, 201, 6, 
+0, 23, 0, 39, 128, 24, 192, 198, 18, 23, 0, 3, 128, 24, 192, 128, 
+17, 23, 0, 1, 128, 129, 9, 7, 0, 5, 10, 128, 2, 64, 10, 0, 
+0, 29, 74, 0, 1, 23, 192, 36, 128, 88, 64, 129, 17, 23, 64, 0, 
+128, 24, 128, 129, 17, 23, 192, 35, 128, 129, 73, 7, 0, 23, 64, 35, 
+128, 24, 0, 199, 18, 23, 0, 1, 128, 24, 0, 129, 17, 23, 64, 34, 
+128, 129, 137, 7, 0, 193, 201, 7, 0, 23, 128, 33, 128, 24, 64, 199, 
+18, 23, 192, 2, 128, 24, 192, 129, 17, 23, 128, 32, 128, 129, 9, 8, 
+0, 11, 74, 0, 0, 71, 74, 2, 18, 10, 74, 138, 144, 192, 9, 0, 
+20, 7, 10, 2, 18, 27, 10, 0, 0, 23, 128, 30, 128, 10, 192, 9, 
+20, 23, 0, 30, 128, 24, 0, 200, 18, 23, 128, 5, 128, 7, 138, 134, 
+12, 24, 128, 130, 17, 23, 0, 3, 128, 71, 10, 3, 18, 24, 128, 200, 
+20, 23, 0, 0, 128, 10, 202, 72, 145, 71, 74, 3, 18, 24, 0, 201, 
+20, 23, 0, 0, 128, 10, 202, 72, 146, 71, 138, 3, 18, 24, 64, 201, 
+20, 23, 0, 26, 128, 10, 202, 72, 147, 23, 128, 25, 128, 24, 192, 130, 
+17, 23, 0, 25, 128, 71, 202, 3, 18, 91, 10, 0, 0, 23, 64, 24, 
+128, 10, 202, 200, 147, 23, 192, 23, 128, 24, 128, 199, 18, 23, 0, 9, 
+128, 24, 0, 132, 17, 23, 128, 3, 128, 7, 10, 5, 18, 27, 74, 0, 
+0, 23, 0, 0, 128, 1, 10, 10, 0, 7, 10, 10, 0, 27, 74, 0, 
+0, 23, 0, 0, 128, 11, 10, 0, 0, 129, 73, 10, 0, 199, 137, 134, 
+12, 71, 202, 73, 20, 91, 10, 0, 0, 23, 128, 19, 128, 193, 137, 10, 
+0, 23, 0, 19, 128, 24, 64, 132, 17, 23, 64, 3, 128, 6, 202, 74, 
+3, 71, 202, 4, 18, 91, 74, 0, 0, 23, 0, 0, 128, 65, 202, 5, 
+0, 29, 138, 0, 1, 25, 0, 10, 150, 23, 0, 0, 128, 1, 10, 11, 
+0, 129, 73, 10, 0, 65, 74, 11, 0, 128, 10, 0, 20, 214, 137, 138, 
+20, 23, 0, 15, 128, 24, 128, 132, 17, 23, 128, 14, 128, 129, 137, 11, 
+0, 23, 0, 14, 128, 24, 128, 203, 18, 23, 128, 0, 128, 129, 137, 7, 
+0, 193, 201, 11, 0, 23, 192, 12, 128, 88, 64, 202, 18, 23, 64, 0, 
+128, 24, 0, 204, 18, 23, 192, 11, 128, 129, 9, 12, 0, 24, 64, 133, 
+17, 23, 192, 3, 128, 6, 202, 74, 3, 71, 138, 5, 18, 91, 74, 0, 
+0, 23, 0, 0, 128, 65, 74, 5, 0, 29, 138, 0, 1, 13, 202, 69, 
+20, 65, 202, 5, 0, 128, 10, 0, 20, 193, 202, 5, 0, 97, 138, 0, 
+128, 76, 75, 204, 0, 195, 11, 0, 0, 93, 75, 128, 1, 96, 202, 254, 
+127, 23, 0, 7, 128, 24, 192, 133, 17, 23, 128, 6, 128, 7, 10, 5, 
+18, 27, 74, 0, 0, 23, 0, 0, 128, 1, 10, 10, 0, 7, 10, 10, 
+0, 27, 74, 0, 0, 23, 0, 0, 128, 11, 10, 0, 0, 71, 138, 72, 
+20, 91, 10, 0, 0, 23, 128, 0, 128, 76, 138, 204, 0, 197, 10, 128, 
+3, 93, 74, 128, 1, 71, 10, 73, 20, 91, 10, 0, 0, 23, 128, 0, 
+128, 76, 138, 204, 0, 197, 10, 0, 4, 93, 74, 128, 1, 71, 138, 73, 
+20, 91, 10, 0, 0, 23, 128, 0, 128, 76, 138, 204, 0, 197, 10, 128, 
+4, 93, 74, 128, 1, 192, 9, 0, 20, 24, 128, 70, 19, 23, 64, 0, 
+128, 193, 198, 5, 0, 23, 0, 13, 128, 141, 198, 69, 13, 10, 134, 9, 
+13, 74, 198, 9, 13, 23, 0, 12, 128, 24, 0, 198, 15, 23, 64, 8, 
+128, 199, 136, 6, 12, 7, 137, 134, 12, 24, 64, 202, 17, 23, 192, 0, 
+128, 76, 201, 204, 0, 192, 9, 0, 18, 93, 73, 128, 1, 23, 64, 5, 
+128, 24, 0, 204, 17, 23, 192, 4, 128, 27, 9, 0, 0, 23, 64, 4, 
+128, 71, 137, 73, 18, 91, 9, 0, 0, 23, 128, 0, 128, 76, 9, 205, 
+0, 197, 9, 128, 4, 93, 73, 128, 1, 71, 9, 73, 18, 91, 9, 0, 
+0, 23, 128, 0, 128, 76, 9, 205, 0, 197, 9, 0, 4, 93, 73, 128, 
+1, 71, 137, 72, 18, 91, 9, 0, 0, 23, 128, 0, 128, 76, 9, 205, 
+0, 197, 9, 128, 3, 93, 73, 128, 1, 10, 70, 77, 13, 74, 70, 77, 
+13, 142, 198, 69, 13, 23, 0, 3, 128, 88, 128, 205, 15, 23, 64, 0, 
+128, 24, 192, 205, 15, 23, 0, 2, 128, 199, 136, 6, 12, 88, 64, 202, 
+17, 23, 64, 0, 128, 24, 0, 204, 17, 23, 192, 0, 128, 5, 9, 0, 
+5, 64, 9, 128, 0, 128, 9, 0, 16, 29, 73, 128, 1, 34, 7, 1, 
+0, 163, 199, 195, 127, 31, 0, 128, 0, 56, 0, 0, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 32, 98, 111, 100, 121, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 32, 116, 101, 120, 116, 0, 4, 8, 0, 0, 0, 
+0, 0, 0, 0, 32, 115, 116, 121, 108, 101, 115, 0, 4, 18, 0, 0, 
+0, 0, 0, 0, 0, 32, 97, 117, 116, 111, 109, 97, 116, 105, 99, 45, 
+115, 116, 121, 108, 101, 115, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+32, 115, 116, 121, 108, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+32, 110, 97, 109, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 32, 
+112, 97, 114, 101, 110, 116, 45, 110, 97, 109, 101, 0, 4, 17, 0, 0, 
+0, 0, 0, 0, 0, 32, 116, 101, 120, 116, 45, 112, 114, 111, 112, 101, 
+114, 116, 105, 101, 115, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 32, 
+112, 97, 114, 97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 112, 101, 114, 
+116, 105, 101, 115, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 32, 102, 
+111, 110, 116, 45, 115, 116, 121, 108, 101, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 32, 102, 111, 110, 116, 45, 119, 101, 105, 103, 104, 116, 0, 
+4, 22, 0, 0, 0, 0, 0, 0, 0, 32, 116, 101, 120, 116, 45, 117, 
+110, 100, 101, 114, 108, 105, 110, 101, 45, 115, 116, 121, 108, 101, 0, 4, 
+13, 0, 0, 0, 0, 0, 0, 0, 32, 109, 97, 114, 103, 105, 110, 45, 
+108, 101, 102, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 32, 112, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 32, 104, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 32, 108, 105, 115, 116, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 32, 111, 117, 116, 108, 105, 110, 101, 45, 108, 101, 
+118, 101, 108, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 32, 115, 116, 
+121, 108, 101, 45, 110, 97, 109, 101, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 32, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 32, 99, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 32, 115, 112, 97, 110, 0, 
+3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 111, 112, 101, 110, 116, 97, 103, 0, 3, 0, 0, 0, 0, 0, 
+0, 240, 63, 4, 9, 0, 0, 0, 0, 0, 0, 0, 99, 108, 111, 115, 
+101, 116, 97, 103, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 32, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 115, 107, 105, 112, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 100, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 111, 100, 121, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 115, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+115, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 112, 97, 114, 101, 110, 116, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 105, 116, 97, 108, 105, 99, 0, 1, 1, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 98, 111, 108, 100, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 115, 111, 108, 105, 100, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 117, 110, 100, 101, 114, 108, 105, 110, 101, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 101, 110, 116, 101, 100, 0, 
+4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 112, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 81, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 116, 111, 110, 117, 109, 98, 101, 114, 0, 3, 0, 0, 0, 0, 0, 
+0, 16, 64, 4, 2, 0, 0, 0, 0, 0, 0, 0, 72, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 108, 105, 115, 116, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 76, 66, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 105, 110, 108, 105, 110, 101, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 102, 108, 117, 115, 104, 119, 111, 114, 100, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 115, 116, 121, 108, 101, 95, 111, 110, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 102, 108, 117, 115, 104, 112, 97, 114, 97, 103, 
+114, 97, 112, 104, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+121, 108, 101, 95, 111, 102, 102, 0, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 116, 101, 120, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+99, 100, 97, 116, 97, 0, 0, 0, 0, 0, 11, 0, 0, 0, 1, 16, 
+1, 17, 1, 18, 1, 19, 1, 6, 1, 20, 0, 0, 1, 0, 1, 2, 
+1, 1, 1, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 236, 0, 0, 0, 46, 1, 0, 0, 
+1, 0, 12, 104, 0, 0, 0, 27, 64, 0, 0, 23, 64, 2, 128, 70, 
+0, 64, 0, 129, 64, 0, 0, 193, 128, 0, 0, 3, 1, 0, 0, 93, 
+128, 0, 2, 0, 0, 128, 0, 27, 64, 0, 0, 23, 64, 0, 128, 67, 
+0, 0, 0, 95, 0, 0, 1, 70, 192, 64, 0, 129, 0, 1, 0, 93, 
+64, 0, 1, 69, 0, 128, 0, 128, 0, 0, 0, 93, 128, 0, 1, 132, 
+0, 128, 0, 91, 0, 0, 0, 23, 64, 2, 128, 12, 65, 193, 0, 129, 
+129, 1, 0, 29, 129, 128, 1, 128, 0, 0, 2, 12, 65, 193, 0, 129, 
+193, 1, 0, 29, 129, 128, 1, 192, 0, 0, 2, 12, 1, 194, 0, 29, 
+65, 0, 1, 155, 0, 0, 0, 23, 64, 0, 128, 219, 64, 0, 0, 23, 
+192, 1, 128, 6, 65, 66, 0, 68, 1, 0, 0, 129, 129, 2, 0, 29, 
+65, 128, 1, 6, 193, 66, 0, 29, 65, 128, 0, 3, 1, 0, 0, 31, 
+1, 0, 1, 11, 1, 0, 0, 70, 1, 67, 0, 93, 129, 128, 0, 134, 
+65, 67, 0, 192, 1, 128, 2, 157, 129, 0, 1, 204, 129, 67, 3, 221, 
+65, 0, 1, 197, 1, 0, 1, 0, 2, 0, 2, 64, 2, 0, 3, 128, 
+2, 0, 1, 221, 65, 0, 2, 132, 0, 0, 0, 197, 1, 0, 1, 0, 
+2, 0, 2, 64, 2, 0, 3, 128, 2, 128, 1, 221, 65, 0, 2, 196, 
+0, 0, 0, 213, 1, 128, 2, 25, 192, 129, 135, 23, 128, 0, 128, 204, 
+1, 196, 2, 65, 194, 3, 0, 221, 65, 128, 1, 198, 65, 68, 0, 0, 
+2, 0, 0, 221, 129, 0, 1, 6, 130, 68, 0, 7, 194, 68, 4, 7, 
+194, 1, 4, 27, 2, 0, 0, 23, 0, 3, 128, 1, 194, 3, 0, 64, 
+2, 128, 3, 129, 2, 5, 0, 192, 2, 0, 4, 86, 194, 130, 4, 134, 
+130, 68, 0, 135, 194, 68, 5, 135, 66, 2, 5, 155, 66, 0, 0, 23, 
+128, 253, 127, 192, 1, 128, 4, 23, 0, 0, 128, 23, 192, 252, 127, 6, 
+130, 68, 0, 12, 66, 69, 4, 128, 2, 128, 2, 192, 2, 128, 3, 29, 
+66, 0, 2, 6, 130, 68, 0, 12, 130, 69, 4, 128, 2, 128, 3, 29, 
+66, 128, 1, 6, 194, 66, 0, 29, 66, 128, 0, 3, 2, 128, 0, 31, 
+2, 0, 1, 31, 0, 128, 0, 23, 0, 0, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 0, 
+4, 16, 0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 32, 
+79, 68, 84, 32, 70, 105, 108, 101, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 73, 109, 112, 111, 114, 116, 32, 102, 114, 111, 109, 58, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 109, 101, 100, 105, 97, 116, 
+101, 77, 101, 115, 115, 97, 103, 101, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 73, 109, 112, 111, 114, 116, 105, 110, 103, 46, 46, 46, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 100, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 115, 46, 120, 109, 108, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 116, 101, 110, 
+116, 46, 120, 109, 108, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 99, 
+108, 111, 115, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 
+100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 65, 0, 0, 0, 
+0, 0, 0, 0, 84, 104, 101, 32, 105, 109, 112, 111, 114, 116, 32, 102, 
+97, 105, 108, 101, 100, 44, 32, 112, 114, 111, 98, 97, 98, 108, 121, 32, 
+98, 101, 99, 97, 117, 115, 101, 32, 116, 104, 101, 32, 102, 105, 108, 101, 
+32, 99, 111, 117, 108, 100, 32, 110, 111, 116, 32, 98, 101, 32, 102, 111, 
+117, 110, 100, 46, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 
+101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 
+101, 73, 109, 112, 111, 114, 116, 101, 114, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 114, 101, 115, 101, 116, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 4, 18, 0, 0, 0, 0, 0, 0, 0, 100, 101, 108, 101, 116, 
+101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 65, 116, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 76, 101, 97, 102, 110, 97, 109, 101, 0, 4, 
+12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 100, 111, 99, 
+117, 109, 101, 110, 116, 115, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+45, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 68, 111, 
+99, 117, 109, 101, 110, 116, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 
+115, 101, 116, 67, 117, 114, 114, 101, 110, 116, 0, 0, 0, 0, 0, 3, 
+0, 0, 0, 0, 0, 1, 5, 1, 22, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/navigate.lua */
+static const char file_26[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 20, 245, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 134, 128, 64, 0, 135, 0, 65, 1, 198, 128, 64, 0, 199, 64, 193, 
+1, 6, 129, 64, 0, 7, 129, 65, 2, 70, 129, 64, 0, 71, 193, 193, 
+2, 134, 129, 64, 0, 135, 1, 66, 3, 198, 129, 64, 0, 199, 65, 194, 
+3, 6, 130, 64, 0, 7, 130, 66, 4, 70, 130, 64, 0, 71, 194, 194, 
+4, 134, 130, 64, 0, 135, 2, 67, 5, 198, 130, 64, 0, 199, 66, 195, 
+5, 6, 131, 67, 0, 7, 195, 67, 6, 70, 3, 68, 0, 91, 67, 0, 
+0, 23, 64, 0, 128, 70, 131, 67, 0, 71, 3, 196, 6, 134, 67, 68, 
+0, 229, 3, 0, 0, 138, 195, 3, 137, 134, 67, 68, 0, 229, 67, 0, 
+0, 138, 195, 131, 137, 134, 67, 68, 0, 229, 131, 0, 0, 138, 195, 3, 
+138, 134, 67, 68, 0, 229, 195, 0, 0, 138, 195, 131, 138, 134, 67, 68, 
+0, 229, 3, 1, 0, 138, 195, 3, 139, 134, 67, 68, 0, 229, 67, 1, 
+0, 138, 195, 131, 139, 134, 67, 68, 0, 229, 131, 1, 0, 138, 195, 3, 
+140, 134, 67, 68, 0, 229, 195, 1, 0, 138, 195, 131, 140, 134, 67, 68, 
+0, 229, 3, 2, 0, 138, 195, 3, 141, 134, 67, 68, 0, 229, 67, 2, 
+0, 138, 195, 131, 141, 134, 67, 68, 0, 229, 131, 2, 0, 138, 195, 3, 
+142, 134, 67, 68, 0, 229, 195, 2, 0, 138, 195, 131, 142, 134, 67, 68, 
+0, 229, 3, 3, 0, 138, 195, 3, 143, 134, 67, 68, 0, 229, 67, 3, 
+0, 138, 195, 131, 143, 134, 67, 68, 0, 229, 131, 3, 0, 138, 195, 3, 
+144, 134, 67, 68, 0, 229, 195, 3, 0, 138, 195, 131, 144, 134, 67, 68, 
+0, 229, 3, 4, 0, 138, 195, 3, 145, 134, 67, 68, 0, 229, 67, 4, 
+0, 138, 195, 131, 145, 134, 67, 68, 0, 229, 131, 4, 0, 138, 195, 3, 
+146, 134, 67, 68, 0, 229, 195, 4, 0, 138, 195, 131, 146, 134, 67, 68, 
+0, 229, 3, 5, 0, 138, 195, 3, 147, 134, 67, 68, 0, 229, 67, 5, 
+0, 138, 195, 131, 147, 134, 67, 68, 0, 229, 131, 5, 0, 138, 195, 3, 
+148, 134, 67, 68, 0, 229, 195, 5, 0, 138, 195, 131, 148, 134, 67, 68, 
+0, 229, 3, 6, 0, 138, 195, 3, 149, 134, 67, 68, 0, 229, 67, 6, 
+0, 138, 195, 131, 149, 134, 67, 68, 0, 229, 131, 6, 0, 138, 195, 3, 
+150, 134, 67, 68, 0, 229, 195, 6, 0, 138, 195, 131, 150, 134, 67, 68, 
+0, 229, 3, 7, 0, 138, 195, 3, 151, 134, 67, 68, 0, 229, 67, 7, 
+0, 138, 195, 131, 151, 134, 67, 68, 0, 229, 131, 7, 0, 138, 195, 3, 
+152, 165, 195, 7, 0, 198, 67, 68, 0, 37, 4, 8, 0, 202, 3, 132, 
+152, 198, 67, 68, 0, 37, 68, 8, 0, 202, 3, 4, 153, 198, 67, 68, 
+0, 37, 132, 8, 0, 202, 3, 132, 153, 198, 67, 68, 0, 37, 196, 8, 
+0, 202, 3, 4, 154, 198, 67, 68, 0, 37, 4, 9, 0, 202, 3, 132, 
+154, 198, 67, 68, 0, 37, 68, 9, 0, 202, 3, 4, 155, 203, 3, 1, 
+0, 11, 4, 0, 1, 70, 132, 64, 0, 71, 4, 206, 8, 129, 68, 14, 
+0, 36, 68, 0, 1, 202, 3, 132, 155, 11, 4, 0, 1, 70, 132, 64, 
+0, 71, 196, 206, 8, 129, 68, 14, 0, 36, 68, 0, 1, 202, 3, 4, 
+157, 11, 4, 0, 1, 70, 132, 64, 0, 71, 68, 207, 8, 129, 68, 14, 
+0, 36, 68, 0, 1, 202, 3, 4, 158, 11, 4, 0, 1, 65, 196, 15, 
+0, 129, 196, 15, 0, 36, 68, 0, 1, 202, 3, 4, 159, 6, 68, 68, 
+0, 101, 132, 9, 0, 10, 68, 4, 160, 6, 68, 68, 0, 101, 196, 9, 
+0, 10, 68, 132, 160, 37, 4, 10, 0, 8, 0, 4, 161, 37, 68, 10, 
+0, 8, 0, 132, 161, 6, 68, 68, 0, 101, 132, 10, 0, 10, 68, 4, 
+162, 37, 196, 10, 0, 8, 0, 132, 162, 6, 68, 68, 0, 101, 4, 11, 
+0, 10, 68, 4, 163, 6, 68, 68, 0, 101, 68, 11, 0, 10, 68, 132, 
+163, 37, 132, 11, 0, 70, 68, 68, 0, 165, 196, 11, 0, 74, 132, 4, 
+164, 70, 68, 68, 0, 165, 4, 12, 0, 74, 132, 132, 164, 70, 68, 68, 
+0, 165, 68, 12, 0, 74, 132, 4, 165, 70, 68, 68, 0, 165, 132, 12, 
+0, 74, 132, 132, 165, 70, 68, 68, 0, 165, 196, 12, 0, 74, 132, 4, 
+166, 70, 68, 68, 0, 165, 4, 13, 0, 74, 132, 132, 166, 70, 68, 68, 
+0, 165, 68, 13, 0, 74, 132, 4, 167, 70, 68, 68, 0, 165, 132, 13, 
+0, 74, 132, 132, 167, 70, 68, 68, 0, 165, 196, 13, 0, 74, 132, 4, 
+168, 70, 68, 68, 0, 165, 4, 14, 0, 74, 132, 132, 168, 101, 68, 14, 
+0, 134, 68, 68, 0, 229, 132, 14, 0, 138, 196, 4, 169, 134, 68, 68, 
+0, 229, 196, 14, 0, 138, 196, 132, 169, 134, 68, 68, 0, 229, 4, 15, 
+0, 138, 196, 4, 170, 134, 68, 68, 0, 229, 68, 15, 0, 138, 196, 132, 
+170, 134, 68, 68, 0, 229, 132, 15, 0, 138, 196, 4, 171, 134, 68, 68, 
+0, 229, 196, 15, 0, 138, 196, 132, 171, 134, 68, 68, 0, 229, 4, 16, 
+0, 138, 196, 4, 172, 134, 68, 68, 0, 229, 68, 16, 0, 138, 196, 132, 
+172, 31, 0, 128, 0, 90, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 109, 97, 116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+102, 108, 111, 111, 114, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 
+103, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 98, 121, 
+116, 101, 115, 111, 102, 99, 104, 97, 114, 97, 99, 116, 101, 114, 0, 4, 
+15, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 115, 116, 114, 105, 110, 
+103, 119, 105, 100, 116, 104, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 
+110, 101, 120, 116, 99, 104, 97, 114, 105, 110, 119, 111, 114, 100, 0, 4, 
+15, 0, 0, 0, 0, 0, 0, 0, 112, 114, 101, 118, 99, 104, 97, 114, 
+105, 110, 119, 111, 114, 100, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 
+105, 110, 115, 101, 114, 116, 105, 110, 116, 111, 119, 111, 114, 100, 0, 4, 
+15, 0, 0, 0, 0, 0, 0, 0, 100, 101, 108, 101, 116, 101, 102, 114, 
+111, 109, 119, 111, 114, 100, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 
+97, 112, 112, 108, 121, 115, 116, 121, 108, 101, 116, 111, 119, 111, 114, 100, 
+0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 115, 116, 121, 
+108, 101, 102, 114, 111, 109, 119, 111, 114, 100, 0, 4, 16, 0, 0, 0, 
+0, 0, 0, 0, 99, 114, 101, 97, 116, 101, 115, 116, 121, 108, 101, 98, 
+121, 116, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 97, 
+100, 117, 56, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 119, 114, 105, 
+116, 101, 117, 56, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 
+98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 
+99, 97, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 117, 110, 112, 
+97, 99, 107, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 
+0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 66, 101, 
+103, 105, 110, 110, 105, 110, 103, 79, 102, 87, 111, 114, 100, 0, 4, 14, 
+0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 69, 110, 100, 79, 102, 
+87, 111, 114, 100, 0, 4, 25, 0, 0, 0, 0, 0, 0, 0, 71, 111, 
+116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 
+71, 111, 116, 111, 69, 110, 100, 79, 102, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 0, 4, 24, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 
+66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 68, 111, 99, 117, 109, 
+101, 110, 116, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 
+111, 69, 110, 100, 79, 102, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 
+22, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 
+105, 111, 117, 115, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 18, 
+0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 101, 120, 116, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 23, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 
+114, 97, 103, 114, 97, 112, 104, 87, 0, 4, 19, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 116, 111, 78, 101, 120, 116, 80, 97, 114, 97, 103, 114, 
+97, 112, 104, 87, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 71, 111, 
+116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 87, 111, 114, 100, 0, 4, 
+13, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 101, 120, 116, 
+87, 111, 114, 100, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 71, 111, 
+116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 87, 111, 114, 100, 87, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 101, 120, 
+116, 87, 111, 114, 100, 87, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 
+71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 67, 104, 97, 114, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 101, 
+120, 116, 67, 104, 97, 114, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 
+71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 67, 104, 97, 114, 
+87, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 
+101, 120, 116, 67, 104, 97, 114, 87, 0, 4, 21, 0, 0, 0, 0, 0, 
+0, 0, 73, 110, 115, 101, 114, 116, 83, 116, 114, 105, 110, 103, 73, 110, 
+116, 111, 87, 111, 114, 100, 0, 4, 26, 0, 0, 0, 0, 0, 0, 0, 
+73, 110, 115, 101, 114, 116, 83, 116, 114, 105, 110, 103, 73, 110, 116, 111, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 17, 0, 0, 0, 0, 
+0, 0, 0, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 87, 
+111, 114, 100, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 74, 111, 105, 
+110, 87, 105, 116, 104, 78, 101, 120, 116, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 74, 111, 105, 110, 
+87, 105, 116, 104, 78, 101, 120, 116, 87, 111, 114, 100, 0, 4, 19, 0, 
+0, 0, 0, 0, 0, 0, 68, 101, 108, 101, 116, 101, 80, 114, 101, 118, 
+105, 111, 117, 115, 67, 104, 97, 114, 0, 4, 30, 0, 0, 0, 0, 0, 
+0, 0, 68, 101, 108, 101, 116, 101, 83, 101, 108, 101, 99, 116, 105, 111, 
+110, 79, 114, 80, 114, 101, 118, 105, 111, 117, 115, 67, 104, 97, 114, 0, 
+4, 15, 0, 0, 0, 0, 0, 0, 0, 68, 101, 108, 101, 116, 101, 78, 
+101, 120, 116, 67, 104, 97, 114, 0, 4, 26, 0, 0, 0, 0, 0, 0, 
+0, 68, 101, 108, 101, 116, 101, 83, 101, 108, 101, 99, 116, 105, 111, 110, 
+79, 114, 78, 101, 120, 116, 67, 104, 97, 114, 0, 4, 23, 0, 0, 0, 
+0, 0, 0, 0, 68, 101, 108, 101, 116, 101, 87, 111, 114, 100, 76, 101, 
+102, 116, 79, 102, 67, 117, 114, 115, 111, 114, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 68, 101, 108, 101, 116, 101, 87, 111, 114, 100, 0, 4, 
+22, 0, 0, 0, 0, 0, 0, 0, 83, 112, 108, 105, 116, 67, 117, 114, 
+114, 101, 110, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 14, 
+0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 88, 80, 111, 115, 105, 
+116, 105, 111, 110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 71, 111, 
+116, 111, 78, 101, 120, 116, 76, 105, 110, 101, 0, 4, 17, 0, 0, 0, 
+0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 
+76, 105, 110, 101, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 71, 111, 
+116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 76, 105, 110, 
+101, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 69, 
+110, 100, 79, 102, 76, 105, 110, 101, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 
+103, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 
+78, 101, 120, 116, 80, 97, 103, 101, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 98, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 66, 79, 76, 
+68, 0, 3, 0, 0, 0, 0, 0, 0, 46, 64, 4, 2, 0, 0, 0, 
+0, 0, 0, 0, 117, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 85, 
+78, 68, 69, 82, 76, 73, 78, 69, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 105, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 73, 84, 65, 
+76, 73, 67, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 111, 0, 3, 
+0, 0, 0, 0, 0, 0, 0, 0, 4, 22, 0, 0, 0, 0, 0, 0, 
+0, 65, 112, 112, 108, 121, 83, 116, 121, 108, 101, 84, 111, 83, 101, 108, 
+101, 99, 116, 105, 111, 110, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+83, 101, 116, 83, 116, 121, 108, 101, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 71, 101, 116, 83, 116, 121, 108, 101, 65, 116, 67, 117, 114, 115, 
+111, 114, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 71, 101, 116, 83, 
+116, 121, 108, 101, 84, 111, 76, 101, 102, 116, 79, 102, 67, 117, 114, 115, 
+111, 114, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 65, 99, 116, 105, 
+118, 97, 116, 101, 77, 101, 110, 117, 0, 4, 23, 0, 0, 0, 0, 0, 
+0, 0, 67, 111, 110, 102, 105, 114, 109, 68, 111, 99, 117, 109, 101, 110, 
+116, 69, 114, 97, 115, 117, 114, 101, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 84, 101, 114, 109, 105, 110, 97, 116, 101, 80, 114, 111, 103, 114, 
+97, 109, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 
+116, 101, 66, 108, 97, 110, 107, 68, 111, 99, 117, 109, 101, 110, 116, 83, 
+101, 116, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 67, 104, 97, 110, 
+103, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 83, 116, 121, 108, 101, 
+0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 84, 111, 103, 103, 108, 101, 
+77, 97, 114, 107, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 83, 101, 
+116, 77, 97, 114, 107, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 85, 
+110, 115, 101, 116, 77, 97, 114, 107, 0, 4, 18, 0, 0, 0, 0, 0, 
+0, 0, 77, 111, 118, 101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 99, 
+116, 101, 100, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 84, 121, 112, 
+101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 99, 116, 101, 100, 0, 4, 
+11, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 99, 116, 87, 111, 
+114, 100, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 67, 104, 97, 110, 
+103, 101, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 67, 117, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 67, 111, 112, 121, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 80, 
+97, 115, 116, 101, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 73, 110, 
+115, 101, 114, 116, 84, 101, 120, 116, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 68, 101, 108, 101, 116, 101, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 70, 105, 110, 100, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+70, 105, 110, 100, 78, 101, 120, 116, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 82, 101, 112, 108, 97, 99, 101, 84, 104, 101, 110, 70, 105, 110, 
+100, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 84, 111, 103, 103, 108, 
+101, 83, 116, 97, 116, 117, 115, 66, 97, 114, 0, 4, 17, 0, 0, 0, 
+0, 0, 0, 0, 65, 98, 111, 117, 116, 87, 111, 114, 100, 71, 114, 105, 
+110, 100, 101, 114, 0, 66, 0, 0, 0, 20, 0, 0, 0, 24, 0, 0, 
+0, 0, 0, 2, 7, 0, 0, 0, 6, 0, 64, 0, 10, 128, 192, 128, 
+6, 192, 64, 0, 29, 64, 128, 0, 3, 0, 128, 0, 31, 0, 0, 1, 
+31, 0, 128, 0, 4, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 111, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 
+12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 
+114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 26, 0, 0, 0, 30, 0, 0, 0, 0, 0, 3, 16, 0, 0, 
+0, 6, 0, 64, 0, 70, 0, 64, 0, 134, 0, 64, 0, 135, 128, 64, 
+1, 71, 128, 128, 0, 134, 0, 64, 0, 135, 192, 64, 1, 71, 128, 128, 
+0, 85, 0, 128, 0, 77, 0, 193, 0, 10, 64, 128, 128, 6, 64, 65, 
+0, 29, 64, 128, 0, 3, 0, 128, 0, 31, 0, 0, 1, 31, 0, 128, 
+0, 6, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 
+99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+99, 111, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 
+117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 35, 0, 0, 0, 0, 
+0, 2, 7, 0, 0, 0, 6, 0, 64, 0, 10, 128, 192, 128, 6, 192, 
+64, 0, 7, 0, 65, 0, 30, 0, 128, 0, 31, 0, 0, 0, 31, 0, 
+128, 0, 5, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 119, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 20, 0, 0, 0, 0, 
+0, 0, 0, 71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 
+79, 102, 87, 111, 114, 100, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 37, 0, 0, 0, 40, 0, 0, 0, 0, 0, 3, 
+12, 0, 0, 0, 6, 0, 64, 0, 70, 0, 64, 0, 134, 0, 64, 0, 
+135, 128, 64, 1, 71, 128, 128, 0, 85, 0, 128, 0, 10, 64, 128, 128, 
+6, 192, 64, 0, 7, 0, 65, 0, 30, 0, 128, 0, 31, 0, 0, 0, 
+31, 0, 128, 0, 5, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+112, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 
+14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 69, 110, 100, 79, 
+102, 87, 111, 114, 100, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 42, 0, 0, 0, 45, 0, 0, 0, 0, 0, 2, 7, 
+0, 0, 0, 6, 0, 64, 0, 10, 128, 192, 128, 6, 192, 64, 0, 7, 
+0, 65, 0, 30, 0, 128, 0, 31, 0, 0, 0, 31, 0, 128, 0, 5, 
+0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 67, 109, 100, 0, 4, 25, 0, 0, 0, 0, 0, 0, 0, 
+71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 50, 0, 0, 0, 0, 
+0, 2, 9, 0, 0, 0, 6, 0, 64, 0, 70, 0, 64, 0, 85, 0, 
+128, 0, 10, 64, 128, 128, 6, 128, 64, 0, 7, 192, 64, 0, 30, 0, 
+128, 0, 31, 0, 0, 0, 31, 0, 128, 0, 4, 0, 0, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 19, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 116, 111, 69, 110, 100, 79, 102, 80, 97, 114, 97, 103, 
+114, 97, 112, 104, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 52, 0, 0, 0, 64, 0, 0, 0, 0, 0, 2, 22, 0, 
+0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 24, 128, 64, 0, 23, 192, 
+0, 128, 6, 192, 64, 0, 29, 64, 128, 0, 3, 0, 0, 0, 31, 0, 
+0, 1, 6, 0, 64, 0, 70, 0, 64, 0, 71, 64, 192, 0, 78, 128, 
+192, 0, 10, 64, 128, 128, 6, 0, 64, 0, 10, 128, 64, 130, 6, 0, 
+64, 0, 10, 128, 192, 130, 6, 192, 64, 0, 29, 64, 128, 0, 3, 0, 
+128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 6, 0, 0, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 
+101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+111, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+66, 0, 0, 0, 78, 0, 0, 0, 0, 0, 2, 24, 0, 0, 0, 6, 
+0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 85, 0, 128, 0, 24, 
+64, 0, 0, 23, 192, 0, 128, 6, 128, 64, 0, 29, 64, 128, 0, 3, 
+0, 0, 0, 31, 0, 0, 1, 6, 0, 64, 0, 70, 0, 64, 0, 71, 
+64, 192, 0, 77, 192, 192, 0, 10, 64, 128, 128, 6, 0, 64, 0, 10, 
+192, 64, 130, 6, 0, 64, 0, 10, 192, 192, 130, 6, 128, 64, 0, 29, 
+64, 128, 0, 3, 0, 128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 6, 
+0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 
+101, 100, 114, 97, 119, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 99, 111, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 80, 0, 0, 0, 82, 0, 0, 0, 0, 0, 2, 
+5, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 30, 0, 128, 0, 
+31, 0, 0, 0, 31, 0, 128, 0, 2, 0, 0, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 22, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 
+114, 97, 103, 114, 97, 112, 104, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 86, 0, 0, 0, 0, 0, 
+2, 5, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 30, 0, 128, 
+0, 31, 0, 0, 0, 31, 0, 128, 0, 2, 0, 0, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 18, 0, 0, 0, 0, 
+0, 0, 0, 71, 111, 116, 111, 78, 101, 120, 116, 80, 97, 114, 97, 103, 
+114, 97, 112, 104, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 88, 0, 0, 0, 99, 0, 0, 0, 0, 0, 2, 20, 0, 
+0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 24, 128, 64, 0, 23, 192, 
+0, 128, 6, 192, 64, 0, 29, 64, 128, 0, 3, 0, 0, 0, 31, 0, 
+0, 1, 6, 0, 64, 0, 70, 0, 64, 0, 71, 64, 192, 0, 78, 128, 
+192, 0, 10, 64, 128, 128, 6, 0, 64, 0, 10, 128, 64, 130, 6, 192, 
+64, 0, 29, 64, 128, 0, 3, 0, 128, 0, 31, 0, 0, 1, 31, 0, 
+128, 0, 5, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 119, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 
+113, 0, 0, 0, 0, 0, 3, 25, 0, 0, 0, 6, 0, 64, 0, 70, 
+0, 64, 0, 71, 64, 192, 0, 7, 64, 0, 0, 70, 0, 64, 0, 71, 
+128, 192, 0, 149, 0, 0, 0, 24, 128, 128, 0, 23, 192, 0, 128, 70, 
+192, 64, 0, 93, 64, 128, 0, 67, 0, 0, 0, 95, 0, 0, 1, 70, 
+0, 64, 0, 134, 0, 64, 0, 135, 128, 64, 1, 141, 0, 65, 1, 74, 
+128, 0, 129, 70, 0, 64, 0, 74, 0, 193, 130, 70, 192, 64, 0, 93, 
+64, 128, 0, 67, 0, 128, 0, 95, 0, 0, 1, 31, 0, 128, 0, 6, 
+0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 99, 111, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 115, 0, 0, 0, 120, 0, 0, 0, 0, 0, 2, 
+17, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 29, 128, 128, 0, 
+27, 64, 0, 0, 23, 0, 2, 128, 6, 0, 64, 0, 7, 128, 64, 0, 
+29, 128, 128, 0, 27, 0, 0, 0, 23, 128, 0, 128, 6, 0, 64, 0, 
+7, 192, 64, 0, 29, 128, 128, 0, 31, 0, 0, 1, 3, 0, 128, 0, 
+31, 0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 87, 111, 
+114, 100, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 
+80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 87, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 
+69, 110, 100, 79, 102, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 0, 
+0, 127, 0, 0, 0, 0, 0, 2, 17, 0, 0, 0, 6, 0, 64, 0, 
+7, 64, 64, 0, 29, 128, 128, 0, 27, 64, 0, 0, 23, 0, 2, 128, 
+6, 0, 64, 0, 7, 128, 64, 0, 29, 128, 128, 0, 27, 0, 0, 0, 
+23, 128, 0, 128, 6, 0, 64, 0, 7, 192, 64, 0, 29, 128, 128, 0, 
+31, 0, 0, 1, 3, 0, 128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 
+4, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 101, 
+120, 116, 87, 111, 114, 100, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 
+71, 111, 116, 111, 78, 101, 120, 116, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 87, 0, 4, 25, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 
+66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 80, 97, 114, 97, 103, 
+114, 97, 112, 104, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 129, 0, 0, 0, 140, 0, 0, 0, 0, 0, 4, 23, 0, 
+0, 0, 6, 0, 64, 0, 70, 0, 64, 0, 71, 64, 192, 0, 7, 64, 
+0, 0, 70, 0, 64, 0, 71, 128, 192, 0, 7, 64, 0, 0, 69, 0, 
+128, 0, 128, 0, 0, 0, 198, 0, 64, 0, 199, 192, 192, 1, 93, 128, 
+128, 1, 91, 64, 0, 0, 23, 64, 0, 128, 131, 0, 0, 0, 159, 0, 
+0, 1, 134, 0, 64, 0, 138, 64, 128, 129, 134, 0, 65, 0, 157, 64, 
+128, 0, 131, 0, 128, 0, 159, 0, 0, 1, 31, 0, 128, 0, 5, 0, 
+0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 99, 111, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 
+0, 2, 0, 0, 0, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142, 0, 0, 
+0, 153, 0, 0, 0, 0, 0, 4, 23, 0, 0, 0, 6, 0, 64, 0, 
+70, 0, 64, 0, 71, 64, 192, 0, 7, 64, 0, 0, 70, 0, 64, 0, 
+71, 128, 192, 0, 7, 64, 0, 0, 69, 0, 128, 0, 128, 0, 0, 0, 
+198, 0, 64, 0, 199, 192, 192, 1, 93, 128, 128, 1, 91, 64, 0, 0, 
+23, 64, 0, 128, 131, 0, 0, 0, 159, 0, 0, 1, 134, 0, 64, 0, 
+138, 64, 128, 129, 134, 0, 65, 0, 157, 64, 128, 0, 131, 0, 128, 0, 
+159, 0, 0, 1, 31, 0, 128, 0, 5, 0, 0, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+111, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 155, 0, 0, 0, 160, 0, 0, 0, 0, 
+0, 2, 17, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 29, 128, 
+128, 0, 27, 64, 0, 0, 23, 0, 2, 128, 6, 0, 64, 0, 7, 128, 
+64, 0, 29, 128, 128, 0, 27, 0, 0, 0, 23, 128, 0, 128, 6, 0, 
+64, 0, 7, 192, 64, 0, 29, 128, 128, 0, 31, 0, 0, 1, 3, 0, 
+128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 17, 0, 0, 0, 
+0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 
+67, 104, 97, 114, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 71, 111, 
+116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 87, 111, 114, 100, 87, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 69, 110, 100, 
+79, 102, 87, 111, 114, 100, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 162, 0, 0, 0, 167, 0, 0, 0, 0, 0, 2, 
+17, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 29, 128, 128, 0, 
+27, 64, 0, 0, 23, 0, 2, 128, 6, 0, 64, 0, 7, 128, 64, 0, 
+29, 128, 128, 0, 27, 0, 0, 0, 23, 128, 0, 128, 6, 0, 64, 0, 
+7, 192, 64, 0, 29, 128, 128, 0, 31, 0, 0, 1, 3, 0, 128, 0, 
+31, 0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 116, 111, 78, 101, 120, 116, 67, 104, 97, 114, 0, 4, 
+14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 101, 120, 116, 
+87, 111, 114, 100, 87, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 71, 
+111, 116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 87, 111, 
+114, 100, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 169, 0, 0, 0, 197, 0, 0, 0, 1, 0, 18, 59, 0, 0, 0, 
+70, 0, 64, 0, 71, 64, 192, 0, 134, 0, 64, 0, 135, 128, 64, 1, 
+198, 0, 64, 0, 199, 192, 192, 1, 6, 1, 64, 0, 7, 65, 0, 2, 
+71, 129, 0, 2, 133, 1, 128, 0, 192, 1, 128, 2, 0, 2, 0, 0, 
+64, 2, 128, 1, 134, 2, 65, 0, 157, 2, 128, 0, 157, 193, 0, 0, 
+219, 65, 0, 0, 23, 64, 0, 128, 3, 2, 0, 0, 31, 2, 0, 1, 
+11, 194, 0, 0, 10, 130, 129, 130, 70, 2, 64, 0, 71, 130, 192, 4, 
+10, 66, 2, 131, 10, 2, 129, 131, 70, 2, 66, 0, 134, 66, 66, 0, 
+135, 130, 66, 5, 192, 2, 0, 4, 93, 66, 128, 1, 71, 66, 65, 4, 
+134, 2, 64, 0, 198, 194, 66, 0, 7, 3, 67, 2, 76, 67, 67, 2, 
+193, 131, 3, 0, 14, 132, 67, 1, 93, 131, 0, 2, 128, 3, 128, 4, 
+204, 67, 67, 2, 77, 132, 67, 1, 221, 3, 128, 1, 221, 130, 0, 0, 
+138, 194, 130, 0, 134, 2, 64, 0, 213, 2, 128, 4, 21, 3, 0, 3, 
+206, 2, 131, 5, 205, 194, 130, 3, 138, 194, 130, 129, 134, 194, 67, 0, 
+140, 2, 68, 5, 157, 66, 0, 1, 134, 66, 68, 0, 157, 66, 128, 0, 
+131, 2, 128, 0, 159, 2, 0, 1, 31, 0, 128, 0, 18, 0, 0, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 111, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 71, 
+101, 116, 67, 117, 114, 114, 101, 110, 116, 83, 116, 121, 108, 101, 72, 105, 
+110, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 119, 111, 114, 100, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 110, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 112, 97, 114, 97, 103, 114, 97, 112, 104, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 70, 105, 114, 101, 69, 118, 101, 
+110, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 
+116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 87, 111, 114, 100, 77, 
+111, 100, 105, 102, 105, 101, 100, 0, 4, 16, 0, 0, 0, 0, 0, 0, 
+0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 117, 98, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 5, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 199, 
+0, 0, 0, 211, 0, 0, 0, 1, 0, 8, 20, 0, 0, 0, 67, 0, 
+128, 0, 140, 0, 64, 0, 1, 65, 0, 0, 157, 0, 129, 1, 23, 64, 
+2, 128, 91, 64, 0, 0, 23, 128, 0, 128, 134, 129, 64, 0, 135, 193, 
+64, 3, 157, 65, 128, 0, 134, 129, 64, 0, 135, 1, 65, 3, 192, 1, 
+128, 2, 157, 65, 0, 1, 67, 0, 0, 0, 162, 64, 0, 0, 35, 193, 
+252, 127, 131, 0, 128, 0, 159, 0, 0, 1, 31, 0, 128, 0, 5, 0, 
+0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 103, 109, 97, 116, 99, 
+104, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 91, 94, 37, 115, 93, 
+43, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 83, 112, 108, 105, 116, 67, 117, 114, 
+114, 101, 110, 116, 87, 111, 114, 100, 0, 4, 21, 0, 0, 0, 0, 0, 
+0, 0, 73, 110, 115, 101, 114, 116, 83, 116, 114, 105, 110, 103, 73, 110, 
+116, 111, 87, 111, 114, 100, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 213, 0, 0, 0, 4, 1, 0, 0, 0, 0, 18, 
+70, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 
+71, 128, 192, 0, 134, 0, 64, 0, 135, 192, 64, 1, 193, 0, 1, 0, 
+1, 65, 1, 0, 70, 1, 64, 0, 71, 129, 193, 2, 91, 65, 0, 0, 
+23, 64, 3, 128, 70, 193, 65, 0, 93, 129, 128, 0, 133, 1, 128, 0, 
+192, 1, 128, 2, 157, 129, 0, 1, 192, 0, 0, 3, 88, 64, 193, 2, 
+23, 0, 1, 128, 128, 1, 128, 1, 197, 1, 128, 0, 1, 66, 1, 0, 
+221, 129, 0, 1, 214, 192, 1, 3, 1, 1, 2, 0, 70, 1, 64, 0, 
+71, 1, 128, 2, 135, 65, 128, 2, 197, 1, 0, 1, 0, 2, 0, 3, 
+64, 2, 0, 1, 149, 2, 0, 3, 141, 2, 66, 5, 221, 129, 0, 2, 
+5, 2, 0, 1, 64, 2, 0, 3, 129, 2, 2, 0, 192, 2, 0, 1, 
+29, 130, 0, 2, 70, 2, 64, 0, 134, 66, 66, 0, 199, 130, 194, 2, 
+12, 195, 194, 2, 129, 3, 2, 0, 206, 3, 194, 0, 29, 131, 0, 2, 
+64, 3, 128, 3, 128, 3, 128, 1, 192, 3, 0, 4, 150, 195, 3, 7, 
+204, 195, 194, 2, 77, 4, 194, 0, 221, 3, 128, 1, 157, 130, 0, 0, 
+74, 130, 2, 0, 70, 2, 64, 0, 141, 2, 194, 0, 74, 130, 2, 129, 
+70, 2, 64, 0, 141, 2, 1, 132, 74, 130, 130, 129, 70, 2, 67, 0, 
+76, 66, 195, 4, 93, 66, 0, 1, 70, 130, 67, 0, 93, 66, 128, 0, 
+67, 2, 128, 0, 95, 2, 0, 1, 31, 0, 128, 0, 15, 0, 0, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 111, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 109, 112, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 71, 101, 
+116, 67, 117, 114, 114, 101, 110, 116, 83, 116, 121, 108, 101, 72, 105, 110, 
+116, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 16, 0, 0, 0, 
+0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 
+97, 112, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 
+108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 117, 98, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 
+117, 99, 104, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 
+117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 3, 0, 0, 
+0, 0, 0, 1, 9, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 1, 0, 0, 20, 
+1, 0, 0, 0, 0, 9, 36, 0, 0, 0, 6, 0, 64, 0, 7, 64, 
+64, 0, 70, 0, 64, 0, 71, 128, 192, 0, 134, 0, 64, 0, 135, 192, 
+64, 1, 198, 0, 64, 0, 213, 0, 128, 1, 24, 192, 0, 0, 23, 64, 
+0, 128, 195, 0, 0, 0, 223, 0, 0, 1, 198, 0, 64, 0, 6, 1, 
+65, 0, 70, 1, 64, 0, 71, 1, 128, 2, 71, 65, 193, 2, 134, 1, 
+64, 0, 135, 1, 0, 3, 198, 1, 64, 0, 13, 130, 65, 0, 199, 1, 
+130, 3, 29, 129, 0, 2, 202, 0, 1, 0, 198, 0, 64, 0, 204, 192, 
+193, 1, 77, 129, 65, 0, 221, 64, 128, 1, 198, 0, 66, 0, 204, 64, 
+194, 1, 221, 64, 0, 1, 198, 128, 66, 0, 221, 64, 128, 0, 195, 0, 
+128, 0, 223, 0, 0, 1, 31, 0, 128, 0, 11, 0, 0, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 111, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 
+97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 18, 0, 0, 0, 0, 0, 0, 0, 100, 101, 
+108, 101, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 65, 116, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 
+117, 99, 104, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 
+117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 42, 1, 0, 0, 0, 
+0, 13, 48, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 
+64, 0, 71, 128, 192, 0, 134, 0, 64, 0, 135, 192, 64, 1, 198, 0, 
+64, 0, 199, 0, 128, 1, 21, 1, 128, 1, 24, 0, 129, 0, 23, 0, 
+2, 128, 6, 1, 65, 0, 7, 65, 65, 2, 29, 129, 128, 0, 27, 65, 
+0, 0, 23, 64, 0, 128, 3, 1, 0, 0, 31, 1, 0, 1, 6, 1, 
+64, 0, 199, 0, 0, 2, 5, 1, 128, 0, 77, 129, 193, 0, 71, 65, 
+129, 1, 135, 65, 128, 1, 193, 129, 1, 0, 1, 194, 1, 0, 29, 129, 
+128, 2, 70, 1, 64, 0, 134, 1, 66, 0, 199, 65, 194, 1, 12, 130, 
+194, 1, 129, 130, 1, 0, 206, 130, 193, 0, 29, 130, 0, 2, 64, 2, 
+0, 2, 140, 130, 194, 1, 13, 195, 194, 0, 157, 2, 128, 1, 157, 129, 
+0, 0, 74, 129, 1, 0, 70, 1, 67, 0, 76, 65, 195, 2, 93, 65, 
+0, 1, 70, 129, 67, 0, 93, 65, 128, 0, 67, 1, 128, 0, 95, 1, 
+0, 1, 31, 0, 128, 0, 15, 0, 0, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 22, 0, 
+0, 0, 0, 0, 0, 0, 74, 111, 105, 110, 87, 105, 116, 104, 78, 101, 
+120, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+115, 116, 121, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+117, 98, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 
+100, 114, 97, 119, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 
+5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 44, 1, 0, 0, 46, 1, 0, 0, 0, 0, 2, 
+10, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 29, 128, 128, 0, 
+27, 0, 0, 0, 23, 128, 0, 128, 6, 0, 64, 0, 7, 128, 64, 0, 
+29, 128, 128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 18, 0, 
+0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 
+117, 115, 67, 104, 97, 114, 87, 0, 4, 15, 0, 0, 0, 0, 0, 0, 
+0, 68, 101, 108, 101, 116, 101, 78, 101, 120, 116, 67, 104, 97, 114, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 1, 
+0, 0, 54, 1, 0, 0, 0, 0, 2, 14, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 27, 0, 0, 0, 23, 0, 1, 128, 6, 128, 64, 
+0, 7, 192, 64, 0, 30, 0, 128, 0, 31, 0, 0, 0, 23, 192, 0, 
+128, 6, 128, 64, 0, 7, 0, 65, 0, 30, 0, 128, 0, 31, 0, 0, 
+0, 31, 0, 128, 0, 5, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 109, 112, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+67, 109, 100, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 68, 101, 108, 
+101, 116, 101, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 68, 101, 108, 
+101, 116, 101, 80, 114, 101, 118, 105, 111, 117, 115, 67, 104, 97, 114, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 1, 
+0, 0, 73, 1, 0, 0, 0, 0, 14, 44, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 128, 192, 0, 134, 0, 64, 
+0, 135, 192, 64, 1, 198, 0, 64, 0, 199, 0, 128, 1, 7, 65, 128, 
+1, 69, 1, 128, 0, 128, 1, 0, 2, 192, 1, 0, 1, 93, 129, 128, 
+1, 91, 65, 0, 0, 23, 192, 0, 128, 134, 1, 65, 0, 135, 65, 65, 
+3, 158, 1, 128, 0, 159, 1, 0, 0, 134, 1, 64, 0, 198, 129, 65, 
+0, 7, 194, 193, 1, 76, 2, 194, 1, 193, 66, 2, 0, 14, 67, 194, 
+0, 93, 130, 0, 2, 133, 2, 0, 1, 192, 2, 0, 2, 0, 3, 0, 
+1, 64, 3, 128, 2, 157, 130, 0, 2, 204, 2, 194, 1, 77, 67, 194, 
+0, 221, 2, 128, 1, 221, 129, 0, 0, 138, 193, 1, 0, 134, 129, 66, 
+0, 140, 193, 66, 3, 157, 65, 0, 1, 134, 1, 67, 0, 157, 65, 128, 
+0, 131, 1, 128, 0, 159, 1, 0, 1, 31, 0, 128, 0, 13, 0, 0, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 99, 111, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+67, 109, 100, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 74, 111, 105, 
+110, 87, 105, 116, 104, 78, 101, 120, 116, 87, 111, 114, 100, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+115, 116, 121, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+117, 98, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 
+100, 114, 97, 119, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 
+3, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 75, 1, 0, 0, 81, 1, 0, 0, 0, 
+0, 2, 14, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 0, 
+0, 0, 23, 0, 1, 128, 6, 128, 64, 0, 7, 192, 64, 0, 30, 0, 
+128, 0, 31, 0, 0, 0, 23, 192, 0, 128, 6, 128, 64, 0, 7, 0, 
+65, 0, 30, 0, 128, 0, 31, 0, 0, 0, 31, 0, 128, 0, 5, 0, 
+0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 112, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 68, 101, 108, 101, 116, 101, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 68, 101, 108, 101, 116, 101, 78, 101, 120, 116, 
+67, 104, 97, 114, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 83, 1, 0, 0, 95, 1, 0, 0, 0, 0, 7, 26, 0, 
+0, 0, 6, 0, 64, 0, 70, 0, 64, 0, 71, 64, 192, 0, 7, 64, 
+0, 0, 70, 0, 64, 0, 71, 128, 192, 0, 134, 0, 64, 0, 135, 192, 
+64, 1, 197, 0, 128, 0, 7, 65, 0, 0, 65, 1, 1, 0, 128, 1, 
+0, 1, 221, 128, 0, 2, 10, 192, 128, 0, 198, 0, 64, 0, 202, 0, 
+193, 129, 204, 64, 65, 0, 221, 64, 0, 1, 198, 128, 65, 0, 204, 64, 
+193, 1, 221, 64, 0, 1, 198, 192, 65, 0, 221, 64, 128, 0, 195, 0, 
+128, 0, 223, 0, 0, 1, 31, 0, 128, 0, 8, 0, 0, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 111, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 
+101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 97, 1, 0, 0, 106, 1, 0, 0, 0, 0, 
+2, 24, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 24, 128, 64, 
+0, 23, 192, 1, 128, 6, 0, 64, 0, 7, 192, 64, 0, 24, 128, 64, 
+0, 23, 192, 0, 128, 6, 0, 65, 0, 7, 64, 65, 0, 30, 0, 128, 
+0, 31, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 24, 128, 64, 
+0, 23, 128, 0, 128, 6, 0, 65, 0, 7, 64, 65, 0, 29, 64, 128, 
+0, 6, 0, 65, 0, 7, 128, 65, 0, 30, 0, 128, 0, 31, 0, 0, 
+0, 31, 0, 128, 0, 7, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 99, 111, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 19, 0, 0, 0, 0, 0, 
+0, 0, 68, 101, 108, 101, 116, 101, 80, 114, 101, 118, 105, 111, 117, 115, 
+67, 104, 97, 114, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 68, 101, 
+108, 101, 116, 101, 87, 111, 114, 100, 76, 101, 102, 116, 79, 102, 67, 117, 
+114, 115, 111, 114, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 108, 1, 0, 0, 133, 1, 0, 0, 0, 0, 9, 63, 0, 
+0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 24, 128, 64, 0, 23, 192, 
+1, 128, 6, 0, 64, 0, 7, 192, 64, 0, 24, 128, 64, 0, 23, 192, 
+0, 128, 6, 0, 65, 0, 7, 64, 65, 0, 29, 64, 128, 0, 23, 0, 
+3, 128, 6, 0, 64, 0, 7, 64, 64, 0, 25, 0, 0, 129, 23, 192, 
+0, 128, 6, 0, 65, 0, 7, 64, 65, 0, 29, 64, 128, 0, 23, 0, 
+1, 128, 6, 128, 65, 0, 12, 192, 65, 0, 29, 64, 0, 1, 6, 0, 
+66, 0, 29, 64, 128, 0, 6, 0, 64, 0, 7, 64, 66, 0, 70, 0, 
+64, 0, 71, 192, 192, 0, 134, 0, 64, 0, 135, 0, 0, 1, 198, 128, 
+66, 0, 7, 193, 66, 1, 76, 1, 67, 1, 193, 129, 0, 0, 14, 130, 
+192, 0, 93, 1, 0, 2, 221, 128, 0, 0, 6, 129, 66, 0, 71, 193, 
+66, 1, 140, 1, 67, 1, 0, 2, 128, 0, 157, 1, 128, 1, 29, 129, 
+0, 0, 70, 1, 64, 0, 74, 1, 1, 0, 70, 1, 64, 0, 76, 65, 
+195, 2, 192, 1, 128, 1, 0, 2, 0, 0, 93, 65, 0, 2, 70, 1, 
+64, 0, 134, 1, 64, 0, 135, 65, 66, 3, 141, 129, 64, 3, 74, 129, 
+129, 132, 70, 1, 64, 0, 74, 129, 192, 129, 70, 1, 64, 0, 74, 129, 
+192, 128, 67, 1, 128, 0, 95, 1, 0, 1, 31, 0, 128, 0, 14, 0, 
+0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 
+3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 99, 119, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 83, 112, 108, 105, 116, 
+67, 117, 114, 114, 101, 110, 116, 87, 111, 114, 100, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 
+100, 114, 97, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 
+0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 121, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 115, 117, 98, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 105, 
+110, 115, 101, 114, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 66, 101, 
+102, 111, 114, 101, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 135, 1, 0, 0, 169, 1, 0, 0, 1, 0, 13, 59, 0, 
+0, 0, 70, 0, 64, 0, 134, 0, 64, 0, 135, 64, 64, 1, 71, 128, 
+128, 0, 140, 128, 192, 0, 6, 1, 64, 0, 7, 193, 64, 2, 157, 128, 
+128, 1, 204, 0, 193, 0, 70, 1, 64, 0, 71, 65, 193, 2, 221, 128, 
+128, 1, 7, 193, 0, 1, 85, 1, 0, 2, 135, 129, 193, 0, 135, 193, 
+65, 3, 155, 65, 0, 0, 23, 0, 0, 128, 129, 1, 2, 0, 14, 128, 
+1, 0, 25, 0, 66, 0, 23, 0, 0, 128, 1, 0, 2, 0, 25, 64, 
+1, 132, 23, 128, 1, 128, 135, 65, 194, 0, 199, 65, 1, 2, 135, 193, 
+1, 3, 90, 0, 0, 3, 23, 64, 0, 128, 78, 129, 194, 2, 23, 128, 
+253, 127, 24, 0, 194, 2, 23, 0, 0, 128, 65, 129, 2, 0, 135, 65, 
+1, 2, 199, 129, 129, 0, 7, 66, 194, 0, 7, 130, 1, 4, 70, 2, 
+67, 0, 128, 2, 128, 3, 206, 2, 2, 0, 93, 130, 128, 1, 8, 64, 
+130, 133, 70, 2, 64, 0, 140, 66, 195, 0, 0, 3, 128, 1, 157, 130, 
+128, 1, 141, 66, 1, 5, 142, 130, 66, 5, 74, 130, 130, 130, 70, 2, 
+64, 0, 134, 194, 66, 0, 74, 130, 2, 135, 70, 194, 67, 0, 93, 66, 
+128, 0, 67, 2, 0, 0, 95, 2, 0, 1, 31, 0, 128, 0, 16, 0, 
+0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 112, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 112, 119, 105, 100, 116, 104, 
+0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 76, 105, 110, 
+101, 79, 102, 87, 111, 114, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 119, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 
+108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 101, 
+110, 116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 120, 115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 
+63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 111, 0, 4, 19, 0, 
+0, 0, 0, 0, 0, 0, 71, 101, 116, 79, 102, 102, 115, 101, 116, 70, 
+114, 111, 109, 87, 105, 100, 116, 104, 0, 4, 14, 0, 0, 0, 0, 0, 
+0, 0, 103, 101, 116, 87, 111, 114, 100, 79, 102, 76, 105, 110, 101, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 
+1, 0, 0, 181, 1, 0, 0, 0, 0, 10, 29, 0, 0, 0, 6, 0, 
+64, 0, 70, 0, 64, 0, 71, 64, 192, 0, 7, 64, 0, 0, 76, 128, 
+64, 0, 93, 128, 0, 1, 134, 0, 64, 0, 135, 192, 64, 1, 199, 128, 
+0, 0, 12, 1, 65, 0, 128, 1, 0, 1, 29, 1, 129, 1, 198, 65, 
+65, 0, 0, 2, 128, 1, 70, 2, 64, 0, 71, 130, 193, 4, 221, 129, 
+128, 1, 13, 193, 1, 2, 199, 193, 65, 0, 199, 1, 194, 3, 219, 65, 
+0, 0, 23, 0, 0, 128, 193, 65, 2, 0, 13, 193, 1, 2, 192, 1, 
+0, 2, 0, 2, 128, 2, 64, 2, 128, 0, 223, 1, 0, 2, 31, 0, 
+128, 0, 10, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 112, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 119, 114, 97, 
+112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 17, 
+0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 88, 79, 102, 102, 115, 101, 
+116, 79, 102, 87, 111, 114, 100, 0, 4, 19, 0, 0, 0, 0, 0, 0, 
+0, 71, 101, 116, 87, 105, 100, 116, 104, 70, 114, 111, 109, 79, 102, 102, 
+115, 101, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 105, 110, 100, 101, 110, 116, 0, 3, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 183, 1, 0, 0, 194, 1, 0, 0, 0, 0, 
+7, 35, 0, 0, 0, 5, 0, 0, 0, 29, 0, 129, 0, 213, 0, 0, 
+1, 24, 192, 128, 0, 23, 128, 3, 128, 198, 0, 192, 0, 199, 64, 192, 
+1, 221, 128, 128, 0, 219, 0, 0, 0, 23, 0, 2, 128, 198, 0, 192, 
+0, 199, 128, 192, 1, 221, 128, 128, 0, 219, 0, 0, 0, 23, 192, 0, 
+128, 198, 0, 192, 0, 199, 192, 192, 1, 0, 1, 0, 0, 221, 128, 0, 
+1, 223, 0, 0, 1, 198, 0, 193, 0, 6, 1, 193, 0, 70, 1, 193, 
+0, 71, 129, 193, 2, 7, 65, 1, 2, 12, 193, 65, 2, 141, 1, 194, 
+0, 29, 129, 128, 1, 202, 0, 129, 130, 198, 0, 192, 0, 199, 192, 192, 
+1, 0, 1, 0, 0, 222, 0, 0, 1, 223, 0, 0, 0, 31, 0, 128, 
+0, 9, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 
+101, 120, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 25, 0, 
+0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 
+105, 110, 103, 79, 102, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 
+14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 88, 80, 111, 115, 
+105, 116, 105, 111, 110, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 87, 111, 114, 100, 
+79, 102, 76, 105, 110, 101, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+0, 0, 0, 0, 2, 0, 0, 0, 1, 14, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+196, 1, 0, 0, 207, 1, 0, 0, 0, 0, 7, 34, 0, 0, 0, 5, 
+0, 0, 0, 29, 0, 129, 0, 24, 0, 192, 0, 23, 128, 3, 128, 198, 
+64, 192, 0, 199, 128, 192, 1, 221, 128, 128, 0, 219, 0, 0, 0, 23, 
+0, 2, 128, 198, 64, 192, 0, 199, 192, 192, 1, 221, 128, 128, 0, 219, 
+0, 0, 0, 23, 192, 0, 128, 198, 64, 192, 0, 199, 0, 193, 1, 0, 
+1, 0, 0, 221, 128, 0, 1, 223, 0, 0, 1, 198, 64, 193, 0, 6, 
+65, 193, 0, 70, 65, 193, 0, 71, 193, 193, 2, 7, 65, 1, 2, 12, 
+1, 66, 2, 142, 1, 192, 0, 29, 129, 128, 1, 202, 0, 1, 131, 198, 
+64, 192, 0, 199, 0, 193, 1, 0, 1, 0, 0, 222, 0, 0, 1, 223, 
+0, 0, 0, 31, 0, 128, 0, 9, 0, 0, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 
+0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 
+101, 118, 105, 111, 117, 115, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 
+4, 19, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 69, 110, 100, 
+79, 102, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 14, 0, 0, 
+0, 0, 0, 0, 0, 71, 111, 116, 111, 88, 80, 111, 115, 105, 116, 105, 
+111, 110, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 14, 0, 
+0, 0, 0, 0, 0, 0, 103, 101, 116, 87, 111, 114, 100, 79, 102, 76, 
+105, 110, 101, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 14, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 209, 1, 0, 0, 211, 1, 0, 0, 0, 0, 2, 6, 
+0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 65, 128, 0, 0, 30, 
+0, 0, 1, 31, 0, 0, 0, 31, 0, 128, 0, 3, 0, 0, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 14, 0, 0, 
+0, 0, 0, 0, 0, 71, 111, 116, 111, 88, 80, 111, 115, 105, 116, 105, 
+111, 110, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 213, 1, 0, 0, 215, 1, 
+0, 0, 0, 0, 2, 6, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 
+0, 70, 128, 64, 0, 30, 0, 0, 1, 31, 0, 0, 0, 31, 0, 128, 
+0, 3, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 88, 
+80, 111, 115, 105, 116, 105, 111, 110, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 217, 1, 0, 0, 
+226, 1, 0, 0, 0, 0, 5, 28, 0, 0, 0, 6, 0, 64, 0, 7, 
+64, 64, 0, 27, 0, 0, 0, 23, 0, 5, 128, 6, 0, 64, 0, 7, 
+128, 64, 0, 27, 0, 0, 0, 23, 0, 4, 128, 5, 0, 128, 0, 29, 
+0, 129, 0, 198, 0, 64, 0, 6, 1, 64, 0, 7, 65, 64, 2, 202, 
+0, 129, 129, 198, 0, 64, 0, 6, 1, 64, 0, 7, 129, 64, 2, 202, 
+0, 1, 130, 198, 0, 64, 0, 202, 128, 193, 130, 198, 192, 65, 0, 199, 
+0, 194, 1, 0, 1, 0, 0, 222, 0, 0, 1, 223, 0, 0, 0, 3, 
+0, 0, 0, 31, 0, 0, 1, 31, 0, 128, 0, 9, 0, 0, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 111, 112, 112, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 116, 111, 112, 119, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 67, 109, 100, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 
+71, 111, 116, 111, 88, 80, 111, 115, 105, 116, 105, 111, 110, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 0, 0, 1, 14, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 1, 
+0, 0, 237, 1, 0, 0, 0, 0, 5, 28, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 27, 0, 0, 0, 23, 0, 5, 128, 6, 0, 64, 
+0, 7, 128, 64, 0, 27, 0, 0, 0, 23, 0, 4, 128, 5, 0, 128, 
+0, 29, 0, 129, 0, 198, 0, 64, 0, 6, 1, 64, 0, 7, 65, 64, 
+2, 202, 0, 129, 129, 198, 0, 64, 0, 6, 1, 64, 0, 7, 129, 64, 
+2, 202, 0, 1, 130, 198, 0, 64, 0, 202, 128, 193, 130, 198, 192, 65, 
+0, 199, 0, 194, 1, 0, 1, 0, 0, 222, 0, 0, 1, 223, 0, 0, 
+0, 3, 0, 0, 0, 31, 0, 0, 1, 31, 0, 128, 0, 9, 0, 0, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 111, 116, 112, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 111, 116, 119, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+99, 111, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 14, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 116, 111, 88, 80, 111, 115, 105, 116, 105, 111, 110, 0, 
+0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 14, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+247, 1, 0, 0, 46, 2, 0, 0, 1, 0, 35, 105, 0, 0, 0, 70, 
+0, 64, 0, 71, 64, 192, 0, 91, 64, 0, 0, 23, 64, 0, 128, 67, 
+0, 0, 0, 95, 0, 0, 1, 70, 0, 64, 0, 76, 128, 192, 0, 93, 
+192, 1, 1, 198, 1, 64, 0, 199, 193, 192, 3, 6, 2, 64, 0, 7, 
+2, 65, 4, 70, 2, 64, 0, 71, 66, 193, 4, 133, 2, 128, 0, 198, 
+2, 0, 1, 157, 194, 0, 1, 0, 3, 128, 0, 64, 3, 0, 2, 129, 
+131, 1, 0, 33, 131, 17, 128, 6, 4, 64, 0, 7, 196, 3, 8, 65, 
+132, 1, 0, 149, 4, 0, 8, 24, 64, 128, 7, 23, 0, 0, 128, 64, 
+4, 0, 1, 24, 0, 129, 7, 23, 0, 0, 128, 128, 4, 128, 2, 203, 
+4, 0, 0, 0, 5, 128, 8, 64, 5, 0, 9, 129, 133, 1, 0, 33, 
+69, 10, 128, 7, 198, 5, 8, 65, 134, 1, 0, 149, 6, 0, 12, 141, 
+134, 65, 13, 24, 64, 128, 7, 23, 128, 0, 128, 24, 128, 128, 11, 23, 
+0, 0, 128, 64, 6, 128, 1, 24, 0, 129, 7, 23, 128, 0, 128, 24, 
+64, 129, 11, 23, 0, 0, 128, 128, 6, 0, 3, 24, 192, 129, 7, 23, 
+64, 3, 128, 24, 0, 130, 11, 23, 192, 2, 128, 198, 6, 64, 0, 5, 
+7, 128, 1, 64, 7, 0, 12, 128, 7, 0, 5, 192, 7, 128, 5, 0, 
+8, 128, 12, 64, 8, 0, 13, 128, 8, 128, 4, 29, 199, 128, 3, 202, 
+70, 135, 130, 0, 6, 0, 14, 23, 0, 2, 128, 197, 6, 128, 1, 0, 
+7, 0, 12, 64, 7, 0, 5, 128, 7, 128, 5, 192, 7, 128, 12, 0, 
+8, 0, 13, 65, 200, 1, 0, 221, 134, 128, 3, 0, 6, 128, 13, 213, 
+6, 128, 9, 205, 134, 193, 13, 202, 4, 134, 13, 32, 5, 245, 127, 6, 
+5, 64, 0, 70, 5, 66, 0, 135, 69, 66, 8, 204, 133, 66, 8, 65, 
+134, 1, 0, 142, 134, 193, 8, 221, 133, 0, 2, 0, 6, 128, 9, 76, 
+134, 66, 8, 205, 134, 65, 9, 93, 6, 128, 1, 93, 133, 0, 0, 10, 
+69, 133, 7, 32, 195, 237, 127, 6, 195, 66, 0, 7, 3, 67, 6, 29, 
+67, 128, 0, 6, 67, 67, 0, 12, 131, 67, 6, 29, 67, 0, 1, 6, 
+195, 67, 0, 29, 67, 128, 0, 3, 3, 128, 0, 31, 3, 0, 1, 31, 
+0, 128, 0, 16, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 109, 112, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
+116, 77, 97, 114, 107, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 16, 0, 
+0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 
+103, 114, 97, 112, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 
+116, 121, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 117, 
+98, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 85, 110, 115, 101, 116, 77, 97, 114, 
+107, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+116, 111, 117, 99, 104, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 
+117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 4, 
+0, 0, 0, 0, 0, 1, 13, 1, 15, 1, 7, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 
+2, 0, 0, 57, 2, 0, 0, 1, 0, 6, 21, 0, 0, 0, 70, 0, 
+64, 0, 71, 64, 192, 0, 91, 0, 0, 0, 23, 0, 1, 128, 70, 128, 
+64, 0, 71, 192, 192, 0, 128, 0, 0, 0, 94, 0, 0, 1, 95, 0, 
+0, 0, 69, 0, 128, 0, 134, 0, 0, 1, 93, 192, 0, 1, 198, 0, 
+65, 0, 0, 1, 128, 0, 64, 1, 0, 1, 221, 64, 128, 1, 198, 64, 
+65, 0, 221, 64, 128, 0, 195, 0, 128, 0, 223, 0, 0, 1, 31, 0, 
+128, 0, 6, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 109, 112, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 
+0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 65, 112, 112, 108, 121, 83, 
+116, 121, 108, 101, 84, 111, 83, 101, 108, 101, 99, 116, 105, 111, 110, 0, 
+4, 20, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 67, 117, 114, 114, 
+101, 110, 116, 83, 116, 121, 108, 101, 72, 105, 110, 116, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 13, 1, 15, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 59, 2, 0, 0, 65, 2, 0, 0, 0, 0, 6, 14, 
+0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 
+128, 192, 0, 134, 0, 64, 0, 135, 192, 64, 1, 197, 0, 128, 0, 6, 
+1, 64, 0, 7, 1, 0, 2, 7, 65, 0, 2, 64, 1, 0, 1, 222, 
+0, 128, 1, 223, 0, 0, 0, 31, 0, 128, 0, 4, 0, 0, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 99, 111, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 
+8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 67, 2, 0, 0, 81, 2, 0, 0, 0, 0, 6, 
+25, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 
+71, 128, 192, 0, 134, 0, 64, 0, 135, 192, 64, 1, 24, 0, 65, 1, 
+23, 0, 2, 128, 24, 0, 193, 0, 23, 64, 0, 128, 193, 64, 1, 0, 
+223, 0, 0, 1, 78, 0, 193, 0, 198, 0, 64, 0, 199, 0, 128, 1, 
+199, 64, 128, 1, 149, 0, 128, 1, 197, 0, 128, 0, 6, 1, 64, 0, 
+7, 1, 0, 2, 7, 65, 0, 2, 64, 1, 0, 1, 222, 0, 128, 1, 
+223, 0, 0, 0, 31, 0, 128, 0, 6, 0, 0, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+111, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 3, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 8, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 83, 2, 0, 0, 88, 2, 0, 0, 1, 0, 4, 12, 
+0, 0, 0, 70, 0, 64, 0, 71, 64, 192, 0, 76, 128, 192, 0, 192, 
+0, 0, 0, 93, 64, 128, 1, 70, 192, 64, 0, 93, 64, 128, 0, 70, 
+0, 65, 0, 93, 64, 128, 0, 67, 0, 128, 0, 95, 0, 0, 1, 31, 
+0, 128, 0, 5, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 
+68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 109, 101, 110, 117, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 97, 99, 116, 105, 118, 97, 116, 101, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 
+110, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 96, 2, 0, 0, 103, 2, 0, 0, 0, 0, 3, 
+15, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 0, 0, 0, 
+23, 192, 1, 128, 6, 128, 64, 0, 65, 192, 0, 0, 129, 0, 1, 0, 
+29, 128, 128, 1, 27, 64, 0, 0, 23, 64, 0, 128, 3, 0, 0, 0, 
+31, 0, 0, 1, 3, 0, 128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 
+5, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 99, 104, 97, 110, 103, 101, 100, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 80, 114, 111, 109, 112, 116, 70, 111, 114, 89, 101, 115, 78, 
+111, 0, 4, 24, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 32, 115, 101, 116, 32, 110, 111, 116, 32, 115, 97, 118, 101, 
+100, 33, 0, 4, 127, 0, 0, 0, 0, 0, 0, 0, 83, 111, 109, 101, 
+32, 111, 102, 32, 116, 104, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 
+115, 32, 105, 110, 32, 116, 104, 105, 115, 32, 100, 111, 99, 117, 109, 101, 
+110, 116, 32, 115, 101, 116, 32, 99, 111, 110, 116, 97, 105, 110, 32, 117, 
+110, 115, 97, 118, 101, 100, 32, 101, 100, 105, 116, 115, 46, 32, 65, 114, 
+101, 32, 121, 111, 117, 32, 115, 117, 114, 101, 32, 121, 111, 117, 32, 119, 
+97, 110, 116, 32, 116, 111, 32, 100, 105, 115, 99, 97, 114, 100, 32, 116, 
+104, 101, 109, 44, 32, 119, 105, 116, 104, 111, 117, 116, 32, 115, 97, 118, 
+105, 110, 103, 32, 102, 105, 114, 115, 116, 63, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 2, 0, 0, 111, 2, 0, 
+0, 0, 0, 2, 10, 0, 0, 0, 6, 0, 64, 0, 29, 128, 128, 0, 
+27, 0, 0, 0, 23, 128, 0, 128, 6, 64, 64, 0, 7, 128, 64, 0, 
+29, 64, 128, 0, 3, 0, 0, 0, 31, 0, 0, 1, 31, 0, 128, 0, 
+3, 0, 0, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 
+102, 105, 114, 109, 68, 111, 99, 117, 109, 101, 110, 116, 69, 114, 97, 115, 
+117, 114, 101, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 111, 115, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 101, 120, 105, 116, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 2, 0, 0, 
+121, 2, 0, 0, 0, 0, 2, 13, 0, 0, 0, 6, 0, 64, 0, 29, 
+128, 128, 0, 27, 0, 0, 0, 23, 64, 1, 128, 6, 64, 64, 0, 29, 
+64, 128, 0, 6, 128, 64, 0, 29, 64, 128, 0, 3, 0, 128, 0, 31, 
+0, 0, 1, 3, 0, 0, 0, 31, 0, 0, 1, 31, 0, 128, 0, 3, 
+0, 0, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 
+105, 114, 109, 68, 111, 99, 117, 109, 101, 110, 116, 69, 114, 97, 115, 117, 
+114, 101, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 82, 101, 115, 101, 
+116, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+123, 2, 0, 0, 129, 2, 0, 0, 0, 0, 11, 18, 0, 0, 0, 11, 
+0, 0, 0, 70, 0, 64, 0, 134, 64, 64, 0, 135, 128, 64, 1, 93, 
+0, 1, 1, 23, 192, 1, 128, 149, 1, 0, 0, 141, 193, 64, 3, 199, 
+1, 193, 2, 1, 66, 1, 0, 71, 130, 193, 2, 129, 194, 1, 0, 214, 
+129, 130, 3, 10, 192, 1, 3, 98, 128, 0, 0, 227, 64, 253, 127, 31, 
+0, 0, 1, 31, 0, 128, 0, 8, 0, 0, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 112, 97, 105, 114, 115, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 101, 115, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 110, 97, 109, 101, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 32, 
+40, 72, 84, 77, 76, 58, 32, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 104, 116, 109, 108, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 41, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 
+2, 0, 0, 154, 2, 0, 0, 1, 0, 11, 52, 0, 0, 0, 70, 0, 
+64, 0, 71, 64, 192, 0, 7, 0, 128, 0, 27, 64, 0, 0, 23, 64, 
+1, 128, 70, 128, 64, 0, 129, 192, 0, 0, 193, 0, 1, 0, 93, 64, 
+128, 1, 67, 0, 0, 0, 95, 0, 0, 1, 68, 0, 128, 0, 198, 64, 
+65, 0, 199, 128, 193, 1, 219, 0, 0, 0, 23, 128, 2, 128, 196, 0, 
+0, 0, 6, 65, 65, 0, 12, 193, 65, 2, 29, 193, 1, 1, 192, 0, 
+128, 4, 192, 0, 0, 4, 128, 0, 128, 3, 192, 0, 0, 3, 192, 0, 
+128, 2, 64, 0, 0, 2, 23, 128, 0, 128, 198, 64, 65, 0, 71, 0, 
+194, 1, 128, 0, 128, 0, 192, 0, 128, 0, 0, 1, 0, 1, 65, 65, 
+2, 0, 225, 128, 1, 128, 198, 65, 65, 0, 6, 130, 66, 0, 64, 2, 
+0, 0, 134, 66, 65, 0, 135, 130, 1, 5, 29, 130, 128, 1, 202, 1, 
+2, 3, 224, 192, 253, 127, 198, 0, 64, 0, 204, 192, 194, 1, 221, 64, 
+0, 1, 198, 0, 67, 0, 221, 64, 128, 0, 198, 64, 67, 0, 199, 128, 
+195, 1, 222, 0, 128, 0, 223, 0, 0, 0, 31, 0, 128, 0, 15, 0, 
+0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+115, 116, 121, 108, 101, 115, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 24, 0, 
+0, 0, 0, 0, 0, 0, 85, 110, 107, 110, 111, 119, 110, 32, 112, 97, 
+114, 97, 103, 114, 97, 112, 104, 32, 115, 116, 121, 108, 101, 0, 4, 77, 
+0, 0, 0, 0, 0, 0, 0, 83, 111, 114, 114, 121, 33, 32, 73, 32, 
+100, 111, 110, 39, 116, 32, 114, 101, 99, 111, 103, 110, 105, 115, 101, 32, 
+116, 104, 97, 116, 32, 115, 116, 121, 108, 101, 46, 32, 40, 84, 104, 105, 
+115, 32, 117, 115, 101, 114, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 
+32, 119, 105, 108, 108, 32, 98, 101, 32, 105, 109, 112, 114, 111, 118, 101, 
+100, 46, 41, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 
+112, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 77, 97, 
+114, 107, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 
+3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 117, 99, 104, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 
+101, 100, 114, 97, 119, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 
+109, 100, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 85, 110, 115, 101, 
+116, 77, 97, 114, 107, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 156, 2, 0, 0, 171, 2, 0, 0, 0, 0, 2, 32, 
+0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 0, 0, 0, 23, 
+0, 2, 128, 6, 0, 64, 0, 10, 128, 192, 128, 6, 0, 64, 0, 10, 
+128, 192, 129, 6, 0, 64, 0, 10, 128, 64, 130, 6, 0, 64, 0, 10, 
+128, 193, 130, 23, 64, 3, 128, 6, 0, 64, 0, 70, 0, 64, 0, 71, 
+192, 193, 0, 10, 64, 128, 128, 6, 0, 64, 0, 70, 0, 64, 0, 71, 
+0, 194, 0, 10, 64, 128, 129, 6, 0, 64, 0, 70, 0, 64, 0, 71, 
+64, 194, 0, 10, 64, 0, 130, 6, 0, 64, 0, 10, 128, 194, 130, 6, 
+192, 66, 0, 29, 64, 128, 0, 3, 0, 128, 0, 31, 0, 0, 1, 31, 
+0, 128, 0, 12, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 109, 112, 0, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 
+119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 111, 0, 4, 17, 
+0, 0, 0, 0, 0, 0, 0, 115, 116, 105, 99, 107, 121, 95, 115, 101, 
+108, 101, 99, 116, 105, 111, 110, 0, 1, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 1, 1, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 
+100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 173, 2, 0, 0, 181, 2, 0, 0, 0, 0, 2, 21, 0, 
+0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 64, 0, 0, 23, 64, 
+3, 128, 6, 0, 64, 0, 70, 0, 64, 0, 71, 128, 192, 0, 10, 64, 
+128, 128, 6, 0, 64, 0, 70, 0, 64, 0, 71, 0, 193, 0, 10, 64, 
+128, 129, 6, 0, 64, 0, 70, 0, 64, 0, 71, 128, 193, 0, 10, 64, 
+128, 130, 6, 0, 64, 0, 10, 0, 194, 131, 3, 0, 128, 0, 31, 0, 
+0, 1, 31, 0, 128, 0, 9, 0, 0, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 109, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 119, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 109, 111, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 111, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 115, 116, 105, 
+99, 107, 121, 95, 115, 101, 108, 101, 99, 116, 105, 111, 110, 0, 1, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 2, 
+0, 0, 190, 2, 0, 0, 0, 0, 2, 11, 0, 0, 0, 6, 0, 64, 
+0, 10, 128, 192, 128, 6, 0, 64, 0, 10, 128, 192, 129, 6, 0, 64, 
+0, 10, 128, 64, 130, 6, 64, 65, 0, 29, 64, 128, 0, 3, 0, 128, 
+0, 31, 0, 0, 1, 31, 0, 128, 0, 6, 0, 0, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 109, 112, 0, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 109, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 109, 111, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 
+117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 192, 2, 0, 0, 197, 2, 0, 0, 0, 
+0, 2, 15, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 0, 
+0, 0, 23, 192, 1, 128, 6, 0, 64, 0, 7, 128, 64, 0, 27, 64, 
+0, 0, 23, 192, 0, 128, 6, 192, 64, 0, 7, 0, 65, 0, 30, 0, 
+128, 0, 31, 0, 0, 0, 3, 0, 128, 0, 31, 0, 0, 1, 31, 0, 
+128, 0, 5, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 109, 112, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 115, 116, 105, 
+99, 107, 121, 95, 115, 101, 108, 101, 99, 116, 105, 111, 110, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 85, 110, 115, 101, 116, 77, 97, 114, 107, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 199, 2, 0, 0, 
+204, 2, 0, 0, 0, 0, 2, 15, 0, 0, 0, 6, 0, 64, 0, 7, 
+64, 64, 0, 27, 0, 0, 0, 23, 192, 1, 128, 6, 0, 64, 0, 7, 
+128, 64, 0, 27, 64, 0, 0, 23, 192, 0, 128, 6, 192, 64, 0, 7, 
+0, 65, 0, 30, 0, 128, 0, 31, 0, 0, 0, 3, 0, 128, 0, 31, 
+0, 0, 1, 31, 0, 128, 0, 5, 0, 0, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 115, 116, 105, 99, 107, 121, 95, 115, 101, 108, 101, 99, 116, 105, 
+111, 110, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 68, 101, 108, 101, 116, 101, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206, 2, 
+0, 0, 211, 2, 0, 0, 0, 0, 2, 20, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 29, 128, 128, 0, 27, 0, 0, 0, 23, 0, 3, 
+128, 6, 0, 64, 0, 7, 128, 64, 0, 29, 128, 128, 0, 27, 0, 0, 
+0, 23, 192, 1, 128, 6, 0, 64, 0, 7, 192, 64, 0, 29, 128, 128, 
+0, 27, 0, 0, 0, 23, 128, 0, 128, 6, 0, 64, 0, 7, 0, 65, 
+0, 29, 128, 128, 0, 31, 0, 0, 1, 31, 0, 128, 0, 5, 0, 0, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 85, 110, 115, 101, 116, 77, 97, 114, 107, 
+0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 66, 101, 
+103, 105, 110, 110, 105, 110, 103, 79, 102, 87, 111, 114, 100, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 77, 97, 114, 107, 0, 4, 
+14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 69, 110, 100, 79, 
+102, 87, 111, 114, 100, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 213, 2, 0, 0, 221, 2, 0, 0, 1, 0, 4, 17, 
+0, 0, 0, 70, 0, 64, 0, 76, 64, 192, 0, 192, 0, 0, 0, 93, 
+128, 128, 1, 91, 64, 0, 0, 23, 64, 0, 128, 67, 0, 0, 0, 95, 
+0, 0, 1, 70, 0, 64, 0, 76, 128, 192, 0, 192, 0, 0, 0, 93, 
+64, 128, 1, 70, 192, 64, 0, 93, 64, 128, 0, 67, 0, 128, 0, 95, 
+0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 
+101, 116, 67, 117, 114, 114, 101, 110, 116, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 2, 0, 
+0, 225, 2, 0, 0, 0, 0, 2, 11, 0, 0, 0, 6, 0, 64, 0, 
+7, 64, 64, 0, 67, 0, 128, 0, 29, 128, 0, 1, 27, 0, 0, 0, 
+23, 128, 0, 128, 6, 0, 64, 0, 7, 128, 64, 0, 29, 128, 128, 0, 
+31, 0, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 67, 111, 112, 121, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+68, 101, 108, 101, 116, 101, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 227, 2, 0, 0, 41, 3, 0, 0, 1, 0, 18, 
+122, 0, 0, 0, 70, 0, 64, 0, 71, 64, 192, 0, 91, 64, 0, 0, 
+23, 64, 0, 128, 67, 0, 0, 0, 95, 0, 0, 1, 70, 0, 64, 0, 
+76, 128, 192, 0, 93, 192, 1, 1, 198, 193, 64, 0, 221, 129, 128, 0, 
+6, 2, 65, 0, 12, 66, 65, 4, 128, 2, 128, 3, 29, 66, 128, 1, 
+0, 2, 128, 0, 64, 2, 0, 2, 129, 130, 1, 0, 33, 66, 1, 128, 
+6, 3, 64, 0, 7, 195, 2, 6, 76, 195, 193, 3, 204, 3, 66, 6, 
+221, 3, 0, 1, 93, 67, 0, 0, 32, 2, 254, 127, 12, 66, 194, 3, 
+129, 130, 1, 0, 29, 66, 128, 1, 4, 2, 0, 0, 25, 128, 0, 131, 
+23, 128, 2, 128, 7, 130, 193, 3, 70, 130, 66, 0, 135, 194, 66, 4, 
+204, 2, 67, 4, 64, 3, 0, 1, 221, 2, 128, 1, 93, 130, 0, 0, 
+202, 65, 2, 131, 24, 0, 129, 0, 23, 0, 0, 128, 78, 129, 128, 2, 
+85, 2, 128, 3, 7, 66, 130, 3, 85, 2, 0, 4, 25, 64, 130, 2, 
+23, 0, 2, 128, 85, 2, 128, 3, 134, 130, 66, 0, 199, 194, 66, 4, 
+12, 3, 67, 4, 129, 131, 1, 0, 192, 3, 128, 2, 29, 3, 0, 2, 
+157, 130, 0, 0, 202, 129, 130, 4, 7, 130, 193, 3, 71, 130, 65, 4, 
+8, 64, 130, 134, 70, 66, 67, 0, 91, 2, 0, 0, 23, 192, 4, 128, 
+70, 130, 66, 0, 135, 194, 66, 4, 203, 2, 0, 0, 5, 3, 128, 0, 
+70, 67, 67, 0, 129, 131, 1, 0, 192, 3, 128, 1, 29, 3, 0, 2, 
+228, 66, 0, 0, 12, 3, 67, 4, 129, 131, 3, 0, 29, 3, 128, 1, 
+93, 130, 0, 0, 202, 65, 2, 131, 24, 0, 129, 0, 23, 192, 0, 128, 
+24, 64, 1, 1, 23, 64, 0, 128, 78, 194, 0, 3, 141, 129, 193, 4, 
+85, 2, 128, 3, 7, 66, 130, 3, 85, 2, 0, 4, 71, 66, 2, 4, 
+8, 64, 130, 134, 70, 66, 67, 0, 91, 2, 0, 0, 23, 64, 4, 128, 
+85, 2, 128, 3, 134, 130, 66, 0, 199, 194, 66, 4, 12, 3, 67, 4, 
+129, 131, 1, 0, 213, 3, 0, 4, 206, 131, 193, 7, 29, 131, 0, 2, 
+69, 3, 128, 0, 134, 67, 67, 0, 192, 3, 0, 3, 6, 68, 67, 0, 
+12, 196, 67, 8, 29, 132, 0, 1, 13, 132, 65, 8, 93, 3, 0, 2, 
+157, 130, 0, 0, 202, 129, 130, 4, 70, 2, 68, 0, 129, 66, 4, 0, 
+93, 66, 0, 1, 27, 64, 0, 0, 23, 0, 1, 128, 70, 130, 68, 0, 
+71, 194, 196, 4, 94, 2, 128, 0, 95, 2, 0, 0, 23, 64, 0, 128, 
+67, 2, 128, 0, 95, 2, 0, 1, 31, 0, 128, 0, 20, 0, 0, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 77, 97, 114, 107, 115, 0, 
+4, 15, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 115, 101, 116, 67, 108, 105, 112, 98, 111, 97, 
+114, 100, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 16, 0, 0, 
+0, 0, 0, 0, 0, 97, 112, 112, 101, 110, 100, 80, 97, 114, 97, 103, 
+114, 97, 112, 104, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 99, 111, 
+112, 121, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 100, 101, 108, 101, 
+116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 65, 116, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+115, 116, 121, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+117, 98, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 119, 111, 114, 100, 
+0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 108, 101, 110, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 
+78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 
+4, 35, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 99, 116, 101, 
+100, 32, 97, 114, 101, 97, 32, 99, 111, 112, 105, 101, 100, 32, 116, 111, 
+32, 99, 108, 105, 112, 98, 111, 97, 114, 100, 46, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 85, 110, 115, 101, 116, 77, 97, 114, 107, 0, 0, 0, 0, 0, 
+2, 0, 0, 0, 0, 0, 1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 3, 0, 0, 
+116, 3, 0, 0, 1, 0, 20, 128, 0, 0, 0, 70, 0, 64, 0, 71, 
+64, 192, 0, 134, 128, 64, 0, 135, 192, 64, 1, 157, 64, 128, 0, 134, 
+0, 64, 0, 198, 0, 64, 0, 199, 0, 193, 1, 135, 192, 0, 1, 203, 
+0, 0, 0, 6, 65, 65, 0, 71, 129, 65, 0, 29, 1, 1, 1, 23, 
+0, 3, 128, 75, 194, 0, 0, 74, 2, 130, 131, 74, 194, 1, 132, 74, 
+130, 128, 132, 134, 130, 66, 0, 198, 194, 66, 0, 199, 2, 195, 5, 0, 
+3, 128, 4, 157, 66, 128, 1, 149, 2, 128, 1, 141, 130, 65, 5, 199, 
+194, 193, 4, 202, 192, 2, 5, 34, 129, 0, 0, 163, 1, 252, 127, 6, 
+1, 64, 0, 70, 1, 64, 0, 71, 1, 193, 2, 134, 65, 67, 0, 199, 
+129, 67, 1, 12, 194, 67, 1, 129, 130, 1, 0, 192, 2, 128, 0, 29, 
+130, 0, 2, 64, 2, 128, 1, 140, 194, 67, 1, 13, 131, 193, 0, 157, 
+2, 128, 1, 157, 129, 0, 0, 10, 129, 129, 2, 6, 1, 64, 0, 70, 
+1, 64, 0, 71, 65, 192, 2, 149, 1, 128, 1, 77, 129, 129, 2, 10, 
+65, 129, 128, 6, 1, 64, 0, 10, 129, 65, 136, 6, 1, 64, 0, 7, 
+65, 64, 2, 70, 1, 64, 0, 74, 65, 128, 128, 70, 129, 64, 0, 71, 
+65, 196, 2, 93, 65, 128, 0, 70, 1, 64, 0, 142, 129, 65, 2, 74, 
+129, 129, 128, 21, 1, 0, 0, 25, 0, 1, 131, 23, 192, 11, 128, 6, 
+129, 64, 0, 7, 129, 68, 2, 29, 65, 128, 0, 1, 193, 4, 0, 65, 
+193, 4, 0, 149, 1, 0, 0, 193, 129, 1, 0, 97, 129, 9, 128, 71, 
+2, 2, 0, 139, 2, 0, 0, 198, 66, 65, 0, 7, 3, 2, 0, 221, 
+2, 1, 1, 23, 0, 3, 128, 11, 196, 0, 0, 10, 196, 131, 131, 10, 
+132, 3, 132, 10, 68, 130, 132, 70, 132, 66, 0, 134, 196, 66, 0, 135, 
+4, 67, 9, 192, 4, 0, 8, 93, 68, 128, 1, 85, 4, 0, 5, 77, 
+132, 193, 8, 135, 196, 65, 8, 138, 130, 132, 8, 226, 130, 0, 0, 99, 
+3, 252, 127, 198, 2, 64, 0, 204, 2, 197, 5, 70, 67, 67, 0, 135, 
+131, 195, 4, 192, 3, 0, 5, 93, 131, 128, 1, 134, 3, 64, 0, 135, 
+3, 65, 7, 221, 66, 0, 2, 198, 2, 64, 0, 6, 3, 64, 0, 7, 
+3, 65, 6, 13, 131, 65, 6, 202, 2, 3, 130, 198, 2, 64, 0, 202, 
+130, 193, 128, 198, 2, 64, 0, 202, 130, 65, 136, 96, 193, 245, 127, 6, 
+129, 64, 0, 7, 65, 69, 2, 29, 129, 128, 0, 27, 1, 0, 0, 23, 
+192, 1, 128, 6, 129, 64, 0, 7, 129, 69, 2, 29, 129, 128, 0, 27, 
+1, 0, 0, 23, 128, 0, 128, 6, 129, 64, 0, 7, 65, 68, 2, 29, 
+129, 128, 0, 31, 1, 0, 1, 31, 0, 128, 0, 23, 0, 0, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 119, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 17, 0, 0, 0, 0, 
+0, 0, 0, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 87, 
+111, 114, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 
+3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 119, 111, 114, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+119, 110, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 97, 
+103, 114, 97, 112, 104, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 70, 
+105, 114, 101, 69, 118, 101, 110, 116, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 69, 118, 101, 110, 116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 
+0, 87, 111, 114, 100, 77, 111, 100, 105, 102, 105, 101, 100, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+115, 116, 121, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 115, 
+117, 98, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 74, 111, 105, 110, 87, 105, 116, 104, 
+78, 101, 120, 116, 87, 111, 114, 100, 0, 4, 22, 0, 0, 0, 0, 0, 
+0, 0, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 80, 97, 
+114, 97, 103, 114, 97, 112, 104, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+64, 4, 22, 0, 0, 0, 0, 0, 0, 0, 105, 110, 115, 101, 114, 116, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 66, 101, 102, 111, 114, 101, 0, 
+4, 20, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 66, 101, 103, 
+105, 110, 110, 105, 110, 103, 79, 102, 87, 111, 114, 100, 0, 4, 18, 0, 
+0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 
+117, 115, 67, 104, 97, 114, 87, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 118, 3, 0, 0, 131, 3, 0, 0, 0, 0, 
+3, 26, 0, 0, 0, 6, 0, 64, 0, 12, 64, 64, 0, 29, 128, 0, 
+1, 27, 64, 0, 0, 23, 64, 0, 128, 67, 0, 0, 0, 95, 0, 0, 
+1, 70, 128, 64, 0, 71, 192, 192, 0, 91, 0, 0, 0, 23, 128, 1, 
+128, 70, 0, 65, 0, 71, 64, 193, 0, 93, 128, 128, 0, 91, 64, 0, 
+0, 23, 64, 0, 128, 67, 0, 0, 0, 95, 0, 0, 1, 70, 128, 65, 
+0, 129, 192, 1, 0, 93, 64, 0, 1, 69, 0, 128, 0, 128, 0, 0, 
+0, 94, 0, 0, 1, 95, 0, 0, 0, 31, 0, 128, 0, 8, 0, 0, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 103, 
+101, 116, 67, 108, 105, 112, 98, 111, 97, 114, 100, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 67, 109, 100, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+68, 101, 108, 101, 116, 101, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 
+78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 
+4, 37, 0, 0, 0, 0, 0, 0, 0, 67, 108, 105, 112, 98, 111, 97, 
+114, 100, 32, 99, 111, 112, 105, 101, 100, 32, 116, 111, 32, 99, 117, 114, 
+115, 111, 114, 32, 112, 111, 115, 105, 116, 105, 111, 110, 46, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 0, 0, 1, 17, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 3, 
+0, 0, 168, 3, 0, 0, 1, 0, 14, 80, 0, 0, 0, 27, 64, 0, 
+0, 23, 64, 0, 128, 67, 0, 0, 0, 95, 0, 0, 1, 75, 0, 0, 
+0, 128, 0, 0, 0, 193, 0, 0, 0, 150, 192, 0, 1, 140, 64, 64, 
+1, 1, 129, 0, 0, 157, 0, 129, 1, 23, 64, 3, 128, 149, 1, 128, 
+0, 141, 193, 64, 3, 198, 1, 65, 0, 0, 2, 128, 2, 221, 129, 0, 
+1, 204, 65, 193, 3, 65, 130, 1, 0, 129, 194, 1, 0, 221, 129, 0, 
+2, 204, 65, 193, 3, 65, 2, 2, 0, 129, 66, 2, 0, 221, 129, 0, 
+2, 74, 192, 1, 3, 162, 64, 0, 0, 35, 193, 251, 127, 134, 128, 66, 
+0, 135, 192, 66, 1, 135, 0, 67, 1, 203, 0, 0, 0, 6, 65, 67, 
+0, 64, 1, 128, 0, 29, 1, 1, 1, 23, 128, 8, 128, 70, 130, 67, 
+0, 128, 2, 0, 4, 93, 130, 0, 1, 135, 194, 192, 4, 88, 64, 66, 
+5, 23, 192, 5, 128, 24, 192, 192, 3, 23, 128, 2, 128, 140, 194, 67, 
+4, 1, 3, 4, 0, 157, 130, 128, 1, 155, 2, 0, 0, 23, 64, 1, 
+128, 134, 66, 68, 0, 135, 130, 68, 5, 192, 2, 128, 4, 1, 195, 0, 
+0, 65, 67, 2, 0, 157, 66, 0, 2, 149, 2, 128, 0, 24, 128, 130, 
+3, 23, 192, 1, 128, 140, 194, 67, 4, 1, 195, 4, 0, 157, 130, 128, 
+1, 155, 2, 0, 0, 23, 128, 0, 128, 149, 2, 128, 4, 141, 194, 64, 
+5, 74, 66, 66, 5, 134, 2, 69, 0, 192, 2, 0, 1, 0, 3, 128, 
+4, 157, 130, 128, 1, 202, 128, 130, 3, 34, 129, 0, 0, 163, 129, 246, 
+127, 6, 65, 69, 0, 29, 65, 128, 0, 5, 1, 128, 0, 64, 1, 128, 
+1, 30, 1, 0, 1, 31, 1, 0, 0, 31, 0, 128, 0, 22, 0, 0, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 10, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 103, 109, 97, 116, 99, 104, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 40, 91, 94, 10, 93, 42, 41, 10, 0, 3, 0, 
+0, 0, 0, 0, 0, 240, 63, 4, 19, 0, 0, 0, 0, 0, 0, 0, 
+67, 97, 110, 111, 110, 105, 99, 97, 108, 105, 115, 101, 83, 116, 114, 105, 
+110, 103, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 103, 115, 117, 98, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 9, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 32, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+37, 99, 43, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 12, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 
+101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 121, 108, 
+101, 115, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 21, 
+0, 0, 0, 0, 0, 0, 0, 80, 97, 114, 115, 101, 83, 116, 114, 105, 
+110, 103, 73, 110, 116, 111, 87, 111, 114, 100, 115, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 94, 32, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 
+97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 110, 
+115, 101, 114, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 32, 36, 
+0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 17, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 
+3, 0, 0, 220, 3, 0, 0, 0, 0, 13, 82, 0, 0, 0, 6, 0, 
+64, 0, 7, 64, 64, 0, 27, 64, 0, 0, 23, 64, 0, 128, 3, 0, 
+0, 0, 31, 0, 0, 1, 6, 0, 64, 0, 12, 128, 64, 0, 29, 192, 
+1, 1, 134, 1, 64, 0, 138, 193, 128, 129, 134, 1, 64, 0, 138, 1, 
+1, 130, 134, 1, 64, 0, 138, 65, 129, 130, 134, 129, 65, 0, 135, 193, 
+65, 3, 157, 129, 128, 0, 155, 65, 0, 0, 23, 64, 0, 128, 131, 1, 
+0, 0, 159, 1, 0, 1, 134, 1, 64, 0, 138, 1, 128, 129, 134, 1, 
+64, 0, 138, 65, 0, 130, 134, 1, 64, 0, 138, 129, 128, 130, 134, 129, 
+65, 0, 135, 193, 65, 3, 157, 129, 128, 0, 155, 65, 0, 0, 23, 64, 
+0, 128, 131, 1, 0, 0, 159, 1, 0, 1, 129, 1, 2, 0, 206, 1, 
+128, 1, 205, 1, 194, 3, 1, 2, 2, 0, 161, 1, 1, 128, 134, 2, 
+64, 0, 140, 66, 66, 5, 6, 3, 64, 0, 7, 195, 64, 6, 157, 66, 
+128, 1, 160, 65, 254, 127, 134, 129, 65, 0, 135, 129, 66, 3, 157, 129, 
+128, 0, 155, 1, 0, 0, 23, 64, 2, 128, 134, 129, 65, 0, 135, 193, 
+66, 3, 157, 129, 128, 0, 155, 1, 0, 0, 23, 0, 1, 128, 134, 129, 
+65, 0, 135, 1, 67, 3, 157, 129, 128, 0, 155, 65, 0, 0, 23, 64, 
+0, 128, 131, 1, 0, 0, 159, 1, 0, 1, 24, 0, 66, 1, 23, 0, 
+2, 128, 25, 64, 0, 132, 23, 128, 1, 128, 134, 129, 65, 0, 135, 65, 
+67, 3, 157, 129, 128, 0, 155, 65, 0, 0, 23, 64, 0, 128, 131, 1, 
+0, 0, 159, 1, 0, 1, 134, 129, 67, 0, 193, 193, 3, 0, 157, 65, 
+0, 1, 134, 129, 65, 0, 135, 1, 68, 3, 158, 1, 128, 0, 159, 1, 
+0, 0, 31, 0, 128, 0, 17, 0, 0, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 109, 112, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 103, 101, 116, 77, 97, 114, 107, 115, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 
+119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 22, 0, 0, 0, 
+0, 0, 0, 0, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 3, 0, 0, 0, 0, 0, 
+0, 240, 63, 4, 18, 0, 0, 0, 0, 0, 0, 0, 100, 101, 108, 101, 
+116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 65, 116, 0, 4, 18, 
+0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 
+111, 117, 115, 87, 111, 114, 100, 87, 0, 4, 14, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 116, 111, 69, 110, 100, 79, 102, 87, 111, 114, 100, 0, 
+4, 17, 0, 0, 0, 0, 0, 0, 0, 74, 111, 105, 110, 87, 105, 116, 
+104, 78, 101, 120, 116, 87, 111, 114, 100, 0, 4, 17, 0, 0, 0, 0, 
+0, 0, 0, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 87, 
+111, 114, 100, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 
+109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 23, 0, 
+0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 99, 116, 101, 100, 32, 97, 
+114, 101, 97, 32, 100, 101, 108, 101, 116, 101, 100, 46, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 85, 110, 115, 101, 116, 77, 97, 114, 107, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 3, 
+0, 0, 19, 4, 0, 0, 2, 0, 17, 100, 0, 0, 0, 27, 64, 0, 
+0, 23, 64, 2, 128, 134, 0, 64, 0, 157, 192, 128, 0, 64, 0, 128, 
+1, 0, 0, 0, 1, 27, 0, 0, 0, 23, 64, 0, 128, 24, 64, 64, 
+0, 23, 64, 0, 128, 131, 0, 0, 0, 159, 0, 0, 1, 139, 0, 0, 
+0, 198, 128, 64, 0, 0, 1, 0, 0, 65, 193, 0, 0, 221, 128, 128, 
+1, 6, 1, 65, 0, 64, 1, 128, 1, 29, 1, 1, 1, 23, 192, 10, 
+128, 75, 2, 0, 0, 129, 66, 1, 0, 204, 130, 65, 4, 221, 130, 0, 
+1, 26, 192, 2, 5, 23, 128, 7, 128, 5, 3, 128, 0, 69, 3, 0, 
+1, 128, 3, 0, 4, 192, 3, 0, 5, 93, 3, 128, 1, 29, 131, 0, 
+0, 69, 3, 128, 1, 140, 195, 65, 4, 0, 4, 0, 5, 157, 3, 128, 
+1, 93, 131, 0, 0, 141, 66, 3, 5, 26, 0, 3, 132, 23, 64, 0, 
+128, 90, 64, 66, 6, 23, 192, 0, 128, 26, 0, 3, 133, 23, 0, 2, 
+128, 26, 192, 66, 6, 23, 128, 1, 128, 65, 3, 3, 0, 140, 67, 67, 
+6, 157, 131, 0, 1, 204, 131, 67, 6, 221, 131, 0, 1, 1, 196, 3, 
+0, 22, 3, 132, 6, 85, 3, 128, 4, 77, 67, 193, 6, 74, 2, 131, 
+6, 23, 128, 247, 127, 21, 3, 0, 1, 13, 67, 65, 6, 69, 3, 0, 
+2, 128, 3, 128, 4, 193, 3, 4, 0, 93, 131, 128, 1, 138, 64, 3, 
+6, 34, 129, 0, 0, 163, 65, 244, 127, 1, 65, 4, 0, 85, 1, 0, 
+1, 78, 65, 193, 2, 129, 65, 1, 0, 33, 1, 1, 128, 1, 130, 4, 
+0, 71, 194, 1, 1, 129, 194, 4, 0, 22, 130, 2, 4, 138, 0, 130, 
+3, 32, 65, 254, 127, 21, 1, 0, 1, 25, 0, 129, 130, 23, 64, 2, 
+128, 7, 65, 65, 1, 65, 193, 4, 0, 22, 65, 1, 2, 138, 0, 129, 
+130, 21, 1, 0, 1, 65, 129, 4, 0, 149, 1, 0, 1, 135, 129, 1, 
+1, 86, 129, 129, 2, 138, 64, 1, 2, 6, 1, 69, 0, 10, 129, 128, 
+138, 6, 1, 69, 0, 10, 65, 0, 139, 6, 193, 69, 0, 7, 1, 70, 
+2, 30, 1, 128, 0, 31, 1, 0, 0, 31, 0, 128, 0, 25, 0, 0, 
+0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 70, 105, 110, 100, 65, 110, 
+100, 82, 101, 112, 108, 97, 99, 101, 68, 105, 97, 108, 111, 103, 117, 101, 
+0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 83, 112, 108, 105, 116, 83, 116, 114, 105, 110, 103, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 37, 115, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 4, 0, 0, 0, 0, 0, 0, 0, 108, 101, 
+110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 98, 121, 116, 101, 0, 
+4, 2, 0, 0, 0, 0, 0, 0, 0, 65, 0, 4, 2, 0, 0, 0, 
+0, 0, 0, 0, 90, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 97, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 122, 0, 4, 2, 0, 0, 
+0, 0, 0, 0, 0, 91, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+117, 112, 112, 101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 
+111, 119, 101, 114, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 93, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 37, 99, 42, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 64, 4, 5, 0, 0, 0, 0, 0, 0, 0, 94, 
+37, 99, 42, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 37, 99, 42, 
+36, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+102, 105, 110, 100, 116, 101, 120, 116, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 114, 101, 112, 108, 97, 99, 101, 116, 101, 120, 116, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 70, 105, 110, 100, 78, 101, 120, 116, 0, 0, 0, 0, 
+0, 5, 0, 0, 0, 0, 0, 1, 11, 1, 10, 1, 1, 1, 12, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 21, 4, 0, 0, 106, 4, 0, 0, 0, 0, 14, 119, 0, 
+0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 64, 0, 0, 23, 64, 
+0, 128, 3, 0, 0, 0, 31, 0, 0, 1, 6, 128, 64, 0, 65, 192, 
+0, 0, 29, 64, 0, 1, 6, 0, 65, 0, 7, 64, 65, 0, 70, 0, 
+65, 0, 71, 128, 193, 0, 134, 0, 65, 0, 135, 192, 65, 1, 198, 0, 
+64, 0, 199, 64, 192, 1, 21, 1, 128, 1, 24, 0, 66, 2, 23, 128, 
+1, 128, 6, 65, 66, 0, 29, 65, 128, 0, 6, 129, 66, 0, 65, 193, 
+2, 0, 29, 65, 0, 1, 3, 1, 0, 0, 31, 1, 0, 1, 7, 1, 
+195, 1, 70, 1, 65, 0, 71, 1, 128, 2, 71, 65, 128, 2, 140, 65, 
+195, 2, 0, 2, 0, 2, 64, 2, 0, 1, 157, 193, 0, 2, 155, 1, 
+0, 0, 23, 0, 12, 128, 0, 2, 128, 0, 65, 130, 3, 0, 131, 2, 
+128, 0, 213, 2, 128, 1, 26, 192, 130, 4, 23, 128, 4, 128, 13, 2, 
+67, 4, 198, 2, 65, 0, 199, 2, 128, 5, 71, 1, 130, 5, 91, 65, 
+0, 0, 23, 64, 0, 128, 131, 2, 0, 0, 23, 128, 2, 128, 204, 66, 
+195, 2, 71, 67, 130, 1, 221, 194, 128, 1, 192, 1, 0, 6, 8, 192, 
+130, 135, 219, 65, 0, 0, 23, 64, 0, 128, 131, 2, 0, 0, 23, 64, 
+0, 128, 77, 2, 195, 4, 23, 64, 250, 127, 155, 2, 0, 0, 23, 64, 
+5, 128, 198, 2, 65, 0, 202, 2, 128, 130, 198, 2, 65, 0, 202, 2, 
+2, 131, 198, 2, 65, 0, 13, 3, 195, 3, 202, 2, 131, 131, 198, 2, 
+65, 0, 6, 3, 65, 0, 7, 67, 65, 6, 202, 2, 3, 136, 198, 2, 
+65, 0, 202, 66, 128, 136, 198, 2, 65, 0, 202, 130, 1, 137, 198, 130, 
+66, 0, 1, 195, 4, 0, 221, 66, 0, 1, 198, 66, 66, 0, 221, 66, 
+128, 0, 195, 2, 128, 0, 223, 2, 0, 1, 129, 0, 3, 0, 77, 0, 
+195, 0, 6, 2, 65, 0, 7, 2, 0, 4, 21, 2, 0, 4, 25, 64, 
+0, 4, 23, 128, 1, 128, 65, 0, 3, 0, 13, 0, 67, 0, 6, 2, 
+65, 0, 21, 2, 0, 4, 25, 0, 0, 4, 23, 0, 0, 128, 1, 0, 
+3, 0, 6, 2, 65, 0, 7, 66, 65, 4, 24, 0, 2, 0, 23, 192, 
+236, 127, 6, 2, 65, 0, 7, 130, 65, 4, 24, 0, 130, 0, 23, 192, 
+235, 127, 88, 0, 67, 1, 23, 0, 0, 128, 23, 0, 235, 127, 70, 65, 
+66, 0, 93, 65, 128, 0, 70, 129, 66, 0, 129, 1, 5, 0, 93, 65, 
+0, 1, 67, 1, 0, 0, 95, 1, 0, 1, 31, 0, 128, 0, 21, 0, 
+0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+102, 105, 110, 100, 116, 101, 120, 116, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 
+103, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 83, 101, 97, 114, 
+99, 104, 105, 110, 103, 46, 46, 46, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 3, 
+0, 0, 0, 0, 0, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 4, 16, 0, 
+0, 0, 0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 
+115, 115, 97, 103, 101, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 78, 
+111, 116, 104, 105, 110, 103, 32, 116, 111, 32, 115, 101, 97, 114, 99, 104, 
+32, 102, 111, 114, 46, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 64, 4, 2, 0, 0, 0, 0, 0, 0, 0, 95, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 109, 119, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 109, 111, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 70, 111, 
+117, 110, 100, 46, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 78, 111, 
+116, 32, 102, 111, 117, 110, 100, 46, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 108, 4, 0, 0, 132, 4, 0, 0, 0, 
+0, 9, 53, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 0, 
+0, 0, 23, 192, 10, 128, 6, 128, 64, 0, 7, 192, 64, 0, 29, 128, 
+128, 0, 27, 0, 0, 0, 23, 128, 0, 128, 6, 128, 64, 0, 7, 0, 
+65, 0, 29, 128, 128, 0, 27, 64, 0, 0, 23, 64, 0, 128, 67, 0, 
+0, 0, 95, 0, 0, 1, 3, 0, 128, 0, 70, 64, 65, 0, 134, 128, 
+65, 0, 135, 192, 65, 1, 193, 0, 2, 0, 93, 128, 128, 1, 134, 64, 
+66, 0, 192, 0, 128, 0, 157, 0, 1, 1, 23, 0, 3, 128, 25, 64, 
+1, 133, 23, 192, 0, 128, 198, 129, 64, 0, 199, 193, 194, 3, 221, 129, 
+128, 0, 64, 1, 128, 3, 27, 0, 0, 0, 23, 0, 1, 128, 198, 129, 
+64, 0, 199, 1, 195, 3, 0, 2, 0, 3, 221, 129, 0, 1, 0, 0, 
+128, 3, 162, 128, 0, 0, 35, 1, 252, 127, 27, 64, 0, 0, 23, 64, 
+0, 128, 131, 0, 0, 0, 159, 0, 0, 1, 134, 64, 67, 0, 193, 128, 
+3, 0, 157, 64, 0, 1, 6, 128, 64, 0, 7, 192, 67, 0, 30, 0, 
+128, 0, 31, 0, 0, 0, 31, 0, 128, 0, 16, 0, 0, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 68, 101, 108, 101, 116, 101, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 85, 110, 115, 101, 116, 77, 97, 114, 107, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 83, 112, 108, 105, 116, 83, 116, 114, 105, 110, 103, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 114, 
+101, 112, 108, 97, 99, 101, 116, 101, 120, 116, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 37, 115, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+105, 112, 97, 105, 114, 115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 17, 0, 0, 0, 0, 0, 0, 0, 83, 112, 108, 105, 116, 67, 117, 
+114, 114, 101, 110, 116, 87, 111, 114, 100, 0, 4, 21, 0, 0, 0, 0, 
+0, 0, 0, 73, 110, 115, 101, 114, 116, 83, 116, 114, 105, 110, 103, 73, 
+110, 116, 111, 87, 111, 114, 100, 0, 4, 16, 0, 0, 0, 0, 0, 0, 
+0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 82, 101, 112, 108, 97, 99, 
+101, 100, 32, 116, 101, 120, 116, 46, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 70, 105, 110, 100, 78, 101, 120, 116, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 4, 0, 0, 145, 4, 0, 
+0, 0, 0, 2, 20, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 
+27, 0, 0, 0, 23, 64, 1, 128, 6, 0, 64, 0, 10, 128, 192, 128, 
+6, 192, 64, 0, 65, 0, 1, 0, 29, 64, 0, 1, 23, 0, 1, 128, 
+6, 0, 64, 0, 10, 64, 193, 128, 6, 192, 64, 0, 65, 128, 1, 0, 
+29, 64, 0, 1, 6, 192, 65, 0, 29, 64, 128, 0, 3, 0, 128, 0, 
+31, 0, 0, 1, 31, 0, 128, 0, 8, 0, 0, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 116, 97, 116, 117, 115, 
+98, 97, 114, 0, 1, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 78, 
+111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 
+21, 0, 0, 0, 0, 0, 0, 0, 83, 116, 97, 116, 117, 115, 32, 98, 
+97, 114, 32, 100, 105, 115, 97, 98, 108, 101, 100, 46, 0, 1, 1, 4, 
+20, 0, 0, 0, 0, 0, 0, 0, 83, 116, 97, 116, 117, 115, 32, 98, 
+97, 114, 32, 101, 110, 97, 98, 108, 101, 100, 46, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 
+4, 0, 0, 149, 4, 0, 0, 0, 0, 2, 3, 0, 0, 0, 6, 0, 
+64, 0, 29, 64, 128, 0, 31, 0, 128, 0, 1, 0, 0, 0, 4, 14, 
+0, 0, 0, 0, 0, 0, 0, 65, 98, 111, 117, 116, 68, 105, 97, 108, 
+111, 103, 117, 101, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/goto.lua */
+static const char file_27[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 9, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 165, 0, 0, 0, 198, 0, 65, 0, 37, 65, 0, 0, 202, 0, 129, 
+130, 31, 0, 128, 0, 6, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 114, 101, 112, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 
+97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 111, 
+110, 99, 97, 116, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 0, 
+2, 0, 0, 0, 8, 0, 0, 0, 46, 0, 0, 0, 2, 0, 8, 53, 
+0, 0, 0, 134, 0, 64, 0, 135, 64, 64, 1, 203, 0, 2, 0, 202, 
+192, 64, 129, 6, 1, 64, 0, 7, 65, 64, 2, 202, 0, 1, 130, 202, 
+128, 193, 130, 202, 0, 194, 131, 202, 128, 194, 132, 202, 128, 194, 133, 202, 
+0, 0, 134, 202, 64, 128, 134, 157, 128, 0, 1, 203, 192, 1, 1, 202, 
+192, 67, 135, 6, 1, 64, 0, 7, 65, 68, 2, 202, 0, 1, 136, 6, 
+1, 64, 0, 7, 65, 68, 2, 202, 0, 1, 137, 202, 0, 197, 137, 202, 
+128, 197, 138, 202, 0, 198, 139, 202, 0, 198, 140, 6, 1, 64, 0, 7, 
+129, 70, 2, 75, 65, 1, 0, 74, 129, 193, 130, 74, 129, 193, 131, 74, 
+129, 194, 132, 74, 129, 193, 133, 74, 1, 199, 141, 29, 129, 0, 1, 64, 
+1, 0, 1, 228, 64, 0, 1, 6, 1, 64, 0, 7, 65, 71, 2, 64, 
+1, 128, 1, 134, 129, 71, 0, 193, 193, 7, 0, 29, 129, 0, 2, 70, 
+1, 72, 0, 93, 65, 128, 0, 27, 1, 0, 0, 23, 128, 0, 128, 71, 
+65, 67, 1, 95, 1, 0, 1, 23, 64, 0, 128, 68, 1, 0, 0, 95, 
+1, 0, 1, 31, 0, 128, 0, 33, 0, 0, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 66, 114, 111, 119, 115, 101, 114, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 102, 111, 99, 117, 115, 97, 98, 108, 101, 0, 1, 1, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 116, 121, 112, 101, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 3, 0, 
+0, 0, 0, 0, 0, 0, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+120, 50, 0, 3, 0, 0, 0, 0, 0, 0, 240, 191, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 121, 50, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 100, 97, 116, 97, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 
+117, 114, 115, 111, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 
+105, 116, 108, 101, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 84, 97, 
+98, 108, 101, 32, 111, 102, 32, 67, 111, 110, 116, 101, 110, 116, 115, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 104, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 101, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 116, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 101, 116, 99, 104, 121, 0, 
+1, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 94, 
+67, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 99, 101, 
+108, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 
+69, 84, 85, 82, 78, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 
+111, 110, 102, 105, 114, 109, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+75, 69, 89, 95, 69, 78, 84, 69, 82, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 76, 97, 98, 101, 108, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 118, 97, 108, 117, 101, 0, 4, 27, 0, 0, 0, 0, 0, 0, 
+0, 83, 101, 108, 101, 99, 116, 32, 104, 101, 97, 100, 105, 110, 103, 32, 
+116, 111, 32, 106, 117, 109, 112, 32, 116, 111, 58, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 82, 117, 110, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 4, 
+40, 0, 0, 0, 0, 0, 0, 0, 82, 69, 84, 85, 82, 78, 32, 116, 
+111, 32, 115, 101, 108, 101, 99, 116, 32, 105, 116, 101, 109, 44, 32, 67, 
+84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 
+100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 48, 0, 0, 0, 102, 0, 0, 0, 0, 0, 19, 101, 0, 
+0, 0, 6, 0, 64, 0, 65, 64, 0, 0, 29, 64, 0, 1, 11, 0, 
+0, 0, 75, 0, 0, 2, 129, 128, 0, 0, 193, 128, 0, 0, 1, 129, 
+0, 0, 65, 129, 0, 0, 100, 64, 0, 2, 129, 192, 0, 0, 198, 0, 
+65, 0, 6, 65, 65, 0, 221, 0, 1, 1, 23, 64, 13, 128, 7, 130, 
+193, 3, 7, 194, 65, 4, 12, 2, 66, 4, 129, 66, 2, 0, 29, 2, 
+129, 1, 155, 2, 0, 0, 23, 128, 11, 128, 198, 130, 66, 0, 0, 3, 
+0, 5, 221, 130, 0, 1, 128, 2, 128, 5, 199, 130, 130, 0, 205, 194, 
+192, 5, 74, 192, 2, 5, 205, 194, 64, 5, 1, 195, 2, 0, 65, 195, 
+0, 0, 225, 2, 0, 128, 74, 128, 64, 7, 224, 66, 255, 127, 203, 2, 
+0, 0, 1, 195, 0, 0, 64, 3, 0, 5, 129, 195, 0, 0, 33, 67, 
+1, 128, 21, 4, 128, 5, 13, 196, 64, 8, 71, 196, 131, 0, 129, 4, 
+3, 0, 86, 132, 132, 8, 202, 66, 4, 8, 32, 3, 254, 127, 21, 3, 
+128, 5, 13, 195, 64, 6, 202, 66, 67, 6, 21, 3, 128, 5, 13, 195, 
+64, 6, 76, 131, 195, 3, 93, 131, 0, 1, 202, 66, 3, 6, 21, 3, 
+0, 0, 13, 195, 64, 6, 75, 131, 0, 0, 133, 3, 128, 0, 192, 3, 
+128, 5, 157, 131, 0, 1, 74, 131, 131, 135, 74, 131, 1, 136, 10, 64, 
+3, 6, 6, 67, 65, 0, 7, 67, 68, 6, 26, 0, 3, 3, 23, 0, 
+0, 128, 149, 0, 0, 0, 226, 128, 0, 0, 99, 193, 241, 127, 213, 0, 
+0, 0, 24, 128, 192, 1, 23, 64, 1, 128, 198, 128, 68, 0, 1, 193, 
+4, 0, 65, 1, 5, 0, 221, 64, 128, 1, 195, 0, 0, 0, 223, 0, 
+0, 1, 197, 0, 0, 1, 0, 1, 0, 0, 64, 1, 0, 1, 221, 128, 
+128, 1, 6, 65, 69, 0, 29, 65, 128, 0, 219, 0, 0, 0, 23, 64, 
+2, 128, 6, 65, 65, 0, 71, 193, 0, 0, 71, 1, 196, 2, 10, 65, 
+129, 136, 6, 65, 65, 0, 10, 193, 64, 139, 6, 65, 65, 0, 10, 193, 
+192, 139, 3, 1, 128, 0, 31, 1, 0, 1, 3, 1, 0, 0, 31, 1, 
+0, 1, 31, 0, 128, 0, 24, 0, 0, 0, 4, 17, 0, 0, 0, 0, 
+0, 0, 0, 73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 
+97, 103, 101, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 83, 99, 97, 
+110, 110, 105, 110, 103, 32, 100, 111, 99, 117, 109, 101, 110, 116, 46, 46, 
+46, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 
+105, 114, 115, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 115, 
+116, 121, 108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+109, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 94, 72, 40, 37, 100, 41, 
+36, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 110, 117, 109, 
+98, 101, 114, 0, 3, 0, 0, 0, 0, 0, 0, 16, 64, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 46, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 32, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 97, 115, 83, 116, 
+114, 105, 110, 103, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 97, 
+98, 101, 108, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 112, 97, 114, 
+97, 110, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 
+13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 
+115, 97, 103, 101, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 78, 111, 
+32, 99, 111, 110, 116, 101, 110, 116, 115, 32, 97, 118, 97, 105, 108, 97, 
+98, 108, 101, 0, 4, 85, 0, 0, 0, 0, 0, 0, 0, 89, 111, 117, 
+32, 109, 117, 115, 116, 32, 104, 97, 118, 101, 32, 115, 111, 109, 101, 32, 
+104, 101, 97, 100, 105, 110, 103, 32, 112, 97, 114, 97, 103, 114, 97, 112, 
+104, 115, 32, 105, 110, 32, 121, 111, 117, 114, 32, 100, 111, 99, 117, 109, 
+101, 110, 116, 32, 116, 111, 32, 117, 115, 101, 32, 116, 104, 101, 32, 116, 
+97, 98, 108, 101, 32, 111, 102, 32, 99, 111, 110, 116, 101, 110, 116, 115, 
+46, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 0, 
+0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 1, 1, 2, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/autosave.lua */
+static const char file_28[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 6, 24, 0, 0, 
+0, 37, 0, 0, 0, 101, 64, 0, 0, 165, 128, 0, 0, 198, 0, 64, 
+0, 6, 65, 64, 0, 7, 129, 64, 2, 64, 1, 0, 1, 221, 64, 128, 
+1, 165, 192, 0, 0, 198, 0, 64, 0, 6, 65, 64, 0, 7, 193, 64, 
+2, 64, 1, 0, 1, 221, 64, 128, 1, 165, 0, 1, 0, 198, 0, 64, 
+0, 6, 65, 64, 0, 7, 1, 65, 2, 64, 1, 0, 1, 221, 64, 128, 
+1, 134, 64, 65, 0, 229, 64, 1, 0, 138, 192, 0, 131, 31, 0, 128, 
+0, 7, 0, 0, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 65, 100, 
+100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 73, 100, 108, 101, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 76, 111, 97, 
+100, 101, 100, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 82, 101, 103, 
+105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 18, 0, 0, 0, 0, 0, 
+0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 65, 117, 116, 111, 115, 
+97, 118, 101, 0, 6, 0, 0, 0, 5, 0, 0, 0, 15, 0, 0, 0, 
+0, 0, 9, 23, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 7, 
+128, 64, 0, 71, 192, 64, 0, 91, 0, 0, 0, 23, 0, 3, 128, 70, 
+0, 65, 0, 129, 64, 1, 0, 199, 128, 65, 0, 1, 193, 1, 0, 70, 
+1, 66, 0, 135, 129, 65, 0, 193, 65, 2, 0, 1, 130, 2, 0, 93, 
+129, 0, 2, 129, 193, 2, 0, 150, 128, 1, 1, 93, 64, 0, 1, 23, 
+128, 0, 128, 70, 0, 65, 0, 129, 0, 3, 0, 93, 64, 0, 1, 31, 
+0, 128, 0, 13, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 
+68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 97, 100, 100, 111, 110, 115, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 97, 117, 116, 111, 115, 97, 118, 101, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 101, 110, 97, 98, 108, 101, 100, 0, 4, 
+16, 0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 
+77, 101, 115, 115, 97, 103, 101, 0, 4, 35, 0, 0, 0, 0, 0, 0, 
+0, 65, 117, 116, 111, 115, 97, 118, 101, 32, 105, 115, 32, 101, 110, 97, 
+98, 108, 101, 100, 46, 32, 78, 101, 120, 116, 32, 115, 97, 118, 101, 32, 
+105, 110, 32, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 112, 101, 114, 
+105, 111, 100, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 32, 109, 105, 
+110, 117, 116, 101, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 80, 108, 
+117, 114, 97, 108, 105, 115, 101, 0, 4, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 115, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 46, 0, 4, 22, 0, 0, 0, 0, 0, 0, 
+0, 65, 117, 116, 111, 115, 97, 118, 101, 32, 105, 115, 32, 100, 105, 115, 
+97, 98, 108, 101, 100, 46, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 17, 0, 0, 0, 29, 0, 0, 0, 1, 0, 7, 
+38, 0, 0, 0, 70, 0, 64, 0, 71, 64, 192, 0, 140, 128, 192, 0, 
+1, 193, 0, 0, 65, 1, 1, 0, 157, 128, 0, 2, 64, 0, 0, 1, 
+140, 128, 192, 0, 1, 65, 1, 0, 65, 129, 1, 0, 157, 128, 0, 2, 
+64, 0, 0, 1, 134, 192, 65, 0, 135, 0, 66, 1, 193, 64, 2, 0, 
+157, 128, 0, 1, 204, 128, 64, 1, 65, 65, 1, 0, 129, 129, 1, 0, 
+221, 128, 0, 2, 128, 0, 128, 1, 204, 128, 64, 0, 65, 129, 2, 0, 
+128, 1, 128, 0, 221, 128, 0, 2, 0, 0, 128, 1, 204, 128, 64, 0, 
+65, 193, 2, 0, 128, 1, 0, 1, 221, 128, 0, 2, 0, 0, 128, 1, 
+204, 128, 64, 0, 65, 129, 1, 0, 129, 65, 1, 0, 221, 128, 0, 2, 
+0, 0, 128, 1, 31, 0, 0, 1, 31, 0, 128, 0, 12, 0, 0, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 
+109, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 103, 115, 117, 98, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 37, 46, 119, 103, 36, 0, 
+4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 37, 37, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 37, 
+37, 37, 37, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 111, 115, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 101, 0, 4, 14, 
+0, 0, 0, 0, 0, 0, 0, 37, 89, 45, 37, 109, 45, 37, 100, 46, 
+37, 72, 37, 77, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 37, 37, 
+91, 102, 70, 93, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 37, 37, 
+91, 116, 84, 93, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 35, 0, 0, 0, 65, 0, 0, 0, 0, 0, 8, 59, 0, 
+0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 7, 128, 64, 0, 71, 192, 
+64, 0, 91, 0, 0, 0, 23, 192, 0, 128, 70, 0, 64, 0, 71, 0, 
+193, 0, 91, 64, 0, 0, 23, 0, 0, 128, 31, 0, 128, 0, 71, 64, 
+65, 0, 91, 64, 0, 0, 23, 192, 0, 128, 70, 128, 65, 0, 71, 192, 
+193, 0, 93, 128, 128, 0, 10, 64, 128, 130, 70, 128, 65, 0, 71, 192, 
+193, 0, 93, 128, 128, 0, 135, 64, 65, 0, 78, 128, 128, 0, 135, 0, 
+66, 0, 143, 64, 66, 1, 25, 64, 0, 1, 23, 128, 7, 128, 70, 128, 
+66, 0, 129, 192, 2, 0, 93, 64, 0, 1, 69, 0, 128, 0, 135, 0, 
+67, 0, 93, 128, 0, 1, 10, 64, 195, 129, 134, 128, 67, 0, 192, 0, 
+128, 0, 157, 192, 0, 1, 10, 192, 195, 129, 155, 64, 0, 0, 23, 128, 
+1, 128, 6, 1, 68, 0, 65, 65, 4, 0, 129, 129, 4, 0, 192, 1, 
+128, 1, 150, 193, 1, 3, 29, 65, 128, 1, 23, 128, 1, 128, 6, 193, 
+68, 0, 65, 1, 5, 0, 128, 1, 128, 0, 86, 129, 129, 2, 29, 65, 
+0, 1, 6, 65, 69, 0, 29, 65, 128, 0, 6, 129, 65, 0, 7, 193, 
+65, 2, 29, 129, 128, 0, 10, 0, 129, 130, 31, 0, 128, 0, 22, 0, 
+0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+97, 100, 100, 111, 110, 115, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+97, 117, 116, 111, 115, 97, 118, 101, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 101, 110, 97, 98, 108, 101, 100, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 99, 104, 97, 110, 103, 101, 100, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 108, 97, 115, 116, 115, 97, 118, 101, 100, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 111, 115, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 116, 105, 109, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 112, 101, 114, 105, 111, 100, 0, 3, 0, 0, 0, 0, 0, 0, 78, 
+64, 4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 109, 101, 100, 105, 
+97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 0, 4, 14, 0, 0, 0, 
+0, 0, 0, 0, 65, 117, 116, 111, 115, 97, 118, 105, 110, 103, 46, 46, 
+46, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 116, 101, 
+114, 110, 0, 1, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 83, 97, 
+118, 101, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 82, 97, 119, 
+0, 1, 1, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 97, 
+108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 65, 117, 116, 111, 115, 97, 118, 101, 32, 102, 97, 105, 108, 101, 
+100, 0, 4, 38, 0, 0, 0, 0, 0, 0, 0, 84, 104, 101, 32, 100, 
+111, 99, 117, 109, 101, 110, 116, 32, 99, 111, 117, 108, 100, 32, 110, 111, 
+116, 32, 98, 101, 32, 97, 117, 116, 111, 115, 97, 118, 101, 100, 58, 32, 
+0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 
+97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 14, 0, 0, 0, 0, 
+0, 0, 0, 65, 117, 116, 111, 115, 97, 118, 101, 100, 32, 97, 115, 32, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 
+101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 
+1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 78, 0, 0, 0, 0, 0, 
+2, 16, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 
+0, 71, 64, 192, 0, 71, 128, 192, 0, 91, 64, 0, 0, 23, 0, 0, 
+128, 75, 0, 0, 0, 10, 64, 0, 129, 6, 0, 64, 0, 7, 64, 64, 
+0, 7, 128, 64, 0, 10, 0, 193, 129, 5, 0, 128, 0, 29, 64, 128, 
+0, 31, 0, 128, 0, 5, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 111, 110, 115, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 97, 117, 116, 111, 115, 97, 118, 101, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 108, 97, 115, 116, 115, 97, 118, 
+101, 100, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 87, 0, 0, 0, 93, 0, 0, 0, 0, 0, 2, 13, 
+0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 
+64, 192, 0, 71, 128, 192, 0, 91, 64, 0, 0, 23, 192, 0, 128, 75, 
+192, 0, 0, 74, 0, 193, 129, 74, 128, 193, 130, 74, 0, 194, 131, 10, 
+64, 0, 129, 31, 0, 128, 0, 9, 0, 0, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 111, 110, 115, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 97, 117, 116, 111, 115, 97, 118, 
+101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 101, 110, 97, 98, 108, 
+101, 100, 0, 1, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 112, 101, 
+114, 105, 111, 100, 0, 3, 0, 0, 0, 0, 0, 0, 36, 64, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 116, 101, 114, 110, 0, 4, 
+18, 0, 0, 0, 0, 0, 0, 0, 37, 70, 46, 97, 117, 116, 111, 115, 
+97, 118, 101, 46, 37, 84, 46, 119, 103, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 211, 0, 0, 0, 
+0, 0, 14, 157, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 7, 
+128, 64, 0, 70, 0, 64, 0, 71, 192, 192, 0, 91, 64, 0, 0, 23, 
+0, 2, 128, 70, 0, 65, 0, 129, 64, 1, 0, 193, 128, 1, 0, 1, 
+193, 1, 0, 65, 1, 2, 0, 214, 64, 129, 1, 93, 64, 128, 1, 67, 
+0, 0, 0, 95, 0, 0, 1, 70, 64, 66, 0, 71, 128, 194, 0, 139, 
+128, 1, 0, 138, 0, 195, 133, 138, 0, 195, 134, 138, 192, 67, 135, 138, 
+0, 67, 136, 138, 128, 196, 136, 199, 0, 69, 0, 138, 192, 128, 137, 93, 
+128, 0, 1, 134, 64, 66, 0, 135, 64, 69, 1, 203, 64, 1, 0, 202, 
+192, 195, 133, 202, 128, 197, 134, 202, 192, 69, 135, 202, 128, 69, 136, 6, 
+1, 70, 0, 71, 65, 70, 0, 29, 129, 0, 1, 202, 0, 129, 137, 157, 
+128, 0, 1, 198, 64, 66, 0, 199, 128, 198, 1, 11, 65, 1, 0, 10, 
+1, 195, 133, 10, 193, 198, 134, 10, 1, 71, 135, 10, 193, 70, 136, 10, 
+65, 199, 137, 221, 128, 0, 1, 6, 65, 66, 0, 7, 65, 69, 2, 75, 
+129, 1, 0, 74, 193, 195, 133, 74, 129, 199, 134, 74, 1, 71, 135, 74, 
+129, 71, 136, 135, 193, 71, 0, 74, 129, 129, 137, 165, 1, 0, 0, 74, 
+129, 1, 144, 29, 129, 0, 1, 75, 193, 1, 3, 74, 129, 200, 144, 134, 
+65, 66, 0, 135, 1, 73, 3, 74, 129, 129, 145, 74, 129, 201, 146, 74, 
+1, 202, 147, 74, 129, 202, 148, 74, 1, 203, 149, 74, 1, 203, 150, 128, 
+1, 128, 0, 198, 65, 66, 0, 199, 129, 198, 3, 11, 130, 1, 0, 10, 
+2, 195, 133, 10, 130, 197, 134, 10, 130, 75, 135, 10, 130, 69, 136, 70, 
+66, 66, 0, 71, 2, 204, 4, 10, 66, 130, 151, 10, 66, 204, 137, 221, 
+129, 0, 1, 0, 2, 0, 1, 70, 66, 66, 0, 71, 130, 198, 4, 139, 
+130, 1, 0, 138, 2, 195, 133, 138, 130, 199, 134, 138, 130, 75, 135, 138, 
+130, 71, 136, 198, 66, 66, 0, 199, 2, 204, 5, 138, 194, 130, 151, 138, 
+130, 204, 137, 93, 130, 0, 1, 128, 2, 0, 2, 192, 2, 128, 1, 100, 
+65, 0, 3, 134, 65, 66, 0, 135, 193, 76, 3, 192, 1, 128, 2, 6, 
+2, 77, 0, 65, 66, 13, 0, 157, 129, 0, 2, 155, 65, 0, 0, 23, 
+64, 0, 128, 195, 1, 0, 0, 223, 1, 0, 1, 199, 193, 196, 0, 6, 
+130, 77, 0, 71, 194, 68, 1, 29, 130, 0, 1, 71, 194, 68, 2, 27, 
+66, 0, 0, 23, 0, 1, 128, 134, 2, 65, 0, 193, 194, 13, 0, 1, 
+3, 14, 0, 157, 66, 128, 1, 23, 64, 250, 127, 140, 66, 206, 4, 157, 
+130, 0, 1, 24, 128, 78, 5, 23, 0, 1, 128, 134, 2, 65, 0, 193, 
+194, 13, 0, 1, 195, 14, 0, 157, 66, 128, 1, 23, 0, 248, 127, 140, 
+2, 207, 4, 1, 67, 15, 0, 157, 130, 128, 1, 155, 2, 0, 0, 23, 
+128, 1, 128, 134, 2, 65, 0, 193, 194, 13, 0, 1, 131, 15, 0, 65, 
+195, 15, 0, 22, 67, 3, 6, 157, 66, 128, 1, 23, 0, 245, 127, 10, 
+192, 1, 138, 10, 0, 130, 140, 10, 64, 130, 143, 10, 64, 80, 160, 134, 
+2, 64, 0, 140, 130, 80, 5, 157, 66, 0, 1, 133, 2, 0, 1, 157, 
+66, 128, 0, 131, 2, 128, 0, 159, 2, 0, 1, 23, 0, 242, 127, 131, 
+1, 0, 0, 159, 1, 0, 1, 31, 0, 128, 0, 67, 0, 0, 0, 4, 
+12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 
+111, 110, 115, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 97, 117, 116, 
+111, 115, 97, 118, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 
+97, 109, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 
+97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 23, 0, 0, 0, 0, 
+0, 0, 0, 65, 117, 116, 111, 115, 97, 118, 101, 32, 110, 111, 116, 32, 
+97, 118, 97, 105, 108, 97, 98, 108, 101, 0, 4, 25, 0, 0, 0, 0, 
+0, 0, 0, 89, 111, 117, 32, 99, 97, 110, 110, 111, 116, 32, 117, 115, 
+101, 32, 97, 117, 116, 111, 115, 97, 118, 101, 32, 0, 4, 60, 0, 0, 
+0, 0, 0, 0, 0, 117, 110, 116, 105, 108, 32, 121, 111, 117, 32, 104, 
+97, 118, 101, 32, 109, 97, 110, 117, 97, 108, 108, 121, 32, 115, 97, 118, 
+101, 100, 32, 121, 111, 117, 114, 32, 100, 111, 99, 117, 109, 101, 110, 116, 
+32, 97, 116, 32, 108, 101, 97, 115, 116, 32, 111, 110, 99, 101, 44, 32, 
+0, 4, 50, 0, 0, 0, 0, 0, 0, 0, 115, 111, 32, 116, 104, 97, 
+116, 32, 65, 117, 116, 111, 115, 97, 118, 101, 32, 107, 110, 111, 119, 115, 
+32, 119, 104, 97, 116, 32, 98, 97, 115, 101, 32, 102, 105, 108, 101, 110, 
+97, 109, 101, 32, 116, 111, 32, 117, 115, 101, 46, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 67, 104, 101, 99, 107, 98, 111, 120, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 240, 
+63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 120, 50, 0, 3, 0, 0, 0, 0, 0, 128, 
+64, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 50, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 108, 97, 98, 101, 108, 0, 4, 18, 0, 
+0, 0, 0, 0, 0, 0, 69, 110, 97, 98, 108, 101, 32, 97, 117, 116, 
+111, 115, 97, 118, 105, 110, 103, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 118, 97, 108, 117, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+101, 110, 97, 98, 108, 101, 100, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 84, 101, 120, 116, 70, 105, 101, 108, 100, 0, 3, 0, 0, 0, 0, 
+0, 0, 8, 64, 3, 0, 0, 0, 0, 0, 128, 69, 64, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 116, 111, 115, 116, 114, 105, 110, 103, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 112, 101, 114, 105, 111, 100, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 98, 101, 108, 0, 3, 0, 
+0, 0, 0, 0, 0, 28, 64, 3, 0, 0, 0, 0, 0, 0, 240, 191, 
+4, 55, 0, 0, 0, 0, 0, 0, 0, 40, 69, 120, 97, 109, 112, 108, 
+101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 58, 32, 82, 69, 65, 68, 
+77, 69, 46, 97, 117, 116, 111, 115, 97, 118, 101, 46, 50, 48, 48, 56, 
+45, 48, 56, 45, 48, 55, 46, 49, 56, 50, 57, 46, 119, 103, 41, 0, 
+3, 0, 0, 0, 0, 0, 0, 20, 64, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 112, 97, 116, 116, 101, 114, 110, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 100, 114, 97, 119, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 116, 105, 116, 108, 101, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 
+67, 111, 110, 102, 105, 103, 117, 114, 101, 32, 65, 117, 116, 111, 115, 97, 
+118, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 
+104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 101, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 116, 
+0, 3, 0, 0, 0, 0, 0, 0, 34, 64, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 114, 101, 116, 99, 104, 121, 0, 1, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 94, 67, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 99, 101, 108, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 69, 84, 85, 82, 
+78, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 
+114, 109, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 
+69, 78, 84, 69, 82, 0, 3, 0, 0, 0, 0, 0, 0, 64, 64, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 97, 108, 105, 103, 110, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 76, 101, 102, 116, 0, 4, 32, 0, 0, 
+0, 0, 0, 0, 0, 80, 101, 114, 105, 111, 100, 32, 98, 101, 116, 119, 
+101, 101, 110, 32, 115, 97, 118, 101, 115, 32, 40, 109, 105, 110, 117, 116, 
+101, 115, 41, 58, 0, 4, 27, 0, 0, 0, 0, 0, 0, 0, 65, 117, 
+116, 111, 115, 97, 118, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 
+112, 97, 116, 116, 101, 114, 110, 58, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 82, 117, 110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 
+101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 4, 53, 0, 0, 
+0, 0, 0, 0, 0, 83, 80, 65, 67, 69, 32, 116, 111, 32, 116, 111, 
+103, 103, 108, 101, 44, 32, 82, 69, 84, 85, 82, 78, 32, 116, 111, 32, 
+99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 84, 82, 76, 43, 67, 32, 
+116, 111, 32, 99, 97, 110, 99, 101, 108, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 116, 111, 110, 117, 109, 98, 101, 114, 0, 4, 16, 0, 0, 
+0, 0, 0, 0, 0, 80, 97, 114, 97, 109, 101, 116, 101, 114, 32, 101, 
+114, 114, 111, 114, 0, 4, 41, 0, 0, 0, 0, 0, 0, 0, 84, 104, 
+101, 32, 112, 101, 114, 105, 111, 100, 32, 102, 105, 101, 108, 100, 32, 109, 
+117, 115, 116, 32, 98, 101, 32, 97, 32, 118, 97, 108, 105, 100, 32, 110, 
+117, 109, 98, 101, 114, 46, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+108, 101, 110, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 38, 0, 
+0, 0, 0, 0, 0, 0, 84, 104, 101, 32, 102, 105, 108, 101, 110, 97, 
+109, 101, 32, 112, 97, 116, 116, 101, 114, 110, 32, 99, 97, 110, 110, 111, 
+116, 32, 98, 101, 32, 101, 109, 112, 116, 121, 46, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 37, 37, 91, 94, 37, 37, 102, 116, 70, 84, 93, 0, 4, 
+39, 0, 0, 0, 0, 0, 0, 0, 84, 104, 101, 32, 102, 105, 108, 101, 
+110, 97, 109, 101, 32, 112, 97, 116, 116, 101, 114, 110, 32, 99, 97, 110, 
+32, 111, 110, 108, 121, 32, 99, 111, 110, 116, 97, 105, 110, 32, 0, 4, 
+21, 0, 0, 0, 0, 0, 0, 0, 37, 37, 44, 32, 37, 70, 32, 111, 
+114, 32, 37, 84, 32, 102, 105, 101, 108, 100, 115, 46, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 108, 97, 115, 116, 115, 97, 118, 101, 100, 0, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 
+1, 0, 0, 0, 139, 0, 0, 0, 145, 0, 0, 0, 1, 0, 5, 18, 
+0, 0, 0, 71, 0, 64, 0, 71, 64, 192, 0, 128, 0, 0, 0, 93, 
+64, 0, 1, 70, 128, 64, 0, 133, 0, 128, 0, 199, 192, 64, 0, 157, 
+0, 0, 1, 93, 128, 0, 0, 129, 0, 1, 0, 192, 0, 128, 0, 1, 
+65, 1, 0, 150, 0, 1, 1, 136, 128, 128, 129, 133, 0, 0, 1, 140, 
+64, 64, 1, 157, 64, 0, 1, 31, 0, 128, 0, 6, 0, 0, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 99, 108, 97, 115, 115, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 76, 101, 97, 102, 110, 97, 109, 101, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 40, 101, 46, 103, 46, 58, 32, 46, 46, 46, 
+47, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 
+0, 3, 0, 0, 0, 0, 0, 0, 1, 1, 3, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 
+0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/docsetman.lua */
+static const char file_29[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 7, 0, 0, 
+0, 6, 0, 64, 0, 101, 0, 0, 0, 10, 64, 128, 128, 6, 0, 64, 
+0, 101, 64, 0, 0, 10, 64, 0, 129, 31, 0, 128, 0, 3, 0, 0, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 17, 
+0, 0, 0, 0, 0, 0, 0, 65, 100, 100, 66, 108, 97, 110, 107, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 18, 0, 0, 0, 0, 0, 0, 
+0, 77, 97, 110, 97, 103, 101, 68, 111, 99, 117, 109, 101, 110, 116, 115, 
+85, 73, 0, 2, 0, 0, 0, 5, 0, 0, 0, 22, 0, 0, 0, 1, 
+0, 5, 39, 0, 0, 0, 27, 64, 0, 0, 23, 128, 2, 128, 70, 0, 
+64, 0, 129, 64, 0, 0, 193, 128, 0, 0, 93, 128, 128, 1, 0, 0, 
+128, 0, 27, 0, 0, 0, 23, 64, 0, 128, 24, 192, 64, 0, 23, 64, 
+0, 128, 67, 0, 0, 0, 95, 0, 0, 1, 70, 0, 65, 0, 71, 64, 
+193, 0, 71, 0, 128, 0, 91, 0, 0, 0, 23, 64, 1, 128, 70, 128, 
+65, 0, 129, 192, 1, 0, 193, 0, 2, 0, 93, 64, 128, 1, 67, 0, 
+0, 0, 95, 0, 0, 1, 70, 0, 65, 0, 76, 64, 194, 0, 198, 128, 
+66, 0, 221, 128, 128, 0, 0, 1, 0, 0, 93, 64, 0, 2, 70, 0, 
+65, 0, 76, 192, 194, 0, 192, 0, 0, 0, 93, 64, 128, 1, 70, 0, 
+67, 0, 93, 64, 128, 0, 67, 0, 128, 0, 95, 0, 0, 1, 31, 0, 
+128, 0, 13, 0, 0, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 80, 
+114, 111, 109, 112, 116, 70, 111, 114, 83, 116, 114, 105, 110, 103, 0, 4, 
+22, 0, 0, 0, 0, 0, 0, 0, 78, 97, 109, 101, 32, 111, 102, 32, 
+110, 101, 119, 32, 100, 111, 99, 117, 109, 101, 110, 116, 63, 0, 4, 36, 
+0, 0, 0, 0, 0, 0, 0, 80, 108, 101, 97, 115, 101, 32, 101, 110, 
+116, 101, 114, 32, 116, 104, 101, 32, 110, 101, 119, 32, 100, 111, 99, 117, 
+109, 101, 110, 116, 32, 110, 97, 109, 101, 58, 0, 4, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 100, 111, 99, 117, 109, 101, 110, 116, 115, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 
+103, 101, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 78, 97, 109, 101, 
+32, 105, 110, 32, 117, 115, 101, 0, 4, 71, 0, 0, 0, 0, 0, 0, 
+0, 83, 111, 114, 114, 121, 33, 32, 84, 104, 101, 114, 101, 39, 115, 32, 
+97, 108, 114, 101, 97, 100, 121, 32, 97, 32, 100, 111, 99, 117, 109, 101, 
+110, 116, 32, 119, 105, 116, 104, 32, 116, 104, 97, 116, 32, 110, 97, 109, 
+101, 32, 105, 110, 32, 116, 104, 105, 115, 32, 100, 111, 99, 117, 109, 101, 
+110, 116, 32, 115, 101, 116, 46, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 97, 100, 100, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 101, 
+116, 67, 117, 114, 114, 101, 110, 116, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 
+156, 0, 0, 0, 0, 0, 11, 111, 0, 0, 0, 6, 0, 64, 0, 7, 
+64, 64, 0, 75, 192, 1, 0, 74, 192, 64, 129, 134, 0, 64, 0, 135, 
+64, 64, 1, 74, 128, 0, 130, 74, 128, 193, 130, 74, 0, 194, 131, 74, 
+128, 194, 132, 74, 0, 195, 133, 165, 0, 0, 0, 74, 128, 128, 134, 29, 
+128, 0, 1, 75, 0, 131, 2, 74, 192, 67, 135, 134, 0, 64, 0, 135, 
+64, 68, 1, 74, 128, 0, 136, 134, 0, 64, 0, 135, 64, 68, 1, 74, 
+128, 0, 137, 74, 0, 197, 137, 74, 128, 197, 138, 74, 128, 197, 139, 74, 
+128, 69, 140, 165, 64, 0, 0, 74, 128, 128, 140, 165, 128, 0, 0, 74, 
+128, 0, 141, 165, 192, 0, 0, 74, 128, 128, 141, 165, 0, 1, 0, 74, 
+128, 0, 142, 165, 64, 1, 0, 74, 128, 128, 142, 134, 0, 64, 0, 135, 
+128, 71, 1, 203, 64, 1, 0, 202, 128, 193, 130, 202, 128, 193, 131, 202, 
+128, 194, 132, 202, 128, 193, 133, 202, 0, 200, 143, 157, 128, 0, 1, 198, 
+0, 64, 0, 199, 128, 199, 1, 11, 65, 1, 0, 10, 129, 193, 130, 10, 
+65, 200, 131, 10, 129, 194, 132, 10, 65, 200, 133, 10, 129, 200, 143, 221, 
+128, 0, 1, 6, 1, 64, 0, 7, 129, 71, 2, 75, 65, 1, 0, 74, 
+129, 193, 130, 74, 193, 200, 131, 74, 129, 194, 132, 74, 193, 200, 133, 74, 
+1, 201, 143, 29, 129, 0, 1, 70, 1, 64, 0, 71, 129, 199, 2, 139, 
+65, 1, 0, 138, 129, 193, 130, 138, 129, 194, 131, 138, 129, 194, 132, 138, 
+129, 194, 133, 138, 65, 201, 143, 93, 129, 0, 1, 128, 1, 0, 0, 100, 
+64, 128, 2, 139, 0, 0, 0, 196, 0, 0, 0, 6, 129, 73, 0, 70, 
+193, 73, 0, 76, 1, 202, 2, 93, 1, 0, 1, 29, 1, 1, 0, 23, 
+192, 2, 128, 75, 130, 0, 0, 74, 2, 130, 148, 135, 194, 74, 4, 155, 
+66, 0, 0, 23, 0, 0, 128, 129, 2, 11, 0, 74, 130, 2, 149, 138, 
+64, 130, 3, 70, 66, 75, 0, 24, 64, 2, 4, 23, 0, 0, 128, 192, 
+0, 128, 3, 34, 129, 0, 0, 163, 65, 252, 127, 10, 128, 0, 151, 10, 
+192, 128, 151, 6, 1, 64, 0, 7, 1, 76, 2, 64, 1, 128, 0, 134, 
+65, 76, 0, 29, 129, 128, 1, 70, 129, 76, 0, 93, 65, 128, 0, 27, 
+65, 0, 0, 23, 128, 247, 127, 67, 1, 128, 0, 95, 1, 0, 1, 23, 
+192, 246, 127, 31, 0, 128, 0, 51, 0, 0, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 66, 114, 111, 119, 115, 101, 114, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 102, 111, 99, 117, 115, 97, 98, 108, 101, 0, 1, 1, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 116, 121, 112, 101, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 3, 0, 
+0, 0, 0, 0, 0, 0, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+120, 50, 0, 3, 0, 0, 0, 0, 0, 0, 240, 191, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 121, 50, 0, 3, 0, 0, 0, 0, 0, 0, 16, 
+192, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 110, 103, 101, 
+100, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 105, 116, 108, 101, 
+0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 32, 77, 97, 110, 97, 103, 101, 114, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 119, 105, 100, 116, 104, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 76, 97, 114, 103, 101, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 104, 101, 105, 103, 104, 116, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 115, 116, 114, 101, 116, 99, 104, 121, 0, 1, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 94, 67, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 99, 97, 110, 99, 101, 108, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 69, 78, 
+84, 69, 82, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 117, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 100, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 114, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 120, 0, 
+4, 2, 0, 0, 0, 0, 0, 0, 0, 110, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 76, 97, 98, 101, 108, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 27, 0, 0, 0, 0, 0, 
+0, 0, 83, 101, 108, 101, 99, 116, 32, 104, 101, 97, 100, 105, 110, 103, 
+32, 116, 111, 32, 106, 117, 109, 112, 32, 116, 111, 58, 0, 3, 0, 0, 
+0, 0, 0, 0, 8, 192, 4, 52, 0, 0, 0, 0, 0, 0, 0, 85, 
+58, 32, 77, 111, 118, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 
+117, 112, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+82, 58, 32, 82, 101, 110, 97, 109, 101, 32, 100, 111, 99, 117, 109, 101, 
+110, 116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 192, 4, 52, 0, 0, 
+0, 0, 0, 0, 0, 68, 58, 32, 77, 111, 118, 101, 32, 100, 111, 99, 
+117, 109, 101, 110, 116, 32, 100, 111, 119, 110, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 88, 58, 32, 68, 101, 108, 101, 116, 101, 32, 
+100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 56, 0, 0, 0, 0, 0, 
+0, 0, 78, 58, 32, 67, 114, 101, 97, 116, 101, 32, 98, 108, 97, 110, 
+107, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 32, 32, 32, 32, 82, 
+69, 84, 85, 82, 78, 44, 32, 94, 67, 58, 32, 67, 108, 111, 115, 101, 
+32, 100, 105, 97, 108, 111, 103, 117, 101, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 12, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 
+16, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 68, 111, 99, 117, 109, 
+101, 110, 116, 76, 105, 115, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 108, 97, 98, 101, 108, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 110, 97, 109, 101, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+40, 117, 110, 110, 97, 109, 101, 100, 41, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 100, 97, 116, 97, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 82, 117, 110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 0, 6, 0, 0, 0, 31, 0, 0, 0, 34, 0, 0, 0, 1, 0, 
+4, 11, 0, 0, 0, 70, 0, 64, 0, 71, 64, 192, 0, 135, 128, 64, 
+0, 199, 192, 64, 0, 135, 192, 0, 1, 135, 0, 65, 1, 135, 64, 65, 
+1, 93, 64, 0, 1, 65, 128, 1, 0, 95, 0, 0, 1, 31, 0, 128, 
+0, 7, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 67, 104, 97, 110, 103, 
+101, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 100, 97, 116, 97, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 99, 117, 114, 115, 111, 114, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 110, 97, 109, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 114, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 56, 0, 0, 0, 0, 0, 
+5, 21, 0, 0, 0, 6, 0, 64, 0, 25, 0, 128, 128, 23, 128, 3, 
+128, 6, 128, 64, 0, 70, 0, 64, 0, 7, 64, 0, 0, 7, 192, 64, 
+0, 70, 0, 193, 0, 76, 64, 193, 0, 199, 128, 65, 0, 6, 1, 64, 
+0, 14, 65, 64, 2, 93, 64, 0, 2, 70, 0, 64, 0, 78, 64, 192, 
+0, 8, 64, 0, 128, 65, 192, 1, 0, 95, 0, 0, 1, 1, 0, 2, 
+0, 31, 0, 0, 1, 31, 0, 128, 0, 9, 0, 0, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 99, 117, 114, 115, 111, 114, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 
+97, 116, 97, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 100, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 20, 0, 0, 0, 
+0, 0, 0, 0, 109, 111, 118, 101, 68, 111, 99, 117, 109, 101, 110, 116, 
+73, 110, 100, 101, 120, 84, 111, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 110, 97, 109, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 
+111, 110, 102, 105, 114, 109, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+110, 111, 112, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 58, 0, 0, 0, 65, 0, 0, 0, 0, 0, 4, 20, 
+0, 0, 0, 6, 0, 64, 0, 70, 64, 64, 0, 85, 0, 128, 0, 25, 
+64, 0, 0, 23, 192, 2, 128, 6, 128, 192, 0, 12, 192, 64, 0, 134, 
+0, 193, 0, 135, 64, 65, 1, 198, 0, 64, 0, 205, 128, 193, 1, 29, 
+64, 0, 2, 6, 0, 64, 0, 13, 128, 65, 0, 8, 0, 0, 128, 1, 
+192, 1, 0, 31, 0, 0, 1, 1, 0, 2, 0, 31, 0, 0, 1, 31, 
+0, 128, 0, 9, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+99, 117, 114, 115, 111, 114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+100, 97, 116, 97, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 20, 0, 0, 0, 0, 
+0, 0, 0, 109, 111, 118, 101, 68, 111, 99, 117, 109, 101, 110, 116, 73, 
+110, 100, 101, 120, 84, 111, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 110, 97, 109, 101, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 110, 111, 112, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 
+0, 0, 79, 0, 0, 0, 0, 0, 5, 31, 0, 0, 0, 6, 0, 64, 
+0, 65, 64, 0, 0, 129, 128, 0, 0, 198, 192, 64, 0, 199, 0, 193, 
+1, 29, 128, 0, 2, 27, 0, 0, 0, 23, 192, 0, 128, 70, 192, 64, 
+0, 71, 0, 193, 0, 24, 64, 0, 0, 23, 64, 0, 128, 65, 64, 1, 
+0, 95, 0, 0, 1, 70, 128, 65, 0, 76, 192, 193, 0, 198, 192, 64, 
+0, 199, 0, 193, 1, 0, 1, 0, 0, 93, 128, 0, 2, 91, 64, 0, 
+0, 23, 64, 1, 128, 70, 0, 66, 0, 129, 64, 2, 0, 193, 128, 2, 
+0, 93, 64, 128, 1, 65, 64, 1, 0, 95, 0, 0, 1, 65, 64, 1, 
+0, 95, 0, 0, 1, 31, 0, 128, 0, 11, 0, 0, 0, 4, 16, 0, 
+0, 0, 0, 0, 0, 0, 80, 114, 111, 109, 112, 116, 70, 111, 114, 83, 
+116, 114, 105, 110, 103, 0, 4, 32, 0, 0, 0, 0, 0, 0, 0, 67, 
+104, 97, 110, 103, 101, 32, 110, 97, 109, 101, 32, 111, 102, 32, 99, 117, 
+114, 114, 101, 110, 116, 32, 100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 
+36, 0, 0, 0, 0, 0, 0, 0, 80, 108, 101, 97, 115, 101, 32, 101, 
+110, 116, 101, 114, 32, 116, 104, 101, 32, 110, 101, 119, 32, 100, 111, 99, 
+117, 109, 101, 110, 116, 32, 110, 97, 109, 101, 58, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 
+116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 114, 101, 110, 97, 109, 
+101, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 78, 97, 109, 101, 32, 105, 110, 
+32, 117, 115, 101, 0, 4, 71, 0, 0, 0, 0, 0, 0, 0, 83, 111, 
+114, 114, 121, 33, 32, 84, 104, 101, 114, 101, 39, 115, 32, 97, 108, 114, 
+101, 97, 100, 121, 32, 97, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 
+119, 105, 116, 104, 32, 116, 104, 97, 116, 32, 110, 97, 109, 101, 32, 105, 
+110, 32, 116, 104, 105, 115, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 
+115, 101, 116, 46, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 81, 0, 0, 0, 98, 0, 0, 0, 0, 0, 5, 38, 0, 
+0, 0, 6, 0, 64, 0, 21, 0, 0, 0, 24, 64, 64, 0, 23, 64, 
+1, 128, 6, 128, 192, 0, 65, 192, 0, 0, 129, 0, 1, 0, 29, 64, 
+128, 1, 1, 64, 1, 0, 31, 0, 0, 1, 6, 128, 193, 0, 65, 192, 
+1, 0, 129, 0, 2, 0, 198, 64, 194, 0, 199, 128, 194, 1, 1, 193, 
+2, 0, 150, 0, 1, 1, 29, 128, 128, 1, 27, 64, 0, 0, 23, 64, 
+0, 128, 3, 0, 0, 0, 31, 0, 0, 1, 6, 0, 195, 0, 12, 64, 
+67, 0, 134, 64, 194, 0, 135, 128, 66, 1, 29, 128, 128, 1, 27, 64, 
+0, 0, 23, 64, 1, 128, 6, 128, 192, 0, 65, 192, 0, 0, 129, 128, 
+3, 0, 29, 64, 128, 1, 1, 64, 1, 0, 31, 0, 0, 1, 1, 64, 
+1, 0, 31, 0, 0, 1, 31, 0, 128, 0, 15, 0, 0, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 97, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 
+100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 26, 0, 0, 0, 
+0, 0, 0, 0, 85, 110, 97, 98, 108, 101, 32, 116, 111, 32, 100, 101, 
+108, 101, 116, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 58, 
+0, 0, 0, 0, 0, 0, 0, 89, 111, 117, 32, 99, 97, 110, 39, 116, 
+32, 100, 101, 108, 101, 116, 101, 32, 116, 104, 101, 32, 108, 97, 115, 116, 
+32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 102, 114, 111, 109, 32, 116, 
+104, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 46, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 
+109, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 80, 114, 111, 109, 112, 
+116, 70, 111, 114, 89, 101, 115, 78, 111, 0, 4, 22, 0, 0, 0, 0, 
+0, 0, 0, 68, 101, 108, 101, 116, 101, 32, 116, 104, 105, 115, 32, 100, 
+111, 99, 117, 109, 101, 110, 116, 63, 0, 4, 47, 0, 0, 0, 0, 0, 
+0, 0, 65, 114, 101, 32, 121, 111, 117, 32, 115, 117, 114, 101, 32, 121, 
+111, 117, 32, 119, 97, 110, 116, 32, 116, 111, 32, 100, 101, 108, 101, 116, 
+101, 32, 116, 104, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 39, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 
+0, 4, 79, 0, 0, 0, 0, 0, 0, 0, 39, 63, 32, 73, 116, 32, 
+119, 105, 108, 108, 32, 98, 101, 32, 114, 101, 109, 111, 118, 101, 100, 32, 
+102, 114, 111, 109, 32, 116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 
+32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 44, 32, 97, 
+110, 100, 32, 119, 105, 108, 108, 32, 98, 101, 32, 103, 111, 110, 101, 32, 
+102, 111, 114, 101, 118, 101, 114, 46, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 100, 101, 108, 101, 116, 101, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 32, 0, 0, 0, 0, 0, 0, 0, 89, 
+111, 117, 32, 99, 97, 110, 39, 116, 32, 100, 101, 108, 101, 116, 101, 32, 
+116, 104, 97, 116, 32, 100, 111, 99, 117, 109, 101, 110, 116, 46, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 
+0, 0, 0, 103, 0, 0, 0, 0, 0, 2, 6, 0, 0, 0, 6, 0, 
+64, 0, 7, 64, 64, 0, 29, 64, 128, 0, 1, 128, 0, 0, 31, 0, 
+0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 67, 109, 100, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 
+65, 100, 100, 66, 108, 97, 110, 107, 68, 111, 99, 117, 109, 101, 110, 116, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 
+109, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/scrapbook.lua */
+static const char file_30[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 20, 0, 0, 
+0, 37, 0, 0, 0, 70, 0, 64, 0, 165, 64, 0, 0, 74, 128, 128, 
+128, 70, 0, 64, 0, 165, 128, 0, 0, 74, 128, 0, 129, 70, 0, 64, 
+0, 165, 192, 0, 0, 74, 128, 128, 129, 101, 0, 1, 0, 134, 0, 65, 
+0, 198, 64, 65, 0, 199, 128, 193, 1, 0, 1, 128, 0, 157, 64, 128, 
+1, 70, 0, 64, 0, 165, 64, 1, 0, 74, 128, 128, 131, 31, 0, 128, 
+0, 8, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 67, 117, 116, 84, 111, 
+83, 99, 114, 97, 112, 98, 111, 111, 107, 0, 4, 16, 0, 0, 0, 0, 
+0, 0, 0, 67, 111, 112, 121, 84, 111, 83, 99, 114, 97, 112, 98, 111, 
+111, 107, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 80, 97, 115, 116, 
+101, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 0, 4, 17, 0, 
+0, 0, 0, 0, 0, 0, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 
+115, 116, 101, 110, 101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+69, 118, 101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 82, 
+101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 0, 4, 19, 
+0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 
+83, 99, 114, 97, 112, 98, 111, 111, 107, 0, 6, 0, 0, 0, 5, 0, 
+0, 0, 16, 0, 0, 0, 2, 0, 7, 35, 0, 0, 0, 91, 64, 0, 
+0, 23, 64, 0, 128, 134, 0, 64, 0, 71, 64, 64, 1, 140, 128, 192, 
+0, 1, 193, 0, 0, 65, 1, 1, 0, 157, 128, 0, 2, 64, 0, 0, 
+1, 134, 64, 65, 0, 135, 128, 65, 1, 193, 192, 1, 0, 157, 128, 0, 
+1, 204, 128, 64, 1, 65, 193, 0, 0, 129, 1, 1, 0, 221, 128, 0, 
+2, 128, 0, 128, 1, 204, 128, 64, 0, 65, 1, 2, 0, 128, 1, 128, 
+0, 221, 128, 0, 2, 0, 0, 128, 1, 204, 128, 64, 0, 65, 65, 2, 
+0, 128, 1, 0, 1, 221, 128, 0, 2, 0, 0, 128, 1, 204, 128, 64, 
+0, 65, 1, 1, 0, 129, 193, 0, 0, 221, 128, 0, 2, 0, 0, 128, 
+1, 31, 0, 0, 1, 31, 0, 128, 0, 10, 0, 0, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 103, 115, 117, 98, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 37, 37, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+37, 37, 37, 37, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 111, 115, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 97, 116, 101, 0, 4, 
+14, 0, 0, 0, 0, 0, 0, 0, 37, 89, 45, 37, 109, 45, 37, 100, 
+46, 37, 72, 37, 77, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 37, 
+37, 91, 110, 78, 93, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 37, 
+37, 91, 116, 84, 93, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 18, 0, 0, 0, 28, 0, 0, 0, 0, 0, 2, 21, 
+0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 64, 0, 0, 23, 
+0, 1, 128, 6, 128, 64, 0, 65, 192, 0, 0, 29, 64, 0, 1, 3, 
+0, 0, 0, 31, 0, 0, 1, 6, 0, 65, 0, 7, 64, 65, 0, 29, 
+128, 128, 0, 27, 64, 0, 0, 23, 64, 0, 128, 3, 0, 0, 0, 31, 
+0, 0, 1, 6, 0, 65, 0, 7, 128, 65, 0, 30, 0, 128, 0, 31, 
+0, 0, 0, 31, 0, 128, 0, 7, 0, 0, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 
+101, 0, 4, 26, 0, 0, 0, 0, 0, 0, 0, 84, 104, 101, 114, 101, 
+39, 115, 32, 110, 111, 116, 104, 105, 110, 103, 32, 115, 101, 108, 101, 99, 
+116, 101, 100, 46, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 117, 116, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 80, 97, 115, 116, 101, 84, 111, 83, 
+99, 114, 97, 112, 98, 111, 111, 107, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 40, 0, 0, 0, 0, 
+0, 2, 21, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 64, 
+0, 0, 23, 0, 1, 128, 6, 128, 64, 0, 65, 192, 0, 0, 29, 64, 
+0, 1, 3, 0, 0, 0, 31, 0, 0, 1, 6, 0, 65, 0, 7, 64, 
+65, 0, 29, 128, 128, 0, 27, 64, 0, 0, 23, 64, 0, 128, 3, 0, 
+0, 0, 31, 0, 0, 1, 6, 0, 65, 0, 7, 128, 65, 0, 30, 0, 
+128, 0, 31, 0, 0, 0, 31, 0, 128, 0, 7, 0, 0, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 16, 0, 0, 
+0, 0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 
+115, 97, 103, 101, 0, 4, 26, 0, 0, 0, 0, 0, 0, 0, 84, 104, 
+101, 114, 101, 39, 115, 32, 110, 111, 116, 104, 105, 110, 103, 32, 115, 101, 
+108, 101, 99, 116, 101, 100, 46, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 67, 109, 100, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 67, 111, 
+112, 121, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 80, 97, 115, 116, 
+101, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 74, 
+0, 0, 0, 0, 0, 7, 80, 0, 0, 0, 6, 0, 64, 0, 12, 64, 
+64, 0, 29, 128, 0, 1, 27, 64, 0, 0, 23, 0, 1, 128, 70, 128, 
+64, 0, 129, 192, 0, 0, 93, 64, 0, 1, 67, 0, 0, 0, 95, 0, 
+0, 1, 70, 0, 64, 0, 71, 0, 193, 0, 71, 64, 193, 0, 134, 128, 
+65, 0, 135, 192, 65, 1, 198, 0, 64, 0, 204, 0, 194, 1, 71, 65, 
+194, 0, 221, 128, 128, 1, 219, 64, 0, 0, 23, 192, 2, 128, 198, 0, 
+64, 0, 204, 128, 194, 1, 70, 193, 66, 0, 93, 129, 128, 0, 135, 65, 
+194, 0, 221, 64, 0, 2, 198, 128, 64, 0, 1, 1, 3, 0, 71, 65, 
+194, 0, 129, 65, 3, 0, 22, 129, 1, 2, 221, 64, 0, 1, 198, 0, 
+64, 0, 204, 128, 195, 1, 71, 65, 194, 0, 221, 64, 128, 1, 198, 192, 
+67, 0, 199, 0, 196, 1, 221, 64, 128, 0, 198, 192, 67, 0, 199, 64, 
+196, 1, 221, 64, 128, 0, 198, 192, 67, 0, 199, 128, 196, 1, 221, 64, 
+128, 0, 199, 192, 196, 0, 219, 0, 0, 0, 23, 64, 3, 128, 198, 192, 
+67, 0, 199, 0, 197, 1, 5, 1, 128, 0, 71, 65, 197, 0, 128, 1, 
+0, 1, 29, 1, 128, 1, 221, 64, 0, 0, 198, 192, 67, 0, 199, 128, 
+197, 1, 1, 193, 5, 0, 221, 64, 0, 1, 198, 192, 67, 0, 199, 128, 
+196, 1, 221, 64, 128, 0, 198, 192, 67, 0, 199, 128, 197, 1, 1, 1, 
+6, 0, 221, 64, 0, 1, 198, 192, 67, 0, 199, 64, 198, 1, 221, 64, 
+128, 0, 198, 0, 64, 0, 204, 128, 195, 1, 64, 1, 0, 1, 221, 64, 
+128, 1, 198, 128, 64, 0, 1, 129, 6, 0, 221, 64, 0, 1, 195, 0, 
+0, 0, 223, 0, 0, 1, 31, 0, 128, 0, 27, 0, 0, 0, 4, 12, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 
+101, 116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 67, 
+108, 105, 112, 98, 111, 97, 114, 100, 0, 4, 16, 0, 0, 0, 0, 0, 
+0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 
+101, 0, 4, 34, 0, 0, 0, 0, 0, 0, 0, 84, 104, 101, 114, 101, 
+39, 115, 32, 110, 111, 116, 104, 105, 110, 103, 32, 111, 110, 32, 116, 104, 
+101, 32, 99, 108, 105, 112, 98, 111, 97, 114, 100, 46, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 97, 100, 100, 111, 110, 115, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 115, 99, 114, 97, 112, 98, 111, 111, 107, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 100, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 97, 100, 100, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 33, 0, 0, 0, 0, 0, 0, 0, 67, 114, 
+101, 97, 116, 105, 110, 103, 32, 115, 99, 114, 97, 112, 98, 111, 111, 107, 
+32, 105, 110, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 39, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 39, 46, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 115, 101, 116, 67, 117, 114, 114, 101, 110, 116, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 18, 0, 0, 
+0, 0, 0, 0, 0, 71, 111, 116, 111, 69, 110, 100, 79, 102, 68, 111, 
+99, 117, 109, 101, 110, 116, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+85, 110, 115, 101, 116, 77, 97, 114, 107, 0, 4, 22, 0, 0, 0, 0, 
+0, 0, 0, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 116, 105, 109, 101, 115, 116, 97, 109, 112, 0, 4, 26, 0, 0, 
+0, 0, 0, 0, 0, 73, 110, 115, 101, 114, 116, 83, 116, 114, 105, 110, 
+103, 73, 110, 116, 111, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 116, 101, 114, 110, 0, 
+4, 21, 0, 0, 0, 0, 0, 0, 0, 67, 104, 97, 110, 103, 101, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 83, 116, 121, 108, 101, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 72, 49, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 80, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 80, 97, 
+115, 116, 101, 0, 4, 29, 0, 0, 0, 0, 0, 0, 0, 70, 114, 97, 
+103, 109, 101, 110, 116, 32, 97, 100, 100, 101, 100, 32, 116, 111, 32, 115, 
+99, 114, 97, 112, 98, 111, 111, 107, 46, 0, 0, 0, 0, 0, 2, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 0, 86, 0, 
+0, 0, 0, 0, 2, 13, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 
+0, 70, 0, 64, 0, 71, 64, 192, 0, 71, 128, 192, 0, 91, 64, 0, 
+0, 23, 192, 0, 128, 75, 192, 0, 0, 74, 0, 193, 129, 74, 128, 193, 
+130, 74, 0, 194, 131, 10, 64, 0, 129, 31, 0, 128, 0, 9, 0, 0, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 
+100, 100, 111, 110, 115, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 115, 
+99, 114, 97, 112, 98, 111, 111, 107, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 83, 99, 114, 97, 112, 98, 111, 111, 107, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 116, 105, 109, 101, 115, 116, 97, 109, 112, 
+0, 1, 1, 4, 8, 0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 116, 
+101, 114, 110, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 73, 116, 101, 
+109, 32, 102, 114, 111, 109, 32, 39, 37, 78, 39, 32, 97, 116, 32, 37, 
+84, 58, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 94, 0, 0, 0, 193, 0, 0, 0, 0, 0, 14, 140, 0, 0, 0, 
+6, 0, 64, 0, 7, 64, 64, 0, 7, 128, 64, 0, 70, 192, 64, 0, 
+71, 0, 193, 0, 139, 64, 1, 0, 138, 128, 193, 130, 138, 0, 194, 131, 
+138, 128, 194, 132, 138, 0, 194, 133, 198, 64, 67, 0, 7, 129, 67, 0, 
+221, 128, 0, 1, 138, 192, 0, 134, 93, 128, 0, 1, 134, 192, 64, 0, 
+135, 192, 67, 1, 203, 128, 1, 0, 202, 0, 194, 130, 202, 0, 196, 131, 
+202, 128, 193, 132, 202, 0, 196, 133, 202, 128, 196, 136, 7, 193, 68, 0, 
+202, 0, 1, 134, 157, 128, 0, 1, 198, 192, 64, 0, 199, 0, 197, 1, 
+11, 1, 1, 0, 10, 1, 194, 130, 10, 65, 197, 131, 10, 129, 194, 132, 
+10, 65, 197, 133, 221, 128, 0, 1, 6, 193, 64, 0, 7, 1, 65, 2, 
+75, 129, 1, 0, 74, 129, 193, 130, 74, 129, 197, 131, 74, 129, 194, 132, 
+74, 129, 197, 133, 135, 193, 69, 0, 74, 129, 1, 134, 165, 1, 0, 0, 
+74, 129, 1, 140, 29, 129, 0, 1, 75, 193, 1, 3, 74, 129, 198, 140, 
+134, 193, 64, 0, 135, 1, 71, 3, 74, 129, 129, 141, 74, 129, 199, 142, 
+74, 1, 200, 143, 74, 129, 200, 144, 74, 1, 201, 145, 74, 1, 201, 146, 
+134, 193, 64, 0, 135, 1, 69, 3, 203, 129, 1, 0, 202, 1, 194, 130, 
+202, 1, 194, 131, 202, 129, 201, 132, 202, 1, 194, 133, 6, 194, 64, 0, 
+7, 2, 74, 4, 202, 1, 130, 147, 202, 65, 74, 134, 157, 129, 0, 1, 
+192, 1, 128, 0, 0, 2, 0, 1, 70, 194, 64, 0, 71, 2, 197, 4, 
+139, 130, 1, 0, 138, 2, 194, 130, 138, 130, 197, 131, 138, 130, 201, 132, 
+138, 130, 197, 133, 198, 194, 64, 0, 199, 2, 202, 5, 138, 194, 130, 147, 
+138, 130, 74, 134, 93, 130, 0, 1, 128, 2, 0, 2, 192, 2, 128, 1, 
+100, 65, 0, 3, 134, 193, 64, 0, 135, 193, 74, 3, 192, 1, 128, 2, 
+6, 2, 75, 0, 65, 66, 11, 0, 157, 129, 0, 2, 155, 65, 0, 0, 
+23, 64, 0, 128, 195, 1, 0, 0, 223, 1, 0, 1, 199, 1, 195, 0, 
+7, 2, 67, 1, 71, 2, 67, 2, 140, 130, 203, 3, 157, 130, 0, 1, 
+24, 192, 75, 5, 23, 0, 1, 128, 134, 2, 76, 0, 193, 66, 12, 0, 
+1, 131, 12, 0, 157, 66, 128, 1, 23, 64, 250, 127, 140, 130, 203, 4, 
+157, 130, 0, 1, 24, 192, 75, 5, 23, 0, 1, 128, 134, 2, 76, 0, 
+193, 66, 12, 0, 1, 195, 12, 0, 157, 66, 128, 1, 23, 0, 248, 127, 
+140, 2, 205, 4, 1, 67, 13, 0, 157, 130, 128, 1, 155, 2, 0, 0, 
+23, 128, 1, 128, 134, 2, 76, 0, 193, 66, 12, 0, 1, 131, 13, 0, 
+65, 195, 13, 0, 22, 67, 3, 6, 157, 66, 128, 1, 23, 0, 245, 127, 
+10, 192, 1, 135, 10, 0, 130, 137, 10, 64, 130, 139, 134, 2, 64, 0, 
+140, 2, 78, 5, 157, 66, 0, 1, 131, 2, 128, 0, 159, 2, 0, 1, 
+23, 192, 242, 127, 131, 1, 0, 0, 159, 1, 0, 1, 31, 0, 128, 0, 
+57, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 97, 100, 100, 111, 110, 115, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 115, 99, 114, 97, 112, 98, 111, 111, 107, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 84, 101, 120, 116, 70, 105, 101, 108, 100, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 128, 
+64, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 3, 0, 
+0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+120, 50, 0, 3, 0, 0, 0, 0, 0, 0, 240, 191, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 121, 50, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 118, 97, 108, 117, 101, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+116, 111, 115, 116, 114, 105, 110, 103, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 67, 104, 101, 99, 107, 98, 111, 120, 0, 3, 0, 0, 
+0, 0, 0, 0, 8, 64, 4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 
+97, 98, 101, 108, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 69, 110, 
+97, 98, 108, 101, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 116, 105, 109, 101, 115, 116, 97, 109, 
+112, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 98, 101, 108, 
+0, 3, 0, 0, 0, 0, 0, 0, 28, 64, 3, 0, 0, 0, 0, 0, 
+0, 20, 64, 4, 8, 0, 0, 0, 0, 0, 0, 0, 112, 97, 116, 116, 
+101, 114, 110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 
+119, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 105, 116, 108, 101, 
+0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 
+117, 114, 101, 32, 84, 105, 109, 101, 115, 116, 97, 109, 112, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 104, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 101, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 116, 0, 3, 0, 0, 0, 
+0, 0, 0, 34, 64, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+114, 101, 116, 99, 104, 121, 0, 1, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 75, 69, 89, 95, 94, 67, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 99, 97, 110, 99, 101, 108, 0, 4, 11, 0, 0, 0, 0, 0, 
+0, 0, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 0, 4, 8, 0, 
+0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 69, 78, 84, 69, 82, 
+0, 3, 0, 0, 0, 0, 0, 0, 64, 64, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 97, 108, 105, 103, 110, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 76, 101, 102, 116, 0, 4, 28, 0, 0, 0, 0, 0, 0, 0, 
+78, 97, 109, 101, 32, 111, 102, 32, 115, 99, 114, 97, 112, 98, 111, 111, 
+107, 32, 100, 111, 99, 117, 109, 101, 110, 116, 58, 0, 4, 19, 0, 0, 
+0, 0, 0, 0, 0, 84, 105, 109, 101, 115, 116, 97, 109, 112, 32, 112, 
+97, 116, 116, 101, 114, 110, 58, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 82, 117, 110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 
+100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 4, 53, 0, 0, 0, 
+0, 0, 0, 0, 83, 80, 65, 67, 69, 32, 116, 111, 32, 116, 111, 103, 
+103, 108, 101, 44, 32, 82, 69, 84, 85, 82, 78, 32, 116, 111, 32, 99, 
+111, 110, 102, 105, 114, 109, 44, 32, 67, 84, 82, 76, 43, 67, 32, 116, 
+111, 32, 99, 97, 110, 99, 101, 108, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 108, 101, 110, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 
+115, 97, 103, 101, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 80, 97, 
+114, 97, 109, 101, 116, 101, 114, 32, 101, 114, 114, 111, 114, 0, 4, 35, 
+0, 0, 0, 0, 0, 0, 0, 84, 104, 101, 32, 100, 111, 99, 117, 109, 
+101, 110, 116, 32, 110, 97, 109, 101, 32, 99, 97, 110, 110, 111, 116, 32, 
+98, 101, 32, 101, 109, 112, 116, 121, 46, 0, 4, 39, 0, 0, 0, 0, 
+0, 0, 0, 84, 104, 101, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 
+32, 112, 97, 116, 116, 101, 114, 110, 32, 99, 97, 110, 110, 111, 116, 32, 
+98, 101, 32, 101, 109, 112, 116, 121, 46, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 102, 105, 110, 100, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 37, 37, 91, 94, 37, 37, 110, 116, 78, 84, 93, 0, 4, 39, 0, 
+0, 0, 0, 0, 0, 0, 84, 104, 101, 32, 102, 105, 108, 101, 110, 97, 
+109, 101, 32, 112, 97, 116, 116, 101, 114, 110, 32, 99, 97, 110, 32, 111, 
+110, 108, 121, 32, 99, 111, 110, 116, 97, 105, 110, 32, 0, 4, 21, 0, 
+0, 0, 0, 0, 0, 0, 37, 37, 44, 32, 37, 78, 32, 111, 114, 32, 
+37, 84, 32, 102, 105, 101, 108, 100, 115, 46, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 1, 0, 0, 0, 124, 0, 
+0, 0, 129, 0, 0, 0, 1, 0, 4, 15, 0, 0, 0, 71, 0, 64, 
+0, 71, 64, 192, 0, 128, 0, 0, 0, 93, 64, 0, 1, 65, 192, 0, 
+0, 133, 0, 128, 0, 199, 128, 64, 0, 157, 128, 0, 1, 193, 0, 1, 
+0, 86, 192, 128, 0, 8, 64, 0, 129, 69, 0, 0, 0, 76, 64, 192, 
+0, 93, 64, 0, 1, 31, 0, 128, 0, 5, 0, 0, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 99, 108, 97, 115, 115, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 100, 114, 97, 119, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 21, 0, 0, 0, 0, 0, 
+0, 0, 40, 69, 120, 97, 109, 112, 108, 101, 32, 116, 105, 109, 101, 115, 
+116, 97, 109, 112, 58, 32, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+41, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 3, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/pagecount.lua */
+static const char file_31[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 16, 0, 0, 
+0, 37, 0, 0, 0, 70, 0, 64, 0, 134, 64, 64, 0, 135, 128, 64, 
+1, 192, 0, 0, 0, 93, 64, 128, 1, 37, 64, 0, 0, 70, 0, 64, 
+0, 134, 64, 64, 0, 135, 192, 64, 1, 192, 0, 0, 0, 93, 64, 128, 
+1, 6, 0, 65, 0, 101, 128, 0, 0, 10, 64, 128, 130, 31, 0, 128, 
+0, 6, 0, 0, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 65, 100, 
+100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 66, 117, 105, 108, 100, 83, 116, 97, 116, 
+117, 115, 66, 97, 114, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 82, 
+101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 19, 0, 0, 0, 
+0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 80, 97, 103, 
+101, 67, 111, 117, 110, 116, 0, 3, 0, 0, 0, 9, 0, 0, 0, 16, 
+0, 0, 0, 3, 0, 13, 33, 0, 0, 0, 198, 0, 64, 0, 199, 64, 
+192, 1, 199, 128, 192, 1, 219, 64, 0, 0, 23, 0, 0, 128, 203, 0, 
+0, 0, 7, 193, 192, 1, 27, 1, 0, 0, 23, 128, 5, 128, 6, 1, 
+65, 0, 7, 65, 65, 2, 70, 129, 65, 0, 71, 193, 193, 2, 91, 65, 
+0, 0, 23, 0, 0, 128, 65, 1, 2, 0, 135, 65, 194, 1, 80, 129, 
+129, 2, 29, 129, 0, 1, 85, 1, 0, 1, 77, 129, 194, 2, 134, 193, 
+66, 0, 135, 1, 67, 3, 193, 65, 3, 0, 0, 2, 0, 2, 70, 130, 
+67, 0, 128, 2, 0, 2, 193, 194, 3, 0, 1, 3, 4, 0, 93, 2, 
+0, 2, 157, 129, 0, 0, 138, 128, 129, 2, 31, 0, 128, 0, 17, 0, 
+0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+97, 100, 100, 111, 110, 115, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+112, 97, 103, 101, 99, 111, 117, 110, 116, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 101, 110, 97, 98, 108, 101, 100, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 109, 97, 116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 102, 108, 111, 111, 114, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 119, 111, 114, 100, 99, 111, 117, 110, 116, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 119, 
+111, 114, 100, 115, 112, 101, 114, 112, 97, 103, 101, 0, 3, 0, 0, 0, 
+0, 0, 0, 240, 63, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+114, 105, 110, 103, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 102, 111, 
+114, 109, 97, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 37, 100, 
+32, 37, 115, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 80, 108, 117, 
+114, 97, 108, 105, 115, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+112, 97, 103, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+103, 101, 115, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 25, 0, 0, 0, 30, 0, 0, 0, 0, 0, 2, 12, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 64, 192, 
+0, 71, 128, 192, 0, 91, 64, 0, 0, 23, 128, 0, 128, 75, 128, 0, 
+0, 74, 0, 193, 129, 74, 128, 193, 130, 10, 64, 0, 129, 31, 0, 128, 
+0, 7, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 97, 100, 100, 111, 110, 115, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 112, 97, 103, 101, 99, 111, 117, 110, 116, 0, 4, 8, 0, 
+0, 0, 0, 0, 0, 0, 101, 110, 97, 98, 108, 101, 100, 0, 1, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 119, 111, 114, 100, 115, 112, 101, 
+114, 112, 97, 103, 101, 0, 3, 0, 0, 0, 0, 0, 64, 111, 64, 0, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 
+0, 100, 0, 0, 0, 0, 0, 10, 83, 0, 0, 0, 6, 0, 64, 0, 
+7, 64, 64, 0, 7, 128, 64, 0, 70, 192, 64, 0, 71, 0, 193, 0, 
+139, 128, 1, 0, 138, 128, 193, 130, 138, 128, 193, 131, 138, 64, 66, 132, 
+138, 128, 65, 133, 138, 0, 195, 133, 199, 128, 67, 0, 138, 192, 128, 134, 
+93, 128, 0, 1, 134, 192, 64, 0, 135, 192, 67, 1, 203, 64, 1, 0, 
+202, 64, 194, 130, 202, 0, 196, 131, 202, 64, 68, 132, 202, 0, 68, 133, 
+6, 129, 68, 0, 71, 193, 68, 0, 29, 129, 0, 1, 202, 0, 129, 134, 
+157, 128, 0, 1, 203, 192, 129, 1, 202, 64, 69, 138, 6, 193, 64, 0, 
+7, 193, 69, 2, 202, 0, 1, 139, 202, 64, 70, 140, 202, 192, 70, 141, 
+202, 64, 71, 142, 202, 192, 71, 143, 202, 192, 71, 144, 0, 1, 128, 0, 
+70, 193, 64, 0, 71, 65, 200, 2, 139, 129, 1, 0, 138, 129, 193, 130, 
+138, 1, 196, 131, 138, 129, 72, 132, 138, 1, 68, 133, 198, 193, 64, 0, 
+199, 1, 201, 3, 138, 193, 129, 145, 138, 65, 201, 134, 93, 129, 0, 1, 
+128, 1, 0, 1, 228, 64, 128, 1, 6, 193, 64, 0, 7, 129, 73, 2, 
+64, 1, 128, 1, 134, 193, 73, 0, 193, 1, 10, 0, 29, 129, 0, 2, 
+27, 65, 0, 0, 23, 64, 0, 128, 67, 1, 0, 0, 95, 1, 0, 1, 
+71, 65, 195, 0, 134, 65, 74, 0, 199, 65, 67, 1, 157, 129, 0, 1, 
+155, 65, 0, 0, 23, 0, 1, 128, 198, 129, 74, 0, 1, 194, 10, 0, 
+65, 2, 11, 0, 221, 65, 128, 1, 23, 128, 250, 127, 10, 64, 1, 135, 
+10, 128, 129, 137, 198, 1, 64, 0, 204, 65, 203, 3, 221, 65, 0, 1, 
+195, 1, 128, 0, 223, 1, 0, 1, 23, 128, 248, 127, 3, 1, 0, 0, 
+31, 1, 0, 1, 31, 0, 128, 0, 46, 0, 0, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 111, 110, 115, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 112, 97, 103, 101, 99, 111, 
+117, 110, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 70, 111, 114, 
+109, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 104, 101, 99, 107, 
+98, 111, 120, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 49, 0, 
+3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 121, 49, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 50, 
+0, 3, 0, 0, 0, 0, 0, 128, 64, 64, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 121, 50, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 
+97, 98, 101, 108, 0, 4, 28, 0, 0, 0, 0, 0, 0, 0, 83, 104, 
+111, 119, 32, 97, 112, 112, 114, 111, 120, 105, 109, 97, 116, 101, 32, 112, 
+97, 103, 101, 32, 99, 111, 117, 110, 116, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 101, 110, 97, 98, 108, 101, 100, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 84, 101, 120, 116, 70, 105, 101, 108, 100, 0, 3, 0, 0, 
+0, 0, 0, 0, 8, 64, 3, 0, 0, 0, 0, 0, 128, 69, 64, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 115, 116, 114, 105, 110, 103, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 119, 111, 114, 100, 115, 112, 
+101, 114, 112, 97, 103, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+116, 105, 116, 108, 101, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 67, 
+111, 110, 102, 105, 103, 117, 114, 101, 32, 80, 97, 103, 101, 32, 67, 111, 
+117, 110, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 
+116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 
+101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 
+116, 0, 3, 0, 0, 0, 0, 0, 0, 20, 64, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 115, 116, 114, 101, 116, 99, 104, 121, 0, 1, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 94, 67, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 99, 101, 108, 0, 4, 
+11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 69, 84, 85, 
+82, 78, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 
+105, 114, 109, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 
+95, 69, 78, 84, 69, 82, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+76, 97, 98, 101, 108, 0, 3, 0, 0, 0, 0, 0, 0, 64, 64, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 97, 108, 105, 103, 110, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 76, 101, 102, 116, 0, 4, 26, 0, 0, 
+0, 0, 0, 0, 0, 78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 119, 
+111, 114, 100, 115, 32, 112, 101, 114, 32, 112, 97, 103, 101, 58, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 
+110, 0, 4, 53, 0, 0, 0, 0, 0, 0, 0, 83, 80, 65, 67, 69, 
+32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 84, 85, 
+82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 
+84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 110, 117, 109, 98, 101, 
+114, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 97, 108, 
+77, 101, 115, 115, 97, 103, 101, 0, 4, 16, 0, 0, 0, 0, 0, 0, 
+0, 80, 97, 114, 97, 109, 101, 116, 101, 114, 32, 101, 114, 114, 111, 114, 
+0, 4, 53, 0, 0, 0, 0, 0, 0, 0, 84, 104, 101, 32, 110, 117, 
+109, 98, 101, 114, 32, 111, 102, 32, 119, 111, 114, 100, 115, 32, 112, 101, 
+114, 32, 112, 97, 103, 101, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 
+32, 118, 97, 108, 105, 100, 32, 110, 117, 109, 98, 101, 114, 46, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/statusbar_charstyle.lua */
+static const char file_32[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 18, 0, 0, 
+0, 1, 0, 0, 0, 101, 0, 0, 0, 134, 64, 64, 0, 198, 128, 64, 
+0, 199, 192, 192, 1, 0, 1, 128, 0, 157, 64, 128, 1, 101, 64, 0, 
+0, 134, 64, 64, 0, 198, 128, 64, 0, 199, 0, 193, 1, 0, 1, 128, 
+0, 157, 64, 128, 1, 101, 128, 0, 0, 8, 64, 128, 130, 101, 192, 0, 
+0, 8, 64, 0, 131, 31, 0, 128, 0, 7, 0, 0, 0, 3, 0, 0, 
+0, 0, 0, 0, 0, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 65, 
+100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 
+15, 0, 0, 0, 0, 0, 0, 0, 66, 117, 105, 108, 100, 83, 116, 97, 
+116, 117, 115, 66, 97, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+77, 111, 118, 101, 100, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 83, 
+101, 116, 67, 117, 114, 114, 101, 110, 116, 83, 116, 121, 108, 101, 72, 105, 
+110, 116, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 71, 101, 116, 67, 
+117, 114, 114, 101, 110, 116, 83, 116, 121, 108, 101, 72, 105, 110, 116, 0, 
+4, 0, 0, 0, 11, 0, 0, 0, 24, 0, 0, 0, 3, 0, 9, 49, 
+0, 0, 0, 203, 0, 128, 1, 6, 1, 64, 0, 7, 65, 64, 2, 69, 
+1, 128, 0, 134, 129, 64, 0, 135, 193, 64, 3, 29, 129, 128, 1, 27, 
+1, 0, 0, 23, 128, 0, 128, 1, 1, 1, 0, 27, 65, 0, 0, 23, 
+0, 0, 128, 1, 65, 1, 0, 70, 1, 64, 0, 71, 65, 192, 2, 133, 
+1, 128, 0, 198, 129, 64, 0, 199, 129, 193, 3, 93, 129, 128, 1, 91, 
+1, 0, 0, 23, 128, 0, 128, 65, 193, 1, 0, 91, 65, 0, 0, 23, 
+0, 0, 128, 65, 65, 1, 0, 134, 1, 64, 0, 135, 65, 64, 3, 197, 
+1, 128, 0, 6, 130, 64, 0, 7, 2, 66, 4, 157, 129, 128, 1, 155, 
+1, 0, 0, 23, 128, 0, 128, 129, 65, 2, 0, 155, 65, 0, 0, 23, 
+0, 0, 128, 129, 65, 1, 0, 228, 64, 128, 1, 21, 1, 0, 1, 13, 
+129, 66, 2, 75, 129, 0, 0, 74, 1, 195, 133, 134, 129, 67, 0, 135, 
+193, 67, 3, 192, 1, 128, 1, 157, 129, 0, 1, 74, 129, 129, 134, 138, 
+64, 1, 2, 31, 0, 128, 0, 16, 0, 0, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 98, 105, 116, 51, 50, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 98, 116, 101, 115, 116, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 119, 103, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 73, 84, 
+65, 76, 73, 67, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 73, 0, 
+4, 2, 0, 0, 0, 0, 0, 0, 0, 46, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 66, 79, 76, 68, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 66, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 85, 78, 68, 
+69, 82, 76, 73, 78, 69, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 
+85, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 112, 114, 105, 111, 114, 105, 116, 121, 0, 3, 0, 0, 
+0, 0, 0, 128, 91, 64, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 
+97, 108, 117, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 
+98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 
+99, 97, 116, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 33, 0, 0, 0, 35, 0, 0, 0, 2, 0, 3, 4, 
+0, 0, 0, 134, 0, 192, 0, 157, 128, 128, 0, 137, 0, 0, 0, 31, 
+0, 128, 0, 1, 0, 0, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 
+71, 101, 116, 83, 116, 121, 108, 101, 84, 111, 76, 101, 102, 116, 79, 102, 
+67, 117, 114, 115, 111, 114, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 46, 0, 0, 0, 2, 
+0, 5, 13, 0, 0, 0, 134, 0, 192, 0, 135, 64, 64, 1, 197, 0, 
+0, 0, 0, 1, 0, 0, 157, 128, 128, 1, 137, 0, 0, 0, 134, 0, 
+192, 0, 135, 128, 64, 1, 197, 0, 0, 0, 0, 1, 128, 0, 157, 128, 
+128, 1, 137, 0, 0, 0, 31, 0, 128, 0, 3, 0, 0, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 98, 105, 116, 51, 50, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 98, 120, 111, 114, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 98, 97, 110, 100, 0, 0, 0, 0, 0, 2, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 50, 0, 0, 
+0, 0, 0, 2, 3, 0, 0, 0, 5, 0, 0, 0, 31, 0, 0, 1, 
+31, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+
+};
+
+/* This is src/lua/addons/statusbar_position.lua */
+static const char file_33[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 9, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 101, 0, 0, 0, 134, 128, 64, 
+0, 198, 192, 64, 0, 199, 0, 193, 1, 0, 1, 128, 0, 157, 64, 128, 
+1, 31, 0, 128, 0, 5, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 102, 111, 114, 109, 97, 116, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 
+101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 
+116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 66, 117, 105, 108, 100, 
+83, 116, 97, 116, 117, 115, 66, 97, 114, 0, 1, 0, 0, 0, 11, 0, 
+0, 0, 17, 0, 0, 0, 3, 0, 9, 14, 0, 0, 0, 213, 0, 0, 
+1, 205, 0, 192, 1, 11, 129, 0, 0, 10, 129, 192, 128, 69, 1, 0, 
+0, 129, 1, 1, 0, 198, 65, 193, 0, 199, 129, 193, 3, 6, 66, 193, 
+0, 21, 2, 0, 4, 93, 129, 0, 2, 10, 65, 129, 129, 138, 0, 129, 
+1, 31, 0, 128, 0, 7, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 4, 9, 0, 0, 0, 0, 0, 0, 0, 112, 114, 105, 111, 114, 
+105, 116, 121, 0, 3, 0, 0, 0, 0, 0, 0, 89, 64, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 80, 58, 32, 37, 100, 47, 37, 100, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 112, 0, 0, 0, 0, 0, 
+2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/statusbar_wordcount.lua */
+static const char file_34[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 9, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 101, 0, 0, 0, 134, 128, 64, 
+0, 198, 192, 64, 0, 199, 0, 193, 1, 0, 1, 128, 0, 157, 64, 128, 
+1, 31, 0, 128, 0, 5, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 102, 111, 114, 109, 97, 116, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 
+101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 
+116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 66, 117, 105, 108, 100, 
+83, 116, 97, 116, 117, 115, 66, 97, 114, 0, 1, 0, 0, 0, 11, 0, 
+0, 0, 18, 0, 0, 0, 3, 0, 12, 24, 0, 0, 0, 213, 0, 0, 
+1, 205, 0, 192, 1, 11, 129, 0, 0, 10, 129, 192, 128, 69, 1, 0, 
+0, 129, 1, 1, 0, 198, 65, 193, 0, 199, 129, 193, 3, 219, 65, 0, 
+0, 23, 0, 0, 128, 193, 193, 1, 0, 6, 2, 194, 0, 70, 66, 193, 
+0, 71, 130, 193, 4, 91, 66, 0, 0, 23, 0, 0, 128, 65, 194, 1, 
+0, 129, 66, 2, 0, 193, 130, 2, 0, 29, 2, 0, 2, 93, 129, 0, 
+0, 10, 65, 129, 129, 138, 0, 129, 1, 31, 0, 128, 0, 11, 0, 0, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 112, 114, 105, 111, 114, 105, 116, 121, 0, 3, 0, 0, 0, 
+0, 0, 128, 86, 64, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 
+108, 117, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 37, 100, 32, 
+37, 115, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 119, 111, 
+114, 100, 99, 111, 117, 110, 116, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 80, 108, 117, 114, 97, 108, 
+105, 115, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 119, 111, 114, 
+100, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 111, 114, 100, 115, 
+0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/debug.lua */
+static const char file_35[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 7, 31, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 134, 0, 65, 0, 135, 64, 65, 1, 229, 0, 0, 0, 6, 129, 65, 
+0, 70, 193, 65, 0, 71, 1, 194, 2, 128, 1, 128, 1, 29, 65, 128, 
+1, 229, 64, 0, 0, 6, 129, 65, 0, 70, 193, 65, 0, 71, 65, 194, 
+2, 128, 1, 128, 1, 29, 65, 128, 1, 229, 128, 0, 0, 6, 129, 65, 
+0, 70, 193, 65, 0, 71, 129, 194, 2, 128, 1, 128, 1, 29, 65, 128, 
+1, 198, 192, 66, 0, 37, 193, 0, 0, 202, 0, 1, 134, 198, 192, 66, 
+0, 37, 1, 1, 0, 202, 0, 129, 134, 31, 0, 128, 0, 14, 0, 0, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 102, 111, 114, 109, 97, 116, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 98, 108, 101, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 99, 97, 116, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 114, 101, 110, 100, 101, 114, 115, 116, 97, 116, 115, 
+0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 65, 100, 100, 69, 118, 101, 
+110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 66, 117, 105, 108, 100, 83, 116, 97, 116, 117, 115, 66, 97, 
+114, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 73, 100, 108, 101, 0, 
+4, 15, 0, 0, 0, 0, 0, 0, 0, 82, 101, 103, 105, 115, 116, 101, 
+114, 65, 100, 100, 111, 110, 115, 0, 4, 4, 0, 0, 0, 0, 0, 0, 
+0, 67, 109, 100, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 67, 111, 
+110, 102, 105, 103, 117, 114, 101, 68, 101, 98, 117, 103, 0, 4, 16, 0, 
+0, 0, 0, 0, 0, 0, 68, 117, 109, 112, 82, 101, 110, 100, 101, 114, 
+83, 116, 97, 116, 115, 0, 5, 0, 0, 0, 13, 0, 0, 0, 40, 0, 
+0, 0, 3, 0, 13, 65, 0, 0, 0, 198, 0, 64, 0, 199, 64, 192, 
+1, 7, 129, 192, 1, 27, 1, 0, 0, 23, 0, 3, 128, 6, 193, 64, 
+0, 65, 1, 1, 0, 29, 129, 0, 1, 85, 1, 0, 1, 77, 65, 193, 
+2, 139, 129, 0, 0, 138, 193, 65, 131, 197, 1, 128, 0, 1, 66, 2, 
+0, 64, 2, 0, 2, 221, 129, 128, 1, 138, 193, 1, 132, 138, 128, 129, 
+2, 7, 129, 194, 1, 27, 1, 0, 0, 23, 128, 10, 128, 5, 1, 0, 
+1, 29, 193, 128, 0, 133, 1, 128, 0, 193, 193, 2, 0, 7, 2, 195, 
+2, 157, 129, 128, 1, 199, 65, 195, 2, 219, 1, 0, 0, 23, 64, 1, 
+128, 192, 1, 0, 3, 5, 2, 128, 0, 65, 130, 3, 0, 135, 66, 195, 
+2, 29, 130, 128, 1, 150, 1, 130, 3, 192, 1, 0, 3, 5, 2, 128, 
+0, 65, 194, 3, 0, 135, 2, 196, 2, 29, 130, 128, 1, 150, 1, 130, 
+3, 199, 65, 196, 2, 219, 1, 0, 0, 23, 64, 1, 128, 192, 1, 0, 
+3, 5, 2, 128, 0, 65, 130, 4, 0, 135, 66, 196, 2, 29, 130, 128, 
+1, 150, 1, 130, 3, 213, 1, 0, 1, 205, 65, 193, 3, 11, 130, 0, 
+0, 10, 194, 65, 131, 64, 2, 0, 3, 133, 2, 128, 0, 193, 194, 4, 
+0, 7, 3, 197, 2, 15, 67, 69, 6, 157, 130, 128, 1, 86, 130, 130, 
+4, 10, 66, 2, 132, 138, 0, 130, 3, 31, 0, 128, 0, 22, 0, 0, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 71, 108, 111, 98, 97, 108, 
+83, 101, 116, 116, 105, 110, 103, 115, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 100, 101, 98, 117, 103, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 109, 101, 109, 111, 114, 121, 0, 4, 15, 0, 0, 0, 0, 0, 0, 
+0, 99, 111, 108, 108, 101, 99, 116, 103, 97, 114, 98, 97, 103, 101, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 99, 111, 117, 110, 116, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 63, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 112, 114, 105, 111, 114, 105, 116, 121, 0, 3, 0, 0, 0, 0, 0, 
+0, 73, 64, 4, 6, 0, 0, 0, 0, 0, 0, 0, 118, 97, 108, 117, 
+101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 37, 100, 107, 66, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 114, 101, 110, 100, 101, 114, 115, 
+116, 97, 116, 115, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 37, 100, 
+119, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 119, 114, 105, 116, 101, 
+115, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 99, 101, 108, 108, 115, 
+99, 104, 97, 110, 103, 101, 100, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 32, 37, 100, 99, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 32, 
+37, 100, 97, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 97, 116, 116, 
+114, 115, 119, 105, 116, 99, 104, 101, 115, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 114, 101, 113, 117, 101, 115, 116, 115, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 32, 37, 100, 114, 0, 4, 8, 0, 0, 0, 0, 
+0, 0, 0, 32, 37, 46, 49, 102, 109, 115, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 114, 101, 100, 114, 97, 119, 116, 105, 109, 101, 0, 3, 
+0, 0, 0, 0, 0, 64, 143, 64, 0, 0, 0, 0, 3, 0, 0, 0, 
+0, 0, 1, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 54, 0, 
+0, 0, 2, 0, 3, 8, 0, 0, 0, 134, 0, 64, 0, 135, 64, 64, 
+1, 135, 128, 64, 1, 155, 0, 0, 0, 23, 64, 0, 128, 134, 192, 64, 
+0, 157, 64, 128, 0, 31, 0, 128, 0, 4, 0, 0, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 
+105, 110, 103, 115, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 100, 101, 
+98, 117, 103, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 109, 101, 109, 
+111, 114, 121, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 81, 117, 101, 
+117, 101, 82, 101, 100, 114, 97, 119, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 68, 0, 0, 0, 0, 
+0, 2, 10, 0, 0, 0, 6, 0, 64, 0, 70, 0, 64, 0, 71, 64, 
+192, 0, 91, 64, 0, 0, 23, 128, 0, 128, 75, 128, 0, 0, 74, 192, 
+64, 129, 74, 192, 64, 130, 10, 64, 128, 128, 31, 0, 128, 0, 5, 0, 
+0, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 71, 108, 111, 98, 97, 
+108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 100, 101, 98, 117, 103, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 109, 101, 109, 111, 114, 121, 0, 1, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 114, 101, 110, 100, 101, 114, 115, 116, 97, 116, 115, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 
+0, 0, 128, 0, 0, 0, 0, 0, 9, 68, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 0, 139, 128, 1, 
+0, 138, 64, 65, 130, 138, 192, 65, 131, 138, 64, 66, 132, 138, 192, 65, 
+133, 138, 0, 195, 133, 199, 128, 67, 0, 138, 192, 128, 134, 93, 128, 0, 
+1, 134, 128, 64, 0, 135, 192, 64, 1, 203, 128, 1, 0, 202, 64, 65, 
+130, 202, 192, 67, 131, 202, 64, 66, 132, 202, 192, 67, 133, 202, 0, 196, 
+133, 7, 65, 68, 0, 202, 0, 129, 134, 157, 128, 0, 1, 203, 192, 1, 
+1, 202, 192, 68, 137, 6, 129, 64, 0, 7, 65, 69, 2, 202, 0, 1, 
+138, 202, 192, 69, 139, 202, 64, 70, 140, 202, 192, 70, 141, 202, 64, 71, 
+142, 202, 64, 71, 143, 0, 1, 128, 0, 64, 1, 0, 1, 134, 129, 64, 
+0, 135, 193, 71, 3, 203, 129, 1, 0, 202, 65, 65, 130, 202, 65, 65, 
+131, 202, 1, 72, 132, 202, 65, 65, 133, 6, 130, 64, 0, 7, 130, 72, 
+4, 202, 1, 130, 144, 202, 193, 200, 134, 157, 1, 0, 1, 228, 64, 0, 
+0, 6, 129, 64, 0, 7, 1, 73, 2, 64, 1, 128, 1, 134, 65, 73, 
+0, 193, 129, 9, 0, 29, 129, 0, 2, 27, 65, 0, 0, 23, 64, 0, 
+128, 67, 1, 0, 0, 95, 1, 0, 1, 71, 65, 195, 0, 10, 64, 1, 
+135, 71, 65, 67, 1, 10, 64, 129, 136, 70, 193, 73, 0, 93, 65, 128, 
+0, 67, 1, 128, 0, 95, 1, 0, 1, 31, 0, 128, 0, 40, 0, 0, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 71, 108, 111, 98, 97, 108, 
+83, 101, 116, 116, 105, 110, 103, 115, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 100, 101, 98, 117, 103, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 70, 111, 114, 109, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 
+104, 101, 99, 107, 98, 111, 120, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 121, 49, 0, 3, 0, 0, 0, 0, 0, 0, 
+8, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 120, 50, 0, 3, 0, 
+0, 0, 0, 0, 0, 68, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+121, 50, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 97, 98, 101, 
+108, 0, 4, 32, 0, 0, 0, 0, 0, 0, 0, 83, 104, 111, 119, 32, 
+109, 101, 109, 111, 114, 121, 32, 117, 115, 97, 103, 101, 32, 111, 110, 32, 
+115, 116, 97, 116, 117, 115, 32, 98, 97, 114, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 109, 101, 109, 111, 114, 121, 0, 3, 0, 0, 0, 0, 0, 
+0, 20, 64, 4, 40, 0, 0, 0, 0, 0, 0, 0, 83, 104, 111, 119, 
+32, 114, 101, 110, 100, 101, 114, 105, 110, 103, 32, 115, 116, 97, 116, 105, 
+115, 116, 105, 99, 115, 32, 111, 110, 32, 115, 116, 97, 116, 117, 115, 32, 
+98, 97, 114, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 114, 101, 110, 
+100, 101, 114, 115, 116, 97, 116, 115, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 116, 105, 116, 108, 101, 0, 4, 28, 0, 0, 0, 0, 0, 0, 
+0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 32, 68, 101, 98, 117, 103, 
+103, 105, 110, 103, 32, 79, 112, 116, 105, 111, 110, 115, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 104, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 76, 97, 114, 103, 101, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 104, 101, 105, 103, 104, 116, 0, 3, 0, 0, 0, 0, 
+0, 0, 28, 64, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 
+101, 116, 99, 104, 121, 0, 1, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 75, 69, 89, 95, 94, 67, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 99, 97, 110, 99, 101, 108, 0, 4, 11, 0, 0, 0, 0, 0, 0, 
+0, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 69, 78, 84, 69, 82, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 98, 101, 108, 0, 3, 
+0, 0, 0, 0, 0, 0, 240, 191, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 97, 108, 105, 103, 110, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+67, 101, 110, 116, 114, 101, 0, 4, 59, 0, 0, 0, 0, 0, 0, 0, 
+78, 111, 110, 101, 32, 111, 102, 32, 116, 104, 101, 115, 101, 32, 111, 112, 
+116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 111, 102, 32, 97, 110, 121, 
+32, 105, 110, 116, 101, 114, 101, 115, 116, 32, 116, 111, 32, 110, 111, 114, 
+109, 97, 108, 32, 117, 115, 101, 114, 115, 46, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 82, 117, 110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 
+0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 4, 53, 
+0, 0, 0, 0, 0, 0, 0, 83, 80, 65, 67, 69, 32, 116, 111, 32, 
+116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 84, 85, 82, 78, 32, 116, 
+111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 84, 82, 76, 43, 
+67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 0, 4, 19, 0, 0, 
+0, 0, 0, 0, 0, 83, 97, 118, 101, 71, 108, 111, 98, 97, 108, 83, 
+101, 116, 116, 105, 110, 103, 115, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 135, 0, 0, 0, 157, 0, 0, 0, 0, 0, 
+10, 18, 0, 0, 0, 5, 0, 0, 0, 29, 192, 128, 0, 165, 0, 0, 
+0, 198, 0, 192, 1, 1, 65, 0, 0, 65, 129, 0, 0, 128, 1, 0, 
+1, 192, 1, 0, 0, 157, 129, 0, 1, 193, 193, 0, 0, 0, 2, 0, 
+1, 64, 2, 128, 0, 29, 130, 0, 1, 86, 1, 130, 2, 221, 64, 128, 
+1, 195, 0, 128, 0, 223, 0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 100, 97, 108, 77, 
+101, 115, 115, 97, 103, 101, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 
+82, 101, 110, 100, 101, 114, 105, 110, 103, 32, 115, 116, 97, 116, 105, 115, 
+116, 105, 99, 115, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 84, 111, 
+116, 97, 108, 58, 32, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 32, 
+76, 97, 115, 116, 32, 102, 114, 97, 109, 101, 58, 32, 0, 1, 0, 0, 
+0, 138, 0, 0, 0, 152, 0, 0, 0, 1, 0, 6, 53, 0, 0, 0, 
+75, 0, 128, 0, 133, 0, 0, 0, 193, 0, 0, 0, 7, 65, 64, 0, 
+157, 128, 128, 1, 197, 0, 0, 0, 1, 129, 0, 0, 71, 193, 64, 0, 
+221, 0, 128, 1, 100, 64, 0, 0, 135, 0, 65, 0, 155, 0, 0, 0, 
+23, 128, 1, 128, 149, 0, 128, 0, 141, 64, 65, 1, 197, 0, 0, 0, 
+1, 129, 1, 0, 71, 1, 65, 0, 221, 128, 128, 1, 74, 192, 0, 1, 
+149, 0, 128, 0, 141, 64, 65, 1, 197, 0, 0, 0, 1, 193, 1, 0, 
+71, 1, 66, 0, 221, 128, 128, 1, 74, 192, 0, 1, 135, 64, 66, 0, 
+155, 0, 0, 0, 23, 128, 1, 128, 149, 0, 128, 0, 141, 64, 65, 1, 
+197, 0, 0, 0, 1, 129, 2, 0, 71, 65, 66, 0, 221, 128, 128, 1, 
+74, 192, 0, 1, 149, 0, 128, 0, 141, 64, 65, 1, 197, 0, 0, 0, 
+1, 193, 2, 0, 71, 1, 67, 0, 79, 65, 195, 2, 221, 128, 128, 1, 
+74, 192, 0, 1, 133, 0, 128, 0, 192, 0, 128, 0, 1, 129, 3, 0, 
+157, 128, 128, 1, 193, 192, 3, 0, 150, 192, 0, 1, 159, 0, 0, 1, 
+31, 0, 128, 0, 16, 0, 0, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 37, 100, 32, 102, 114, 97, 109, 101, 115, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 102, 114, 97, 109, 101, 115, 0, 4, 22, 0, 0, 0, 
+0, 0, 0, 0, 37, 100, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 
+115, 32, 119, 114, 105, 116, 116, 101, 110, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 119, 114, 105, 116, 101, 115, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 99, 101, 108, 108, 115, 99, 104, 97, 110, 103, 101, 100, 0, 
+3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 37, 100, 32, 99, 101, 108, 108, 115, 32, 99, 104, 97, 110, 103, 
+101, 100, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 37, 100, 32, 97, 
+116, 116, 114, 105, 98, 117, 116, 101, 32, 115, 119, 105, 116, 99, 104, 101, 
+115, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 97, 116, 116, 114, 115, 
+119, 105, 116, 99, 104, 101, 115, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 114, 101, 113, 117, 101, 115, 116, 115, 0, 4, 20, 0, 0, 0, 0, 
+0, 0, 0, 37, 100, 32, 100, 105, 115, 112, 108, 97, 121, 32, 114, 101, 
+113, 117, 101, 115, 116, 115, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 
+37, 46, 51, 102, 109, 115, 32, 105, 110, 32, 82, 101, 100, 114, 97, 119, 
+83, 99, 114, 101, 101, 110, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 
+114, 101, 100, 114, 97, 119, 116, 105, 109, 101, 0, 3, 0, 0, 0, 0, 
+0, 64, 143, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 44, 32, 0, 
+4, 2, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 1, 
+2, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/widescreen.lua */
+static const char file_36[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 12, 0, 0, 
+0, 37, 0, 0, 0, 8, 0, 0, 128, 37, 64, 0, 0, 70, 64, 64, 
+0, 134, 128, 64, 0, 135, 192, 64, 1, 192, 0, 0, 0, 93, 64, 128, 
+1, 6, 0, 65, 0, 101, 128, 0, 0, 10, 64, 128, 130, 31, 0, 128, 
+0, 6, 0, 0, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 71, 101, 
+116, 77, 97, 120, 105, 109, 117, 109, 65, 108, 108, 111, 119, 101, 100, 87, 
+105, 100, 116, 104, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 65, 100, 
+100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 69, 118, 101, 110, 116, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 82, 101, 103, 105, 115, 116, 101, 114, 65, 
+100, 100, 111, 110, 115, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 
+109, 100, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 
+105, 103, 117, 114, 101, 87, 105, 100, 101, 115, 99, 114, 101, 101, 110, 0, 
+3, 0, 0, 0, 8, 0, 0, 0, 14, 0, 0, 0, 1, 0, 5, 15, 
+0, 0, 0, 70, 0, 64, 0, 71, 64, 192, 0, 91, 0, 0, 0, 23, 
+128, 0, 128, 135, 128, 192, 0, 155, 64, 0, 0, 23, 0, 0, 128, 31, 
+0, 0, 1, 134, 192, 64, 0, 135, 0, 65, 1, 192, 0, 0, 0, 7, 
+65, 193, 0, 158, 0, 128, 1, 159, 0, 0, 0, 31, 0, 128, 0, 6, 
+0, 0, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 71, 108, 111, 98, 
+97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 119, 105, 100, 101, 115, 99, 114, 101, 101, 110, 0, 4, 
+8, 0, 0, 0, 0, 0, 0, 0, 101, 110, 97, 98, 108, 101, 100, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 97, 116, 104, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 109, 105, 110, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 109, 97, 120, 119, 105, 100, 116, 104, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 25, 
+0, 0, 0, 0, 0, 2, 10, 0, 0, 0, 6, 0, 64, 0, 70, 0, 
+64, 0, 71, 64, 192, 0, 91, 64, 0, 0, 23, 128, 0, 128, 75, 128, 
+0, 0, 74, 192, 64, 129, 74, 64, 65, 130, 10, 64, 128, 128, 31, 0, 
+128, 0, 6, 0, 0, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 71, 
+108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 101, 115, 99, 114, 101, 101, 
+110, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 101, 110, 97, 98, 108, 
+101, 100, 0, 1, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 109, 97, 
+120, 119, 105, 100, 116, 104, 0, 3, 0, 0, 0, 0, 0, 0, 84, 64, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 
+0, 0, 95, 0, 0, 0, 0, 0, 10, 83, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 0, 139, 128, 1, 
+0, 138, 64, 65, 130, 138, 64, 65, 131, 138, 0, 194, 131, 138, 64, 193, 
+132, 138, 192, 66, 133, 199, 64, 67, 0, 138, 192, 0, 134, 93, 128, 0, 
+1, 134, 128, 64, 0, 135, 128, 67, 1, 203, 64, 1, 0, 202, 0, 66, 
+130, 202, 192, 67, 131, 202, 0, 196, 131, 202, 192, 195, 132, 6, 65, 68, 
+0, 71, 129, 68, 0, 29, 129, 0, 1, 202, 0, 1, 134, 157, 128, 0, 
+1, 203, 192, 129, 1, 202, 0, 197, 137, 6, 129, 64, 0, 7, 129, 69, 
+2, 202, 0, 129, 138, 202, 0, 198, 139, 202, 128, 198, 140, 202, 0, 199, 
+141, 202, 128, 199, 142, 202, 128, 199, 143, 0, 1, 128, 0, 70, 129, 64, 
+0, 71, 1, 200, 2, 139, 129, 1, 0, 138, 65, 65, 130, 138, 193, 67, 
+131, 138, 65, 200, 131, 138, 193, 195, 132, 198, 129, 64, 0, 199, 193, 200, 
+3, 138, 193, 1, 145, 138, 1, 73, 134, 93, 129, 0, 1, 128, 1, 0, 
+1, 228, 64, 128, 1, 6, 129, 64, 0, 7, 65, 73, 2, 64, 1, 128, 
+1, 134, 129, 73, 0, 193, 193, 9, 0, 29, 129, 0, 2, 27, 65, 0, 
+0, 23, 64, 0, 128, 67, 1, 0, 0, 95, 1, 0, 1, 71, 1, 195, 
+0, 134, 1, 74, 0, 199, 1, 67, 1, 157, 129, 0, 1, 155, 1, 0, 
+0, 23, 64, 0, 128, 25, 64, 74, 3, 23, 0, 1, 128, 198, 129, 74, 
+0, 1, 194, 10, 0, 65, 2, 11, 0, 221, 65, 128, 1, 23, 0, 250, 
+127, 10, 64, 129, 134, 10, 128, 1, 137, 198, 65, 75, 0, 221, 65, 128, 
+0, 195, 1, 128, 0, 223, 1, 0, 1, 23, 64, 248, 127, 3, 1, 0, 
+0, 31, 1, 0, 1, 31, 0, 128, 0, 46, 0, 0, 0, 4, 15, 0, 
+0, 0, 0, 0, 0, 0, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 
+105, 110, 103, 115, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 119, 105, 
+100, 101, 115, 99, 114, 101, 101, 110, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 70, 111, 114, 109, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+67, 104, 101, 99, 107, 98, 111, 120, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 120, 50, 0, 3, 0, 0, 0, 0, 0, 128, 64, 64, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 121, 50, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 108, 97, 98, 101, 108, 0, 4, 23, 0, 0, 0, 0, 
+0, 0, 0, 69, 110, 97, 98, 108, 101, 32, 119, 105, 100, 101, 115, 99, 
+114, 101, 101, 110, 32, 109, 111, 100, 101, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 8, 0, 0, 0, 0, 0, 
+0, 0, 101, 110, 97, 98, 108, 101, 100, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 84, 101, 120, 116, 70, 105, 101, 108, 100, 0, 3, 0, 0, 
+0, 0, 0, 0, 8, 64, 3, 0, 0, 0, 0, 0, 128, 69, 64, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 115, 116, 114, 105, 110, 103, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 109, 97, 120, 119, 105, 100, 
+116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 105, 116, 108, 
+101, 0, 4, 26, 0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 105, 
+103, 117, 114, 101, 32, 87, 105, 100, 101, 115, 99, 114, 101, 101, 110, 32, 
+77, 111, 100, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 105, 
+100, 116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 114, 
+103, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 104, 101, 105, 103, 
+104, 116, 0, 3, 0, 0, 0, 0, 0, 0, 20, 64, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 115, 116, 114, 101, 116, 99, 104, 121, 0, 1, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 94, 67, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 99, 101, 108, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 69, 84, 
+85, 82, 78, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 
+102, 105, 114, 109, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 75, 69, 
+89, 95, 69, 78, 84, 69, 82, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 76, 97, 98, 101, 108, 0, 3, 0, 0, 0, 0, 0, 0, 64, 64, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 97, 108, 105, 103, 110, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 76, 101, 102, 116, 0, 4, 23, 0, 
+0, 0, 0, 0, 0, 0, 77, 97, 120, 105, 109, 117, 109, 32, 97, 108, 
+108, 111, 119, 101, 100, 32, 119, 105, 100, 116, 104, 58, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 4, 13, 0, 0, 0, 0, 
+0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 
+4, 53, 0, 0, 0, 0, 0, 0, 0, 83, 80, 65, 67, 69, 32, 116, 
+111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 84, 85, 82, 78, 
+32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 84, 82, 
+76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 116, 111, 110, 117, 109, 98, 101, 114, 0, 
+3, 0, 0, 0, 0, 0, 0, 52, 64, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 
+16, 0, 0, 0, 0, 0, 0, 0, 80, 97, 114, 97, 109, 101, 116, 101, 
+114, 32, 101, 114, 114, 111, 114, 0, 4, 61, 0, 0, 0, 0, 0, 0, 
+0, 84, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 119, 105, 100, 
+116, 104, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 118, 97, 108, 
+105, 100, 32, 110, 117, 109, 98, 101, 114, 32, 116, 104, 97, 116, 39, 115, 
+32, 97, 116, 32, 108, 101, 97, 115, 116, 32, 50, 48, 46, 0, 4, 19, 
+0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 71, 108, 111, 98, 97, 
+108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 
+};
+
+/* This is src/lua/addons/keymapoverride.lua */
+static const char file_37[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 6, 0, 0, 
+0, 11, 0, 0, 0, 101, 0, 0, 0, 8, 64, 0, 128, 101, 64, 0, 
+0, 8, 64, 128, 128, 31, 0, 128, 0, 2, 0, 0, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 79, 118, 101, 114, 114, 105, 100, 101, 75, 101, 
+121, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 67, 104, 101, 99, 107, 
+79, 118, 101, 114, 114, 105, 100, 101, 84, 97, 98, 108, 101, 0, 2, 0, 
+0, 0, 7, 0, 0, 0, 12, 0, 0, 0, 2, 0, 5, 9, 0, 0, 
+0, 91, 64, 0, 0, 23, 0, 1, 128, 134, 0, 64, 0, 193, 64, 0, 
+0, 0, 1, 0, 0, 214, 0, 129, 1, 157, 64, 0, 1, 72, 64, 0, 
+0, 31, 0, 128, 0, 2, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 101, 114, 114, 111, 114, 0, 4, 49, 0, 0, 0, 0, 0, 0, 
+0, 121, 111, 117, 32, 116, 114, 105, 101, 100, 32, 116, 111, 32, 109, 97, 
+112, 32, 115, 111, 109, 101, 116, 104, 105, 110, 103, 32, 73, 32, 100, 111, 
+110, 39, 116, 32, 114, 101, 99, 111, 103, 110, 105, 115, 101, 32, 116, 111, 
+32, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 14, 0, 0, 0, 16, 0, 0, 0, 1, 0, 2, 3, 0, 0, 
+0, 70, 0, 0, 0, 95, 0, 0, 1, 31, 0, 128, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/smartquotes.lua */
+static const char file_38[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 18, 0, 0, 
+0, 37, 0, 0, 0, 101, 64, 0, 0, 134, 0, 64, 0, 198, 64, 64, 
+0, 199, 128, 192, 1, 0, 1, 128, 0, 157, 64, 128, 1, 87, 192, 255, 
+127, 37, 128, 0, 0, 70, 0, 64, 0, 134, 64, 64, 0, 135, 192, 64, 
+1, 192, 0, 0, 0, 93, 64, 128, 1, 6, 0, 65, 0, 101, 192, 0, 
+0, 10, 64, 128, 130, 31, 0, 128, 0, 6, 0, 0, 0, 4, 17, 0, 
+0, 0, 0, 0, 0, 0, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 
+115, 116, 101, 110, 101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+69, 118, 101, 110, 116, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 87, 
+111, 114, 100, 77, 111, 100, 105, 102, 105, 101, 100, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 
+111, 110, 115, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 
+0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 
+117, 114, 101, 83, 109, 97, 114, 116, 81, 117, 111, 116, 101, 115, 0, 4, 
+0, 0, 0, 9, 0, 0, 0, 11, 0, 0, 0, 1, 0, 5, 6, 0, 
+0, 0, 76, 0, 64, 0, 193, 64, 0, 0, 1, 129, 0, 0, 93, 128, 
+0, 2, 95, 0, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 103, 115, 117, 98, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 37, 37, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 13, 0, 0, 0, 26, 0, 0, 0, 3, 0, 9, 53, 0, 0, 
+0, 198, 0, 64, 0, 199, 64, 192, 1, 199, 128, 192, 1, 219, 64, 0, 
+0, 23, 0, 0, 128, 203, 0, 0, 0, 7, 193, 192, 1, 27, 1, 0, 
+0, 23, 128, 10, 128, 7, 1, 65, 1, 7, 65, 65, 2, 7, 129, 65, 
+2, 88, 192, 65, 2, 23, 64, 9, 128, 7, 1, 194, 1, 27, 1, 0, 
+0, 23, 192, 3, 128, 7, 65, 66, 1, 12, 129, 66, 2, 129, 193, 2, 
+0, 197, 1, 128, 0, 7, 2, 195, 1, 221, 1, 0, 1, 29, 129, 0, 
+0, 138, 0, 129, 132, 7, 65, 66, 1, 12, 129, 66, 2, 129, 65, 3, 
+0, 197, 1, 128, 0, 7, 130, 195, 1, 221, 1, 0, 1, 29, 129, 0, 
+0, 138, 0, 129, 132, 7, 193, 195, 1, 27, 1, 0, 0, 23, 192, 3, 
+128, 7, 65, 66, 1, 12, 129, 66, 2, 129, 1, 4, 0, 197, 1, 128, 
+0, 7, 66, 196, 1, 221, 1, 0, 1, 29, 129, 0, 0, 138, 0, 129, 
+132, 7, 65, 66, 1, 12, 129, 66, 2, 129, 129, 4, 0, 197, 1, 128, 
+0, 7, 194, 196, 1, 221, 1, 0, 1, 29, 129, 0, 0, 138, 0, 129, 
+132, 31, 0, 128, 0, 20, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 111, 110, 115, 0, 4, 12, 
+0, 0, 0, 0, 0, 0, 0, 115, 109, 97, 114, 116, 113, 117, 111, 116, 
+101, 115, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 110, 111, 116, 105, 
+110, 114, 97, 119, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 112, 97, 
+114, 97, 103, 114, 97, 112, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 115, 116, 121, 108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+110, 97, 109, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 65, 
+87, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 100, 111, 117, 98, 108, 
+101, 113, 117, 111, 116, 101, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 119, 111, 114, 100, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 103, 
+115, 117, 98, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 94, 34, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 108, 101, 102, 116, 100, 111, 117, 
+98, 108, 101, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 34, 0, 4, 
+12, 0, 0, 0, 0, 0, 0, 0, 114, 105, 103, 104, 116, 100, 111, 117, 
+98, 108, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 105, 110, 
+103, 108, 101, 113, 117, 111, 116, 101, 115, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 94, 39, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 108, 
+101, 102, 116, 115, 105, 110, 103, 108, 101, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 39, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 114, 105, 
+103, 104, 116, 115, 105, 110, 103, 108, 101, 0, 0, 0, 0, 0, 2, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 45, 0, 
+0, 0, 0, 0, 2, 17, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 
+0, 70, 0, 64, 0, 71, 64, 192, 0, 71, 128, 192, 0, 91, 64, 0, 
+0, 23, 192, 1, 128, 75, 192, 1, 0, 74, 0, 193, 129, 74, 0, 193, 
+130, 74, 192, 65, 131, 74, 64, 66, 132, 74, 192, 66, 133, 74, 64, 67, 
+134, 74, 192, 67, 135, 10, 64, 0, 129, 31, 0, 128, 0, 16, 0, 0, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 
+100, 100, 111, 110, 115, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 115, 
+109, 97, 114, 116, 113, 117, 111, 116, 101, 115, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 100, 111, 117, 98, 108, 101, 113, 117, 111, 116, 101, 115, 
+0, 1, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 105, 110, 103, 
+108, 101, 113, 117, 111, 116, 101, 115, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 110, 111, 116, 105, 110, 114, 97, 119, 0, 1, 1, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 108, 101, 102, 116, 100, 111, 117, 98, 108, 101, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 156, 0, 4, 12, 
+0, 0, 0, 0, 0, 0, 0, 114, 105, 103, 104, 116, 100, 111, 117, 98, 
+108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 157, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 108, 101, 102, 116, 115, 105, 110, 
+103, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 128, 152, 
+0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 114, 105, 103, 104, 116, 115, 
+105, 110, 103, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 226, 
+128, 153, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 53, 0, 0, 0, 193, 0, 0, 0, 0, 0, 25, 216, 0, 0, 0, 
+6, 0, 64, 0, 7, 64, 64, 0, 7, 128, 64, 0, 70, 192, 64, 0, 
+71, 0, 193, 0, 139, 128, 1, 0, 138, 128, 193, 130, 138, 128, 193, 131, 
+138, 64, 66, 132, 138, 128, 65, 133, 138, 0, 195, 133, 199, 128, 67, 0, 
+138, 192, 128, 134, 93, 128, 0, 1, 134, 192, 64, 0, 135, 0, 65, 1, 
+203, 128, 1, 0, 202, 128, 193, 130, 202, 192, 195, 131, 202, 64, 66, 132, 
+202, 192, 67, 133, 202, 0, 196, 133, 7, 65, 68, 0, 202, 0, 129, 134, 
+157, 128, 0, 1, 198, 192, 64, 0, 199, 128, 196, 1, 11, 65, 1, 0, 
+10, 193, 196, 130, 10, 1, 197, 131, 10, 65, 69, 132, 10, 1, 69, 133, 
+70, 129, 69, 0, 135, 193, 69, 0, 93, 129, 0, 1, 10, 65, 129, 134, 
+221, 128, 0, 1, 6, 193, 64, 0, 7, 129, 68, 2, 75, 65, 1, 0, 
+74, 1, 198, 130, 74, 1, 197, 131, 74, 65, 70, 132, 74, 1, 69, 133, 
+134, 129, 69, 0, 199, 129, 70, 0, 157, 129, 0, 1, 74, 129, 129, 134, 
+29, 129, 0, 1, 70, 193, 64, 0, 71, 129, 196, 2, 139, 65, 1, 0, 
+138, 193, 196, 130, 138, 193, 198, 131, 138, 65, 69, 132, 138, 193, 70, 133, 
+198, 129, 69, 0, 7, 2, 71, 0, 221, 129, 0, 1, 138, 193, 129, 134, 
+93, 129, 0, 1, 134, 193, 64, 0, 135, 129, 68, 3, 203, 65, 1, 0, 
+202, 1, 198, 130, 202, 193, 198, 131, 202, 65, 70, 132, 202, 193, 70, 133, 
+6, 130, 69, 0, 71, 66, 71, 0, 29, 130, 0, 1, 202, 1, 130, 134, 
+157, 129, 0, 1, 198, 193, 64, 0, 199, 1, 193, 3, 11, 130, 1, 0, 
+10, 130, 193, 130, 10, 130, 199, 131, 10, 66, 66, 132, 10, 130, 65, 133, 
+10, 194, 199, 133, 71, 2, 72, 0, 10, 66, 130, 134, 221, 129, 0, 1, 
+11, 194, 129, 6, 10, 130, 200, 144, 70, 194, 64, 0, 71, 2, 201, 4, 
+10, 66, 130, 145, 10, 130, 201, 146, 10, 2, 202, 147, 10, 130, 202, 148, 
+10, 2, 203, 149, 10, 2, 203, 150, 64, 2, 128, 0, 128, 2, 0, 1, 
+192, 2, 128, 1, 0, 3, 0, 2, 64, 3, 128, 2, 128, 3, 0, 3, 
+192, 3, 128, 3, 6, 196, 64, 0, 7, 132, 75, 8, 75, 132, 1, 0, 
+74, 132, 193, 130, 74, 4, 197, 131, 74, 196, 75, 132, 74, 4, 69, 133, 
+134, 196, 64, 0, 135, 68, 76, 9, 74, 132, 4, 152, 74, 132, 204, 134, 
+29, 132, 0, 1, 70, 196, 64, 0, 71, 132, 203, 8, 139, 132, 1, 0, 
+138, 68, 194, 130, 138, 4, 197, 131, 138, 196, 76, 132, 138, 4, 69, 133, 
+198, 196, 64, 0, 199, 68, 204, 9, 138, 196, 4, 152, 138, 4, 205, 134, 
+93, 132, 0, 1, 134, 196, 64, 0, 135, 132, 75, 9, 203, 132, 1, 0, 
+202, 68, 205, 130, 202, 4, 197, 131, 202, 132, 77, 132, 202, 4, 69, 133, 
+6, 197, 64, 0, 7, 69, 76, 10, 202, 4, 5, 152, 202, 196, 205, 134, 
+157, 132, 0, 1, 198, 196, 64, 0, 199, 132, 203, 9, 11, 133, 1, 0, 
+10, 133, 193, 130, 10, 197, 198, 131, 10, 197, 75, 132, 10, 197, 70, 133, 
+70, 197, 64, 0, 71, 69, 204, 10, 10, 69, 5, 152, 10, 5, 206, 134, 
+221, 132, 0, 1, 6, 197, 64, 0, 7, 133, 75, 10, 75, 133, 1, 0, 
+74, 69, 194, 130, 74, 197, 198, 131, 74, 197, 76, 132, 74, 197, 70, 133, 
+134, 197, 64, 0, 135, 69, 76, 11, 74, 133, 5, 152, 74, 5, 205, 134, 
+29, 133, 0, 1, 70, 197, 64, 0, 71, 133, 203, 10, 139, 133, 1, 0, 
+138, 69, 205, 130, 138, 197, 198, 131, 138, 133, 77, 132, 138, 197, 70, 133, 
+198, 197, 64, 0, 199, 69, 204, 11, 138, 197, 5, 152, 138, 197, 205, 134, 
+93, 133, 0, 1, 134, 197, 64, 0, 135, 133, 75, 11, 203, 133, 1, 0, 
+202, 133, 193, 130, 202, 69, 206, 131, 202, 133, 78, 132, 202, 69, 78, 133, 
+6, 198, 64, 0, 7, 198, 78, 12, 202, 5, 6, 152, 202, 5, 207, 134, 
+157, 5, 0, 1, 36, 66, 0, 0, 70, 194, 64, 0, 71, 66, 207, 4, 
+128, 2, 0, 4, 198, 130, 79, 0, 1, 195, 15, 0, 93, 130, 0, 2, 
+91, 66, 0, 0, 23, 64, 0, 128, 131, 2, 0, 0, 159, 2, 0, 1, 
+135, 66, 195, 0, 10, 128, 2, 135, 135, 66, 67, 1, 10, 128, 130, 136, 
+135, 66, 195, 1, 10, 128, 130, 139, 135, 66, 67, 2, 10, 128, 2, 141, 
+135, 66, 195, 2, 10, 128, 2, 142, 135, 66, 67, 3, 10, 128, 130, 142, 
+135, 66, 195, 3, 10, 128, 2, 160, 134, 2, 64, 0, 140, 66, 80, 5, 
+157, 66, 0, 1, 131, 2, 128, 0, 159, 2, 0, 1, 31, 0, 128, 0, 
+66, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 97, 100, 100, 111, 110, 115, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 115, 109, 97, 114, 116, 113, 117, 111, 116, 101, 115, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 67, 104, 101, 99, 107, 98, 111, 120, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 
+0, 240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 120, 50, 0, 3, 0, 0, 0, 0, 
+0, 0, 67, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 50, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 97, 98, 101, 108, 0, 4, 
+36, 0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 118, 101, 114, 116, 32, 
+115, 105, 110, 103, 108, 101, 32, 113, 117, 111, 116, 101, 115, 32, 119, 104, 
+105, 108, 101, 32, 116, 121, 112, 105, 110, 103, 58, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 118, 97, 108, 117, 101, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 115, 105, 110, 103, 108, 101, 113, 117, 111, 116, 101, 115, 
+0, 3, 0, 0, 0, 0, 0, 0, 8, 64, 4, 36, 0, 0, 0, 0, 
+0, 0, 0, 67, 111, 110, 118, 101, 114, 116, 32, 100, 111, 117, 98, 108, 
+101, 32, 113, 117, 111, 116, 101, 115, 32, 119, 104, 105, 108, 101, 32, 116, 
+121, 112, 105, 110, 103, 58, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+100, 111, 117, 98, 108, 101, 113, 117, 111, 116, 101, 115, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 84, 101, 120, 116, 70, 105, 101, 108, 100, 0, 
+3, 0, 0, 0, 0, 0, 128, 68, 64, 3, 0, 0, 0, 0, 0, 0, 
+20, 64, 3, 0, 0, 0, 0, 0, 0, 71, 64, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 116, 111, 115, 116, 114, 105, 110, 103, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 108, 101, 102, 116, 115, 105, 110, 103, 108, 101, 
+0, 3, 0, 0, 0, 0, 0, 128, 73, 64, 3, 0, 0, 0, 0, 0, 
+0, 76, 64, 4, 12, 0, 0, 0, 0, 0, 0, 0, 114, 105, 103, 104, 
+116, 115, 105, 110, 103, 108, 101, 0, 3, 0, 0, 0, 0, 0, 0, 28, 
+64, 4, 11, 0, 0, 0, 0, 0, 0, 0, 108, 101, 102, 116, 100, 111, 
+117, 98, 108, 101, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 114, 105, 
+103, 104, 116, 100, 111, 117, 98, 108, 101, 0, 3, 0, 0, 0, 0, 0, 
+0, 34, 64, 4, 33, 0, 0, 0, 0, 0, 0, 0, 68, 111, 110, 39, 
+116, 32, 99, 111, 110, 118, 101, 114, 116, 32, 105, 110, 32, 82, 65, 87, 
+32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 115, 58, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 110, 111, 116, 105, 110, 114, 97, 119, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 116, 105, 116, 108, 101, 0, 4, 23, 
+0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 
+32, 83, 109, 97, 114, 116, 32, 81, 117, 111, 116, 101, 115, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 119, 105, 100, 116, 104, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 76, 97, 114, 103, 101, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 104, 101, 105, 103, 104, 116, 0, 3, 0, 0, 0, 
+0, 0, 0, 42, 64, 4, 9, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+114, 101, 116, 99, 104, 121, 0, 1, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 75, 69, 89, 95, 94, 67, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 99, 97, 110, 99, 101, 108, 0, 4, 11, 0, 0, 0, 0, 0, 
+0, 0, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 0, 4, 8, 0, 
+0, 0, 0, 0, 0, 0, 99, 111, 110, 102, 105, 114, 109, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 69, 78, 84, 69, 82, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 97, 98, 101, 108, 0, 
+3, 0, 0, 0, 0, 0, 0, 64, 64, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 97, 108, 105, 103, 110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 76, 101, 102, 116, 0, 4, 29, 0, 0, 0, 0, 0, 0, 0, 84, 
+101, 120, 116, 32, 117, 115, 101, 100, 32, 102, 111, 114, 32, 115, 105, 110, 
+103, 108, 101, 32, 113, 117, 111, 116, 101, 115, 58, 0, 3, 0, 0, 0, 
+0, 0, 128, 67, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 76, 58, 
+0, 3, 0, 0, 0, 0, 0, 0, 72, 64, 3, 0, 0, 0, 0, 0, 
+128, 72, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 82, 58, 0, 4, 
+29, 0, 0, 0, 0, 0, 0, 0, 84, 101, 120, 116, 32, 117, 115, 101, 
+100, 32, 102, 111, 114, 32, 100, 111, 117, 98, 108, 101, 32, 113, 117, 111, 
+116, 101, 115, 58, 0, 3, 0, 0, 0, 0, 0, 0, 38, 64, 3, 0, 
+0, 0, 0, 0, 0, 240, 191, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+67, 101, 110, 116, 114, 101, 0, 4, 51, 0, 0, 0, 0, 0, 0, 0, 
+84, 111, 32, 97, 112, 112, 108, 121, 32, 116, 111, 32, 101, 120, 105, 115, 
+116, 105, 110, 103, 32, 116, 101, 120, 116, 44, 32, 99, 111, 112, 121, 32, 
+97, 110, 100, 32, 116, 104, 101, 110, 32, 112, 97, 115, 116, 101, 32, 105, 
+116, 46, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 
+99, 114, 101, 101, 110, 0, 4, 53, 0, 0, 0, 0, 0, 0, 0, 83, 
+80, 65, 67, 69, 32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 
+82, 69, 84, 85, 82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 
+109, 44, 32, 67, 84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 
+99, 101, 108, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 110, 111, 116, 
+105, 110, 114, 97, 119, 113, 117, 111, 116, 101, 115, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 116, 111, 117, 99, 104, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 
+};
+
+/* This is src/lua/addons/undo.lua */
+static const char file_39[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 8, 16, 0, 0, 
+0, 1, 0, 0, 0, 101, 0, 0, 0, 165, 64, 0, 0, 229, 128, 0, 
+0, 37, 193, 0, 0, 101, 1, 1, 0, 134, 65, 64, 0, 229, 65, 1, 
+0, 138, 193, 1, 129, 134, 65, 64, 0, 229, 129, 1, 0, 138, 193, 129, 
+129, 134, 65, 64, 0, 229, 193, 1, 0, 138, 193, 1, 130, 31, 0, 128, 
+0, 5, 0, 0, 0, 3, 0, 0, 0, 0, 0, 64, 127, 64, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 67, 104, 101, 99, 107, 112, 111, 105, 110, 116, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 85, 110, 100, 111, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 82, 101, 100, 111, 0, 8, 0, 0, 0, 7, 
+0, 0, 0, 19, 0, 0, 0, 2, 0, 8, 20, 0, 0, 0, 149, 0, 
+0, 0, 213, 0, 128, 0, 88, 192, 0, 1, 23, 64, 0, 128, 131, 0, 
+0, 0, 159, 0, 0, 1, 129, 0, 0, 0, 213, 0, 0, 0, 1, 1, 
+0, 0, 161, 64, 1, 128, 135, 65, 1, 0, 199, 65, 129, 0, 88, 192, 
+1, 3, 23, 64, 0, 128, 131, 1, 0, 0, 159, 1, 0, 1, 160, 0, 
+254, 127, 131, 0, 128, 0, 159, 0, 0, 1, 31, 0, 128, 0, 1, 0, 
+0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 27, 0, 0, 0, 1, 
+0, 8, 10, 0, 0, 0, 75, 0, 0, 0, 134, 0, 64, 0, 192, 0, 
+0, 0, 157, 0, 1, 1, 23, 0, 0, 128, 74, 128, 129, 2, 162, 128, 
+0, 0, 35, 1, 255, 127, 95, 0, 0, 1, 31, 0, 128, 0, 1, 0, 
+0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 
+115, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+29, 0, 0, 0, 33, 0, 0, 0, 0, 0, 4, 14, 0, 0, 0, 5, 
+0, 0, 0, 70, 0, 192, 0, 29, 128, 0, 1, 70, 0, 192, 0, 71, 
+64, 192, 0, 134, 0, 192, 0, 135, 128, 64, 1, 198, 0, 192, 0, 199, 
+192, 192, 1, 10, 192, 128, 129, 10, 128, 0, 129, 10, 64, 128, 128, 31, 
+0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 
+0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 35, 0, 0, 0, 47, 0, 0, 0, 1, 0, 8, 35, 0, 0, 0, 
+70, 0, 64, 0, 85, 0, 128, 0, 129, 64, 0, 0, 213, 0, 0, 0, 
+1, 65, 0, 0, 161, 128, 0, 128, 134, 1, 64, 0, 199, 65, 1, 0, 
+138, 193, 129, 2, 160, 192, 254, 127, 149, 0, 0, 0, 141, 64, 64, 1, 
+192, 0, 128, 0, 1, 65, 0, 0, 161, 64, 0, 128, 134, 1, 64, 0, 
+138, 129, 192, 2, 160, 0, 255, 127, 134, 0, 64, 0, 198, 0, 64, 0, 
+6, 1, 64, 0, 71, 193, 64, 0, 135, 1, 65, 0, 199, 65, 65, 0, 
+10, 193, 129, 130, 202, 128, 1, 130, 138, 64, 129, 129, 134, 0, 64, 0, 
+138, 128, 64, 131, 134, 0, 64, 0, 140, 192, 65, 1, 157, 64, 0, 1, 
+134, 0, 66, 0, 157, 64, 128, 0, 31, 0, 128, 0, 9, 0, 0, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 99, 112, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 99, 119, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 99, 111, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 112, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 112, 117, 114, 103, 101, 0, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 0, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 
+0, 0, 60, 0, 0, 0, 2, 0, 7, 23, 0, 0, 0, 135, 0, 64, 
+0, 155, 64, 0, 0, 23, 64, 0, 128, 195, 0, 0, 0, 223, 0, 0, 
+1, 198, 64, 64, 0, 199, 128, 192, 1, 0, 1, 0, 0, 65, 1, 0, 
+0, 221, 64, 128, 1, 198, 64, 64, 0, 199, 192, 192, 1, 0, 1, 128, 
+0, 65, 1, 0, 0, 133, 1, 128, 0, 157, 1, 128, 0, 221, 64, 0, 
+0, 197, 0, 0, 1, 0, 1, 0, 1, 221, 64, 0, 1, 195, 0, 128, 
+0, 223, 0, 0, 1, 31, 0, 128, 0, 4, 0, 0, 0, 3, 0, 0, 
+0, 0, 0, 0, 240, 63, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 
+97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 114, 101, 
+109, 111, 118, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 110, 
+115, 101, 114, 116, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 
+3, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 80, 0, 0, 0, 0, 
+0, 7, 32, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 27, 64, 
+0, 0, 23, 0, 0, 128, 11, 0, 0, 0, 70, 0, 64, 0, 74, 0, 
+128, 128, 71, 128, 64, 0, 91, 0, 0, 0, 23, 64, 1, 128, 133, 0, 
+128, 0, 198, 0, 64, 0, 0, 1, 128, 0, 157, 128, 128, 1, 155, 64, 
+0, 0, 23, 0, 3, 128, 133, 0, 0, 1, 157, 128, 128, 0, 198, 192, 
+64, 0, 199, 0, 193, 1, 0, 1, 0, 0, 65, 129, 0, 0, 128, 1, 
+0, 1, 221, 64, 0, 2, 197, 0, 128, 1, 10, 64, 193, 1, 198, 0, 
+64, 0, 11, 1, 0, 0, 202, 0, 1, 131, 131, 0, 128, 0, 159, 0, 
+0, 1, 31, 0, 128, 0, 7, 0, 0, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 11, 0, 0, 
+0, 0, 0, 0, 0, 95, 117, 110, 100, 111, 115, 116, 97, 99, 107, 0, 
+3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 116, 97, 98, 108, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 105, 110, 115, 101, 114, 116, 0, 0, 4, 11, 0, 0, 0, 0, 0, 
+0, 0, 95, 114, 101, 100, 111, 115, 116, 97, 99, 107, 0, 0, 0, 0, 
+0, 4, 0, 0, 0, 0, 0, 1, 1, 1, 3, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 85, 0, 0, 0, 94, 0, 0, 0, 0, 0, 4, 38, 0, 0, 0, 
+6, 0, 64, 0, 70, 0, 64, 0, 71, 64, 192, 0, 91, 64, 0, 0, 
+23, 0, 0, 128, 75, 0, 0, 0, 10, 64, 128, 128, 6, 0, 64, 0, 
+70, 0, 64, 0, 71, 128, 192, 0, 91, 64, 0, 0, 23, 0, 0, 128, 
+75, 0, 0, 0, 10, 64, 0, 129, 5, 0, 128, 0, 70, 0, 64, 0, 
+71, 64, 192, 0, 134, 0, 64, 0, 135, 128, 64, 1, 29, 128, 128, 1, 
+27, 64, 0, 0, 23, 0, 1, 128, 6, 192, 64, 0, 65, 0, 1, 0, 
+29, 64, 0, 1, 3, 0, 0, 0, 31, 0, 0, 1, 6, 192, 64, 0, 
+65, 64, 1, 0, 134, 0, 64, 0, 135, 64, 64, 1, 149, 0, 0, 1, 
+193, 128, 1, 0, 86, 192, 128, 0, 29, 64, 0, 1, 3, 0, 128, 0, 
+31, 0, 0, 1, 31, 0, 128, 0, 7, 0, 0, 0, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 11, 
+0, 0, 0, 0, 0, 0, 0, 95, 117, 110, 100, 111, 115, 116, 97, 99, 
+107, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 95, 114, 101, 100, 111, 
+115, 116, 97, 99, 107, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 78, 
+111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 
+21, 0, 0, 0, 0, 0, 0, 0, 78, 111, 116, 104, 105, 110, 103, 32, 
+108, 101, 102, 116, 32, 116, 111, 32, 117, 110, 100, 111, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 85, 110, 100, 111, 110, 101, 32, 40, 0, 4, 
+22, 0, 0, 0, 0, 0, 0, 0, 32, 108, 101, 102, 116, 32, 105, 110, 
+32, 117, 110, 100, 111, 32, 98, 117, 102, 102, 101, 114, 41, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 0, 0, 1, 5, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 
+0, 0, 108, 0, 0, 0, 0, 0, 4, 38, 0, 0, 0, 6, 0, 64, 
+0, 70, 0, 64, 0, 71, 64, 192, 0, 91, 64, 0, 0, 23, 0, 0, 
+128, 75, 0, 0, 0, 10, 64, 128, 128, 6, 0, 64, 0, 70, 0, 64, 
+0, 71, 128, 192, 0, 91, 64, 0, 0, 23, 0, 0, 128, 75, 0, 0, 
+0, 10, 64, 0, 129, 5, 0, 128, 0, 70, 0, 64, 0, 71, 128, 192, 
+0, 134, 0, 64, 0, 135, 64, 64, 1, 29, 128, 128, 1, 27, 64, 0, 
+0, 23, 0, 1, 128, 6, 192, 64, 0, 65, 0, 1, 0, 29, 64, 0, 
+1, 3, 0, 0, 0, 31, 0, 0, 1, 6, 192, 64, 0, 65, 64, 1, 
+0, 134, 0, 64, 0, 135, 128, 64, 1, 149, 0, 0, 1, 193, 128, 1, 
+0, 86, 192, 128, 0, 29, 64, 0, 1, 3, 0, 128, 0, 31, 0, 0, 
+1, 31, 0, 128, 0, 7, 0, 0, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 95, 117, 110, 100, 111, 115, 116, 97, 99, 107, 0, 4, 
+11, 0, 0, 0, 0, 0, 0, 0, 95, 114, 101, 100, 111, 115, 116, 97, 
+99, 107, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 109, 
+111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 21, 0, 0, 
+0, 0, 0, 0, 0, 78, 111, 116, 104, 105, 110, 103, 32, 108, 101, 102, 
+116, 32, 116, 111, 32, 114, 101, 100, 111, 0, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 82, 101, 100, 111, 110, 101, 32, 40, 0, 4, 22, 0, 0, 
+0, 0, 0, 0, 0, 32, 108, 101, 102, 116, 32, 105, 110, 32, 114, 101, 
+100, 111, 32, 98, 117, 102, 102, 101, 114, 41, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 0, 0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/spillchocker.lua */
+static const char file_40[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 10, 0, 0, 
+0, 37, 0, 0, 0, 70, 0, 64, 0, 134, 64, 64, 0, 135, 128, 64, 
+1, 192, 0, 0, 0, 93, 64, 128, 1, 6, 192, 64, 0, 101, 64, 0, 
+0, 10, 64, 0, 130, 31, 0, 128, 0, 5, 0, 0, 0, 4, 17, 0, 
+0, 0, 0, 0, 0, 0, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 
+115, 116, 101, 110, 101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+69, 118, 101, 110, 116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 82, 
+101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 22, 0, 0, 0, 
+0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 83, 112, 101, 
+108, 108, 99, 104, 101, 99, 107, 101, 114, 0, 2, 0, 0, 0, 9, 0, 
+0, 0, 13, 0, 0, 0, 0, 0, 2, 11, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 70, 0, 64, 0, 71, 64, 192, 0, 71, 128, 192, 
+0, 91, 64, 0, 0, 23, 64, 0, 128, 75, 64, 0, 0, 74, 0, 193, 
+129, 10, 64, 0, 129, 31, 0, 128, 0, 5, 0, 0, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 
+116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 97, 100, 100, 111, 110, 
+115, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 115, 112, 101, 108, 108, 
+99, 104, 101, 99, 107, 101, 114, 0, 4, 10, 0, 0, 0, 0, 0, 0, 
+0, 104, 105, 103, 104, 108, 105, 103, 104, 116, 0, 1, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 61, 
+0, 0, 0, 0, 0, 7, 53, 0, 0, 0, 6, 0, 64, 0, 7, 64, 
+64, 0, 7, 128, 64, 0, 70, 192, 64, 0, 71, 0, 193, 0, 139, 128, 
+1, 0, 138, 128, 193, 130, 138, 128, 193, 131, 138, 64, 66, 132, 138, 128, 
+65, 133, 138, 0, 195, 133, 199, 128, 67, 0, 138, 192, 128, 134, 93, 128, 
+0, 1, 139, 192, 129, 0, 138, 0, 196, 135, 198, 192, 64, 0, 199, 128, 
+196, 1, 138, 192, 128, 136, 138, 0, 197, 137, 138, 128, 197, 138, 138, 0, 
+198, 139, 138, 128, 198, 140, 138, 128, 198, 141, 192, 0, 128, 0, 6, 193, 
+64, 0, 7, 1, 71, 2, 75, 129, 1, 0, 74, 129, 193, 130, 74, 129, 
+193, 131, 74, 65, 71, 132, 74, 129, 65, 133, 134, 193, 64, 0, 135, 193, 
+71, 3, 74, 129, 1, 143, 74, 1, 200, 134, 29, 1, 0, 1, 164, 64, 
+0, 0, 198, 192, 64, 0, 199, 64, 200, 1, 0, 1, 0, 1, 70, 129, 
+72, 0, 129, 193, 8, 0, 221, 128, 0, 2, 219, 64, 0, 0, 23, 64, 
+0, 128, 3, 1, 0, 0, 31, 1, 0, 1, 7, 65, 195, 0, 10, 0, 
+1, 146, 3, 1, 128, 0, 31, 1, 0, 1, 31, 0, 128, 0, 37, 0, 
+0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+97, 100, 100, 111, 110, 115, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+115, 112, 101, 108, 108, 99, 104, 101, 99, 107, 101, 114, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 70, 111, 114, 109, 0, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 67, 104, 101, 99, 107, 98, 111, 120, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 120, 49, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 49, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 120, 50, 0, 3, 0, 0, 0, 0, 0, 
+128, 64, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 121, 50, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 108, 97, 98, 101, 108, 0, 4, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 118, 97, 108, 117, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+101, 110, 97, 98, 108, 101, 100, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 116, 105, 116, 108, 101, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 
+67, 111, 110, 102, 105, 103, 117, 114, 101, 32, 83, 112, 101, 108, 108, 99, 
+104, 101, 99, 107, 101, 114, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+119, 105, 100, 116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 76, 
+97, 114, 103, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 104, 101, 
+105, 103, 104, 116, 0, 3, 0, 0, 0, 0, 0, 0, 20, 64, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 101, 116, 99, 104, 121, 0, 
+1, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 94, 
+67, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 99, 97, 110, 99, 101, 
+108, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 
+69, 84, 85, 82, 78, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 99, 
+111, 110, 102, 105, 114, 109, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+75, 69, 89, 95, 69, 78, 84, 69, 82, 0, 4, 6, 0, 0, 0, 0, 
+0, 0, 0, 76, 97, 98, 101, 108, 0, 3, 0, 0, 0, 0, 0, 0, 
+64, 64, 4, 6, 0, 0, 0, 0, 0, 0, 0, 97, 108, 105, 103, 110, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 76, 101, 102, 116, 0, 4, 
+24, 0, 0, 0, 0, 0, 0, 0, 68, 105, 115, 112, 108, 97, 121, 32, 
+109, 105, 115, 115, 112, 101, 108, 116, 32, 119, 111, 114, 100, 115, 58, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 
+101, 110, 0, 4, 53, 0, 0, 0, 0, 0, 0, 0, 83, 80, 65, 67, 
+69, 32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 84, 
+85, 82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 
+67, 84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 104, 105, 103, 104, 108, 105, 
+103, 104, 116, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/menu.lua */
+static const char file_41[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 71, 253, 3, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 134, 128, 64, 0, 135, 0, 65, 1, 198, 128, 64, 0, 199, 64, 193, 
+1, 6, 129, 64, 0, 7, 129, 65, 2, 70, 129, 64, 0, 71, 193, 193, 
+2, 134, 129, 64, 0, 135, 1, 66, 3, 198, 129, 64, 0, 199, 65, 194, 
+3, 6, 130, 64, 0, 7, 130, 66, 4, 70, 130, 64, 0, 71, 194, 194, 
+4, 139, 2, 0, 0, 203, 2, 0, 0, 11, 3, 0, 0, 101, 3, 0, 
+0, 165, 67, 0, 0, 192, 3, 128, 6, 1, 4, 3, 0, 75, 4, 0, 
+0, 221, 131, 128, 1, 0, 4, 128, 6, 65, 68, 3, 0, 139, 4, 0, 
+0, 29, 132, 128, 1, 70, 132, 67, 0, 71, 196, 195, 8, 128, 4, 128, 
+6, 193, 4, 4, 0, 11, 5, 128, 1, 75, 5, 128, 2, 129, 69, 4, 
+0, 193, 133, 4, 0, 1, 198, 4, 0, 68, 6, 0, 0, 134, 134, 67, 
+0, 135, 6, 69, 13, 100, 69, 128, 2, 139, 5, 128, 2, 193, 69, 5, 
+0, 1, 134, 5, 0, 65, 198, 5, 0, 132, 6, 0, 0, 198, 134, 67, 
+0, 199, 6, 198, 13, 164, 69, 128, 2, 203, 5, 128, 2, 1, 70, 6, 
+0, 65, 134, 6, 0, 129, 198, 6, 0, 196, 6, 0, 0, 6, 135, 67, 
+0, 7, 7, 71, 14, 228, 69, 128, 2, 36, 69, 128, 1, 157, 132, 128, 
+1, 192, 4, 128, 6, 1, 69, 7, 0, 75, 5, 128, 2, 139, 5, 128, 
+2, 193, 133, 7, 0, 1, 134, 4, 0, 65, 198, 7, 0, 132, 6, 0, 
+0, 198, 134, 67, 0, 199, 6, 200, 13, 164, 69, 128, 2, 203, 5, 128, 
+2, 1, 70, 8, 0, 65, 134, 5, 0, 129, 134, 8, 0, 196, 6, 0, 
+0, 6, 135, 67, 0, 7, 199, 72, 14, 228, 69, 128, 2, 11, 6, 128, 
+2, 65, 6, 9, 0, 129, 134, 6, 0, 193, 70, 9, 0, 4, 7, 0, 
+0, 70, 135, 67, 0, 71, 135, 201, 14, 36, 70, 128, 2, 75, 6, 128, 
+2, 129, 198, 9, 0, 193, 6, 10, 0, 1, 71, 10, 0, 68, 7, 0, 
+0, 134, 135, 67, 0, 135, 135, 74, 15, 100, 70, 128, 2, 139, 6, 128, 
+2, 193, 198, 10, 0, 1, 7, 11, 0, 65, 71, 11, 0, 132, 7, 0, 
+0, 198, 135, 67, 0, 199, 135, 203, 15, 164, 70, 128, 2, 100, 69, 128, 
+2, 221, 132, 128, 1, 0, 5, 128, 6, 65, 197, 11, 0, 139, 5, 0, 
+3, 203, 5, 128, 2, 1, 6, 12, 0, 65, 70, 12, 0, 129, 134, 12, 
+0, 196, 6, 0, 0, 6, 135, 67, 0, 7, 199, 76, 14, 228, 69, 128, 
+2, 11, 6, 128, 2, 65, 6, 13, 0, 129, 70, 13, 0, 193, 134, 13, 
+0, 4, 7, 0, 0, 70, 135, 67, 0, 71, 199, 205, 14, 36, 70, 128, 
+2, 75, 6, 128, 2, 129, 6, 14, 0, 193, 134, 5, 0, 1, 71, 14, 
+0, 68, 7, 0, 0, 134, 135, 67, 0, 135, 135, 78, 15, 100, 70, 128, 
+2, 139, 6, 128, 2, 193, 198, 14, 0, 1, 7, 15, 0, 65, 71, 15, 
+0, 132, 7, 0, 0, 198, 135, 67, 0, 199, 135, 207, 15, 164, 70, 128, 
+2, 203, 6, 128, 2, 1, 199, 15, 0, 65, 7, 16, 0, 129, 71, 16, 
+0, 196, 7, 0, 0, 6, 136, 67, 0, 7, 136, 80, 16, 228, 70, 128, 
+2, 11, 7, 128, 2, 65, 199, 16, 0, 129, 7, 17, 0, 193, 71, 17, 
+0, 4, 8, 0, 0, 70, 136, 67, 0, 71, 136, 209, 16, 36, 71, 128, 
+2, 164, 69, 0, 3, 29, 133, 128, 1, 64, 5, 128, 6, 129, 197, 17, 
+0, 203, 5, 0, 2, 11, 6, 128, 2, 65, 6, 18, 0, 129, 70, 18, 
+0, 193, 134, 18, 0, 4, 7, 0, 0, 70, 135, 67, 0, 71, 199, 210, 
+14, 36, 70, 128, 2, 65, 6, 19, 0, 139, 6, 128, 2, 193, 70, 19, 
+0, 1, 135, 19, 0, 65, 199, 19, 0, 132, 7, 0, 0, 198, 135, 67, 
+0, 199, 7, 212, 15, 164, 70, 128, 2, 203, 6, 128, 2, 1, 71, 20, 
+0, 65, 135, 20, 0, 129, 199, 20, 0, 196, 7, 0, 0, 6, 136, 67, 
+0, 7, 8, 85, 16, 228, 70, 128, 2, 228, 69, 0, 2, 93, 133, 128, 
+1, 128, 5, 128, 6, 193, 69, 21, 0, 11, 6, 128, 7, 75, 6, 128, 
+2, 129, 134, 21, 0, 193, 198, 21, 0, 1, 7, 22, 0, 68, 7, 0, 
+0, 134, 135, 67, 0, 135, 71, 86, 15, 100, 70, 128, 2, 139, 6, 128, 
+2, 193, 134, 22, 0, 1, 135, 4, 0, 65, 199, 22, 0, 132, 7, 0, 
+0, 198, 135, 67, 0, 199, 7, 215, 15, 164, 70, 128, 2, 203, 6, 128, 
+2, 1, 71, 23, 0, 65, 71, 13, 0, 129, 135, 23, 0, 193, 199, 23, 
+0, 6, 136, 67, 0, 7, 8, 88, 16, 228, 70, 128, 2, 11, 7, 128, 
+2, 65, 71, 24, 0, 129, 71, 12, 0, 193, 135, 24, 0, 4, 8, 0, 
+0, 70, 136, 67, 0, 71, 200, 216, 16, 36, 71, 128, 2, 65, 7, 19, 
+0, 139, 7, 128, 2, 193, 7, 25, 0, 1, 72, 25, 0, 65, 136, 25, 
+0, 132, 8, 0, 0, 198, 136, 67, 0, 199, 200, 217, 17, 164, 71, 128, 
+2, 203, 7, 128, 2, 1, 8, 26, 0, 65, 72, 26, 0, 129, 136, 26, 
+0, 196, 8, 0, 0, 0, 9, 0, 9, 228, 71, 128, 2, 11, 8, 128, 
+2, 65, 200, 26, 0, 129, 8, 27, 0, 193, 72, 27, 0, 4, 9, 0, 
+0, 64, 9, 128, 9, 36, 72, 128, 2, 75, 8, 128, 2, 129, 136, 27, 
+0, 193, 136, 19, 0, 1, 201, 27, 0, 68, 9, 0, 0, 134, 137, 67, 
+0, 135, 9, 92, 19, 100, 72, 128, 2, 129, 8, 19, 0, 203, 8, 128, 
+2, 1, 73, 28, 0, 65, 137, 6, 0, 129, 137, 28, 0, 196, 9, 0, 
+0, 0, 10, 0, 10, 228, 72, 128, 2, 11, 9, 128, 2, 65, 201, 28, 
+0, 129, 9, 29, 0, 193, 73, 29, 0, 4, 10, 0, 0, 64, 10, 128, 
+10, 36, 73, 128, 2, 65, 9, 19, 0, 139, 9, 128, 2, 193, 137, 29, 
+0, 1, 202, 29, 0, 65, 10, 30, 0, 132, 10, 0, 0, 198, 138, 67, 
+0, 199, 74, 222, 21, 164, 73, 128, 2, 203, 9, 128, 2, 1, 138, 30, 
+0, 65, 202, 30, 0, 129, 10, 31, 0, 193, 74, 31, 0, 6, 139, 67, 
+0, 7, 139, 95, 22, 228, 73, 128, 2, 36, 70, 128, 7, 157, 133, 128, 
+1, 192, 5, 128, 6, 1, 198, 31, 0, 75, 6, 128, 1, 139, 6, 128, 
+2, 193, 6, 32, 0, 1, 135, 6, 0, 65, 71, 32, 0, 132, 7, 0, 
+0, 203, 7, 0, 1, 0, 8, 128, 8, 70, 136, 67, 0, 71, 136, 224, 
+16, 228, 71, 0, 1, 164, 70, 128, 2, 203, 6, 128, 2, 1, 199, 32, 
+0, 65, 7, 17, 0, 129, 7, 33, 0, 196, 7, 0, 0, 6, 136, 67, 
+0, 7, 72, 97, 16, 228, 70, 128, 2, 11, 7, 128, 2, 65, 135, 33, 
+0, 129, 7, 15, 0, 193, 199, 33, 0, 4, 8, 0, 0, 75, 8, 0, 
+1, 128, 8, 128, 8, 198, 136, 67, 0, 199, 8, 226, 17, 100, 72, 0, 
+1, 36, 71, 128, 2, 100, 70, 128, 1, 221, 133, 128, 1, 0, 6, 128, 
+6, 65, 70, 34, 0, 139, 6, 0, 7, 203, 6, 128, 2, 1, 135, 34, 
+0, 65, 135, 6, 0, 129, 199, 34, 0, 193, 7, 35, 0, 11, 8, 0, 
+1, 64, 8, 128, 8, 134, 136, 67, 0, 135, 200, 98, 17, 36, 72, 0, 
+1, 228, 70, 128, 2, 11, 7, 128, 2, 65, 71, 35, 0, 129, 7, 17, 
+0, 193, 135, 35, 0, 1, 200, 35, 0, 70, 136, 67, 0, 71, 136, 227, 
+16, 36, 71, 128, 2, 75, 7, 128, 2, 129, 7, 36, 0, 193, 7, 15, 
+0, 1, 72, 36, 0, 65, 136, 36, 0, 139, 8, 0, 1, 192, 8, 128, 
+8, 6, 137, 67, 0, 7, 73, 100, 18, 164, 72, 0, 1, 100, 71, 128, 
+2, 139, 7, 128, 2, 193, 199, 36, 0, 1, 136, 19, 0, 65, 8, 37, 
+0, 132, 8, 0, 0, 203, 8, 0, 1, 0, 9, 128, 8, 70, 137, 67, 
+0, 71, 9, 229, 18, 228, 72, 0, 1, 164, 71, 128, 2, 193, 7, 19, 
+0, 11, 8, 128, 2, 65, 72, 37, 0, 129, 136, 37, 0, 193, 200, 37, 
+0, 1, 9, 38, 0, 70, 137, 67, 0, 71, 201, 229, 18, 36, 72, 128, 
+2, 75, 8, 128, 2, 129, 72, 38, 0, 193, 8, 27, 0, 1, 137, 38, 
+0, 65, 201, 38, 0, 134, 137, 67, 0, 135, 137, 102, 19, 100, 72, 128, 
+2, 129, 8, 19, 0, 203, 8, 128, 2, 1, 9, 39, 0, 65, 9, 11, 
+0, 129, 73, 39, 0, 193, 137, 39, 0, 6, 138, 67, 0, 7, 202, 103, 
+20, 228, 72, 128, 2, 11, 9, 128, 2, 65, 9, 40, 0, 129, 201, 21, 
+0, 193, 73, 40, 0, 1, 138, 40, 0, 70, 138, 67, 0, 71, 202, 232, 
+20, 36, 73, 128, 2, 75, 9, 128, 2, 129, 9, 41, 0, 193, 137, 20, 
+0, 1, 74, 41, 0, 65, 138, 41, 0, 139, 10, 0, 1, 192, 10, 128, 
+8, 6, 139, 67, 0, 7, 203, 105, 22, 164, 74, 0, 1, 100, 73, 128, 
+2, 129, 9, 19, 0, 203, 9, 128, 2, 1, 10, 42, 0, 65, 10, 29, 
+0, 129, 74, 42, 0, 193, 138, 42, 0, 6, 139, 67, 0, 7, 203, 106, 
+22, 228, 73, 128, 2, 11, 10, 128, 2, 65, 10, 43, 0, 129, 74, 13, 
+0, 193, 74, 43, 0, 4, 11, 0, 0, 64, 11, 128, 11, 36, 74, 128, 
+2, 164, 70, 0, 7, 29, 134, 128, 1, 64, 6, 128, 6, 129, 134, 43, 
+0, 203, 6, 0, 2, 11, 7, 128, 2, 65, 199, 43, 0, 129, 135, 5, 
+0, 193, 7, 44, 0, 4, 8, 0, 0, 101, 136, 0, 0, 36, 71, 128, 
+2, 75, 7, 128, 2, 129, 71, 44, 0, 193, 71, 13, 0, 1, 136, 44, 
+0, 68, 8, 0, 0, 165, 200, 0, 0, 100, 71, 128, 2, 139, 7, 128, 
+2, 193, 199, 44, 0, 1, 200, 21, 0, 65, 8, 45, 0, 132, 8, 0, 
+0, 229, 8, 1, 0, 164, 71, 128, 2, 203, 7, 128, 2, 1, 72, 45, 
+0, 65, 72, 18, 0, 129, 136, 45, 0, 196, 8, 0, 0, 37, 73, 1, 
+0, 228, 71, 128, 2, 228, 70, 0, 2, 93, 134, 128, 1, 128, 6, 128, 
+6, 193, 198, 45, 0, 11, 7, 0, 4, 75, 7, 128, 2, 129, 7, 46, 
+0, 193, 71, 26, 0, 1, 72, 46, 0, 65, 136, 46, 0, 139, 8, 0, 
+1, 192, 8, 128, 8, 37, 137, 1, 0, 164, 72, 0, 1, 100, 71, 128, 
+2, 139, 7, 128, 2, 193, 199, 46, 0, 1, 136, 37, 0, 65, 8, 47, 
+0, 129, 72, 47, 0, 203, 8, 0, 1, 0, 9, 128, 8, 101, 201, 1, 
+0, 228, 72, 0, 1, 164, 71, 128, 2, 203, 7, 128, 2, 1, 136, 47, 
+0, 65, 72, 25, 0, 129, 200, 47, 0, 193, 8, 48, 0, 11, 9, 0, 
+1, 64, 9, 128, 8, 165, 9, 2, 0, 36, 73, 0, 1, 228, 71, 128, 
+2, 11, 8, 128, 2, 65, 72, 48, 0, 129, 136, 4, 0, 193, 136, 48, 
+0, 1, 201, 48, 0, 75, 9, 0, 1, 128, 9, 128, 8, 229, 73, 2, 
+0, 100, 73, 0, 1, 36, 72, 128, 2, 65, 8, 19, 0, 139, 8, 128, 
+2, 193, 8, 49, 0, 1, 9, 15, 0, 65, 73, 49, 0, 129, 137, 49, 
+0, 192, 9, 0, 8, 164, 72, 128, 2, 203, 8, 128, 2, 1, 201, 49, 
+0, 65, 9, 50, 0, 129, 73, 50, 0, 196, 9, 0, 0, 0, 10, 128, 
+12, 228, 72, 128, 2, 11, 9, 128, 2, 65, 137, 50, 0, 129, 73, 13, 
+0, 193, 201, 50, 0, 4, 10, 0, 0, 70, 138, 67, 0, 71, 10, 243, 
+20, 36, 73, 128, 2, 36, 71, 0, 4, 157, 134, 128, 1, 192, 6, 128, 
+6, 1, 71, 51, 0, 75, 7, 128, 12, 139, 7, 128, 2, 193, 135, 51, 
+0, 4, 8, 0, 0, 65, 200, 51, 0, 129, 8, 52, 0, 203, 8, 0, 
+1, 6, 137, 67, 0, 7, 73, 116, 18, 70, 137, 67, 0, 71, 137, 244, 
+18, 228, 72, 0, 1, 164, 71, 128, 2, 203, 7, 128, 2, 1, 200, 52, 
+0, 68, 8, 0, 0, 129, 8, 53, 0, 193, 72, 53, 0, 11, 9, 0, 
+1, 70, 137, 67, 0, 71, 73, 244, 18, 134, 137, 67, 0, 135, 137, 117, 
+19, 36, 73, 0, 1, 228, 71, 128, 2, 11, 8, 128, 2, 65, 200, 53, 
+0, 132, 8, 0, 0, 193, 8, 54, 0, 1, 73, 54, 0, 75, 9, 0, 
+1, 134, 137, 67, 0, 135, 73, 116, 19, 198, 137, 67, 0, 199, 137, 246, 
+19, 100, 73, 0, 1, 36, 72, 128, 2, 75, 8, 128, 2, 129, 200, 54, 
+0, 196, 8, 0, 0, 1, 9, 55, 0, 65, 73, 55, 0, 139, 9, 0, 
+1, 198, 137, 67, 0, 199, 73, 244, 19, 6, 138, 67, 0, 7, 138, 119, 
+20, 164, 73, 0, 1, 100, 72, 128, 2, 139, 8, 128, 2, 193, 200, 55, 
+0, 4, 9, 0, 0, 65, 9, 56, 0, 129, 73, 56, 0, 203, 9, 0, 
+1, 6, 138, 67, 0, 7, 138, 120, 20, 70, 138, 67, 0, 71, 138, 244, 
+20, 228, 73, 0, 1, 164, 72, 128, 2, 203, 8, 128, 2, 1, 201, 56, 
+0, 68, 9, 0, 0, 129, 9, 57, 0, 193, 73, 57, 0, 11, 10, 0, 
+1, 70, 138, 67, 0, 71, 138, 248, 20, 134, 138, 67, 0, 135, 138, 117, 
+21, 36, 74, 0, 1, 228, 72, 128, 2, 11, 9, 128, 2, 65, 137, 57, 
+0, 132, 9, 0, 0, 193, 201, 57, 0, 1, 10, 58, 0, 75, 10, 0, 
+1, 134, 138, 67, 0, 135, 138, 120, 21, 198, 138, 67, 0, 199, 138, 246, 
+21, 100, 74, 0, 1, 36, 73, 128, 2, 75, 9, 128, 2, 129, 73, 58, 
+0, 196, 9, 0, 0, 1, 138, 58, 0, 65, 202, 58, 0, 139, 10, 0, 
+1, 198, 138, 67, 0, 199, 138, 248, 21, 6, 139, 67, 0, 7, 139, 119, 
+22, 164, 74, 0, 1, 100, 73, 128, 2, 139, 9, 128, 2, 193, 9, 59, 
+0, 4, 10, 0, 0, 65, 74, 59, 0, 129, 138, 59, 0, 198, 138, 67, 
+0, 199, 202, 251, 21, 164, 73, 128, 2, 203, 9, 128, 2, 1, 10, 60, 
+0, 68, 10, 0, 0, 129, 74, 60, 0, 193, 138, 60, 0, 11, 11, 0, 
+1, 70, 139, 67, 0, 71, 75, 244, 22, 134, 139, 67, 0, 135, 203, 124, 
+23, 36, 75, 0, 1, 228, 73, 128, 2, 11, 10, 128, 2, 65, 10, 61, 
+0, 132, 10, 0, 0, 193, 74, 61, 0, 1, 139, 61, 0, 75, 11, 0, 
+1, 134, 139, 67, 0, 135, 75, 116, 23, 198, 139, 67, 0, 199, 203, 253, 
+23, 100, 75, 0, 1, 36, 74, 128, 2, 75, 10, 128, 2, 129, 10, 62, 
+0, 196, 10, 0, 0, 1, 75, 62, 0, 65, 139, 62, 0, 139, 11, 0, 
+1, 198, 139, 67, 0, 199, 75, 244, 23, 6, 140, 67, 0, 7, 204, 126, 
+24, 164, 75, 0, 1, 100, 74, 128, 2, 139, 10, 128, 2, 193, 10, 63, 
+0, 4, 11, 0, 0, 65, 75, 63, 0, 129, 139, 63, 0, 203, 11, 0, 
+1, 6, 140, 67, 0, 7, 76, 116, 24, 70, 140, 67, 0, 71, 204, 255, 
+24, 228, 75, 0, 1, 164, 74, 128, 2, 203, 10, 128, 2, 1, 11, 64, 
+0, 68, 11, 0, 0, 129, 75, 64, 0, 193, 139, 64, 0, 11, 12, 0, 
+1, 70, 140, 67, 0, 71, 140, 248, 24, 134, 140, 67, 0, 135, 204, 124, 
+25, 36, 76, 0, 1, 228, 74, 128, 2, 11, 11, 128, 2, 65, 203, 64, 
+0, 132, 11, 0, 0, 193, 11, 65, 0, 1, 76, 65, 0, 75, 12, 0, 
+1, 134, 140, 67, 0, 135, 140, 120, 25, 198, 140, 67, 0, 199, 204, 253, 
+25, 100, 76, 0, 1, 36, 75, 128, 2, 75, 11, 128, 2, 129, 139, 65, 
+0, 196, 11, 0, 0, 1, 204, 65, 0, 65, 12, 66, 0, 139, 12, 0, 
+1, 198, 140, 67, 0, 199, 140, 248, 25, 6, 141, 67, 0, 7, 205, 126, 
+26, 164, 76, 0, 1, 100, 75, 128, 2, 139, 11, 128, 2, 193, 75, 66, 
+0, 4, 12, 0, 0, 65, 140, 66, 0, 129, 204, 66, 0, 203, 12, 0, 
+1, 6, 141, 67, 0, 7, 141, 120, 26, 70, 141, 67, 0, 71, 205, 255, 
+26, 228, 76, 0, 1, 164, 75, 128, 2, 203, 11, 128, 2, 1, 12, 67, 
+0, 68, 12, 0, 0, 129, 76, 67, 0, 193, 140, 67, 0, 11, 13, 0, 
+1, 70, 141, 67, 0, 71, 77, 244, 26, 134, 141, 67, 0, 193, 205, 67, 
+0, 135, 205, 13, 27, 36, 77, 0, 1, 228, 75, 128, 2, 11, 12, 128, 
+2, 65, 12, 68, 0, 132, 12, 0, 0, 193, 76, 68, 0, 1, 141, 68, 
+0, 75, 13, 0, 1, 134, 141, 67, 0, 135, 77, 116, 27, 198, 141, 67, 
+0, 1, 206, 68, 0, 199, 13, 142, 27, 100, 77, 0, 1, 36, 76, 128, 
+2, 75, 12, 128, 2, 129, 12, 69, 0, 196, 12, 0, 0, 1, 77, 69, 
+0, 65, 141, 69, 0, 139, 13, 0, 1, 198, 141, 67, 0, 199, 141, 248, 
+27, 6, 142, 67, 0, 65, 206, 67, 0, 7, 78, 14, 28, 164, 77, 0, 
+1, 100, 76, 128, 2, 139, 12, 128, 2, 193, 204, 69, 0, 4, 13, 0, 
+0, 65, 13, 70, 0, 129, 77, 70, 0, 203, 13, 0, 1, 6, 142, 67, 
+0, 7, 142, 120, 28, 70, 142, 67, 0, 129, 206, 68, 0, 71, 142, 142, 
+28, 228, 77, 0, 1, 164, 76, 128, 2, 203, 12, 128, 2, 1, 141, 70, 
+0, 68, 13, 0, 0, 129, 205, 70, 0, 193, 13, 71, 0, 11, 14, 0, 
+1, 70, 142, 67, 0, 71, 78, 244, 28, 134, 142, 67, 0, 193, 78, 71, 
+0, 135, 206, 14, 29, 36, 78, 0, 1, 228, 76, 128, 2, 11, 13, 128, 
+2, 65, 141, 71, 0, 132, 13, 0, 0, 193, 205, 71, 0, 1, 14, 72, 
+0, 75, 14, 0, 1, 134, 142, 67, 0, 135, 78, 116, 29, 198, 142, 67, 
+0, 1, 79, 72, 0, 199, 14, 143, 29, 100, 78, 0, 1, 36, 77, 128, 
+2, 75, 13, 128, 2, 129, 141, 72, 0, 196, 13, 0, 0, 1, 206, 72, 
+0, 65, 14, 73, 0, 139, 14, 0, 1, 198, 142, 67, 0, 199, 142, 248, 
+29, 6, 143, 67, 0, 65, 79, 71, 0, 7, 79, 15, 30, 164, 78, 0, 
+1, 100, 77, 128, 2, 139, 13, 128, 2, 193, 77, 73, 0, 4, 14, 0, 
+0, 65, 142, 73, 0, 129, 206, 73, 0, 203, 14, 0, 1, 6, 143, 67, 
+0, 7, 143, 120, 30, 70, 143, 67, 0, 129, 79, 72, 0, 71, 143, 143, 
+30, 228, 78, 0, 1, 164, 77, 128, 2, 203, 13, 128, 2, 1, 14, 74, 
+0, 68, 14, 0, 0, 129, 78, 74, 0, 193, 142, 74, 0, 11, 15, 0, 
+1, 70, 143, 67, 0, 71, 79, 244, 30, 134, 143, 67, 0, 193, 207, 74, 
+0, 135, 207, 15, 31, 36, 79, 0, 1, 228, 77, 128, 2, 11, 14, 128, 
+2, 65, 14, 75, 0, 132, 14, 0, 0, 193, 78, 75, 0, 1, 143, 75, 
+0, 75, 15, 0, 1, 134, 143, 67, 0, 135, 79, 116, 31, 198, 143, 67, 
+0, 1, 208, 75, 0, 199, 15, 144, 31, 100, 79, 0, 1, 36, 78, 128, 
+2, 75, 14, 128, 2, 129, 14, 76, 0, 196, 14, 0, 0, 1, 79, 76, 
+0, 65, 143, 76, 0, 139, 15, 0, 1, 198, 143, 67, 0, 199, 143, 248, 
+31, 6, 144, 67, 0, 65, 208, 74, 0, 7, 80, 16, 32, 164, 79, 0, 
+1, 100, 78, 128, 2, 139, 14, 128, 2, 193, 206, 76, 0, 4, 15, 0, 
+0, 65, 15, 77, 0, 129, 79, 77, 0, 203, 15, 0, 1, 6, 144, 67, 
+0, 7, 144, 120, 32, 70, 144, 67, 0, 129, 208, 75, 0, 71, 144, 144, 
+32, 228, 79, 0, 1, 164, 78, 128, 2, 203, 14, 128, 2, 1, 143, 77, 
+0, 68, 15, 0, 0, 129, 207, 77, 0, 193, 15, 78, 0, 11, 16, 0, 
+1, 64, 16, 128, 8, 134, 144, 67, 0, 193, 80, 78, 0, 135, 208, 16, 
+33, 36, 80, 0, 1, 228, 78, 128, 2, 11, 15, 128, 2, 65, 143, 78, 
+0, 132, 15, 0, 0, 193, 207, 78, 0, 1, 16, 79, 0, 75, 16, 0, 
+1, 128, 16, 128, 8, 198, 144, 67, 0, 1, 81, 79, 0, 199, 16, 145, 
+33, 100, 80, 0, 1, 36, 79, 128, 2, 75, 15, 128, 2, 129, 143, 79, 
+0, 196, 15, 0, 0, 1, 208, 79, 0, 65, 16, 80, 0, 139, 16, 128, 
+1, 192, 16, 128, 8, 6, 145, 67, 0, 65, 81, 80, 0, 7, 81, 17, 
+34, 70, 145, 67, 0, 129, 145, 80, 0, 71, 145, 145, 34, 164, 80, 128, 
+1, 100, 79, 128, 2, 139, 15, 128, 2, 193, 207, 80, 0, 4, 16, 0, 
+0, 65, 16, 81, 0, 129, 80, 81, 0, 198, 144, 67, 0, 1, 145, 81, 
+0, 199, 16, 145, 33, 164, 79, 128, 2, 100, 71, 128, 16, 221, 134, 128, 
+1, 0, 7, 128, 6, 65, 199, 81, 0, 139, 7, 128, 2, 203, 7, 128, 
+2, 1, 8, 11, 0, 65, 8, 11, 0, 129, 8, 82, 0, 196, 8, 0, 
+0, 0, 9, 0, 11, 228, 71, 128, 2, 11, 8, 128, 2, 65, 8, 27, 
+0, 129, 8, 27, 0, 193, 72, 82, 0, 4, 9, 0, 0, 64, 9, 0, 
+12, 36, 72, 128, 2, 75, 8, 128, 2, 129, 72, 13, 0, 193, 72, 13, 
+0, 1, 137, 82, 0, 68, 9, 0, 0, 128, 9, 0, 13, 100, 72, 128, 
+2, 139, 8, 128, 2, 193, 136, 19, 0, 1, 137, 19, 0, 65, 201, 82, 
+0, 132, 9, 0, 0, 192, 9, 128, 7, 164, 72, 128, 2, 203, 8, 128, 
+2, 1, 201, 29, 0, 65, 201, 29, 0, 129, 9, 83, 0, 196, 9, 0, 
+0, 0, 10, 128, 13, 228, 72, 128, 2, 164, 71, 128, 2, 29, 135, 128, 
+1, 65, 71, 83, 0, 165, 135, 2, 0, 8, 128, 135, 14, 65, 135, 83, 
+0, 165, 199, 2, 0, 8, 128, 135, 14, 65, 199, 83, 0, 139, 71, 1, 
+0, 193, 7, 84, 0, 37, 8, 3, 0, 138, 7, 136, 15, 193, 71, 84, 
+0, 37, 72, 3, 0, 138, 7, 136, 15, 193, 135, 84, 0, 37, 136, 3, 
+0, 138, 7, 136, 15, 193, 199, 84, 0, 37, 200, 3, 0, 138, 7, 136, 
+15, 193, 7, 85, 0, 37, 8, 4, 0, 138, 7, 136, 15, 8, 128, 135, 
+14, 65, 71, 85, 0, 165, 71, 4, 0, 8, 128, 135, 14, 65, 135, 85, 
+0, 165, 135, 4, 0, 8, 128, 135, 14, 65, 199, 85, 0, 165, 199, 4, 
+0, 8, 128, 135, 14, 65, 7, 86, 0, 165, 7, 5, 0, 8, 128, 135, 
+14, 31, 0, 128, 0, 89, 1, 0, 0, 4, 5, 0, 0, 0, 0, 0, 
+0, 0, 109, 97, 116, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+102, 108, 111, 111, 114, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 
+103, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 114, 105, 116, 101, 
+0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 99, 108, 101, 97, 114, 116, 
+111, 101, 111, 108, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 103, 101, 
+116, 99, 104, 97, 114, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 103, 
+111, 116, 111, 120, 121, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 115, 
+101, 116, 98, 111, 108, 100, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 
+115, 101, 116, 98, 114, 105, 103, 104, 116, 0, 4, 11, 0, 0, 0, 0, 
+0, 0, 0, 115, 101, 116, 114, 101, 118, 101, 114, 115, 101, 0, 4, 10, 
+0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 110, 111, 114, 109, 97, 108, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 115, 116, 114, 
+105, 110, 103, 119, 105, 100, 116, 104, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 115, 0, 4, 17, 0, 0, 
+0, 0, 0, 0, 0, 80, 97, 114, 97, 103, 114, 97, 112, 104, 32, 83, 
+116, 121, 108, 101, 115, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 
+109, 100, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 67, 104, 101, 99, 
+107, 112, 111, 105, 110, 116, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 
+73, 109, 112, 111, 114, 116, 32, 110, 101, 119, 32, 100, 111, 99, 117, 109, 
+101, 110, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 70, 73, 111, 
+100, 116, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 79, 0, 4, 19, 
+0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 32, 79, 68, 
+84, 32, 102, 105, 108, 101, 46, 46, 46, 0, 4, 14, 0, 0, 0, 0, 
+0, 0, 0, 73, 109, 112, 111, 114, 116, 79, 68, 84, 70, 105, 108, 101, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 70, 73, 104, 116, 109, 108, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 72, 0, 4, 20, 0, 0, 
+0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 32, 72, 84, 77, 76, 
+32, 102, 105, 108, 101, 46, 46, 46, 0, 4, 15, 0, 0, 0, 0, 0, 
+0, 0, 73, 109, 112, 111, 114, 116, 72, 84, 77, 76, 70, 105, 108, 101, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 70, 73, 116, 120, 116, 0, 
+4, 2, 0, 0, 0, 0, 0, 0, 0, 84, 0, 4, 20, 0, 0, 0, 
+0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 32, 116, 101, 120, 116, 32, 
+102, 105, 108, 101, 46, 46, 46, 0, 4, 15, 0, 0, 0, 0, 0, 0, 
+0, 73, 109, 112, 111, 114, 116, 84, 101, 120, 116, 70, 105, 108, 101, 0, 
+4, 24, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 32, 
+99, 117, 114, 114, 101, 110, 116, 32, 100, 111, 99, 117, 109, 101, 110, 116, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 70, 69, 111, 100, 116, 0, 
+4, 17, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 32, 
+116, 111, 32, 79, 68, 84, 46, 46, 46, 0, 4, 14, 0, 0, 0, 0, 
+0, 0, 0, 69, 120, 112, 111, 114, 116, 79, 68, 84, 70, 105, 108, 101, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 70, 69, 104, 116, 109, 108, 
+0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 
+32, 116, 111, 32, 72, 84, 77, 76, 46, 46, 46, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 72, 84, 77, 76, 70, 
+105, 108, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 70, 69, 116, 
+120, 116, 0, 4, 24, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 
+114, 116, 32, 116, 111, 32, 112, 108, 97, 105, 110, 32, 116, 101, 120, 116, 
+46, 46, 46, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 
+111, 114, 116, 84, 101, 120, 116, 70, 105, 108, 101, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 70, 69, 116, 101, 120, 0, 4, 2, 0, 0, 0, 
+0, 0, 0, 0, 76, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 69, 
+120, 112, 111, 114, 116, 32, 116, 111, 32, 76, 97, 84, 101, 88, 46, 46, 
+46, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 
+116, 76, 97, 116, 101, 120, 70, 105, 108, 101, 0, 4, 5, 0, 0, 0, 
+0, 0, 0, 0, 70, 69, 116, 114, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 70, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 
+111, 114, 116, 32, 116, 111, 32, 84, 114, 111, 102, 102, 46, 46, 46, 0, 
+4, 16, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 84, 
+114, 111, 102, 102, 70, 105, 108, 101, 0, 4, 18, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 116, 105, 
+110, 103, 115, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 70, 83, 97, 
+117, 116, 111, 115, 97, 118, 101, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 65, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 65, 117, 116, 111, 
+115, 97, 118, 101, 46, 46, 46, 0, 4, 18, 0, 0, 0, 0, 0, 0, 
+0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 65, 117, 116, 111, 115, 97, 
+118, 101, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 70, 83, 115, 99, 
+114, 97, 112, 98, 111, 111, 107, 0, 4, 2, 0, 0, 0, 0, 0, 0, 
+0, 83, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 83, 99, 114, 97, 
+112, 98, 111, 111, 107, 46, 46, 46, 0, 4, 19, 0, 0, 0, 0, 0, 
+0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 83, 99, 114, 97, 112, 
+98, 111, 111, 107, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 70, 83, 
+72, 84, 77, 76, 69, 120, 112, 111, 114, 116, 0, 4, 15, 0, 0, 0, 
+0, 0, 0, 0, 72, 84, 77, 76, 32, 101, 120, 112, 111, 114, 116, 46, 
+46, 46, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 
+105, 103, 117, 114, 101, 72, 84, 77, 76, 69, 120, 112, 111, 114, 116, 0, 
+4, 12, 0, 0, 0, 0, 0, 0, 0, 70, 83, 80, 97, 103, 101, 67, 
+111, 117, 110, 116, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 80, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 80, 97, 103, 101, 32, 99, 111, 
+117, 110, 116, 46, 46, 46, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 
+67, 111, 110, 102, 105, 103, 117, 114, 101, 80, 97, 103, 101, 67, 111, 117, 
+110, 116, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 70, 83, 83, 109, 
+97, 114, 116, 113, 117, 111, 116, 101, 115, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 81, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 83, 109, 
+97, 114, 116, 32, 113, 117, 111, 116, 101, 115, 46, 46, 46, 0, 4, 21, 
+0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 
+83, 109, 97, 114, 116, 81, 117, 111, 116, 101, 115, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 70, 83, 83, 112, 101, 108, 108, 99, 104, 101, 99, 
+107, 101, 114, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 67, 0, 4, 
+16, 0, 0, 0, 0, 0, 0, 0, 83, 112, 101, 108, 108, 99, 104, 101, 
+99, 107, 101, 114, 46, 46, 46, 0, 4, 22, 0, 0, 0, 0, 0, 0, 
+0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 83, 112, 101, 108, 108, 99, 
+104, 101, 99, 107, 101, 114, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 
+71, 108, 111, 98, 97, 108, 32, 115, 101, 116, 116, 105, 110, 103, 115, 0, 
+4, 13, 0, 0, 0, 0, 0, 0, 0, 70, 83, 87, 105, 100, 101, 115, 
+99, 114, 101, 101, 110, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 87, 
+0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 87, 105, 100, 101, 115, 99, 
+114, 101, 101, 110, 32, 109, 111, 100, 101, 46, 46, 46, 0, 4, 20, 0, 
+0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 101, 87, 
+105, 100, 101, 115, 99, 114, 101, 101, 110, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 45, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 70, 83, 
+68, 101, 98, 117, 103, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 68, 
+0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 68, 101, 98, 117, 103, 103, 
+105, 110, 103, 32, 111, 112, 116, 105, 111, 110, 115, 46, 46, 46, 0, 4, 
+15, 0, 0, 0, 0, 0, 0, 0, 67, 111, 110, 102, 105, 103, 117, 114, 
+101, 68, 101, 98, 117, 103, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 
+70, 83, 82, 101, 110, 100, 101, 114, 83, 116, 97, 116, 115, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 82, 0, 4, 24, 0, 0, 0, 0, 0, 
+0, 0, 82, 101, 110, 100, 101, 114, 105, 110, 103, 32, 115, 116, 97, 116, 
+105, 115, 116, 105, 99, 115, 46, 46, 46, 0, 4, 16, 0, 0, 0, 0, 
+0, 0, 0, 68, 117, 109, 112, 82, 101, 110, 100, 101, 114, 83, 116, 97, 
+116, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 70, 105, 108, 101, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 70, 78, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 78, 0, 4, 17, 0, 0, 0, 0, 0, 0, 
+0, 78, 101, 119, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 
+116, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 
+101, 66, 108, 97, 110, 107, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 
+116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 70, 79, 0, 4, 21, 
+0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 32, 100, 111, 99, 117, 
+109, 101, 110, 116, 32, 115, 101, 116, 46, 46, 46, 0, 4, 16, 0, 0, 
+0, 0, 0, 0, 0, 76, 111, 97, 100, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 70, 83, 
+0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 32, 100, 
+111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 94, 83, 0, 4, 20, 0, 0, 0, 0, 0, 0, 
+0, 83, 97, 118, 101, 67, 117, 114, 114, 101, 110, 116, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 70, 65, 
+0, 4, 24, 0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 32, 100, 
+111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 32, 97, 115, 46, 46, 
+46, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 83, 97, 118, 101, 67, 
+117, 114, 114, 101, 110, 116, 68, 111, 99, 117, 109, 101, 110, 116, 65, 115, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 70, 66, 0, 4, 2, 0, 
+0, 0, 0, 0, 0, 0, 66, 0, 4, 23, 0, 0, 0, 0, 0, 0, 
+0, 65, 100, 100, 32, 110, 101, 119, 32, 98, 108, 97, 110, 107, 32, 100, 
+111, 99, 117, 109, 101, 110, 116, 0, 4, 17, 0, 0, 0, 0, 0, 0, 
+0, 65, 100, 100, 66, 108, 97, 110, 107, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 70, 73, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 73, 0, 4, 24, 0, 0, 0, 0, 0, 
+0, 0, 73, 109, 112, 111, 114, 116, 32, 110, 101, 119, 32, 100, 111, 99, 
+117, 109, 101, 110, 116, 32, 226, 150, 183, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 70, 69, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 69, 
+0, 4, 28, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 
+32, 99, 117, 114, 114, 101, 110, 116, 32, 100, 111, 99, 117, 109, 101, 110, 
+116, 32, 226, 150, 183, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 70, 
+100, 111, 99, 109, 97, 110, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 
+77, 97, 110, 97, 103, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 115, 
+46, 46, 46, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 77, 97, 110, 
+97, 103, 101, 68, 111, 99, 117, 109, 101, 110, 116, 115, 85, 73, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 70, 115, 101, 116, 116, 105, 110, 103, 
+115, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 
+101, 110, 116, 32, 115, 101, 116, 116, 105, 110, 103, 115, 32, 226, 150, 183, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 70, 103, 108, 111, 98, 97, 
+108, 115, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 20, 
+0, 0, 0, 0, 0, 0, 0, 71, 108, 111, 98, 97, 108, 32, 115, 101, 
+116, 116, 105, 110, 103, 115, 32, 226, 150, 183, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 70, 97, 98, 111, 117, 116, 0, 4, 2, 0, 0, 0, 
+0, 0, 0, 0, 90, 0, 4, 21, 0, 0, 0, 0, 0, 0, 0, 65, 
+98, 111, 117, 116, 32, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 
+46, 46, 46, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 65, 98, 111, 
+117, 116, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 70, 81, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 88, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 69, 120, 
+105, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 94, 81, 0, 4, 
+17, 0, 0, 0, 0, 0, 0, 0, 84, 101, 114, 109, 105, 110, 97, 116, 
+101, 80, 114, 111, 103, 114, 97, 109, 0, 4, 10, 0, 0, 0, 0, 0, 
+0, 0, 83, 99, 114, 97, 112, 98, 111, 111, 107, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 69, 83, 99, 117, 116, 0, 4, 17, 0, 0, 0, 
+0, 0, 0, 0, 67, 117, 116, 32, 116, 111, 32, 115, 99, 114, 97, 112, 
+98, 111, 111, 107, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 67, 117, 
+116, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 69, 83, 99, 111, 112, 121, 0, 4, 18, 0, 
+0, 0, 0, 0, 0, 0, 67, 111, 112, 121, 32, 116, 111, 32, 115, 99, 
+114, 97, 112, 98, 111, 111, 107, 0, 4, 16, 0, 0, 0, 0, 0, 0, 
+0, 67, 111, 112, 121, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 
+0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 69, 83, 112, 97, 115, 116, 
+101, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 80, 97, 115, 116, 101, 
+32, 116, 111, 32, 115, 99, 114, 97, 112, 98, 111, 111, 107, 0, 4, 17, 
+0, 0, 0, 0, 0, 0, 0, 80, 97, 115, 116, 101, 84, 111, 83, 99, 
+114, 97, 112, 98, 111, 111, 107, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 69, 100, 105, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 69, 
+84, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 117, 116, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 94, 88, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 69, 67, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+67, 111, 112, 121, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 94, 67, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 69, 80, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 80, 97, 115, 116, 101, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 94, 86, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 69, 68, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 68, 101, 108, 
+101, 116, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 69, 117, 110, 
+100, 111, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 85, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 85, 110, 100, 111, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 94, 90, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 69, 114, 101, 100, 111, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+82, 101, 100, 111, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 94, 89, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 69, 70, 0, 4, 20, 0, 
+0, 0, 0, 0, 0, 0, 70, 105, 110, 100, 32, 97, 110, 100, 32, 114, 
+101, 112, 108, 97, 99, 101, 46, 46, 46, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 94, 70, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 70, 
+105, 110, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 69, 78, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 70, 105, 110, 100, 32, 110, 101, 
+120, 116, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 94, 75, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 70, 105, 110, 100, 78, 101, 120, 116, 
+0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 69, 82, 0, 4, 18, 0, 
+0, 0, 0, 0, 0, 0, 82, 101, 112, 108, 97, 99, 101, 32, 116, 104, 
+101, 110, 32, 102, 105, 110, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 94, 82, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 82, 101, 112, 
+108, 97, 99, 101, 84, 104, 101, 110, 70, 105, 110, 100, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 69, 71, 0, 4, 9, 0, 0, 0, 0, 0, 
+0, 0, 71, 111, 32, 116, 111, 46, 46, 46, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 94, 71, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+71, 111, 116, 111, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 69, 115, 
+99, 114, 97, 112, 98, 111, 111, 107, 0, 4, 14, 0, 0, 0, 0, 0, 
+0, 0, 83, 99, 114, 97, 112, 98, 111, 111, 107, 32, 226, 150, 183, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 77, 97, 114, 103, 105, 110, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 83, 77, 49, 0, 4, 12, 0, 
+0, 0, 0, 0, 0, 0, 72, 105, 100, 101, 32, 109, 97, 114, 103, 105, 
+110, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 83, 77, 50, 0, 4, 
+22, 0, 0, 0, 0, 0, 0, 0, 83, 104, 111, 119, 32, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 32, 115, 116, 121, 108, 101, 115, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 83, 77, 51, 0, 4, 23, 0, 0, 0, 
+0, 0, 0, 0, 83, 104, 111, 119, 32, 112, 97, 114, 97, 103, 114, 97, 
+112, 104, 32, 110, 117, 109, 98, 101, 114, 115, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 83, 77, 52, 0, 4, 27, 0, 0, 0, 0, 0, 0, 
+0, 83, 104, 111, 119, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 32, 
+119, 111, 114, 100, 32, 99, 111, 117, 110, 116, 115, 0, 4, 6, 0, 0, 
+0, 0, 0, 0, 0, 83, 116, 121, 108, 101, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 83, 73, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 
+83, 101, 116, 32, 105, 116, 97, 108, 105, 99, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 94, 73, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+83, 85, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 32, 
+117, 110, 100, 101, 114, 108, 105, 110, 101, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 94, 85, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 83, 
+66, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 32, 98, 
+111, 108, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 94, 66, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 83, 79, 0, 4, 10, 0, 0, 
+0, 0, 0, 0, 0, 83, 101, 116, 32, 112, 108, 97, 105, 110, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 94, 79, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 83, 80, 0, 4, 27, 0, 0, 0, 0, 0, 0, 0, 
+67, 104, 97, 110, 103, 101, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+32, 115, 116, 121, 108, 101, 32, 226, 150, 183, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 94, 80, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+83, 77, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 77, 0, 4, 20, 
+0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 32, 109, 97, 114, 103, 105, 
+110, 32, 109, 111, 100, 101, 32, 226, 150, 183, 0, 4, 3, 0, 0, 0, 
+0, 0, 0, 0, 83, 83, 0, 4, 18, 0, 0, 0, 0, 0, 0, 0, 
+84, 111, 103, 103, 108, 101, 32, 115, 116, 97, 116, 117, 115, 32, 98, 97, 
+114, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 84, 111, 103, 103, 108, 
+101, 83, 116, 97, 116, 117, 115, 66, 97, 114, 0, 4, 11, 0, 0, 0, 
+0, 0, 0, 0, 78, 97, 118, 105, 103, 97, 116, 105, 111, 110, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 90, 85, 0, 4, 10, 0, 0, 0, 
+0, 0, 0, 0, 67, 117, 114, 115, 111, 114, 32, 117, 112, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 85, 80, 0, 4, 18, 0, 0, 0, 0, 
+0, 0, 0, 77, 111, 118, 101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 
+99, 116, 101, 100, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 71, 111, 
+116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 76, 105, 110, 101, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 90, 82, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 67, 117, 114, 115, 111, 114, 32, 114, 105, 103, 104, 116, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 82, 73, 71, 72, 84, 0, 
+4, 14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 101, 120, 
+116, 67, 104, 97, 114, 87, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+90, 68, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 67, 117, 114, 115, 
+111, 114, 32, 100, 111, 119, 110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 68, 79, 87, 78, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 71, 
+111, 116, 111, 78, 101, 120, 116, 76, 105, 110, 101, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 90, 76, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 67, 117, 114, 115, 111, 114, 32, 108, 101, 102, 116, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 76, 69, 70, 84, 0, 4, 18, 0, 0, 0, 
+0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 
+67, 104, 97, 114, 87, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 90, 
+83, 85, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 
+99, 116, 105, 111, 110, 32, 117, 112, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 83, 85, 80, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 83, 
+101, 116, 77, 97, 114, 107, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+90, 83, 82, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 
+101, 99, 116, 105, 111, 110, 32, 114, 105, 103, 104, 116, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 83, 82, 73, 71, 72, 84, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 90, 83, 68, 0, 4, 15, 0, 0, 0, 0, 
+0, 0, 0, 83, 101, 108, 101, 99, 116, 105, 111, 110, 32, 100, 111, 119, 
+110, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 83, 68, 79, 87, 78, 
+0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 90, 83, 76, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 99, 116, 105, 111, 110, 
+32, 108, 101, 102, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 83, 
+76, 69, 70, 84, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 90, 83, 
+87, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 99, 
+116, 32, 119, 111, 114, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 
+94, 87, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 
+99, 116, 87, 111, 114, 100, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+90, 87, 76, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 
+111, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 119, 111, 114, 100, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 94, 76, 69, 70, 84, 0, 4, 
+18, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 
+105, 111, 117, 115, 87, 111, 114, 100, 87, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 90, 87, 82, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 
+71, 111, 116, 111, 32, 110, 101, 120, 116, 32, 119, 111, 114, 100, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 94, 82, 73, 71, 72, 84, 0, 4, 
+14, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 101, 120, 116, 
+87, 111, 114, 100, 87, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 90, 
+78, 80, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 
+32, 110, 101, 120, 116, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 94, 68, 79, 87, 78, 0, 4, 
+19, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 78, 101, 120, 116, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 87, 0, 4, 4, 0, 0, 0, 
+0, 0, 0, 0, 90, 80, 80, 0, 4, 24, 0, 0, 0, 0, 0, 0, 
+0, 71, 111, 116, 111, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 112, 
+97, 114, 97, 103, 114, 97, 112, 104, 0, 4, 4, 0, 0, 0, 0, 0, 
+0, 0, 94, 85, 80, 0, 4, 23, 0, 0, 0, 0, 0, 0, 0, 71, 
+111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 114, 97, 103, 
+114, 97, 112, 104, 87, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 90, 
+83, 87, 76, 0, 4, 24, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 
+101, 99, 116, 32, 116, 111, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 
+119, 111, 114, 100, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 83, 94, 
+76, 69, 70, 84, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 90, 83, 
+87, 82, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 
+99, 116, 32, 116, 111, 32, 110, 101, 120, 116, 32, 119, 111, 114, 100, 0, 
+4, 8, 0, 0, 0, 0, 0, 0, 0, 83, 94, 82, 73, 71, 72, 84, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 90, 83, 78, 80, 0, 4, 
+25, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 99, 116, 32, 116, 
+111, 32, 110, 101, 120, 116, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 83, 94, 68, 79, 87, 78, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 90, 83, 80, 80, 0, 4, 
+29, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 99, 116, 32, 116, 
+111, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 112, 97, 114, 97, 103, 
+114, 97, 112, 104, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 83, 94, 
+85, 80, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 90, 72, 0, 4, 
+23, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 32, 98, 101, 103, 
+105, 110, 110, 105, 110, 103, 32, 111, 102, 32, 108, 105, 110, 101, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 72, 79, 77, 69, 0, 4, 20, 0, 
+0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 
+105, 110, 103, 79, 102, 76, 105, 110, 101, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 90, 69, 0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 71, 
+111, 116, 111, 32, 101, 110, 100, 32, 111, 102, 32, 108, 105, 110, 101, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 69, 78, 68, 0, 4, 14, 0, 
+0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 69, 110, 100, 79, 102, 76, 
+105, 110, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 90, 83, 72, 
+0, 4, 28, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 99, 116, 
+32, 116, 111, 32, 98, 101, 103, 105, 110, 110, 105, 110, 103, 32, 111, 102, 
+32, 108, 105, 110, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 83, 
+72, 79, 77, 69, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 90, 83, 
+69, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 99, 
+116, 32, 116, 111, 32, 101, 110, 100, 32, 111, 102, 32, 108, 105, 110, 101, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 83, 69, 78, 68, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 90, 66, 68, 0, 4, 27, 0, 0, 
+0, 0, 0, 0, 0, 71, 111, 116, 111, 32, 98, 101, 103, 105, 110, 110, 
+105, 110, 103, 32, 111, 102, 32, 100, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 6, 0, 0, 0, 0, 0, 0, 0, 94, 80, 71, 85, 80, 0, 4, 
+24, 0, 0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 66, 101, 103, 105, 
+110, 110, 105, 110, 103, 79, 102, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 90, 69, 68, 0, 4, 21, 0, 
+0, 0, 0, 0, 0, 0, 71, 111, 116, 111, 32, 101, 110, 100, 32, 111, 
+102, 32, 100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 6, 0, 0, 0, 
+0, 0, 0, 0, 94, 80, 71, 68, 78, 0, 4, 18, 0, 0, 0, 0, 
+0, 0, 0, 71, 111, 116, 111, 69, 110, 100, 79, 102, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 90, 83, 
+66, 68, 0, 4, 32, 0, 0, 0, 0, 0, 0, 0, 83, 101, 108, 101, 
+99, 116, 32, 116, 111, 32, 98, 101, 103, 105, 110, 110, 105, 110, 103, 32, 
+111, 102, 32, 100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 83, 94, 80, 71, 85, 80, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 90, 83, 69, 68, 0, 4, 26, 0, 0, 0, 0, 
+0, 0, 0, 83, 101, 108, 101, 99, 116, 32, 116, 111, 32, 101, 110, 100, 
+32, 111, 102, 32, 100, 111, 99, 117, 109, 101, 110, 116, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 83, 94, 80, 71, 68, 78, 0, 4, 6, 0, 
+0, 0, 0, 0, 0, 0, 90, 80, 71, 85, 80, 0, 4, 8, 0, 0, 
+0, 0, 0, 0, 0, 80, 97, 103, 101, 32, 117, 112, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 80, 71, 85, 80, 0, 4, 17, 0, 0, 0, 
+0, 0, 0, 0, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 
+80, 97, 103, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 90, 80, 
+71, 68, 78, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 80, 97, 103, 
+101, 32, 100, 111, 119, 110, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+80, 71, 68, 78, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 71, 111, 
+116, 111, 78, 101, 120, 116, 80, 97, 103, 101, 0, 4, 7, 0, 0, 0, 
+0, 0, 0, 0, 90, 83, 80, 71, 85, 80, 0, 4, 18, 0, 0, 0, 
+0, 0, 0, 0, 83, 101, 108, 101, 99, 116, 105, 111, 110, 32, 112, 97, 
+103, 101, 32, 117, 112, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 83, 
+80, 71, 85, 80, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 90, 83, 
+80, 71, 68, 78, 0, 4, 20, 0, 0, 0, 0, 0, 0, 0, 83, 101, 
+108, 101, 99, 116, 105, 111, 110, 32, 112, 97, 103, 101, 32, 100, 111, 119, 
+110, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 83, 80, 71, 68, 78, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 90, 68, 80, 67, 0, 4, 
+26, 0, 0, 0, 0, 0, 0, 0, 68, 101, 108, 101, 116, 101, 32, 112, 
+114, 101, 118, 105, 111, 117, 115, 32, 99, 104, 97, 114, 97, 99, 116, 101, 
+114, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 66, 65, 67, 75, 83, 
+80, 65, 67, 69, 0, 4, 30, 0, 0, 0, 0, 0, 0, 0, 68, 101, 
+108, 101, 116, 101, 83, 101, 108, 101, 99, 116, 105, 111, 110, 79, 114, 80, 
+114, 101, 118, 105, 111, 117, 115, 67, 104, 97, 114, 0, 4, 5, 0, 0, 
+0, 0, 0, 0, 0, 90, 68, 78, 67, 0, 4, 22, 0, 0, 0, 0, 
+0, 0, 0, 68, 101, 108, 101, 116, 101, 32, 110, 101, 120, 116, 32, 99, 
+104, 97, 114, 97, 99, 116, 101, 114, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 68, 69, 76, 69, 84, 69, 0, 4, 26, 0, 0, 0, 0, 0, 
+0, 0, 68, 101, 108, 101, 116, 101, 83, 101, 108, 101, 99, 116, 105, 111, 
+110, 79, 114, 78, 101, 120, 116, 67, 104, 97, 114, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 90, 68, 87, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 68, 101, 108, 101, 116, 101, 32, 119, 111, 114, 100, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 94, 69, 0, 4, 18, 0, 0, 0, 0, 
+0, 0, 0, 84, 121, 112, 101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 
+99, 116, 101, 100, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 68, 101, 
+108, 101, 116, 101, 87, 111, 114, 100, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 90, 77, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 84, 111, 
+103, 103, 108, 101, 32, 109, 97, 114, 107, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 94, 64, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 84, 
+111, 103, 103, 108, 101, 77, 97, 114, 107, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 77, 97, 105, 110, 32, 77, 101, 110, 117, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 70, 105, 108, 101, 32, 226, 150, 183, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 69, 100, 105, 116, 32, 226, 150, 183, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 83, 116, 121, 108, 101, 32, 
+226, 150, 183, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 
+117, 109, 101, 110, 116, 115, 32, 226, 150, 183, 0, 4, 15, 0, 0, 0, 
+0, 0, 0, 0, 78, 97, 118, 105, 103, 97, 116, 105, 111, 110, 32, 226, 
+150, 183, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 73, 115, 77, 101, 
+110, 117, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 77, 
+101, 110, 117, 65, 99, 116, 105, 111, 110, 0, 4, 10, 0, 0, 0, 0, 
+0, 0, 0, 77, 101, 110, 117, 67, 108, 97, 115, 115, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 97, 99, 116, 105, 118, 97, 116, 101, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 109, 101, 110, 117, 
+0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 109, 101, 
+110, 117, 115, 116, 97, 99, 107, 0, 4, 8, 0, 0, 0, 0, 0, 0, 
+0, 114, 117, 110, 109, 101, 110, 117, 0, 4, 18, 0, 0, 0, 0, 0, 
+0, 0, 108, 111, 111, 107, 117, 112, 65, 99, 99, 101, 108, 101, 114, 97, 
+116, 111, 114, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 
+97, 116, 101, 77, 101, 110, 117, 0, 4, 27, 0, 0, 0, 0, 0, 0, 
+0, 82, 101, 98, 117, 105, 108, 100, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 83, 116, 121, 108, 101, 115, 77, 101, 110, 117, 0, 4, 21, 0, 0, 
+0, 0, 0, 0, 0, 82, 101, 98, 117, 105, 108, 100, 68, 111, 99, 117, 
+109, 101, 110, 116, 115, 77, 101, 110, 117, 0, 4, 14, 0, 0, 0, 0, 
+0, 0, 0, 76, 105, 115, 116, 77, 101, 110, 117, 73, 116, 101, 109, 115, 
+0, 21, 0, 0, 0, 20, 0, 0, 0, 67, 0, 0, 0, 3, 0, 13, 
+87, 0, 0, 0, 204, 0, 64, 0, 221, 128, 0, 1, 155, 64, 0, 0, 
+23, 64, 0, 128, 11, 1, 0, 0, 128, 0, 0, 2, 138, 0, 128, 128, 
+11, 1, 0, 0, 138, 0, 1, 129, 6, 193, 64, 0, 64, 1, 0, 1, 
+29, 1, 1, 1, 23, 0, 0, 128, 138, 0, 193, 3, 34, 129, 0, 0, 
+163, 1, 255, 127, 6, 193, 64, 0, 64, 1, 128, 0, 29, 1, 1, 1, 
+23, 64, 15, 128, 24, 64, 65, 4, 23, 192, 0, 128, 85, 2, 0, 1, 
+77, 130, 193, 4, 138, 64, 193, 4, 23, 192, 13, 128, 75, 66, 1, 0, 
+135, 130, 65, 4, 74, 130, 130, 131, 135, 66, 66, 4, 74, 130, 2, 132, 
+135, 130, 66, 4, 74, 130, 130, 128, 135, 2, 67, 4, 74, 130, 130, 133, 
+135, 130, 67, 4, 74, 130, 130, 134, 149, 2, 0, 1, 141, 130, 65, 5, 
+138, 64, 2, 5, 135, 2, 194, 4, 155, 2, 0, 0, 23, 0, 3, 128, 
+135, 130, 64, 1, 199, 2, 194, 4, 135, 194, 2, 5, 155, 2, 0, 0, 
+23, 0, 1, 128, 134, 194, 67, 0, 193, 2, 4, 0, 7, 3, 194, 4, 
+214, 2, 131, 5, 157, 66, 0, 1, 135, 130, 64, 1, 199, 2, 194, 4, 
+138, 66, 130, 5, 135, 194, 193, 4, 134, 130, 130, 0, 155, 2, 0, 0, 
+23, 0, 1, 128, 134, 194, 67, 0, 193, 66, 4, 0, 7, 195, 193, 4, 
+214, 2, 131, 5, 157, 66, 0, 1, 135, 194, 193, 4, 72, 64, 2, 5, 
+135, 194, 194, 4, 155, 2, 0, 0, 23, 128, 0, 128, 135, 194, 194, 4, 
+199, 194, 193, 4, 136, 192, 2, 5, 135, 66, 192, 4, 140, 2, 64, 5, 
+157, 130, 0, 1, 25, 128, 130, 1, 23, 192, 0, 128, 135, 66, 192, 4, 
+140, 2, 64, 5, 157, 130, 0, 1, 192, 0, 0, 5, 34, 129, 0, 0, 
+163, 193, 239, 127, 138, 192, 0, 137, 159, 0, 0, 1, 31, 0, 128, 0, 
+19, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 108, 101, 110, 
+0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 97, 98, 101, 108, 0, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 109, 107, 115, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 0, 4, 2, 
+0, 0, 0, 0, 0, 0, 0, 45, 0, 3, 0, 0, 0, 0, 0, 0, 
+240, 63, 4, 3, 0, 0, 0, 0, 0, 0, 0, 105, 100, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 109, 107, 0, 3, 0, 0, 0, 0, 0, 
+0, 0, 64, 3, 0, 0, 0, 0, 0, 0, 8, 64, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 97, 107, 0, 3, 0, 0, 0, 0, 0, 0, 16, 
+64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 102, 110, 0, 3, 0, 0, 
+0, 0, 0, 0, 20, 64, 4, 6, 0, 0, 0, 0, 0, 0, 0, 101, 
+114, 114, 111, 114, 0, 4, 27, 0, 0, 0, 0, 0, 0, 0, 68, 117, 
+112, 108, 105, 99, 97, 116, 101, 32, 109, 101, 110, 117, 32, 97, 99, 116, 
+105, 111, 110, 32, 107, 101, 121, 32, 0, 4, 18, 0, 0, 0, 0, 0, 
+0, 0, 68, 117, 112, 105, 99, 97, 116, 101, 32, 109, 101, 110, 117, 32, 
+73, 68, 32, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 109, 97, 120, 
+119, 105, 100, 116, 104, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 
+1, 10, 1, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 76, 0, 0, 0, 
+1, 0, 7, 14, 0, 0, 0, 70, 0, 64, 0, 128, 0, 0, 0, 93, 
+0, 1, 1, 23, 128, 1, 128, 135, 65, 192, 2, 72, 128, 64, 3, 135, 
+193, 192, 2, 155, 1, 0, 0, 23, 64, 0, 128, 135, 193, 192, 2, 136, 
+128, 64, 3, 98, 128, 0, 0, 227, 128, 253, 127, 31, 0, 128, 0, 4, 
+0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 
+114, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 105, 100, 0, 0, 
+4, 3, 0, 0, 0, 0, 0, 0, 0, 97, 107, 0, 0, 0, 0, 0, 
+3, 0, 0, 0, 0, 0, 1, 10, 1, 11, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 0, 
+0, 0, 164, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 65, 128, 0, 0, 29, 64, 0, 1, 31, 0, 128, 
+0, 3, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 86, 105, 
+101, 119, 77, 111, 100, 101, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 165, 0, 
+0, 0, 165, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 65, 128, 0, 0, 29, 64, 0, 1, 31, 0, 128, 
+0, 3, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 86, 105, 
+101, 119, 77, 111, 100, 101, 0, 3, 0, 0, 0, 0, 0, 0, 0, 64, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 0, 
+0, 0, 166, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 65, 128, 0, 0, 29, 64, 0, 1, 31, 0, 128, 
+0, 3, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 86, 105, 
+101, 119, 77, 111, 100, 101, 0, 3, 0, 0, 0, 0, 0, 0, 8, 64, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 0, 
+0, 0, 167, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 65, 128, 0, 0, 29, 64, 0, 1, 31, 0, 128, 
+0, 3, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 86, 105, 
+101, 119, 77, 111, 100, 101, 0, 3, 0, 0, 0, 0, 0, 0, 16, 64, 
+0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 172, 0, 
+0, 0, 172, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 6, 0, 64, 
+0, 7, 64, 64, 0, 65, 128, 0, 0, 29, 64, 0, 1, 31, 0, 128, 
+0, 3, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 
+100, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 83, 116, 
+121, 108, 101, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 105, 0, 0, 
+0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 173, 0, 0, 
+0, 173, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 6, 0, 64, 0, 
+7, 64, 64, 0, 65, 128, 0, 0, 29, 64, 0, 1, 31, 0, 128, 0, 
+3, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 83, 116, 121, 
+108, 101, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0, 0, 
+0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 174, 0, 0, 0, 
+174, 0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 6, 0, 64, 0, 7, 
+64, 64, 0, 65, 128, 0, 0, 29, 64, 0, 1, 31, 0, 128, 0, 3, 
+0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 83, 116, 121, 108, 
+101, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 175, 0, 0, 0, 175, 
+0, 0, 0, 0, 0, 2, 5, 0, 0, 0, 6, 0, 64, 0, 7, 64, 
+64, 0, 65, 128, 0, 0, 29, 64, 0, 1, 31, 0, 128, 0, 3, 0, 
+0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 
+9, 0, 0, 0, 0, 0, 0, 0, 83, 101, 116, 83, 116, 121, 108, 101, 
+0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 111, 0, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 230, 0, 
+0, 0, 1, 0, 3, 14, 0, 0, 0, 70, 0, 64, 0, 128, 0, 0, 
+0, 93, 128, 0, 1, 24, 64, 192, 0, 23, 0, 1, 128, 70, 0, 64, 
+0, 135, 128, 64, 0, 93, 128, 0, 1, 24, 192, 192, 0, 23, 0, 0, 
+128, 67, 64, 0, 0, 67, 0, 128, 0, 95, 0, 0, 1, 31, 0, 128, 
+0, 4, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 116, 121, 
+112, 101, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 98, 108, 
+101, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 9, 0, 0, 0, 
+0, 0, 0, 0, 102, 117, 110, 99, 116, 105, 111, 110, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 0, 0, 0, 246, 
+0, 0, 0, 1, 0, 10, 35, 0, 0, 0, 70, 0, 64, 0, 128, 0, 
+0, 0, 93, 128, 0, 1, 24, 64, 192, 0, 23, 192, 0, 128, 64, 0, 
+0, 0, 94, 0, 128, 0, 95, 0, 0, 0, 23, 0, 6, 128, 70, 128, 
+64, 0, 128, 0, 0, 0, 93, 128, 0, 1, 91, 0, 0, 0, 23, 0, 
+1, 128, 70, 192, 64, 0, 71, 0, 193, 0, 128, 0, 0, 0, 93, 64, 
+0, 1, 23, 128, 3, 128, 70, 64, 65, 0, 128, 0, 0, 0, 93, 0, 
+1, 1, 23, 128, 1, 128, 128, 1, 128, 2, 157, 193, 128, 0, 155, 65, 
+0, 0, 23, 128, 0, 128, 3, 2, 0, 0, 64, 2, 128, 3, 31, 2, 
+128, 1, 98, 128, 0, 0, 227, 128, 253, 127, 67, 0, 128, 0, 95, 0, 
+0, 1, 31, 0, 128, 0, 6, 0, 0, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 116, 121, 112, 101, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 102, 117, 110, 99, 116, 105, 111, 110, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 73, 115, 77, 101, 110, 117, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 67, 109, 100, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+65, 99, 116, 105, 118, 97, 116, 101, 77, 101, 110, 117, 0, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 0, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 251, 0, 0, 0, 0, 
+1, 0, 0, 2, 0, 7, 13, 0, 0, 0, 91, 64, 0, 0, 23, 0, 
+0, 128, 69, 0, 0, 0, 140, 0, 64, 0, 1, 65, 0, 0, 65, 65, 
+0, 0, 128, 1, 128, 0, 157, 64, 128, 2, 134, 128, 192, 0, 157, 64, 
+128, 0, 133, 0, 0, 1, 157, 64, 128, 0, 31, 0, 128, 0, 3, 0, 
+0, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 114, 117, 110, 109, 101, 
+110, 117, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 
+0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 28, 0, 0, 1, 8, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 2, 1, 0, 0, 69, 1, 0, 0, 6, 0, 22, 152, 0, 
+0, 0, 129, 1, 0, 0, 198, 65, 64, 0, 0, 2, 128, 1, 221, 1, 
+1, 1, 23, 128, 2, 128, 7, 131, 64, 0, 71, 195, 192, 5, 7, 67, 
+3, 6, 27, 3, 0, 0, 23, 64, 1, 128, 69, 3, 128, 0, 128, 3, 
+0, 6, 93, 131, 0, 1, 25, 64, 3, 3, 23, 0, 0, 128, 128, 1, 
+128, 6, 226, 129, 0, 0, 99, 130, 252, 127, 25, 128, 1, 128, 23, 0, 
+0, 128, 141, 1, 65, 3, 199, 65, 193, 1, 205, 129, 193, 3, 205, 129, 
+129, 3, 6, 194, 65, 0, 85, 2, 128, 1, 134, 2, 66, 0, 142, 130, 
+0, 5, 142, 66, 66, 5, 29, 130, 128, 1, 70, 130, 66, 0, 128, 2, 
+128, 0, 192, 2, 0, 1, 0, 3, 128, 3, 64, 3, 0, 4, 135, 195, 
+194, 1, 93, 66, 0, 3, 85, 2, 128, 1, 25, 64, 2, 4, 23, 64, 
+6, 128, 78, 2, 193, 2, 149, 2, 128, 1, 80, 130, 130, 4, 141, 2, 
+130, 2, 142, 2, 65, 5, 213, 2, 128, 1, 144, 194, 2, 5, 207, 2, 
+130, 4, 205, 130, 128, 5, 205, 2, 193, 5, 15, 3, 2, 5, 13, 131, 
+0, 6, 13, 3, 65, 6, 69, 3, 0, 1, 93, 67, 128, 0, 64, 3, 
+128, 5, 128, 3, 0, 6, 193, 3, 1, 0, 97, 67, 1, 128, 69, 4, 
+128, 1, 141, 196, 129, 0, 141, 4, 65, 9, 192, 4, 0, 8, 1, 5, 
+3, 0, 93, 68, 0, 2, 96, 3, 254, 127, 64, 2, 128, 2, 141, 2, 
+130, 2, 142, 2, 65, 5, 193, 2, 1, 0, 97, 66, 17, 128, 71, 3, 
+131, 1, 135, 131, 64, 0, 199, 195, 192, 6, 135, 195, 3, 7, 205, 3, 
+3, 1, 206, 67, 129, 7, 205, 3, 193, 7, 24, 64, 195, 6, 23, 192, 
+3, 128, 24, 0, 1, 6, 23, 64, 0, 128, 5, 4, 0, 2, 29, 68, 
+128, 0, 5, 4, 0, 1, 29, 68, 128, 0, 5, 4, 128, 1, 77, 4, 
+193, 0, 128, 4, 128, 7, 198, 132, 67, 0, 199, 196, 195, 9, 1, 5, 
+4, 0, 64, 5, 128, 3, 221, 4, 128, 1, 29, 68, 0, 0, 23, 128, 
+10, 128, 5, 4, 128, 2, 29, 68, 128, 0, 24, 0, 1, 6, 23, 128, 
+2, 128, 5, 4, 0, 2, 29, 68, 128, 0, 5, 4, 128, 1, 77, 4, 
+193, 0, 128, 4, 128, 7, 198, 132, 67, 0, 199, 196, 195, 9, 1, 69, 
+4, 0, 64, 5, 128, 3, 221, 4, 128, 1, 29, 68, 0, 0, 5, 4, 
+128, 1, 77, 132, 193, 0, 128, 4, 128, 7, 199, 196, 194, 6, 29, 68, 
+0, 2, 5, 4, 0, 3, 29, 68, 128, 0, 5, 4, 0, 1, 29, 68, 
+128, 0, 155, 3, 0, 0, 23, 0, 2, 128, 5, 4, 128, 0, 64, 4, 
+0, 7, 29, 132, 0, 1, 69, 4, 128, 1, 141, 196, 129, 0, 142, 4, 
+4, 9, 192, 4, 128, 7, 0, 5, 0, 7, 93, 68, 0, 2, 7, 132, 
+196, 6, 27, 4, 0, 0, 23, 0, 1, 128, 5, 4, 128, 1, 77, 196, 
+196, 0, 128, 4, 128, 7, 199, 132, 196, 6, 29, 68, 0, 2, 5, 4, 
+128, 2, 29, 68, 128, 0, 96, 2, 238, 127, 69, 2, 128, 3, 134, 2, 
+69, 0, 142, 2, 65, 5, 198, 2, 66, 0, 206, 2, 193, 5, 93, 66, 
+128, 1, 70, 66, 69, 0, 129, 130, 5, 0, 93, 66, 0, 1, 31, 0, 
+128, 0, 23, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 
+13, 0, 0, 0, 0, 0, 0, 0, 97, 99, 99, 101, 108, 101, 114, 97, 
+116, 111, 114, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 105, 100, 
+0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 9, 0, 0, 0, 0, 
+0, 0, 0, 109, 97, 120, 119, 105, 100, 116, 104, 0, 3, 0, 0, 0, 
+0, 0, 0, 16, 64, 4, 4, 0, 0, 0, 0, 0, 0, 0, 109, 105, 
+110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 
+110, 72, 101, 105, 103, 104, 116, 0, 3, 0, 0, 0, 0, 0, 0, 8, 
+64, 4, 14, 0, 0, 0, 0, 0, 0, 0, 68, 114, 97, 119, 84, 105, 
+116, 108, 101, 100, 66, 111, 120, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 108, 97, 98, 101, 108, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 
+226, 149, 145, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 45, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 114, 101, 112, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 226, 148, 128, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 32, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 109, 107, 0, 
+3, 0, 0, 0, 0, 0, 0, 0, 64, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 68, 114, 97, 119, 83, 116, 97, 116, 117, 
+115, 76, 105, 110, 101, 0, 4, 74, 0, 0, 0, 0, 0, 0, 0, 94, 
+86, 32, 114, 101, 98, 105, 110, 100, 115, 32, 97, 32, 109, 101, 110, 117, 
+32, 105, 116, 101, 109, 59, 32, 94, 88, 32, 117, 110, 98, 105, 110, 100, 
+115, 32, 105, 116, 59, 32, 94, 82, 32, 114, 101, 115, 101, 116, 115, 32, 
+97, 108, 108, 32, 98, 105, 110, 100, 105, 110, 103, 115, 32, 116, 111, 32, 
+100, 101, 102, 97, 117, 108, 116, 46, 0, 0, 0, 0, 0, 8, 0, 0, 
+0, 0, 0, 1, 9, 1, 6, 1, 1, 1, 7, 1, 8, 1, 5, 1, 
+4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 71, 1, 0, 0, 82, 1, 0, 0, 1, 0, 15, 
+24, 0, 0, 0, 70, 0, 64, 0, 71, 64, 192, 0, 134, 0, 64, 0, 
+138, 128, 192, 128, 134, 192, 64, 0, 157, 64, 128, 0, 134, 0, 64, 0, 
+138, 64, 128, 128, 129, 0, 1, 0, 198, 64, 65, 0, 5, 1, 128, 0, 
+221, 0, 1, 1, 23, 192, 1, 128, 12, 130, 65, 0, 143, 194, 65, 1, 
+207, 2, 66, 1, 7, 67, 194, 3, 71, 131, 194, 3, 135, 195, 194, 3, 
+29, 66, 128, 3, 141, 0, 67, 1, 226, 128, 0, 0, 99, 65, 253, 127, 
+31, 0, 128, 0, 13, 0, 0, 0, 4, 12, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 10, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 97, 116, 117, 115, 98, 97, 114, 0, 
+1, 1, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 100, 114, 97, 
+119, 83, 99, 114, 101, 101, 110, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 109, 101, 
+110, 117, 0, 3, 0, 0, 0, 0, 0, 0, 16, 64, 3, 0, 0, 0, 
+0, 0, 0, 0, 64, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 101, 
+110, 117, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 110, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 116, 111, 112, 0, 3, 0, 0, 0, 0, 
+0, 0, 240, 63, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 12, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 84, 1, 0, 0, 206, 1, 0, 0, 4, 0, 15, 16, 
+1, 0, 0, 1, 1, 0, 0, 65, 1, 0, 0, 132, 1, 0, 0, 198, 
+65, 64, 0, 21, 2, 128, 1, 70, 130, 64, 0, 78, 130, 128, 4, 78, 
+194, 192, 4, 221, 129, 128, 1, 25, 64, 1, 2, 23, 0, 0, 128, 64, 
+1, 0, 2, 13, 194, 129, 2, 14, 2, 64, 4, 25, 0, 1, 4, 23, 
+64, 0, 128, 14, 194, 1, 2, 77, 1, 64, 4, 12, 2, 65, 0, 128, 
+2, 128, 0, 192, 2, 0, 1, 0, 3, 128, 1, 64, 3, 0, 2, 128, 
+3, 128, 2, 29, 66, 128, 3, 5, 2, 128, 0, 29, 130, 128, 0, 12, 
+66, 65, 4, 29, 130, 0, 1, 24, 128, 65, 4, 23, 128, 1, 128, 70, 
+194, 65, 0, 93, 66, 128, 0, 70, 2, 66, 0, 93, 66, 128, 0, 76, 
+66, 66, 0, 93, 66, 0, 1, 23, 0, 247, 127, 24, 128, 66, 4, 23, 
+192, 0, 128, 25, 0, 1, 128, 23, 64, 0, 128, 14, 1, 64, 2, 23, 
+128, 245, 127, 24, 192, 66, 4, 23, 0, 1, 128, 85, 2, 128, 1, 25, 
+64, 2, 2, 23, 64, 0, 128, 13, 1, 64, 2, 23, 192, 243, 127, 24, 
+0, 67, 4, 23, 0, 2, 128, 69, 2, 0, 1, 134, 66, 64, 0, 208, 
+66, 195, 3, 205, 194, 2, 2, 21, 3, 128, 1, 157, 2, 128, 1, 93, 
+130, 0, 0, 0, 1, 128, 4, 23, 0, 241, 127, 24, 128, 67, 4, 23, 
+0, 2, 128, 69, 2, 0, 1, 134, 194, 67, 0, 208, 66, 195, 3, 206, 
+194, 2, 2, 1, 3, 0, 0, 157, 2, 128, 1, 93, 130, 0, 0, 0, 
+1, 128, 4, 23, 64, 238, 127, 88, 0, 68, 4, 23, 64, 0, 128, 24, 
+64, 68, 4, 23, 0, 2, 128, 70, 130, 68, 0, 135, 2, 129, 1, 93, 
+130, 0, 1, 88, 192, 196, 4, 23, 0, 236, 127, 71, 2, 129, 1, 135, 
+1, 197, 4, 23, 128, 32, 128, 23, 0, 235, 127, 24, 64, 69, 4, 23, 
+128, 0, 128, 68, 2, 0, 0, 95, 2, 0, 1, 23, 192, 233, 127, 24, 
+128, 69, 4, 23, 128, 0, 128, 67, 2, 0, 0, 95, 2, 0, 1, 23, 
+128, 232, 127, 24, 192, 69, 4, 23, 128, 0, 128, 67, 2, 0, 0, 95, 
+2, 0, 1, 23, 64, 231, 127, 24, 0, 70, 4, 23, 128, 4, 128, 71, 
+2, 129, 1, 134, 130, 68, 0, 192, 2, 128, 4, 157, 130, 0, 1, 88, 
+192, 68, 5, 23, 64, 229, 127, 135, 66, 70, 0, 199, 2, 197, 4, 135, 
+194, 2, 5, 155, 2, 0, 0, 23, 0, 228, 127, 199, 66, 70, 0, 202, 
+130, 70, 5, 199, 66, 70, 0, 7, 3, 197, 4, 202, 130, 70, 6, 204, 
+66, 66, 0, 221, 66, 0, 1, 23, 0, 226, 127, 24, 192, 70, 4, 23, 
+192, 13, 128, 71, 2, 129, 1, 134, 130, 68, 0, 192, 2, 128, 4, 157, 
+130, 0, 1, 88, 192, 68, 5, 23, 0, 224, 127, 135, 66, 70, 0, 199, 
+2, 197, 4, 135, 194, 2, 5, 155, 66, 0, 0, 23, 192, 222, 127, 134, 
+2, 71, 0, 193, 66, 7, 0, 157, 66, 0, 1, 133, 2, 128, 0, 157, 
+130, 128, 0, 140, 66, 65, 5, 157, 130, 0, 1, 204, 130, 71, 5, 65, 
+195, 7, 0, 221, 130, 128, 1, 219, 2, 0, 0, 23, 192, 219, 127, 204, 
+2, 72, 5, 65, 195, 7, 0, 129, 67, 8, 0, 221, 130, 0, 2, 128, 
+2, 128, 5, 199, 66, 70, 0, 199, 130, 130, 5, 219, 2, 0, 0, 23, 
+128, 1, 128, 198, 130, 72, 0, 1, 195, 8, 0, 64, 3, 0, 5, 129, 
+3, 9, 0, 22, 131, 3, 6, 221, 66, 0, 1, 23, 64, 3, 128, 88, 
+64, 73, 5, 23, 64, 0, 128, 24, 128, 73, 5, 23, 192, 0, 128, 198, 
+130, 72, 0, 1, 195, 9, 0, 221, 66, 0, 1, 23, 64, 1, 128, 199, 
+66, 70, 0, 7, 3, 197, 4, 202, 2, 3, 5, 199, 66, 70, 0, 7, 
+3, 197, 4, 202, 130, 2, 6, 204, 66, 66, 0, 221, 66, 0, 1, 23, 
+128, 211, 127, 24, 0, 74, 4, 23, 0, 6, 128, 70, 66, 74, 0, 129, 
+130, 10, 0, 193, 194, 10, 0, 1, 3, 11, 0, 214, 2, 131, 5, 93, 
+130, 128, 1, 91, 2, 0, 0, 23, 64, 3, 128, 70, 66, 75, 0, 134, 
+194, 75, 0, 157, 130, 128, 0, 74, 130, 2, 151, 70, 66, 75, 0, 76, 
+2, 204, 4, 93, 66, 0, 1, 70, 130, 72, 0, 129, 66, 12, 0, 93, 
+66, 0, 1, 75, 2, 0, 0, 73, 2, 128, 1, 67, 2, 0, 0, 95, 
+2, 0, 1, 76, 66, 66, 0, 93, 66, 0, 1, 23, 192, 204, 127, 71, 
+130, 204, 1, 71, 2, 130, 4, 91, 2, 0, 0, 23, 192, 203, 127, 71, 
+130, 204, 1, 71, 2, 130, 4, 135, 1, 197, 4, 23, 0, 0, 128, 23, 
+128, 202, 127, 198, 129, 1, 2, 7, 194, 204, 3, 70, 2, 77, 0, 128, 
+2, 0, 4, 93, 130, 0, 1, 91, 2, 0, 0, 23, 192, 6, 128, 69, 
+2, 128, 1, 85, 2, 128, 4, 77, 2, 192, 4, 139, 194, 0, 0, 138, 
+194, 0, 151, 138, 2, 129, 154, 138, 66, 1, 155, 200, 128, 130, 4, 76, 
+194, 77, 0, 205, 2, 206, 0, 13, 67, 67, 1, 64, 3, 0, 4, 93, 
+130, 128, 2, 133, 2, 128, 1, 149, 2, 0, 5, 200, 128, 70, 5, 24, 
+64, 206, 4, 23, 128, 0, 128, 131, 2, 128, 0, 159, 2, 0, 1, 23, 
+192, 0, 128, 24, 128, 206, 4, 23, 64, 0, 128, 131, 2, 0, 0, 159, 
+2, 0, 1, 140, 66, 66, 0, 157, 66, 0, 1, 23, 128, 193, 127, 27, 
+66, 0, 0, 23, 0, 1, 128, 70, 194, 78, 0, 129, 2, 15, 0, 193, 
+66, 15, 0, 93, 66, 128, 1, 23, 192, 1, 128, 70, 130, 79, 0, 128, 
+2, 0, 4, 93, 194, 0, 1, 155, 2, 0, 0, 23, 128, 0, 128, 198, 
+130, 72, 0, 0, 3, 0, 5, 221, 66, 0, 1, 75, 2, 0, 0, 73, 
+2, 128, 1, 67, 2, 128, 0, 95, 2, 0, 1, 23, 128, 188, 127, 31, 
+0, 128, 0, 63, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 4, 0, 0, 0, 0, 0, 0, 0, 109, 105, 110, 0, 4, 13, 0, 
+0, 0, 0, 0, 0, 0, 83, 99, 114, 101, 101, 110, 72, 101, 105, 103, 
+104, 116, 0, 3, 0, 0, 0, 0, 0, 0, 8, 64, 4, 9, 0, 0, 
+0, 0, 0, 0, 0, 100, 114, 97, 119, 109, 101, 110, 117, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 117, 112, 112, 101, 114, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 69, 83, 73, 90, 69, 
+0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 82, 101, 115, 105, 122, 101, 
+83, 99, 114, 101, 101, 110, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 4, 14, 0, 
+0, 0, 0, 0, 0, 0, 100, 114, 97, 119, 109, 101, 110, 117, 115, 116, 
+97, 99, 107, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 
+95, 85, 80, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 
+95, 68, 79, 87, 78, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 75, 
+69, 89, 95, 80, 71, 68, 78, 0, 3, 0, 0, 0, 0, 0, 0, 0, 
+64, 4, 9, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 80, 71, 
+85, 80, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 109, 97, 120, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 82, 69, 84, 
+85, 82, 78, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 
+95, 82, 73, 71, 72, 84, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 
+116, 121, 112, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 
+114, 105, 110, 103, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 105, 100, 
+0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 76, 69, 
+70, 84, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 
+69, 83, 67, 65, 80, 69, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+75, 69, 89, 95, 94, 67, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+75, 69, 89, 95, 94, 88, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 
+97, 99, 99, 101, 108, 101, 114, 97, 116, 111, 114, 115, 0, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 94, 86, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 68, 114, 97, 119, 83, 116, 97, 116, 117, 
+115, 76, 105, 110, 101, 0, 4, 41, 0, 0, 0, 0, 0, 0, 0, 80, 
+114, 101, 115, 115, 32, 110, 101, 119, 32, 97, 99, 99, 101, 108, 101, 114, 
+97, 116, 111, 114, 32, 107, 101, 121, 32, 102, 111, 114, 32, 109, 101, 110, 
+117, 32, 105, 116, 101, 109, 46, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 109, 97, 116, 99, 104, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 
+94, 75, 69, 89, 95, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 103, 
+115, 117, 98, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 
+101, 115, 115, 97, 103, 101, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+83, 111, 114, 114, 121, 44, 32, 0, 4, 29, 0, 0, 0, 0, 0, 0, 
+0, 32, 105, 115, 32, 97, 108, 114, 101, 97, 100, 121, 32, 98, 111, 117, 
+110, 100, 32, 101, 108, 115, 101, 119, 104, 101, 114, 101, 46, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 69, 83, 67, 65, 80, 69, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 82, 69, 83, 73, 90, 69, 0, 4, 25, 
+0, 0, 0, 0, 0, 0, 0, 89, 111, 117, 32, 99, 97, 110, 39, 116, 
+32, 98, 105, 110, 100, 32, 116, 104, 97, 116, 32, 107, 101, 121, 46, 0, 
+4, 7, 0, 0, 0, 0, 0, 0, 0, 75, 69, 89, 95, 94, 82, 0, 
+4, 15, 0, 0, 0, 0, 0, 0, 0, 80, 114, 111, 109, 112, 116, 70, 
+111, 114, 89, 101, 115, 78, 111, 0, 4, 24, 0, 0, 0, 0, 0, 0, 
+0, 82, 101, 115, 101, 116, 32, 109, 101, 110, 117, 32, 107, 101, 121, 98, 
+105, 110, 100, 105, 110, 103, 115, 63, 0, 4, 45, 0, 0, 0, 0, 0, 
+0, 0, 65, 114, 101, 32, 121, 111, 117, 32, 115, 117, 114, 101, 32, 121, 
+111, 117, 32, 119, 97, 110, 116, 32, 116, 111, 32, 114, 101, 115, 101, 116, 
+32, 97, 108, 108, 32, 116, 104, 101, 32, 109, 101, 110, 117, 32, 0, 4, 
+36, 0, 0, 0, 0, 0, 0, 0, 107, 101, 121, 98, 105, 110, 100, 105, 
+110, 103, 115, 32, 98, 97, 99, 107, 32, 116, 111, 32, 116, 104, 101, 105, 
+114, 32, 100, 101, 102, 97, 117, 108, 116, 115, 63, 0, 4, 12, 0, 0, 
+0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 109, 101, 110, 117, 0, 4, 
+11, 0, 0, 0, 0, 0, 0, 0, 67, 114, 101, 97, 116, 101, 77, 101, 
+110, 117, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 116, 111, 117, 99, 
+104, 0, 4, 59, 0, 0, 0, 0, 0, 0, 0, 65, 108, 108, 32, 107, 
+101, 121, 98, 105, 110, 100, 105, 110, 103, 115, 32, 104, 97, 118, 101, 32, 
+98, 101, 101, 110, 32, 114, 101, 115, 101, 116, 32, 116, 111, 32, 116, 104, 
+101, 105, 114, 32, 100, 101, 102, 97, 117, 108, 116, 32, 115, 101, 116, 116, 
+105, 110, 103, 115, 46, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 109, 
+107, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 102, 110, 0, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 73, 115, 77, 101, 110, 117, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 110, 0, 4, 4, 0, 0, 0, 0, 
+0, 0, 0, 116, 111, 112, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 
+114, 117, 110, 109, 101, 110, 117, 0, 3, 0, 0, 0, 0, 0, 0, 16, 
+64, 1, 1, 1, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 77, 111, 
+100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 4, 20, 0, 0, 0, 
+0, 0, 0, 0, 78, 111, 116, 32, 105, 109, 112, 108, 101, 109, 101, 110, 
+116, 101, 100, 32, 121, 101, 116, 0, 4, 81, 0, 0, 0, 0, 0, 0, 
+0, 83, 111, 114, 114, 121, 44, 32, 116, 104, 97, 116, 32, 102, 101, 97, 
+116, 117, 114, 101, 32, 105, 115, 110, 39, 116, 32, 105, 109, 112, 108, 101, 
+109, 101, 110, 116, 101, 100, 32, 121, 101, 116, 46, 32, 40, 84, 104, 105, 
+115, 32, 115, 104, 111, 117, 108, 100, 32, 110, 101, 118, 101, 114, 32, 104, 
+97, 112, 112, 101, 110, 46, 32, 67, 111, 109, 112, 108, 97, 105, 110, 46, 
+41, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 82, 117, 110, 77, 101, 
+110, 117, 65, 99, 116, 105, 111, 110, 0, 0, 0, 0, 0, 5, 0, 0, 
+0, 0, 0, 1, 3, 1, 0, 1, 12, 1, 10, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 
+1, 0, 0, 236, 1, 0, 0, 2, 0, 6, 33, 0, 0, 0, 140, 0, 
+192, 0, 1, 65, 0, 0, 65, 129, 0, 0, 157, 128, 0, 2, 64, 0, 
+0, 1, 134, 192, 64, 0, 192, 0, 128, 0, 157, 128, 0, 1, 155, 64, 
+0, 0, 23, 64, 0, 128, 135, 0, 65, 0, 135, 64, 0, 1, 155, 64, 
+0, 0, 23, 64, 0, 128, 196, 0, 0, 0, 223, 0, 0, 1, 196, 0, 
+0, 0, 6, 65, 65, 0, 64, 1, 0, 1, 29, 129, 0, 1, 24, 128, 
+65, 2, 23, 64, 0, 128, 192, 0, 0, 1, 23, 128, 1, 128, 6, 129, 
+128, 0, 27, 65, 0, 0, 23, 128, 0, 128, 101, 1, 0, 0, 192, 0, 
+128, 2, 23, 0, 0, 128, 199, 192, 65, 2, 223, 0, 0, 1, 31, 0, 
+128, 0, 8, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 103, 
+115, 117, 98, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 94, 75, 69, 
+89, 95, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 19, 0, 
+0, 0, 0, 0, 0, 0, 67, 104, 101, 99, 107, 79, 118, 101, 114, 114, 
+105, 100, 101, 84, 97, 98, 108, 101, 0, 4, 13, 0, 0, 0, 0, 0, 
+0, 0, 97, 99, 99, 101, 108, 101, 114, 97, 116, 111, 114, 115, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 116, 121, 112, 101, 0, 4, 9, 0, 
+0, 0, 0, 0, 0, 0, 102, 117, 110, 99, 116, 105, 111, 110, 0, 4, 
+3, 0, 0, 0, 0, 0, 0, 0, 102, 110, 0, 1, 0, 0, 0, 227, 
+1, 0, 0, 229, 1, 0, 0, 0, 0, 4, 7, 0, 0, 0, 6, 0, 
+64, 0, 65, 64, 0, 0, 133, 0, 128, 0, 193, 128, 0, 0, 86, 192, 
+128, 0, 29, 64, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 16, 
+0, 0, 0, 0, 0, 0, 0, 78, 111, 110, 109, 111, 100, 97, 108, 77, 
+101, 115, 115, 97, 103, 101, 0, 4, 19, 0, 0, 0, 0, 0, 0, 0, 
+77, 101, 110, 117, 32, 105, 116, 101, 109, 32, 119, 105, 116, 104, 32, 73, 
+68, 32, 0, 4, 12, 0, 0, 0, 0, 0, 0, 0, 32, 110, 111, 116, 
+32, 102, 111, 117, 110, 100, 46, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 10, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 239, 1, 0, 0, 251, 1, 0, 0, 0, 0, 7, 19, 
+0, 0, 0, 11, 0, 0, 0, 70, 0, 64, 0, 133, 0, 128, 0, 93, 
+0, 1, 1, 23, 64, 0, 128, 10, 64, 1, 2, 10, 0, 129, 2, 98, 
+128, 0, 0, 227, 192, 254, 127, 75, 64, 0, 0, 74, 0, 128, 128, 134, 
+128, 64, 0, 192, 0, 128, 0, 11, 65, 0, 0, 70, 1, 65, 0, 10, 
+65, 129, 129, 157, 64, 128, 1, 95, 0, 0, 1, 31, 0, 128, 0, 5, 
+0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 112, 97, 105, 114, 
+115, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 97, 99, 99, 101, 108, 
+101, 114, 97, 116, 111, 114, 115, 0, 4, 13, 0, 0, 0, 0, 0, 0, 
+0, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 0, 4, 8, 
+0, 0, 0, 0, 0, 0, 0, 95, 95, 105, 110, 100, 101, 120, 0, 4, 
+10, 0, 0, 0, 0, 0, 0, 0, 77, 101, 110, 117, 67, 108, 97, 115, 
+115, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 11, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 253, 1, 0, 0, 17, 2, 0, 0, 1, 0, 15, 45, 0, 0, 
+0, 69, 0, 0, 0, 133, 0, 128, 0, 93, 64, 0, 1, 75, 0, 0, 
+0, 134, 0, 64, 1, 192, 0, 0, 0, 157, 0, 1, 1, 23, 0, 7, 
+128, 196, 1, 0, 0, 26, 64, 192, 2, 23, 0, 1, 128, 6, 130, 64, 
+1, 78, 194, 192, 2, 29, 130, 0, 1, 192, 1, 0, 4, 23, 0, 1, 
+128, 6, 2, 65, 1, 7, 66, 65, 4, 77, 130, 193, 2, 29, 130, 0, 
+1, 192, 1, 0, 4, 21, 2, 128, 0, 13, 194, 64, 4, 75, 2, 128, 
+2, 129, 194, 1, 0, 192, 2, 128, 2, 150, 194, 2, 5, 192, 2, 128, 
+3, 7, 3, 66, 3, 65, 67, 2, 0, 135, 131, 66, 3, 22, 131, 3, 
+6, 68, 3, 0, 0, 165, 3, 0, 0, 100, 66, 128, 2, 74, 64, 2, 
+4, 151, 193, 255, 127, 162, 128, 0, 0, 35, 1, 248, 127, 133, 0, 128, 
+1, 193, 192, 2, 0, 0, 1, 128, 0, 69, 1, 128, 0, 157, 64, 0, 
+2, 31, 0, 128, 0, 12, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 105, 112, 97, 105, 114, 115, 0, 3, 0, 0, 0, 0, 0, 0, 
+36, 64, 4, 9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 115, 116, 114, 
+105, 110, 103, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 7, 0, 
+0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 99, 104, 97, 114, 0, 3, 0, 0, 0, 0, 
+0, 0, 75, 64, 4, 3, 0, 0, 0, 0, 0, 0, 0, 83, 80, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 58, 32, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 100, 101, 115, 99, 0, 4, 17, 0, 0, 0, 0, 0, 0, 
+0, 80, 97, 114, 97, 103, 114, 97, 112, 104, 32, 83, 116, 121, 108, 101, 
+115, 0, 1, 0, 0, 0, 11, 2, 0, 0, 13, 2, 0, 0, 0, 0, 
+2, 5, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 192, 
+0, 29, 64, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 4, 0, 
+0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 21, 0, 0, 0, 0, 
+0, 0, 0, 67, 104, 97, 110, 103, 101, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 83, 116, 121, 108, 101, 0, 4, 5, 0, 0, 0, 0, 0, 0, 
+0, 110, 97, 109, 101, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 
+1, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 1, 14, 1, 16, 0, 0, 
+1, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 19, 2, 0, 0, 52, 2, 0, 0, 1, 0, 
+17, 60, 0, 0, 0, 75, 0, 0, 0, 134, 0, 64, 0, 197, 0, 128, 
+0, 157, 0, 1, 1, 23, 0, 2, 128, 198, 65, 64, 0, 199, 129, 192, 
+3, 199, 193, 192, 3, 7, 2, 65, 3, 199, 1, 130, 3, 219, 1, 0, 
+0, 23, 64, 0, 128, 7, 66, 65, 3, 74, 192, 1, 4, 162, 128, 0, 
+0, 35, 1, 253, 127, 133, 0, 0, 1, 197, 0, 128, 0, 157, 64, 0, 
+1, 139, 0, 0, 0, 198, 0, 64, 0, 0, 1, 0, 0, 221, 0, 1, 
+1, 23, 192, 6, 128, 7, 130, 193, 3, 7, 2, 130, 0, 68, 2, 0, 
+0, 26, 192, 65, 3, 23, 0, 1, 128, 134, 2, 66, 0, 206, 66, 66, 
+3, 157, 130, 0, 1, 64, 2, 0, 5, 23, 0, 1, 128, 134, 130, 66, 
+0, 135, 194, 66, 5, 205, 2, 67, 3, 157, 130, 0, 1, 64, 2, 0, 
+5, 149, 2, 0, 1, 141, 66, 66, 5, 203, 2, 128, 2, 1, 67, 3, 
+0, 64, 3, 0, 3, 22, 67, 3, 6, 64, 3, 128, 4, 135, 131, 193, 
+3, 192, 3, 0, 4, 37, 4, 0, 0, 228, 66, 128, 2, 138, 192, 2, 
+5, 215, 193, 255, 127, 226, 128, 0, 0, 99, 65, 248, 127, 197, 0, 128, 
+1, 1, 129, 3, 0, 64, 1, 0, 1, 133, 1, 128, 0, 221, 64, 0, 
+2, 31, 0, 128, 0, 15, 0, 0, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 12, 0, 0, 0, 0, 0, 
+0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 5, 
+0, 0, 0, 0, 0, 0, 0, 109, 101, 110, 117, 0, 4, 13, 0, 0, 
+0, 0, 0, 0, 0, 97, 99, 99, 101, 108, 101, 114, 97, 116, 111, 114, 
+115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 105, 100, 0, 4, 6, 
+0, 0, 0, 0, 0, 0, 0, 108, 97, 98, 101, 108, 0, 4, 5, 0, 
+0, 0, 0, 0, 0, 0, 110, 97, 109, 101, 0, 3, 0, 0, 0, 0, 
+0, 0, 36, 64, 4, 9, 0, 0, 0, 0, 0, 0, 0, 116, 111, 115, 
+116, 114, 105, 110, 103, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 
+7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 0, 4, 
+5, 0, 0, 0, 0, 0, 0, 0, 99, 104, 97, 114, 0, 3, 0, 0, 
+0, 0, 0, 0, 75, 64, 4, 2, 0, 0, 0, 0, 0, 0, 0, 68, 
+0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 
+110, 116, 115, 0, 1, 0, 0, 0, 44, 2, 0, 0, 46, 2, 0, 0, 
+0, 0, 2, 5, 0, 0, 0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 
+128, 192, 0, 29, 64, 0, 1, 31, 0, 128, 0, 3, 0, 0, 0, 4, 
+4, 0, 0, 0, 0, 0, 0, 0, 67, 109, 100, 0, 4, 15, 0, 0, 
+0, 0, 0, 0, 0, 67, 104, 97, 110, 103, 101, 68, 111, 99, 117, 109, 
+101, 110, 116, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 110, 97, 109, 
+101, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 7, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 4, 0, 0, 0, 0, 0, 1, 15, 1, 14, 1, 13, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 54, 2, 0, 0, 69, 2, 0, 0, 0, 0, 4, 10, 0, 0, 
+0, 37, 0, 0, 0, 70, 0, 64, 0, 71, 64, 192, 0, 76, 128, 192, 
+0, 193, 192, 0, 0, 93, 64, 128, 1, 64, 0, 0, 0, 133, 0, 128, 
+0, 93, 64, 0, 1, 31, 0, 128, 0, 4, 0, 0, 0, 4, 3, 0, 
+0, 0, 0, 0, 0, 0, 105, 111, 0, 4, 7, 0, 0, 0, 0, 0, 
+0, 0, 115, 116, 100, 111, 117, 116, 0, 4, 6, 0, 0, 0, 0, 0, 
+0, 0, 119, 114, 105, 116, 101, 0, 4, 28, 0, 0, 0, 0, 0, 0, 
+0, 65, 108, 108, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 32, 109, 
+101, 110, 117, 32, 105, 116, 101, 109, 115, 58, 10, 10, 0, 1, 0, 0, 
+0, 55, 2, 0, 0, 65, 2, 0, 0, 1, 0, 12, 30, 0, 0, 0, 
+70, 0, 64, 0, 128, 0, 0, 0, 93, 0, 1, 1, 23, 128, 5, 128, 
+134, 65, 64, 0, 192, 1, 128, 2, 157, 129, 0, 1, 155, 1, 0, 0, 
+23, 64, 4, 128, 134, 129, 64, 0, 135, 193, 64, 3, 140, 1, 65, 3, 
+6, 66, 65, 0, 7, 130, 65, 4, 65, 194, 1, 0, 135, 2, 194, 2, 
+199, 66, 194, 2, 29, 2, 0, 2, 157, 65, 0, 0, 134, 65, 64, 0, 
+199, 129, 194, 2, 157, 129, 0, 1, 155, 1, 0, 0, 23, 128, 0, 128, 
+133, 1, 128, 0, 199, 129, 194, 2, 157, 65, 0, 1, 98, 128, 0, 0, 
+227, 128, 249, 127, 31, 0, 128, 0, 11, 0, 0, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 7, 0, 0, 
+0, 0, 0, 0, 0, 73, 115, 77, 101, 110, 117, 0, 4, 3, 0, 0, 
+0, 0, 0, 0, 0, 105, 111, 0, 4, 7, 0, 0, 0, 0, 0, 0, 
+0, 115, 116, 100, 111, 117, 116, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 119, 114, 105, 116, 101, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+115, 116, 114, 105, 110, 103, 0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 
+102, 111, 114, 109, 97, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 
+37, 49, 53, 115, 32, 37, 115, 10, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 105, 100, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 108, 97, 
+98, 101, 108, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 102, 110, 0, 
+0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 0, 0, 0, 0, 0, 1, 28, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/cli.lua */
+static const char file_42[] = {
+27, 76, 117, 97, 82, 0, 1, 4, 8, 4, 8, 0, 25, 147, 13, 10, 
+26, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 6, 47, 0, 0, 
+0, 6, 0, 64, 0, 7, 64, 64, 0, 70, 128, 64, 0, 71, 192, 192, 
+0, 134, 0, 65, 0, 135, 64, 65, 1, 203, 0, 1, 0, 6, 193, 65, 
+0, 7, 1, 66, 2, 202, 0, 1, 131, 6, 193, 65, 0, 7, 129, 66, 
+2, 202, 0, 129, 132, 6, 193, 65, 0, 7, 1, 67, 2, 202, 0, 129, 
+133, 6, 193, 65, 0, 7, 129, 67, 2, 202, 0, 129, 134, 11, 129, 1, 
+0, 70, 193, 65, 0, 71, 193, 195, 2, 10, 65, 1, 131, 70, 193, 65, 
+0, 71, 1, 196, 2, 10, 65, 129, 132, 70, 193, 65, 0, 71, 65, 196, 
+2, 10, 65, 129, 133, 70, 193, 65, 0, 71, 193, 196, 2, 10, 65, 1, 
+137, 70, 193, 65, 0, 71, 65, 197, 2, 10, 65, 1, 138, 70, 193, 65, 
+0, 71, 129, 197, 2, 10, 65, 129, 134, 101, 1, 0, 0, 8, 64, 129, 
+139, 101, 65, 0, 0, 8, 64, 1, 140, 101, 129, 0, 0, 8, 64, 129, 
+140, 101, 193, 0, 0, 8, 64, 1, 141, 31, 0, 128, 0, 27, 0, 0, 
+0, 4, 7, 0, 0, 0, 0, 0, 0, 0, 115, 116, 114, 105, 110, 103, 
+0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 102, 105, 110, 100, 0, 4, 
+6, 0, 0, 0, 0, 0, 0, 0, 116, 97, 98, 108, 101, 0, 4, 7, 
+0, 0, 0, 0, 0, 0, 0, 99, 111, 110, 99, 97, 116, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 105, 111, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 115, 116, 100, 101, 114, 114, 0, 4, 3, 0, 0, 0, 0, 
+0, 0, 0, 119, 103, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 67, 
+109, 100, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 76, 111, 97, 100, 
+68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 4, 4, 0, 0, 
+0, 0, 0, 0, 0, 111, 100, 116, 0, 4, 14, 0, 0, 0, 0, 0, 
+0, 0, 73, 109, 112, 111, 114, 116, 79, 68, 84, 70, 105, 108, 101, 0, 
+4, 5, 0, 0, 0, 0, 0, 0, 0, 104, 116, 109, 108, 0, 4, 15, 
+0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 114, 116, 72, 84, 77, 
+76, 70, 105, 108, 101, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 116, 
+120, 116, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 73, 109, 112, 111, 
+114, 116, 84, 101, 120, 116, 70, 105, 108, 101, 0, 4, 22, 0, 0, 0, 
+0, 0, 0, 0, 83, 97, 118, 101, 67, 117, 114, 114, 101, 110, 116, 68, 
+111, 99, 117, 109, 101, 110, 116, 65, 115, 0, 4, 14, 0, 0, 0, 0, 
+0, 0, 0, 69, 120, 112, 111, 114, 116, 79, 68, 84, 70, 105, 108, 101, 
+0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 
+72, 84, 77, 76, 70, 105, 108, 101, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 116, 114, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 69, 120, 
+112, 111, 114, 116, 84, 114, 111, 102, 102, 70, 105, 108, 101, 0, 4, 4, 
+0, 0, 0, 0, 0, 0, 0, 116, 101, 120, 0, 4, 16, 0, 0, 0, 
+0, 0, 0, 0, 69, 120, 112, 111, 114, 116, 76, 97, 116, 101, 120, 70, 
+105, 108, 101, 0, 4, 15, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 
+111, 114, 116, 84, 101, 120, 116, 70, 105, 108, 101, 0, 4, 11, 0, 0, 
+0, 0, 0, 0, 0, 67, 76, 73, 77, 101, 115, 115, 97, 103, 101, 0, 
+4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 69, 114, 114, 111, 
+114, 0, 4, 10, 0, 0, 0, 0, 0, 0, 0, 69, 110, 103, 97, 103, 
+101, 67, 76, 73, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 67, 108, 
+105, 67, 111, 110, 118, 101, 114, 116, 0, 4, 0, 0, 0, 27, 0, 0, 
+0, 31, 0, 0, 0, 0, 1, 4, 13, 0, 0, 0, 5, 0, 0, 0, 
+12, 0, 64, 0, 129, 64, 0, 0, 230, 0, 0, 0, 29, 64, 0, 0, 
+5, 0, 0, 0, 12, 0, 64, 0, 129, 128, 0, 0, 29, 64, 128, 1, 
+5, 0, 0, 0, 12, 192, 64, 0, 29, 64, 0, 1, 31, 0, 128, 0, 
+4, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 119, 114, 105, 
+116, 101, 0, 4, 14, 0, 0, 0, 0, 0, 0, 0, 119, 111, 114, 100, 
+103, 114, 105, 110, 100, 101, 114, 58, 32, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 10, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 102, 108, 
+117, 115, 104, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 2, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 33, 0, 0, 0, 36, 0, 0, 0, 0, 1, 2, 8, 0, 0, 
+0, 6, 0, 64, 0, 102, 0, 0, 0, 29, 64, 0, 0, 6, 64, 64, 
+0, 7, 128, 64, 0, 65, 192, 0, 0, 29, 64, 0, 1, 31, 0, 128, 
+0, 4, 0, 0, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 67, 76, 
+73, 77, 101, 115, 115, 97, 103, 101, 0, 4, 3, 0, 0, 0, 0, 0, 
+0, 0, 111, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 101, 120, 
+105, 116, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 
+1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 52, 0, 
+0, 0, 0, 0, 2, 5, 0, 0, 0, 37, 0, 0, 0, 8, 0, 0, 
+128, 37, 64, 0, 0, 8, 0, 128, 128, 31, 0, 128, 0, 2, 0, 0, 
+0, 4, 17, 0, 0, 0, 0, 0, 0, 0, 73, 109, 109, 101, 100, 105, 
+97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 0, 4, 13, 0, 0, 0, 
+0, 0, 0, 0, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 
+0, 2, 0, 0, 0, 41, 0, 0, 0, 45, 0, 0, 0, 1, 0, 3, 
+6, 0, 0, 0, 27, 0, 0, 0, 23, 128, 0, 128, 70, 0, 64, 0, 
+128, 0, 0, 0, 93, 64, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 
+4, 11, 0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 77, 101, 115, 115, 
+97, 103, 101, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 47, 0, 0, 0, 51, 0, 0, 0, 2, 0, 4, 6, 0, 0, 
+0, 91, 0, 0, 0, 23, 128, 0, 128, 134, 0, 64, 0, 192, 0, 128, 
+0, 157, 64, 0, 1, 31, 0, 128, 0, 1, 0, 0, 0, 4, 11, 0, 
+0, 0, 0, 0, 0, 0, 67, 76, 73, 77, 101, 115, 115, 97, 103, 101, 
+0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 163, 0, 0, 
+0, 1, 1, 29, 161, 0, 0, 0, 70, 0, 64, 0, 93, 64, 128, 0, 
+101, 0, 0, 0, 128, 0, 128, 0, 192, 0, 0, 0, 157, 64, 1, 1, 
+128, 1, 0, 1, 193, 65, 0, 0, 0, 2, 128, 1, 150, 1, 2, 3, 
+229, 65, 0, 0, 6, 194, 128, 1, 27, 66, 0, 0, 23, 64, 2, 128, 
+70, 130, 64, 0, 129, 194, 0, 0, 192, 2, 128, 1, 1, 3, 1, 0, 
+65, 67, 1, 0, 128, 3, 128, 3, 197, 3, 128, 1, 157, 131, 0, 1, 
+193, 131, 1, 0, 93, 66, 128, 3, 75, 2, 0, 0, 139, 2, 0, 0, 
+198, 194, 65, 0, 11, 3, 0, 0, 102, 3, 0, 0, 36, 67, 0, 0, 
+221, 2, 1, 1, 23, 128, 11, 128, 0, 4, 128, 0, 64, 4, 128, 7, 
+29, 68, 1, 1, 0, 5, 0, 8, 65, 69, 0, 0, 128, 5, 128, 8, 
+22, 133, 5, 10, 88, 0, 66, 9, 23, 128, 0, 128, 70, 133, 64, 0, 
+129, 69, 2, 0, 93, 69, 0, 1, 70, 69, 4, 2, 91, 69, 0, 0, 
+23, 64, 2, 128, 134, 133, 64, 0, 193, 133, 2, 0, 0, 6, 128, 8, 
+65, 6, 1, 0, 129, 70, 1, 0, 192, 6, 128, 3, 5, 7, 0, 2, 
+221, 134, 0, 1, 1, 135, 1, 0, 157, 69, 128, 3, 149, 5, 128, 4, 
+141, 197, 66, 11, 203, 5, 128, 1, 0, 6, 128, 10, 64, 6, 0, 10, 
+134, 6, 67, 0, 192, 6, 128, 8, 157, 134, 0, 1, 24, 64, 67, 13, 
+23, 0, 0, 128, 131, 70, 0, 0, 131, 6, 128, 0, 228, 69, 128, 1, 
+74, 194, 5, 11, 149, 5, 128, 4, 135, 133, 133, 4, 135, 133, 67, 11, 
+155, 5, 0, 0, 23, 128, 0, 128, 149, 5, 0, 5, 141, 197, 66, 11, 
+138, 2, 5, 11, 226, 130, 0, 0, 99, 131, 243, 127, 213, 2, 0, 5, 
+25, 192, 195, 5, 23, 64, 0, 128, 203, 2, 0, 0, 128, 2, 128, 5, 
+192, 2, 0, 4, 0, 3, 0, 3, 221, 130, 0, 1, 219, 66, 0, 0, 
+23, 128, 0, 128, 198, 130, 64, 0, 1, 3, 4, 0, 221, 66, 0, 1, 
+88, 0, 66, 2, 23, 0, 6, 128, 24, 64, 196, 1, 23, 192, 3, 128, 
+198, 130, 68, 0, 204, 194, 196, 5, 221, 130, 0, 1, 7, 67, 129, 5, 
+27, 67, 0, 0, 23, 0, 1, 128, 6, 131, 64, 0, 65, 3, 5, 0, 
+128, 3, 128, 2, 193, 67, 5, 0, 29, 67, 0, 2, 6, 131, 68, 0, 
+12, 131, 69, 6, 128, 3, 128, 2, 29, 67, 128, 1, 23, 128, 1, 128, 
+198, 194, 69, 0, 199, 2, 198, 5, 6, 131, 68, 0, 12, 67, 70, 6, 
+128, 3, 128, 5, 192, 3, 128, 2, 29, 67, 0, 2, 198, 194, 65, 0, 
+0, 3, 128, 4, 221, 2, 1, 1, 23, 64, 3, 128, 7, 132, 195, 7, 
+27, 4, 0, 0, 23, 128, 0, 128, 21, 4, 0, 5, 24, 128, 70, 8, 
+23, 192, 1, 128, 7, 196, 194, 7, 71, 196, 195, 7, 29, 132, 0, 1, 
+27, 68, 0, 0, 23, 128, 0, 128, 6, 132, 64, 0, 65, 4, 4, 0, 
+29, 68, 0, 1, 226, 130, 0, 0, 99, 195, 251, 127, 213, 2, 0, 5, 
+25, 192, 2, 141, 23, 192, 2, 128, 198, 194, 70, 0, 1, 3, 7, 0, 
+221, 66, 0, 1, 198, 66, 71, 0, 6, 195, 69, 0, 64, 3, 0, 5, 
+221, 194, 128, 1, 219, 66, 0, 0, 23, 128, 0, 128, 70, 131, 64, 0, 
+128, 3, 0, 6, 93, 67, 0, 1, 198, 130, 71, 0, 199, 194, 199, 5, 
+1, 131, 6, 0, 221, 66, 0, 1, 31, 0, 128, 0, 32, 0, 0, 0, 
+4, 10, 0, 0, 0, 0, 0, 0, 0, 69, 110, 103, 97, 103, 101, 67, 
+76, 73, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 46, 0, 4, 9, 
+0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 69, 114, 114, 111, 114, 0, 
+4, 37, 0, 0, 0, 0, 0, 0, 0, 100, 111, 110, 39, 116, 32, 107, 
+110, 111, 119, 32, 104, 111, 119, 32, 116, 111, 32, 105, 109, 112, 111, 114, 
+116, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 39, 0, 4, 3, 
+0, 0, 0, 0, 0, 0, 0, 39, 32, 0, 4, 28, 0, 0, 0, 0, 
+0, 0, 0, 40, 115, 117, 112, 112, 111, 114, 116, 101, 100, 32, 101, 120, 
+116, 101, 110, 115, 105, 111, 110, 115, 32, 97, 114, 101, 58, 32, 0, 4, 
+2, 0, 0, 0, 0, 0, 0, 0, 41, 0, 4, 7, 0, 0, 0, 0, 
+0, 0, 0, 105, 112, 97, 105, 114, 115, 0, 4, 1, 0, 0, 0, 0, 
+0, 0, 0, 0, 4, 55, 0, 0, 0, 0, 0, 0, 0, 121, 111, 117, 
+32, 99, 97, 110, 110, 111, 116, 32, 115, 112, 101, 99, 105, 102, 121, 32, 
+97, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 110, 97, 109, 101, 32, 
+102, 111, 114, 32, 116, 104, 101, 32, 111, 117, 116, 112, 117, 116, 32, 102, 
+105, 108, 101, 0, 4, 37, 0, 0, 0, 0, 0, 0, 0, 100, 111, 110, 
+39, 116, 32, 107, 110, 111, 119, 32, 104, 111, 119, 32, 116, 111, 32, 101, 
+120, 112, 111, 114, 116, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 
+39, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 4, 12, 0, 0, 0, 
+0, 0, 0, 0, 71, 101, 116, 69, 120, 112, 111, 114, 116, 101, 114, 0, 
+0, 3, 0, 0, 0, 0, 0, 0, 8, 64, 3, 0, 0, 0, 0, 0, 
+0, 0, 64, 4, 7, 0, 0, 0, 0, 0, 0, 0, 102, 97, 105, 108, 
+101, 100, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 119, 103, 0, 4, 
+12, 0, 0, 0, 0, 0, 0, 0, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 0, 4, 16, 0, 0, 0, 0, 0, 0, 0, 103, 101, 116, 
+68, 111, 99, 117, 109, 101, 110, 116, 76, 105, 115, 116, 0, 4, 19, 0, 
+0, 0, 0, 0, 0, 0, 110, 111, 32, 115, 117, 99, 104, 32, 100, 111, 
+99, 117, 109, 101, 110, 116, 32, 39, 0, 4, 2, 0, 0, 0, 0, 0, 
+0, 0, 39, 0, 4, 11, 0, 0, 0, 0, 0, 0, 0, 115, 101, 116, 
+67, 117, 114, 114, 101, 110, 116, 0, 4, 9, 0, 0, 0, 0, 0, 0, 
+0, 68, 111, 99, 117, 109, 101, 110, 116, 0, 4, 5, 0, 0, 0, 0, 
+0, 0, 0, 110, 97, 109, 101, 0, 4, 15, 0, 0, 0, 0, 0, 0, 
+0, 114, 101, 110, 97, 109, 101, 68, 111, 99, 117, 109, 101, 110, 116, 0, 
+3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 17, 0, 0, 0, 0, 0, 
+0, 0, 73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 
+103, 101, 0, 4, 13, 0, 0, 0, 0, 0, 0, 0, 69, 120, 112, 111, 
+114, 116, 105, 110, 103, 46, 46, 46, 0, 4, 22, 0, 0, 0, 0, 0, 
+0, 0, 69, 120, 112, 111, 114, 116, 84, 111, 77, 117, 108, 116, 105, 112, 
+108, 101, 70, 105, 108, 101, 115, 0, 4, 3, 0, 0, 0, 0, 0, 0, 
+0, 111, 115, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 101, 120, 105, 
+116, 0, 2, 0, 0, 0, 63, 0, 0, 0, 72, 0, 0, 0, 1, 0, 
+11, 19, 0, 0, 0, 69, 0, 0, 0, 128, 0, 0, 0, 193, 0, 0, 
+0, 93, 192, 129, 1, 219, 0, 0, 0, 23, 64, 0, 128, 27, 65, 0, 
+0, 23, 0, 1, 128, 198, 65, 192, 0, 1, 130, 0, 0, 64, 2, 0, 
+0, 129, 194, 0, 0, 221, 65, 0, 2, 192, 1, 128, 1, 0, 2, 0, 
+2, 64, 2, 128, 2, 128, 2, 0, 3, 223, 1, 128, 2, 31, 0, 128, 
+0, 4, 0, 0, 0, 4, 22, 0, 0, 0, 0, 0, 0, 0, 94, 40, 
+46, 42, 41, 37, 46, 40, 37, 119, 42, 41, 40, 58, 63, 41, 40, 46, 
+42, 41, 36, 0, 4, 9, 0, 0, 0, 0, 0, 0, 0, 67, 76, 73, 
+69, 114, 114, 111, 114, 0, 4, 27, 0, 0, 0, 0, 0, 0, 0, 117, 
+110, 97, 98, 108, 101, 32, 116, 111, 32, 112, 97, 114, 115, 101, 32, 102, 
+105, 108, 101, 110, 97, 109, 101, 32, 39, 0, 4, 2, 0, 0, 0, 0, 
+0, 0, 0, 39, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 77, 0, 0, 0, 83, 0, 0, 0, 1, 0, 8, 
+16, 0, 0, 0, 75, 0, 0, 0, 134, 0, 64, 0, 192, 0, 0, 0, 
+157, 0, 1, 1, 23, 128, 0, 128, 213, 1, 128, 0, 205, 65, 192, 3, 
+74, 64, 129, 3, 162, 128, 0, 0, 35, 129, 254, 127, 133, 0, 128, 0, 
+192, 0, 128, 0, 1, 129, 0, 0, 158, 0, 128, 1, 159, 0, 0, 0, 
+31, 0, 128, 0, 3, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 
+0, 112, 97, 105, 114, 115, 0, 3, 0, 0, 0, 0, 0, 0, 240, 63, 
+4, 2, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 2, 
+0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 
+0, 1, 0, 1, 1, 1, 3, 1, 4, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 
+};
+const FileDescriptor script_table[] = {
+{ file_1, sizeof(file_1), "src/lua/_prologue.lua" },
+{ file_2, sizeof(file_2), "src/lua/ffi.lua" },
+{ file_3, sizeof(file_3), "src/lua/events.lua" },
+{ file_4, sizeof(file_4), "src/lua/main.lua" },
+{ file_5, sizeof(file_5), "src/lua/xml.lua" },
+{ file_6, sizeof(file_6), "src/lua/utils.lua" },
+{ file_7, sizeof(file_7), "src/lua/redraw.lua" },
+{ file_8, sizeof(file_8), "src/lua/settings.lua" },
+{ file_9, sizeof(file_9), "src/lua/document.lua" },
+{ file_10, sizeof(file_10), "src/lua/forms.lua" },
+{ file_11, sizeof(file_11), "src/lua/ui.lua" },
+{ file_12, sizeof(file_12), "src/lua/browser.lua" },
+{ file_13, sizeof(file_13), "src/lua/html.lua" },
+{ file_14, sizeof(file_14), "src/lua/margin.lua" },
+{ file_15, sizeof(file_15), "src/lua/fileio.lua" },
+{ file_16, sizeof(file_16), "src/lua/export.lua" },
+{ file_17, sizeof(file_17), "src/lua/export/text.lua" },
+{ file_18, sizeof(file_18), "src/lua/export/html.lua" },
+{ file_19, sizeof(file_19), "src/lua/export/latex.lua" },
+{ file_20, sizeof(file_20), "src/lua/export/troff.lua" },
+{ file_21, sizeof(file_21), "src/lua/export/opendocument.lua" },
+{ file_22, sizeof(file_22), "src/lua/import.lua" },
+{ file_23, sizeof(file_23), "src/lua/import/html.lua" },
+{ file_24, sizeof(file_24), "src/lua/import/text.lua" },
+{ file_25, sizeof(file_25), "src/lua/import/opendocument.lua" },
+{ file_26, sizeof(file_26), "src/lua/navigate.lua" },
+{ file_27, sizeof(file_27), "src/lua/addons/goto.lua" },
+{ file_28, sizeof(file_28), "src/lua/addons/autosave.lua" },
+{ file_29, sizeof(file_29), "src/lua/addons/docsetman.lua" },
+{ file_30, sizeof(file_30), "src/lua/addons/scrapbook.lua" },
+{ file_31, sizeof(file_31), "src/lua/addons/pagecount.lua" },
+{ file_32, sizeof(file_32), "src/lua/addons/statusbar_charstyle.lua" },
+{ file_33, sizeof(file_33), "src/lua/addons/statusbar_position.lua" },
+{ file_34, sizeof(file_34), "src/lua/addons/statusbar_wordcount.lua" },
+{ file_35, sizeof(file_35), "src/lua/addons/debug.lua" },
+{ file_36, sizeof(file_36), "src/lua/addons/widescreen.lua" },
+{ file_37, sizeof(file_37), "src/lua/addons/keymapoverride.lua" },
+{ file_38, sizeof(file_38), "src/lua/addons/smartquotes.lua" },
+{ file_39, sizeof(file_39), "src/lua/addons/undo.lua" },
+{ file_40, sizeof(file_40), "src/lua/addons/spillchocker.lua" },
+{ file_41, sizeof(file_41), "src/lua/menu.lua" },
+{ file_42, sizeof(file_42), "src/lua/cli.lua" },
+{ NULL, 0 }
+};
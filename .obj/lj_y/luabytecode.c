@@ -0,0 +1,8742 @@
+#include "globals.h"
+
+/* This is src/lua/_prologue.lua */
+static const char file_1[] = {
+27, 76, 74, 2, 10, 61, 0, 2, 6, 0, 2, 1, 11, 54, 2, 0, 
+0, 57, 2, 1, 2, 18, 4, 0, 0, 18, 5, 1, 0, 66, 2, 3, 
+2, 9, 2, 0, 0, 88, 2, 2, 128, 43, 2, 1, 0, 88, 3, 1, 
+128, 43, 2, 2, 0, 76, 2, 2, 0, 9, 98, 97, 110, 100, 8, 98, 
+105, 116, 0, 111, 0, 2, 7, 1, 5, 0, 14, 45, 2, 0, 0, 56, 
+2, 1, 2, 14, 0, 2, 0, 88, 2, 6, 128, 54, 2, 0, 0, 39, 
+4, 1, 0, 18, 5, 1, 0, 39, 6, 2, 0, 38, 4, 6, 4, 66, 
+2, 2, 1, 54, 2, 3, 0, 54, 4, 4, 0, 18, 5, 1, 0, 68, 
+2, 3, 0, 0, 192, 7, 95, 71, 11, 114, 97, 119, 103, 101, 116, 6, 
+39, 32, 114, 101, 97, 100, 32, 102, 114, 111, 109, 32, 117, 110, 100, 101, 
+102, 105, 110, 101, 100, 32, 108, 111, 99, 97, 108, 32, 39, 10, 101, 114, 
+114, 111, 114, 165, 5, 3, 0, 6, 0, 24, 0, 52, 54, 0, 0, 0, 
+15, 0, 0, 0, 88, 1, 12, 128, 54, 0, 1, 0, 54, 1, 1, 0, 
+57, 1, 2, 1, 39, 2, 3, 0, 38, 1, 2, 1, 61, 1, 2, 0, 
+54, 0, 1, 0, 54, 1, 1, 0, 57, 1, 4, 1, 39, 2, 5, 0, 
+38, 1, 2, 1, 61, 1, 4, 0, 54, 0, 6, 0, 14, 0, 0, 0, 
+88, 0, 4, 128, 54, 0, 7, 0, 39, 2, 6, 0, 66, 0, 2, 2, 
+55, 0, 6, 0, 54, 0, 8, 0, 14, 0, 0, 0, 88, 0, 13, 128, 
+53, 0, 11, 0, 54, 1, 9, 0, 57, 1, 10, 1, 61, 1, 10, 0, 
+54, 1, 9, 0, 57, 1, 12, 1, 61, 1, 12, 0, 54, 1, 9, 0, 
+57, 1, 13, 1, 61, 1, 13, 0, 51, 1, 14, 0, 61, 1, 15, 0, 
+55, 0, 8, 0, 54, 0, 16, 0, 15, 0, 0, 0, 88, 1, 8, 128, 
+53, 0, 17, 0, 54, 1, 18, 0, 54, 3, 19, 0, 53, 4, 21, 0, 
+51, 5, 20, 0, 61, 5, 22, 4, 66, 1, 3, 1, 50, 0, 0, 128, 
+52, 0, 0, 0, 55, 0, 23, 0, 75, 0, 1, 0, 8, 67, 109, 100, 
+12, 95, 95, 105, 110, 100, 101, 120, 1, 0, 1, 12, 95, 95, 105, 110, 
+100, 101, 120, 0, 0, 7, 95, 71, 17, 115, 101, 116, 109, 101, 116, 97, 
+116, 97, 98, 108, 101, 1, 0, 9, 23, 88, 49, 49, 95, 71, 76, 89, 
+80, 72, 95, 67, 65, 67, 72, 69, 95, 75, 66, 2, 28, 88, 49, 49, 
+95, 71, 76, 89, 80, 72, 95, 67, 65, 67, 72, 69, 95, 69, 78, 84, 
+82, 73, 69, 83, 2, 13, 88, 49, 49, 95, 70, 79, 78, 84, 2, 19, 
+88, 49, 49, 95, 68, 73, 77, 95, 67, 79, 76, 79, 85, 82, 2, 22, 
+88, 49, 49, 95, 66, 82, 73, 71, 72, 84, 95, 67, 79, 76, 79, 85, 
+82, 2, 22, 88, 49, 49, 95, 66, 79, 76, 68, 95, 77, 79, 68, 73, 
+70, 73, 69, 82, 2, 21, 88, 49, 49, 95, 66, 76, 65, 67, 75, 95, 
+67, 79, 76, 79, 85, 82, 2, 22, 88, 49, 49, 95, 78, 79, 82, 77, 
+65, 76, 95, 67, 79, 76, 79, 85, 82, 2, 24, 88, 49, 49, 95, 73, 
+84, 65, 76, 73, 67, 95, 77, 79, 68, 73, 70, 73, 69, 82, 2, 10, 
+68, 69, 66, 85, 71, 10, 98, 116, 101, 115, 116, 0, 8, 98, 111, 114, 
+9, 98, 97, 110, 100, 1, 0, 4, 9, 98, 97, 110, 100, 0, 10, 98, 
+116, 101, 115, 116, 0, 9, 98, 120, 111, 114, 0, 8, 98, 111, 114, 0, 
+9, 98, 120, 111, 114, 8, 98, 105, 116, 10, 98, 105, 116, 51, 50, 12, 
+114, 101, 113, 117, 105, 114, 101, 8, 108, 102, 115, 100, 59, 47, 117, 115, 
+114, 47, 108, 105, 98, 47, 120, 56, 54, 95, 54, 52, 45, 108, 105, 110, 
+117, 120, 45, 103, 110, 117, 47, 108, 117, 97, 47, 53, 46, 49, 47, 63, 
+46, 115, 111, 59, 47, 117, 115, 114, 47, 108, 105, 98, 47, 108, 117, 97, 
+47, 53, 46, 49, 47, 63, 46, 115, 111, 59, 47, 117, 115, 114, 47, 108, 
+111, 99, 97, 108, 47, 108, 105, 98, 47, 108, 117, 97, 47, 53, 46, 49, 
+47, 108, 111, 97, 100, 97, 108, 108, 46, 115, 111, 10, 99, 112, 97, 116, 
+104, 60, 59, 47, 117, 115, 114, 47, 115, 104, 97, 114, 101, 47, 108, 117, 
+97, 47, 53, 46, 49, 47, 63, 46, 108, 117, 97, 59, 47, 117, 115, 114, 
+47, 115, 104, 97, 114, 101, 47, 108, 117, 97, 47, 53, 46, 49, 47, 63, 
+47, 105, 110, 105, 116, 46, 108, 117, 97, 9, 112, 97, 116, 104, 12, 112, 
+97, 99, 107, 97, 103, 101, 8, 106, 105, 116, 0, 
+};
+
+/* This is src/lua/ffi.lua */
+static const char file_2[] = {
+27, 76, 74, 2, 10, 37, 0, 0, 1, 1, 1, 0, 3, 45, 0, 0, 
+0, 57, 0, 0, 0, 76, 0, 2, 0, 2, 192, 20, 98, 117, 102, 102, 
+101, 114, 95, 97, 112, 112, 101, 110, 100, 117, 56, 25, 0, 1, 5, 1, 
+0, 0, 4, 45, 1, 0, 0, 18, 3, 0, 0, 21, 4, 0, 0, 68, 
+1, 3, 0, 4, 192, 73, 0, 7, 17, 1, 0, 0, 16, 45, 7, 0, 
+0, 18, 9, 0, 0, 18, 10, 1, 0, 18, 11, 2, 0, 21, 12, 2, 
+0, 18, 13, 3, 0, 12, 14, 4, 0, 88, 14, 1, 128, 41, 14, 0, 
+0, 12, 15, 5, 0, 88, 15, 1, 128, 41, 15, 0, 0, 12, 16, 6, 
+0, 88, 16, 1, 128, 41, 16, 0, 0, 68, 7, 9, 0, 5, 192, 103, 
+0, 2, 8, 3, 3, 1, 15, 45, 2, 0, 0, 45, 4, 1, 0, 45, 
+6, 2, 0, 18, 7, 0, 0, 66, 4, 3, 2, 18, 5, 1, 0, 66, 
+2, 3, 2, 9, 2, 0, 0, 88, 3, 3, 128, 54, 3, 0, 0, 39, 
+5, 1, 0, 66, 3, 2, 1, 54, 3, 2, 0, 18, 5, 2, 0, 68, 
+3, 2, 0, 6, 192, 3, 192, 7, 192, 13, 116, 111, 110, 117, 109, 98, 
+101, 114, 18, 111, 117, 116, 32, 111, 102, 32, 109, 101, 109, 111, 114, 121, 
+10, 101, 114, 114, 111, 114, 0, 184, 5, 3, 0, 13, 0, 29, 0, 57, 
+54, 0, 0, 0, 54, 2, 1, 0, 39, 3, 2, 0, 66, 0, 3, 2, 
+15, 0, 0, 0, 88, 0, 6, 128, 54, 0, 3, 0, 57, 0, 4, 0, 
+39, 2, 5, 0, 66, 0, 2, 2, 15, 0, 0, 0, 88, 1, 1, 128, 
+50, 0, 42, 128, 54, 0, 6, 0, 54, 2, 7, 0, 39, 3, 8, 0, 
+66, 0, 3, 3, 14, 0, 0, 0, 88, 2, 1, 128, 50, 0, 36, 128, 
+57, 2, 9, 1, 39, 4, 10, 0, 66, 2, 2, 1, 57, 2, 11, 1, 
+54, 3, 6, 0, 51, 5, 12, 0, 66, 3, 2, 2, 14, 0, 3, 0, 
+88, 3, 2, 128, 50, 0, 0, 128, 75, 0, 1, 0, 57, 3, 13, 1, 
+57, 4, 14, 2, 57, 5, 15, 2, 57, 6, 16, 2, 57, 7, 17, 1, 
+39, 9, 18, 0, 66, 7, 2, 2, 54, 8, 19, 0, 51, 9, 21, 0, 
+61, 9, 20, 8, 54, 8, 19, 0, 51, 9, 23, 0, 61, 9, 22, 8, 
+54, 8, 24, 0, 54, 10, 19, 0, 57, 10, 25, 10, 41, 12, 16, 0, 
+66, 10, 2, 0, 65, 8, 0, 2, 57, 8, 26, 8, 51, 9, 28, 0, 
+61, 9, 27, 8, 50, 0, 0, 128, 75, 0, 1, 0, 75, 0, 1, 0, 
+75, 0, 1, 0, 0, 13, 97, 112, 112, 101, 110, 100, 117, 56, 12, 95, 
+95, 105, 110, 100, 101, 120, 17, 99, 114, 101, 97, 116, 101, 98, 117, 102, 
+102, 101, 114, 17, 103, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 
+0, 16, 119, 114, 105, 116, 101, 115, 116, 121, 108, 101, 100, 0, 19, 103, 
+101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 104, 7, 119, 103, 
+19, 115, 116, 114, 117, 99, 116, 32, 98, 117, 102, 102, 101, 114, 42, 11, 
+116, 121, 112, 101, 111, 102, 20, 98, 117, 102, 102, 101, 114, 95, 97, 112, 
+112, 101, 110, 100, 117, 56, 21, 119, 111, 114, 100, 95, 119, 114, 105, 116, 
+101, 115, 116, 121, 108, 101, 100, 26, 115, 99, 114, 101, 101, 110, 95, 103, 
+101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 104, 9, 99, 97, 
+115, 116, 0, 6, 67, 237, 1, 9, 105, 110, 116, 32, 115, 99, 114, 101, 
+101, 110, 95, 103, 101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 
+104, 40, 99, 111, 110, 115, 116, 32, 99, 104, 97, 114, 42, 32, 115, 44, 
+32, 115, 105, 122, 101, 95, 116, 32, 115, 105, 122, 101, 41, 59, 10, 9, 
+105, 110, 116, 32, 119, 111, 114, 100, 95, 119, 114, 105, 116, 101, 115, 116, 
+121, 108, 101, 100, 40, 105, 110, 116, 32, 120, 44, 32, 105, 110, 116, 32, 
+121, 44, 32, 99, 111, 110, 115, 116, 32, 99, 104, 97, 114, 42, 32, 115, 
+44, 32, 115, 105, 122, 101, 95, 116, 32, 115, 105, 122, 101, 44, 10, 9, 
+9, 105, 110, 116, 32, 111, 97, 116, 116, 114, 44, 32, 105, 110, 116, 32, 
+114, 101, 118, 111, 110, 44, 32, 105, 110, 116, 32, 114, 101, 118, 111, 102, 
+102, 44, 32, 105, 110, 116, 32, 115, 111, 114, 41, 59, 10, 9, 115, 116, 
+114, 117, 99, 116, 32, 98, 117, 102, 102, 101, 114, 59, 10, 9, 115, 105, 
+122, 101, 95, 116, 32, 98, 117, 102, 102, 101, 114, 95, 97, 112, 112, 101, 
+110, 100, 117, 56, 40, 115, 116, 114, 117, 99, 116, 32, 98, 117, 102, 102, 
+101, 114, 42, 32, 98, 44, 32, 105, 110, 116, 32, 99, 41, 59, 10, 9, 
+99, 100, 101, 102, 8, 102, 102, 105, 12, 114, 101, 113, 117, 105, 114, 101, 
+10, 112, 99, 97, 108, 108, 23, 87, 79, 82, 68, 71, 82, 73, 78, 68, 
+69, 82, 95, 78, 79, 95, 70, 70, 73, 11, 103, 101, 116, 101, 110, 118, 
+7, 111, 115, 8, 106, 105, 116, 7, 95, 71, 11, 114, 97, 119, 103, 101, 
+116, 0, 
+};
+
+/* This is src/lua/events.lua */
+static const char file_3[] = {
+27, 76, 74, 2, 10, 61, 0, 2, 4, 1, 0, 0, 13, 45, 2, 0, 
+0, 56, 2, 0, 2, 14, 0, 2, 0, 88, 2, 3, 128, 45, 2, 0, 
+0, 52, 3, 0, 0, 60, 3, 0, 2, 52, 2, 3, 0, 62, 0, 1, 
+2, 45, 3, 0, 0, 56, 3, 0, 3, 60, 1, 2, 3, 76, 2, 2, 
+0, 0, 192, 33, 0, 1, 4, 1, 0, 0, 6, 58, 1, 1, 0, 45, 
+2, 0, 0, 56, 2, 1, 2, 43, 3, 0, 0, 60, 3, 0, 2, 75, 
+0, 1, 0, 0, 192, 83, 2, 1, 12, 1, 1, 0, 17, 45, 1, 0, 
+0, 56, 1, 0, 1, 14, 0, 1, 0, 88, 2, 1, 128, 75, 0, 1, 
+0, 54, 2, 0, 0, 18, 4, 1, 0, 66, 2, 2, 4, 72, 5, 5, 
+128, 18, 7, 6, 0, 18, 9, 0, 0, 18, 10, 5, 0, 71, 11, 1, 
+0, 65, 7, 2, 1, 70, 5, 3, 3, 82, 5, 249, 127, 75, 0, 1, 
+0, 0, 192, 10, 112, 97, 105, 114, 115, 25, 0, 1, 3, 1, 0, 0, 
+4, 45, 1, 0, 0, 43, 2, 2, 0, 60, 2, 0, 1, 75, 0, 1, 
+0, 1, 192, 84, 0, 0, 4, 1, 2, 0, 15, 85, 0, 13, 128, 54, 
+0, 0, 0, 45, 2, 0, 0, 66, 0, 2, 2, 14, 0, 0, 0, 88, 
+1, 1, 128, 88, 0, 7, 128, 45, 1, 0, 0, 43, 2, 0, 0, 60, 
+2, 0, 1, 54, 1, 1, 0, 18, 3, 0, 0, 66, 1, 2, 1, 88, 
+0, 242, 127, 75, 0, 1, 0, 1, 192, 14, 70, 105, 114, 101, 69, 118, 
+101, 110, 116, 9, 110, 101, 120, 116, 168, 3, 3, 0, 4, 0, 22, 0, 
+49, 52, 0, 0, 0, 52, 1, 0, 0, 52, 2, 0, 0, 55, 2, 0, 
+0, 54, 2, 0, 0, 52, 3, 0, 0, 61, 3, 1, 2, 54, 2, 0, 
+0, 52, 3, 0, 0, 61, 3, 2, 2, 54, 2, 0, 0, 52, 3, 0, 
+0, 61, 3, 3, 2, 54, 2, 0, 0, 52, 3, 0, 0, 61, 3, 4, 
+2, 54, 2, 0, 0, 52, 3, 0, 0, 61, 3, 5, 2, 54, 2, 0, 
+0, 52, 3, 0, 0, 61, 3, 6, 2, 54, 2, 0, 0, 52, 3, 0, 
+0, 61, 3, 7, 2, 54, 2, 0, 0, 52, 3, 0, 0, 61, 3, 8, 
+2, 54, 2, 0, 0, 52, 3, 0, 0, 61, 3, 9, 2, 54, 2, 0, 
+0, 52, 3, 0, 0, 61, 3, 10, 2, 54, 2, 0, 0, 52, 3, 0, 
+0, 61, 3, 11, 2, 51, 2, 12, 0, 55, 2, 13, 0, 51, 2, 14, 
+0, 55, 2, 15, 0, 51, 2, 16, 0, 55, 2, 17, 0, 51, 2, 18, 
+0, 55, 2, 19, 0, 51, 2, 20, 0, 55, 2, 21, 0, 50, 0, 0, 
+128, 75, 0, 1, 0, 21, 70, 108, 117, 115, 104, 65, 115, 121, 110, 99, 
+69, 118, 101, 110, 116, 115, 0, 19, 70, 105, 114, 101, 65, 115, 121, 110, 
+99, 69, 118, 101, 110, 116, 0, 14, 70, 105, 114, 101, 69, 118, 101, 110, 
+116, 0, 24, 82, 101, 109, 111, 118, 101, 69, 118, 101, 110, 116, 76, 105, 
+115, 116, 101, 110, 101, 114, 0, 21, 65, 100, 100, 69, 118, 101, 110, 116, 
+76, 105, 115, 116, 101, 110, 101, 114, 0, 19, 87, 97, 105, 116, 105, 110, 
+103, 70, 111, 114, 85, 115, 101, 114, 19, 82, 101, 103, 105, 115, 116, 101, 
+114, 65, 100, 100, 111, 110, 115, 11, 82, 101, 100, 114, 97, 119, 10, 77, 
+111, 118, 101, 100, 17, 87, 111, 114, 100, 77, 111, 100, 105, 102, 105, 101, 
+100, 9, 73, 100, 108, 101, 20, 68, 111, 99, 117, 109, 101, 110, 116, 85, 
+112, 103, 114, 97, 100, 101, 19, 68, 111, 99, 117, 109, 101, 110, 116, 76, 
+111, 97, 100, 101, 100, 20, 68, 111, 99, 117, 109, 101, 110, 116, 67, 114, 
+101, 97, 116, 101, 100, 12, 67, 104, 97, 110, 103, 101, 100, 19, 66, 117, 
+105, 108, 100, 83, 116, 97, 116, 117, 115, 66, 97, 114, 10, 69, 118, 101, 
+110, 116, 0, 
+};
+
+/* This is src/lua/main.lua */
+static const char file_4[] = {
+27, 76, 74, 2, 10, 166, 2, 0, 0, 3, 7, 10, 1, 50, 45, 0, 
+0, 0, 14, 0, 0, 0, 88, 0, 4, 128, 49, 0, 2, 0, 45, 0, 
+2, 0, 66, 0, 1, 2, 46, 1, 0, 0, 45, 0, 3, 0, 45, 1, 
+3, 0, 57, 1, 0, 1, 22, 1, 0, 1, 61, 1, 0, 0, 54, 0, 
+1, 0, 15, 0, 0, 0, 88, 1, 34, 128, 45, 0, 4, 0, 54, 1, 
+1, 0, 57, 1, 2, 1, 5, 0, 1, 0, 88, 0, 10, 128, 45, 0, 
+5, 0, 54, 1, 1, 0, 57, 1, 3, 1, 5, 0, 1, 0, 88, 0, 
+5, 128, 45, 0, 6, 0, 54, 1, 1, 0, 57, 1, 4, 1, 4, 0, 
+1, 0, 88, 0, 13, 128, 54, 0, 1, 0, 57, 0, 2, 0, 46, 4, 
+0, 0, 54, 0, 1, 0, 57, 0, 3, 0, 46, 5, 0, 0, 54, 0, 
+1, 0, 57, 0, 4, 0, 46, 6, 0, 0, 54, 0, 5, 0, 54, 2, 
+6, 0, 57, 2, 7, 2, 66, 0, 2, 1, 54, 0, 1, 0, 57, 0, 
+8, 0, 14, 0, 0, 0, 88, 0, 2, 128, 54, 0, 9, 0, 66, 0, 
+1, 1, 75, 0, 1, 0, 13, 128, 14, 128, 12, 192, 16, 192, 18, 128, 
+19, 128, 20, 128, 17, 82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 
+110, 14, 119, 114, 97, 112, 119, 105, 100, 116, 104, 10, 77, 111, 118, 101, 
+100, 10, 69, 118, 101, 110, 116, 14, 70, 105, 114, 101, 69, 118, 101, 110, 
+116, 7, 99, 111, 7, 99, 119, 7, 99, 112, 13, 68, 111, 99, 117, 109, 
+101, 110, 116, 13, 114, 101, 113, 117, 101, 115, 116, 115, 2, 130, 1, 0, 
+0, 8, 1, 4, 0, 20, 52, 0, 0, 0, 54, 1, 0, 0, 45, 3, 
+0, 0, 66, 1, 2, 4, 72, 4, 1, 128, 60, 5, 4, 0, 70, 4, 
+3, 3, 82, 4, 253, 127, 57, 1, 2, 0, 41, 2, 0, 0, 1, 2, 
+1, 0, 88, 1, 5, 128, 57, 1, 3, 0, 57, 2, 2, 0, 35, 1, 
+2, 1, 14, 0, 1, 0, 88, 2, 1, 128, 41, 1, 0, 0, 61, 1, 
+1, 0, 76, 0, 2, 0, 16, 192, 17, 116, 111, 116, 97, 108, 108, 97, 
+116, 101, 110, 99, 121, 11, 102, 114, 97, 109, 101, 115, 19, 97, 118, 101, 
+114, 97, 103, 101, 108, 97, 116, 101, 110, 99, 121, 10, 112, 97, 105, 114, 
+115, 233, 1, 0, 0, 8, 5, 8, 1, 34, 45, 0, 0, 0, 66, 0, 
+1, 2, 54, 1, 0, 0, 66, 1, 1, 1, 45, 1, 0, 0, 66, 1, 
+1, 2, 45, 2, 1, 0, 33, 2, 2, 1, 45, 3, 2, 0, 45, 4, 
+2, 0, 57, 4, 1, 4, 22, 4, 0, 4, 61, 4, 1, 3, 45, 3, 
+2, 0, 33, 4, 0, 1, 61, 4, 2, 3, 45, 3, 2, 0, 61, 2, 
+3, 3, 45, 3, 2, 0, 54, 4, 5, 0, 57, 4, 6, 4, 45, 6, 
+2, 0, 57, 6, 4, 6, 18, 7, 2, 0, 66, 4, 3, 2, 61, 4, 
+4, 3, 45, 3, 2, 0, 45, 4, 2, 0, 57, 4, 7, 4, 32, 4, 
+2, 4, 61, 4, 7, 3, 49, 3, 1, 0, 46, 4, 1, 0, 75, 0, 
+1, 0, 12, 192, 14, 128, 16, 192, 13, 128, 15, 128, 17, 116, 111, 116, 
+97, 108, 108, 97, 116, 101, 110, 99, 121, 8, 109, 97, 120, 9, 109, 97, 
+116, 104, 15, 109, 97, 120, 108, 97, 116, 101, 110, 99, 121, 16, 108, 97, 
+115, 116, 108, 97, 116, 101, 110, 99, 121, 18, 108, 97, 115, 116, 102, 114, 
+97, 109, 101, 116, 105, 109, 101, 11, 102, 114, 97, 109, 101, 115, 17, 82, 
+101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 2, 129, 2, 0, 0, 
+5, 5, 9, 1, 39, 54, 0, 0, 0, 57, 0, 1, 0, 85, 1, 35, 
+128, 45, 1, 0, 0, 15, 0, 1, 0, 88, 2, 20, 128, 45, 1, 1, 
+0, 57, 2, 2, 0, 30, 2, 0, 2, 32, 1, 2, 1, 45, 2, 2, 
+0, 66, 2, 1, 2, 33, 1, 2, 1, 41, 2, 0, 0, 3, 1, 2, 
+0, 88, 2, 3, 128, 45, 2, 3, 0, 66, 2, 1, 1, 88, 2, 239, 
+127, 45, 2, 4, 0, 18, 4, 1, 0, 66, 2, 2, 2, 6, 2, 3, 
+0, 88, 3, 234, 127, 76, 2, 2, 0, 88, 1, 232, 127, 45, 1, 4, 
+0, 54, 3, 4, 0, 57, 3, 5, 3, 66, 1, 2, 2, 6, 1, 3, 
+0, 88, 2, 1, 128, 76, 1, 2, 0, 54, 2, 6, 0, 54, 4, 7, 
+0, 57, 4, 8, 4, 66, 2, 2, 1, 88, 1, 220, 127, 75, 0, 1, 
+0, 13, 128, 15, 128, 12, 192, 21, 192, 11, 192, 9, 73, 100, 108, 101, 
+10, 69, 118, 101, 110, 116, 14, 70, 105, 114, 101, 69, 118, 101, 110, 116, 
+13, 105, 100, 108, 101, 116, 105, 109, 101, 16, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 16, 75, 69, 89, 95, 84, 73, 77, 69, 79, 85, 
+84, 11, 109, 97, 120, 102, 112, 115, 11, 114, 101, 100, 114, 97, 119, 19, 
+71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 2, 133, 
+1, 0, 0, 2, 0, 4, 1, 20, 54, 0, 0, 0, 54, 1, 0, 0, 
+57, 1, 1, 1, 14, 0, 1, 0, 88, 2, 1, 128, 52, 1, 0, 0, 
+61, 1, 1, 0, 54, 0, 0, 0, 57, 0, 1, 0, 57, 1, 2, 0, 
+14, 0, 1, 0, 88, 2, 1, 128, 41, 1, 30, 0, 61, 1, 2, 0, 
+57, 1, 3, 0, 14, 0, 1, 0, 88, 2, 1, 128, 42, 1, 0, 0, 
+61, 1, 3, 0, 75, 0, 1, 0, 15, 109, 97, 120, 108, 97, 116, 101, 
+110, 99, 121, 11, 109, 97, 120, 102, 112, 115, 11, 114, 101, 100, 114, 97, 
+119, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 
+1, 128, 128, 192, 254, 3, 130, 3, 0, 0, 5, 0, 18, 0, 42, 54, 
+0, 0, 0, 66, 0, 1, 2, 55, 0, 1, 0, 54, 0, 1, 0, 54, 
+1, 3, 0, 66, 1, 1, 2, 61, 1, 2, 0, 54, 0, 4, 0, 66, 
+0, 1, 2, 55, 0, 5, 0, 54, 0, 1, 0, 18, 2, 0, 0, 57, 
+0, 6, 0, 54, 3, 4, 0, 66, 3, 1, 2, 39, 4, 7, 0, 66, 
+0, 4, 1, 54, 0, 8, 0, 54, 2, 1, 0, 57, 2, 9, 2, 66, 
+0, 2, 1, 54, 0, 10, 0, 54, 2, 1, 0, 57, 2, 11, 2, 66, 
+0, 2, 1, 54, 0, 1, 0, 18, 2, 0, 0, 57, 0, 12, 0, 66, 
+0, 2, 1, 54, 0, 1, 0, 18, 2, 0, 0, 57, 0, 13, 0, 66, 
+0, 2, 1, 54, 0, 14, 0, 54, 2, 15, 0, 57, 2, 16, 2, 66, 
+0, 2, 1, 54, 0, 14, 0, 54, 2, 15, 0, 57, 2, 17, 2, 66, 
+0, 2, 1, 75, 0, 1, 0, 19, 82, 101, 103, 105, 115, 116, 101, 114, 
+65, 100, 100, 111, 110, 115, 20, 68, 111, 99, 117, 109, 101, 110, 116, 67, 
+114, 101, 97, 116, 101, 100, 10, 69, 118, 101, 110, 116, 14, 70, 105, 114, 
+101, 69, 118, 101, 110, 116, 10, 99, 108, 101, 97, 110, 10, 112, 117, 114, 
+103, 101, 14, 100, 111, 99, 117, 109, 101, 110, 116, 115, 25, 82, 101, 98, 
+117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 110, 116, 115, 77, 101, 110, 
+117, 11, 115, 116, 121, 108, 101, 115, 31, 82, 101, 98, 117, 105, 108, 100, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 83, 116, 121, 108, 101, 115, 77, 
+101, 110, 117, 9, 109, 97, 105, 110, 16, 97, 100, 100, 68, 111, 99, 117, 
+109, 101, 110, 116, 13, 68, 111, 99, 117, 109, 101, 110, 116, 19, 67, 114, 
+101, 97, 116, 101, 68, 111, 99, 117, 109, 101, 110, 116, 15, 67, 114, 101, 
+97, 116, 101, 77, 101, 110, 117, 9, 109, 101, 110, 117, 16, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 22, 67, 114, 101, 97, 116, 101, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 66, 0, 2, 6, 3, 1, 
+1, 8, 48, 0, 0, 0, 48, 1, 0, 0, 48, 2, 0, 0, 54, 2, 
+0, 0, 41, 4, 0, 0, 41, 5, 0, 0, 66, 2, 3, 1, 75, 0, 
+1, 0, 18, 128, 19, 128, 20, 128, 24, 83, 101, 116, 67, 117, 114, 114, 
+101, 110, 116, 83, 116, 121, 108, 101, 72, 105, 110, 116, 2, 118, 0, 0, 
+5, 0, 7, 0, 11, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 2, 
+0, 39, 3, 3, 0, 57, 4, 4, 0, 66, 1, 3, 1, 54, 1, 2, 
+0, 39, 3, 5, 0, 57, 4, 6, 0, 66, 1, 3, 1, 75, 0, 1, 
+0, 12, 115, 116, 101, 112, 109, 117, 108, 15, 115, 101, 116, 115, 116, 101, 
+112, 109, 117, 108, 10, 112, 97, 117, 115, 101, 13, 115, 101, 116, 112, 97, 
+117, 115, 101, 19, 99, 111, 108, 108, 101, 99, 116, 103, 97, 114, 98, 97, 
+103, 101, 7, 103, 99, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 
+105, 110, 103, 115, 239, 1, 0, 1, 7, 4, 7, 0, 41, 54, 1, 0, 
+0, 57, 1, 1, 1, 45, 2, 0, 0, 66, 2, 1, 1, 45, 2, 1, 
+0, 15, 0, 2, 0, 88, 3, 7, 128, 54, 2, 2, 0, 39, 4, 3, 
+0, 66, 2, 2, 2, 45, 3, 1, 0, 3, 2, 3, 0, 88, 2, 1, 
+128, 75, 0, 1, 0, 45, 2, 2, 0, 66, 2, 1, 2, 57, 3, 4, 
+1, 32, 2, 3, 2, 45, 3, 3, 0, 66, 3, 1, 2, 14, 0, 3, 
+0, 88, 3, 18, 128, 85, 3, 17, 128, 54, 3, 2, 0, 39, 5, 5, 
+0, 57, 6, 6, 1, 66, 3, 3, 2, 15, 0, 3, 0, 88, 4, 5, 
+128, 54, 3, 2, 0, 39, 5, 3, 0, 66, 3, 2, 2, 46, 1, 3, 
+0, 75, 0, 1, 0, 45, 3, 2, 0, 66, 3, 1, 2, 3, 2, 3, 
+0, 88, 3, 236, 127, 75, 0, 1, 0, 88, 3, 234, 127, 75, 0, 1, 
+0, 24, 192, 23, 128, 12, 192, 8, 192, 13, 115, 116, 101, 112, 115, 105, 
+122, 101, 9, 115, 116, 101, 112, 11, 98, 117, 100, 103, 101, 116, 10, 99, 
+111, 117, 110, 116, 19, 99, 111, 108, 108, 101, 99, 116, 103, 97, 114, 98, 
+97, 103, 101, 7, 103, 99, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 
+116, 105, 110, 103, 115, 195, 1, 0, 0, 3, 1, 6, 1, 32, 54, 0, 
+0, 0, 54, 1, 0, 0, 57, 1, 1, 1, 14, 0, 1, 0, 88, 2, 
+1, 128, 52, 1, 0, 0, 61, 1, 1, 0, 54, 0, 0, 0, 57, 0, 
+1, 0, 57, 1, 2, 0, 14, 0, 1, 0, 88, 2, 1, 128, 41, 1, 
+200, 0, 61, 1, 2, 0, 57, 1, 3, 0, 14, 0, 1, 0, 88, 2, 
+1, 128, 41, 1, 200, 0, 61, 1, 3, 0, 57, 1, 4, 0, 14, 0, 
+1, 0, 88, 2, 1, 128, 41, 1, 64, 0, 61, 1, 4, 0, 57, 1, 
+5, 0, 14, 0, 1, 0, 88, 2, 1, 128, 42, 1, 0, 0, 61, 1, 
+5, 0, 45, 1, 0, 0, 66, 1, 1, 1, 75, 0, 1, 0, 24, 192, 
+11, 98, 117, 100, 103, 101, 116, 13, 115, 116, 101, 112, 115, 105, 122, 101, 
+12, 115, 116, 101, 112, 109, 117, 108, 10, 112, 97, 117, 115, 101, 7, 103, 
+99, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 
+181, 230, 204, 153, 19, 153, 179, 166, 253, 3, 53, 0, 0, 2, 0, 2, 
+0, 5, 54, 0, 0, 0, 66, 0, 1, 1, 54, 0, 1, 0, 66, 0, 
+1, 1, 75, 0, 1, 0, 17, 82, 101, 100, 114, 97, 119, 83, 99, 114, 
+101, 101, 110, 17, 82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 
+57, 0, 0, 2, 0, 2, 0, 5, 54, 0, 0, 0, 66, 0, 1, 1, 
+54, 0, 1, 0, 66, 0, 1, 1, 75, 0, 1, 0, 17, 82, 101, 100, 
+114, 97, 119, 83, 99, 114, 101, 101, 110, 21, 73, 110, 118, 97, 108, 105, 
+100, 97, 116, 101, 83, 99, 114, 101, 101, 110, 97, 0, 0, 4, 1, 4, 
+0, 11, 54, 0, 0, 0, 57, 0, 1, 0, 66, 0, 1, 1, 54, 0, 
+0, 0, 57, 0, 2, 0, 66, 0, 1, 1, 54, 0, 0, 0, 57, 0, 
+3, 0, 45, 2, 0, 0, 66, 2, 1, 0, 67, 0, 0, 0, 4, 0, 
+15, 73, 110, 115, 101, 114, 116, 84, 101, 120, 116, 22, 84, 121, 112, 101, 
+87, 104, 105, 108, 101, 83, 101, 108, 101, 99, 116, 101, 100, 15, 67, 104, 
+101, 99, 107, 112, 111, 105, 110, 116, 8, 67, 109, 100, 250, 2, 0, 1, 
+9, 1, 14, 0, 48, 45, 1, 0, 0, 56, 1, 0, 1, 15, 0, 1, 
+0, 88, 2, 4, 128, 54, 2, 0, 0, 18, 4, 1, 0, 66, 2, 2, 
+1, 88, 2, 39, 128, 18, 4, 0, 0, 57, 2, 1, 0, 39, 5, 2, 
+0, 66, 2, 3, 2, 14, 0, 2, 0, 88, 2, 11, 128, 54, 2, 3, 
+0, 57, 2, 4, 2, 66, 2, 1, 1, 54, 2, 3, 0, 57, 2, 5, 
+2, 66, 2, 1, 1, 54, 2, 3, 0, 57, 2, 6, 2, 18, 4, 0, 
+0, 66, 2, 2, 1, 88, 2, 22, 128, 54, 2, 7, 0, 57, 2, 8, 
+2, 18, 4, 2, 0, 57, 2, 9, 2, 18, 5, 0, 0, 66, 2, 3, 
+2, 18, 1, 2, 0, 15, 0, 1, 0, 88, 2, 4, 128, 54, 2, 0, 
+0, 18, 4, 1, 0, 66, 2, 2, 1, 88, 2, 9, 128, 54, 2, 10, 
+0, 18, 6, 0, 0, 57, 4, 11, 0, 39, 7, 2, 0, 39, 8, 12, 
+0, 66, 4, 4, 2, 39, 5, 13, 0, 38, 4, 5, 4, 66, 2, 2, 
+1, 75, 0, 1, 0, 1, 192, 44, 32, 105, 115, 32, 110, 111, 116, 32, 
+98, 111, 117, 110, 100, 32, 45, 45, 45, 32, 116, 114, 121, 32, 69, 83, 
+67, 65, 80, 69, 32, 102, 111, 114, 32, 97, 32, 109, 101, 110, 117, 5, 
+9, 103, 115, 117, 98, 20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 
+115, 115, 97, 103, 101, 22, 108, 111, 111, 107, 117, 112, 65, 99, 99, 101, 
+108, 101, 114, 97, 116, 111, 114, 9, 109, 101, 110, 117, 16, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 25, 73, 110, 115, 101, 114, 116, 83, 
+116, 114, 105, 110, 103, 73, 110, 116, 111, 87, 111, 114, 100, 22, 84, 121, 
+112, 101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 99, 116, 101, 100, 15, 
+67, 104, 101, 99, 107, 112, 111, 105, 110, 116, 8, 67, 109, 100, 10, 94, 
+75, 69, 89, 95, 10, 109, 97, 116, 99, 104, 18, 82, 117, 110, 77, 101, 
+110, 117, 65, 99, 116, 105, 111, 110, 203, 3, 0, 0, 11, 8, 15, 1, 
+67, 54, 0, 0, 0, 57, 0, 1, 0, 41, 2, 13, 0, 66, 0, 2, 
+2, 85, 1, 61, 128, 54, 1, 2, 0, 57, 1, 3, 1, 15, 0, 1, 
+0, 88, 2, 7, 128, 54, 1, 4, 0, 54, 3, 5, 0, 57, 3, 6, 
+3, 66, 1, 2, 1, 54, 1, 2, 0, 43, 2, 1, 0, 61, 2, 3, 
+1, 54, 1, 7, 0, 66, 1, 1, 1, 54, 1, 4, 0, 54, 3, 5, 
+0, 57, 3, 8, 3, 66, 1, 2, 1, 45, 1, 0, 0, 66, 1, 1, 
+2, 54, 2, 9, 0, 66, 2, 1, 1, 45, 2, 1, 0, 18, 4, 1, 
+0, 66, 2, 2, 1, 54, 2, 10, 0, 57, 2, 11, 2, 57, 2, 12, 
+2, 45, 3, 2, 0, 66, 3, 1, 2, 15, 0, 3, 0, 88, 4, 224, 
+127, 45, 3, 3, 0, 15, 0, 3, 0, 88, 3, 6, 128, 45, 3, 4, 
+0, 66, 3, 1, 2, 45, 4, 5, 0, 33, 3, 4, 3, 1, 3, 2, 
+0, 88, 3, 215, 127, 85, 3, 19, 128, 54, 3, 13, 0, 45, 5, 6, 
+0, 66, 5, 1, 0, 65, 3, 0, 4, 88, 6, 11, 128, 45, 8, 1, 
+0, 18, 10, 7, 0, 66, 8, 2, 1, 45, 8, 3, 0, 15, 0, 8, 
+0, 88, 9, 5, 128, 45, 8, 7, 0, 45, 9, 7, 0, 57, 9, 14, 
+9, 22, 9, 0, 9, 61, 9, 14, 8, 69, 6, 3, 3, 82, 6, 243, 
+127, 88, 3, 223, 127, 88, 1, 194, 127, 75, 0, 1, 0, 5, 0, 2, 
+192, 6, 0, 7, 0, 2, 0, 1, 0, 8, 0, 9, 0, 17, 100, 101, 
+102, 101, 114, 114, 101, 100, 107, 101, 121, 115, 11, 105, 112, 97, 105, 114, 
+115, 15, 109, 97, 120, 108, 97, 116, 101, 110, 99, 121, 11, 114, 101, 100, 
+114, 97, 119, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 
+103, 115, 26, 82, 101, 115, 101, 116, 78, 111, 110, 109, 111, 100, 97, 108, 
+77, 101, 115, 115, 97, 103, 101, 115, 19, 87, 97, 105, 116, 105, 110, 103, 
+70, 111, 114, 85, 115, 101, 114, 21, 70, 108, 117, 115, 104, 65, 115, 121, 
+110, 99, 69, 118, 101, 110, 116, 115, 12, 67, 104, 97, 110, 103, 101, 100, 
+10, 69, 118, 101, 110, 116, 14, 70, 105, 114, 101, 69, 118, 101, 110, 116, 
+16, 106, 117, 115, 116, 99, 104, 97, 110, 103, 101, 100, 16, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 9, 99, 104, 97, 114, 11, 115, 116, 
+114, 105, 110, 103, 2, 160, 8, 1, 1, 14, 10, 39, 0, 98, 54, 1, 
+0, 0, 66, 1, 1, 1, 54, 1, 1, 0, 45, 3, 0, 0, 66, 1, 
+2, 3, 15, 0, 2, 0, 88, 3, 11, 128, 18, 5, 2, 0, 57, 3, 
+2, 2, 39, 6, 3, 0, 66, 3, 3, 2, 14, 0, 3, 0, 88, 3, 
+5, 128, 54, 3, 4, 0, 39, 5, 5, 0, 18, 6, 2, 0, 38, 5, 
+6, 5, 66, 3, 2, 1, 14, 0, 2, 0, 88, 3, 4, 128, 54, 3, 
+6, 0, 18, 5, 1, 0, 54, 6, 4, 0, 66, 3, 3, 1, 54, 1, 
+7, 0, 57, 1, 8, 1, 66, 1, 1, 1, 54, 1, 9, 0, 66, 1, 
+1, 1, 45, 1, 2, 0, 66, 1, 1, 2, 46, 1, 1, 0, 45, 1, 
+3, 0, 66, 1, 1, 1, 15, 0, 0, 0, 88, 1, 5, 128, 54, 1, 
+10, 0, 57, 1, 11, 1, 18, 3, 0, 0, 66, 1, 2, 1, 88, 1, 
+4, 128, 54, 1, 12, 0, 54, 3, 13, 0, 57, 3, 14, 3, 66, 1, 
+2, 1, 53, 1, 16, 0, 51, 2, 15, 0, 61, 2, 17, 1, 51, 2, 
+18, 0, 61, 2, 19, 1, 52, 2, 4, 0, 54, 3, 10, 0, 57, 3, 
+20, 3, 62, 3, 1, 2, 54, 3, 10, 0, 57, 3, 21, 3, 62, 3, 
+2, 2, 54, 3, 10, 0, 57, 3, 22, 3, 62, 3, 3, 2, 61, 2, 
+23, 1, 52, 2, 4, 0, 54, 3, 10, 0, 57, 3, 20, 3, 62, 3, 
+1, 2, 54, 3, 10, 0, 57, 3, 21, 3, 62, 3, 2, 2, 54, 3, 
+10, 0, 57, 3, 24, 3, 62, 3, 3, 2, 61, 2, 25, 1, 54, 2, 
+10, 0, 57, 2, 26, 2, 61, 2, 27, 1, 51, 2, 28, 0, 61, 2, 
+29, 1, 51, 2, 30, 0, 51, 3, 31, 0, 85, 4, 16, 128, 54, 4, 
+6, 0, 18, 6, 3, 0, 54, 7, 32, 0, 66, 4, 3, 3, 14, 0, 
+4, 0, 88, 6, 249, 127, 54, 6, 33, 0, 39, 8, 34, 0, 39, 9, 
+35, 0, 39, 10, 36, 0, 39, 11, 37, 0, 39, 12, 38, 0, 18, 13, 
+5, 0, 38, 9, 13, 9, 66, 6, 3, 1, 88, 4, 239, 127, 50, 0, 
+0, 128, 75, 0, 1, 0, 17, 128, 14, 128, 12, 192, 21, 192, 10, 192, 
+22, 192, 8, 192, 13, 128, 9, 192, 16, 192, 33, 105, 110, 102, 111, 114, 
+109, 97, 116, 105, 111, 110, 32, 116, 111, 32, 116, 104, 101, 32, 97, 117, 
+116, 104, 111, 114, 58, 10, 10, 65, 100, 105, 102, 102, 101, 114, 101, 110, 
+116, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 44, 32, 101, 120, 105, 
+116, 44, 32, 97, 110, 100, 32, 115, 101, 110, 100, 32, 116, 104, 101, 32, 
+102, 111, 108, 108, 111, 119, 105, 110, 103, 32, 116, 101, 99, 104, 110, 105, 
+99, 97, 108, 32, 65, 99, 111, 110, 116, 105, 110, 117, 101, 32, 98, 117, 
+116, 32, 121, 111, 117, 32, 115, 104, 111, 117, 108, 100, 32, 115, 97, 118, 
+101, 32, 121, 111, 117, 114, 32, 119, 111, 114, 107, 32, 105, 109, 109, 101, 
+100, 105, 97, 116, 101, 108, 121, 32, 40, 117, 110, 100, 101, 114, 32, 97, 
+32, 59, 83, 111, 109, 101, 116, 104, 105, 110, 103, 32, 119, 101, 110, 116, 
+32, 119, 114, 111, 110, 103, 32, 105, 110, 115, 105, 100, 101, 32, 87, 111, 
+114, 100, 71, 114, 105, 110, 100, 101, 114, 33, 32, 73, 39, 108, 108, 32, 
+116, 114, 121, 32, 97, 110, 100, 32, 20, 73, 110, 116, 101, 114, 110, 97, 
+108, 32, 101, 114, 114, 111, 114, 33, 17, 77, 111, 100, 97, 108, 77, 101, 
+115, 115, 97, 103, 101, 14, 84, 114, 97, 99, 101, 98, 97, 99, 107, 0, 
+0, 14, 75, 69, 89, 95, 80, 65, 83, 84, 69, 0, 15, 75, 69, 89, 
+95, 69, 83, 67, 65, 80, 69, 17, 65, 99, 116, 105, 118, 97, 116, 101, 
+77, 101, 110, 117, 15, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 26, 
+83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 80, 97, 114, 97, 
+103, 114, 97, 112, 104, 6, 32, 21, 83, 112, 108, 105, 116, 67, 117, 114, 
+114, 101, 110, 116, 87, 111, 114, 100, 22, 84, 121, 112, 101, 87, 104, 105, 
+108, 101, 83, 101, 108, 101, 99, 116, 101, 100, 15, 67, 104, 101, 99, 107, 
+112, 111, 105, 110, 116, 15, 75, 69, 89, 95, 82, 69, 68, 82, 65, 87, 
+0, 15, 75, 69, 89, 95, 82, 69, 83, 73, 90, 69, 1, 0, 6, 15, 
+75, 69, 89, 95, 69, 83, 67, 65, 80, 69, 0, 14, 75, 69, 89, 95, 
+80, 65, 83, 84, 69, 0, 6, 32, 0, 15, 75, 69, 89, 95, 82, 69, 
+68, 82, 65, 87, 0, 15, 75, 69, 89, 95, 82, 69, 83, 73, 90, 69, 
+0, 15, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 0, 0, 19, 68, 
+111, 99, 117, 109, 101, 110, 116, 76, 111, 97, 100, 101, 100, 10, 69, 118, 
+101, 110, 116, 14, 70, 105, 114, 101, 69, 118, 101, 110, 116, 20, 76, 111, 
+97, 100, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 8, 67, 109, 
+100, 17, 82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 15, 105, 
+110, 105, 116, 115, 99, 114, 101, 101, 110, 7, 119, 103, 11, 120, 112, 99, 
+97, 108, 108, 36, 99, 111, 110, 102, 105, 103, 32, 102, 105, 108, 101, 32, 
+99, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 32, 101, 114, 114, 111, 
+114, 58, 32, 13, 67, 76, 73, 69, 114, 114, 111, 114, 30, 78, 111, 32, 
+115, 117, 99, 104, 32, 102, 105, 108, 101, 32, 111, 114, 32, 100, 105, 114, 
+101, 99, 116, 111, 114, 121, 9, 102, 105, 110, 100, 13, 108, 111, 97, 100, 
+102, 105, 108, 101, 23, 76, 111, 97, 100, 71, 108, 111, 98, 97, 108, 83, 
+101, 116, 116, 105, 110, 103, 115, 217, 10, 0, 1, 7, 2, 10, 0, 31, 
+45, 1, 0, 0, 18, 3, 1, 0, 57, 1, 0, 1, 39, 4, 1, 0, 
+54, 5, 2, 0, 39, 6, 3, 0, 66, 1, 5, 1, 54, 1, 4, 0, 
+15, 0, 1, 0, 88, 2, 5, 128, 45, 1, 0, 0, 18, 3, 1, 0, 
+57, 1, 0, 1, 39, 4, 5, 0, 66, 1, 3, 1, 45, 1, 0, 0, 
+18, 3, 1, 0, 57, 1, 0, 1, 39, 4, 6, 0, 45, 5, 1, 0, 
+39, 6, 7, 0, 38, 4, 6, 4, 66, 1, 3, 1, 54, 1, 4, 0, 
+15, 0, 1, 0, 88, 2, 0, 128, 54, 1, 8, 0, 57, 1, 9, 1, 
+41, 3, 0, 0, 66, 1, 2, 1, 75, 0, 1, 0, 1, 192, 0, 0, 
+9, 101, 120, 105, 116, 7, 111, 115, 7, 10, 10, 204, 8, 83, 121, 110, 
+116, 97, 120, 58, 32, 119, 111, 114, 100, 103, 114, 105, 110, 100, 101, 114, 
+32, 91, 60, 111, 112, 116, 105, 111, 110, 115, 46, 46, 46, 62, 93, 32, 
+91, 60, 102, 105, 108, 101, 110, 97, 109, 101, 62, 93, 10, 79, 112, 116, 
+105, 111, 110, 115, 58, 10, 32, 32, 32, 45, 104, 32, 32, 32, 32, 45, 
+45, 104, 101, 108, 112, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 68, 105, 115, 112, 108, 97, 121, 115, 32, 116, 104, 
+105, 115, 32, 109, 101, 115, 115, 97, 103, 101, 46, 10, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 45, 45, 108, 117, 97, 32, 102, 105, 108, 101, 46, 
+108, 117, 97, 32, 32, 32, 32, 32, 32, 32, 32, 76, 111, 97, 100, 115, 
+32, 97, 110, 100, 32, 101, 120, 101, 99, 117, 116, 101, 115, 32, 102, 105, 
+108, 101, 46, 108, 117, 97, 32, 97, 110, 100, 32, 116, 104, 101, 110, 32, 
+101, 120, 105, 116, 115, 10, 9, 9, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 
+111, 114, 32, 102, 105, 108, 101, 46, 108, 117, 97, 32, 99, 97, 110, 32, 
+98, 101, 32, 115, 111, 109, 101, 32, 76, 117, 97, 32, 115, 116, 97, 116, 
+101, 109, 101, 110, 116, 115, 41, 10, 32, 32, 32, 45, 99, 32, 32, 32, 
+32, 45, 45, 99, 111, 110, 118, 101, 114, 116, 32, 115, 114, 99, 32, 100, 
+101, 115, 116, 46, 46, 46, 32, 67, 111, 110, 118, 101, 114, 116, 115, 32, 
+102, 114, 111, 109, 32, 111, 110, 101, 32, 102, 105, 108, 101, 32, 102, 111, 
+114, 109, 97, 116, 32, 116, 111, 32, 111, 116, 104, 101, 114, 115, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 45, 45, 99, 111, 110, 102, 105, 103, 
+32, 102, 105, 108, 101, 46, 108, 117, 97, 32, 32, 32, 32, 32, 83, 101, 
+116, 115, 32, 116, 104, 101, 32, 110, 97, 109, 101, 32, 111, 102, 32, 116, 
+104, 101, 32, 117, 115, 101, 114, 32, 99, 111, 110, 102, 105, 103, 32, 102, 
+105, 108, 101, 10, 10, 79, 110, 108, 121, 32, 111, 110, 101, 32, 102, 105, 
+108, 101, 110, 97, 109, 101, 32, 109, 97, 121, 32, 98, 101, 32, 115, 112, 
+101, 99, 105, 102, 105, 101, 100, 44, 32, 119, 104, 105, 99, 104, 32, 105, 
+115, 32, 116, 104, 101, 32, 110, 97, 109, 101, 32, 111, 102, 32, 97, 32, 
+87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 10, 102, 105, 108, 101, 
+32, 116, 111, 32, 108, 111, 97, 100, 32, 111, 110, 32, 115, 116, 97, 114, 
+116, 117, 112, 46, 32, 73, 102, 32, 110, 111, 116, 32, 103, 105, 118, 101, 
+110, 44, 32, 121, 111, 117, 32, 103, 101, 116, 32, 97, 32, 98, 108, 97, 
+110, 107, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 105, 110, 115, 116, 
+101, 97, 100, 46, 10, 10, 84, 111, 32, 99, 111, 110, 118, 101, 114, 116, 
+32, 100, 111, 99, 117, 109, 101, 110, 116, 115, 44, 32, 117, 115, 101, 32, 
+45, 45, 99, 111, 110, 118, 101, 114, 116, 46, 32, 84, 104, 101, 32, 102, 
+105, 108, 101, 32, 116, 121, 112, 101, 32, 105, 115, 32, 97, 117, 116, 111, 
+100, 101, 116, 101, 99, 116, 101, 100, 32, 102, 114, 111, 109, 32, 116, 104, 
+101, 10, 101, 120, 116, 101, 110, 115, 105, 111, 110, 46, 32, 84, 111, 32, 
+115, 112, 101, 99, 105, 102, 121, 32, 97, 32, 100, 111, 99, 117, 109, 101, 
+110, 116, 32, 110, 97, 109, 101, 44, 32, 117, 115, 101, 32, 58, 110, 97, 
+109, 101, 32, 97, 115, 32, 97, 32, 115, 117, 102, 102, 105, 120, 46, 32, 
+101, 46, 103, 46, 58, 10, 10, 32, 32, 32, 32, 119, 111, 114, 100, 103, 
+114, 105, 110, 100, 101, 114, 32, 45, 45, 99, 111, 110, 118, 101, 114, 116, 
+32, 102, 105, 108, 101, 110, 97, 109, 101, 46, 119, 103, 58, 34, 67, 104, 
+97, 112, 116, 101, 114, 32, 49, 34, 32, 99, 104, 97, 112, 116, 101, 114, 
+49, 46, 111, 100, 116, 10, 10, 73, 102, 32, 115, 101, 118, 101, 114, 97, 
+108, 32, 100, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 115, 32, 97, 
+114, 101, 32, 103, 105, 118, 101, 110, 44, 32, 116, 104, 101, 32, 100, 111, 
+99, 117, 109, 101, 110, 116, 32, 105, 115, 32, 114, 101, 97, 100, 32, 111, 
+110, 99, 101, 32, 97, 110, 100, 32, 97, 108, 108, 32, 116, 104, 101, 10, 
+101, 120, 112, 111, 114, 116, 101, 100, 32, 102, 105, 108, 101, 115, 32, 97, 
+114, 101, 32, 119, 114, 105, 116, 116, 101, 110, 32, 105, 110, 32, 97, 32, 
+115, 105, 110, 103, 108, 101, 32, 112, 97, 115, 115, 32, 111, 118, 101, 114, 
+32, 105, 116, 58, 10, 10, 32, 32, 32, 32, 119, 111, 114, 100, 103, 114, 
+105, 110, 100, 101, 114, 32, 45, 45, 99, 111, 110, 118, 101, 114, 116, 32, 
+102, 105, 108, 101, 110, 97, 109, 101, 46, 119, 103, 32, 99, 104, 97, 112, 
+116, 101, 114, 49, 46, 111, 100, 116, 32, 99, 104, 97, 112, 116, 101, 114, 
+49, 46, 104, 116, 109, 108, 32, 99, 104, 97, 112, 116, 101, 114, 49, 46, 
+116, 120, 116, 10, 10, 84, 104, 101, 32, 117, 115, 101, 114, 32, 99, 111, 
+110, 102, 105, 103, 32, 102, 105, 108, 101, 32, 105, 115, 32, 97, 32, 76, 
+117, 97, 32, 102, 105, 108, 101, 32, 119, 104, 105, 99, 104, 32, 105, 115, 
+32, 108, 111, 97, 100, 101, 100, 32, 97, 110, 100, 32, 101, 120, 101, 99, 
+117, 116, 101, 100, 32, 98, 101, 102, 111, 114, 101, 10, 116, 104, 101, 32, 
+112, 114, 111, 103, 114, 97, 109, 32, 115, 116, 97, 114, 116, 115, 32, 117, 
+112, 32, 40, 98, 117, 116, 32, 97, 102, 116, 101, 114, 32, 97, 110, 121, 
+32, 45, 45, 108, 117, 97, 32, 102, 105, 108, 101, 115, 41, 46, 32, 73, 
+116, 32, 100, 101, 102, 97, 117, 108, 116, 115, 32, 116, 111, 58, 10, 10, 
+32, 32, 32, 32, 62, 40, 84, 104, 105, 115, 32, 118, 101, 114, 115, 105, 
+111, 110, 32, 104, 97, 115, 32, 98, 101, 101, 110, 32, 99, 111, 109, 112, 
+105, 108, 101, 100, 32, 119, 105, 116, 104, 32, 100, 101, 98, 117, 103, 103, 
+105, 110, 103, 32, 101, 110, 97, 98, 108, 101, 100, 46, 41, 10, 10, 68, 
+69, 66, 85, 71, 31, 32, 194, 169, 32, 50, 48, 48, 55, 45, 50, 48, 
+48, 56, 32, 68, 97, 118, 105, 100, 32, 71, 105, 118, 101, 110, 10, 12, 
+86, 69, 82, 83, 73, 79, 78, 25, 87, 111, 114, 100, 71, 114, 105, 110, 
+100, 101, 114, 32, 118, 101, 114, 115, 105, 111, 110, 32, 10, 119, 114, 105, 
+116, 101, 151, 2, 0, 2, 8, 0, 9, 0, 36, 14, 0, 0, 0, 88, 
+2, 3, 128, 54, 2, 0, 0, 39, 4, 1, 0, 66, 2, 2, 1, 54, 
+2, 2, 0, 18, 4, 0, 0, 66, 2, 2, 3, 15, 0, 3, 0, 88, 
+4, 11, 128, 18, 6, 3, 0, 57, 4, 3, 3, 39, 7, 4, 0, 66, 
+4, 3, 2, 15, 0, 4, 0, 88, 5, 5, 128, 54, 4, 5, 0, 18, 
+6, 0, 0, 66, 4, 2, 3, 18, 3, 5, 0, 18, 2, 4, 0, 15, 
+0, 3, 0, 88, 4, 5, 128, 54, 4, 0, 0, 39, 6, 6, 0, 18, 
+7, 3, 0, 38, 6, 7, 6, 66, 4, 2, 1, 18, 4, 2, 0, 18, 
+6, 1, 0, 66, 4, 2, 1, 54, 4, 7, 0, 57, 4, 8, 4, 41, 
+6, 0, 0, 66, 4, 2, 1, 75, 0, 1, 0, 9, 101, 120, 105, 116, 
+7, 111, 115, 36, 117, 115, 101, 114, 32, 115, 99, 114, 105, 112, 116, 32, 
+99, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 32, 101, 114, 114, 111, 
+114, 58, 32, 15, 108, 111, 97, 100, 115, 116, 114, 105, 110, 103, 30, 78, 
+111, 32, 115, 117, 99, 104, 32, 102, 105, 108, 101, 32, 111, 114, 32, 100, 
+105, 114, 101, 99, 116, 111, 114, 121, 9, 102, 105, 110, 100, 13, 108, 111, 
+97, 100, 102, 105, 108, 101, 32, 45, 45, 108, 117, 97, 32, 109, 117, 115, 
+116, 32, 104, 97, 118, 101, 32, 97, 110, 32, 97, 114, 103, 117, 109, 101, 
+110, 116, 13, 67, 76, 73, 69, 114, 114, 111, 114, 229, 1, 2, 1, 11, 
+1, 5, 4, 34, 52, 1, 0, 0, 54, 2, 0, 0, 52, 4, 3, 0, 
+71, 5, 1, 0, 63, 5, 0, 0, 66, 2, 2, 4, 88, 5, 10, 128, 
+18, 9, 6, 0, 57, 7, 1, 6, 41, 10, 1, 0, 66, 7, 3, 2, 
+9, 7, 1, 0, 88, 7, 1, 128, 88, 2, 5, 128, 21, 7, 1, 0, 
+22, 7, 2, 7, 60, 6, 7, 1, 69, 5, 3, 3, 82, 5, 244, 127, 
+15, 0, 0, 0, 88, 2, 3, 128, 21, 2, 1, 0, 9, 2, 3, 0, 
+88, 2, 3, 128, 54, 2, 2, 0, 39, 4, 3, 0, 66, 2, 2, 1, 
+54, 2, 4, 0, 18, 4, 0, 0, 45, 5, 0, 0, 18, 7, 1, 0, 
+66, 5, 2, 0, 65, 2, 1, 1, 75, 0, 1, 0, 1, 0, 15, 67, 
+108, 105, 67, 111, 110, 118, 101, 114, 116, 47, 45, 45, 99, 111, 110, 118, 
+101, 114, 116, 32, 109, 117, 115, 116, 32, 104, 97, 118, 101, 32, 97, 116, 
+32, 108, 101, 97, 115, 116, 32, 116, 119, 111, 32, 97, 114, 103, 117, 109, 
+101, 110, 116, 115, 13, 67, 76, 73, 69, 114, 114, 111, 114, 9, 98, 121, 
+116, 101, 11, 105, 112, 97, 105, 114, 115, 3, 128, 128, 192, 153, 4, 90, 
+2, 0, 81, 0, 2, 5, 1, 2, 0, 8, 14, 0, 0, 0, 88, 2, 
+3, 128, 54, 2, 0, 0, 39, 4, 1, 0, 66, 2, 2, 1, 46, 0, 
+0, 0, 41, 2, 1, 0, 76, 2, 2, 0, 0, 0, 35, 45, 45, 99, 
+111, 110, 102, 105, 103, 32, 109, 117, 115, 116, 32, 104, 97, 118, 101, 32, 
+97, 110, 32, 97, 114, 103, 117, 109, 101, 110, 116, 13, 67, 76, 73, 69, 
+114, 114, 111, 114, 65, 0, 1, 4, 0, 2, 0, 6, 14, 0, 0, 0, 
+88, 1, 3, 128, 54, 1, 0, 0, 39, 3, 1, 0, 66, 1, 2, 1, 
+75, 0, 1, 0, 29, 109, 105, 115, 115, 105, 110, 103, 32, 111, 112, 116, 
+105, 111, 110, 32, 112, 97, 114, 97, 109, 101, 116, 101, 114, 13, 67, 76, 
+73, 69, 114, 114, 111, 114, 88, 0, 1, 6, 0, 3, 0, 6, 54, 1, 
+0, 0, 39, 3, 1, 0, 18, 4, 0, 0, 39, 5, 2, 0, 66, 1, 
+4, 1, 75, 0, 1, 0, 30, 39, 32, 45, 45, 45, 32, 116, 114, 121, 
+32, 45, 45, 104, 101, 108, 112, 32, 102, 111, 114, 32, 104, 101, 108, 112, 
+26, 117, 110, 114, 101, 99, 111, 103, 110, 105, 115, 101, 100, 32, 111, 112, 
+116, 105, 111, 110, 32, 39, 13, 67, 76, 73, 69, 114, 114, 111, 114, 255, 
+5, 3, 0, 22, 2, 32, 3, 131, 1, 54, 0, 0, 0, 66, 0, 1, 
+1, 43, 0, 0, 0, 54, 1, 1, 0, 57, 1, 2, 1, 54, 2, 1, 
+0, 57, 2, 3, 2, 51, 3, 4, 0, 51, 4, 5, 0, 51, 5, 6, 
+0, 51, 6, 7, 0, 51, 7, 8, 0, 53, 8, 9, 0, 61, 3, 10, 
+8, 61, 3, 11, 8, 61, 4, 12, 8, 61, 5, 13, 8, 61, 5, 14, 
+8, 61, 6, 15, 8, 54, 9, 16, 0, 15, 0, 9, 0, 88, 10, 0, 
+128, 51, 9, 17, 0, 52, 10, 3, 0, 71, 11, 0, 0, 63, 11, 0, 
+0, 41, 11, 2, 0, 21, 12, 10, 0, 3, 11, 12, 0, 88, 12, 76, 
+128, 85, 12, 75, 128, 56, 12, 11, 10, 43, 13, 0, 0, 18, 16, 12, 
+0, 57, 14, 18, 12, 41, 17, 1, 0, 66, 14, 3, 2, 9, 14, 1, 
+0, 88, 14, 59, 128, 18, 16, 12, 0, 57, 14, 18, 12, 41, 17, 2, 
+0, 66, 14, 3, 2, 9, 14, 1, 0, 88, 14, 21, 128, 18, 16, 12, 
+0, 57, 14, 19, 12, 41, 17, 3, 0, 66, 14, 3, 2, 18, 12, 14, 
+0, 56, 14, 12, 8, 14, 0, 14, 0, 88, 15, 5, 128, 18, 15, 9, 
+0, 39, 17, 20, 0, 18, 18, 12, 0, 38, 17, 18, 17, 66, 15, 2, 
+1, 18, 15, 14, 0, 45, 17, 1, 0, 18, 19, 10, 0, 22, 20, 2, 
+11, 66, 17, 3, 0, 65, 15, 0, 2, 32, 11, 15, 11, 88, 14, 38, 
+128, 18, 16, 12, 0, 57, 14, 19, 12, 41, 17, 2, 0, 41, 18, 2, 
+0, 66, 14, 4, 2, 56, 15, 14, 8, 14, 0, 15, 0, 88, 16, 5, 
+128, 18, 16, 9, 0, 39, 18, 21, 0, 18, 19, 14, 0, 38, 18, 19, 
+18, 66, 16, 2, 1, 18, 18, 12, 0, 57, 16, 19, 12, 41, 19, 3, 
+0, 66, 16, 3, 2, 18, 13, 16, 0, 7, 13, 22, 0, 88, 16, 8, 
+128, 18, 16, 15, 0, 45, 18, 1, 0, 18, 20, 10, 0, 22, 21, 2, 
+11, 66, 18, 3, 0, 65, 16, 0, 2, 32, 11, 16, 11, 88, 16, 10, 
+128, 18, 16, 15, 0, 18, 18, 13, 0, 66, 16, 2, 1, 88, 14, 6, 
+128, 15, 0, 0, 0, 88, 14, 3, 128, 54, 14, 23, 0, 39, 16, 24, 
+0, 66, 14, 2, 1, 18, 0, 12, 0, 22, 11, 2, 11, 88, 12, 177, 
+127, 50, 1, 0, 128, 15, 0, 0, 0, 88, 1, 18, 128, 18, 3, 0, 
+0, 57, 1, 25, 0, 39, 4, 26, 0, 66, 1, 3, 2, 14, 0, 1, 
+0, 88, 1, 12, 128, 18, 3, 0, 0, 57, 1, 25, 0, 39, 4, 27, 
+0, 66, 1, 3, 2, 14, 0, 1, 0, 88, 1, 6, 128, 54, 1, 28, 
+0, 57, 1, 29, 1, 66, 1, 1, 2, 39, 2, 30, 0, 18, 3, 0, 
+0, 38, 0, 3, 1, 54, 1, 31, 0, 18, 3, 0, 0, 66, 1, 2, 
+1, 75, 0, 1, 0, 17, 128, 1, 192, 18, 87, 111, 114, 100, 80, 114, 
+111, 99, 101, 115, 115, 111, 114, 6, 47, 15, 99, 117, 114, 114, 101, 110, 
+116, 100, 105, 114, 8, 108, 102, 115, 19, 94, 91, 97, 45, 122, 65, 45, 
+90, 93, 58, 91, 47, 92, 93, 7, 94, 47, 9, 102, 105, 110, 100, 38, 
+121, 111, 117, 32, 109, 97, 121, 32, 111, 110, 108, 121, 32, 115, 112, 101, 
+99, 105, 102, 121, 32, 111, 110, 101, 32, 102, 105, 108, 101, 110, 97, 109, 
+101, 13, 67, 76, 73, 69, 114, 114, 111, 114, 5, 6, 45, 7, 45, 45, 
+8, 115, 117, 98, 9, 98, 121, 116, 101, 0, 10, 68, 69, 66, 85, 71, 
+11, 99, 111, 110, 102, 105, 103, 12, 99, 111, 110, 118, 101, 114, 116, 6, 
+99, 8, 108, 117, 97, 9, 104, 101, 108, 112, 6, 104, 1, 0, 6, 12, 
+99, 111, 110, 118, 101, 114, 116, 0, 8, 108, 117, 97, 0, 9, 104, 101, 
+108, 112, 0, 6, 104, 0, 6, 99, 0, 11, 99, 111, 110, 102, 105, 103, 
+0, 0, 0, 0, 0, 0, 11, 115, 116, 100, 101, 114, 114, 11, 115, 116, 
+100, 111, 117, 116, 7, 105, 111, 21, 82, 101, 115, 101, 116, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 3, 128, 128, 192, 153, 4, 90, 2, 
+175, 6, 3, 0, 31, 0, 45, 0, 94, 54, 0, 0, 0, 57, 0, 1, 
+0, 54, 1, 2, 0, 14, 0, 1, 0, 88, 2, 2, 128, 54, 1, 3, 
+0, 57, 1, 2, 1, 54, 2, 4, 0, 57, 2, 5, 2, 54, 3, 4, 
+0, 57, 3, 6, 3, 54, 4, 4, 0, 57, 4, 7, 4, 54, 5, 4, 
+0, 57, 5, 8, 5, 54, 6, 4, 0, 57, 6, 9, 6, 54, 7, 4, 
+0, 57, 7, 10, 7, 54, 8, 4, 0, 57, 8, 11, 8, 54, 9, 4, 
+0, 57, 9, 12, 9, 54, 10, 4, 0, 57, 10, 13, 10, 54, 11, 4, 
+0, 57, 11, 14, 11, 54, 12, 4, 0, 57, 12, 15, 12, 43, 13, 2, 
+0, 41, 14, 0, 0, 41, 15, 0, 0, 53, 16, 16, 0, 54, 17, 17, 
+0, 57, 17, 18, 17, 39, 19, 19, 0, 66, 17, 2, 2, 14, 0, 17, 
+0, 88, 18, 4, 128, 54, 17, 17, 0, 57, 17, 18, 17, 39, 19, 20, 
+0, 66, 17, 2, 2, 55, 17, 19, 0, 54, 17, 19, 0, 39, 18, 21, 
+0, 38, 17, 18, 17, 44, 18, 20, 0, 51, 21, 22, 0, 55, 21, 23, 
+0, 51, 21, 24, 0, 55, 21, 25, 0, 51, 21, 26, 0, 51, 22, 27, 
+0, 51, 23, 28, 0, 54, 24, 29, 0, 54, 26, 30, 0, 57, 26, 31, 
+26, 18, 27, 23, 0, 66, 24, 3, 1, 51, 23, 32, 0, 55, 23, 33, 
+0, 51, 23, 34, 0, 54, 24, 29, 0, 54, 26, 30, 0, 57, 26, 35, 
+26, 18, 27, 23, 0, 66, 24, 3, 1, 54, 24, 29, 0, 54, 26, 30, 
+0, 57, 26, 36, 26, 18, 27, 23, 0, 66, 24, 3, 1, 43, 23, 0, 
+0, 51, 24, 37, 0, 51, 25, 38, 0, 51, 26, 39, 0, 54, 27, 29, 
+0, 54, 29, 30, 0, 57, 29, 40, 29, 18, 30, 25, 0, 66, 27, 3, 
+1, 54, 27, 29, 0, 54, 29, 30, 0, 57, 29, 31, 29, 18, 30, 26, 
+0, 66, 27, 3, 1, 50, 23, 0, 128, 51, 23, 41, 0, 55, 23, 42, 
+0, 51, 23, 43, 0, 55, 23, 44, 0, 50, 0, 0, 128, 75, 0, 1, 
+0, 9, 77, 97, 105, 110, 0, 18, 87, 111, 114, 100, 80, 114, 111, 99, 
+101, 115, 115, 111, 114, 0, 9, 73, 100, 108, 101, 0, 0, 0, 20, 68, 
+111, 99, 117, 109, 101, 110, 116, 67, 114, 101, 97, 116, 101, 100, 19, 68, 
+111, 99, 117, 109, 101, 110, 116, 76, 111, 97, 100, 101, 100, 0, 21, 82, 
+101, 115, 101, 116, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 
+19, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 10, 
+69, 118, 101, 110, 116, 21, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 
+115, 116, 101, 110, 101, 114, 0, 0, 0, 19, 71, 101, 116, 82, 101, 100, 
+114, 97, 119, 83, 116, 97, 116, 115, 0, 16, 81, 117, 101, 117, 101, 82, 
+101, 100, 114, 97, 119, 0, 22, 47, 46, 119, 111, 114, 100, 103, 114, 105, 
+110, 100, 101, 114, 46, 108, 117, 97, 16, 85, 83, 69, 82, 80, 82, 79, 
+70, 73, 76, 69, 9, 72, 79, 77, 69, 11, 103, 101, 116, 101, 110, 118, 
+7, 111, 115, 1, 0, 7, 17, 116, 111, 116, 97, 108, 108, 97, 116, 101, 
+110, 99, 121, 3, 0, 15, 109, 97, 120, 108, 97, 116, 101, 110, 99, 121, 
+3, 0, 16, 108, 97, 115, 116, 108, 97, 116, 101, 110, 99, 121, 3, 0, 
+18, 108, 97, 115, 116, 102, 114, 97, 109, 101, 116, 105, 109, 101, 3, 0, 
+17, 100, 101, 102, 101, 114, 114, 101, 100, 107, 101, 121, 115, 3, 0, 11, 
+102, 114, 97, 109, 101, 115, 3, 0, 13, 114, 101, 113, 117, 101, 115, 116, 
+115, 3, 0, 9, 116, 105, 109, 101, 12, 103, 101, 116, 99, 104, 97, 114, 
+18, 103, 101, 116, 112, 97, 115, 116, 101, 100, 116, 101, 120, 116, 13, 103, 
+101, 116, 99, 104, 97, 114, 115, 20, 104, 97, 115, 112, 101, 110, 100, 105, 
+110, 103, 105, 110, 112, 117, 116, 19, 103, 101, 116, 115, 116, 114, 105, 110, 
+103, 119, 105, 100, 116, 104, 15, 115, 101, 116, 114, 101, 118, 101, 114, 115, 
+101, 17, 115, 101, 116, 117, 110, 100, 101, 114, 108, 105, 110, 101, 12, 115, 
+101, 116, 98, 111, 108, 100, 14, 115, 101, 116, 110, 111, 114, 109, 97, 108, 
+10, 119, 114, 105, 116, 101, 7, 119, 103, 10, 116, 97, 98, 108, 101, 11, 
+117, 110, 112, 97, 99, 107, 10, 102, 108, 111, 111, 114, 9, 109, 97, 116, 
+104, 0, 
+};
+
+/* This is src/lua/xml.lua */
+static const char file_5[] = {
+27, 76, 74, 2, 10, 180, 1, 0, 1, 15, 1, 7, 1, 25, 52, 1, 
+0, 0, 54, 2, 0, 0, 18, 4, 0, 0, 66, 2, 2, 4, 72, 5, 
+17, 128, 39, 7, 1, 0, 18, 8, 5, 0, 45, 9, 0, 0, 18, 11, 
+5, 0, 39, 12, 2, 0, 66, 9, 3, 5, 15, 0, 11, 0, 88, 13, 
+2, 128, 18, 7, 11, 0, 18, 8, 12, 0, 21, 13, 1, 0, 22, 13, 
+0, 13, 53, 14, 3, 0, 61, 7, 4, 14, 61, 8, 5, 14, 61, 6, 
+6, 14, 60, 14, 13, 1, 70, 5, 3, 3, 82, 5, 237, 127, 76, 1, 
+2, 0, 1, 0, 10, 118, 97, 108, 117, 101, 9, 110, 97, 109, 101, 14, 
+110, 97, 109, 101, 115, 112, 97, 99, 101, 1, 0, 3, 10, 118, 97, 108, 
+117, 101, 0, 9, 110, 97, 109, 101, 0, 14, 110, 97, 109, 101, 115, 112, 
+97, 99, 101, 0, 19, 94, 40, 46, 42, 41, 32, 40, 91, 94, 32, 93, 
+42, 41, 36, 5, 10, 112, 97, 105, 114, 115, 2, 143, 3, 0, 0, 8, 
+2, 15, 0, 49, 45, 0, 0, 0, 66, 0, 1, 5, 7, 0, 0, 0, 
+88, 4, 10, 128, 53, 4, 1, 0, 61, 0, 2, 4, 61, 1, 3, 4, 
+61, 2, 4, 4, 45, 5, 1, 0, 18, 7, 3, 0, 66, 5, 2, 2, 
+61, 5, 5, 4, 76, 4, 2, 0, 88, 4, 33, 128, 7, 0, 6, 0, 
+88, 4, 6, 128, 53, 4, 7, 0, 61, 0, 2, 4, 61, 1, 3, 4, 
+61, 2, 4, 4, 76, 4, 2, 0, 88, 4, 25, 128, 6, 0, 8, 0, 
+88, 4, 2, 128, 7, 0, 9, 0, 88, 4, 4, 128, 53, 4, 10, 0, 
+61, 1, 8, 4, 76, 4, 2, 0, 88, 4, 17, 128, 7, 0, 11, 0, 
+88, 4, 9, 128, 53, 4, 12, 0, 61, 0, 2, 4, 61, 1, 4, 4, 
+45, 5, 1, 0, 18, 7, 2, 0, 66, 5, 2, 2, 61, 5, 5, 4, 
+76, 4, 2, 0, 88, 4, 6, 128, 7, 0, 13, 0, 88, 4, 4, 128, 
+53, 4, 14, 0, 61, 0, 2, 4, 61, 1, 8, 4, 76, 4, 2, 0, 
+43, 4, 0, 0, 76, 4, 2, 0, 1, 192, 2, 192, 1, 0, 2, 9, 
+116, 101, 120, 116, 0, 10, 101, 118, 101, 110, 116, 0, 10, 101, 114, 114, 
+111, 114, 1, 0, 3, 10, 97, 116, 116, 114, 115, 0, 9, 110, 97, 109, 
+101, 0, 10, 101, 118, 101, 110, 116, 0, 15, 112, 114, 111, 99, 101, 115, 
+115, 105, 110, 103, 1, 0, 2, 9, 116, 101, 120, 116, 0, 10, 101, 118, 
+101, 110, 116, 9, 116, 101, 120, 116, 10, 99, 100, 97, 116, 97, 9, 116, 
+101, 120, 116, 1, 0, 3, 9, 110, 97, 109, 101, 0, 14, 110, 97, 109, 
+101, 115, 112, 97, 99, 101, 0, 10, 101, 118, 101, 110, 116, 0, 13, 99, 
+108, 111, 115, 101, 116, 97, 103, 10, 97, 116, 116, 114, 115, 9, 110, 97, 
+109, 101, 14, 110, 97, 109, 101, 115, 112, 97, 99, 101, 10, 101, 118, 101, 
+110, 116, 1, 0, 4, 10, 97, 116, 116, 114, 115, 0, 9, 110, 97, 109, 
+101, 0, 14, 110, 97, 109, 101, 115, 112, 97, 99, 101, 0, 10, 101, 118, 
+101, 110, 116, 0, 12, 111, 112, 101, 110, 116, 97, 103, 41, 1, 1, 4, 
+2, 2, 0, 7, 45, 1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 2, 
+51, 2, 0, 0, 51, 3, 1, 0, 50, 0, 0, 128, 76, 3, 2, 0, 
+0, 192, 1, 192, 0, 0, 219, 1, 0, 3, 14, 2, 8, 1, 41, 18, 
+3, 2, 0, 6, 0, 0, 0, 88, 4, 6, 128, 18, 4, 0, 0, 39, 
+5, 2, 0, 18, 6, 1, 0, 38, 4, 6, 4, 61, 4, 1, 3, 88, 
+4, 1, 128, 61, 1, 1, 3, 85, 4, 29, 128, 45, 4, 0, 0, 66, 
+4, 1, 5, 7, 4, 3, 0, 88, 8, 9, 128, 21, 8, 3, 0, 22, 
+8, 0, 8, 45, 9, 1, 0, 18, 11, 5, 0, 18, 12, 6, 0, 18, 
+13, 7, 0, 66, 9, 4, 2, 60, 9, 8, 3, 88, 8, 242, 127, 6, 
+4, 4, 0, 88, 8, 2, 128, 7, 4, 5, 0, 88, 8, 4, 128, 21, 
+8, 3, 0, 22, 8, 0, 8, 60, 5, 8, 3, 88, 8, 234, 127, 6, 
+4, 6, 0, 88, 8, 4, 128, 15, 0, 4, 0, 88, 8, 2, 128, 7, 
+4, 7, 0, 88, 8, 228, 127, 76, 3, 2, 0, 88, 4, 226, 127, 75, 
+0, 1, 0, 1, 192, 2, 192, 10, 101, 114, 114, 111, 114, 13, 99, 108, 
+111, 115, 101, 116, 97, 103, 10, 99, 100, 97, 116, 97, 9, 116, 101, 120, 
+116, 12, 111, 112, 101, 110, 116, 97, 103, 6, 32, 10, 95, 110, 97, 109, 
+101, 5, 2, 124, 1, 1, 12, 1, 3, 0, 25, 45, 1, 0, 0, 18, 
+3, 0, 0, 66, 1, 2, 2, 51, 2, 0, 0, 85, 3, 18, 128, 18, 
+3, 1, 0, 66, 3, 1, 5, 7, 3, 1, 0, 88, 7, 6, 128, 18, 
+7, 2, 0, 18, 9, 4, 0, 18, 10, 5, 0, 18, 11, 6, 0, 50, 
+0, 0, 128, 68, 7, 4, 0, 15, 0, 3, 0, 88, 7, 2, 128, 7, 
+3, 2, 0, 88, 7, 241, 127, 52, 7, 0, 0, 50, 0, 0, 128, 76, 
+7, 2, 0, 88, 3, 237, 127, 50, 0, 0, 128, 75, 0, 1, 0, 0, 
+192, 10, 101, 114, 114, 111, 114, 12, 111, 112, 101, 110, 116, 97, 103, 0, 
+97, 3, 0, 3, 0, 8, 0, 10, 54, 0, 0, 0, 57, 0, 1, 0, 
+54, 1, 2, 0, 57, 1, 3, 1, 51, 2, 4, 0, 55, 2, 5, 0, 
+51, 2, 6, 0, 55, 2, 7, 0, 50, 0, 0, 128, 75, 0, 1, 0, 
+13, 80, 97, 114, 115, 101, 88, 77, 76, 0, 16, 84, 111, 107, 101, 110, 
+105, 115, 101, 88, 77, 76, 0, 9, 102, 105, 110, 100, 11, 115, 116, 114, 
+105, 110, 103, 16, 116, 111, 107, 101, 110, 105, 115, 101, 120, 109, 108, 7, 
+119, 103, 0, 
+};
+
+/* This is src/lua/utils.lua */
+static const char file_6[] = {
+27, 76, 74, 2, 10, 31, 0, 2, 2, 0, 0, 0, 6, 1, 1, 0, 
+0, 88, 2, 2, 128, 76, 0, 2, 0, 88, 2, 1, 128, 76, 1, 2, 
+0, 75, 0, 1, 0, 31, 0, 2, 2, 0, 0, 0, 6, 1, 0, 1, 
+0, 88, 2, 2, 128, 76, 0, 2, 0, 88, 2, 1, 128, 76, 1, 2, 
+0, 75, 0, 1, 0, 36, 0, 1, 4, 0, 2, 0, 4, 54, 1, 0, 
+0, 57, 1, 1, 1, 18, 3, 0, 0, 68, 1, 2, 0, 14, 116, 114, 
+97, 110, 115, 99, 111, 100, 101, 7, 119, 103, 32, 0, 3, 3, 0, 0, 
+1, 6, 9, 0, 0, 0, 88, 3, 2, 128, 76, 1, 2, 0, 88, 3, 
+1, 128, 76, 2, 2, 0, 75, 0, 1, 0, 2, 54, 0, 1, 5, 0, 
+2, 0, 8, 18, 3, 0, 0, 57, 1, 0, 0, 39, 4, 1, 0, 66, 
+1, 3, 4, 15, 0, 3, 0, 88, 4, 1, 128, 76, 3, 2, 0, 76, 
+0, 2, 0, 14, 40, 91, 94, 47, 92, 93, 43, 41, 36, 9, 102, 105, 
+110, 100, 185, 1, 0, 1, 8, 0, 9, 1, 28, 41, 1, 1, 0, 52, 
+2, 3, 0, 39, 3, 0, 0, 18, 4, 0, 0, 38, 3, 4, 3, 62, 
+3, 1, 2, 85, 3, 16, 128, 54, 3, 1, 0, 57, 3, 2, 3, 18, 
+5, 1, 0, 66, 3, 2, 2, 14, 0, 3, 0, 88, 4, 1, 128, 88, 
+3, 9, 128, 21, 4, 2, 0, 22, 4, 0, 4, 57, 5, 3, 3, 39, 
+6, 4, 0, 57, 7, 5, 3, 38, 5, 7, 5, 60, 5, 4, 2, 22, 
+1, 0, 1, 88, 3, 239, 127, 54, 3, 6, 0, 57, 3, 7, 3, 18, 
+5, 2, 0, 39, 6, 8, 0, 68, 3, 3, 0, 6, 10, 11, 99, 111, 
+110, 99, 97, 116, 10, 116, 97, 98, 108, 101, 16, 99, 117, 114, 114, 101, 
+110, 116, 108, 105, 110, 101, 6, 58, 14, 115, 104, 111, 114, 116, 95, 115, 
+114, 99, 12, 103, 101, 116, 105, 110, 102, 111, 10, 100, 101, 98, 117, 103, 
+16, 69, 120, 99, 101, 112, 116, 105, 111, 110, 58, 32, 2, 198, 1, 0, 
+2, 13, 0, 6, 1, 40, 18, 4, 0, 0, 57, 2, 0, 0, 18, 5, 
+1, 0, 66, 2, 3, 2, 14, 0, 2, 0, 88, 2, 3, 128, 52, 2, 
+3, 0, 62, 0, 1, 2, 76, 2, 2, 0, 52, 2, 0, 0, 39, 3, 
+1, 0, 18, 4, 1, 0, 39, 5, 2, 0, 38, 3, 5, 3, 41, 4, 
+0, 0, 43, 5, 0, 0, 18, 8, 0, 0, 57, 6, 3, 0, 18, 9, 
+3, 0, 66, 6, 3, 4, 88, 9, 7, 128, 22, 4, 0, 4, 60, 9, 
+4, 2, 18, 5, 10, 0, 54, 11, 4, 0, 5, 4, 11, 0, 88, 11, 
+1, 128, 88, 6, 2, 128, 69, 9, 3, 3, 82, 9, 247, 127, 54, 6, 
+4, 0, 4, 4, 6, 0, 88, 6, 6, 128, 22, 6, 0, 4, 18, 9, 
+0, 0, 57, 7, 5, 0, 18, 10, 5, 0, 66, 7, 3, 2, 60, 7, 
+6, 2, 76, 2, 2, 0, 8, 115, 117, 98, 10, 109, 97, 120, 78, 98, 
+11, 103, 109, 97, 116, 99, 104, 7, 40, 41, 9, 40, 46, 45, 41, 9, 
+102, 105, 110, 100, 2, 158, 2, 0, 1, 12, 0, 13, 1, 51, 52, 1, 
+0, 0, 54, 2, 0, 0, 18, 4, 0, 0, 66, 2, 2, 4, 88, 5, 
+35, 128, 43, 7, 0, 0, 54, 8, 1, 0, 18, 10, 6, 0, 66, 8, 
+2, 2, 7, 8, 2, 0, 88, 8, 7, 128, 54, 8, 2, 0, 57, 8, 
+3, 8, 39, 10, 4, 0, 18, 11, 6, 0, 66, 8, 3, 2, 18, 7, 
+8, 0, 88, 8, 19, 128, 54, 8, 1, 0, 18, 10, 6, 0, 66, 8, 
+2, 2, 7, 8, 5, 0, 88, 8, 5, 128, 54, 8, 6, 0, 18, 10, 
+6, 0, 66, 8, 2, 2, 18, 7, 8, 0, 88, 8, 9, 128, 11, 6, 
+0, 0, 88, 8, 2, 128, 43, 7, 0, 0, 88, 8, 5, 128, 39, 8, 
+7, 0, 54, 9, 1, 0, 18, 11, 6, 0, 66, 9, 2, 2, 38, 7, 
+9, 8, 21, 8, 1, 0, 22, 8, 0, 8, 60, 7, 8, 1, 69, 5, 
+3, 3, 82, 5, 219, 127, 39, 2, 8, 0, 54, 3, 9, 0, 57, 3, 
+10, 3, 18, 5, 1, 0, 39, 6, 11, 0, 66, 3, 3, 2, 39, 4, 
+12, 0, 38, 2, 4, 2, 76, 2, 2, 0, 6, 125, 7, 44, 32, 11, 
+99, 111, 110, 99, 97, 116, 10, 116, 97, 98, 108, 101, 6, 123, 13, 117, 
+110, 107, 110, 111, 119, 110, 32, 13, 116, 111, 115, 116, 114, 105, 110, 103, 
+11, 110, 117, 109, 98, 101, 114, 7, 37, 113, 11, 102, 111, 114, 109, 97, 
+116, 11, 115, 116, 114, 105, 110, 103, 9, 116, 121, 112, 101, 11, 105, 112, 
+97, 105, 114, 115, 2, 15, 0, 0, 1, 0, 0, 0, 2, 41, 0, 1, 
+0, 76, 0, 2, 0, 21, 0, 2, 3, 1, 0, 0, 3, 45, 2, 0, 
+0, 56, 2, 1, 2, 76, 2, 2, 0, 0, 192, 100, 0, 3, 6, 1, 
+4, 0, 12, 54, 3, 0, 0, 18, 5, 1, 0, 66, 3, 2, 2, 7, 
+3, 1, 0, 88, 3, 4, 128, 54, 3, 2, 0, 39, 5, 3, 0, 66, 
+3, 2, 1, 88, 3, 2, 128, 45, 3, 0, 0, 60, 2, 1, 3, 75, 
+0, 1, 0, 0, 192, 29, 119, 114, 105, 116, 101, 32, 116, 111, 32, 105, 
+109, 109, 117, 116, 97, 98, 108, 101, 32, 116, 97, 98, 108, 101, 10, 101, 
+114, 114, 111, 114, 11, 110, 117, 109, 98, 101, 114, 9, 116, 121, 112, 101, 
+21, 0, 1, 2, 1, 0, 0, 3, 45, 1, 0, 0, 21, 1, 1, 0, 
+76, 1, 2, 0, 0, 192, 28, 0, 1, 4, 1, 1, 0, 3, 54, 1, 
+0, 0, 45, 3, 0, 0, 68, 1, 2, 0, 0, 192, 11, 105, 112, 97, 
+105, 114, 115, 17, 0, 1, 2, 1, 0, 0, 2, 45, 1, 0, 0, 76, 
+1, 2, 0, 0, 192, 215, 1, 1, 1, 7, 1, 12, 0, 22, 45, 1, 
+0, 0, 14, 0, 1, 0, 88, 1, 1, 128, 50, 0, 17, 128, 52, 1, 
+0, 0, 54, 2, 0, 0, 18, 4, 1, 0, 53, 5, 2, 0, 51, 6, 
+1, 0, 61, 6, 3, 5, 51, 6, 4, 0, 61, 6, 5, 5, 51, 6, 
+6, 0, 61, 6, 7, 5, 51, 6, 8, 0, 61, 6, 9, 5, 51, 6, 
+10, 0, 61, 6, 11, 5, 66, 2, 3, 1, 50, 0, 0, 128, 76, 1, 
+2, 0, 76, 0, 2, 0, 0, 192, 16, 103, 101, 116, 82, 97, 119, 65, 
+114, 114, 97, 121, 0, 13, 95, 95, 105, 112, 97, 105, 114, 115, 0, 10, 
+95, 95, 108, 101, 110, 0, 15, 95, 95, 110, 101, 119, 105, 110, 100, 101, 
+120, 0, 12, 95, 95, 105, 110, 100, 101, 120, 1, 0, 5, 15, 95, 95, 
+110, 101, 119, 105, 110, 100, 101, 120, 0, 12, 95, 95, 105, 110, 100, 101, 
+120, 0, 10, 95, 95, 108, 101, 110, 0, 16, 103, 101, 116, 82, 97, 119, 
+65, 114, 114, 97, 121, 0, 13, 95, 95, 105, 112, 97, 105, 114, 115, 0, 
+0, 17, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 146, 2, 
+3, 0, 5, 0, 22, 1, 32, 51, 0, 0, 0, 55, 0, 1, 0, 51, 
+0, 2, 0, 55, 0, 3, 0, 51, 0, 4, 0, 55, 0, 5, 0, 51, 
+0, 6, 0, 55, 0, 7, 0, 51, 0, 8, 0, 55, 0, 9, 0, 51, 
+0, 10, 0, 55, 0, 11, 0, 51, 0, 12, 0, 55, 0, 13, 0, 51, 
+0, 14, 0, 55, 0, 15, 0, 54, 0, 16, 0, 52, 2, 0, 0, 53, 
+3, 18, 0, 51, 4, 17, 0, 61, 4, 19, 3, 66, 0, 3, 2, 21, 
+0, 0, 0, 8, 0, 0, 0, 88, 0, 2, 128, 43, 0, 1, 0, 88, 
+1, 1, 128, 43, 0, 2, 0, 51, 1, 20, 0, 55, 1, 21, 0, 50, 
+0, 0, 128, 75, 0, 1, 0, 21, 73, 109, 109, 117, 116, 97, 98, 108, 
+105, 115, 101, 65, 114, 114, 97, 121, 0, 10, 95, 95, 108, 101, 110, 1, 
+0, 1, 10, 95, 95, 108, 101, 110, 0, 0, 17, 115, 101, 116, 109, 101, 
+116, 97, 116, 97, 98, 108, 101, 18, 84, 97, 98, 108, 101, 84, 111, 83, 
+116, 114, 105, 110, 103, 0, 16, 83, 112, 108, 105, 116, 83, 116, 114, 105, 
+110, 103, 0, 14, 84, 114, 97, 99, 101, 98, 97, 99, 107, 0, 13, 76, 
+101, 97, 102, 110, 97, 109, 101, 0, 14, 80, 108, 117, 114, 97, 108, 105, 
+115, 101, 0, 23, 67, 97, 110, 111, 110, 105, 99, 97, 108, 105, 115, 101, 
+83, 116, 114, 105, 110, 103, 0, 8, 109, 105, 110, 0, 8, 109, 97, 120, 
+0, 2, 0, 
+};
+
+/* This is src/lua/redraw.lua */
+static const char file_7[] = {
+27, 76, 74, 2, 10, 54, 0, 1, 3, 1, 1, 1, 8, 45, 1, 0, 
+0, 45, 2, 0, 0, 21, 2, 2, 0, 22, 2, 0, 2, 60, 0, 2, 
+1, 54, 1, 0, 0, 66, 1, 1, 1, 75, 0, 1, 0, 15, 128, 16, 
+81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 2, 21, 0, 0, 1, 
+1, 0, 0, 3, 52, 0, 0, 0, 46, 0, 0, 0, 75, 0, 1, 0, 
+15, 128, 224, 1, 0, 0, 6, 1, 10, 2, 29, 54, 0, 0, 0, 57, 
+0, 1, 0, 66, 0, 1, 3, 55, 1, 2, 0, 55, 0, 3, 0, 54, 
+0, 4, 0, 54, 2, 3, 0, 66, 0, 2, 2, 54, 1, 5, 0, 57, 
+1, 6, 1, 33, 1, 1, 0, 23, 1, 0, 1, 54, 2, 7, 0, 57, 
+2, 8, 2, 54, 4, 3, 0, 25, 4, 1, 4, 25, 5, 1, 1, 33, 
+4, 5, 4, 66, 2, 2, 2, 46, 0, 2, 0, 54, 2, 5, 0, 18, 
+4, 2, 0, 57, 2, 9, 2, 54, 5, 5, 0, 57, 5, 6, 5, 33, 
+5, 5, 0, 23, 5, 0, 5, 66, 2, 3, 1, 75, 0, 1, 0, 16, 
+128, 9, 119, 114, 97, 112, 10, 102, 108, 111, 111, 114, 9, 109, 97, 116, 
+104, 11, 109, 97, 114, 103, 105, 110, 13, 68, 111, 99, 117, 109, 101, 110, 
+116, 27, 71, 101, 116, 77, 97, 120, 105, 109, 117, 109, 65, 108, 108, 111, 
+119, 101, 100, 87, 105, 100, 116, 104, 16, 83, 99, 114, 101, 101, 110, 87, 
+105, 100, 116, 104, 17, 83, 99, 114, 101, 101, 110, 72, 101, 105, 103, 104, 
+116, 18, 103, 101, 116, 115, 99, 114, 101, 101, 110, 115, 105, 122, 101, 7, 
+119, 103, 2, 4, 126, 0, 2, 8, 0, 4, 0, 18, 54, 2, 0, 0, 
+54, 3, 1, 0, 57, 3, 2, 3, 56, 2, 3, 2, 57, 3, 3, 2, 
+15, 0, 3, 0, 88, 4, 9, 128, 18, 5, 2, 0, 57, 3, 3, 2, 
+18, 6, 0, 0, 18, 7, 1, 0, 66, 3, 4, 2, 14, 0, 3, 0, 
+88, 4, 1, 128, 43, 3, 1, 0, 76, 3, 2, 0, 43, 3, 1, 0, 
+76, 3, 2, 0, 15, 103, 101, 116, 99, 111, 110, 116, 101, 110, 116, 13, 
+118, 105, 101, 119, 109, 111, 100, 101, 13, 68, 111, 99, 117, 109, 101, 110, 
+116, 22, 77, 97, 114, 103, 105, 110, 67, 111, 110, 116, 114, 111, 108, 108, 
+101, 114, 115, 216, 1, 0, 3, 11, 5, 6, 1, 37, 15, 0, 1, 0, 
+88, 3, 12, 128, 45, 3, 0, 0, 66, 3, 1, 1, 54, 3, 0, 0, 
+45, 5, 1, 0, 18, 6, 0, 0, 54, 7, 1, 0, 57, 7, 2, 7, 
+23, 7, 0, 7, 18, 8, 1, 0, 66, 3, 5, 1, 45, 3, 2, 0, 
+66, 3, 1, 1, 57, 3, 3, 2, 57, 3, 4, 3, 15, 0, 3, 0, 
+88, 4, 18, 128, 45, 4, 3, 0, 18, 6, 3, 0, 66, 4, 2, 2, 
+22, 4, 0, 4, 57, 5, 3, 2, 57, 5, 5, 5, 3, 4, 5, 0, 
+88, 6, 10, 128, 45, 6, 4, 0, 45, 8, 1, 0, 54, 9, 1, 0, 
+57, 9, 2, 9, 32, 8, 9, 8, 32, 8, 5, 8, 33, 8, 4, 8, 
+18, 9, 0, 0, 18, 10, 3, 0, 66, 6, 4, 1, 75, 0, 1, 0, 
+10, 192, 16, 128, 5, 192, 11, 192, 1, 192, 11, 105, 110, 100, 101, 110, 
+116, 11, 98, 117, 108, 108, 101, 116, 10, 115, 116, 121, 108, 101, 11, 109, 
+97, 114, 103, 105, 110, 13, 68, 111, 99, 117, 109, 101, 110, 116, 18, 82, 
+65, 108, 105, 103, 110, 73, 110, 70, 105, 101, 108, 100, 2, 64, 0, 0, 
+2, 1, 2, 1, 8, 45, 0, 0, 0, 21, 0, 0, 0, 54, 1, 0, 
+0, 57, 1, 1, 1, 15, 0, 1, 0, 88, 2, 1, 128, 22, 0, 0, 
+0, 76, 0, 2, 0, 15, 128, 14, 115, 116, 97, 116, 117, 115, 98, 97, 
+114, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 2, 48, 0, 
+2, 4, 0, 1, 0, 8, 57, 2, 0, 0, 57, 3, 0, 1, 0, 2, 
+3, 0, 88, 2, 2, 128, 43, 2, 1, 0, 88, 3, 1, 128, 43, 2, 
+2, 0, 76, 2, 2, 0, 13, 112, 114, 105, 111, 114, 105, 116, 121, 133, 
+6, 1, 0, 11, 6, 27, 1, 134, 1, 54, 0, 0, 0, 23, 0, 0, 
+0, 54, 1, 1, 0, 57, 1, 2, 1, 15, 0, 1, 0, 88, 2, 98, 
+128, 53, 1, 6, 0, 54, 2, 3, 0, 54, 4, 1, 0, 57, 4, 4, 
+4, 14, 0, 4, 0, 88, 5, 1, 128, 39, 4, 5, 0, 66, 2, 2, 
+2, 62, 2, 1, 1, 54, 2, 7, 0, 57, 2, 4, 2, 14, 0, 2, 
+0, 88, 3, 1, 128, 39, 2, 8, 0, 62, 2, 3, 1, 45, 2, 0, 
+0, 54, 3, 1, 0, 57, 3, 9, 3, 56, 2, 3, 2, 14, 0, 2, 
+0, 88, 3, 1, 128, 39, 2, 8, 0, 62, 2, 5, 1, 45, 2, 1, 
+0, 66, 2, 1, 1, 45, 2, 2, 0, 41, 4, 0, 0, 54, 5, 0, 
+0, 23, 5, 0, 5, 54, 6, 10, 0, 23, 6, 0, 6, 54, 7, 0, 
+0, 23, 7, 0, 7, 66, 2, 5, 1, 54, 2, 11, 0, 41, 4, 0, 
+0, 54, 5, 0, 0, 23, 5, 0, 5, 54, 6, 10, 0, 54, 7, 12, 
+0, 57, 7, 13, 7, 18, 9, 1, 0, 39, 10, 8, 0, 66, 7, 3, 
+0, 65, 2, 3, 1, 52, 2, 0, 0, 54, 3, 14, 0, 54, 5, 15, 
+0, 57, 5, 16, 5, 18, 6, 2, 0, 66, 3, 3, 1, 54, 3, 12, 
+0, 57, 3, 17, 3, 18, 5, 2, 0, 51, 6, 18, 0, 66, 3, 3, 
+1, 53, 3, 19, 0, 54, 4, 20, 0, 18, 6, 2, 0, 66, 4, 2, 
+4, 88, 7, 4, 128, 21, 9, 3, 0, 22, 9, 0, 9, 57, 10, 21, 
+8, 60, 10, 9, 3, 69, 7, 3, 3, 82, 7, 250, 127, 54, 4, 12, 
+0, 57, 4, 13, 4, 18, 6, 3, 0, 39, 7, 22, 0, 66, 4, 3, 
+2, 18, 3, 4, 0, 54, 4, 23, 0, 57, 4, 24, 4, 18, 6, 3, 
+0, 21, 7, 3, 0, 66, 4, 3, 2, 7, 4, 25, 0, 88, 4, 8, 
+128, 54, 4, 23, 0, 57, 4, 24, 4, 18, 6, 3, 0, 41, 7, 1, 
+0, 21, 8, 3, 0, 23, 8, 0, 8, 66, 4, 4, 2, 18, 3, 4, 
+0, 54, 4, 26, 0, 41, 6, 0, 0, 54, 7, 0, 0, 23, 7, 0, 
+7, 54, 8, 10, 0, 18, 9, 3, 0, 66, 4, 5, 1, 45, 4, 3, 
+0, 66, 4, 1, 1, 23, 0, 0, 0, 45, 1, 4, 0, 21, 1, 1, 
+0, 41, 2, 0, 0, 1, 2, 1, 0, 88, 1, 24, 128, 45, 1, 1, 
+0, 66, 1, 1, 1, 45, 1, 4, 0, 21, 1, 1, 0, 41, 2, 1, 
+0, 41, 3, 255, 255, 77, 1, 15, 128, 45, 5, 2, 0, 41, 7, 0, 
+0, 18, 8, 0, 0, 54, 9, 10, 0, 23, 9, 0, 9, 18, 10, 0, 
+0, 66, 5, 5, 1, 45, 5, 5, 0, 41, 7, 0, 0, 18, 8, 0, 
+0, 45, 9, 4, 0, 56, 9, 4, 9, 66, 5, 4, 1, 23, 0, 0, 
+0, 79, 1, 241, 127, 45, 1, 3, 0, 66, 1, 1, 1, 75, 0, 1, 
+0, 19, 192, 9, 192, 3, 192, 5, 192, 15, 128, 1, 192, 18, 82, 65, 
+108, 105, 103, 110, 73, 110, 70, 105, 101, 108, 100, 6, 32, 8, 115, 117, 
+98, 11, 115, 116, 114, 105, 110, 103, 10, 32, 226, 148, 130, 32, 10, 118, 
+97, 108, 117, 101, 11, 105, 112, 97, 105, 114, 115, 1, 2, 0, 0, 6, 
+32, 0, 9, 115, 111, 114, 116, 19, 66, 117, 105, 108, 100, 83, 116, 97, 
+116, 117, 115, 66, 97, 114, 10, 69, 118, 101, 110, 116, 14, 70, 105, 114, 
+101, 69, 118, 101, 110, 116, 11, 99, 111, 110, 99, 97, 116, 10, 116, 97, 
+98, 108, 101, 18, 76, 65, 108, 105, 103, 110, 73, 110, 70, 105, 101, 108, 
+100, 16, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 12, 99, 104, 
+97, 110, 103, 101, 100, 5, 13, 68, 111, 99, 117, 109, 101, 110, 116, 1, 
+5, 0, 0, 0, 6, 91, 0, 7, 93, 32, 14, 40, 117, 110, 110, 97, 
+109, 101, 100, 41, 9, 110, 97, 109, 101, 13, 76, 101, 97, 102, 110, 97, 
+109, 101, 14, 115, 116, 97, 116, 117, 115, 98, 97, 114, 16, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 17, 83, 99, 114, 101, 101, 110, 72, 
+101, 105, 103, 104, 116, 2, 141, 1, 0, 1, 11, 6, 1, 2, 27, 45, 
+1, 0, 0, 54, 3, 0, 0, 45, 4, 1, 0, 33, 3, 4, 3, 25, 
+3, 0, 3, 66, 1, 2, 2, 45, 2, 2, 0, 66, 2, 1, 1, 45, 
+2, 3, 0, 21, 2, 2, 0, 41, 3, 1, 0, 41, 4, 255, 255, 77, 
+2, 11, 128, 41, 6, 0, 0, 3, 6, 0, 0, 88, 6, 6, 128, 45, 
+6, 4, 0, 18, 8, 1, 0, 18, 9, 0, 0, 45, 10, 3, 0, 56, 
+10, 5, 10, 66, 6, 4, 1, 23, 0, 1, 0, 79, 2, 245, 127, 45, 
+2, 5, 0, 66, 2, 1, 1, 75, 0, 1, 0, 0, 192, 23, 192, 10, 
+192, 22, 192, 1, 192, 5, 192, 16, 83, 99, 114, 101, 101, 110, 87, 105, 
+100, 116, 104, 4, 2, 154, 1, 0, 1, 11, 6, 2, 2, 27, 45, 1, 
+0, 0, 54, 3, 0, 0, 45, 4, 1, 0, 33, 3, 4, 3, 25, 3, 
+0, 3, 66, 1, 2, 2, 45, 2, 2, 0, 66, 2, 1, 1, 41, 2, 
+1, 0, 45, 3, 3, 0, 21, 3, 3, 0, 41, 4, 1, 0, 77, 2, 
+11, 128, 54, 6, 1, 0, 3, 0, 6, 0, 88, 6, 6, 128, 45, 6, 
+4, 0, 18, 8, 1, 0, 18, 9, 0, 0, 45, 10, 3, 0, 56, 10, 
+5, 10, 66, 6, 4, 1, 22, 0, 1, 0, 79, 2, 245, 127, 45, 2, 
+5, 0, 66, 2, 1, 1, 75, 0, 1, 0, 0, 192, 26, 192, 10, 192, 
+25, 192, 1, 192, 5, 192, 17, 83, 99, 114, 101, 101, 110, 72, 101, 105, 
+103, 104, 116, 16, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 4, 
+2, 17, 0, 0, 1, 1, 0, 0, 2, 49, 0, 2, 0, 75, 0, 1, 
+0, 37, 128, 192, 2, 0, 1, 13, 7, 0, 3, 74, 43, 1, 0, 0, 
+41, 2, 0, 0, 23, 3, 0, 0, 41, 4, 1, 0, 77, 2, 26, 128, 
+45, 6, 0, 0, 56, 6, 5, 6, 45, 7, 1, 0, 4, 6, 7, 0, 
+88, 7, 20, 128, 45, 7, 2, 0, 56, 7, 5, 7, 41, 8, 0, 0, 
+23, 9, 0, 0, 41, 10, 1, 0, 77, 8, 11, 128, 45, 12, 3, 0, 
+56, 12, 11, 12, 5, 12, 6, 0, 88, 12, 6, 128, 45, 12, 4, 0, 
+56, 12, 11, 12, 5, 12, 7, 0, 88, 12, 2, 128, 33, 1, 5, 11, 
+88, 8, 1, 128, 79, 8, 245, 127, 15, 0, 1, 0, 88, 8, 1, 128, 
+88, 2, 1, 128, 79, 2, 230, 127, 15, 0, 1, 0, 88, 2, 2, 128, 
+9, 1, 1, 0, 88, 2, 2, 128, 41, 2, 0, 0, 76, 2, 2, 0, 
+41, 2, 0, 0, 41, 3, 0, 0, 23, 4, 0, 0, 41, 5, 1, 0, 
+77, 3, 26, 128, 32, 7, 1, 6, 41, 8, 0, 0, 3, 8, 7, 0, 
+88, 8, 21, 128, 1, 7, 0, 0, 88, 8, 19, 128, 45, 8, 3, 0, 
+56, 8, 7, 8, 45, 9, 0, 0, 56, 9, 6, 9, 5, 8, 9, 0, 
+88, 8, 13, 128, 45, 8, 4, 0, 56, 8, 7, 8, 45, 9, 2, 0, 
+56, 9, 6, 9, 5, 8, 9, 0, 88, 8, 7, 128, 45, 8, 5, 0, 
+56, 8, 7, 8, 45, 9, 6, 0, 56, 9, 6, 9, 5, 8, 9, 0, 
+88, 8, 1, 128, 22, 2, 0, 2, 79, 3, 230, 127, 24, 3, 2, 2, 
+3, 3, 0, 0, 88, 3, 2, 128, 41, 3, 0, 0, 76, 3, 2, 0, 
+76, 1, 2, 0, 38, 192, 28, 192, 39, 192, 32, 192, 33, 192, 34, 192, 
+40, 192, 2, 0, 4, 93, 0, 5, 7, 7, 0, 0, 18, 41, 5, 0, 
+0, 3, 5, 0, 0, 88, 5, 14, 128, 45, 5, 0, 0, 1, 0, 5, 
+0, 88, 5, 11, 128, 45, 5, 1, 0, 60, 1, 0, 5, 45, 5, 2, 
+0, 60, 2, 0, 5, 45, 5, 3, 0, 60, 3, 0, 5, 45, 5, 4, 
+0, 60, 4, 0, 5, 45, 5, 5, 0, 45, 6, 6, 0, 60, 6, 0, 
+5, 75, 0, 1, 0, 8, 192, 8, 0, 9, 0, 10, 0, 11, 0, 12, 
+0, 6, 0, 143, 17, 1, 0, 30, 29, 39, 3, 203, 3, 54, 0, 0, 
+0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 2, 1, 54, 2, 0, 
+0, 57, 2, 3, 2, 45, 3, 0, 0, 54, 5, 4, 0, 25, 5, 0, 
+5, 66, 3, 2, 2, 54, 4, 0, 0, 57, 4, 5, 4, 54, 5, 0, 
+0, 57, 5, 6, 5, 54, 6, 7, 0, 39, 7, 8, 0, 54, 8, 4, 
+0, 39, 9, 9, 0, 45, 10, 1, 0, 39, 11, 9, 0, 18, 12, 4, 
+0, 39, 13, 10, 0, 54, 14, 11, 0, 54, 16, 0, 0, 57, 16, 12, 
+16, 66, 14, 2, 2, 38, 6, 14, 6, 45, 7, 2, 0, 14, 0, 7, 
+0, 88, 8, 13, 128, 12, 7, 5, 0, 88, 7, 11, 128, 45, 7, 3, 
+0, 66, 7, 1, 2, 45, 8, 4, 0, 5, 7, 8, 0, 88, 7, 5, 
+128, 45, 7, 5, 0, 5, 6, 7, 0, 88, 7, 2, 128, 43, 7, 1, 
+0, 88, 8, 1, 128, 43, 7, 2, 0, 49, 2, 1, 0, 46, 5, 6, 
+0, 45, 8, 6, 0, 22, 8, 1, 8, 46, 6, 8, 0, 54, 8, 4, 
+0, 45, 9, 7, 0, 66, 9, 1, 2, 33, 8, 9, 8, 51, 9, 13, 
+0, 54, 10, 0, 0, 56, 10, 0, 10, 18, 11, 1, 0, 18, 14, 10, 
+0, 57, 12, 14, 10, 18, 15, 1, 0, 66, 12, 3, 3, 18, 1, 13, 
+0, 55, 12, 15, 0, 54, 12, 15, 0, 14, 0, 12, 0, 88, 12, 7, 
+128, 54, 12, 16, 0, 39, 14, 17, 0, 18, 15, 11, 0, 39, 16, 18, 
+0, 21, 17, 10, 0, 38, 14, 17, 14, 66, 12, 2, 1, 54, 12, 0, 
+0, 57, 12, 2, 12, 56, 13, 12, 10, 45, 14, 13, 0, 45, 16, 1, 
+0, 32, 16, 4, 16, 57, 17, 19, 10, 56, 17, 12, 17, 32, 16, 17, 
+16, 54, 17, 20, 0, 18, 19, 13, 0, 54, 20, 0, 0, 57, 20, 3, 
+20, 66, 17, 3, 2, 32, 16, 17, 16, 57, 17, 21, 10, 57, 17, 22, 
+17, 14, 0, 17, 0, 88, 18, 1, 128, 41, 17, 0, 0, 32, 16, 17, 
+16, 23, 17, 1, 3, 66, 14, 3, 1, 23, 12, 1, 0, 54, 13, 15, 
+0, 33, 13, 13, 3, 23, 13, 1, 13, 54, 14, 0, 0, 18, 16, 14, 
+0, 57, 14, 23, 14, 18, 17, 0, 0, 66, 14, 3, 2, 33, 13, 14, 
+13, 54, 14, 0, 0, 43, 15, 0, 0, 61, 15, 24, 14, 54, 14, 0, 
+0, 43, 15, 0, 0, 61, 15, 25, 14, 41, 14, 0, 0, 3, 14, 13, 
+0, 88, 14, 54, 128, 85, 14, 53, 128, 54, 14, 0, 0, 56, 14, 12, 
+14, 14, 0, 14, 0, 88, 15, 1, 128, 88, 14, 48, 128, 18, 17, 14, 
+0, 57, 15, 26, 14, 66, 15, 2, 2, 45, 16, 14, 0, 18, 18, 12, 
+0, 18, 19, 14, 0, 66, 16, 3, 2, 21, 17, 15, 0, 41, 18, 1, 
+0, 41, 19, 255, 255, 77, 17, 29, 128, 56, 21, 20, 15, 9, 20, 1, 
+0, 88, 22, 8, 128, 18, 22, 9, 0, 18, 24, 13, 0, 18, 25, 14, 
+0, 18, 26, 21, 0, 18, 27, 16, 0, 18, 28, 12, 0, 66, 22, 6, 
+1, 88, 22, 7, 128, 18, 22, 9, 0, 18, 24, 13, 0, 18, 25, 14, 
+0, 18, 26, 21, 0, 43, 27, 0, 0, 18, 28, 12, 0, 66, 22, 6, 
+1, 54, 22, 0, 0, 61, 12, 24, 22, 54, 22, 0, 0, 57, 23, 27, 
+21, 61, 23, 25, 22, 23, 13, 1, 13, 41, 22, 0, 0, 1, 13, 22, 
+0, 88, 22, 1, 128, 88, 17, 1, 128, 79, 17, 227, 127, 54, 17, 0, 
+0, 18, 19, 17, 0, 57, 17, 23, 17, 18, 20, 12, 0, 66, 17, 3, 
+2, 33, 13, 17, 13, 23, 12, 1, 12, 88, 14, 199, 127, 41, 14, 0, 
+0, 3, 14, 13, 0, 88, 14, 6, 128, 18, 14, 9, 0, 18, 16, 13, 
+0, 45, 17, 15, 0, 45, 18, 15, 0, 43, 19, 0, 0, 66, 14, 5, 
+1, 54, 14, 15, 0, 33, 13, 14, 3, 18, 12, 0, 0, 54, 14, 4, 
+0, 1, 13, 14, 0, 88, 14, 64, 128, 85, 14, 63, 128, 54, 14, 0, 
+0, 56, 14, 12, 14, 14, 0, 14, 0, 88, 15, 1, 128, 88, 14, 58, 
+128, 45, 15, 14, 0, 18, 17, 12, 0, 18, 18, 14, 0, 66, 15, 3, 
+2, 54, 16, 28, 0, 18, 20, 14, 0, 57, 18, 26, 14, 66, 18, 2, 
+0, 65, 16, 0, 4, 88, 19, 38, 128, 9, 19, 1, 0, 88, 21, 8, 
+128, 18, 21, 9, 0, 18, 23, 13, 0, 18, 24, 14, 0, 18, 25, 20, 
+0, 18, 26, 15, 0, 18, 27, 12, 0, 66, 21, 6, 1, 88, 21, 7, 
+128, 18, 21, 9, 0, 18, 23, 13, 0, 18, 24, 14, 0, 18, 25, 20, 
+0, 43, 26, 0, 0, 18, 27, 12, 0, 66, 21, 6, 1, 54, 21, 0, 
+0, 57, 21, 24, 21, 14, 0, 21, 0, 88, 21, 7, 128, 9, 13, 2, 
+0, 88, 21, 5, 128, 54, 21, 0, 0, 61, 12, 24, 21, 54, 21, 0, 
+0, 57, 22, 27, 20, 61, 22, 25, 21, 54, 21, 0, 0, 61, 12, 29, 
+21, 54, 21, 0, 0, 57, 22, 27, 20, 61, 22, 30, 21, 22, 13, 1, 
+13, 54, 21, 4, 0, 1, 21, 13, 0, 88, 21, 1, 128, 88, 16, 2, 
+128, 69, 19, 3, 3, 82, 19, 216, 127, 54, 16, 0, 0, 18, 18, 16, 
+0, 57, 16, 31, 16, 18, 19, 12, 0, 66, 16, 3, 2, 32, 13, 16, 
+13, 22, 12, 1, 12, 88, 14, 189, 127, 54, 14, 0, 0, 57, 14, 24, 
+14, 14, 0, 14, 0, 88, 14, 6, 128, 54, 14, 0, 0, 41, 15, 1, 
+0, 61, 15, 24, 14, 54, 14, 0, 0, 41, 15, 1, 0, 61, 15, 25, 
+14, 54, 14, 4, 0, 3, 13, 14, 0, 88, 14, 6, 128, 18, 14, 9, 
+0, 18, 16, 13, 0, 45, 17, 16, 0, 45, 18, 16, 0, 43, 19, 0, 
+0, 66, 14, 5, 1, 41, 14, 0, 0, 23, 15, 1, 8, 41, 16, 1, 
+0, 77, 14, 12, 128, 45, 18, 12, 0, 56, 18, 17, 18, 45, 19, 6, 
+0, 4, 18, 19, 0, 88, 18, 6, 128, 18, 18, 9, 0, 18, 20, 17, 
+0, 45, 21, 17, 0, 45, 22, 17, 0, 43, 23, 0, 0, 66, 18, 5, 
+1, 79, 14, 244, 127, 15, 0, 7, 0, 88, 14, 4, 128, 54, 14, 32, 
+0, 57, 14, 33, 14, 66, 14, 1, 1, 88, 14, 54, 128, 45, 14, 18, 
+0, 18, 16, 8, 0, 66, 14, 2, 2, 8, 14, 2, 0, 88, 15, 49, 
+128, 45, 15, 19, 0, 41, 17, 0, 0, 23, 18, 1, 8, 18, 19, 14, 
+0, 66, 15, 4, 1, 41, 15, 0, 0, 23, 16, 1, 8, 41, 17, 1, 
+0, 41, 18, 0, 0, 1, 14, 18, 0, 88, 18, 5, 128, 18, 18, 16, 
+0, 18, 19, 15, 0, 41, 17, 255, 255, 18, 16, 19, 0, 18, 15, 18, 
+0, 18, 18, 15, 0, 18, 19, 16, 0, 18, 20, 17, 0, 77, 18, 29, 
+128, 32, 22, 14, 21, 41, 23, 0, 0, 3, 23, 22, 0, 88, 23, 15, 
+128, 1, 22, 8, 0, 88, 23, 13, 128, 45, 23, 20, 0, 45, 24, 20, 
+0, 56, 24, 22, 24, 60, 24, 21, 23, 45, 23, 21, 0, 45, 24, 21, 
+0, 56, 24, 22, 24, 60, 24, 21, 23, 45, 23, 22, 0, 45, 24, 22, 
+0, 56, 24, 22, 24, 60, 24, 21, 23, 88, 23, 9, 128, 45, 23, 20, 
+0, 45, 24, 17, 0, 60, 24, 21, 23, 45, 23, 21, 0, 45, 24, 17, 
+0, 60, 24, 21, 23, 45, 23, 22, 0, 43, 24, 0, 0, 60, 24, 21, 
+23, 79, 18, 227, 127, 41, 14, 0, 0, 23, 15, 1, 8, 41, 16, 1, 
+0, 77, 14, 87, 128, 45, 18, 8, 0, 56, 18, 17, 18, 45, 19, 9, 
+0, 56, 19, 17, 19, 45, 20, 10, 0, 56, 20, 17, 20, 14, 0, 7, 
+0, 88, 21, 12, 128, 45, 21, 20, 0, 56, 21, 17, 21, 5, 21, 18, 
+0, 88, 21, 8, 128, 45, 21, 21, 0, 56, 21, 17, 21, 5, 21, 19, 
+0, 88, 21, 4, 128, 45, 21, 22, 0, 56, 21, 17, 21, 4, 21, 20, 
+0, 88, 21, 66, 128, 45, 21, 20, 0, 60, 18, 17, 21, 45, 21, 21, 
+0, 60, 19, 17, 21, 45, 21, 22, 0, 60, 20, 17, 21, 14, 0, 7, 
+0, 88, 21, 7, 128, 45, 21, 23, 0, 41, 23, 0, 0, 18, 24, 17, 
+0, 54, 25, 7, 0, 23, 25, 1, 25, 18, 26, 17, 0, 66, 21, 5, 
+1, 45, 21, 15, 0, 5, 18, 21, 0, 88, 21, 4, 128, 45, 21, 24, 
+0, 18, 23, 17, 0, 66, 21, 2, 1, 88, 21, 44, 128, 45, 21, 16, 
+0, 5, 18, 21, 0, 88, 21, 4, 128, 45, 21, 25, 0, 18, 23, 17, 
+0, 66, 21, 2, 1, 88, 21, 37, 128, 45, 21, 17, 0, 4, 18, 21, 
+0, 88, 21, 34, 128, 57, 21, 21, 18, 57, 21, 22, 21, 14, 0, 21, 
+0, 88, 22, 1, 128, 41, 21, 0, 0, 14, 0, 5, 0, 88, 22, 9, 
+128, 18, 24, 18, 0, 57, 22, 34, 18, 18, 25, 19, 0, 45, 26, 1, 
+0, 32, 26, 4, 26, 32, 26, 21, 26, 18, 27, 17, 0, 66, 22, 5, 
+1, 88, 22, 11, 128, 18, 24, 18, 0, 57, 22, 35, 18, 18, 25, 19, 
+0, 45, 26, 1, 0, 32, 26, 4, 26, 32, 26, 21, 26, 18, 27, 17, 
+0, 43, 28, 0, 0, 45, 29, 11, 0, 56, 29, 17, 29, 66, 22, 7, 
+1, 10, 20, 0, 0, 88, 22, 5, 128, 45, 22, 26, 0, 18, 24, 17, 
+0, 18, 25, 20, 0, 18, 26, 18, 0, 66, 22, 4, 1, 79, 14, 169, 
+127, 18, 14, 8, 0, 54, 15, 4, 0, 23, 15, 1, 15, 41, 16, 1, 
+0, 77, 14, 10, 128, 45, 18, 20, 0, 45, 19, 27, 0, 60, 19, 17, 
+18, 45, 18, 21, 0, 45, 19, 27, 0, 60, 19, 17, 18, 45, 18, 22, 
+0, 43, 19, 0, 0, 60, 19, 17, 18, 79, 14, 246, 127, 45, 14, 28, 
+0, 66, 14, 1, 1, 54, 14, 36, 0, 54, 16, 37, 0, 57, 16, 38, 
+16, 66, 14, 2, 1, 45, 14, 3, 0, 66, 14, 1, 2, 46, 4, 14, 
+0, 50, 0, 0, 128, 75, 0, 1, 0, 0, 192, 16, 128, 37, 128, 12, 
+192, 35, 128, 36, 128, 43, 128, 20, 192, 38, 192, 39, 192, 40, 192, 41, 
+192, 42, 192, 2, 192, 17, 192, 29, 192, 30, 192, 28, 192, 44, 192, 4, 
+192, 32, 192, 33, 192, 34, 192, 3, 192, 24, 192, 27, 192, 18, 192, 31, 
+192, 21, 192, 11, 82, 101, 100, 114, 97, 119, 10, 69, 118, 101, 110, 116, 
+14, 70, 105, 114, 101, 69, 118, 101, 110, 116, 21, 114, 101, 110, 100, 101, 
+114, 77, 97, 114, 107, 101, 100, 76, 105, 110, 101, 15, 114, 101, 110, 100, 
+101, 114, 76, 105, 110, 101, 16, 99, 108, 101, 97, 114, 115, 99, 114, 101, 
+101, 110, 7, 119, 103, 15, 115, 112, 97, 99, 101, 66, 101, 108, 111, 119, 
+9, 98, 111, 116, 119, 9, 98, 111, 116, 112, 11, 105, 112, 97, 105, 114, 
+115, 7, 119, 110, 9, 119, 114, 97, 112, 9, 116, 111, 112, 119, 9, 116, 
+111, 112, 112, 15, 115, 112, 97, 99, 101, 65, 98, 111, 118, 101, 11, 105, 
+110, 100, 101, 110, 116, 10, 115, 116, 121, 108, 101, 23, 71, 101, 116, 87, 
+105, 100, 116, 104, 70, 114, 111, 109, 79, 102, 102, 115, 101, 116, 7, 120, 
+115, 25, 32, 110, 111, 116, 32, 105, 110, 32, 112, 97, 114, 97, 32, 111, 
+102, 32, 108, 101, 110, 32, 10, 119, 111, 114, 100, 32, 10, 101, 114, 114, 
+111, 114, 7, 99, 108, 18, 103, 101, 116, 76, 105, 110, 101, 79, 102, 87, 
+111, 114, 100, 0, 13, 118, 105, 101, 119, 109, 111, 100, 101, 13, 116, 111, 
+115, 116, 114, 105, 110, 103, 6, 32, 6, 43, 6, 120, 16, 83, 99, 114, 
+101, 101, 110, 87, 105, 100, 116, 104, 7, 109, 112, 11, 109, 97, 114, 103, 
+105, 110, 17, 83, 99, 114, 101, 101, 110, 72, 101, 105, 103, 104, 116, 7, 
+99, 111, 7, 99, 119, 7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 
+116, 4, 2, 0, 53, 0, 0, 5, 3, 0, 0, 10, 45, 0, 0, 0, 
+66, 0, 1, 2, 45, 1, 1, 0, 66, 1, 1, 1, 45, 1, 2, 0, 
+45, 3, 0, 0, 66, 3, 1, 2, 33, 3, 0, 3, 66, 1, 2, 1, 
+75, 0, 1, 0, 13, 192, 45, 192, 14, 192, 81, 0, 2, 10, 0, 3, 
+0, 12, 41, 2, 0, 0, 54, 3, 0, 0, 54, 5, 1, 0, 66, 3, 
+2, 4, 88, 6, 2, 128, 21, 8, 7, 0, 32, 2, 8, 2, 69, 6, 
+3, 3, 82, 6, 252, 127, 54, 3, 1, 0, 61, 2, 2, 3, 75, 0, 
+1, 0, 14, 119, 111, 114, 100, 99, 111, 117, 110, 116, 13, 68, 111, 99, 
+117, 109, 101, 110, 116, 11, 105, 112, 97, 105, 114, 115, 201, 7, 3, 0, 
+51, 0, 42, 0, 82, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 2, 
+0, 57, 1, 3, 1, 54, 2, 2, 0, 57, 2, 4, 2, 54, 3, 2, 
+0, 57, 3, 5, 3, 54, 4, 2, 0, 57, 4, 6, 4, 54, 5, 2, 
+0, 57, 5, 7, 5, 54, 6, 2, 0, 57, 6, 8, 6, 54, 7, 2, 
+0, 57, 7, 9, 7, 54, 8, 2, 0, 57, 8, 10, 8, 54, 9, 2, 
+0, 57, 9, 11, 9, 54, 10, 2, 0, 57, 10, 12, 10, 54, 11, 2, 
+0, 57, 11, 13, 11, 54, 12, 2, 0, 57, 12, 14, 12, 54, 13, 2, 
+0, 57, 13, 15, 13, 54, 14, 2, 0, 57, 14, 16, 14, 52, 15, 0, 
+0, 41, 16, 0, 0, 51, 17, 17, 0, 55, 17, 18, 0, 51, 17, 19, 
+0, 55, 17, 20, 0, 51, 17, 21, 0, 55, 17, 22, 0, 51, 17, 23, 
+0, 51, 18, 24, 0, 53, 19, 25, 0, 51, 20, 26, 0, 51, 21, 27, 
+0, 53, 22, 28, 0, 18, 23, 11, 0, 58, 25, 1, 22, 66, 23, 2, 
+2, 51, 24, 29, 0, 53, 25, 30, 0, 18, 26, 11, 0, 58, 28, 1, 
+25, 66, 26, 2, 2, 51, 27, 31, 0, 52, 28, 0, 0, 52, 29, 0, 
+0, 52, 30, 0, 0, 52, 31, 0, 0, 52, 32, 0, 0, 52, 33, 0, 
+0, 52, 34, 0, 0, 44, 35, 36, 0, 43, 37, 2, 0, 52, 38, 0, 
+0, 52, 39, 0, 0, 52, 40, 0, 0, 52, 41, 0, 0, 52, 42, 0, 
+0, 41, 43, 0, 0, 51, 44, 32, 0, 55, 44, 33, 0, 51, 44, 34, 
+0, 51, 45, 35, 0, 51, 46, 36, 0, 55, 46, 37, 0, 51, 46, 38, 
+0, 54, 47, 39, 0, 54, 49, 40, 0, 57, 49, 41, 49, 18, 50, 46, 
+0, 66, 47, 3, 1, 50, 0, 0, 128, 75, 0, 1, 0, 12, 67, 104, 
+97, 110, 103, 101, 100, 10, 69, 118, 101, 110, 116, 21, 65, 100, 100, 69, 
+118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 17, 82, 101, 
+100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 0, 0, 0, 21, 73, 110, 
+118, 97, 108, 105, 100, 97, 116, 101, 83, 99, 114, 101, 101, 110, 0, 0, 
+1, 2, 0, 0, 170, 1, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 
+226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 
+226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 
+226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 0, 1, 2, 0, 0, 
+170, 1, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 
+226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 
+226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 
+226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 
+148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 128, 226, 148, 
+128, 226, 148, 128, 226, 148, 128, 0, 0, 1, 0, 1, 2, 12, 67, 72, 
+65, 78, 71, 69, 68, 0, 0, 17, 82, 101, 115, 105, 122, 101, 83, 99, 
+114, 101, 101, 110, 0, 26, 82, 101, 115, 101, 116, 78, 111, 110, 109, 111, 
+100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 115, 0, 20, 78, 111, 110, 
+109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 0, 18, 97, 100, 
+100, 114, 101, 100, 114, 97, 119, 116, 105, 109, 101, 9, 116, 105, 109, 101, 
+17, 103, 101, 116, 100, 114, 97, 119, 99, 111, 117, 110, 116, 19, 103, 101, 
+116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 104, 11, 115, 101, 116, 
+100, 105, 109, 15, 115, 101, 116, 114, 101, 118, 101, 114, 115, 101, 17, 115, 
+101, 116, 117, 110, 100, 101, 114, 108, 105, 110, 101, 14, 115, 101, 116, 98, 
+114, 105, 103, 104, 116, 12, 115, 101, 116, 98, 111, 108, 100, 14, 115, 101, 
+116, 110, 111, 114, 109, 97, 108, 15, 115, 99, 114, 111, 108, 108, 97, 114, 
+101, 97, 14, 99, 108, 101, 97, 114, 97, 114, 101, 97, 11, 103, 111, 116, 
+111, 120, 121, 10, 119, 114, 105, 116, 101, 7, 119, 103, 10, 102, 108, 111, 
+111, 114, 9, 109, 97, 116, 104, 0, 
+};
+
+/* This is src/lua/settings.lua */
+static const char file_8[] = {
+27, 76, 74, 2, 10, 114, 0, 0, 4, 1, 5, 0, 11, 54, 0, 0, 
+0, 45, 2, 0, 0, 66, 0, 2, 2, 15, 0, 0, 0, 88, 1, 5, 
+128, 55, 0, 1, 0, 54, 1, 2, 0, 54, 3, 3, 0, 57, 3, 4, 
+3, 66, 1, 2, 1, 75, 0, 1, 0, 0, 192, 19, 82, 101, 103, 105, 
+115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 10, 69, 118, 101, 110, 116, 
+14, 70, 105, 114, 101, 69, 118, 101, 110, 116, 19, 71, 108, 111, 98, 97, 
+108, 83, 101, 116, 116, 105, 110, 103, 115, 19, 76, 111, 97, 100, 70, 114, 
+111, 109, 83, 116, 114, 101, 97, 109, 57, 0, 0, 4, 1, 2, 0, 5, 
+54, 0, 0, 0, 45, 2, 0, 0, 54, 3, 1, 0, 66, 0, 3, 3, 
+76, 0, 2, 0, 0, 192, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 
+116, 105, 110, 103, 115, 17, 83, 97, 118, 101, 84, 111, 83, 116, 114, 101, 
+97, 109, 134, 1, 3, 0, 2, 0, 7, 0, 11, 52, 0, 0, 0, 55, 
+0, 0, 0, 54, 0, 1, 0, 39, 1, 2, 0, 38, 0, 1, 0, 51, 
+1, 3, 0, 55, 1, 4, 0, 51, 1, 5, 0, 55, 1, 6, 0, 50, 
+0, 0, 128, 75, 0, 1, 0, 23, 83, 97, 118, 101, 71, 108, 111, 98, 
+97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 23, 76, 111, 97, 100, 
+71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 27, 
+47, 46, 119, 111, 114, 100, 103, 114, 105, 110, 100, 101, 114, 46, 115, 101, 
+116, 116, 105, 110, 103, 115, 9, 72, 79, 77, 69, 19, 71, 108, 111, 98, 
+97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 0, 
+};
+
+/* This is src/lua/document.lua */
+static const char file_9[] = {
+27, 76, 74, 2, 10, 70, 0, 1, 9, 0, 3, 0, 10, 54, 1, 0, 
+0, 57, 3, 1, 0, 66, 1, 2, 4, 88, 4, 3, 128, 18, 8, 5, 
+0, 57, 6, 2, 5, 66, 6, 2, 1, 69, 4, 3, 3, 82, 4, 251, 
+127, 75, 0, 1, 0, 10, 112, 117, 114, 103, 101, 14, 100, 111, 99, 117, 
+109, 101, 110, 116, 115, 11, 105, 112, 97, 105, 114, 115, 47, 0, 1, 2, 
+0, 2, 0, 5, 43, 1, 2, 0, 61, 1, 0, 0, 43, 1, 2, 0, 
+61, 1, 1, 0, 75, 0, 1, 0, 16, 106, 117, 115, 116, 99, 104, 97, 
+110, 103, 101, 100, 12, 99, 104, 97, 110, 103, 101, 100, 47, 0, 1, 2, 
+0, 2, 0, 5, 43, 1, 0, 0, 61, 1, 0, 0, 43, 1, 0, 0, 
+61, 1, 1, 0, 75, 0, 1, 0, 16, 106, 117, 115, 116, 99, 104, 97, 
+110, 103, 101, 100, 12, 99, 104, 97, 110, 103, 101, 100, 25, 0, 1, 2, 
+0, 1, 0, 2, 57, 1, 0, 0, 76, 1, 2, 0, 14, 100, 111, 99, 
+117, 109, 101, 110, 116, 115, 77, 0, 2, 9, 0, 3, 0, 12, 54, 2, 
+0, 0, 57, 4, 1, 0, 66, 2, 2, 4, 88, 5, 4, 128, 57, 7, 
+2, 6, 5, 7, 1, 0, 88, 7, 1, 128, 76, 5, 2, 0, 69, 5, 
+3, 3, 82, 5, 250, 127, 43, 2, 0, 0, 76, 2, 2, 0, 9, 110, 
+97, 109, 101, 14, 100, 111, 99, 117, 109, 101, 110, 116, 115, 11, 105, 112, 
+97, 105, 114, 115, 205, 1, 0, 2, 9, 0, 6, 0, 22, 57, 2, 0, 
+0, 56, 2, 1, 2, 14, 0, 2, 0, 88, 3, 17, 128, 57, 3, 0, 
+0, 18, 6, 0, 0, 57, 4, 1, 0, 18, 7, 1, 0, 66, 4, 3, 
+2, 56, 2, 4, 3, 15, 0, 2, 0, 88, 3, 9, 128, 54, 3, 2, 
+0, 39, 5, 3, 0, 39, 6, 4, 0, 18, 7, 1, 0, 39, 8, 5, 
+0, 38, 6, 8, 6, 66, 3, 3, 1, 57, 3, 0, 0, 60, 2, 1, 
+3, 76, 2, 2, 0, 7, 39, 46, 35, 83, 111, 109, 101, 116, 104, 105, 
+110, 103, 32, 102, 114, 101, 97, 107, 121, 32, 104, 97, 112, 112, 101, 110, 
+101, 100, 32, 116, 111, 32, 39, 43, 68, 111, 99, 117, 109, 101, 110, 116, 
+32, 105, 110, 100, 101, 120, 32, 105, 110, 99, 111, 110, 115, 105, 115, 116, 
+101, 110, 99, 121, 32, 99, 111, 114, 114, 101, 99, 116, 101, 100, 17, 77, 
+111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 18, 95, 102, 105, 110, 
+100, 68, 111, 99, 117, 109, 101, 110, 116, 14, 100, 111, 99, 117, 109, 101, 
+110, 116, 115, 211, 1, 0, 4, 9, 0, 7, 1, 32, 61, 2, 0, 1, 
+18, 6, 0, 0, 57, 4, 1, 0, 18, 7, 2, 0, 66, 4, 3, 2, 
+14, 0, 4, 0, 88, 5, 3, 128, 57, 4, 2, 0, 21, 4, 4, 0, 
+22, 4, 0, 4, 57, 5, 2, 0, 60, 1, 4, 5, 57, 5, 2, 0, 
+60, 1, 2, 5, 57, 5, 3, 0, 15, 0, 5, 0, 88, 5, 4, 128, 
+57, 5, 3, 0, 57, 5, 0, 5, 5, 5, 2, 0, 88, 5, 4, 128, 
+18, 7, 0, 0, 57, 5, 4, 0, 18, 8, 2, 0, 66, 5, 3, 1, 
+18, 7, 0, 0, 57, 5, 5, 0, 66, 5, 2, 1, 54, 5, 6, 0, 
+57, 7, 2, 0, 66, 5, 2, 1, 75, 0, 1, 0, 25, 82, 101, 98, 
+117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 110, 116, 115, 77, 101, 110, 
+117, 10, 116, 111, 117, 99, 104, 15, 115, 101, 116, 67, 117, 114, 114, 101, 
+110, 116, 12, 99, 117, 114, 114, 101, 110, 116, 14, 100, 111, 99, 117, 109, 
+101, 110, 116, 115, 18, 95, 102, 105, 110, 100, 68, 111, 99, 117, 109, 101, 
+110, 116, 9, 110, 97, 109, 101, 2, 162, 1, 0, 3, 10, 2, 4, 0, 
+25, 18, 5, 0, 0, 57, 3, 0, 0, 18, 6, 1, 0, 66, 3, 3, 
+2, 14, 0, 3, 0, 88, 4, 1, 128, 75, 0, 1, 0, 57, 4, 1, 
+0, 56, 4, 3, 4, 45, 5, 0, 0, 57, 7, 1, 0, 18, 8, 3, 
+0, 66, 5, 3, 1, 45, 5, 1, 0, 57, 7, 1, 0, 18, 8, 2, 
+0, 18, 9, 4, 0, 66, 5, 4, 1, 18, 7, 0, 0, 57, 5, 2, 
+0, 66, 5, 2, 1, 54, 5, 3, 0, 57, 7, 1, 0, 66, 5, 2, 
+1, 75, 0, 1, 0, 0, 192, 1, 192, 25, 82, 101, 98, 117, 105, 108, 
+100, 68, 111, 99, 117, 109, 101, 110, 116, 115, 77, 101, 110, 117, 10, 116, 
+111, 117, 99, 104, 14, 100, 111, 99, 117, 109, 101, 110, 116, 115, 18, 95, 
+102, 105, 110, 100, 68, 111, 99, 117, 109, 101, 110, 116, 138, 2, 0, 2, 
+8, 1, 7, 1, 45, 57, 2, 0, 0, 21, 2, 2, 0, 9, 2, 0, 
+0, 88, 2, 2, 128, 43, 2, 1, 0, 76, 2, 2, 0, 18, 4, 0, 
+0, 57, 2, 1, 0, 18, 5, 1, 0, 66, 2, 3, 2, 14, 0, 2, 
+0, 88, 3, 1, 128, 75, 0, 1, 0, 57, 3, 0, 0, 56, 3, 2, 
+3, 45, 4, 0, 0, 57, 6, 0, 0, 18, 7, 2, 0, 66, 4, 3, 
+1, 57, 4, 0, 0, 43, 5, 0, 0, 60, 5, 1, 4, 18, 6, 0, 
+0, 57, 4, 2, 0, 66, 4, 2, 1, 54, 4, 3, 0, 57, 6, 0, 
+0, 66, 4, 2, 1, 54, 4, 4, 0, 5, 4, 3, 0, 88, 4, 12, 
+128, 57, 4, 0, 0, 56, 3, 2, 4, 14, 0, 3, 0, 88, 4, 4, 
+128, 57, 4, 0, 0, 57, 5, 0, 0, 21, 5, 5, 0, 56, 3, 5, 
+4, 18, 6, 0, 0, 57, 4, 5, 0, 57, 7, 6, 3, 66, 4, 3, 
+1, 43, 4, 2, 0, 76, 4, 2, 0, 0, 192, 9, 110, 97, 109, 101, 
+15, 115, 101, 116, 67, 117, 114, 114, 101, 110, 116, 13, 68, 111, 99, 117, 
+109, 101, 110, 116, 25, 82, 101, 98, 117, 105, 108, 100, 68, 111, 99, 117, 
+109, 101, 110, 116, 115, 77, 101, 110, 117, 10, 116, 111, 117, 99, 104, 18, 
+95, 102, 105, 110, 100, 68, 111, 99, 117, 109, 101, 110, 116, 14, 100, 111, 
+99, 117, 109, 101, 110, 116, 115, 2, 167, 1, 0, 2, 5, 0, 8, 0, 
+22, 54, 2, 0, 0, 57, 2, 1, 2, 15, 0, 2, 0, 88, 3, 4, 
+128, 54, 2, 2, 0, 54, 4, 3, 0, 57, 4, 4, 4, 66, 2, 2, 
+1, 57, 2, 5, 0, 56, 2, 1, 2, 55, 2, 0, 0, 54, 2, 0, 
+0, 14, 0, 2, 0, 88, 2, 3, 128, 57, 2, 5, 0, 58, 2, 1, 
+2, 55, 2, 0, 0, 54, 2, 0, 0, 61, 2, 6, 0, 54, 2, 7, 
+0, 66, 2, 1, 1, 75, 0, 1, 0, 17, 82, 101, 115, 105, 122, 101, 
+83, 99, 114, 101, 101, 110, 12, 99, 117, 114, 114, 101, 110, 116, 14, 100, 
+111, 99, 117, 109, 101, 110, 116, 115, 12, 67, 104, 97, 110, 103, 101, 100, 
+10, 69, 118, 101, 110, 116, 14, 70, 105, 114, 101, 69, 118, 101, 110, 116, 
+12, 99, 104, 97, 110, 103, 101, 100, 13, 68, 111, 99, 117, 109, 101, 110, 
+116, 137, 1, 0, 3, 7, 0, 4, 0, 22, 57, 3, 0, 0, 56, 3, 
+2, 3, 15, 0, 3, 0, 88, 4, 2, 128, 43, 3, 1, 0, 76, 3, 
+2, 0, 57, 3, 0, 0, 56, 3, 1, 3, 57, 4, 0, 0, 43, 5, 
+0, 0, 60, 5, 1, 4, 57, 4, 0, 0, 60, 3, 2, 4, 61, 2, 
+1, 3, 18, 6, 0, 0, 57, 4, 2, 0, 66, 4, 2, 1, 54, 4, 
+3, 0, 57, 6, 0, 0, 66, 4, 2, 1, 43, 4, 2, 0, 76, 4, 
+2, 0, 25, 82, 101, 98, 117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 
+110, 116, 115, 77, 101, 110, 117, 10, 116, 111, 117, 99, 104, 9, 110, 97, 
+109, 101, 14, 100, 111, 99, 117, 109, 101, 110, 116, 115, 25, 0, 2, 2, 
+0, 1, 0, 2, 61, 1, 0, 0, 75, 0, 1, 0, 14, 99, 108, 105, 
+112, 98, 111, 97, 114, 100, 25, 0, 1, 2, 0, 1, 0, 2, 57, 1, 
+0, 0, 76, 1, 2, 0, 14, 99, 108, 105, 112, 98, 111, 97, 114, 100, 
+24, 0, 2, 3, 0, 0, 1, 4, 21, 2, 0, 0, 22, 2, 0, 2, 
+60, 1, 2, 0, 75, 0, 1, 0, 2, 48, 0, 3, 8, 0, 2, 0, 
+7, 54, 3, 0, 0, 57, 3, 1, 3, 18, 5, 0, 0, 18, 6, 2, 
+0, 18, 7, 1, 0, 66, 3, 4, 1, 75, 0, 1, 0, 11, 105, 110, 
+115, 101, 114, 116, 10, 116, 97, 98, 108, 101, 44, 0, 2, 6, 0, 2, 
+0, 6, 54, 2, 0, 0, 57, 2, 1, 2, 18, 4, 0, 0, 18, 5, 
+1, 0, 66, 2, 3, 1, 75, 0, 1, 0, 11, 114, 101, 109, 111, 118, 
+101, 10, 116, 97, 98, 108, 101, 25, 0, 2, 2, 0, 1, 0, 2, 61, 
+1, 0, 0, 75, 0, 1, 0, 14, 119, 114, 97, 112, 119, 105, 100, 116, 
+104, 161, 1, 0, 1, 13, 0, 6, 0, 34, 57, 1, 0, 0, 14, 0, 
+1, 0, 88, 1, 1, 128, 75, 0, 1, 0, 57, 1, 0, 0, 57, 2, 
+1, 0, 57, 3, 2, 0, 57, 4, 3, 0, 57, 5, 4, 0, 57, 6, 
+5, 0, 0, 4, 1, 0, 88, 7, 8, 128, 5, 1, 4, 0, 88, 7, 
+13, 128, 0, 5, 2, 0, 88, 7, 4, 128, 5, 2, 5, 0, 88, 7, 
+9, 128, 1, 6, 3, 0, 88, 7, 7, 128, 18, 7, 4, 0, 18, 8, 
+5, 0, 18, 9, 6, 0, 18, 10, 1, 0, 18, 11, 2, 0, 18, 12, 
+3, 0, 74, 7, 7, 0, 18, 7, 1, 0, 18, 8, 2, 0, 18, 9, 
+3, 0, 18, 10, 4, 0, 18, 11, 5, 0, 18, 12, 6, 0, 74, 7, 
+7, 0, 7, 99, 111, 7, 99, 119, 7, 99, 112, 7, 109, 111, 7, 109, 
+119, 7, 109, 112, 166, 1, 0, 1, 9, 0, 9, 0, 24, 54, 1, 0, 
+0, 18, 3, 0, 0, 66, 1, 2, 4, 88, 4, 3, 128, 18, 8, 5, 
+0, 57, 6, 1, 5, 66, 6, 2, 1, 69, 4, 3, 3, 82, 4, 251, 
+127, 43, 1, 0, 0, 61, 1, 2, 0, 43, 1, 0, 0, 61, 1, 3, 
+0, 43, 1, 0, 0, 61, 1, 4, 0, 43, 1, 0, 0, 61, 1, 5, 
+0, 43, 1, 0, 0, 61, 1, 6, 0, 43, 1, 0, 0, 61, 1, 7, 
+0, 43, 1, 0, 0, 61, 1, 8, 0, 75, 0, 1, 0, 14, 114, 101, 
+100, 111, 115, 116, 97, 99, 107, 14, 117, 110, 100, 111, 115, 116, 97, 99, 
+107, 14, 119, 114, 97, 112, 119, 105, 100, 116, 104, 9, 98, 111, 116, 119, 
+9, 98, 111, 116, 112, 9, 116, 111, 112, 119, 9, 116, 111, 112, 112, 10, 
+116, 111, 117, 99, 104, 11, 105, 112, 97, 105, 114, 115, 114, 0, 2, 7, 
+0, 3, 1, 22, 56, 2, 1, 0, 23, 3, 0, 1, 56, 3, 3, 0, 
+57, 4, 0, 2, 57, 4, 1, 4, 14, 0, 4, 0, 88, 5, 1, 128, 
+41, 4, 0, 0, 41, 5, 0, 0, 15, 0, 3, 0, 88, 6, 5, 128, 
+57, 6, 0, 3, 57, 6, 2, 6, 12, 5, 6, 0, 88, 7, 1, 128, 
+41, 5, 0, 0, 1, 5, 4, 0, 88, 6, 2, 128, 76, 4, 2, 0, 
+88, 6, 1, 128, 76, 5, 2, 0, 75, 0, 1, 0, 10, 98, 101, 108, 
+111, 119, 10, 97, 98, 111, 118, 101, 10, 115, 116, 121, 108, 101, 2, 114, 
+0, 2, 7, 0, 3, 1, 22, 56, 2, 1, 0, 22, 3, 0, 1, 56, 
+3, 3, 0, 57, 4, 0, 2, 57, 4, 1, 4, 14, 0, 4, 0, 88, 
+5, 1, 128, 41, 4, 0, 0, 41, 5, 0, 0, 15, 0, 3, 0, 88, 
+6, 5, 128, 57, 6, 0, 3, 57, 6, 2, 6, 12, 5, 6, 0, 88, 
+7, 1, 128, 41, 5, 0, 0, 1, 4, 5, 0, 88, 6, 2, 128, 76, 
+5, 2, 0, 88, 6, 1, 128, 76, 4, 2, 0, 75, 0, 1, 0, 10, 
+97, 98, 111, 118, 101, 10, 98, 101, 108, 111, 119, 10, 115, 116, 121, 108, 
+101, 2, 93, 0, 1, 9, 0, 3, 1, 14, 52, 1, 0, 0, 54, 2, 
+0, 0, 18, 4, 0, 0, 66, 2, 2, 4, 88, 5, 3, 128, 21, 7, 
+1, 0, 22, 7, 0, 7, 60, 6, 7, 1, 69, 5, 3, 3, 82, 5, 
+251, 127, 54, 2, 1, 0, 57, 4, 2, 0, 18, 5, 1, 0, 68, 2, 
+3, 0, 10, 115, 116, 121, 108, 101, 20, 67, 114, 101, 97, 116, 101, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 11, 105, 112, 97, 105, 114, 115, 2, 
+54, 0, 1, 2, 0, 3, 0, 7, 43, 1, 0, 0, 61, 1, 0, 0, 
+43, 1, 0, 0, 61, 1, 1, 0, 43, 1, 0, 0, 61, 1, 2, 0, 
+75, 0, 1, 0, 7, 120, 115, 14, 119, 114, 97, 112, 119, 105, 100, 116, 
+104, 10, 108, 105, 110, 101, 115, 168, 2, 0, 2, 14, 1, 10, 1, 55, 
+14, 0, 1, 0, 88, 2, 2, 128, 54, 2, 0, 0, 57, 1, 1, 2, 
+57, 2, 2, 0, 57, 2, 3, 2, 14, 0, 2, 0, 88, 3, 1, 128, 
+41, 2, 0, 0, 33, 1, 2, 1, 57, 2, 1, 0, 4, 2, 1, 0, 
+88, 2, 40, 128, 52, 2, 0, 0, 53, 3, 4, 0, 41, 4, 0, 0, 
+52, 5, 0, 0, 61, 5, 5, 0, 54, 6, 6, 0, 18, 8, 0, 0, 
+66, 6, 2, 4, 88, 9, 20, 128, 45, 11, 0, 0, 18, 13, 10, 0, 
+66, 11, 2, 2, 22, 11, 0, 11, 60, 4, 9, 5, 32, 4, 11, 4, 
+3, 1, 4, 0, 88, 12, 9, 128, 21, 12, 2, 0, 22, 12, 0, 12, 
+60, 3, 12, 2, 53, 12, 7, 0, 61, 9, 8, 12, 18, 3, 12, 0, 
+18, 4, 11, 0, 41, 12, 0, 0, 60, 12, 9, 5, 21, 12, 3, 0, 
+22, 12, 0, 12, 60, 9, 12, 3, 69, 9, 3, 3, 82, 9, 234, 127, 
+21, 6, 3, 0, 41, 7, 0, 0, 1, 7, 6, 0, 88, 6, 3, 128, 
+21, 6, 2, 0, 22, 6, 0, 6, 60, 3, 6, 2, 61, 1, 1, 0, 
+61, 2, 9, 0, 57, 2, 9, 0, 76, 2, 2, 0, 11, 192, 10, 108, 
+105, 110, 101, 115, 7, 119, 110, 1, 0, 1, 7, 119, 110, 0, 11, 105, 
+112, 97, 105, 114, 115, 7, 120, 115, 1, 0, 1, 7, 119, 110, 3, 1, 
+11, 105, 110, 100, 101, 110, 116, 10, 115, 116, 121, 108, 101, 14, 119, 114, 
+97, 112, 119, 105, 100, 116, 104, 13, 68, 111, 99, 117, 109, 101, 110, 116, 
+2, 140, 1, 0, 4, 22, 2, 4, 0, 27, 45, 4, 0, 0, 57, 5, 
+0, 0, 57, 5, 1, 5, 56, 4, 5, 4, 14, 0, 4, 0, 88, 5, 
+1, 128, 41, 4, 0, 0, 41, 5, 0, 0, 57, 6, 2, 0, 54, 7, 
+3, 0, 18, 9, 1, 0, 66, 7, 2, 4, 88, 10, 11, 128, 56, 12, 
+11, 0, 45, 13, 1, 0, 56, 15, 11, 6, 32, 15, 15, 2, 18, 16, 
+3, 0, 18, 17, 12, 0, 18, 18, 5, 0, 44, 19, 20, 0, 18, 21, 
+4, 0, 66, 13, 8, 2, 18, 5, 13, 0, 69, 10, 3, 3, 82, 10, 
+243, 127, 75, 0, 1, 0, 20, 192, 4, 192, 11, 105, 112, 97, 105, 114, 
+115, 7, 120, 115, 9, 110, 97, 109, 101, 10, 115, 116, 121, 108, 101, 190, 
+3, 0, 6, 31, 2, 8, 1, 95, 14, 0, 4, 0, 88, 6, 2, 128, 
+54, 6, 0, 0, 33, 4, 2, 6, 57, 6, 1, 1, 54, 7, 2, 0, 
+18, 9, 7, 0, 57, 7, 3, 7, 66, 7, 2, 7, 45, 13, 0, 0, 
+57, 14, 4, 0, 57, 14, 5, 14, 56, 13, 14, 13, 14, 0, 13, 0, 
+88, 14, 1, 128, 41, 13, 0, 0, 41, 14, 0, 0, 54, 15, 6, 0, 
+18, 17, 1, 0, 66, 15, 2, 4, 88, 18, 71, 128, 44, 20, 21, 0, 
+32, 22, 18, 6, 23, 18, 0, 22, 0, 5, 7, 0, 88, 22, 2, 128, 
+1, 10, 5, 0, 88, 22, 2, 128, 43, 20, 0, 0, 88, 22, 50, 128, 
+1, 7, 5, 0, 88, 22, 4, 128, 1, 5, 10, 0, 88, 22, 2, 128, 
+41, 20, 1, 0, 88, 22, 44, 128, 5, 5, 7, 0, 88, 22, 24, 128, 
+5, 5, 10, 0, 88, 22, 22, 128, 5, 18, 8, 0, 88, 22, 5, 128, 
+5, 18, 11, 0, 88, 22, 3, 128, 18, 20, 9, 0, 18, 21, 12, 0, 
+88, 22, 33, 128, 5, 18, 8, 0, 88, 22, 2, 128, 18, 20, 9, 0, 
+88, 22, 29, 128, 5, 18, 11, 0, 88, 22, 3, 128, 41, 20, 1, 0, 
+18, 21, 12, 0, 88, 22, 24, 128, 1, 8, 18, 0, 88, 22, 22, 128, 
+1, 18, 11, 0, 88, 22, 20, 128, 41, 20, 1, 0, 88, 22, 18, 128, 
+5, 5, 7, 0, 88, 22, 8, 128, 1, 8, 18, 0, 88, 22, 2, 128, 
+41, 20, 1, 0, 88, 22, 12, 128, 5, 18, 8, 0, 88, 22, 10, 128, 
+18, 20, 9, 0, 88, 22, 8, 128, 41, 20, 1, 0, 1, 11, 18, 0, 
+88, 22, 2, 128, 43, 20, 0, 0, 88, 22, 3, 128, 5, 18, 11, 0, 
+88, 22, 1, 128, 18, 21, 12, 0, 45, 22, 1, 0, 57, 24, 7, 0, 
+56, 24, 19, 24, 32, 24, 24, 2, 18, 25, 3, 0, 56, 26, 19, 0, 
+18, 27, 14, 0, 18, 28, 20, 0, 18, 29, 21, 0, 18, 30, 13, 0, 
+66, 22, 8, 2, 18, 14, 22, 0, 69, 18, 3, 3, 82, 18, 183, 127, 
+75, 0, 1, 0, 20, 192, 4, 192, 7, 120, 115, 11, 105, 112, 97, 105, 
+114, 115, 9, 110, 97, 109, 101, 10, 115, 116, 121, 108, 101, 13, 103, 101, 
+116, 77, 97, 114, 107, 115, 13, 68, 111, 99, 117, 109, 101, 110, 116, 7, 
+119, 110, 16, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 2, 95, 
+0, 2, 10, 0, 2, 0, 19, 18, 4, 0, 0, 57, 2, 0, 0, 66, 
+2, 2, 2, 54, 3, 1, 0, 18, 5, 2, 0, 66, 3, 2, 4, 88, 
+6, 8, 128, 21, 8, 7, 0, 3, 1, 8, 0, 88, 8, 3, 128, 18, 
+8, 6, 0, 18, 9, 1, 0, 74, 8, 3, 0, 21, 8, 7, 0, 33, 
+1, 8, 1, 69, 6, 3, 3, 82, 6, 246, 127, 44, 3, 4, 0, 74, 
+3, 3, 0, 11, 105, 112, 97, 105, 114, 115, 9, 119, 114, 97, 112, 39, 
+0, 2, 5, 0, 2, 0, 6, 18, 4, 0, 0, 57, 2, 0, 0, 66, 
+2, 2, 2, 56, 3, 1, 2, 57, 3, 1, 3, 76, 3, 2, 0, 7, 
+119, 110, 9, 119, 114, 97, 112, 81, 0, 2, 9, 0, 3, 0, 13, 18, 
+4, 0, 0, 57, 2, 0, 0, 66, 2, 2, 2, 57, 3, 1, 0, 56, 
+3, 1, 3, 18, 6, 0, 0, 57, 4, 2, 0, 18, 7, 1, 0, 66, 
+4, 3, 3, 18, 6, 3, 0, 18, 7, 4, 0, 18, 8, 5, 0, 74, 
+6, 4, 0, 18, 103, 101, 116, 76, 105, 110, 101, 79, 102, 87, 111, 114, 
+100, 7, 120, 115, 9, 119, 114, 97, 112, 112, 0, 3, 10, 0, 1, 1, 
+25, 14, 0, 2, 0, 88, 3, 4, 128, 21, 3, 0, 0, 33, 3, 1, 
+3, 22, 2, 0, 3, 88, 3, 7, 128, 54, 3, 0, 0, 18, 5, 2, 
+0, 21, 6, 0, 0, 33, 6, 1, 6, 22, 6, 0, 6, 66, 3, 3, 
+2, 18, 2, 3, 0, 52, 3, 0, 0, 18, 4, 1, 0, 32, 5, 2, 
+1, 23, 5, 0, 5, 41, 6, 1, 0, 77, 4, 5, 128, 21, 8, 3, 
+0, 22, 8, 0, 8, 56, 9, 7, 0, 60, 9, 8, 3, 79, 4, 251, 
+127, 76, 3, 2, 0, 8, 109, 105, 110, 2, 89, 0, 1, 11, 2, 2, 
+1, 17, 52, 1, 0, 0, 54, 2, 0, 0, 18, 4, 0, 0, 66, 2, 
+2, 4, 88, 5, 6, 128, 21, 7, 1, 0, 22, 7, 0, 7, 45, 8, 
+0, 0, 18, 10, 6, 0, 66, 8, 2, 2, 60, 8, 7, 1, 69, 5, 
+3, 3, 82, 5, 248, 127, 45, 2, 1, 0, 18, 4, 1, 0, 39, 5, 
+1, 0, 68, 2, 3, 0, 13, 192, 2, 192, 6, 32, 11, 105, 112, 97, 
+105, 114, 115, 2, 228, 2, 2, 1, 13, 0, 14, 2, 55, 52, 1, 0, 
+0, 55, 1, 0, 0, 54, 1, 1, 0, 52, 3, 3, 0, 71, 4, 1, 
+0, 63, 4, 0, 0, 66, 1, 2, 4, 88, 4, 22, 128, 54, 6, 2, 
+0, 18, 8, 5, 0, 66, 6, 2, 2, 7, 6, 3, 0, 88, 6, 12, 
+128, 54, 6, 1, 0, 18, 8, 5, 0, 66, 6, 2, 4, 88, 9, 5, 
+128, 54, 11, 0, 0, 54, 12, 0, 0, 21, 12, 12, 0, 22, 12, 1, 
+12, 60, 10, 12, 11, 69, 9, 3, 3, 82, 9, 249, 127, 88, 6, 5, 
+128, 54, 6, 0, 0, 54, 7, 0, 0, 21, 7, 7, 0, 22, 7, 1, 
+7, 60, 5, 7, 6, 69, 4, 3, 3, 82, 4, 232, 127, 54, 1, 0, 
+0, 12, 2, 0, 0, 88, 2, 3, 128, 54, 2, 5, 0, 57, 2, 6, 
+2, 57, 2, 7, 2, 61, 2, 4, 1, 54, 1, 8, 0, 54, 3, 0, 
+0, 53, 4, 9, 0, 54, 5, 10, 0, 61, 5, 11, 4, 66, 1, 3, 
+1, 54, 1, 12, 0, 15, 0, 1, 0, 88, 2, 4, 128, 54, 1, 13, 
+0, 54, 3, 0, 0, 68, 1, 2, 0, 88, 1, 2, 128, 54, 1, 0, 
+0, 76, 1, 2, 0, 75, 0, 1, 0, 21, 73, 109, 109, 117, 116, 97, 
+98, 108, 105, 115, 101, 65, 114, 114, 97, 121, 10, 68, 69, 66, 85, 71, 
+12, 95, 95, 105, 110, 100, 101, 120, 19, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 67, 108, 97, 115, 115, 1, 0, 1, 12, 95, 95, 105, 110, 100, 
+101, 120, 0, 17, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 
+6, 80, 11, 115, 116, 121, 108, 101, 115, 16, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 10, 115, 116, 121, 108, 101, 10, 116, 97, 98, 108, 
+101, 9, 116, 121, 112, 101, 11, 105, 112, 97, 105, 114, 115, 10, 119, 111, 
+114, 100, 115, 3, 128, 128, 192, 153, 4, 2, 42, 0, 2, 9, 1, 1, 
+1, 7, 45, 2, 0, 0, 18, 6, 0, 0, 57, 4, 0, 0, 41, 7, 
+1, 0, 23, 8, 0, 1, 66, 4, 4, 0, 67, 2, 0, 0, 11, 192, 
+8, 115, 117, 98, 2, 157, 1, 0, 2, 10, 2, 3, 2, 32, 21, 2, 
+0, 0, 41, 3, 1, 0, 3, 3, 2, 0, 88, 4, 26, 128, 85, 4, 
+25, 128, 9, 1, 0, 0, 88, 4, 1, 128, 76, 3, 2, 0, 45, 4, 
+0, 0, 54, 6, 0, 0, 57, 6, 1, 6, 18, 8, 0, 0, 18, 9, 
+3, 0, 66, 6, 3, 0, 65, 4, 0, 2, 18, 7, 0, 0, 57, 5, 
+2, 0, 18, 8, 3, 0, 32, 9, 4, 3, 23, 9, 1, 9, 66, 5, 
+4, 2, 45, 6, 1, 0, 18, 8, 5, 0, 66, 6, 2, 2, 1, 1, 
+6, 0, 88, 7, 1, 128, 76, 3, 2, 0, 33, 1, 6, 1, 32, 3, 
+4, 3, 88, 4, 228, 127, 22, 4, 1, 2, 76, 4, 2, 0, 12, 192, 
+11, 192, 8, 115, 117, 98, 9, 98, 121, 116, 101, 11, 115, 116, 114, 105, 
+110, 103, 0, 2, 217, 6, 0, 0, 8, 0, 13, 0, 32, 52, 0, 12, 
+0, 53, 1, 0, 0, 62, 1, 1, 0, 53, 1, 1, 0, 62, 1, 2, 
+0, 53, 1, 2, 0, 62, 1, 3, 0, 53, 1, 3, 0, 62, 1, 4, 
+0, 53, 1, 4, 0, 62, 1, 5, 0, 53, 1, 5, 0, 62, 1, 6, 
+0, 53, 1, 6, 0, 62, 1, 7, 0, 53, 1, 7, 0, 62, 1, 8, 
+0, 53, 1, 8, 0, 62, 1, 9, 0, 53, 1, 9, 0, 62, 1, 10, 
+0, 53, 1, 10, 0, 62, 1, 11, 0, 54, 1, 11, 0, 18, 3, 0, 
+0, 66, 1, 2, 4, 88, 4, 2, 128, 57, 6, 12, 5, 60, 5, 6, 
+0, 69, 4, 3, 3, 82, 4, 252, 127, 76, 0, 2, 0, 9, 110, 97, 
+109, 101, 11, 105, 112, 97, 105, 114, 115, 1, 0, 6, 11, 105, 110, 100, 
+101, 110, 116, 3, 0, 10, 98, 101, 108, 111, 119, 3, 0, 9, 100, 101, 
+115, 99, 37, 82, 97, 119, 32, 100, 97, 116, 97, 32, 101, 120, 112, 111, 
+114, 116, 101, 100, 32, 116, 111, 32, 111, 117, 116, 112, 117, 116, 32, 102, 
+105, 108, 101, 10, 97, 98, 111, 118, 101, 3, 0, 9, 104, 116, 109, 108, 
+0, 9, 110, 97, 109, 101, 8, 82, 65, 87, 1, 0, 6, 11, 105, 110, 
+100, 101, 110, 116, 3, 4, 10, 98, 101, 108, 111, 119, 3, 0, 9, 100, 
+101, 115, 99, 22, 80, 114, 101, 102, 111, 114, 109, 97, 116, 116, 101, 100, 
+32, 116, 101, 120, 116, 10, 97, 98, 111, 118, 101, 3, 0, 9, 104, 116, 
+109, 108, 8, 80, 82, 69, 9, 110, 97, 109, 101, 8, 80, 82, 69, 1, 
+0, 6, 11, 105, 110, 100, 101, 110, 116, 3, 4, 10, 98, 101, 108, 111, 
+119, 3, 0, 9, 100, 101, 115, 99, 32, 73, 110, 100, 101, 110, 116, 101, 
+100, 32, 116, 101, 120, 116, 44, 32, 114, 117, 110, 32, 116, 111, 103, 101, 
+116, 104, 101, 114, 10, 97, 98, 111, 118, 101, 3, 0, 9, 104, 116, 109, 
+108, 15, 66, 76, 79, 67, 75, 81, 85, 79, 84, 69, 9, 110, 97, 109, 
+101, 6, 86, 1, 0, 6, 9, 100, 101, 115, 99, 29, 76, 105, 115, 116, 
+32, 105, 116, 101, 109, 32, 119, 105, 116, 104, 111, 117, 116, 32, 98, 117, 
+108, 108, 101, 116, 10, 98, 101, 108, 111, 119, 3, 1, 11, 105, 110, 100, 
+101, 110, 116, 3, 4, 10, 97, 98, 111, 118, 101, 3, 1, 9, 104, 116, 
+109, 108, 7, 76, 73, 9, 110, 97, 109, 101, 6, 76, 1, 0, 7, 9, 
+100, 101, 115, 99, 26, 76, 105, 115, 116, 32, 105, 116, 101, 109, 32, 119, 
+105, 116, 104, 32, 98, 117, 108, 108, 101, 116, 10, 98, 101, 108, 111, 119, 
+3, 1, 11, 105, 110, 100, 101, 110, 116, 3, 4, 10, 97, 98, 111, 118, 
+101, 3, 1, 11, 98, 117, 108, 108, 101, 116, 6, 45, 9, 104, 116, 109, 
+108, 7, 76, 73, 9, 110, 97, 109, 101, 7, 76, 66, 1, 0, 6, 11, 
+105, 110, 100, 101, 110, 116, 3, 4, 10, 98, 101, 108, 111, 119, 3, 1, 
+9, 100, 101, 115, 99, 18, 73, 110, 100, 101, 110, 116, 101, 100, 32, 116, 
+101, 120, 116, 10, 97, 98, 111, 118, 101, 3, 1, 9, 104, 116, 109, 108, 
+15, 66, 76, 79, 67, 75, 81, 85, 79, 84, 69, 9, 110, 97, 109, 101, 
+6, 81, 1, 0, 5, 9, 100, 101, 115, 99, 15, 72, 101, 97, 100, 105, 
+110, 103, 32, 35, 52, 10, 98, 101, 108, 111, 119, 3, 1, 10, 97, 98, 
+111, 118, 101, 3, 1, 9, 104, 116, 109, 108, 7, 72, 52, 9, 110, 97, 
+109, 101, 7, 72, 52, 1, 0, 5, 9, 100, 101, 115, 99, 15, 72, 101, 
+97, 100, 105, 110, 103, 32, 35, 51, 10, 98, 101, 108, 111, 119, 3, 1, 
+10, 97, 98, 111, 118, 101, 3, 1, 9, 104, 116, 109, 108, 7, 72, 51, 
+9, 110, 97, 109, 101, 7, 72, 51, 1, 0, 5, 9, 100, 101, 115, 99, 
+15, 72, 101, 97, 100, 105, 110, 103, 32, 35, 50, 10, 98, 101, 108, 111, 
+119, 3, 1, 10, 97, 98, 111, 118, 101, 3, 2, 9, 104, 116, 109, 108, 
+7, 72, 50, 9, 110, 97, 109, 101, 7, 72, 50, 1, 0, 5, 9, 100, 
+101, 115, 99, 15, 72, 101, 97, 100, 105, 110, 103, 32, 35, 49, 10, 98, 
+101, 108, 111, 119, 3, 1, 10, 97, 98, 111, 118, 101, 3, 3, 9, 104, 
+116, 109, 108, 7, 72, 49, 9, 110, 97, 109, 101, 7, 72, 49, 1, 0, 
+5, 9, 100, 101, 115, 99, 15, 80, 108, 97, 105, 110, 32, 116, 101, 120, 
+116, 10, 98, 101, 108, 111, 119, 3, 1, 10, 97, 98, 111, 118, 101, 3, 
+1, 9, 104, 116, 109, 108, 6, 80, 9, 110, 97, 109, 101, 6, 80, 48, 
+0, 0, 3, 1, 2, 0, 5, 54, 0, 0, 0, 45, 1, 0, 0, 66, 
+1, 1, 2, 61, 1, 1, 0, 75, 0, 1, 0, 21, 192, 11, 115, 116, 
+121, 108, 101, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+237, 1, 0, 0, 6, 1, 10, 0, 17, 53, 0, 0, 0, 54, 1, 1, 
+0, 61, 1, 2, 0, 52, 1, 0, 0, 61, 1, 3, 0, 45, 1, 0, 
+0, 66, 1, 1, 2, 61, 1, 4, 0, 52, 1, 0, 0, 61, 1, 5, 
+0, 54, 1, 6, 0, 18, 3, 0, 0, 53, 4, 7, 0, 54, 5, 8, 
+0, 61, 5, 9, 4, 66, 1, 3, 1, 76, 0, 2, 0, 21, 192, 12, 
+95, 95, 105, 110, 100, 101, 120, 21, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 67, 108, 97, 115, 115, 1, 0, 1, 12, 95, 95, 105, 110, 
+100, 101, 120, 0, 17, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 
+101, 11, 97, 100, 100, 111, 110, 115, 11, 115, 116, 121, 108, 101, 115, 14, 
+100, 111, 99, 117, 109, 101, 110, 116, 115, 15, 102, 105, 108, 101, 102, 111, 
+114, 109, 97, 116, 15, 70, 73, 76, 69, 70, 79, 82, 77, 65, 84, 1, 
+0, 6, 11, 97, 100, 100, 111, 110, 115, 0, 11, 115, 116, 121, 108, 101, 
+115, 0, 14, 100, 111, 99, 117, 109, 101, 110, 116, 115, 0, 13, 105, 100, 
+108, 101, 116, 105, 109, 101, 3, 3, 14, 115, 116, 97, 116, 117, 115, 98, 
+97, 114, 2, 15, 102, 105, 108, 101, 102, 111, 114, 109, 97, 116, 0, 233, 
+1, 0, 0, 6, 0, 11, 0, 18, 53, 0, 0, 0, 54, 1, 1, 0, 
+18, 3, 0, 0, 53, 4, 2, 0, 54, 5, 3, 0, 61, 5, 4, 4, 
+66, 1, 3, 1, 54, 1, 5, 0, 54, 3, 6, 0, 57, 3, 7, 3, 
+57, 3, 8, 3, 53, 4, 9, 0, 66, 1, 3, 2, 18, 4, 0, 0, 
+57, 2, 10, 0, 18, 5, 1, 0, 66, 2, 3, 1, 76, 0, 2, 0, 
+20, 97, 112, 112, 101, 110, 100, 80, 97, 114, 97, 103, 114, 97, 112, 104, 
+1, 2, 0, 0, 5, 6, 80, 11, 115, 116, 121, 108, 101, 115, 16, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 20, 67, 114, 101, 97, 116, 
+101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 12, 95, 95, 105, 110, 100, 
+101, 120, 18, 68, 111, 99, 117, 109, 101, 110, 116, 67, 108, 97, 115, 115, 
+1, 0, 1, 12, 95, 95, 105, 110, 100, 101, 120, 0, 17, 115, 101, 116, 
+109, 101, 116, 97, 116, 97, 98, 108, 101, 1, 0, 6, 7, 99, 111, 3, 
+1, 14, 119, 114, 97, 112, 119, 105, 100, 116, 104, 0, 7, 99, 119, 3, 
+1, 7, 99, 112, 3, 1, 11, 109, 97, 114, 103, 105, 110, 3, 0, 13, 
+118, 105, 101, 119, 109, 111, 100, 101, 3, 1, 178, 13, 3, 0, 23, 0, 
+105, 0, 136, 1, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 0, 0, 
+57, 1, 2, 1, 54, 2, 0, 0, 57, 2, 3, 2, 54, 3, 4, 0, 
+57, 3, 5, 3, 54, 4, 4, 0, 57, 4, 6, 4, 54, 5, 4, 0, 
+57, 5, 7, 5, 54, 6, 4, 0, 57, 6, 8, 6, 54, 7, 4, 0, 
+57, 7, 9, 7, 54, 8, 4, 0, 57, 8, 10, 8, 54, 9, 4, 0, 
+57, 9, 11, 9, 54, 10, 4, 0, 57, 10, 12, 10, 54, 11, 4, 0, 
+57, 11, 13, 11, 54, 12, 4, 0, 57, 12, 14, 12, 54, 13, 4, 0, 
+57, 13, 15, 13, 54, 14, 4, 0, 57, 14, 16, 14, 54, 15, 4, 0, 
+57, 15, 17, 15, 54, 16, 4, 0, 57, 16, 18, 16, 54, 17, 4, 0, 
+57, 17, 19, 17, 54, 18, 4, 0, 57, 18, 20, 18, 54, 19, 4, 0, 
+57, 19, 21, 19, 53, 20, 22, 0, 32, 21, 18, 15, 32, 21, 14, 21, 
+32, 21, 16, 21, 61, 21, 23, 20, 32, 21, 14, 18, 32, 21, 16, 21, 
+61, 21, 24, 20, 32, 21, 18, 15, 32, 21, 14, 21, 61, 21, 25, 20, 
+32, 21, 14, 18, 61, 21, 26, 20, 53, 21, 28, 0, 51, 22, 27, 0, 
+61, 22, 29, 21, 51, 22, 30, 0, 61, 22, 31, 21, 51, 22, 32, 0, 
+61, 22, 33, 21, 51, 22, 34, 0, 61, 22, 35, 21, 51, 22, 36, 0, 
+61, 22, 37, 21, 51, 22, 38, 0, 61, 22, 39, 21, 51, 22, 40, 0, 
+61, 22, 41, 21, 51, 22, 42, 0, 61, 22, 43, 21, 51, 22, 44, 0, 
+61, 22, 45, 21, 51, 22, 46, 0, 61, 22, 47, 21, 51, 22, 48, 0, 
+61, 22, 49, 21, 51, 22, 50, 0, 61, 22, 51, 21, 51, 22, 52, 0, 
+61, 22, 53, 21, 55, 21, 54, 0, 53, 21, 56, 0, 51, 22, 55, 0, 
+61, 22, 57, 21, 51, 22, 58, 0, 61, 22, 59, 21, 51, 22, 60, 0, 
+61, 22, 61, 21, 51, 22, 62, 0, 61, 22, 63, 21, 51, 22, 64, 0, 
+61, 22, 65, 21, 51, 22, 66, 0, 61, 22, 29, 21, 51, 22, 67, 0, 
+61, 22, 68, 21, 51, 22, 69, 0, 61, 22, 70, 21, 55, 21, 71, 0, 
+53, 21, 73, 0, 51, 22, 72, 0, 61, 22, 74, 21, 51, 22, 75, 0, 
+61, 22, 31, 21, 51, 22, 76, 0, 61, 22, 63, 21, 51, 22, 77, 0, 
+61, 22, 78, 21, 51, 22, 79, 0, 61, 22, 80, 21, 51, 22, 81, 0, 
+61, 22, 82, 21, 51, 22, 83, 0, 61, 22, 84, 21, 51, 22, 85, 0, 
+61, 22, 86, 21, 51, 22, 87, 0, 61, 22, 88, 21, 51, 22, 89, 0, 
+61, 22, 90, 21, 55, 21, 91, 0, 51, 21, 92, 0, 55, 21, 93, 0, 
+51, 21, 94, 0, 55, 21, 95, 0, 51, 21, 96, 0, 55, 21, 97, 0, 
+51, 21, 98, 0, 51, 22, 99, 0, 55, 22, 100, 0, 51, 22, 101, 0, 
+55, 22, 102, 0, 51, 22, 103, 0, 55, 22, 104, 0, 50, 0, 0, 128, 
+75, 0, 1, 0, 19, 67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 109, 
+101, 110, 116, 0, 22, 67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 0, 25, 82, 101, 115, 101, 116, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 83, 116, 121, 108, 101, 115, 0, 0, 23, 71, 
+101, 116, 79, 102, 102, 115, 101, 116, 70, 114, 111, 109, 87, 105, 100, 116, 
+104, 0, 23, 71, 101, 116, 87, 105, 100, 116, 104, 70, 114, 111, 109, 79, 
+102, 102, 115, 101, 116, 0, 20, 67, 114, 101, 97, 116, 101, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 0, 19, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 67, 108, 97, 115, 115, 13, 97, 115, 83, 116, 114, 105, 110, 103, 0, 
+8, 115, 117, 98, 0, 21, 103, 101, 116, 88, 79, 102, 102, 115, 101, 116, 
+79, 102, 87, 111, 114, 100, 0, 18, 103, 101, 116, 87, 111, 114, 100, 79, 
+102, 76, 105, 110, 101, 0, 18, 103, 101, 116, 76, 105, 110, 101, 79, 102, 
+87, 111, 114, 100, 0, 21, 114, 101, 110, 100, 101, 114, 77, 97, 114, 107, 
+101, 100, 76, 105, 110, 101, 0, 15, 114, 101, 110, 100, 101, 114, 76, 105, 
+110, 101, 0, 0, 0, 9, 99, 111, 112, 121, 1, 0, 10, 9, 119, 114, 
+97, 112, 0, 10, 116, 111, 117, 99, 104, 0, 8, 115, 117, 98, 0, 9, 
+99, 111, 112, 121, 0, 21, 114, 101, 110, 100, 101, 114, 77, 97, 114, 107, 
+101, 100, 76, 105, 110, 101, 0, 15, 114, 101, 110, 100, 101, 114, 76, 105, 
+110, 101, 0, 13, 97, 115, 83, 116, 114, 105, 110, 103, 0, 18, 103, 101, 
+116, 76, 105, 110, 101, 79, 102, 87, 111, 114, 100, 0, 21, 103, 101, 116, 
+88, 79, 102, 102, 115, 101, 116, 79, 102, 87, 111, 114, 100, 0, 18, 103, 
+101, 116, 87, 111, 114, 100, 79, 102, 76, 105, 110, 101, 0, 0, 18, 68, 
+111, 99, 117, 109, 101, 110, 116, 67, 108, 97, 115, 115, 15, 115, 112, 97, 
+99, 101, 66, 101, 108, 111, 119, 0, 15, 115, 112, 97, 99, 101, 65, 98, 
+111, 118, 101, 0, 0, 13, 103, 101, 116, 77, 97, 114, 107, 115, 0, 9, 
+119, 114, 97, 112, 0, 22, 100, 101, 108, 101, 116, 101, 80, 97, 114, 97, 
+103, 114, 97, 112, 104, 65, 116, 0, 26, 105, 110, 115, 101, 114, 116, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 66, 101, 102, 111, 114, 101, 0, 20, 
+97, 112, 112, 101, 110, 100, 80, 97, 114, 97, 103, 114, 97, 112, 104, 1, 
+0, 8, 9, 119, 114, 97, 112, 0, 13, 103, 101, 116, 77, 97, 114, 107, 
+115, 0, 10, 112, 117, 114, 103, 101, 0, 22, 100, 101, 108, 101, 116, 101, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 65, 116, 0, 26, 105, 110, 115, 
+101, 114, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 66, 101, 102, 111, 
+114, 101, 0, 20, 97, 112, 112, 101, 110, 100, 80, 97, 114, 97, 103, 114, 
+97, 112, 104, 0, 15, 115, 112, 97, 99, 101, 65, 98, 111, 118, 101, 0, 
+15, 115, 112, 97, 99, 101, 66, 101, 108, 111, 119, 0, 0, 21, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 67, 108, 97, 115, 115, 17, 103, 
+101, 116, 67, 108, 105, 112, 98, 111, 97, 114, 100, 0, 17, 115, 101, 116, 
+67, 108, 105, 112, 98, 111, 97, 114, 100, 0, 19, 114, 101, 110, 97, 109, 
+101, 68, 111, 99, 117, 109, 101, 110, 116, 0, 15, 115, 101, 116, 67, 117, 
+114, 114, 101, 110, 116, 0, 19, 100, 101, 108, 101, 116, 101, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 24, 109, 111, 118, 101, 68, 111, 99, 117, 109, 
+101, 110, 116, 73, 110, 100, 101, 120, 84, 111, 0, 16, 97, 100, 100, 68, 
+111, 99, 117, 109, 101, 110, 116, 0, 17, 102, 105, 110, 100, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 18, 95, 102, 105, 110, 100, 68, 111, 99, 117, 
+109, 101, 110, 116, 0, 20, 103, 101, 116, 68, 111, 99, 117, 109, 101, 110, 
+116, 76, 105, 115, 116, 0, 10, 99, 108, 101, 97, 110, 0, 10, 116, 111, 
+117, 99, 104, 0, 10, 112, 117, 114, 103, 101, 1, 0, 13, 24, 109, 111, 
+118, 101, 68, 111, 99, 117, 109, 101, 110, 116, 73, 110, 100, 101, 120, 84, 
+111, 0, 17, 115, 101, 116, 67, 108, 105, 112, 98, 111, 97, 114, 100, 0, 
+15, 115, 101, 116, 67, 117, 114, 114, 101, 110, 116, 0, 17, 102, 105, 110, 
+100, 68, 111, 99, 117, 109, 101, 110, 116, 0, 19, 114, 101, 110, 97, 109, 
+101, 68, 111, 99, 117, 109, 101, 110, 116, 0, 18, 95, 102, 105, 110, 100, 
+68, 111, 99, 117, 109, 101, 110, 116, 0, 20, 103, 101, 116, 68, 111, 99, 
+117, 109, 101, 110, 116, 76, 105, 115, 116, 0, 10, 99, 108, 101, 97, 110, 
+0, 19, 100, 101, 108, 101, 116, 101, 68, 111, 99, 117, 109, 101, 110, 116, 
+0, 10, 116, 111, 117, 99, 104, 0, 10, 112, 117, 114, 103, 101, 0, 16, 
+97, 100, 100, 68, 111, 99, 117, 109, 101, 110, 116, 0, 17, 103, 101, 116, 
+67, 108, 105, 112, 98, 111, 97, 114, 100, 0, 0, 7, 72, 52, 7, 72, 
+51, 7, 72, 50, 7, 72, 49, 1, 0, 4, 7, 72, 50, 0, 7, 72, 
+49, 0, 7, 72, 52, 0, 7, 72, 51, 0, 8, 68, 73, 77, 11, 66, 
+82, 73, 71, 72, 84, 12, 82, 69, 86, 69, 82, 83, 69, 14, 85, 78, 
+68, 69, 82, 76, 73, 78, 69, 11, 73, 84, 65, 76, 73, 67, 9, 66, 
+79, 76, 68, 16, 103, 101, 116, 119, 111, 114, 100, 116, 101, 120, 116, 24, 
+103, 101, 116, 98, 121, 116, 101, 115, 111, 102, 99, 104, 97, 114, 97, 99, 
+116, 101, 114, 19, 103, 101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 
+116, 104, 11, 115, 101, 116, 100, 105, 109, 15, 115, 101, 116, 114, 101, 118, 
+101, 114, 115, 101, 17, 115, 101, 116, 117, 110, 100, 101, 114, 108, 105, 110, 
+101, 12, 115, 101, 116, 98, 111, 108, 100, 14, 115, 101, 116, 110, 111, 114, 
+109, 97, 108, 15, 99, 108, 101, 97, 114, 116, 111, 101, 111, 108, 16, 119, 
+114, 105, 116, 101, 115, 116, 121, 108, 101, 100, 10, 119, 114, 105, 116, 101, 
+7, 119, 103, 11, 99, 111, 110, 99, 97, 116, 11, 105, 110, 115, 101, 114, 
+116, 11, 114, 101, 109, 111, 118, 101, 10, 116, 97, 98, 108, 101, 0, 
+};
+
+/* This is src/lua/forms.lua */
+static const char file_10[] = {
+27, 76, 74, 2, 10, 31, 0, 2, 2, 0, 0, 0, 6, 1, 0, 1, 
+0, 88, 2, 2, 128, 76, 0, 2, 0, 88, 2, 1, 128, 76, 1, 2, 
+0, 75, 0, 1, 0, 31, 0, 2, 2, 0, 0, 0, 6, 1, 1, 0, 
+0, 88, 2, 2, 128, 76, 0, 2, 0, 88, 2, 1, 128, 76, 1, 2, 
+0, 75, 0, 1, 0, 84, 0, 1, 6, 1, 4, 0, 9, 54, 1, 0, 
+0, 18, 3, 0, 0, 53, 4, 1, 0, 45, 5, 0, 0, 61, 5, 2, 
+4, 66, 1, 3, 1, 45, 1, 0, 0, 61, 1, 3, 0, 76, 0, 2, 
+0, 0, 192, 10, 99, 108, 97, 115, 115, 12, 95, 95, 105, 110, 100, 101, 
+120, 1, 0, 1, 12, 95, 95, 105, 110, 100, 101, 120, 0, 17, 115, 101, 
+116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 20, 1, 1, 2, 0, 1, 
+0, 3, 51, 1, 0, 0, 50, 0, 0, 128, 76, 1, 2, 0, 0, 75, 
+0, 1, 9, 2, 4, 0, 9, 45, 1, 0, 0, 57, 3, 0, 0, 57, 
+4, 1, 0, 45, 5, 1, 0, 39, 7, 2, 0, 57, 8, 3, 0, 66, 
+5, 3, 0, 65, 1, 2, 1, 75, 0, 1, 0, 1, 192, 11, 192, 14, 
+114, 101, 97, 108, 119, 105, 100, 116, 104, 8, 226, 148, 128, 11, 114, 101, 
+97, 108, 121, 49, 11, 114, 101, 97, 108, 120, 49, 191, 1, 0, 1, 14, 
+0, 8, 1, 25, 54, 1, 0, 0, 57, 3, 1, 0, 66, 1, 2, 2, 
+54, 2, 2, 0, 43, 4, 0, 0, 18, 5, 1, 0, 66, 2, 3, 2, 
+18, 5, 2, 0, 57, 3, 3, 2, 57, 6, 4, 0, 66, 3, 3, 2, 
+41, 4, 1, 0, 21, 5, 3, 0, 41, 6, 1, 0, 77, 4, 9, 128, 
+18, 10, 2, 0, 57, 8, 5, 2, 56, 11, 7, 3, 57, 12, 6, 0, 
+57, 13, 7, 0, 32, 13, 7, 13, 23, 13, 0, 13, 66, 8, 5, 1, 
+79, 4, 247, 127, 75, 0, 1, 0, 11, 114, 101, 97, 108, 121, 49, 11, 
+114, 101, 97, 108, 120, 49, 15, 114, 101, 110, 100, 101, 114, 76, 105, 110, 
+101, 14, 114, 101, 97, 108, 119, 105, 100, 116, 104, 9, 119, 114, 97, 112, 
+20, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 
+10, 118, 97, 108, 117, 101, 25, 80, 97, 114, 115, 101, 83, 116, 114, 105, 
+110, 103, 73, 110, 116, 111, 87, 111, 114, 100, 115, 2, 117, 0, 1, 7, 
+0, 5, 0, 13, 54, 1, 0, 0, 57, 3, 1, 0, 66, 1, 2, 2, 
+54, 2, 2, 0, 43, 4, 0, 0, 18, 5, 1, 0, 66, 2, 3, 2, 
+18, 5, 2, 0, 57, 3, 3, 2, 57, 6, 4, 0, 66, 3, 3, 2, 
+21, 4, 3, 0, 76, 4, 2, 0, 14, 114, 101, 97, 108, 119, 105, 100, 
+116, 104, 9, 119, 114, 97, 112, 20, 67, 114, 101, 97, 116, 101, 80, 97, 
+114, 97, 103, 114, 97, 112, 104, 10, 118, 97, 108, 117, 101, 25, 80, 97, 
+114, 115, 101, 83, 116, 114, 105, 110, 103, 73, 110, 116, 111, 87, 111, 114, 
+100, 115, 141, 2, 0, 1, 10, 4, 10, 1, 48, 43, 1, 0, 0, 57, 
+2, 0, 0, 54, 3, 1, 0, 57, 3, 2, 3, 5, 2, 3, 0, 88, 
+2, 10, 128, 45, 2, 0, 0, 57, 4, 3, 0, 45, 5, 1, 0, 57, 
+7, 4, 0, 66, 5, 2, 2, 33, 4, 5, 4, 25, 4, 0, 4, 66, 
+2, 2, 2, 18, 1, 2, 0, 88, 2, 17, 128, 57, 2, 0, 0, 54, 
+3, 1, 0, 57, 3, 5, 3, 5, 2, 3, 0, 88, 2, 2, 128, 41, 
+1, 0, 0, 88, 2, 10, 128, 57, 2, 0, 0, 54, 3, 1, 0, 57, 
+3, 6, 3, 5, 2, 3, 0, 88, 2, 5, 128, 57, 2, 3, 0, 45, 
+3, 1, 0, 57, 5, 4, 0, 66, 3, 2, 2, 33, 1, 3, 2, 45, 
+2, 2, 0, 57, 4, 7, 0, 57, 5, 8, 0, 45, 6, 3, 0, 39, 
+8, 9, 0, 57, 9, 3, 0, 66, 6, 3, 0, 65, 2, 2, 1, 45, 
+2, 2, 0, 57, 4, 7, 0, 32, 4, 1, 4, 57, 5, 8, 0, 57, 
+6, 4, 0, 66, 2, 4, 1, 75, 0, 1, 0, 0, 192, 3, 192, 1, 
+192, 11, 192, 6, 32, 11, 114, 101, 97, 108, 121, 49, 11, 114, 101, 97, 
+108, 120, 49, 10, 82, 105, 103, 104, 116, 9, 76, 101, 102, 116, 10, 118, 
+97, 108, 117, 101, 14, 114, 101, 97, 108, 119, 105, 100, 116, 104, 11, 67, 
+101, 110, 116, 114, 101, 9, 70, 111, 114, 109, 10, 97, 108, 105, 103, 110, 
+4, 46, 0, 2, 5, 0, 2, 0, 7, 57, 2, 0, 0, 19, 2, 2, 
+0, 61, 2, 0, 0, 18, 4, 0, 0, 57, 2, 1, 0, 66, 2, 2, 
+1, 75, 0, 1, 0, 9, 100, 114, 97, 119, 10, 118, 97, 108, 117, 101, 
+211, 1, 0, 1, 10, 5, 9, 1, 33, 43, 1, 0, 0, 57, 2, 0, 
+0, 15, 0, 2, 0, 88, 3, 2, 128, 39, 1, 1, 0, 88, 2, 1, 
+128, 39, 1, 2, 0, 45, 2, 0, 0, 57, 4, 3, 0, 57, 5, 4, 
+0, 45, 6, 1, 0, 57, 8, 5, 0, 57, 9, 6, 0, 23, 9, 0, 
+9, 66, 6, 3, 0, 65, 2, 2, 1, 45, 2, 2, 0, 66, 2, 1, 
+1, 45, 2, 0, 0, 57, 4, 7, 0, 57, 5, 4, 0, 18, 6, 1, 
+0, 66, 2, 4, 1, 45, 2, 3, 0, 66, 2, 1, 1, 57, 2, 8, 
+0, 15, 0, 2, 0, 88, 3, 4, 128, 45, 2, 4, 0, 57, 4, 7, 
+0, 57, 5, 4, 0, 66, 2, 3, 1, 75, 0, 1, 0, 1, 192, 4, 
+192, 8, 192, 6, 192, 2, 192, 10, 102, 111, 99, 117, 115, 11, 114, 101, 
+97, 108, 120, 50, 14, 114, 101, 97, 108, 119, 105, 100, 116, 104, 10, 108, 
+97, 98, 101, 108, 11, 114, 101, 97, 108, 121, 49, 11, 114, 101, 97, 108, 
+120, 49, 10, 62, 32, 78, 79, 32, 10, 62, 32, 89, 69, 83, 10, 118, 
+97, 108, 117, 101, 4, 92, 0, 1, 4, 0, 4, 1, 15, 57, 1, 0, 
+0, 14, 0, 1, 0, 88, 2, 5, 128, 57, 1, 1, 0, 18, 3, 1, 
+0, 57, 1, 2, 1, 66, 1, 2, 2, 22, 1, 0, 1, 61, 1, 0, 
+0, 57, 1, 3, 0, 14, 0, 1, 0, 88, 2, 1, 128, 41, 1, 1, 
+0, 61, 1, 3, 0, 75, 0, 1, 0, 11, 111, 102, 102, 115, 101, 116, 
+8, 108, 101, 110, 10, 118, 97, 108, 117, 101, 11, 99, 117, 114, 115, 111, 
+114, 2, 177, 3, 0, 1, 13, 8, 11, 1, 86, 45, 1, 0, 0, 66, 
+1, 1, 1, 45, 1, 1, 0, 57, 3, 0, 0, 57, 4, 1, 0, 22, 
+4, 0, 4, 45, 5, 2, 0, 39, 7, 2, 0, 57, 8, 3, 0, 66, 
+5, 3, 0, 65, 1, 2, 1, 45, 1, 1, 0, 57, 3, 0, 0, 57, 
+4, 1, 0, 45, 5, 2, 0, 39, 7, 4, 0, 57, 8, 3, 0, 66, 
+5, 3, 0, 65, 1, 2, 1, 45, 1, 3, 0, 66, 1, 1, 1, 57, 
+1, 5, 0, 57, 2, 6, 0, 1, 1, 2, 0, 88, 1, 2, 128, 57, 
+1, 5, 0, 61, 1, 6, 0, 85, 1, 23, 128, 45, 1, 4, 0, 57, 
+3, 7, 0, 18, 5, 3, 0, 57, 3, 8, 3, 57, 6, 6, 0, 57, 
+7, 5, 0, 66, 3, 4, 0, 65, 1, 0, 2, 57, 2, 3, 0, 3, 
+1, 2, 0, 88, 2, 1, 128, 88, 1, 11, 128, 45, 2, 5, 0, 57, 
+4, 7, 0, 18, 6, 4, 0, 57, 4, 9, 4, 57, 7, 6, 0, 66, 
+4, 3, 0, 65, 2, 0, 2, 57, 3, 6, 0, 32, 3, 2, 3, 61, 
+3, 6, 0, 88, 1, 232, 127, 45, 1, 6, 0, 57, 3, 7, 0, 18, 
+5, 3, 0, 57, 3, 8, 3, 57, 6, 6, 0, 66, 3, 3, 2, 57, 
+4, 3, 0, 66, 1, 3, 2, 45, 2, 0, 0, 66, 2, 1, 1, 45, 
+2, 1, 0, 57, 4, 0, 0, 57, 5, 1, 0, 18, 6, 1, 0, 66, 
+2, 4, 1, 45, 2, 3, 0, 66, 2, 1, 1, 57, 2, 10, 0, 15, 
+0, 2, 0, 88, 3, 14, 128, 45, 2, 7, 0, 57, 4, 0, 0, 45, 
+5, 4, 0, 18, 9, 1, 0, 57, 7, 8, 1, 41, 10, 1, 0, 57, 
+11, 5, 0, 57, 12, 6, 0, 33, 11, 12, 11, 66, 7, 4, 0, 65, 
+5, 0, 2, 32, 4, 5, 4, 57, 5, 1, 0, 66, 2, 3, 1, 75, 
+0, 1, 0, 8, 192, 1, 192, 11, 192, 6, 192, 3, 192, 5, 192, 4, 
+192, 2, 192, 10, 102, 111, 99, 117, 115, 9, 98, 121, 116, 101, 8, 115, 
+117, 98, 10, 118, 97, 108, 117, 101, 11, 111, 102, 102, 115, 101, 116, 11, 
+99, 117, 114, 115, 111, 114, 6, 32, 14, 114, 101, 97, 108, 119, 105, 100, 
+116, 104, 8, 226, 150, 148, 11, 114, 101, 97, 108, 121, 49, 11, 114, 101, 
+97, 108, 120, 49, 2, 134, 1, 0, 2, 8, 1, 5, 2, 24, 57, 2, 
+0, 0, 41, 3, 1, 0, 1, 3, 2, 0, 88, 2, 18, 128, 85, 2, 
+14, 128, 57, 2, 0, 0, 23, 2, 0, 2, 61, 2, 0, 0, 45, 2, 
+0, 0, 57, 4, 1, 0, 18, 6, 4, 0, 57, 4, 2, 4, 57, 7, 
+0, 0, 66, 4, 3, 0, 65, 2, 0, 2, 8, 2, 1, 0, 88, 2, 
+243, 127, 88, 2, 1, 128, 88, 2, 241, 127, 18, 4, 0, 0, 57, 2, 
+3, 0, 66, 2, 2, 1, 39, 2, 4, 0, 76, 2, 2, 0, 5, 192, 
+8, 110, 111, 112, 9, 100, 114, 97, 119, 9, 98, 121, 116, 101, 10, 118, 
+97, 108, 117, 101, 11, 99, 117, 114, 115, 111, 114, 2, 0, 128, 1, 0, 
+2, 9, 1, 6, 0, 22, 57, 2, 0, 0, 57, 3, 1, 0, 18, 5, 
+3, 0, 57, 3, 2, 3, 66, 3, 2, 2, 3, 2, 3, 0, 88, 2, 
+13, 128, 57, 2, 0, 0, 45, 3, 0, 0, 57, 5, 1, 0, 18, 7, 
+5, 0, 57, 5, 3, 5, 57, 8, 0, 0, 66, 5, 3, 0, 65, 3, 
+0, 2, 32, 2, 3, 2, 61, 2, 0, 0, 18, 4, 0, 0, 57, 2, 
+4, 0, 66, 2, 2, 1, 39, 2, 5, 0, 76, 2, 2, 0, 5, 192, 
+8, 110, 111, 112, 9, 100, 114, 97, 119, 9, 98, 121, 116, 101, 8, 108, 
+101, 110, 10, 118, 97, 108, 117, 101, 11, 99, 117, 114, 115, 111, 114, 51, 
+0, 2, 5, 0, 3, 0, 7, 41, 2, 1, 0, 61, 2, 0, 0, 18, 
+4, 0, 0, 57, 2, 1, 0, 66, 2, 2, 1, 39, 2, 2, 0, 76, 
+2, 2, 0, 8, 110, 111, 112, 9, 100, 114, 97, 119, 11, 99, 117, 114, 
+115, 111, 114, 78, 0, 2, 5, 0, 5, 1, 11, 57, 2, 1, 0, 18, 
+4, 2, 0, 57, 2, 2, 2, 66, 2, 2, 2, 22, 2, 0, 2, 61, 
+2, 0, 0, 18, 4, 0, 0, 57, 2, 3, 0, 66, 2, 2, 1, 39, 
+2, 4, 0, 76, 2, 2, 0, 8, 110, 111, 112, 9, 100, 114, 97, 119, 
+8, 108, 101, 110, 10, 118, 97, 108, 117, 101, 11, 99, 117, 114, 115, 111, 
+114, 2, 206, 1, 0, 2, 9, 1, 6, 2, 41, 57, 2, 0, 0, 41, 
+3, 1, 0, 1, 3, 2, 0, 88, 2, 35, 128, 43, 2, 0, 0, 85, 
+3, 15, 128, 57, 3, 0, 0, 23, 3, 0, 3, 61, 3, 0, 0, 45, 
+3, 0, 0, 57, 5, 1, 0, 18, 7, 5, 0, 57, 5, 2, 5, 57, 
+8, 0, 0, 66, 5, 3, 0, 65, 3, 0, 2, 18, 2, 3, 0, 8, 
+2, 1, 0, 88, 3, 242, 127, 88, 3, 1, 128, 88, 3, 240, 127, 57, 
+3, 1, 0, 18, 5, 3, 0, 57, 3, 3, 3, 41, 6, 1, 0, 57, 
+7, 0, 0, 23, 7, 0, 7, 66, 3, 4, 2, 57, 4, 1, 0, 18, 
+6, 4, 0, 57, 4, 3, 4, 57, 7, 0, 0, 32, 7, 2, 7, 66, 
+4, 3, 2, 38, 3, 4, 3, 61, 3, 1, 0, 18, 5, 0, 0, 57, 
+3, 4, 0, 66, 3, 2, 1, 39, 2, 5, 0, 76, 2, 2, 0, 5, 
+192, 8, 110, 111, 112, 9, 100, 114, 97, 119, 8, 115, 117, 98, 9, 98, 
+121, 116, 101, 10, 118, 97, 108, 117, 101, 11, 99, 117, 114, 115, 111, 114, 
+2, 0, 177, 1, 0, 2, 9, 1, 6, 1, 34, 57, 2, 0, 0, 18, 
+4, 2, 0, 57, 2, 1, 2, 57, 5, 2, 0, 66, 2, 3, 2, 15, 
+0, 2, 0, 88, 3, 25, 128, 45, 3, 0, 0, 57, 5, 0, 0, 18, 
+7, 5, 0, 57, 5, 1, 5, 57, 8, 2, 0, 66, 5, 3, 0, 65, 
+3, 0, 2, 57, 4, 0, 0, 18, 6, 4, 0, 57, 4, 3, 4, 41, 
+7, 1, 0, 57, 8, 2, 0, 23, 8, 0, 8, 66, 4, 4, 2, 57, 
+5, 0, 0, 18, 7, 5, 0, 57, 5, 3, 5, 57, 8, 2, 0, 32, 
+8, 3, 8, 66, 5, 3, 2, 38, 4, 5, 4, 61, 4, 0, 0, 18, 
+6, 0, 0, 57, 4, 4, 0, 66, 4, 2, 1, 39, 3, 5, 0, 76, 
+3, 2, 0, 5, 192, 8, 110, 111, 112, 9, 100, 114, 97, 119, 8, 115, 
+117, 98, 11, 99, 117, 114, 115, 111, 114, 9, 98, 121, 116, 101, 10, 118, 
+97, 108, 117, 101, 2, 81, 0, 2, 5, 0, 6, 0, 11, 41, 2, 1, 
+0, 61, 2, 0, 0, 41, 2, 1, 0, 61, 2, 1, 0, 39, 2, 3, 
+0, 61, 2, 2, 0, 18, 4, 0, 0, 57, 2, 4, 0, 66, 2, 2, 
+1, 39, 2, 5, 0, 76, 2, 2, 0, 8, 110, 111, 112, 9, 100, 114, 
+97, 119, 5, 10, 118, 97, 108, 117, 101, 11, 111, 102, 102, 115, 101, 116, 
+11, 99, 117, 114, 115, 111, 114, 197, 1, 0, 2, 9, 1, 8, 1, 36, 
+18, 4, 1, 0, 57, 2, 0, 1, 39, 5, 1, 0, 66, 2, 3, 2, 
+14, 0, 2, 0, 88, 2, 29, 128, 57, 2, 2, 0, 18, 4, 2, 0, 
+57, 2, 3, 2, 41, 5, 1, 0, 57, 6, 4, 0, 23, 6, 0, 6, 
+66, 2, 4, 2, 18, 3, 1, 0, 57, 4, 2, 0, 18, 6, 4, 0, 
+57, 4, 3, 4, 57, 7, 4, 0, 66, 4, 3, 2, 38, 2, 4, 2, 
+61, 2, 2, 0, 57, 2, 4, 0, 45, 3, 0, 0, 18, 7, 1, 0, 
+57, 5, 5, 1, 41, 8, 1, 0, 66, 5, 3, 0, 65, 3, 0, 2, 
+32, 2, 3, 2, 61, 2, 4, 0, 18, 4, 0, 0, 57, 2, 6, 0, 
+66, 2, 2, 1, 39, 2, 7, 0, 76, 2, 2, 0, 75, 0, 1, 0, 
+5, 192, 8, 110, 111, 112, 9, 100, 114, 97, 119, 9, 98, 121, 116, 101, 
+11, 99, 117, 114, 115, 111, 114, 8, 115, 117, 98, 10, 118, 97, 108, 117, 
+101, 10, 94, 75, 69, 89, 95, 10, 109, 97, 116, 99, 104, 2, 65, 0, 
+1, 2, 0, 2, 0, 11, 57, 1, 0, 0, 14, 0, 1, 0, 88, 2, 
+1, 128, 41, 1, 1, 0, 61, 1, 0, 0, 57, 1, 1, 0, 14, 0, 
+1, 0, 88, 2, 1, 128, 41, 1, 0, 0, 61, 1, 1, 0, 75, 0, 
+1, 0, 11, 111, 102, 102, 115, 101, 116, 11, 99, 117, 114, 115, 111, 114, 
+189, 1, 0, 1, 7, 3, 4, 2, 36, 57, 1, 0, 0, 57, 2, 1, 
+0, 9, 2, 0, 0, 88, 2, 6, 128, 57, 2, 2, 0, 45, 3, 0, 
+0, 25, 5, 1, 1, 66, 3, 2, 2, 33, 2, 3, 2, 61, 2, 1, 
+0, 45, 2, 1, 0, 57, 4, 1, 0, 57, 5, 2, 0, 66, 2, 3, 
+2, 61, 2, 1, 0, 45, 2, 2, 0, 57, 4, 1, 0, 57, 5, 2, 
+0, 23, 6, 1, 1, 33, 5, 6, 5, 66, 2, 3, 2, 61, 2, 1, 
+0, 45, 2, 1, 0, 57, 4, 1, 0, 57, 5, 3, 0, 21, 5, 5, 
+0, 23, 6, 1, 1, 33, 5, 6, 5, 66, 2, 3, 2, 61, 2, 1, 
+0, 45, 2, 2, 0, 57, 4, 1, 0, 41, 5, 1, 0, 66, 2, 3, 
+2, 61, 2, 1, 0, 75, 0, 1, 0, 0, 192, 12, 192, 13, 192, 9, 
+100, 97, 116, 97, 11, 99, 117, 114, 115, 111, 114, 11, 111, 102, 102, 115, 
+101, 116, 15, 114, 101, 97, 108, 104, 101, 105, 103, 104, 116, 0, 4, 19, 
+0, 1, 2, 0, 1, 0, 2, 39, 1, 0, 0, 76, 1, 2, 0, 8, 
+110, 111, 112, 175, 5, 0, 1, 19, 6, 17, 3, 140, 1, 57, 1, 0, 
+0, 57, 2, 1, 0, 57, 3, 2, 0, 57, 4, 3, 0, 45, 5, 0, 
+0, 39, 7, 4, 0, 23, 8, 0, 3, 66, 5, 3, 2, 45, 6, 1, 
+0, 66, 6, 1, 1, 45, 6, 2, 0, 18, 8, 1, 0, 18, 9, 2, 
+0, 39, 10, 5, 0, 66, 6, 4, 1, 45, 6, 2, 0, 22, 8, 1, 
+1, 18, 9, 2, 0, 18, 10, 5, 0, 66, 6, 4, 1, 45, 6, 2, 
+0, 32, 8, 3, 1, 23, 8, 1, 8, 18, 9, 2, 0, 39, 10, 6, 
+0, 66, 6, 4, 1, 41, 6, 1, 0, 23, 7, 1, 4, 41, 8, 1, 
+0, 77, 6, 12, 128, 45, 10, 2, 0, 18, 12, 1, 0, 32, 13, 9, 
+2, 39, 14, 7, 0, 66, 10, 4, 1, 45, 10, 2, 0, 32, 12, 3, 
+1, 23, 12, 1, 12, 32, 13, 9, 2, 39, 14, 7, 0, 66, 10, 4, 
+1, 79, 6, 244, 127, 45, 6, 2, 0, 18, 8, 1, 0, 32, 9, 4, 
+2, 39, 10, 8, 0, 66, 6, 4, 1, 45, 6, 2, 0, 22, 8, 1, 
+1, 32, 9, 4, 2, 18, 10, 5, 0, 66, 6, 4, 1, 45, 6, 2, 
+0, 32, 8, 3, 1, 23, 8, 1, 8, 32, 9, 4, 2, 39, 10, 9, 
+0, 66, 6, 4, 1, 45, 6, 3, 0, 66, 6, 1, 1, 18, 7, 0, 
+0, 57, 5, 10, 0, 66, 5, 2, 1, 45, 5, 0, 0, 39, 7, 11, 
+0, 23, 8, 0, 3, 66, 5, 3, 2, 41, 6, 0, 0, 23, 7, 0, 
+4, 41, 8, 1, 0, 77, 6, 66, 128, 57, 10, 12, 0, 32, 10, 9, 
+10, 57, 11, 13, 0, 56, 11, 10, 11, 14, 0, 11, 0, 88, 12, 1, 
+128, 88, 6, 59, 128, 57, 12, 14, 0, 5, 10, 12, 0, 88, 12, 3, 
+128, 45, 12, 4, 0, 66, 12, 1, 1, 88, 12, 2, 128, 45, 12, 3, 
+0, 66, 12, 1, 1, 45, 12, 2, 0, 22, 14, 1, 1, 22, 15, 1, 
+2, 32, 15, 9, 15, 18, 16, 5, 0, 66, 12, 4, 1, 45, 12, 5, 
+0, 57, 14, 15, 11, 23, 15, 2, 3, 66, 12, 3, 2, 45, 13, 2, 
+0, 22, 15, 0, 1, 22, 16, 1, 2, 32, 16, 9, 16, 18, 17, 12, 
+0, 66, 13, 4, 1, 57, 13, 13, 0, 21, 13, 13, 0, 23, 14, 0, 
+4, 1, 14, 13, 0, 88, 13, 27, 128, 45, 13, 3, 0, 66, 13, 1, 
+1, 45, 13, 1, 0, 66, 13, 1, 1, 39, 12, 7, 0, 22, 13, 1, 
+9, 57, 14, 13, 0, 21, 14, 14, 0, 34, 13, 14, 13, 23, 14, 1, 
+4, 35, 13, 14, 13, 57, 14, 12, 0, 3, 14, 13, 0, 88, 14, 6, 
+128, 57, 14, 12, 0, 32, 14, 4, 14, 23, 14, 0, 14, 3, 13, 14, 
+0, 88, 14, 1, 128, 39, 12, 16, 0, 45, 14, 2, 0, 32, 16, 3, 
+1, 23, 16, 1, 16, 22, 17, 1, 2, 32, 17, 9, 17, 18, 18, 12, 
+0, 66, 14, 4, 1, 45, 13, 3, 0, 66, 13, 1, 1, 79, 6, 190, 
+127, 45, 6, 3, 0, 66, 6, 1, 1, 75, 0, 1, 0, 11, 192, 8, 
+192, 1, 192, 6, 192, 10, 192, 4, 192, 8, 226, 149, 145, 10, 108, 97, 
+98, 101, 108, 11, 99, 117, 114, 115, 111, 114, 9, 100, 97, 116, 97, 11, 
+111, 102, 102, 115, 101, 116, 6, 32, 18, 95, 97, 100, 106, 117, 115, 116, 
+79, 102, 102, 115, 101, 116, 8, 226, 148, 152, 8, 226, 148, 148, 8, 226, 
+148, 130, 8, 226, 148, 144, 8, 226, 148, 140, 8, 226, 148, 128, 15, 114, 
+101, 97, 108, 104, 101, 105, 103, 104, 116, 14, 114, 101, 97, 108, 119, 105, 
+100, 116, 104, 11, 114, 101, 97, 108, 121, 49, 11, 114, 101, 97, 108, 120, 
+49, 4, 2, 8, 92, 0, 2, 5, 0, 4, 1, 15, 57, 2, 0, 0, 
+41, 3, 1, 0, 1, 3, 2, 0, 88, 2, 9, 128, 57, 2, 0, 0, 
+23, 2, 0, 2, 61, 2, 0, 0, 18, 4, 0, 0, 57, 2, 1, 0, 
+66, 2, 2, 1, 18, 4, 0, 0, 57, 2, 2, 0, 68, 2, 2, 0, 
+39, 2, 3, 0, 76, 2, 2, 0, 8, 110, 111, 112, 12, 99, 104, 97, 
+110, 103, 101, 100, 9, 100, 114, 97, 119, 11, 99, 117, 114, 115, 111, 114, 
+2, 101, 0, 2, 5, 0, 5, 1, 16, 57, 2, 0, 0, 57, 3, 1, 
+0, 21, 3, 3, 0, 1, 2, 3, 0, 88, 2, 9, 128, 57, 2, 0, 
+0, 22, 2, 0, 2, 61, 2, 0, 0, 18, 4, 0, 0, 57, 2, 2, 
+0, 66, 2, 2, 1, 18, 4, 0, 0, 57, 2, 3, 0, 68, 2, 2, 
+0, 39, 2, 4, 0, 76, 2, 2, 0, 8, 110, 111, 112, 12, 99, 104, 
+97, 110, 103, 101, 100, 9, 100, 114, 97, 119, 9, 100, 97, 116, 97, 11, 
+99, 117, 114, 115, 111, 114, 2, 141, 1, 0, 2, 6, 1, 5, 1, 24, 
+57, 2, 0, 0, 45, 3, 0, 0, 57, 5, 1, 0, 25, 5, 0, 5, 
+66, 3, 2, 2, 33, 3, 3, 2, 61, 3, 0, 0, 57, 3, 0, 0, 
+41, 4, 1, 0, 1, 3, 4, 0, 88, 3, 2, 128, 41, 3, 1, 0, 
+61, 3, 0, 0, 57, 3, 0, 0, 4, 3, 2, 0, 88, 3, 6, 128, 
+18, 5, 0, 0, 57, 3, 2, 0, 66, 3, 2, 1, 18, 5, 0, 0, 
+57, 3, 3, 0, 68, 3, 2, 0, 39, 3, 4, 0, 76, 3, 2, 0, 
+0, 192, 8, 110, 111, 112, 12, 99, 104, 97, 110, 103, 101, 100, 9, 100, 
+114, 97, 119, 15, 114, 101, 97, 108, 104, 101, 105, 103, 104, 116, 11, 99, 
+117, 114, 115, 111, 114, 4, 154, 1, 0, 2, 6, 1, 6, 1, 26, 57, 
+2, 0, 0, 45, 3, 0, 0, 57, 5, 1, 0, 25, 5, 0, 5, 66, 
+3, 2, 2, 32, 3, 3, 2, 61, 3, 0, 0, 57, 3, 0, 0, 57, 
+4, 2, 0, 21, 4, 4, 0, 1, 4, 3, 0, 88, 3, 3, 128, 57, 
+3, 2, 0, 21, 3, 3, 0, 61, 3, 0, 0, 57, 3, 0, 0, 4, 
+3, 2, 0, 88, 3, 6, 128, 18, 5, 0, 0, 57, 3, 3, 0, 66, 
+3, 2, 1, 18, 5, 0, 0, 57, 3, 4, 0, 68, 3, 2, 0, 39, 
+3, 5, 0, 76, 3, 2, 0, 0, 192, 8, 110, 111, 112, 12, 99, 104, 
+97, 110, 103, 101, 100, 9, 100, 114, 97, 119, 9, 100, 97, 116, 97, 15, 
+114, 101, 97, 108, 104, 101, 105, 103, 104, 116, 11, 99, 117, 114, 115, 111, 
+114, 4, 128, 1, 0, 2, 5, 0, 4, 2, 23, 57, 2, 0, 0, 15, 
+0, 2, 0, 88, 3, 18, 128, 57, 2, 0, 0, 23, 2, 0, 2, 57, 
+3, 0, 0, 4, 2, 3, 0, 88, 3, 13, 128, 85, 3, 12, 128, 9, 
+2, 1, 0, 88, 3, 1, 128, 21, 2, 0, 0, 56, 3, 2, 0, 57, 
+4, 1, 3, 15, 0, 4, 0, 88, 5, 3, 128, 61, 2, 0, 0, 39, 
+4, 2, 0, 76, 4, 2, 0, 23, 2, 0, 2, 88, 3, 240, 127, 39, 
+2, 3, 0, 76, 2, 2, 0, 8, 110, 111, 112, 11, 114, 101, 100, 114, 
+97, 119, 14, 102, 111, 99, 117, 115, 97, 98, 108, 101, 10, 102, 111, 99, 
+117, 115, 2, 0, 131, 1, 0, 2, 5, 0, 4, 1, 24, 57, 2, 0, 
+0, 15, 0, 2, 0, 88, 3, 19, 128, 57, 2, 0, 0, 22, 2, 0, 
+2, 57, 3, 0, 0, 4, 2, 3, 0, 88, 3, 14, 128, 85, 3, 13, 
+128, 21, 3, 0, 0, 1, 3, 2, 0, 88, 3, 1, 128, 41, 2, 1, 
+0, 56, 3, 2, 0, 57, 4, 1, 3, 15, 0, 4, 0, 88, 5, 3, 
+128, 61, 2, 0, 0, 39, 4, 2, 0, 76, 4, 2, 0, 22, 2, 0, 
+2, 88, 3, 239, 127, 39, 2, 3, 0, 76, 2, 2, 0, 8, 110, 111, 
+112, 11, 114, 101, 100, 114, 97, 119, 14, 102, 111, 99, 117, 115, 97, 98, 
+108, 101, 10, 102, 111, 99, 117, 115, 2, 39, 0, 2, 3, 0, 0, 0, 
+8, 41, 2, 0, 0, 1, 0, 2, 0, 88, 2, 3, 128, 32, 2, 1, 
+0, 76, 2, 2, 0, 88, 2, 1, 128, 76, 0, 2, 0, 75, 0, 1, 
+0, 121, 0, 3, 8, 0, 3, 0, 24, 56, 3, 2, 0, 15, 0, 3, 
+0, 88, 4, 10, 128, 54, 4, 0, 0, 18, 6, 3, 0, 66, 4, 2, 
+2, 7, 4, 1, 0, 88, 4, 5, 128, 18, 4, 3, 0, 18, 6, 1, 
+0, 18, 7, 2, 0, 66, 4, 3, 2, 18, 3, 4, 0, 14, 0, 3, 
+0, 88, 4, 8, 128, 57, 4, 2, 0, 15, 0, 4, 0, 88, 5, 5, 
+128, 57, 4, 2, 0, 18, 6, 1, 0, 18, 7, 2, 0, 66, 4, 3, 
+2, 18, 3, 4, 0, 76, 3, 2, 0, 8, 107, 101, 121, 13, 102, 117, 
+110, 99, 116, 105, 111, 110, 9, 116, 121, 112, 101, 235, 10, 0, 3, 12, 
+5, 38, 5, 143, 2, 54, 3, 0, 0, 66, 3, 1, 1, 57, 3, 1, 
+0, 14, 0, 3, 0, 88, 3, 11, 128, 54, 3, 2, 0, 18, 5, 0, 
+0, 66, 3, 2, 4, 88, 6, 5, 128, 57, 8, 3, 7, 15, 0, 8, 
+0, 88, 9, 2, 128, 61, 6, 1, 0, 88, 3, 2, 128, 69, 6, 3, 
+3, 82, 6, 249, 127, 54, 3, 2, 0, 18, 5, 0, 0, 66, 3, 2, 
+4, 88, 6, 6, 128, 57, 8, 4, 7, 15, 0, 8, 0, 88, 9, 3, 
+128, 18, 10, 7, 0, 57, 8, 4, 7, 66, 8, 2, 1, 69, 6, 3, 
+3, 82, 6, 248, 127, 15, 0, 1, 0, 88, 3, 2, 128, 18, 3, 1, 
+0, 66, 3, 1, 1, 57, 3, 5, 0, 54, 4, 6, 0, 57, 4, 7, 
+4, 5, 3, 4, 0, 88, 3, 7, 128, 45, 3, 0, 0, 54, 5, 9, 
+0, 24, 5, 0, 5, 25, 5, 1, 5, 66, 3, 2, 2, 61, 3, 8, 
+0, 88, 3, 2, 128, 57, 3, 5, 0, 61, 3, 8, 0, 57, 3, 10, 
+0, 54, 4, 6, 0, 57, 4, 7, 4, 5, 3, 4, 0, 88, 3, 7, 
+128, 45, 3, 0, 0, 54, 5, 12, 0, 24, 5, 2, 5, 25, 5, 0, 
+5, 66, 3, 2, 2, 61, 3, 11, 0, 88, 3, 2, 128, 57, 3, 10, 
+0, 61, 3, 11, 0, 57, 3, 13, 0, 15, 0, 3, 0, 88, 4, 40, 
+128, 54, 3, 2, 0, 18, 5, 0, 0, 66, 3, 2, 4, 88, 6, 34, 
+128, 57, 8, 14, 7, 41, 9, 0, 0, 1, 9, 8, 0, 88, 8, 30, 
+128, 57, 8, 15, 7, 41, 9, 0, 0, 1, 8, 9, 0, 88, 8, 26, 
+128, 45, 8, 1, 0, 57, 10, 17, 7, 57, 11, 8, 0, 66, 8, 3, 
+2, 61, 8, 16, 7, 45, 8, 1, 0, 57, 10, 19, 7, 57, 11, 8, 
+0, 66, 8, 3, 2, 61, 8, 18, 7, 57, 8, 18, 7, 57, 9, 16, 
+7, 33, 8, 9, 8, 61, 8, 8, 7, 41, 8, 1, 0, 57, 9, 20, 
+7, 15, 0, 9, 0, 88, 10, 4, 128, 18, 11, 7, 0, 57, 9, 20, 
+7, 66, 9, 2, 2, 18, 8, 9, 0, 57, 9, 10, 0, 32, 9, 8, 
+9, 61, 9, 11, 0, 88, 3, 2, 128, 69, 6, 3, 3, 82, 6, 220, 
+127, 45, 3, 0, 0, 54, 5, 9, 0, 25, 5, 3, 5, 57, 6, 8, 
+0, 25, 6, 3, 6, 33, 5, 6, 5, 66, 3, 2, 2, 61, 3, 21, 
+0, 45, 3, 0, 0, 54, 5, 12, 0, 25, 5, 3, 5, 57, 6, 11, 
+0, 25, 6, 3, 6, 33, 5, 6, 5, 66, 3, 2, 2, 61, 3, 22, 
+0, 54, 3, 2, 0, 18, 5, 0, 0, 66, 3, 2, 4, 88, 6, 36, 
+128, 45, 8, 1, 0, 57, 10, 17, 7, 57, 11, 8, 0, 66, 8, 3, 
+2, 57, 9, 21, 0, 32, 8, 9, 8, 61, 8, 16, 7, 45, 8, 1, 
+0, 57, 10, 14, 7, 57, 11, 11, 0, 66, 8, 3, 2, 57, 9, 22, 
+0, 32, 8, 9, 8, 61, 8, 23, 7, 45, 8, 1, 0, 57, 10, 19, 
+7, 57, 11, 8, 0, 66, 8, 3, 2, 57, 9, 21, 0, 32, 8, 9, 
+8, 61, 8, 18, 7, 45, 8, 1, 0, 57, 10, 15, 7, 57, 11, 11, 
+0, 66, 8, 3, 2, 57, 9, 22, 0, 32, 8, 9, 8, 61, 8, 24, 
+7, 57, 8, 18, 7, 57, 9, 16, 7, 33, 8, 9, 8, 61, 8, 8, 
+7, 57, 8, 24, 7, 57, 9, 23, 7, 33, 8, 9, 8, 61, 8, 11, 
+7, 69, 6, 3, 3, 82, 6, 218, 127, 41, 3, 0, 0, 15, 0, 2, 
+0, 88, 4, 1, 128, 41, 3, 1, 0, 54, 4, 25, 0, 57, 6, 21, 
+0, 23, 6, 4, 6, 57, 7, 22, 0, 23, 7, 4, 7, 57, 8, 8, 
+0, 57, 9, 11, 0, 32, 9, 3, 9, 57, 10, 26, 0, 66, 4, 6, 
+1, 15, 0, 2, 0, 88, 4, 11, 128, 54, 4, 27, 0, 57, 6, 21, 
+0, 57, 7, 22, 0, 57, 8, 11, 0, 32, 7, 8, 7, 57, 8, 8, 
+0, 39, 9, 28, 0, 18, 10, 2, 0, 39, 11, 29, 0, 38, 9, 11, 
+9, 66, 4, 5, 1, 45, 3, 2, 0, 54, 5, 9, 0, 23, 5, 4, 
+5, 54, 6, 12, 0, 23, 6, 4, 6, 66, 3, 3, 1, 54, 3, 2, 
+0, 18, 5, 0, 0, 66, 3, 2, 4, 88, 6, 10, 128, 57, 8, 1, 
+0, 4, 6, 8, 0, 88, 8, 2, 128, 43, 8, 1, 0, 88, 9, 1, 
+128, 43, 8, 2, 0, 61, 8, 1, 7, 18, 10, 7, 0, 57, 8, 30, 
+7, 66, 8, 2, 1, 69, 6, 3, 3, 82, 6, 244, 127, 85, 3, 59, 
+128, 54, 3, 31, 0, 57, 3, 32, 3, 66, 3, 1, 2, 7, 3, 33, 
+0, 88, 4, 8, 128, 54, 4, 0, 0, 66, 4, 1, 1, 54, 4, 6, 
+0, 57, 4, 34, 4, 18, 6, 0, 0, 18, 7, 1, 0, 18, 8, 2, 
+0, 68, 4, 4, 0, 43, 4, 0, 0, 57, 5, 1, 0, 15, 0, 5, 
+0, 88, 6, 8, 128, 57, 5, 1, 0, 56, 5, 5, 0, 45, 6, 3, 
+0, 18, 8, 5, 0, 18, 9, 5, 0, 18, 10, 3, 0, 66, 6, 4, 
+2, 18, 4, 6, 0, 14, 0, 4, 0, 88, 5, 13, 128, 45, 5, 3, 
+0, 18, 7, 0, 0, 18, 8, 0, 0, 18, 9, 3, 0, 66, 5, 4, 
+2, 12, 4, 5, 0, 88, 6, 6, 128, 45, 5, 3, 0, 45, 7, 4, 
+0, 18, 8, 0, 0, 18, 9, 3, 0, 66, 5, 4, 2, 18, 4, 5, 
+0, 7, 4, 35, 0, 88, 5, 7, 128, 54, 5, 6, 0, 57, 5, 34, 
+5, 18, 7, 0, 0, 18, 8, 1, 0, 18, 9, 2, 0, 68, 5, 4, 
+0, 88, 5, 206, 127, 7, 4, 36, 0, 88, 5, 3, 128, 43, 5, 1, 
+0, 76, 5, 2, 0, 88, 5, 201, 127, 7, 4, 37, 0, 88, 5, 199, 
+127, 43, 5, 2, 0, 76, 5, 2, 0, 88, 3, 196, 127, 75, 0, 1, 
+0, 0, 192, 17, 192, 2, 192, 18, 192, 16, 192, 12, 99, 111, 110, 102, 
+105, 114, 109, 11, 99, 97, 110, 99, 101, 108, 11, 114, 101, 100, 114, 97, 
+119, 8, 82, 117, 110, 15, 75, 69, 89, 95, 82, 69, 83, 73, 90, 69, 
+12, 103, 101, 116, 99, 104, 97, 114, 7, 119, 103, 9, 100, 114, 97, 119, 
+6, 62, 6, 60, 18, 67, 101, 110, 116, 114, 101, 73, 110, 70, 105, 101, 
+108, 100, 10, 116, 105, 116, 108, 101, 18, 68, 114, 97, 119, 84, 105, 116, 
+108, 101, 100, 66, 111, 120, 11, 114, 101, 97, 108, 121, 50, 11, 114, 101, 
+97, 108, 121, 49, 10, 114, 101, 97, 108, 121, 10, 114, 101, 97, 108, 120, 
+21, 99, 97, 108, 99, 117, 108, 97, 116, 101, 95, 104, 101, 105, 103, 104, 
+116, 7, 120, 50, 11, 114, 101, 97, 108, 120, 50, 7, 120, 49, 11, 114, 
+101, 97, 108, 120, 49, 7, 121, 50, 7, 121, 49, 13, 115, 116, 114, 101, 
+116, 99, 104, 121, 17, 83, 99, 114, 101, 101, 110, 72, 101, 105, 103, 104, 
+116, 15, 114, 101, 97, 108, 104, 101, 105, 103, 104, 116, 11, 104, 101, 105, 
+103, 104, 116, 16, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 14, 
+114, 101, 97, 108, 119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 9, 
+70, 111, 114, 109, 10, 119, 105, 100, 116, 104, 9, 105, 110, 105, 116, 14, 
+102, 111, 99, 117, 115, 97, 98, 108, 101, 11, 105, 112, 97, 105, 114, 115, 
+10, 102, 111, 99, 117, 115, 17, 82, 101, 115, 105, 122, 101, 83, 99, 114, 
+101, 101, 110, 12, 14, 10, 4, 2, 60, 0, 0, 5, 0, 3, 0, 6, 
+54, 0, 0, 0, 39, 2, 1, 0, 39, 3, 2, 0, 43, 4, 1, 0, 
+66, 0, 4, 1, 75, 0, 1, 0, 15, 76, 111, 97, 100, 32, 102, 105, 
+108, 101, 58, 10, 84, 105, 116, 108, 101, 16, 70, 105, 108, 101, 66, 114, 
+111, 119, 115, 101, 114, 169, 10, 3, 0, 21, 0, 88, 0, 141, 1, 54, 
+0, 0, 0, 57, 0, 1, 0, 54, 1, 2, 0, 57, 1, 3, 1, 54, 
+2, 2, 0, 57, 2, 4, 2, 54, 3, 2, 0, 57, 3, 5, 3, 54, 
+4, 2, 0, 57, 4, 6, 4, 54, 5, 2, 0, 57, 5, 7, 5, 54, 
+6, 2, 0, 57, 6, 8, 6, 54, 7, 2, 0, 57, 7, 9, 7, 54, 
+8, 2, 0, 57, 8, 10, 8, 54, 9, 2, 0, 57, 9, 11, 9, 54, 
+10, 2, 0, 57, 10, 12, 10, 54, 11, 13, 0, 57, 11, 14, 11, 52, 
+12, 0, 0, 55, 12, 15, 0, 54, 12, 15, 0, 52, 13, 0, 0, 61, 
+13, 16, 12, 54, 12, 15, 0, 52, 13, 0, 0, 61, 13, 17, 12, 54, 
+12, 15, 0, 52, 13, 0, 0, 61, 13, 18, 12, 54, 12, 15, 0, 54, 
+13, 15, 0, 57, 13, 18, 13, 61, 13, 19, 12, 54, 12, 15, 0, 52, 
+13, 0, 0, 61, 13, 20, 12, 51, 12, 21, 0, 51, 13, 22, 0, 51, 
+14, 23, 0, 54, 15, 15, 0, 18, 16, 14, 0, 53, 18, 26, 0, 51, 
+19, 25, 0, 61, 19, 27, 18, 66, 16, 2, 2, 61, 16, 24, 15, 54, 
+15, 15, 0, 18, 16, 14, 0, 53, 18, 30, 0, 51, 19, 29, 0, 61, 
+19, 27, 18, 51, 19, 31, 0, 61, 19, 32, 18, 66, 16, 2, 2, 61, 
+16, 28, 15, 54, 15, 15, 0, 18, 16, 14, 0, 53, 18, 34, 0, 54, 
+19, 15, 0, 57, 19, 18, 19, 61, 19, 35, 18, 51, 19, 36, 0, 61, 
+19, 27, 18, 66, 16, 2, 2, 61, 16, 33, 15, 51, 15, 37, 0, 54, 
+16, 15, 0, 18, 17, 14, 0, 53, 19, 39, 0, 51, 20, 40, 0, 61, 
+20, 27, 19, 61, 15, 41, 19, 66, 17, 2, 2, 61, 17, 38, 16, 54, 
+16, 15, 0, 18, 17, 14, 0, 53, 19, 43, 0, 51, 20, 44, 0, 61, 
+20, 45, 19, 51, 20, 46, 0, 61, 20, 27, 19, 51, 20, 47, 0, 61, 
+20, 48, 19, 51, 20, 49, 0, 61, 20, 50, 19, 51, 20, 51, 0, 61, 
+20, 52, 19, 51, 20, 53, 0, 61, 20, 54, 19, 51, 20, 55, 0, 61, 
+20, 56, 19, 51, 20, 57, 0, 61, 20, 58, 19, 51, 20, 59, 0, 61, 
+20, 60, 19, 51, 20, 61, 0, 61, 20, 62, 19, 66, 17, 2, 2, 61, 
+17, 42, 16, 54, 16, 15, 0, 18, 17, 14, 0, 53, 19, 64, 0, 51, 
+20, 65, 0, 61, 20, 45, 19, 51, 20, 66, 0, 61, 20, 67, 19, 51, 
+20, 68, 0, 61, 20, 69, 19, 51, 20, 70, 0, 61, 20, 27, 19, 51, 
+20, 71, 0, 61, 20, 72, 19, 51, 20, 73, 0, 61, 20, 74, 19, 51, 
+20, 75, 0, 61, 20, 76, 19, 51, 20, 77, 0, 61, 20, 78, 19, 66, 
+17, 2, 2, 61, 17, 63, 16, 53, 16, 80, 0, 51, 17, 79, 0, 61, 
+17, 72, 16, 51, 17, 81, 0, 61, 17, 74, 16, 51, 17, 82, 0, 51, 
+18, 83, 0, 54, 19, 15, 0, 51, 20, 85, 0, 61, 20, 84, 19, 54, 
+19, 15, 0, 51, 20, 87, 0, 61, 20, 86, 19, 50, 0, 0, 128, 75, 
+0, 1, 0, 0, 9, 84, 101, 115, 116, 0, 8, 82, 117, 110, 0, 0, 
+0, 1, 0, 2, 13, 75, 69, 89, 95, 68, 79, 87, 78, 0, 11, 75, 
+69, 89, 95, 85, 80, 0, 0, 13, 75, 69, 89, 95, 80, 71, 68, 78, 
+0, 13, 75, 69, 89, 95, 80, 71, 85, 80, 0, 13, 75, 69, 89, 95, 
+68, 79, 87, 78, 0, 11, 75, 69, 89, 95, 85, 80, 0, 0, 12, 99, 
+104, 97, 110, 103, 101, 100, 0, 18, 95, 97, 100, 106, 117, 115, 116, 79, 
+102, 102, 115, 101, 116, 0, 0, 1, 0, 9, 9, 100, 114, 97, 119, 0, 
+18, 95, 97, 100, 106, 117, 115, 116, 79, 102, 102, 115, 101, 116, 0, 9, 
+105, 110, 105, 116, 0, 13, 75, 69, 89, 95, 80, 71, 68, 78, 0, 13, 
+75, 69, 89, 95, 80, 71, 85, 80, 0, 13, 75, 69, 89, 95, 68, 79, 
+87, 78, 0, 11, 75, 69, 89, 95, 85, 80, 0, 12, 99, 104, 97, 110, 
+103, 101, 100, 0, 14, 102, 111, 99, 117, 115, 97, 98, 108, 101, 2, 12, 
+66, 114, 111, 119, 115, 101, 114, 8, 107, 101, 121, 0, 11, 75, 69, 89, 
+95, 94, 85, 0, 15, 75, 69, 89, 95, 68, 69, 76, 69, 84, 69, 0, 
+18, 75, 69, 89, 95, 66, 65, 67, 75, 83, 80, 65, 67, 69, 0, 12, 
+75, 69, 89, 95, 69, 78, 68, 0, 13, 75, 69, 89, 95, 72, 79, 77, 
+69, 0, 14, 75, 69, 89, 95, 82, 73, 71, 72, 84, 0, 13, 75, 69, 
+89, 95, 76, 69, 70, 84, 0, 0, 9, 105, 110, 105, 116, 0, 1, 0, 
+11, 12, 75, 69, 89, 95, 69, 78, 68, 0, 13, 75, 69, 89, 95, 72, 
+79, 77, 69, 0, 14, 75, 69, 89, 95, 82, 73, 71, 72, 84, 0, 9, 
+100, 114, 97, 119, 0, 13, 75, 69, 89, 95, 76, 69, 70, 84, 0, 15, 
+75, 69, 89, 95, 68, 69, 76, 69, 84, 69, 0, 8, 107, 101, 121, 0, 
+9, 105, 110, 105, 116, 0, 11, 75, 69, 89, 95, 94, 85, 0, 14, 102, 
+111, 99, 117, 115, 97, 98, 108, 101, 2, 18, 75, 69, 89, 95, 66, 65, 
+67, 75, 83, 80, 65, 67, 69, 0, 14, 84, 101, 120, 116, 70, 105, 101, 
+108, 100, 6, 32, 0, 1, 0, 5, 9, 100, 114, 97, 119, 0, 10, 118, 
+97, 108, 117, 101, 1, 6, 32, 0, 14, 102, 111, 99, 117, 115, 97, 98, 
+108, 101, 2, 10, 108, 97, 98, 101, 108, 13, 67, 104, 101, 99, 107, 98, 
+111, 120, 13, 67, 104, 101, 99, 107, 98, 111, 120, 0, 0, 10, 97, 108, 
+105, 103, 110, 1, 0, 2, 10, 97, 108, 105, 103, 110, 0, 9, 100, 114, 
+97, 119, 0, 10, 76, 97, 98, 101, 108, 21, 99, 97, 108, 99, 117, 108, 
+97, 116, 101, 95, 104, 101, 105, 103, 104, 116, 0, 1, 0, 2, 9, 100, 
+114, 97, 119, 0, 21, 99, 97, 108, 99, 117, 108, 97, 116, 101, 95, 104, 
+101, 105, 103, 104, 116, 0, 0, 17, 87, 114, 97, 112, 112, 101, 100, 76, 
+97, 98, 101, 108, 9, 100, 114, 97, 119, 1, 0, 1, 9, 100, 114, 97, 
+119, 0, 0, 12, 68, 105, 118, 105, 100, 101, 114, 0, 0, 0, 10, 76, 
+97, 114, 103, 101, 11, 67, 101, 110, 116, 101, 114, 11, 67, 101, 110, 116, 
+114, 101, 10, 82, 105, 103, 104, 116, 9, 76, 101, 102, 116, 9, 70, 111, 
+114, 109, 8, 114, 101, 112, 11, 115, 116, 114, 105, 110, 103, 15, 115, 101, 
+116, 114, 101, 118, 101, 114, 115, 101, 17, 115, 101, 116, 117, 110, 100, 101, 
+114, 108, 105, 110, 101, 14, 115, 101, 116, 98, 114, 105, 103, 104, 116, 12, 
+115, 101, 116, 98, 111, 108, 100, 14, 115, 101, 116, 110, 111, 114, 109, 97, 
+108, 24, 103, 101, 116, 98, 121, 116, 101, 115, 111, 102, 99, 104, 97, 114, 
+97, 99, 116, 101, 114, 21, 103, 101, 116, 98, 111, 117, 110, 100, 101, 100, 
+115, 116, 114, 105, 110, 103, 19, 103, 101, 116, 115, 116, 114, 105, 110, 103, 
+119, 105, 100, 116, 104, 11, 103, 111, 116, 111, 120, 121, 10, 119, 114, 105, 
+116, 101, 7, 119, 103, 10, 102, 108, 111, 111, 114, 9, 109, 97, 116, 104, 
+0, 
+};
+
+/* This is src/lua/ui.lua */
+static const char file_11[] = {
+27, 76, 74, 2, 10, 121, 0, 1, 7, 4, 2, 1, 20, 45, 1, 0, 
+0, 66, 1, 1, 1, 45, 1, 1, 0, 41, 3, 0, 0, 54, 4, 0, 
+0, 23, 4, 0, 4, 54, 5, 1, 0, 23, 5, 0, 5, 54, 6, 0, 
+0, 23, 6, 0, 6, 66, 1, 5, 1, 45, 1, 2, 0, 41, 3, 0, 
+0, 54, 4, 0, 0, 23, 4, 0, 4, 18, 5, 0, 0, 66, 1, 4, 
+1, 45, 1, 3, 0, 66, 1, 1, 1, 75, 0, 1, 0, 8, 192, 3, 
+192, 1, 192, 4, 192, 16, 83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 
+104, 17, 83, 99, 114, 101, 101, 110, 72, 101, 105, 103, 104, 116, 2, 197, 
+2, 0, 4, 15, 1, 10, 1, 67, 54, 4, 0, 0, 57, 4, 1, 4, 
+39, 6, 2, 0, 18, 7, 2, 0, 66, 4, 3, 2, 54, 5, 0, 0, 
+57, 5, 1, 5, 39, 7, 3, 0, 18, 8, 2, 0, 66, 5, 3, 2, 
+45, 6, 0, 0, 23, 8, 0, 0, 18, 9, 1, 0, 39, 10, 4, 0, 
+66, 6, 4, 1, 45, 6, 0, 0, 32, 8, 2, 0, 22, 8, 0, 8, 
+18, 9, 1, 0, 39, 10, 5, 0, 66, 6, 4, 1, 45, 6, 0, 0, 
+23, 8, 0, 0, 32, 9, 3, 1, 22, 9, 0, 9, 39, 10, 6, 0, 
+66, 6, 4, 1, 45, 6, 0, 0, 32, 8, 2, 0, 22, 8, 0, 8, 
+32, 9, 3, 1, 22, 9, 0, 9, 39, 10, 7, 0, 66, 6, 4, 1, 
+45, 6, 0, 0, 22, 8, 0, 0, 18, 9, 1, 0, 18, 10, 4, 0, 
+66, 6, 4, 1, 45, 6, 0, 0, 22, 8, 0, 0, 32, 9, 3, 1, 
+22, 9, 0, 9, 18, 10, 4, 0, 66, 6, 4, 1, 22, 6, 0, 1, 
+32, 7, 3, 1, 41, 8, 1, 0, 77, 6, 17, 128, 45, 10, 0, 0, 
+23, 12, 0, 0, 18, 13, 9, 0, 39, 14, 8, 0, 66, 10, 4, 1, 
+45, 10, 0, 0, 32, 12, 2, 0, 22, 12, 0, 12, 18, 13, 9, 0, 
+39, 14, 9, 0, 66, 10, 4, 1, 45, 10, 0, 0, 22, 12, 0, 0, 
+18, 13, 9, 0, 18, 14, 5, 0, 66, 10, 4, 1, 79, 6, 239, 127, 
+75, 0, 1, 0, 1, 192, 9, 226, 148, 130, 32, 9, 32, 226, 148, 130, 
+9, 226, 148, 152, 32, 9, 32, 226, 148, 148, 9, 226, 148, 144, 32, 9, 
+32, 226, 148, 140, 6, 32, 8, 226, 148, 128, 8, 114, 101, 112, 11, 115, 
+116, 114, 105, 110, 103, 2, 88, 0, 4, 10, 4, 0, 1, 18, 45, 4, 
+0, 0, 18, 6, 3, 0, 18, 7, 2, 0, 66, 4, 3, 2, 18, 3, 
+4, 0, 45, 4, 1, 0, 45, 6, 2, 0, 18, 8, 3, 0, 66, 6, 
+2, 2, 33, 6, 6, 2, 25, 6, 0, 6, 66, 4, 2, 2, 45, 5, 
+3, 0, 32, 7, 4, 0, 18, 8, 1, 0, 18, 9, 3, 0, 66, 5, 
+4, 1, 75, 0, 1, 0, 12, 192, 0, 192, 10, 192, 1, 192, 4, 55, 
+0, 4, 9, 2, 0, 0, 11, 45, 4, 0, 0, 18, 6, 3, 0, 18, 
+7, 2, 0, 66, 4, 3, 2, 18, 3, 4, 0, 45, 4, 1, 0, 18, 
+6, 0, 0, 18, 7, 1, 0, 18, 8, 3, 0, 66, 4, 4, 1, 75, 
+0, 1, 0, 12, 192, 1, 192, 73, 0, 4, 10, 3, 0, 0, 15, 45, 
+4, 0, 0, 18, 6, 3, 0, 18, 7, 2, 0, 66, 4, 3, 2, 18, 
+3, 4, 0, 45, 4, 1, 0, 18, 6, 3, 0, 66, 4, 2, 2, 33, 
+4, 4, 2, 45, 5, 2, 0, 32, 7, 4, 0, 18, 8, 1, 0, 18, 
+9, 3, 0, 66, 5, 4, 1, 75, 0, 1, 0, 12, 192, 10, 192, 1, 
+192, 148, 1, 0, 6, 12, 3, 2, 1, 28, 45, 6, 0, 0, 66, 6, 
+1, 1, 54, 6, 0, 0, 18, 8, 0, 0, 18, 9, 1, 0, 18, 10, 
+2, 0, 18, 11, 3, 0, 66, 6, 5, 1, 54, 6, 1, 0, 22, 8, 
+0, 0, 18, 9, 1, 0, 18, 10, 2, 0, 18, 11, 4, 0, 66, 6, 
+5, 1, 15, 0, 5, 0, 88, 6, 9, 128, 45, 6, 1, 0, 66, 6, 
+1, 1, 54, 6, 1, 0, 22, 8, 0, 0, 32, 9, 3, 1, 22, 9, 
+0, 9, 18, 10, 2, 0, 18, 11, 5, 0, 66, 6, 5, 1, 45, 6, 
+2, 0, 66, 6, 1, 1, 75, 0, 1, 0, 6, 192, 5, 192, 4, 192, 
+18, 67, 101, 110, 116, 114, 101, 73, 110, 70, 105, 101, 108, 100, 12, 68, 
+114, 97, 119, 66, 111, 120, 2, 164, 1, 0, 1, 10, 3, 5, 2, 27, 
+45, 1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 2, 45, 2, 1, 0, 
+54, 4, 0, 0, 33, 4, 1, 4, 25, 4, 0, 4, 66, 2, 2, 2, 
+45, 3, 1, 0, 54, 5, 1, 0, 25, 5, 0, 5, 66, 3, 2, 2, 
+54, 4, 2, 0, 23, 6, 0, 2, 23, 7, 1, 3, 22, 8, 0, 1, 
+41, 9, 1, 0, 66, 4, 5, 1, 45, 4, 2, 0, 18, 6, 2, 0, 
+18, 7, 3, 0, 18, 8, 0, 0, 66, 4, 4, 1, 54, 4, 3, 0, 
+57, 4, 4, 4, 66, 4, 1, 1, 75, 0, 1, 0, 10, 192, 0, 192, 
+1, 192, 9, 115, 121, 110, 99, 7, 119, 103, 12, 68, 114, 97, 119, 66, 
+111, 120, 17, 83, 99, 114, 101, 101, 110, 72, 101, 105, 103, 104, 116, 16, 
+83, 99, 114, 101, 101, 110, 87, 105, 100, 116, 104, 4, 2, 178, 2, 0, 
+2, 8, 0, 13, 1, 23, 53, 2, 0, 0, 12, 3, 0, 0, 88, 3, 
+1, 128, 39, 3, 1, 0, 61, 3, 2, 2, 54, 3, 3, 0, 57, 3, 
+4, 3, 61, 3, 5, 2, 54, 3, 3, 0, 57, 3, 6, 3, 53, 5, 
+7, 0, 61, 1, 8, 5, 66, 3, 2, 0, 63, 3, 0, 0, 54, 3, 
+3, 0, 57, 3, 9, 3, 18, 5, 2, 0, 54, 6, 10, 0, 39, 7, 
+11, 0, 66, 3, 4, 1, 54, 3, 12, 0, 66, 3, 1, 1, 75, 0, 
+1, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 28, 112, 
+114, 101, 115, 115, 32, 83, 80, 65, 67, 69, 32, 116, 111, 32, 99, 111, 
+110, 116, 105, 110, 117, 101, 17, 82, 101, 100, 114, 97, 119, 83, 99, 114, 
+101, 101, 110, 8, 82, 117, 110, 10, 118, 97, 108, 117, 101, 1, 0, 5, 
+10, 118, 97, 108, 117, 101, 0, 7, 120, 50, 3, 255, 255, 255, 255, 15, 
+7, 120, 49, 3, 1, 7, 121, 50, 3, 253, 255, 255, 255, 15, 7, 121, 
+49, 3, 1, 17, 87, 114, 97, 112, 112, 101, 100, 76, 97, 98, 101, 108, 
+10, 119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 9, 70, 111, 114, 
+109, 10, 116, 105, 116, 108, 101, 12, 77, 101, 115, 115, 97, 103, 101, 1, 
+0, 6, 11, 104, 101, 105, 103, 104, 116, 3, 2, 10, 119, 105, 100, 116, 
+104, 0, 11, 75, 69, 89, 95, 94, 67, 11, 99, 97, 110, 99, 101, 108, 
+10, 116, 105, 116, 108, 101, 0, 13, 115, 116, 114, 101, 116, 99, 104, 121, 
+2, 6, 32, 12, 99, 111, 110, 102, 105, 114, 109, 3, 128, 128, 192, 153, 
+4, 29, 0, 0, 1, 1, 1, 0, 3, 49, 0, 2, 0, 39, 0, 0, 
+0, 76, 0, 2, 0, 2, 128, 12, 99, 111, 110, 102, 105, 114, 109, 29, 
+0, 0, 1, 1, 1, 0, 3, 49, 0, 1, 0, 39, 0, 0, 0, 76, 
+0, 2, 0, 2, 128, 12, 99, 111, 110, 102, 105, 114, 109, 239, 2, 1, 
+2, 11, 0, 19, 1, 31, 43, 2, 0, 0, 51, 3, 0, 0, 51, 4, 
+1, 0, 53, 5, 2, 0, 12, 6, 0, 0, 88, 6, 1, 128, 39, 6, 
+3, 0, 61, 6, 4, 5, 54, 6, 5, 0, 57, 6, 6, 6, 61, 6, 
+7, 5, 61, 4, 8, 5, 61, 4, 9, 5, 61, 3, 10, 5, 61, 3, 
+11, 5, 54, 6, 5, 0, 57, 6, 12, 6, 53, 8, 13, 0, 61, 1, 
+14, 8, 66, 6, 2, 0, 63, 6, 0, 0, 54, 6, 5, 0, 57, 6, 
+15, 6, 18, 8, 5, 0, 54, 9, 16, 0, 39, 10, 17, 0, 66, 6, 
+4, 1, 54, 6, 18, 0, 66, 6, 1, 1, 50, 0, 0, 128, 76, 2, 
+2, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 45, 89, 
+32, 102, 111, 114, 32, 121, 101, 115, 44, 32, 78, 32, 102, 111, 114, 32, 
+110, 111, 44, 32, 111, 114, 32, 67, 84, 82, 76, 43, 67, 32, 116, 111, 
+32, 99, 97, 110, 99, 101, 108, 17, 82, 101, 100, 114, 97, 119, 83, 99, 
+114, 101, 101, 110, 8, 82, 117, 110, 10, 118, 97, 108, 117, 101, 1, 0, 
+5, 10, 118, 97, 108, 117, 101, 0, 7, 120, 50, 3, 255, 255, 255, 255, 
+15, 7, 120, 49, 3, 1, 7, 121, 50, 3, 253, 255, 255, 255, 15, 7, 
+121, 49, 3, 1, 17, 87, 114, 97, 112, 112, 101, 100, 76, 97, 98, 101, 
+108, 6, 89, 6, 121, 6, 78, 6, 110, 10, 119, 105, 100, 116, 104, 10, 
+76, 97, 114, 103, 101, 9, 70, 111, 114, 109, 10, 116, 105, 116, 108, 101, 
+12, 77, 101, 115, 115, 97, 103, 101, 1, 0, 9, 11, 104, 101, 105, 103, 
+104, 116, 3, 2, 10, 119, 105, 100, 116, 104, 0, 11, 75, 69, 89, 95, 
+94, 67, 11, 99, 97, 110, 99, 101, 108, 10, 116, 105, 116, 108, 101, 0, 
+6, 121, 0, 6, 89, 0, 6, 78, 0, 6, 110, 0, 13, 115, 116, 114, 
+101, 116, 99, 104, 121, 2, 0, 0, 3, 128, 128, 192, 153, 4, 220, 3, 
+0, 3, 10, 0, 17, 1, 41, 14, 0, 2, 0, 88, 3, 1, 128, 39, 
+2, 0, 0, 54, 3, 1, 0, 57, 3, 2, 3, 53, 5, 3, 0, 61, 
+2, 4, 5, 18, 8, 2, 0, 57, 6, 5, 2, 66, 6, 2, 2, 22, 
+6, 0, 6, 61, 6, 6, 5, 66, 3, 2, 2, 53, 4, 7, 0, 61, 
+0, 8, 4, 54, 5, 1, 0, 57, 5, 9, 5, 61, 5, 10, 4, 54, 
+5, 1, 0, 57, 5, 11, 5, 53, 7, 12, 0, 61, 1, 4, 7, 66, 
+5, 2, 2, 62, 5, 1, 4, 62, 3, 2, 4, 54, 5, 1, 0, 57, 
+5, 13, 5, 18, 7, 4, 0, 54, 8, 14, 0, 39, 9, 15, 0, 66, 
+5, 4, 2, 54, 6, 16, 0, 66, 6, 1, 1, 15, 0, 5, 0, 88, 
+6, 3, 128, 57, 6, 4, 3, 76, 6, 2, 0, 88, 6, 2, 128, 43, 
+6, 0, 0, 76, 6, 2, 0, 75, 0, 1, 0, 16, 81, 117, 101, 117, 
+101, 82, 101, 100, 114, 97, 119, 40, 82, 69, 84, 85, 82, 78, 32, 116, 
+111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 84, 82, 76, 43, 
+67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 17, 82, 101, 100, 114, 
+97, 119, 83, 99, 114, 101, 101, 110, 8, 82, 117, 110, 1, 0, 5, 10, 
+118, 97, 108, 117, 101, 0, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 
+120, 49, 3, 1, 7, 121, 50, 3, 250, 255, 255, 255, 15, 7, 121, 49, 
+3, 1, 17, 87, 114, 97, 112, 112, 101, 100, 76, 97, 98, 101, 108, 10, 
+119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 10, 116, 105, 116, 108, 
+101, 1, 0, 7, 11, 104, 101, 105, 103, 104, 116, 3, 4, 15, 75, 69, 
+89, 95, 82, 69, 84, 85, 82, 78, 12, 99, 111, 110, 102, 105, 114, 109, 
+10, 119, 105, 100, 116, 104, 0, 14, 75, 69, 89, 95, 69, 78, 84, 69, 
+82, 12, 99, 111, 110, 102, 105, 114, 109, 10, 116, 105, 116, 108, 101, 0, 
+11, 75, 69, 89, 95, 94, 67, 11, 99, 97, 110, 99, 101, 108, 13, 115, 
+116, 114, 101, 116, 99, 104, 121, 2, 11, 99, 117, 114, 115, 111, 114, 8, 
+108, 101, 110, 10, 118, 97, 108, 117, 101, 1, 0, 6, 10, 118, 97, 108, 
+117, 101, 0, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 120, 49, 3, 
+1, 7, 121, 50, 3, 253, 255, 255, 255, 15, 7, 121, 49, 3, 252, 255, 
+255, 255, 15, 11, 99, 117, 114, 115, 111, 114, 0, 14, 84, 101, 120, 116, 
+70, 105, 101, 108, 100, 9, 70, 111, 114, 109, 5, 2, 147, 5, 0, 2, 
+10, 0, 20, 1, 65, 14, 0, 0, 0, 88, 2, 1, 128, 39, 0, 0, 
+0, 14, 0, 1, 0, 88, 2, 1, 128, 39, 1, 0, 0, 54, 2, 1, 
+0, 57, 2, 2, 2, 53, 4, 3, 0, 61, 0, 4, 4, 18, 7, 0, 
+0, 57, 5, 5, 0, 66, 5, 2, 2, 22, 5, 0, 5, 61, 5, 6, 
+4, 66, 2, 2, 2, 54, 3, 1, 0, 57, 3, 2, 3, 53, 5, 7, 
+0, 61, 1, 4, 5, 18, 8, 1, 0, 57, 6, 5, 1, 66, 6, 2, 
+2, 22, 6, 0, 6, 61, 6, 6, 5, 66, 3, 2, 2, 53, 4, 8, 
+0, 54, 5, 1, 0, 57, 5, 9, 5, 61, 5, 10, 4, 54, 5, 1, 
+0, 57, 5, 11, 5, 53, 7, 12, 0, 54, 8, 1, 0, 57, 8, 13, 
+8, 61, 8, 14, 7, 66, 5, 2, 2, 62, 5, 1, 4, 54, 5, 1, 
+0, 57, 5, 11, 5, 53, 7, 15, 0, 54, 8, 1, 0, 57, 8, 13, 
+8, 61, 8, 14, 7, 66, 5, 2, 2, 62, 5, 2, 4, 62, 2, 3, 
+4, 62, 3, 4, 4, 54, 5, 1, 0, 57, 5, 16, 5, 18, 7, 4, 
+0, 54, 8, 17, 0, 39, 9, 18, 0, 66, 5, 4, 2, 54, 6, 19, 
+0, 66, 6, 1, 1, 15, 0, 5, 0, 88, 6, 4, 128, 57, 6, 4, 
+2, 57, 7, 4, 3, 74, 6, 3, 0, 88, 6, 2, 128, 43, 6, 0, 
+0, 76, 6, 2, 0, 75, 0, 1, 0, 16, 81, 117, 101, 117, 101, 82, 
+101, 100, 114, 97, 119, 40, 82, 69, 84, 85, 82, 78, 32, 116, 111, 32, 
+99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 84, 82, 76, 43, 67, 32, 
+116, 111, 32, 99, 97, 110, 99, 101, 108, 17, 82, 101, 100, 114, 97, 119, 
+83, 99, 114, 101, 101, 110, 8, 82, 117, 110, 1, 0, 6, 10, 97, 108, 
+105, 103, 110, 0, 10, 118, 97, 108, 117, 101, 13, 82, 101, 112, 108, 97, 
+99, 101, 58, 7, 120, 50, 3, 10, 7, 120, 49, 3, 1, 7, 121, 50, 
+3, 3, 7, 121, 49, 3, 3, 10, 97, 108, 105, 103, 110, 9, 76, 101, 
+102, 116, 1, 0, 6, 10, 97, 108, 105, 103, 110, 0, 10, 118, 97, 108, 
+117, 101, 10, 70, 105, 110, 100, 58, 7, 120, 50, 3, 10, 7, 120, 49, 
+3, 1, 7, 121, 50, 3, 1, 7, 121, 49, 3, 1, 10, 76, 97, 98, 
+101, 108, 10, 119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 1, 0, 
+6, 11, 104, 101, 105, 103, 104, 116, 3, 5, 15, 75, 69, 89, 95, 82, 
+69, 84, 85, 82, 78, 12, 99, 111, 110, 102, 105, 114, 109, 10, 119, 105, 
+100, 116, 104, 0, 14, 75, 69, 89, 95, 69, 78, 84, 69, 82, 12, 99, 
+111, 110, 102, 105, 114, 109, 10, 116, 105, 116, 108, 101, 21, 70, 105, 110, 
+100, 32, 97, 110, 100, 32, 82, 101, 112, 108, 97, 99, 101, 11, 75, 69, 
+89, 95, 94, 67, 11, 99, 97, 110, 99, 101, 108, 1, 0, 6, 10, 118, 
+97, 108, 117, 101, 0, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 120, 
+49, 3, 11, 7, 121, 50, 3, 4, 7, 121, 49, 3, 3, 11, 99, 117, 
+114, 115, 111, 114, 0, 11, 99, 117, 114, 115, 111, 114, 8, 108, 101, 110, 
+10, 118, 97, 108, 117, 101, 1, 0, 6, 10, 118, 97, 108, 117, 101, 0, 
+7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 120, 49, 3, 11, 7, 121, 
+50, 3, 2, 7, 121, 49, 3, 1, 11, 99, 117, 114, 115, 111, 114, 0, 
+14, 84, 101, 120, 116, 70, 105, 101, 108, 100, 9, 70, 111, 114, 109, 5, 
+2, 212, 8, 0, 0, 6, 0, 23, 1, 78, 53, 0, 0, 0, 54, 1, 
+1, 0, 57, 1, 2, 1, 61, 1, 3, 0, 54, 1, 1, 0, 57, 1, 
+4, 1, 53, 3, 7, 0, 39, 4, 5, 0, 54, 5, 6, 0, 38, 4, 
+5, 4, 61, 4, 8, 3, 54, 4, 1, 0, 57, 4, 9, 4, 61, 4, 
+10, 3, 66, 1, 2, 2, 62, 1, 1, 0, 54, 1, 1, 0, 57, 1, 
+4, 1, 53, 3, 11, 0, 54, 4, 1, 0, 57, 4, 9, 4, 61, 4, 
+10, 3, 66, 1, 2, 2, 62, 1, 2, 0, 54, 1, 1, 0, 57, 1, 
+4, 1, 53, 3, 14, 0, 39, 4, 12, 0, 54, 5, 13, 0, 38, 4, 
+5, 4, 61, 4, 8, 3, 54, 4, 1, 0, 57, 4, 9, 4, 61, 4, 
+10, 3, 66, 1, 2, 2, 62, 1, 3, 0, 54, 1, 1, 0, 57, 1, 
+4, 1, 53, 3, 15, 0, 54, 4, 1, 0, 57, 4, 9, 4, 61, 4, 
+10, 3, 66, 1, 2, 2, 62, 1, 4, 0, 54, 1, 1, 0, 57, 1, 
+4, 1, 53, 3, 16, 0, 54, 4, 1, 0, 57, 4, 9, 4, 61, 4, 
+10, 3, 66, 1, 2, 2, 62, 1, 5, 0, 54, 1, 1, 0, 57, 1, 
+4, 1, 53, 3, 17, 0, 54, 4, 1, 0, 57, 4, 9, 4, 61, 4, 
+10, 3, 66, 1, 2, 2, 62, 1, 6, 0, 54, 1, 1, 0, 57, 1, 
+4, 1, 53, 3, 18, 0, 54, 4, 1, 0, 57, 4, 9, 4, 61, 4, 
+10, 3, 66, 1, 2, 0, 63, 1, 0, 0, 54, 1, 1, 0, 57, 1, 
+19, 1, 18, 3, 0, 0, 54, 4, 20, 0, 39, 5, 21, 0, 66, 1, 
+4, 2, 54, 2, 22, 0, 66, 2, 1, 1, 43, 2, 0, 0, 76, 2, 
+2, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 28, 112, 
+114, 101, 115, 115, 32, 83, 80, 65, 67, 69, 32, 116, 111, 32, 99, 111, 
+110, 116, 105, 110, 117, 101, 17, 82, 101, 100, 114, 97, 119, 83, 99, 114, 
+101, 101, 110, 8, 82, 117, 110, 1, 0, 6, 10, 97, 108, 105, 103, 110, 
+0, 10, 118, 97, 108, 117, 101, 66, 70, 111, 114, 32, 109, 111, 114, 101, 
+32, 105, 110, 102, 111, 114, 109, 97, 116, 105, 111, 110, 44, 32, 115, 101, 
+101, 32, 104, 116, 116, 112, 58, 47, 47, 119, 111, 114, 100, 103, 114, 105, 
+110, 100, 101, 114, 46, 115, 111, 117, 114, 99, 101, 102, 111, 114, 103, 101, 
+46, 110, 101, 116, 46, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 120, 
+49, 3, 1, 7, 121, 50, 3, 10, 7, 121, 49, 3, 10, 1, 0, 6, 
+10, 97, 108, 105, 103, 110, 0, 10, 118, 97, 108, 117, 101, 58, 32, 32, 
+32, 32, 100, 111, 119, 110, 32, 97, 110, 100, 32, 100, 111, 32, 115, 111, 
+109, 101, 32, 114, 101, 97, 108, 32, 119, 114, 105, 116, 105, 110, 103, 46, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 120, 49, 3, 
+1, 7, 121, 50, 3, 8, 7, 121, 49, 3, 8, 1, 0, 6, 10, 97, 
+108, 105, 103, 110, 0, 10, 118, 97, 108, 117, 101, 58, 32, 32, 32, 32, 
+100, 105, 115, 112, 108, 97, 99, 101, 109, 101, 110, 116, 32, 97, 99, 116, 
+105, 118, 105, 116, 121, 32, 116, 111, 32, 97, 118, 111, 105, 100, 32, 104, 
+97, 118, 105, 110, 103, 32, 116, 111, 32, 115, 101, 116, 116, 108, 101, 32, 
+32, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 120, 49, 3, 1, 7, 
+121, 50, 3, 7, 7, 121, 49, 3, 7, 1, 0, 6, 10, 97, 108, 105, 
+103, 110, 0, 10, 118, 97, 108, 117, 101, 58, 67, 97, 116, 32, 118, 97, 
+99, 117, 117, 109, 105, 110, 103, 32, 40, 110, 41, 58, 32, 112, 111, 105, 
+110, 116, 108, 101, 115, 115, 32, 111, 114, 32, 111, 116, 104, 101, 114, 119, 
+105, 115, 101, 32, 105, 110, 101, 102, 102, 105, 99, 105, 101, 110, 116, 7, 
+120, 50, 3, 255, 255, 255, 255, 15, 7, 120, 49, 3, 1, 7, 121, 50, 
+3, 6, 7, 121, 49, 3, 6, 1, 0, 6, 10, 97, 108, 105, 103, 110, 
+0, 10, 118, 97, 108, 117, 101, 0, 7, 120, 50, 3, 255, 255, 255, 255, 
+15, 7, 120, 49, 3, 1, 7, 121, 50, 3, 4, 7, 121, 49, 3, 4, 
+15, 70, 73, 76, 69, 70, 79, 82, 77, 65, 84, 25, 70, 105, 108, 101, 
+32, 102, 111, 114, 109, 97, 116, 32, 118, 101, 114, 115, 105, 111, 110, 32, 
+1, 0, 6, 10, 97, 108, 105, 103, 110, 0, 10, 118, 97, 108, 117, 101, 
+29, 194, 169, 32, 50, 48, 48, 55, 45, 50, 48, 49, 51, 32, 68, 97, 
+118, 105, 100, 32, 71, 105, 118, 101, 110, 7, 120, 50, 3, 255, 255, 255, 
+255, 15, 7, 120, 49, 3, 1, 7, 121, 50, 3, 2, 7, 121, 49, 3, 
+2, 10, 97, 108, 105, 103, 110, 11, 67, 101, 110, 116, 114, 101, 10, 118, 
+97, 108, 117, 101, 1, 0, 6, 10, 97, 108, 105, 103, 110, 0, 10, 118, 
+97, 108, 117, 101, 0, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 120, 
+49, 3, 1, 7, 121, 50, 3, 1, 7, 121, 49, 3, 1, 12, 86, 69, 
+82, 83, 73, 79, 78, 17, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 
+114, 32, 10, 76, 97, 98, 101, 108, 10, 119, 105, 100, 116, 104, 10, 76, 
+97, 114, 103, 101, 9, 70, 111, 114, 109, 1, 0, 7, 11, 104, 101, 105, 
+103, 104, 116, 3, 12, 15, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 
+12, 99, 111, 110, 102, 105, 114, 109, 10, 119, 105, 100, 116, 104, 0, 14, 
+75, 69, 89, 95, 69, 78, 84, 69, 82, 12, 99, 111, 110, 102, 105, 114, 
+109, 10, 116, 105, 116, 108, 101, 22, 65, 98, 111, 117, 116, 32, 87, 111, 
+114, 100, 71, 114, 105, 110, 100, 101, 114, 11, 75, 69, 89, 95, 94, 67, 
+11, 99, 97, 110, 99, 101, 108, 6, 32, 12, 99, 111, 110, 102, 105, 114, 
+109, 15, 128, 128, 192, 153, 4, 168, 4, 3, 0, 14, 0, 39, 0, 52, 
+54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 2, 0, 57, 1, 3, 1, 
+54, 2, 2, 0, 57, 2, 4, 2, 54, 3, 2, 0, 57, 3, 5, 3, 
+54, 4, 2, 0, 57, 4, 6, 4, 54, 5, 2, 0, 57, 5, 7, 5, 
+54, 6, 2, 0, 57, 6, 8, 6, 54, 7, 2, 0, 57, 7, 9, 7, 
+54, 8, 2, 0, 57, 8, 10, 8, 54, 9, 2, 0, 57, 9, 11, 9, 
+54, 10, 2, 0, 57, 10, 12, 10, 54, 11, 2, 0, 57, 11, 13, 11, 
+54, 12, 2, 0, 57, 12, 14, 12, 51, 13, 15, 0, 55, 13, 16, 0, 
+51, 13, 17, 0, 55, 13, 18, 0, 51, 13, 19, 0, 55, 13, 20, 0, 
+51, 13, 21, 0, 55, 13, 22, 0, 51, 13, 23, 0, 55, 13, 24, 0, 
+51, 13, 25, 0, 55, 13, 26, 0, 51, 13, 27, 0, 55, 13, 28, 0, 
+51, 13, 29, 0, 55, 13, 30, 0, 51, 13, 31, 0, 55, 13, 32, 0, 
+51, 13, 33, 0, 55, 13, 34, 0, 51, 13, 35, 0, 55, 13, 36, 0, 
+51, 13, 37, 0, 55, 13, 38, 0, 50, 0, 0, 128, 75, 0, 1, 0, 
+18, 65, 98, 111, 117, 116, 68, 105, 97, 108, 111, 103, 117, 101, 0, 27, 
+70, 105, 110, 100, 65, 110, 100, 82, 101, 112, 108, 97, 99, 101, 68, 105, 
+97, 108, 111, 103, 117, 101, 0, 20, 80, 114, 111, 109, 112, 116, 70, 111, 
+114, 83, 116, 114, 105, 110, 103, 0, 19, 80, 114, 111, 109, 112, 116, 70, 
+111, 114, 89, 101, 115, 78, 111, 0, 17, 77, 111, 100, 97, 108, 77, 101, 
+115, 115, 97, 103, 101, 0, 21, 73, 109, 109, 101, 100, 105, 97, 116, 101, 
+77, 101, 115, 115, 97, 103, 101, 0, 18, 68, 114, 97, 119, 84, 105, 116, 
+108, 101, 100, 66, 111, 120, 0, 18, 82, 65, 108, 105, 103, 110, 73, 110, 
+70, 105, 101, 108, 100, 0, 18, 76, 65, 108, 105, 103, 110, 73, 110, 70, 
+105, 101, 108, 100, 0, 18, 67, 101, 110, 116, 114, 101, 73, 110, 70, 105, 
+101, 108, 100, 0, 12, 68, 114, 97, 119, 66, 111, 120, 0, 19, 68, 114, 
+97, 119, 83, 116, 97, 116, 117, 115, 76, 105, 110, 101, 0, 21, 103, 101, 
+116, 98, 111, 117, 110, 100, 101, 100, 115, 116, 114, 105, 110, 103, 24, 103, 
+101, 116, 98, 121, 116, 101, 115, 111, 102, 99, 104, 97, 114, 97, 99, 116, 
+101, 114, 19, 103, 101, 116, 115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 
+104, 11, 115, 101, 116, 100, 105, 109, 15, 115, 101, 116, 114, 101, 118, 101, 
+114, 115, 101, 17, 115, 101, 116, 117, 110, 100, 101, 114, 108, 105, 110, 101, 
+14, 115, 101, 116, 98, 114, 105, 103, 104, 116, 12, 115, 101, 116, 98, 111, 
+108, 100, 14, 115, 101, 116, 110, 111, 114, 109, 97, 108, 14, 99, 108, 101, 
+97, 114, 97, 114, 101, 97, 11, 103, 111, 116, 111, 120, 121, 10, 119, 114, 
+105, 116, 101, 7, 119, 103, 10, 102, 108, 111, 111, 114, 9, 109, 97, 116, 
+104, 0, 
+};
+
+/* This is src/lua/browser.lua */
+static const char file_12[] = {
+27, 76, 74, 2, 10, 103, 0, 2, 4, 0, 3, 0, 19, 57, 2, 0, 
+0, 57, 3, 0, 1, 5, 2, 3, 0, 88, 2, 8, 128, 57, 2, 1, 
+0, 57, 3, 1, 1, 0, 2, 3, 0, 88, 2, 2, 128, 43, 2, 1, 
+0, 88, 3, 1, 128, 43, 2, 2, 0, 76, 2, 2, 0, 57, 2, 0, 
+0, 7, 2, 2, 0, 88, 2, 2, 128, 43, 2, 2, 0, 76, 2, 2, 
+0, 43, 2, 1, 0, 76, 2, 2, 0, 14, 100, 105, 114, 101, 99, 116, 
+111, 114, 121, 9, 110, 97, 109, 101, 9, 109, 111, 100, 101, 142, 8, 1, 
+4, 17, 0, 35, 2, 173, 1, 52, 4, 0, 0, 54, 5, 0, 0, 57, 
+5, 1, 5, 39, 7, 2, 0, 66, 5, 2, 4, 88, 8, 20, 128, 6, 
+8, 2, 0, 88, 9, 18, 128, 6, 8, 3, 0, 88, 9, 6, 128, 18, 
+11, 8, 0, 57, 9, 4, 8, 39, 12, 5, 0, 66, 9, 3, 2, 14, 
+0, 9, 0, 88, 9, 10, 128, 54, 9, 0, 0, 57, 9, 6, 9, 18, 
+11, 8, 0, 66, 9, 2, 2, 15, 0, 9, 0, 88, 10, 4, 128, 61, 
+8, 7, 9, 21, 10, 4, 0, 22, 10, 0, 10, 60, 9, 10, 4, 69, 
+8, 3, 2, 82, 8, 234, 127, 54, 5, 8, 0, 57, 5, 9, 5, 18, 
+7, 4, 0, 51, 8, 10, 0, 66, 5, 3, 1, 52, 5, 0, 0, 41, 
+6, 1, 0, 54, 7, 11, 0, 18, 9, 4, 0, 66, 7, 2, 4, 88, 
+10, 19, 128, 39, 12, 12, 0, 57, 13, 13, 11, 7, 13, 14, 0, 88, 
+13, 1, 128, 39, 12, 15, 0, 21, 13, 5, 0, 22, 13, 0, 13, 53, 
+14, 16, 0, 57, 15, 7, 11, 61, 15, 17, 14, 18, 15, 12, 0, 57, 
+16, 7, 11, 38, 15, 16, 15, 61, 15, 18, 14, 60, 14, 13, 5, 57, 
+13, 7, 11, 5, 13, 3, 0, 88, 13, 1, 128, 21, 6, 5, 0, 69, 
+10, 3, 3, 82, 10, 235, 127, 21, 7, 5, 0, 9, 7, 1, 0, 88, 
+7, 4, 128, 21, 7, 5, 0, 22, 7, 0, 7, 53, 8, 19, 0, 60, 
+8, 7, 5, 54, 7, 20, 0, 18, 9, 0, 0, 54, 10, 0, 0, 57, 
+10, 21, 10, 66, 10, 1, 2, 18, 11, 1, 0, 18, 12, 5, 0, 18, 
+13, 3, 0, 18, 14, 6, 0, 66, 7, 7, 2, 14, 0, 7, 0, 88, 
+8, 3, 128, 43, 8, 0, 0, 50, 0, 0, 128, 76, 8, 2, 0, 54, 
+8, 22, 0, 7, 8, 23, 0, 88, 8, 9, 128, 18, 10, 7, 0, 57, 
+8, 4, 7, 39, 11, 24, 0, 66, 8, 3, 2, 15, 0, 8, 0, 88, 
+9, 3, 128, 18, 8, 7, 0, 39, 9, 25, 0, 38, 7, 9, 8, 54, 
+8, 0, 0, 57, 8, 6, 8, 18, 10, 7, 0, 66, 8, 2, 3, 14, 
+0, 2, 0, 88, 10, 16, 128, 15, 0, 9, 0, 88, 10, 14, 128, 54, 
+10, 26, 0, 39, 12, 27, 0, 39, 13, 28, 0, 18, 14, 7, 0, 39, 
+15, 29, 0, 18, 16, 9, 0, 38, 13, 16, 13, 66, 10, 3, 1, 54, 
+10, 30, 0, 18, 12, 0, 0, 18, 13, 1, 0, 18, 14, 2, 0, 50, 
+0, 0, 128, 68, 10, 4, 0, 15, 0, 8, 0, 88, 10, 13, 128, 57, 
+10, 13, 8, 7, 10, 14, 0, 88, 10, 10, 128, 54, 10, 0, 0, 57, 
+10, 31, 10, 18, 12, 7, 0, 66, 10, 2, 1, 54, 10, 30, 0, 18, 
+12, 0, 0, 18, 13, 1, 0, 18, 14, 2, 0, 50, 0, 0, 128, 68, 
+10, 4, 0, 15, 0, 2, 0, 88, 10, 32, 128, 14, 0, 9, 0, 88, 
+10, 30, 128, 54, 10, 32, 0, 39, 12, 33, 0, 39, 13, 28, 0, 18, 
+14, 7, 0, 39, 15, 34, 0, 38, 13, 15, 13, 66, 10, 3, 2, 11, 
+10, 0, 0, 88, 11, 4, 128, 43, 11, 0, 0, 50, 0, 0, 128, 76, 
+11, 2, 0, 88, 11, 17, 128, 15, 0, 10, 0, 88, 11, 9, 128, 54, 
+11, 0, 0, 57, 11, 21, 11, 66, 11, 1, 2, 39, 12, 25, 0, 18, 
+13, 7, 0, 38, 11, 13, 11, 50, 0, 0, 128, 76, 11, 2, 0, 88, 
+11, 6, 128, 54, 11, 30, 0, 18, 13, 0, 0, 18, 14, 1, 0, 18, 
+15, 2, 0, 50, 0, 0, 128, 68, 11, 4, 0, 54, 10, 0, 0, 57, 
+10, 21, 10, 66, 10, 1, 2, 39, 11, 25, 0, 18, 12, 7, 0, 38, 
+10, 12, 10, 50, 0, 0, 128, 76, 10, 2, 0, 51, 39, 32, 97, 108, 
+114, 101, 97, 100, 121, 32, 101, 120, 105, 115, 116, 115, 46, 32, 68, 111, 
+32, 121, 111, 117, 32, 119, 97, 110, 116, 32, 116, 111, 32, 111, 118, 101, 
+114, 119, 114, 105, 116, 101, 32, 105, 116, 63, 20, 79, 118, 101, 114, 119, 
+114, 105, 116, 101, 32, 102, 105, 108, 101, 63, 19, 80, 114, 111, 109, 112, 
+116, 70, 111, 114, 89, 101, 115, 78, 111, 10, 99, 104, 100, 105, 114, 16, 
+70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 30, 39, 32, 99, 111, 
+117, 108, 100, 32, 110, 111, 116, 32, 98, 101, 32, 97, 99, 99, 101, 115, 
+115, 101, 100, 58, 32, 15, 84, 104, 101, 32, 102, 105, 108, 101, 32, 39, 
+22, 70, 105, 108, 101, 32, 105, 110, 97, 99, 99, 101, 115, 115, 105, 98, 
+108, 101, 17, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 6, 
+47, 10, 94, 37, 97, 58, 36, 12, 119, 105, 110, 100, 111, 119, 115, 9, 
+65, 82, 67, 72, 15, 99, 117, 114, 114, 101, 110, 116, 100, 105, 114, 12, 
+66, 114, 111, 119, 115, 101, 114, 1, 0, 2, 10, 108, 97, 98, 101, 108, 
+11, 226, 151, 135, 32, 46, 46, 9, 100, 97, 116, 97, 7, 46, 46, 10, 
+108, 97, 98, 101, 108, 9, 100, 97, 116, 97, 1, 0, 2, 10, 108, 97, 
+98, 101, 108, 0, 9, 100, 97, 116, 97, 0, 9, 226, 151, 135, 32, 14, 
+100, 105, 114, 101, 99, 116, 111, 114, 121, 9, 109, 111, 100, 101, 7, 32, 
+32, 11, 105, 112, 97, 105, 114, 115, 0, 9, 115, 111, 114, 116, 10, 116, 
+97, 98, 108, 101, 9, 110, 97, 109, 101, 15, 97, 116, 116, 114, 105, 98, 
+117, 116, 101, 115, 8, 94, 37, 46, 10, 109, 97, 116, 99, 104, 7, 46, 
+46, 6, 46, 8, 100, 105, 114, 8, 108, 102, 115, 2, 0, 156, 1, 0, 
+2, 7, 3, 6, 1, 27, 45, 2, 0, 0, 56, 2, 1, 2, 45, 4, 
+0, 0, 66, 2, 2, 2, 45, 3, 1, 0, 45, 4, 2, 0, 45, 5, 
+0, 0, 57, 5, 1, 5, 56, 4, 5, 4, 57, 4, 2, 4, 61, 4, 
+0, 3, 45, 3, 1, 0, 45, 4, 1, 0, 57, 4, 0, 4, 18, 6, 
+4, 0, 57, 4, 3, 4, 66, 4, 2, 2, 22, 4, 0, 4, 61, 4, 
+1, 3, 45, 3, 1, 0, 41, 4, 1, 0, 61, 4, 4, 3, 45, 3, 
+1, 0, 18, 5, 3, 0, 57, 3, 5, 3, 66, 3, 2, 1, 76, 2, 
+2, 0, 6, 192, 7, 192, 3, 192, 9, 100, 114, 97, 119, 11, 111, 102, 
+102, 115, 101, 116, 8, 108, 101, 110, 9, 100, 97, 116, 97, 11, 99, 117, 
+114, 115, 111, 114, 10, 118, 97, 108, 117, 101, 2, 238, 7, 1, 6, 17, 
+1, 33, 3, 90, 54, 6, 0, 0, 57, 6, 1, 6, 53, 8, 2, 0, 
+54, 9, 0, 0, 57, 9, 1, 9, 61, 9, 3, 8, 61, 3, 4, 8, 
+12, 9, 5, 0, 88, 9, 1, 128, 41, 9, 1, 0, 61, 9, 5, 8, 
+66, 6, 2, 2, 54, 7, 0, 0, 57, 7, 6, 7, 53, 9, 7, 0, 
+45, 10, 0, 0, 18, 12, 2, 0, 66, 10, 2, 2, 22, 10, 0, 10, 
+61, 10, 8, 9, 12, 10, 4, 0, 88, 10, 2, 128, 58, 10, 1, 3, 
+57, 10, 4, 10, 61, 10, 9, 9, 66, 7, 2, 2, 51, 8, 10, 0, 
+43, 9, 0, 0, 54, 10, 11, 0, 7, 10, 12, 0, 88, 10, 2, 128, 
+39, 9, 13, 0, 88, 10, 1, 128, 39, 9, 14, 0, 53, 10, 15, 0, 
+61, 0, 16, 10, 54, 11, 0, 0, 57, 11, 17, 11, 61, 11, 18, 10, 
+54, 11, 0, 0, 57, 11, 17, 11, 61, 11, 19, 10, 61, 8, 20, 10, 
+61, 8, 21, 10, 61, 8, 22, 10, 61, 8, 23, 10, 54, 11, 0, 0, 
+57, 11, 24, 11, 53, 13, 25, 0, 61, 1, 9, 13, 66, 11, 2, 2, 
+62, 11, 1, 10, 62, 7, 2, 10, 62, 6, 3, 10, 54, 11, 0, 0, 
+57, 11, 24, 11, 53, 13, 26, 0, 45, 14, 0, 0, 18, 16, 2, 0, 
+66, 14, 2, 2, 22, 14, 1, 14, 61, 14, 27, 13, 61, 2, 9, 13, 
+66, 11, 2, 2, 62, 11, 4, 10, 54, 11, 0, 0, 57, 11, 24, 11, 
+53, 13, 28, 0, 61, 9, 9, 13, 66, 11, 2, 0, 63, 11, 2, 0, 
+54, 11, 0, 0, 57, 11, 29, 11, 18, 13, 10, 0, 54, 14, 30, 0, 
+39, 15, 31, 0, 66, 11, 4, 2, 54, 12, 32, 0, 66, 12, 1, 1, 
+15, 0, 11, 0, 88, 12, 4, 128, 57, 12, 9, 7, 50, 0, 0, 128, 
+76, 12, 2, 0, 88, 12, 3, 128, 43, 12, 0, 0, 50, 0, 0, 128, 
+76, 12, 2, 0, 50, 0, 0, 128, 75, 0, 1, 0, 11, 192, 16, 81, 
+117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 40, 82, 69, 84, 85, 82, 
+78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 84, 
+82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 17, 82, 
+101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 8, 82, 117, 110, 1, 
+0, 5, 10, 118, 97, 108, 117, 101, 0, 7, 120, 50, 3, 255, 255, 255, 
+255, 15, 7, 120, 49, 3, 1, 7, 121, 50, 3, 255, 255, 255, 255, 15, 
+7, 121, 49, 3, 255, 255, 255, 255, 15, 7, 120, 50, 1, 0, 5, 10, 
+118, 97, 108, 117, 101, 0, 7, 120, 50, 0, 7, 120, 49, 3, 1, 7, 
+121, 50, 3, 253, 255, 255, 255, 15, 7, 121, 49, 3, 253, 255, 255, 255, 
+15, 1, 0, 5, 10, 118, 97, 108, 117, 101, 0, 7, 120, 50, 3, 255, 
+255, 255, 255, 15, 7, 120, 49, 3, 1, 7, 121, 50, 3, 1, 7, 121, 
+49, 3, 1, 10, 76, 97, 98, 101, 108, 13, 75, 69, 89, 95, 80, 71, 
+85, 80, 13, 75, 69, 89, 95, 80, 71, 68, 78, 13, 75, 69, 89, 95, 
+68, 79, 87, 78, 11, 75, 69, 89, 95, 85, 80, 11, 104, 101, 105, 103, 
+104, 116, 10, 119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 10, 116, 
+105, 116, 108, 101, 1, 0, 11, 11, 104, 101, 105, 103, 104, 116, 0, 13, 
+75, 69, 89, 95, 80, 71, 68, 78, 0, 15, 75, 69, 89, 95, 82, 69, 
+84, 85, 82, 78, 12, 99, 111, 110, 102, 105, 114, 109, 14, 75, 69, 89, 
+95, 69, 78, 84, 69, 82, 12, 99, 111, 110, 102, 105, 114, 109, 10, 116, 
+105, 116, 108, 101, 0, 11, 75, 69, 89, 95, 94, 67, 11, 99, 97, 110, 
+99, 101, 108, 11, 75, 69, 89, 95, 85, 80, 0, 10, 119, 105, 100, 116, 
+104, 0, 13, 75, 69, 89, 95, 80, 71, 85, 80, 0, 13, 115, 116, 114, 
+101, 116, 99, 104, 121, 1, 13, 75, 69, 89, 95, 68, 79, 87, 78, 0, 
+39, 101, 110, 116, 101, 114, 32, 97, 110, 32, 97, 98, 115, 111, 108, 117, 
+116, 101, 32, 112, 97, 116, 104, 32, 116, 111, 32, 103, 111, 32, 116, 104, 
+101, 114, 101, 62, 101, 110, 116, 101, 114, 32, 97, 110, 32, 97, 98, 115, 
+111, 108, 117, 116, 101, 32, 112, 97, 116, 104, 32, 111, 114, 32, 100, 114, 
+105, 118, 101, 32, 108, 101, 116, 116, 101, 114, 32, 40, 39, 99, 58, 39, 
+41, 32, 116, 111, 32, 103, 111, 32, 116, 104, 101, 114, 101, 12, 119, 105, 
+110, 100, 111, 119, 115, 9, 65, 82, 67, 72, 0, 10, 118, 97, 108, 117, 
+101, 7, 120, 49, 1, 0, 5, 10, 118, 97, 108, 117, 101, 0, 7, 120, 
+50, 3, 255, 255, 255, 255, 15, 7, 120, 49, 0, 7, 121, 50, 3, 254, 
+255, 255, 255, 15, 7, 121, 49, 3, 253, 255, 255, 255, 15, 14, 84, 101, 
+120, 116, 70, 105, 101, 108, 100, 11, 99, 117, 114, 115, 111, 114, 9, 100, 
+97, 116, 97, 9, 116, 121, 112, 101, 1, 0, 8, 14, 102, 111, 99, 117, 
+115, 97, 98, 108, 101, 1, 7, 120, 50, 3, 255, 255, 255, 255, 15, 9, 
+116, 121, 112, 101, 0, 7, 120, 49, 3, 1, 7, 121, 50, 3, 251, 255, 
+255, 255, 15, 7, 121, 49, 3, 2, 11, 99, 117, 114, 115, 111, 114, 0, 
+9, 100, 97, 116, 97, 0, 12, 66, 114, 111, 119, 115, 101, 114, 9, 70, 
+111, 114, 109, 6, 2, 11, 128, 128, 192, 153, 4, 151, 2, 3, 0, 14, 
+0, 20, 0, 30, 54, 0, 0, 0, 54, 1, 1, 0, 54, 2, 2, 0, 
+57, 2, 3, 2, 54, 3, 4, 0, 57, 3, 5, 3, 54, 4, 6, 0, 
+57, 4, 7, 4, 54, 5, 6, 0, 57, 5, 8, 5, 54, 6, 6, 0, 
+57, 6, 9, 6, 54, 7, 6, 0, 57, 7, 10, 7, 54, 8, 6, 0, 
+57, 8, 11, 8, 54, 9, 6, 0, 57, 9, 12, 9, 54, 10, 6, 0, 
+57, 10, 13, 10, 54, 11, 6, 0, 57, 11, 14, 11, 54, 12, 6, 0, 
+57, 12, 15, 12, 51, 13, 16, 0, 55, 13, 17, 0, 51, 13, 18, 0, 
+55, 13, 19, 0, 50, 0, 0, 128, 75, 0, 1, 0, 12, 66, 114, 111, 
+119, 115, 101, 114, 0, 16, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 
+114, 0, 24, 103, 101, 116, 98, 121, 116, 101, 115, 111, 102, 99, 104, 97, 
+114, 97, 99, 116, 101, 114, 19, 103, 101, 116, 115, 116, 114, 105, 110, 103, 
+119, 105, 100, 116, 104, 11, 115, 101, 116, 100, 105, 109, 15, 115, 101, 116, 
+114, 101, 118, 101, 114, 115, 101, 17, 115, 101, 116, 117, 110, 100, 101, 114, 
+108, 105, 110, 101, 12, 115, 101, 116, 98, 111, 108, 100, 14, 115, 101, 116, 
+110, 111, 114, 109, 97, 108, 11, 103, 111, 116, 111, 120, 121, 10, 119, 114, 
+105, 116, 101, 7, 119, 103, 8, 114, 101, 112, 11, 115, 116, 114, 105, 110, 
+103, 10, 102, 108, 111, 111, 114, 9, 109, 97, 116, 104, 8, 109, 97, 120, 
+8, 109, 105, 110, 0, 
+};
+
+/* This is src/lua/html.lua */
+static const char file_13[] = {
+27, 76, 74, 2, 10, 149, 1, 0, 1, 9, 2, 4, 0, 26, 54, 1, 
+0, 0, 56, 1, 0, 1, 15, 0, 1, 0, 88, 2, 1, 128, 76, 1, 
+2, 0, 45, 2, 0, 0, 18, 4, 0, 0, 39, 5, 1, 0, 66, 2, 
+3, 4, 14, 0, 4, 0, 88, 5, 2, 128, 43, 5, 0, 0, 76, 5, 
+2, 0, 54, 5, 2, 0, 39, 7, 3, 0, 18, 8, 4, 0, 38, 7, 
+8, 7, 66, 5, 2, 2, 18, 4, 5, 0, 14, 0, 4, 0, 88, 5, 
+2, 128, 43, 5, 0, 0, 76, 5, 2, 0, 45, 5, 1, 0, 18, 7, 
+4, 0, 68, 5, 2, 0, 1, 192, 0, 192, 6, 48, 13, 116, 111, 110, 
+117, 109, 98, 101, 114, 14, 94, 38, 35, 40, 37, 119, 42, 41, 59, 17, 
+72, 84, 77, 76, 69, 110, 116, 105, 116, 105, 101, 115, 175, 22, 3, 0, 
+3, 0, 8, 0, 10, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 2, 
+0, 57, 1, 3, 1, 53, 2, 4, 0, 55, 2, 5, 0, 51, 2, 6, 
+0, 55, 2, 7, 0, 50, 0, 0, 128, 75, 0, 1, 0, 21, 68, 101, 
+99, 111, 100, 101, 72, 84, 77, 76, 69, 110, 116, 105, 116, 121, 0, 17, 
+72, 84, 77, 76, 69, 110, 116, 105, 116, 105, 101, 115, 1, 0, 252, 1, 
+12, 38, 105, 110, 102, 105, 110, 59, 8, 226, 136, 158, 12, 38, 112, 114, 
+105, 109, 101, 59, 8, 226, 128, 178, 13, 38, 102, 111, 114, 97, 108, 108, 
+59, 8, 226, 136, 128, 11, 38, 73, 117, 109, 108, 59, 7, 195, 143, 11, 
+38, 102, 110, 111, 102, 59, 7, 198, 146, 12, 38, 80, 114, 105, 109, 101, 
+59, 8, 226, 128, 179, 13, 38, 100, 105, 118, 105, 100, 101, 59, 7, 195, 
+183, 11, 38, 111, 114, 100, 109, 59, 7, 194, 186, 10, 38, 100, 101, 103, 
+59, 7, 194, 176, 12, 38, 111, 108, 105, 110, 101, 59, 8, 226, 128, 190, 
+11, 38, 122, 119, 110, 106, 59, 8, 226, 128, 140, 10, 38, 110, 111, 116, 
+59, 7, 194, 172, 10, 38, 122, 119, 106, 59, 8, 226, 128, 141, 12, 38, 
+110, 100, 97, 115, 104, 59, 8, 226, 128, 147, 13, 38, 116, 104, 105, 110, 
+115, 112, 59, 8, 226, 128, 137, 12, 38, 109, 100, 97, 115, 104, 59, 8, 
+226, 128, 148, 11, 38, 110, 98, 115, 112, 59, 7, 194, 160, 11, 38, 111, 
+114, 100, 102, 59, 7, 194, 170, 11, 38, 101, 110, 115, 112, 59, 8, 226, 
+128, 130, 13, 38, 112, 101, 114, 109, 105, 108, 59, 8, 226, 128, 176, 11, 
+38, 101, 109, 115, 112, 59, 8, 226, 128, 131, 13, 38, 102, 114, 97, 99, 
+49, 50, 59, 7, 194, 189, 12, 38, 115, 98, 113, 117, 111, 59, 8, 226, 
+128, 154, 13, 38, 102, 114, 97, 99, 49, 52, 59, 7, 194, 188, 12, 38, 
+114, 115, 113, 117, 111, 59, 8, 226, 128, 153, 13, 38, 102, 114, 97, 99, 
+51, 52, 59, 7, 194, 190, 13, 38, 114, 115, 97, 113, 117, 111, 59, 8, 
+226, 128, 186, 9, 38, 103, 101, 59, 8, 226, 137, 165, 12, 38, 114, 100, 
+113, 117, 111, 59, 8, 226, 128, 157, 13, 38, 79, 115, 108, 97, 115, 104, 
+59, 7, 195, 152, 12, 38, 114, 97, 113, 117, 111, 59, 7, 194, 187, 13, 
+38, 111, 103, 114, 97, 118, 101, 59, 7, 195, 178, 12, 38, 108, 115, 113, 
+117, 111, 59, 8, 226, 128, 152, 13, 38, 79, 103, 114, 97, 118, 101, 59, 
+7, 195, 146, 13, 38, 108, 115, 97, 113, 117, 111, 59, 8, 226, 128, 185, 
+12, 38, 111, 101, 108, 105, 103, 59, 7, 197, 147, 12, 38, 108, 100, 113, 
+117, 111, 59, 8, 226, 128, 156, 12, 38, 79, 69, 108, 105, 103, 59, 7, 
+197, 146, 12, 38, 108, 97, 113, 117, 111, 59, 7, 194, 171, 12, 38, 111, 
+99, 105, 114, 99, 59, 7, 195, 180, 12, 38, 98, 100, 113, 117, 111, 59, 
+8, 226, 128, 158, 12, 38, 79, 99, 105, 114, 99, 59, 7, 195, 148, 13, 
+38, 119, 101, 105, 101, 114, 112, 59, 8, 226, 132, 152, 13, 38, 111, 97, 
+99, 117, 116, 101, 59, 7, 195, 179, 12, 38, 116, 114, 97, 100, 101, 59, 
+8, 226, 132, 162, 13, 38, 79, 97, 99, 117, 116, 101, 59, 7, 195, 147, 
+11, 38, 115, 117, 112, 49, 59, 7, 194, 185, 13, 38, 110, 116, 105, 108, 
+100, 101, 59, 7, 195, 177, 10, 38, 115, 104, 121, 59, 7, 194, 173, 13, 
+38, 78, 116, 105, 108, 100, 101, 59, 7, 195, 145, 11, 38, 115, 101, 99, 
+116, 59, 7, 194, 167, 10, 38, 114, 108, 109, 59, 5, 9, 38, 108, 101, 
+59, 8, 226, 137, 164, 10, 38, 114, 101, 103, 59, 7, 194, 174, 12, 38, 
+109, 105, 110, 117, 115, 59, 8, 226, 136, 146, 11, 38, 114, 101, 97, 108, 
+59, 8, 226, 132, 156, 11, 38, 115, 117, 112, 50, 59, 7, 194, 178, 13, 
+38, 73, 103, 114, 97, 118, 101, 59, 7, 195, 140, 11, 38, 115, 117, 112, 
+51, 59, 7, 194, 179, 12, 38, 105, 99, 105, 114, 99, 59, 7, 195, 174, 
+12, 38, 116, 105, 109, 101, 115, 59, 7, 195, 151, 12, 38, 73, 99, 105, 
+114, 99, 59, 7, 195, 142, 14, 38, 97, 108, 101, 102, 115, 121, 109, 59, 
+8, 226, 132, 181, 13, 38, 105, 97, 99, 117, 116, 101, 59, 7, 195, 173, 
+10, 38, 97, 110, 100, 59, 8, 226, 136, 167, 13, 38, 73, 97, 99, 117, 
+116, 101, 59, 7, 195, 141, 10, 38, 97, 110, 103, 59, 8, 226, 136, 160, 
+11, 38, 101, 117, 109, 108, 59, 7, 195, 171, 12, 38, 97, 115, 121, 109, 
+112, 59, 8, 226, 137, 136, 11, 38, 69, 117, 109, 108, 59, 7, 195, 139, 
+10, 38, 99, 97, 112, 59, 8, 226, 136, 169, 10, 38, 101, 116, 104, 59, 
+7, 195, 176, 11, 38, 99, 111, 110, 103, 59, 8, 226, 137, 133, 10, 38, 
+69, 84, 72, 59, 7, 195, 144, 10, 38, 99, 117, 112, 59, 8, 226, 136, 
+170, 13, 38, 101, 103, 114, 97, 118, 101, 59, 7, 195, 168, 10, 38, 108, 
+114, 109, 59, 5, 13, 38, 69, 103, 114, 97, 118, 101, 59, 7, 195, 136, 
+13, 38, 105, 113, 117, 101, 115, 116, 59, 7, 194, 191, 12, 38, 101, 99, 
+105, 114, 99, 59, 7, 195, 170, 12, 38, 105, 109, 97, 103, 101, 59, 8, 
+226, 132, 145, 12, 38, 69, 99, 105, 114, 99, 59, 7, 195, 138, 12, 38, 
+105, 101, 120, 99, 108, 59, 7, 194, 161, 13, 38, 101, 97, 99, 117, 116, 
+101, 59, 7, 195, 169, 13, 38, 104, 101, 108, 108, 105, 112, 59, 8, 226, 
+128, 166, 13, 38, 69, 97, 99, 117, 116, 101, 59, 7, 195, 137, 12, 38, 
+102, 114, 97, 115, 108, 59, 8, 226, 129, 132, 13, 38, 99, 99, 101, 100, 
+105, 108, 59, 7, 195, 167, 13, 38, 68, 97, 103, 103, 101, 114, 59, 8, 
+226, 128, 161, 13, 38, 67, 99, 101, 100, 105, 108, 59, 7, 195, 135, 13, 
+38, 100, 97, 103, 103, 101, 114, 59, 8, 226, 128, 160, 11, 38, 97, 117, 
+109, 108, 59, 7, 195, 164, 11, 38, 99, 111, 112, 121, 59, 7, 194, 169, 
+11, 38, 65, 117, 109, 108, 59, 7, 195, 132, 11, 38, 98, 117, 108, 108, 
+59, 8, 226, 128, 162, 13, 38, 97, 116, 105, 108, 100, 101, 59, 7, 195, 
+163, 13, 38, 98, 114, 118, 98, 97, 114, 59, 7, 194, 166, 13, 38, 65, 
+116, 105, 108, 100, 101, 59, 7, 195, 131, 10, 38, 121, 101, 110, 59, 7, 
+194, 165, 12, 38, 97, 114, 105, 110, 103, 59, 7, 195, 165, 12, 38, 112, 
+111, 117, 110, 100, 59, 7, 194, 163, 12, 38, 65, 114, 105, 110, 103, 59, 
+7, 195, 133, 11, 38, 101, 117, 114, 111, 59, 8, 226, 130, 172, 13, 38, 
+97, 103, 114, 97, 118, 101, 59, 7, 195, 160, 13, 38, 99, 117, 114, 114, 
+101, 110, 59, 7, 194, 164, 13, 38, 65, 103, 114, 97, 118, 101, 59, 7, 
+195, 128, 11, 38, 99, 101, 110, 116, 59, 7, 194, 162, 12, 38, 97, 101, 
+108, 105, 103, 59, 7, 195, 166, 11, 38, 89, 117, 109, 108, 59, 7, 197, 
+184, 12, 38, 65, 69, 108, 105, 103, 59, 7, 195, 134, 11, 38, 121, 117, 
+109, 108, 59, 7, 195, 191, 12, 38, 97, 99, 105, 114, 99, 59, 7, 195, 
+162, 13, 38, 121, 97, 99, 117, 116, 101, 59, 7, 195, 189, 12, 38, 65, 
+99, 105, 114, 99, 59, 7, 195, 130, 13, 38, 89, 97, 99, 117, 116, 101, 
+59, 7, 195, 157, 13, 38, 97, 97, 99, 117, 116, 101, 59, 7, 195, 161, 
+11, 38, 117, 117, 109, 108, 59, 7, 195, 188, 13, 38, 65, 97, 99, 117, 
+116, 101, 59, 7, 195, 129, 11, 38, 85, 117, 109, 108, 59, 7, 195, 156, 
+10, 38, 117, 109, 108, 59, 7, 194, 168, 13, 38, 117, 103, 114, 97, 118, 
+101, 59, 7, 195, 185, 12, 38, 116, 105, 108, 100, 101, 59, 7, 203, 156, 
+13, 38, 85, 103, 114, 97, 118, 101, 59, 7, 195, 153, 13, 38, 109, 105, 
+100, 100, 111, 116, 59, 7, 194, 183, 12, 38, 117, 99, 105, 114, 99, 59, 
+7, 195, 187, 11, 38, 109, 97, 99, 114, 59, 7, 194, 175, 12, 38, 85, 
+99, 105, 114, 99, 59, 7, 195, 155, 11, 38, 99, 105, 114, 99, 59, 7, 
+203, 134, 13, 38, 117, 97, 99, 117, 116, 101, 59, 7, 195, 186, 12, 38, 
+99, 101, 100, 105, 108, 59, 7, 194, 184, 13, 38, 85, 97, 99, 117, 116, 
+101, 59, 7, 195, 154, 12, 38, 97, 99, 117, 116, 101, 59, 7, 194, 180, 
+12, 38, 116, 104, 111, 114, 110, 59, 7, 195, 190, 11, 38, 113, 117, 111, 
+116, 59, 6, 34, 12, 38, 84, 72, 79, 82, 78, 59, 7, 195, 158, 9, 
+38, 108, 116, 59, 6, 60, 12, 38, 115, 122, 108, 105, 103, 59, 7, 195, 
+159, 9, 38, 103, 116, 59, 6, 62, 13, 38, 115, 99, 97, 114, 111, 110, 
+59, 7, 197, 161, 10, 38, 97, 109, 112, 59, 6, 38, 13, 38, 83, 99, 
+97, 114, 111, 110, 59, 7, 197, 160, 12, 38, 101, 109, 112, 116, 121, 59, 
+8, 226, 136, 133, 11, 38, 111, 117, 109, 108, 59, 7, 195, 182, 12, 38, 
+101, 113, 117, 105, 118, 59, 8, 226, 137, 161, 11, 38, 79, 117, 109, 108, 
+59, 7, 195, 150, 12, 38, 101, 120, 105, 115, 116, 59, 8, 226, 136, 131, 
+13, 38, 111, 116, 105, 108, 100, 101, 59, 7, 195, 181, 11, 38, 105, 117, 
+109, 108, 59, 7, 195, 175, 13, 38, 79, 116, 105, 108, 100, 101, 59, 7, 
+195, 149, 13, 38, 105, 103, 114, 97, 118, 101, 59, 7, 195, 172, 13, 38, 
+111, 115, 108, 97, 115, 104, 59, 7, 195, 184, 11, 38, 112, 97, 114, 97, 
+59, 7, 194, 182, 13, 38, 108, 97, 109, 98, 100, 97, 59, 7, 206, 187, 
+9, 38, 77, 117, 59, 7, 206, 156, 13, 38, 76, 97, 109, 98, 100, 97, 
+59, 7, 206, 155, 9, 38, 109, 117, 59, 7, 206, 188, 12, 38, 107, 97, 
+112, 112, 97, 59, 7, 206, 186, 9, 38, 78, 117, 59, 7, 206, 157, 12, 
+38, 75, 97, 112, 112, 97, 59, 7, 206, 154, 9, 38, 110, 117, 59, 7, 
+206, 189, 11, 38, 105, 111, 116, 97, 59, 7, 206, 185, 12, 38, 79, 109, 
+101, 103, 97, 59, 7, 206, 169, 11, 38, 73, 111, 116, 97, 59, 7, 206, 
+153, 12, 38, 111, 109, 101, 103, 97, 59, 7, 207, 137, 12, 38, 103, 97, 
+109, 109, 97, 59, 7, 206, 179, 14, 38, 79, 109, 105, 99, 114, 111, 110, 
+59, 7, 206, 159, 12, 38, 71, 97, 109, 109, 97, 59, 7, 206, 147, 14, 
+38, 111, 109, 105, 99, 114, 111, 110, 59, 7, 206, 191, 10, 38, 101, 116, 
+97, 59, 7, 206, 183, 10, 38, 80, 104, 105, 59, 7, 206, 166, 10, 38, 
+69, 116, 97, 59, 7, 206, 151, 10, 38, 112, 104, 105, 59, 7, 207, 134, 
+14, 38, 101, 112, 115, 105, 108, 111, 110, 59, 7, 206, 181, 9, 38, 80, 
+105, 59, 7, 206, 160, 14, 38, 69, 112, 115, 105, 108, 111, 110, 59, 7, 
+206, 149, 9, 38, 112, 105, 59, 7, 207, 128, 12, 38, 100, 101, 108, 116, 
+97, 59, 7, 206, 180, 10, 38, 112, 105, 118, 59, 7, 207, 150, 12, 38, 
+68, 101, 108, 116, 97, 59, 7, 206, 148, 10, 38, 80, 115, 105, 59, 7, 
+206, 168, 10, 38, 99, 104, 105, 59, 7, 207, 135, 10, 38, 112, 115, 105, 
+59, 7, 207, 136, 10, 38, 67, 104, 105, 59, 7, 206, 167, 10, 38, 82, 
+104, 111, 59, 7, 206, 161, 11, 38, 98, 101, 116, 97, 59, 7, 206, 178, 
+10, 38, 114, 104, 111, 59, 7, 207, 129, 11, 38, 66, 101, 116, 97, 59, 
+7, 206, 146, 12, 38, 83, 105, 103, 109, 97, 59, 7, 206, 163, 12, 38, 
+97, 108, 112, 104, 97, 59, 7, 206, 177, 12, 38, 115, 105, 103, 109, 97, 
+59, 7, 207, 131, 12, 38, 65, 108, 112, 104, 97, 59, 7, 206, 145, 13, 
+38, 115, 105, 103, 109, 97, 102, 59, 7, 207, 130, 13, 38, 116, 104, 101, 
+114, 101, 52, 59, 8, 226, 136, 180, 10, 38, 84, 97, 117, 59, 7, 206, 
+164, 11, 38, 115, 117, 112, 101, 59, 8, 226, 138, 135, 10, 38, 116, 97, 
+117, 59, 7, 207, 132, 10, 38, 115, 117, 112, 59, 8, 226, 138, 131, 12, 
+38, 84, 104, 101, 116, 97, 59, 7, 206, 152, 10, 38, 115, 117, 109, 59, 
+8, 226, 136, 145, 12, 38, 116, 104, 101, 116, 97, 59, 7, 206, 184, 11, 
+38, 115, 117, 98, 101, 59, 8, 226, 138, 134, 15, 38, 116, 104, 101, 116, 
+97, 115, 121, 109, 59, 7, 207, 145, 10, 38, 115, 117, 98, 59, 8, 226, 
+138, 130, 12, 38, 117, 112, 115, 105, 104, 59, 7, 207, 146, 10, 38, 115, 
+105, 109, 59, 8, 226, 136, 188, 14, 38, 85, 112, 115, 105, 108, 111, 110, 
+59, 7, 206, 165, 11, 38, 115, 100, 111, 116, 59, 8, 226, 139, 133, 14, 
+38, 117, 112, 115, 105, 108, 111, 110, 59, 7, 207, 133, 13, 38, 114, 102, 
+108, 111, 111, 114, 59, 8, 226, 140, 139, 9, 38, 88, 105, 59, 7, 206, 
+158, 12, 38, 114, 99, 101, 105, 108, 59, 8, 226, 140, 137, 9, 38, 120, 
+105, 59, 7, 206, 190, 11, 38, 114, 97, 110, 103, 59, 8, 226, 140, 170, 
+11, 38, 90, 101, 116, 97, 59, 7, 206, 150, 12, 38, 114, 97, 100, 105, 
+99, 59, 8, 226, 136, 154, 11, 38, 122, 101, 116, 97, 59, 7, 206, 182, 
+11, 38, 112, 114, 111, 112, 59, 8, 226, 136, 157, 12, 38, 99, 114, 97, 
+114, 114, 59, 8, 226, 134, 181, 11, 38, 112, 114, 111, 100, 59, 8, 226, 
+136, 143, 11, 38, 100, 97, 114, 114, 59, 8, 226, 134, 147, 13, 38, 112, 
+108, 117, 115, 109, 110, 59, 7, 194, 177, 11, 38, 100, 65, 114, 114, 59, 
+8, 226, 135, 147, 11, 38, 112, 101, 114, 112, 59, 8, 226, 138, 165, 11, 
+38, 104, 97, 114, 114, 59, 8, 226, 134, 148, 11, 38, 112, 97, 114, 116, 
+59, 8, 226, 136, 130, 11, 38, 104, 65, 114, 114, 59, 8, 226, 135, 148, 
+13, 38, 111, 116, 105, 109, 101, 115, 59, 8, 226, 138, 151, 11, 38, 108, 
+97, 114, 114, 59, 8, 226, 134, 144, 9, 38, 111, 114, 59, 8, 226, 136, 
+168, 11, 38, 108, 65, 114, 114, 59, 8, 226, 135, 144, 12, 38, 111, 112, 
+108, 117, 115, 59, 8, 226, 138, 149, 11, 38, 114, 97, 114, 114, 59, 8, 
+226, 134, 146, 11, 38, 110, 115, 117, 98, 59, 8, 226, 138, 132, 11, 38, 
+114, 65, 114, 114, 59, 8, 226, 135, 146, 12, 38, 110, 111, 116, 105, 110, 
+59, 8, 226, 136, 137, 11, 38, 117, 97, 114, 114, 59, 8, 226, 134, 145, 
+9, 38, 110, 105, 59, 8, 226, 136, 139, 11, 38, 117, 65, 114, 114, 59, 
+8, 226, 135, 145, 9, 38, 110, 101, 59, 8, 226, 137, 160, 12, 38, 99, 
+108, 117, 98, 115, 59, 8, 226, 153, 163, 12, 38, 110, 97, 98, 108, 97, 
+59, 8, 226, 136, 135, 12, 38, 100, 105, 97, 109, 115, 59, 8, 226, 153, 
+166, 12, 38, 109, 105, 99, 114, 111, 59, 7, 194, 181, 13, 38, 104, 101, 
+97, 114, 116, 115, 59, 8, 226, 153, 165, 13, 38, 108, 111, 119, 97, 115, 
+116, 59, 8, 226, 136, 151, 13, 38, 115, 112, 97, 100, 101, 115, 59, 8, 
+226, 153, 160, 13, 38, 108, 102, 108, 111, 111, 114, 59, 8, 226, 140, 138, 
+10, 38, 108, 111, 122, 59, 8, 226, 151, 138, 12, 38, 108, 99, 101, 105, 
+108, 59, 8, 226, 140, 136, 11, 38, 108, 97, 110, 103, 59, 8, 226, 140, 
+169, 11, 38, 105, 115, 105, 110, 59, 8, 226, 136, 136, 10, 38, 105, 110, 
+116, 59, 8, 226, 136, 171, 9, 102, 105, 110, 100, 11, 115, 116, 114, 105, 
+110, 103, 12, 119, 114, 105, 116, 101, 117, 56, 7, 119, 103, 0, 
+};
+
+/* This is src/lua/margin.lua */
+static const char file_14[] = {
+27, 76, 74, 2, 10, 82, 0, 1, 4, 0, 4, 0, 7, 54, 1, 0, 
+0, 41, 2, 0, 0, 61, 2, 1, 1, 54, 1, 2, 0, 39, 3, 3, 
+0, 66, 1, 2, 1, 75, 0, 1, 0, 19, 72, 105, 100, 105, 110, 103, 
+32, 109, 97, 114, 103, 105, 110, 46, 20, 78, 111, 110, 109, 111, 100, 97, 
+108, 77, 101, 115, 115, 97, 103, 101, 11, 109, 97, 114, 103, 105, 110, 13, 
+68, 111, 99, 117, 109, 101, 110, 116, 15, 0, 3, 4, 0, 0, 0, 2, 
+43, 3, 0, 0, 76, 3, 2, 0, 194, 1, 0, 1, 10, 1, 8, 1, 
+21, 41, 1, 0, 0, 54, 2, 0, 0, 54, 4, 1, 0, 57, 4, 2, 
+4, 66, 2, 2, 4, 72, 5, 6, 128, 45, 7, 0, 0, 57, 9, 3, 
+6, 66, 7, 2, 2, 1, 1, 7, 0, 88, 8, 1, 128, 18, 1, 7, 
+0, 70, 5, 3, 3, 82, 5, 248, 127, 54, 2, 4, 0, 22, 3, 0, 
+1, 61, 3, 5, 2, 54, 2, 6, 0, 39, 4, 7, 0, 66, 2, 2, 
+1, 75, 0, 1, 0, 1, 192, 42, 77, 97, 114, 103, 105, 110, 32, 110, 
+111, 119, 32, 100, 105, 115, 112, 108, 97, 121, 115, 32, 112, 97, 114, 97, 
+103, 114, 97, 112, 104, 32, 115, 116, 121, 108, 101, 115, 46, 20, 78, 111, 
+110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 11, 109, 97, 
+114, 103, 105, 110, 13, 68, 111, 99, 117, 109, 101, 110, 116, 9, 110, 97, 
+109, 101, 11, 115, 116, 121, 108, 101, 115, 16, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 10, 112, 97, 105, 114, 115, 2, 30, 0, 3, 4, 
+0, 2, 0, 3, 57, 3, 0, 2, 57, 3, 1, 3, 76, 3, 2, 0, 
+9, 110, 97, 109, 101, 10, 115, 116, 121, 108, 101, 81, 0, 0, 6, 1, 
+4, 1, 11, 54, 0, 0, 0, 45, 1, 0, 0, 54, 3, 2, 0, 57, 
+3, 3, 3, 54, 5, 0, 0, 21, 5, 5, 0, 66, 3, 2, 0, 65, 
+1, 0, 2, 22, 1, 0, 1, 61, 1, 1, 0, 75, 0, 1, 0, 0, 
+0, 10, 108, 111, 103, 49, 48, 9, 109, 97, 116, 104, 11, 109, 97, 114, 
+103, 105, 110, 13, 68, 111, 99, 117, 109, 101, 110, 116, 6, 154, 1, 1, 
+1, 6, 1, 7, 0, 13, 51, 1, 0, 0, 54, 2, 2, 0, 54, 4, 
+3, 0, 57, 4, 4, 4, 18, 5, 1, 0, 66, 2, 3, 2, 61, 2, 
+1, 0, 18, 2, 1, 0, 66, 2, 1, 1, 54, 2, 5, 0, 39, 4, 
+6, 0, 66, 2, 2, 1, 75, 0, 1, 0, 0, 192, 43, 77, 97, 114, 
+103, 105, 110, 32, 110, 111, 119, 32, 100, 105, 115, 112, 108, 97, 121, 115, 
+32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 32, 110, 117, 109, 98, 101, 
+114, 115, 46, 20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 
+97, 103, 101, 12, 67, 104, 97, 110, 103, 101, 100, 10, 69, 118, 101, 110, 
+116, 21, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 
+101, 114, 10, 116, 111, 107, 101, 110, 0, 57, 0, 1, 4, 0, 2, 0, 
+6, 54, 1, 0, 0, 57, 3, 1, 0, 66, 1, 2, 1, 43, 1, 0, 
+0, 61, 1, 1, 0, 75, 0, 1, 0, 10, 116, 111, 107, 101, 110, 24, 
+82, 101, 109, 111, 118, 101, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 
+110, 101, 114, 28, 0, 3, 6, 0, 1, 0, 3, 54, 3, 0, 0, 18, 
+5, 1, 0, 68, 3, 2, 0, 13, 116, 111, 115, 116, 114, 105, 110, 103, 
+100, 0, 1, 4, 0, 4, 0, 7, 54, 1, 0, 0, 41, 2, 5, 0, 
+61, 2, 1, 1, 54, 1, 2, 0, 39, 3, 3, 0, 66, 1, 2, 1, 
+75, 0, 1, 0, 37, 77, 97, 114, 103, 105, 110, 32, 110, 111, 119, 32, 
+100, 105, 115, 112, 108, 97, 121, 115, 32, 119, 111, 114, 100, 32, 99, 111, 
+117, 110, 116, 115, 46, 20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 
+115, 115, 97, 103, 101, 11, 109, 97, 114, 103, 105, 110, 13, 68, 111, 99, 
+117, 109, 101, 110, 116, 28, 0, 3, 6, 0, 1, 0, 3, 54, 3, 0, 
+0, 21, 5, 2, 0, 68, 3, 2, 0, 13, 116, 111, 115, 116, 114, 105, 
+110, 103, 204, 1, 0, 1, 5, 0, 8, 0, 29, 54, 1, 0, 0, 54, 
+2, 1, 0, 57, 2, 2, 2, 56, 1, 2, 1, 57, 2, 3, 1, 15, 
+0, 2, 0, 88, 3, 3, 128, 18, 4, 1, 0, 57, 2, 3, 1, 66, 
+2, 2, 1, 54, 2, 1, 0, 61, 0, 2, 2, 54, 2, 0, 0, 54, 
+3, 1, 0, 57, 3, 2, 3, 56, 1, 3, 2, 57, 2, 4, 1, 15, 
+0, 2, 0, 88, 3, 3, 128, 18, 4, 1, 0, 57, 2, 4, 1, 66, 
+2, 2, 1, 54, 2, 5, 0, 18, 4, 2, 0, 57, 2, 6, 2, 66, 
+2, 2, 1, 54, 2, 7, 0, 66, 2, 1, 1, 75, 0, 1, 0, 17, 
+82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 10, 116, 111, 117, 
+99, 104, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 11, 97, 
+116, 116, 97, 99, 104, 11, 100, 101, 116, 97, 99, 104, 13, 118, 105, 101, 
+119, 109, 111, 100, 101, 13, 68, 111, 99, 117, 109, 101, 110, 116, 22, 77, 
+97, 114, 103, 105, 110, 67, 111, 110, 116, 114, 111, 108, 108, 101, 114, 115, 
+61, 0, 1, 4, 0, 2, 0, 7, 54, 1, 0, 0, 18, 3, 0, 0, 
+66, 1, 2, 1, 54, 1, 1, 0, 66, 1, 1, 1, 43, 1, 2, 0, 
+76, 1, 2, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 
+18, 83, 101, 116, 77, 97, 114, 103, 105, 110, 77, 111, 100, 101, 248, 2, 
+3, 0, 8, 0, 26, 0, 39, 54, 0, 0, 0, 57, 0, 1, 0, 54, 
+1, 2, 0, 57, 1, 3, 1, 53, 2, 5, 0, 51, 3, 4, 0, 61, 
+3, 6, 2, 51, 3, 7, 0, 61, 3, 8, 2, 53, 3, 10, 0, 51, 
+4, 9, 0, 61, 4, 6, 3, 51, 4, 11, 0, 61, 4, 8, 3, 53, 
+4, 13, 0, 51, 5, 12, 0, 61, 5, 6, 4, 51, 5, 14, 0, 61, 
+5, 15, 4, 51, 5, 16, 0, 61, 5, 8, 4, 53, 5, 18, 0, 51, 
+6, 17, 0, 61, 6, 6, 5, 51, 6, 19, 0, 61, 6, 8, 5, 52, 
+6, 0, 16, 62, 2, 1, 6, 62, 3, 2, 6, 62, 4, 3, 6, 62, 
+5, 4, 6, 55, 6, 20, 0, 51, 6, 21, 0, 55, 6, 22, 0, 54, 
+6, 23, 0, 51, 7, 25, 0, 61, 7, 24, 6, 50, 0, 0, 128, 75, 
+0, 1, 0, 0, 16, 83, 101, 116, 86, 105, 101, 119, 77, 111, 100, 101, 
+8, 67, 109, 100, 18, 83, 101, 116, 77, 97, 114, 103, 105, 110, 77, 111, 
+100, 101, 0, 22, 77, 97, 114, 103, 105, 110, 67, 111, 110, 116, 114, 111, 
+108, 108, 101, 114, 115, 0, 1, 0, 2, 15, 103, 101, 116, 99, 111, 110, 
+116, 101, 110, 116, 0, 11, 97, 116, 116, 97, 99, 104, 0, 0, 0, 11, 
+100, 101, 116, 97, 99, 104, 0, 1, 0, 3, 15, 103, 101, 116, 99, 111, 
+110, 116, 101, 110, 116, 0, 11, 97, 116, 116, 97, 99, 104, 0, 11, 100, 
+101, 116, 97, 99, 104, 0, 0, 0, 1, 0, 2, 15, 103, 101, 116, 99, 
+111, 110, 116, 101, 110, 116, 0, 11, 97, 116, 116, 97, 99, 104, 0, 0, 
+15, 103, 101, 116, 99, 111, 110, 116, 101, 110, 116, 0, 11, 97, 116, 116, 
+97, 99, 104, 1, 0, 2, 15, 103, 101, 116, 99, 111, 110, 116, 101, 110, 
+116, 0, 11, 97, 116, 116, 97, 99, 104, 0, 0, 19, 103, 101, 116, 115, 
+116, 114, 105, 110, 103, 119, 105, 100, 116, 104, 7, 119, 103, 10, 102, 108, 
+111, 111, 114, 9, 109, 97, 116, 104, 0, 
+};
+
+/* This is src/lua/fileio.lua */
+static const char file_15[] = {
+27, 76, 74, 2, 10, 193, 6, 0, 1, 11, 16, 15, 1, 169, 1, 45, 
+1, 0, 0, 56, 1, 0, 1, 15, 0, 1, 0, 88, 2, 8, 128, 45, 
+1, 1, 0, 45, 3, 2, 0, 66, 1, 2, 1, 45, 1, 1, 0, 45, 
+3, 0, 0, 56, 3, 0, 3, 66, 1, 2, 1, 75, 0, 1, 0, 45, 
+1, 0, 0, 45, 2, 3, 0, 60, 2, 0, 1, 45, 1, 3, 0, 22, 
+1, 0, 1, 46, 3, 1, 0, 54, 1, 0, 0, 18, 3, 0, 0, 66, 
+1, 2, 2, 7, 1, 1, 0, 88, 1, 86, 128, 54, 1, 2, 0, 18, 
+3, 0, 0, 66, 1, 2, 2, 15, 0, 1, 0, 88, 2, 14, 128, 45, 
+2, 4, 0, 57, 3, 3, 1, 56, 1, 3, 2, 14, 0, 1, 0, 88, 
+2, 10, 128, 54, 2, 2, 0, 18, 4, 0, 0, 66, 2, 2, 2, 18, 
+4, 2, 0, 57, 2, 4, 2, 66, 2, 2, 2, 18, 0, 2, 0, 45, 
+1, 5, 0, 88, 2, 1, 128, 45, 1, 5, 0, 45, 2, 6, 0, 5, 
+1, 2, 0, 88, 2, 7, 128, 45, 2, 1, 0, 45, 4, 7, 0, 66, 
+2, 2, 1, 45, 2, 8, 0, 18, 4, 0, 0, 66, 2, 2, 1, 88, 
+2, 115, 128, 45, 2, 1, 0, 18, 4, 1, 0, 66, 2, 2, 1, 45, 
+2, 1, 0, 21, 4, 0, 0, 66, 2, 2, 1, 54, 2, 5, 0, 18, 
+4, 0, 0, 66, 2, 2, 4, 88, 5, 3, 128, 45, 7, 8, 0, 18, 
+9, 6, 0, 66, 7, 2, 1, 69, 5, 3, 3, 82, 5, 251, 127, 52, 
+2, 0, 0, 54, 3, 6, 0, 18, 5, 0, 0, 66, 3, 2, 4, 72, 
+6, 14, 128, 54, 7, 0, 0, 18, 9, 6, 0, 66, 7, 2, 2, 6, 
+7, 7, 0, 88, 7, 9, 128, 18, 9, 6, 0, 57, 7, 8, 6, 39, 
+10, 9, 0, 66, 7, 3, 2, 14, 0, 7, 0, 88, 7, 3, 128, 21, 
+7, 2, 0, 22, 7, 0, 7, 60, 6, 7, 2, 70, 6, 3, 2, 82, 
+6, 240, 127, 54, 3, 1, 0, 57, 3, 10, 3, 18, 5, 2, 0, 66, 
+3, 2, 1, 54, 3, 5, 0, 18, 5, 2, 0, 66, 3, 2, 4, 88, 
+6, 6, 128, 45, 8, 8, 0, 18, 10, 7, 0, 66, 8, 2, 1, 45, 
+8, 8, 0, 56, 10, 7, 0, 66, 8, 2, 1, 69, 6, 3, 3, 82, 
+6, 248, 127, 45, 3, 1, 0, 45, 5, 9, 0, 66, 3, 2, 1, 88, 
+1, 59, 128, 54, 1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 2, 7, 
+1, 11, 0, 88, 1, 10, 128, 15, 0, 0, 0, 88, 1, 4, 128, 45, 
+1, 1, 0, 45, 3, 10, 0, 66, 1, 2, 1, 88, 1, 48, 128, 45, 
+1, 1, 0, 45, 3, 11, 0, 66, 1, 2, 1, 88, 1, 44, 128, 54, 
+1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 2, 7, 1, 12, 0, 88, 
+1, 10, 128, 45, 1, 1, 0, 45, 3, 12, 0, 66, 1, 2, 1, 45, 
+1, 1, 0, 21, 3, 0, 0, 66, 1, 2, 1, 45, 1, 13, 0, 18, 
+3, 0, 0, 66, 1, 2, 1, 88, 1, 29, 128, 54, 1, 0, 0, 18, 
+3, 0, 0, 66, 1, 2, 2, 7, 1, 7, 0, 88, 1, 17, 128, 41, 
+1, 0, 0, 3, 1, 0, 0, 88, 1, 7, 128, 45, 1, 1, 0, 45, 
+3, 14, 0, 66, 1, 2, 1, 45, 1, 1, 0, 18, 3, 0, 0, 66, 
+1, 2, 1, 88, 1, 14, 128, 45, 1, 1, 0, 45, 3, 15, 0, 66, 
+1, 2, 1, 45, 1, 1, 0, 20, 3, 0, 0, 66, 1, 2, 1, 88, 
+1, 7, 128, 54, 1, 13, 0, 39, 3, 14, 0, 54, 4, 0, 0, 18, 
+6, 0, 0, 66, 4, 2, 2, 38, 3, 4, 3, 66, 1, 2, 1, 75, 
+0, 1, 0, 4, 192, 2, 192, 4, 0, 5, 128, 3, 192, 5, 0, 6, 
+0, 7, 0, 6, 192, 8, 0, 9, 0, 10, 0, 11, 0, 1, 192, 12, 
+0, 13, 0, 22, 117, 110, 115, 117, 112, 112, 111, 114, 116, 101, 100, 32, 
+116, 121, 112, 101, 32, 10, 101, 114, 114, 111, 114, 11, 115, 116, 114, 105, 
+110, 103, 12, 98, 111, 111, 108, 101, 97, 110, 9, 115, 111, 114, 116, 7, 
+94, 95, 9, 102, 105, 110, 100, 11, 110, 117, 109, 98, 101, 114, 10, 112, 
+97, 105, 114, 115, 11, 105, 112, 97, 105, 114, 115, 16, 103, 101, 116, 82, 
+97, 119, 65, 114, 114, 97, 121, 12, 95, 95, 105, 110, 100, 101, 120, 17, 
+103, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 10, 116, 97, 98, 
+108, 101, 9, 116, 121, 112, 101, 2, 180, 1, 1, 3, 10, 14, 5, 0, 
+22, 52, 3, 0, 16, 54, 4, 0, 0, 45, 5, 0, 0, 60, 5, 4, 
+3, 54, 4, 1, 0, 45, 5, 1, 0, 60, 5, 4, 3, 54, 4, 2, 
+0, 45, 5, 2, 0, 60, 5, 4, 3, 54, 4, 3, 0, 45, 5, 3, 
+0, 60, 5, 4, 3, 52, 4, 0, 0, 41, 5, 1, 0, 51, 6, 4, 
+0, 18, 7, 6, 0, 18, 9, 0, 0, 66, 7, 2, 1, 43, 7, 2, 
+0, 50, 0, 0, 128, 76, 7, 2, 0, 23, 192, 24, 192, 25, 192, 27, 
+192, 20, 192, 15, 192, 26, 192, 22, 192, 14, 192, 16, 192, 17, 192, 18, 
+192, 19, 192, 21, 192, 0, 14, 77, 101, 110, 117, 67, 108, 97, 115, 115, 
+19, 80, 97, 114, 97, 103, 114, 97, 112, 104, 67, 108, 97, 115, 115, 18, 
+68, 111, 99, 117, 109, 101, 110, 116, 67, 108, 97, 115, 115, 21, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 67, 108, 97, 115, 115, 85, 0, 
+1, 5, 3, 2, 0, 15, 54, 1, 0, 0, 18, 3, 0, 0, 66, 1, 
+2, 2, 7, 1, 1, 0, 88, 1, 5, 128, 45, 1, 0, 0, 45, 3, 
+1, 0, 18, 4, 0, 0, 66, 1, 3, 1, 88, 1, 4, 128, 45, 1, 
+2, 0, 45, 3, 1, 0, 18, 4, 0, 0, 66, 1, 3, 1, 75, 0, 
+1, 0, 6, 192, 4, 128, 5, 192, 11, 110, 117, 109, 98, 101, 114, 9, 
+116, 121, 112, 101, 31, 0, 1, 5, 2, 0, 0, 5, 45, 1, 0, 0, 
+45, 3, 1, 0, 18, 4, 0, 0, 66, 1, 3, 1, 75, 0, 1, 0, 
+6, 192, 4, 128, 156, 3, 1, 2, 18, 4, 14, 0, 83, 54, 2, 0, 
+0, 57, 2, 1, 2, 18, 4, 0, 0, 39, 5, 2, 0, 66, 2, 3, 
+3, 14, 0, 2, 0, 88, 4, 3, 128, 43, 4, 0, 0, 18, 5, 3, 
+0, 50, 0, 71, 128, 18, 6, 2, 0, 57, 4, 3, 2, 66, 4, 2, 
+1, 54, 4, 0, 0, 57, 4, 1, 4, 18, 6, 0, 0, 39, 7, 4, 
+0, 38, 6, 7, 6, 39, 7, 2, 0, 66, 4, 3, 3, 18, 3, 5, 
+0, 18, 2, 4, 0, 14, 0, 2, 0, 88, 4, 3, 128, 43, 4, 0, 
+0, 18, 5, 3, 0, 50, 0, 55, 128, 45, 4, 0, 0, 66, 4, 1, 
+2, 57, 5, 5, 4, 57, 6, 6, 4, 51, 7, 7, 0, 51, 8, 8, 
+0, 45, 9, 1, 0, 18, 11, 1, 0, 18, 12, 7, 0, 18, 13, 8, 
+0, 66, 9, 4, 2, 45, 10, 2, 0, 18, 12, 4, 0, 66, 10, 2, 
+2, 43, 4, 0, 0, 43, 11, 0, 0, 15, 0, 9, 0, 88, 12, 8, 
+128, 18, 14, 2, 0, 57, 12, 9, 2, 45, 15, 3, 0, 39, 16, 10, 
+0, 18, 17, 10, 0, 66, 12, 5, 3, 18, 11, 13, 0, 18, 9, 12, 
+0, 15, 0, 9, 0, 88, 12, 5, 128, 18, 14, 2, 0, 57, 12, 3, 
+2, 66, 12, 2, 3, 18, 11, 13, 0, 18, 9, 12, 0, 15, 0, 9, 
+0, 88, 12, 15, 128, 54, 12, 11, 0, 57, 12, 12, 12, 18, 14, 0, 
+0, 39, 15, 4, 0, 38, 14, 15, 14, 18, 15, 0, 0, 66, 12, 3, 
+3, 18, 11, 13, 0, 18, 9, 12, 0, 54, 12, 11, 0, 57, 12, 13, 
+12, 18, 14, 0, 0, 39, 15, 4, 0, 38, 14, 15, 14, 66, 12, 2, 
+1, 18, 12, 9, 0, 18, 13, 11, 0, 50, 0, 0, 128, 74, 12, 3, 
+0, 74, 4, 3, 0, 74, 4, 3, 0, 9, 192, 28, 192, 6, 192, 13, 
+192, 11, 114, 101, 109, 111, 118, 101, 11, 114, 101, 110, 97, 109, 101, 7, 
+111, 115, 6, 10, 10, 119, 114, 105, 116, 101, 0, 0, 13, 97, 112, 112, 
+101, 110, 100, 117, 56, 11, 97, 112, 112, 101, 110, 100, 9, 46, 110, 101, 
+119, 10, 99, 108, 111, 115, 101, 7, 119, 98, 9, 111, 112, 101, 110, 7, 
+105, 111, 70, 0, 1, 5, 0, 3, 0, 8, 54, 1, 0, 0, 18, 3, 
+1, 0, 57, 1, 1, 1, 66, 1, 2, 1, 54, 1, 2, 0, 18, 3, 
+0, 0, 54, 4, 0, 0, 68, 1, 3, 0, 17, 83, 97, 118, 101, 84, 
+111, 83, 116, 114, 101, 97, 109, 10, 112, 117, 114, 103, 101, 16, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 155, 3, 0, 1, 8, 0, 17, 
+0, 47, 14, 0, 0, 0, 88, 1, 19, 128, 54, 1, 0, 0, 39, 3, 
+1, 0, 39, 4, 2, 0, 43, 5, 2, 0, 66, 1, 4, 2, 18, 0, 
+1, 0, 14, 0, 0, 0, 88, 1, 2, 128, 43, 1, 1, 0, 76, 1, 
+2, 0, 18, 3, 0, 0, 57, 1, 3, 0, 39, 4, 4, 0, 66, 1, 
+3, 2, 15, 0, 1, 0, 88, 2, 3, 128, 18, 1, 0, 0, 39, 2, 
+5, 0, 38, 0, 2, 1, 54, 1, 6, 0, 61, 0, 7, 1, 54, 1, 
+8, 0, 39, 3, 9, 0, 66, 1, 2, 1, 54, 1, 6, 0, 18, 3, 
+1, 0, 57, 1, 10, 1, 66, 1, 2, 1, 54, 1, 11, 0, 54, 3, 
+6, 0, 57, 3, 7, 3, 66, 1, 2, 3, 14, 0, 1, 0, 88, 3, 
+7, 128, 54, 3, 12, 0, 39, 5, 13, 0, 39, 6, 14, 0, 18, 7, 
+2, 0, 38, 6, 7, 6, 66, 3, 3, 1, 88, 3, 3, 128, 54, 3, 
+15, 0, 39, 5, 16, 0, 66, 3, 2, 1, 76, 1, 2, 0, 20, 83, 
+97, 118, 101, 32, 115, 117, 99, 99, 101, 101, 100, 101, 100, 46, 20, 78, 
+111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 38, 84, 
+104, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 99, 111, 117, 108, 
+100, 32, 110, 111, 116, 32, 98, 101, 32, 115, 97, 118, 101, 100, 58, 32, 
+16, 83, 97, 118, 101, 32, 102, 97, 105, 108, 101, 100, 17, 77, 111, 100, 
+97, 108, 77, 101, 115, 115, 97, 103, 101, 23, 83, 97, 118, 101, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 82, 97, 119, 10, 99, 108, 101, 
+97, 110, 14, 83, 97, 118, 105, 110, 103, 46, 46, 46, 21, 73, 109, 109, 
+101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 9, 110, 97, 
+109, 101, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 8, 46, 
+119, 103, 12, 47, 91, 94, 46, 93, 42, 36, 9, 102, 105, 110, 100, 13, 
+83, 97, 118, 101, 32, 97, 115, 58, 22, 83, 97, 118, 101, 32, 68, 111, 
+99, 117, 109, 101, 110, 116, 32, 83, 101, 116, 16, 70, 105, 108, 101, 66, 
+114, 111, 119, 115, 101, 114, 222, 1, 0, 0, 6, 0, 10, 0, 29, 54, 
+0, 0, 0, 57, 0, 1, 0, 14, 0, 0, 0, 88, 1, 21, 128, 54, 
+1, 2, 0, 39, 3, 3, 0, 39, 4, 4, 0, 43, 5, 2, 0, 66, 
+1, 4, 2, 18, 0, 1, 0, 14, 0, 0, 0, 88, 1, 2, 128, 43, 
+1, 1, 0, 76, 1, 2, 0, 18, 3, 0, 0, 57, 1, 5, 0, 39, 
+4, 6, 0, 66, 1, 3, 2, 15, 0, 1, 0, 88, 2, 3, 128, 18, 
+1, 0, 0, 39, 2, 7, 0, 38, 0, 2, 1, 54, 1, 0, 0, 61, 
+0, 1, 1, 54, 1, 8, 0, 57, 1, 9, 1, 18, 3, 0, 0, 68, 
+1, 2, 0, 26, 83, 97, 118, 101, 67, 117, 114, 114, 101, 110, 116, 68, 
+111, 99, 117, 109, 101, 110, 116, 65, 115, 8, 67, 109, 100, 8, 46, 119, 
+103, 12, 47, 91, 94, 46, 93, 42, 36, 9, 102, 105, 110, 100, 13, 83, 
+97, 118, 101, 32, 97, 115, 58, 22, 83, 97, 118, 101, 32, 68, 111, 99, 
+117, 109, 101, 110, 116, 32, 83, 101, 116, 16, 70, 105, 108, 101, 66, 114, 
+111, 119, 115, 101, 114, 9, 110, 97, 109, 101, 16, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 132, 1, 0, 1, 8, 2, 3, 0, 26, 54, 
+1, 0, 0, 45, 3, 0, 0, 18, 5, 3, 0, 57, 3, 1, 3, 39, 
+6, 2, 0, 66, 3, 3, 0, 65, 1, 0, 2, 41, 2, 1, 0, 18, 
+3, 1, 0, 41, 4, 1, 0, 77, 2, 4, 128, 45, 6, 1, 0, 66, 
+6, 1, 2, 60, 6, 5, 0, 79, 2, 252, 127, 85, 2, 9, 128, 45, 
+2, 1, 0, 66, 2, 1, 2, 14, 0, 2, 0, 88, 3, 1, 128, 88, 
+2, 4, 128, 45, 3, 1, 0, 66, 3, 1, 2, 60, 3, 2, 0, 88, 
+2, 246, 127, 76, 0, 2, 0, 0, 192, 2, 128, 7, 42, 108, 9, 114, 
+101, 97, 100, 13, 116, 111, 110, 117, 109, 98, 101, 114, 122, 0, 0, 6, 
+2, 4, 1, 15, 52, 0, 0, 0, 54, 1, 0, 0, 18, 3, 0, 0, 
+53, 4, 1, 0, 54, 5, 2, 0, 61, 5, 3, 4, 66, 1, 3, 1, 
+45, 1, 0, 0, 45, 2, 0, 0, 21, 2, 2, 0, 22, 2, 0, 2, 
+60, 0, 2, 1, 45, 1, 1, 0, 18, 3, 0, 0, 68, 1, 2, 0, 
+1, 192, 3, 192, 12, 95, 95, 105, 110, 100, 101, 120, 21, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 67, 108, 97, 115, 115, 1, 0, 1, 
+12, 95, 95, 105, 110, 100, 101, 120, 0, 17, 115, 101, 116, 109, 101, 116, 
+97, 116, 97, 98, 108, 101, 2, 119, 0, 0, 6, 2, 4, 1, 15, 52, 
+0, 0, 0, 54, 1, 0, 0, 18, 3, 0, 0, 53, 4, 1, 0, 54, 
+5, 2, 0, 61, 5, 3, 4, 66, 1, 3, 1, 45, 1, 0, 0, 45, 
+2, 0, 0, 21, 2, 2, 0, 22, 2, 0, 2, 60, 0, 2, 1, 45, 
+1, 1, 0, 18, 3, 0, 0, 68, 1, 2, 0, 1, 192, 3, 192, 12, 
+95, 95, 105, 110, 100, 101, 120, 18, 68, 111, 99, 117, 109, 101, 110, 116, 
+67, 108, 97, 115, 115, 1, 0, 1, 12, 95, 95, 105, 110, 100, 101, 120, 
+0, 17, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 2, 120, 
+0, 0, 6, 2, 4, 1, 15, 52, 0, 0, 0, 54, 1, 0, 0, 18, 
+3, 0, 0, 53, 4, 1, 0, 54, 5, 2, 0, 61, 5, 3, 4, 66, 
+1, 3, 1, 45, 1, 0, 0, 45, 2, 0, 0, 21, 2, 2, 0, 22, 
+2, 0, 2, 60, 0, 2, 1, 45, 1, 1, 0, 18, 3, 0, 0, 68, 
+1, 2, 0, 1, 192, 3, 192, 12, 95, 95, 105, 110, 100, 101, 120, 19, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 67, 108, 97, 115, 115, 1, 0, 
+1, 12, 95, 95, 105, 110, 100, 101, 120, 0, 17, 115, 101, 116, 109, 101, 
+116, 97, 116, 97, 98, 108, 101, 2, 77, 0, 0, 5, 2, 1, 1, 15, 
+52, 0, 0, 0, 45, 1, 0, 0, 21, 1, 1, 0, 22, 1, 0, 1, 
+45, 2, 0, 0, 52, 3, 0, 0, 60, 3, 1, 2, 45, 2, 1, 0, 
+18, 4, 0, 0, 66, 2, 2, 1, 45, 2, 0, 0, 57, 3, 0, 0, 
+60, 3, 1, 2, 57, 2, 0, 0, 76, 2, 2, 0, 1, 192, 3, 192, 
+9, 116, 101, 120, 116, 2, 115, 0, 0, 6, 2, 4, 1, 15, 52, 0, 
+0, 0, 54, 1, 0, 0, 18, 3, 0, 0, 53, 4, 1, 0, 54, 5, 
+2, 0, 61, 5, 3, 4, 66, 1, 3, 1, 45, 1, 0, 0, 45, 2, 
+0, 0, 21, 2, 2, 0, 22, 2, 0, 2, 60, 0, 2, 1, 45, 1, 
+1, 0, 18, 3, 0, 0, 68, 1, 2, 0, 1, 192, 3, 192, 12, 95, 
+95, 105, 110, 100, 101, 120, 14, 77, 101, 110, 117, 67, 108, 97, 115, 115, 
+1, 0, 1, 12, 95, 95, 105, 110, 100, 101, 120, 0, 17, 115, 101, 116, 
+109, 101, 116, 97, 116, 97, 98, 108, 101, 2, 48, 0, 0, 4, 2, 0, 
+1, 9, 52, 0, 0, 0, 45, 1, 0, 0, 45, 2, 0, 0, 21, 2, 
+2, 0, 22, 2, 0, 2, 60, 0, 2, 1, 45, 1, 1, 0, 18, 3, 
+0, 0, 68, 1, 2, 0, 1, 192, 3, 192, 2, 64, 0, 0, 4, 2, 
+2, 1, 11, 45, 0, 0, 0, 18, 2, 0, 0, 57, 0, 0, 0, 39, 
+3, 1, 0, 66, 0, 3, 2, 45, 1, 1, 0, 45, 2, 1, 0, 21, 
+2, 2, 0, 22, 2, 0, 2, 60, 0, 2, 1, 76, 0, 2, 0, 0, 
+192, 1, 192, 7, 42, 108, 9, 114, 101, 97, 100, 2, 81, 0, 0, 6, 
+2, 3, 1, 13, 54, 0, 0, 0, 45, 2, 0, 0, 18, 4, 2, 0, 
+57, 2, 1, 2, 39, 5, 2, 0, 66, 2, 3, 0, 65, 0, 0, 2, 
+45, 1, 1, 0, 45, 2, 1, 0, 21, 2, 2, 0, 22, 2, 0, 2, 
+60, 0, 2, 1, 76, 0, 2, 0, 0, 192, 1, 192, 7, 42, 108, 9, 
+114, 101, 97, 100, 13, 116, 111, 110, 117, 109, 98, 101, 114, 2, 86, 0, 
+0, 4, 2, 3, 1, 16, 45, 0, 0, 0, 18, 2, 0, 0, 57, 0, 
+0, 0, 39, 3, 1, 0, 66, 0, 3, 2, 6, 0, 2, 0, 88, 1, 
+2, 128, 43, 0, 1, 0, 88, 1, 1, 128, 43, 0, 2, 0, 45, 1, 
+1, 0, 45, 2, 1, 0, 21, 2, 2, 0, 22, 2, 0, 2, 60, 0, 
+2, 1, 76, 0, 2, 0, 0, 192, 1, 192, 6, 84, 7, 42, 108, 9, 
+114, 101, 97, 100, 2, 15, 0, 0, 1, 0, 0, 0, 2, 43, 0, 0, 
+0, 76, 0, 2, 0, 202, 1, 0, 0, 7, 3, 6, 0, 29, 45, 0, 
+0, 0, 18, 2, 0, 0, 57, 0, 0, 0, 39, 3, 1, 0, 66, 0, 
+3, 2, 14, 0, 0, 0, 88, 1, 3, 128, 54, 1, 2, 0, 39, 3, 
+3, 0, 66, 1, 2, 1, 54, 1, 4, 0, 18, 3, 0, 0, 66, 1, 
+2, 2, 15, 0, 1, 0, 88, 2, 3, 128, 45, 2, 1, 0, 56, 2, 
+1, 2, 76, 2, 2, 0, 45, 2, 2, 0, 56, 2, 0, 2, 14, 0, 
+2, 0, 88, 3, 5, 128, 54, 3, 2, 0, 39, 5, 5, 0, 18, 6, 
+0, 0, 38, 5, 6, 5, 66, 3, 2, 1, 18, 3, 2, 0, 68, 3, 
+1, 0, 0, 192, 1, 192, 4, 192, 21, 99, 97, 110, 39, 116, 32, 108, 
+111, 97, 100, 32, 116, 121, 112, 101, 32, 13, 116, 111, 110, 117, 109, 98, 
+101, 114, 37, 117, 110, 101, 120, 112, 101, 99, 116, 101, 100, 32, 69, 79, 
+70, 32, 119, 104, 101, 110, 32, 114, 101, 97, 100, 105, 110, 103, 32, 102, 
+105, 108, 101, 10, 101, 114, 114, 111, 114, 7, 42, 108, 9, 114, 101, 97, 
+100, 186, 1, 1, 1, 7, 0, 23, 0, 28, 52, 1, 0, 0, 43, 2, 
+0, 0, 51, 3, 0, 0, 53, 4, 2, 0, 51, 5, 1, 0, 61, 5, 
+3, 4, 51, 5, 4, 0, 61, 5, 5, 4, 51, 5, 6, 0, 61, 5, 
+7, 4, 51, 5, 8, 0, 61, 5, 9, 4, 51, 5, 10, 0, 61, 5, 
+11, 4, 51, 5, 12, 0, 61, 5, 13, 4, 51, 5, 14, 0, 61, 5, 
+15, 4, 51, 5, 16, 0, 61, 5, 17, 4, 51, 5, 18, 0, 61, 5, 
+19, 4, 51, 5, 20, 0, 61, 5, 21, 4, 51, 2, 22, 0, 18, 5, 
+2, 0, 50, 0, 0, 128, 68, 5, 1, 0, 0, 6, 46, 0, 6, 66, 
+0, 6, 78, 0, 6, 83, 0, 6, 84, 0, 6, 77, 0, 6, 87, 0, 
+6, 80, 0, 6, 68, 0, 7, 68, 83, 1, 0, 10, 6, 78, 0, 6, 
+83, 0, 6, 84, 0, 6, 77, 0, 6, 87, 0, 6, 80, 0, 6, 68, 
+0, 7, 68, 83, 0, 6, 46, 0, 6, 66, 0, 0, 0, 119, 0, 1, 
+8, 4, 0, 0, 26, 43, 1, 0, 0, 45, 2, 1, 0, 45, 4, 2, 
+0, 45, 5, 0, 0, 66, 2, 3, 3, 46, 0, 3, 0, 18, 1, 2, 
+0, 41, 2, 1, 0, 18, 3, 1, 0, 41, 4, 1, 0, 77, 2, 4, 
+128, 45, 6, 3, 0, 66, 6, 1, 2, 60, 6, 5, 0, 79, 2, 252, 
+127, 85, 2, 9, 128, 45, 2, 3, 0, 66, 2, 1, 2, 14, 0, 2, 
+0, 88, 3, 1, 128, 88, 2, 4, 128, 45, 3, 3, 0, 66, 3, 1, 
+2, 60, 3, 2, 0, 88, 2, 246, 127, 76, 0, 2, 0, 4, 128, 1, 
+0, 3, 192, 2, 128, 55, 0, 0, 5, 4, 0, 0, 10, 43, 0, 0, 
+0, 45, 1, 1, 0, 45, 3, 2, 0, 45, 4, 0, 0, 66, 1, 3, 
+3, 46, 0, 2, 0, 18, 0, 1, 0, 45, 1, 3, 0, 56, 1, 0, 
+1, 76, 1, 2, 0, 4, 128, 1, 0, 3, 192, 1, 192, 122, 0, 0, 
+6, 2, 4, 1, 15, 52, 0, 0, 0, 54, 1, 0, 0, 18, 3, 0, 
+0, 53, 4, 1, 0, 54, 5, 2, 0, 61, 5, 3, 4, 66, 1, 3, 
+1, 45, 1, 0, 0, 45, 2, 0, 0, 21, 2, 2, 0, 22, 2, 0, 
+2, 60, 0, 2, 1, 45, 1, 1, 0, 18, 3, 0, 0, 68, 1, 2, 
+0, 1, 192, 5, 192, 12, 95, 95, 105, 110, 100, 101, 120, 21, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 67, 108, 97, 115, 115, 1, 0, 
+1, 12, 95, 95, 105, 110, 100, 101, 120, 0, 17, 115, 101, 116, 109, 101, 
+116, 97, 116, 97, 98, 108, 101, 2, 119, 0, 0, 6, 2, 4, 1, 15, 
+52, 0, 0, 0, 54, 1, 0, 0, 18, 3, 0, 0, 53, 4, 1, 0, 
+54, 5, 2, 0, 61, 5, 3, 4, 66, 1, 3, 1, 45, 1, 0, 0, 
+45, 2, 0, 0, 21, 2, 2, 0, 22, 2, 0, 2, 60, 0, 2, 1, 
+45, 1, 1, 0, 18, 3, 0, 0, 68, 1, 2, 0, 1, 192, 5, 192, 
+12, 95, 95, 105, 110, 100, 101, 120, 18, 68, 111, 99, 117, 109, 101, 110, 
+116, 67, 108, 97, 115, 115, 1, 0, 1, 12, 95, 95, 105, 110, 100, 101, 
+120, 0, 17, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 2, 
+120, 0, 0, 6, 2, 4, 1, 15, 52, 0, 0, 0, 54, 1, 0, 0, 
+18, 3, 0, 0, 53, 4, 1, 0, 54, 5, 2, 0, 61, 5, 3, 4, 
+66, 1, 3, 1, 45, 1, 0, 0, 45, 2, 0, 0, 21, 2, 2, 0, 
+22, 2, 0, 2, 60, 0, 2, 1, 45, 1, 1, 0, 18, 3, 0, 0, 
+68, 1, 2, 0, 1, 192, 5, 192, 12, 95, 95, 105, 110, 100, 101, 120, 
+19, 80, 97, 114, 97, 103, 114, 97, 112, 104, 67, 108, 97, 115, 115, 1, 
+0, 1, 12, 95, 95, 105, 110, 100, 101, 120, 0, 17, 115, 101, 116, 109, 
+101, 116, 97, 116, 97, 98, 108, 101, 2, 77, 0, 0, 5, 2, 1, 1, 
+15, 52, 0, 0, 0, 45, 1, 0, 0, 21, 1, 1, 0, 22, 1, 0, 
+1, 45, 2, 0, 0, 52, 3, 0, 0, 60, 3, 1, 2, 45, 2, 1, 
+0, 18, 4, 0, 0, 66, 2, 2, 1, 45, 2, 0, 0, 57, 3, 0, 
+0, 60, 3, 1, 2, 57, 2, 0, 0, 76, 2, 2, 0, 1, 192, 5, 
+192, 9, 116, 101, 120, 116, 2, 44, 0, 0, 3, 2, 0, 1, 8, 45, 
+0, 0, 0, 66, 0, 1, 2, 45, 1, 1, 0, 45, 2, 1, 0, 21, 
+2, 2, 0, 22, 2, 0, 2, 60, 0, 2, 1, 76, 0, 2, 0, 2, 
+128, 1, 192, 2, 115, 0, 0, 6, 2, 4, 1, 15, 52, 0, 0, 0, 
+54, 1, 0, 0, 18, 3, 0, 0, 53, 4, 1, 0, 54, 5, 2, 0, 
+61, 5, 3, 4, 66, 1, 3, 1, 45, 1, 0, 0, 45, 2, 0, 0, 
+21, 2, 2, 0, 22, 2, 0, 2, 60, 0, 2, 1, 45, 1, 1, 0, 
+18, 3, 0, 0, 68, 1, 2, 0, 1, 192, 5, 192, 12, 95, 95, 105, 
+110, 100, 101, 120, 14, 77, 101, 110, 117, 67, 108, 97, 115, 115, 1, 0, 
+1, 12, 95, 95, 105, 110, 100, 101, 120, 0, 17, 115, 101, 116, 109, 101, 
+116, 97, 116, 97, 98, 108, 101, 2, 48, 0, 0, 4, 2, 0, 1, 9, 
+52, 0, 0, 0, 45, 1, 0, 0, 45, 2, 0, 0, 21, 2, 2, 0, 
+22, 2, 0, 2, 60, 0, 2, 1, 45, 1, 1, 0, 18, 3, 0, 0, 
+68, 1, 2, 0, 1, 192, 5, 192, 2, 116, 0, 0, 6, 4, 1, 1, 
+24, 43, 0, 0, 0, 45, 1, 1, 0, 45, 3, 2, 0, 45, 4, 0, 
+0, 66, 1, 3, 3, 46, 0, 2, 0, 18, 0, 1, 0, 45, 1, 2, 
+0, 18, 3, 1, 0, 57, 1, 0, 1, 45, 4, 0, 0, 45, 5, 0, 
+0, 32, 5, 0, 5, 23, 5, 0, 5, 66, 1, 4, 2, 45, 2, 0, 
+0, 32, 2, 0, 2, 46, 0, 2, 0, 45, 2, 3, 0, 45, 3, 3, 
+0, 21, 3, 3, 0, 22, 3, 0, 3, 60, 1, 3, 2, 76, 1, 2, 
+0, 4, 128, 1, 0, 3, 192, 1, 192, 8, 115, 117, 98, 2, 68, 0, 
+0, 5, 4, 0, 1, 13, 43, 0, 0, 0, 45, 1, 1, 0, 45, 3, 
+2, 0, 45, 4, 0, 0, 66, 1, 3, 3, 46, 0, 2, 0, 18, 0, 
+1, 0, 45, 1, 3, 0, 45, 2, 3, 0, 21, 2, 2, 0, 22, 2, 
+0, 2, 60, 0, 2, 1, 76, 0, 2, 0, 4, 128, 1, 0, 3, 192, 
+1, 192, 2, 72, 0, 0, 5, 4, 0, 1, 14, 43, 0, 0, 0, 45, 
+1, 1, 0, 45, 3, 2, 0, 45, 4, 0, 0, 66, 1, 3, 3, 46, 
+0, 2, 0, 18, 0, 1, 0, 20, 0, 0, 0, 45, 1, 3, 0, 45, 
+2, 3, 0, 21, 2, 2, 0, 22, 2, 0, 2, 60, 0, 2, 1, 76, 
+0, 2, 0, 4, 128, 1, 0, 3, 192, 1, 192, 2, 42, 0, 0, 3, 
+1, 0, 1, 8, 45, 0, 0, 0, 45, 1, 0, 0, 21, 1, 1, 0, 
+22, 1, 0, 1, 43, 2, 2, 0, 60, 2, 1, 0, 43, 0, 2, 0, 
+76, 0, 2, 0, 1, 192, 2, 42, 0, 0, 3, 1, 0, 1, 8, 45, 
+0, 0, 0, 45, 1, 0, 0, 21, 1, 1, 0, 22, 1, 0, 1, 43, 
+2, 1, 0, 60, 2, 1, 0, 43, 0, 1, 0, 76, 0, 2, 0, 1, 
+192, 2, 15, 0, 0, 1, 0, 0, 0, 2, 43, 0, 0, 0, 76, 0, 
+2, 0, 130, 1, 0, 0, 8, 4, 3, 0, 20, 43, 0, 0, 0, 45, 
+1, 1, 0, 45, 3, 2, 0, 45, 4, 0, 0, 66, 1, 3, 3, 46, 
+0, 2, 0, 18, 0, 1, 0, 45, 1, 3, 0, 56, 1, 0, 1, 14, 
+0, 1, 0, 88, 2, 7, 128, 54, 2, 0, 0, 39, 4, 1, 0, 18, 
+5, 0, 0, 39, 6, 2, 0, 45, 7, 0, 0, 38, 4, 7, 4, 66, 
+2, 2, 1, 18, 2, 1, 0, 68, 2, 1, 0, 4, 128, 1, 0, 3, 
+192, 6, 192, 16, 32, 97, 116, 32, 111, 102, 102, 115, 101, 116, 32, 21, 
+99, 97, 110, 39, 116, 32, 108, 111, 97, 100, 32, 116, 121, 112, 101, 32, 
+10, 101, 114, 114, 111, 114, 163, 2, 1, 1, 9, 16, 18, 0, 57, 52, 
+1, 0, 0, 43, 2, 0, 0, 45, 3, 0, 0, 18, 7, 0, 0, 57, 
+5, 0, 0, 39, 8, 1, 0, 66, 5, 3, 0, 65, 3, 0, 2, 41, 
+4, 1, 0, 51, 5, 2, 0, 52, 6, 0, 32, 45, 7, 2, 0, 51, 
+8, 3, 0, 60, 8, 7, 6, 45, 7, 3, 0, 51, 8, 4, 0, 60, 
+8, 7, 6, 45, 7, 4, 0, 51, 8, 5, 0, 60, 8, 7, 6, 45, 
+7, 5, 0, 51, 8, 6, 0, 60, 8, 7, 6, 45, 7, 6, 0, 51, 
+8, 7, 0, 60, 8, 7, 6, 45, 7, 7, 0, 51, 8, 8, 0, 60, 
+8, 7, 6, 45, 7, 8, 0, 51, 8, 9, 0, 60, 8, 7, 6, 45, 
+7, 9, 0, 51, 8, 10, 0, 60, 8, 7, 6, 45, 7, 10, 0, 51, 
+8, 11, 0, 60, 8, 7, 6, 45, 7, 11, 0, 51, 8, 12, 0, 60, 
+8, 7, 6, 45, 7, 12, 0, 51, 8, 13, 0, 60, 8, 7, 6, 45, 
+7, 13, 0, 51, 8, 14, 0, 60, 8, 7, 6, 45, 7, 14, 0, 51, 
+8, 15, 0, 60, 8, 7, 6, 45, 7, 15, 0, 51, 8, 16, 0, 60, 
+8, 7, 6, 51, 2, 17, 0, 18, 7, 2, 0, 50, 0, 0, 128, 68, 
+7, 1, 0, 7, 192, 8, 192, 20, 192, 23, 192, 24, 192, 25, 192, 26, 
+192, 22, 192, 27, 192, 15, 192, 18, 192, 19, 192, 21, 192, 16, 192, 17, 
+192, 14, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 7, 42, 97, 9, 114, 101, 97, 100, 250, 2, 0, 1, 12, 
+5, 13, 0, 59, 54, 1, 0, 0, 57, 1, 1, 1, 18, 3, 0, 0, 
+39, 4, 2, 0, 66, 1, 3, 3, 14, 0, 1, 0, 88, 3, 7, 128, 
+43, 3, 0, 0, 39, 4, 3, 0, 18, 5, 0, 0, 39, 6, 4, 0, 
+18, 7, 2, 0, 38, 4, 7, 4, 74, 3, 3, 0, 43, 3, 0, 0, 
+18, 6, 1, 0, 57, 4, 5, 1, 39, 7, 6, 0, 66, 4, 3, 2, 
+45, 5, 0, 0, 5, 4, 5, 0, 88, 5, 2, 128, 45, 3, 1, 0, 
+88, 5, 14, 128, 45, 5, 2, 0, 5, 4, 5, 0, 88, 5, 2, 128, 
+54, 3, 7, 0, 88, 5, 9, 128, 18, 7, 1, 0, 57, 5, 8, 1, 
+66, 5, 2, 1, 43, 5, 0, 0, 39, 6, 3, 0, 18, 7, 0, 0, 
+39, 8, 9, 0, 38, 6, 8, 6, 74, 5, 3, 0, 45, 5, 3, 0, 
+66, 5, 1, 1, 54, 5, 10, 0, 18, 7, 3, 0, 54, 8, 11, 0, 
+18, 9, 1, 0, 66, 5, 4, 4, 45, 8, 4, 0, 66, 8, 1, 1, 
+18, 10, 1, 0, 57, 8, 8, 1, 66, 8, 2, 1, 14, 0, 5, 0, 
+88, 8, 4, 128, 54, 8, 12, 0, 18, 10, 6, 0, 41, 11, 0, 0, 
+66, 8, 3, 1, 18, 8, 6, 0, 18, 9, 7, 0, 74, 8, 3, 0, 
+12, 192, 29, 192, 13, 192, 10, 192, 11, 192, 10, 101, 114, 114, 111, 114, 
+14, 84, 114, 97, 99, 101, 98, 97, 99, 107, 11, 120, 112, 99, 97, 108, 
+108, 39, 39, 32, 105, 115, 32, 110, 111, 116, 32, 97, 32, 118, 97, 108, 
+105, 100, 32, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 32, 102, 
+105, 108, 101, 46, 10, 99, 108, 111, 115, 101, 20, 108, 111, 97, 100, 102, 
+114, 111, 109, 115, 116, 114, 101, 97, 109, 122, 7, 42, 108, 9, 114, 101, 
+97, 100, 28, 39, 32, 99, 111, 117, 108, 100, 32, 110, 111, 116, 32, 98, 
+101, 32, 111, 112, 101, 110, 101, 100, 58, 32, 6, 39, 7, 114, 98, 9, 
+111, 112, 101, 110, 7, 105, 111, 85, 0, 1, 6, 0, 3, 0, 13, 54, 
+1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 3, 15, 0, 2, 0, 88, 
+3, 3, 128, 43, 3, 0, 0, 18, 4, 2, 0, 74, 3, 3, 0, 18, 
+5, 1, 0, 57, 3, 1, 1, 66, 3, 2, 1, 61, 0, 2, 1, 76, 
+1, 2, 0, 9, 110, 97, 109, 101, 10, 99, 108, 101, 97, 110, 19, 76, 
+111, 97, 100, 70, 114, 111, 109, 83, 116, 114, 101, 97, 109, 143, 10, 0, 
+1, 12, 1, 39, 0, 116, 54, 1, 0, 0, 66, 1, 1, 2, 14, 0, 
+1, 0, 88, 1, 2, 128, 43, 1, 1, 0, 76, 1, 2, 0, 14, 0, 
+0, 0, 88, 1, 10, 128, 54, 1, 1, 0, 39, 3, 2, 0, 39, 4, 
+3, 0, 43, 5, 1, 0, 66, 1, 4, 2, 18, 0, 1, 0, 14, 0, 
+0, 0, 88, 1, 2, 128, 43, 1, 1, 0, 76, 1, 2, 0, 54, 1, 
+4, 0, 39, 3, 5, 0, 66, 1, 2, 1, 45, 1, 0, 0, 18, 3, 
+0, 0, 66, 1, 2, 3, 14, 0, 1, 0, 88, 3, 11, 128, 14, 0, 
+2, 0, 88, 3, 1, 128, 39, 2, 6, 0, 54, 3, 7, 0, 39, 5, 
+8, 0, 18, 6, 2, 0, 66, 3, 3, 1, 54, 3, 9, 0, 66, 3, 
+1, 1, 43, 3, 1, 0, 76, 3, 2, 0, 57, 3, 10, 1, 14, 0, 
+3, 0, 88, 4, 1, 128, 41, 3, 1, 0, 54, 4, 11, 0, 1, 4, 
+3, 0, 88, 4, 10, 128, 54, 4, 7, 0, 39, 6, 12, 0, 39, 7, 
+13, 0, 39, 8, 14, 0, 38, 7, 8, 7, 66, 4, 3, 1, 54, 4, 
+9, 0, 66, 4, 1, 1, 43, 4, 1, 0, 76, 4, 2, 0, 55, 1, 
+15, 0, 57, 4, 16, 1, 55, 4, 17, 0, 54, 4, 11, 0, 1, 3, 
+4, 0, 88, 4, 24, 128, 54, 4, 18, 0, 18, 6, 3, 0, 66, 4, 
+2, 1, 54, 4, 19, 0, 54, 6, 20, 0, 57, 6, 21, 6, 18, 7, 
+3, 0, 54, 8, 11, 0, 66, 4, 4, 1, 54, 4, 19, 0, 54, 6, 
+20, 0, 57, 6, 22, 6, 66, 4, 2, 1, 54, 4, 15, 0, 54, 5, 
+11, 0, 61, 5, 10, 4, 54, 4, 15, 0, 54, 5, 24, 0, 66, 5, 
+1, 2, 61, 5, 23, 4, 54, 4, 15, 0, 18, 6, 4, 0, 57, 4, 
+25, 4, 66, 4, 2, 1, 54, 4, 26, 0, 66, 4, 1, 1, 54, 4, 
+19, 0, 54, 6, 20, 0, 57, 6, 27, 6, 66, 4, 2, 1, 54, 4, 
+28, 0, 66, 4, 1, 1, 54, 4, 29, 0, 54, 6, 15, 0, 57, 6, 
+30, 6, 66, 4, 2, 1, 54, 4, 31, 0, 54, 6, 15, 0, 57, 6, 
+32, 6, 66, 4, 2, 1, 54, 4, 9, 0, 66, 4, 1, 1, 54, 4, 
+11, 0, 1, 3, 4, 0, 88, 4, 9, 128, 54, 4, 7, 0, 39, 6, 
+33, 0, 39, 7, 34, 0, 39, 8, 35, 0, 39, 9, 36, 0, 39, 10, 
+37, 0, 39, 11, 38, 0, 38, 7, 11, 7, 66, 4, 3, 1, 43, 4, 
+2, 0, 76, 4, 2, 0, 30, 192, 29, 116, 111, 32, 116, 104, 101, 105, 
+114, 32, 100, 101, 102, 97, 117, 108, 116, 32, 118, 97, 108, 117, 101, 115, 
+46, 63, 65, 108, 115, 111, 44, 32, 97, 108, 108, 32, 107, 101, 121, 98, 
+105, 110, 100, 105, 110, 103, 115, 32, 100, 101, 102, 105, 110, 101, 100, 32, 
+105, 110, 32, 116, 104, 105, 115, 32, 102, 105, 108, 101, 32, 119, 105, 108, 
+108, 32, 103, 101, 116, 32, 114, 101, 115, 101, 116, 32, 61, 115, 97, 118, 
+101, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 97, 103, 97, 105, 110, 
+32, 105, 116, 32, 109, 97, 121, 32, 110, 111, 116, 32, 119, 111, 114, 107, 
+32, 111, 110, 32, 116, 104, 101, 32, 111, 108, 100, 32, 118, 101, 114, 115, 
+105, 111, 110, 46, 32, 62, 118, 101, 114, 115, 105, 111, 110, 32, 111, 102, 
+32, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 46, 32, 84, 104, 
+97, 116, 39, 115, 32, 110, 111, 116, 32, 97, 32, 112, 114, 111, 98, 108, 
+101, 109, 44, 32, 98, 117, 116, 32, 105, 102, 32, 121, 111, 117, 32, 59, 
+89, 111, 117, 32, 97, 114, 101, 32, 116, 114, 121, 105, 110, 103, 32, 116, 
+111, 32, 111, 112, 101, 110, 32, 97, 32, 102, 105, 108, 101, 32, 98, 101, 
+108, 111, 110, 103, 105, 110, 103, 32, 116, 111, 32, 97, 110, 32, 101, 97, 
+114, 108, 105, 101, 114, 32, 22, 68, 111, 99, 117, 109, 101, 110, 116, 32, 
+117, 112, 103, 114, 97, 100, 101, 100, 14, 100, 111, 99, 117, 109, 101, 110, 
+116, 115, 25, 82, 101, 98, 117, 105, 108, 100, 68, 111, 99, 117, 109, 101, 
+110, 116, 115, 77, 101, 110, 117, 11, 115, 116, 121, 108, 101, 115, 31, 82, 
+101, 98, 117, 105, 108, 100, 80, 97, 114, 97, 103, 114, 97, 112, 104, 83, 
+116, 121, 108, 101, 115, 77, 101, 110, 117, 25, 82, 101, 115, 101, 116, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 83, 116, 121, 108, 101, 115, 19, 68, 
+111, 99, 117, 109, 101, 110, 116, 76, 111, 97, 100, 101, 100, 17, 82, 101, 
+115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 10, 116, 111, 117, 99, 104, 
+15, 67, 114, 101, 97, 116, 101, 77, 101, 110, 117, 9, 109, 101, 110, 117, 
+19, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 20, 
+68, 111, 99, 117, 109, 101, 110, 116, 85, 112, 103, 114, 97, 100, 101, 10, 
+69, 118, 101, 110, 116, 14, 70, 105, 114, 101, 69, 118, 101, 110, 116, 20, 
+85, 112, 103, 114, 97, 100, 101, 68, 111, 99, 117, 109, 101, 110, 116, 13, 
+68, 111, 99, 117, 109, 101, 110, 116, 12, 99, 117, 114, 114, 101, 110, 116, 
+16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 45, 87, 111, 114, 
+100, 71, 114, 105, 110, 100, 101, 114, 32, 97, 110, 100, 32, 99, 97, 110, 
+110, 111, 116, 32, 98, 101, 32, 108, 111, 97, 100, 101, 100, 46, 32, 83, 
+111, 114, 114, 121, 46, 49, 84, 104, 105, 115, 32, 100, 111, 99, 117, 109, 
+101, 110, 116, 32, 98, 101, 108, 111, 110, 103, 115, 32, 116, 111, 32, 97, 
+32, 110, 101, 119, 101, 114, 32, 118, 101, 114, 115, 105, 111, 110, 32, 111, 
+102, 32, 25, 67, 97, 110, 110, 111, 116, 32, 108, 111, 97, 100, 32, 100, 
+111, 99, 117, 109, 101, 110, 116, 15, 70, 73, 76, 69, 70, 79, 82, 77, 
+65, 84, 15, 102, 105, 108, 101, 102, 111, 114, 109, 97, 116, 16, 81, 117, 
+101, 117, 101, 82, 101, 100, 114, 97, 119, 16, 76, 111, 97, 100, 32, 102, 
+97, 105, 108, 101, 100, 17, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 
+103, 101, 68, 84, 104, 101, 32, 108, 111, 97, 100, 32, 102, 97, 105, 108, 
+101, 100, 44, 32, 112, 114, 111, 98, 97, 98, 108, 121, 32, 98, 101, 99, 
+97, 117, 115, 101, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 99, 111, 
+117, 108, 100, 32, 110, 111, 116, 32, 98, 101, 32, 111, 112, 101, 110, 101, 
+100, 46, 15, 76, 111, 97, 100, 105, 110, 103, 46, 46, 46, 21, 73, 109, 
+109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 15, 76, 
+111, 97, 100, 32, 102, 105, 108, 101, 58, 22, 76, 111, 97, 100, 32, 68, 
+111, 99, 117, 109, 101, 110, 116, 32, 83, 101, 116, 16, 70, 105, 108, 101, 
+66, 114, 111, 119, 115, 101, 114, 27, 67, 111, 110, 102, 105, 114, 109, 68, 
+111, 99, 117, 109, 101, 110, 116, 69, 114, 97, 115, 117, 114, 101, 218, 1, 
+0, 1, 14, 0, 6, 0, 39, 54, 1, 0, 0, 54, 2, 0, 0, 57, 
+2, 1, 2, 14, 0, 2, 0, 88, 3, 1, 128, 52, 2, 0, 0, 61, 
+2, 1, 1, 41, 1, 2, 0, 1, 0, 1, 0, 88, 1, 19, 128, 54, 
+1, 2, 0, 54, 3, 0, 0, 66, 1, 2, 4, 88, 4, 10, 128, 41, 
+6, 0, 0, 54, 7, 2, 0, 18, 9, 5, 0, 66, 7, 2, 4, 88, 
+10, 2, 128, 21, 12, 11, 0, 32, 6, 12, 6, 69, 10, 3, 3, 82, 
+10, 252, 127, 61, 6, 3, 5, 69, 4, 3, 3, 82, 4, 244, 127, 54, 
+1, 0, 0, 43, 2, 2, 0, 61, 2, 4, 1, 41, 1, 3, 0, 1, 
+0, 1, 0, 88, 1, 3, 128, 54, 1, 0, 0, 41, 2, 3, 0, 61, 
+2, 5, 1, 41, 1, 6, 0, 1, 0, 1, 0, 88, 1, 0, 128, 75, 
+0, 1, 0, 13, 105, 100, 108, 101, 116, 105, 109, 101, 14, 115, 116, 97, 
+116, 117, 115, 98, 97, 114, 14, 119, 111, 114, 100, 99, 111, 117, 110, 116, 
+11, 105, 112, 97, 105, 114, 115, 11, 97, 100, 100, 111, 110, 115, 16, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 235, 4, 3, 0, 33, 0, 
+36, 0, 64, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 2, 0, 57, 
+1, 3, 1, 54, 2, 2, 0, 57, 2, 4, 2, 54, 3, 2, 0, 57, 
+3, 5, 3, 54, 4, 2, 0, 57, 4, 6, 4, 54, 5, 0, 0, 57, 
+5, 7, 5, 54, 6, 0, 0, 57, 6, 8, 6, 54, 7, 0, 0, 57, 
+7, 9, 7, 54, 8, 0, 0, 57, 8, 10, 8, 54, 9, 0, 0, 57, 
+9, 11, 9, 54, 10, 0, 0, 57, 10, 12, 10, 54, 11, 0, 0, 57, 
+11, 13, 11, 39, 12, 14, 0, 39, 13, 15, 0, 41, 14, 0, 0, 41, 
+15, 1, 0, 41, 16, 2, 0, 41, 17, 3, 0, 41, 18, 4, 0, 41, 
+19, 5, 0, 41, 20, 6, 0, 41, 21, 7, 0, 41, 22, 8, 0, 41, 
+23, 100, 0, 41, 24, 101, 0, 41, 25, 102, 0, 41, 26, 103, 0, 41, 
+27, 104, 0, 51, 28, 16, 0, 51, 29, 17, 0, 55, 29, 18, 0, 51, 
+29, 19, 0, 55, 29, 20, 0, 54, 29, 21, 0, 51, 30, 23, 0, 61, 
+30, 22, 29, 54, 29, 21, 0, 51, 30, 25, 0, 61, 30, 24, 29, 51, 
+29, 26, 0, 51, 30, 27, 0, 55, 30, 28, 0, 51, 30, 29, 0, 55, 
+30, 30, 0, 51, 30, 31, 0, 54, 31, 21, 0, 51, 32, 33, 0, 61, 
+32, 32, 31, 51, 31, 34, 0, 55, 31, 35, 0, 50, 0, 0, 128, 75, 
+0, 1, 0, 20, 85, 112, 103, 114, 97, 100, 101, 68, 111, 99, 117, 109, 
+101, 110, 116, 0, 0, 20, 76, 111, 97, 100, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 0, 19, 76, 111, 97, 100, 70, 114, 111, 109, 83, 
+116, 114, 101, 97, 109, 0, 20, 108, 111, 97, 100, 102, 114, 111, 109, 115, 
+116, 114, 101, 97, 109, 122, 0, 0, 0, 24, 83, 97, 118, 101, 67, 117, 
+114, 114, 101, 110, 116, 68, 111, 99, 117, 109, 101, 110, 116, 0, 26, 83, 
+97, 118, 101, 67, 117, 114, 114, 101, 110, 116, 68, 111, 99, 117, 109, 101, 
+110, 116, 65, 115, 8, 67, 109, 100, 23, 83, 97, 118, 101, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 82, 97, 119, 0, 17, 83, 97, 118, 
+101, 84, 111, 83, 116, 114, 101, 97, 109, 0, 0, 54, 87, 111, 114, 100, 
+71, 114, 105, 110, 100, 101, 114, 32, 100, 117, 109, 112, 102, 105, 108, 101, 
+32, 118, 50, 58, 32, 116, 104, 105, 115, 32, 105, 115, 32, 110, 111, 116, 
+32, 97, 32, 116, 101, 120, 116, 32, 102, 105, 108, 101, 33, 54, 87, 111, 
+114, 100, 71, 114, 105, 110, 100, 101, 114, 32, 100, 117, 109, 112, 102, 105, 
+108, 101, 32, 118, 49, 58, 32, 116, 104, 105, 115, 32, 105, 115, 32, 110, 
+111, 116, 32, 97, 32, 116, 101, 120, 116, 32, 102, 105, 108, 101, 33, 13, 
+101, 110, 100, 97, 114, 101, 110, 97, 15, 98, 101, 103, 105, 110, 97, 114, 
+101, 110, 97, 17, 99, 114, 101, 97, 116, 101, 98, 117, 102, 102, 101, 114, 
+11, 114, 101, 97, 100, 117, 56, 15, 100, 101, 99, 111, 109, 112, 114, 101, 
+115, 115, 13, 99, 111, 109, 112, 114, 101, 115, 115, 9, 116, 105, 109, 101, 
+10, 98, 116, 101, 115, 116, 9, 98, 120, 111, 114, 8, 98, 111, 114, 9, 
+98, 97, 110, 100, 10, 98, 105, 116, 51, 50, 14, 112, 97, 114, 115, 101, 
+119, 111, 114, 100, 7, 119, 103, 0, 
+};
+
+/* This is src/lua/export.lua */
+static const char file_16[] = {
+27, 76, 74, 2, 10, 167, 1, 0, 3, 10, 3, 3, 1, 29, 45, 3, 
+0, 0, 56, 3, 0, 3, 14, 0, 3, 0, 88, 4, 7, 128, 54, 4, 
+0, 0, 52, 6, 0, 0, 53, 7, 1, 0, 66, 4, 3, 2, 18, 3, 
+4, 0, 45, 4, 0, 0, 60, 3, 0, 4, 56, 4, 1, 3, 15, 0, 
+4, 0, 88, 5, 4, 128, 45, 5, 1, 0, 22, 5, 0, 5, 46, 1, 
+5, 0, 88, 5, 10, 128, 45, 5, 2, 0, 22, 5, 0, 5, 46, 2, 
+5, 0, 18, 7, 0, 0, 57, 5, 2, 0, 18, 8, 1, 0, 18, 9, 
+2, 0, 66, 5, 4, 2, 18, 4, 5, 0, 60, 4, 1, 3, 76, 4, 
+2, 0, 12, 192, 13, 128, 14, 128, 16, 114, 101, 110, 100, 101, 114, 119, 
+111, 114, 100, 115, 1, 0, 1, 11, 95, 95, 109, 111, 100, 101, 6, 107, 
+17, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 101, 2, 23, 0, 
+0, 2, 2, 0, 0, 3, 45, 0, 0, 0, 45, 1, 1, 0, 74, 0, 
+3, 0, 13, 128, 14, 128, 57, 2, 1, 8, 1, 0, 0, 12, 41, 1, 
+1, 0, 45, 2, 0, 0, 21, 2, 2, 0, 41, 3, 1, 0, 77, 1, 
+6, 128, 45, 5, 0, 0, 56, 5, 4, 5, 56, 5, 0, 5, 71, 7, 
+1, 0, 65, 5, 0, 1, 79, 1, 250, 127, 75, 0, 1, 0, 1, 192, 
+63, 2, 0, 7, 2, 0, 0, 13, 41, 0, 1, 0, 45, 1, 0, 0, 
+21, 1, 1, 0, 41, 2, 1, 0, 77, 0, 7, 128, 45, 4, 0, 0, 
+56, 4, 3, 4, 45, 5, 1, 0, 56, 4, 5, 4, 71, 6, 0, 0, 
+65, 4, 0, 1, 79, 0, 249, 127, 75, 0, 1, 0, 0, 0, 0, 192, 
+59, 1, 1, 2, 1, 1, 1, 12, 45, 1, 0, 0, 21, 1, 1, 0, 
+9, 1, 0, 0, 88, 1, 4, 128, 45, 1, 0, 0, 58, 1, 1, 1, 
+56, 1, 0, 1, 50, 0, 3, 128, 51, 1, 0, 0, 50, 0, 0, 128, 
+76, 1, 2, 0, 76, 1, 2, 0, 3, 192, 0, 2, 243, 3, 0, 2, 
+6, 14, 9, 0, 96, 45, 2, 1, 0, 18, 4, 0, 0, 45, 5, 2, 
+0, 66, 2, 3, 2, 46, 0, 2, 0, 45, 2, 1, 0, 18, 4, 0, 
+0, 45, 5, 4, 0, 66, 2, 3, 2, 46, 3, 2, 0, 45, 2, 1, 
+0, 18, 4, 0, 0, 45, 5, 6, 0, 66, 2, 3, 2, 46, 5, 2, 
+0, 43, 2, 0, 0, 45, 3, 7, 0, 15, 0, 3, 0, 88, 4, 3, 
+128, 45, 3, 8, 0, 57, 2, 0, 3, 88, 3, 2, 128, 45, 3, 8, 
+0, 57, 2, 1, 3, 45, 3, 0, 0, 14, 0, 3, 0, 88, 3, 6, 
+128, 45, 3, 9, 0, 15, 0, 3, 0, 88, 4, 3, 128, 45, 3, 8, 
+0, 57, 3, 2, 3, 66, 3, 1, 1, 45, 3, 3, 0, 14, 0, 3, 
+0, 88, 3, 6, 128, 45, 3, 10, 0, 15, 0, 3, 0, 88, 4, 3, 
+128, 45, 3, 8, 0, 57, 3, 3, 3, 66, 3, 1, 1, 45, 3, 5, 
+0, 14, 0, 3, 0, 88, 3, 6, 128, 45, 3, 11, 0, 15, 0, 3, 
+0, 88, 4, 3, 128, 45, 3, 8, 0, 57, 3, 4, 3, 66, 3, 1, 
+1, 45, 3, 12, 0, 15, 0, 3, 0, 88, 4, 4, 128, 18, 3, 2, 
+0, 39, 5, 5, 0, 66, 3, 2, 1, 49, 12, 1, 0, 45, 3, 5, 
+0, 15, 0, 3, 0, 88, 4, 6, 128, 45, 3, 11, 0, 14, 0, 3, 
+0, 88, 3, 3, 128, 45, 3, 8, 0, 57, 3, 6, 3, 66, 3, 1, 
+1, 45, 3, 3, 0, 15, 0, 3, 0, 88, 4, 6, 128, 45, 3, 10, 
+0, 14, 0, 3, 0, 88, 3, 3, 128, 45, 3, 8, 0, 57, 3, 7, 
+3, 66, 3, 1, 1, 45, 3, 0, 0, 15, 0, 3, 0, 88, 4, 6, 
+128, 45, 3, 9, 0, 14, 0, 3, 0, 88, 3, 3, 128, 45, 3, 8, 
+0, 57, 3, 8, 3, 66, 3, 1, 1, 18, 3, 2, 0, 18, 5, 1, 
+0, 66, 3, 2, 1, 49, 13, 1, 0, 45, 3, 0, 0, 46, 9, 3, 
+0, 45, 3, 3, 0, 46, 10, 3, 0, 45, 3, 5, 0, 46, 11, 3, 
+0, 75, 0, 1, 0, 9, 128, 0, 0, 1, 0, 10, 128, 2, 0, 11, 
+128, 3, 0, 8, 128, 6, 192, 12, 128, 13, 128, 14, 128, 16, 128, 17, 
+128, 14, 105, 116, 97, 108, 105, 99, 95, 111, 110, 17, 117, 110, 100, 101, 
+114, 108, 105, 110, 101, 95, 111, 110, 12, 98, 111, 108, 100, 95, 111, 110, 
+6, 32, 13, 98, 111, 108, 100, 95, 111, 102, 102, 18, 117, 110, 100, 101, 
+114, 108, 105, 110, 101, 95, 111, 102, 102, 15, 105, 116, 97, 108, 105, 99, 
+95, 111, 102, 102, 9, 116, 101, 120, 116, 12, 114, 97, 119, 116, 101, 120, 
+116, 247, 6, 1, 2, 38, 6, 23, 2, 157, 1, 52, 2, 0, 0, 52, 
+3, 0, 0, 54, 4, 0, 0, 18, 6, 1, 0, 66, 4, 2, 4, 88, 
+7, 10, 128, 57, 9, 1, 8, 15, 0, 9, 0, 88, 10, 4, 128, 21, 
+9, 2, 0, 22, 9, 0, 9, 60, 8, 9, 2, 88, 9, 3, 128, 21, 
+9, 3, 0, 22, 9, 0, 9, 60, 8, 9, 3, 69, 7, 3, 3, 82, 
+7, 244, 127, 51, 4, 2, 0, 51, 5, 3, 0, 52, 6, 0, 0, 54, 
+7, 0, 0, 53, 9, 4, 0, 66, 7, 2, 4, 88, 10, 4, 128, 18, 
+12, 5, 0, 18, 14, 11, 0, 66, 12, 2, 2, 60, 12, 11, 6, 69, 
+10, 3, 3, 82, 10, 250, 127, 18, 7, 4, 0, 39, 9, 5, 0, 66, 
+7, 2, 1, 43, 7, 1, 0, 43, 8, 1, 0, 44, 9, 17, 0, 51, 
+18, 6, 0, 54, 19, 0, 0, 18, 21, 0, 0, 66, 19, 2, 4, 88, 
+22, 103, 128, 57, 24, 7, 23, 57, 25, 8, 24, 6, 25, 9, 0, 88, 
+26, 2, 128, 7, 25, 10, 0, 88, 26, 7, 128, 14, 0, 7, 0, 88, 
+26, 11, 128, 18, 26, 4, 0, 39, 28, 11, 0, 66, 26, 2, 1, 43, 
+7, 2, 0, 88, 26, 6, 128, 15, 0, 7, 0, 88, 26, 4, 128, 18, 
+26, 4, 0, 39, 28, 12, 0, 66, 26, 2, 1, 43, 7, 1, 0, 6, 
+25, 13, 0, 88, 26, 2, 128, 43, 8, 1, 0, 88, 26, 1, 128, 43, 
+8, 2, 0, 18, 26, 4, 0, 39, 28, 14, 0, 18, 29, 25, 0, 66, 
+26, 3, 1, 21, 26, 23, 0, 9, 26, 0, 0, 88, 26, 8, 128, 58, 
+26, 1, 23, 21, 26, 26, 0, 9, 26, 1, 0, 88, 26, 4, 128, 18, 
+26, 4, 0, 39, 28, 15, 0, 66, 26, 2, 1, 88, 26, 60, 128, 41, 
+26, 1, 0, 21, 27, 2, 0, 41, 28, 1, 0, 77, 26, 9, 128, 56, 
+30, 29, 2, 57, 31, 16, 30, 45, 33, 4, 0, 57, 35, 1, 30, 18, 
+36, 23, 0, 18, 37, 8, 0, 66, 33, 4, 0, 65, 31, 0, 1, 79, 
+26, 247, 127, 21, 26, 3, 0, 41, 27, 0, 0, 1, 27, 26, 0, 88, 
+26, 43, 128, 43, 15, 2, 0, 43, 16, 1, 0, 43, 12, 1, 0, 43, 
+13, 1, 0, 43, 14, 1, 0, 54, 26, 0, 0, 18, 28, 23, 0, 66, 
+26, 2, 4, 88, 29, 20, 128, 15, 0, 15, 0, 88, 31, 2, 128, 43, 
+15, 1, 0, 88, 31, 1, 128, 43, 16, 2, 0, 43, 17, 2, 0, 43, 
+9, 1, 0, 43, 10, 1, 0, 43, 11, 1, 0, 45, 31, 5, 0, 18, 
+33, 30, 0, 41, 34, 0, 0, 18, 35, 18, 0, 66, 31, 4, 1, 15, 
+0, 17, 0, 88, 31, 4, 128, 18, 31, 18, 0, 41, 33, 0, 0, 39, 
+34, 17, 0, 66, 31, 3, 1, 69, 29, 3, 3, 82, 29, 234, 127, 15, 
+0, 9, 0, 88, 26, 2, 128, 57, 26, 18, 6, 66, 26, 1, 1, 15, 
+0, 10, 0, 88, 26, 2, 128, 57, 26, 19, 6, 66, 26, 1, 1, 15, 
+0, 11, 0, 88, 26, 2, 128, 57, 26, 20, 6, 66, 26, 1, 1, 18, 
+26, 4, 0, 39, 28, 21, 0, 18, 29, 25, 0, 66, 26, 3, 1, 69, 
+22, 3, 3, 82, 22, 151, 127, 15, 0, 7, 0, 88, 19, 3, 128, 18, 
+19, 4, 0, 39, 21, 12, 0, 66, 19, 2, 1, 18, 19, 4, 0, 39, 
+21, 22, 0, 66, 19, 2, 1, 50, 0, 0, 128, 75, 0, 1, 0, 7, 
+192, 0, 192, 1, 192, 2, 192, 15, 192, 3, 192, 13, 101, 112, 105, 108, 
+111, 103, 117, 101, 18, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 
+110, 100, 13, 98, 111, 108, 100, 95, 111, 102, 102, 18, 117, 110, 100, 101, 
+114, 108, 105, 110, 101, 95, 111, 102, 102, 15, 105, 116, 97, 108, 105, 99, 
+95, 111, 102, 102, 5, 12, 114, 97, 119, 116, 101, 120, 116, 11, 110, 111, 
+116, 101, 120, 116, 20, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 115, 
+116, 97, 114, 116, 8, 82, 65, 87, 13, 108, 105, 115, 116, 95, 101, 110, 
+100, 15, 108, 105, 115, 116, 95, 115, 116, 97, 114, 116, 7, 76, 66, 6, 
+76, 9, 110, 97, 109, 101, 10, 115, 116, 121, 108, 101, 0, 13, 112, 114, 
+111, 108, 111, 103, 117, 101, 1, 9, 0, 0, 9, 116, 101, 120, 116, 12, 
+114, 97, 119, 116, 101, 120, 116, 14, 105, 116, 97, 108, 105, 99, 95, 111, 
+110, 15, 105, 116, 97, 108, 105, 99, 95, 111, 102, 102, 17, 117, 110, 100, 
+101, 114, 108, 105, 110, 101, 95, 111, 110, 18, 117, 110, 100, 101, 114, 108, 
+105, 110, 101, 95, 111, 102, 102, 12, 98, 111, 108, 100, 95, 111, 110, 13, 
+98, 111, 108, 100, 95, 111, 102, 102, 0, 0, 11, 102, 111, 114, 109, 97, 
+116, 11, 105, 112, 97, 105, 114, 115, 2, 0, 60, 0, 2, 6, 0, 1, 
+0, 5, 54, 2, 0, 0, 18, 4, 0, 0, 52, 5, 3, 0, 62, 1, 
+1, 5, 68, 2, 3, 0, 37, 69, 120, 112, 111, 114, 116, 70, 105, 108, 
+101, 85, 115, 105, 110, 103, 77, 117, 108, 116, 105, 112, 108, 101, 67, 97, 
+108, 108, 98, 97, 99, 107, 115, 95, 2, 0, 4, 6, 0, 0, 19, 45, 
+0, 0, 0, 15, 0, 0, 0, 88, 1, 1, 128, 75, 0, 1, 0, 45, 
+0, 1, 0, 45, 2, 2, 0, 71, 3, 0, 0, 65, 0, 1, 2, 45, 
+1, 3, 0, 1, 1, 0, 0, 88, 0, 7, 128, 45, 0, 4, 0, 45, 
+2, 2, 0, 45, 3, 5, 0, 66, 0, 3, 3, 14, 0, 0, 0, 88, 
+2, 1, 128, 46, 0, 1, 0, 75, 0, 1, 0, 6, 128, 4, 192, 3, 
+192, 1, 0, 5, 192, 1, 192, 121, 0, 0, 6, 4, 1, 0, 25, 43, 
+0, 0, 0, 45, 1, 0, 0, 45, 2, 0, 0, 14, 0, 2, 0, 88, 
+2, 6, 128, 45, 2, 1, 0, 45, 4, 2, 0, 45, 5, 3, 0, 66, 
+2, 3, 3, 18, 1, 3, 0, 18, 0, 2, 0, 45, 2, 3, 0, 18, 
+4, 2, 0, 57, 2, 0, 2, 66, 2, 2, 3, 15, 0, 0, 0, 88, 
+4, 5, 128, 14, 0, 2, 0, 88, 4, 3, 128, 43, 4, 0, 0, 18, 
+1, 3, 0, 18, 0, 4, 0, 18, 4, 0, 0, 18, 5, 1, 0, 74, 
+4, 3, 0, 6, 128, 5, 192, 3, 192, 1, 192, 10, 99, 108, 111, 115, 
+101, 126, 1, 1, 11, 2, 7, 0, 22, 54, 1, 0, 0, 57, 1, 1, 
+1, 18, 3, 0, 0, 39, 4, 2, 0, 66, 1, 3, 3, 14, 0, 1, 
+0, 88, 3, 3, 128, 43, 3, 0, 0, 18, 4, 2, 0, 50, 0, 11, 
+128, 45, 3, 0, 0, 66, 3, 1, 2, 57, 4, 3, 3, 57, 5, 4, 
+3, 43, 6, 0, 0, 51, 7, 5, 0, 51, 8, 6, 0, 18, 9, 7, 
+0, 18, 10, 8, 0, 50, 0, 0, 128, 74, 9, 3, 0, 74, 3, 3, 
+0, 10, 192, 11, 192, 0, 0, 12, 102, 108, 117, 115, 104, 116, 111, 11, 
+97, 112, 112, 101, 110, 100, 6, 119, 9, 111, 112, 101, 110, 7, 105, 111, 
+93, 0, 3, 6, 1, 4, 0, 9, 45, 3, 0, 0, 53, 4, 0, 0, 
+61, 1, 1, 4, 12, 5, 2, 0, 88, 5, 1, 128, 54, 5, 2, 0, 
+61, 5, 3, 4, 60, 4, 0, 3, 75, 0, 1, 0, 16, 192, 9, 111, 
+112, 101, 110, 19, 79, 112, 101, 110, 69, 120, 112, 111, 114, 116, 70, 105, 
+108, 101, 13, 99, 97, 108, 108, 98, 97, 99, 107, 1, 0, 2, 9, 111, 
+112, 101, 110, 0, 13, 99, 97, 108, 108, 98, 97, 99, 107, 0, 21, 0, 
+1, 2, 1, 0, 0, 3, 45, 1, 0, 0, 56, 1, 0, 1, 76, 1, 
+2, 0, 16, 192, 93, 0, 0, 9, 1, 0, 0, 21, 43, 0, 2, 0, 
+43, 1, 0, 0, 41, 2, 1, 0, 45, 3, 0, 0, 21, 3, 3, 0, 
+41, 4, 1, 0, 77, 2, 11, 128, 45, 6, 0, 0, 56, 6, 5, 6, 
+66, 6, 1, 3, 14, 0, 6, 0, 88, 8, 5, 128, 15, 0, 0, 0, 
+88, 8, 3, 128, 43, 8, 0, 0, 18, 1, 7, 0, 18, 0, 8, 0, 
+79, 2, 245, 127, 18, 2, 0, 0, 18, 3, 1, 0, 74, 2, 3, 0, 
+2, 192, 160, 3, 1, 2, 21, 2, 13, 1, 65, 52, 2, 0, 0, 52, 
+3, 0, 0, 51, 4, 0, 0, 54, 5, 1, 0, 18, 7, 1, 0, 66, 
+5, 2, 4, 88, 8, 49, 128, 45, 10, 0, 0, 18, 14, 9, 0, 57, 
+12, 2, 9, 39, 15, 3, 0, 66, 12, 3, 2, 14, 0, 12, 0, 88, 
+13, 1, 128, 39, 12, 4, 0, 66, 10, 2, 2, 45, 11, 1, 0, 56, 
+11, 10, 11, 14, 0, 11, 0, 88, 12, 9, 128, 18, 12, 4, 0, 66, 
+12, 1, 1, 43, 12, 0, 0, 39, 13, 5, 0, 18, 14, 9, 0, 39, 
+15, 6, 0, 38, 13, 15, 13, 50, 0, 0, 128, 74, 12, 3, 0, 57, 
+12, 7, 11, 18, 14, 9, 0, 66, 12, 2, 3, 14, 0, 12, 0, 88, 
+14, 12, 128, 18, 14, 4, 0, 66, 14, 1, 1, 43, 14, 0, 0, 39, 
+15, 8, 0, 18, 16, 9, 0, 39, 17, 9, 0, 54, 18, 10, 0, 18, 
+20, 13, 0, 66, 18, 2, 2, 38, 15, 18, 15, 50, 0, 0, 128, 74, 
+14, 3, 0, 21, 14, 2, 0, 22, 14, 0, 14, 60, 13, 14, 2, 21, 
+14, 3, 0, 22, 14, 0, 14, 57, 15, 11, 11, 18, 17, 12, 0, 18, 
+18, 0, 0, 66, 15, 3, 2, 60, 15, 14, 3, 69, 8, 3, 3, 82, 
+8, 205, 127, 54, 5, 12, 0, 18, 7, 0, 0, 18, 8, 3, 0, 66, 
+5, 3, 1, 18, 5, 4, 0, 50, 0, 0, 128, 68, 5, 1, 0, 8, 
+192, 16, 192, 37, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 85, 115, 
+105, 110, 103, 77, 117, 108, 116, 105, 112, 108, 101, 67, 97, 108, 108, 98, 
+97, 99, 107, 115, 13, 99, 97, 108, 108, 98, 97, 99, 107, 13, 116, 111, 
+115, 116, 114, 105, 110, 103, 7, 58, 32, 36, 117, 110, 97, 98, 108, 101, 
+32, 116, 111, 32, 111, 112, 101, 110, 32, 116, 104, 101, 32, 111, 117, 116, 
+112, 117, 116, 32, 102, 105, 108, 101, 32, 9, 111, 112, 101, 110, 6, 39, 
+31, 100, 111, 110, 39, 116, 32, 107, 110, 111, 119, 32, 104, 111, 119, 32, 
+116, 111, 32, 101, 120, 112, 111, 114, 116, 32, 39, 5, 13, 37, 46, 40, 
+37, 119, 42, 41, 36, 10, 109, 97, 116, 99, 104, 11, 105, 112, 97, 105, 
+114, 115, 0, 2, 147, 5, 0, 4, 18, 0, 22, 0, 99, 14, 0, 0, 
+0, 88, 4, 42, 128, 54, 4, 0, 0, 57, 0, 1, 4, 15, 0, 0, 
+0, 88, 4, 17, 128, 18, 6, 0, 0, 57, 4, 2, 0, 39, 7, 3, 
+0, 66, 4, 3, 2, 14, 0, 4, 0, 88, 4, 4, 128, 18, 4, 0, 
+0, 18, 5, 2, 0, 38, 0, 5, 4, 88, 4, 8, 128, 18, 6, 0, 
+0, 57, 4, 4, 0, 39, 7, 3, 0, 18, 8, 2, 0, 66, 4, 4, 
+2, 18, 0, 4, 0, 88, 4, 1, 128, 39, 0, 5, 0, 54, 4, 6, 
+0, 18, 6, 1, 0, 39, 7, 7, 0, 43, 8, 2, 0, 18, 9, 0, 
+0, 66, 4, 5, 2, 18, 0, 4, 0, 14, 0, 0, 0, 88, 4, 2, 
+128, 43, 4, 1, 0, 76, 4, 2, 0, 18, 6, 0, 0, 57, 4, 2, 
+0, 39, 7, 8, 0, 66, 4, 3, 2, 15, 0, 4, 0, 88, 5, 3, 
+128, 18, 4, 0, 0, 18, 5, 2, 0, 38, 0, 5, 4, 54, 4, 9, 
+0, 39, 6, 10, 0, 66, 4, 2, 1, 54, 4, 11, 0, 18, 6, 0, 
+0, 66, 4, 2, 3, 14, 0, 4, 0, 88, 6, 11, 128, 54, 6, 12, 
+0, 43, 8, 0, 0, 39, 9, 13, 0, 18, 10, 5, 0, 39, 11, 14, 
+0, 38, 9, 11, 9, 66, 6, 3, 1, 54, 6, 15, 0, 66, 6, 1, 
+1, 43, 6, 1, 0, 76, 6, 2, 0, 18, 6, 3, 0, 18, 8, 4, 
+0, 54, 9, 0, 0, 66, 6, 3, 2, 54, 7, 16, 0, 18, 9, 6, 
+0, 66, 7, 2, 2, 7, 7, 17, 0, 88, 7, 4, 128, 54, 7, 18, 
+0, 54, 9, 0, 0, 18, 10, 6, 0, 66, 7, 3, 1, 18, 7, 5, 
+0, 66, 7, 1, 3, 14, 0, 7, 0, 88, 9, 15, 128, 54, 9, 12, 
+0, 43, 11, 0, 0, 39, 12, 19, 0, 18, 13, 0, 0, 39, 14, 20, 
+0, 54, 15, 21, 0, 18, 17, 8, 0, 66, 15, 2, 2, 39, 16, 14, 
+0, 38, 12, 16, 12, 66, 9, 3, 1, 54, 9, 15, 0, 66, 9, 1, 
+1, 43, 9, 1, 0, 76, 9, 2, 0, 54, 9, 15, 0, 66, 9, 1, 
+1, 43, 9, 2, 0, 76, 9, 2, 0, 13, 116, 111, 115, 116, 114, 105, 
+110, 103, 7, 58, 32, 37, 85, 110, 97, 98, 108, 101, 32, 116, 111, 32, 
+119, 114, 105, 116, 101, 32, 116, 104, 101, 32, 111, 117, 116, 112, 117, 116, 
+32, 102, 105, 108, 101, 32, 29, 69, 120, 112, 111, 114, 116, 70, 105, 108, 
+101, 85, 115, 105, 110, 103, 67, 97, 108, 108, 98, 97, 99, 107, 115, 10, 
+116, 97, 98, 108, 101, 9, 116, 121, 112, 101, 16, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 6, 46, 36, 85, 110, 97, 98, 108, 101, 32, 
+116, 111, 32, 111, 112, 101, 110, 32, 116, 104, 101, 32, 111, 117, 116, 112, 
+117, 116, 32, 102, 105, 108, 101, 32, 17, 77, 111, 100, 97, 108, 77, 101, 
+115, 115, 97, 103, 101, 19, 79, 112, 101, 110, 69, 120, 112, 111, 114, 116, 
+70, 105, 108, 101, 17, 69, 120, 112, 111, 114, 116, 105, 110, 103, 46, 46, 
+46, 21, 73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 
+103, 101, 12, 47, 91, 94, 46, 93, 42, 36, 15, 69, 120, 112, 111, 114, 
+116, 32, 97, 115, 58, 16, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 
+114, 14, 40, 117, 110, 110, 97, 109, 101, 100, 41, 9, 103, 115, 117, 98, 
+10, 37, 46, 46, 45, 36, 9, 102, 105, 110, 100, 9, 110, 97, 109, 101, 
+13, 68, 111, 99, 117, 109, 101, 110, 116, 245, 3, 3, 0, 18, 0, 33, 
+1, 49, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 
+2, 1, 54, 2, 0, 0, 57, 2, 3, 2, 54, 3, 0, 0, 57, 3, 
+4, 3, 54, 4, 5, 0, 57, 4, 6, 4, 54, 5, 5, 0, 57, 5, 
+7, 5, 54, 6, 5, 0, 57, 6, 8, 6, 54, 7, 5, 0, 57, 7, 
+9, 7, 54, 8, 10, 0, 57, 8, 11, 8, 54, 9, 0, 0, 57, 9, 
+12, 9, 54, 10, 0, 0, 57, 10, 13, 10, 42, 11, 0, 0, 54, 12, 
+14, 0, 52, 14, 0, 0, 53, 15, 15, 0, 66, 12, 3, 2, 41, 13, 
+0, 0, 41, 14, 0, 0, 51, 15, 16, 0, 51, 16, 17, 0, 55, 16, 
+18, 0, 51, 16, 19, 0, 55, 16, 20, 0, 51, 16, 21, 0, 55, 16, 
+22, 0, 52, 16, 0, 0, 51, 17, 23, 0, 55, 17, 24, 0, 51, 17, 
+25, 0, 55, 17, 26, 0, 51, 17, 27, 0, 55, 17, 28, 0, 51, 17, 
+29, 0, 55, 17, 30, 0, 51, 17, 31, 0, 55, 17, 32, 0, 50, 0, 
+0, 128, 75, 0, 1, 0, 21, 69, 120, 112, 111, 114, 116, 70, 105, 108, 
+101, 87, 105, 116, 104, 85, 73, 0, 26, 69, 120, 112, 111, 114, 116, 84, 
+111, 77, 117, 108, 116, 105, 112, 108, 101, 70, 105, 108, 101, 115, 0, 16, 
+71, 101, 116, 69, 120, 112, 111, 114, 116, 101, 114, 0, 21, 82, 101, 103, 
+105, 115, 116, 101, 114, 69, 120, 112, 111, 114, 116, 101, 114, 0, 19, 79, 
+112, 101, 110, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 0, 29, 69, 
+120, 112, 111, 114, 116, 70, 105, 108, 101, 85, 115, 105, 110, 103, 67, 97, 
+108, 108, 98, 97, 99, 107, 115, 0, 37, 69, 120, 112, 111, 114, 116, 70, 
+105, 108, 101, 85, 115, 105, 110, 103, 77, 117, 108, 116, 105, 112, 108, 101, 
+67, 97, 108, 108, 98, 97, 99, 107, 115, 0, 32, 71, 101, 116, 69, 120, 
+112, 111, 114, 116, 70, 114, 97, 103, 109, 101, 110, 116, 67, 97, 99, 104, 
+101, 83, 116, 97, 116, 115, 0, 0, 1, 0, 1, 11, 95, 95, 109, 111, 
+100, 101, 6, 107, 17, 115, 101, 116, 109, 101, 116, 97, 116, 97, 98, 108, 
+101, 17, 99, 114, 101, 97, 116, 101, 98, 117, 102, 102, 101, 114, 9, 116, 
+105, 109, 101, 10, 108, 111, 119, 101, 114, 11, 115, 116, 114, 105, 110, 103, 
+10, 98, 116, 101, 115, 116, 9, 98, 120, 111, 114, 8, 98, 111, 114, 9, 
+98, 97, 110, 100, 10, 98, 105, 116, 51, 50, 14, 112, 97, 114, 115, 101, 
+119, 111, 114, 100, 9, 66, 79, 76, 68, 14, 85, 78, 68, 69, 82, 76, 
+73, 78, 69, 11, 73, 84, 65, 76, 73, 67, 7, 119, 103, 128, 128, 8, 
+0, 
+};
+
+/* This is src/lua/export/text.lua */
+static const char file_17[] = {
+27, 76, 74, 2, 10, 11, 0, 0, 1, 0, 0, 0, 1, 75, 0, 1, 
+0, 25, 0, 1, 4, 1, 0, 0, 4, 45, 1, 0, 0, 18, 3, 0, 
+0, 66, 1, 2, 1, 75, 0, 1, 0, 0, 192, 11, 0, 1, 1, 0, 
+0, 0, 1, 75, 0, 1, 0, 11, 0, 0, 1, 0, 0, 0, 1, 75, 
+0, 1, 0, 11, 0, 0, 1, 0, 0, 0, 1, 75, 0, 1, 0, 11, 
+0, 1, 1, 0, 0, 0, 1, 75, 0, 1, 0, 27, 0, 1, 4, 1, 
+1, 0, 4, 45, 1, 0, 0, 39, 3, 0, 0, 66, 1, 2, 1, 75, 
+0, 1, 0, 0, 192, 6, 10, 11, 0, 0, 1, 0, 0, 0, 1, 75, 
+0, 1, 0, 165, 2, 1, 2, 4, 1, 18, 0, 21, 53, 2, 1, 0, 
+51, 3, 0, 0, 61, 3, 2, 2, 45, 3, 0, 0, 61, 3, 3, 2, 
+51, 3, 4, 0, 61, 3, 5, 2, 51, 3, 6, 0, 61, 3, 7, 2, 
+51, 3, 8, 0, 61, 3, 9, 2, 51, 3, 10, 0, 61, 3, 11, 2, 
+51, 3, 12, 0, 61, 3, 13, 2, 51, 3, 14, 0, 61, 3, 15, 2, 
+51, 3, 16, 0, 61, 3, 17, 2, 50, 0, 0, 128, 76, 2, 2, 0, 
+0, 192, 13, 101, 112, 105, 108, 111, 103, 117, 101, 0, 18, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 0, 20, 112, 97, 114, 97, 
+103, 114, 97, 112, 104, 95, 115, 116, 97, 114, 116, 0, 13, 108, 105, 115, 
+116, 95, 101, 110, 100, 0, 15, 108, 105, 115, 116, 95, 115, 116, 97, 114, 
+116, 0, 11, 110, 111, 116, 101, 120, 116, 0, 12, 114, 97, 119, 116, 101, 
+120, 116, 0, 11, 102, 111, 114, 109, 97, 116, 13, 112, 114, 111, 108, 111, 
+103, 117, 101, 1, 0, 9, 15, 108, 105, 115, 116, 95, 115, 116, 97, 114, 
+116, 0, 11, 110, 111, 116, 101, 120, 116, 0, 20, 112, 97, 114, 97, 103, 
+114, 97, 112, 104, 95, 115, 116, 97, 114, 116, 0, 13, 108, 105, 115, 116, 
+95, 101, 110, 100, 0, 13, 112, 114, 111, 108, 111, 103, 117, 101, 0, 11, 
+102, 111, 114, 109, 97, 116, 0, 12, 114, 97, 119, 116, 101, 120, 116, 0, 
+13, 101, 112, 105, 108, 111, 103, 117, 101, 0, 18, 112, 97, 114, 97, 103, 
+114, 97, 112, 104, 95, 101, 110, 100, 0, 0, 72, 0, 1, 7, 1, 3, 
+0, 6, 54, 1, 0, 0, 18, 3, 0, 0, 39, 4, 1, 0, 39, 5, 
+2, 0, 45, 6, 0, 0, 68, 1, 5, 0, 1, 192, 9, 46, 116, 120, 
+116, 21, 69, 120, 112, 111, 114, 116, 32, 84, 101, 120, 116, 32, 70, 105, 
+108, 101, 21, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 87, 105, 116, 
+104, 85, 73, 127, 3, 0, 6, 0, 8, 0, 14, 54, 0, 0, 0, 57, 
+0, 1, 0, 52, 2, 0, 0, 66, 0, 2, 2, 51, 1, 2, 0, 54, 
+2, 3, 0, 51, 3, 5, 0, 61, 3, 4, 2, 54, 2, 6, 0, 39, 
+4, 7, 0, 18, 5, 1, 0, 66, 2, 3, 1, 50, 0, 0, 128, 75, 
+0, 1, 0, 8, 116, 120, 116, 21, 82, 101, 103, 105, 115, 116, 101, 114, 
+69, 120, 112, 111, 114, 116, 101, 114, 0, 19, 69, 120, 112, 111, 114, 116, 
+84, 101, 120, 116, 70, 105, 108, 101, 8, 67, 109, 100, 0, 23, 99, 114, 
+101, 97, 116, 101, 101, 120, 112, 111, 114, 116, 102, 111, 114, 109, 97, 116, 
+7, 119, 103, 0, 
+};
+
+/* This is src/lua/export/html.lua */
+static const char file_18[] = {
+27, 76, 74, 2, 10, 207, 2, 0, 1, 6, 5, 9, 0, 40, 45, 1, 
+0, 0, 52, 3, 7, 0, 57, 4, 0, 0, 62, 4, 1, 3, 57, 4, 
+1, 0, 62, 4, 2, 3, 57, 4, 2, 0, 62, 4, 3, 3, 57, 4, 
+3, 0, 62, 4, 4, 3, 57, 4, 4, 0, 62, 4, 5, 3, 57, 4, 
+5, 0, 62, 4, 6, 3, 39, 4, 6, 0, 66, 1, 3, 2, 45, 2, 
+1, 0, 4, 1, 2, 0, 88, 2, 19, 128, 45, 2, 3, 0, 53, 4, 
+7, 0, 57, 5, 0, 0, 61, 5, 0, 4, 57, 5, 1, 0, 61, 5, 
+1, 4, 57, 5, 2, 0, 61, 5, 2, 4, 57, 5, 3, 0, 61, 5, 
+3, 4, 57, 5, 4, 0, 61, 5, 4, 4, 57, 5, 5, 0, 61, 5, 
+5, 4, 45, 5, 4, 0, 61, 5, 8, 4, 66, 2, 2, 2, 46, 2, 
+2, 0, 46, 1, 1, 0, 45, 2, 2, 0, 76, 2, 2, 0, 1, 192, 
+5, 128, 4, 128, 0, 192, 2, 192, 12, 101, 115, 99, 97, 112, 101, 115, 
+1, 0, 7, 13, 98, 111, 108, 100, 95, 111, 102, 102, 0, 12, 98, 111, 
+108, 100, 95, 111, 110, 0, 18, 117, 110, 100, 101, 114, 108, 105, 110, 101, 
+95, 111, 102, 102, 0, 17, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 
+111, 110, 0, 15, 105, 116, 97, 108, 105, 99, 95, 111, 102, 102, 0, 14, 
+105, 116, 97, 108, 105, 99, 95, 111, 110, 0, 12, 101, 115, 99, 97, 112, 
+101, 115, 0, 6, 0, 13, 98, 111, 108, 100, 95, 111, 102, 102, 12, 98, 
+111, 108, 100, 95, 111, 110, 18, 117, 110, 100, 101, 114, 108, 105, 110, 101, 
+95, 111, 102, 102, 17, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 111, 
+110, 15, 105, 116, 97, 108, 105, 99, 95, 111, 102, 102, 14, 105, 116, 97, 
+108, 105, 99, 95, 111, 110, 154, 2, 0, 1, 6, 4, 7, 0, 59, 45, 
+1, 0, 0, 45, 2, 1, 0, 56, 1, 2, 1, 45, 2, 0, 0, 56, 
+2, 0, 2, 45, 3, 1, 0, 5, 0, 3, 0, 88, 3, 8, 128, 15, 
+0, 0, 0, 88, 3, 6, 128, 57, 3, 0, 1, 15, 0, 3, 0, 88, 
+3, 3, 128, 57, 3, 0, 2, 14, 0, 3, 0, 88, 3, 39, 128, 15, 
+0, 1, 0, 88, 3, 3, 128, 45, 3, 2, 0, 57, 5, 1, 1, 66, 
+3, 2, 1, 45, 3, 2, 0, 39, 5, 2, 0, 66, 3, 2, 1, 15, 
+0, 2, 0, 88, 3, 3, 128, 57, 3, 3, 2, 14, 0, 3, 0, 88, 
+3, 7, 128, 45, 3, 3, 0, 15, 0, 3, 0, 88, 4, 4, 128, 45, 
+3, 2, 0, 39, 5, 4, 0, 66, 3, 2, 1, 49, 3, 1, 0, 15, 
+0, 2, 0, 88, 3, 10, 128, 57, 3, 3, 2, 15, 0, 3, 0, 88, 
+4, 7, 128, 45, 3, 3, 0, 14, 0, 3, 0, 88, 3, 4, 128, 45, 
+3, 2, 0, 39, 5, 5, 0, 66, 3, 2, 1, 49, 3, 2, 0, 15, 
+0, 2, 0, 88, 3, 3, 128, 45, 3, 2, 0, 57, 5, 6, 2, 66, 
+3, 2, 1, 46, 1, 0, 0, 88, 3, 3, 128, 45, 3, 2, 0, 39, 
+5, 2, 0, 66, 3, 2, 1, 75, 0, 1, 0, 1, 0, 3, 128, 0, 
+192, 4, 128, 7, 111, 110, 10, 60, 117, 108, 62, 10, 11, 60, 47, 117, 
+108, 62, 10, 9, 108, 105, 115, 116, 6, 10, 8, 111, 102, 102, 8, 112, 
+114, 101, 212, 2, 0, 0, 7, 3, 10, 0, 26, 45, 0, 0, 0, 39, 
+2, 0, 0, 66, 0, 2, 1, 45, 0, 0, 0, 39, 2, 1, 0, 66, 
+0, 2, 1, 45, 0, 0, 0, 39, 2, 2, 0, 54, 3, 3, 0, 39, 
+4, 4, 0, 38, 2, 4, 2, 66, 0, 2, 1, 45, 0, 0, 0, 39, 
+2, 5, 0, 45, 3, 1, 0, 18, 5, 3, 0, 57, 3, 6, 3, 45, 
+6, 2, 0, 57, 6, 7, 6, 66, 3, 3, 2, 39, 4, 8, 0, 66, 
+0, 4, 1, 45, 0, 0, 0, 39, 2, 9, 0, 66, 0, 2, 1, 75, 
+0, 1, 0, 0, 192, 5, 192, 1, 192, 19, 60, 47, 104, 101, 97, 100, 
+62, 60, 98, 111, 100, 121, 62, 10, 14, 60, 47, 116, 105, 116, 108, 101, 
+62, 10, 9, 110, 97, 109, 101, 11, 101, 115, 99, 97, 112, 101, 12, 60, 
+116, 105, 116, 108, 101, 62, 9, 34, 47, 62, 10, 12, 86, 69, 82, 83, 
+73, 79, 78, 49, 60, 109, 101, 116, 97, 32, 110, 97, 109, 101, 61, 34, 
+103, 101, 110, 101, 114, 97, 116, 111, 114, 34, 32, 99, 111, 110, 116, 101, 
+110, 116, 61, 34, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 32, 
+73, 60, 109, 101, 116, 97, 32, 104, 116, 116, 112, 45, 101, 113, 117, 105, 
+118, 61, 34, 67, 111, 110, 116, 101, 110, 116, 45, 84, 121, 112, 101, 34, 
+32, 99, 111, 110, 116, 101, 110, 116, 61, 34, 116, 101, 120, 116, 47, 104, 
+116, 109, 108, 59, 99, 104, 97, 114, 115, 101, 116, 61, 117, 116, 102, 45, 
+56, 34, 47, 62, 10, 55, 60, 104, 116, 109, 108, 32, 120, 109, 108, 110, 
+115, 61, 34, 104, 116, 116, 112, 58, 47, 47, 119, 119, 119, 46, 119, 51, 
+46, 111, 114, 103, 47, 49, 57, 57, 57, 47, 120, 104, 116, 109, 108, 34, 
+62, 60, 104, 101, 97, 100, 62, 10, 25, 0, 1, 4, 1, 0, 0, 4, 
+45, 1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 1, 75, 0, 1, 0, 
+0, 192, 49, 0, 1, 4, 2, 2, 0, 7, 45, 1, 0, 0, 6, 1, 
+0, 0, 88, 1, 3, 128, 45, 1, 1, 0, 39, 3, 1, 0, 66, 1, 
+2, 1, 75, 0, 1, 0, 3, 128, 0, 192, 10, 60, 98, 114, 47, 62, 
+8, 80, 82, 69, 11, 0, 0, 1, 0, 0, 0, 1, 75, 0, 1, 0, 
+11, 0, 0, 1, 0, 0, 0, 1, 75, 0, 1, 0, 25, 0, 1, 4, 
+1, 0, 0, 4, 45, 1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 1, 
+75, 0, 1, 0, 6, 192, 11, 0, 1, 1, 0, 0, 0, 1, 75, 0, 
+1, 0, 69, 0, 0, 3, 2, 2, 0, 10, 45, 0, 0, 0, 43, 2, 
+0, 0, 66, 0, 2, 1, 45, 0, 1, 0, 39, 2, 0, 0, 66, 0, 
+2, 1, 45, 0, 1, 0, 39, 2, 1, 0, 66, 0, 2, 1, 75, 0, 
+1, 0, 6, 192, 0, 192, 13, 60, 47, 104, 116, 109, 108, 62, 10, 13, 
+60, 47, 98, 111, 100, 121, 62, 10, 230, 2, 1, 2, 9, 2, 22, 0, 
+29, 54, 2, 0, 0, 57, 2, 1, 2, 57, 2, 2, 2, 43, 3, 0, 
+0, 43, 4, 1, 0, 45, 5, 0, 0, 18, 7, 2, 0, 66, 5, 2, 
+2, 51, 6, 3, 0, 53, 7, 5, 0, 51, 8, 4, 0, 61, 8, 6, 
+7, 61, 5, 7, 7, 51, 8, 8, 0, 61, 8, 9, 7, 51, 8, 10, 
+0, 61, 8, 11, 7, 51, 8, 12, 0, 61, 8, 13, 7, 51, 8, 14, 
+0, 61, 8, 15, 7, 51, 8, 16, 0, 61, 8, 17, 7, 51, 8, 18, 
+0, 61, 8, 19, 7, 51, 8, 20, 0, 61, 8, 21, 7, 50, 0, 0, 
+128, 76, 7, 2, 0, 6, 192, 3, 192, 13, 101, 112, 105, 108, 111, 103, 
+117, 101, 0, 18, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 110, 
+100, 0, 20, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 115, 116, 97, 
+114, 116, 0, 13, 108, 105, 115, 116, 95, 101, 110, 100, 0, 15, 108, 105, 
+115, 116, 95, 115, 116, 97, 114, 116, 0, 11, 110, 111, 116, 101, 120, 116, 
+0, 12, 114, 97, 119, 116, 101, 120, 116, 0, 11, 102, 111, 114, 109, 97, 
+116, 13, 112, 114, 111, 108, 111, 103, 117, 101, 1, 0, 9, 13, 108, 105, 
+115, 116, 95, 101, 110, 100, 0, 11, 102, 111, 114, 109, 97, 116, 0, 13, 
+101, 112, 105, 108, 111, 103, 117, 101, 0, 18, 112, 97, 114, 97, 103, 114, 
+97, 112, 104, 95, 101, 110, 100, 0, 20, 112, 97, 114, 97, 103, 114, 97, 
+112, 104, 95, 115, 116, 97, 114, 116, 0, 13, 112, 114, 111, 108, 111, 103, 
+117, 101, 0, 15, 108, 105, 115, 116, 95, 115, 116, 97, 114, 116, 0, 11, 
+110, 111, 116, 101, 120, 116, 0, 12, 114, 97, 119, 116, 101, 120, 116, 0, 
+0, 0, 15, 104, 116, 109, 108, 101, 120, 112, 111, 114, 116, 11, 97, 100, 
+100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+73, 0, 1, 7, 1, 3, 0, 6, 54, 1, 0, 0, 18, 3, 0, 0, 
+39, 4, 1, 0, 39, 5, 2, 0, 45, 6, 0, 0, 68, 1, 5, 0, 
+7, 192, 10, 46, 104, 116, 109, 108, 21, 69, 120, 112, 111, 114, 116, 32, 
+72, 84, 77, 76, 32, 70, 105, 108, 101, 21, 69, 120, 112, 111, 114, 116, 
+70, 105, 108, 101, 87, 105, 116, 104, 85, 73, 224, 1, 0, 0, 2, 0, 
+8, 0, 23, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 
+1, 1, 1, 57, 1, 2, 1, 14, 0, 1, 0, 88, 2, 1, 128, 53, 
+1, 3, 0, 61, 1, 2, 0, 54, 0, 0, 0, 57, 0, 1, 0, 57, 
+0, 2, 0, 57, 1, 4, 0, 14, 0, 1, 0, 88, 2, 1, 128, 39, 
+1, 5, 0, 61, 1, 4, 0, 57, 1, 6, 0, 14, 0, 1, 0, 88, 
+2, 1, 128, 39, 1, 7, 0, 61, 1, 6, 0, 75, 0, 1, 0, 9, 
+60, 47, 98, 62, 13, 98, 111, 108, 100, 95, 111, 102, 102, 8, 60, 98, 
+62, 12, 98, 111, 108, 100, 95, 111, 110, 1, 0, 4, 15, 105, 116, 97, 
+108, 105, 99, 95, 111, 102, 102, 9, 60, 47, 105, 62, 14, 105, 116, 97, 
+108, 105, 99, 95, 111, 110, 8, 60, 105, 62, 18, 117, 110, 100, 101, 114, 
+108, 105, 110, 101, 95, 111, 102, 102, 9, 60, 47, 117, 62, 17, 117, 110, 
+100, 101, 114, 108, 105, 110, 101, 95, 111, 110, 8, 60, 117, 62, 15, 104, 
+116, 109, 108, 101, 120, 112, 111, 114, 116, 11, 97, 100, 100, 111, 110, 115, 
+16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 171, 10, 0, 0, 
+13, 0, 33, 0, 125, 54, 0, 0, 0, 57, 0, 1, 0, 57, 0, 2, 
+0, 54, 1, 3, 0, 57, 1, 4, 1, 53, 3, 5, 0, 57, 4, 6, 
+0, 61, 4, 7, 3, 66, 1, 2, 2, 54, 2, 3, 0, 57, 2, 4, 
+2, 53, 4, 8, 0, 57, 5, 9, 0, 61, 5, 7, 4, 66, 2, 2, 
+2, 54, 3, 3, 0, 57, 3, 4, 3, 53, 5, 10, 0, 57, 6, 11, 
+0, 61, 6, 7, 5, 66, 3, 2, 2, 54, 4, 3, 0, 57, 4, 4, 
+4, 53, 6, 12, 0, 57, 7, 13, 0, 61, 7, 7, 6, 66, 4, 2, 
+2, 54, 5, 3, 0, 57, 5, 4, 5, 53, 7, 14, 0, 57, 8, 15, 
+0, 61, 8, 7, 7, 66, 5, 2, 2, 54, 6, 3, 0, 57, 6, 4, 
+6, 53, 8, 16, 0, 57, 9, 17, 0, 61, 9, 7, 8, 66, 6, 2, 
+2, 53, 7, 18, 0, 54, 8, 3, 0, 57, 8, 19, 8, 61, 8, 20, 
+7, 54, 8, 3, 0, 57, 8, 21, 8, 53, 10, 22, 0, 54, 11, 3, 
+0, 57, 11, 23, 11, 61, 11, 24, 10, 66, 8, 2, 2, 62, 8, 1, 
+7, 62, 1, 2, 7, 54, 8, 3, 0, 57, 8, 21, 8, 53, 10, 25, 
+0, 54, 11, 3, 0, 57, 11, 23, 11, 61, 11, 24, 10, 66, 8, 2, 
+2, 62, 8, 3, 7, 62, 2, 4, 7, 54, 8, 3, 0, 57, 8, 21, 
+8, 53, 10, 26, 0, 54, 11, 3, 0, 57, 11, 23, 11, 61, 11, 24, 
+10, 66, 8, 2, 2, 62, 8, 5, 7, 62, 3, 6, 7, 54, 8, 3, 
+0, 57, 8, 21, 8, 53, 10, 27, 0, 54, 11, 3, 0, 57, 11, 23, 
+11, 61, 11, 24, 10, 66, 8, 2, 2, 62, 8, 7, 7, 62, 4, 8, 
+7, 54, 8, 3, 0, 57, 8, 21, 8, 53, 10, 28, 0, 54, 11, 3, 
+0, 57, 11, 23, 11, 61, 11, 24, 10, 66, 8, 2, 2, 62, 8, 9, 
+7, 62, 5, 10, 7, 54, 8, 3, 0, 57, 8, 21, 8, 53, 10, 29, 
+0, 54, 11, 3, 0, 57, 11, 23, 11, 61, 11, 24, 10, 66, 8, 2, 
+2, 62, 8, 11, 7, 62, 6, 12, 7, 85, 8, 25, 128, 54, 8, 3, 
+0, 57, 8, 30, 8, 18, 10, 7, 0, 54, 11, 31, 0, 39, 12, 32, 
+0, 66, 8, 4, 2, 14, 0, 8, 0, 88, 9, 2, 128, 43, 9, 1, 
+0, 76, 9, 2, 0, 57, 9, 7, 1, 61, 9, 6, 0, 57, 9, 7, 
+2, 61, 9, 9, 0, 57, 9, 7, 3, 61, 9, 11, 0, 57, 9, 7, 
+4, 61, 9, 13, 0, 57, 9, 7, 5, 61, 9, 15, 0, 57, 9, 7, 
+6, 61, 9, 17, 0, 43, 9, 2, 0, 76, 9, 2, 0, 88, 8, 230, 
+127, 43, 8, 1, 0, 76, 8, 2, 0, 57, 83, 80, 65, 67, 69, 32, 
+116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 84, 85, 82, 
+78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 84, 
+82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 17, 82, 
+101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 8, 82, 117, 110, 1, 
+0, 6, 10, 118, 97, 108, 117, 101, 14, 66, 111, 108, 100, 32, 111, 102, 
+102, 58, 7, 121, 50, 3, 11, 7, 120, 50, 3, 32, 7, 121, 49, 3, 
+11, 7, 120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 1, 0, 6, 
+10, 118, 97, 108, 117, 101, 13, 66, 111, 108, 100, 32, 111, 110, 58, 7, 
+121, 50, 3, 9, 7, 120, 50, 3, 32, 7, 121, 49, 3, 9, 7, 120, 
+49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 1, 0, 6, 10, 118, 97, 
+108, 117, 101, 17, 73, 116, 97, 108, 105, 99, 115, 32, 111, 102, 102, 58, 
+7, 121, 50, 3, 7, 7, 120, 50, 3, 32, 7, 121, 49, 3, 7, 7, 
+120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 1, 0, 6, 10, 118, 
+97, 108, 117, 101, 16, 73, 116, 97, 108, 105, 99, 115, 32, 111, 110, 58, 
+7, 121, 50, 3, 5, 7, 120, 50, 3, 32, 7, 121, 49, 3, 5, 7, 
+120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 1, 0, 6, 10, 118, 
+97, 108, 117, 101, 19, 85, 110, 100, 101, 114, 108, 105, 110, 101, 32, 111, 
+102, 102, 58, 7, 121, 50, 3, 3, 7, 120, 50, 3, 32, 7, 121, 49, 
+3, 3, 7, 120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 10, 97, 
+108, 105, 103, 110, 9, 76, 101, 102, 116, 1, 0, 6, 10, 118, 97, 108, 
+117, 101, 18, 85, 110, 100, 101, 114, 108, 105, 110, 101, 32, 111, 110, 58, 
+7, 121, 50, 3, 1, 7, 120, 50, 3, 32, 7, 121, 49, 3, 1, 7, 
+120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 10, 76, 97, 98, 101, 
+108, 10, 119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 1, 0, 7, 
+14, 75, 69, 89, 95, 69, 78, 84, 69, 82, 12, 99, 111, 110, 102, 105, 
+114, 109, 10, 116, 105, 116, 108, 101, 26, 67, 111, 110, 102, 105, 103, 117, 
+114, 101, 32, 72, 84, 77, 76, 32, 69, 120, 112, 111, 114, 116, 15, 75, 
+69, 89, 95, 82, 69, 84, 85, 82, 78, 12, 99, 111, 110, 102, 105, 114, 
+109, 11, 75, 69, 89, 95, 94, 67, 11, 99, 97, 110, 99, 101, 108, 13, 
+115, 116, 114, 101, 116, 99, 104, 121, 1, 11, 104, 101, 105, 103, 104, 116, 
+3, 13, 10, 119, 105, 100, 116, 104, 0, 13, 98, 111, 108, 100, 95, 111, 
+102, 102, 1, 0, 5, 10, 118, 97, 108, 117, 101, 0, 7, 121, 50, 3, 
+11, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 121, 49, 3, 11, 7, 
+120, 49, 3, 16, 12, 98, 111, 108, 100, 95, 111, 110, 1, 0, 5, 10, 
+118, 97, 108, 117, 101, 0, 7, 121, 50, 3, 9, 7, 120, 50, 3, 255, 
+255, 255, 255, 15, 7, 121, 49, 3, 9, 7, 120, 49, 3, 16, 15, 105, 
+116, 97, 108, 105, 99, 95, 111, 102, 102, 1, 0, 5, 10, 118, 97, 108, 
+117, 101, 0, 7, 121, 50, 3, 7, 7, 120, 50, 3, 255, 255, 255, 255, 
+15, 7, 121, 49, 3, 7, 7, 120, 49, 3, 16, 14, 105, 116, 97, 108, 
+105, 99, 95, 111, 110, 1, 0, 5, 10, 118, 97, 108, 117, 101, 0, 7, 
+121, 50, 3, 5, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 121, 49, 
+3, 5, 7, 120, 49, 3, 16, 18, 117, 110, 100, 101, 114, 108, 105, 110, 
+101, 95, 111, 102, 102, 1, 0, 5, 10, 118, 97, 108, 117, 101, 0, 7, 
+121, 50, 3, 3, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 121, 49, 
+3, 3, 7, 120, 49, 3, 16, 10, 118, 97, 108, 117, 101, 17, 117, 110, 
+100, 101, 114, 108, 105, 110, 101, 95, 111, 110, 1, 0, 5, 10, 118, 97, 
+108, 117, 101, 0, 7, 121, 50, 3, 1, 7, 120, 50, 3, 255, 255, 255, 
+255, 15, 7, 121, 49, 3, 1, 7, 120, 49, 3, 16, 14, 84, 101, 120, 
+116, 70, 105, 101, 108, 100, 9, 70, 111, 114, 109, 15, 104, 116, 109, 108, 
+101, 120, 112, 111, 114, 116, 11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 209, 6, 3, 0, 13, 0, 41, 
+0, 49, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 2, 0, 57, 1, 
+3, 1, 53, 2, 4, 0, 53, 3, 6, 0, 53, 4, 5, 0, 61, 4, 
+7, 3, 53, 4, 8, 0, 61, 4, 9, 3, 53, 4, 10, 0, 61, 4, 
+11, 3, 53, 4, 12, 0, 61, 4, 13, 3, 53, 4, 14, 0, 61, 4, 
+15, 3, 53, 4, 16, 0, 61, 4, 17, 3, 53, 4, 18, 0, 61, 4, 
+19, 3, 53, 4, 20, 0, 61, 4, 21, 3, 53, 4, 22, 0, 61, 4, 
+23, 3, 53, 4, 24, 0, 61, 4, 25, 3, 53, 4, 26, 0, 61, 4, 
+27, 3, 44, 4, 5, 0, 51, 6, 28, 0, 51, 7, 29, 0, 54, 8, 
+30, 0, 51, 9, 32, 0, 61, 9, 31, 8, 54, 8, 33, 0, 39, 10, 
+34, 0, 18, 11, 7, 0, 66, 8, 3, 1, 51, 8, 35, 0, 54, 9, 
+36, 0, 54, 11, 37, 0, 57, 11, 38, 11, 18, 12, 8, 0, 66, 9, 
+3, 1, 54, 8, 30, 0, 51, 9, 40, 0, 61, 9, 39, 8, 50, 0, 
+0, 128, 75, 0, 1, 0, 0, 24, 67, 111, 110, 102, 105, 103, 117, 114, 
+101, 72, 84, 77, 76, 69, 120, 112, 111, 114, 116, 19, 82, 101, 103, 105, 
+115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 10, 69, 118, 101, 110, 116, 
+21, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 
+114, 0, 9, 104, 116, 109, 108, 21, 82, 101, 103, 105, 115, 116, 101, 114, 
+69, 120, 112, 111, 114, 116, 101, 114, 0, 19, 69, 120, 112, 111, 114, 116, 
+72, 84, 77, 76, 70, 105, 108, 101, 8, 67, 109, 100, 0, 0, 8, 80, 
+82, 69, 1, 0, 4, 9, 108, 105, 115, 116, 1, 8, 112, 114, 101, 2, 
+7, 111, 110, 10, 60, 112, 114, 101, 62, 8, 111, 102, 102, 11, 60, 47, 
+112, 114, 101, 62, 8, 82, 65, 87, 1, 0, 4, 9, 108, 105, 115, 116, 
+1, 8, 112, 114, 101, 1, 7, 111, 110, 5, 8, 111, 102, 102, 5, 6, 
+86, 1, 0, 4, 9, 108, 105, 115, 116, 1, 8, 112, 114, 101, 1, 7, 
+111, 110, 17, 60, 98, 108, 111, 99, 107, 113, 117, 111, 116, 101, 62, 8, 
+111, 102, 102, 18, 60, 47, 98, 108, 111, 99, 107, 113, 117, 111, 116, 101, 
+62, 6, 81, 1, 0, 4, 9, 108, 105, 115, 116, 1, 8, 112, 114, 101, 
+1, 7, 111, 110, 17, 60, 98, 108, 111, 99, 107, 113, 117, 111, 116, 101, 
+62, 8, 111, 102, 102, 18, 60, 47, 98, 108, 111, 99, 107, 113, 117, 111, 
+116, 101, 62, 7, 76, 66, 1, 0, 4, 9, 108, 105, 115, 116, 2, 8, 
+112, 114, 101, 1, 7, 111, 110, 9, 60, 108, 105, 62, 8, 111, 102, 102, 
+10, 60, 47, 108, 105, 62, 6, 76, 1, 0, 4, 9, 108, 105, 115, 116, 
+2, 8, 112, 114, 101, 1, 7, 111, 110, 40, 60, 108, 105, 32, 115, 116, 
+121, 108, 101, 61, 34, 108, 105, 115, 116, 45, 115, 116, 121, 108, 101, 45, 
+116, 121, 112, 101, 58, 32, 110, 111, 110, 101, 59, 34, 62, 8, 111, 102, 
+102, 10, 60, 47, 108, 105, 62, 6, 80, 1, 0, 4, 9, 108, 105, 115, 
+116, 1, 8, 112, 114, 101, 1, 7, 111, 110, 8, 60, 112, 62, 8, 111, 
+102, 102, 9, 60, 47, 112, 62, 7, 72, 52, 1, 0, 4, 9, 108, 105, 
+115, 116, 1, 8, 112, 114, 101, 1, 7, 111, 110, 9, 60, 104, 52, 62, 
+8, 111, 102, 102, 10, 60, 47, 104, 52, 62, 7, 72, 51, 1, 0, 4, 
+9, 108, 105, 115, 116, 1, 8, 112, 114, 101, 1, 7, 111, 110, 9, 60, 
+104, 51, 62, 8, 111, 102, 102, 10, 60, 47, 104, 51, 62, 7, 72, 50, 
+1, 0, 4, 9, 108, 105, 115, 116, 1, 8, 112, 114, 101, 1, 7, 111, 
+110, 9, 60, 104, 50, 62, 8, 111, 102, 102, 10, 60, 47, 104, 50, 62, 
+7, 72, 49, 1, 0, 11, 6, 76, 0, 6, 80, 0, 8, 80, 82, 69, 
+0, 7, 72, 52, 0, 8, 82, 65, 87, 0, 6, 86, 0, 7, 72, 51, 
+0, 6, 81, 0, 7, 72, 50, 0, 7, 76, 66, 0, 7, 72, 49, 0, 
+1, 0, 4, 9, 108, 105, 115, 116, 1, 8, 112, 114, 101, 1, 7, 111, 
+110, 9, 60, 104, 49, 62, 8, 111, 102, 102, 10, 60, 47, 104, 49, 62, 
+1, 0, 3, 6, 38, 10, 38, 97, 109, 112, 59, 6, 62, 9, 38, 103, 
+116, 59, 6, 60, 9, 38, 108, 116, 59, 11, 99, 111, 110, 99, 97, 116, 
+10, 116, 97, 98, 108, 101, 23, 99, 114, 101, 97, 116, 101, 101, 120, 112, 
+111, 114, 116, 102, 111, 114, 109, 97, 116, 7, 119, 103, 0, 
+};
+
+/* This is src/lua/export/latex.lua */
+static const char file_19[] = {
+27, 76, 74, 2, 10, 157, 3, 0, 0, 7, 2, 16, 0, 39, 45, 0, 
+0, 0, 39, 2, 0, 0, 39, 3, 1, 0, 54, 4, 2, 0, 39, 5, 
+3, 0, 38, 2, 5, 2, 66, 0, 2, 1, 45, 0, 0, 0, 39, 2, 
+4, 0, 66, 0, 2, 1, 45, 0, 0, 0, 39, 2, 5, 0, 66, 0, 
+2, 1, 45, 0, 0, 0, 39, 2, 6, 0, 66, 0, 2, 1, 45, 0, 
+0, 0, 39, 2, 7, 0, 66, 0, 2, 1, 45, 0, 0, 0, 39, 2, 
+8, 0, 66, 0, 2, 1, 45, 0, 0, 0, 39, 2, 9, 0, 45, 3, 
+1, 0, 18, 5, 3, 0, 57, 3, 10, 3, 54, 6, 11, 0, 57, 6, 
+12, 6, 66, 3, 3, 2, 39, 4, 13, 0, 66, 0, 4, 1, 45, 0, 
+0, 0, 39, 2, 14, 0, 66, 0, 2, 1, 45, 0, 0, 0, 39, 2, 
+15, 0, 66, 0, 2, 1, 75, 0, 1, 0, 0, 192, 0, 0, 16, 92, 
+109, 97, 107, 101, 116, 105, 116, 108, 101, 10, 26, 92, 97, 117, 116, 104, 
+111, 114, 123, 40, 110, 111, 32, 97, 117, 116, 104, 111, 114, 41, 125, 10, 
+7, 125, 10, 9, 110, 97, 109, 101, 13, 68, 111, 99, 117, 109, 101, 110, 
+116, 11, 101, 115, 99, 97, 112, 101, 12, 92, 116, 105, 116, 108, 101, 123, 
+22, 92, 98, 101, 103, 105, 110, 123, 100, 111, 99, 117, 109, 101, 110, 116, 
+125, 10, 21, 92, 111, 110, 101, 104, 97, 108, 102, 115, 112, 97, 99, 105, 
+110, 103, 10, 13, 92, 115, 108, 111, 112, 112, 121, 10, 46, 92, 117, 115, 
+101, 112, 97, 99, 107, 97, 103, 101, 123, 120, 117, 110, 105, 99, 111, 100, 
+101, 44, 32, 115, 101, 116, 115, 112, 97, 99, 101, 44, 32, 120, 108, 116, 
+120, 116, 114, 97, 125, 10, 29, 92, 100, 111, 99, 117, 109, 101, 110, 116, 
+99, 108, 97, 115, 115, 123, 97, 114, 116, 105, 99, 108, 101, 125, 10, 7, 
+46, 10, 12, 86, 69, 82, 83, 73, 79, 78, 17, 87, 111, 114, 100, 71, 
+114, 105, 110, 100, 101, 114, 32, 49, 37, 37, 32, 84, 104, 105, 115, 32, 
+100, 111, 99, 117, 109, 101, 110, 116, 32, 97, 117, 116, 111, 109, 97, 116, 
+105, 99, 97, 108, 108, 121, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 
+32, 98, 121, 32, 25, 0, 1, 4, 1, 0, 0, 4, 45, 1, 0, 0, 
+18, 3, 0, 0, 66, 1, 2, 1, 75, 0, 1, 0, 0, 192, 38, 0, 
+1, 4, 1, 1, 0, 4, 45, 1, 0, 0, 39, 3, 0, 0, 66, 1, 
+2, 1, 75, 0, 1, 0, 0, 192, 17, 92, 112, 97, 114, 97, 103, 114, 
+97, 112, 104, 123, 125, 42, 0, 0, 3, 1, 1, 0, 4, 45, 0, 0, 
+0, 39, 2, 0, 0, 66, 0, 2, 1, 75, 0, 1, 0, 0, 192, 21, 
+92, 98, 101, 103, 105, 110, 123, 105, 116, 101, 109, 105, 122, 101, 125, 10, 
+40, 0, 0, 3, 1, 1, 0, 4, 45, 0, 0, 0, 39, 2, 0, 0, 
+66, 0, 2, 1, 75, 0, 1, 0, 0, 192, 19, 92, 101, 110, 100, 123, 
+105, 116, 101, 109, 105, 122, 101, 125, 10, 48, 0, 1, 4, 2, 1, 0, 
+9, 45, 1, 0, 0, 45, 3, 1, 0, 56, 3, 0, 3, 58, 3, 1, 
+3, 14, 0, 3, 0, 88, 4, 1, 128, 39, 3, 0, 0, 66, 1, 2, 
+1, 75, 0, 1, 0, 0, 192, 1, 0, 5, 62, 0, 1, 4, 2, 2, 
+0, 12, 45, 1, 0, 0, 45, 3, 1, 0, 56, 3, 0, 3, 58, 3, 
+2, 3, 14, 0, 3, 0, 88, 4, 1, 128, 39, 3, 0, 0, 66, 1, 
+2, 1, 45, 1, 0, 0, 39, 3, 1, 0, 66, 1, 2, 1, 75, 0, 
+1, 0, 0, 192, 1, 0, 6, 10, 5, 41, 0, 0, 3, 1, 1, 0, 
+4, 45, 0, 0, 0, 39, 2, 0, 0, 66, 0, 2, 1, 75, 0, 1, 
+0, 0, 192, 20, 92, 101, 110, 100, 123, 100, 111, 99, 117, 109, 101, 110, 
+116, 125, 10, 167, 2, 1, 2, 4, 2, 18, 0, 21, 53, 2, 1, 0, 
+51, 3, 0, 0, 61, 3, 2, 2, 45, 3, 0, 0, 61, 3, 3, 2, 
+51, 3, 4, 0, 61, 3, 5, 2, 51, 3, 6, 0, 61, 3, 7, 2, 
+51, 3, 8, 0, 61, 3, 9, 2, 51, 3, 10, 0, 61, 3, 11, 2, 
+51, 3, 12, 0, 61, 3, 13, 2, 51, 3, 14, 0, 61, 3, 15, 2, 
+51, 3, 16, 0, 61, 3, 17, 2, 50, 0, 0, 128, 76, 2, 2, 0, 
+2, 192, 3, 192, 13, 101, 112, 105, 108, 111, 103, 117, 101, 0, 18, 112, 
+97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 0, 20, 112, 97, 
+114, 97, 103, 114, 97, 112, 104, 95, 115, 116, 97, 114, 116, 0, 13, 108, 
+105, 115, 116, 95, 101, 110, 100, 0, 15, 108, 105, 115, 116, 95, 115, 116, 
+97, 114, 116, 0, 11, 110, 111, 116, 101, 120, 116, 0, 12, 114, 97, 119, 
+116, 101, 120, 116, 0, 11, 102, 111, 114, 109, 97, 116, 13, 112, 114, 111, 
+108, 111, 103, 117, 101, 1, 0, 9, 13, 108, 105, 115, 116, 95, 101, 110, 
+100, 0, 11, 102, 111, 114, 109, 97, 116, 0, 13, 101, 112, 105, 108, 111, 
+103, 117, 101, 0, 18, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 
+110, 100, 0, 20, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 115, 116, 
+97, 114, 116, 0, 13, 112, 114, 111, 108, 111, 103, 117, 101, 0, 15, 108, 
+105, 115, 116, 95, 115, 116, 97, 114, 116, 0, 11, 110, 111, 116, 101, 120, 
+116, 0, 12, 114, 97, 119, 116, 101, 120, 116, 0, 0, 73, 0, 1, 7, 
+1, 3, 0, 6, 54, 1, 0, 0, 18, 3, 0, 0, 39, 4, 1, 0, 
+39, 5, 2, 0, 45, 6, 0, 0, 68, 1, 5, 0, 4, 192, 9, 46, 
+116, 101, 120, 22, 69, 120, 112, 111, 114, 116, 32, 76, 97, 84, 101, 88, 
+32, 70, 105, 108, 101, 21, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 
+87, 105, 116, 104, 85, 73, 244, 5, 3, 0, 9, 0, 34, 0, 40, 54, 
+0, 0, 0, 57, 0, 1, 0, 53, 1, 2, 0, 18, 2, 0, 0, 53, 
+4, 3, 0, 61, 1, 4, 4, 66, 2, 2, 2, 53, 3, 6, 0, 53, 
+4, 5, 0, 61, 4, 7, 3, 53, 4, 8, 0, 61, 4, 9, 3, 53, 
+4, 10, 0, 61, 4, 11, 3, 53, 4, 12, 0, 61, 4, 13, 3, 53, 
+4, 14, 0, 61, 4, 15, 3, 53, 4, 16, 0, 61, 4, 17, 3, 53, 
+4, 18, 0, 61, 4, 19, 3, 53, 4, 20, 0, 61, 4, 21, 3, 53, 
+4, 22, 0, 61, 4, 23, 3, 53, 4, 24, 0, 61, 4, 25, 3, 53, 
+4, 26, 0, 61, 4, 27, 3, 51, 4, 28, 0, 54, 5, 29, 0, 51, 
+6, 31, 0, 61, 6, 30, 5, 54, 5, 32, 0, 39, 7, 33, 0, 18, 
+8, 4, 0, 66, 5, 3, 1, 50, 0, 0, 128, 75, 0, 1, 0, 8, 
+116, 101, 120, 21, 82, 101, 103, 105, 115, 116, 101, 114, 69, 120, 112, 111, 
+114, 116, 101, 114, 0, 20, 69, 120, 112, 111, 114, 116, 76, 97, 116, 101, 
+120, 70, 105, 108, 101, 8, 67, 109, 100, 0, 8, 80, 82, 69, 1, 3, 
+0, 0, 22, 92, 98, 101, 103, 105, 110, 123, 118, 101, 114, 98, 97, 116, 
+105, 109, 125, 10, 20, 10, 92, 101, 110, 100, 123, 118, 101, 114, 98, 97, 
+116, 105, 109, 125, 8, 82, 65, 87, 1, 3, 0, 0, 5, 5, 6, 86, 
+1, 3, 0, 0, 23, 92, 98, 101, 103, 105, 110, 123, 113, 117, 111, 116, 
+97, 116, 105, 111, 110, 125, 10, 21, 10, 92, 101, 110, 100, 123, 113, 117, 
+111, 116, 97, 116, 105, 111, 110, 125, 6, 81, 1, 3, 0, 0, 23, 92, 
+98, 101, 103, 105, 110, 123, 113, 117, 111, 116, 97, 116, 105, 111, 110, 125, 
+10, 21, 10, 92, 101, 110, 100, 123, 113, 117, 111, 116, 97, 116, 105, 111, 
+110, 125, 7, 76, 66, 1, 3, 0, 0, 11, 92, 105, 116, 101, 109, 123, 
+6, 125, 6, 76, 1, 3, 0, 0, 13, 92, 105, 116, 101, 109, 91, 93, 
+123, 6, 125, 6, 80, 1, 3, 0, 0, 5, 6, 10, 7, 72, 52, 1, 
+3, 0, 0, 16, 92, 112, 97, 114, 97, 103, 114, 97, 112, 104, 123, 6, 
+125, 7, 72, 51, 1, 3, 0, 0, 20, 92, 115, 117, 98, 115, 117, 98, 
+115, 101, 99, 116, 105, 111, 110, 123, 6, 125, 7, 72, 50, 1, 3, 0, 
+0, 17, 92, 115, 117, 98, 115, 101, 99, 116, 105, 111, 110, 123, 6, 125, 
+7, 72, 49, 1, 0, 11, 6, 76, 0, 6, 80, 0, 8, 80, 82, 69, 
+0, 7, 72, 52, 0, 8, 82, 65, 87, 0, 6, 86, 0, 7, 72, 51, 
+0, 6, 81, 0, 7, 72, 50, 0, 7, 76, 66, 0, 7, 72, 49, 0, 
+1, 3, 0, 0, 14, 92, 115, 101, 99, 116, 105, 111, 110, 123, 6, 125, 
+12, 101, 115, 99, 97, 112, 101, 115, 1, 0, 7, 13, 98, 111, 108, 100, 
+95, 111, 102, 102, 6, 125, 12, 98, 111, 108, 100, 95, 111, 110, 13, 92, 
+116, 101, 120, 116, 98, 102, 123, 18, 117, 110, 100, 101, 114, 108, 105, 110, 
+101, 95, 111, 102, 102, 6, 125, 17, 117, 110, 100, 101, 114, 108, 105, 110, 
+101, 95, 111, 110, 16, 92, 117, 110, 100, 101, 114, 108, 105, 110, 101, 123, 
+15, 105, 116, 97, 108, 105, 99, 95, 111, 102, 102, 6, 125, 14, 105, 116, 
+97, 108, 105, 99, 95, 111, 110, 13, 92, 116, 101, 120, 116, 105, 116, 123, 
+12, 101, 115, 99, 97, 112, 101, 115, 0, 1, 0, 12, 6, 37, 7, 92, 
+37, 6, 62, 14, 36, 92, 114, 97, 110, 103, 108, 101, 36, 6, 126, 9, 
+92, 126, 123, 125, 6, 60, 14, 36, 92, 108, 97, 110, 103, 108, 101, 36, 
+6, 94, 9, 92, 94, 123, 125, 6, 123, 7, 92, 123, 6, 95, 9, 92, 
+95, 123, 125, 6, 125, 7, 92, 125, 6, 38, 7, 92, 38, 6, 92, 17, 
+36, 92, 98, 97, 99, 107, 115, 108, 97, 115, 104, 36, 6, 36, 7, 92, 
+36, 6, 35, 7, 92, 35, 23, 99, 114, 101, 97, 116, 101, 101, 120, 112, 
+111, 114, 116, 102, 111, 114, 109, 97, 116, 7, 119, 103, 0, 
+};
+
+/* This is src/lua/export/troff.lua */
+static const char file_20[] = {
+27, 76, 74, 2, 10, 45, 0, 0, 3, 2, 1, 0, 8, 45, 0, 0, 
+0, 14, 0, 0, 0, 88, 0, 3, 128, 45, 0, 1, 0, 39, 2, 0, 
+0, 66, 0, 2, 1, 49, 0, 2, 0, 75, 0, 1, 0, 7, 128, 0, 
+192, 6, 10, 199, 1, 0, 1, 9, 7, 5, 0, 39, 39, 1, 0, 0, 
+45, 2, 0, 0, 15, 0, 2, 0, 88, 3, 14, 128, 45, 2, 1, 0, 
+18, 4, 0, 0, 39, 5, 1, 0, 39, 6, 0, 0, 66, 2, 4, 2, 
+18, 0, 2, 0, 45, 2, 2, 0, 18, 4, 0, 0, 39, 5, 2, 0, 
+66, 2, 3, 2, 15, 0, 2, 0, 88, 3, 1, 128, 39, 1, 3, 0, 
+49, 0, 1, 0, 45, 2, 3, 0, 15, 0, 2, 0, 88, 3, 9, 128, 
+45, 2, 4, 0, 18, 4, 1, 0, 45, 5, 5, 0, 18, 7, 5, 0, 
+57, 5, 4, 5, 18, 8, 0, 0, 66, 5, 3, 0, 65, 2, 1, 1, 
+88, 2, 8, 128, 45, 2, 4, 0, 18, 4, 1, 0, 45, 5, 6, 0, 
+18, 7, 5, 0, 57, 5, 4, 5, 18, 8, 0, 0, 66, 5, 3, 0, 
+65, 2, 1, 1, 75, 0, 1, 0, 7, 128, 0, 0, 1, 0, 6, 128, 
+0, 192, 2, 0, 3, 0, 11, 101, 115, 99, 97, 112, 101, 7, 92, 38, 
+10, 94, 91, 46, 39, 93, 9, 94, 37, 115, 43, 5, 188, 2, 0, 3, 
+6, 7, 6, 0, 67, 15, 0, 1, 0, 88, 3, 10, 128, 45, 3, 0, 
+0, 14, 0, 3, 0, 88, 3, 7, 128, 45, 3, 1, 0, 66, 3, 1, 
+1, 45, 3, 2, 0, 39, 5, 0, 0, 66, 3, 2, 1, 49, 3, 2, 
+0, 49, 4, 1, 0, 15, 0, 0, 0, 88, 3, 7, 128, 14, 0, 2, 
+0, 88, 3, 5, 128, 45, 3, 2, 0, 39, 5, 1, 0, 66, 3, 2, 
+1, 49, 4, 1, 0, 88, 3, 32, 128, 15, 0, 0, 0, 88, 3, 7, 
+128, 15, 0, 2, 0, 88, 3, 5, 128, 45, 3, 2, 0, 39, 5, 2, 
+0, 66, 3, 2, 1, 49, 4, 1, 0, 88, 3, 23, 128, 14, 0, 0, 
+0, 88, 3, 7, 128, 15, 0, 2, 0, 88, 3, 5, 128, 45, 3, 2, 
+0, 39, 5, 3, 0, 66, 3, 2, 1, 49, 4, 1, 0, 88, 3, 14, 
+128, 14, 0, 0, 0, 88, 3, 12, 128, 14, 0, 2, 0, 88, 3, 10, 
+128, 45, 3, 5, 0, 14, 0, 3, 0, 88, 4, 3, 128, 45, 3, 6, 
+0, 15, 0, 3, 0, 88, 4, 4, 128, 45, 3, 2, 0, 39, 5, 4, 
+0, 66, 3, 2, 1, 49, 4, 1, 0, 14, 0, 1, 0, 88, 3, 8, 
+128, 45, 3, 0, 0, 15, 0, 3, 0, 88, 4, 5, 128, 45, 3, 2, 
+0, 39, 5, 5, 0, 66, 3, 2, 1, 49, 3, 1, 0, 49, 4, 2, 
+0, 46, 5, 0, 0, 46, 0, 1, 0, 46, 6, 2, 0, 75, 0, 1, 
+0, 3, 128, 8, 192, 0, 192, 6, 128, 7, 128, 4, 128, 5, 128, 7, 
+34, 10, 8, 92, 102, 82, 8, 92, 102, 66, 10, 92, 102, 40, 66, 73, 
+8, 92, 102, 73, 10, 46, 85, 76, 32, 34, 224, 1, 0, 0, 6, 3, 
+9, 0, 22, 45, 0, 0, 0, 39, 2, 0, 0, 39, 3, 1, 0, 54, 
+4, 2, 0, 39, 5, 3, 0, 38, 2, 5, 2, 66, 0, 2, 1, 45, 
+0, 0, 0, 39, 2, 4, 0, 66, 0, 2, 1, 45, 0, 0, 0, 39, 
+2, 5, 0, 66, 0, 2, 1, 45, 0, 1, 0, 54, 2, 6, 0, 57, 
+2, 7, 2, 66, 0, 2, 1, 45, 0, 0, 0, 39, 2, 8, 0, 66, 
+0, 2, 1, 49, 2, 2, 0, 75, 0, 1, 0, 0, 192, 9, 192, 7, 
+128, 6, 10, 9, 110, 97, 109, 101, 13, 68, 111, 99, 117, 109, 101, 110, 
+116, 9, 46, 84, 76, 10, 36, 46, 92, 34, 32, 85, 115, 101, 32, 116, 
+104, 101, 32, 46, 109, 115, 32, 109, 97, 99, 114, 111, 32, 112, 97, 99, 
+107, 97, 103, 101, 33, 10, 7, 46, 10, 12, 86, 69, 82, 83, 73, 79, 
+78, 17, 87, 111, 114, 100, 71, 114, 105, 110, 100, 101, 114, 32, 50, 46, 
+92, 34, 32, 84, 104, 105, 115, 32, 100, 111, 99, 117, 109, 101, 110, 116, 
+32, 97, 117, 116, 111, 109, 97, 116, 105, 99, 97, 108, 108, 121, 32, 103, 
+101, 110, 101, 114, 97, 116, 101, 100, 32, 98, 121, 32, 25, 0, 1, 4, 
+1, 0, 0, 4, 45, 1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 1, 
+75, 0, 1, 0, 0, 192, 11, 0, 1, 1, 0, 0, 0, 1, 75, 0, 
+1, 0, 37, 0, 0, 5, 3, 0, 0, 6, 45, 0, 0, 0, 43, 2, 
+2, 0, 45, 3, 1, 0, 45, 4, 2, 0, 66, 0, 4, 1, 75, 0, 
+1, 0, 10, 192, 3, 128, 5, 128, 37, 0, 0, 5, 3, 0, 0, 6, 
+45, 0, 0, 0, 43, 2, 1, 0, 45, 3, 1, 0, 45, 4, 2, 0, 
+66, 0, 4, 1, 75, 0, 1, 0, 10, 192, 3, 128, 5, 128, 37, 0, 
+0, 5, 3, 0, 0, 6, 45, 0, 0, 0, 45, 2, 1, 0, 43, 3, 
+2, 0, 45, 4, 2, 0, 66, 0, 4, 1, 75, 0, 1, 0, 10, 192, 
+4, 128, 5, 128, 37, 0, 0, 5, 3, 0, 0, 6, 45, 0, 0, 0, 
+45, 2, 1, 0, 43, 3, 1, 0, 45, 4, 2, 0, 66, 0, 4, 1, 
+75, 0, 1, 0, 10, 192, 4, 128, 5, 128, 37, 0, 0, 5, 3, 0, 
+0, 6, 45, 0, 0, 0, 45, 2, 1, 0, 45, 3, 2, 0, 43, 4, 
+2, 0, 66, 0, 4, 1, 75, 0, 1, 0, 10, 192, 4, 128, 3, 128, 
+37, 0, 0, 5, 3, 0, 0, 6, 45, 0, 0, 0, 45, 2, 1, 0, 
+45, 3, 2, 0, 43, 4, 1, 0, 66, 0, 4, 1, 75, 0, 1, 0, 
+10, 192, 4, 128, 3, 128, 11, 0, 0, 1, 0, 0, 0, 1, 75, 0, 
+1, 0, 11, 0, 0, 1, 0, 0, 0, 1, 75, 0, 1, 0, 126, 0, 
+1, 4, 4, 4, 0, 24, 45, 1, 0, 0, 7, 1, 0, 0, 88, 1, 
+2, 128, 6, 0, 0, 0, 88, 1, 16, 128, 45, 1, 0, 0, 7, 1, 
+0, 0, 88, 1, 3, 128, 45, 1, 1, 0, 39, 3, 1, 0, 66, 1, 
+2, 1, 45, 1, 1, 0, 45, 3, 2, 0, 56, 3, 0, 3, 14, 0, 
+3, 0, 88, 4, 1, 128, 39, 3, 2, 0, 66, 1, 2, 1, 45, 1, 
+1, 0, 39, 3, 3, 0, 66, 1, 2, 1, 49, 3, 2, 0, 46, 0, 
+0, 0, 75, 0, 1, 0, 2, 128, 0, 192, 4, 0, 7, 128, 6, 10, 
+8, 46, 76, 80, 9, 46, 68, 69, 10, 8, 80, 82, 69, 21, 0, 1, 
+3, 1, 0, 0, 3, 45, 1, 0, 0, 66, 1, 1, 1, 75, 0, 1, 
+0, 8, 192, 11, 0, 0, 1, 0, 0, 0, 1, 75, 0, 1, 0, 138, 
+4, 1, 2, 13, 5, 33, 0, 41, 43, 2, 0, 0, 43, 3, 1, 0, 
+43, 4, 1, 0, 43, 5, 1, 0, 43, 6, 1, 0, 43, 7, 2, 0, 
+51, 8, 0, 0, 51, 9, 1, 0, 51, 10, 2, 0, 53, 11, 4, 0, 
+51, 12, 3, 0, 61, 12, 5, 11, 61, 9, 6, 11, 51, 12, 7, 0, 
+61, 12, 8, 11, 51, 12, 9, 0, 61, 12, 10, 11, 51, 12, 11, 0, 
+61, 12, 12, 11, 51, 12, 13, 0, 61, 12, 14, 11, 51, 12, 15, 0, 
+61, 12, 16, 11, 51, 12, 17, 0, 61, 12, 18, 11, 51, 12, 19, 0, 
+61, 12, 20, 11, 51, 12, 21, 0, 61, 12, 22, 11, 51, 12, 23, 0, 
+61, 12, 24, 11, 51, 12, 25, 0, 61, 12, 26, 11, 51, 12, 27, 0, 
+61, 12, 28, 11, 51, 12, 29, 0, 61, 12, 30, 11, 51, 12, 31, 0, 
+61, 12, 32, 11, 50, 0, 0, 128, 76, 11, 2, 0, 2, 192, 1, 192, 
+4, 192, 3, 192, 5, 192, 13, 101, 112, 105, 108, 111, 103, 117, 101, 0, 
+18, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 0, 20, 
+112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 115, 116, 97, 114, 116, 0, 
+13, 108, 105, 115, 116, 95, 101, 110, 100, 0, 15, 108, 105, 115, 116, 95, 
+115, 116, 97, 114, 116, 0, 13, 98, 111, 108, 100, 95, 111, 102, 102, 0, 
+12, 98, 111, 108, 100, 95, 111, 110, 0, 18, 117, 110, 100, 101, 114, 108, 
+105, 110, 101, 95, 111, 102, 102, 0, 17, 117, 110, 100, 101, 114, 108, 105, 
+110, 101, 95, 111, 110, 0, 15, 105, 116, 97, 108, 105, 99, 95, 111, 102, 
+102, 0, 14, 105, 116, 97, 108, 105, 99, 95, 111, 110, 0, 11, 110, 111, 
+116, 101, 120, 116, 0, 12, 114, 97, 119, 116, 101, 120, 116, 0, 9, 116, 
+101, 120, 116, 13, 112, 114, 111, 108, 111, 103, 117, 101, 1, 0, 15, 11, 
+110, 111, 116, 101, 120, 116, 0, 9, 116, 101, 120, 116, 0, 12, 98, 111, 
+108, 100, 95, 111, 110, 0, 15, 108, 105, 115, 116, 95, 115, 116, 97, 114, 
+116, 0, 13, 108, 105, 115, 116, 95, 101, 110, 100, 0, 13, 101, 112, 105, 
+108, 111, 103, 117, 101, 0, 18, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+95, 101, 110, 100, 0, 20, 112, 97, 114, 97, 103, 114, 97, 112, 104, 95, 
+115, 116, 97, 114, 116, 0, 13, 98, 111, 108, 100, 95, 111, 102, 102, 0, 
+13, 112, 114, 111, 108, 111, 103, 117, 101, 0, 18, 117, 110, 100, 101, 114, 
+108, 105, 110, 101, 95, 111, 102, 102, 0, 17, 117, 110, 100, 101, 114, 108, 
+105, 110, 101, 95, 111, 110, 0, 15, 105, 116, 97, 108, 105, 99, 95, 111, 
+102, 102, 0, 14, 105, 116, 97, 108, 105, 99, 95, 111, 110, 0, 12, 114, 
+97, 119, 116, 101, 120, 116, 0, 0, 0, 0, 0, 72, 0, 1, 7, 1, 
+3, 0, 6, 54, 1, 0, 0, 18, 3, 0, 0, 39, 4, 1, 0, 39, 
+5, 2, 0, 45, 6, 0, 0, 68, 1, 5, 0, 6, 192, 8, 46, 116, 
+114, 22, 69, 120, 112, 111, 114, 116, 32, 84, 114, 111, 102, 102, 32, 70, 
+105, 108, 101, 21, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 87, 105, 
+116, 104, 85, 73, 246, 2, 3, 0, 11, 0, 17, 0, 27, 54, 0, 0, 
+0, 57, 0, 1, 0, 54, 1, 2, 0, 57, 1, 3, 1, 54, 2, 2, 
+0, 57, 2, 4, 2, 18, 3, 0, 0, 53, 5, 6, 0, 53, 6, 5, 
+0, 61, 6, 7, 5, 66, 3, 2, 2, 18, 4, 0, 0, 53, 6, 9, 
+0, 53, 7, 8, 0, 61, 7, 7, 6, 66, 4, 2, 2, 53, 5, 10, 
+0, 51, 6, 11, 0, 54, 7, 12, 0, 51, 8, 14, 0, 61, 8, 13, 
+7, 54, 7, 15, 0, 39, 9, 16, 0, 18, 10, 6, 0, 66, 7, 3, 
+1, 50, 0, 0, 128, 75, 0, 1, 0, 7, 116, 114, 21, 82, 101, 103, 
+105, 115, 116, 101, 114, 69, 120, 112, 111, 114, 116, 101, 114, 0, 20, 69, 
+120, 112, 111, 114, 116, 84, 114, 111, 102, 102, 70, 105, 108, 101, 8, 67, 
+109, 100, 0, 1, 0, 11, 6, 76, 8, 46, 73, 80, 6, 80, 8, 46, 
+76, 80, 8, 80, 82, 69, 10, 46, 76, 68, 32, 49, 7, 72, 52, 10, 
+46, 78, 72, 32, 52, 8, 82, 65, 87, 5, 6, 86, 8, 46, 73, 80, 
+7, 72, 51, 10, 46, 78, 72, 32, 51, 6, 81, 8, 46, 73, 80, 7, 
+72, 50, 10, 46, 78, 72, 32, 50, 7, 76, 66, 14, 46, 73, 80, 32, 
+92, 91, 98, 117, 93, 7, 72, 49, 10, 46, 78, 72, 32, 49, 1, 0, 
+2, 12, 101, 115, 99, 97, 112, 101, 115, 0, 12, 117, 110, 105, 99, 111, 
+100, 101, 13, 92, 91, 117, 37, 48, 52, 88, 93, 1, 0, 2, 6, 92, 
+7, 92, 92, 6, 34, 7, 92, 34, 12, 101, 115, 99, 97, 112, 101, 115, 
+1, 0, 2, 12, 101, 115, 99, 97, 112, 101, 115, 0, 12, 117, 110, 105, 
+99, 111, 100, 101, 13, 92, 91, 117, 37, 48, 52, 88, 93, 1, 0, 1, 
+6, 92, 7, 92, 92, 9, 103, 115, 117, 98, 9, 102, 105, 110, 100, 11, 
+115, 116, 114, 105, 110, 103, 23, 99, 114, 101, 97, 116, 101, 101, 120, 112, 
+111, 114, 116, 102, 111, 114, 109, 97, 116, 7, 119, 103, 0, 
+};
+
+/* This is src/lua/export/opendocument.lua */
+static const char file_21[] = {
+27, 76, 74, 2, 10, 155, 1, 0, 1, 6, 3, 1, 0, 35, 45, 1, 
+0, 0, 45, 2, 1, 0, 56, 1, 2, 1, 45, 2, 0, 0, 56, 2, 
+0, 2, 45, 3, 1, 0, 5, 0, 3, 0, 88, 3, 8, 128, 15, 0, 
+0, 0, 88, 3, 6, 128, 58, 3, 1, 1, 15, 0, 3, 0, 88, 3, 
+3, 128, 58, 3, 1, 2, 14, 0, 3, 0, 88, 3, 15, 128, 15, 0, 
+1, 0, 88, 3, 3, 128, 45, 3, 2, 0, 58, 5, 3, 1, 66, 3, 
+2, 1, 45, 3, 2, 0, 39, 5, 0, 0, 66, 3, 2, 1, 15, 0, 
+2, 0, 88, 3, 3, 128, 45, 3, 2, 0, 58, 5, 2, 2, 66, 3, 
+2, 1, 46, 1, 0, 0, 88, 3, 3, 128, 45, 3, 2, 0, 39, 5, 
+0, 0, 66, 3, 2, 1, 75, 0, 1, 0, 0, 0, 3, 128, 0, 192, 
+6, 10, 175, 3, 0, 0, 3, 1, 1, 0, 4, 45, 0, 0, 0, 39, 
+2, 0, 0, 66, 0, 2, 1, 75, 0, 1, 0, 0, 192, 153, 3, 60, 
+63, 120, 109, 108, 32, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 
+48, 34, 32, 101, 110, 99, 111, 100, 105, 110, 103, 61, 34, 85, 84, 70, 
+45, 56, 34, 63, 62, 10, 9, 9, 9, 9, 9, 60, 111, 102, 102, 105, 
+99, 101, 58, 100, 111, 99, 117, 109, 101, 110, 116, 45, 99, 111, 110, 116, 
+101, 110, 116, 32, 111, 102, 102, 105, 99, 101, 58, 118, 101, 114, 115, 105, 
+111, 110, 61, 34, 49, 46, 48, 34, 10, 9, 9, 9, 9, 9, 120, 109, 
+108, 110, 115, 58, 111, 102, 102, 105, 99, 101, 61, 34, 117, 114, 110, 58, 
+111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 
+112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 
+115, 58, 111, 102, 102, 105, 99, 101, 58, 49, 46, 48, 34, 10, 9, 9, 
+9, 9, 9, 120, 109, 108, 110, 115, 58, 116, 101, 120, 116, 61, 34, 117, 
+114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 
+99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 
+109, 108, 110, 115, 58, 116, 101, 120, 116, 58, 49, 46, 48, 34, 10, 9, 
+9, 9, 9, 9, 120, 109, 108, 110, 115, 58, 102, 111, 61, 34, 117, 114, 
+110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 
+58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 
+108, 110, 115, 58, 120, 115, 108, 45, 102, 111, 45, 99, 111, 109, 112, 97, 
+116, 105, 98, 108, 101, 58, 49, 46, 48, 34, 10, 9, 9, 9, 9, 9, 
+120, 109, 108, 110, 115, 58, 115, 116, 121, 108, 101, 61, 34, 117, 114, 110, 
+58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 
+111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 
+110, 115, 58, 115, 116, 121, 108, 101, 58, 49, 46, 48, 34, 62, 10, 9, 
+9, 9, 9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 98, 111, 100, 121, 
+62, 60, 111, 102, 102, 105, 99, 101, 58, 116, 101, 120, 116, 62, 10, 9, 
+9, 9, 9, 95, 0, 0, 3, 2, 1, 0, 7, 45, 0, 0, 0, 43, 
+2, 0, 0, 66, 0, 2, 1, 45, 0, 1, 0, 39, 2, 0, 0, 66, 
+0, 2, 1, 75, 0, 1, 0, 4, 192, 0, 192, 60, 60, 47, 111, 102, 
+102, 105, 99, 101, 58, 116, 101, 120, 116, 62, 60, 47, 111, 102, 102, 105, 
+99, 101, 58, 98, 111, 100, 121, 62, 60, 47, 111, 102, 102, 105, 99, 101, 
+58, 100, 111, 99, 117, 109, 101, 110, 116, 45, 99, 111, 110, 116, 101, 110, 
+116, 62, 10, 25, 0, 1, 4, 1, 0, 0, 4, 45, 1, 0, 0, 18, 
+3, 0, 0, 66, 1, 2, 1, 75, 0, 1, 0, 0, 192, 11, 0, 1, 
+1, 0, 0, 0, 1, 75, 0, 1, 0, 11, 0, 0, 1, 0, 0, 0, 
+1, 75, 0, 1, 0, 11, 0, 0, 1, 0, 0, 0, 1, 75, 0, 1, 
+0, 25, 0, 1, 4, 1, 0, 0, 4, 45, 1, 0, 0, 18, 3, 0, 
+0, 66, 1, 2, 1, 75, 0, 1, 0, 4, 192, 11, 0, 1, 1, 0, 
+0, 0, 1, 75, 0, 1, 0, 218, 2, 1, 2, 7, 2, 22, 0, 26, 
+54, 2, 0, 0, 57, 2, 1, 2, 57, 2, 2, 2, 43, 3, 0, 0, 
+51, 4, 3, 0, 53, 5, 5, 0, 51, 6, 4, 0, 61, 6, 6, 5, 
+51, 6, 7, 0, 61, 6, 8, 5, 45, 6, 1, 0, 61, 6, 9, 5, 
+51, 6, 10, 0, 61, 6, 11, 5, 51, 6, 12, 0, 61, 6, 13, 5, 
+51, 6, 14, 0, 61, 6, 15, 5, 51, 6, 16, 0, 61, 6, 17, 5, 
+51, 6, 18, 0, 61, 6, 19, 5, 51, 6, 20, 0, 61, 6, 21, 5, 
+50, 0, 0, 128, 76, 5, 2, 0, 5, 192, 4, 192, 18, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 0, 20, 112, 97, 114, 97, 
+103, 114, 97, 112, 104, 95, 115, 116, 97, 114, 116, 0, 13, 108, 105, 115, 
+116, 95, 101, 110, 100, 0, 15, 108, 105, 115, 116, 95, 115, 116, 97, 114, 
+116, 0, 11, 110, 111, 116, 101, 120, 116, 0, 12, 114, 97, 119, 116, 101, 
+120, 116, 0, 11, 102, 111, 114, 109, 97, 116, 13, 101, 112, 105, 108, 111, 
+103, 117, 101, 0, 13, 112, 114, 111, 108, 111, 103, 117, 101, 1, 0, 9, 
+13, 108, 105, 115, 116, 95, 101, 110, 100, 0, 11, 102, 111, 114, 109, 97, 
+116, 0, 13, 101, 112, 105, 108, 111, 103, 117, 101, 0, 18, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 95, 101, 110, 100, 0, 20, 112, 97, 114, 97, 
+103, 114, 97, 112, 104, 95, 115, 116, 97, 114, 116, 0, 13, 112, 114, 111, 
+108, 111, 103, 117, 101, 0, 15, 108, 105, 115, 116, 95, 115, 116, 97, 114, 
+116, 0, 11, 110, 111, 116, 101, 120, 116, 0, 12, 114, 97, 119, 116, 101, 
+120, 116, 0, 0, 0, 15, 104, 116, 109, 108, 101, 120, 112, 111, 114, 116, 
+11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 96, 2, 0, 4, 4, 2, 0, 17, 45, 0, 0, 0, 45, 
+2, 1, 0, 71, 3, 0, 0, 65, 0, 1, 2, 45, 1, 2, 0, 1, 
+1, 0, 0, 88, 0, 9, 128, 45, 0, 3, 0, 18, 2, 0, 0, 57, 
+0, 0, 0, 45, 3, 1, 0, 66, 0, 3, 1, 45, 0, 1, 0, 18, 
+2, 0, 0, 57, 0, 1, 0, 66, 0, 2, 1, 75, 0, 1, 0, 5, 
+192, 4, 192, 2, 0, 2, 192, 10, 99, 108, 101, 97, 114, 11, 97, 112, 
+112, 101, 110, 100, 121, 0, 0, 4, 3, 3, 0, 22, 45, 0, 0, 0, 
+18, 2, 0, 0, 57, 0, 0, 0, 45, 3, 1, 0, 66, 0, 3, 1, 
+45, 0, 0, 0, 18, 2, 0, 0, 57, 0, 1, 0, 66, 0, 2, 2, 
+45, 1, 0, 0, 18, 3, 1, 0, 57, 1, 2, 1, 66, 1, 2, 2, 
+13, 0, 1, 0, 88, 2, 0, 128, 14, 0, 0, 0, 88, 1, 3, 128, 
+43, 1, 0, 0, 45, 2, 2, 0, 74, 1, 3, 0, 43, 1, 2, 0, 
+76, 1, 2, 0, 2, 192, 4, 192, 0, 192, 10, 99, 108, 111, 115, 101, 
+11, 102, 105, 110, 105, 115, 104, 11, 97, 112, 112, 101, 110, 100, 221, 54, 
+1, 1, 14, 3, 11, 0, 52, 53, 1, 0, 0, 45, 2, 0, 0, 18, 
+4, 0, 0, 66, 2, 2, 2, 13, 3, 2, 0, 88, 3, 5, 128, 18, 
+5, 2, 0, 57, 3, 1, 2, 39, 6, 2, 0, 57, 7, 2, 1, 66, 
+3, 4, 2, 54, 4, 3, 0, 53, 6, 4, 0, 66, 4, 2, 4, 88, 
+7, 8, 128, 15, 0, 3, 0, 88, 9, 6, 128, 18, 11, 2, 0, 57, 
+9, 1, 2, 18, 12, 8, 0, 56, 13, 8, 1, 66, 9, 4, 2, 18, 
+3, 9, 0, 69, 7, 3, 3, 82, 7, 246, 127, 15, 0, 3, 0, 88, 
+4, 5, 128, 18, 6, 2, 0, 57, 4, 5, 2, 39, 7, 6, 0, 66, 
+4, 3, 2, 18, 3, 4, 0, 14, 0, 3, 0, 88, 4, 8, 128, 15, 
+0, 2, 0, 88, 4, 3, 128, 18, 6, 2, 0, 57, 4, 7, 2, 66, 
+4, 2, 1, 43, 4, 0, 0, 18, 5, 0, 0, 50, 0, 9, 128, 45, 
+4, 1, 0, 66, 4, 1, 2, 57, 5, 8, 4, 51, 6, 9, 0, 51, 
+7, 10, 0, 18, 8, 6, 0, 18, 9, 7, 0, 50, 0, 0, 128, 74, 
+8, 3, 0, 74, 4, 3, 0, 0, 192, 1, 192, 2, 192, 0, 0, 11, 
+97, 112, 112, 101, 110, 100, 10, 99, 108, 111, 115, 101, 16, 99, 111, 110, 
+116, 101, 110, 116, 46, 120, 109, 108, 9, 111, 112, 101, 110, 1, 5, 0, 
+0, 26, 77, 69, 84, 65, 45, 73, 78, 70, 47, 109, 97, 110, 105, 102, 
+101, 115, 116, 46, 120, 109, 108, 15, 115, 116, 121, 108, 101, 115, 46, 120, 
+109, 108, 17, 115, 101, 116, 116, 105, 110, 103, 115, 46, 120, 109, 108, 13, 
+109, 101, 116, 97, 46, 120, 109, 108, 11, 105, 112, 97, 105, 114, 115, 13, 
+109, 105, 109, 101, 116, 121, 112, 101, 10, 119, 114, 105, 116, 101, 1, 0, 
+5, 13, 109, 101, 116, 97, 46, 120, 109, 108, 162, 1, 60, 63, 120, 109, 
+108, 32, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 34, 32, 
+101, 110, 99, 111, 100, 105, 110, 103, 61, 34, 85, 84, 70, 45, 56, 34, 
+63, 62, 10, 9, 9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 100, 111, 
+99, 117, 109, 101, 110, 116, 45, 109, 101, 116, 97, 32, 111, 102, 102, 105, 
+99, 101, 58, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 34, 
+10, 9, 9, 9, 9, 120, 109, 108, 110, 115, 58, 111, 102, 102, 105, 99, 
+101, 61, 34, 117, 114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 
+101, 115, 58, 116, 99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 
+110, 116, 58, 120, 109, 108, 110, 115, 58, 111, 102, 102, 105, 99, 101, 58, 
+49, 46, 48, 34, 47, 62, 10, 9, 9, 26, 77, 69, 84, 65, 45, 73, 
+78, 70, 47, 109, 97, 110, 105, 102, 101, 115, 116, 46, 120, 109, 108, 178, 
+5, 60, 63, 120, 109, 108, 32, 118, 101, 114, 115, 105, 111, 110, 61, 34, 
+49, 46, 48, 34, 32, 101, 110, 99, 111, 100, 105, 110, 103, 61, 34, 85, 
+84, 70, 45, 56, 34, 63, 62, 10, 9, 9, 9, 60, 109, 97, 110, 105, 
+102, 101, 115, 116, 58, 109, 97, 110, 105, 102, 101, 115, 116, 32, 120, 109, 
+108, 110, 115, 58, 109, 97, 110, 105, 102, 101, 115, 116, 61, 34, 117, 114, 
+110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 
+58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 
+108, 110, 115, 58, 109, 97, 110, 105, 102, 101, 115, 116, 58, 49, 46, 48, 
+34, 62, 32, 10, 9, 9, 9, 9, 60, 109, 97, 110, 105, 102, 101, 115, 
+116, 58, 102, 105, 108, 101, 45, 101, 110, 116, 114, 121, 10, 9, 9, 9, 
+9, 9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 109, 101, 100, 105, 97, 
+45, 116, 121, 112, 101, 61, 34, 97, 112, 112, 108, 105, 99, 97, 116, 105, 
+111, 110, 47, 118, 110, 100, 46, 111, 97, 115, 105, 115, 46, 111, 112, 101, 
+110, 100, 111, 99, 117, 109, 101, 110, 116, 46, 116, 101, 120, 116, 34, 10, 
+9, 9, 9, 9, 9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 102, 117, 
+108, 108, 45, 112, 97, 116, 104, 61, 34, 47, 34, 47, 62, 32, 10, 9, 
+9, 9, 9, 60, 109, 97, 110, 105, 102, 101, 115, 116, 58, 102, 105, 108, 
+101, 45, 101, 110, 116, 114, 121, 10, 9, 9, 9, 9, 9, 109, 97, 110, 
+105, 102, 101, 115, 116, 58, 109, 101, 100, 105, 97, 45, 116, 121, 112, 101, 
+61, 34, 116, 101, 120, 116, 47, 120, 109, 108, 34, 10, 9, 9, 9, 9, 
+9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 102, 117, 108, 108, 45, 112, 
+97, 116, 104, 61, 34, 99, 111, 110, 116, 101, 110, 116, 46, 120, 109, 108, 
+34, 47, 62, 32, 10, 9, 9, 9, 9, 60, 109, 97, 110, 105, 102, 101, 
+115, 116, 58, 102, 105, 108, 101, 45, 101, 110, 116, 114, 121, 10, 9, 9, 
+9, 9, 9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 109, 101, 100, 105, 
+97, 45, 116, 121, 112, 101, 61, 34, 116, 101, 120, 116, 47, 120, 109, 108, 
+34, 10, 9, 9, 9, 9, 9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 
+102, 117, 108, 108, 45, 112, 97, 116, 104, 61, 34, 109, 101, 116, 97, 46, 
+120, 109, 108, 34, 47, 62, 32, 10, 9, 9, 9, 9, 60, 109, 97, 110, 
+105, 102, 101, 115, 116, 58, 102, 105, 108, 101, 45, 101, 110, 116, 114, 121, 
+10, 9, 9, 9, 9, 9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 109, 
+101, 100, 105, 97, 45, 116, 121, 112, 101, 61, 34, 116, 101, 120, 116, 47, 
+120, 109, 108, 34, 10, 9, 9, 9, 9, 9, 109, 97, 110, 105, 102, 101, 
+115, 116, 58, 102, 117, 108, 108, 45, 112, 97, 116, 104, 61, 34, 115, 101, 
+116, 116, 105, 110, 103, 115, 46, 120, 109, 108, 34, 47, 62, 32, 10, 9, 
+9, 9, 9, 60, 109, 97, 110, 105, 102, 101, 115, 116, 58, 102, 105, 108, 
+101, 45, 101, 110, 116, 114, 121, 10, 9, 9, 9, 9, 9, 109, 97, 110, 
+105, 102, 101, 115, 116, 58, 109, 101, 100, 105, 97, 45, 116, 121, 112, 101, 
+61, 34, 116, 101, 120, 116, 47, 120, 109, 108, 34, 10, 9, 9, 9, 9, 
+9, 109, 97, 110, 105, 102, 101, 115, 116, 58, 102, 117, 108, 108, 45, 112, 
+97, 116, 104, 61, 34, 115, 116, 121, 108, 101, 115, 46, 120, 109, 108, 34, 
+47, 62, 32, 10, 9, 9, 9, 60, 47, 109, 97, 110, 105, 102, 101, 115, 
+116, 58, 109, 97, 110, 105, 102, 101, 115, 116, 62, 10, 9, 9, 13, 109, 
+105, 109, 101, 116, 121, 112, 101, 44, 97, 112, 112, 108, 105, 99, 97, 116, 
+105, 111, 110, 47, 118, 110, 100, 46, 111, 97, 115, 105, 115, 46, 111, 112, 
+101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 46, 116, 101, 120, 116, 17, 
+115, 101, 116, 116, 105, 110, 103, 115, 46, 120, 109, 108, 166, 1, 60, 63, 
+120, 109, 108, 32, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 
+34, 32, 101, 110, 99, 111, 100, 105, 110, 103, 61, 34, 85, 84, 70, 45, 
+56, 34, 63, 62, 10, 9, 9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 
+100, 111, 99, 117, 109, 101, 110, 116, 45, 115, 101, 116, 116, 105, 110, 103, 
+115, 32, 111, 102, 102, 105, 99, 101, 58, 118, 101, 114, 115, 105, 111, 110, 
+61, 34, 49, 46, 48, 34, 10, 9, 9, 9, 9, 120, 109, 108, 110, 115, 
+58, 111, 102, 102, 105, 99, 101, 61, 34, 117, 114, 110, 58, 111, 97, 115, 
+105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 112, 101, 110, 
+100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 115, 58, 111, 
+102, 102, 105, 99, 101, 58, 49, 46, 48, 34, 47, 62, 10, 9, 9, 15, 
+115, 116, 121, 108, 101, 115, 46, 120, 109, 108, 182, 43, 60, 63, 120, 109, 
+108, 32, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 48, 34, 32, 
+101, 110, 99, 111, 100, 105, 110, 103, 61, 34, 85, 84, 70, 45, 56, 34, 
+63, 62, 10, 9, 9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 100, 111, 
+99, 117, 109, 101, 110, 116, 45, 115, 116, 121, 108, 101, 115, 32, 111, 102, 
+102, 105, 99, 101, 58, 118, 101, 114, 115, 105, 111, 110, 61, 34, 49, 46, 
+48, 34, 10, 9, 9, 9, 9, 120, 109, 108, 110, 115, 58, 116, 101, 120, 
+116, 61, 34, 117, 114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 
+101, 115, 58, 116, 99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 
+110, 116, 58, 120, 109, 108, 110, 115, 58, 116, 101, 120, 116, 58, 49, 46, 
+48, 34, 10, 9, 9, 9, 9, 120, 109, 108, 110, 115, 58, 102, 111, 61, 
+34, 117, 114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 
+58, 116, 99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 
+58, 120, 109, 108, 110, 115, 58, 120, 115, 108, 45, 102, 111, 45, 99, 111, 
+109, 112, 97, 116, 105, 98, 108, 101, 58, 49, 46, 48, 34, 10, 9, 9, 
+9, 9, 120, 109, 108, 110, 115, 58, 115, 116, 121, 108, 101, 61, 34, 117, 
+114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 
+99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 
+109, 108, 110, 115, 58, 115, 116, 121, 108, 101, 58, 49, 46, 48, 34, 10, 
+9, 9, 9, 9, 120, 109, 108, 110, 115, 58, 115, 118, 103, 61, 34, 117, 
+114, 110, 58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 
+99, 58, 111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 
+109, 108, 110, 115, 58, 115, 118, 103, 45, 99, 111, 109, 112, 97, 116, 105, 
+98, 108, 101, 58, 49, 46, 48, 34, 10, 9, 9, 9, 9, 120, 109, 108, 
+110, 115, 58, 111, 102, 102, 105, 99, 101, 61, 34, 117, 114, 110, 58, 111, 
+97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 112, 
+101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 115, 
+58, 111, 102, 102, 105, 99, 101, 58, 49, 46, 48, 34, 62, 10, 9, 9, 
+9, 9, 10, 9, 9, 9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 102, 
+111, 110, 116, 45, 102, 97, 99, 101, 45, 100, 101, 99, 108, 115, 62, 10, 
+9, 9, 9, 9, 32, 32, 60, 115, 116, 121, 108, 101, 58, 102, 111, 110, 
+116, 45, 102, 97, 99, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 
+101, 61, 34, 109, 111, 110, 111, 115, 112, 97, 99, 101, 34, 32, 115, 118, 
+103, 58, 102, 111, 110, 116, 45, 102, 97, 109, 105, 108, 121, 61, 34, 109, 
+111, 110, 111, 115, 112, 97, 99, 101, 34, 32, 115, 116, 121, 108, 101, 58, 
+102, 111, 110, 116, 45, 102, 97, 109, 105, 108, 121, 45, 103, 101, 110, 101, 
+114, 105, 99, 61, 34, 109, 111, 100, 101, 114, 110, 34, 32, 115, 116, 121, 
+108, 101, 58, 102, 111, 110, 116, 45, 112, 105, 116, 99, 104, 61, 34, 102, 
+105, 120, 101, 100, 34, 47, 62, 10, 9, 9, 9, 9, 32, 32, 60, 115, 
+116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 102, 97, 99, 101, 32, 115, 
+116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 115, 101, 114, 105, 102, 
+34, 32, 115, 118, 103, 58, 102, 111, 110, 116, 45, 102, 97, 109, 105, 108, 
+121, 61, 34, 115, 101, 114, 105, 102, 34, 32, 115, 116, 121, 108, 101, 58, 
+102, 111, 110, 116, 45, 102, 97, 109, 105, 108, 121, 45, 103, 101, 110, 101, 
+114, 105, 99, 61, 34, 114, 111, 109, 97, 110, 34, 32, 115, 116, 121, 108, 
+101, 58, 102, 111, 110, 116, 45, 112, 105, 116, 99, 104, 61, 34, 118, 97, 
+114, 105, 97, 98, 108, 101, 34, 47, 62, 10, 9, 9, 9, 9, 60, 47, 
+111, 102, 102, 105, 99, 101, 58, 102, 111, 110, 116, 45, 102, 97, 99, 101, 
+45, 100, 101, 99, 108, 115, 62, 10, 9, 9, 9, 9, 32, 10, 9, 9, 
+9, 9, 60, 111, 102, 102, 105, 99, 101, 58, 115, 116, 121, 108, 101, 115, 
+62, 10, 9, 9, 9, 9, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 
+121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 
+66, 34, 32, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 
+34, 116, 101, 120, 116, 34, 62, 10, 9, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 
+116, 101, 120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 
+102, 111, 58, 102, 111, 110, 116, 45, 119, 101, 105, 103, 104, 116, 61, 34, 
+98, 111, 108, 100, 34, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 9, 115, 116, 121, 108, 101, 58, 102, 111, 
+110, 116, 45, 119, 101, 105, 103, 104, 116, 45, 99, 111, 109, 112, 108, 101, 
+120, 61, 34, 98, 111, 108, 100, 34, 10, 9, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 
+101, 58, 102, 111, 110, 116, 45, 119, 101, 105, 103, 104, 116, 45, 97, 115, 
+105, 97, 110, 61, 34, 98, 111, 108, 100, 34, 47, 62, 10, 9, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 
+108, 101, 58, 115, 116, 121, 108, 101, 62, 10, 9, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 10, 9, 9, 9, 9, 9, 60, 115, 
+116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 
+58, 110, 97, 109, 101, 61, 34, 73, 34, 32, 115, 116, 121, 108, 101, 58, 
+102, 97, 109, 105, 108, 121, 61, 34, 116, 101, 120, 116, 34, 62, 10, 9, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 
+60, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 114, 111, 112, 
+101, 114, 116, 105, 101, 115, 32, 102, 111, 58, 102, 111, 110, 116, 45, 115, 
+116, 121, 108, 101, 61, 34, 105, 116, 97, 108, 105, 99, 34, 10, 9, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 
+115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 115, 116, 121, 108, 101, 
+45, 97, 115, 105, 97, 110, 61, 34, 105, 116, 97, 108, 105, 99, 34, 10, 
+9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 115, 116, 
+121, 108, 101, 45, 99, 111, 109, 112, 108, 101, 120, 61, 34, 105, 116, 97, 
+108, 105, 99, 34, 47, 62, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 
+108, 101, 62, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 10, 9, 9, 9, 9, 9, 60, 115, 116, 121, 108, 101, 58, 115, 
+116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 
+34, 85, 76, 34, 32, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 
+121, 61, 34, 116, 101, 120, 116, 34, 62, 10, 9, 9, 9, 9, 9, 9, 
+60, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 114, 111, 112, 
+101, 114, 116, 105, 101, 115, 32, 115, 116, 121, 108, 101, 58, 116, 101, 120, 
+116, 45, 117, 110, 100, 101, 114, 108, 105, 110, 101, 45, 115, 116, 121, 108, 
+101, 61, 34, 115, 111, 108, 105, 100, 34, 10, 9, 9, 9, 9, 9, 9, 
+9, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 117, 110, 100, 101, 
+114, 108, 105, 110, 101, 45, 119, 105, 100, 116, 104, 61, 34, 97, 117, 116, 
+111, 34, 10, 9, 9, 9, 9, 9, 9, 9, 115, 116, 121, 108, 101, 58, 
+116, 101, 120, 116, 45, 117, 110, 100, 101, 114, 108, 105, 110, 101, 45, 99, 
+111, 108, 111, 114, 61, 34, 102, 111, 110, 116, 45, 99, 111, 108, 111, 114, 
+34, 47, 62, 10, 9, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 62, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 
+32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 72, 49, 34, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 
+34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 34, 32, 115, 116, 121, 108, 
+101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 101, 120, 116, 34, 62, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 97, 114, 97, 103, 114, 97, 
+112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 
+9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 111, 112, 61, 34, 
+53, 109, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 
+110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 50, 109, 109, 34, 47, 62, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 
+114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 
+102, 111, 110, 116, 45, 115, 105, 122, 101, 61, 34, 49, 53, 48, 37, 34, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 9, 115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 
+97, 109, 101, 61, 34, 115, 101, 114, 105, 102, 34, 10, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 
+111, 58, 102, 111, 110, 116, 45, 119, 101, 105, 103, 104, 116, 61, 34, 98, 
+111, 108, 100, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 
+115, 116, 121, 108, 101, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 10, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 115, 116, 121, 108, 101, 
+58, 115, 116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 
+101, 61, 34, 72, 50, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 
+97, 109, 105, 108, 121, 61, 34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+34, 32, 115, 116, 121, 108, 101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 
+101, 120, 116, 34, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 
+97, 114, 97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 
+105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 
+45, 116, 111, 112, 61, 34, 53, 109, 109, 34, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 
+58, 109, 97, 114, 103, 105, 110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 
+50, 109, 109, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 
+116, 101, 120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 9, 9, 102, 111, 58, 102, 111, 110, 116, 45, 115, 105, 122, 101, 61, 
+34, 49, 51, 48, 37, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 115, 116, 121, 108, 101, 58, 
+102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 115, 101, 114, 105, 102, 
+34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 9, 9, 9, 102, 111, 58, 102, 111, 110, 116, 45, 119, 101, 105, 
+103, 104, 116, 61, 34, 98, 111, 108, 100, 34, 47, 62, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 
+115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 62, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+60, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 32, 115, 116, 121, 
+108, 101, 58, 110, 97, 109, 101, 61, 34, 72, 51, 34, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 115, 
+116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 34, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 34, 32, 115, 116, 121, 108, 101, 58, 99, 108, 
+97, 115, 115, 61, 34, 116, 101, 120, 116, 34, 62, 10, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 
+116, 121, 108, 101, 58, 112, 97, 114, 97, 103, 114, 97, 112, 104, 45, 112, 
+114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 
+109, 97, 114, 103, 105, 110, 45, 116, 111, 112, 61, 34, 53, 109, 109, 34, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 98, 111, 
+116, 116, 111, 109, 61, 34, 50, 109, 109, 34, 47, 62, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 
+115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 45, 112, 114, 111, 112, 101, 
+114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 102, 111, 110, 116, 
+45, 115, 105, 122, 101, 61, 34, 49, 49, 48, 37, 34, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 
+115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 
+34, 115, 101, 114, 105, 102, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 102, 111, 
+110, 116, 45, 119, 101, 105, 103, 104, 116, 61, 34, 98, 111, 108, 100, 34, 
+47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 
+101, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 121, 
+108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 72, 
+52, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 
+121, 61, 34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 34, 32, 115, 116, 
+121, 108, 101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 101, 120, 116, 34, 
+62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 97, 114, 97, 103, 
+114, 97, 112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 111, 112, 
+61, 34, 53, 109, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 
+103, 105, 110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 50, 109, 109, 34, 
+47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 
+45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 115, 
+116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 
+115, 101, 114, 105, 102, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 102, 111, 110, 
+116, 45, 119, 101, 105, 103, 104, 116, 61, 34, 98, 111, 108, 100, 34, 47, 
+62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 
+62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 9, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 60, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 
+101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 80, 34, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 97, 109, 105, 108, 121, 61, 
+34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 34, 32, 115, 116, 121, 108, 
+101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 101, 120, 116, 34, 62, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 97, 114, 97, 103, 114, 97, 
+112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 
+9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 111, 112, 61, 34, 
+49, 46, 53, 109, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 
+103, 105, 110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 49, 46, 53, 109, 
+109, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 
+120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 115, 116, 
+121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 115, 
+101, 114, 105, 102, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 
+58, 115, 116, 121, 108, 101, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 115, 116, 121, 108, 
+101, 58, 115, 116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 
+109, 101, 61, 34, 81, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 
+97, 109, 105, 108, 121, 61, 34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+34, 32, 115, 116, 121, 108, 101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 
+101, 120, 116, 34, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 
+97, 114, 97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 
+105, 101, 115, 10, 9, 9, 9, 9, 9, 9, 9, 102, 111, 58, 109, 97, 
+114, 103, 105, 110, 45, 116, 111, 112, 61, 34, 49, 46, 53, 109, 109, 34, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 98, 111, 
+116, 116, 111, 109, 61, 34, 49, 46, 53, 109, 109, 34, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 
+102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 108, 101, 102, 116, 61, 34, 
+49, 48, 109, 109, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 
+58, 116, 101, 120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 
+32, 115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 
+61, 34, 115, 101, 114, 105, 102, 34, 47, 62, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 
+121, 108, 101, 58, 115, 116, 121, 108, 101, 62, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 115, 
+116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 
+58, 110, 97, 109, 101, 61, 34, 86, 34, 10, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 
+101, 58, 102, 97, 109, 105, 108, 121, 61, 34, 112, 97, 114, 97, 103, 114, 
+97, 112, 104, 34, 32, 115, 116, 121, 108, 101, 58, 99, 108, 97, 115, 115, 
+61, 34, 116, 101, 120, 116, 34, 62, 10, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 
+101, 58, 112, 97, 114, 97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 112, 
+101, 114, 116, 105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 
+103, 105, 110, 45, 108, 101, 102, 116, 61, 34, 49, 48, 109, 109, 34, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 45, 116, 111, 112, 
+61, 34, 48, 109, 109, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 
+103, 105, 110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 48, 109, 109, 34, 
+47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 116, 101, 120, 116, 
+45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 115, 116, 121, 108, 
+101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 34, 115, 101, 114, 
+105, 102, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 60, 47, 115, 116, 121, 108, 101, 58, 115, 
+116, 121, 108, 101, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 10, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 115, 116, 121, 108, 101, 58, 
+115, 116, 121, 108, 101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 
+61, 34, 80, 82, 69, 34, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 115, 116, 121, 108, 101, 58, 102, 
+97, 109, 105, 108, 121, 61, 34, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+34, 32, 115, 116, 121, 108, 101, 58, 99, 108, 97, 115, 115, 61, 34, 116, 
+101, 120, 116, 34, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 112, 
+97, 114, 97, 103, 114, 97, 112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 
+105, 101, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 9, 9, 9, 102, 111, 58, 109, 97, 114, 103, 105, 110, 
+45, 116, 111, 112, 61, 34, 48, 109, 109, 34, 10, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 9, 9, 102, 111, 
+58, 109, 97, 114, 103, 105, 110, 45, 98, 111, 116, 116, 111, 109, 61, 34, 
+48, 109, 109, 34, 47, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 9, 9, 60, 115, 116, 121, 108, 101, 58, 
+116, 101, 120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 
+115, 116, 121, 108, 101, 58, 102, 111, 110, 116, 45, 110, 97, 109, 101, 61, 
+34, 109, 111, 110, 111, 115, 112, 97, 99, 101, 34, 47, 62, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 
+47, 115, 116, 121, 108, 101, 58, 115, 116, 121, 108, 101, 62, 10, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+9, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 115, 116, 121, 108, 
+101, 32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 76, 66, 
+34, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 9, 9, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 
+108, 101, 118, 101, 108, 45, 115, 116, 121, 108, 101, 45, 98, 117, 108, 108, 
+101, 116, 32, 116, 101, 120, 116, 58, 108, 101, 118, 101, 108, 61, 34, 49, 
+34, 32, 116, 101, 120, 116, 58, 98, 117, 108, 108, 101, 116, 45, 99, 104, 
+97, 114, 61, 34, 226, 128, 162, 34, 62, 10, 9, 9, 9, 9, 9, 9, 
+9, 60, 115, 116, 121, 108, 101, 58, 108, 105, 115, 116, 45, 108, 101, 118, 
+101, 108, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 9, 9, 
+9, 9, 9, 9, 9, 9, 116, 101, 120, 116, 58, 115, 112, 97, 99, 101, 
+45, 98, 101, 102, 111, 114, 101, 61, 34, 53, 109, 109, 34, 10, 9, 9, 
+9, 9, 9, 9, 9, 9, 116, 101, 120, 116, 58, 109, 105, 110, 45, 108, 
+97, 98, 101, 108, 45, 119, 105, 100, 116, 104, 61, 34, 53, 109, 109, 34, 
+47, 62, 10, 9, 9, 9, 9, 9, 9, 60, 47, 116, 101, 120, 116, 58, 
+108, 105, 115, 116, 45, 108, 101, 118, 101, 108, 45, 115, 116, 121, 108, 101, 
+45, 98, 117, 108, 108, 101, 116, 62, 10, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 60, 47, 116, 101, 120, 116, 
+58, 108, 105, 115, 116, 45, 115, 116, 121, 108, 101, 62, 10, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 
+60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 115, 116, 121, 108, 101, 
+32, 115, 116, 121, 108, 101, 58, 110, 97, 109, 101, 61, 34, 76, 34, 62, 
+10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 9, 9, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 108, 101, 
+118, 101, 108, 45, 115, 116, 121, 108, 101, 45, 98, 117, 108, 108, 101, 116, 
+32, 116, 101, 120, 116, 58, 108, 101, 118, 101, 108, 61, 34, 49, 34, 32, 
+116, 101, 120, 116, 58, 98, 117, 108, 108, 101, 116, 45, 99, 104, 97, 114, 
+61, 34, 32, 34, 62, 10, 9, 9, 9, 9, 9, 9, 9, 60, 115, 116, 
+121, 108, 101, 58, 108, 105, 115, 116, 45, 108, 101, 118, 101, 108, 45, 112, 
+114, 111, 112, 101, 114, 116, 105, 101, 115, 10, 9, 9, 9, 9, 9, 9, 
+9, 9, 116, 101, 120, 116, 58, 115, 112, 97, 99, 101, 45, 98, 101, 102, 
+111, 114, 101, 61, 34, 53, 109, 109, 34, 10, 9, 9, 9, 9, 9, 9, 
+9, 9, 116, 101, 120, 116, 58, 109, 105, 110, 45, 108, 97, 98, 101, 108, 
+45, 119, 105, 100, 116, 104, 61, 34, 53, 109, 109, 34, 47, 62, 10, 9, 
+9, 9, 9, 9, 9, 60, 47, 116, 101, 120, 116, 58, 108, 105, 115, 116, 
+45, 108, 101, 118, 101, 108, 45, 115, 116, 121, 108, 101, 45, 98, 117, 108, 
+108, 101, 116, 62, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 
+32, 32, 32, 32, 32, 9, 60, 47, 116, 101, 120, 116, 58, 108, 105, 115, 
+116, 45, 115, 116, 121, 108, 101, 62, 10, 9, 9, 9, 9, 60, 47, 111, 
+102, 102, 105, 99, 101, 58, 115, 116, 121, 108, 101, 115, 62, 10, 9, 9, 
+9, 60, 47, 111, 102, 102, 105, 99, 101, 58, 100, 111, 99, 117, 109, 101, 
+110, 116, 45, 115, 116, 121, 108, 101, 115, 62, 10, 9, 9, 132, 4, 0, 
+3, 13, 2, 16, 0, 80, 14, 0, 0, 0, 88, 3, 42, 128, 54, 3, 
+0, 0, 57, 0, 1, 3, 15, 0, 0, 0, 88, 3, 17, 128, 18, 5, 
+0, 0, 57, 3, 2, 0, 39, 6, 3, 0, 66, 3, 3, 2, 14, 0, 
+3, 0, 88, 3, 4, 128, 18, 3, 0, 0, 18, 4, 2, 0, 38, 0, 
+4, 3, 88, 3, 8, 128, 18, 5, 0, 0, 57, 3, 4, 0, 39, 6, 
+3, 0, 18, 7, 2, 0, 66, 3, 4, 2, 18, 0, 3, 0, 88, 3, 
+1, 128, 39, 0, 5, 0, 54, 3, 6, 0, 18, 5, 1, 0, 39, 6, 
+7, 0, 43, 7, 2, 0, 18, 8, 0, 0, 66, 3, 5, 2, 18, 0, 
+3, 0, 14, 0, 0, 0, 88, 3, 2, 128, 43, 3, 1, 0, 76, 3, 
+2, 0, 18, 5, 0, 0, 57, 3, 2, 0, 39, 6, 8, 0, 66, 3, 
+3, 2, 15, 0, 3, 0, 88, 4, 3, 128, 18, 3, 0, 0, 18, 4, 
+2, 0, 38, 0, 4, 3, 54, 3, 9, 0, 39, 5, 10, 0, 66, 3, 
+2, 1, 45, 3, 0, 0, 18, 5, 0, 0, 66, 3, 2, 3, 43, 5, 
+1, 0, 15, 0, 3, 0, 88, 6, 10, 128, 54, 6, 11, 0, 54, 8, 
+0, 0, 45, 9, 1, 0, 18, 11, 3, 0, 54, 12, 0, 0, 66, 9, 
+3, 0, 65, 6, 1, 1, 18, 6, 4, 0, 66, 6, 1, 2, 18, 5, 
+6, 0, 14, 0, 5, 0, 88, 6, 11, 128, 54, 6, 12, 0, 43, 8, 
+0, 0, 39, 9, 13, 0, 18, 10, 0, 0, 39, 11, 14, 0, 38, 9, 
+11, 9, 66, 6, 3, 1, 54, 6, 15, 0, 66, 6, 1, 1, 43, 6, 
+1, 0, 76, 6, 2, 0, 54, 6, 15, 0, 66, 6, 1, 1, 43, 6, 
+2, 0, 76, 6, 2, 0, 7, 192, 6, 192, 16, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 6, 46, 36, 85, 110, 97, 98, 108, 101, 32, 
+116, 111, 32, 111, 112, 101, 110, 32, 116, 104, 101, 32, 111, 117, 116, 112, 
+117, 116, 32, 102, 105, 108, 101, 32, 17, 77, 111, 100, 97, 108, 77, 101, 
+115, 115, 97, 103, 101, 29, 69, 120, 112, 111, 114, 116, 70, 105, 108, 101, 
+85, 115, 105, 110, 103, 67, 97, 108, 108, 98, 97, 99, 107, 115, 17, 69, 
+120, 112, 111, 114, 116, 105, 110, 103, 46, 46, 46, 21, 73, 109, 109, 101, 
+100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 12, 47, 91, 94, 
+46, 93, 42, 36, 15, 69, 120, 112, 111, 114, 116, 32, 97, 115, 58, 16, 
+70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 14, 40, 117, 110, 110, 
+97, 109, 101, 100, 41, 9, 103, 115, 117, 98, 10, 37, 46, 46, 45, 36, 
+9, 102, 105, 110, 100, 9, 110, 97, 109, 101, 13, 68, 111, 99, 117, 109, 
+101, 110, 116, 50, 0, 1, 6, 1, 2, 0, 5, 45, 1, 0, 0, 18, 
+3, 0, 0, 39, 4, 0, 0, 39, 5, 1, 0, 68, 1, 4, 0, 8, 
+192, 9, 46, 111, 100, 116, 20, 69, 120, 112, 111, 114, 116, 32, 79, 68, 
+84, 32, 70, 105, 108, 101, 230, 10, 3, 0, 14, 0, 38, 1, 48, 54, 
+0, 0, 0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 2, 1, 42, 
+2, 0, 0, 54, 3, 0, 0, 57, 3, 3, 3, 18, 4, 3, 0, 53, 
+6, 4, 0, 53, 7, 5, 0, 61, 7, 6, 6, 66, 4, 2, 2, 53, 
+5, 8, 0, 53, 6, 7, 0, 61, 6, 9, 5, 53, 6, 10, 0, 61, 
+6, 11, 5, 53, 6, 12, 0, 61, 6, 13, 5, 53, 6, 14, 0, 61, 
+6, 15, 5, 53, 6, 16, 0, 61, 6, 17, 5, 53, 6, 18, 0, 61, 
+6, 19, 5, 53, 6, 20, 0, 61, 6, 21, 5, 53, 6, 22, 0, 61, 
+6, 23, 5, 53, 6, 24, 0, 61, 6, 25, 5, 53, 6, 26, 0, 61, 
+6, 27, 5, 53, 6, 28, 0, 61, 6, 29, 5, 51, 6, 30, 0, 51, 
+7, 31, 0, 51, 8, 32, 0, 54, 9, 33, 0, 51, 10, 35, 0, 61, 
+10, 34, 9, 54, 9, 36, 0, 39, 11, 37, 0, 18, 12, 6, 0, 18, 
+13, 7, 0, 66, 9, 4, 1, 50, 0, 0, 128, 75, 0, 1, 0, 8, 
+111, 100, 116, 21, 82, 101, 103, 105, 115, 116, 101, 114, 69, 120, 112, 111, 
+114, 116, 101, 114, 0, 18, 69, 120, 112, 111, 114, 116, 79, 68, 84, 70, 
+105, 108, 101, 8, 67, 109, 100, 0, 0, 0, 8, 80, 82, 69, 1, 4, 
+0, 0, 1, 35, 60, 116, 101, 120, 116, 58, 112, 32, 116, 101, 120, 116, 
+58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 80, 82, 69, 
+34, 62, 14, 60, 47, 116, 101, 120, 116, 58, 112, 62, 8, 82, 65, 87, 
+1, 4, 0, 0, 1, 5, 5, 6, 86, 1, 4, 0, 0, 1, 33, 60, 
+116, 101, 120, 116, 58, 112, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 
+101, 45, 110, 97, 109, 101, 61, 34, 86, 34, 62, 14, 60, 47, 116, 101, 
+120, 116, 58, 112, 62, 6, 81, 1, 4, 0, 0, 1, 33, 60, 116, 101, 
+120, 116, 58, 112, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 
+110, 97, 109, 101, 61, 34, 81, 34, 62, 14, 60, 47, 116, 101, 120, 116, 
+58, 112, 62, 7, 76, 66, 1, 4, 0, 0, 1, 81, 60, 116, 101, 120, 
+116, 58, 108, 105, 115, 116, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 
+101, 45, 110, 97, 109, 101, 61, 34, 76, 66, 34, 62, 60, 116, 101, 120, 
+116, 58, 108, 105, 115, 116, 45, 105, 116, 101, 109, 62, 60, 116, 101, 120, 
+116, 58, 112, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 
+97, 109, 101, 61, 34, 80, 34, 62, 43, 60, 47, 116, 101, 120, 116, 58, 
+112, 62, 60, 47, 116, 101, 120, 116, 58, 108, 105, 115, 116, 45, 105, 116, 
+101, 109, 62, 60, 47, 116, 101, 120, 116, 58, 108, 105, 115, 116, 62, 6, 
+76, 1, 4, 0, 0, 1, 80, 60, 116, 101, 120, 116, 58, 108, 105, 115, 
+116, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 
+101, 61, 34, 76, 34, 62, 60, 116, 101, 120, 116, 58, 108, 105, 115, 116, 
+45, 105, 116, 101, 109, 62, 60, 116, 101, 120, 116, 58, 112, 32, 116, 101, 
+120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 80, 
+34, 62, 43, 60, 47, 116, 101, 120, 116, 58, 112, 62, 60, 47, 116, 101, 
+120, 116, 58, 108, 105, 115, 116, 45, 105, 116, 101, 109, 62, 60, 47, 116, 
+101, 120, 116, 58, 108, 105, 115, 116, 62, 6, 80, 1, 4, 0, 0, 1, 
+33, 60, 116, 101, 120, 116, 58, 112, 32, 116, 101, 120, 116, 58, 115, 116, 
+121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 80, 34, 62, 14, 60, 47, 
+116, 101, 120, 116, 58, 112, 62, 7, 72, 52, 1, 4, 0, 0, 1, 57, 
+60, 116, 101, 120, 116, 58, 104, 32, 116, 101, 120, 116, 58, 115, 116, 121, 
+108, 101, 45, 110, 97, 109, 101, 61, 34, 72, 52, 34, 32, 116, 101, 120, 
+116, 58, 111, 117, 116, 108, 105, 110, 101, 45, 108, 101, 118, 101, 108, 61, 
+34, 52, 34, 62, 14, 60, 47, 116, 101, 120, 116, 58, 104, 62, 7, 72, 
+51, 1, 4, 0, 0, 1, 57, 60, 116, 101, 120, 116, 58, 104, 32, 116, 
+101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 
+72, 51, 34, 32, 116, 101, 120, 116, 58, 111, 117, 116, 108, 105, 110, 101, 
+45, 108, 101, 118, 101, 108, 61, 34, 51, 34, 62, 14, 60, 47, 116, 101, 
+120, 116, 58, 104, 62, 7, 72, 50, 1, 4, 0, 0, 1, 57, 60, 116, 
+101, 120, 116, 58, 104, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 
+45, 110, 97, 109, 101, 61, 34, 72, 50, 34, 32, 116, 101, 120, 116, 58, 
+111, 117, 116, 108, 105, 110, 101, 45, 108, 101, 118, 101, 108, 61, 34, 50, 
+34, 62, 14, 60, 47, 116, 101, 120, 116, 58, 104, 62, 7, 72, 49, 1, 
+0, 11, 6, 76, 0, 6, 80, 0, 8, 80, 82, 69, 0, 7, 72, 52, 
+0, 8, 82, 65, 87, 0, 6, 86, 0, 7, 72, 51, 0, 6, 81, 0, 
+7, 72, 50, 0, 7, 76, 66, 0, 7, 72, 49, 0, 1, 4, 0, 0, 
+1, 57, 60, 116, 101, 120, 116, 58, 104, 32, 116, 101, 120, 116, 58, 115, 
+116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 72, 49, 34, 32, 116, 
+101, 120, 116, 58, 111, 117, 116, 108, 105, 110, 101, 45, 108, 101, 118, 101, 
+108, 61, 34, 49, 34, 62, 14, 60, 47, 116, 101, 120, 116, 58, 104, 62, 
+12, 101, 115, 99, 97, 112, 101, 115, 1, 0, 9, 6, 10, 14, 60, 116, 
+101, 120, 116, 58, 115, 47, 62, 6, 62, 9, 38, 103, 116, 59, 6, 11, 
+14, 60, 116, 101, 120, 116, 58, 115, 47, 62, 6, 60, 9, 38, 108, 116, 
+59, 6, 12, 14, 60, 116, 101, 120, 116, 58, 115, 47, 62, 6, 13, 14, 
+60, 116, 101, 120, 116, 58, 115, 47, 62, 6, 9, 14, 60, 116, 101, 120, 
+116, 58, 115, 47, 62, 6, 38, 10, 38, 97, 109, 112, 59, 6, 32, 14, 
+60, 116, 101, 120, 116, 58, 115, 47, 62, 1, 0, 7, 13, 98, 111, 108, 
+100, 95, 111, 102, 102, 17, 60, 47, 116, 101, 120, 116, 58, 115, 112, 97, 
+110, 62, 12, 98, 111, 108, 100, 95, 111, 110, 36, 60, 116, 101, 120, 116, 
+58, 115, 112, 97, 110, 32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 
+45, 110, 97, 109, 101, 61, 34, 66, 34, 62, 18, 117, 110, 100, 101, 114, 
+108, 105, 110, 101, 95, 111, 102, 102, 17, 60, 47, 116, 101, 120, 116, 58, 
+115, 112, 97, 110, 62, 17, 117, 110, 100, 101, 114, 108, 105, 110, 101, 95, 
+111, 110, 37, 60, 116, 101, 120, 116, 58, 115, 112, 97, 110, 32, 116, 101, 
+120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 61, 34, 85, 
+76, 34, 62, 15, 105, 116, 97, 108, 105, 99, 95, 111, 102, 102, 17, 60, 
+47, 116, 101, 120, 116, 58, 115, 112, 97, 110, 62, 14, 105, 116, 97, 108, 
+105, 99, 95, 111, 110, 36, 60, 116, 101, 120, 116, 58, 115, 112, 97, 110, 
+32, 116, 101, 120, 116, 58, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 
+61, 34, 73, 34, 62, 12, 101, 115, 99, 97, 112, 101, 115, 0, 23, 99, 
+114, 101, 97, 116, 101, 101, 120, 112, 111, 114, 116, 102, 111, 114, 109, 97, 
+116, 17, 99, 114, 101, 97, 116, 101, 98, 117, 102, 102, 101, 114, 14, 99, 
+114, 101, 97, 116, 101, 122, 105, 112, 7, 119, 103, 128, 128, 8, 0, 
+};
+
+/* This is src/lua/import.lua */
+static const char file_22[] = {
+27, 76, 74, 2, 10, 98, 0, 1, 9, 0, 3, 2, 17, 52, 1, 0, 
+0, 18, 4, 0, 0, 57, 2, 0, 0, 39, 5, 1, 0, 66, 2, 3, 
+4, 88, 5, 3, 128, 21, 6, 1, 0, 22, 6, 0, 6, 60, 5, 6, 
+1, 69, 5, 3, 2, 82, 5, 251, 127, 21, 2, 1, 0, 9, 2, 1, 
+0, 88, 2, 2, 128, 53, 2, 2, 0, 76, 2, 2, 0, 76, 1, 2, 
+0, 1, 2, 0, 0, 5, 13, 91, 94, 32, 9, 13, 10, 93, 43, 11, 
+103, 109, 97, 116, 99, 104, 2, 0, 44, 0, 1, 2, 4, 0, 1, 7, 
+52, 1, 0, 0, 46, 0, 1, 0, 52, 1, 0, 0, 46, 1, 1, 0, 
+48, 2, 0, 0, 48, 3, 0, 0, 75, 0, 1, 0, 1, 128, 2, 128, 
+3, 128, 4, 128, 0, 35, 0, 2, 6, 2, 0, 0, 6, 45, 2, 1, 
+0, 45, 4, 0, 0, 18, 5, 1, 0, 66, 2, 3, 2, 46, 0, 2, 
+0, 75, 0, 1, 0, 4, 128, 0, 0, 49, 0, 2, 8, 3, 0, 0, 
+9, 45, 2, 1, 0, 45, 4, 2, 0, 45, 6, 0, 0, 18, 7, 1, 
+0, 66, 4, 3, 2, 18, 5, 1, 0, 66, 2, 3, 2, 46, 0, 2, 
+0, 75, 0, 1, 0, 4, 128, 1, 0, 0, 0, 101, 0, 2, 7, 4, 
+0, 2, 21, 45, 2, 0, 0, 45, 3, 1, 0, 4, 2, 3, 0, 88, 
+2, 11, 128, 45, 2, 2, 0, 45, 3, 2, 0, 21, 3, 3, 0, 22, 
+3, 0, 3, 45, 4, 3, 0, 45, 6, 1, 0, 27, 6, 1, 6, 66, 
+4, 2, 2, 60, 4, 3, 2, 45, 2, 1, 0, 46, 0, 2, 0, 45, 
+2, 2, 0, 45, 3, 2, 0, 21, 3, 3, 0, 22, 3, 0, 3, 60, 
+1, 3, 2, 75, 0, 1, 0, 3, 128, 4, 128, 2, 128, 2, 0, 2, 
+32, 93, 0, 2, 5, 4, 0, 2, 19, 45, 2, 0, 0, 21, 2, 2, 
+0, 41, 3, 0, 0, 0, 3, 2, 0, 88, 2, 2, 128, 15, 0, 1, 
+0, 88, 2, 11, 128, 45, 2, 1, 0, 45, 4, 0, 0, 66, 2, 2, 
+2, 45, 3, 2, 0, 45, 4, 2, 0, 21, 4, 4, 0, 22, 4, 0, 
+4, 60, 2, 4, 3, 52, 3, 0, 0, 46, 0, 3, 0, 48, 3, 1, 
+0, 75, 0, 1, 0, 2, 128, 3, 0, 1, 128, 3, 128, 2, 0, 196, 
+1, 0, 2, 7, 3, 6, 0, 30, 14, 0, 1, 0, 88, 2, 1, 128, 
+39, 1, 0, 0, 45, 2, 0, 0, 21, 2, 2, 0, 41, 3, 0, 0, 
+1, 3, 2, 0, 88, 2, 3, 128, 18, 4, 0, 0, 57, 2, 1, 0, 
+66, 2, 2, 1, 45, 2, 1, 0, 21, 2, 2, 0, 41, 3, 0, 0, 
+1, 3, 2, 0, 88, 2, 13, 128, 54, 2, 2, 0, 54, 4, 3, 0, 
+57, 4, 4, 4, 56, 4, 1, 4, 45, 5, 1, 0, 66, 2, 3, 2, 
+45, 3, 2, 0, 18, 5, 3, 0, 57, 3, 5, 3, 18, 6, 2, 0, 
+66, 3, 3, 1, 52, 3, 0, 0, 46, 1, 3, 0, 75, 0, 1, 0, 
+2, 128, 1, 128, 0, 192, 20, 97, 112, 112, 101, 110, 100, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 11, 115, 116, 121, 108, 101, 115, 16, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 20, 67, 114, 101, 97, 116, 101, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 14, 102, 108, 117, 115, 104, 119, 
+111, 114, 100, 6, 80, 204, 1, 1, 1, 7, 4, 13, 0, 16, 44, 1, 
+4, 0, 53, 5, 1, 0, 51, 6, 0, 0, 61, 6, 2, 5, 51, 6, 
+3, 0, 61, 6, 4, 5, 51, 6, 5, 0, 61, 6, 6, 5, 51, 6, 
+7, 0, 61, 6, 8, 5, 51, 6, 9, 0, 61, 6, 10, 5, 51, 6, 
+11, 0, 61, 6, 12, 5, 50, 0, 0, 128, 76, 5, 2, 0, 7, 192, 
+8, 192, 10, 192, 13, 192, 19, 102, 108, 117, 115, 104, 112, 97, 114, 97, 
+103, 114, 97, 112, 104, 0, 14, 102, 108, 117, 115, 104, 119, 111, 114, 100, 
+0, 9, 116, 101, 120, 116, 0, 14, 115, 116, 121, 108, 101, 95, 111, 102, 
+102, 0, 13, 115, 116, 121, 108, 101, 95, 111, 110, 0, 10, 114, 101, 115, 
+101, 116, 1, 0, 6, 19, 102, 108, 117, 115, 104, 112, 97, 114, 97, 103, 
+114, 97, 112, 104, 0, 10, 114, 101, 115, 101, 116, 0, 14, 102, 108, 117, 
+115, 104, 119, 111, 114, 100, 0, 9, 116, 101, 120, 116, 0, 14, 115, 116, 
+121, 108, 101, 95, 111, 102, 102, 0, 13, 115, 116, 121, 108, 101, 95, 111, 
+110, 0, 0, 151, 5, 0, 3, 12, 2, 20, 0, 99, 14, 0, 0, 0, 
+88, 3, 10, 128, 54, 3, 0, 0, 18, 5, 1, 0, 39, 6, 1, 0, 
+43, 7, 1, 0, 66, 3, 4, 2, 18, 0, 3, 0, 14, 0, 0, 0, 
+88, 3, 2, 128, 43, 3, 1, 0, 76, 3, 2, 0, 54, 3, 2, 0, 
+39, 5, 3, 0, 66, 3, 2, 1, 54, 3, 4, 0, 57, 3, 5, 3, 
+18, 5, 0, 0, 66, 3, 2, 2, 14, 0, 3, 0, 88, 4, 2, 128, 
+43, 4, 0, 0, 76, 4, 2, 0, 45, 4, 0, 0, 66, 4, 1, 1, 
+54, 4, 6, 0, 18, 6, 2, 0, 54, 7, 7, 0, 18, 8, 3, 0, 
+66, 4, 4, 3, 45, 6, 1, 0, 66, 6, 1, 1, 14, 0, 4, 0, 
+88, 6, 7, 128, 18, 8, 3, 0, 57, 6, 8, 3, 66, 6, 2, 1, 
+54, 6, 9, 0, 18, 8, 5, 0, 41, 9, 0, 0, 66, 6, 3, 1, 
+14, 0, 5, 0, 88, 6, 8, 128, 54, 6, 10, 0, 43, 8, 0, 0, 
+39, 9, 11, 0, 66, 6, 3, 1, 54, 6, 12, 0, 66, 6, 1, 1, 
+43, 6, 1, 0, 76, 6, 2, 0, 18, 8, 3, 0, 57, 6, 8, 3, 
+66, 6, 2, 1, 21, 6, 5, 0, 41, 7, 1, 0, 1, 7, 6, 0, 
+88, 6, 4, 128, 18, 8, 5, 0, 57, 6, 13, 5, 41, 9, 1, 0, 
+66, 6, 3, 1, 54, 6, 14, 0, 18, 8, 0, 0, 66, 6, 2, 2, 
+54, 7, 15, 0, 57, 7, 16, 7, 56, 7, 6, 7, 15, 0, 7, 0, 
+88, 8, 14, 128, 41, 7, 1, 0, 85, 8, 12, 128, 18, 8, 6, 0, 
+39, 9, 17, 0, 18, 10, 7, 0, 38, 8, 10, 8, 54, 9, 15, 0, 
+57, 9, 16, 9, 56, 9, 8, 9, 14, 0, 9, 0, 88, 9, 246, 127, 
+18, 6, 8, 0, 88, 8, 1, 128, 88, 8, 243, 127, 54, 7, 15, 0, 
+18, 9, 7, 0, 57, 7, 18, 7, 18, 10, 5, 0, 18, 11, 6, 0, 
+66, 7, 4, 1, 54, 7, 15, 0, 18, 9, 7, 0, 57, 7, 19, 7, 
+18, 10, 6, 0, 66, 7, 3, 1, 54, 7, 12, 0, 66, 7, 1, 1, 
+43, 7, 2, 0, 76, 7, 2, 0, 4, 192, 5, 192, 15, 115, 101, 116, 
+67, 117, 114, 114, 101, 110, 116, 16, 97, 100, 100, 68, 111, 99, 117, 109, 
+101, 110, 116, 6, 45, 14, 100, 111, 99, 117, 109, 101, 110, 116, 115, 16, 
+68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 13, 76, 101, 97, 102, 
+110, 97, 109, 101, 22, 100, 101, 108, 101, 116, 101, 80, 97, 114, 97, 103, 
+114, 97, 112, 104, 65, 116, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 
+97, 119, 69, 84, 104, 101, 32, 105, 109, 112, 111, 114, 116, 32, 102, 97, 
+105, 108, 101, 100, 44, 32, 112, 114, 111, 98, 97, 98, 108, 121, 32, 98, 
+101, 99, 97, 117, 115, 101, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 
+99, 111, 117, 108, 100, 32, 110, 111, 116, 32, 98, 101, 32, 102, 111, 117, 
+110, 100, 46, 17, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 
+10, 101, 114, 114, 111, 114, 10, 99, 108, 111, 115, 101, 14, 84, 114, 97, 
+99, 101, 98, 97, 99, 107, 11, 120, 112, 99, 97, 108, 108, 9, 111, 112, 
+101, 110, 7, 105, 111, 17, 73, 109, 112, 111, 114, 116, 105, 110, 103, 46, 
+46, 46, 21, 73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 
+97, 103, 101, 17, 73, 109, 112, 111, 114, 116, 32, 102, 114, 111, 109, 58, 
+16, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 197, 2, 3, 0, 
+15, 0, 24, 0, 36, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 0, 
+0, 57, 1, 2, 1, 54, 2, 0, 0, 57, 2, 3, 2, 54, 3, 0, 
+0, 57, 3, 4, 3, 54, 4, 0, 0, 57, 4, 5, 4, 54, 5, 0, 
+0, 57, 5, 6, 5, 54, 6, 7, 0, 57, 6, 8, 6, 54, 7, 7, 
+0, 57, 7, 9, 7, 54, 8, 7, 0, 57, 8, 10, 8, 54, 9, 7, 
+0, 57, 9, 11, 9, 54, 10, 12, 0, 57, 10, 13, 10, 54, 11, 12, 
+0, 57, 11, 14, 11, 54, 12, 12, 0, 57, 12, 15, 12, 54, 13, 16, 
+0, 57, 13, 17, 13, 51, 14, 18, 0, 55, 14, 19, 0, 51, 14, 20, 
+0, 55, 14, 21, 0, 51, 14, 22, 0, 55, 14, 23, 0, 50, 0, 0, 
+128, 75, 0, 1, 0, 21, 73, 109, 112, 111, 114, 116, 70, 105, 108, 101, 
+87, 105, 116, 104, 85, 73, 0, 19, 67, 114, 101, 97, 116, 101, 73, 109, 
+112, 111, 114, 116, 101, 114, 0, 25, 80, 97, 114, 115, 101, 83, 116, 114, 
+105, 110, 103, 73, 110, 116, 111, 87, 111, 114, 100, 115, 0, 11, 99, 111, 
+110, 99, 97, 116, 10, 116, 97, 98, 108, 101, 8, 115, 117, 98, 9, 102, 
+105, 110, 100, 9, 99, 104, 97, 114, 11, 115, 116, 114, 105, 110, 103, 10, 
+98, 116, 101, 115, 116, 9, 98, 120, 111, 114, 8, 98, 111, 114, 9, 98, 
+97, 110, 100, 10, 98, 105, 116, 51, 50, 13, 101, 110, 100, 97, 114, 101, 
+110, 97, 15, 98, 101, 103, 105, 110, 97, 114, 101, 110, 97, 12, 119, 114, 
+105, 116, 101, 117, 56, 14, 112, 97, 114, 115, 101, 119, 111, 114, 100, 14, 
+85, 78, 68, 69, 82, 76, 73, 78, 69, 11, 73, 84, 65, 76, 73, 67, 
+7, 119, 103, 0, 
+};
+
+/* This is src/lua/import/html.lua */
+static const char file_23[] = {
+27, 76, 74, 2, 10, 56, 0, 0, 4, 2, 2, 0, 7, 45, 0, 0, 
+0, 18, 2, 0, 0, 57, 0, 0, 0, 45, 3, 1, 0, 66, 0, 3, 
+1, 47, 1, 1, 0, 75, 0, 1, 0, 5, 192, 6, 128, 6, 80, 19, 
+102, 108, 117, 115, 104, 112, 97, 114, 97, 103, 114, 97, 112, 104, 45, 0, 
+0, 4, 2, 1, 0, 6, 45, 0, 0, 0, 18, 2, 0, 0, 57, 0, 
+0, 0, 45, 3, 1, 0, 66, 0, 3, 1, 75, 0, 1, 0, 5, 192, 
+7, 128, 14, 102, 108, 117, 115, 104, 119, 111, 114, 100, 45, 0, 0, 2, 
+3, 1, 0, 7, 45, 0, 0, 0, 66, 0, 1, 1, 45, 0, 1, 0, 
+15, 0, 0, 0, 88, 1, 1, 128, 47, 2, 0, 0, 75, 0, 1, 0, 
+8, 192, 7, 128, 6, 128, 8, 80, 82, 69, 30, 0, 0, 2, 2, 1, 
+0, 4, 45, 0, 0, 0, 66, 0, 1, 1, 47, 1, 0, 0, 75, 0, 
+1, 0, 8, 192, 6, 128, 7, 72, 49, 30, 0, 0, 2, 2, 1, 0, 
+4, 45, 0, 0, 0, 66, 0, 1, 1, 47, 1, 0, 0, 75, 0, 1, 
+0, 8, 192, 6, 128, 7, 72, 50, 30, 0, 0, 2, 2, 1, 0, 4, 
+45, 0, 0, 0, 66, 0, 1, 1, 47, 1, 0, 0, 75, 0, 1, 0, 
+8, 192, 6, 128, 7, 72, 51, 30, 0, 0, 2, 2, 1, 0, 4, 45, 
+0, 0, 0, 66, 0, 1, 1, 47, 1, 0, 0, 75, 0, 1, 0, 8, 
+192, 6, 128, 7, 72, 52, 30, 0, 0, 2, 2, 1, 0, 4, 45, 0, 
+0, 0, 66, 0, 1, 1, 47, 1, 0, 0, 75, 0, 1, 0, 8, 192, 
+6, 128, 7, 76, 66, 44, 0, 0, 4, 2, 1, 0, 6, 45, 0, 0, 
+0, 18, 2, 0, 0, 57, 0, 0, 0, 45, 3, 1, 0, 66, 0, 3, 
+1, 75, 0, 1, 0, 5, 192, 1, 0, 13, 115, 116, 121, 108, 101, 95, 
+111, 110, 44, 0, 0, 4, 2, 1, 0, 6, 45, 0, 0, 0, 18, 2, 
+0, 0, 57, 0, 0, 0, 45, 3, 1, 0, 66, 0, 3, 1, 75, 0, 
+1, 0, 5, 192, 1, 0, 13, 115, 116, 121, 108, 101, 95, 111, 110, 44, 
+0, 0, 4, 2, 1, 0, 6, 45, 0, 0, 0, 18, 2, 0, 0, 57, 
+0, 0, 0, 45, 3, 1, 0, 66, 0, 3, 1, 75, 0, 1, 0, 5, 
+192, 2, 0, 13, 115, 116, 121, 108, 101, 95, 111, 110, 44, 0, 0, 4, 
+2, 1, 0, 6, 45, 0, 0, 0, 18, 2, 0, 0, 57, 0, 0, 0, 
+45, 3, 1, 0, 66, 0, 3, 1, 75, 0, 1, 0, 5, 192, 3, 0, 
+13, 115, 116, 121, 108, 101, 95, 111, 110, 37, 0, 0, 2, 3, 1, 0, 
+5, 45, 0, 0, 0, 66, 0, 1, 1, 47, 1, 0, 0, 49, 2, 2, 
+0, 75, 0, 1, 0, 8, 192, 6, 128, 7, 128, 8, 80, 82, 69, 45, 
+0, 0, 4, 2, 1, 0, 6, 45, 0, 0, 0, 18, 2, 0, 0, 57, 
+0, 0, 0, 45, 3, 1, 0, 66, 0, 3, 1, 75, 0, 1, 0, 5, 
+192, 1, 0, 14, 115, 116, 121, 108, 101, 95, 111, 102, 102, 45, 0, 0, 
+4, 2, 1, 0, 6, 45, 0, 0, 0, 18, 2, 0, 0, 57, 0, 0, 
+0, 45, 3, 1, 0, 66, 0, 3, 1, 75, 0, 1, 0, 5, 192, 1, 
+0, 14, 115, 116, 121, 108, 101, 95, 111, 102, 102, 45, 0, 0, 4, 2, 
+1, 0, 6, 45, 0, 0, 0, 18, 2, 0, 0, 57, 0, 0, 0, 45, 
+3, 1, 0, 66, 0, 3, 1, 75, 0, 1, 0, 5, 192, 2, 0, 14, 
+115, 116, 121, 108, 101, 95, 111, 102, 102, 45, 0, 0, 4, 2, 1, 0, 
+6, 45, 0, 0, 0, 18, 2, 0, 0, 57, 0, 0, 0, 45, 3, 1, 
+0, 66, 0, 3, 1, 75, 0, 1, 0, 5, 192, 3, 0, 14, 115, 116, 
+121, 108, 101, 95, 111, 102, 102, 27, 0, 0, 2, 2, 0, 0, 4, 45, 
+0, 0, 0, 66, 0, 1, 1, 49, 1, 1, 0, 75, 0, 1, 0, 8, 
+192, 7, 128, 142, 6, 1, 1, 24, 4, 46, 0, 129, 1, 18, 3, 0, 
+0, 57, 1, 0, 0, 39, 4, 1, 0, 66, 1, 3, 2, 54, 2, 2, 
+0, 18, 4, 1, 0, 66, 2, 2, 2, 18, 1, 2, 0, 45, 2, 0, 
+0, 18, 4, 1, 0, 54, 5, 3, 0, 66, 2, 3, 2, 43, 3, 1, 
+0, 18, 4, 2, 0, 44, 5, 6, 0, 88, 7, 6, 128, 7, 7, 4, 
+0, 88, 9, 4, 128, 7, 8, 5, 0, 88, 9, 2, 128, 43, 3, 2, 
+0, 88, 4, 2, 128, 69, 7, 3, 3, 82, 7, 248, 127, 14, 0, 3, 
+0, 88, 4, 5, 128, 45, 4, 0, 0, 18, 6, 1, 0, 54, 7, 3, 
+0, 66, 4, 3, 2, 18, 2, 4, 0, 54, 4, 6, 0, 66, 4, 1, 
+2, 54, 5, 7, 0, 18, 7, 4, 0, 66, 5, 2, 2, 39, 6, 8, 
+0, 43, 7, 1, 0, 51, 8, 9, 0, 51, 9, 10, 0, 51, 10, 11, 
+0, 53, 11, 12, 0, 61, 8, 13, 11, 61, 10, 14, 11, 51, 12, 15, 
+0, 61, 12, 16, 11, 51, 12, 17, 0, 61, 12, 18, 11, 51, 12, 19, 
+0, 61, 12, 20, 11, 51, 12, 21, 0, 61, 12, 22, 11, 51, 12, 23, 
+0, 61, 12, 24, 11, 51, 12, 25, 0, 61, 12, 26, 11, 51, 12, 27, 
+0, 61, 12, 28, 11, 51, 12, 29, 0, 61, 12, 30, 11, 51, 12, 31, 
+0, 61, 12, 32, 11, 51, 12, 33, 0, 61, 12, 34, 11, 53, 12, 35, 
+0, 61, 8, 16, 12, 61, 8, 18, 12, 61, 8, 20, 12, 61, 8, 22, 
+12, 51, 13, 36, 0, 61, 13, 26, 12, 51, 13, 37, 0, 61, 13, 28, 
+12, 51, 13, 38, 0, 61, 13, 30, 12, 51, 13, 39, 0, 61, 13, 32, 
+12, 51, 13, 40, 0, 61, 13, 34, 12, 18, 15, 5, 0, 57, 13, 41, 
+5, 66, 13, 2, 1, 18, 13, 2, 0, 44, 14, 15, 0, 88, 16, 38, 
+128, 7, 16, 42, 0, 88, 18, 5, 128, 18, 20, 5, 0, 57, 18, 42, 
+5, 18, 21, 17, 0, 66, 18, 3, 1, 88, 18, 31, 128, 7, 16, 43, 
+0, 88, 18, 8, 128, 41, 18, 1, 0, 18, 19, 17, 0, 41, 20, 1, 
+0, 77, 18, 3, 128, 18, 22, 9, 0, 66, 22, 1, 1, 79, 18, 253, 
+127, 88, 18, 21, 128, 7, 16, 44, 0, 88, 18, 9, 128, 15, 0, 7, 
+0, 88, 18, 4, 128, 18, 18, 8, 0, 66, 18, 1, 1, 39, 6, 45, 
+0, 88, 18, 13, 128, 18, 18, 9, 0, 66, 18, 1, 1, 88, 18, 10, 
+128, 43, 18, 0, 0, 7, 16, 4, 0, 88, 19, 2, 128, 56, 18, 17, 
+11, 88, 19, 1, 128, 56, 18, 17, 12, 15, 0, 18, 0, 88, 19, 2, 
+128, 18, 19, 18, 0, 66, 19, 1, 1, 69, 16, 3, 3, 82, 16, 216, 
+127, 18, 13, 8, 0, 66, 13, 1, 1, 50, 0, 0, 128, 76, 4, 2, 
+0, 13, 192, 0, 192, 1, 192, 2, 192, 8, 80, 82, 69, 12, 110, 101, 
+119, 108, 105, 110, 101, 10, 115, 112, 97, 99, 101, 9, 116, 101, 120, 116, 
+10, 114, 101, 115, 101, 116, 0, 0, 0, 0, 0, 1, 0, 9, 6, 117, 
+0, 7, 101, 109, 0, 6, 105, 0, 7, 104, 52, 0, 7, 104, 51, 0, 
+7, 104, 50, 0, 7, 104, 49, 0, 8, 112, 114, 101, 0, 6, 98, 0, 
+8, 112, 114, 101, 0, 6, 98, 0, 6, 117, 0, 7, 101, 109, 0, 6, 
+105, 0, 7, 108, 105, 0, 7, 104, 52, 0, 7, 104, 51, 0, 7, 104, 
+50, 0, 7, 104, 49, 0, 7, 98, 114, 6, 112, 1, 0, 12, 6, 117, 
+0, 7, 101, 109, 0, 6, 105, 0, 7, 108, 105, 0, 7, 104, 52, 0, 
+7, 104, 51, 0, 6, 112, 0, 7, 104, 49, 0, 7, 98, 114, 0, 7, 
+104, 50, 0, 8, 112, 114, 101, 0, 6, 98, 0, 0, 0, 0, 6, 80, 
+19, 67, 114, 101, 97, 116, 101, 73, 109, 112, 111, 114, 116, 101, 114, 19, 
+67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 109, 101, 110, 116, 9, 98, 
+111, 100, 121, 12, 111, 112, 101, 110, 116, 97, 103, 17, 72, 84, 77, 76, 
+69, 110, 116, 105, 116, 105, 101, 115, 23, 67, 97, 110, 111, 110, 105, 99, 
+97, 108, 105, 115, 101, 83, 116, 114, 105, 110, 103, 7, 42, 97, 9, 114, 
+101, 97, 100, 63, 0, 1, 6, 1, 2, 0, 5, 54, 1, 0, 0, 18, 
+3, 0, 0, 39, 4, 1, 0, 45, 5, 0, 0, 68, 1, 4, 0, 14, 
+192, 21, 73, 109, 112, 111, 114, 116, 32, 72, 84, 77, 76, 32, 70, 105, 
+108, 101, 21, 73, 109, 112, 111, 114, 116, 70, 105, 108, 101, 87, 105, 116, 
+104, 85, 73, 152, 2, 3, 0, 17, 0, 22, 0, 34, 54, 0, 0, 0, 
+57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 2, 1, 54, 2, 0, 0, 
+57, 2, 3, 2, 54, 3, 0, 0, 57, 3, 4, 3, 54, 4, 0, 0, 
+57, 4, 5, 4, 54, 5, 6, 0, 57, 5, 7, 5, 54, 6, 6, 0, 
+57, 6, 8, 6, 54, 7, 6, 0, 57, 7, 9, 7, 54, 8, 6, 0, 
+57, 8, 10, 8, 54, 9, 11, 0, 57, 9, 12, 9, 54, 10, 11, 0, 
+57, 10, 13, 10, 54, 11, 11, 0, 57, 11, 14, 11, 54, 12, 15, 0, 
+57, 12, 16, 12, 54, 13, 0, 0, 57, 13, 17, 13, 51, 14, 18, 0, 
+54, 15, 19, 0, 51, 16, 21, 0, 61, 16, 20, 15, 50, 0, 0, 128, 
+75, 0, 1, 0, 0, 19, 73, 109, 112, 111, 114, 116, 72, 84, 77, 76, 
+70, 105, 108, 101, 8, 67, 109, 100, 0, 17, 116, 111, 107, 101, 110, 105, 
+115, 101, 104, 116, 109, 108, 11, 99, 111, 110, 99, 97, 116, 10, 116, 97, 
+98, 108, 101, 8, 115, 117, 98, 9, 102, 105, 110, 100, 9, 99, 104, 97, 
+114, 11, 115, 116, 114, 105, 110, 103, 10, 98, 116, 101, 115, 116, 9, 98, 
+120, 111, 114, 8, 98, 111, 114, 9, 98, 97, 110, 100, 10, 98, 105, 116, 
+51, 50, 12, 119, 114, 105, 116, 101, 117, 56, 14, 112, 97, 114, 115, 101, 
+119, 111, 114, 100, 9, 66, 79, 76, 68, 14, 85, 78, 68, 69, 82, 76, 
+73, 78, 69, 11, 73, 84, 65, 76, 73, 67, 7, 119, 103, 0, 
+};
+
+/* This is src/lua/import/text.lua */
+static const char file_24[] = {
+27, 76, 74, 2, 10, 255, 1, 0, 1, 12, 0, 12, 0, 31, 54, 1, 
+0, 0, 66, 1, 1, 2, 18, 4, 0, 0, 57, 2, 1, 0, 66, 2, 
+2, 4, 88, 5, 22, 128, 54, 6, 2, 0, 18, 8, 5, 0, 66, 6, 
+2, 2, 18, 5, 6, 0, 18, 8, 5, 0, 57, 6, 3, 5, 39, 9, 
+4, 0, 39, 10, 5, 0, 66, 6, 4, 2, 18, 5, 6, 0, 54, 6, 
+6, 0, 54, 8, 7, 0, 57, 8, 8, 8, 57, 8, 9, 8, 54, 9, 
+10, 0, 18, 11, 5, 0, 66, 9, 2, 0, 65, 6, 1, 2, 18, 9, 
+1, 0, 57, 7, 11, 1, 18, 10, 6, 0, 66, 7, 3, 1, 69, 5, 
+3, 2, 82, 5, 232, 127, 76, 1, 2, 0, 20, 97, 112, 112, 101, 110, 
+100, 80, 97, 114, 97, 103, 114, 97, 112, 104, 25, 80, 97, 114, 115, 101, 
+83, 116, 114, 105, 110, 103, 73, 110, 116, 111, 87, 111, 114, 100, 115, 6, 
+80, 11, 115, 116, 121, 108, 101, 115, 16, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 20, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 
+114, 97, 112, 104, 5, 8, 37, 99, 43, 9, 103, 115, 117, 98, 23, 67, 
+97, 110, 111, 110, 105, 99, 97, 108, 105, 115, 101, 83, 116, 114, 105, 110, 
+103, 10, 108, 105, 110, 101, 115, 19, 67, 114, 101, 97, 116, 101, 68, 111, 
+99, 117, 109, 101, 110, 116, 63, 0, 1, 6, 1, 2, 0, 5, 54, 1, 
+0, 0, 18, 3, 0, 0, 39, 4, 1, 0, 45, 5, 0, 0, 68, 1, 
+4, 0, 12, 192, 21, 73, 109, 112, 111, 114, 116, 32, 84, 101, 120, 116, 
+32, 70, 105, 108, 101, 21, 73, 109, 112, 111, 114, 116, 70, 105, 108, 101, 
+87, 105, 116, 104, 85, 73, 246, 1, 3, 0, 15, 0, 20, 0, 30, 54, 
+0, 0, 0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 2, 1, 54, 
+2, 0, 0, 57, 2, 3, 2, 54, 3, 0, 0, 57, 3, 4, 3, 54, 
+4, 5, 0, 57, 4, 6, 4, 54, 5, 5, 0, 57, 5, 7, 5, 54, 
+6, 5, 0, 57, 6, 8, 6, 54, 7, 5, 0, 57, 7, 9, 7, 54, 
+8, 10, 0, 57, 8, 11, 8, 54, 9, 10, 0, 57, 9, 12, 9, 54, 
+10, 10, 0, 57, 10, 13, 10, 54, 11, 14, 0, 57, 11, 15, 11, 51, 
+12, 16, 0, 54, 13, 17, 0, 51, 14, 19, 0, 61, 14, 18, 13, 50, 
+0, 0, 128, 75, 0, 1, 0, 0, 19, 73, 109, 112, 111, 114, 116, 84, 
+101, 120, 116, 70, 105, 108, 101, 8, 67, 109, 100, 0, 11, 99, 111, 110, 
+99, 97, 116, 10, 116, 97, 98, 108, 101, 8, 115, 117, 98, 9, 102, 105, 
+110, 100, 9, 99, 104, 97, 114, 11, 115, 116, 114, 105, 110, 103, 10, 98, 
+116, 101, 115, 116, 9, 98, 120, 111, 114, 8, 98, 111, 114, 9, 98, 97, 
+110, 100, 10, 98, 105, 116, 51, 50, 12, 119, 114, 105, 116, 101, 117, 56, 
+14, 112, 97, 114, 115, 101, 119, 111, 114, 100, 14, 85, 78, 68, 69, 82, 
+76, 73, 78, 69, 11, 73, 84, 65, 76, 73, 67, 7, 119, 103, 0, 
+};
+
+/* This is src/lua/import/opendocument.lua */
+static const char file_25[] = {
+27, 76, 74, 2, 10, 82, 0, 2, 7, 2, 1, 0, 16, 45, 2, 0, 
+0, 56, 2, 0, 2, 56, 3, 1, 2, 15, 0, 3, 0, 88, 4, 2, 
+128, 43, 3, 2, 0, 76, 3, 2, 0, 57, 3, 0, 2, 15, 0, 3, 
+0, 88, 4, 4, 128, 45, 3, 1, 0, 57, 5, 0, 2, 18, 6, 1, 
+0, 68, 3, 3, 0, 43, 3, 0, 0, 76, 3, 2, 0, 0, 192, 1, 
+192, 11, 112, 97, 114, 101, 110, 116, 161, 1, 1, 1, 11, 0, 6, 0, 
+29, 51, 1, 0, 0, 54, 2, 1, 0, 18, 4, 0, 0, 66, 2, 2, 
+4, 72, 5, 20, 128, 18, 7, 1, 0, 18, 9, 5, 0, 39, 10, 2, 
+0, 66, 7, 3, 2, 61, 7, 2, 6, 18, 7, 1, 0, 18, 9, 5, 
+0, 39, 10, 3, 0, 66, 7, 3, 2, 61, 7, 3, 6, 18, 7, 1, 
+0, 18, 9, 5, 0, 39, 10, 4, 0, 66, 7, 3, 2, 61, 7, 4, 
+6, 18, 7, 1, 0, 18, 9, 5, 0, 39, 10, 5, 0, 66, 7, 3, 
+2, 61, 7, 5, 6, 70, 5, 3, 3, 82, 5, 234, 127, 50, 0, 0, 
+128, 75, 0, 1, 0, 13, 105, 110, 100, 101, 110, 116, 101, 100, 14, 117, 
+110, 100, 101, 114, 108, 105, 110, 101, 9, 98, 111, 108, 100, 11, 105, 116, 
+97, 108, 105, 99, 10, 112, 97, 105, 114, 115, 0, 184, 1, 0, 2, 11, 
+2, 5, 0, 37, 43, 2, 1, 0, 45, 3, 0, 0, 18, 5, 1, 0, 
+39, 6, 0, 0, 66, 3, 3, 2, 15, 0, 3, 0, 88, 4, 1, 128, 
+43, 2, 2, 0, 45, 3, 1, 0, 18, 5, 1, 0, 39, 6, 1, 0, 
+66, 3, 3, 4, 88, 6, 11, 128, 15, 0, 2, 0, 88, 7, 4, 128, 
+18, 9, 0, 0, 57, 7, 2, 0, 43, 10, 1, 0, 66, 7, 3, 1, 
+18, 9, 0, 0, 57, 7, 3, 0, 18, 10, 6, 0, 66, 7, 3, 1, 
+43, 2, 2, 0, 69, 6, 3, 2, 82, 6, 243, 127, 45, 3, 0, 0, 
+18, 5, 1, 0, 39, 6, 4, 0, 66, 3, 3, 2, 15, 0, 3, 0, 
+88, 4, 4, 128, 18, 5, 0, 0, 57, 3, 2, 0, 43, 6, 1, 0, 
+66, 3, 3, 1, 75, 0, 1, 0, 12, 192, 14, 192, 7, 32, 36, 9, 
+116, 101, 120, 116, 14, 102, 108, 117, 115, 104, 119, 111, 114, 100, 8, 37, 
+83, 43, 7, 94, 32, 232, 13, 0, 3, 49, 10, 52, 1, 200, 2, 45, 
+3, 0, 0, 39, 4, 0, 0, 38, 3, 4, 3, 45, 4, 0, 0, 39, 
+5, 1, 0, 38, 4, 5, 4, 45, 5, 0, 0, 39, 6, 2, 0, 38, 
+5, 6, 5, 45, 6, 0, 0, 39, 7, 3, 0, 38, 6, 7, 6, 45, 
+7, 1, 0, 39, 8, 4, 0, 38, 7, 8, 7, 45, 8, 1, 0, 39, 
+9, 5, 0, 38, 8, 9, 8, 45, 9, 1, 0, 39, 10, 6, 0, 38, 
+9, 10, 9, 45, 10, 1, 0, 39, 11, 7, 0, 38, 10, 11, 10, 45, 
+11, 1, 0, 39, 12, 8, 0, 38, 11, 12, 11, 45, 12, 2, 0, 39, 
+13, 9, 0, 38, 12, 13, 12, 45, 13, 2, 0, 39, 14, 10, 0, 38, 
+13, 14, 13, 45, 14, 1, 0, 39, 15, 11, 0, 38, 14, 15, 14, 45, 
+15, 2, 0, 39, 16, 12, 0, 38, 15, 16, 15, 45, 16, 3, 0, 39, 
+17, 13, 0, 38, 16, 17, 16, 45, 17, 3, 0, 39, 18, 14, 0, 38, 
+17, 18, 17, 45, 18, 3, 0, 39, 19, 15, 0, 38, 18, 19, 18, 45, 
+19, 3, 0, 39, 20, 16, 0, 38, 19, 20, 19, 45, 20, 3, 0, 39, 
+21, 17, 0, 38, 20, 21, 20, 45, 21, 3, 0, 39, 22, 18, 0, 38, 
+21, 22, 21, 45, 22, 3, 0, 39, 23, 19, 0, 38, 22, 23, 22, 45, 
+23, 3, 0, 39, 24, 20, 0, 38, 23, 24, 23, 52, 24, 0, 0, 52, 
+25, 0, 0, 41, 26, 0, 0, 41, 27, 0, 0, 45, 28, 4, 0, 18, 
+30, 2, 0, 66, 28, 2, 4, 88, 31, 254, 128, 41, 35, 0, 0, 1, 
+35, 27, 0, 88, 35, 8, 128, 7, 31, 21, 0, 88, 35, 2, 128, 22, 
+27, 0, 27, 88, 35, 247, 128, 7, 31, 22, 0, 88, 35, 245, 128, 23, 
+27, 0, 27, 88, 35, 243, 128, 7, 31, 21, 0, 88, 35, 186, 128, 18, 
+35, 32, 0, 39, 36, 23, 0, 18, 37, 33, 0, 38, 35, 37, 35, 18, 
+36, 34, 0, 56, 37, 26, 24, 39, 38, 24, 0, 43, 39, 0, 0, 14, 
+0, 37, 0, 88, 40, 2, 128, 39, 38, 25, 0, 88, 40, 166, 128, 7, 
+37, 25, 0, 88, 40, 13, 128, 5, 35, 3, 0, 88, 40, 5, 128, 39, 
+38, 26, 0, 45, 40, 5, 0, 18, 42, 0, 0, 66, 40, 2, 1, 88, 
+40, 157, 128, 4, 35, 5, 0, 88, 40, 2, 128, 5, 35, 6, 0, 88, 
+40, 153, 128, 39, 38, 27, 0, 88, 40, 151, 128, 7, 37, 26, 0, 88, 
+40, 5, 128, 5, 35, 4, 0, 88, 40, 147, 128, 39, 38, 28, 0, 39, 
+39, 29, 0, 88, 40, 144, 128, 7, 37, 27, 0, 88, 40, 12, 128, 5, 
+35, 7, 0, 88, 40, 140, 128, 39, 38, 30, 0, 53, 40, 31, 0, 56, 
+41, 9, 36, 61, 41, 32, 40, 18, 39, 40, 0, 56, 40, 8, 36, 15, 
+0, 40, 0, 88, 41, 132, 128, 60, 39, 40, 0, 88, 40, 130, 128, 7, 
+37, 30, 0, 88, 40, 27, 128, 56, 40, 26, 25, 5, 35, 10, 0, 88, 
+41, 16, 128, 56, 41, 12, 36, 7, 41, 33, 0, 88, 41, 2, 128, 43, 
+41, 2, 0, 61, 41, 33, 40, 56, 41, 13, 36, 7, 41, 34, 0, 88, 
+41, 2, 128, 43, 41, 2, 0, 61, 41, 34, 40, 56, 41, 14, 36, 7, 
+41, 35, 0, 88, 41, 112, 128, 43, 41, 2, 0, 61, 41, 36, 40, 88, 
+41, 109, 128, 5, 35, 11, 0, 88, 41, 107, 128, 56, 41, 15, 36, 15, 
+0, 41, 0, 88, 42, 104, 128, 43, 41, 2, 0, 61, 41, 37, 40, 88, 
+40, 101, 128, 7, 37, 28, 0, 88, 40, 38, 128, 5, 35, 16, 0, 88, 
+40, 15, 128, 56, 40, 20, 36, 14, 0, 40, 0, 88, 41, 1, 128, 39, 
+40, 38, 0, 56, 40, 40, 0, 14, 0, 40, 0, 88, 41, 1, 128, 52, 
+40, 0, 0, 39, 38, 39, 0, 56, 39, 26, 25, 57, 41, 37, 40, 15, 
+0, 41, 0, 88, 42, 84, 128, 39, 39, 40, 0, 88, 40, 82, 128, 5, 
+35, 17, 0, 88, 40, 15, 128, 54, 40, 41, 0, 56, 42, 19, 36, 14, 
+0, 42, 0, 88, 43, 1, 128, 41, 42, 1, 0, 66, 40, 2, 2, 41, 
+41, 4, 0, 1, 41, 40, 0, 88, 41, 1, 128, 41, 40, 4, 0, 39, 
+38, 39, 0, 39, 41, 42, 0, 18, 42, 40, 0, 38, 39, 42, 41, 88, 
+40, 65, 128, 5, 35, 18, 0, 88, 40, 63, 128, 39, 38, 43, 0, 88, 
+40, 61, 128, 7, 37, 43, 0, 88, 40, 3, 128, 39, 38, 28, 0, 39, 
+39, 44, 0, 88, 40, 56, 128, 6, 37, 39, 0, 88, 40, 2, 128, 7, 
+37, 45, 0, 88, 40, 52, 128, 39, 38, 45, 0, 5, 35, 21, 0, 88, 
+40, 17, 128, 54, 40, 41, 0, 56, 42, 22, 36, 14, 0, 42, 0, 88, 
+43, 1, 128, 41, 42, 0, 0, 66, 40, 2, 2, 22, 40, 0, 40, 41, 
+41, 1, 0, 18, 42, 40, 0, 41, 43, 1, 0, 77, 41, 5, 128, 18, 
+47, 1, 0, 57, 45, 46, 1, 43, 48, 1, 0, 66, 45, 3, 1, 79, 
+41, 251, 127, 88, 40, 32, 128, 5, 35, 23, 0, 88, 40, 30, 128, 56, 
+40, 20, 36, 14, 0, 40, 0, 88, 41, 1, 128, 39, 40, 38, 0, 56, 
+40, 40, 0, 14, 0, 40, 0, 88, 41, 1, 128, 52, 40, 0, 0, 57, 
+41, 33, 40, 15, 0, 41, 0, 88, 42, 4, 128, 18, 43, 1, 0, 57, 
+41, 47, 1, 45, 44, 6, 0, 66, 41, 3, 1, 57, 41, 34, 40, 15, 
+0, 41, 0, 88, 42, 4, 128, 18, 43, 1, 0, 57, 41, 47, 1, 45, 
+44, 7, 0, 66, 41, 3, 1, 57, 41, 36, 40, 15, 0, 41, 0, 88, 
+42, 4, 128, 18, 43, 1, 0, 57, 41, 47, 1, 45, 44, 8, 0, 66, 
+41, 3, 1, 18, 39, 40, 0, 7, 38, 24, 0, 88, 40, 2, 128, 41, 
+27, 1, 0, 88, 40, 59, 128, 22, 26, 0, 26, 60, 38, 26, 24, 60, 
+39, 26, 25, 88, 35, 55, 128, 7, 31, 22, 0, 88, 35, 40, 128, 56, 
+35, 26, 24, 56, 36, 26, 25, 7, 35, 39, 0, 88, 37, 5, 128, 18, 
+39, 1, 0, 57, 37, 48, 1, 18, 40, 36, 0, 66, 37, 3, 1, 88, 
+37, 25, 128, 7, 35, 45, 0, 88, 37, 23, 128, 15, 0, 36, 0, 88, 
+37, 21, 128, 57, 37, 36, 36, 15, 0, 37, 0, 88, 38, 4, 128, 18, 
+39, 1, 0, 57, 37, 49, 1, 45, 40, 8, 0, 66, 37, 3, 1, 57, 
+37, 34, 36, 15, 0, 37, 0, 88, 38, 4, 128, 18, 39, 1, 0, 57, 
+37, 49, 1, 45, 40, 7, 0, 66, 37, 3, 1, 57, 37, 33, 36, 15, 
+0, 37, 0, 88, 38, 4, 128, 18, 39, 1, 0, 57, 37, 49, 1, 45, 
+40, 6, 0, 66, 37, 3, 1, 43, 37, 0, 0, 60, 37, 26, 24, 43, 
+37, 0, 0, 60, 37, 26, 25, 23, 26, 0, 26, 88, 35, 13, 128, 6, 
+31, 50, 0, 88, 35, 2, 128, 7, 31, 51, 0, 88, 35, 9, 128, 56, 
+35, 26, 24, 6, 35, 39, 0, 88, 36, 2, 128, 7, 35, 45, 0, 88, 
+36, 4, 128, 45, 36, 9, 0, 18, 38, 1, 0, 18, 39, 32, 0, 66, 
+36, 3, 1, 69, 31, 3, 5, 82, 31, 0, 127, 75, 0, 1, 0, 16, 
+192, 17, 192, 18, 192, 19, 192, 6, 192, 20, 192, 0, 192, 2, 192, 1, 
+192, 21, 192, 10, 99, 100, 97, 116, 97, 9, 116, 101, 120, 116, 14, 115, 
+116, 121, 108, 101, 95, 111, 102, 102, 19, 102, 108, 117, 115, 104, 112, 97, 
+114, 97, 103, 114, 97, 112, 104, 13, 115, 116, 121, 108, 101, 95, 111, 110, 
+14, 102, 108, 117, 115, 104, 119, 111, 114, 100, 11, 105, 110, 108, 105, 110, 
+101, 7, 76, 66, 9, 108, 105, 115, 116, 6, 72, 13, 116, 111, 110, 117, 
+109, 98, 101, 114, 6, 81, 14, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+5, 13, 105, 110, 100, 101, 110, 116, 101, 100, 14, 117, 110, 100, 101, 114, 
+108, 105, 110, 101, 10, 115, 111, 108, 105, 100, 9, 98, 111, 108, 100, 11, 
+105, 116, 97, 108, 105, 99, 11, 112, 97, 114, 101, 110, 116, 1, 0, 1, 
+11, 112, 97, 114, 101, 110, 116, 0, 10, 115, 116, 121, 108, 101, 6, 80, 
+15, 112, 97, 114, 97, 103, 114, 97, 112, 104, 115, 11, 115, 116, 121, 108, 
+101, 115, 9, 98, 111, 100, 121, 13, 100, 111, 99, 117, 109, 101, 110, 116, 
+9, 115, 107, 105, 112, 6, 32, 13, 99, 108, 111, 115, 101, 116, 97, 103, 
+12, 111, 112, 101, 110, 116, 97, 103, 10, 32, 115, 112, 97, 110, 7, 32, 
+99, 7, 32, 115, 16, 32, 115, 116, 121, 108, 101, 45, 110, 97, 109, 101, 
+19, 32, 111, 117, 116, 108, 105, 110, 101, 45, 108, 101, 118, 101, 108, 10, 
+32, 108, 105, 115, 116, 7, 32, 104, 7, 32, 112, 17, 32, 109, 97, 114, 
+103, 105, 110, 45, 108, 101, 102, 116, 26, 32, 116, 101, 120, 116, 45, 117, 
+110, 100, 101, 114, 108, 105, 110, 101, 45, 115, 116, 121, 108, 101, 17, 32, 
+102, 111, 110, 116, 45, 119, 101, 105, 103, 104, 116, 16, 32, 102, 111, 110, 
+116, 45, 115, 116, 121, 108, 101, 26, 32, 112, 97, 114, 97, 103, 114, 97, 
+112, 104, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 21, 32, 116, 
+101, 120, 116, 45, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 17, 32, 
+112, 97, 114, 101, 110, 116, 45, 110, 97, 109, 101, 10, 32, 110, 97, 109, 
+101, 11, 32, 115, 116, 121, 108, 101, 22, 32, 97, 117, 116, 111, 109, 97, 
+116, 105, 99, 45, 115, 116, 121, 108, 101, 115, 12, 32, 115, 116, 121, 108, 
+101, 115, 10, 32, 116, 101, 120, 116, 10, 32, 98, 111, 100, 121, 2, 252, 
+5, 0, 1, 13, 2, 22, 0, 112, 14, 0, 0, 0, 88, 1, 10, 128, 
+54, 1, 0, 0, 39, 3, 1, 0, 39, 4, 2, 0, 43, 5, 1, 0, 
+66, 1, 4, 2, 18, 0, 1, 0, 14, 0, 0, 0, 88, 1, 2, 128, 
+43, 1, 1, 0, 76, 1, 2, 0, 54, 1, 3, 0, 39, 3, 4, 0, 
+66, 1, 2, 1, 45, 1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 2, 
+44, 2, 3, 0, 15, 0, 1, 0, 88, 4, 13, 128, 18, 6, 1, 0, 
+57, 4, 5, 1, 39, 7, 6, 0, 66, 4, 3, 2, 18, 2, 4, 0, 
+18, 6, 1, 0, 57, 4, 5, 1, 39, 7, 7, 0, 66, 4, 3, 2, 
+18, 3, 4, 0, 18, 6, 1, 0, 57, 4, 8, 1, 66, 4, 2, 1, 
+15, 0, 2, 0, 88, 4, 2, 128, 14, 0, 3, 0, 88, 4, 8, 128, 
+54, 4, 9, 0, 43, 6, 0, 0, 39, 7, 10, 0, 66, 4, 3, 1, 
+54, 4, 11, 0, 66, 4, 1, 1, 43, 4, 1, 0, 76, 4, 2, 0, 
+52, 4, 0, 0, 54, 5, 12, 0, 66, 5, 1, 2, 54, 6, 13, 0, 
+18, 8, 5, 0, 66, 6, 2, 2, 18, 9, 6, 0, 57, 7, 14, 6, 
+66, 7, 2, 1, 45, 7, 1, 0, 18, 9, 4, 0, 18, 10, 6, 0, 
+18, 11, 2, 0, 66, 7, 4, 1, 43, 2, 0, 0, 45, 7, 1, 0, 
+18, 9, 4, 0, 18, 10, 6, 0, 18, 11, 3, 0, 66, 7, 4, 1, 
+43, 3, 0, 0, 21, 7, 5, 0, 41, 8, 1, 0, 1, 8, 7, 0, 
+88, 7, 4, 128, 18, 9, 5, 0, 57, 7, 15, 5, 41, 10, 1, 0, 
+66, 7, 3, 1, 54, 7, 16, 0, 18, 9, 0, 0, 66, 7, 2, 2, 
+54, 8, 17, 0, 57, 8, 18, 8, 56, 8, 7, 8, 15, 0, 8, 0, 
+88, 9, 14, 128, 41, 8, 1, 0, 85, 9, 12, 128, 18, 9, 7, 0, 
+39, 10, 19, 0, 18, 11, 8, 0, 38, 9, 11, 9, 54, 10, 17, 0, 
+57, 10, 18, 10, 56, 10, 9, 10, 14, 0, 10, 0, 88, 10, 246, 127, 
+18, 7, 9, 0, 88, 9, 1, 128, 88, 9, 243, 127, 54, 8, 17, 0, 
+18, 10, 8, 0, 57, 8, 20, 8, 18, 11, 5, 0, 18, 12, 7, 0, 
+66, 8, 4, 1, 54, 8, 17, 0, 18, 10, 8, 0, 57, 8, 21, 8, 
+18, 11, 7, 0, 66, 8, 3, 1, 54, 8, 11, 0, 66, 8, 1, 1, 
+43, 8, 2, 0, 76, 8, 2, 0, 5, 192, 22, 192, 15, 115, 101, 116, 
+67, 117, 114, 114, 101, 110, 116, 16, 97, 100, 100, 68, 111, 99, 117, 109, 
+101, 110, 116, 6, 45, 14, 100, 111, 99, 117, 109, 101, 110, 116, 115, 16, 
+68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 13, 76, 101, 97, 102, 
+110, 97, 109, 101, 22, 100, 101, 108, 101, 116, 101, 80, 97, 114, 97, 103, 
+114, 97, 112, 104, 65, 116, 10, 114, 101, 115, 101, 116, 19, 67, 114, 101, 
+97, 116, 101, 73, 109, 112, 111, 114, 116, 101, 114, 19, 67, 114, 101, 97, 
+116, 101, 68, 111, 99, 117, 109, 101, 110, 116, 16, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 69, 84, 104, 101, 32, 105, 109, 112, 111, 114, 
+116, 32, 102, 97, 105, 108, 101, 100, 44, 32, 112, 114, 111, 98, 97, 98, 
+108, 121, 32, 98, 101, 99, 97, 117, 115, 101, 32, 116, 104, 101, 32, 102, 
+105, 108, 101, 32, 99, 111, 117, 108, 100, 32, 110, 111, 116, 32, 98, 101, 
+32, 102, 111, 117, 110, 100, 46, 17, 77, 111, 100, 97, 108, 77, 101, 115, 
+115, 97, 103, 101, 10, 99, 108, 111, 115, 101, 16, 99, 111, 110, 116, 101, 
+110, 116, 46, 120, 109, 108, 15, 115, 116, 121, 108, 101, 115, 46, 120, 109, 
+108, 9, 114, 101, 97, 100, 17, 73, 109, 112, 111, 114, 116, 105, 110, 103, 
+46, 46, 46, 21, 73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 
+115, 97, 103, 101, 17, 73, 109, 112, 111, 114, 116, 32, 102, 114, 111, 109, 
+58, 20, 73, 109, 112, 111, 114, 116, 32, 79, 68, 84, 32, 70, 105, 108, 
+101, 16, 70, 105, 108, 101, 66, 114, 111, 119, 115, 101, 114, 155, 4, 3, 
+0, 25, 0, 30, 0, 44, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 
+0, 0, 57, 1, 2, 1, 54, 2, 0, 0, 57, 2, 3, 2, 54, 3, 
+0, 0, 57, 3, 4, 3, 54, 4, 0, 0, 57, 4, 5, 4, 54, 5, 
+0, 0, 57, 5, 6, 5, 54, 6, 0, 0, 57, 6, 7, 6, 54, 7, 
+8, 0, 57, 7, 9, 7, 54, 8, 8, 0, 57, 8, 10, 8, 54, 9, 
+8, 0, 57, 9, 11, 9, 54, 10, 8, 0, 57, 10, 12, 10, 54, 11, 
+13, 0, 57, 11, 14, 11, 54, 12, 13, 0, 57, 12, 15, 12, 54, 13, 
+13, 0, 57, 13, 16, 13, 54, 14, 13, 0, 57, 14, 17, 14, 54, 15, 
+18, 0, 57, 15, 19, 15, 39, 16, 20, 0, 39, 17, 21, 0, 39, 18, 
+22, 0, 39, 19, 23, 0, 51, 20, 24, 0, 51, 21, 25, 0, 51, 22, 
+26, 0, 54, 23, 27, 0, 51, 24, 29, 0, 61, 24, 28, 23, 50, 0, 
+0, 128, 75, 0, 1, 0, 0, 18, 73, 109, 112, 111, 114, 116, 79, 68, 
+84, 70, 105, 108, 101, 8, 67, 109, 100, 0, 0, 0, 51, 117, 114, 110, 
+58, 111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 
+111, 112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 
+110, 115, 58, 116, 101, 120, 116, 58, 49, 46, 48, 64, 117, 114, 110, 58, 
+111, 97, 115, 105, 115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 
+112, 101, 110, 100, 111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 
+115, 58, 120, 115, 108, 45, 102, 111, 45, 99, 111, 109, 112, 97, 116, 105, 
+98, 108, 101, 58, 49, 46, 48, 52, 117, 114, 110, 58, 111, 97, 115, 105, 
+115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 112, 101, 110, 100, 
+111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 115, 58, 115, 116, 
+121, 108, 101, 58, 49, 46, 48, 53, 117, 114, 110, 58, 111, 97, 115, 105, 
+115, 58, 110, 97, 109, 101, 115, 58, 116, 99, 58, 111, 112, 101, 110, 100, 
+111, 99, 117, 109, 101, 110, 116, 58, 120, 109, 108, 110, 115, 58, 111, 102, 
+102, 105, 99, 101, 58, 49, 46, 48, 11, 99, 111, 110, 99, 97, 116, 10, 
+116, 97, 98, 108, 101, 11, 103, 109, 97, 116, 99, 104, 8, 115, 117, 98, 
+9, 102, 105, 110, 100, 9, 99, 104, 97, 114, 11, 115, 116, 114, 105, 110, 
+103, 10, 98, 116, 101, 115, 116, 9, 98, 120, 111, 114, 8, 98, 111, 114, 
+9, 98, 97, 110, 100, 10, 98, 105, 116, 51, 50, 16, 116, 111, 107, 101, 
+110, 105, 115, 101, 120, 109, 108, 12, 111, 112, 101, 110, 122, 105, 112, 12, 
+119, 114, 105, 116, 101, 117, 56, 14, 112, 97, 114, 115, 101, 119, 111, 114, 
+100, 9, 66, 79, 76, 68, 14, 85, 78, 68, 69, 82, 76, 73, 78, 69, 
+11, 73, 84, 65, 76, 73, 67, 7, 119, 103, 0, 
+};
+
+/* This is src/lua/navigate.lua */
+static const char file_26[] = {
+27, 76, 74, 2, 10, 59, 0, 0, 2, 0, 3, 0, 7, 54, 0, 0, 
+0, 41, 1, 1, 0, 61, 1, 1, 0, 54, 0, 2, 0, 66, 0, 1, 
+1, 43, 0, 2, 0, 76, 0, 2, 0, 16, 81, 117, 101, 117, 101, 82, 
+101, 100, 114, 97, 119, 7, 99, 111, 13, 68, 111, 99, 117, 109, 101, 110, 
+116, 98, 0, 0, 3, 0, 5, 1, 15, 54, 0, 0, 0, 54, 1, 0, 
+0, 54, 2, 0, 0, 57, 2, 2, 2, 56, 1, 2, 1, 54, 2, 0, 
+0, 57, 2, 3, 2, 56, 1, 2, 1, 21, 1, 1, 0, 22, 1, 0, 
+1, 61, 1, 1, 0, 54, 0, 4, 0, 66, 0, 1, 1, 43, 0, 2, 
+0, 76, 0, 2, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 7, 99, 119, 7, 99, 112, 7, 99, 111, 13, 68, 111, 99, 117, 109, 
+101, 110, 116, 2, 67, 0, 0, 2, 0, 4, 0, 6, 54, 0, 0, 0, 
+41, 1, 1, 0, 61, 1, 1, 0, 54, 0, 2, 0, 57, 0, 3, 0, 
+68, 0, 1, 0, 24, 71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 105, 
+110, 103, 79, 102, 87, 111, 114, 100, 8, 67, 109, 100, 7, 99, 119, 13, 
+68, 111, 99, 117, 109, 101, 110, 116, 80, 0, 0, 3, 0, 5, 0, 10, 
+54, 0, 0, 0, 54, 1, 0, 0, 54, 2, 0, 0, 57, 2, 2, 2, 
+56, 1, 2, 1, 21, 1, 1, 0, 61, 1, 1, 0, 54, 0, 3, 0, 
+57, 0, 4, 0, 68, 0, 1, 0, 18, 71, 111, 116, 111, 69, 110, 100, 
+79, 102, 87, 111, 114, 100, 8, 67, 109, 100, 7, 99, 112, 7, 99, 119, 
+13, 68, 111, 99, 117, 109, 101, 110, 116, 72, 0, 0, 2, 0, 4, 0, 
+6, 54, 0, 0, 0, 41, 1, 1, 0, 61, 1, 1, 0, 54, 0, 2, 
+0, 57, 0, 3, 0, 68, 0, 1, 0, 29, 71, 111, 116, 111, 66, 101, 
+103, 105, 110, 110, 105, 110, 103, 79, 102, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 8, 67, 109, 100, 7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 
+110, 116, 70, 0, 0, 2, 0, 4, 0, 7, 54, 0, 0, 0, 54, 1, 
+0, 0, 21, 1, 1, 0, 61, 1, 1, 0, 54, 0, 2, 0, 57, 0, 
+3, 0, 68, 0, 1, 0, 23, 71, 111, 116, 111, 69, 110, 100, 79, 102, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 8, 67, 109, 100, 7, 99, 112, 
+13, 68, 111, 99, 117, 109, 101, 110, 116, 130, 1, 0, 0, 2, 0, 5, 
+1, 23, 54, 0, 0, 0, 57, 0, 1, 0, 9, 0, 0, 0, 88, 0, 
+4, 128, 54, 0, 2, 0, 66, 0, 1, 1, 43, 0, 1, 0, 76, 0, 
+2, 0, 54, 0, 0, 0, 54, 1, 0, 0, 57, 1, 1, 1, 23, 1, 
+0, 1, 61, 1, 1, 0, 54, 0, 0, 0, 41, 1, 1, 0, 61, 1, 
+3, 0, 54, 0, 0, 0, 41, 1, 1, 0, 61, 1, 4, 0, 54, 0, 
+2, 0, 66, 0, 1, 1, 43, 0, 2, 0, 76, 0, 2, 0, 7, 99, 
+111, 7, 99, 119, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 
+7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 2, 138, 1, 0, 
+0, 2, 0, 5, 1, 25, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 
+0, 0, 21, 1, 1, 0, 5, 0, 1, 0, 88, 0, 4, 128, 54, 0, 
+2, 0, 66, 0, 1, 1, 43, 0, 1, 0, 76, 0, 2, 0, 54, 0, 
+0, 0, 54, 1, 0, 0, 57, 1, 1, 1, 22, 1, 0, 1, 61, 1, 
+1, 0, 54, 0, 0, 0, 41, 1, 1, 0, 61, 1, 3, 0, 54, 0, 
+0, 0, 41, 1, 1, 0, 61, 1, 4, 0, 54, 0, 2, 0, 66, 0, 
+1, 1, 43, 0, 2, 0, 76, 0, 2, 0, 7, 99, 111, 7, 99, 119, 
+16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 7, 99, 112, 13, 
+68, 111, 99, 117, 109, 101, 110, 116, 2, 45, 0, 0, 2, 0, 2, 0, 
+3, 54, 0, 0, 0, 57, 0, 1, 0, 68, 0, 1, 0, 26, 71, 111, 
+116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 114, 97, 103, 114, 
+97, 112, 104, 8, 67, 109, 100, 41, 0, 0, 2, 0, 2, 0, 3, 54, 
+0, 0, 0, 57, 0, 1, 0, 68, 0, 1, 0, 22, 71, 111, 116, 111, 
+78, 101, 120, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 8, 67, 109, 
+100, 115, 0, 0, 2, 0, 4, 1, 20, 54, 0, 0, 0, 57, 0, 1, 
+0, 9, 0, 0, 0, 88, 0, 4, 128, 54, 0, 2, 0, 66, 0, 1, 
+1, 43, 0, 1, 0, 76, 0, 2, 0, 54, 0, 0, 0, 54, 1, 0, 
+0, 57, 1, 1, 1, 23, 1, 0, 1, 61, 1, 1, 0, 54, 0, 0, 
+0, 41, 1, 1, 0, 61, 1, 3, 0, 54, 0, 2, 0, 66, 0, 1, 
+1, 43, 0, 2, 0, 76, 0, 2, 0, 7, 99, 111, 16, 81, 117, 101, 
+117, 101, 82, 101, 100, 114, 97, 119, 7, 99, 119, 13, 68, 111, 99, 117, 
+109, 101, 110, 116, 2, 138, 1, 0, 0, 3, 0, 5, 1, 25, 54, 0, 
+0, 0, 54, 1, 0, 0, 57, 1, 1, 1, 56, 0, 1, 0, 54, 1, 
+0, 0, 57, 1, 2, 1, 21, 2, 0, 0, 5, 1, 2, 0, 88, 1, 
+4, 128, 54, 1, 3, 0, 66, 1, 1, 1, 43, 1, 1, 0, 76, 1, 
+2, 0, 54, 1, 0, 0, 54, 2, 0, 0, 57, 2, 2, 2, 22, 2, 
+0, 2, 61, 2, 2, 1, 54, 1, 0, 0, 41, 2, 1, 0, 61, 2, 
+4, 1, 54, 1, 3, 0, 66, 1, 1, 1, 43, 1, 2, 0, 76, 1, 
+2, 0, 7, 99, 111, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 7, 99, 119, 7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 
+2, 134, 1, 0, 0, 2, 0, 4, 0, 16, 54, 0, 0, 0, 57, 0, 
+1, 0, 66, 0, 1, 2, 14, 0, 0, 0, 88, 0, 9, 128, 54, 0, 
+0, 0, 57, 0, 2, 0, 66, 0, 1, 2, 15, 0, 0, 0, 88, 1, 
+3, 128, 54, 0, 0, 0, 57, 0, 3, 0, 66, 0, 1, 2, 76, 0, 
+2, 0, 43, 0, 2, 0, 76, 0, 2, 0, 23, 71, 111, 116, 111, 69, 
+110, 100, 79, 102, 80, 97, 114, 97, 103, 114, 97, 112, 104, 27, 71, 111, 
+116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 114, 97, 103, 114, 
+97, 112, 104, 87, 21, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 
+115, 87, 111, 114, 100, 8, 67, 109, 100, 132, 1, 0, 0, 2, 0, 4, 
+0, 16, 54, 0, 0, 0, 57, 0, 1, 0, 66, 0, 1, 2, 14, 0, 
+0, 0, 88, 0, 9, 128, 54, 0, 0, 0, 57, 0, 2, 0, 66, 0, 
+1, 2, 15, 0, 0, 0, 88, 1, 3, 128, 54, 0, 0, 0, 57, 0, 
+3, 0, 66, 0, 1, 2, 76, 0, 2, 0, 43, 0, 2, 0, 76, 0, 
+2, 0, 29, 71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 
+79, 102, 80, 97, 114, 97, 103, 114, 97, 112, 104, 23, 71, 111, 116, 111, 
+78, 101, 120, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 87, 17, 71, 
+111, 116, 111, 78, 101, 120, 116, 87, 111, 114, 100, 8, 67, 109, 100, 127, 
+0, 0, 5, 1, 5, 0, 22, 54, 0, 0, 0, 54, 1, 0, 0, 57, 
+1, 1, 1, 56, 0, 1, 0, 54, 1, 0, 0, 57, 1, 2, 1, 56, 
+0, 1, 0, 45, 1, 0, 0, 18, 3, 0, 0, 54, 4, 0, 0, 57, 
+4, 3, 4, 66, 1, 3, 2, 14, 0, 1, 0, 88, 2, 2, 128, 43, 
+2, 1, 0, 76, 2, 2, 0, 54, 2, 0, 0, 61, 1, 3, 2, 54, 
+2, 4, 0, 66, 2, 1, 1, 43, 2, 2, 0, 76, 2, 2, 0, 4, 
+192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 7, 99, 111, 
+7, 99, 119, 7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 127, 
+0, 0, 5, 1, 5, 0, 22, 54, 0, 0, 0, 54, 1, 0, 0, 57, 
+1, 1, 1, 56, 0, 1, 0, 54, 1, 0, 0, 57, 1, 2, 1, 56, 
+0, 1, 0, 45, 1, 0, 0, 18, 3, 0, 0, 54, 4, 0, 0, 57, 
+4, 3, 4, 66, 1, 3, 2, 14, 0, 1, 0, 88, 2, 2, 128, 43, 
+2, 1, 0, 76, 2, 2, 0, 54, 2, 0, 0, 61, 1, 3, 2, 54, 
+2, 4, 0, 66, 2, 1, 1, 43, 2, 2, 0, 76, 2, 2, 0, 3, 
+192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 7, 99, 111, 
+7, 99, 119, 7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 124, 
+0, 0, 2, 0, 4, 0, 16, 54, 0, 0, 0, 57, 0, 1, 0, 66, 
+0, 1, 2, 14, 0, 0, 0, 88, 0, 9, 128, 54, 0, 0, 0, 57, 
+0, 2, 0, 66, 0, 1, 2, 15, 0, 0, 0, 88, 1, 3, 128, 54, 
+0, 0, 0, 57, 0, 3, 0, 66, 0, 1, 2, 76, 0, 2, 0, 43, 
+0, 2, 0, 76, 0, 2, 0, 18, 71, 111, 116, 111, 69, 110, 100, 79, 
+102, 87, 111, 114, 100, 22, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 
+117, 115, 87, 111, 114, 100, 87, 21, 71, 111, 116, 111, 80, 114, 101, 118, 
+105, 111, 117, 115, 67, 104, 97, 114, 8, 67, 109, 100, 122, 0, 0, 2, 
+0, 4, 0, 16, 54, 0, 0, 0, 57, 0, 1, 0, 66, 0, 1, 2, 
+14, 0, 0, 0, 88, 0, 9, 128, 54, 0, 0, 0, 57, 0, 2, 0, 
+66, 0, 1, 2, 15, 0, 0, 0, 88, 1, 3, 128, 54, 0, 0, 0, 
+57, 0, 3, 0, 66, 0, 1, 2, 76, 0, 2, 0, 43, 0, 2, 0, 
+76, 0, 2, 0, 24, 71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 105, 
+110, 103, 79, 102, 87, 111, 114, 100, 18, 71, 111, 116, 111, 78, 101, 120, 
+116, 87, 111, 114, 100, 87, 17, 71, 111, 116, 111, 78, 101, 120, 116, 67, 
+104, 97, 114, 8, 67, 109, 100, 163, 3, 0, 1, 20, 1, 18, 1, 61, 
+54, 1, 0, 0, 57, 1, 1, 1, 54, 2, 0, 0, 57, 2, 2, 2, 
+54, 3, 0, 0, 57, 3, 3, 3, 54, 4, 0, 0, 56, 4, 1, 4, 
+56, 5, 2, 4, 45, 6, 0, 0, 18, 8, 5, 0, 18, 9, 0, 0, 
+18, 10, 3, 0, 54, 11, 4, 0, 66, 11, 1, 0, 65, 6, 3, 3, 
+14, 0, 7, 0, 88, 8, 2, 128, 43, 8, 1, 0, 76, 8, 2, 0, 
+53, 8, 5, 0, 61, 6, 6, 8, 54, 9, 0, 0, 57, 9, 2, 9, 
+61, 9, 7, 8, 61, 4, 8, 8, 54, 9, 9, 0, 54, 11, 10, 0, 
+57, 11, 11, 11, 18, 12, 8, 0, 66, 9, 3, 1, 57, 9, 6, 8, 
+54, 10, 0, 0, 54, 11, 12, 0, 57, 13, 13, 4, 18, 16, 4, 0, 
+57, 14, 14, 4, 41, 17, 1, 0, 23, 18, 0, 2, 66, 14, 4, 2, 
+18, 15, 9, 0, 18, 18, 4, 0, 57, 16, 14, 4, 22, 19, 0, 2, 
+66, 16, 3, 0, 65, 11, 3, 2, 60, 11, 1, 10, 54, 10, 0, 0, 
+21, 11, 9, 0, 21, 12, 6, 0, 33, 11, 12, 11, 32, 11, 11, 7, 
+61, 11, 3, 10, 54, 10, 15, 0, 18, 12, 10, 0, 57, 10, 16, 10, 
+66, 10, 2, 1, 54, 10, 17, 0, 66, 10, 1, 1, 43, 10, 2, 0, 
+76, 10, 2, 0, 5, 192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 
+97, 119, 10, 116, 111, 117, 99, 104, 16, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 8, 115, 117, 98, 10, 115, 116, 121, 108, 101, 20, 67, 
+114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 17, 87, 
+111, 114, 100, 77, 111, 100, 105, 102, 105, 101, 100, 10, 69, 118, 101, 110, 
+116, 14, 70, 105, 114, 101, 69, 118, 101, 110, 116, 14, 112, 97, 114, 97, 
+103, 114, 97, 112, 104, 7, 119, 110, 9, 119, 111, 114, 100, 1, 0, 3, 
+14, 112, 97, 114, 97, 103, 114, 97, 112, 104, 0, 7, 119, 110, 0, 9, 
+119, 111, 114, 100, 0, 24, 71, 101, 116, 67, 117, 114, 114, 101, 110, 116, 
+83, 116, 121, 108, 101, 72, 105, 110, 116, 7, 99, 111, 7, 99, 119, 7, 
+99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 2, 143, 1, 0, 1, 
+9, 0, 5, 0, 20, 43, 1, 2, 0, 18, 4, 0, 0, 57, 2, 0, 
+0, 39, 5, 1, 0, 66, 2, 3, 4, 88, 5, 10, 128, 14, 0, 1, 
+0, 88, 6, 3, 128, 54, 6, 2, 0, 57, 6, 3, 6, 66, 6, 1, 
+1, 54, 6, 2, 0, 57, 6, 4, 6, 18, 8, 5, 0, 66, 6, 2, 
+1, 43, 1, 1, 0, 69, 5, 3, 2, 82, 5, 244, 127, 43, 2, 2, 
+0, 76, 2, 2, 0, 25, 73, 110, 115, 101, 114, 116, 83, 116, 114, 105, 
+110, 103, 73, 110, 116, 111, 87, 111, 114, 100, 21, 83, 112, 108, 105, 116, 
+67, 117, 114, 114, 101, 110, 116, 87, 111, 114, 100, 8, 67, 109, 100, 11, 
+91, 94, 37, 115, 93, 43, 11, 103, 109, 97, 116, 99, 104, 143, 3, 0, 
+0, 20, 2, 13, 2, 72, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 
+0, 0, 57, 1, 2, 1, 54, 2, 0, 0, 57, 2, 3, 2, 39, 3, 
+4, 0, 41, 4, 0, 0, 54, 5, 0, 0, 57, 5, 5, 5, 14, 0, 
+5, 0, 88, 5, 14, 128, 54, 5, 6, 0, 66, 5, 1, 2, 45, 6, 
+0, 0, 18, 8, 5, 0, 66, 6, 2, 2, 18, 3, 6, 0, 8, 5, 
+0, 0, 88, 6, 5, 128, 18, 6, 3, 0, 45, 7, 0, 0, 41, 9, 
+0, 0, 66, 7, 2, 2, 38, 3, 7, 6, 41, 4, 1, 0, 54, 5, 
+0, 0, 56, 5, 0, 5, 56, 6, 1, 5, 45, 7, 1, 0, 18, 9, 
+6, 0, 18, 10, 2, 0, 21, 11, 6, 0, 22, 11, 1, 11, 66, 7, 
+4, 2, 45, 8, 1, 0, 18, 10, 6, 0, 41, 11, 1, 0, 18, 12, 
+2, 0, 66, 8, 4, 2, 54, 9, 0, 0, 54, 10, 7, 0, 57, 12, 
+8, 5, 18, 15, 5, 0, 57, 13, 9, 5, 41, 16, 1, 0, 23, 17, 
+1, 1, 66, 13, 4, 2, 18, 14, 7, 0, 18, 15, 3, 0, 18, 16, 
+8, 0, 38, 15, 16, 15, 18, 18, 5, 0, 57, 16, 9, 5, 22, 19, 
+1, 1, 66, 16, 3, 0, 65, 10, 4, 2, 60, 10, 0, 9, 54, 9, 
+0, 0, 22, 10, 1, 1, 61, 10, 2, 9, 54, 9, 0, 0, 27, 10, 
+1, 4, 61, 10, 3, 9, 54, 9, 10, 0, 18, 11, 9, 0, 57, 9, 
+11, 9, 66, 9, 2, 1, 54, 9, 12, 0, 66, 9, 1, 1, 43, 9, 
+2, 0, 76, 9, 2, 0, 9, 192, 6, 192, 16, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 10, 116, 111, 117, 99, 104, 16, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 8, 115, 117, 98, 10, 115, 116, 121, 
+108, 101, 20, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 24, 71, 101, 116, 67, 117, 114, 114, 101, 110, 116, 83, 116, 121, 
+108, 101, 72, 105, 110, 116, 7, 109, 112, 5, 7, 99, 111, 7, 99, 119, 
+7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 0, 2, 244, 1, 
+0, 0, 10, 0, 10, 1, 37, 54, 0, 0, 0, 57, 0, 1, 0, 54, 
+1, 0, 0, 57, 1, 2, 1, 54, 2, 0, 0, 57, 2, 3, 2, 54, 
+3, 0, 0, 21, 3, 3, 0, 5, 0, 3, 0, 88, 3, 2, 128, 43, 
+3, 1, 0, 76, 3, 2, 0, 54, 3, 0, 0, 54, 4, 4, 0, 54, 
+6, 0, 0, 56, 6, 0, 6, 57, 6, 5, 6, 54, 7, 0, 0, 56, 
+7, 0, 7, 54, 8, 0, 0, 22, 9, 0, 0, 56, 8, 9, 8, 66, 
+4, 4, 2, 60, 4, 0, 3, 54, 3, 0, 0, 18, 5, 3, 0, 57, 
+3, 6, 3, 22, 6, 0, 0, 66, 3, 3, 1, 54, 3, 7, 0, 18, 
+5, 3, 0, 57, 3, 8, 3, 66, 3, 2, 1, 54, 3, 9, 0, 66, 
+3, 1, 1, 43, 3, 2, 0, 76, 3, 2, 0, 16, 81, 117, 101, 117, 
+101, 82, 101, 100, 114, 97, 119, 10, 116, 111, 117, 99, 104, 16, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 22, 100, 101, 108, 101, 116, 101, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 65, 116, 10, 115, 116, 121, 108, 
+101, 20, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 7, 99, 111, 7, 99, 119, 7, 99, 112, 13, 68, 111, 99, 117, 109, 
+101, 110, 116, 2, 183, 2, 0, 0, 15, 1, 12, 2, 50, 54, 0, 0, 
+0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 2, 1, 54, 2, 0, 
+0, 57, 2, 3, 2, 54, 3, 0, 0, 56, 3, 0, 3, 21, 4, 3, 
+0, 5, 1, 4, 0, 88, 4, 9, 128, 54, 4, 4, 0, 57, 4, 5, 
+4, 66, 4, 1, 2, 14, 0, 4, 0, 88, 4, 2, 128, 43, 4, 1, 
+0, 76, 4, 2, 0, 54, 4, 0, 0, 56, 3, 0, 4, 45, 4, 0, 
+0, 22, 6, 0, 1, 56, 6, 6, 3, 56, 7, 1, 3, 41, 8, 1, 
+0, 41, 9, 0, 0, 66, 4, 5, 2, 54, 5, 0, 0, 54, 6, 6, 
+0, 57, 8, 7, 3, 18, 11, 3, 0, 57, 9, 8, 3, 41, 12, 1, 
+0, 23, 13, 0, 1, 66, 9, 4, 2, 18, 10, 4, 0, 18, 13, 3, 
+0, 57, 11, 8, 3, 22, 14, 1, 1, 66, 11, 3, 0, 65, 6, 3, 
+2, 60, 6, 0, 5, 54, 5, 9, 0, 18, 7, 5, 0, 57, 5, 10, 
+5, 66, 5, 2, 1, 54, 5, 11, 0, 66, 5, 1, 1, 43, 5, 2, 
+0, 76, 5, 2, 0, 5, 192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 
+114, 97, 119, 10, 116, 111, 117, 99, 104, 16, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 8, 115, 117, 98, 10, 115, 116, 121, 108, 101, 20, 
+67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 26, 
+74, 111, 105, 110, 87, 105, 116, 104, 78, 101, 120, 116, 80, 97, 114, 97, 
+103, 114, 97, 112, 104, 8, 67, 109, 100, 7, 99, 111, 7, 99, 119, 7, 
+99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 2, 4, 80, 0, 0, 
+2, 0, 3, 0, 9, 54, 0, 0, 0, 57, 0, 1, 0, 66, 0, 1, 
+2, 15, 0, 0, 0, 88, 1, 3, 128, 54, 0, 0, 0, 57, 0, 2, 
+0, 66, 0, 1, 2, 76, 0, 2, 0, 19, 68, 101, 108, 101, 116, 101, 
+78, 101, 120, 116, 67, 104, 97, 114, 22, 71, 111, 116, 111, 80, 114, 101, 
+118, 105, 111, 117, 115, 67, 104, 97, 114, 87, 8, 67, 109, 100, 97, 0, 
+0, 2, 0, 5, 0, 12, 54, 0, 0, 0, 57, 0, 1, 0, 15, 0, 
+0, 0, 88, 1, 4, 128, 54, 0, 2, 0, 57, 0, 3, 0, 68, 0, 
+1, 0, 88, 0, 3, 128, 54, 0, 2, 0, 57, 0, 4, 0, 68, 0, 
+1, 0, 75, 0, 1, 0, 23, 68, 101, 108, 101, 116, 101, 80, 114, 101, 
+118, 105, 111, 117, 115, 67, 104, 97, 114, 11, 68, 101, 108, 101, 116, 101, 
+8, 67, 109, 100, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 
+159, 2, 0, 0, 16, 2, 12, 1, 45, 54, 0, 0, 0, 57, 0, 1, 
+0, 54, 1, 0, 0, 57, 1, 2, 1, 54, 2, 0, 0, 57, 2, 3, 
+2, 54, 3, 0, 0, 56, 3, 0, 3, 56, 4, 1, 3, 45, 5, 0, 
+0, 18, 7, 4, 0, 18, 8, 2, 0, 66, 5, 3, 2, 14, 0, 5, 
+0, 88, 6, 3, 128, 54, 6, 4, 0, 57, 6, 5, 6, 68, 6, 1, 
+0, 54, 6, 0, 0, 54, 7, 6, 0, 57, 9, 7, 3, 18, 12, 3, 
+0, 57, 10, 8, 3, 41, 13, 1, 0, 23, 14, 0, 1, 66, 10, 4, 
+2, 45, 11, 1, 0, 18, 13, 4, 0, 18, 14, 2, 0, 18, 15, 5, 
+0, 66, 11, 4, 2, 18, 14, 3, 0, 57, 12, 8, 3, 22, 15, 0, 
+1, 66, 12, 3, 0, 65, 7, 3, 2, 60, 7, 0, 6, 54, 6, 9, 
+0, 18, 8, 6, 0, 57, 6, 10, 6, 66, 6, 2, 1, 54, 6, 11, 
+0, 66, 6, 1, 1, 43, 6, 2, 0, 76, 6, 2, 0, 3, 192, 6, 
+192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 10, 116, 111, 
+117, 99, 104, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 8, 
+115, 117, 98, 10, 115, 116, 121, 108, 101, 20, 67, 114, 101, 97, 116, 101, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 21, 74, 111, 105, 110, 87, 105, 
+116, 104, 78, 101, 120, 116, 87, 111, 114, 100, 8, 67, 109, 100, 7, 99, 
+111, 7, 99, 119, 7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 
+2, 93, 0, 0, 2, 0, 5, 0, 12, 54, 0, 0, 0, 57, 0, 1, 
+0, 15, 0, 0, 0, 88, 1, 4, 128, 54, 0, 2, 0, 57, 0, 3, 
+0, 68, 0, 1, 0, 88, 0, 3, 128, 54, 0, 2, 0, 57, 0, 4, 
+0, 68, 0, 1, 0, 75, 0, 1, 0, 19, 68, 101, 108, 101, 116, 101, 
+78, 101, 120, 116, 67, 104, 97, 114, 11, 68, 101, 108, 101, 116, 101, 8, 
+67, 109, 100, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 169, 
+1, 0, 0, 8, 1, 7, 0, 28, 54, 0, 0, 0, 54, 1, 0, 0, 
+57, 1, 1, 1, 56, 0, 1, 0, 54, 1, 0, 0, 57, 1, 2, 1, 
+54, 2, 0, 0, 57, 2, 3, 2, 45, 3, 0, 0, 56, 5, 1, 0, 
+41, 6, 1, 0, 18, 7, 2, 0, 66, 3, 4, 2, 60, 3, 1, 0, 
+54, 3, 0, 0, 41, 4, 1, 0, 61, 4, 3, 3, 18, 5, 0, 0, 
+57, 3, 4, 0, 66, 3, 2, 1, 54, 3, 5, 0, 18, 5, 3, 0, 
+57, 3, 4, 3, 66, 3, 2, 1, 54, 3, 6, 0, 66, 3, 1, 1, 
+43, 3, 2, 0, 76, 3, 2, 0, 6, 192, 16, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 
+101, 116, 10, 116, 111, 117, 99, 104, 7, 99, 111, 7, 99, 119, 7, 99, 
+112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 153, 1, 0, 0, 2, 0, 
+6, 1, 21, 54, 0, 0, 0, 57, 0, 1, 0, 9, 0, 0, 0, 88, 
+0, 7, 128, 54, 0, 0, 0, 57, 0, 2, 0, 9, 0, 0, 0, 88, 
+0, 3, 128, 54, 0, 3, 0, 57, 0, 4, 0, 68, 0, 1, 0, 54, 
+0, 0, 0, 57, 0, 1, 0, 9, 0, 0, 0, 88, 0, 3, 128, 54, 
+0, 3, 0, 57, 0, 4, 0, 66, 0, 1, 1, 54, 0, 3, 0, 57, 
+0, 5, 0, 68, 0, 1, 0, 27, 68, 101, 108, 101, 116, 101, 87, 111, 
+114, 100, 76, 101, 102, 116, 79, 102, 67, 117, 114, 115, 111, 114, 23, 68, 
+101, 108, 101, 116, 101, 80, 114, 101, 118, 105, 111, 117, 115, 67, 104, 97, 
+114, 8, 67, 109, 100, 7, 99, 119, 7, 99, 111, 13, 68, 111, 99, 117, 
+109, 101, 110, 116, 2, 145, 3, 0, 0, 11, 0, 13, 1, 69, 54, 0, 
+0, 0, 57, 0, 1, 0, 9, 0, 0, 0, 88, 0, 8, 128, 54, 0, 
+0, 0, 57, 0, 2, 0, 9, 0, 0, 0, 88, 0, 4, 128, 54, 0, 
+3, 0, 57, 0, 4, 0, 66, 0, 1, 1, 88, 0, 15, 128, 54, 0, 
+0, 0, 57, 0, 1, 0, 41, 1, 1, 0, 1, 1, 0, 0, 88, 0, 
+4, 128, 54, 0, 3, 0, 57, 0, 4, 0, 66, 0, 1, 1, 88, 0, 
+6, 128, 54, 0, 5, 0, 18, 2, 0, 0, 57, 0, 6, 0, 66, 0, 
+2, 1, 54, 0, 7, 0, 66, 0, 1, 1, 54, 0, 0, 0, 57, 0, 
+8, 0, 54, 1, 0, 0, 57, 1, 2, 1, 54, 2, 0, 0, 56, 2, 
+0, 2, 54, 3, 9, 0, 57, 5, 10, 2, 18, 8, 2, 0, 57, 6, 
+11, 2, 41, 9, 1, 0, 23, 10, 0, 1, 66, 6, 4, 0, 65, 3, 
+1, 2, 54, 4, 9, 0, 57, 6, 10, 2, 18, 9, 2, 0, 57, 7, 
+11, 2, 18, 10, 1, 0, 66, 7, 3, 0, 65, 4, 1, 2, 54, 5, 
+0, 0, 60, 4, 0, 5, 54, 5, 0, 0, 18, 7, 5, 0, 57, 5, 
+12, 5, 18, 8, 3, 0, 18, 9, 0, 0, 66, 5, 4, 1, 54, 5, 
+0, 0, 54, 6, 0, 0, 57, 6, 8, 6, 22, 6, 0, 6, 61, 6, 
+8, 5, 54, 5, 0, 0, 41, 6, 1, 0, 61, 6, 2, 5, 54, 5, 
+0, 0, 41, 6, 1, 0, 61, 6, 1, 5, 43, 5, 2, 0, 76, 5, 
+2, 0, 26, 105, 110, 115, 101, 114, 116, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 66, 101, 102, 111, 114, 101, 8, 115, 117, 98, 10, 115, 116, 121, 
+108, 101, 20, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 7, 99, 112, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 10, 116, 111, 117, 99, 104, 16, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 21, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 
+87, 111, 114, 100, 8, 67, 109, 100, 7, 99, 119, 7, 99, 111, 13, 68, 
+111, 99, 117, 109, 101, 110, 116, 2, 252, 2, 0, 1, 14, 0, 14, 2, 
+65, 54, 1, 0, 0, 54, 2, 0, 0, 57, 2, 1, 2, 56, 1, 2, 
+1, 18, 4, 1, 0, 57, 2, 2, 1, 54, 5, 0, 0, 57, 5, 3, 
+5, 66, 2, 3, 2, 18, 5, 1, 0, 57, 3, 4, 1, 54, 6, 0, 
+0, 57, 6, 5, 6, 66, 3, 3, 2, 56, 4, 3, 2, 21, 5, 4, 
+0, 57, 6, 6, 1, 57, 6, 7, 6, 14, 0, 6, 0, 88, 7, 1, 
+128, 41, 6, 0, 0, 33, 0, 6, 0, 41, 6, 0, 0, 1, 0, 6, 
+0, 88, 6, 1, 128, 41, 0, 0, 0, 41, 6, 0, 0, 1, 6, 5, 
+0, 88, 6, 9, 128, 85, 6, 8, 128, 57, 6, 8, 1, 56, 7, 5, 
+4, 56, 6, 7, 6, 3, 6, 0, 0, 88, 6, 1, 128, 88, 6, 2, 
+128, 23, 5, 0, 5, 88, 6, 244, 127, 9, 5, 1, 0, 88, 6, 1, 
+128, 41, 5, 1, 0, 56, 6, 5, 4, 56, 7, 6, 1, 57, 8, 8, 
+1, 56, 8, 6, 8, 54, 9, 9, 0, 18, 11, 7, 0, 33, 12, 8, 
+0, 66, 9, 3, 2, 55, 9, 10, 0, 54, 9, 0, 0, 18, 12, 1, 
+0, 57, 10, 11, 1, 18, 13, 3, 0, 66, 10, 3, 2, 32, 10, 5, 
+10, 23, 10, 0, 10, 61, 10, 5, 9, 54, 9, 0, 0, 54, 10, 10, 
+0, 61, 10, 12, 9, 54, 9, 13, 0, 66, 9, 1, 1, 43, 9, 1, 
+0, 76, 9, 2, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 
+119, 7, 99, 111, 18, 103, 101, 116, 87, 111, 114, 100, 79, 102, 76, 105, 
+110, 101, 7, 119, 111, 23, 71, 101, 116, 79, 102, 102, 115, 101, 116, 70, 
+114, 111, 109, 87, 105, 100, 116, 104, 7, 120, 115, 11, 105, 110, 100, 101, 
+110, 116, 10, 115, 116, 121, 108, 101, 7, 99, 119, 18, 103, 101, 116, 76, 
+105, 110, 101, 79, 102, 87, 111, 114, 100, 14, 119, 114, 97, 112, 119, 105, 
+100, 116, 104, 9, 119, 114, 97, 112, 7, 99, 112, 13, 68, 111, 99, 117, 
+109, 101, 110, 116, 2, 0, 199, 1, 0, 0, 11, 0, 9, 0, 30, 54, 
+0, 0, 0, 54, 1, 0, 0, 57, 1, 1, 1, 56, 0, 1, 0, 18, 
+3, 0, 0, 57, 1, 2, 0, 66, 1, 2, 2, 54, 2, 0, 0, 57, 
+2, 3, 2, 56, 3, 2, 0, 18, 6, 0, 0, 57, 4, 4, 0, 18, 
+7, 2, 0, 66, 4, 3, 4, 54, 7, 5, 0, 18, 9, 3, 0, 54, 
+10, 0, 0, 57, 10, 6, 10, 66, 7, 3, 2, 32, 4, 7, 4, 57, 
+7, 7, 0, 57, 7, 8, 7, 14, 0, 7, 0, 88, 8, 1, 128, 41, 
+7, 0, 0, 32, 4, 7, 4, 18, 7, 4, 0, 18, 8, 5, 0, 18, 
+9, 1, 0, 74, 7, 4, 0, 11, 105, 110, 100, 101, 110, 116, 10, 115, 
+116, 121, 108, 101, 7, 99, 111, 23, 71, 101, 116, 87, 105, 100, 116, 104, 
+70, 114, 111, 109, 79, 102, 102, 115, 101, 116, 21, 103, 101, 116, 88, 79, 
+102, 102, 115, 101, 116, 79, 102, 87, 111, 114, 100, 7, 99, 119, 9, 119, 
+114, 97, 112, 7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 236, 
+1, 0, 0, 8, 1, 8, 1, 34, 45, 0, 0, 0, 66, 0, 1, 4, 
+21, 3, 2, 0, 5, 1, 3, 0, 88, 3, 15, 128, 54, 3, 0, 0, 
+57, 3, 1, 3, 66, 3, 1, 2, 15, 0, 3, 0, 88, 4, 9, 128, 
+54, 3, 0, 0, 57, 3, 2, 3, 66, 3, 1, 2, 15, 0, 3, 0, 
+88, 4, 4, 128, 54, 3, 0, 0, 57, 3, 3, 3, 18, 5, 0, 0, 
+66, 3, 2, 2, 76, 3, 2, 0, 54, 3, 4, 0, 54, 4, 4, 0, 
+54, 5, 4, 0, 57, 5, 6, 5, 56, 4, 5, 4, 18, 6, 4, 0, 
+57, 4, 7, 4, 22, 7, 0, 1, 66, 4, 3, 2, 61, 4, 5, 3, 
+54, 3, 0, 0, 57, 3, 3, 3, 18, 5, 0, 0, 68, 3, 2, 0, 
+14, 192, 18, 103, 101, 116, 87, 111, 114, 100, 79, 102, 76, 105, 110, 101, 
+7, 99, 112, 7, 99, 119, 13, 68, 111, 99, 117, 109, 101, 110, 116, 18, 
+71, 111, 116, 111, 88, 80, 111, 115, 105, 116, 105, 111, 110, 29, 71, 111, 
+116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 80, 97, 114, 
+97, 103, 114, 97, 112, 104, 22, 71, 111, 116, 111, 78, 101, 120, 116, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 8, 67, 109, 100, 2, 230, 1, 0, 
+0, 8, 1, 8, 1, 33, 45, 0, 0, 0, 66, 0, 1, 4, 9, 1, 
+0, 0, 88, 3, 15, 128, 54, 3, 0, 0, 57, 3, 1, 3, 66, 3, 
+1, 2, 15, 0, 3, 0, 88, 4, 9, 128, 54, 3, 0, 0, 57, 3, 
+2, 3, 66, 3, 1, 2, 15, 0, 3, 0, 88, 4, 4, 128, 54, 3, 
+0, 0, 57, 3, 3, 3, 18, 5, 0, 0, 66, 3, 2, 2, 76, 3, 
+2, 0, 54, 3, 4, 0, 54, 4, 4, 0, 54, 5, 4, 0, 57, 5, 
+6, 5, 56, 4, 5, 4, 18, 6, 4, 0, 57, 4, 7, 4, 23, 7, 
+0, 1, 66, 4, 3, 2, 61, 4, 5, 3, 54, 3, 0, 0, 57, 3, 
+3, 3, 18, 5, 0, 0, 68, 3, 2, 0, 14, 192, 18, 103, 101, 116, 
+87, 111, 114, 100, 79, 102, 76, 105, 110, 101, 7, 99, 112, 7, 99, 119, 
+13, 68, 111, 99, 117, 109, 101, 110, 116, 18, 71, 111, 116, 111, 88, 80, 
+111, 115, 105, 116, 105, 111, 110, 23, 71, 111, 116, 111, 69, 110, 100, 79, 
+102, 80, 97, 114, 97, 103, 114, 97, 112, 104, 26, 71, 111, 116, 111, 80, 
+114, 101, 118, 105, 111, 117, 115, 80, 97, 114, 97, 103, 114, 97, 112, 104, 
+8, 67, 109, 100, 2, 41, 0, 0, 3, 0, 2, 0, 4, 54, 0, 0, 
+0, 57, 0, 1, 0, 41, 2, 0, 0, 68, 0, 2, 0, 18, 71, 111, 
+116, 111, 88, 80, 111, 115, 105, 116, 105, 111, 110, 8, 67, 109, 100, 53, 
+0, 0, 3, 0, 3, 0, 4, 54, 0, 0, 0, 57, 0, 1, 0, 54, 
+2, 2, 0, 68, 0, 2, 0, 16, 83, 99, 114, 101, 101, 110, 87, 105, 
+100, 116, 104, 18, 71, 111, 116, 111, 88, 80, 111, 115, 105, 116, 105, 111, 
+110, 8, 67, 109, 100, 163, 1, 0, 0, 6, 1, 8, 0, 27, 54, 0, 
+0, 0, 57, 0, 1, 0, 15, 0, 0, 0, 88, 1, 21, 128, 54, 0, 
+0, 0, 57, 0, 2, 0, 15, 0, 0, 0, 88, 1, 17, 128, 45, 0, 
+0, 0, 66, 0, 1, 4, 54, 3, 0, 0, 54, 4, 0, 0, 57, 4, 
+1, 4, 61, 4, 3, 3, 54, 3, 0, 0, 54, 4, 0, 0, 57, 4, 
+2, 4, 61, 4, 4, 3, 54, 3, 0, 0, 41, 4, 1, 0, 61, 4, 
+5, 3, 54, 3, 6, 0, 57, 3, 7, 3, 18, 5, 0, 0, 68, 3, 
+2, 0, 43, 0, 1, 0, 76, 0, 2, 0, 14, 192, 18, 71, 111, 116, 
+111, 88, 80, 111, 115, 105, 116, 105, 111, 110, 8, 67, 109, 100, 7, 99, 
+111, 7, 99, 119, 7, 99, 112, 9, 116, 111, 112, 119, 9, 116, 111, 112, 
+112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 163, 1, 0, 0, 6, 1, 
+8, 0, 27, 54, 0, 0, 0, 57, 0, 1, 0, 15, 0, 0, 0, 88, 
+1, 21, 128, 54, 0, 0, 0, 57, 0, 2, 0, 15, 0, 0, 0, 88, 
+1, 17, 128, 45, 0, 0, 0, 66, 0, 1, 4, 54, 3, 0, 0, 54, 
+4, 0, 0, 57, 4, 1, 4, 61, 4, 3, 3, 54, 3, 0, 0, 54, 
+4, 0, 0, 57, 4, 2, 4, 61, 4, 4, 3, 54, 3, 0, 0, 41, 
+4, 1, 0, 61, 4, 5, 3, 54, 3, 6, 0, 57, 3, 7, 3, 18, 
+5, 0, 0, 68, 3, 2, 0, 43, 0, 1, 0, 76, 0, 2, 0, 14, 
+192, 18, 71, 111, 116, 111, 88, 80, 111, 115, 105, 116, 105, 111, 110, 8, 
+67, 109, 100, 7, 99, 111, 7, 99, 119, 7, 99, 112, 9, 98, 111, 116, 
+119, 9, 98, 111, 116, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 166, 
+4, 0, 1, 36, 3, 14, 1, 109, 54, 1, 0, 0, 57, 1, 1, 1, 
+14, 0, 1, 0, 88, 1, 2, 128, 43, 1, 1, 0, 76, 1, 2, 0, 
+54, 1, 0, 0, 18, 3, 1, 0, 57, 1, 2, 1, 66, 1, 2, 7, 
+54, 7, 0, 0, 57, 7, 3, 7, 54, 8, 0, 0, 57, 8, 4, 8, 
+54, 9, 0, 0, 57, 9, 5, 9, 45, 10, 0, 0, 45, 12, 1, 0, 
+56, 12, 0, 12, 66, 10, 2, 3, 18, 12, 1, 0, 18, 13, 4, 0, 
+41, 14, 1, 0, 77, 12, 74, 128, 54, 16, 0, 0, 56, 16, 15, 16, 
+41, 17, 1, 0, 21, 18, 16, 0, 5, 15, 1, 0, 88, 19, 1, 128, 
+18, 17, 2, 0, 5, 15, 4, 0, 88, 19, 1, 128, 18, 18, 5, 0, 
+52, 19, 0, 0, 18, 20, 17, 0, 18, 21, 18, 0, 41, 22, 1, 0, 
+77, 20, 43, 128, 56, 24, 23, 16, 41, 25, 1, 0, 21, 26, 24, 0, 
+22, 26, 0, 26, 5, 15, 1, 0, 88, 27, 3, 128, 5, 23, 2, 0, 
+88, 27, 1, 128, 18, 25, 3, 0, 5, 15, 4, 0, 88, 27, 3, 128, 
+5, 23, 5, 0, 88, 27, 1, 128, 18, 26, 6, 0, 5, 15, 7, 0, 
+88, 27, 14, 128, 5, 23, 8, 0, 88, 27, 12, 128, 54, 27, 0, 0, 
+45, 28, 2, 0, 18, 30, 24, 0, 18, 31, 10, 0, 18, 32, 11, 0, 
+18, 33, 25, 0, 18, 34, 26, 0, 18, 35, 9, 0, 66, 28, 7, 3, 
+61, 29, 5, 27, 18, 24, 28, 0, 88, 27, 9, 128, 45, 27, 2, 0, 
+18, 29, 24, 0, 18, 30, 10, 0, 18, 31, 11, 0, 18, 32, 25, 0, 
+18, 33, 26, 0, 41, 34, 0, 0, 66, 27, 7, 2, 18, 24, 27, 0, 
+21, 27, 19, 0, 22, 27, 0, 27, 60, 24, 27, 19, 79, 20, 213, 127, 
+54, 20, 0, 0, 54, 21, 6, 0, 57, 23, 7, 16, 18, 26, 16, 0, 
+57, 24, 8, 16, 41, 27, 1, 0, 23, 28, 0, 17, 66, 24, 4, 2, 
+18, 25, 19, 0, 18, 28, 16, 0, 57, 26, 8, 16, 22, 29, 0, 18, 
+66, 26, 3, 0, 65, 21, 3, 2, 60, 21, 15, 20, 79, 12, 182, 127, 
+54, 12, 9, 0, 57, 12, 10, 12, 66, 12, 1, 1, 54, 12, 11, 0, 
+18, 14, 12, 0, 57, 12, 12, 12, 66, 12, 2, 1, 54, 12, 13, 0, 
+66, 12, 1, 1, 43, 12, 2, 0, 76, 12, 2, 0, 13, 192, 15, 192, 
+7, 192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 10, 116, 
+111, 117, 99, 104, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+14, 85, 110, 115, 101, 116, 77, 97, 114, 107, 8, 67, 109, 100, 8, 115, 
+117, 98, 10, 115, 116, 121, 108, 101, 20, 67, 114, 101, 97, 116, 101, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 7, 99, 111, 7, 99, 119, 7, 99, 
+112, 13, 103, 101, 116, 77, 97, 114, 107, 115, 7, 109, 112, 13, 68, 111, 
+99, 117, 109, 101, 110, 116, 2, 161, 1, 0, 1, 7, 2, 6, 0, 20, 
+54, 1, 0, 0, 57, 1, 1, 1, 15, 0, 1, 0, 88, 2, 4, 128, 
+54, 1, 2, 0, 57, 1, 3, 1, 18, 3, 0, 0, 68, 1, 2, 0, 
+45, 1, 0, 0, 45, 3, 1, 0, 56, 3, 0, 3, 66, 1, 2, 3, 
+54, 3, 4, 0, 18, 5, 1, 0, 18, 6, 2, 0, 66, 3, 3, 1, 
+54, 3, 5, 0, 66, 3, 1, 1, 43, 3, 2, 0, 76, 3, 2, 0, 
+13, 192, 15, 192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 
+24, 83, 101, 116, 67, 117, 114, 114, 101, 110, 116, 83, 116, 121, 108, 101, 
+72, 105, 110, 116, 26, 65, 112, 112, 108, 121, 83, 116, 121, 108, 101, 84, 
+111, 83, 101, 108, 101, 99, 116, 105, 111, 110, 8, 67, 109, 100, 7, 109, 
+112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 75, 0, 0, 7, 1, 4, 
+0, 12, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 
+2, 1, 54, 2, 0, 0, 57, 2, 3, 2, 45, 3, 0, 0, 54, 5, 
+0, 0, 56, 5, 0, 5, 56, 5, 1, 5, 18, 6, 2, 0, 68, 3, 
+3, 0, 8, 192, 7, 99, 111, 7, 99, 119, 7, 99, 112, 13, 68, 111, 
+99, 117, 109, 101, 110, 116, 120, 0, 0, 7, 1, 4, 1, 23, 54, 0, 
+0, 0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 2, 1, 54, 2, 
+0, 0, 57, 2, 3, 2, 9, 2, 0, 0, 88, 3, 9, 128, 9, 1, 
+0, 0, 88, 3, 2, 128, 41, 3, 0, 0, 76, 3, 2, 0, 23, 1, 
+0, 1, 54, 3, 0, 0, 56, 3, 0, 3, 56, 3, 1, 3, 21, 2, 
+3, 0, 45, 3, 0, 0, 54, 5, 0, 0, 56, 5, 0, 5, 56, 5, 
+1, 5, 18, 6, 2, 0, 68, 3, 3, 0, 8, 192, 7, 99, 111, 7, 
+99, 119, 7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 2, 106, 
+0, 1, 5, 0, 5, 0, 12, 54, 1, 0, 0, 57, 1, 1, 1, 18, 
+3, 1, 0, 57, 1, 2, 1, 18, 4, 0, 0, 66, 1, 3, 1, 54, 
+1, 3, 0, 66, 1, 1, 1, 54, 1, 4, 0, 66, 1, 1, 1, 43, 
+1, 2, 0, 76, 1, 2, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 
+114, 97, 119, 17, 82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 
+13, 97, 99, 116, 105, 118, 97, 116, 101, 9, 109, 101, 110, 117, 16, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 250, 1, 0, 0, 4, 0, 
+5, 0, 14, 54, 0, 0, 0, 57, 0, 1, 0, 15, 0, 0, 0, 88, 
+1, 8, 128, 54, 0, 2, 0, 39, 2, 3, 0, 39, 3, 4, 0, 66, 
+0, 3, 2, 14, 0, 0, 0, 88, 0, 2, 128, 43, 0, 1, 0, 76, 
+0, 2, 0, 43, 0, 2, 0, 76, 0, 2, 0, 131, 1, 83, 111, 109, 
+101, 32, 111, 102, 32, 116, 104, 101, 32, 100, 111, 99, 117, 109, 101, 110, 
+116, 115, 32, 105, 110, 32, 116, 104, 105, 115, 32, 100, 111, 99, 117, 109, 
+101, 110, 116, 32, 115, 101, 116, 32, 99, 111, 110, 116, 97, 105, 110, 32, 
+117, 110, 115, 97, 118, 101, 100, 32, 101, 100, 105, 116, 115, 46, 32, 65, 
+114, 101, 32, 121, 111, 117, 32, 115, 117, 114, 101, 32, 121, 111, 117, 32, 
+119, 97, 110, 116, 32, 116, 111, 32, 100, 105, 115, 99, 97, 114, 100, 32, 
+116, 104, 101, 109, 44, 32, 119, 105, 116, 104, 111, 117, 116, 32, 115, 97, 
+118, 105, 110, 103, 32, 102, 105, 114, 115, 116, 63, 28, 68, 111, 99, 117, 
+109, 101, 110, 116, 32, 115, 101, 116, 32, 110, 111, 116, 32, 115, 97, 118, 
+101, 100, 33, 19, 80, 114, 111, 109, 112, 116, 70, 111, 114, 89, 101, 115, 
+78, 111, 12, 99, 104, 97, 110, 103, 101, 100, 16, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 74, 0, 0, 2, 0, 3, 0, 9, 54, 0, 
+0, 0, 66, 0, 1, 2, 15, 0, 0, 0, 88, 1, 3, 128, 54, 0, 
+1, 0, 57, 0, 2, 0, 66, 0, 1, 1, 43, 0, 1, 0, 76, 0, 
+2, 0, 9, 101, 120, 105, 116, 7, 111, 115, 27, 67, 111, 110, 102, 105, 
+114, 109, 68, 111, 99, 117, 109, 101, 110, 116, 69, 114, 97, 115, 117, 114, 
+101, 107, 0, 0, 2, 0, 3, 0, 12, 54, 0, 0, 0, 66, 0, 1, 
+2, 15, 0, 0, 0, 88, 1, 6, 128, 54, 0, 1, 0, 66, 0, 1, 
+1, 54, 0, 2, 0, 66, 0, 1, 1, 43, 0, 2, 0, 76, 0, 2, 
+0, 43, 0, 1, 0, 76, 0, 2, 0, 16, 81, 117, 101, 117, 101, 82, 
+101, 100, 114, 97, 119, 21, 82, 101, 115, 101, 116, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 27, 67, 111, 110, 102, 105, 114, 109, 68, 111, 
+99, 117, 109, 101, 110, 116, 69, 114, 97, 115, 117, 114, 101, 122, 0, 0, 
+11, 0, 7, 1, 17, 52, 0, 0, 0, 54, 1, 0, 0, 54, 3, 1, 
+0, 57, 3, 2, 3, 66, 1, 2, 4, 72, 4, 8, 128, 21, 6, 0, 
+0, 22, 6, 0, 6, 57, 7, 3, 5, 39, 8, 4, 0, 57, 9, 5, 
+5, 39, 10, 6, 0, 38, 7, 10, 7, 60, 7, 6, 0, 70, 4, 3, 
+3, 82, 4, 246, 127, 76, 0, 2, 0, 6, 41, 9, 104, 116, 109, 108, 
+13, 32, 40, 72, 84, 77, 76, 58, 32, 9, 110, 97, 109, 101, 11, 115, 
+116, 121, 108, 101, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 
+116, 10, 112, 97, 105, 114, 115, 2, 164, 3, 0, 1, 12, 0, 14, 0, 
+52, 54, 1, 0, 0, 57, 1, 1, 1, 56, 0, 0, 1, 14, 0, 0, 
+0, 88, 1, 6, 128, 54, 1, 2, 0, 39, 3, 3, 0, 39, 4, 4, 
+0, 66, 1, 3, 1, 43, 1, 1, 0, 76, 1, 2, 0, 44, 1, 2, 
+0, 54, 3, 5, 0, 57, 3, 6, 3, 15, 0, 3, 0, 88, 4, 12, 
+128, 43, 3, 0, 0, 54, 4, 5, 0, 18, 6, 4, 0, 57, 4, 7, 
+4, 66, 4, 2, 7, 18, 3, 9, 0, 18, 3, 8, 0, 18, 2, 7, 
+0, 18, 3, 6, 0, 18, 3, 5, 0, 18, 1, 4, 0, 88, 3, 3, 
+128, 54, 3, 5, 0, 57, 1, 8, 3, 18, 2, 1, 0, 18, 3, 1, 
+0, 18, 4, 2, 0, 41, 5, 1, 0, 77, 3, 8, 128, 54, 7, 5, 
+0, 54, 8, 9, 0, 18, 10, 0, 0, 54, 11, 5, 0, 56, 11, 6, 
+11, 66, 8, 3, 2, 60, 8, 6, 7, 79, 3, 248, 127, 54, 3, 0, 
+0, 18, 5, 3, 0, 57, 3, 10, 3, 66, 3, 2, 1, 54, 3, 11, 
+0, 66, 3, 1, 1, 54, 3, 12, 0, 57, 3, 13, 3, 68, 3, 1, 
+0, 14, 85, 110, 115, 101, 116, 77, 97, 114, 107, 8, 67, 109, 100, 16, 
+81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 10, 116, 111, 117, 99, 
+104, 20, 67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 7, 99, 112, 13, 103, 101, 116, 77, 97, 114, 107, 115, 7, 109, 112, 
+13, 68, 111, 99, 117, 109, 101, 110, 116, 81, 83, 111, 114, 114, 121, 33, 
+32, 73, 32, 100, 111, 110, 39, 116, 32, 114, 101, 99, 111, 103, 110, 105, 
+115, 101, 32, 116, 104, 97, 116, 32, 115, 116, 121, 108, 101, 46, 32, 40, 
+84, 104, 105, 115, 32, 117, 115, 101, 114, 32, 105, 110, 116, 101, 114, 102, 
+97, 99, 101, 32, 119, 105, 108, 108, 32, 98, 101, 32, 105, 109, 112, 114, 
+111, 118, 101, 100, 46, 41, 28, 85, 110, 107, 110, 111, 119, 110, 32, 112, 
+97, 114, 97, 103, 114, 97, 112, 104, 32, 115, 116, 121, 108, 101, 17, 77, 
+111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 11, 115, 116, 121, 108, 
+101, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 207, 1, 
+0, 0, 2, 0, 9, 0, 36, 54, 0, 0, 0, 57, 0, 1, 0, 15, 
+0, 0, 0, 88, 1, 13, 128, 54, 0, 0, 0, 43, 1, 0, 0, 61, 
+1, 1, 0, 54, 0, 0, 0, 43, 1, 0, 0, 61, 1, 2, 0, 54, 
+0, 0, 0, 43, 1, 0, 0, 61, 1, 3, 0, 54, 0, 0, 0, 43, 
+1, 1, 0, 61, 1, 4, 0, 88, 0, 15, 128, 54, 0, 0, 0, 54, 
+1, 0, 0, 57, 1, 5, 1, 61, 1, 1, 0, 54, 0, 0, 0, 54, 
+1, 0, 0, 57, 1, 6, 1, 61, 1, 2, 0, 54, 0, 0, 0, 54, 
+1, 0, 0, 57, 1, 7, 1, 61, 1, 3, 0, 54, 0, 0, 0, 43, 
+1, 2, 0, 61, 1, 4, 0, 54, 0, 8, 0, 66, 0, 1, 1, 43, 
+0, 2, 0, 76, 0, 2, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 
+114, 97, 119, 7, 99, 111, 7, 99, 119, 7, 99, 112, 21, 115, 116, 105, 
+99, 107, 121, 95, 115, 101, 108, 101, 99, 116, 105, 111, 110, 7, 109, 111, 
+7, 109, 119, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 135, 
+1, 0, 0, 2, 0, 8, 0, 21, 54, 0, 0, 0, 57, 0, 1, 0, 
+14, 0, 0, 0, 88, 0, 15, 128, 54, 0, 0, 0, 54, 1, 0, 0, 
+57, 1, 2, 1, 61, 1, 1, 0, 54, 0, 0, 0, 54, 1, 0, 0, 
+57, 1, 4, 1, 61, 1, 3, 0, 54, 0, 0, 0, 54, 1, 0, 0, 
+57, 1, 6, 1, 61, 1, 5, 0, 54, 0, 0, 0, 43, 1, 1, 0, 
+61, 1, 7, 0, 43, 0, 2, 0, 76, 0, 2, 0, 21, 115, 116, 105, 
+99, 107, 121, 95, 115, 101, 108, 101, 99, 116, 105, 111, 110, 7, 99, 111, 
+7, 109, 111, 7, 99, 119, 7, 109, 119, 7, 99, 112, 7, 109, 112, 13, 
+68, 111, 99, 117, 109, 101, 110, 116, 89, 0, 0, 2, 0, 5, 0, 13, 
+54, 0, 0, 0, 43, 1, 0, 0, 61, 1, 1, 0, 54, 0, 0, 0, 
+43, 1, 0, 0, 61, 1, 2, 0, 54, 0, 0, 0, 43, 1, 0, 0, 
+61, 1, 3, 0, 54, 0, 4, 0, 66, 0, 1, 1, 43, 0, 2, 0, 
+76, 0, 2, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 
+7, 109, 111, 7, 109, 119, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 
+110, 116, 102, 0, 0, 2, 0, 5, 0, 13, 54, 0, 0, 0, 57, 0, 
+1, 0, 15, 0, 0, 0, 88, 1, 7, 128, 54, 0, 0, 0, 57, 0, 
+2, 0, 14, 0, 0, 0, 88, 0, 3, 128, 54, 0, 3, 0, 57, 0, 
+4, 0, 68, 0, 1, 0, 43, 0, 2, 0, 76, 0, 2, 0, 14, 85, 
+110, 115, 101, 116, 77, 97, 114, 107, 8, 67, 109, 100, 21, 115, 116, 105, 
+99, 107, 121, 95, 115, 101, 108, 101, 99, 116, 105, 111, 110, 7, 109, 112, 
+13, 68, 111, 99, 117, 109, 101, 110, 116, 99, 0, 0, 2, 0, 5, 0, 
+13, 54, 0, 0, 0, 57, 0, 1, 0, 15, 0, 0, 0, 88, 1, 7, 
+128, 54, 0, 0, 0, 57, 0, 2, 0, 14, 0, 0, 0, 88, 0, 3, 
+128, 54, 0, 3, 0, 57, 0, 4, 0, 68, 0, 1, 0, 43, 0, 2, 
+0, 76, 0, 2, 0, 11, 68, 101, 108, 101, 116, 101, 8, 67, 109, 100, 
+21, 115, 116, 105, 99, 107, 121, 95, 115, 101, 108, 101, 99, 116, 105, 111, 
+110, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 139, 1, 0, 
+0, 2, 0, 5, 0, 19, 54, 0, 0, 0, 57, 0, 1, 0, 66, 0, 
+1, 2, 15, 0, 0, 0, 88, 1, 13, 128, 54, 0, 0, 0, 57, 0, 
+2, 0, 66, 0, 1, 2, 15, 0, 0, 0, 88, 1, 8, 128, 54, 0, 
+0, 0, 57, 0, 3, 0, 66, 0, 1, 2, 15, 0, 0, 0, 88, 1, 
+3, 128, 54, 0, 0, 0, 57, 0, 4, 0, 66, 0, 1, 2, 76, 0, 
+2, 0, 18, 71, 111, 116, 111, 69, 110, 100, 79, 102, 87, 111, 114, 100, 
+12, 83, 101, 116, 77, 97, 114, 107, 24, 71, 111, 116, 111, 66, 101, 103, 
+105, 110, 110, 105, 110, 103, 79, 102, 87, 111, 114, 100, 14, 85, 110, 115, 
+101, 116, 77, 97, 114, 107, 8, 67, 109, 100, 127, 0, 1, 5, 0, 4, 
+0, 18, 54, 1, 0, 0, 18, 3, 1, 0, 57, 1, 1, 1, 18, 4, 
+0, 0, 66, 1, 3, 2, 14, 0, 1, 0, 88, 1, 2, 128, 43, 1, 
+1, 0, 76, 1, 2, 0, 54, 1, 0, 0, 18, 3, 1, 0, 57, 1, 
+2, 1, 18, 4, 0, 0, 66, 1, 3, 1, 54, 1, 3, 0, 66, 1, 
+1, 1, 43, 1, 2, 0, 76, 1, 2, 0, 16, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 15, 115, 101, 116, 67, 117, 114, 114, 101, 110, 
+116, 17, 102, 105, 110, 100, 68, 111, 99, 117, 109, 101, 110, 116, 16, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 63, 0, 0, 3, 0, 3, 
+0, 10, 54, 0, 0, 0, 57, 0, 1, 0, 43, 2, 2, 0, 66, 0, 
+2, 2, 15, 0, 0, 0, 88, 1, 3, 128, 54, 0, 0, 0, 57, 0, 
+2, 0, 66, 0, 1, 2, 76, 0, 2, 0, 11, 68, 101, 108, 101, 116, 
+101, 9, 67, 111, 112, 121, 8, 67, 109, 100, 233, 5, 0, 1, 21, 1, 
+18, 2, 132, 1, 54, 1, 0, 0, 57, 1, 1, 1, 14, 0, 1, 0, 
+88, 1, 2, 128, 43, 1, 1, 0, 76, 1, 2, 0, 54, 1, 0, 0, 
+18, 3, 1, 0, 57, 1, 2, 1, 66, 1, 2, 7, 54, 7, 3, 0, 
+66, 7, 1, 2, 54, 8, 4, 0, 18, 10, 8, 0, 57, 8, 5, 8, 
+18, 11, 7, 0, 66, 8, 3, 1, 18, 8, 1, 0, 18, 9, 4, 0, 
+41, 10, 1, 0, 77, 8, 9, 128, 54, 12, 0, 0, 56, 12, 11, 12, 
+18, 15, 7, 0, 57, 13, 6, 7, 18, 18, 12, 0, 57, 16, 7, 12, 
+66, 16, 2, 0, 65, 13, 1, 1, 79, 8, 247, 127, 18, 10, 7, 0, 
+57, 8, 8, 7, 41, 11, 1, 0, 66, 8, 3, 1, 43, 8, 0, 0, 
+41, 9, 1, 0, 1, 9, 2, 0, 88, 9, 12, 128, 58, 8, 1, 7, 
+54, 9, 9, 0, 57, 11, 10, 8, 18, 14, 8, 0, 57, 12, 11, 8, 
+18, 15, 2, 0, 66, 12, 3, 0, 65, 9, 1, 2, 62, 9, 1, 7, 
+5, 1, 4, 0, 88, 9, 1, 128, 33, 5, 2, 5, 21, 9, 7, 0, 
+56, 8, 9, 7, 21, 9, 8, 0, 1, 5, 9, 0, 88, 9, 10, 128, 
+21, 9, 7, 0, 54, 10, 9, 0, 57, 12, 10, 8, 18, 15, 8, 0, 
+57, 13, 11, 8, 41, 16, 1, 0, 18, 17, 5, 0, 66, 13, 4, 0, 
+65, 10, 1, 2, 60, 10, 9, 7, 58, 8, 1, 7, 58, 9, 1, 8, 
+55, 9, 12, 0, 54, 9, 12, 0, 15, 0, 9, 0, 88, 10, 21, 128, 
+54, 9, 9, 0, 57, 11, 10, 8, 52, 12, 3, 0, 45, 13, 0, 0, 
+54, 15, 12, 0, 41, 16, 1, 0, 18, 17, 3, 0, 66, 13, 4, 0, 
+63, 13, 0, 0, 18, 15, 8, 0, 57, 13, 11, 8, 41, 16, 2, 0, 
+66, 13, 3, 0, 65, 9, 2, 2, 62, 9, 1, 7, 5, 1, 4, 0, 
+88, 9, 4, 128, 5, 2, 5, 0, 88, 9, 2, 128, 33, 9, 3, 6, 
+22, 6, 1, 9, 21, 9, 7, 0, 56, 8, 9, 7, 21, 9, 8, 0, 
+56, 9, 9, 8, 55, 9, 12, 0, 54, 9, 12, 0, 15, 0, 9, 0, 
+88, 10, 20, 128, 21, 9, 7, 0, 54, 10, 9, 0, 57, 12, 10, 8, 
+18, 15, 8, 0, 57, 13, 11, 8, 41, 16, 1, 0, 21, 17, 8, 0, 
+23, 17, 1, 17, 66, 13, 4, 2, 45, 14, 0, 0, 54, 16, 12, 0, 
+18, 17, 6, 0, 54, 18, 12, 0, 18, 20, 18, 0, 57, 18, 13, 18, 
+66, 18, 2, 2, 22, 18, 1, 18, 66, 14, 4, 0, 65, 10, 2, 2, 
+60, 10, 9, 7, 54, 9, 14, 0, 39, 11, 15, 0, 66, 9, 2, 1, 
+14, 0, 0, 0, 88, 9, 4, 128, 54, 9, 16, 0, 57, 9, 17, 9, 
+68, 9, 1, 0, 88, 9, 2, 128, 43, 9, 2, 0, 76, 9, 2, 0, 
+75, 0, 1, 0, 6, 192, 14, 85, 110, 115, 101, 116, 77, 97, 114, 107, 
+8, 67, 109, 100, 39, 83, 101, 108, 101, 99, 116, 101, 100, 32, 97, 114, 
+101, 97, 32, 99, 111, 112, 105, 101, 100, 32, 116, 111, 32, 99, 108, 105, 
+112, 98, 111, 97, 114, 100, 46, 20, 78, 111, 110, 109, 111, 100, 97, 108, 
+77, 101, 115, 115, 97, 103, 101, 8, 108, 101, 110, 9, 119, 111, 114, 100, 
+8, 115, 117, 98, 10, 115, 116, 121, 108, 101, 20, 67, 114, 101, 97, 116, 
+101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 22, 100, 101, 108, 101, 116, 
+101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 65, 116, 9, 99, 111, 112, 
+121, 20, 97, 112, 112, 101, 110, 100, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 17, 115, 101, 116, 67, 108, 105, 112, 98, 111, 97, 114, 100, 16, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 19, 67, 114, 101, 97, 116, 
+101, 68, 111, 99, 117, 109, 101, 110, 116, 13, 103, 101, 116, 77, 97, 114, 
+107, 115, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 3, 128, 
+128, 192, 153, 4, 2, 171, 6, 0, 1, 21, 0, 23, 1, 134, 1, 54, 
+1, 0, 0, 57, 1, 1, 1, 54, 2, 2, 0, 57, 2, 3, 2, 66, 
+2, 1, 1, 54, 2, 0, 0, 54, 3, 0, 0, 57, 3, 4, 3, 56, 
+2, 3, 2, 52, 3, 0, 0, 54, 4, 5, 0, 58, 6, 1, 0, 66, 
+4, 2, 4, 88, 7, 13, 128, 53, 9, 6, 0, 61, 8, 7, 9, 61, 
+7, 8, 9, 61, 2, 9, 9, 54, 10, 10, 0, 54, 12, 11, 0, 57, 
+12, 12, 12, 18, 13, 9, 0, 66, 10, 3, 1, 21, 10, 3, 0, 22, 
+10, 0, 10, 57, 11, 7, 9, 60, 11, 10, 3, 69, 7, 3, 3, 82, 
+7, 241, 127, 54, 4, 0, 0, 54, 5, 0, 0, 57, 5, 4, 5, 54, 
+6, 13, 0, 57, 8, 14, 2, 18, 11, 2, 0, 57, 9, 15, 2, 41, 
+12, 1, 0, 18, 13, 1, 0, 66, 9, 4, 2, 18, 10, 3, 0, 18, 
+13, 2, 0, 57, 11, 15, 2, 22, 14, 0, 1, 66, 11, 3, 0, 65, 
+6, 3, 2, 60, 6, 5, 4, 54, 4, 0, 0, 54, 5, 0, 0, 57, 
+5, 1, 5, 21, 6, 3, 0, 32, 5, 6, 5, 61, 5, 1, 4, 54, 
+4, 0, 0, 41, 5, 1, 0, 61, 5, 16, 4, 54, 4, 0, 0, 57, 
+4, 1, 4, 54, 5, 0, 0, 61, 1, 1, 5, 54, 5, 2, 0, 57, 
+5, 17, 5, 66, 5, 1, 1, 54, 5, 0, 0, 23, 6, 0, 4, 61, 
+6, 1, 5, 21, 4, 0, 0, 41, 5, 1, 0, 1, 5, 4, 0, 88, 
+4, 51, 128, 54, 4, 2, 0, 57, 4, 18, 4, 66, 4, 1, 1, 41, 
+4, 2, 0, 41, 5, 2, 0, 21, 6, 0, 0, 41, 7, 1, 0, 77, 
+5, 43, 128, 56, 9, 8, 0, 52, 10, 0, 0, 54, 11, 5, 0, 56, 
+13, 8, 0, 66, 11, 2, 4, 88, 14, 13, 128, 53, 16, 19, 0, 61, 
+15, 7, 16, 61, 14, 8, 16, 61, 9, 9, 16, 54, 17, 10, 0, 54, 
+19, 11, 0, 57, 19, 12, 19, 18, 20, 16, 0, 66, 17, 3, 1, 21, 
+17, 10, 0, 22, 17, 0, 17, 57, 18, 7, 16, 60, 18, 17, 10, 69, 
+14, 3, 3, 82, 14, 241, 127, 54, 11, 0, 0, 18, 13, 11, 0, 57, 
+11, 20, 11, 54, 14, 13, 0, 57, 16, 14, 9, 18, 17, 10, 0, 66, 
+14, 3, 2, 54, 15, 0, 0, 57, 15, 4, 15, 66, 11, 4, 1, 54, 
+11, 0, 0, 54, 12, 0, 0, 57, 12, 4, 12, 22, 12, 0, 12, 61, 
+12, 4, 11, 54, 11, 0, 0, 41, 12, 1, 0, 61, 12, 1, 11, 54, 
+11, 0, 0, 41, 12, 1, 0, 61, 12, 16, 11, 79, 5, 213, 127, 54, 
+4, 2, 0, 57, 4, 21, 4, 66, 4, 1, 2, 15, 0, 4, 0, 88, 
+5, 8, 128, 54, 4, 2, 0, 57, 4, 22, 4, 66, 4, 1, 2, 15, 
+0, 4, 0, 88, 5, 3, 128, 54, 4, 2, 0, 57, 4, 17, 4, 66, 
+4, 1, 2, 76, 4, 2, 0, 22, 71, 111, 116, 111, 80, 114, 101, 118, 
+105, 111, 117, 115, 67, 104, 97, 114, 87, 24, 71, 111, 116, 111, 66, 101, 
+103, 105, 110, 110, 105, 110, 103, 79, 102, 87, 111, 114, 100, 26, 105, 110, 
+115, 101, 114, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 66, 101, 102, 
+111, 114, 101, 1, 0, 3, 14, 112, 97, 114, 97, 103, 114, 97, 112, 104, 
+0, 7, 119, 110, 0, 9, 119, 111, 114, 100, 0, 26, 83, 112, 108, 105, 
+116, 67, 117, 114, 114, 101, 110, 116, 80, 97, 114, 97, 103, 114, 97, 112, 
+104, 21, 74, 111, 105, 110, 87, 105, 116, 104, 78, 101, 120, 116, 87, 111, 
+114, 100, 7, 99, 111, 8, 115, 117, 98, 10, 115, 116, 121, 108, 101, 20, 
+67, 114, 101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 17, 
+87, 111, 114, 100, 77, 111, 100, 105, 102, 105, 101, 100, 10, 69, 118, 101, 
+110, 116, 14, 70, 105, 114, 101, 69, 118, 101, 110, 116, 14, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 7, 119, 110, 9, 119, 111, 114, 100, 1, 0, 
+3, 14, 112, 97, 114, 97, 103, 114, 97, 112, 104, 0, 7, 119, 110, 0, 
+9, 119, 111, 114, 100, 0, 11, 105, 112, 97, 105, 114, 115, 7, 99, 112, 
+21, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 87, 111, 114, 
+100, 8, 67, 109, 100, 7, 99, 119, 13, 68, 111, 99, 117, 109, 101, 110, 
+116, 2, 210, 1, 0, 0, 4, 1, 8, 0, 25, 54, 0, 0, 0, 18, 
+2, 0, 0, 57, 0, 1, 0, 66, 0, 2, 2, 14, 0, 0, 0, 88, 
+1, 2, 128, 43, 1, 1, 0, 76, 1, 2, 0, 54, 1, 2, 0, 57, 
+1, 3, 1, 15, 0, 1, 0, 88, 2, 7, 128, 54, 1, 4, 0, 57, 
+1, 5, 1, 66, 1, 1, 2, 14, 0, 1, 0, 88, 1, 2, 128, 43, 
+1, 1, 0, 76, 1, 2, 0, 54, 1, 6, 0, 39, 3, 7, 0, 66, 
+1, 2, 1, 45, 1, 0, 0, 18, 3, 0, 0, 68, 1, 2, 0, 17, 
+192, 41, 67, 108, 105, 112, 98, 111, 97, 114, 100, 32, 99, 111, 112, 105, 
+101, 100, 32, 116, 111, 32, 99, 117, 114, 115, 111, 114, 32, 112, 111, 115, 
+105, 116, 105, 111, 110, 46, 20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 
+101, 115, 115, 97, 103, 101, 11, 68, 101, 108, 101, 116, 101, 8, 67, 109, 
+100, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 17, 103, 101, 
+116, 67, 108, 105, 112, 98, 111, 97, 114, 100, 16, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 242, 3, 0, 1, 15, 1, 21, 1, 84, 14, 
+0, 0, 0, 88, 1, 2, 128, 43, 1, 1, 0, 76, 1, 2, 0, 52, 
+1, 0, 0, 18, 2, 0, 0, 39, 3, 0, 0, 38, 2, 3, 2, 18, 
+4, 2, 0, 57, 2, 1, 2, 39, 5, 2, 0, 66, 2, 3, 4, 88, 
+5, 16, 128, 21, 6, 1, 0, 22, 6, 0, 6, 54, 7, 3, 0, 18, 
+9, 5, 0, 66, 7, 2, 2, 18, 9, 7, 0, 57, 7, 4, 7, 39, 
+10, 5, 0, 39, 11, 6, 0, 66, 7, 4, 2, 18, 9, 7, 0, 57, 
+7, 4, 7, 39, 10, 7, 0, 39, 11, 8, 0, 66, 7, 4, 2, 60, 
+7, 6, 1, 69, 5, 3, 2, 82, 5, 238, 127, 54, 2, 9, 0, 57, 
+2, 10, 2, 57, 2, 11, 2, 52, 3, 0, 0, 54, 4, 12, 0, 18, 
+6, 1, 0, 66, 4, 2, 4, 88, 7, 38, 128, 54, 9, 13, 0, 18, 
+11, 8, 0, 66, 9, 2, 2, 58, 10, 1, 9, 6, 10, 8, 0, 88, 
+10, 27, 128, 9, 7, 0, 0, 88, 10, 12, 128, 18, 12, 8, 0, 57, 
+10, 14, 8, 39, 13, 15, 0, 66, 10, 3, 2, 15, 0, 10, 0, 88, 
+11, 6, 128, 54, 10, 16, 0, 57, 10, 17, 10, 18, 12, 9, 0, 41, 
+13, 1, 0, 39, 14, 8, 0, 66, 10, 4, 1, 21, 10, 1, 0, 5, 
+7, 10, 0, 88, 10, 10, 128, 18, 12, 8, 0, 57, 10, 14, 8, 39, 
+13, 18, 0, 66, 10, 3, 2, 15, 0, 10, 0, 88, 11, 4, 128, 21, 
+10, 9, 0, 22, 10, 0, 10, 39, 11, 8, 0, 60, 11, 10, 9, 54, 
+10, 19, 0, 18, 12, 2, 0, 18, 13, 9, 0, 66, 10, 3, 2, 60, 
+10, 7, 3, 69, 7, 3, 3, 82, 7, 216, 127, 54, 4, 20, 0, 66, 
+4, 1, 1, 45, 4, 0, 0, 18, 6, 3, 0, 68, 4, 2, 0, 17, 
+192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 20, 67, 114, 
+101, 97, 116, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 7, 32, 36, 
+11, 105, 110, 115, 101, 114, 116, 10, 116, 97, 98, 108, 101, 7, 94, 32, 
+9, 102, 105, 110, 100, 25, 80, 97, 114, 115, 101, 83, 116, 114, 105, 110, 
+103, 73, 110, 116, 111, 87, 111, 114, 100, 115, 11, 105, 112, 97, 105, 114, 
+115, 6, 80, 11, 115, 116, 121, 108, 101, 115, 16, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 5, 8, 37, 99, 43, 6, 32, 6, 9, 9, 
+103, 115, 117, 98, 23, 67, 97, 110, 111, 110, 105, 99, 97, 108, 105, 115, 
+101, 83, 116, 114, 105, 110, 103, 13, 40, 91, 94, 10, 93, 42, 41, 10, 
+11, 103, 109, 97, 116, 99, 104, 6, 10, 2, 145, 4, 0, 0, 14, 0, 
+16, 1, 83, 54, 0, 0, 0, 57, 0, 1, 0, 14, 0, 0, 0, 88, 
+0, 2, 128, 43, 0, 1, 0, 76, 0, 2, 0, 54, 0, 0, 0, 18, 
+2, 0, 0, 57, 0, 2, 0, 66, 0, 2, 7, 54, 6, 0, 0, 61, 
+3, 3, 6, 54, 6, 0, 0, 61, 4, 4, 6, 54, 6, 0, 0, 61, 
+5, 5, 6, 54, 6, 6, 0, 57, 6, 7, 6, 66, 6, 1, 2, 14, 
+0, 6, 0, 88, 6, 2, 128, 43, 6, 1, 0, 76, 6, 2, 0, 54, 
+6, 0, 0, 61, 0, 3, 6, 54, 6, 0, 0, 61, 1, 4, 6, 54, 
+6, 0, 0, 61, 2, 5, 6, 54, 6, 6, 0, 57, 6, 7, 6, 66, 
+6, 1, 2, 14, 0, 6, 0, 88, 6, 2, 128, 43, 6, 1, 0, 76, 
+6, 2, 0, 41, 6, 1, 0, 33, 7, 0, 3, 22, 7, 0, 7, 41, 
+8, 1, 0, 77, 6, 7, 128, 54, 10, 0, 0, 18, 12, 10, 0, 57, 
+10, 8, 10, 54, 13, 0, 0, 57, 13, 3, 13, 66, 10, 3, 1, 79, 
+6, 249, 127, 54, 6, 6, 0, 57, 6, 9, 6, 66, 6, 1, 2, 15, 
+0, 6, 0, 88, 7, 10, 128, 54, 6, 6, 0, 57, 6, 10, 6, 66, 
+6, 1, 2, 15, 0, 6, 0, 88, 7, 5, 128, 54, 6, 6, 0, 57, 
+6, 11, 6, 66, 6, 1, 2, 14, 0, 6, 0, 88, 6, 2, 128, 43, 
+6, 1, 0, 76, 6, 2, 0, 9, 2, 0, 0, 88, 6, 10, 128, 41, 
+6, 1, 0, 1, 6, 1, 0, 88, 6, 7, 128, 54, 6, 6, 0, 57, 
+6, 12, 6, 66, 6, 1, 2, 14, 0, 6, 0, 88, 6, 2, 128, 43, 
+6, 1, 0, 76, 6, 2, 0, 54, 6, 13, 0, 39, 8, 14, 0, 66, 
+6, 2, 1, 54, 6, 6, 0, 57, 6, 15, 6, 68, 6, 1, 0, 14, 
+85, 110, 115, 101, 116, 77, 97, 114, 107, 27, 83, 101, 108, 101, 99, 116, 
+101, 100, 32, 97, 114, 101, 97, 32, 100, 101, 108, 101, 116, 101, 100, 46, 
+20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 
+21, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 87, 111, 114, 
+100, 21, 74, 111, 105, 110, 87, 105, 116, 104, 78, 101, 120, 116, 87, 111, 
+114, 100, 18, 71, 111, 116, 111, 69, 110, 100, 79, 102, 87, 111, 114, 100, 
+22, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 87, 111, 114, 
+100, 87, 22, 100, 101, 108, 101, 116, 101, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 65, 116, 26, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 
+116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 8, 67, 109, 100, 7, 99, 
+111, 7, 99, 119, 7, 99, 112, 13, 103, 101, 116, 77, 97, 114, 107, 115, 
+7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 2, 203, 4, 0, 
+2, 19, 4, 23, 1, 108, 14, 0, 0, 0, 88, 2, 10, 128, 54, 2, 
+0, 0, 66, 2, 1, 3, 18, 1, 3, 0, 18, 0, 2, 0, 15, 0, 
+0, 0, 88, 2, 2, 128, 7, 0, 1, 0, 88, 2, 2, 128, 43, 2, 
+1, 0, 76, 2, 2, 0, 52, 2, 0, 0, 54, 3, 2, 0, 18, 5, 
+0, 0, 39, 6, 3, 0, 66, 3, 3, 2, 54, 4, 4, 0, 18, 6, 
+3, 0, 66, 4, 2, 4, 88, 7, 53, 128, 52, 9, 0, 0, 41, 10, 
+1, 0, 18, 13, 8, 0, 57, 11, 5, 8, 66, 11, 2, 2, 3, 10, 
+11, 0, 88, 12, 39, 128, 85, 12, 38, 128, 45, 12, 0, 0, 45, 14, 
+1, 0, 18, 16, 8, 0, 18, 17, 10, 0, 66, 14, 3, 0, 65, 12, 
+0, 2, 45, 13, 2, 0, 18, 17, 8, 0, 57, 15, 6, 8, 18, 18, 
+10, 0, 66, 15, 3, 0, 65, 13, 0, 2, 32, 10, 13, 10, 39, 13, 
+7, 0, 3, 13, 12, 0, 88, 13, 3, 128, 39, 13, 8, 0, 2, 12, 
+13, 0, 88, 13, 6, 128, 39, 13, 9, 0, 3, 13, 12, 0, 88, 13, 
+12, 128, 39, 13, 10, 0, 3, 12, 13, 0, 88, 13, 9, 128, 39, 13, 
+11, 0, 18, 16, 12, 0, 57, 14, 12, 12, 66, 14, 2, 2, 18, 17, 
+12, 0, 57, 15, 13, 12, 66, 15, 2, 2, 39, 16, 14, 0, 38, 12, 
+16, 13, 21, 13, 9, 0, 22, 13, 0, 13, 60, 12, 13, 9, 88, 12, 
+215, 127, 21, 12, 2, 0, 22, 12, 0, 12, 45, 13, 3, 0, 18, 15, 
+9, 0, 39, 16, 15, 0, 66, 13, 3, 2, 60, 13, 12, 2, 69, 7, 
+3, 3, 82, 7, 201, 127, 41, 4, 2, 0, 21, 5, 2, 0, 23, 5, 
+0, 5, 41, 6, 1, 0, 77, 4, 6, 128, 39, 8, 16, 0, 56, 9, 
+7, 2, 39, 10, 17, 0, 38, 8, 10, 8, 60, 8, 7, 2, 79, 4, 
+250, 127, 21, 4, 2, 0, 41, 5, 1, 0, 1, 5, 4, 0, 88, 4, 
+10, 128, 58, 4, 1, 2, 39, 5, 17, 0, 38, 4, 5, 4, 62, 4, 
+1, 2, 21, 4, 2, 0, 39, 5, 16, 0, 21, 6, 2, 0, 56, 6, 
+6, 2, 38, 5, 6, 5, 60, 5, 4, 2, 54, 4, 18, 0, 61, 2, 
+19, 4, 54, 4, 18, 0, 61, 1, 20, 4, 54, 4, 21, 0, 57, 4, 
+22, 4, 68, 4, 1, 0, 11, 192, 10, 192, 1, 192, 12, 192, 13, 70, 
+105, 110, 100, 78, 101, 120, 116, 8, 67, 109, 100, 16, 114, 101, 112, 108, 
+97, 99, 101, 116, 101, 120, 116, 13, 102, 105, 110, 100, 116, 101, 120, 116, 
+16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 9, 37, 99, 42, 
+36, 9, 94, 37, 99, 42, 8, 37, 99, 42, 6, 93, 10, 108, 111, 119, 
+101, 114, 10, 117, 112, 112, 101, 114, 6, 91, 6, 122, 6, 97, 6, 90, 
+6, 65, 9, 98, 121, 116, 101, 8, 108, 101, 110, 11, 105, 112, 97, 105, 
+114, 115, 7, 37, 115, 16, 83, 112, 108, 105, 116, 83, 116, 114, 105, 110, 
+103, 5, 27, 70, 105, 110, 100, 65, 110, 100, 82, 101, 112, 108, 97, 99, 
+101, 68, 105, 97, 108, 111, 103, 117, 101, 2, 143, 5, 0, 0, 15, 0, 
+18, 2, 123, 54, 0, 0, 0, 57, 0, 1, 0, 14, 0, 0, 0, 88, 
+0, 2, 128, 43, 0, 1, 0, 76, 0, 2, 0, 54, 0, 2, 0, 39, 
+2, 3, 0, 66, 0, 2, 1, 54, 0, 4, 0, 57, 0, 5, 0, 54, 
+1, 4, 0, 57, 1, 6, 1, 54, 2, 4, 0, 57, 2, 7, 2, 54, 
+3, 0, 0, 57, 3, 1, 3, 21, 4, 3, 0, 9, 4, 0, 0, 88, 
+4, 7, 128, 54, 4, 8, 0, 66, 4, 1, 1, 54, 4, 9, 0, 39, 
+6, 10, 0, 66, 4, 2, 1, 43, 4, 1, 0, 76, 4, 2, 0, 58, 
+4, 1, 3, 85, 5, 87, 128, 54, 5, 4, 0, 56, 5, 0, 5, 56, 
+5, 1, 5, 18, 8, 5, 0, 57, 6, 11, 5, 18, 9, 4, 0, 18, 
+10, 2, 0, 66, 6, 4, 3, 15, 0, 6, 0, 88, 8, 51, 128, 18, 
+8, 1, 0, 41, 9, 2, 0, 43, 10, 2, 0, 21, 11, 3, 0, 3, 
+9, 11, 0, 88, 11, 21, 128, 85, 11, 20, 128, 22, 8, 1, 8, 54, 
+11, 4, 0, 56, 11, 0, 11, 56, 5, 8, 11, 14, 0, 5, 0, 88, 
+11, 2, 128, 43, 10, 1, 0, 88, 11, 12, 128, 18, 13, 5, 0, 57, 
+11, 11, 5, 56, 14, 9, 3, 66, 11, 3, 3, 18, 7, 12, 0, 55, 
+11, 12, 0, 14, 0, 7, 0, 88, 11, 2, 128, 43, 10, 1, 0, 88, 
+11, 2, 128, 22, 9, 1, 9, 88, 11, 232, 127, 15, 0, 10, 0, 88, 
+11, 22, 128, 54, 11, 4, 0, 61, 0, 5, 11, 54, 11, 4, 0, 61, 
+8, 6, 11, 54, 11, 4, 0, 22, 12, 1, 7, 61, 12, 7, 11, 54, 
+11, 4, 0, 54, 12, 4, 0, 57, 12, 5, 12, 61, 12, 13, 11, 54, 
+11, 4, 0, 61, 1, 14, 11, 54, 11, 4, 0, 61, 6, 15, 11, 54, 
+11, 9, 0, 39, 13, 16, 0, 66, 11, 2, 1, 54, 11, 8, 0, 66, 
+11, 1, 1, 43, 11, 2, 0, 76, 11, 2, 0, 41, 2, 1, 0, 22, 
+1, 1, 1, 54, 8, 4, 0, 56, 8, 0, 8, 21, 8, 8, 0, 1, 
+8, 1, 0, 88, 8, 7, 128, 41, 1, 1, 0, 22, 0, 1, 0, 54, 
+8, 4, 0, 21, 8, 8, 0, 1, 8, 0, 0, 88, 8, 1, 128, 41, 
+0, 1, 0, 54, 8, 4, 0, 57, 8, 5, 8, 5, 0, 8, 0, 88, 
+8, 176, 127, 54, 8, 4, 0, 57, 8, 6, 8, 5, 1, 8, 0, 88, 
+8, 172, 127, 9, 2, 1, 0, 88, 8, 170, 127, 88, 5, 1, 128, 88, 
+5, 168, 127, 54, 5, 8, 0, 66, 5, 1, 1, 54, 5, 9, 0, 39, 
+7, 17, 0, 66, 5, 2, 1, 43, 5, 1, 0, 76, 5, 2, 0, 15, 
+78, 111, 116, 32, 102, 111, 117, 110, 100, 46, 11, 70, 111, 117, 110, 100, 
+46, 7, 109, 111, 7, 109, 119, 7, 109, 112, 6, 95, 9, 102, 105, 110, 
+100, 27, 78, 111, 116, 104, 105, 110, 103, 32, 116, 111, 32, 115, 101, 97, 
+114, 99, 104, 32, 102, 111, 114, 46, 20, 78, 111, 110, 109, 111, 100, 97, 
+108, 77, 101, 115, 115, 97, 103, 101, 16, 81, 117, 101, 117, 101, 82, 101, 
+100, 114, 97, 119, 7, 99, 111, 7, 99, 119, 7, 99, 112, 13, 68, 111, 
+99, 117, 109, 101, 110, 116, 17, 83, 101, 97, 114, 99, 104, 105, 110, 103, 
+46, 46, 46, 21, 73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 
+115, 97, 103, 101, 13, 102, 105, 110, 100, 116, 101, 120, 116, 16, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 2, 244, 2, 0, 0, 10, 
+0, 15, 0, 52, 54, 0, 0, 0, 57, 0, 1, 0, 15, 0, 0, 0, 
+88, 1, 45, 128, 54, 0, 2, 0, 57, 0, 3, 0, 66, 0, 1, 2, 
+15, 0, 0, 0, 88, 1, 3, 128, 54, 0, 2, 0, 57, 0, 4, 0, 
+66, 0, 1, 2, 14, 0, 0, 0, 88, 1, 2, 128, 43, 1, 1, 0, 
+76, 1, 2, 0, 43, 0, 2, 0, 54, 1, 5, 0, 54, 3, 6, 0, 
+57, 3, 7, 3, 39, 4, 8, 0, 66, 1, 3, 2, 54, 2, 9, 0, 
+18, 4, 1, 0, 66, 2, 2, 4, 88, 5, 14, 128, 41, 7, 1, 0, 
+1, 7, 5, 0, 88, 7, 4, 128, 54, 7, 2, 0, 57, 7, 10, 7, 
+66, 7, 1, 2, 18, 5, 7, 0, 15, 0, 0, 0, 88, 7, 5, 128, 
+54, 7, 2, 0, 57, 7, 11, 7, 18, 9, 6, 0, 66, 7, 2, 2, 
+18, 0, 7, 0, 69, 5, 3, 3, 82, 5, 240, 127, 14, 0, 0, 0, 
+88, 2, 2, 128, 43, 2, 1, 0, 76, 2, 2, 0, 54, 2, 12, 0, 
+39, 4, 13, 0, 66, 2, 2, 1, 54, 0, 2, 0, 57, 0, 14, 0, 
+68, 0, 1, 0, 13, 70, 105, 110, 100, 78, 101, 120, 116, 19, 82, 101, 
+112, 108, 97, 99, 101, 100, 32, 116, 101, 120, 116, 46, 20, 78, 111, 110, 
+109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 25, 73, 110, 115, 
+101, 114, 116, 83, 116, 114, 105, 110, 103, 73, 110, 116, 111, 87, 111, 114, 
+100, 21, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 116, 87, 111, 
+114, 100, 11, 105, 112, 97, 105, 114, 115, 7, 37, 115, 16, 114, 101, 112, 
+108, 97, 99, 101, 116, 101, 120, 116, 16, 68, 111, 99, 117, 109, 101, 110, 
+116, 83, 101, 116, 16, 83, 112, 108, 105, 116, 83, 116, 114, 105, 110, 103, 
+14, 85, 110, 115, 101, 116, 77, 97, 114, 107, 11, 68, 101, 108, 101, 116, 
+101, 8, 67, 109, 100, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 110, 
+116, 182, 1, 0, 0, 3, 0, 6, 0, 21, 54, 0, 0, 0, 57, 0, 
+1, 0, 15, 0, 0, 0, 88, 1, 7, 128, 54, 0, 0, 0, 43, 1, 
+1, 0, 61, 1, 1, 0, 54, 0, 2, 0, 39, 2, 3, 0, 66, 0, 
+2, 1, 88, 0, 6, 128, 54, 0, 0, 0, 43, 1, 2, 0, 61, 1, 
+1, 0, 54, 0, 2, 0, 39, 2, 4, 0, 66, 0, 2, 1, 54, 0, 
+5, 0, 66, 0, 1, 1, 43, 0, 2, 0, 76, 0, 2, 0, 16, 81, 
+117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 24, 83, 116, 97, 116, 117, 
+115, 32, 98, 97, 114, 32, 101, 110, 97, 98, 108, 101, 100, 46, 25, 83, 
+116, 97, 116, 117, 115, 32, 98, 97, 114, 32, 100, 105, 115, 97, 98, 108, 
+101, 100, 46, 20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 
+97, 103, 101, 14, 115, 116, 97, 116, 117, 115, 98, 97, 114, 16, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 33, 0, 0, 2, 0, 1, 0, 
+3, 54, 0, 0, 0, 66, 0, 1, 1, 75, 0, 1, 0, 18, 65, 98, 
+111, 117, 116, 68, 105, 97, 108, 111, 103, 117, 101, 169, 18, 3, 0, 20, 
+0, 159, 1, 0, 240, 1, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 
+2, 0, 57, 1, 3, 1, 54, 2, 2, 0, 57, 2, 4, 2, 54, 3, 
+2, 0, 57, 3, 5, 3, 54, 4, 2, 0, 57, 4, 6, 4, 54, 5, 
+2, 0, 57, 5, 7, 5, 54, 6, 2, 0, 57, 6, 8, 6, 54, 7, 
+2, 0, 57, 7, 9, 7, 54, 8, 2, 0, 57, 8, 10, 8, 54, 9, 
+2, 0, 57, 9, 11, 9, 54, 10, 2, 0, 57, 10, 12, 10, 54, 11, 
+2, 0, 57, 11, 13, 11, 54, 12, 14, 0, 57, 12, 15, 12, 54, 13, 
+16, 0, 14, 0, 13, 0, 88, 14, 2, 128, 54, 13, 14, 0, 57, 13, 
+16, 13, 54, 14, 17, 0, 51, 15, 19, 0, 61, 15, 18, 14, 54, 14, 
+17, 0, 51, 15, 21, 0, 61, 15, 20, 14, 54, 14, 17, 0, 51, 15, 
+23, 0, 61, 15, 22, 14, 54, 14, 17, 0, 51, 15, 25, 0, 61, 15, 
+24, 14, 54, 14, 17, 0, 51, 15, 27, 0, 61, 15, 26, 14, 54, 14, 
+17, 0, 51, 15, 29, 0, 61, 15, 28, 14, 54, 14, 17, 0, 51, 15, 
+31, 0, 61, 15, 30, 14, 54, 14, 17, 0, 51, 15, 33, 0, 61, 15, 
+32, 14, 54, 14, 17, 0, 51, 15, 35, 0, 61, 15, 34, 14, 54, 14, 
+17, 0, 51, 15, 37, 0, 61, 15, 36, 14, 54, 14, 17, 0, 51, 15, 
+39, 0, 61, 15, 38, 14, 54, 14, 17, 0, 51, 15, 41, 0, 61, 15, 
+40, 14, 54, 14, 17, 0, 51, 15, 43, 0, 61, 15, 42, 14, 54, 14, 
+17, 0, 51, 15, 45, 0, 61, 15, 44, 14, 54, 14, 17, 0, 51, 15, 
+47, 0, 61, 15, 46, 14, 54, 14, 17, 0, 51, 15, 49, 0, 61, 15, 
+48, 14, 54, 14, 17, 0, 51, 15, 51, 0, 61, 15, 50, 14, 54, 14, 
+17, 0, 51, 15, 53, 0, 61, 15, 52, 14, 54, 14, 17, 0, 51, 15, 
+55, 0, 61, 15, 54, 14, 54, 14, 17, 0, 51, 15, 57, 0, 61, 15, 
+56, 14, 54, 14, 17, 0, 51, 15, 59, 0, 61, 15, 58, 14, 54, 14, 
+17, 0, 51, 15, 61, 0, 61, 15, 60, 14, 54, 14, 17, 0, 51, 15, 
+63, 0, 61, 15, 62, 14, 54, 14, 17, 0, 51, 15, 65, 0, 61, 15, 
+64, 14, 54, 14, 17, 0, 51, 15, 67, 0, 61, 15, 66, 14, 54, 14, 
+17, 0, 51, 15, 69, 0, 61, 15, 68, 14, 54, 14, 17, 0, 51, 15, 
+71, 0, 61, 15, 70, 14, 54, 14, 17, 0, 51, 15, 73, 0, 61, 15, 
+72, 14, 54, 14, 17, 0, 51, 15, 75, 0, 61, 15, 74, 14, 54, 14, 
+17, 0, 51, 15, 77, 0, 61, 15, 76, 14, 54, 14, 17, 0, 51, 15, 
+79, 0, 61, 15, 78, 14, 51, 14, 80, 0, 54, 15, 17, 0, 51, 16, 
+82, 0, 61, 16, 81, 15, 54, 15, 17, 0, 51, 16, 84, 0, 61, 16, 
+83, 15, 54, 15, 17, 0, 51, 16, 86, 0, 61, 16, 85, 15, 54, 15, 
+17, 0, 51, 16, 88, 0, 61, 16, 87, 15, 54, 15, 17, 0, 51, 16, 
+90, 0, 61, 16, 89, 15, 54, 15, 17, 0, 51, 16, 92, 0, 61, 16, 
+91, 15, 53, 15, 95, 0, 53, 16, 94, 0, 54, 17, 2, 0, 57, 17, 
+93, 17, 62, 17, 1, 16, 61, 16, 96, 15, 53, 16, 98, 0, 54, 17, 
+2, 0, 57, 17, 97, 17, 62, 17, 1, 16, 61, 16, 99, 15, 53, 16, 
+101, 0, 54, 17, 2, 0, 57, 17, 100, 17, 62, 17, 1, 16, 61, 16, 
+102, 15, 53, 16, 103, 0, 61, 16, 104, 15, 54, 16, 17, 0, 51, 17, 
+106, 0, 61, 17, 105, 16, 54, 16, 17, 0, 51, 17, 108, 0, 61, 17, 
+107, 16, 51, 16, 109, 0, 55, 16, 110, 0, 51, 16, 111, 0, 55, 16, 
+112, 0, 54, 16, 17, 0, 51, 17, 114, 0, 61, 17, 113, 16, 51, 16, 
+115, 0, 55, 16, 116, 0, 54, 16, 17, 0, 51, 17, 118, 0, 61, 17, 
+117, 16, 54, 16, 17, 0, 51, 17, 120, 0, 61, 17, 119, 16, 51, 16, 
+121, 0, 54, 17, 17, 0, 51, 18, 123, 0, 61, 18, 122, 17, 54, 17, 
+17, 0, 51, 18, 125, 0, 61, 18, 124, 17, 54, 17, 17, 0, 51, 18, 
+127, 0, 61, 18, 126, 17, 54, 17, 17, 0, 51, 18, 129, 0, 61, 18, 
+128, 17, 54, 17, 17, 0, 51, 18, 131, 0, 61, 18, 130, 17, 54, 17, 
+17, 0, 51, 18, 133, 0, 61, 18, 132, 17, 54, 17, 17, 0, 51, 18, 
+135, 0, 61, 18, 134, 17, 54, 17, 17, 0, 51, 18, 137, 0, 61, 18, 
+136, 17, 54, 17, 17, 0, 51, 18, 139, 0, 61, 18, 138, 17, 54, 17, 
+17, 0, 51, 18, 141, 0, 61, 18, 140, 17, 51, 17, 142, 0, 54, 18, 
+17, 0, 51, 19, 144, 0, 61, 19, 143, 18, 54, 18, 17, 0, 51, 19, 
+146, 0, 61, 19, 145, 18, 54, 18, 17, 0, 51, 19, 148, 0, 61, 19, 
+147, 18, 54, 18, 17, 0, 51, 19, 150, 0, 61, 19, 149, 18, 54, 18, 
+17, 0, 51, 19, 152, 0, 61, 19, 151, 18, 54, 18, 17, 0, 51, 19, 
+154, 0, 61, 19, 153, 18, 54, 18, 17, 0, 51, 19, 156, 0, 61, 19, 
+155, 18, 54, 18, 17, 0, 51, 19, 158, 0, 61, 19, 157, 18, 50, 0, 
+0, 128, 75, 0, 1, 0, 0, 21, 65, 98, 111, 117, 116, 87, 111, 114, 
+100, 71, 114, 105, 110, 100, 101, 114, 0, 20, 84, 111, 103, 103, 108, 101, 
+83, 116, 97, 116, 117, 115, 66, 97, 114, 0, 20, 82, 101, 112, 108, 97, 
+99, 101, 84, 104, 101, 110, 70, 105, 110, 100, 0, 13, 70, 105, 110, 100, 
+78, 101, 120, 116, 0, 9, 70, 105, 110, 100, 0, 11, 68, 101, 108, 101, 
+116, 101, 0, 15, 73, 110, 115, 101, 114, 116, 84, 101, 120, 116, 0, 10, 
+80, 97, 115, 116, 101, 0, 0, 9, 67, 111, 112, 121, 0, 8, 67, 117, 
+116, 0, 19, 67, 104, 97, 110, 103, 101, 68, 111, 99, 117, 109, 101, 110, 
+116, 0, 15, 83, 101, 108, 101, 99, 116, 87, 111, 114, 100, 0, 22, 84, 
+121, 112, 101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 99, 116, 101, 100, 
+0, 22, 77, 111, 118, 101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 99, 
+116, 101, 100, 0, 14, 85, 110, 115, 101, 116, 77, 97, 114, 107, 0, 12, 
+83, 101, 116, 77, 97, 114, 107, 0, 15, 84, 111, 103, 103, 108, 101, 77, 
+97, 114, 107, 0, 25, 67, 104, 97, 110, 103, 101, 80, 97, 114, 97, 103, 
+114, 97, 112, 104, 83, 116, 121, 108, 101, 0, 0, 27, 67, 114, 101, 97, 
+116, 101, 66, 108, 97, 110, 107, 68, 111, 99, 117, 109, 101, 110, 116, 83, 
+101, 116, 0, 21, 84, 101, 114, 109, 105, 110, 97, 116, 101, 80, 114, 111, 
+103, 114, 97, 109, 27, 67, 111, 110, 102, 105, 114, 109, 68, 111, 99, 117, 
+109, 101, 110, 116, 69, 114, 97, 115, 117, 114, 101, 0, 0, 17, 65, 99, 
+116, 105, 118, 97, 116, 101, 77, 101, 110, 117, 27, 71, 101, 116, 83, 116, 
+121, 108, 101, 84, 111, 76, 101, 102, 116, 79, 102, 67, 117, 114, 115, 111, 
+114, 0, 21, 71, 101, 116, 83, 116, 121, 108, 101, 65, 116, 67, 117, 114, 
+115, 111, 114, 0, 0, 13, 83, 101, 116, 83, 116, 121, 108, 101, 0, 26, 
+65, 112, 112, 108, 121, 83, 116, 121, 108, 101, 84, 111, 83, 101, 108, 101, 
+99, 116, 105, 111, 110, 6, 111, 1, 3, 0, 0, 3, 0, 3, 0, 6, 
+105, 1, 3, 0, 0, 0, 3, 15, 11, 73, 84, 65, 76, 73, 67, 6, 
+117, 1, 3, 0, 0, 0, 3, 15, 14, 85, 78, 68, 69, 82, 76, 73, 
+78, 69, 6, 98, 1, 0, 4, 6, 117, 0, 6, 98, 0, 6, 105, 0, 
+6, 111, 0, 1, 3, 0, 0, 0, 3, 15, 9, 66, 79, 76, 68, 0, 
+17, 71, 111, 116, 111, 78, 101, 120, 116, 80, 97, 103, 101, 0, 21, 71, 
+111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 103, 101, 0, 
+18, 71, 111, 116, 111, 69, 110, 100, 79, 102, 76, 105, 110, 101, 0, 24, 
+71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 76, 
+105, 110, 101, 0, 21, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 
+115, 76, 105, 110, 101, 0, 17, 71, 111, 116, 111, 78, 101, 120, 116, 76, 
+105, 110, 101, 0, 0, 18, 71, 111, 116, 111, 88, 80, 111, 115, 105, 116, 
+105, 111, 110, 0, 26, 83, 112, 108, 105, 116, 67, 117, 114, 114, 101, 110, 
+116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 15, 68, 101, 108, 101, 
+116, 101, 87, 111, 114, 100, 0, 27, 68, 101, 108, 101, 116, 101, 87, 111, 
+114, 100, 76, 101, 102, 116, 79, 102, 67, 117, 114, 115, 111, 114, 0, 30, 
+68, 101, 108, 101, 116, 101, 83, 101, 108, 101, 99, 116, 105, 111, 110, 79, 
+114, 78, 101, 120, 116, 67, 104, 97, 114, 0, 19, 68, 101, 108, 101, 116, 
+101, 78, 101, 120, 116, 67, 104, 97, 114, 0, 34, 68, 101, 108, 101, 116, 
+101, 83, 101, 108, 101, 99, 116, 105, 111, 110, 79, 114, 80, 114, 101, 118, 
+105, 111, 117, 115, 67, 104, 97, 114, 0, 23, 68, 101, 108, 101, 116, 101, 
+80, 114, 101, 118, 105, 111, 117, 115, 67, 104, 97, 114, 0, 21, 74, 111, 
+105, 110, 87, 105, 116, 104, 78, 101, 120, 116, 87, 111, 114, 100, 0, 26, 
+74, 111, 105, 110, 87, 105, 116, 104, 78, 101, 120, 116, 80, 97, 114, 97, 
+103, 114, 97, 112, 104, 0, 21, 83, 112, 108, 105, 116, 67, 117, 114, 114, 
+101, 110, 116, 87, 111, 114, 100, 0, 30, 73, 110, 115, 101, 114, 116, 83, 
+116, 114, 105, 110, 103, 73, 110, 116, 111, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 0, 25, 73, 110, 115, 101, 114, 116, 83, 116, 114, 105, 110, 103, 
+73, 110, 116, 111, 87, 111, 114, 100, 0, 18, 71, 111, 116, 111, 78, 101, 
+120, 116, 67, 104, 97, 114, 87, 0, 22, 71, 111, 116, 111, 80, 114, 101, 
+118, 105, 111, 117, 115, 67, 104, 97, 114, 87, 0, 17, 71, 111, 116, 111, 
+78, 101, 120, 116, 67, 104, 97, 114, 0, 21, 71, 111, 116, 111, 80, 114, 
+101, 118, 105, 111, 117, 115, 67, 104, 97, 114, 0, 18, 71, 111, 116, 111, 
+78, 101, 120, 116, 87, 111, 114, 100, 87, 0, 22, 71, 111, 116, 111, 80, 
+114, 101, 118, 105, 111, 117, 115, 87, 111, 114, 100, 87, 0, 17, 71, 111, 
+116, 111, 78, 101, 120, 116, 87, 111, 114, 100, 0, 21, 71, 111, 116, 111, 
+80, 114, 101, 118, 105, 111, 117, 115, 87, 111, 114, 100, 0, 23, 71, 111, 
+116, 111, 78, 101, 120, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 87, 
+0, 27, 71, 111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 
+114, 97, 103, 114, 97, 112, 104, 87, 0, 22, 71, 111, 116, 111, 78, 101, 
+120, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 26, 71, 111, 116, 
+111, 80, 114, 101, 118, 105, 111, 117, 115, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 0, 22, 71, 111, 116, 111, 69, 110, 100, 79, 102, 68, 111, 99, 
+117, 109, 101, 110, 116, 0, 28, 71, 111, 116, 111, 66, 101, 103, 105, 110, 
+110, 105, 110, 103, 79, 102, 68, 111, 99, 117, 109, 101, 110, 116, 0, 23, 
+71, 111, 116, 111, 69, 110, 100, 79, 102, 80, 97, 114, 97, 103, 114, 97, 
+112, 104, 0, 29, 71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 
+103, 79, 102, 80, 97, 114, 97, 103, 114, 97, 112, 104, 0, 18, 71, 111, 
+116, 111, 69, 110, 100, 79, 102, 87, 111, 114, 100, 0, 24, 71, 111, 116, 
+111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 87, 111, 114, 100, 
+8, 67, 109, 100, 11, 117, 110, 112, 97, 99, 107, 11, 99, 111, 110, 99, 
+97, 116, 10, 116, 97, 98, 108, 101, 12, 119, 114, 105, 116, 101, 117, 56, 
+11, 114, 101, 97, 100, 117, 56, 20, 99, 114, 101, 97, 116, 101, 115, 116, 
+121, 108, 101, 98, 121, 116, 101, 21, 103, 101, 116, 115, 116, 121, 108, 101, 
+102, 114, 111, 109, 119, 111, 114, 100, 21, 97, 112, 112, 108, 121, 115, 116, 
+121, 108, 101, 116, 111, 119, 111, 114, 100, 19, 100, 101, 108, 101, 116, 101, 
+102, 114, 111, 109, 119, 111, 114, 100, 19, 105, 110, 115, 101, 114, 116, 105, 
+110, 116, 111, 119, 111, 114, 100, 19, 112, 114, 101, 118, 99, 104, 97, 114, 
+105, 110, 119, 111, 114, 100, 19, 110, 101, 120, 116, 99, 104, 97, 114, 105, 
+110, 119, 111, 114, 100, 19, 103, 101, 116, 115, 116, 114, 105, 110, 103, 119, 
+105, 100, 116, 104, 24, 103, 101, 116, 98, 121, 116, 101, 115, 111, 102, 99, 
+104, 97, 114, 97, 99, 116, 101, 114, 7, 119, 103, 10, 102, 108, 111, 111, 
+114, 9, 109, 97, 116, 104, 0, 
+};
+
+/* This is src/lua/addons/goto.lua */
+static const char file_27[] = {
+27, 76, 74, 2, 10, 252, 3, 0, 2, 9, 0, 16, 0, 38, 54, 2, 
+0, 0, 57, 2, 1, 2, 53, 4, 2, 0, 54, 5, 0, 0, 57, 5, 
+1, 5, 61, 5, 3, 4, 61, 0, 4, 4, 61, 1, 5, 4, 66, 2, 
+2, 2, 53, 3, 6, 0, 54, 4, 0, 0, 57, 4, 7, 4, 61, 4, 
+8, 3, 54, 4, 0, 0, 57, 4, 7, 4, 61, 4, 9, 3, 54, 4, 
+0, 0, 57, 4, 10, 4, 53, 6, 11, 0, 66, 4, 2, 2, 62, 4, 
+1, 3, 62, 2, 2, 3, 54, 4, 0, 0, 57, 4, 12, 4, 18, 6, 
+3, 0, 54, 7, 13, 0, 39, 8, 14, 0, 66, 4, 4, 2, 54, 5, 
+15, 0, 66, 5, 1, 1, 15, 0, 4, 0, 88, 5, 3, 128, 57, 5, 
+5, 2, 76, 5, 2, 0, 88, 5, 2, 128, 43, 5, 0, 0, 76, 5, 
+2, 0, 75, 0, 1, 0, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 
+97, 119, 44, 82, 69, 84, 85, 82, 78, 32, 116, 111, 32, 115, 101, 108, 
+101, 99, 116, 32, 105, 116, 101, 109, 44, 32, 67, 84, 82, 76, 43, 67, 
+32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 17, 82, 101, 100, 114, 97, 
+119, 83, 99, 114, 101, 101, 110, 8, 82, 117, 110, 1, 0, 5, 10, 118, 
+97, 108, 117, 101, 31, 83, 101, 108, 101, 99, 116, 32, 104, 101, 97, 100, 
+105, 110, 103, 32, 116, 111, 32, 106, 117, 109, 112, 32, 116, 111, 58, 7, 
+121, 50, 3, 1, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 121, 49, 
+3, 1, 7, 120, 49, 3, 1, 10, 76, 97, 98, 101, 108, 11, 104, 101, 
+105, 103, 104, 116, 10, 119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 
+1, 0, 7, 14, 75, 69, 89, 95, 69, 78, 84, 69, 82, 12, 99, 111, 
+110, 102, 105, 114, 109, 11, 75, 69, 89, 95, 94, 67, 11, 99, 97, 110, 
+99, 101, 108, 13, 115, 116, 114, 101, 116, 99, 104, 121, 1, 11, 104, 101, 
+105, 103, 104, 116, 0, 15, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 
+12, 99, 111, 110, 102, 105, 114, 109, 10, 119, 105, 100, 116, 104, 0, 10, 
+116, 105, 116, 108, 101, 22, 84, 97, 98, 108, 101, 32, 111, 102, 32, 67, 
+111, 110, 116, 101, 110, 116, 115, 11, 99, 117, 114, 115, 111, 114, 9, 100, 
+97, 116, 97, 9, 116, 121, 112, 101, 1, 0, 8, 7, 121, 50, 3, 255, 
+255, 255, 255, 15, 11, 99, 117, 114, 115, 111, 114, 0, 9, 116, 121, 112, 
+101, 0, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 121, 49, 3, 2, 
+7, 120, 49, 3, 1, 14, 102, 111, 99, 117, 115, 97, 98, 108, 101, 2, 
+9, 100, 97, 116, 97, 0, 12, 66, 114, 111, 119, 115, 101, 114, 9, 70, 
+111, 114, 109, 187, 5, 0, 0, 19, 2, 23, 2, 101, 54, 0, 0, 0, 
+39, 2, 1, 0, 66, 0, 2, 1, 52, 0, 0, 0, 53, 1, 2, 0, 
+41, 2, 1, 0, 54, 3, 3, 0, 54, 5, 4, 0, 66, 3, 2, 4, 
+88, 6, 58, 128, 57, 8, 5, 7, 57, 8, 6, 8, 18, 10, 8, 0, 
+57, 8, 7, 8, 39, 11, 8, 0, 66, 8, 3, 4, 15, 0, 10, 0, 
+88, 11, 50, 128, 54, 11, 9, 0, 18, 13, 10, 0, 66, 11, 2, 2, 
+18, 10, 11, 0, 56, 11, 10, 1, 22, 11, 0, 11, 60, 11, 10, 1, 
+22, 11, 0, 10, 41, 12, 4, 0, 41, 13, 1, 0, 77, 11, 3, 128, 
+41, 15, 0, 0, 60, 15, 14, 1, 79, 11, 253, 127, 52, 11, 0, 0, 
+41, 12, 1, 0, 18, 13, 10, 0, 41, 14, 1, 0, 77, 12, 7, 128, 
+21, 16, 11, 0, 22, 16, 0, 16, 56, 17, 15, 1, 39, 18, 10, 0, 
+38, 17, 18, 17, 60, 17, 16, 11, 79, 12, 249, 127, 21, 12, 11, 0, 
+22, 12, 0, 12, 39, 13, 11, 0, 60, 13, 12, 11, 21, 12, 11, 0, 
+22, 12, 0, 12, 18, 15, 7, 0, 57, 13, 12, 7, 66, 13, 2, 2, 
+60, 13, 12, 11, 21, 12, 0, 0, 22, 12, 0, 12, 53, 13, 13, 0, 
+45, 14, 0, 0, 18, 16, 11, 0, 66, 14, 2, 2, 61, 14, 14, 13, 
+61, 6, 15, 13, 60, 13, 12, 0, 54, 12, 4, 0, 57, 12, 16, 12, 
+3, 6, 12, 0, 88, 12, 1, 128, 21, 2, 0, 0, 69, 6, 3, 3, 
+82, 6, 196, 127, 21, 3, 0, 0, 9, 3, 1, 0, 88, 3, 6, 128, 
+54, 3, 17, 0, 39, 5, 18, 0, 39, 6, 19, 0, 66, 3, 3, 1, 
+43, 3, 1, 0, 76, 3, 2, 0, 45, 3, 1, 0, 18, 5, 0, 0, 
+18, 6, 2, 0, 66, 3, 3, 2, 54, 4, 20, 0, 66, 4, 1, 1, 
+15, 0, 3, 0, 88, 4, 12, 128, 54, 4, 4, 0, 56, 5, 3, 0, 
+57, 5, 15, 5, 61, 5, 16, 4, 54, 4, 4, 0, 41, 5, 1, 0, 
+61, 5, 21, 4, 54, 4, 4, 0, 41, 5, 1, 0, 61, 5, 22, 4, 
+43, 4, 2, 0, 76, 4, 2, 0, 43, 4, 1, 0, 76, 4, 2, 0, 
+1, 192, 2, 192, 7, 99, 111, 7, 99, 119, 16, 81, 117, 101, 117, 101, 
+82, 101, 100, 114, 97, 119, 89, 89, 111, 117, 32, 109, 117, 115, 116, 32, 
+104, 97, 118, 101, 32, 115, 111, 109, 101, 32, 104, 101, 97, 100, 105, 110, 
+103, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 115, 32, 105, 110, 32, 
+121, 111, 117, 114, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 116, 111, 
+32, 117, 115, 101, 32, 116, 104, 101, 32, 116, 97, 98, 108, 101, 32, 111, 
+102, 32, 99, 111, 110, 116, 101, 110, 116, 115, 46, 26, 78, 111, 32, 99, 
+111, 110, 116, 101, 110, 116, 115, 32, 97, 118, 97, 105, 108, 97, 98, 108, 
+101, 17, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 7, 99, 
+112, 10, 112, 97, 114, 97, 110, 10, 108, 97, 98, 101, 108, 1, 0, 2, 
+10, 108, 97, 98, 101, 108, 0, 10, 112, 97, 114, 97, 110, 0, 13, 97, 
+115, 83, 116, 114, 105, 110, 103, 6, 32, 6, 46, 13, 116, 111, 110, 117, 
+109, 98, 101, 114, 12, 94, 72, 40, 37, 100, 41, 36, 9, 102, 105, 110, 
+100, 9, 110, 97, 109, 101, 10, 115, 116, 121, 108, 101, 13, 68, 111, 99, 
+117, 109, 101, 110, 116, 11, 105, 112, 97, 105, 114, 115, 1, 5, 0, 0, 
+3, 0, 3, 0, 3, 0, 3, 0, 25, 83, 99, 97, 110, 110, 105, 110, 
+103, 32, 100, 111, 99, 117, 109, 101, 110, 116, 46, 46, 46, 21, 73, 109, 
+109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 2, 0, 
+82, 3, 0, 5, 0, 8, 0, 10, 54, 0, 0, 0, 57, 0, 1, 0, 
+54, 1, 2, 0, 57, 1, 3, 1, 51, 2, 4, 0, 54, 3, 5, 0, 
+51, 4, 7, 0, 61, 4, 6, 3, 50, 0, 0, 128, 75, 0, 1, 0, 
+0, 9, 71, 111, 116, 111, 8, 67, 109, 100, 0, 11, 99, 111, 110, 99, 
+97, 116, 10, 116, 97, 98, 108, 101, 8, 114, 101, 112, 11, 115, 116, 114, 
+105, 110, 103, 0, 
+};
+
+/* This is src/lua/addons/autosave.lua */
+static const char file_28[] = {
+27, 76, 74, 2, 10, 238, 1, 0, 0, 11, 0, 13, 0, 23, 54, 0, 
+0, 0, 57, 0, 1, 0, 57, 0, 2, 0, 57, 1, 3, 0, 15, 0, 
+1, 0, 88, 2, 13, 128, 54, 1, 4, 0, 39, 3, 5, 0, 57, 4, 
+6, 0, 39, 5, 7, 0, 54, 6, 8, 0, 57, 8, 6, 0, 39, 9, 
+9, 0, 39, 10, 10, 0, 66, 6, 4, 2, 39, 7, 11, 0, 38, 3, 
+7, 3, 66, 1, 2, 1, 88, 1, 3, 128, 54, 1, 4, 0, 39, 3, 
+12, 0, 66, 1, 2, 1, 75, 0, 1, 0, 26, 65, 117, 116, 111, 115, 
+97, 118, 101, 32, 105, 115, 32, 100, 105, 115, 97, 98, 108, 101, 100, 46, 
+6, 46, 6, 115, 5, 14, 80, 108, 117, 114, 97, 108, 105, 115, 101, 12, 
+32, 109, 105, 110, 117, 116, 101, 11, 112, 101, 114, 105, 111, 100, 39, 65, 
+117, 116, 111, 115, 97, 118, 101, 32, 105, 115, 32, 101, 110, 97, 98, 108, 
+101, 100, 46, 32, 78, 101, 120, 116, 32, 115, 97, 118, 101, 32, 105, 110, 
+32, 20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 
+101, 12, 101, 110, 97, 98, 108, 101, 100, 13, 97, 117, 116, 111, 115, 97, 
+118, 101, 11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 252, 1, 0, 1, 8, 0, 12, 0, 43, 54, 1, 
+0, 0, 57, 1, 1, 1, 18, 4, 1, 0, 57, 2, 2, 1, 39, 5, 
+3, 0, 39, 6, 4, 0, 66, 2, 4, 2, 18, 1, 2, 0, 18, 4, 
+1, 0, 57, 2, 2, 1, 39, 5, 5, 0, 39, 6, 6, 0, 66, 2, 
+4, 2, 18, 1, 2, 0, 54, 2, 7, 0, 57, 2, 8, 2, 39, 4, 
+9, 0, 66, 2, 2, 2, 18, 5, 2, 0, 57, 3, 2, 2, 39, 6, 
+5, 0, 39, 7, 6, 0, 66, 3, 4, 2, 18, 2, 3, 0, 18, 5, 
+0, 0, 57, 3, 2, 0, 39, 6, 10, 0, 18, 7, 1, 0, 66, 3, 
+4, 2, 18, 0, 3, 0, 18, 5, 0, 0, 57, 3, 2, 0, 39, 6, 
+11, 0, 18, 7, 2, 0, 66, 3, 4, 2, 18, 0, 3, 0, 18, 5, 
+0, 0, 57, 3, 2, 0, 39, 6, 6, 0, 39, 7, 5, 0, 66, 3, 
+4, 2, 18, 0, 3, 0, 76, 0, 2, 0, 11, 37, 37, 91, 116, 84, 
+93, 11, 37, 37, 91, 102, 70, 93, 18, 37, 89, 45, 37, 109, 45, 37, 
+100, 46, 37, 72, 37, 77, 9, 100, 97, 116, 101, 7, 111, 115, 9, 37, 
+37, 37, 37, 7, 37, 37, 5, 10, 37, 46, 119, 103, 36, 9, 103, 115, 
+117, 98, 9, 110, 97, 109, 101, 16, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 234, 3, 0, 0, 9, 1, 19, 1, 61, 54, 0, 0, 0, 
+57, 0, 1, 0, 57, 0, 2, 0, 57, 1, 3, 0, 15, 0, 1, 0, 
+88, 1, 4, 128, 54, 1, 0, 0, 57, 1, 4, 1, 14, 0, 1, 0, 
+88, 1, 1, 128, 75, 0, 1, 0, 57, 1, 5, 0, 14, 0, 1, 0, 
+88, 1, 4, 128, 54, 1, 6, 0, 57, 1, 7, 1, 66, 1, 1, 2, 
+61, 1, 5, 0, 54, 1, 6, 0, 57, 1, 7, 1, 66, 1, 1, 2, 
+57, 2, 5, 0, 33, 1, 2, 1, 57, 2, 8, 0, 24, 2, 0, 2, 
+1, 2, 1, 0, 88, 1, 33, 128, 54, 1, 9, 0, 39, 3, 10, 0, 
+66, 1, 2, 1, 45, 1, 0, 0, 57, 3, 11, 0, 66, 1, 2, 2, 
+43, 2, 1, 0, 61, 2, 3, 0, 54, 2, 12, 0, 18, 4, 1, 0, 
+66, 2, 2, 3, 43, 4, 2, 0, 61, 4, 3, 0, 14, 0, 2, 0, 
+88, 4, 7, 128, 54, 4, 13, 0, 39, 6, 14, 0, 39, 7, 15, 0, 
+18, 8, 3, 0, 38, 7, 8, 7, 66, 4, 3, 1, 88, 4, 7, 128, 
+54, 4, 16, 0, 39, 6, 17, 0, 18, 7, 1, 0, 38, 6, 7, 6, 
+66, 4, 2, 1, 54, 4, 18, 0, 66, 4, 1, 1, 54, 4, 6, 0, 
+57, 4, 7, 4, 66, 4, 1, 2, 61, 4, 5, 0, 75, 0, 1, 0, 
+1, 192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 18, 65, 
+117, 116, 111, 115, 97, 118, 101, 100, 32, 97, 115, 32, 20, 78, 111, 110, 
+109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 42, 84, 104, 101, 
+32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 99, 111, 117, 108, 100, 32, 
+110, 111, 116, 32, 98, 101, 32, 97, 117, 116, 111, 115, 97, 118, 101, 100, 
+58, 32, 20, 65, 117, 116, 111, 115, 97, 118, 101, 32, 102, 97, 105, 108, 
+101, 100, 17, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 23, 
+83, 97, 118, 101, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 82, 
+97, 119, 12, 112, 97, 116, 116, 101, 114, 110, 18, 65, 117, 116, 111, 115, 
+97, 118, 105, 110, 103, 46, 46, 46, 21, 73, 109, 109, 101, 100, 105, 97, 
+116, 101, 77, 101, 115, 115, 97, 103, 101, 11, 112, 101, 114, 105, 111, 100, 
+9, 116, 105, 109, 101, 7, 111, 115, 14, 108, 97, 115, 116, 115, 97, 118, 
+101, 100, 12, 99, 104, 97, 110, 103, 101, 100, 12, 101, 110, 97, 98, 108, 
+101, 100, 13, 97, 117, 116, 111, 115, 97, 118, 101, 11, 97, 100, 100, 111, 
+110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 120, 115, 
+0, 0, 2, 1, 4, 0, 17, 54, 0, 0, 0, 57, 0, 1, 0, 54, 
+1, 0, 0, 57, 1, 1, 1, 57, 1, 2, 1, 14, 0, 1, 0, 88, 
+2, 1, 128, 52, 1, 0, 0, 61, 1, 2, 0, 54, 0, 0, 0, 57, 
+0, 1, 0, 57, 0, 2, 0, 43, 1, 0, 0, 61, 1, 3, 0, 45, 
+0, 0, 0, 66, 0, 1, 1, 75, 0, 1, 0, 0, 192, 14, 108, 97, 
+115, 116, 115, 97, 118, 101, 100, 13, 97, 117, 116, 111, 115, 97, 118, 101, 
+11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 122, 0, 0, 2, 0, 4, 0, 10, 54, 0, 0, 0, 57, 
+0, 1, 0, 54, 1, 0, 0, 57, 1, 1, 1, 57, 1, 2, 1, 14, 
+0, 1, 0, 88, 2, 1, 128, 53, 1, 3, 0, 61, 1, 2, 0, 75, 
+0, 1, 0, 1, 0, 3, 11, 112, 101, 114, 105, 111, 100, 3, 10, 12, 
+112, 97, 116, 116, 101, 114, 110, 22, 37, 70, 46, 97, 117, 116, 111, 115, 
+97, 118, 101, 46, 37, 84, 46, 119, 103, 12, 101, 110, 97, 98, 108, 101, 
+100, 1, 13, 97, 117, 116, 111, 115, 97, 118, 101, 11, 97, 100, 100, 111, 
+110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 131, 1, 
+0, 1, 6, 2, 6, 0, 20, 57, 1, 0, 0, 57, 1, 1, 1, 18, 
+3, 0, 0, 66, 1, 2, 1, 54, 1, 2, 0, 45, 3, 0, 0, 57, 
+5, 3, 0, 66, 3, 2, 0, 65, 1, 0, 2, 45, 2, 1, 0, 39, 
+3, 4, 0, 18, 4, 1, 0, 39, 5, 5, 0, 38, 3, 5, 3, 61, 
+3, 3, 2, 45, 2, 1, 0, 18, 4, 2, 0, 57, 2, 1, 2, 66, 
+2, 2, 1, 75, 0, 1, 0, 0, 0, 3, 192, 6, 41, 16, 40, 101, 
+46, 103, 46, 58, 32, 46, 46, 46, 47, 10, 118, 97, 108, 117, 101, 13, 
+76, 101, 97, 102, 110, 97, 109, 101, 9, 100, 114, 97, 119, 10, 99, 108, 
+97, 115, 115, 153, 12, 1, 0, 15, 2, 45, 1, 132, 1, 54, 0, 0, 
+0, 57, 0, 1, 0, 57, 0, 2, 0, 54, 1, 0, 0, 57, 1, 3, 
+1, 14, 0, 1, 0, 88, 1, 9, 128, 54, 1, 4, 0, 39, 3, 5, 
+0, 39, 4, 6, 0, 39, 5, 7, 0, 39, 6, 8, 0, 38, 4, 6, 
+4, 66, 1, 3, 1, 43, 1, 1, 0, 50, 0, 115, 128, 54, 1, 9, 
+0, 57, 1, 10, 1, 53, 3, 11, 0, 57, 4, 12, 0, 61, 4, 13, 
+3, 66, 1, 2, 2, 54, 2, 9, 0, 57, 2, 14, 2, 53, 4, 15, 
+0, 54, 5, 16, 0, 57, 7, 17, 0, 66, 5, 2, 2, 61, 5, 13, 
+4, 66, 2, 2, 2, 54, 3, 9, 0, 57, 3, 18, 3, 53, 5, 19, 
+0, 66, 3, 2, 2, 54, 4, 9, 0, 57, 4, 14, 4, 53, 6, 20, 
+0, 57, 7, 21, 0, 61, 7, 13, 6, 51, 7, 22, 0, 61, 7, 23, 
+6, 66, 4, 2, 2, 53, 5, 24, 0, 54, 6, 9, 0, 57, 6, 25, 
+6, 61, 6, 26, 5, 62, 1, 1, 5, 54, 6, 9, 0, 57, 6, 18, 
+6, 53, 8, 27, 0, 54, 9, 9, 0, 57, 9, 28, 9, 61, 9, 29, 
+8, 66, 6, 2, 2, 62, 6, 2, 5, 62, 2, 3, 5, 54, 6, 9, 
+0, 57, 6, 18, 6, 53, 8, 30, 0, 54, 9, 9, 0, 57, 9, 28, 
+9, 61, 9, 29, 8, 66, 6, 2, 2, 62, 6, 4, 5, 62, 4, 5, 
+5, 62, 3, 6, 5, 85, 6, 61, 128, 54, 6, 9, 0, 57, 6, 31, 
+6, 18, 8, 5, 0, 54, 9, 32, 0, 39, 10, 33, 0, 66, 6, 4, 
+2, 14, 0, 6, 0, 88, 7, 3, 128, 43, 7, 1, 0, 50, 0, 0, 
+128, 76, 7, 2, 0, 57, 7, 13, 1, 54, 8, 34, 0, 57, 10, 13, 
+2, 66, 8, 2, 2, 57, 9, 13, 4, 14, 0, 8, 0, 88, 10, 5, 
+128, 54, 10, 4, 0, 39, 12, 35, 0, 39, 13, 36, 0, 66, 10, 3, 
+1, 88, 10, 232, 127, 18, 12, 9, 0, 57, 10, 37, 9, 66, 10, 2, 
+2, 9, 10, 0, 0, 88, 10, 5, 128, 54, 10, 4, 0, 39, 12, 35, 
+0, 39, 13, 38, 0, 66, 10, 3, 1, 88, 10, 222, 127, 18, 12, 9, 
+0, 57, 10, 39, 9, 39, 13, 40, 0, 66, 10, 3, 2, 15, 0, 10, 
+0, 88, 11, 7, 128, 54, 10, 4, 0, 39, 12, 35, 0, 39, 13, 41, 
+0, 39, 14, 42, 0, 38, 13, 14, 13, 66, 10, 3, 1, 88, 10, 209, 
+127, 61, 7, 12, 0, 61, 8, 17, 0, 61, 9, 21, 0, 43, 10, 0, 
+0, 61, 10, 43, 0, 54, 10, 0, 0, 18, 12, 10, 0, 57, 10, 44, 
+10, 66, 10, 2, 1, 45, 10, 1, 0, 66, 10, 1, 1, 43, 10, 2, 
+0, 50, 0, 0, 128, 76, 10, 2, 0, 88, 6, 194, 127, 43, 6, 1, 
+0, 50, 0, 0, 128, 76, 6, 2, 0, 76, 1, 2, 0, 1, 192, 0, 
+192, 10, 116, 111, 117, 99, 104, 14, 108, 97, 115, 116, 115, 97, 118, 101, 
+100, 25, 37, 37, 44, 32, 37, 70, 32, 111, 114, 32, 37, 84, 32, 102, 
+105, 101, 108, 100, 115, 46, 43, 84, 104, 101, 32, 102, 105, 108, 101, 110, 
+97, 109, 101, 32, 112, 97, 116, 116, 101, 114, 110, 32, 99, 97, 110, 32, 
+111, 110, 108, 121, 32, 99, 111, 110, 116, 97, 105, 110, 32, 16, 37, 37, 
+91, 94, 37, 37, 102, 116, 70, 84, 93, 9, 102, 105, 110, 100, 42, 84, 
+104, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 112, 97, 116, 116, 
+101, 114, 110, 32, 99, 97, 110, 110, 111, 116, 32, 98, 101, 32, 101, 109, 
+112, 116, 121, 46, 8, 108, 101, 110, 45, 84, 104, 101, 32, 112, 101, 114, 
+105, 111, 100, 32, 102, 105, 101, 108, 100, 32, 109, 117, 115, 116, 32, 98, 
+101, 32, 97, 32, 118, 97, 108, 105, 100, 32, 110, 117, 109, 98, 101, 114, 
+46, 20, 80, 97, 114, 97, 109, 101, 116, 101, 114, 32, 101, 114, 114, 111, 
+114, 13, 116, 111, 110, 117, 109, 98, 101, 114, 57, 83, 80, 65, 67, 69, 
+32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 84, 85, 
+82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 
+84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 17, 
+82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 8, 82, 117, 110, 
+1, 0, 6, 10, 118, 97, 108, 117, 101, 31, 65, 117, 116, 111, 115, 97, 
+118, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 112, 97, 116, 116, 
+101, 114, 110, 58, 7, 121, 50, 3, 5, 7, 120, 50, 3, 32, 7, 121, 
+49, 3, 5, 7, 120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 10, 
+97, 108, 105, 103, 110, 9, 76, 101, 102, 116, 1, 0, 6, 10, 118, 97, 
+108, 117, 101, 36, 80, 101, 114, 105, 111, 100, 32, 98, 101, 116, 119, 101, 
+101, 110, 32, 115, 97, 118, 101, 115, 32, 40, 109, 105, 110, 117, 116, 101, 
+115, 41, 58, 7, 121, 50, 3, 3, 7, 120, 50, 3, 32, 7, 121, 49, 
+3, 3, 7, 120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 10, 119, 
+105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 1, 0, 7, 14, 75, 69, 
+89, 95, 69, 78, 84, 69, 82, 12, 99, 111, 110, 102, 105, 114, 109, 11, 
+75, 69, 89, 95, 94, 67, 11, 99, 97, 110, 99, 101, 108, 13, 115, 116, 
+114, 101, 116, 99, 104, 121, 1, 11, 104, 101, 105, 103, 104, 116, 3, 9, 
+15, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 12, 99, 111, 110, 102, 
+105, 114, 109, 10, 119, 105, 100, 116, 104, 0, 10, 116, 105, 116, 108, 101, 
+23, 67, 111, 110, 102, 105, 103, 117, 114, 101, 32, 65, 117, 116, 111, 115, 
+97, 118, 101, 9, 100, 114, 97, 119, 0, 12, 112, 97, 116, 116, 101, 114, 
+110, 1, 0, 6, 10, 118, 97, 108, 117, 101, 0, 9, 100, 114, 97, 119, 
+0, 7, 121, 50, 3, 5, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 
+121, 49, 3, 5, 7, 120, 49, 3, 33, 1, 0, 5, 10, 118, 97, 108, 
+117, 101, 59, 40, 69, 120, 97, 109, 112, 108, 101, 32, 102, 105, 108, 101, 
+110, 97, 109, 101, 58, 32, 82, 69, 65, 68, 77, 69, 46, 97, 117, 116, 
+111, 115, 97, 118, 101, 46, 50, 48, 48, 56, 45, 48, 56, 45, 48, 55, 
+46, 49, 56, 50, 57, 46, 119, 103, 41, 7, 121, 50, 3, 7, 7, 120, 
+50, 3, 255, 255, 255, 255, 15, 7, 121, 49, 3, 7, 7, 120, 49, 3, 
+1, 10, 76, 97, 98, 101, 108, 11, 112, 101, 114, 105, 111, 100, 13, 116, 
+111, 115, 116, 114, 105, 110, 103, 1, 0, 5, 10, 118, 97, 108, 117, 101, 
+0, 7, 121, 50, 3, 3, 7, 120, 50, 3, 43, 7, 121, 49, 3, 3, 
+7, 120, 49, 3, 33, 14, 84, 101, 120, 116, 70, 105, 101, 108, 100, 10, 
+118, 97, 108, 117, 101, 12, 101, 110, 97, 98, 108, 101, 100, 1, 0, 6, 
+10, 108, 97, 98, 101, 108, 22, 69, 110, 97, 98, 108, 101, 32, 97, 117, 
+116, 111, 115, 97, 118, 105, 110, 103, 10, 118, 97, 108, 117, 101, 0, 7, 
+121, 50, 3, 1, 7, 120, 50, 3, 33, 7, 121, 49, 3, 1, 7, 120, 
+49, 3, 1, 13, 67, 104, 101, 99, 107, 98, 111, 120, 9, 70, 111, 114, 
+109, 54, 115, 111, 32, 116, 104, 97, 116, 32, 65, 117, 116, 111, 115, 97, 
+118, 101, 32, 107, 110, 111, 119, 115, 32, 119, 104, 97, 116, 32, 98, 97, 
+115, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 116, 111, 32, 117, 
+115, 101, 46, 64, 117, 110, 116, 105, 108, 32, 121, 111, 117, 32, 104, 97, 
+118, 101, 32, 109, 97, 110, 117, 97, 108, 108, 121, 32, 115, 97, 118, 101, 
+100, 32, 121, 111, 117, 114, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 
+97, 116, 32, 108, 101, 97, 115, 116, 32, 111, 110, 99, 101, 44, 32, 29, 
+89, 111, 117, 32, 99, 97, 110, 110, 111, 116, 32, 117, 115, 101, 32, 97, 
+117, 116, 111, 115, 97, 118, 101, 32, 27, 65, 117, 116, 111, 115, 97, 118, 
+101, 32, 110, 111, 116, 32, 97, 118, 97, 105, 108, 97, 98, 108, 101, 17, 
+77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 9, 110, 97, 109, 
+101, 13, 97, 117, 116, 111, 115, 97, 118, 101, 11, 97, 100, 100, 111, 110, 
+115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 0, 193, 1, 
+3, 0, 7, 0, 13, 0, 25, 51, 0, 0, 0, 51, 1, 1, 0, 51, 
+2, 2, 0, 54, 3, 3, 0, 54, 5, 4, 0, 57, 5, 5, 5, 18, 
+6, 2, 0, 66, 3, 3, 1, 51, 2, 6, 0, 54, 3, 3, 0, 54, 
+5, 4, 0, 57, 5, 7, 5, 18, 6, 2, 0, 66, 3, 3, 1, 51, 
+2, 8, 0, 54, 3, 3, 0, 54, 5, 4, 0, 57, 5, 9, 5, 18, 
+6, 2, 0, 66, 3, 3, 1, 54, 2, 10, 0, 51, 3, 12, 0, 61, 
+3, 11, 2, 50, 0, 0, 128, 75, 0, 1, 0, 0, 22, 67, 111, 110, 
+102, 105, 103, 117, 114, 101, 65, 117, 116, 111, 115, 97, 118, 101, 8, 67, 
+109, 100, 19, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 
+115, 0, 19, 68, 111, 99, 117, 109, 101, 110, 116, 76, 111, 97, 100, 101, 
+100, 0, 9, 73, 100, 108, 101, 10, 69, 118, 101, 110, 116, 21, 65, 100, 
+100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 0, 
+0, 0, 
+};
+
+/* This is src/lua/addons/docsetman.lua */
+static const char file_29[] = {
+27, 76, 74, 2, 10, 154, 3, 0, 1, 6, 0, 13, 0, 40, 14, 0, 
+0, 0, 88, 1, 11, 128, 54, 1, 0, 0, 39, 3, 1, 0, 39, 4, 
+2, 0, 66, 1, 3, 2, 18, 0, 1, 0, 15, 0, 0, 0, 88, 1, 
+2, 128, 7, 0, 3, 0, 88, 1, 2, 128, 43, 1, 1, 0, 76, 1, 
+2, 0, 54, 1, 4, 0, 57, 1, 5, 1, 56, 1, 0, 1, 15, 0, 
+1, 0, 88, 2, 6, 128, 54, 1, 6, 0, 39, 3, 7, 0, 39, 4, 
+8, 0, 66, 1, 3, 1, 43, 1, 1, 0, 76, 1, 2, 0, 54, 1, 
+4, 0, 18, 3, 1, 0, 57, 1, 9, 1, 54, 4, 10, 0, 66, 4, 
+1, 2, 18, 5, 0, 0, 66, 1, 4, 1, 54, 1, 4, 0, 18, 3, 
+1, 0, 57, 1, 11, 1, 18, 4, 0, 0, 66, 1, 3, 1, 54, 1, 
+12, 0, 66, 1, 1, 1, 43, 1, 2, 0, 76, 1, 2, 0, 16, 81, 
+117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 15, 115, 101, 116, 67, 117, 
+114, 114, 101, 110, 116, 19, 67, 114, 101, 97, 116, 101, 68, 111, 99, 117, 
+109, 101, 110, 116, 16, 97, 100, 100, 68, 111, 99, 117, 109, 101, 110, 116, 
+75, 83, 111, 114, 114, 121, 33, 32, 84, 104, 101, 114, 101, 39, 115, 32, 
+97, 108, 114, 101, 97, 100, 121, 32, 97, 32, 100, 111, 99, 117, 109, 101, 
+110, 116, 32, 119, 105, 116, 104, 32, 116, 104, 97, 116, 32, 110, 97, 109, 
+101, 32, 105, 110, 32, 116, 104, 105, 115, 32, 100, 111, 99, 117, 109, 101, 
+110, 116, 32, 115, 101, 116, 46, 16, 78, 97, 109, 101, 32, 105, 110, 32, 
+117, 115, 101, 17, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 
+14, 100, 111, 99, 117, 109, 101, 110, 116, 115, 16, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 5, 40, 80, 108, 101, 97, 115, 101, 32, 101, 
+110, 116, 101, 114, 32, 116, 104, 101, 32, 110, 101, 119, 32, 100, 111, 99, 
+117, 109, 101, 110, 116, 32, 110, 97, 109, 101, 58, 26, 78, 97, 109, 101, 
+32, 111, 102, 32, 110, 101, 119, 32, 100, 111, 99, 117, 109, 101, 110, 116, 
+63, 20, 80, 114, 111, 109, 112, 116, 70, 111, 114, 83, 116, 114, 105, 110, 
+103, 99, 0, 1, 5, 0, 7, 0, 10, 54, 1, 0, 0, 57, 1, 1, 
+1, 57, 3, 2, 0, 57, 4, 3, 0, 56, 3, 4, 3, 57, 3, 4, 
+3, 57, 3, 5, 3, 66, 1, 2, 1, 39, 1, 6, 0, 76, 1, 2, 
+0, 11, 114, 101, 100, 114, 97, 119, 9, 110, 97, 109, 101, 13, 100, 111, 
+99, 117, 109, 101, 110, 116, 11, 99, 117, 114, 115, 111, 114, 9, 100, 97, 
+116, 97, 19, 67, 104, 97, 110, 103, 101, 68, 111, 99, 117, 109, 101, 110, 
+116, 8, 67, 109, 100, 192, 1, 0, 0, 6, 1, 8, 1, 28, 45, 0, 
+0, 0, 57, 0, 0, 0, 41, 1, 1, 0, 1, 1, 0, 0, 88, 0, 
+21, 128, 45, 0, 0, 0, 57, 0, 1, 0, 45, 1, 0, 0, 57, 1, 
+0, 1, 56, 0, 1, 0, 57, 0, 2, 0, 54, 1, 3, 0, 18, 3, 
+1, 0, 57, 1, 4, 1, 57, 4, 5, 0, 45, 5, 0, 0, 57, 5, 
+0, 5, 23, 5, 0, 5, 66, 1, 4, 1, 45, 1, 0, 0, 45, 2, 
+0, 0, 57, 2, 0, 2, 23, 2, 0, 2, 61, 2, 0, 1, 39, 1, 
+6, 0, 76, 1, 2, 0, 39, 0, 7, 0, 76, 0, 2, 0, 0, 192, 
+8, 110, 111, 112, 12, 99, 111, 110, 102, 105, 114, 109, 9, 110, 97, 109, 
+101, 24, 109, 111, 118, 101, 68, 111, 99, 117, 109, 101, 110, 116, 73, 110, 
+100, 101, 120, 84, 111, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 
+116, 13, 100, 111, 99, 117, 109, 101, 110, 116, 9, 100, 97, 116, 97, 11, 
+99, 117, 114, 115, 111, 114, 2, 180, 1, 0, 0, 5, 1, 8, 1, 25, 
+45, 0, 0, 0, 57, 0, 0, 0, 45, 1, 0, 0, 57, 1, 1, 1, 
+21, 1, 1, 0, 1, 0, 1, 0, 88, 0, 16, 128, 54, 0, 2, 0, 
+18, 2, 0, 0, 57, 0, 3, 0, 54, 3, 4, 0, 57, 3, 5, 3, 
+45, 4, 0, 0, 57, 4, 0, 4, 22, 4, 0, 4, 66, 0, 4, 1, 
+45, 0, 0, 0, 45, 1, 0, 0, 57, 1, 0, 1, 22, 1, 0, 1, 
+61, 1, 0, 0, 39, 0, 6, 0, 76, 0, 2, 0, 39, 0, 7, 0, 
+76, 0, 2, 0, 0, 192, 8, 110, 111, 112, 12, 99, 111, 110, 102, 105, 
+114, 109, 9, 110, 97, 109, 101, 13, 68, 111, 99, 117, 109, 101, 110, 116, 
+24, 109, 111, 118, 101, 68, 111, 99, 117, 109, 101, 110, 116, 73, 110, 100, 
+101, 120, 84, 111, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+9, 100, 97, 116, 97, 11, 99, 117, 114, 115, 111, 114, 2, 232, 2, 0, 
+0, 6, 0, 11, 0, 31, 54, 0, 0, 0, 39, 2, 1, 0, 39, 3, 
+2, 0, 54, 4, 3, 0, 57, 4, 4, 4, 66, 0, 4, 2, 15, 0, 
+0, 0, 88, 1, 4, 128, 54, 1, 3, 0, 57, 1, 4, 1, 5, 0, 
+1, 0, 88, 1, 2, 128, 39, 1, 5, 0, 76, 1, 2, 0, 54, 1, 
+6, 0, 18, 3, 1, 0, 57, 1, 7, 1, 54, 4, 3, 0, 57, 4, 
+4, 4, 18, 5, 0, 0, 66, 1, 4, 2, 14, 0, 1, 0, 88, 1, 
+6, 128, 54, 1, 8, 0, 39, 3, 9, 0, 39, 4, 10, 0, 66, 1, 
+3, 1, 39, 1, 5, 0, 76, 1, 2, 0, 39, 1, 5, 0, 76, 1, 
+2, 0, 75, 83, 111, 114, 114, 121, 33, 32, 84, 104, 101, 114, 101, 39, 
+115, 32, 97, 108, 114, 101, 97, 100, 121, 32, 97, 32, 100, 111, 99, 117, 
+109, 101, 110, 116, 32, 119, 105, 116, 104, 32, 116, 104, 97, 116, 32, 110, 
+97, 109, 101, 32, 105, 110, 32, 116, 104, 105, 115, 32, 100, 111, 99, 117, 
+109, 101, 110, 116, 32, 115, 101, 116, 46, 16, 78, 97, 109, 101, 32, 105, 
+110, 32, 117, 115, 101, 17, 77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 
+103, 101, 19, 114, 101, 110, 97, 109, 101, 68, 111, 99, 117, 109, 101, 110, 
+116, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 12, 99, 111, 
+110, 102, 105, 114, 109, 9, 110, 97, 109, 101, 13, 68, 111, 99, 117, 109, 
+101, 110, 116, 40, 80, 108, 101, 97, 115, 101, 32, 101, 110, 116, 101, 114, 
+32, 116, 104, 101, 32, 110, 101, 119, 32, 100, 111, 99, 117, 109, 101, 110, 
+116, 32, 110, 97, 109, 101, 58, 36, 67, 104, 97, 110, 103, 101, 32, 110, 
+97, 109, 101, 32, 111, 102, 32, 99, 117, 114, 114, 101, 110, 116, 32, 100, 
+111, 99, 117, 109, 101, 110, 116, 20, 80, 114, 111, 109, 112, 116, 70, 111, 
+114, 83, 116, 114, 105, 110, 103, 128, 4, 0, 0, 6, 1, 14, 1, 39, 
+45, 0, 0, 0, 57, 0, 0, 0, 21, 0, 0, 0, 9, 0, 0, 0, 
+88, 0, 6, 128, 54, 0, 1, 0, 39, 2, 2, 0, 39, 3, 3, 0, 
+66, 0, 3, 1, 39, 0, 4, 0, 76, 0, 2, 0, 54, 0, 5, 0, 
+39, 2, 6, 0, 39, 3, 7, 0, 54, 4, 8, 0, 57, 4, 9, 4, 
+39, 5, 10, 0, 38, 3, 5, 3, 66, 0, 3, 2, 14, 0, 0, 0, 
+88, 0, 2, 128, 43, 0, 1, 0, 76, 0, 2, 0, 54, 0, 11, 0, 
+18, 2, 0, 0, 57, 0, 12, 0, 54, 3, 8, 0, 57, 3, 9, 3, 
+66, 0, 3, 2, 14, 0, 0, 0, 88, 0, 6, 128, 54, 0, 1, 0, 
+39, 2, 2, 0, 39, 3, 13, 0, 66, 0, 3, 1, 39, 0, 4, 0, 
+76, 0, 2, 0, 39, 0, 4, 0, 76, 0, 2, 0, 0, 192, 36, 89, 
+111, 117, 32, 99, 97, 110, 39, 116, 32, 100, 101, 108, 101, 116, 101, 32, 
+116, 104, 97, 116, 32, 100, 111, 99, 117, 109, 101, 110, 116, 46, 19, 100, 
+101, 108, 101, 116, 101, 68, 111, 99, 117, 109, 101, 110, 116, 16, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 83, 39, 63, 32, 73, 116, 32, 
+119, 105, 108, 108, 32, 98, 101, 32, 114, 101, 109, 111, 118, 101, 100, 32, 
+102, 114, 111, 109, 32, 116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 
+32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 44, 32, 97, 
+110, 100, 32, 119, 105, 108, 108, 32, 98, 101, 32, 103, 111, 110, 101, 32, 
+102, 111, 114, 101, 118, 101, 114, 46, 9, 110, 97, 109, 101, 13, 68, 111, 
+99, 117, 109, 101, 110, 116, 51, 65, 114, 101, 32, 121, 111, 117, 32, 115, 
+117, 114, 101, 32, 121, 111, 117, 32, 119, 97, 110, 116, 32, 116, 111, 32, 
+100, 101, 108, 101, 116, 101, 32, 116, 104, 101, 32, 100, 111, 99, 117, 109, 
+101, 110, 116, 32, 39, 26, 68, 101, 108, 101, 116, 101, 32, 116, 104, 105, 
+115, 32, 100, 111, 99, 117, 109, 101, 110, 116, 63, 19, 80, 114, 111, 109, 
+112, 116, 70, 111, 114, 89, 101, 115, 78, 111, 12, 99, 111, 110, 102, 105, 
+114, 109, 62, 89, 111, 117, 32, 99, 97, 110, 39, 116, 32, 100, 101, 108, 
+101, 116, 101, 32, 116, 104, 101, 32, 108, 97, 115, 116, 32, 100, 111, 99, 
+117, 109, 101, 110, 116, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 100, 
+111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 46, 30, 85, 110, 97, 
+98, 108, 101, 32, 116, 111, 32, 100, 101, 108, 101, 116, 101, 32, 100, 111, 
+99, 117, 109, 101, 110, 116, 17, 77, 111, 100, 97, 108, 77, 101, 115, 115, 
+97, 103, 101, 9, 100, 97, 116, 97, 2, 56, 0, 0, 2, 0, 3, 0, 
+5, 54, 0, 0, 0, 57, 0, 1, 0, 66, 0, 1, 1, 39, 0, 2, 
+0, 76, 0, 2, 0, 12, 99, 111, 110, 102, 105, 114, 109, 21, 65, 100, 
+100, 66, 108, 97, 110, 107, 68, 111, 99, 117, 109, 101, 110, 116, 8, 67, 
+109, 100, 180, 8, 1, 0, 11, 0, 39, 0, 88, 54, 0, 0, 0, 57, 
+0, 1, 0, 53, 2, 2, 0, 54, 3, 0, 0, 57, 3, 1, 3, 61, 
+3, 3, 2, 51, 3, 4, 0, 61, 3, 5, 2, 66, 0, 2, 2, 53, 
+1, 6, 0, 54, 2, 0, 0, 57, 2, 7, 2, 61, 2, 8, 1, 54, 
+2, 0, 0, 57, 2, 7, 2, 61, 2, 9, 1, 51, 2, 10, 0, 61, 
+2, 11, 1, 51, 2, 12, 0, 61, 2, 13, 1, 51, 2, 14, 0, 61, 
+2, 15, 1, 51, 2, 16, 0, 61, 2, 17, 1, 51, 2, 18, 0, 61, 
+2, 19, 1, 54, 2, 0, 0, 57, 2, 20, 2, 53, 4, 21, 0, 66, 
+2, 2, 2, 62, 2, 1, 1, 54, 2, 0, 0, 57, 2, 20, 2, 53, 
+4, 22, 0, 66, 2, 2, 2, 62, 2, 2, 1, 54, 2, 0, 0, 57, 
+2, 20, 2, 53, 4, 23, 0, 66, 2, 2, 2, 62, 2, 3, 1, 54, 
+2, 0, 0, 57, 2, 20, 2, 53, 4, 24, 0, 66, 2, 2, 2, 62, 
+2, 4, 1, 62, 0, 5, 1, 85, 2, 38, 128, 52, 2, 0, 0, 43, 
+3, 0, 0, 54, 4, 25, 0, 54, 6, 26, 0, 18, 8, 6, 0, 57, 
+6, 27, 6, 66, 6, 2, 0, 65, 4, 0, 4, 88, 7, 12, 128, 53, 
+9, 28, 0, 61, 8, 29, 9, 57, 10, 30, 8, 14, 0, 10, 0, 88, 
+11, 1, 128, 39, 10, 31, 0, 61, 10, 32, 9, 60, 9, 7, 2, 54, 
+9, 33, 0, 5, 8, 9, 0, 88, 9, 1, 128, 18, 3, 7, 0, 69, 
+7, 3, 3, 82, 7, 242, 127, 61, 2, 34, 0, 61, 3, 35, 0, 54, 
+4, 0, 0, 57, 4, 36, 4, 18, 6, 1, 0, 54, 7, 37, 0, 66, 
+4, 3, 2, 54, 5, 38, 0, 66, 5, 1, 1, 14, 0, 4, 0, 88, 
+5, 221, 127, 43, 5, 2, 0, 50, 0, 0, 128, 76, 5, 2, 0, 88, 
+2, 217, 127, 50, 0, 0, 128, 75, 0, 1, 0, 16, 81, 117, 101, 117, 
+101, 82, 101, 100, 114, 97, 119, 17, 82, 101, 100, 114, 97, 119, 83, 99, 
+114, 101, 101, 110, 8, 82, 117, 110, 11, 99, 117, 114, 115, 111, 114, 9, 
+100, 97, 116, 97, 13, 68, 111, 99, 117, 109, 101, 110, 116, 10, 108, 97, 
+98, 101, 108, 14, 40, 117, 110, 110, 97, 109, 101, 100, 41, 9, 110, 97, 
+109, 101, 13, 100, 111, 99, 117, 109, 101, 110, 116, 1, 0, 2, 10, 108, 
+97, 98, 101, 108, 0, 13, 100, 111, 99, 117, 109, 101, 110, 116, 0, 20, 
+103, 101, 116, 68, 111, 99, 117, 109, 101, 110, 116, 76, 105, 115, 116, 16, 
+68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 11, 105, 112, 97, 105, 
+114, 115, 1, 0, 5, 10, 118, 97, 108, 117, 101, 60, 78, 58, 32, 67, 
+114, 101, 97, 116, 101, 32, 98, 108, 97, 110, 107, 32, 100, 111, 99, 117, 
+109, 101, 110, 116, 32, 32, 32, 32, 32, 82, 69, 84, 85, 82, 78, 44, 
+32, 94, 67, 58, 32, 67, 108, 111, 115, 101, 32, 100, 105, 97, 108, 111, 
+103, 117, 101, 7, 121, 50, 3, 255, 255, 255, 255, 15, 7, 120, 50, 3, 
+255, 255, 255, 255, 15, 7, 121, 49, 3, 255, 255, 255, 255, 15, 7, 120, 
+49, 3, 1, 1, 0, 5, 10, 118, 97, 108, 117, 101, 56, 68, 58, 32, 
+77, 111, 118, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 100, 111, 
+119, 110, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 88, 58, 
+32, 68, 101, 108, 101, 116, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 
+7, 121, 50, 3, 254, 255, 255, 255, 15, 7, 120, 50, 3, 255, 255, 255, 
+255, 15, 7, 121, 49, 3, 254, 255, 255, 255, 15, 7, 120, 49, 3, 1, 
+1, 0, 5, 10, 118, 97, 108, 117, 101, 56, 85, 58, 32, 77, 111, 118, 
+101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 117, 112, 32, 32, 32, 
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 82, 58, 32, 82, 101, 
+110, 97, 109, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 7, 121, 50, 
+3, 253, 255, 255, 255, 15, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 
+121, 49, 3, 253, 255, 255, 255, 15, 7, 120, 49, 3, 1, 1, 0, 5, 
+10, 118, 97, 108, 117, 101, 31, 83, 101, 108, 101, 99, 116, 32, 104, 101, 
+97, 100, 105, 110, 103, 32, 116, 111, 32, 106, 117, 109, 112, 32, 116, 111, 
+58, 7, 121, 50, 3, 1, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 
+121, 49, 3, 1, 7, 120, 49, 3, 1, 10, 76, 97, 98, 101, 108, 6, 
+110, 0, 6, 120, 0, 6, 114, 0, 6, 100, 0, 6, 117, 0, 11, 104, 
+101, 105, 103, 104, 116, 10, 119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 
+101, 1, 0, 12, 6, 114, 0, 11, 75, 69, 89, 95, 94, 67, 11, 99, 
+97, 110, 99, 101, 108, 6, 120, 0, 11, 104, 101, 105, 103, 104, 116, 0, 
+13, 115, 116, 114, 101, 116, 99, 104, 121, 1, 10, 119, 105, 100, 116, 104, 
+0, 6, 100, 0, 10, 116, 105, 116, 108, 101, 21, 68, 111, 99, 117, 109, 
+101, 110, 116, 32, 77, 97, 110, 97, 103, 101, 114, 6, 110, 0, 6, 117, 
+0, 14, 75, 69, 89, 95, 69, 78, 84, 69, 82, 11, 99, 97, 110, 99, 
+101, 108, 15, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 11, 99, 97, 
+110, 99, 101, 108, 12, 99, 104, 97, 110, 103, 101, 100, 0, 9, 116, 121, 
+112, 101, 1, 0, 7, 7, 121, 50, 3, 252, 255, 255, 255, 15, 12, 99, 
+104, 97, 110, 103, 101, 100, 0, 9, 116, 121, 112, 101, 0, 7, 120, 50, 
+3, 255, 255, 255, 255, 15, 7, 121, 49, 3, 2, 7, 120, 49, 3, 1, 
+14, 102, 111, 99, 117, 115, 97, 98, 108, 101, 2, 12, 66, 114, 111, 119, 
+115, 101, 114, 9, 70, 111, 114, 109, 76, 3, 0, 2, 0, 5, 0, 7, 
+54, 0, 0, 0, 51, 1, 2, 0, 61, 1, 1, 0, 54, 0, 0, 0, 
+51, 1, 4, 0, 61, 1, 3, 0, 75, 0, 1, 0, 0, 22, 77, 97, 
+110, 97, 103, 101, 68, 111, 99, 117, 109, 101, 110, 116, 115, 85, 73, 0, 
+21, 65, 100, 100, 66, 108, 97, 110, 107, 68, 111, 99, 117, 109, 101, 110, 
+116, 8, 67, 109, 100, 0, 
+};
+
+/* This is src/lua/addons/scrapbook.lua */
+static const char file_30[] = {
+27, 76, 74, 2, 10, 226, 1, 0, 2, 8, 0, 10, 0, 39, 14, 0, 
+1, 0, 88, 2, 2, 128, 54, 2, 0, 0, 57, 1, 1, 2, 18, 4, 
+1, 0, 57, 2, 2, 1, 39, 5, 3, 0, 39, 6, 4, 0, 66, 2, 
+4, 2, 18, 1, 2, 0, 54, 2, 5, 0, 57, 2, 6, 2, 39, 4, 
+7, 0, 66, 2, 2, 2, 18, 5, 2, 0, 57, 3, 2, 2, 39, 6, 
+3, 0, 39, 7, 4, 0, 66, 3, 4, 2, 18, 2, 3, 0, 18, 5, 
+0, 0, 57, 3, 2, 0, 39, 6, 8, 0, 18, 7, 1, 0, 66, 3, 
+4, 2, 18, 0, 3, 0, 18, 5, 0, 0, 57, 3, 2, 0, 39, 6, 
+9, 0, 18, 7, 2, 0, 66, 3, 4, 2, 18, 0, 3, 0, 18, 5, 
+0, 0, 57, 3, 2, 0, 39, 6, 4, 0, 39, 7, 3, 0, 66, 3, 
+4, 2, 18, 0, 3, 0, 76, 0, 2, 0, 11, 37, 37, 91, 116, 84, 
+93, 11, 37, 37, 91, 110, 78, 93, 18, 37, 89, 45, 37, 109, 45, 37, 
+100, 46, 37, 72, 37, 77, 9, 100, 97, 116, 101, 7, 111, 115, 9, 37, 
+37, 37, 37, 7, 37, 37, 9, 103, 115, 117, 98, 9, 110, 97, 109, 101, 
+13, 68, 111, 99, 117, 109, 101, 110, 116, 162, 1, 0, 0, 3, 0, 7, 
+0, 19, 54, 0, 0, 0, 57, 0, 1, 0, 14, 0, 0, 0, 88, 0, 
+5, 128, 54, 0, 2, 0, 39, 2, 3, 0, 66, 0, 2, 1, 43, 0, 
+1, 0, 76, 0, 2, 0, 54, 0, 4, 0, 57, 0, 5, 0, 66, 0, 
+1, 2, 14, 0, 0, 0, 88, 0, 2, 128, 43, 0, 1, 0, 76, 0, 
+2, 0, 54, 0, 4, 0, 57, 0, 6, 0, 68, 0, 1, 0, 21, 80, 
+97, 115, 116, 101, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 8, 
+67, 117, 116, 8, 67, 109, 100, 30, 84, 104, 101, 114, 101, 39, 115, 32, 
+110, 111, 116, 104, 105, 110, 103, 32, 115, 101, 108, 101, 99, 116, 101, 100, 
+46, 20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 
+101, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 163, 1, 0, 
+0, 3, 0, 7, 0, 19, 54, 0, 0, 0, 57, 0, 1, 0, 14, 0, 
+0, 0, 88, 0, 5, 128, 54, 0, 2, 0, 39, 2, 3, 0, 66, 0, 
+2, 1, 43, 0, 1, 0, 76, 0, 2, 0, 54, 0, 4, 0, 57, 0, 
+5, 0, 66, 0, 1, 2, 14, 0, 0, 0, 88, 0, 2, 128, 43, 0, 
+1, 0, 76, 0, 2, 0, 54, 0, 4, 0, 57, 0, 6, 0, 68, 0, 
+1, 0, 21, 80, 97, 115, 116, 101, 84, 111, 83, 99, 114, 97, 112, 98, 
+111, 111, 107, 9, 67, 111, 112, 121, 8, 67, 109, 100, 30, 84, 104, 101, 
+114, 101, 39, 115, 32, 110, 111, 116, 104, 105, 110, 103, 32, 115, 101, 108, 
+101, 99, 116, 101, 100, 46, 20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 
+101, 115, 115, 97, 103, 101, 7, 109, 112, 13, 68, 111, 99, 117, 109, 101, 
+110, 116, 194, 5, 0, 0, 9, 1, 27, 0, 84, 54, 0, 0, 0, 18, 
+2, 0, 0, 57, 0, 1, 0, 66, 0, 2, 2, 14, 0, 0, 0, 88, 
+1, 5, 128, 54, 1, 2, 0, 39, 3, 3, 0, 66, 1, 2, 1, 43, 
+1, 1, 0, 76, 1, 2, 0, 54, 1, 0, 0, 57, 1, 4, 1, 57, 
+1, 5, 1, 54, 2, 6, 0, 57, 2, 7, 2, 54, 3, 0, 0, 18, 
+5, 3, 0, 57, 3, 8, 3, 57, 6, 9, 1, 66, 3, 3, 2, 14, 
+0, 3, 0, 88, 3, 13, 128, 54, 3, 0, 0, 18, 5, 3, 0, 57, 
+3, 10, 3, 54, 6, 11, 0, 66, 6, 1, 2, 57, 7, 9, 1, 66, 
+3, 4, 1, 54, 3, 2, 0, 39, 5, 12, 0, 57, 6, 9, 1, 39, 
+7, 13, 0, 38, 5, 7, 5, 66, 3, 2, 1, 54, 3, 0, 0, 18, 
+5, 3, 0, 57, 3, 14, 3, 57, 6, 9, 1, 66, 3, 3, 1, 54, 
+3, 15, 0, 57, 3, 16, 3, 66, 3, 1, 1, 54, 3, 15, 0, 57, 
+3, 17, 3, 66, 3, 1, 1, 54, 3, 15, 0, 57, 3, 18, 3, 66, 
+3, 1, 1, 57, 3, 19, 1, 15, 0, 3, 0, 88, 4, 14, 128, 54, 
+3, 15, 0, 57, 3, 20, 3, 45, 5, 0, 0, 57, 7, 21, 1, 18, 
+8, 2, 0, 66, 5, 3, 0, 65, 3, 0, 1, 54, 3, 15, 0, 57, 
+3, 22, 3, 39, 5, 23, 0, 66, 3, 2, 1, 54, 3, 15, 0, 57, 
+3, 18, 3, 66, 3, 1, 1, 54, 3, 15, 0, 57, 3, 22, 3, 39, 
+5, 24, 0, 66, 3, 2, 1, 54, 3, 15, 0, 57, 3, 25, 3, 66, 
+3, 1, 1, 54, 3, 0, 0, 18, 5, 3, 0, 57, 3, 14, 3, 18, 
+6, 2, 0, 66, 3, 3, 1, 54, 3, 2, 0, 39, 5, 26, 0, 66, 
+3, 2, 1, 43, 3, 1, 0, 76, 3, 2, 0, 0, 192, 33, 70, 114, 
+97, 103, 109, 101, 110, 116, 32, 97, 100, 100, 101, 100, 32, 116, 111, 32, 
+115, 99, 114, 97, 112, 98, 111, 111, 107, 46, 10, 80, 97, 115, 116, 101, 
+6, 80, 7, 72, 49, 25, 67, 104, 97, 110, 103, 101, 80, 97, 114, 97, 
+103, 114, 97, 112, 104, 83, 116, 121, 108, 101, 12, 112, 97, 116, 116, 101, 
+114, 110, 30, 73, 110, 115, 101, 114, 116, 83, 116, 114, 105, 110, 103, 73, 
+110, 116, 111, 80, 97, 114, 97, 103, 114, 97, 112, 104, 14, 116, 105, 109, 
+101, 115, 116, 97, 109, 112, 26, 83, 112, 108, 105, 116, 67, 117, 114, 114, 
+101, 110, 116, 80, 97, 114, 97, 103, 114, 97, 112, 104, 14, 85, 110, 115, 
+101, 116, 77, 97, 114, 107, 22, 71, 111, 116, 111, 69, 110, 100, 79, 102, 
+68, 111, 99, 117, 109, 101, 110, 116, 8, 67, 109, 100, 15, 115, 101, 116, 
+67, 117, 114, 114, 101, 110, 116, 7, 39, 46, 37, 67, 114, 101, 97, 116, 
+105, 110, 103, 32, 115, 99, 114, 97, 112, 98, 111, 111, 107, 32, 105, 110, 
+32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 39, 19, 67, 114, 101, 97, 
+116, 101, 68, 111, 99, 117, 109, 101, 110, 116, 16, 97, 100, 100, 68, 111, 
+99, 117, 109, 101, 110, 116, 13, 100, 111, 99, 117, 109, 101, 110, 116, 17, 
+102, 105, 110, 100, 68, 111, 99, 117, 109, 101, 110, 116, 9, 110, 97, 109, 
+101, 13, 68, 111, 99, 117, 109, 101, 110, 116, 14, 115, 99, 114, 97, 112, 
+98, 111, 111, 107, 11, 97, 100, 100, 111, 110, 115, 38, 84, 104, 101, 114, 
+101, 39, 115, 32, 110, 111, 116, 104, 105, 110, 103, 32, 111, 110, 32, 116, 
+104, 101, 32, 99, 108, 105, 112, 98, 111, 97, 114, 100, 46, 20, 78, 111, 
+110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 17, 103, 101, 
+116, 67, 108, 105, 112, 98, 111, 97, 114, 100, 16, 68, 111, 99, 117, 109, 
+101, 110, 116, 83, 101, 116, 139, 1, 0, 0, 2, 0, 4, 0, 10, 54, 
+0, 0, 0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 1, 1, 57, 
+1, 2, 1, 14, 0, 1, 0, 88, 2, 1, 128, 53, 1, 3, 0, 61, 
+1, 2, 0, 75, 0, 1, 0, 1, 0, 3, 14, 116, 105, 109, 101, 115, 
+116, 97, 109, 112, 2, 13, 100, 111, 99, 117, 109, 101, 110, 116, 14, 83, 
+99, 114, 97, 112, 98, 111, 111, 107, 12, 112, 97, 116, 116, 101, 114, 110, 
+26, 73, 116, 101, 109, 32, 102, 114, 111, 109, 32, 39, 37, 78, 39, 32, 
+97, 116, 32, 37, 84, 58, 14, 115, 99, 114, 97, 112, 98, 111, 111, 107, 
+11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 119, 0, 1, 6, 2, 5, 0, 17, 57, 1, 0, 0, 57, 
+1, 1, 1, 18, 3, 0, 0, 66, 1, 2, 1, 45, 1, 0, 0, 39, 
+2, 3, 0, 45, 3, 1, 0, 57, 5, 2, 0, 66, 3, 2, 2, 39, 
+4, 4, 0, 38, 2, 4, 2, 61, 2, 2, 1, 45, 1, 0, 0, 18, 
+3, 1, 0, 57, 1, 1, 1, 66, 1, 2, 1, 75, 0, 1, 0, 3, 
+192, 0, 0, 6, 41, 25, 40, 69, 120, 97, 109, 112, 108, 101, 32, 116, 
+105, 109, 101, 115, 116, 97, 109, 112, 58, 32, 10, 118, 97, 108, 117, 101, 
+9, 100, 114, 97, 119, 10, 99, 108, 97, 115, 115, 215, 9, 1, 0, 15, 
+1, 38, 1, 115, 54, 0, 0, 0, 57, 0, 1, 0, 57, 0, 2, 0, 
+54, 1, 3, 0, 57, 1, 4, 1, 53, 3, 5, 0, 54, 4, 6, 0, 
+57, 6, 7, 0, 66, 4, 2, 2, 61, 4, 8, 3, 66, 1, 2, 2, 
+54, 2, 3, 0, 57, 2, 9, 2, 53, 4, 10, 0, 57, 5, 11, 0, 
+61, 5, 8, 4, 66, 2, 2, 2, 54, 3, 3, 0, 57, 3, 12, 3, 
+53, 5, 13, 0, 66, 3, 2, 2, 54, 4, 3, 0, 57, 4, 4, 4, 
+53, 6, 14, 0, 57, 7, 15, 0, 61, 7, 8, 6, 51, 7, 16, 0, 
+61, 7, 17, 6, 66, 4, 2, 2, 53, 5, 18, 0, 54, 6, 3, 0, 
+57, 6, 19, 6, 61, 6, 20, 5, 54, 6, 3, 0, 57, 6, 12, 6, 
+53, 8, 21, 0, 54, 9, 3, 0, 57, 9, 22, 9, 61, 9, 23, 8, 
+66, 6, 2, 2, 62, 6, 1, 5, 62, 1, 2, 5, 62, 2, 3, 5, 
+54, 6, 3, 0, 57, 6, 12, 6, 53, 8, 24, 0, 54, 9, 3, 0, 
+57, 9, 22, 9, 61, 9, 23, 8, 66, 6, 2, 2, 62, 6, 4, 5, 
+62, 4, 5, 5, 62, 3, 6, 5, 85, 6, 58, 128, 54, 6, 3, 0, 
+57, 6, 25, 6, 18, 8, 5, 0, 54, 9, 26, 0, 39, 10, 27, 0, 
+66, 6, 4, 2, 14, 0, 6, 0, 88, 7, 3, 128, 43, 7, 1, 0, 
+50, 0, 0, 128, 76, 7, 2, 0, 57, 7, 8, 1, 57, 8, 8, 2, 
+57, 9, 8, 4, 18, 12, 7, 0, 57, 10, 28, 7, 66, 10, 2, 2, 
+9, 10, 0, 0, 88, 10, 5, 128, 54, 10, 29, 0, 39, 12, 30, 0, 
+39, 13, 31, 0, 66, 10, 3, 1, 88, 10, 231, 127, 18, 12, 9, 0, 
+57, 10, 28, 9, 66, 10, 2, 2, 9, 10, 0, 0, 88, 10, 5, 128, 
+54, 10, 29, 0, 39, 12, 30, 0, 39, 13, 32, 0, 66, 10, 3, 1, 
+88, 10, 221, 127, 18, 12, 9, 0, 57, 10, 33, 9, 39, 13, 34, 0, 
+66, 10, 3, 2, 15, 0, 10, 0, 88, 11, 7, 128, 54, 10, 29, 0, 
+39, 12, 30, 0, 39, 13, 35, 0, 39, 14, 36, 0, 38, 13, 14, 13, 
+66, 10, 3, 1, 88, 10, 208, 127, 61, 7, 7, 0, 61, 8, 11, 0, 
+61, 9, 15, 0, 54, 10, 0, 0, 18, 12, 10, 0, 57, 10, 37, 10, 
+66, 10, 2, 1, 43, 10, 2, 0, 50, 0, 0, 128, 76, 10, 2, 0, 
+88, 6, 197, 127, 43, 6, 1, 0, 50, 0, 0, 128, 76, 6, 2, 0, 
+0, 192, 10, 116, 111, 117, 99, 104, 25, 37, 37, 44, 32, 37, 78, 32, 
+111, 114, 32, 37, 84, 32, 102, 105, 101, 108, 100, 115, 46, 43, 84, 104, 
+101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 112, 97, 116, 116, 101, 
+114, 110, 32, 99, 97, 110, 32, 111, 110, 108, 121, 32, 99, 111, 110, 116, 
+97, 105, 110, 32, 16, 37, 37, 91, 94, 37, 37, 110, 116, 78, 84, 93, 
+9, 102, 105, 110, 100, 43, 84, 104, 101, 32, 116, 105, 109, 101, 115, 116, 
+97, 109, 112, 32, 112, 97, 116, 116, 101, 114, 110, 32, 99, 97, 110, 110, 
+111, 116, 32, 98, 101, 32, 101, 109, 112, 116, 121, 46, 39, 84, 104, 101, 
+32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 110, 97, 109, 101, 32, 99, 
+97, 110, 110, 111, 116, 32, 98, 101, 32, 101, 109, 112, 116, 121, 46, 20, 
+80, 97, 114, 97, 109, 101, 116, 101, 114, 32, 101, 114, 114, 111, 114, 17, 
+77, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 8, 108, 101, 110, 
+57, 83, 80, 65, 67, 69, 32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 
+44, 32, 82, 69, 84, 85, 82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 
+105, 114, 109, 44, 32, 67, 84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 
+97, 110, 99, 101, 108, 17, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 
+101, 110, 8, 82, 117, 110, 1, 0, 6, 10, 118, 97, 108, 117, 101, 23, 
+84, 105, 109, 101, 115, 116, 97, 109, 112, 32, 112, 97, 116, 116, 101, 114, 
+110, 58, 7, 121, 50, 3, 5, 7, 120, 50, 3, 32, 7, 121, 49, 3, 
+5, 7, 120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 10, 97, 108, 
+105, 103, 110, 9, 76, 101, 102, 116, 1, 0, 6, 10, 118, 97, 108, 117, 
+101, 32, 78, 97, 109, 101, 32, 111, 102, 32, 115, 99, 114, 97, 112, 98, 
+111, 111, 107, 32, 100, 111, 99, 117, 109, 101, 110, 116, 58, 7, 121, 50, 
+3, 1, 7, 120, 50, 3, 32, 7, 121, 49, 3, 1, 7, 120, 49, 3, 
+1, 10, 97, 108, 105, 103, 110, 0, 10, 119, 105, 100, 116, 104, 10, 76, 
+97, 114, 103, 101, 1, 0, 7, 14, 75, 69, 89, 95, 69, 78, 84, 69, 
+82, 12, 99, 111, 110, 102, 105, 114, 109, 11, 75, 69, 89, 95, 94, 67, 
+11, 99, 97, 110, 99, 101, 108, 13, 115, 116, 114, 101, 116, 99, 104, 121, 
+1, 11, 104, 101, 105, 103, 104, 116, 3, 9, 15, 75, 69, 89, 95, 82, 
+69, 84, 85, 82, 78, 12, 99, 111, 110, 102, 105, 114, 109, 10, 119, 105, 
+100, 116, 104, 0, 10, 116, 105, 116, 108, 101, 24, 67, 111, 110, 102, 105, 
+103, 117, 114, 101, 32, 84, 105, 109, 101, 115, 116, 97, 109, 112, 9, 100, 
+114, 97, 119, 0, 12, 112, 97, 116, 116, 101, 114, 110, 1, 0, 6, 10, 
+118, 97, 108, 117, 101, 0, 9, 100, 114, 97, 119, 0, 7, 121, 50, 3, 
+5, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 121, 49, 3, 5, 7, 
+120, 49, 3, 33, 1, 0, 4, 7, 121, 49, 3, 7, 7, 120, 49, 3, 
+1, 7, 121, 50, 3, 7, 7, 120, 50, 3, 255, 255, 255, 255, 15, 10, 
+76, 97, 98, 101, 108, 14, 116, 105, 109, 101, 115, 116, 97, 109, 112, 1, 
+0, 6, 10, 108, 97, 98, 101, 108, 21, 69, 110, 97, 98, 108, 101, 32, 
+116, 105, 109, 101, 115, 116, 97, 109, 112, 10, 118, 97, 108, 117, 101, 0, 
+7, 121, 50, 3, 3, 7, 120, 50, 3, 33, 7, 121, 49, 3, 3, 7, 
+120, 49, 3, 1, 13, 67, 104, 101, 99, 107, 98, 111, 120, 10, 118, 97, 
+108, 117, 101, 13, 100, 111, 99, 117, 109, 101, 110, 116, 13, 116, 111, 115, 
+116, 114, 105, 110, 103, 1, 0, 5, 10, 118, 97, 108, 117, 101, 0, 7, 
+121, 50, 3, 1, 7, 120, 50, 3, 255, 255, 255, 255, 15, 7, 121, 49, 
+3, 1, 7, 120, 49, 3, 33, 14, 84, 101, 120, 116, 70, 105, 101, 108, 
+100, 9, 70, 111, 114, 109, 14, 115, 99, 114, 97, 112, 98, 111, 111, 107, 
+11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 0, 206, 1, 3, 0, 6, 0, 14, 0, 21, 51, 0, 0, 
+0, 54, 1, 1, 0, 51, 2, 3, 0, 61, 2, 2, 1, 54, 1, 1, 
+0, 51, 2, 5, 0, 61, 2, 4, 1, 54, 1, 1, 0, 51, 2, 7, 
+0, 61, 2, 6, 1, 51, 1, 8, 0, 54, 2, 9, 0, 54, 4, 10, 
+0, 57, 4, 11, 4, 18, 5, 1, 0, 66, 2, 3, 1, 54, 1, 1, 
+0, 51, 2, 13, 0, 61, 2, 12, 1, 50, 0, 0, 128, 75, 0, 1, 
+0, 0, 23, 67, 111, 110, 102, 105, 103, 117, 114, 101, 83, 99, 114, 97, 
+112, 98, 111, 111, 107, 19, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 
+100, 111, 110, 115, 10, 69, 118, 101, 110, 116, 21, 65, 100, 100, 69, 118, 
+101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 0, 21, 80, 97, 
+115, 116, 101, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 0, 20, 
+67, 111, 112, 121, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 0, 
+19, 67, 117, 116, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 8, 
+67, 109, 100, 0, 0, 
+};
+
+/* This is src/lua/addons/pagecount.lua */
+static const char file_31[] = {
+27, 76, 74, 2, 10, 133, 2, 0, 3, 15, 0, 15, 1, 33, 54, 3, 
+0, 0, 57, 3, 1, 3, 57, 3, 2, 3, 14, 0, 3, 0, 88, 4, 
+1, 128, 52, 3, 0, 0, 57, 4, 3, 3, 15, 0, 4, 0, 88, 5, 
+23, 128, 54, 4, 4, 0, 57, 4, 5, 4, 54, 6, 6, 0, 57, 6, 
+7, 6, 14, 0, 6, 0, 88, 7, 1, 128, 41, 6, 0, 0, 57, 7, 
+8, 3, 35, 6, 7, 6, 66, 4, 2, 2, 21, 5, 2, 0, 22, 5, 
+0, 5, 54, 6, 9, 0, 57, 6, 10, 6, 39, 8, 11, 0, 18, 9, 
+4, 0, 54, 10, 12, 0, 18, 12, 4, 0, 39, 13, 13, 0, 39, 14, 
+14, 0, 66, 10, 4, 0, 65, 6, 2, 2, 60, 6, 5, 2, 75, 0, 
+1, 0, 10, 112, 97, 103, 101, 115, 9, 112, 97, 103, 101, 14, 80, 108, 
+117, 114, 97, 108, 105, 115, 101, 10, 37, 100, 32, 37, 115, 11, 102, 111, 
+114, 109, 97, 116, 11, 115, 116, 114, 105, 110, 103, 17, 119, 111, 114, 100, 
+115, 112, 101, 114, 112, 97, 103, 101, 14, 119, 111, 114, 100, 99, 111, 117, 
+110, 116, 13, 68, 111, 99, 117, 109, 101, 110, 116, 10, 102, 108, 111, 111, 
+114, 9, 109, 97, 116, 104, 12, 101, 110, 97, 98, 108, 101, 100, 14, 112, 
+97, 103, 101, 99, 111, 117, 110, 116, 11, 97, 100, 100, 111, 110, 115, 16, 
+68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 2, 104, 0, 0, 2, 
+0, 4, 0, 10, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 0, 0, 
+57, 1, 1, 1, 57, 1, 2, 1, 14, 0, 1, 0, 88, 2, 1, 128, 
+53, 1, 3, 0, 61, 1, 2, 0, 75, 0, 1, 0, 1, 0, 2, 12, 
+101, 110, 97, 98, 108, 101, 100, 1, 17, 119, 111, 114, 100, 115, 112, 101, 
+114, 112, 97, 103, 101, 3, 250, 1, 14, 112, 97, 103, 101, 99, 111, 117, 
+110, 116, 11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 171, 6, 0, 0, 11, 0, 27, 0, 64, 54, 0, 
+0, 0, 57, 0, 1, 0, 57, 0, 2, 0, 54, 1, 3, 0, 57, 1, 
+4, 1, 53, 3, 5, 0, 57, 4, 6, 0, 61, 4, 7, 3, 66, 1, 
+2, 2, 54, 2, 3, 0, 57, 2, 8, 2, 53, 4, 9, 0, 54, 5, 
+10, 0, 57, 7, 11, 0, 66, 5, 2, 2, 61, 5, 7, 4, 66, 2, 
+2, 2, 53, 3, 12, 0, 54, 4, 3, 0, 57, 4, 13, 4, 61, 4, 
+14, 3, 62, 1, 1, 3, 54, 4, 3, 0, 57, 4, 15, 4, 53, 6, 
+16, 0, 54, 7, 3, 0, 57, 7, 17, 7, 61, 7, 18, 6, 66, 4, 
+2, 2, 62, 4, 2, 3, 62, 2, 3, 3, 85, 4, 30, 128, 54, 4, 
+3, 0, 57, 4, 19, 4, 18, 6, 3, 0, 54, 7, 20, 0, 39, 8, 
+21, 0, 66, 4, 4, 2, 14, 0, 4, 0, 88, 5, 2, 128, 43, 5, 
+1, 0, 76, 5, 2, 0, 57, 5, 7, 1, 54, 6, 22, 0, 57, 8, 
+7, 2, 66, 6, 2, 2, 14, 0, 6, 0, 88, 7, 5, 128, 54, 7, 
+23, 0, 39, 9, 24, 0, 39, 10, 25, 0, 66, 7, 3, 1, 88, 7, 
+234, 127, 61, 5, 6, 0, 61, 6, 11, 0, 54, 7, 0, 0, 18, 9, 
+7, 0, 57, 7, 26, 7, 66, 7, 2, 1, 43, 7, 2, 0, 76, 7, 
+2, 0, 88, 4, 225, 127, 43, 4, 1, 0, 76, 4, 2, 0, 10, 116, 
+111, 117, 99, 104, 57, 84, 104, 101, 32, 110, 117, 109, 98, 101, 114, 32, 
+111, 102, 32, 119, 111, 114, 100, 115, 32, 112, 101, 114, 32, 112, 97, 103, 
+101, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 118, 97, 108, 105, 
+100, 32, 110, 117, 109, 98, 101, 114, 46, 20, 80, 97, 114, 97, 109, 101, 
+116, 101, 114, 32, 101, 114, 114, 111, 114, 17, 77, 111, 100, 97, 108, 77, 
+101, 115, 115, 97, 103, 101, 13, 116, 111, 110, 117, 109, 98, 101, 114, 57, 
+83, 80, 65, 67, 69, 32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 
+32, 82, 69, 84, 85, 82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 
+114, 109, 44, 32, 67, 84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 
+110, 99, 101, 108, 17, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 
+110, 8, 82, 117, 110, 10, 97, 108, 105, 103, 110, 9, 76, 101, 102, 116, 
+1, 0, 6, 10, 118, 97, 108, 117, 101, 30, 78, 117, 109, 98, 101, 114, 
+32, 111, 102, 32, 119, 111, 114, 100, 115, 32, 112, 101, 114, 32, 112, 97, 
+103, 101, 58, 7, 121, 50, 3, 3, 7, 120, 50, 3, 32, 7, 121, 49, 
+3, 3, 7, 120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 10, 76, 
+97, 98, 101, 108, 10, 119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 
+1, 0, 7, 14, 75, 69, 89, 95, 69, 78, 84, 69, 82, 12, 99, 111, 
+110, 102, 105, 114, 109, 11, 75, 69, 89, 95, 94, 67, 11, 99, 97, 110, 
+99, 101, 108, 13, 115, 116, 114, 101, 116, 99, 104, 121, 1, 11, 104, 101, 
+105, 103, 104, 116, 3, 5, 15, 75, 69, 89, 95, 82, 69, 84, 85, 82, 
+78, 12, 99, 111, 110, 102, 105, 114, 109, 10, 119, 105, 100, 116, 104, 0, 
+10, 116, 105, 116, 108, 101, 25, 67, 111, 110, 102, 105, 103, 117, 114, 101, 
+32, 80, 97, 103, 101, 32, 67, 111, 117, 110, 116, 17, 119, 111, 114, 100, 
+115, 112, 101, 114, 112, 97, 103, 101, 13, 116, 111, 115, 116, 114, 105, 110, 
+103, 1, 0, 5, 10, 118, 97, 108, 117, 101, 0, 7, 121, 50, 3, 3, 
+7, 120, 50, 3, 43, 7, 121, 49, 3, 3, 7, 120, 49, 3, 33, 14, 
+84, 101, 120, 116, 70, 105, 101, 108, 100, 10, 118, 97, 108, 117, 101, 12, 
+101, 110, 97, 98, 108, 101, 100, 1, 0, 6, 10, 108, 97, 98, 101, 108, 
+32, 83, 104, 111, 119, 32, 97, 112, 112, 114, 111, 120, 105, 109, 97, 116, 
+101, 32, 112, 97, 103, 101, 32, 99, 111, 117, 110, 116, 10, 118, 97, 108, 
+117, 101, 0, 7, 121, 50, 3, 1, 7, 120, 50, 3, 33, 7, 121, 49, 
+3, 1, 7, 120, 49, 3, 1, 13, 67, 104, 101, 99, 107, 98, 111, 120, 
+9, 70, 111, 114, 109, 14, 112, 97, 103, 101, 99, 111, 117, 110, 116, 11, 
+97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 
+101, 116, 150, 1, 3, 0, 5, 0, 9, 0, 16, 51, 0, 0, 0, 54, 
+1, 1, 0, 54, 3, 2, 0, 57, 3, 3, 3, 18, 4, 0, 0, 66, 
+1, 3, 1, 51, 0, 4, 0, 54, 1, 1, 0, 54, 3, 2, 0, 57, 
+3, 5, 3, 18, 4, 0, 0, 66, 1, 3, 1, 54, 0, 6, 0, 51, 
+1, 8, 0, 61, 1, 7, 0, 75, 0, 1, 0, 0, 23, 67, 111, 110, 
+102, 105, 103, 117, 114, 101, 80, 97, 103, 101, 67, 111, 117, 110, 116, 8, 
+67, 109, 100, 19, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 
+110, 115, 0, 19, 66, 117, 105, 108, 100, 83, 116, 97, 116, 117, 115, 66, 
+97, 114, 10, 69, 118, 101, 110, 116, 21, 65, 100, 100, 69, 118, 101, 110, 
+116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 0, 
+};
+
+/* This is src/lua/addons/statusbar_charstyle.lua */
+static const char file_32[] = {
+27, 76, 74, 2, 10, 155, 2, 0, 3, 9, 1, 14, 1, 47, 52, 3, 
+4, 0, 54, 4, 0, 0, 57, 4, 1, 4, 45, 6, 0, 0, 54, 7, 
+2, 0, 57, 7, 3, 7, 66, 4, 3, 2, 15, 0, 4, 0, 88, 5, 
+2, 128, 39, 4, 4, 0, 88, 5, 1, 128, 39, 4, 5, 0, 62, 4, 
+1, 3, 54, 4, 0, 0, 57, 4, 1, 4, 45, 6, 0, 0, 54, 7, 
+2, 0, 57, 7, 6, 7, 66, 4, 3, 2, 15, 0, 4, 0, 88, 5, 
+2, 128, 39, 4, 7, 0, 88, 5, 1, 128, 39, 4, 5, 0, 62, 4, 
+2, 3, 54, 4, 0, 0, 57, 4, 1, 4, 45, 6, 0, 0, 54, 7, 
+2, 0, 57, 7, 8, 7, 66, 4, 3, 2, 15, 0, 4, 0, 88, 5, 
+2, 128, 39, 4, 9, 0, 88, 5, 1, 128, 39, 4, 5, 0, 62, 4, 
+3, 3, 21, 4, 2, 0, 22, 4, 0, 4, 53, 5, 10, 0, 54, 6, 
+11, 0, 57, 6, 12, 6, 18, 8, 3, 0, 66, 6, 2, 2, 61, 6, 
+13, 5, 60, 5, 4, 2, 75, 0, 1, 0, 0, 128, 10, 118, 97, 108, 
+117, 101, 11, 99, 111, 110, 99, 97, 116, 10, 116, 97, 98, 108, 101, 1, 
+0, 2, 10, 118, 97, 108, 117, 101, 0, 13, 112, 114, 105, 111, 114, 105, 
+116, 121, 3, 110, 6, 85, 14, 85, 78, 68, 69, 82, 76, 73, 78, 69, 
+6, 66, 9, 66, 79, 76, 68, 6, 46, 6, 73, 11, 73, 84, 65, 76, 
+73, 67, 7, 119, 103, 10, 98, 116, 101, 115, 116, 10, 98, 105, 116, 51, 
+50, 2, 48, 0, 2, 4, 1, 1, 0, 4, 54, 2, 0, 0, 66, 2, 
+1, 2, 46, 0, 2, 0, 75, 0, 1, 0, 0, 128, 27, 71, 101, 116, 
+83, 116, 121, 108, 101, 84, 111, 76, 101, 102, 116, 79, 102, 67, 117, 114, 
+115, 111, 114, 77, 0, 2, 6, 1, 3, 0, 13, 54, 2, 0, 0, 57, 
+2, 1, 2, 45, 4, 0, 0, 18, 5, 0, 0, 66, 2, 3, 2, 46, 
+0, 2, 0, 54, 2, 0, 0, 57, 2, 2, 2, 45, 4, 0, 0, 18, 
+5, 1, 0, 66, 2, 3, 2, 46, 0, 2, 0, 75, 0, 1, 0, 0, 
+128, 9, 98, 97, 110, 100, 9, 98, 120, 111, 114, 10, 98, 105, 116, 51, 
+50, 17, 0, 0, 1, 1, 0, 0, 2, 45, 0, 0, 0, 76, 0, 2, 
+0, 0, 128, 171, 1, 3, 0, 6, 0, 10, 0, 19, 41, 0, 0, 0, 
+51, 1, 0, 0, 54, 2, 1, 0, 54, 4, 2, 0, 57, 4, 3, 4, 
+18, 5, 1, 0, 66, 2, 3, 1, 51, 1, 4, 0, 54, 2, 1, 0, 
+54, 4, 2, 0, 57, 4, 5, 4, 18, 5, 1, 0, 66, 2, 3, 1, 
+51, 1, 6, 0, 55, 1, 7, 0, 51, 1, 8, 0, 55, 1, 9, 0, 
+50, 0, 0, 128, 75, 0, 1, 0, 24, 71, 101, 116, 67, 117, 114, 114, 
+101, 110, 116, 83, 116, 121, 108, 101, 72, 105, 110, 116, 0, 24, 83, 101, 
+116, 67, 117, 114, 114, 101, 110, 116, 83, 116, 121, 108, 101, 72, 105, 110, 
+116, 0, 10, 77, 111, 118, 101, 100, 0, 19, 66, 117, 105, 108, 100, 83, 
+116, 97, 116, 117, 115, 66, 97, 114, 10, 69, 118, 101, 110, 116, 21, 65, 
+100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 
+0, 
+};
+
+/* This is src/lua/addons/statusbar_position.lua */
+static const char file_33[] = {
+27, 76, 74, 2, 10, 110, 0, 3, 10, 1, 5, 1, 13, 21, 3, 2, 
+0, 22, 3, 0, 3, 53, 4, 0, 0, 45, 5, 0, 0, 39, 7, 1, 
+0, 54, 8, 2, 0, 57, 8, 3, 8, 54, 9, 2, 0, 21, 9, 9, 
+0, 66, 5, 4, 2, 61, 5, 4, 4, 60, 4, 3, 2, 75, 0, 1, 
+0, 0, 192, 10, 118, 97, 108, 117, 101, 7, 99, 112, 13, 68, 111, 99, 
+117, 109, 101, 110, 116, 13, 80, 58, 32, 37, 100, 47, 37, 100, 1, 0, 
+2, 10, 118, 97, 108, 117, 101, 0, 13, 112, 114, 105, 111, 114, 105, 116, 
+121, 3, 100, 2, 100, 3, 0, 6, 0, 6, 0, 10, 54, 0, 0, 0, 
+57, 0, 1, 0, 51, 1, 2, 0, 54, 2, 3, 0, 54, 4, 4, 0, 
+57, 4, 5, 4, 18, 5, 1, 0, 66, 2, 3, 1, 50, 0, 0, 128, 
+75, 0, 1, 0, 19, 66, 117, 105, 108, 100, 83, 116, 97, 116, 117, 115, 
+66, 97, 114, 10, 69, 118, 101, 110, 116, 21, 65, 100, 100, 69, 118, 101, 
+110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 11, 102, 111, 114, 109, 
+97, 116, 11, 115, 116, 114, 105, 110, 103, 0, 
+};
+
+/* This is src/lua/addons/statusbar_wordcount.lua */
+static const char file_34[] = {
+27, 76, 74, 2, 10, 175, 1, 0, 3, 14, 1, 8, 1, 23, 21, 3, 
+2, 0, 22, 3, 0, 3, 53, 4, 0, 0, 45, 5, 0, 0, 39, 7, 
+1, 0, 54, 8, 2, 0, 57, 8, 3, 8, 14, 0, 8, 0, 88, 9, 
+1, 128, 41, 8, 0, 0, 54, 9, 4, 0, 54, 11, 2, 0, 57, 11, 
+3, 11, 14, 0, 11, 0, 88, 12, 1, 128, 41, 11, 0, 0, 39, 12, 
+5, 0, 39, 13, 6, 0, 66, 9, 4, 0, 65, 5, 2, 2, 61, 5, 
+7, 4, 60, 4, 3, 2, 75, 0, 1, 0, 0, 192, 10, 118, 97, 108, 
+117, 101, 10, 119, 111, 114, 100, 115, 9, 119, 111, 114, 100, 14, 80, 108, 
+117, 114, 97, 108, 105, 115, 101, 14, 119, 111, 114, 100, 99, 111, 117, 110, 
+116, 13, 68, 111, 99, 117, 109, 101, 110, 116, 10, 37, 100, 32, 37, 115, 
+1, 0, 2, 10, 118, 97, 108, 117, 101, 0, 13, 112, 114, 105, 111, 114, 
+105, 116, 121, 3, 90, 2, 100, 3, 0, 6, 0, 6, 0, 10, 54, 0, 
+0, 0, 57, 0, 1, 0, 51, 1, 2, 0, 54, 2, 3, 0, 54, 4, 
+4, 0, 57, 4, 5, 4, 18, 5, 1, 0, 66, 2, 3, 1, 50, 0, 
+0, 128, 75, 0, 1, 0, 19, 66, 117, 105, 108, 100, 83, 116, 97, 116, 
+117, 115, 66, 97, 114, 10, 69, 118, 101, 110, 116, 21, 65, 100, 100, 69, 
+118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 11, 102, 111, 
+114, 109, 97, 116, 11, 115, 116, 114, 105, 110, 103, 0, 
+};
+
+/* This is src/lua/addons/debug.lua */
+static const char file_35[] = {
+27, 76, 74, 2, 10, 204, 3, 0, 3, 14, 2, 20, 2, 63, 54, 3, 
+0, 0, 57, 3, 1, 3, 57, 4, 2, 3, 15, 0, 4, 0, 88, 5, 
+12, 128, 54, 4, 3, 0, 39, 6, 4, 0, 66, 4, 2, 2, 21, 5, 
+2, 0, 22, 5, 0, 5, 53, 6, 5, 0, 45, 7, 0, 0, 39, 9, 
+6, 0, 18, 10, 4, 0, 66, 7, 3, 2, 61, 7, 7, 6, 60, 6, 
+5, 2, 57, 4, 8, 3, 15, 0, 4, 0, 88, 5, 42, 128, 45, 4, 
+1, 0, 66, 4, 1, 3, 45, 6, 0, 0, 39, 8, 9, 0, 57, 9, 
+10, 5, 66, 6, 3, 2, 57, 7, 11, 5, 15, 0, 7, 0, 88, 8, 
+6, 128, 18, 7, 6, 0, 45, 8, 0, 0, 39, 10, 12, 0, 57, 11, 
+11, 5, 66, 8, 3, 2, 38, 6, 8, 7, 18, 7, 6, 0, 45, 8, 
+0, 0, 39, 10, 13, 0, 57, 11, 14, 5, 66, 8, 3, 2, 38, 6, 
+8, 7, 57, 7, 15, 5, 15, 0, 7, 0, 88, 8, 6, 128, 18, 7, 
+6, 0, 45, 8, 0, 0, 39, 10, 16, 0, 57, 11, 15, 5, 66, 8, 
+3, 2, 38, 6, 8, 7, 21, 7, 2, 0, 22, 7, 0, 7, 53, 8, 
+17, 0, 18, 9, 6, 0, 45, 10, 0, 0, 39, 12, 18, 0, 57, 13, 
+19, 5, 24, 13, 1, 13, 66, 10, 3, 2, 38, 9, 10, 9, 61, 9, 
+7, 8, 60, 8, 7, 2, 75, 0, 1, 0, 0, 192, 2, 192, 15, 114, 
+101, 100, 114, 97, 119, 116, 105, 109, 101, 12, 32, 37, 46, 49, 102, 109, 
+115, 1, 0, 2, 10, 118, 97, 108, 117, 101, 0, 13, 112, 114, 105, 111, 
+114, 105, 116, 121, 3, 50, 9, 32, 37, 100, 114, 13, 114, 101, 113, 117, 
+101, 115, 116, 115, 17, 97, 116, 116, 114, 115, 119, 105, 116, 99, 104, 101, 
+115, 9, 32, 37, 100, 97, 9, 32, 37, 100, 99, 17, 99, 101, 108, 108, 
+115, 99, 104, 97, 110, 103, 101, 100, 11, 119, 114, 105, 116, 101, 115, 8, 
+37, 100, 119, 16, 114, 101, 110, 100, 101, 114, 115, 116, 97, 116, 115, 10, 
+118, 97, 108, 117, 101, 9, 37, 100, 107, 66, 1, 0, 2, 10, 118, 97, 
+108, 117, 101, 0, 13, 112, 114, 105, 111, 114, 105, 116, 121, 3, 50, 10, 
+99, 111, 117, 110, 116, 19, 99, 111, 108, 108, 101, 99, 116, 103, 97, 114, 
+98, 97, 103, 101, 11, 109, 101, 109, 111, 114, 121, 10, 100, 101, 98, 117, 
+103, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 
+2, 208, 15, 79, 0, 2, 4, 0, 4, 0, 8, 54, 2, 0, 0, 57, 
+2, 1, 2, 57, 2, 2, 2, 15, 0, 2, 0, 88, 3, 2, 128, 54, 
+2, 3, 0, 66, 2, 1, 1, 75, 0, 1, 0, 16, 81, 117, 101, 117, 
+101, 82, 101, 100, 114, 97, 119, 11, 109, 101, 109, 111, 114, 121, 10, 100, 
+101, 98, 117, 103, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 
+110, 103, 115, 84, 0, 0, 2, 0, 3, 0, 8, 54, 0, 0, 0, 54, 
+1, 0, 0, 57, 1, 1, 1, 14, 0, 1, 0, 88, 2, 1, 128, 53, 
+1, 2, 0, 61, 1, 1, 0, 75, 0, 1, 0, 1, 0, 2, 11, 109, 
+101, 109, 111, 114, 121, 1, 16, 114, 101, 110, 100, 101, 114, 115, 116, 97, 
+116, 115, 1, 10, 100, 101, 98, 117, 103, 19, 71, 108, 111, 98, 97, 108, 
+83, 101, 116, 116, 105, 110, 103, 115, 222, 5, 0, 0, 9, 0, 20, 1, 
+46, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 2, 0, 57, 1, 3, 
+1, 53, 3, 4, 0, 57, 4, 5, 0, 61, 4, 6, 3, 66, 1, 2, 
+2, 54, 2, 2, 0, 57, 2, 3, 2, 53, 4, 7, 0, 57, 5, 8, 
+0, 61, 5, 6, 4, 66, 2, 2, 2, 53, 3, 9, 0, 54, 4, 2, 
+0, 57, 4, 10, 4, 61, 4, 11, 3, 62, 1, 1, 3, 62, 2, 2, 
+3, 54, 4, 2, 0, 57, 4, 12, 4, 53, 6, 13, 0, 54, 7, 2, 
+0, 57, 7, 14, 7, 61, 7, 15, 6, 66, 4, 2, 0, 63, 4, 0, 
+0, 54, 4, 2, 0, 57, 4, 16, 4, 18, 6, 3, 0, 54, 7, 17, 
+0, 39, 8, 18, 0, 66, 4, 4, 2, 14, 0, 4, 0, 88, 5, 2, 
+128, 43, 5, 1, 0, 76, 5, 2, 0, 57, 5, 6, 1, 61, 5, 5, 
+0, 57, 5, 6, 2, 61, 5, 8, 0, 54, 5, 19, 0, 66, 5, 1, 
+1, 43, 5, 2, 0, 76, 5, 2, 0, 23, 83, 97, 118, 101, 71, 108, 
+111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 57, 83, 80, 65, 
+67, 69, 32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 
+84, 85, 82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 
+32, 67, 84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 
+108, 17, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 8, 82, 
+117, 110, 10, 97, 108, 105, 103, 110, 11, 67, 101, 110, 116, 114, 101, 1, 
+0, 6, 10, 118, 97, 108, 117, 101, 63, 78, 111, 110, 101, 32, 111, 102, 
+32, 116, 104, 101, 115, 101, 32, 111, 112, 116, 105, 111, 110, 115, 32, 97, 
+114, 101, 32, 111, 102, 32, 97, 110, 121, 32, 105, 110, 116, 101, 114, 101, 
+115, 116, 32, 116, 111, 32, 110, 111, 114, 109, 97, 108, 32, 117, 115, 101, 
+114, 115, 46, 7, 121, 50, 3, 1, 7, 120, 50, 3, 255, 255, 255, 255, 
+15, 7, 121, 49, 3, 1, 7, 120, 49, 3, 1, 10, 97, 108, 105, 103, 
+110, 0, 10, 76, 97, 98, 101, 108, 10, 119, 105, 100, 116, 104, 10, 76, 
+97, 114, 103, 101, 1, 0, 7, 14, 75, 69, 89, 95, 69, 78, 84, 69, 
+82, 12, 99, 111, 110, 102, 105, 114, 109, 11, 75, 69, 89, 95, 94, 67, 
+11, 99, 97, 110, 99, 101, 108, 13, 115, 116, 114, 101, 116, 99, 104, 121, 
+1, 11, 104, 101, 105, 103, 104, 116, 3, 7, 15, 75, 69, 89, 95, 82, 
+69, 84, 85, 82, 78, 12, 99, 111, 110, 102, 105, 114, 109, 10, 119, 105, 
+100, 116, 104, 0, 10, 116, 105, 116, 108, 101, 32, 67, 111, 110, 102, 105, 
+103, 117, 114, 101, 32, 68, 101, 98, 117, 103, 103, 105, 110, 103, 32, 79, 
+112, 116, 105, 111, 110, 115, 16, 114, 101, 110, 100, 101, 114, 115, 116, 97, 
+116, 115, 1, 0, 6, 10, 108, 97, 98, 101, 108, 44, 83, 104, 111, 119, 
+32, 114, 101, 110, 100, 101, 114, 105, 110, 103, 32, 115, 116, 97, 116, 105, 
+115, 116, 105, 99, 115, 32, 111, 110, 32, 115, 116, 97, 116, 117, 115, 32, 
+98, 97, 114, 10, 118, 97, 108, 117, 101, 0, 7, 121, 50, 3, 5, 7, 
+120, 50, 3, 40, 7, 121, 49, 3, 5, 7, 120, 49, 3, 1, 10, 118, 
+97, 108, 117, 101, 11, 109, 101, 109, 111, 114, 121, 1, 0, 6, 10, 108, 
+97, 98, 101, 108, 36, 83, 104, 111, 119, 32, 109, 101, 109, 111, 114, 121, 
+32, 117, 115, 97, 103, 101, 32, 111, 110, 32, 115, 116, 97, 116, 117, 115, 
+32, 98, 97, 114, 10, 118, 97, 108, 117, 101, 0, 7, 121, 50, 3, 3, 
+7, 120, 50, 3, 40, 7, 121, 49, 3, 3, 7, 120, 49, 3, 1, 13, 
+67, 104, 101, 99, 107, 98, 111, 120, 9, 70, 111, 114, 109, 10, 100, 101, 
+98, 117, 103, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 
+103, 115, 7, 128, 128, 192, 153, 4, 155, 3, 0, 1, 7, 2, 14, 3, 
+53, 52, 1, 3, 0, 45, 2, 0, 0, 39, 4, 0, 0, 57, 5, 1, 
+0, 66, 2, 3, 2, 62, 2, 1, 1, 45, 2, 0, 0, 39, 4, 2, 
+0, 57, 5, 3, 0, 66, 2, 3, 0, 63, 2, 0, 0, 57, 2, 4, 
+0, 15, 0, 2, 0, 88, 3, 7, 128, 21, 2, 1, 0, 22, 2, 1, 
+2, 45, 3, 0, 0, 39, 5, 5, 0, 57, 6, 4, 0, 66, 3, 3, 
+2, 60, 3, 2, 1, 21, 2, 1, 0, 22, 2, 1, 2, 45, 3, 0, 
+0, 39, 5, 6, 0, 57, 6, 7, 0, 66, 3, 3, 2, 60, 3, 2, 
+1, 57, 2, 8, 0, 15, 0, 2, 0, 88, 3, 7, 128, 21, 2, 1, 
+0, 22, 2, 1, 2, 45, 3, 0, 0, 39, 5, 9, 0, 57, 6, 8, 
+0, 66, 3, 3, 2, 60, 3, 2, 1, 21, 2, 1, 0, 22, 2, 1, 
+2, 45, 3, 0, 0, 39, 5, 10, 0, 57, 6, 11, 0, 24, 6, 2, 
+6, 66, 3, 3, 2, 60, 3, 2, 1, 45, 2, 1, 0, 18, 4, 1, 
+0, 39, 5, 12, 0, 66, 2, 3, 2, 39, 3, 13, 0, 38, 2, 3, 
+2, 76, 2, 2, 0, 1, 0, 2, 0, 6, 46, 7, 44, 32, 15, 114, 
+101, 100, 114, 97, 119, 116, 105, 109, 101, 27, 37, 46, 51, 102, 109, 115, 
+32, 105, 110, 32, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 
+24, 37, 100, 32, 100, 105, 115, 112, 108, 97, 121, 32, 114, 101, 113, 117, 
+101, 115, 116, 115, 13, 114, 101, 113, 117, 101, 115, 116, 115, 17, 97, 116, 
+116, 114, 115, 119, 105, 116, 99, 104, 101, 115, 26, 37, 100, 32, 97, 116, 
+116, 114, 105, 98, 117, 116, 101, 32, 115, 119, 105, 116, 99, 104, 101, 115, 
+21, 37, 100, 32, 99, 101, 108, 108, 115, 32, 99, 104, 97, 110, 103, 101, 
+100, 17, 99, 101, 108, 108, 115, 99, 104, 97, 110, 103, 101, 100, 11, 119, 
+114, 105, 116, 101, 115, 26, 37, 100, 32, 99, 104, 97, 114, 97, 99, 116, 
+101, 114, 115, 32, 119, 114, 105, 116, 116, 101, 110, 11, 102, 114, 97, 109, 
+101, 115, 14, 37, 100, 32, 102, 114, 97, 109, 101, 115, 5, 128, 128, 192, 
+153, 4, 2, 208, 15, 142, 1, 1, 0, 12, 3, 5, 0, 18, 45, 0, 
+0, 0, 66, 0, 1, 3, 51, 2, 0, 0, 54, 3, 1, 0, 39, 5, 
+2, 0, 39, 6, 3, 0, 18, 7, 2, 0, 18, 9, 0, 0, 66, 7, 
+2, 2, 39, 8, 4, 0, 18, 9, 2, 0, 18, 11, 1, 0, 66, 9, 
+2, 2, 38, 6, 9, 6, 66, 3, 3, 1, 43, 3, 2, 0, 50, 0, 
+0, 128, 76, 3, 2, 0, 2, 192, 0, 192, 1, 192, 18, 32, 76, 97, 
+115, 116, 32, 102, 114, 97, 109, 101, 58, 32, 12, 84, 111, 116, 97, 108, 
+58, 32, 25, 82, 101, 110, 100, 101, 114, 105, 110, 103, 32, 115, 116, 97, 
+116, 105, 115, 116, 105, 99, 115, 17, 77, 111, 100, 97, 108, 77, 101, 115, 
+115, 97, 103, 101, 0, 147, 2, 3, 0, 8, 0, 19, 0, 32, 54, 0, 
+0, 0, 57, 0, 1, 0, 54, 1, 2, 0, 57, 1, 3, 1, 54, 2, 
+4, 0, 57, 2, 5, 2, 51, 3, 6, 0, 54, 4, 7, 0, 54, 6, 
+8, 0, 57, 6, 9, 6, 18, 7, 3, 0, 66, 4, 3, 1, 51, 3, 
+10, 0, 54, 4, 7, 0, 54, 6, 8, 0, 57, 6, 11, 6, 18, 7, 
+3, 0, 66, 4, 3, 1, 51, 3, 12, 0, 54, 4, 7, 0, 54, 6, 
+8, 0, 57, 6, 13, 6, 18, 7, 3, 0, 66, 4, 3, 1, 54, 3, 
+14, 0, 51, 4, 16, 0, 61, 4, 15, 3, 54, 3, 14, 0, 51, 4, 
+18, 0, 61, 4, 17, 3, 50, 0, 0, 128, 75, 0, 1, 0, 0, 20, 
+68, 117, 109, 112, 82, 101, 110, 100, 101, 114, 83, 116, 97, 116, 115, 0, 
+19, 67, 111, 110, 102, 105, 103, 117, 114, 101, 68, 101, 98, 117, 103, 8, 
+67, 109, 100, 19, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 
+110, 115, 0, 9, 73, 100, 108, 101, 0, 19, 66, 117, 105, 108, 100, 83, 
+116, 97, 116, 117, 115, 66, 97, 114, 10, 69, 118, 101, 110, 116, 21, 65, 
+100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 
+16, 114, 101, 110, 100, 101, 114, 115, 116, 97, 116, 115, 7, 119, 103, 11, 
+99, 111, 110, 99, 97, 116, 10, 116, 97, 98, 108, 101, 11, 102, 111, 114, 
+109, 97, 116, 11, 115, 116, 114, 105, 110, 103, 0, 
+};
+
+/* This is src/lua/addons/widescreen.lua */
+static const char file_36[] = {
+27, 76, 74, 2, 10, 111, 0, 1, 6, 0, 6, 0, 13, 54, 1, 0, 
+0, 57, 1, 1, 1, 15, 0, 1, 0, 88, 2, 3, 128, 57, 2, 2, 
+1, 14, 0, 2, 0, 88, 2, 1, 128, 76, 0, 2, 0, 54, 2, 3, 
+0, 57, 2, 4, 2, 18, 4, 0, 0, 57, 5, 5, 1, 68, 2, 3, 
+0, 13, 109, 97, 120, 119, 105, 100, 116, 104, 8, 109, 105, 110, 9, 109, 
+97, 116, 104, 12, 101, 110, 97, 98, 108, 101, 100, 15, 119, 105, 100, 101, 
+115, 99, 114, 101, 101, 110, 19, 71, 108, 111, 98, 97, 108, 83, 101, 116, 
+116, 105, 110, 103, 115, 88, 0, 0, 2, 0, 3, 0, 8, 54, 0, 0, 
+0, 54, 1, 0, 0, 57, 1, 1, 1, 14, 0, 1, 0, 88, 2, 1, 
+128, 53, 1, 2, 0, 61, 1, 1, 0, 75, 0, 1, 0, 1, 0, 2, 
+12, 101, 110, 97, 98, 108, 101, 100, 1, 13, 109, 97, 120, 119, 105, 100, 
+116, 104, 3, 80, 15, 119, 105, 100, 101, 115, 99, 114, 101, 101, 110, 19, 
+71, 108, 111, 98, 97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 182, 6, 
+0, 0, 11, 0, 26, 0, 64, 54, 0, 0, 0, 57, 0, 1, 0, 54, 
+1, 2, 0, 57, 1, 3, 1, 53, 3, 4, 0, 57, 4, 5, 0, 61, 
+4, 6, 3, 66, 1, 2, 2, 54, 2, 2, 0, 57, 2, 7, 2, 53, 
+4, 8, 0, 54, 5, 9, 0, 57, 7, 10, 0, 66, 5, 2, 2, 61, 
+5, 6, 4, 66, 2, 2, 2, 53, 3, 11, 0, 54, 4, 2, 0, 57, 
+4, 12, 4, 61, 4, 13, 3, 62, 1, 1, 3, 54, 4, 2, 0, 57, 
+4, 14, 4, 53, 6, 15, 0, 54, 7, 2, 0, 57, 7, 16, 7, 61, 
+7, 17, 6, 66, 4, 2, 2, 62, 4, 2, 3, 62, 2, 3, 3, 85, 
+4, 31, 128, 54, 4, 2, 0, 57, 4, 18, 4, 18, 6, 3, 0, 54, 
+7, 19, 0, 39, 8, 20, 0, 66, 4, 4, 2, 14, 0, 4, 0, 88, 
+5, 2, 128, 43, 5, 1, 0, 76, 5, 2, 0, 57, 5, 6, 1, 54, 
+6, 21, 0, 57, 8, 6, 2, 66, 6, 2, 2, 15, 0, 6, 0, 88, 
+7, 3, 128, 41, 7, 20, 0, 1, 6, 7, 0, 88, 7, 5, 128, 54, 
+7, 22, 0, 39, 9, 23, 0, 39, 10, 24, 0, 66, 7, 3, 1, 88, 
+7, 231, 127, 61, 5, 5, 0, 61, 6, 10, 0, 54, 7, 25, 0, 66, 
+7, 1, 1, 43, 7, 2, 0, 76, 7, 2, 0, 88, 4, 224, 127, 43, 
+4, 1, 0, 76, 4, 2, 0, 23, 83, 97, 118, 101, 71, 108, 111, 98, 
+97, 108, 83, 101, 116, 116, 105, 110, 103, 115, 65, 84, 104, 101, 32, 109, 
+97, 120, 105, 109, 117, 109, 32, 119, 105, 100, 116, 104, 32, 109, 117, 115, 
+116, 32, 98, 101, 32, 97, 32, 118, 97, 108, 105, 100, 32, 110, 117, 109, 
+98, 101, 114, 32, 116, 104, 97, 116, 39, 115, 32, 97, 116, 32, 108, 101, 
+97, 115, 116, 32, 50, 48, 46, 20, 80, 97, 114, 97, 109, 101, 116, 101, 
+114, 32, 101, 114, 114, 111, 114, 17, 77, 111, 100, 97, 108, 77, 101, 115, 
+115, 97, 103, 101, 13, 116, 111, 110, 117, 109, 98, 101, 114, 57, 83, 80, 
+65, 67, 69, 32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 82, 
+69, 84, 85, 82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 
+44, 32, 67, 84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 
+101, 108, 17, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 8, 
+82, 117, 110, 10, 97, 108, 105, 103, 110, 9, 76, 101, 102, 116, 1, 0, 
+6, 10, 118, 97, 108, 117, 101, 27, 77, 97, 120, 105, 109, 117, 109, 32, 
+97, 108, 108, 111, 119, 101, 100, 32, 119, 105, 100, 116, 104, 58, 7, 121, 
+50, 3, 3, 7, 120, 50, 3, 32, 7, 121, 49, 3, 3, 7, 120, 49, 
+3, 1, 10, 97, 108, 105, 103, 110, 0, 10, 76, 97, 98, 101, 108, 10, 
+119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 1, 0, 7, 14, 75, 
+69, 89, 95, 69, 78, 84, 69, 82, 12, 99, 111, 110, 102, 105, 114, 109, 
+11, 75, 69, 89, 95, 94, 67, 11, 99, 97, 110, 99, 101, 108, 13, 115, 
+116, 114, 101, 116, 99, 104, 121, 1, 11, 104, 101, 105, 103, 104, 116, 3, 
+5, 15, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 12, 99, 111, 110, 
+102, 105, 114, 109, 10, 119, 105, 100, 116, 104, 0, 10, 116, 105, 116, 108, 
+101, 30, 67, 111, 110, 102, 105, 103, 117, 114, 101, 32, 87, 105, 100, 101, 
+115, 99, 114, 101, 101, 110, 32, 77, 111, 100, 101, 13, 109, 97, 120, 119, 
+105, 100, 116, 104, 13, 116, 111, 115, 116, 114, 105, 110, 103, 1, 0, 5, 
+10, 118, 97, 108, 117, 101, 0, 7, 121, 50, 3, 3, 7, 120, 50, 3, 
+43, 7, 121, 49, 3, 3, 7, 120, 49, 3, 33, 14, 84, 101, 120, 116, 
+70, 105, 101, 108, 100, 10, 118, 97, 108, 117, 101, 12, 101, 110, 97, 98, 
+108, 101, 100, 1, 0, 6, 10, 108, 97, 98, 101, 108, 27, 69, 110, 97, 
+98, 108, 101, 32, 119, 105, 100, 101, 115, 99, 114, 101, 101, 110, 32, 109, 
+111, 100, 101, 10, 118, 97, 108, 117, 101, 0, 7, 121, 50, 3, 1, 7, 
+120, 50, 3, 33, 7, 121, 49, 3, 1, 7, 120, 49, 3, 1, 13, 67, 
+104, 101, 99, 107, 98, 111, 120, 9, 70, 111, 114, 109, 15, 119, 105, 100, 
+101, 115, 99, 114, 101, 101, 110, 19, 71, 108, 111, 98, 97, 108, 83, 101, 
+116, 116, 105, 110, 103, 115, 143, 1, 3, 0, 5, 0, 9, 0, 12, 51, 
+0, 0, 0, 55, 0, 1, 0, 51, 0, 2, 0, 54, 1, 3, 0, 54, 
+3, 4, 0, 57, 3, 5, 3, 18, 4, 0, 0, 66, 1, 3, 1, 54, 
+0, 6, 0, 51, 1, 8, 0, 61, 1, 7, 0, 75, 0, 1, 0, 0, 
+24, 67, 111, 110, 102, 105, 103, 117, 114, 101, 87, 105, 100, 101, 115, 99, 
+114, 101, 101, 110, 8, 67, 109, 100, 19, 82, 101, 103, 105, 115, 116, 101, 
+114, 65, 100, 100, 111, 110, 115, 10, 69, 118, 101, 110, 116, 21, 65, 100, 
+100, 69, 118, 101, 110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 27, 
+71, 101, 116, 77, 97, 120, 105, 109, 117, 109, 65, 108, 108, 111, 119, 101, 
+100, 87, 105, 100, 116, 104, 0, 0, 
+};
+
+/* This is src/lua/addons/keymapoverride.lua */
+static const char file_37[] = {
+27, 76, 74, 2, 10, 104, 0, 2, 6, 1, 2, 0, 10, 14, 0, 1, 
+0, 88, 2, 5, 128, 54, 2, 0, 0, 39, 4, 1, 0, 18, 5, 0, 
+0, 38, 4, 5, 4, 66, 2, 2, 1, 45, 2, 0, 0, 60, 1, 0, 
+2, 75, 0, 1, 0, 0, 192, 53, 121, 111, 117, 32, 116, 114, 105, 101, 
+100, 32, 116, 111, 32, 109, 97, 112, 32, 115, 111, 109, 101, 116, 104, 105, 
+110, 103, 32, 73, 32, 100, 111, 110, 39, 116, 32, 114, 101, 99, 111, 103, 
+110, 105, 115, 101, 32, 116, 111, 32, 10, 101, 114, 114, 111, 114, 21, 0, 
+1, 2, 1, 0, 0, 3, 45, 1, 0, 0, 56, 1, 0, 1, 76, 1, 
+2, 0, 0, 192, 68, 3, 0, 2, 0, 4, 0, 7, 52, 0, 0, 0, 
+51, 1, 0, 0, 55, 1, 1, 0, 51, 1, 2, 0, 55, 1, 3, 0, 
+50, 0, 0, 128, 75, 0, 1, 0, 23, 67, 104, 101, 99, 107, 79, 118, 
+101, 114, 114, 105, 100, 101, 84, 97, 98, 108, 101, 0, 16, 79, 118, 101, 
+114, 114, 105, 100, 101, 75, 101, 121, 0, 0, 
+};
+
+/* This is src/lua/addons/smartquotes.lua */
+static const char file_38[] = {
+27, 76, 74, 2, 10, 44, 0, 1, 6, 0, 3, 0, 6, 18, 3, 0, 
+0, 57, 1, 0, 0, 39, 4, 1, 0, 39, 5, 2, 0, 66, 1, 4, 
+2, 76, 1, 2, 0, 9, 37, 37, 37, 37, 7, 37, 37, 9, 103, 115, 
+117, 98, 138, 3, 0, 3, 11, 1, 20, 0, 57, 54, 3, 0, 0, 57, 
+3, 1, 3, 57, 3, 2, 3, 14, 0, 3, 0, 88, 4, 1, 128, 52, 
+3, 0, 0, 57, 4, 3, 3, 15, 0, 4, 0, 88, 5, 47, 128, 57, 
+4, 4, 2, 57, 4, 5, 4, 57, 4, 6, 4, 6, 4, 7, 0, 88, 
+4, 42, 128, 57, 4, 8, 3, 15, 0, 4, 0, 88, 5, 18, 128, 57, 
+4, 9, 2, 18, 6, 4, 0, 57, 4, 10, 4, 39, 7, 11, 0, 45, 
+8, 0, 0, 57, 10, 12, 3, 66, 8, 2, 0, 65, 4, 2, 2, 61, 
+4, 9, 2, 57, 4, 9, 2, 18, 6, 4, 0, 57, 4, 10, 4, 39, 
+7, 13, 0, 45, 8, 0, 0, 57, 10, 14, 3, 66, 8, 2, 0, 65, 
+4, 2, 2, 61, 4, 9, 2, 57, 4, 15, 3, 15, 0, 4, 0, 88, 
+5, 18, 128, 57, 4, 9, 2, 18, 6, 4, 0, 57, 4, 10, 4, 39, 
+7, 16, 0, 45, 8, 0, 0, 57, 10, 17, 3, 66, 8, 2, 0, 65, 
+4, 2, 2, 61, 4, 9, 2, 57, 4, 9, 2, 18, 6, 4, 0, 57, 
+4, 10, 4, 39, 7, 18, 0, 45, 8, 0, 0, 57, 10, 19, 3, 66, 
+8, 2, 0, 65, 4, 2, 2, 61, 4, 9, 2, 75, 0, 1, 0, 0, 
+192, 16, 114, 105, 103, 104, 116, 115, 105, 110, 103, 108, 101, 6, 39, 15, 
+108, 101, 102, 116, 115, 105, 110, 103, 108, 101, 7, 94, 39, 17, 115, 105, 
+110, 103, 108, 101, 113, 117, 111, 116, 101, 115, 16, 114, 105, 103, 104, 116, 
+100, 111, 117, 98, 108, 101, 6, 34, 15, 108, 101, 102, 116, 100, 111, 117, 
+98, 108, 101, 7, 94, 34, 9, 103, 115, 117, 98, 9, 119, 111, 114, 100, 
+17, 100, 111, 117, 98, 108, 101, 113, 117, 111, 116, 101, 115, 8, 82, 65, 
+87, 9, 110, 97, 109, 101, 10, 115, 116, 121, 108, 101, 14, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 13, 110, 111, 116, 105, 110, 114, 97, 119, 16, 
+115, 109, 97, 114, 116, 113, 117, 111, 116, 101, 115, 11, 97, 100, 100, 111, 
+110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 181, 1, 
+0, 0, 2, 0, 4, 0, 10, 54, 0, 0, 0, 57, 0, 1, 0, 54, 
+1, 0, 0, 57, 1, 1, 1, 57, 1, 2, 1, 14, 0, 1, 0, 88, 
+2, 1, 128, 53, 1, 3, 0, 61, 1, 2, 0, 75, 0, 1, 0, 1, 
+0, 7, 16, 114, 105, 103, 104, 116, 100, 111, 117, 98, 108, 101, 8, 226, 
+128, 157, 13, 110, 111, 116, 105, 110, 114, 97, 119, 2, 15, 108, 101, 102, 
+116, 100, 111, 117, 98, 108, 101, 8, 226, 128, 156, 16, 114, 105, 103, 104, 
+116, 115, 105, 110, 103, 108, 101, 8, 226, 128, 153, 17, 100, 111, 117, 98, 
+108, 101, 113, 117, 111, 116, 101, 115, 1, 15, 108, 101, 102, 116, 115, 105, 
+110, 103, 108, 101, 8, 226, 128, 152, 17, 115, 105, 110, 103, 108, 101, 113, 
+117, 111, 116, 101, 115, 1, 16, 115, 109, 97, 114, 116, 113, 117, 111, 116, 
+101, 115, 11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 
+110, 116, 83, 101, 116, 175, 13, 0, 0, 14, 0, 41, 1, 150, 1, 54, 
+0, 0, 0, 57, 0, 1, 0, 57, 0, 2, 0, 54, 1, 3, 0, 57, 
+1, 4, 1, 53, 3, 5, 0, 57, 4, 6, 0, 61, 4, 7, 3, 66, 
+1, 2, 2, 54, 2, 3, 0, 57, 2, 4, 2, 53, 4, 8, 0, 57, 
+5, 9, 0, 61, 5, 7, 4, 66, 2, 2, 2, 54, 3, 3, 0, 57, 
+3, 10, 3, 53, 5, 11, 0, 54, 6, 12, 0, 57, 8, 13, 0, 66, 
+6, 2, 2, 61, 6, 7, 5, 66, 3, 2, 2, 54, 4, 3, 0, 57, 
+4, 10, 4, 53, 6, 14, 0, 54, 7, 12, 0, 57, 9, 15, 0, 66, 
+7, 2, 2, 61, 7, 7, 6, 66, 4, 2, 2, 54, 5, 3, 0, 57, 
+5, 10, 5, 53, 7, 16, 0, 54, 8, 12, 0, 57, 10, 17, 0, 66, 
+8, 2, 2, 61, 8, 7, 7, 66, 5, 2, 2, 54, 6, 3, 0, 57, 
+6, 10, 6, 53, 8, 18, 0, 54, 9, 12, 0, 57, 11, 19, 0, 66, 
+9, 2, 2, 61, 9, 7, 8, 66, 6, 2, 2, 54, 7, 3, 0, 57, 
+7, 4, 7, 53, 9, 20, 0, 57, 10, 21, 0, 61, 10, 7, 9, 66, 
+7, 2, 2, 53, 8, 22, 0, 54, 9, 3, 0, 57, 9, 23, 9, 61, 
+9, 24, 8, 62, 1, 1, 8, 62, 2, 2, 8, 62, 3, 3, 8, 62, 
+4, 4, 8, 62, 5, 5, 8, 62, 6, 6, 8, 62, 7, 7, 8, 54, 
+9, 3, 0, 57, 9, 25, 9, 53, 11, 26, 0, 54, 12, 3, 0, 57, 
+12, 27, 12, 61, 12, 28, 11, 66, 9, 2, 2, 62, 9, 8, 8, 54, 
+9, 3, 0, 57, 9, 25, 9, 53, 11, 29, 0, 54, 12, 3, 0, 57, 
+12, 27, 12, 61, 12, 28, 11, 66, 9, 2, 2, 62, 9, 9, 8, 54, 
+9, 3, 0, 57, 9, 25, 9, 53, 11, 30, 0, 54, 12, 3, 0, 57, 
+12, 27, 12, 61, 12, 28, 11, 66, 9, 2, 2, 62, 9, 10, 8, 54, 
+9, 3, 0, 57, 9, 25, 9, 53, 11, 31, 0, 54, 12, 3, 0, 57, 
+12, 27, 12, 61, 12, 28, 11, 66, 9, 2, 2, 62, 9, 11, 8, 54, 
+9, 3, 0, 57, 9, 25, 9, 53, 11, 32, 0, 54, 12, 3, 0, 57, 
+12, 27, 12, 61, 12, 28, 11, 66, 9, 2, 2, 62, 9, 12, 8, 54, 
+9, 3, 0, 57, 9, 25, 9, 53, 11, 33, 0, 54, 12, 3, 0, 57, 
+12, 27, 12, 61, 12, 28, 11, 66, 9, 2, 2, 62, 9, 13, 8, 54, 
+9, 3, 0, 57, 9, 25, 9, 53, 11, 34, 0, 54, 12, 3, 0, 57, 
+12, 35, 12, 61, 12, 28, 11, 66, 9, 2, 0, 63, 9, 0, 0, 54, 
+9, 3, 0, 57, 9, 36, 9, 18, 11, 8, 0, 54, 12, 37, 0, 39, 
+13, 38, 0, 66, 9, 4, 2, 14, 0, 9, 0, 88, 10, 2, 128, 43, 
+10, 1, 0, 76, 10, 2, 0, 57, 10, 7, 1, 61, 10, 6, 0, 57, 
+10, 7, 2, 61, 10, 9, 0, 57, 10, 7, 3, 61, 10, 13, 0, 57, 
+10, 7, 4, 61, 10, 15, 0, 57, 10, 7, 5, 61, 10, 17, 0, 57, 
+10, 7, 6, 61, 10, 19, 0, 57, 10, 7, 7, 61, 10, 39, 0, 54, 
+10, 0, 0, 18, 12, 10, 0, 57, 10, 40, 10, 66, 10, 2, 1, 43, 
+10, 2, 0, 76, 10, 2, 0, 10, 116, 111, 117, 99, 104, 19, 110, 111, 
+116, 105, 110, 114, 97, 119, 113, 117, 111, 116, 101, 115, 57, 83, 80, 65, 
+67, 69, 32, 116, 111, 32, 116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 
+84, 85, 82, 78, 32, 116, 111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 
+32, 67, 84, 82, 76, 43, 67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 
+108, 17, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 8, 82, 
+117, 110, 11, 67, 101, 110, 116, 114, 101, 1, 0, 6, 10, 118, 97, 108, 
+117, 101, 55, 84, 111, 32, 97, 112, 112, 108, 121, 32, 116, 111, 32, 101, 
+120, 105, 115, 116, 105, 110, 103, 32, 116, 101, 120, 116, 44, 32, 99, 111, 
+112, 121, 32, 97, 110, 100, 32, 116, 104, 101, 110, 32, 112, 97, 115, 116, 
+101, 32, 105, 116, 46, 7, 121, 50, 3, 11, 7, 120, 50, 3, 255, 255, 
+255, 255, 15, 7, 121, 49, 3, 11, 7, 120, 49, 3, 1, 10, 97, 108, 
+105, 103, 110, 0, 1, 0, 6, 10, 118, 97, 108, 117, 101, 7, 82, 58, 
+7, 121, 50, 3, 7, 7, 120, 50, 3, 49, 7, 121, 49, 3, 7, 7, 
+120, 49, 3, 48, 10, 97, 108, 105, 103, 110, 0, 1, 0, 6, 10, 118, 
+97, 108, 117, 101, 7, 76, 58, 7, 121, 50, 3, 7, 7, 120, 50, 3, 
+39, 7, 121, 49, 3, 7, 7, 120, 49, 3, 38, 10, 97, 108, 105, 103, 
+110, 0, 1, 0, 6, 10, 118, 97, 108, 117, 101, 33, 84, 101, 120, 116, 
+32, 117, 115, 101, 100, 32, 102, 111, 114, 32, 100, 111, 117, 98, 108, 101, 
+32, 113, 117, 111, 116, 101, 115, 58, 7, 121, 50, 3, 7, 7, 120, 50, 
+3, 32, 7, 121, 49, 3, 7, 7, 120, 49, 3, 1, 10, 97, 108, 105, 
+103, 110, 0, 1, 0, 6, 10, 118, 97, 108, 117, 101, 7, 82, 58, 7, 
+121, 50, 3, 5, 7, 120, 50, 3, 49, 7, 121, 49, 3, 5, 7, 120, 
+49, 3, 48, 10, 97, 108, 105, 103, 110, 0, 1, 0, 6, 10, 118, 97, 
+108, 117, 101, 7, 76, 58, 7, 121, 50, 3, 5, 7, 120, 50, 3, 39, 
+7, 121, 49, 3, 5, 7, 120, 49, 3, 38, 10, 97, 108, 105, 103, 110, 
+0, 10, 97, 108, 105, 103, 110, 9, 76, 101, 102, 116, 1, 0, 6, 10, 
+118, 97, 108, 117, 101, 33, 84, 101, 120, 116, 32, 117, 115, 101, 100, 32, 
+102, 111, 114, 32, 115, 105, 110, 103, 108, 101, 32, 113, 117, 111, 116, 101, 
+115, 58, 7, 121, 50, 3, 5, 7, 120, 50, 3, 32, 7, 121, 49, 3, 
+5, 7, 120, 49, 3, 1, 10, 97, 108, 105, 103, 110, 0, 10, 76, 97, 
+98, 101, 108, 10, 119, 105, 100, 116, 104, 10, 76, 97, 114, 103, 101, 1, 
+0, 7, 14, 75, 69, 89, 95, 69, 78, 84, 69, 82, 12, 99, 111, 110, 
+102, 105, 114, 109, 10, 116, 105, 116, 108, 101, 27, 67, 111, 110, 102, 105, 
+103, 117, 114, 101, 32, 83, 109, 97, 114, 116, 32, 81, 117, 111, 116, 101, 
+115, 13, 115, 116, 114, 101, 116, 99, 104, 121, 1, 11, 75, 69, 89, 95, 
+94, 67, 11, 99, 97, 110, 99, 101, 108, 15, 75, 69, 89, 95, 82, 69, 
+84, 85, 82, 78, 12, 99, 111, 110, 102, 105, 114, 109, 10, 119, 105, 100, 
+116, 104, 0, 11, 104, 101, 105, 103, 104, 116, 3, 13, 13, 110, 111, 116, 
+105, 110, 114, 97, 119, 1, 0, 6, 10, 108, 97, 98, 101, 108, 37, 68, 
+111, 110, 39, 116, 32, 99, 111, 110, 118, 101, 114, 116, 32, 105, 110, 32, 
+82, 65, 87, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 115, 58, 10, 
+118, 97, 108, 117, 101, 0, 7, 121, 50, 3, 1, 7, 120, 50, 3, 38, 
+7, 121, 49, 3, 9, 7, 120, 49, 3, 1, 16, 114, 105, 103, 104, 116, 
+100, 111, 117, 98, 108, 101, 1, 0, 5, 10, 118, 97, 108, 117, 101, 0, 
+7, 121, 50, 3, 7, 7, 120, 50, 3, 56, 7, 121, 49, 3, 7, 7, 
+120, 49, 3, 51, 15, 108, 101, 102, 116, 100, 111, 117, 98, 108, 101, 1, 
+0, 5, 10, 118, 97, 108, 117, 101, 0, 7, 121, 50, 3, 7, 7, 120, 
+50, 3, 46, 7, 121, 49, 3, 7, 7, 120, 49, 3, 41, 16, 114, 105, 
+103, 104, 116, 115, 105, 110, 103, 108, 101, 1, 0, 5, 10, 118, 97, 108, 
+117, 101, 0, 7, 121, 50, 3, 5, 7, 120, 50, 3, 56, 7, 121, 49, 
+3, 5, 7, 120, 49, 3, 51, 15, 108, 101, 102, 116, 115, 105, 110, 103, 
+108, 101, 13, 116, 111, 115, 116, 114, 105, 110, 103, 1, 0, 5, 10, 118, 
+97, 108, 117, 101, 0, 7, 121, 50, 3, 5, 7, 120, 50, 3, 46, 7, 
+121, 49, 3, 5, 7, 120, 49, 3, 41, 14, 84, 101, 120, 116, 70, 105, 
+101, 108, 100, 17, 100, 111, 117, 98, 108, 101, 113, 117, 111, 116, 101, 115, 
+1, 0, 6, 10, 108, 97, 98, 101, 108, 40, 67, 111, 110, 118, 101, 114, 
+116, 32, 100, 111, 117, 98, 108, 101, 32, 113, 117, 111, 116, 101, 115, 32, 
+119, 104, 105, 108, 101, 32, 116, 121, 112, 105, 110, 103, 58, 10, 118, 97, 
+108, 117, 101, 0, 7, 121, 50, 3, 3, 7, 120, 50, 3, 38, 7, 121, 
+49, 3, 3, 7, 120, 49, 3, 1, 10, 118, 97, 108, 117, 101, 17, 115, 
+105, 110, 103, 108, 101, 113, 117, 111, 116, 101, 115, 1, 0, 6, 10, 108, 
+97, 98, 101, 108, 40, 67, 111, 110, 118, 101, 114, 116, 32, 115, 105, 110, 
+103, 108, 101, 32, 113, 117, 111, 116, 101, 115, 32, 119, 104, 105, 108, 101, 
+32, 116, 121, 112, 105, 110, 103, 58, 10, 118, 97, 108, 117, 101, 0, 7, 
+121, 50, 3, 1, 7, 120, 50, 3, 38, 7, 121, 49, 3, 1, 7, 120, 
+49, 3, 1, 13, 67, 104, 101, 99, 107, 98, 111, 120, 9, 70, 111, 114, 
+109, 16, 115, 109, 97, 114, 116, 113, 117, 111, 116, 101, 115, 11, 97, 100, 
+100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 
+29, 128, 128, 192, 153, 4, 159, 1, 3, 0, 6, 0, 10, 0, 18, 51, 
+0, 0, 0, 51, 1, 1, 0, 54, 2, 2, 0, 54, 4, 3, 0, 57, 
+4, 4, 4, 18, 5, 1, 0, 66, 2, 3, 1, 50, 0, 0, 128, 51, 
+0, 5, 0, 54, 1, 2, 0, 54, 3, 3, 0, 57, 3, 6, 3, 18, 
+4, 0, 0, 66, 1, 3, 1, 54, 0, 7, 0, 51, 1, 9, 0, 61, 
+1, 8, 0, 75, 0, 1, 0, 0, 25, 67, 111, 110, 102, 105, 103, 117, 
+114, 101, 83, 109, 97, 114, 116, 81, 117, 111, 116, 101, 115, 8, 67, 109, 
+100, 19, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 111, 110, 115, 
+0, 17, 87, 111, 114, 100, 77, 111, 100, 105, 102, 105, 101, 100, 10, 69, 
+118, 101, 110, 116, 21, 65, 100, 100, 69, 118, 101, 110, 116, 76, 105, 115, 
+116, 101, 110, 101, 114, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/undo.lua */
+static const char file_39[] = {
+27, 76, 74, 2, 10, 83, 0, 2, 8, 0, 0, 0, 19, 21, 2, 0, 
+0, 21, 3, 1, 0, 4, 2, 3, 0, 88, 2, 2, 128, 43, 2, 1, 
+0, 76, 2, 2, 0, 41, 2, 1, 0, 21, 3, 0, 0, 41, 4, 1, 
+0, 77, 2, 7, 128, 56, 6, 5, 0, 56, 7, 5, 1, 4, 6, 7, 
+0, 88, 6, 2, 128, 43, 6, 1, 0, 76, 6, 2, 0, 79, 2, 249, 
+127, 43, 2, 2, 0, 76, 2, 2, 0, 50, 0, 1, 9, 0, 1, 0, 
+9, 52, 1, 0, 0, 54, 2, 0, 0, 18, 4, 0, 0, 66, 2, 2, 
+4, 88, 5, 1, 128, 60, 6, 5, 1, 69, 5, 3, 3, 82, 5, 253, 
+127, 76, 1, 2, 0, 11, 105, 112, 97, 105, 114, 115, 79, 0, 0, 4, 
+1, 4, 0, 13, 45, 0, 0, 0, 54, 2, 0, 0, 66, 0, 2, 2, 
+54, 1, 0, 0, 57, 1, 1, 1, 54, 2, 0, 0, 57, 2, 2, 2, 
+54, 3, 0, 0, 57, 3, 3, 3, 61, 3, 3, 0, 61, 2, 2, 0, 
+61, 1, 1, 0, 76, 0, 2, 0, 2, 192, 7, 99, 111, 7, 99, 119, 
+7, 99, 112, 13, 68, 111, 99, 117, 109, 101, 110, 116, 199, 1, 0, 1, 
+8, 0, 7, 1, 38, 54, 1, 0, 0, 21, 1, 1, 0, 41, 2, 1, 
+0, 21, 3, 0, 0, 41, 4, 1, 0, 77, 2, 4, 128, 54, 6, 0, 
+0, 56, 7, 5, 0, 60, 7, 5, 6, 79, 2, 252, 127, 21, 2, 0, 
+0, 22, 2, 0, 2, 18, 3, 1, 0, 41, 4, 1, 0, 77, 2, 4, 
+128, 54, 6, 0, 0, 43, 7, 0, 0, 60, 7, 5, 6, 79, 2, 252, 
+127, 54, 2, 0, 0, 54, 3, 0, 0, 54, 4, 0, 0, 57, 5, 1, 
+0, 57, 6, 2, 0, 57, 7, 3, 0, 61, 7, 3, 4, 61, 6, 2, 
+3, 61, 5, 1, 2, 54, 2, 0, 0, 43, 3, 0, 0, 61, 3, 4, 
+2, 54, 2, 0, 0, 18, 4, 2, 0, 57, 2, 5, 2, 66, 2, 2, 
+1, 54, 2, 6, 0, 66, 2, 1, 1, 75, 0, 1, 0, 16, 81, 117, 
+101, 117, 101, 82, 101, 100, 114, 97, 119, 10, 112, 117, 114, 103, 101, 7, 
+109, 112, 7, 99, 111, 7, 99, 119, 7, 99, 112, 13, 68, 111, 99, 117, 
+109, 101, 110, 116, 2, 119, 0, 2, 9, 2, 3, 0, 22, 58, 2, 1, 
+0, 14, 0, 2, 0, 88, 3, 2, 128, 43, 3, 1, 0, 76, 3, 2, 
+0, 54, 3, 0, 0, 57, 3, 1, 3, 18, 5, 0, 0, 41, 6, 1, 
+0, 66, 3, 3, 1, 54, 3, 0, 0, 57, 3, 2, 3, 18, 5, 1, 
+0, 41, 6, 1, 0, 45, 7, 0, 0, 66, 7, 1, 0, 65, 3, 2, 
+1, 45, 3, 1, 0, 18, 5, 2, 0, 66, 3, 2, 1, 43, 3, 2, 
+0, 76, 3, 2, 0, 3, 192, 4, 192, 11, 105, 110, 115, 101, 114, 116, 
+11, 114, 101, 109, 111, 118, 101, 10, 116, 97, 98, 108, 101, 185, 1, 0, 
+0, 8, 3, 5, 0, 32, 54, 0, 0, 0, 57, 0, 1, 0, 14, 0, 
+0, 0, 88, 1, 1, 128, 52, 0, 0, 0, 54, 1, 0, 0, 61, 0, 
+1, 1, 58, 1, 1, 0, 15, 0, 1, 0, 88, 2, 6, 128, 45, 2, 
+0, 0, 54, 4, 0, 0, 18, 5, 1, 0, 66, 2, 3, 2, 14, 0, 
+2, 0, 88, 2, 14, 128, 45, 2, 1, 0, 66, 2, 1, 2, 54, 3, 
+2, 0, 57, 3, 3, 3, 18, 5, 0, 0, 41, 6, 1, 0, 18, 7, 
+2, 0, 66, 3, 4, 1, 45, 3, 2, 0, 43, 4, 0, 0, 60, 4, 
+3, 0, 54, 3, 0, 0, 52, 4, 0, 0, 61, 4, 4, 3, 43, 2, 
+2, 0, 76, 2, 2, 0, 1, 192, 3, 192, 0, 192, 15, 95, 114, 101, 
+100, 111, 115, 116, 97, 99, 107, 11, 105, 110, 115, 101, 114, 116, 10, 116, 
+97, 98, 108, 101, 15, 95, 117, 110, 100, 111, 115, 116, 97, 99, 107, 13, 
+68, 111, 99, 117, 109, 101, 110, 116, 128, 2, 0, 0, 5, 1, 7, 0, 
+37, 54, 0, 0, 0, 54, 1, 0, 0, 57, 1, 1, 1, 14, 0, 1, 
+0, 88, 2, 1, 128, 52, 1, 0, 0, 61, 1, 1, 0, 54, 0, 0, 
+0, 54, 1, 0, 0, 57, 1, 2, 1, 14, 0, 1, 0, 88, 2, 1, 
+128, 52, 1, 0, 0, 61, 1, 2, 0, 45, 0, 0, 0, 54, 2, 0, 
+0, 57, 2, 1, 2, 54, 3, 0, 0, 57, 3, 2, 3, 66, 0, 3, 
+2, 14, 0, 0, 0, 88, 0, 5, 128, 54, 0, 3, 0, 39, 2, 4, 
+0, 66, 0, 2, 1, 43, 0, 1, 0, 76, 0, 2, 0, 54, 0, 3, 
+0, 39, 2, 5, 0, 54, 3, 0, 0, 57, 3, 1, 3, 21, 3, 3, 
+0, 39, 4, 6, 0, 38, 2, 4, 2, 66, 0, 2, 1, 43, 0, 2, 
+0, 76, 0, 2, 0, 5, 192, 26, 32, 108, 101, 102, 116, 32, 105, 110, 
+32, 117, 110, 100, 111, 32, 98, 117, 102, 102, 101, 114, 41, 13, 85, 110, 
+100, 111, 110, 101, 32, 40, 25, 78, 111, 116, 104, 105, 110, 103, 32, 108, 
+101, 102, 116, 32, 116, 111, 32, 117, 110, 100, 111, 20, 78, 111, 110, 109, 
+111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 15, 95, 114, 101, 100, 
+111, 115, 116, 97, 99, 107, 15, 95, 117, 110, 100, 111, 115, 116, 97, 99, 
+107, 13, 68, 111, 99, 117, 109, 101, 110, 116, 128, 2, 0, 0, 5, 1, 
+7, 0, 37, 54, 0, 0, 0, 54, 1, 0, 0, 57, 1, 1, 1, 14, 
+0, 1, 0, 88, 2, 1, 128, 52, 1, 0, 0, 61, 1, 1, 0, 54, 
+0, 0, 0, 54, 1, 0, 0, 57, 1, 2, 1, 14, 0, 1, 0, 88, 
+2, 1, 128, 52, 1, 0, 0, 61, 1, 2, 0, 45, 0, 0, 0, 54, 
+2, 0, 0, 57, 2, 2, 2, 54, 3, 0, 0, 57, 3, 1, 3, 66, 
+0, 3, 2, 14, 0, 0, 0, 88, 0, 5, 128, 54, 0, 3, 0, 39, 
+2, 4, 0, 66, 0, 2, 1, 43, 0, 1, 0, 76, 0, 2, 0, 54, 
+0, 3, 0, 39, 2, 5, 0, 54, 3, 0, 0, 57, 3, 2, 3, 21, 
+3, 3, 0, 39, 4, 6, 0, 38, 2, 4, 2, 66, 0, 2, 1, 43, 
+0, 2, 0, 76, 0, 2, 0, 5, 192, 26, 32, 108, 101, 102, 116, 32, 
+105, 110, 32, 114, 101, 100, 111, 32, 98, 117, 102, 102, 101, 114, 41, 13, 
+82, 101, 100, 111, 110, 101, 32, 40, 25, 78, 111, 116, 104, 105, 110, 103, 
+32, 108, 101, 102, 116, 32, 116, 111, 32, 114, 101, 100, 111, 20, 78, 111, 
+110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 15, 95, 114, 
+101, 100, 111, 115, 116, 97, 99, 107, 15, 95, 117, 110, 100, 111, 115, 116, 
+97, 99, 107, 13, 68, 111, 99, 117, 109, 101, 110, 116, 108, 3, 0, 8, 
+0, 12, 0, 17, 41, 0, 244, 1, 51, 1, 0, 0, 51, 2, 1, 0, 
+51, 3, 2, 0, 51, 4, 3, 0, 51, 5, 4, 0, 54, 6, 5, 0, 
+51, 7, 7, 0, 61, 7, 6, 6, 54, 6, 5, 0, 51, 7, 9, 0, 
+61, 7, 8, 6, 54, 6, 5, 0, 51, 7, 11, 0, 61, 7, 10, 6, 
+50, 0, 0, 128, 75, 0, 1, 0, 0, 9, 82, 101, 100, 111, 0, 9, 
+85, 110, 100, 111, 0, 15, 67, 104, 101, 99, 107, 112, 111, 105, 110, 116, 
+8, 67, 109, 100, 0, 0, 0, 0, 0, 0, 
+};
+
+/* This is src/lua/addons/spillchocker.lua */
+static const char file_40[] = {
+27, 76, 74, 2, 10, 93, 0, 0, 2, 0, 4, 0, 10, 54, 0, 0, 
+0, 57, 0, 1, 0, 54, 1, 0, 0, 57, 1, 1, 1, 57, 1, 2, 
+1, 14, 0, 1, 0, 88, 2, 1, 128, 53, 1, 3, 0, 61, 1, 2, 
+0, 75, 0, 1, 0, 1, 0, 1, 14, 104, 105, 103, 104, 108, 105, 103, 
+104, 116, 1, 17, 115, 112, 101, 108, 108, 99, 104, 101, 99, 107, 101, 114, 
+11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 148, 4, 0, 0, 8, 0, 19, 1, 36, 54, 0, 0, 0, 
+57, 0, 1, 0, 57, 0, 2, 0, 54, 1, 3, 0, 57, 1, 4, 1, 
+53, 3, 5, 0, 57, 4, 6, 0, 61, 4, 7, 3, 66, 1, 2, 2, 
+53, 2, 8, 0, 54, 3, 3, 0, 57, 3, 9, 3, 61, 3, 10, 2, 
+62, 1, 1, 2, 54, 3, 3, 0, 57, 3, 11, 3, 53, 5, 12, 0, 
+54, 6, 3, 0, 57, 6, 13, 6, 61, 6, 14, 5, 66, 3, 2, 0, 
+63, 3, 0, 0, 54, 3, 3, 0, 57, 3, 15, 3, 18, 5, 2, 0, 
+54, 6, 16, 0, 39, 7, 17, 0, 66, 3, 4, 2, 14, 0, 3, 0, 
+88, 4, 2, 128, 43, 4, 1, 0, 76, 4, 2, 0, 57, 4, 7, 1, 
+61, 4, 18, 0, 43, 4, 2, 0, 76, 4, 2, 0, 14, 104, 105, 103, 
+104, 108, 105, 103, 104, 116, 57, 83, 80, 65, 67, 69, 32, 116, 111, 32, 
+116, 111, 103, 103, 108, 101, 44, 32, 82, 69, 84, 85, 82, 78, 32, 116, 
+111, 32, 99, 111, 110, 102, 105, 114, 109, 44, 32, 67, 84, 82, 76, 43, 
+67, 32, 116, 111, 32, 99, 97, 110, 99, 101, 108, 17, 82, 101, 100, 114, 
+97, 119, 83, 99, 114, 101, 101, 110, 8, 82, 117, 110, 10, 97, 108, 105, 
+103, 110, 9, 76, 101, 102, 116, 1, 0, 6, 10, 118, 97, 108, 117, 101, 
+28, 68, 105, 115, 112, 108, 97, 121, 32, 109, 105, 115, 115, 112, 101, 108, 
+116, 32, 119, 111, 114, 100, 115, 58, 7, 121, 50, 3, 1, 7, 120, 50, 
+3, 32, 7, 121, 49, 3, 1, 7, 120, 49, 3, 1, 10, 97, 108, 105, 
+103, 110, 0, 10, 76, 97, 98, 101, 108, 10, 119, 105, 100, 116, 104, 10, 
+76, 97, 114, 103, 101, 1, 0, 7, 14, 75, 69, 89, 95, 69, 78, 84, 
+69, 82, 12, 99, 111, 110, 102, 105, 114, 109, 10, 116, 105, 116, 108, 101, 
+27, 67, 111, 110, 102, 105, 103, 117, 114, 101, 32, 83, 112, 101, 108, 108, 
+99, 104, 101, 99, 107, 101, 114, 13, 115, 116, 114, 101, 116, 99, 104, 121, 
+1, 11, 75, 69, 89, 95, 94, 67, 11, 99, 97, 110, 99, 101, 108, 15, 
+75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 12, 99, 111, 110, 102, 105, 
+114, 109, 10, 119, 105, 100, 116, 104, 0, 11, 104, 101, 105, 103, 104, 116, 
+3, 5, 10, 118, 97, 108, 117, 101, 12, 101, 110, 97, 98, 108, 101, 100, 
+1, 0, 6, 10, 108, 97, 98, 101, 108, 5, 10, 118, 97, 108, 117, 101, 
+0, 7, 121, 50, 3, 1, 7, 120, 50, 3, 33, 7, 121, 49, 3, 1, 
+7, 120, 49, 3, 1, 13, 67, 104, 101, 99, 107, 98, 111, 120, 9, 70, 
+111, 114, 109, 17, 115, 112, 101, 108, 108, 99, 104, 101, 99, 107, 101, 114, 
+11, 97, 100, 100, 111, 110, 115, 16, 68, 111, 99, 117, 109, 101, 110, 116, 
+83, 101, 116, 5, 128, 128, 192, 153, 4, 113, 3, 0, 5, 0, 7, 0, 
+10, 51, 0, 0, 0, 54, 1, 1, 0, 54, 3, 2, 0, 57, 3, 3, 
+3, 18, 4, 0, 0, 66, 1, 3, 1, 54, 0, 4, 0, 51, 1, 6, 
+0, 61, 1, 5, 0, 75, 0, 1, 0, 0, 26, 67, 111, 110, 102, 105, 
+103, 117, 114, 101, 83, 112, 101, 108, 108, 99, 104, 101, 99, 107, 101, 114, 
+8, 67, 109, 100, 19, 82, 101, 103, 105, 115, 116, 101, 114, 65, 100, 100, 
+111, 110, 115, 10, 69, 118, 101, 110, 116, 21, 65, 100, 100, 69, 118, 101, 
+110, 116, 76, 105, 115, 116, 101, 110, 101, 114, 0, 0, 
+};
+
+/* This is src/lua/menu.lua */
+static const char file_41[] = {
+27, 76, 74, 2, 10, 249, 3, 0, 3, 14, 2, 14, 1, 93, 18, 5, 
+0, 0, 57, 3, 0, 0, 66, 3, 2, 2, 14, 0, 2, 0, 88, 4, 
+1, 128, 52, 2, 0, 0, 61, 0, 1, 2, 52, 4, 0, 0, 61, 4, 
+2, 2, 54, 4, 3, 0, 18, 6, 2, 0, 66, 4, 2, 4, 88, 7, 
+2, 128, 43, 9, 0, 0, 60, 9, 7, 2, 69, 7, 3, 3, 82, 7, 
+252, 127, 54, 4, 3, 0, 18, 6, 1, 0, 66, 4, 2, 4, 88, 7, 
+68, 128, 7, 8, 4, 0, 88, 9, 5, 128, 21, 9, 2, 0, 22, 9, 
+0, 9, 39, 10, 4, 0, 60, 10, 9, 2, 88, 9, 61, 128, 53, 9, 
+5, 0, 58, 10, 1, 8, 61, 10, 6, 9, 58, 10, 2, 8, 61, 10, 
+7, 9, 58, 10, 3, 8, 61, 10, 1, 9, 58, 10, 4, 8, 61, 10, 
+8, 9, 58, 10, 5, 8, 61, 10, 9, 9, 21, 10, 2, 0, 22, 10, 
+0, 10, 60, 9, 10, 2, 57, 10, 7, 9, 15, 0, 10, 0, 88, 11, 
+13, 128, 57, 10, 2, 2, 57, 11, 7, 9, 56, 10, 11, 10, 15, 0, 
+10, 0, 88, 11, 5, 128, 54, 10, 10, 0, 39, 12, 11, 0, 57, 13, 
+7, 9, 38, 12, 13, 12, 66, 10, 2, 1, 57, 10, 2, 2, 57, 11, 
+7, 9, 60, 9, 11, 10, 45, 10, 0, 0, 57, 11, 6, 9, 56, 10, 
+11, 10, 15, 0, 10, 0, 88, 11, 5, 128, 54, 10, 10, 0, 39, 12, 
+12, 0, 57, 13, 6, 9, 38, 12, 13, 12, 66, 10, 2, 1, 45, 10, 
+0, 0, 57, 11, 6, 9, 60, 9, 11, 10, 57, 10, 8, 9, 15, 0, 
+10, 0, 88, 11, 4, 128, 45, 10, 1, 0, 57, 11, 8, 9, 57, 12, 
+6, 9, 60, 12, 11, 10, 57, 10, 1, 9, 18, 12, 10, 0, 57, 10, 
+0, 10, 66, 10, 2, 2, 1, 3, 10, 0, 88, 10, 5, 128, 57, 10, 
+1, 9, 18, 12, 10, 0, 57, 10, 0, 10, 66, 10, 2, 2, 18, 3, 
+10, 0, 69, 7, 3, 3, 82, 7, 186, 127, 61, 3, 13, 2, 76, 2, 
+2, 0, 10, 192, 11, 192, 13, 109, 97, 120, 119, 105, 100, 116, 104, 22, 
+68, 117, 112, 105, 99, 97, 116, 101, 32, 109, 101, 110, 117, 32, 73, 68, 
+32, 31, 68, 117, 112, 108, 105, 99, 97, 116, 101, 32, 109, 101, 110, 117, 
+32, 97, 99, 116, 105, 111, 110, 32, 107, 101, 121, 32, 10, 101, 114, 114, 
+111, 114, 7, 102, 110, 7, 97, 107, 7, 109, 107, 7, 105, 100, 1, 0, 
+5, 7, 109, 107, 0, 7, 102, 110, 0, 7, 97, 107, 0, 10, 108, 97, 
+98, 101, 108, 0, 7, 105, 100, 0, 6, 45, 11, 105, 112, 97, 105, 114, 
+115, 8, 109, 107, 115, 10, 108, 97, 98, 101, 108, 8, 108, 101, 110, 2, 
+96, 0, 1, 9, 2, 3, 0, 18, 54, 1, 0, 0, 18, 3, 0, 0, 
+66, 1, 2, 4, 88, 4, 11, 128, 45, 6, 0, 0, 57, 7, 1, 5, 
+43, 8, 0, 0, 60, 8, 7, 6, 57, 6, 2, 5, 15, 0, 6, 0, 
+88, 7, 4, 128, 45, 6, 1, 0, 57, 7, 2, 5, 43, 8, 0, 0, 
+60, 8, 7, 6, 69, 4, 3, 3, 82, 4, 243, 127, 75, 0, 1, 0, 
+10, 192, 11, 192, 7, 97, 107, 7, 105, 100, 11, 105, 112, 97, 105, 114, 
+115, 43, 0, 0, 3, 0, 2, 0, 5, 54, 0, 0, 0, 57, 0, 1, 
+0, 41, 2, 1, 0, 66, 0, 2, 1, 75, 0, 1, 0, 16, 83, 101, 
+116, 86, 105, 101, 119, 77, 111, 100, 101, 8, 67, 109, 100, 43, 0, 0, 
+3, 0, 2, 0, 5, 54, 0, 0, 0, 57, 0, 1, 0, 41, 2, 2, 
+0, 66, 0, 2, 1, 75, 0, 1, 0, 16, 83, 101, 116, 86, 105, 101, 
+119, 77, 111, 100, 101, 8, 67, 109, 100, 43, 0, 0, 3, 0, 2, 0, 
+5, 54, 0, 0, 0, 57, 0, 1, 0, 41, 2, 3, 0, 66, 0, 2, 
+1, 75, 0, 1, 0, 16, 83, 101, 116, 86, 105, 101, 119, 77, 111, 100, 
+101, 8, 67, 109, 100, 43, 0, 0, 3, 0, 2, 0, 5, 54, 0, 0, 
+0, 57, 0, 1, 0, 41, 2, 4, 0, 66, 0, 2, 1, 75, 0, 1, 
+0, 16, 83, 101, 116, 86, 105, 101, 119, 77, 111, 100, 101, 8, 67, 109, 
+100, 42, 0, 0, 3, 0, 3, 0, 5, 54, 0, 0, 0, 57, 0, 1, 
+0, 39, 2, 2, 0, 66, 0, 2, 1, 75, 0, 1, 0, 6, 105, 13, 
+83, 101, 116, 83, 116, 121, 108, 101, 8, 67, 109, 100, 42, 0, 0, 3, 
+0, 3, 0, 5, 54, 0, 0, 0, 57, 0, 1, 0, 39, 2, 2, 0, 
+66, 0, 2, 1, 75, 0, 1, 0, 6, 117, 13, 83, 101, 116, 83, 116, 
+121, 108, 101, 8, 67, 109, 100, 42, 0, 0, 3, 0, 3, 0, 5, 54, 
+0, 0, 0, 57, 0, 1, 0, 39, 2, 2, 0, 66, 0, 2, 1, 75, 
+0, 1, 0, 6, 98, 13, 83, 101, 116, 83, 116, 121, 108, 101, 8, 67, 
+109, 100, 42, 0, 0, 3, 0, 3, 0, 5, 54, 0, 0, 0, 57, 0, 
+1, 0, 39, 2, 2, 0, 66, 0, 2, 1, 75, 0, 1, 0, 6, 111, 
+13, 83, 101, 116, 83, 116, 121, 108, 101, 8, 67, 109, 100, 83, 0, 1, 
+4, 0, 3, 0, 14, 54, 1, 0, 0, 18, 3, 0, 0, 66, 1, 2, 
+2, 7, 1, 1, 0, 88, 1, 5, 128, 54, 1, 0, 0, 58, 3, 1, 
+0, 66, 1, 2, 2, 7, 1, 2, 0, 88, 1, 2, 128, 43, 1, 1, 
+0, 88, 2, 1, 128, 43, 1, 2, 0, 76, 1, 2, 0, 13, 102, 117, 
+110, 99, 116, 105, 111, 110, 10, 116, 97, 98, 108, 101, 9, 116, 121, 112, 
+101, 188, 1, 0, 1, 10, 0, 6, 0, 34, 54, 1, 0, 0, 18, 3, 
+0, 0, 66, 1, 2, 2, 7, 1, 1, 0, 88, 1, 3, 128, 18, 1, 
+0, 0, 68, 1, 1, 0, 88, 1, 25, 128, 54, 1, 2, 0, 18, 3, 
+0, 0, 66, 1, 2, 2, 15, 0, 1, 0, 88, 2, 5, 128, 54, 1, 
+3, 0, 57, 1, 4, 1, 18, 3, 0, 0, 66, 1, 2, 1, 88, 1, 
+15, 128, 54, 1, 5, 0, 18, 3, 0, 0, 66, 1, 2, 4, 88, 4, 
+7, 128, 18, 6, 5, 0, 66, 6, 1, 3, 14, 0, 6, 0, 88, 8, 
+3, 128, 43, 8, 1, 0, 18, 9, 7, 0, 74, 8, 3, 0, 69, 4, 
+3, 3, 82, 4, 247, 127, 43, 1, 2, 0, 76, 1, 2, 0, 75, 0, 
+1, 0, 11, 105, 112, 97, 105, 114, 115, 17, 65, 99, 116, 105, 118, 97, 
+116, 101, 77, 101, 110, 117, 8, 67, 109, 100, 11, 73, 115, 77, 101, 110, 
+117, 13, 102, 117, 110, 99, 116, 105, 111, 110, 9, 116, 121, 112, 101, 87, 
+0, 2, 8, 2, 2, 0, 14, 14, 0, 1, 0, 88, 2, 1, 128, 45, 
+1, 0, 0, 18, 4, 0, 0, 57, 2, 0, 0, 41, 5, 0, 0, 41, 
+6, 0, 0, 18, 7, 1, 0, 66, 2, 5, 1, 54, 2, 1, 0, 66, 
+2, 1, 1, 45, 2, 1, 0, 66, 2, 1, 1, 75, 0, 1, 0, 28, 
+192, 8, 192, 16, 81, 117, 101, 117, 101, 82, 101, 100, 114, 97, 119, 12, 
+114, 117, 110, 109, 101, 110, 117, 194, 6, 0, 6, 24, 7, 18, 4, 153, 
+1, 41, 6, 0, 0, 54, 7, 0, 0, 18, 9, 3, 0, 66, 7, 2, 
+4, 88, 10, 11, 128, 57, 12, 1, 0, 57, 13, 2, 11, 56, 12, 13, 
+12, 15, 0, 12, 0, 88, 13, 6, 128, 45, 13, 0, 0, 18, 15, 12, 
+0, 66, 13, 2, 2, 1, 6, 13, 0, 88, 14, 1, 128, 18, 6, 13, 
+0, 69, 10, 3, 3, 82, 10, 243, 127, 41, 7, 0, 0, 1, 7, 6, 
+0, 88, 7, 1, 128, 22, 6, 0, 6, 57, 7, 3, 3, 22, 7, 1, 
+7, 32, 7, 6, 7, 54, 8, 4, 0, 21, 10, 3, 0, 54, 11, 5, 
+0, 33, 11, 2, 11, 23, 11, 2, 11, 66, 8, 3, 2, 54, 9, 6, 
+0, 18, 11, 1, 0, 18, 12, 2, 0, 18, 13, 7, 0, 18, 14, 8, 
+0, 57, 15, 7, 3, 66, 9, 6, 1, 21, 9, 3, 0, 1, 8, 9, 
+0, 88, 9, 26, 128, 23, 9, 0, 5, 21, 10, 3, 0, 35, 9, 10, 
+9, 32, 10, 8, 5, 23, 10, 0, 10, 21, 11, 3, 0, 35, 10, 11, 
+10, 34, 11, 8, 9, 32, 11, 2, 11, 22, 11, 0, 11, 34, 12, 8, 
+10, 32, 12, 2, 12, 22, 12, 0, 12, 45, 13, 1, 0, 66, 13, 1, 
+1, 18, 13, 11, 0, 18, 14, 12, 0, 41, 15, 1, 0, 77, 13, 7, 
+128, 45, 17, 2, 0, 32, 19, 7, 1, 22, 19, 0, 19, 18, 20, 16, 
+0, 39, 21, 8, 0, 66, 17, 4, 1, 79, 13, 249, 127, 18, 9, 5, 
+0, 32, 10, 8, 5, 23, 10, 0, 10, 41, 11, 1, 0, 77, 9, 71, 
+128, 56, 13, 12, 3, 57, 14, 1, 0, 57, 15, 2, 13, 56, 14, 15, 
+14, 32, 15, 12, 2, 33, 15, 5, 15, 22, 15, 0, 15, 7, 13, 9, 
+0, 88, 16, 16, 128, 5, 12, 4, 0, 88, 16, 2, 128, 45, 16, 3, 
+0, 66, 16, 1, 1, 45, 16, 1, 0, 66, 16, 1, 1, 45, 16, 2, 
+0, 22, 18, 0, 1, 18, 19, 15, 0, 54, 20, 10, 0, 57, 20, 11, 
+20, 39, 22, 12, 0, 18, 23, 7, 0, 66, 20, 3, 0, 65, 16, 2, 
+1, 88, 16, 43, 128, 45, 16, 4, 0, 66, 16, 1, 1, 5, 12, 4, 
+0, 88, 16, 11, 128, 45, 16, 3, 0, 66, 16, 1, 1, 45, 16, 2, 
+0, 22, 18, 0, 1, 18, 19, 15, 0, 54, 20, 10, 0, 57, 20, 11, 
+20, 39, 22, 13, 0, 18, 23, 7, 0, 66, 20, 3, 0, 65, 16, 2, 
+1, 45, 16, 2, 0, 22, 18, 1, 1, 18, 19, 15, 0, 57, 20, 7, 
+13, 66, 16, 4, 1, 45, 16, 5, 0, 66, 16, 1, 1, 45, 16, 1, 
+0, 66, 16, 1, 1, 15, 0, 14, 0, 88, 16, 9, 128, 45, 16, 0, 
+0, 18, 18, 14, 0, 66, 16, 2, 2, 45, 17, 2, 0, 32, 19, 7, 
+1, 33, 19, 16, 19, 18, 20, 15, 0, 18, 21, 14, 0, 66, 17, 4, 
+1, 57, 16, 14, 13, 15, 0, 16, 0, 88, 17, 5, 128, 45, 16, 2, 
+0, 22, 18, 3, 1, 18, 19, 15, 0, 57, 20, 14, 13, 66, 16, 4, 
+1, 45, 16, 4, 0, 66, 16, 1, 1, 79, 9, 185, 127, 45, 9, 6, 
+0, 54, 11, 15, 0, 23, 11, 0, 11, 54, 12, 5, 0, 23, 12, 0, 
+12, 66, 9, 3, 1, 54, 9, 16, 0, 39, 11, 17, 0, 66, 9, 2, 
+1, 75, 0, 1, 0, 9, 192, 6, 192, 1, 192, 7, 192, 8, 192, 5, 
+192, 4, 192, 78, 94, 86, 32, 114, 101, 98, 105, 110, 100, 115, 32, 97, 
+32, 109, 101, 110, 117, 32, 105, 116, 101, 109, 59, 32, 94, 88, 32, 117, 
+110, 98, 105, 110, 100, 115, 32, 105, 116, 59, 32, 94, 82, 32, 114, 101, 
+115, 101, 116, 115, 32, 97, 108, 108, 32, 98, 105, 110, 100, 105, 110, 103, 
+115, 32, 116, 111, 32, 100, 101, 102, 97, 117, 108, 116, 46, 19, 68, 114, 
+97, 119, 83, 116, 97, 116, 117, 115, 76, 105, 110, 101, 16, 83, 99, 114, 
+101, 101, 110, 87, 105, 100, 116, 104, 7, 109, 107, 6, 32, 8, 226, 148, 
+128, 8, 114, 101, 112, 11, 115, 116, 114, 105, 110, 103, 6, 45, 8, 226, 
+149, 145, 10, 108, 97, 98, 101, 108, 18, 68, 114, 97, 119, 84, 105, 116, 
+108, 101, 100, 66, 111, 120, 17, 83, 99, 114, 101, 101, 110, 72, 101, 105, 
+103, 104, 116, 8, 109, 105, 110, 13, 109, 97, 120, 119, 105, 100, 116, 104, 
+7, 105, 100, 17, 97, 99, 99, 101, 108, 101, 114, 97, 116, 111, 114, 115, 
+11, 105, 112, 97, 105, 114, 115, 2, 8, 6, 4, 178, 1, 0, 1, 16, 
+1, 8, 3, 26, 54, 1, 0, 0, 57, 1, 1, 1, 54, 2, 0, 0, 
+43, 3, 2, 0, 61, 3, 1, 2, 54, 2, 2, 0, 66, 2, 1, 1, 
+54, 2, 0, 0, 61, 1, 1, 2, 41, 2, 0, 0, 54, 3, 3, 0, 
+45, 5, 0, 0, 66, 3, 2, 4, 88, 6, 9, 128, 18, 10, 0, 0, 
+57, 8, 4, 0, 24, 11, 0, 2, 24, 12, 1, 2, 57, 13, 5, 7, 
+57, 14, 6, 7, 57, 15, 7, 7, 66, 8, 7, 1, 22, 2, 2, 2, 
+69, 6, 3, 3, 82, 6, 245, 127, 75, 0, 1, 0, 12, 128, 8, 116, 
+111, 112, 6, 110, 9, 109, 101, 110, 117, 13, 100, 114, 97, 119, 109, 101, 
+110, 117, 11, 105, 112, 97, 105, 114, 115, 17, 82, 101, 100, 114, 97, 119, 
+83, 99, 114, 101, 101, 110, 14, 115, 116, 97, 116, 117, 115, 98, 97, 114, 
+16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 8, 4, 2, 170, 
+15, 0, 4, 16, 4, 57, 4, 165, 2, 41, 4, 1, 0, 41, 5, 1, 
+0, 85, 6, 33, 129, 43, 6, 0, 0, 85, 7, 226, 128, 54, 7, 0, 
+0, 21, 9, 3, 0, 54, 10, 1, 0, 33, 10, 2, 10, 23, 10, 0, 
+10, 66, 7, 3, 2, 1, 4, 5, 0, 88, 8, 1, 128, 18, 5, 4, 
+0, 32, 8, 7, 5, 23, 8, 1, 8, 1, 8, 4, 0, 88, 8, 2, 
+128, 33, 8, 7, 4, 22, 5, 1, 8, 18, 10, 0, 0, 57, 8, 2, 
+0, 18, 11, 1, 0, 18, 12, 2, 0, 18, 13, 3, 0, 18, 14, 4, 
+0, 18, 15, 5, 0, 66, 8, 7, 1, 45, 8, 0, 0, 66, 8, 1, 
+2, 18, 10, 8, 0, 57, 8, 3, 8, 66, 8, 2, 2, 7, 8, 4, 
+0, 88, 9, 8, 128, 54, 9, 5, 0, 66, 9, 1, 1, 54, 9, 6, 
+0, 66, 9, 1, 1, 18, 11, 0, 0, 57, 9, 7, 0, 66, 9, 2, 
+1, 88, 9, 217, 127, 7, 8, 8, 0, 88, 9, 5, 128, 41, 9, 1, 
+0, 1, 9, 4, 0, 88, 9, 2, 128, 23, 4, 1, 4, 88, 9, 210, 
+127, 7, 8, 9, 0, 88, 9, 5, 128, 21, 9, 3, 0, 1, 4, 9, 
+0, 88, 9, 2, 128, 22, 4, 1, 4, 88, 9, 203, 127, 7, 8, 10, 
+0, 88, 9, 9, 128, 45, 9, 1, 0, 54, 11, 0, 0, 25, 13, 2, 
+7, 32, 13, 13, 4, 21, 14, 3, 0, 66, 11, 3, 0, 65, 9, 0, 
+2, 18, 4, 9, 0, 88, 9, 192, 127, 7, 8, 11, 0, 88, 9, 9, 
+128, 45, 9, 1, 0, 54, 11, 12, 0, 25, 13, 2, 7, 33, 13, 13, 
+4, 41, 14, 1, 0, 66, 11, 3, 0, 65, 9, 0, 2, 18, 4, 9, 
+0, 88, 9, 181, 127, 6, 8, 13, 0, 88, 9, 2, 128, 7, 8, 14, 
+0, 88, 9, 9, 128, 54, 9, 15, 0, 56, 11, 4, 3, 66, 9, 2, 
+2, 6, 9, 16, 0, 88, 9, 172, 127, 56, 9, 4, 3, 57, 6, 17, 
+9, 88, 7, 140, 128, 88, 9, 168, 127, 7, 8, 18, 0, 88, 9, 3, 
+128, 43, 9, 0, 0, 76, 9, 2, 0, 88, 9, 163, 127, 7, 8, 19, 
+0, 88, 9, 3, 128, 43, 9, 1, 0, 76, 9, 2, 0, 88, 9, 158, 
+127, 7, 8, 20, 0, 88, 9, 3, 128, 43, 9, 1, 0, 76, 9, 2, 
+0, 88, 9, 153, 127, 7, 8, 21, 0, 88, 9, 22, 128, 56, 9, 4, 
+3, 54, 10, 15, 0, 18, 12, 9, 0, 66, 10, 2, 2, 6, 10, 16, 
+0, 88, 10, 145, 127, 57, 10, 22, 0, 57, 11, 17, 9, 56, 10, 11, 
+10, 15, 0, 10, 0, 88, 11, 140, 127, 57, 11, 22, 0, 43, 12, 0, 
+0, 60, 12, 10, 11, 57, 11, 22, 0, 57, 12, 17, 9, 43, 13, 0, 
+0, 60, 13, 12, 11, 18, 13, 0, 0, 57, 11, 7, 0, 66, 11, 2, 
+1, 88, 9, 129, 127, 7, 8, 23, 0, 88, 9, 60, 128, 56, 9, 4, 
+3, 54, 10, 15, 0, 18, 12, 9, 0, 66, 10, 2, 2, 6, 10, 16, 
+0, 88, 10, 121, 127, 57, 10, 22, 0, 57, 11, 17, 9, 56, 10, 11, 
+10, 14, 0, 10, 0, 88, 10, 116, 127, 54, 10, 24, 0, 39, 12, 25, 
+0, 66, 10, 2, 1, 45, 10, 0, 0, 66, 10, 1, 2, 18, 12, 10, 
+0, 57, 10, 3, 10, 66, 10, 2, 2, 18, 13, 10, 0, 57, 11, 26, 
+10, 39, 14, 27, 0, 66, 11, 3, 2, 15, 0, 11, 0, 88, 12, 102, 
+127, 18, 13, 10, 0, 57, 11, 28, 10, 39, 14, 27, 0, 39, 15, 29, 
+0, 66, 11, 4, 2, 18, 10, 11, 0, 57, 11, 22, 0, 56, 11, 10, 
+11, 15, 0, 11, 0, 88, 12, 7, 128, 54, 11, 30, 0, 39, 13, 31, 
+0, 18, 14, 10, 0, 39, 15, 32, 0, 38, 13, 15, 13, 66, 11, 2, 
+1, 88, 11, 14, 128, 6, 10, 33, 0, 88, 11, 2, 128, 7, 10, 34, 
+0, 88, 11, 4, 128, 54, 11, 30, 0, 39, 13, 35, 0, 66, 11, 2, 
+1, 88, 11, 6, 128, 57, 11, 22, 0, 57, 12, 17, 9, 60, 12, 10, 
+11, 57, 11, 22, 0, 57, 12, 17, 9, 60, 10, 12, 11, 18, 13, 0, 
+0, 57, 11, 7, 0, 66, 11, 2, 1, 88, 9, 67, 127, 7, 8, 36, 
+0, 88, 9, 27, 128, 54, 9, 37, 0, 39, 11, 38, 0, 39, 12, 39, 
+0, 39, 13, 40, 0, 38, 12, 13, 12, 66, 9, 3, 2, 15, 0, 9, 
+0, 88, 10, 15, 128, 54, 9, 41, 0, 54, 10, 43, 0, 66, 10, 1, 
+2, 61, 10, 42, 9, 54, 9, 41, 0, 18, 11, 9, 0, 57, 9, 44, 
+9, 66, 9, 2, 1, 54, 9, 30, 0, 39, 11, 45, 0, 66, 9, 2, 
+1, 52, 9, 0, 0, 46, 2, 9, 0, 43, 9, 1, 0, 76, 9, 2, 
+0, 18, 11, 0, 0, 57, 9, 7, 0, 66, 9, 2, 1, 88, 9, 38, 
+127, 57, 9, 46, 3, 56, 9, 8, 9, 15, 0, 9, 0, 88, 10, 34, 
+127, 57, 9, 46, 3, 56, 9, 8, 9, 57, 6, 17, 9, 88, 7, 1, 
+128, 88, 7, 29, 127, 45, 7, 3, 0, 56, 7, 6, 7, 57, 8, 47, 
+7, 54, 9, 48, 0, 18, 11, 8, 0, 66, 9, 2, 2, 15, 0, 9, 
+0, 88, 10, 33, 128, 45, 9, 2, 0, 45, 10, 2, 0, 21, 10, 10, 
+0, 22, 10, 1, 10, 53, 11, 49, 0, 61, 3, 42, 11, 61, 4, 50, 
+11, 61, 5, 51, 11, 60, 11, 10, 9, 18, 11, 0, 0, 57, 9, 52, 
+0, 22, 12, 3, 1, 22, 13, 2, 2, 18, 14, 8, 0, 66, 9, 5, 
+2, 45, 10, 2, 0, 45, 11, 2, 0, 21, 11, 11, 0, 43, 12, 0, 
+0, 60, 12, 11, 10, 11, 9, 2, 0, 88, 10, 3, 128, 43, 10, 2, 
+0, 76, 10, 2, 0, 88, 10, 4, 128, 11, 9, 1, 0, 88, 10, 2, 
+128, 43, 10, 1, 0, 76, 10, 2, 0, 18, 12, 0, 0, 57, 10, 7, 
+0, 66, 10, 2, 1, 88, 9, 242, 126, 14, 0, 8, 0, 88, 9, 5, 
+128, 54, 9, 53, 0, 39, 11, 54, 0, 39, 12, 55, 0, 66, 9, 3, 
+1, 88, 9, 8, 128, 54, 9, 56, 0, 18, 11, 8, 0, 66, 9, 2, 
+3, 15, 0, 10, 0, 88, 11, 3, 128, 54, 11, 30, 0, 18, 13, 10, 
+0, 66, 11, 2, 1, 52, 9, 0, 0, 46, 2, 9, 0, 43, 9, 2, 
+0, 76, 9, 2, 0, 88, 6, 222, 126, 75, 0, 1, 0, 3, 192, 0, 
+192, 12, 128, 10, 192, 18, 82, 117, 110, 77, 101, 110, 117, 65, 99, 116, 
+105, 111, 110, 85, 83, 111, 114, 114, 121, 44, 32, 116, 104, 97, 116, 32, 
+102, 101, 97, 116, 117, 114, 101, 32, 105, 115, 110, 39, 116, 32, 105, 109, 
+112, 108, 101, 109, 101, 110, 116, 101, 100, 32, 121, 101, 116, 46, 32, 40, 
+84, 104, 105, 115, 32, 115, 104, 111, 117, 108, 100, 32, 110, 101, 118, 101, 
+114, 32, 104, 97, 112, 112, 101, 110, 46, 32, 67, 111, 109, 112, 108, 97, 
+105, 110, 46, 41, 24, 78, 111, 116, 32, 105, 109, 112, 108, 101, 109, 101, 
+110, 116, 101, 100, 32, 121, 101, 116, 17, 77, 111, 100, 97, 108, 77, 101, 
+115, 115, 97, 103, 101, 12, 114, 117, 110, 109, 101, 110, 117, 8, 116, 111, 
+112, 6, 110, 1, 0, 3, 8, 116, 111, 112, 0, 6, 110, 0, 9, 109, 
+101, 110, 117, 0, 11, 73, 115, 77, 101, 110, 117, 7, 102, 110, 8, 109, 
+107, 115, 63, 65, 108, 108, 32, 107, 101, 121, 98, 105, 110, 100, 105, 110, 
+103, 115, 32, 104, 97, 118, 101, 32, 98, 101, 101, 110, 32, 114, 101, 115, 
+101, 116, 32, 116, 111, 32, 116, 104, 101, 105, 114, 32, 100, 101, 102, 97, 
+117, 108, 116, 32, 115, 101, 116, 116, 105, 110, 103, 115, 46, 10, 116, 111, 
+117, 99, 104, 15, 67, 114, 101, 97, 116, 101, 77, 101, 110, 117, 9, 109, 
+101, 110, 117, 16, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 40, 
+107, 101, 121, 98, 105, 110, 100, 105, 110, 103, 115, 32, 98, 97, 99, 107, 
+32, 116, 111, 32, 116, 104, 101, 105, 114, 32, 100, 101, 102, 97, 117, 108, 
+116, 115, 63, 49, 65, 114, 101, 32, 121, 111, 117, 32, 115, 117, 114, 101, 
+32, 121, 111, 117, 32, 119, 97, 110, 116, 32, 116, 111, 32, 114, 101, 115, 
+101, 116, 32, 97, 108, 108, 32, 116, 104, 101, 32, 109, 101, 110, 117, 32, 
+28, 82, 101, 115, 101, 116, 32, 109, 101, 110, 117, 32, 107, 101, 121, 98, 
+105, 110, 100, 105, 110, 103, 115, 63, 19, 80, 114, 111, 109, 112, 116, 70, 
+111, 114, 89, 101, 115, 78, 111, 11, 75, 69, 89, 95, 94, 82, 29, 89, 
+111, 117, 32, 99, 97, 110, 39, 116, 32, 98, 105, 110, 100, 32, 116, 104, 
+97, 116, 32, 107, 101, 121, 46, 11, 82, 69, 83, 73, 90, 69, 11, 69, 
+83, 67, 65, 80, 69, 33, 32, 105, 115, 32, 97, 108, 114, 101, 97, 100, 
+121, 32, 98, 111, 117, 110, 100, 32, 101, 108, 115, 101, 119, 104, 101, 114, 
+101, 46, 12, 83, 111, 114, 114, 121, 44, 32, 20, 78, 111, 110, 109, 111, 
+100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 5, 9, 103, 115, 117, 98, 
+10, 94, 75, 69, 89, 95, 10, 109, 97, 116, 99, 104, 45, 80, 114, 101, 
+115, 115, 32, 110, 101, 119, 32, 97, 99, 99, 101, 108, 101, 114, 97, 116, 
+111, 114, 32, 107, 101, 121, 32, 102, 111, 114, 32, 109, 101, 110, 117, 32, 
+105, 116, 101, 109, 46, 19, 68, 114, 97, 119, 83, 116, 97, 116, 117, 115, 
+76, 105, 110, 101, 11, 75, 69, 89, 95, 94, 86, 17, 97, 99, 99, 101, 
+108, 101, 114, 97, 116, 111, 114, 115, 11, 75, 69, 89, 95, 94, 88, 11, 
+75, 69, 89, 95, 94, 67, 15, 75, 69, 89, 95, 69, 83, 67, 65, 80, 
+69, 13, 75, 69, 89, 95, 76, 69, 70, 84, 7, 105, 100, 11, 115, 116, 
+114, 105, 110, 103, 9, 116, 121, 112, 101, 14, 75, 69, 89, 95, 82, 73, 
+71, 72, 84, 15, 75, 69, 89, 95, 82, 69, 84, 85, 82, 78, 8, 109, 
+97, 120, 13, 75, 69, 89, 95, 80, 71, 85, 80, 13, 75, 69, 89, 95, 
+80, 71, 68, 78, 13, 75, 69, 89, 95, 68, 79, 87, 78, 11, 75, 69, 
+89, 95, 85, 80, 18, 100, 114, 97, 119, 109, 101, 110, 117, 115, 116, 97, 
+99, 107, 17, 82, 101, 100, 114, 97, 119, 83, 99, 114, 101, 101, 110, 17, 
+82, 101, 115, 105, 122, 101, 83, 99, 114, 101, 101, 110, 15, 75, 69, 89, 
+95, 82, 69, 83, 73, 90, 69, 10, 117, 112, 112, 101, 114, 13, 100, 114, 
+97, 119, 109, 101, 110, 117, 17, 83, 99, 114, 101, 101, 110, 72, 101, 105, 
+103, 104, 116, 8, 109, 105, 110, 6, 2, 4, 8, 84, 0, 0, 5, 1, 
+3, 0, 7, 54, 0, 0, 0, 39, 2, 1, 0, 45, 3, 0, 0, 39, 
+4, 2, 0, 38, 2, 4, 2, 66, 0, 2, 1, 75, 0, 1, 0, 2, 
+192, 16, 32, 110, 111, 116, 32, 102, 111, 117, 110, 100, 46, 23, 77, 101, 
+110, 117, 32, 105, 116, 101, 109, 32, 119, 105, 116, 104, 32, 73, 68, 32, 
+20, 78, 111, 110, 109, 111, 100, 97, 108, 77, 101, 115, 115, 97, 103, 101, 
+211, 1, 1, 2, 7, 1, 9, 0, 35, 18, 4, 1, 0, 57, 2, 0, 
+1, 39, 5, 1, 0, 39, 6, 2, 0, 66, 2, 4, 2, 18, 1, 2, 
+0, 54, 2, 3, 0, 18, 4, 1, 0, 66, 2, 2, 2, 14, 0, 2, 
+0, 88, 3, 2, 128, 57, 2, 4, 0, 56, 2, 1, 2, 14, 0, 2, 
+0, 88, 3, 2, 128, 43, 3, 0, 0, 50, 0, 17, 128, 43, 3, 0, 
+0, 54, 4, 5, 0, 18, 6, 2, 0, 66, 4, 2, 2, 7, 4, 6, 
+0, 88, 4, 2, 128, 18, 3, 2, 0, 88, 4, 7, 128, 45, 4, 0, 
+0, 56, 4, 2, 4, 14, 0, 4, 0, 88, 5, 2, 128, 51, 3, 7, 
+0, 88, 5, 1, 128, 57, 3, 8, 4, 50, 0, 0, 128, 76, 3, 2, 
+0, 76, 3, 2, 0, 10, 192, 7, 102, 110, 0, 13, 102, 117, 110, 99, 
+116, 105, 111, 110, 9, 116, 121, 112, 101, 17, 97, 99, 99, 101, 108, 101, 
+114, 97, 116, 111, 114, 115, 23, 67, 104, 101, 99, 107, 79, 118, 101, 114, 
+114, 105, 100, 101, 84, 97, 98, 108, 101, 5, 10, 94, 75, 69, 89, 95, 
+9, 103, 115, 117, 98, 160, 1, 0, 0, 8, 1, 7, 0, 18, 52, 0, 
+0, 0, 54, 1, 0, 0, 45, 3, 0, 0, 66, 1, 2, 4, 72, 4, 
+2, 128, 60, 5, 4, 0, 60, 4, 5, 0, 70, 4, 3, 3, 82, 4, 
+252, 127, 53, 1, 1, 0, 61, 0, 2, 1, 54, 2, 3, 0, 18, 4, 
+1, 0, 53, 5, 4, 0, 54, 6, 5, 0, 61, 6, 6, 5, 66, 2, 
+3, 1, 76, 1, 2, 0, 11, 192, 12, 95, 95, 105, 110, 100, 101, 120, 
+14, 77, 101, 110, 117, 67, 108, 97, 115, 115, 1, 0, 1, 12, 95, 95, 
+105, 110, 100, 101, 120, 0, 17, 115, 101, 116, 109, 101, 116, 97, 116, 97, 
+98, 108, 101, 17, 97, 99, 99, 101, 108, 101, 114, 97, 116, 111, 114, 115, 
+1, 0, 1, 17, 97, 99, 99, 101, 108, 101, 114, 97, 116, 111, 114, 115, 
+0, 10, 112, 97, 105, 114, 115, 63, 0, 0, 3, 1, 3, 0, 6, 54, 
+0, 0, 0, 57, 0, 1, 0, 45, 2, 0, 0, 57, 2, 2, 2, 66, 
+0, 2, 1, 75, 0, 1, 0, 6, 192, 9, 110, 97, 109, 101, 25, 67, 
+104, 97, 110, 103, 101, 80, 97, 114, 97, 103, 114, 97, 112, 104, 83, 116, 
+121, 108, 101, 8, 67, 109, 100, 140, 2, 1, 1, 13, 3, 11, 2, 47, 
+45, 1, 0, 0, 45, 3, 1, 0, 66, 1, 2, 1, 52, 1, 0, 0, 
+54, 2, 0, 0, 18, 4, 0, 0, 66, 2, 2, 4, 88, 5, 31, 128, 
+43, 7, 0, 0, 41, 8, 10, 0, 3, 5, 8, 0, 88, 8, 5, 128, 
+54, 8, 1, 0, 23, 10, 0, 5, 66, 8, 2, 2, 18, 7, 8, 0, 
+88, 8, 5, 128, 54, 8, 2, 0, 57, 8, 3, 8, 22, 10, 1, 5, 
+66, 8, 2, 2, 18, 7, 8, 0, 21, 8, 1, 0, 22, 8, 0, 8, 
+53, 9, 8, 0, 39, 10, 4, 0, 18, 11, 5, 0, 38, 10, 11, 10, 
+62, 10, 1, 9, 62, 7, 2, 9, 57, 10, 5, 6, 39, 11, 6, 0, 
+57, 12, 7, 6, 38, 10, 12, 10, 62, 10, 3, 9, 51, 10, 9, 0, 
+62, 10, 5, 9, 60, 9, 8, 1, 50, 5, 0, 128, 69, 5, 3, 3, 
+82, 5, 223, 127, 45, 2, 2, 0, 39, 4, 10, 0, 18, 5, 1, 0, 
+45, 6, 1, 0, 66, 2, 4, 1, 75, 0, 1, 0, 14, 192, 16, 192, 
+13, 192, 21, 80, 97, 114, 97, 103, 114, 97, 112, 104, 32, 83, 116, 121, 
+108, 101, 115, 0, 1, 0, 0, 9, 100, 101, 115, 99, 7, 58, 32, 9, 
+110, 97, 109, 101, 7, 83, 80, 9, 99, 104, 97, 114, 11, 115, 116, 114, 
+105, 110, 103, 13, 116, 111, 115, 116, 114, 105, 110, 103, 11, 105, 112, 97, 
+105, 114, 115, 2, 108, 57, 0, 0, 3, 1, 3, 0, 6, 54, 0, 0, 
+0, 57, 0, 1, 0, 45, 2, 0, 0, 57, 2, 2, 2, 66, 0, 2, 
+1, 75, 0, 1, 0, 7, 192, 9, 110, 97, 109, 101, 19, 67, 104, 97, 
+110, 103, 101, 68, 111, 99, 117, 109, 101, 110, 116, 8, 67, 109, 100, 224, 
+2, 1, 1, 14, 3, 13, 2, 63, 52, 1, 0, 0, 54, 2, 0, 0, 
+45, 4, 0, 0, 66, 2, 2, 4, 88, 5, 9, 128, 54, 7, 1, 0, 
+57, 7, 2, 7, 57, 7, 3, 7, 57, 8, 4, 6, 56, 7, 8, 7, 
+15, 0, 7, 0, 88, 8, 2, 128, 57, 8, 5, 6, 60, 7, 8, 1, 
+69, 5, 3, 3, 82, 5, 245, 127, 45, 2, 1, 0, 45, 4, 0, 0, 
+66, 2, 2, 1, 52, 2, 0, 0, 54, 3, 0, 0, 18, 5, 0, 0, 
+66, 3, 2, 4, 88, 6, 31, 128, 57, 8, 6, 7, 56, 8, 8, 1, 
+43, 9, 0, 0, 41, 10, 10, 0, 3, 6, 10, 0, 88, 10, 5, 128, 
+54, 10, 7, 0, 23, 12, 0, 6, 66, 10, 2, 2, 18, 9, 10, 0, 
+88, 10, 5, 128, 54, 10, 8, 0, 57, 10, 9, 10, 22, 12, 1, 6, 
+66, 10, 2, 2, 18, 9, 10, 0, 21, 10, 2, 0, 22, 10, 0, 10, 
+52, 11, 6, 0, 39, 12, 10, 0, 18, 13, 6, 0, 38, 12, 13, 12, 
+62, 12, 1, 11, 62, 9, 2, 11, 57, 12, 6, 7, 62, 12, 3, 11, 
+62, 8, 4, 11, 51, 12, 11, 0, 62, 12, 5, 11, 60, 11, 10, 2, 
+50, 6, 0, 128, 69, 6, 3, 3, 82, 6, 223, 127, 45, 3, 2, 0, 
+39, 5, 12, 0, 18, 6, 2, 0, 45, 7, 0, 0, 66, 3, 4, 1, 
+75, 0, 1, 0, 15, 192, 14, 192, 13, 192, 14, 68, 111, 99, 117, 109, 
+101, 110, 116, 115, 0, 6, 68, 9, 99, 104, 97, 114, 11, 115, 116, 114, 
+105, 110, 103, 13, 116, 111, 115, 116, 114, 105, 110, 103, 9, 110, 97, 109, 
+101, 10, 108, 97, 98, 101, 108, 7, 105, 100, 17, 97, 99, 99, 101, 108, 
+101, 114, 97, 116, 111, 114, 115, 9, 109, 101, 110, 117, 16, 68, 111, 99, 
+117, 109, 101, 110, 116, 83, 101, 116, 11, 105, 112, 97, 105, 114, 115, 2, 
+108, 198, 1, 0, 1, 14, 1, 11, 0, 31, 54, 1, 0, 0, 18, 3, 
+0, 0, 66, 1, 2, 4, 88, 4, 24, 128, 54, 6, 1, 0, 18, 8, 
+5, 0, 66, 6, 2, 2, 15, 0, 6, 0, 88, 7, 19, 128, 54, 6, 
+2, 0, 57, 6, 3, 6, 18, 8, 6, 0, 57, 6, 4, 6, 54, 9, 
+5, 0, 57, 9, 6, 9, 39, 11, 7, 0, 57, 12, 8, 5, 57, 13, 
+9, 5, 66, 9, 4, 0, 65, 6, 1, 1, 54, 6, 1, 0, 57, 8, 
+10, 5, 66, 6, 2, 2, 15, 0, 6, 0, 88, 7, 3, 128, 45, 6, 
+0, 0, 57, 8, 10, 5, 66, 6, 2, 1, 69, 4, 3, 3, 82, 4, 
+230, 127, 75, 0, 1, 0, 0, 192, 7, 102, 110, 10, 108, 97, 98, 101, 
+108, 7, 105, 100, 13, 37, 49, 53, 115, 32, 37, 115, 10, 11, 102, 111, 
+114, 109, 97, 116, 11, 115, 116, 114, 105, 110, 103, 10, 119, 114, 105, 116, 
+101, 11, 115, 116, 100, 111, 117, 116, 7, 105, 111, 11, 73, 115, 77, 101, 
+110, 117, 11, 105, 112, 97, 105, 114, 115, 102, 1, 0, 5, 1, 5, 0, 
+12, 51, 0, 0, 0, 54, 1, 1, 0, 57, 1, 2, 1, 18, 3, 1, 
+0, 57, 1, 3, 1, 39, 4, 4, 0, 66, 1, 3, 1, 18, 1, 0, 
+0, 45, 3, 0, 0, 66, 1, 2, 1, 50, 0, 0, 128, 75, 0, 1, 
+0, 28, 192, 32, 65, 108, 108, 32, 115, 117, 112, 112, 111, 114, 116, 101, 
+100, 32, 109, 101, 110, 117, 32, 105, 116, 101, 109, 115, 58, 10, 10, 10, 
+119, 114, 105, 116, 101, 11, 115, 116, 100, 111, 117, 116, 7, 105, 111, 0, 
+158, 56, 3, 0, 34, 0, 218, 1, 0, 203, 5, 54, 0, 0, 0, 57, 
+0, 1, 0, 54, 1, 2, 0, 57, 1, 3, 1, 54, 2, 2, 0, 57, 
+2, 4, 2, 54, 3, 2, 0, 57, 3, 5, 3, 54, 4, 2, 0, 57, 
+4, 6, 4, 54, 5, 2, 0, 57, 5, 7, 5, 54, 6, 2, 0, 57, 
+6, 8, 6, 54, 7, 2, 0, 57, 7, 9, 7, 54, 8, 2, 0, 57, 
+8, 10, 8, 54, 9, 2, 0, 57, 9, 11, 9, 52, 10, 0, 0, 52, 
+11, 0, 0, 52, 12, 0, 0, 51, 13, 12, 0, 51, 14, 13, 0, 18, 
+15, 13, 0, 39, 17, 14, 0, 52, 18, 0, 0, 66, 15, 3, 2, 18, 
+16, 13, 0, 39, 18, 15, 0, 52, 19, 0, 0, 66, 16, 3, 2, 54, 
+17, 16, 0, 57, 17, 17, 17, 18, 18, 13, 0, 39, 20, 18, 0, 52, 
+21, 4, 0, 53, 22, 19, 0, 54, 23, 16, 0, 57, 23, 20, 23, 62, 
+23, 5, 22, 62, 22, 1, 21, 53, 22, 21, 0, 54, 23, 16, 0, 57, 
+23, 22, 23, 62, 23, 5, 22, 62, 22, 2, 21, 53, 22, 23, 0, 54, 
+23, 16, 0, 57, 23, 24, 23, 62, 23, 5, 22, 62, 22, 3, 21, 66, 
+18, 3, 2, 18, 19, 13, 0, 39, 21, 25, 0, 52, 22, 6, 0, 53, 
+23, 26, 0, 54, 24, 16, 0, 57, 24, 27, 24, 62, 24, 5, 23, 62, 
+23, 1, 22, 53, 23, 28, 0, 54, 24, 16, 0, 57, 24, 29, 24, 62, 
+24, 5, 23, 62, 23, 2, 22, 53, 23, 30, 0, 54, 24, 16, 0, 57, 
+24, 31, 24, 62, 24, 5, 23, 62, 23, 3, 22, 53, 23, 32, 0, 54, 
+24, 16, 0, 57, 24, 33, 24, 62, 24, 5, 23, 62, 23, 4, 22, 53, 
+23, 34, 0, 54, 24, 16, 0, 57, 24, 35, 24, 62, 24, 5, 23, 62, 
+23, 5, 22, 66, 19, 3, 2, 18, 20, 13, 0, 39, 22, 36, 0, 52, 
+23, 7, 0, 53, 24, 37, 0, 54, 25, 16, 0, 57, 25, 38, 25, 62, 
+25, 5, 24, 62, 24, 1, 23, 53, 24, 39, 0, 54, 25, 16, 0, 57, 
+25, 40, 25, 62, 25, 5, 24, 62, 24, 2, 23, 53, 24, 41, 0, 54, 
+25, 16, 0, 57, 25, 42, 25, 62, 25, 5, 24, 62, 24, 3, 23, 53, 
+24, 43, 0, 54, 25, 16, 0, 57, 25, 44, 25, 62, 25, 5, 24, 62, 
+24, 4, 23, 53, 24, 45, 0, 54, 25, 16, 0, 57, 25, 46, 25, 62, 
+25, 5, 24, 62, 24, 5, 23, 53, 24, 47, 0, 54, 25, 16, 0, 57, 
+25, 48, 25, 62, 25, 5, 24, 62, 24, 6, 23, 66, 20, 3, 2, 18, 
+21, 13, 0, 39, 23, 49, 0, 53, 24, 52, 0, 53, 25, 50, 0, 54, 
+26, 16, 0, 57, 26, 51, 26, 62, 26, 5, 25, 62, 25, 1, 24, 53, 
+25, 53, 0, 54, 26, 16, 0, 57, 26, 54, 26, 62, 26, 5, 25, 62, 
+25, 3, 24, 53, 25, 55, 0, 54, 26, 16, 0, 57, 26, 56, 26, 62, 
+26, 5, 25, 62, 25, 4, 24, 66, 21, 3, 2, 18, 22, 13, 0, 39, 
+24, 57, 0, 53, 25, 66, 0, 53, 26, 58, 0, 54, 27, 16, 0, 57, 
+27, 59, 27, 62, 27, 5, 26, 62, 26, 1, 25, 53, 26, 60, 0, 54, 
+27, 16, 0, 57, 27, 61, 27, 62, 27, 5, 26, 62, 26, 2, 25, 53, 
+26, 62, 0, 54, 27, 16, 0, 57, 27, 63, 27, 62, 27, 5, 26, 62, 
+26, 3, 25, 53, 26, 64, 0, 54, 27, 16, 0, 57, 27, 65, 27, 62, 
+27, 5, 26, 62, 26, 4, 25, 53, 26, 67, 0, 54, 27, 16, 0, 57, 
+27, 68, 27, 62, 27, 5, 26, 62, 26, 6, 25, 53, 26, 69, 0, 62, 
+18, 5, 26, 62, 26, 7, 25, 53, 26, 70, 0, 62, 19, 5, 26, 62, 
+26, 8, 25, 53, 26, 71, 0, 54, 27, 16, 0, 57, 27, 72, 27, 62, 
+27, 5, 26, 62, 26, 9, 25, 53, 26, 73, 0, 62, 20, 5, 26, 62, 
+26, 11, 25, 53, 26, 74, 0, 62, 21, 5, 26, 62, 26, 12, 25, 53, 
+26, 75, 0, 54, 27, 16, 0, 57, 27, 76, 27, 62, 27, 5, 26, 62, 
+26, 14, 25, 53, 26, 77, 0, 54, 27, 16, 0, 57, 27, 78, 27, 62, 
+27, 5, 26, 62, 26, 15, 25, 66, 22, 3, 2, 18, 23, 13, 0, 39, 
+25, 79, 0, 52, 26, 4, 0, 53, 27, 80, 0, 52, 28, 3, 0, 62, 
+17, 1, 28, 54, 29, 16, 0, 57, 29, 81, 29, 62, 29, 2, 28, 62, 
+28, 5, 27, 62, 27, 1, 26, 53, 27, 82, 0, 54, 28, 16, 0, 57, 
+28, 83, 28, 62, 28, 5, 27, 62, 27, 2, 26, 53, 27, 84, 0, 52, 
+28, 3, 0, 62, 17, 1, 28, 54, 29, 16, 0, 57, 29, 85, 29, 62, 
+29, 2, 28, 62, 28, 5, 27, 62, 27, 3, 26, 66, 23, 3, 2, 18, 
+24, 13, 0, 39, 26, 86, 0, 53, 27, 95, 0, 53, 28, 87, 0, 52, 
+29, 3, 0, 62, 17, 1, 29, 54, 30, 16, 0, 57, 30, 88, 30, 62, 
+30, 2, 29, 62, 29, 5, 28, 62, 28, 1, 27, 53, 28, 89, 0, 54, 
+29, 16, 0, 57, 29, 90, 29, 62, 29, 5, 28, 62, 28, 2, 27, 53, 
+28, 91, 0, 52, 29, 3, 0, 62, 17, 1, 29, 54, 30, 16, 0, 57, 
+30, 92, 30, 62, 30, 2, 29, 62, 29, 5, 28, 62, 28, 3, 27, 53, 
+28, 93, 0, 52, 29, 3, 0, 62, 17, 1, 29, 54, 30, 16, 0, 57, 
+30, 94, 30, 62, 30, 2, 29, 62, 29, 5, 28, 62, 28, 4, 27, 53, 
+28, 96, 0, 54, 29, 16, 0, 57, 29, 97, 29, 62, 29, 5, 28, 62, 
+28, 6, 27, 53, 28, 98, 0, 54, 29, 16, 0, 57, 29, 99, 29, 62, 
+29, 5, 28, 62, 28, 7, 27, 53, 28, 100, 0, 54, 29, 16, 0, 57, 
+29, 101, 29, 62, 29, 5, 28, 62, 28, 9, 27, 53, 28, 102, 0, 54, 
+29, 16, 0, 57, 29, 103, 29, 62, 29, 5, 28, 62, 28, 10, 27, 53, 
+28, 104, 0, 52, 29, 3, 0, 62, 17, 1, 29, 54, 30, 16, 0, 57, 
+30, 105, 30, 62, 30, 2, 29, 62, 29, 5, 28, 62, 28, 11, 27, 53, 
+28, 106, 0, 54, 29, 16, 0, 57, 29, 107, 29, 62, 29, 5, 28, 62, 
+28, 13, 27, 53, 28, 108, 0, 62, 23, 5, 28, 62, 28, 14, 27, 66, 
+24, 3, 2, 18, 25, 13, 0, 39, 27, 109, 0, 52, 28, 5, 0, 53, 
+29, 110, 0, 51, 30, 111, 0, 62, 30, 5, 29, 62, 29, 1, 28, 53, 
+29, 112, 0, 51, 30, 113, 0, 62, 30, 5, 29, 62, 29, 2, 28, 53, 
+29, 114, 0, 51, 30, 115, 0, 62, 30, 5, 29, 62, 29, 3, 28, 53, 
+29, 116, 0, 51, 30, 117, 0, 62, 30, 5, 29, 62, 29, 4, 28, 66, 
+25, 3, 2, 18, 26, 13, 0, 39, 28, 118, 0, 53, 29, 127, 0, 53, 
+30, 119, 0, 52, 31, 3, 0, 62, 17, 1, 31, 51, 32, 120, 0, 62, 
+32, 2, 31, 62, 31, 5, 30, 62, 30, 1, 29, 53, 30, 121, 0, 52, 
+31, 3, 0, 62, 17, 1, 31, 51, 32, 122, 0, 62, 32, 2, 31, 62, 
+31, 5, 30, 62, 30, 2, 29, 53, 30, 123, 0, 52, 31, 3, 0, 62, 
+17, 1, 31, 51, 32, 124, 0, 62, 32, 2, 31, 62, 31, 5, 30, 62, 
+30, 3, 29, 53, 30, 125, 0, 52, 31, 3, 0, 62, 17, 1, 31, 51, 
+32, 126, 0, 62, 32, 2, 31, 62, 31, 5, 30, 62, 30, 4, 29, 53, 
+30, 128, 0, 62, 16, 5, 30, 62, 30, 6, 29, 53, 30, 129, 0, 62, 
+25, 5, 30, 62, 30, 7, 29, 53, 30, 130, 0, 54, 31, 16, 0, 57, 
+31, 131, 31, 62, 31, 5, 30, 62, 30, 8, 29, 66, 26, 3, 2, 18, 
+27, 13, 0, 39, 29, 132, 0, 52, 30, 34, 0, 53, 31, 133, 0, 52, 
+32, 3, 0, 54, 33, 16, 0, 57, 33, 134, 33, 62, 33, 1, 32, 54, 
+33, 16, 0, 57, 33, 135, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 
+31, 1, 30, 53, 31, 136, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 
+33, 134, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 33, 137, 33, 62, 
+33, 2, 32, 62, 32, 5, 31, 62, 31, 2, 30, 53, 31, 138, 0, 52, 
+32, 3, 0, 54, 33, 16, 0, 57, 33, 134, 33, 62, 33, 1, 32, 54, 
+33, 16, 0, 57, 33, 139, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 
+31, 3, 30, 53, 31, 140, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 
+33, 134, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 33, 141, 33, 62, 
+33, 2, 32, 62, 32, 5, 31, 62, 31, 4, 30, 53, 31, 142, 0, 52, 
+32, 3, 0, 54, 33, 16, 0, 57, 33, 143, 33, 62, 33, 1, 32, 54, 
+33, 16, 0, 57, 33, 135, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 
+31, 5, 30, 53, 31, 144, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 
+33, 143, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 33, 137, 33, 62, 
+33, 2, 32, 62, 32, 5, 31, 62, 31, 6, 30, 53, 31, 145, 0, 52, 
+32, 3, 0, 54, 33, 16, 0, 57, 33, 143, 33, 62, 33, 1, 32, 54, 
+33, 16, 0, 57, 33, 139, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 
+31, 7, 30, 53, 31, 146, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 
+33, 143, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 33, 141, 33, 62, 
+33, 2, 32, 62, 32, 5, 31, 62, 31, 8, 30, 53, 31, 147, 0, 54, 
+32, 16, 0, 57, 32, 148, 32, 62, 32, 5, 31, 62, 31, 9, 30, 53, 
+31, 149, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 134, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 150, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 10, 30, 53, 31, 151, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 134, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 152, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 11, 30, 53, 
+31, 153, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 134, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 154, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 12, 30, 53, 31, 155, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 134, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 156, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 13, 30, 53, 
+31, 157, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 143, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 150, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 14, 30, 53, 31, 158, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 143, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 152, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 15, 30, 53, 
+31, 159, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 143, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 154, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 16, 30, 53, 31, 160, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 143, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 156, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 17, 30, 53, 
+31, 161, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 134, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 162, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 18, 30, 53, 31, 163, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 134, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 164, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 19, 30, 53, 
+31, 165, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 143, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 162, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 20, 30, 53, 31, 166, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 143, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 164, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 21, 30, 53, 
+31, 167, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 134, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 168, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 22, 30, 53, 31, 169, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 134, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 170, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 23, 30, 53, 
+31, 171, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 143, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 168, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 24, 30, 53, 31, 172, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 143, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 170, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 25, 30, 53, 
+31, 173, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 134, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 174, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 26, 30, 53, 31, 175, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 134, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 176, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 27, 30, 53, 
+31, 177, 0, 52, 32, 3, 0, 54, 33, 16, 0, 57, 33, 143, 33, 62, 
+33, 1, 32, 54, 33, 16, 0, 57, 33, 174, 33, 62, 33, 2, 32, 62, 
+32, 5, 31, 62, 31, 28, 30, 53, 31, 178, 0, 52, 32, 3, 0, 54, 
+33, 16, 0, 57, 33, 143, 33, 62, 33, 1, 32, 54, 33, 16, 0, 57, 
+33, 176, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 29, 30, 53, 
+31, 179, 0, 52, 32, 3, 0, 62, 17, 1, 32, 54, 33, 16, 0, 57, 
+33, 180, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 30, 30, 53, 
+31, 181, 0, 52, 32, 3, 0, 62, 17, 1, 32, 54, 33, 16, 0, 57, 
+33, 182, 33, 62, 33, 2, 32, 62, 32, 5, 31, 62, 31, 31, 30, 53, 
+31, 183, 0, 52, 32, 4, 0, 62, 17, 1, 32, 54, 33, 16, 0, 57, 
+33, 184, 33, 62, 33, 2, 32, 54, 33, 16, 0, 57, 33, 185, 33, 62, 
+33, 3, 32, 62, 32, 5, 31, 62, 31, 32, 30, 53, 31, 186, 0, 54, 
+32, 16, 0, 57, 32, 187, 32, 62, 32, 5, 31, 62, 31, 33, 30, 66, 
+27, 3, 2, 18, 28, 13, 0, 39, 30, 188, 0, 52, 31, 6, 0, 53, 
+32, 189, 0, 62, 22, 5, 32, 62, 32, 1, 31, 53, 32, 190, 0, 62, 
+24, 5, 32, 62, 32, 2, 31, 53, 32, 191, 0, 62, 26, 5, 32, 62, 
+32, 3, 31, 53, 32, 192, 0, 62, 15, 5, 32, 62, 32, 4, 31, 53, 
+32, 193, 0, 62, 27, 5, 32, 62, 32, 5, 31, 66, 28, 3, 2, 51, 
+29, 194, 0, 55, 29, 195, 0, 51, 29, 196, 0, 55, 29, 197, 0, 53, 
+29, 199, 0, 51, 30, 198, 0, 61, 30, 200, 29, 51, 30, 201, 0, 61, 
+30, 202, 29, 51, 30, 203, 0, 61, 30, 204, 29, 51, 30, 205, 0, 61, 
+30, 206, 29, 51, 30, 207, 0, 61, 30, 208, 29, 55, 29, 209, 0, 51, 
+29, 210, 0, 55, 29, 211, 0, 51, 29, 212, 0, 55, 29, 213, 0, 51, 
+29, 214, 0, 55, 29, 215, 0, 51, 29, 216, 0, 55, 29, 217, 0, 50, 
+0, 0, 128, 75, 0, 1, 0, 18, 76, 105, 115, 116, 77, 101, 110, 117, 
+73, 116, 101, 109, 115, 0, 25, 82, 101, 98, 117, 105, 108, 100, 68, 111, 
+99, 117, 109, 101, 110, 116, 115, 77, 101, 110, 117, 0, 31, 82, 101, 98, 
+117, 105, 108, 100, 80, 97, 114, 97, 103, 114, 97, 112, 104, 83, 116, 121, 
+108, 101, 115, 77, 101, 110, 117, 0, 15, 67, 114, 101, 97, 116, 101, 77, 
+101, 110, 117, 0, 14, 77, 101, 110, 117, 67, 108, 97, 115, 115, 22, 108, 
+111, 111, 107, 117, 112, 65, 99, 99, 101, 108, 101, 114, 97, 116, 111, 114, 
+0, 12, 114, 117, 110, 109, 101, 110, 117, 0, 18, 100, 114, 97, 119, 109, 
+101, 110, 117, 115, 116, 97, 99, 107, 0, 13, 100, 114, 97, 119, 109, 101, 
+110, 117, 0, 13, 97, 99, 116, 105, 118, 97, 116, 101, 1, 0, 5, 18, 
+100, 114, 97, 119, 109, 101, 110, 117, 115, 116, 97, 99, 107, 0, 13, 100, 
+114, 97, 119, 109, 101, 110, 117, 0, 12, 114, 117, 110, 109, 101, 110, 117, 
+0, 22, 108, 111, 111, 107, 117, 112, 65, 99, 99, 101, 108, 101, 114, 97, 
+116, 111, 114, 0, 13, 97, 99, 116, 105, 118, 97, 116, 101, 0, 0, 18, 
+82, 117, 110, 77, 101, 110, 117, 65, 99, 116, 105, 111, 110, 0, 11, 73, 
+115, 77, 101, 110, 117, 0, 1, 4, 0, 0, 6, 90, 6, 90, 19, 78, 
+97, 118, 105, 103, 97, 116, 105, 111, 110, 32, 226, 150, 183, 1, 4, 0, 
+0, 6, 68, 6, 68, 18, 68, 111, 99, 117, 109, 101, 110, 116, 115, 32, 
+226, 150, 183, 1, 4, 0, 0, 6, 83, 6, 83, 14, 83, 116, 121, 108, 
+101, 32, 226, 150, 183, 1, 4, 0, 0, 6, 69, 6, 69, 13, 69, 100, 
+105, 116, 32, 226, 150, 183, 1, 4, 0, 0, 6, 70, 6, 70, 13, 70, 
+105, 108, 101, 32, 226, 150, 183, 14, 77, 97, 105, 110, 32, 77, 101, 110, 
+117, 15, 84, 111, 103, 103, 108, 101, 77, 97, 114, 107, 1, 5, 0, 0, 
+7, 90, 77, 0, 16, 84, 111, 103, 103, 108, 101, 32, 109, 97, 114, 107, 
+7, 94, 64, 15, 68, 101, 108, 101, 116, 101, 87, 111, 114, 100, 22, 84, 
+121, 112, 101, 87, 104, 105, 108, 101, 83, 101, 108, 101, 99, 116, 101, 100, 
+1, 5, 0, 0, 8, 90, 68, 87, 0, 16, 68, 101, 108, 101, 116, 101, 
+32, 119, 111, 114, 100, 7, 94, 69, 30, 68, 101, 108, 101, 116, 101, 83, 
+101, 108, 101, 99, 116, 105, 111, 110, 79, 114, 78, 101, 120, 116, 67, 104, 
+97, 114, 1, 5, 0, 0, 9, 90, 68, 78, 67, 0, 26, 68, 101, 108, 
+101, 116, 101, 32, 110, 101, 120, 116, 32, 99, 104, 97, 114, 97, 99, 116, 
+101, 114, 11, 68, 69, 76, 69, 84, 69, 34, 68, 101, 108, 101, 116, 101, 
+83, 101, 108, 101, 99, 116, 105, 111, 110, 79, 114, 80, 114, 101, 118, 105, 
+111, 117, 115, 67, 104, 97, 114, 1, 5, 0, 0, 9, 90, 68, 80, 67, 
+0, 30, 68, 101, 108, 101, 116, 101, 32, 112, 114, 101, 118, 105, 111, 117, 
+115, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 14, 66, 65, 67, 75, 
+83, 80, 65, 67, 69, 1, 5, 0, 0, 11, 90, 83, 80, 71, 68, 78, 
+0, 24, 83, 101, 108, 101, 99, 116, 105, 111, 110, 32, 112, 97, 103, 101, 
+32, 100, 111, 119, 110, 10, 83, 80, 71, 68, 78, 1, 5, 0, 0, 11, 
+90, 83, 80, 71, 85, 80, 0, 22, 83, 101, 108, 101, 99, 116, 105, 111, 
+110, 32, 112, 97, 103, 101, 32, 117, 112, 10, 83, 80, 71, 85, 80, 17, 
+71, 111, 116, 111, 78, 101, 120, 116, 80, 97, 103, 101, 1, 5, 0, 0, 
+10, 90, 80, 71, 68, 78, 0, 14, 80, 97, 103, 101, 32, 100, 111, 119, 
+110, 9, 80, 71, 68, 78, 21, 71, 111, 116, 111, 80, 114, 101, 118, 105, 
+111, 117, 115, 80, 97, 103, 101, 1, 5, 0, 0, 10, 90, 80, 71, 85, 
+80, 0, 12, 80, 97, 103, 101, 32, 117, 112, 9, 80, 71, 85, 80, 1, 
+5, 0, 0, 9, 90, 83, 69, 68, 0, 30, 83, 101, 108, 101, 99, 116, 
+32, 116, 111, 32, 101, 110, 100, 32, 111, 102, 32, 100, 111, 99, 117, 109, 
+101, 110, 116, 11, 83, 94, 80, 71, 68, 78, 1, 5, 0, 0, 9, 90, 
+83, 66, 68, 0, 36, 83, 101, 108, 101, 99, 116, 32, 116, 111, 32, 98, 
+101, 103, 105, 110, 110, 105, 110, 103, 32, 111, 102, 32, 100, 111, 99, 117, 
+109, 101, 110, 116, 11, 83, 94, 80, 71, 85, 80, 22, 71, 111, 116, 111, 
+69, 110, 100, 79, 102, 68, 111, 99, 117, 109, 101, 110, 116, 1, 5, 0, 
+0, 8, 90, 69, 68, 0, 25, 71, 111, 116, 111, 32, 101, 110, 100, 32, 
+111, 102, 32, 100, 111, 99, 117, 109, 101, 110, 116, 10, 94, 80, 71, 68, 
+78, 28, 71, 111, 116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 
+102, 68, 111, 99, 117, 109, 101, 110, 116, 1, 5, 0, 0, 8, 90, 66, 
+68, 0, 31, 71, 111, 116, 111, 32, 98, 101, 103, 105, 110, 110, 105, 110, 
+103, 32, 111, 102, 32, 100, 111, 99, 117, 109, 101, 110, 116, 10, 94, 80, 
+71, 85, 80, 1, 5, 0, 0, 8, 90, 83, 69, 0, 26, 83, 101, 108, 
+101, 99, 116, 32, 116, 111, 32, 101, 110, 100, 32, 111, 102, 32, 108, 105, 
+110, 101, 9, 83, 69, 78, 68, 1, 5, 0, 0, 8, 90, 83, 72, 0, 
+32, 83, 101, 108, 101, 99, 116, 32, 116, 111, 32, 98, 101, 103, 105, 110, 
+110, 105, 110, 103, 32, 111, 102, 32, 108, 105, 110, 101, 10, 83, 72, 79, 
+77, 69, 18, 71, 111, 116, 111, 69, 110, 100, 79, 102, 76, 105, 110, 101, 
+1, 5, 0, 0, 7, 90, 69, 0, 21, 71, 111, 116, 111, 32, 101, 110, 
+100, 32, 111, 102, 32, 108, 105, 110, 101, 8, 69, 78, 68, 24, 71, 111, 
+116, 111, 66, 101, 103, 105, 110, 110, 105, 110, 103, 79, 102, 76, 105, 110, 
+101, 1, 5, 0, 0, 7, 90, 72, 0, 27, 71, 111, 116, 111, 32, 98, 
+101, 103, 105, 110, 110, 105, 110, 103, 32, 111, 102, 32, 108, 105, 110, 101, 
+9, 72, 79, 77, 69, 1, 5, 0, 0, 9, 90, 83, 80, 80, 0, 33, 
+83, 101, 108, 101, 99, 116, 32, 116, 111, 32, 112, 114, 101, 118, 105, 111, 
+117, 115, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 9, 83, 94, 85, 
+80, 1, 5, 0, 0, 9, 90, 83, 78, 80, 0, 29, 83, 101, 108, 101, 
+99, 116, 32, 116, 111, 32, 110, 101, 120, 116, 32, 112, 97, 114, 97, 103, 
+114, 97, 112, 104, 11, 83, 94, 68, 79, 87, 78, 1, 5, 0, 0, 9, 
+90, 83, 87, 82, 0, 24, 83, 101, 108, 101, 99, 116, 32, 116, 111, 32, 
+110, 101, 120, 116, 32, 119, 111, 114, 100, 12, 83, 94, 82, 73, 71, 72, 
+84, 1, 5, 0, 0, 9, 90, 83, 87, 76, 0, 28, 83, 101, 108, 101, 
+99, 116, 32, 116, 111, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 119, 
+111, 114, 100, 11, 83, 94, 76, 69, 70, 84, 27, 71, 111, 116, 111, 80, 
+114, 101, 118, 105, 111, 117, 115, 80, 97, 114, 97, 103, 114, 97, 112, 104, 
+87, 1, 5, 0, 0, 8, 90, 80, 80, 0, 28, 71, 111, 116, 111, 32, 
+112, 114, 101, 118, 105, 111, 117, 115, 32, 112, 97, 114, 97, 103, 114, 97, 
+112, 104, 8, 94, 85, 80, 23, 71, 111, 116, 111, 78, 101, 120, 116, 80, 
+97, 114, 97, 103, 114, 97, 112, 104, 87, 1, 5, 0, 0, 8, 90, 78, 
+80, 0, 24, 71, 111, 116, 111, 32, 110, 101, 120, 116, 32, 112, 97, 114, 
+97, 103, 114, 97, 112, 104, 10, 94, 68, 79, 87, 78, 18, 71, 111, 116, 
+111, 78, 101, 120, 116, 87, 111, 114, 100, 87, 1, 5, 0, 0, 8, 90, 
+87, 82, 0, 19, 71, 111, 116, 111, 32, 110, 101, 120, 116, 32, 119, 111, 
+114, 100, 11, 94, 82, 73, 71, 72, 84, 22, 71, 111, 116, 111, 80, 114, 
+101, 118, 105, 111, 117, 115, 87, 111, 114, 100, 87, 1, 5, 0, 0, 8, 
+90, 87, 76, 0, 23, 71, 111, 116, 111, 32, 112, 114, 101, 118, 105, 111, 
+117, 115, 32, 119, 111, 114, 100, 10, 94, 76, 69, 70, 84, 15, 83, 101, 
+108, 101, 99, 116, 87, 111, 114, 100, 1, 5, 0, 0, 8, 90, 83, 87, 
+0, 16, 83, 101, 108, 101, 99, 116, 32, 119, 111, 114, 100, 7, 94, 87, 
+1, 5, 0, 0, 8, 90, 83, 76, 0, 19, 83, 101, 108, 101, 99, 116, 
+105, 111, 110, 32, 108, 101, 102, 116, 10, 83, 76, 69, 70, 84, 1, 5, 
+0, 0, 8, 90, 83, 68, 0, 19, 83, 101, 108, 101, 99, 116, 105, 111, 
+110, 32, 100, 111, 119, 110, 10, 83, 68, 79, 87, 78, 1, 5, 0, 0, 
+8, 90, 83, 82, 0, 20, 83, 101, 108, 101, 99, 116, 105, 111, 110, 32, 
+114, 105, 103, 104, 116, 11, 83, 82, 73, 71, 72, 84, 12, 83, 101, 116, 
+77, 97, 114, 107, 1, 5, 0, 0, 8, 90, 83, 85, 0, 17, 83, 101, 
+108, 101, 99, 116, 105, 111, 110, 32, 117, 112, 8, 83, 85, 80, 22, 71, 
+111, 116, 111, 80, 114, 101, 118, 105, 111, 117, 115, 67, 104, 97, 114, 87, 
+1, 5, 0, 0, 7, 90, 76, 0, 16, 67, 117, 114, 115, 111, 114, 32, 
+108, 101, 102, 116, 9, 76, 69, 70, 84, 17, 71, 111, 116, 111, 78, 101, 
+120, 116, 76, 105, 110, 101, 1, 5, 0, 0, 7, 90, 68, 0, 16, 67, 
+117, 114, 115, 111, 114, 32, 100, 111, 119, 110, 9, 68, 79, 87, 78, 18, 
+71, 111, 116, 111, 78, 101, 120, 116, 67, 104, 97, 114, 87, 1, 5, 0, 
+0, 7, 90, 82, 0, 17, 67, 117, 114, 115, 111, 114, 32, 114, 105, 103, 
+104, 116, 10, 82, 73, 71, 72, 84, 21, 71, 111, 116, 111, 80, 114, 101, 
+118, 105, 111, 117, 115, 76, 105, 110, 101, 22, 77, 111, 118, 101, 87, 104, 
+105, 108, 101, 83, 101, 108, 101, 99, 116, 101, 100, 1, 5, 0, 0, 7, 
+90, 85, 0, 14, 67, 117, 114, 115, 111, 114, 32, 117, 112, 7, 85, 80, 
+15, 78, 97, 118, 105, 103, 97, 116, 105, 111, 110, 20, 84, 111, 103, 103, 
+108, 101, 83, 116, 97, 116, 117, 115, 66, 97, 114, 1, 4, 0, 0, 7, 
+83, 83, 6, 83, 22, 84, 111, 103, 103, 108, 101, 32, 115, 116, 97, 116, 
+117, 115, 32, 98, 97, 114, 1, 4, 0, 0, 7, 83, 77, 6, 77, 24, 
+83, 101, 116, 32, 109, 97, 114, 103, 105, 110, 32, 109, 111, 100, 101, 32, 
+226, 150, 183, 1, 5, 0, 0, 7, 83, 80, 6, 80, 31, 67, 104, 97, 
+110, 103, 101, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 32, 115, 116, 
+121, 108, 101, 32, 226, 150, 183, 7, 94, 80, 1, 6, 0, 0, 0, 0, 
+0, 0, 6, 45, 0, 1, 5, 0, 0, 7, 83, 79, 6, 79, 14, 83, 
+101, 116, 32, 112, 108, 97, 105, 110, 7, 94, 79, 0, 1, 5, 0, 0, 
+7, 83, 66, 6, 66, 13, 83, 101, 116, 32, 98, 111, 108, 100, 7, 94, 
+66, 0, 1, 5, 0, 0, 7, 83, 85, 6, 85, 18, 83, 101, 116, 32, 
+117, 110, 100, 101, 114, 108, 105, 110, 101, 7, 94, 85, 0, 1, 5, 0, 
+0, 7, 83, 73, 6, 73, 15, 83, 101, 116, 32, 105, 116, 97, 108, 105, 
+99, 7, 94, 73, 10, 83, 116, 121, 108, 101, 0, 1, 4, 0, 0, 8, 
+83, 77, 52, 6, 87, 31, 83, 104, 111, 119, 32, 112, 97, 114, 97, 103, 
+114, 97, 112, 104, 32, 119, 111, 114, 100, 32, 99, 111, 117, 110, 116, 115, 
+0, 1, 4, 0, 0, 8, 83, 77, 51, 6, 78, 27, 83, 104, 111, 119, 
+32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 32, 110, 117, 109, 98, 101, 
+114, 115, 0, 1, 4, 0, 0, 8, 83, 77, 50, 6, 83, 26, 83, 104, 
+111, 119, 32, 112, 97, 114, 97, 103, 114, 97, 112, 104, 32, 115, 116, 121, 
+108, 101, 115, 0, 1, 4, 0, 0, 8, 83, 77, 49, 6, 72, 16, 72, 
+105, 100, 101, 32, 109, 97, 114, 103, 105, 110, 11, 77, 97, 114, 103, 105, 
+110, 1, 4, 0, 0, 15, 69, 115, 99, 114, 97, 112, 98, 111, 111, 107, 
+6, 83, 18, 83, 99, 114, 97, 112, 98, 111, 111, 107, 32, 226, 150, 183, 
+9, 71, 111, 116, 111, 1, 5, 0, 0, 7, 69, 71, 6, 71, 13, 71, 
+111, 32, 116, 111, 46, 46, 46, 7, 94, 71, 20, 82, 101, 112, 108, 97, 
+99, 101, 84, 104, 101, 110, 70, 105, 110, 100, 1, 5, 0, 0, 7, 69, 
+82, 6, 82, 22, 82, 101, 112, 108, 97, 99, 101, 32, 116, 104, 101, 110, 
+32, 102, 105, 110, 100, 7, 94, 82, 13, 70, 105, 110, 100, 78, 101, 120, 
+116, 1, 5, 0, 0, 7, 69, 78, 6, 78, 14, 70, 105, 110, 100, 32, 
+110, 101, 120, 116, 7, 94, 75, 9, 70, 105, 110, 100, 1, 5, 0, 0, 
+7, 69, 70, 6, 70, 24, 70, 105, 110, 100, 32, 97, 110, 100, 32, 114, 
+101, 112, 108, 97, 99, 101, 46, 46, 46, 7, 94, 70, 9, 82, 101, 100, 
+111, 1, 5, 0, 0, 10, 69, 114, 101, 100, 111, 6, 69, 9, 82, 101, 
+100, 111, 7, 94, 89, 9, 85, 110, 100, 111, 1, 5, 0, 0, 10, 69, 
+117, 110, 100, 111, 6, 85, 9, 85, 110, 100, 111, 7, 94, 90, 1, 13, 
+0, 0, 0, 0, 0, 0, 6, 45, 0, 0, 6, 45, 0, 0, 0, 6, 
+45, 11, 68, 101, 108, 101, 116, 101, 1, 4, 0, 0, 7, 69, 68, 6, 
+68, 11, 68, 101, 108, 101, 116, 101, 10, 80, 97, 115, 116, 101, 1, 5, 
+0, 0, 7, 69, 80, 6, 80, 10, 80, 97, 115, 116, 101, 7, 94, 86, 
+9, 67, 111, 112, 121, 1, 5, 0, 0, 7, 69, 67, 6, 67, 9, 67, 
+111, 112, 121, 7, 94, 67, 8, 67, 117, 116, 1, 5, 0, 0, 7, 69, 
+84, 6, 84, 8, 67, 117, 116, 7, 94, 88, 9, 69, 100, 105, 116, 21, 
+80, 97, 115, 116, 101, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 
+1, 4, 0, 0, 12, 69, 83, 112, 97, 115, 116, 101, 6, 80, 23, 80, 
+97, 115, 116, 101, 32, 116, 111, 32, 115, 99, 114, 97, 112, 98, 111, 111, 
+107, 20, 67, 111, 112, 121, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 
+107, 1, 4, 0, 0, 11, 69, 83, 99, 111, 112, 121, 6, 67, 22, 67, 
+111, 112, 121, 32, 116, 111, 32, 115, 99, 114, 97, 112, 98, 111, 111, 107, 
+19, 67, 117, 116, 84, 111, 83, 99, 114, 97, 112, 98, 111, 111, 107, 1, 
+4, 0, 0, 10, 69, 83, 99, 117, 116, 6, 84, 21, 67, 117, 116, 32, 
+116, 111, 32, 115, 99, 114, 97, 112, 98, 111, 111, 107, 14, 83, 99, 114, 
+97, 112, 98, 111, 111, 107, 21, 84, 101, 114, 109, 105, 110, 97, 116, 101, 
+80, 114, 111, 103, 114, 97, 109, 1, 5, 0, 0, 7, 70, 81, 6, 88, 
+9, 69, 120, 105, 116, 7, 94, 81, 21, 65, 98, 111, 117, 116, 87, 111, 
+114, 100, 71, 114, 105, 110, 100, 101, 114, 1, 4, 0, 0, 11, 70, 97, 
+98, 111, 117, 116, 6, 90, 25, 65, 98, 111, 117, 116, 32, 87, 111, 114, 
+100, 71, 114, 105, 110, 100, 101, 114, 46, 46, 46, 1, 4, 0, 0, 13, 
+70, 103, 108, 111, 98, 97, 108, 115, 6, 71, 24, 71, 108, 111, 98, 97, 
+108, 32, 115, 101, 116, 116, 105, 110, 103, 115, 32, 226, 150, 183, 1, 4, 
+0, 0, 14, 70, 115, 101, 116, 116, 105, 110, 103, 115, 6, 84, 26, 68, 
+111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 116, 105, 110, 103, 115, 
+32, 226, 150, 183, 22, 77, 97, 110, 97, 103, 101, 68, 111, 99, 117, 109, 
+101, 110, 116, 115, 85, 73, 1, 4, 0, 0, 12, 70, 100, 111, 99, 109, 
+97, 110, 6, 68, 24, 77, 97, 110, 97, 103, 101, 32, 100, 111, 99, 117, 
+109, 101, 110, 116, 115, 46, 46, 46, 1, 4, 0, 0, 7, 70, 69, 6, 
+69, 32, 69, 120, 112, 111, 114, 116, 32, 99, 117, 114, 114, 101, 110, 116, 
+32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 226, 150, 183, 1, 4, 0, 
+0, 7, 70, 73, 6, 73, 28, 73, 109, 112, 111, 114, 116, 32, 110, 101, 
+119, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 226, 150, 183, 21, 65, 
+100, 100, 66, 108, 97, 110, 107, 68, 111, 99, 117, 109, 101, 110, 116, 1, 
+4, 0, 0, 7, 70, 66, 6, 66, 27, 65, 100, 100, 32, 110, 101, 119, 
+32, 98, 108, 97, 110, 107, 32, 100, 111, 99, 117, 109, 101, 110, 116, 1, 
+14, 0, 0, 0, 0, 0, 0, 6, 45, 0, 0, 0, 0, 6, 45, 0, 
+0, 6, 45, 26, 83, 97, 118, 101, 67, 117, 114, 114, 101, 110, 116, 68, 
+111, 99, 117, 109, 101, 110, 116, 65, 115, 1, 4, 0, 0, 7, 70, 65, 
+6, 65, 28, 83, 97, 118, 101, 32, 100, 111, 99, 117, 109, 101, 110, 116, 
+32, 115, 101, 116, 32, 97, 115, 46, 46, 46, 24, 83, 97, 118, 101, 67, 
+117, 114, 114, 101, 110, 116, 68, 111, 99, 117, 109, 101, 110, 116, 1, 5, 
+0, 0, 7, 70, 83, 6, 83, 22, 83, 97, 118, 101, 32, 100, 111, 99, 
+117, 109, 101, 110, 116, 32, 115, 101, 116, 7, 94, 83, 20, 76, 111, 97, 
+100, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 1, 4, 0, 0, 
+7, 70, 79, 6, 79, 25, 76, 111, 97, 100, 32, 100, 111, 99, 117, 109, 
+101, 110, 116, 32, 115, 101, 116, 46, 46, 46, 27, 67, 114, 101, 97, 116, 
+101, 66, 108, 97, 110, 107, 68, 111, 99, 117, 109, 101, 110, 116, 83, 101, 
+116, 1, 4, 0, 0, 7, 70, 78, 6, 78, 21, 78, 101, 119, 32, 100, 
+111, 99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 9, 70, 105, 108, 101, 
+20, 68, 117, 109, 112, 82, 101, 110, 100, 101, 114, 83, 116, 97, 116, 115, 
+1, 4, 0, 0, 18, 70, 83, 82, 101, 110, 100, 101, 114, 83, 116, 97, 
+116, 115, 6, 82, 28, 82, 101, 110, 100, 101, 114, 105, 110, 103, 32, 115, 
+116, 97, 116, 105, 115, 116, 105, 99, 115, 46, 46, 46, 19, 67, 111, 110, 
+102, 105, 103, 117, 114, 101, 68, 101, 98, 117, 103, 1, 4, 0, 0, 12, 
+70, 83, 68, 101, 98, 117, 103, 6, 68, 25, 68, 101, 98, 117, 103, 103, 
+105, 110, 103, 32, 111, 112, 116, 105, 111, 110, 115, 46, 46, 46, 1, 3, 
+0, 0, 0, 6, 45, 24, 67, 111, 110, 102, 105, 103, 117, 114, 101, 87, 
+105, 100, 101, 115, 99, 114, 101, 101, 110, 1, 4, 0, 0, 17, 70, 83, 
+87, 105, 100, 101, 115, 99, 114, 101, 101, 110, 6, 87, 23, 87, 105, 100, 
+101, 115, 99, 114, 101, 101, 110, 32, 109, 111, 100, 101, 46, 46, 46, 20, 
+71, 108, 111, 98, 97, 108, 32, 115, 101, 116, 116, 105, 110, 103, 115, 26, 
+67, 111, 110, 102, 105, 103, 117, 114, 101, 83, 112, 101, 108, 108, 99, 104, 
+101, 99, 107, 101, 114, 1, 4, 0, 0, 19, 70, 83, 83, 112, 101, 108, 
+108, 99, 104, 101, 99, 107, 101, 114, 6, 67, 20, 83, 112, 101, 108, 108, 
+99, 104, 101, 99, 107, 101, 114, 46, 46, 46, 25, 67, 111, 110, 102, 105, 
+103, 117, 114, 101, 83, 109, 97, 114, 116, 81, 117, 111, 116, 101, 115, 1, 
+4, 0, 0, 18, 70, 83, 83, 109, 97, 114, 116, 113, 117, 111, 116, 101, 
+115, 6, 81, 20, 83, 109, 97, 114, 116, 32, 113, 117, 111, 116, 101, 115, 
+46, 46, 46, 23, 67, 111, 110, 102, 105, 103, 117, 114, 101, 80, 97, 103, 
+101, 67, 111, 117, 110, 116, 1, 4, 0, 0, 16, 70, 83, 80, 97, 103, 
+101, 67, 111, 117, 110, 116, 6, 80, 18, 80, 97, 103, 101, 32, 99, 111, 
+117, 110, 116, 46, 46, 46, 24, 67, 111, 110, 102, 105, 103, 117, 114, 101, 
+72, 84, 77, 76, 69, 120, 112, 111, 114, 116, 1, 4, 0, 0, 17, 70, 
+83, 72, 84, 77, 76, 69, 120, 112, 111, 114, 116, 6, 72, 19, 72, 84, 
+77, 76, 32, 101, 120, 112, 111, 114, 116, 46, 46, 46, 23, 67, 111, 110, 
+102, 105, 103, 117, 114, 101, 83, 99, 114, 97, 112, 98, 111, 111, 107, 1, 
+4, 0, 0, 16, 70, 83, 115, 99, 114, 97, 112, 98, 111, 111, 107, 6, 
+83, 17, 83, 99, 114, 97, 112, 98, 111, 111, 107, 46, 46, 46, 22, 67, 
+111, 110, 102, 105, 103, 117, 114, 101, 65, 117, 116, 111, 115, 97, 118, 101, 
+1, 4, 0, 0, 15, 70, 83, 97, 117, 116, 111, 115, 97, 118, 101, 6, 
+65, 16, 65, 117, 116, 111, 115, 97, 118, 101, 46, 46, 46, 22, 68, 111, 
+99, 117, 109, 101, 110, 116, 32, 115, 101, 116, 116, 105, 110, 103, 115, 20, 
+69, 120, 112, 111, 114, 116, 84, 114, 111, 102, 102, 70, 105, 108, 101, 1, 
+4, 0, 0, 9, 70, 69, 116, 114, 6, 70, 23, 69, 120, 112, 111, 114, 
+116, 32, 116, 111, 32, 84, 114, 111, 102, 102, 46, 46, 46, 20, 69, 120, 
+112, 111, 114, 116, 76, 97, 116, 101, 120, 70, 105, 108, 101, 1, 4, 0, 
+0, 10, 70, 69, 116, 101, 120, 6, 76, 23, 69, 120, 112, 111, 114, 116, 
+32, 116, 111, 32, 76, 97, 84, 101, 88, 46, 46, 46, 19, 69, 120, 112, 
+111, 114, 116, 84, 101, 120, 116, 70, 105, 108, 101, 1, 4, 0, 0, 10, 
+70, 69, 116, 120, 116, 6, 84, 28, 69, 120, 112, 111, 114, 116, 32, 116, 
+111, 32, 112, 108, 97, 105, 110, 32, 116, 101, 120, 116, 46, 46, 46, 19, 
+69, 120, 112, 111, 114, 116, 72, 84, 77, 76, 70, 105, 108, 101, 1, 4, 
+0, 0, 11, 70, 69, 104, 116, 109, 108, 6, 72, 22, 69, 120, 112, 111, 
+114, 116, 32, 116, 111, 32, 72, 84, 77, 76, 46, 46, 46, 18, 69, 120, 
+112, 111, 114, 116, 79, 68, 84, 70, 105, 108, 101, 1, 4, 0, 0, 10, 
+70, 69, 111, 100, 116, 6, 79, 21, 69, 120, 112, 111, 114, 116, 32, 116, 
+111, 32, 79, 68, 84, 46, 46, 46, 28, 69, 120, 112, 111, 114, 116, 32, 
+99, 117, 114, 114, 101, 110, 116, 32, 100, 111, 99, 117, 109, 101, 110, 116, 
+19, 73, 109, 112, 111, 114, 116, 84, 101, 120, 116, 70, 105, 108, 101, 1, 
+4, 0, 0, 10, 70, 73, 116, 120, 116, 6, 84, 24, 73, 109, 112, 111, 
+114, 116, 32, 116, 101, 120, 116, 32, 102, 105, 108, 101, 46, 46, 46, 19, 
+73, 109, 112, 111, 114, 116, 72, 84, 77, 76, 70, 105, 108, 101, 1, 4, 
+0, 0, 11, 70, 73, 104, 116, 109, 108, 6, 72, 24, 73, 109, 112, 111, 
+114, 116, 32, 72, 84, 77, 76, 32, 102, 105, 108, 101, 46, 46, 46, 18, 
+73, 109, 112, 111, 114, 116, 79, 68, 84, 70, 105, 108, 101, 1, 4, 0, 
+0, 10, 70, 73, 111, 100, 116, 6, 79, 23, 73, 109, 112, 111, 114, 116, 
+32, 79, 68, 84, 32, 102, 105, 108, 101, 46, 46, 46, 24, 73, 109, 112, 
+111, 114, 116, 32, 110, 101, 119, 32, 100, 111, 99, 117, 109, 101, 110, 116, 
+15, 67, 104, 101, 99, 107, 112, 111, 105, 110, 116, 8, 67, 109, 100, 21, 
+80, 97, 114, 97, 103, 114, 97, 112, 104, 32, 83, 116, 121, 108, 101, 115, 
+14, 68, 111, 99, 117, 109, 101, 110, 116, 115, 0, 0, 19, 103, 101, 116, 
+115, 116, 114, 105, 110, 103, 119, 105, 100, 116, 104, 14, 115, 101, 116, 110, 
+111, 114, 109, 97, 108, 15, 115, 101, 116, 114, 101, 118, 101, 114, 115, 101, 
+14, 115, 101, 116, 98, 114, 105, 103, 104, 116, 12, 115, 101, 116, 98, 111, 
+108, 100, 11, 103, 111, 116, 111, 120, 121, 12, 103, 101, 116, 99, 104, 97, 
+114, 15, 99, 108, 101, 97, 114, 116, 111, 101, 111, 108, 10, 119, 114, 105, 
+116, 101, 7, 119, 103, 10, 102, 108, 111, 111, 114, 9, 109, 97, 116, 104, 
+0, 
+};
+
+/* This is src/lua/cli.lua */
+static const char file_42[] = {
+27, 76, 74, 2, 10, 101, 2, 0, 5, 1, 4, 0, 16, 45, 0, 0, 
+0, 18, 2, 0, 0, 57, 0, 0, 0, 39, 3, 1, 0, 71, 4, 0, 
+0, 65, 0, 2, 1, 45, 0, 0, 0, 18, 2, 0, 0, 57, 0, 0, 
+0, 39, 3, 2, 0, 66, 0, 3, 1, 45, 0, 0, 0, 18, 2, 0, 
+0, 57, 0, 3, 0, 66, 0, 2, 1, 75, 0, 1, 0, 2, 192, 10, 
+102, 108, 117, 115, 104, 6, 10, 18, 119, 111, 114, 100, 103, 114, 105, 110, 
+100, 101, 114, 58, 32, 10, 119, 114, 105, 116, 101, 58, 2, 0, 3, 0, 
+3, 0, 8, 54, 0, 0, 0, 71, 2, 0, 0, 65, 0, 0, 1, 54, 
+0, 1, 0, 57, 0, 2, 0, 41, 2, 1, 0, 66, 0, 2, 1, 75, 
+0, 1, 0, 9, 101, 120, 105, 116, 7, 111, 115, 15, 67, 76, 73, 77, 
+101, 115, 115, 97, 103, 101, 42, 0, 1, 4, 0, 1, 0, 6, 15, 0, 
+0, 0, 88, 1, 3, 128, 54, 1, 0, 0, 18, 3, 0, 0, 66, 1, 
+2, 1, 75, 0, 1, 0, 15, 67, 76, 73, 77, 101, 115, 115, 97, 103, 
+101, 42, 0, 2, 5, 0, 1, 0, 6, 15, 0, 1, 0, 88, 2, 3, 
+128, 54, 2, 0, 0, 18, 4, 1, 0, 66, 2, 2, 1, 75, 0, 1, 
+0, 15, 67, 76, 73, 77, 101, 115, 115, 97, 103, 101, 59, 1, 0, 1, 
+0, 4, 0, 5, 51, 0, 0, 0, 55, 0, 1, 0, 51, 0, 2, 0, 
+55, 0, 3, 0, 75, 0, 1, 0, 17, 77, 111, 100, 97, 108, 77, 101, 
+115, 115, 97, 103, 101, 0, 21, 73, 109, 109, 101, 100, 105, 97, 116, 101, 
+77, 101, 115, 115, 97, 103, 101, 0, 141, 1, 0, 1, 12, 1, 4, 0, 
+18, 45, 1, 0, 0, 18, 3, 0, 0, 39, 4, 0, 0, 66, 1, 3, 
+7, 15, 0, 3, 0, 88, 7, 2, 128, 14, 0, 4, 0, 88, 7, 5, 
+128, 54, 7, 1, 0, 39, 9, 2, 0, 18, 10, 0, 0, 39, 11, 3, 
+0, 66, 7, 4, 1, 18, 7, 3, 0, 18, 8, 4, 0, 18, 9, 5, 
+0, 18, 10, 6, 0, 74, 7, 5, 0, 0, 0, 6, 39, 31, 117, 110, 
+97, 98, 108, 101, 32, 116, 111, 32, 112, 97, 114, 115, 101, 32, 102, 105, 
+108, 101, 110, 97, 109, 101, 32, 39, 13, 67, 76, 73, 69, 114, 114, 111, 
+114, 26, 94, 40, 46, 42, 41, 37, 46, 40, 37, 119, 42, 41, 40, 58, 
+63, 41, 40, 46, 42, 41, 36, 74, 0, 1, 9, 1, 2, 1, 14, 52, 
+1, 0, 0, 54, 2, 0, 0, 18, 4, 0, 0, 66, 2, 2, 4, 72, 
+5, 3, 128, 21, 7, 1, 0, 22, 7, 0, 7, 60, 5, 7, 1, 70, 
+5, 3, 3, 82, 5, 251, 127, 45, 2, 0, 0, 18, 4, 1, 0, 39, 
+5, 1, 0, 68, 2, 3, 0, 1, 0, 6, 32, 10, 112, 97, 105, 114, 
+115, 2, 164, 8, 3, 1, 31, 4, 29, 3, 168, 1, 54, 1, 0, 0, 
+66, 1, 1, 1, 51, 1, 1, 0, 18, 2, 1, 0, 18, 4, 0, 0, 
+66, 2, 2, 5, 18, 6, 2, 0, 39, 7, 2, 0, 18, 8, 3, 0, 
+38, 6, 8, 6, 51, 7, 3, 0, 45, 8, 2, 0, 56, 8, 3, 8, 
+14, 0, 8, 0, 88, 9, 10, 128, 54, 9, 4, 0, 39, 11, 5, 0, 
+18, 12, 3, 0, 39, 13, 6, 0, 39, 14, 7, 0, 18, 15, 7, 0, 
+45, 17, 2, 0, 66, 15, 2, 2, 39, 16, 8, 0, 66, 9, 7, 1, 
+52, 9, 0, 0, 52, 10, 0, 0, 54, 11, 9, 0, 52, 13, 3, 0, 
+71, 14, 1, 0, 63, 14, 0, 0, 66, 11, 2, 4, 88, 14, 49, 128, 
+18, 16, 1, 0, 18, 18, 15, 0, 66, 16, 2, 5, 18, 20, 16, 0, 
+39, 21, 2, 0, 18, 22, 17, 0, 38, 20, 22, 20, 6, 18, 10, 0, 
+88, 21, 3, 128, 54, 21, 4, 0, 39, 23, 11, 0, 66, 21, 2, 1, 
+45, 21, 3, 0, 56, 21, 17, 21, 14, 0, 21, 0, 88, 22, 10, 128, 
+54, 22, 4, 0, 39, 24, 12, 0, 18, 25, 17, 0, 39, 26, 6, 0, 
+39, 27, 7, 0, 18, 28, 7, 0, 45, 30, 3, 0, 66, 28, 2, 2, 
+39, 29, 8, 0, 66, 22, 7, 1, 21, 22, 9, 0, 22, 22, 1, 22, 
+52, 23, 4, 0, 62, 21, 1, 23, 62, 20, 2, 23, 54, 24, 13, 0, 
+18, 26, 17, 0, 66, 24, 2, 2, 11, 24, 0, 0, 88, 24, 2, 128, 
+43, 24, 1, 0, 88, 25, 1, 128, 43, 24, 2, 0, 62, 24, 3, 23, 
+60, 23, 22, 9, 21, 22, 9, 0, 56, 22, 22, 9, 58, 22, 3, 22, 
+15, 0, 22, 0, 88, 23, 3, 128, 21, 22, 10, 0, 22, 22, 1, 22, 
+60, 20, 22, 10, 69, 14, 3, 3, 82, 14, 205, 127, 21, 11, 10, 0, 
+41, 12, 2, 0, 1, 11, 12, 0, 88, 11, 1, 128, 52, 10, 0, 0, 
+18, 11, 8, 0, 18, 13, 6, 0, 66, 11, 2, 2, 14, 0, 11, 0, 
+88, 11, 3, 128, 54, 11, 4, 0, 39, 13, 14, 0, 66, 11, 2, 1, 
+6, 4, 10, 0, 88, 11, 28, 128, 7, 3, 15, 0, 88, 11, 18, 128, 
+54, 11, 16, 0, 18, 13, 11, 0, 57, 11, 17, 11, 66, 11, 2, 2, 
+56, 12, 5, 11, 14, 0, 12, 0, 88, 12, 5, 128, 54, 12, 4, 0, 
+39, 14, 18, 0, 18, 15, 5, 0, 39, 16, 19, 0, 66, 12, 4, 1, 
+54, 12, 16, 0, 18, 14, 12, 0, 57, 12, 20, 12, 18, 15, 5, 0, 
+66, 12, 3, 1, 88, 11, 8, 128, 54, 11, 21, 0, 57, 11, 22, 11, 
+54, 12, 16, 0, 18, 14, 12, 0, 57, 12, 23, 12, 18, 15, 11, 0, 
+18, 16, 5, 0, 66, 12, 4, 1, 54, 11, 9, 0, 18, 13, 9, 0, 
+66, 11, 2, 4, 88, 14, 14, 128, 58, 16, 3, 15, 15, 0, 16, 0, 
+88, 16, 3, 128, 21, 16, 10, 0, 9, 16, 2, 0, 88, 16, 8, 128, 
+58, 16, 1, 15, 58, 18, 2, 15, 66, 16, 2, 2, 14, 0, 16, 0, 
+88, 16, 3, 128, 54, 16, 4, 0, 39, 18, 14, 0, 66, 16, 2, 1, 
+69, 14, 3, 3, 82, 14, 240, 127, 21, 11, 10, 0, 41, 12, 0, 0, 
+1, 12, 11, 0, 88, 11, 12, 128, 54, 11, 24, 0, 39, 13, 25, 0, 
+66, 11, 2, 1, 54, 11, 26, 0, 54, 13, 21, 0, 18, 14, 10, 0, 
+66, 11, 3, 3, 14, 0, 11, 0, 88, 13, 3, 128, 54, 13, 4, 0, 
+18, 15, 12, 0, 66, 13, 2, 1, 54, 11, 27, 0, 57, 11, 28, 11, 
+41, 13, 0, 0, 66, 11, 2, 1, 75, 0, 1, 0, 0, 192, 1, 192, 
+3, 192, 4, 192, 9, 101, 120, 105, 116, 7, 111, 115, 26, 69, 120, 112, 
+111, 114, 116, 84, 111, 77, 117, 108, 116, 105, 112, 108, 101, 70, 105, 108, 
+101, 115, 17, 69, 120, 112, 111, 114, 116, 105, 110, 103, 46, 46, 46, 21, 
+73, 109, 109, 101, 100, 105, 97, 116, 101, 77, 101, 115, 115, 97, 103, 101, 
+19, 114, 101, 110, 97, 109, 101, 68, 111, 99, 117, 109, 101, 110, 116, 9, 
+110, 97, 109, 101, 13, 68, 111, 99, 117, 109, 101, 110, 116, 15, 115, 101, 
+116, 67, 117, 114, 114, 101, 110, 116, 6, 39, 23, 110, 111, 32, 115, 117, 
+99, 104, 32, 100, 111, 99, 117, 109, 101, 110, 116, 32, 39, 20, 103, 101, 
+116, 68, 111, 99, 117, 109, 101, 110, 116, 76, 105, 115, 116, 16, 68, 111, 
+99, 117, 109, 101, 110, 116, 83, 101, 116, 7, 119, 103, 11, 102, 97, 105, 
+108, 101, 100, 16, 71, 101, 116, 69, 120, 112, 111, 114, 116, 101, 114, 41, 
+100, 111, 110, 39, 116, 32, 107, 110, 111, 119, 32, 104, 111, 119, 32, 116, 
+111, 32, 101, 120, 112, 111, 114, 116, 32, 101, 120, 116, 101, 110, 115, 105, 
+111, 110, 32, 39, 59, 121, 111, 117, 32, 99, 97, 110, 110, 111, 116, 32, 
+115, 112, 101, 99, 105, 102, 121, 32, 97, 32, 100, 111, 99, 117, 109, 101, 
+110, 116, 32, 110, 97, 109, 101, 32, 102, 111, 114, 32, 116, 104, 101, 32, 
+111, 117, 116, 112, 117, 116, 32, 102, 105, 108, 101, 5, 11, 105, 112, 97, 
+105, 114, 115, 6, 41, 32, 40, 115, 117, 112, 112, 111, 114, 116, 101, 100, 
+32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 32, 97, 114, 101, 58, 
+32, 7, 39, 32, 41, 100, 111, 110, 39, 116, 32, 107, 110, 111, 119, 32, 
+104, 111, 119, 32, 116, 111, 32, 105, 109, 112, 111, 114, 116, 32, 101, 120, 
+116, 101, 110, 115, 105, 111, 110, 32, 39, 13, 67, 76, 73, 69, 114, 114, 
+111, 114, 0, 6, 46, 0, 14, 69, 110, 103, 97, 103, 101, 67, 76, 73, 
+3, 128, 128, 192, 153, 4, 2, 0, 135, 4, 3, 0, 6, 0, 33, 0, 
+48, 54, 0, 0, 0, 57, 0, 1, 0, 54, 1, 2, 0, 57, 1, 3, 
+1, 54, 2, 4, 0, 57, 2, 5, 2, 53, 3, 8, 0, 54, 4, 6, 
+0, 57, 4, 7, 4, 61, 4, 9, 3, 54, 4, 6, 0, 57, 4, 10, 
+4, 61, 4, 11, 3, 54, 4, 6, 0, 57, 4, 12, 4, 61, 4, 13, 
+3, 54, 4, 6, 0, 57, 4, 14, 4, 61, 4, 15, 3, 53, 4, 17, 
+0, 54, 5, 6, 0, 57, 5, 16, 5, 61, 5, 9, 4, 54, 5, 6, 
+0, 57, 5, 18, 5, 61, 5, 11, 4, 54, 5, 6, 0, 57, 5, 19, 
+5, 61, 5, 13, 4, 54, 5, 6, 0, 57, 5, 20, 5, 61, 5, 21, 
+4, 54, 5, 6, 0, 57, 5, 22, 5, 61, 5, 23, 4, 54, 5, 6, 
+0, 57, 5, 24, 5, 61, 5, 15, 4, 51, 5, 25, 0, 55, 5, 26, 
+0, 51, 5, 27, 0, 55, 5, 28, 0, 51, 5, 29, 0, 55, 5, 30, 
+0, 51, 5, 31, 0, 55, 5, 32, 0, 50, 0, 0, 128, 75, 0, 1, 
+0, 15, 67, 108, 105, 67, 111, 110, 118, 101, 114, 116, 0, 14, 69, 110, 
+103, 97, 103, 101, 67, 76, 73, 0, 13, 67, 76, 73, 69, 114, 114, 111, 
+114, 0, 15, 67, 76, 73, 77, 101, 115, 115, 97, 103, 101, 0, 19, 69, 
+120, 112, 111, 114, 116, 84, 101, 120, 116, 70, 105, 108, 101, 8, 116, 101, 
+120, 20, 69, 120, 112, 111, 114, 116, 76, 97, 116, 101, 120, 70, 105, 108, 
+101, 7, 116, 114, 20, 69, 120, 112, 111, 114, 116, 84, 114, 111, 102, 102, 
+70, 105, 108, 101, 19, 69, 120, 112, 111, 114, 116, 72, 84, 77, 76, 70, 
+105, 108, 101, 18, 69, 120, 112, 111, 114, 116, 79, 68, 84, 70, 105, 108, 
+101, 1, 0, 6, 8, 111, 100, 116, 0, 8, 116, 101, 120, 0, 7, 119, 
+103, 0, 7, 116, 114, 0, 8, 116, 120, 116, 0, 9, 104, 116, 109, 108, 
+0, 26, 83, 97, 118, 101, 67, 117, 114, 114, 101, 110, 116, 68, 111, 99, 
+117, 109, 101, 110, 116, 65, 115, 8, 116, 120, 116, 19, 73, 109, 112, 111, 
+114, 116, 84, 101, 120, 116, 70, 105, 108, 101, 9, 104, 116, 109, 108, 19, 
+73, 109, 112, 111, 114, 116, 72, 84, 77, 76, 70, 105, 108, 101, 8, 111, 
+100, 116, 18, 73, 109, 112, 111, 114, 116, 79, 68, 84, 70, 105, 108, 101, 
+7, 119, 103, 1, 0, 4, 8, 111, 100, 116, 0, 9, 104, 116, 109, 108, 
+0, 8, 116, 120, 116, 0, 7, 119, 103, 0, 20, 76, 111, 97, 100, 68, 
+111, 99, 117, 109, 101, 110, 116, 83, 101, 116, 8, 67, 109, 100, 11, 115, 
+116, 100, 101, 114, 114, 7, 105, 111, 11, 99, 111, 110, 99, 97, 116, 10, 
+116, 97, 98, 108, 101, 9, 102, 105, 110, 100, 11, 115, 116, 114, 105, 110, 
+103, 0, 
+};
+const FileDescriptor script_table[] = {
+{ file_1, sizeof(file_1), "src/lua/_prologue.lua" },
+{ file_2, sizeof(file_2), "src/lua/ffi.lua" },
+{ file_3, sizeof(file_3), "src/lua/events.lua" },
+{ file_4, sizeof(file_4), "src/lua/main.lua" },
+{ file_5, sizeof(file_5), "src/lua/xml.lua" },
+{ file_6, sizeof(file_6), "src/lua/utils.lua" },
+{ file_7, sizeof(file_7), "src/lua/redraw.lua" },
+{ file_8, sizeof(file_8), "src/lua/settings.lua" },
+{ file_9, sizeof(file_9), "src/lua/document.lua" },
+{ file_10, sizeof(file_10), "src/lua/forms.lua" },
+{ file_11, sizeof(file_11), "src/lua/ui.lua" },
+{ file_12, sizeof(file_12), "src/lua/browser.lua" },
+{ file_13, sizeof(file_13), "src/lua/html.lua" },
+{ file_14, sizeof(file_14), "src/lua/margin.lua" },
+{ file_15, sizeof(file_15), "src/lua/fileio.lua" },
+{ file_16, sizeof(file_16), "src/lua/export.lua" },
+{ file_17, sizeof(file_17), "src/lua/export/text.lua" },
+{ file_18, sizeof(file_18), "src/lua/export/html.lua" },
+{ file_19, sizeof(file_19), "src/lua/export/latex.lua" },
+{ file_20, sizeof(file_20), "src/lua/export/troff.lua" },
+{ file_21, sizeof(file_21), "src/lua/export/opendocument.lua" },
+{ file_22, sizeof(file_22), "src/lua/import.lua" },
+{ file_23, sizeof(file_23), "src/lua/import/html.lua" },
+{ file_24, sizeof(file_24), "src/lua/import/text.lua" },
+{ file_25, sizeof(file_25), "src/lua/import/opendocument.lua" },
+{ file_26, sizeof(file_26), "src/lua/navigate.lua" },
+{ file_27, sizeof(file_27), "src/lua/addons/goto.lua" },
+{ file_28, sizeof(file_28), "src/lua/addons/autosave.lua" },
+{ file_29, sizeof(file_29), "src/lua/addons/docsetman.lua" },
+{ file_30, sizeof(file_30), "src/lua/addons/scrapbook.lua" },
+{ file_31, sizeof(file_31), "src/lua/addons/pagecount.lua" },
+{ file_32, sizeof(file_32), "src/lua/addons/statusbar_charstyle.lua" },
+{ file_33, sizeof(file_33), "src/lua/addons/statusbar_position.lua" },
+{ file_34, sizeof(file_34), "src/lua/addons/statusbar_wordcount.lua" },
+{ file_35, sizeof(file_35), "src/lua/addons/debug.lua" },
+{ file_36, sizeof(file_36), "src/lua/addons/widescreen.lua" },
+{ file_37, sizeof(file_37), "src/lua/addons/keymapoverride.lua" },
+{ file_38, sizeof(file_38), "src/lua/addons/smartquotes.lua" },
+{ file_39, sizeof(file_39), "src/lua/addons/undo.lua" },
+{ file_40, sizeof(file_40), "src/lua/addons/spillchocker.lua" },
+{ file_41, sizeof(file_41), "src/lua/menu.lua" },
+{ file_42, sizeof(file_42), "src/lua/cli.lua" },
+{ NULL, 0 }
+};
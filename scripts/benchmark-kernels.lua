@@ -0,0 +1,95 @@
+-- © 2015 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- This user script benchmarks the loops which lean hardest on the C
+-- primitives: word wrapping, redrawing and saving. It's meant to be run with
+-- the headless build, so that it can be compared across Lua 5.2, LuaJIT, and
+-- LuaJIT with the FFI kernels turned off:
+--
+--     bin/wordgrinder-headless --lua scripts/benchmark-kernels.lua
+--     WORDGRINDER_NO_FFI=1 bin/wordgrinder-headless --lua scripts/benchmark-kernels.lua
+
+if not wg.dumpscreen then
+	print("This script needs the headless build.")
+	return
+end
+
+local text = [[Sed ut perspiciatis unde omnis iste natus error sit voluptatem
+accusantium doloremque laudantium, totam rem aperiam, eaque ipsa quae ab illo
+inventore veritatis et quasi architecto beatae vitae dicta sunt explicabo. Nemo
+enim ipsam voluptatem quia voluptas sit aspernatur aut odit aut fugit, sed quia
+consequuntur magni dolores eos qui ratione voluptatem sequi nesciunt.]]
+
+local words = {}
+for w in text:gmatch("%S+") do
+	words[#words+1] = w
+end
+
+local engine = _VERSION
+if rawget(_G, "jit") then
+	engine = jit.version
+	if (debug.getinfo(wg.getstringwidth, "S").what == "Lua") then
+		engine = engine .. " with FFI"
+	end
+end
+print(engine)
+
+wg.initscreen()
+ResizeScreen()
+
+-- Generate some source text.
+
+math.randomseed(0) -- predictable pseudorandom numbers
+for p = 1, 1000 do
+	local a = math.random(#words)
+	local b = math.random(#words)
+	if (b < a) then
+		a, b = b, a
+	end
+
+	Cmd.InsertStringIntoWord(words[a])
+	for i=a+1, b do
+		Cmd.SplitCurrentWord()
+		Cmd.InsertStringIntoWord(words[i])
+	end
+	Cmd.SplitCurrentParagraph()
+end
+FireEvent(Event.Changed)
+Cmd.GotoBeginningOfDocument()
+RedrawScreen()
+
+local function time(name, count, cb)
+	local before = wg.time()
+	cb()
+	local after = wg.time()
+	local ms = (after-before)*1000
+	print(string.format("%s: %dms (%.3fms per pass)", name, ms, ms/count))
+end
+
+time("Wrap", 50, function()
+	for i = 1, 50 do
+		for _, p in ipairs(Document) do
+			p:touch()
+			p:wrap()
+		end
+	end
+end)
+
+time("Redraw", 1000, function()
+	for i = 1, 1000 do
+		InvalidateScreen()
+		RedrawScreen()
+	end
+end)
+
+local filename = os.tmpname()
+time("Save", 20, function()
+	for i = 1, 20 do
+		local r, e = SaveToStream(filename, DocumentSet)
+		if not r then
+			error(e)
+		end
+	end
+end)
+os.remove(filename)
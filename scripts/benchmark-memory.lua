@@ -0,0 +1,104 @@
+-- © 2015 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- This user script measures how the Lua allocator copes with loading and
+-- throwing away a large document. Compare the pooled allocator against the
+-- system one:
+--
+--     bin/wordgrinder-headless --lua scripts/benchmark-memory.lua
+--     WORDGRINDER_NO_POOL=1 bin/wordgrinder-headless --lua scripts/benchmark-memory.lua
+
+local text = [[Sed ut perspiciatis unde omnis iste natus error sit voluptatem
+accusantium doloremque laudantium, totam rem aperiam, eaque ipsa quae ab illo
+inventore veritatis et quasi architecto beatae vitae dicta sunt explicabo. Nemo
+enim ipsam voluptatem quia voluptas sit aspernatur aut odit aut fugit, sed quia
+consequuntur magni dolores eos qui ratione voluptatem sequi nesciunt.]]
+
+local words = {}
+for w in text:gmatch("%S+") do
+	words[#words+1] = w
+end
+
+-- The allocator only knows about what it's asked for; the resident set size
+-- (where the system reports it) includes the C library's own overheads.
+
+local function rss()
+	local fp = io.open("/proc/self/status")
+	if not fp then
+		return "?"
+	end
+	local s = fp:read("*a")
+	fp:close()
+	return s:match("VmRSS:%s*(%d+)") or "?"
+end
+
+local function report(name)
+	collectgarbage("collect")
+	local s = wg.allocstats()
+	print(string.format("%s: %dkB requested, %dkB held, %dkB high water, "..
+		"%skB resident, %d slabs, %.0f%% fragmentation, %.0f%% waste",
+		name, s.requested/1024, s.total/1024, s.highwater/1024, rss(),
+		s.slabs, s.fragmentation*100, s.waste*100))
+end
+
+print(wg.allocstats().pooling and "Pooled allocator" or "System allocator")
+report("Startup")
+
+-- Generate a document and save it.
+
+math.randomseed(0) -- predictable pseudorandom numbers
+for p = 1, 10000 do
+	local a = math.random(#words)
+	local b = math.random(#words)
+	if (b < a) then
+		a, b = b, a
+	end
+
+	Cmd.InsertStringIntoWord(words[a])
+	for i=a+1, b do
+		Cmd.SplitCurrentWord()
+		Cmd.InsertStringIntoWord(words[i])
+	end
+	Cmd.SplitCurrentParagraph()
+end
+FireEvent(Event.Changed)
+report("Generated")
+
+local filename = os.tmpname()
+local r, e = SaveToStream(filename, DocumentSet)
+if not r then
+	error(e)
+end
+DocumentSet = nil
+report("Saved and discarded")
+
+-- Load it once, to see what the document costs, and then repeatedly for
+-- the timing.
+
+local d, e = LoadFromStream(filename)
+if not d then
+	error(e)
+end
+local s = wg.allocstats()
+print(string.format("Arena: %dkB in %d slabs", s.arenabytes/1024,
+	s.arenaslabs))
+report("Loaded")
+
+-- The previous copy is collected before each load (and not timed), as it
+-- would be when replacing one document with another.
+
+local elapsed = 0
+for i = 1, 10 do
+	d = nil
+	collectgarbage("collect")
+	local before = wg.time()
+	d, e = LoadFromStream(filename)
+	if not d then
+		error(e)
+	end
+	elapsed = elapsed + wg.time() - before
+end
+print(string.format("Load: %.1fms per pass", elapsed*100))
+report("Loaded ten more times")
+os.remove(filename)
@@ -0,0 +1,105 @@
+-- © 2015 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- This user script benchmarks screen redrawing. It's meant to be run with
+-- the headless build, which draws into memory, so the timings measure
+-- WordGrinder itself and not the terminal:
+--
+--     bin/wordgrinder-headless --lua scripts/benchmark-redraw.lua
+--
+-- Each phase finishes by checking that the incrementally drawn screen is
+-- the same as a complete redraw.
+
+if not wg.dumpscreen then
+	print("This script needs the headless build.")
+	return
+end
+
+local text = [[Sed ut perspiciatis unde omnis iste natus error sit voluptatem
+accusantium doloremque laudantium, totam rem aperiam, eaque ipsa quae ab illo
+inventore veritatis et quasi architecto beatae vitae dicta sunt explicabo. Nemo
+enim ipsam voluptatem quia voluptas sit aspernatur aut odit aut fugit, sed quia
+consequuntur magni dolores eos qui ratione voluptatem sequi nesciunt.]]
+
+local words = {}
+for w in text:gmatch("%S+") do
+	words[#words+1] = w
+end
+
+wg.initscreen()
+ResizeScreen()
+
+-- Generate some source text.
+
+math.randomseed(0) -- predictable pseudorandom numbers
+for p = 1, 1000 do
+	local a = math.random(#words)
+	local b = math.random(#words)
+	if (b < a) then
+		a, b = b, a
+	end
+
+	Cmd.InsertStringIntoWord(words[a])
+	for i=a+1, b do
+		Cmd.SplitCurrentWord()
+		Cmd.InsertStringIntoWord(words[i])
+	end
+	Cmd.SplitCurrentParagraph()
+end
+FireEvent(Event.Changed)
+Cmd.GotoBeginningOfDocument()
+RedrawScreen()
+
+local function time(name, count, cb)
+	local before = os.clock()
+	cb()
+	local after = os.clock()
+	local ms = (after-before)*1000
+	print(string.format("%s: %dms (%.3fms per frame)", name, ms, ms/count))
+
+	-- Check that what's on the screen is what a complete redraw would give.
+
+	local incremental = wg.snapshotscreen()
+	InvalidateScreen()
+	RedrawScreen()
+	local n = wg.diffscreen(incremental, wg.snapshotscreen())
+	if (n ~= 0) then
+		print("*** "..n.." cells differ from a complete redraw!")
+		print((wg.dumpscreen()))
+	end
+end
+
+time("Full redraw", 1000, function()
+	for i = 1, 1000 do
+		InvalidateScreen()
+		RedrawScreen()
+	end
+end)
+
+time("Unchanged redraw", 1000, function()
+	for i = 1, 1000 do
+		RedrawScreen()
+	end
+end)
+
+time("Scroll down", 1000, function()
+	for i = 1, 1000 do
+		Cmd.GotoNextLine()
+		RedrawScreen()
+	end
+end)
+
+time("Page down", 100, function()
+	for i = 1, 100 do
+		Cmd.GotoNextPage()
+		RedrawScreen()
+	end
+end)
+
+time("Typing", 1000, function()
+	for i = 1, 1000 do
+		Cmd.InsertStringIntoWord("x")
+		RedrawScreen()
+	end
+end)
@@ -0,0 +1,481 @@
+/* © 2015 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+/* The Lua allocator. A document is millions of small strings and tables, so
+ * blocks of up to POOL_MAX bytes come from size-class pools: each class
+ * carves fixed-size blocks out of slabs, which are aligned to their size so
+ * that a block's slab can be found from its address. Anything bigger goes
+ * to the system allocator. Slabs which become empty are handed back, apart
+ * from a few kept spare.
+ *
+ * While an arena is open (see wg.beginarena()), small blocks come only from
+ * slabs created for that arena. A document being loaded is then packed into
+ * slabs of its own rather than into the holes left by everything else, and
+ * when it's thrown away those slabs empty and can be released.
+ *
+ * Setting WORDGRINDER_NO_POOL in the environment sends everything to the
+ * system allocator, which is useful for comparison; the statistics are kept
+ * either way. */
+
+#include "globals.h"
+#include <string.h>
+
+#define SLAB_SIZE (16*1024)
+#define POOL_GRANULARITY 8
+#define POOL_MAX 256
+#define NUM_CLASSES (POOL_MAX / POOL_GRANULARITY)
+#define MAX_SPARE_SLABS 64
+
+struct slab
+{
+	struct slab* next;      /* in a list of slabs with space */
+	struct slab* prev;
+	void* freelist;         /* blocks which have been freed */
+	char* bump;             /* first block which has never been used */
+	char* end;
+	unsigned int used;      /* blocks currently allocated */
+	unsigned int arena;     /* arena the slab was created for, or 0 */
+	int class;
+	bool listed;
+};
+
+#define SLAB_HEADER ((sizeof(struct slab) + 15) & ~15)
+
+struct slablist
+{
+	struct slab* first;
+	struct slab* last;
+};
+
+struct pool
+{
+	struct slablist partial; /* slabs with free blocks */
+	struct slablist arena;   /* the open arena's slabs with free blocks */
+};
+
+static struct pool pools[NUM_CLASSES];
+static struct slab* spareslabs = NULL;
+static int numspareslabs = 0;
+static bool usepools = true;
+static bool installed = false;
+static int arenadepth = 0;
+static unsigned int currentarena = 0;
+static unsigned int nextarena = 1;
+
+struct alloc_stats
+{
+	size_t requested;       /* bytes Lua thinks it has */
+	size_t pooled;          /* bytes in pool blocks in use */
+	size_t large;           /* bytes from the system allocator in use */
+	size_t slabs;           /* slabs in existence, including spares */
+	size_t highwater;       /* most memory ever held, slabs plus large */
+	size_t allocations;
+	size_t frees;
+	size_t slabsreleased;
+	size_t arenabytes;      /* pool bytes allocated in the last arena */
+	size_t arenaslabs;      /* slabs created for the last arena */
+};
+
+static struct alloc_stats stats;
+
+static int classof(size_t size)
+{
+	if (!usepools || (size == 0) || (size > POOL_MAX))
+		return -1;
+	return (size - 1) / POOL_GRANULARITY;
+}
+
+static size_t blocksize(int class)
+{
+	return (class + 1) * POOL_GRANULARITY;
+}
+
+static void updatehighwater(void)
+{
+	size_t total = stats.slabs*SLAB_SIZE + stats.large;
+	if (total > stats.highwater)
+		stats.highwater = total;
+}
+
+static struct slab* slabof(void* p)
+{
+	return (struct slab*) ((uintptr_t)p & ~(uintptr_t)(SLAB_SIZE-1));
+}
+
+static bool isfull(struct slab* s)
+{
+	return !s->freelist && ((s->bump + blocksize(s->class)) > s->end);
+}
+
+/* Slabs join the end of the list, and blocks are allocated from the front.
+ * Allocation is therefore concentrated on the slabs which have had space the
+ * longest, and slabs which have only just had a block freed are left alone
+ * for a while, giving them a chance to empty and be released. */
+
+static void addslab(struct slablist* list, struct slab* s)
+{
+	s->next = NULL;
+	s->prev = list->last;
+	if (s->prev)
+		s->prev->next = s;
+	else
+		list->first = s;
+	list->last = s;
+	s->listed = true;
+}
+
+static void removeslab(struct slablist* list, struct slab* s)
+{
+	if (s->prev)
+		s->prev->next = s->next;
+	else
+		list->first = s->next;
+	if (s->next)
+		s->next->prev = s->prev;
+	else
+		list->last = s->prev;
+	s->listed = false;
+}
+
+/* While an arena is open, its own slabs are on a separate list. */
+
+static struct slablist* listof(struct pool* pool, struct slab* s)
+{
+	if (currentarena && (s->arena == currentarena))
+		return &pool->arena;
+	return &pool->partial;
+}
+
+static struct slab* newslab(int class)
+{
+	void* p;
+	if (spareslabs)
+	{
+		p = spareslabs;
+		spareslabs = spareslabs->next;
+		numspareslabs--;
+	}
+	else
+	{
+#if defined WIN32
+		p = _aligned_malloc(SLAB_SIZE, SLAB_SIZE);
+		if (!p)
+			return NULL;
+#else
+		if (posix_memalign(&p, SLAB_SIZE, SLAB_SIZE) != 0)
+			return NULL;
+#endif
+		stats.slabs++;
+		updatehighwater();
+	}
+
+	struct slab* s = p;
+	size_t bs = blocksize(class);
+	memset(s, 0, sizeof(*s));
+	s->class = class;
+	s->arena = currentarena;
+	s->bump = (char*)s + SLAB_HEADER;
+	s->end = s->bump + ((SLAB_SIZE - SLAB_HEADER) / bs) * bs;
+
+	if (currentarena)
+		stats.arenaslabs++;
+	return s;
+}
+
+/* A few empty slabs are kept back for reuse by any class, as aligned
+ * allocations are slow and tend to fragment the system heap. */
+
+static void freeslab(struct slab* s)
+{
+	if (numspareslabs < MAX_SPARE_SLABS)
+	{
+		s->next = spareslabs;
+		spareslabs = s;
+		numspareslabs++;
+		return;
+	}
+
+#if defined WIN32
+	_aligned_free(s);
+#else
+	free(s);
+#endif
+	stats.slabs--;
+	stats.slabsreleased++;
+}
+
+static void* poolget(int class)
+{
+	struct pool* pool = &pools[class];
+	struct slablist* list = currentarena ? &pool->arena : &pool->partial;
+	struct slab* s = list->first;
+	if (!s)
+	{
+		s = newslab(class);
+		if (!s)
+			return NULL;
+		addslab(list, s);
+	}
+
+	void* p;
+	if (s->freelist)
+	{
+		p = s->freelist;
+		s->freelist = *(void**)p;
+	}
+	else
+	{
+		p = s->bump;
+		s->bump += blocksize(class);
+	}
+	s->used++;
+
+	if (isfull(s))
+		removeslab(list, s);
+
+	stats.pooled += blocksize(class);
+	if (currentarena)
+		stats.arenabytes += blocksize(class);
+	return p;
+}
+
+static void poolput(void* p, int class)
+{
+	struct pool* pool = &pools[class];
+	struct slab* s = slabof(p);
+	struct slablist* list = listof(pool, s);
+
+	*(void**)p = s->freelist;
+	s->freelist = p;
+	s->used--;
+	stats.pooled -= blocksize(class);
+
+	/* Empty slabs are released, unless it's the only one on its list (which
+	 * avoids thrashing when a single block comes and goes). */
+
+	if (s->used == 0)
+	{
+		bool others = s->listed ? ((list->first != s) || s->next)
+			: (list->first != NULL);
+		if (others)
+		{
+			if (s->listed)
+				removeslab(list, s);
+			freeslab(s);
+			return;
+		}
+	}
+
+	if (!s->listed)
+		addslab(list, s);
+}
+
+static void* get(size_t size)
+{
+	int class = classof(size);
+	if (class != -1)
+		return poolget(class);
+
+	void* p = malloc(size);
+	if (p)
+	{
+		stats.large += size;
+		updatehighwater();
+	}
+	return p;
+}
+
+static void put(void* p, size_t size)
+{
+	int class = classof(size);
+	if (class != -1)
+		poolput(p, class);
+	else
+	{
+		free(p);
+		stats.large -= size;
+	}
+}
+
+static void* allocator(void* ud, void* ptr, size_t osize, size_t nsize)
+{
+	if (!ptr)
+		osize = 0; /* Lua 5.2 passes the object type here */
+
+	if (nsize == 0)
+	{
+		if (ptr)
+		{
+			put(ptr, osize);
+			stats.requested -= osize;
+			stats.frees++;
+		}
+		return NULL;
+	}
+
+	int oclass = classof(osize);
+	int nclass = classof(nsize);
+	void* p;
+	if (ptr && (oclass == -1) && (nclass == -1))
+	{
+		/* Large to large; let the system allocator do it in place. */
+
+		p = realloc(ptr, nsize);
+		if (!p)
+			return NULL;
+		stats.large += nsize - osize;
+		updatehighwater();
+	}
+	else if (ptr && (oclass == nclass))
+		p = ptr;
+	else
+	{
+		p = get(nsize);
+		if (!p)
+			return NULL;
+		if (ptr)
+		{
+			memcpy(p, ptr, (osize < nsize) ? osize : nsize);
+			put(ptr, osize);
+		}
+		else
+			stats.allocations++;
+	}
+
+	stats.requested += nsize - osize;
+	return p;
+}
+
+static int panic(lua_State* L)
+{
+	fprintf(stderr, "PANIC: unprotected error in call to Lua API (%s)\n",
+		lua_tostring(L, -1));
+	return 0;
+}
+
+/* Creates the Lua state. LuaJIT has its own allocator, and on some
+ * platforms won't accept anybody else's, so it's left alone there. */
+
+lua_State* alloc_newstate(void)
+{
+#if !defined USE_LUAJIT
+	if (getenv("WORDGRINDER_NO_POOL"))
+		usepools = false;
+
+	lua_State* state = lua_newstate(allocator, NULL);
+	if (state)
+	{
+		lua_atpanic(state, panic);
+		installed = true;
+		return state;
+	}
+#endif
+
+	return luaL_newstate();
+}
+
+/* Arenas nest; only the outermost pair matters. */
+
+static int beginarena_cb(lua_State* L)
+{
+	if (arenadepth++ == 0)
+	{
+		currentarena = nextarena++;
+		stats.arenabytes = 0;
+		stats.arenaslabs = 0;
+	}
+	return 0;
+}
+
+static int endarena_cb(lua_State* L)
+{
+	if ((arenadepth == 0) || (--arenadepth > 0))
+		return 0;
+
+	/* The arena's slabs with space join the pools like any other. */
+
+	currentarena = 0;
+	for (int class = 0; class < NUM_CLASSES; class++)
+	{
+		struct pool* pool = &pools[class];
+		while (pool->arena.first)
+		{
+			struct slab* s = pool->arena.first;
+			removeslab(&pool->arena, s);
+			if (s->used == 0)
+				freeslab(s);
+			else
+				addslab(&pool->partial, s);
+		}
+	}
+	return 0;
+}
+
+/* Returns a table of allocator statistics. Fragmentation is the proportion
+ * of slab memory not in use by any block; waste is the proportion of pool
+ * block memory which Lua didn't ask for (from rounding up to a size
+ * class). */
+
+static int allocstats_cb(lua_State* L)
+{
+	/* When the allocator isn't in use, all that's known is what the garbage
+	 * collector thinks the heap size is. */
+
+	if (!installed)
+	{
+		stats.requested = stats.large =
+			lua_gc(L, LUA_GCCOUNT, 0)*1024 + lua_gc(L, LUA_GCCOUNTB, 0);
+		updatehighwater();
+	}
+
+	/* Building the result allocates memory, so work from a copy. */
+
+	struct alloc_stats s = stats;
+	size_t slabbytes = s.slabs * SLAB_SIZE;
+	size_t smallrequested = s.requested - s.large;
+
+	lua_newtable(L);
+
+#define FIELD(name, value) \
+	lua_pushnumber(L, value); \
+	lua_setfield(L, -2, name)
+
+	lua_pushboolean(L, installed && usepools);
+	lua_setfield(L, -2, "pooling");
+	FIELD("requested", s.requested);
+	FIELD("pooled", s.pooled);
+	FIELD("large", s.large);
+	FIELD("slabs", s.slabs);
+	FIELD("slabbytes", slabbytes);
+	FIELD("total", slabbytes + s.large);
+	FIELD("highwater", s.highwater);
+	FIELD("allocations", s.allocations);
+	FIELD("frees", s.frees);
+	FIELD("slabsreleased", s.slabsreleased);
+	FIELD("arenabytes", s.arenabytes);
+	FIELD("arenaslabs", s.arenaslabs);
+	FIELD("fragmentation",
+		slabbytes ? (double)(slabbytes - s.pooled) / slabbytes : 0);
+	FIELD("waste",
+		s.pooled ? (double)(s.pooled - smallrequested) / s.pooled : 0);
+
+#undef FIELD
+	return 1;
+}
+
+void alloc_init(void)
+{
+	const static luaL_Reg funcs[] =
+	{
+		{ "allocstats",                allocstats_cb },
+		{ "beginarena",                beginarena_cb },
+		{ "endarena",                  endarena_cb },
+		{ NULL,                        NULL }
+	};
+
+	lua_getglobal(L, "wg");
+	luaL_setfuncs(L, funcs, 0);
+	lua_pop(L, 1);
+}
@@ -0,0 +1,349 @@
+/* © 2015 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+/* A display backend which doesn't display anything. The screen is an
+ * in-memory grid of cells, and keystrokes come from Lua, so that scripts can
+ * drive the editor at full speed and inspect exactly what it drew. */
+
+#include "globals.h"
+#include <string.h>
+
+#define cell_id(c, a) (((c)<<8) | (a))
+
+static int screenwidth = 80;
+static int screenheight = 25;
+static int cursorx, cursory;
+static unsigned int* screen = NULL;
+
+/* What the screen looked like at the last sync. Frames are counted against
+ * this, the same way the X11 and Windows backends decide what to repaint, so
+ * that the statistics show what those would have drawn. */
+
+static unsigned int* front = NULL;
+static int defaultattr = 0;
+
+const unsigned int dpy_trackedstats = DPY_STATS_CELLSCHANGED;
+
+/* Keys are named rather than numbered: the key code for a name is minus
+ * one more than its index in this table. */
+
+static char** keynames = NULL;
+static int numkeynames = 0;
+
+static uni_t find_key(const char* name)
+{
+	for (int i=0; i<numkeynames; i++)
+		if (strcmp(keynames[i], name) == 0)
+			return -(i+1);
+
+	keynames = realloc(keynames, (numkeynames+1) * sizeof(*keynames));
+	keynames[numkeynames++] = strdup(name);
+	return -numkeynames;
+}
+
+static void sput(int x, int y, unsigned int id)
+{
+	if ((x < 0) || (x >= screenwidth))
+		return;
+	if ((y < 0) || (y >= screenheight))
+		return;
+
+	screen[y*screenwidth + x] = id;
+}
+
+static void allocate_screen(int w, int h)
+{
+	screenwidth = w;
+	screenheight = h;
+	free(screen);
+	free(front);
+	screen = malloc(w * h * sizeof(*screen));
+	front = malloc(w * h * sizeof(*front));
+	for (int i=0; i<(w * h); i++)
+		screen[i] = front[i] = cell_id(' ', 0);
+}
+
+/* Returns the screen contents as text, one line per row; the attributes of
+ * each cell as a string of the same shape, with '0' meaning plain text; and
+ * the cursor position. */
+
+static int dumpscreen_cb(lua_State* L)
+{
+	char* text = malloc(screenheight * (screenwidth*4 + 1));
+	char* attrs = malloc(screenheight * (screenwidth + 1));
+	char* tp = text;
+	char* ap = attrs;
+
+	for (int y=0; y<screenheight; y++)
+	{
+		unsigned int* p = &screen[y * screenwidth];
+		for (int x=0; x<screenwidth; x++)
+		{
+			*ap++ = '0' + (p[x] & 0xff);
+			if (p[x] != 0)
+				writeu8(&tp, p[x] >> 8);
+		}
+		*tp++ = '\n';
+		*ap++ = '\n';
+	}
+
+	lua_pushlstring(L, text, tp - text);
+	lua_pushlstring(L, attrs, ap - attrs);
+	free(text);
+	free(attrs);
+	lua_pushinteger(L, cursorx);
+	lua_pushinteger(L, cursory);
+	return 4;
+}
+
+/* Returns an opaque copy of the screen, for comparing with diffscreen(). */
+
+static int snapshotscreen_cb(lua_State* L)
+{
+	int size[2] = { screenwidth, screenheight };
+	luaL_Buffer b;
+	luaL_buffinit(L, &b);
+	luaL_addlstring(&b, (const char*) size, sizeof(size));
+	luaL_addlstring(&b, (const char*) screen,
+		screenwidth * screenheight * sizeof(*screen));
+	luaL_pushresult(&b);
+	return 1;
+}
+
+/* Compares two snapshots. Returns the number of cells which differ and a
+ * list of their {x, y} positions (numbered from zero); or nil if the
+ * snapshots aren't the same size. */
+
+static int diffscreen_cb(lua_State* L)
+{
+	size_t len1, len2;
+	const char* s1 = luaL_checklstring(L, 1, &len1);
+	const char* s2 = luaL_checklstring(L, 2, &len2);
+	int size[2];
+
+	if ((len1 != len2) || (len1 < sizeof(size)))
+		return 0;
+	memcpy(size, s1, sizeof(size));
+	if (memcmp(s1, s2, sizeof(size)) != 0)
+		return 0;
+
+	const unsigned int* p1 = (const unsigned int*) (s1 + sizeof(size));
+	const unsigned int* p2 = (const unsigned int*) (s2 + sizeof(size));
+	int count = 0;
+
+	lua_newtable(L);
+	for (int i=0; i<(size[0] * size[1]); i++)
+	{
+		if (p1[i] != p2[i])
+		{
+			lua_createtable(L, 2, 0);
+			lua_pushinteger(L, i % size[0]);
+			lua_rawseti(L, -2, 1);
+			lua_pushinteger(L, i / size[0]);
+			lua_rawseti(L, -2, 2);
+			lua_rawseti(L, -2, ++count);
+		}
+	}
+
+	lua_pushinteger(L, count);
+	lua_insert(L, -2);
+	return 2;
+}
+
+static int setscreensize_cb(lua_State* L)
+{
+	int w = luaL_checkinteger(L, 1);
+	int h = luaL_checkinteger(L, 2);
+	luaL_argcheck(L, w > 0, 1, "bad width");
+	luaL_argcheck(L, h > 0, 2, "bad height");
+
+	allocate_screen(w, h);
+	keyqueue_push(find_key("KEY_RESIZE"));
+	return 0;
+}
+
+/* Queues keystrokes. Each argument is either a key name, like KEY_LEFT, or
+ * a string of characters to type. */
+
+static int queuekeys_cb(lua_State* L)
+{
+	int n = lua_gettop(L);
+	for (int i=1; i<=n; i++)
+	{
+		const char* s = luaL_checkstring(L, i);
+		if (strncmp(s, "KEY_", 4) == 0)
+			keyqueue_push(find_key(s));
+		else
+		{
+			while (*s)
+				keyqueue_push(readu8(&s));
+		}
+	}
+	return 0;
+}
+
+static int queuepaste_cb(lua_State* L)
+{
+	const char* s = luaL_checkstring(L, 1);
+	keyqueue_addpaste(strdup(s));
+	keyqueue_push(KEYQUEUE_PASTE);
+	return 0;
+}
+
+void dpy_init(const char* argv[])
+{
+	const static luaL_Reg funcs[] =
+	{
+		{ "dumpscreen",                dumpscreen_cb },
+		{ "snapshotscreen",            snapshotscreen_cb },
+		{ "diffscreen",                diffscreen_cb },
+		{ "setscreensize",             setscreensize_cb },
+		{ "queuekeys",                 queuekeys_cb },
+		{ "queuepaste",                queuepaste_cb },
+		{ NULL,                        NULL }
+	};
+
+	lua_getglobal(L, "wg");
+	luaL_setfuncs(L, funcs, 0);
+	lua_pop(L, 1);
+
+	allocate_screen(screenwidth, screenheight);
+}
+
+void dpy_start(void)
+{
+	cursorx = cursory = 0;
+	defaultattr = 0;
+}
+
+void dpy_shutdown(void)
+{
+}
+
+void dpy_clearscreen(void)
+{
+	dpy_cleararea(0, 0, screenwidth-1, screenheight-1);
+}
+
+void dpy_getscreensize(int* x, int* y)
+{
+	*x = screenwidth;
+	*y = screenheight;
+}
+
+void dpy_sync(void)
+{
+	for (int i=0; i<(screenwidth * screenheight); i++)
+	{
+		if (front[i] != screen[i])
+		{
+			dpy_stats.cellschanged++;
+			front[i] = screen[i];
+		}
+	}
+	dpy_stats.frames++;
+}
+
+void dpy_setcursor(int x, int y)
+{
+	cursorx = x;
+	cursory = y;
+}
+
+void dpy_setattr(int andmask, int ormask)
+{
+	int oldattr = defaultattr;
+	defaultattr &= andmask;
+	defaultattr |= ormask;
+	if (defaultattr != oldattr)
+		dpy_stats.attrswitches++;
+}
+
+void dpy_writechar(int x, int y, uni_t c)
+{
+	dpy_stats.writes++;
+	sput(x, y, cell_id(c, defaultattr));
+	if (emu_wcwidth(c) == 2)
+		sput(x+1, y, 0);
+}
+
+void dpy_writerun(int x, int y, const uni_t* run, int len)
+{
+	for (int i = 0; i < len; i++)
+	{
+		dpy_writechar(x, y, run[i]);
+		x += emu_wcwidth(run[i]);
+	}
+}
+
+void dpy_cleararea(int x1, int y1, int x2, int y2)
+{
+	for (int y=y1; y<=y2; y++)
+		for (int x=x1; x<=x2; x++)
+			sput(x, y, cell_id(' ', defaultattr));
+}
+
+static void scrollbuffer(unsigned int* buffer, int y1, int y2, int delta)
+{
+	int rows = y2 - y1 + 1;
+	int shift = abs(delta);
+	unsigned int* top = &buffer[y1 * screenwidth];
+	size_t bytes = (rows - shift) * screenwidth * sizeof(*buffer);
+	int exposed;
+	if (delta > 0)
+	{
+		memmove(top, top + shift*screenwidth, bytes);
+		exposed = y2 - shift + 1;
+	}
+	else
+	{
+		memmove(top + shift*screenwidth, top, bytes);
+		exposed = y1;
+	}
+
+	unsigned int* p = &buffer[exposed * screenwidth];
+	for (int i = 0; i < (shift * screenwidth); i++)
+		p[i] = cell_id(' ', 0);
+}
+
+/* The last frame scrolls too, as the pixels would on a real display. */
+
+void dpy_scrollarea(int y1, int y2, int delta)
+{
+	if ((y1 < 0) || (y2 >= screenheight) || (y1 >= y2) || (delta == 0))
+		return;
+
+	if (abs(delta) > (y2 - y1))
+	{
+		dpy_cleararea(0, y1, screenwidth-1, y2);
+		return;
+	}
+
+	scrollbuffer(screen, y1, y2, delta);
+	scrollbuffer(front, y1, y2, delta);
+}
+
+/* There's nobody to wait for, so if there are no keys queued this times
+ * out immediately. */
+
+uni_t dpy_getchar(int timeout)
+{
+	if (keyqueue_count() > 0)
+		return keyqueue_pop();
+	return find_key("KEY_TIMEOUT");
+}
+
+bool dpy_haspendinginput(void)
+{
+	return keyqueue_count() > 0;
+}
+
+const char* dpy_getkeyname(uni_t k)
+{
+	k = -k - 1;
+	if ((k < 0) || (k >= numkeynames))
+		return NULL;
+	return keynames[k];
+}
@@ -11,11 +11,51 @@
 #include <time.h>
 
 #define KEY_TIMEOUT (KEY_MAX + 1)
+#define KEY_PASTE_BEGIN (KEY_MAX + 2)
+#define KEY_PASTE_END (KEY_MAX + 3)
 
 #if defined A_ITALIC
 static bool has_italics = false;
 #endif
 
+/* Curses does its own screen diffing, out of sight, so there's nothing
+ * beyond the basic counters to report. */
+
+const unsigned int dpy_trackedstats = 0;
+
+/* Curses attributes for every combination of DPY_* flags, worked out once
+ * at startup; and the attributes currently set on the screen, so that
+ * redundant attrset() calls can be skipped. */
+
+#define NUM_ATTRS 64
+static attr_t attrmap[NUM_ATTRS];
+static attr_t currentattr = 0;
+
+static attr_t compute_attr(int attr)
+{
+	attr_t cattr = 0;
+	if (attr & DPY_ITALIC)
+	{
+		#if defined A_ITALIC
+			if (has_italics)
+				cattr |= A_ITALIC;
+			else
+				cattr |= A_BOLD;
+		#else
+			cattr |= A_BOLD;
+		#endif
+	}
+	if (attr & (DPY_BOLD|DPY_BRIGHT))
+		cattr |= A_BOLD;
+	if (attr & DPY_DIM)
+		cattr |= A_DIM;
+	if (attr & DPY_UNDERLINE)
+		cattr |= A_UNDERLINE;
+	if (attr & DPY_REVERSE)
+		cattr |= A_REVERSE;
+	return cattr;
+}
+
 void dpy_init(const char* argv[])
 {
 }
@@ -34,14 +74,29 @@ void dpy_start(void)
 	//notimeout(stdscr, TRUE);
 	keypad(stdscr, TRUE);
 
+	/* Ask the terminal to bracket pasted text with markers, so that it can
+	 * be inserted in one go rather than typed a key at a time. */
+
+	define_key("\033[200~", KEY_PASTE_BEGIN);
+	define_key("\033[201~", KEY_PASTE_END);
+	fputs("\033[?2004h", stdout);
+	fflush(stdout);
+
 	#if defined A_ITALIC
 		has_italics = !!tigetstr("sitm");
 	#endif
+
+	for (int i = 0; i < NUM_ATTRS; i++)
+		attrmap[i] = compute_attr(i);
+	currentattr = 0;
+	attrset(currentattr);
 }
 
 void dpy_shutdown(void)
 {
 	endwin();
+	fputs("\033[?2004l", stdout);
+	fflush(stdout);
 }
 
 void dpy_clearscreen(void)
@@ -57,6 +112,7 @@ void dpy_getscreensize(int* x, int* y)
 void dpy_sync(void)
 {
 	refresh();
+	dpy_stats.frames++;
 }
 
 void dpy_setcursor(int x, int y)
@@ -70,48 +126,195 @@ void dpy_setattr(int andmask, int ormask)
 	attr &= andmask;
 	attr |= ormask;
 
-	int cattr = 0;
-	if (attr & DPY_ITALIC)
+	attr_t cattr = attrmap[attr & (NUM_ATTRS-1)];
+	if (cattr != currentattr)
 	{
-		#if defined A_ITALIC
-			if (has_italics)
-				cattr |= A_ITALIC;
-			else
-				cattr |= A_BOLD;
-		#else
-			cattr |= A_BOLD;
-		#endif
+		attrset(cattr);
+		currentattr = cattr;
+		dpy_stats.attrswitches++;
 	}
-	if (attr & (DPY_BOLD|DPY_BRIGHT))
-		cattr |= A_BOLD;
-	if (attr & DPY_DIM)
-		cattr |= A_DIM;
-	if (attr & DPY_UNDERLINE)
-		cattr |= A_UNDERLINE;
-	if (attr & DPY_REVERSE)
-		cattr |= A_REVERSE;
-
-	attrset(cattr);
 }
 
 void dpy_writechar(int x, int y, uni_t c)
 {
 	wchar_t cc = c;
 
+	dpy_stats.writes++;
 	mvaddnwstr(y, x, &cc, 1);
 }
 
+/* Writes a run of printable characters with one curses call per chunk
+ * rather than one per character. The run is clipped to the right-hand
+ * edge of the screen, as curses would otherwise wrap it. */
+
+void dpy_writerun(int x, int y, const uni_t* run, int len)
+{
+	wchar_t buffer[256];
+	int screenwidth = getmaxx(stdscr);
+
+	while ((len > 0) && (x < 0))
+	{
+		x += emu_wcwidth(*run++);
+		len--;
+	}
+
+	if (move(y, x) == ERR)
+		return;
+	while (len > 0)
+	{
+		int n = 0;
+		while ((n < len) && (n < (sizeof(buffer)/sizeof(*buffer))))
+		{
+			int w = emu_wcwidth(run[n]);
+			if ((x + w) > screenwidth)
+				break;
+			buffer[n] = run[n];
+			x += w;
+			n++;
+		}
+
+		if (n == 0)
+			break;
+		addnwstr(buffer, n);
+		dpy_stats.writes += n;
+		run += n;
+		len -= n;
+	}
+}
+
 void dpy_cleararea(int x1, int y1, int x2, int y2)
 {
-	wchar_t cc = ' ';
+	int screenwidth = getmaxx(stdscr);
+	if (x2 >= screenwidth)
+		x2 = screenwidth - 1;
+	if (x1 > x2)
+		return;
+
+	/* clrtoeol() blanks with the background attributes, so it can only be
+	 * used when no attributes are set. */
 
 	for (int y = y1; y <= y2; y++)
-		for (int x = x1; x <= x2; x++)
-			mvaddnwstr(y, x, &cc, 1);
+	{
+		if ((x2 == (screenwidth-1)) && (currentattr == 0))
+		{
+			move(y, x1);
+			clrtoeol();
+		}
+		else
+			mvhline(y, x1, ' ' | currentattr, x2 - x1 + 1);
+	}
+}
+
+/* The terminal is only allowed to scroll for the duration of the call;
+ * with idlok() set, curses turns this into insert/delete line operations
+ * rather than redrawing the rows. */
+
+void dpy_scrollarea(int y1, int y2, int delta)
+{
+	if ((y1 >= y2) || (delta == 0))
+		return;
+
+	setscrreg(y1, y2);
+	scrollok(stdscr, TRUE);
+	scrl(delta);
+	scrollok(stdscr, FALSE);
+	setscrreg(0, getmaxy(stdscr) - 1);
+}
+
+/* Reads the body of a bracketed paste, up to the closing marker, and queues
+ * its text. Line endings become newlines and other control characters are
+ * dropped. Gives up if the terminal goes quiet, so a lost closing marker
+ * can't hang the program. If memory runs out the rest of the paste is read
+ * and thrown away, leaving whatever fitted. Returns false if there's no text
+ * to queue. */
+
+static bool read_paste(void)
+{
+	size_t len = 0;
+	size_t max = 256;
+	char* text = malloc(max);
+	bool full = !text;
+
+	timeout(1000);
+	for (;;)
+	{
+		wint_t c;
+		int r = get_wch(&c);
+		if (r == ERR)
+			break;
+		if (r == KEY_CODE_YES)
+		{
+			if (c == KEY_PASTE_END)
+				break;
+			continue;
+		}
+
+		if (c == '\r')
+			c = '\n';
+		if (((c < 32) && (c != '\n') && (c != '\t')) || full)
+			continue;
+
+		if ((len + 8) > max)
+		{
+			char* bigger = realloc(text, max*2);
+			if (!bigger)
+			{
+				full = true;
+				continue;
+			}
+			text = bigger;
+			max *= 2;
+		}
+		char* p = text + len;
+		writeu8(&p, c);
+		len = p - text;
+	}
+
+	if (!text)
+		return false;
+	text[len] = '\0';
+	keyqueue_addpaste(text);
+	return true;
+}
+
+/* Converts the result of get_wch() into a key; returns false if it should
+ * be ignored. */
+
+static bool translate_key(int r, wint_t c, uni_t* key)
+{
+	if (r == KEY_CODE_YES)
+	{
+		if (c == KEY_PASTE_BEGIN)
+		{
+			if (!read_paste())
+				return false;
+			*key = KEYQUEUE_PASTE;
+			return true;
+		}
+		if (c == KEY_PASTE_END)
+			return false;
+	}
+
+	if ((r == KEY_CODE_YES) || !iswprint(c)) /* function key */
+	{
+		*key = -c;
+		return true;
+	}
+
+	if (emu_wcwidth(c) > 0)
+	{
+		*key = c;
+		return true;
+	}
+
+	return false;
 }
 
 uni_t dpy_getchar(int timeout)
 {
+	if (keyqueue_count() > 0)
+		return keyqueue_pop();
+
 	struct timeval then;
 	gettimeofday(&then, NULL);
 	u_int64_t thenms = (then.tv_usec/1000) + ((u_int64_t) then.tv_sec*1000);
@@ -125,7 +328,7 @@ uni_t dpy_getchar(int timeout)
 			gettimeofday(&now, NULL);
 			u_int64_t nowms = (now.tv_usec/1000) + ((u_int64_t) now.tv_sec*1000);
 
-			int delay = ((u_int64_t) timeout*1000) + nowms - thenms;
+			int delay = timeout - (int)(nowms - thenms);
 			if (delay <= 0)
 				return -KEY_TIMEOUT;
 
@@ -140,12 +343,31 @@ uni_t dpy_getchar(int timeout)
 		if (r == ERR) /* timeout */
 			return -KEY_TIMEOUT;
 
-		if ((r == KEY_CODE_YES) || !iswprint(c)) /* function key */
-			return -c;
+		uni_t key;
+		if (translate_key(r, c, &key))
+			return key;
+	}
+}
+
+/* Moves everything ncurses has already received into the type-ahead
+ * buffer, without waiting. */
 
-		if (emu_wcwidth(c) > 0)
-			return c;
+bool dpy_haspendinginput(void)
+{
+	while (keyqueue_count() < KEYQUEUE_SIZE)
+	{
+		wint_t c;
+		timeout(0);
+		int r = get_wch(&c);
+		if (r == ERR)
+			break;
+
+		uni_t key;
+		if (translate_key(r, c, &key))
+			keyqueue_push(key);
 	}
+
+	return keyqueue_count() > 0;
 }
 
 const char* dpy_getkeyname(uni_t k)
@@ -13,25 +13,180 @@ enum
 	BOLD = (1<<1),
 };
 
-static struct glyph* glyphs;
+/* The glyph table is kept in least-recently-used order: uthash iterates in
+ * insertion order, so every hit moves the glyph to the end, and eviction
+ * takes glyphs from the front. */
+
+static struct glyph* glyphs = NULL;
 static XftFont* fonts[4];
 
+static int maxentries;
+static size_t maxbytes;
+static int numentries = 0;
+
+/* Glyphs are rendered into a handful of large atlas pixmaps rather than one
+ * pixmap each. As every glyph is exactly one row high, each atlas is cut
+ * into shelves of fontheight which are filled from left to right. Slots
+ * freed by eviction go onto a free list for their width, in cells. */
+
+#define ATLAS_WIDTH 1024
+#define MAX_ATLASES 64
+#define MAX_CELLS   2
+
+struct atlas
+{
+	Pixmap pixmap;
+	XftDraw* draw;
+};
+
+struct slot
+{
+	unsigned short atlas;
+	unsigned short x, y;
+};
+
+static struct atlas atlases[MAX_ATLASES];
+static int numatlases = 0;
+static int maxatlases;
+static int atlasheight;
+
+static int shelfatlas = 0;
+static int shelfx = 0;
+static int shelfy = 0;
+
+static struct slot* freeslots[MAX_CELLS+1];
+static int numfreeslots[MAX_CELLS+1];
+static int maxfreeslots[MAX_CELLS+1];
+
 static struct glyph* create_struct_glyph(void)
 {
 	return calloc(1, sizeof(struct glyph));
 }
 
-#if 0
 static void delete_struct_glyph(struct glyph* glyph)
 {
-	if (!glyph)
-		return;
-
-	if (glyph->pixmap)
-		XFreePixmap(display, glyph->pixmap);
 	free(glyph);
 }
-#endif
+
+static int glyph_cells(struct glyph* glyph)
+{
+	return glyph->width / fontwidth;
+}
+
+static void free_slot(int cells, struct slot slot)
+{
+	if (numfreeslots[cells] == maxfreeslots[cells])
+	{
+		maxfreeslots[cells] = maxfreeslots[cells]*2 + 16;
+		freeslots[cells] = realloc(freeslots[cells],
+			maxfreeslots[cells] * sizeof(struct slot));
+	}
+	freeslots[cells][numfreeslots[cells]++] = slot;
+}
+
+static void remove_glyph(struct glyph* glyph)
+{
+	HASH_DEL(glyphs, glyph);
+	numentries--;
+	free_slot(glyph_cells(glyph),
+		(struct slot) { glyph->atlas, glyph->x, glyph->y });
+	delete_struct_glyph(glyph);
+}
+
+/* Works out how big the atlases are, and how many of them fit into the
+ * memory budget. */
+
+static void size_atlases(void)
+{
+	int depth = DefaultDepth(display, DefaultScreen(display));
+	int bpp = (depth > 16) ? 4 : (depth > 8) ? 2 : 1;
+
+	atlasheight = MAX(1, ATLAS_WIDTH / fontheight) * fontheight;
+	maxatlases = maxbytes / ((size_t)ATLAS_WIDTH * atlasheight * bpp);
+	maxatlases = MAX(1, MIN(MAX_ATLASES, maxatlases));
+}
+
+static bool create_atlas(void)
+{
+	if (numatlases == maxatlases)
+		return false;
+
+	struct atlas* atlas = &atlases[numatlases++];
+	atlas->pixmap = XCreatePixmap(display, window,
+		ATLAS_WIDTH, atlasheight,
+		DefaultDepth(display, DefaultScreen(display)));
+	atlas->draw = XftDrawCreate(display, atlas->pixmap,
+		DefaultVisual(display, DefaultScreen(display)),
+		DefaultColormap(display, DefaultScreen(display)));
+	return true;
+}
+
+/* Marks all of the atlas space as unused. Only valid when there are no
+ * glyphs. */
+
+static void reset_slots(void)
+{
+	shelfatlas = shelfx = shelfy = 0;
+	for (int i=0; i<=MAX_CELLS; i++)
+		numfreeslots[i] = 0;
+}
+
+static void destroy_atlases(void)
+{
+	for (int i=0; i<numatlases; i++)
+	{
+		XftDrawDestroy(atlases[i].draw);
+		XFreePixmap(display, atlases[i].pixmap);
+	}
+	numatlases = 0;
+	reset_slots();
+}
+
+/* Finds room for a glyph of the given width, either from the free list or
+ * from the end of the current shelf. */
+
+static bool allocate_slot(int cells, struct slot* slot)
+{
+	if (numfreeslots[cells] > 0)
+	{
+		*slot = freeslots[cells][--numfreeslots[cells]];
+		return true;
+	}
+
+	int w = cells * fontwidth;
+	for (;;)
+	{
+		if (shelfatlas == numatlases)
+		{
+			if (!create_atlas())
+				return false;
+		}
+
+		if ((shelfx + w) > ATLAS_WIDTH)
+		{
+			shelfx = 0;
+			shelfy += fontheight;
+		}
+
+		if ((shelfy + fontheight) <= atlasheight)
+			break;
+
+		shelfatlas++;
+		shelfx = shelfy = 0;
+	}
+
+	*slot = (struct slot) { shelfatlas, shelfx, shelfy };
+	shelfx += w;
+	return true;
+}
+
+static int get_int_setting(const char* name, int fallback)
+{
+	lua_getglobal(L, name);
+	int value = lua_isnumber(L, -1) ? lua_tointeger(L, -1) : fallback;
+	lua_pop(L, 1);
+	return (value > 0) ? value : fallback;
+}
 
 static void check_font(XftFont* font, const char* name)
 {
@@ -58,7 +213,7 @@ static void load_fonts(void)
 	const char* normalfont = lua_tostring(L, -1);
 	if (!normalfont)
 		normalfont = "monospace";
-	char buffer[strlen(normalfont) + strlen(bold) + strlen(italic)];
+	char buffer[strlen(normalfont) + strlen(bold) + strlen(italic) + 1];
 
 	fonts[REGULAR] = XftFontOpenName(display, DefaultScreen(display), normalfont);
 	check_font(fonts[REGULAR], normalfont);
@@ -84,59 +239,165 @@ static void load_fonts(void)
 		fontascent = font->ascent;
 	}
 
+	lua_pop(L, 3);
+}
+
+static void unload_fonts(void)
+{
+	for (int i=0; i<4; i++)
+	{
+		if (fonts[i])
+			XftFontClose(display, fonts[i]);
+		fonts[i] = NULL;
+	}
+}
+
+/* Rasterises the printable ASCII characters in all four font variants up
+ * front. Ordinary text is drawn straight from the fonts rather than from the
+ * atlases, so this is what keeps the first screenful from stalling. */
+
+static void preload_ascii(void)
+{
+	for (int i=0; i<4; i++)
+	{
+		FT_UInt indices[127 - 32];
+		int n = 0;
+		for (FcChar32 c = 32; c < 127; c++)
+		{
+			FT_UInt index = XftCharIndex(display, fonts[i], c);
+			if (index)
+				indices[n++] = index;
+		}
+		XftFontLoadGlyphs(display, fonts[i], FcTrue, indices, n);
+	}
 }
 
 void glyphcache_init(void)
 {
+	maxentries = get_int_setting("X11_GLYPH_CACHE_ENTRIES", 4096);
+	maxbytes = get_int_setting("X11_GLYPH_CACHE_KB", 16*1024) * 1024;
 	load_fonts();
+	preload_ascii();
+	size_atlases();
 }
 
-static struct glyph* create_glyph(unsigned int id)
+void glyphcache_deinit(void)
 {
-	FcChar32 c = id >> 8;
-	int attrs = id & 0xff;
+	glyphcache_flush();
+	unload_fonts();
+}
 
-	struct glyph* glyph = create_struct_glyph();
-	glyph->id = id;
-	glyph->width = fontwidth * emu_wcwidth(c);
-	glyph->pixmap = XCreatePixmap(display, window,
-		glyph->width, fontheight,
-		DefaultDepth(display, DefaultScreen(display)));
+/* Reloads the fonts after the settings have changed. Every cached glyph was
+ * rendered with the old ones, so they all go. */
 
-	XftDraw* draw = XftDrawCreate(display, glyph->pixmap,
-		DefaultVisual(display, DefaultScreen(display)),
-		DefaultColormap(display, DefaultScreen(display)));
+void glyphcache_reload(void)
+{
+	glyphcache_flush();
+	unload_fonts();
+	load_fonts();
+	preload_ascii();
+	size_atlases();
+}
 
-	XftColor* fg;
-	XftColor* bg;
+void glyphcache_getfontsize(int* w, int* h)
+{
+	*w = fontwidth;
+	*h = fontheight;
+}
 
+void glyphcache_flush(void)
+{
+	while (glyphs)
+		remove_glyph(glyphs);
+	destroy_atlases();
+}
+
+/* Works out the colours and font for a set of DPY_* attributes. These are
+ * shared with the span renderer in x11.c. */
+
+void glyphcache_getcolours(int attrs, XftColor** fg, XftColor** bg)
+{
 	if (attrs & DPY_BRIGHT)
-		fg = &colours[COLOUR_BRIGHT];
+		*fg = &colours[COLOUR_BRIGHT];
 	else if (attrs & DPY_DIM)
-		fg = &colours[COLOUR_DIM];
+		*fg = &colours[COLOUR_DIM];
 	else
-		fg = &colours[COLOUR_NORMAL];
+		*fg = &colours[COLOUR_NORMAL];
 
 	if (attrs & DPY_REVERSE)
 	{
-		bg = fg;
-		fg = &colours[COLOUR_BLACK];
+		*bg = *fg;
+		*fg = &colours[COLOUR_BLACK];
 	}
 	else
-		bg = &colours[COLOUR_BLACK];
+		*bg = &colours[COLOUR_BLACK];
+}
 
+Pixmap glyphcache_getatlas(int atlas)
+{
+	return atlases[atlas].pixmap;
+}
+
+XftFont* glyphcache_getfont(int attrs)
+{
 	int style = REGULAR;
 	if (attrs & DPY_BOLD)
 		style |= BOLD;
 	if (attrs & DPY_ITALIC)
 		style |= ITALIC;
+	return fonts[style];
+}
+
+/* Returns true if the character is drawn by hand rather than from the font,
+ * and so must always come from the cache. */
+
+bool glyphcache_isspecial(uni_t c)
+{
+	switch (c)
+	{
+		case 0x2500: case 0x2501: case 0x2502: case 0x2503:
+		case 0x250c: case 0x250d: case 0x250e: case 0x250f:
+		case 0x2510: case 0x2511: case 0x2512: case 0x2513:
+		case 0x2514: case 0x2515: case 0x2516: case 0x2517:
+		case 0x2518: case 0x2519: case 0x251a: case 0x251b:
+		case 0x2551:
+		case 0x2594:
+			return true;
+	}
+	return false;
+}
+
+static struct glyph* create_glyph(unsigned int id, int cells, struct slot slot)
+{
+	FcChar32 c = id >> 8;
+	int attrs = id & 0xff;
+
+	struct glyph* glyph = create_struct_glyph();
+	glyph->id = id;
+	glyph->width = fontwidth * cells;
+	glyph->atlas = slot.atlas;
+	glyph->x = slot.x;
+	glyph->y = slot.y;
+
+	/* Clip to the slot, so that overhanging glyphs don't spill into their
+	 * neighbours in the atlas. */
+
+	XftDraw* draw = atlases[slot.atlas].draw;
+	int ox = slot.x;
+	int oy = slot.y;
+	XRectangle clip = { 0, 0, glyph->width, fontheight };
+	XftDrawSetClipRectangles(draw, ox, oy, &clip, 1);
+
+	XftColor* fg;
+	XftColor* bg;
+	glyphcache_getcolours(attrs, &fg, &bg);
 
 	int w = (glyph->width+1) & ~1;
 	int w2 = w/2;
 	int h = (fontheight+1) & ~1;
 	int h2 = h/2;
 
-	XftDrawRect(draw, bg, 0, 0, w, h);
+	XftDrawRect(draw, bg, ox, oy, w, h);
 
 	switch (c)
 	{
@@ -146,64 +407,65 @@ static struct glyph* create_glyph(unsigned int id)
 
 		case 0x2500: /* ─ */
 		case 0x2501: /* ━ */
-			XftDrawRect(draw, fg, 0, h2, w, 1);
+			XftDrawRect(draw, fg, ox, oy+h2, w, 1);
 			break;
 
 		case 0x2502: /* │ */
 		case 0x2503: /* ┃ */
-			XftDrawRect(draw, fg, w2, 0, 1, h);
+			XftDrawRect(draw, fg, ox+w2, oy, 1, h);
 			break;
 
 		case 0x250c: /* ┌ */
 		case 0x250d: /* ┍ */
 		case 0x250e: /* ┎ */
 		case 0x250f: /* ┏ */
-			XftDrawRect(draw, fg, w2, h2, 1, h2);
-			XftDrawRect(draw, fg, w2, h2, w2, 1);
+			XftDrawRect(draw, fg, ox+w2, oy+h2, 1, h2);
+			XftDrawRect(draw, fg, ox+w2, oy+h2, w2, 1);
 			break;
 
 		case 0x2510: /* ┐ */
 		case 0x2511: /* ┑ */
 		case 0x2512: /* ┒ */
 		case 0x2513: /* ┓ */
-			XftDrawRect(draw, fg, w2, h2, 1, h2);
-			XftDrawRect(draw, fg, 0, h2, w2, 1);
+			XftDrawRect(draw, fg, ox+w2, oy+h2, 1, h2);
+			XftDrawRect(draw, fg, ox, oy+h2, w2, 1);
 			break;
 
 		case 0x2514: /* └ */
 		case 0x2515: /* ┕ */
 		case 0x2516: /* ┖ */
 		case 0x2517: /* ┗ */
-			XftDrawRect(draw, fg, w2, 0, 1, h2);
-			XftDrawRect(draw, fg, w2, h2, w2, 1);
+			XftDrawRect(draw, fg, ox+w2, oy, 1, h2);
+			XftDrawRect(draw, fg, ox+w2, oy+h2, w2, 1);
 			break;
 
 		case 0x2518: /* ┘ */
 		case 0x2519: /* ┙ */
 		case 0x251a: /* ┚ */
 		case 0x251b: /* ┛ */
-			XftDrawRect(draw, fg, w2, 0, 1, h2);
-			XftDrawRect(draw, fg, 0, h2, w2+1, 1);
+			XftDrawRect(draw, fg, ox+w2, oy, 1, h2);
+			XftDrawRect(draw, fg, ox, oy+h2, w2+1, 1);
 			break;
 
 		case 0x2551: /* ║ */
-			XftDrawRect(draw, fg, w2-1, 0, 1, h);
-			XftDrawRect(draw, fg, w2+1, 0, 1, h);
+			XftDrawRect(draw, fg, ox+w2-1, oy, 1, h);
+			XftDrawRect(draw, fg, ox+w2+1, oy, 1, h);
 			break;
 
 		case 0x2594: /* ▔ */
-			XftDrawRect(draw, fg, 0, 2, w, 1);
+			XftDrawRect(draw, fg, ox, oy+2, w, 1);
 			break;
 	
 		default:
-			XftDrawString32(draw, fg, fonts[style], 0, fontascent, &c, 1);
+			XftDrawString32(draw, fg, glyphcache_getfont(attrs),
+				ox, oy+fontascent, &c, 1);
 			break;
 	}
 
 	if (attrs & DPY_UNDERLINE)
-		XftDrawRect(draw, fg, 0, fontascent + 2, fontwidth, 1);
+		XftDrawRect(draw, fg, ox, oy+fontascent + 2, fontwidth, 1);
 	
-	XftDrawDestroy(draw);
+	XftDrawSetClip(draw, NULL);
 	return glyph;
 }
 
@@ -216,16 +478,42 @@ struct glyph* glyphcache_getglyph(unsigned int id)
 	if (id == 0)
 		return NULL;
 
-	/* Attempt to find the glyph in the cache. */
+	/* Attempt to find the glyph in the cache. If it's there, move it to the
+	 * most recently used end. */
 
-    HASH_FIND_INT(glyphs, &id, glyph);
-    if (!glyph)
+	HASH_FIND_INT(glyphs, &id, glyph);
+	if (glyph)
 	{
-		glyph = create_glyph(id);
-		if (glyph)
-			HASH_ADD_INT(glyphs, id, glyph);
-    }
+		HASH_DEL(glyphs, glyph);
+		HASH_ADD_INT(glyphs, id, glyph);
+		return glyph;
+	}
+
+	/* Make room for it. The caller only ever uses one glyph at a time, so
+	 * evicting everything else is safe. */
 
-    return glyph;
+	int cells = MAX(1, MIN(MAX_CELLS, emu_wcwidth(id >> 8)));
+	while (glyphs && (numentries >= maxentries))
+		remove_glyph(glyphs);
+
+	struct slot slot;
+	while (!allocate_slot(cells, &slot))
+	{
+		if (!glyphs)
+		{
+			/* The free slots are all the wrong width; start again. */
+
+			reset_slots();
+			if (!allocate_slot(cells, &slot))
+				return NULL;
+			break;
+		}
+		remove_glyph(glyphs);
+	}
+
+	glyph = create_glyph(id, cells, slot);
+	HASH_ADD_INT(glyphs, id, glyph);
+	numentries++;
+	return glyph;
 }
 
@@ -38,40 +38,30 @@ Window window;
 XftColor colours[NUM_COLOURS];
 int fontwidth, fontheight, fontascent;
 
+const unsigned int dpy_trackedstats = DPY_STATS_CELLSCHANGED | DPY_STATS_REQUESTS;
+
 static XIC xic;
 static XIM xim;
 static XftDraw* draw;
 static GC gc;
 
+/* Frames are composed in an offscreen pixmap and copied to the window in
+ * one go. */
+
+static Pixmap backpixmap = 0;
+static XftDraw* backdraw = NULL;
+
 static int screenwidth, screenheight;
+static int windowwidth, windowheight;
+static char* appearance = NULL;
 static int cursorx, cursory;
 static unsigned int* frontbuffer = NULL;
 static unsigned int* backbuffer = NULL;
 static int defaultattr = 0;
 
-static uni_t queued[4];
-static int numqueued = 0;
 
 static void redraw(void);
-
-static uni_t dequeue(void)
-{
-	uni_t c = queued[0];
-	queued[0] = queued[1];
-	queued[1] = queued[2];
-	queued[2] = queued[3];
-	numqueued--;
-	return c;
-}
-
-void push_key(uni_t c)
-{
-	if (numqueued >= (sizeof(queued)/sizeof(*queued)))
-		return;
-
-	queued[numqueued] = c;
-	numqueued++;
-}
+static void destroy_backpixmap(void);
 
 static void sput(unsigned int* screen, int x, int y, unsigned int id)
 {
@@ -109,6 +99,99 @@ static XftColor load_colour(const char* name, const char* fallback)
 	return colour;
 }
 
+static void load_colours(void)
+{
+	colours[COLOUR_BLACK]  = load_colour("X11_BLACK_COLOUR",  "#000000");
+	colours[COLOUR_DIM]    = load_colour("X11_DIM_COLOUR",    "#555555");
+	colours[COLOUR_NORMAL] = load_colour("X11_NORMAL_COLOUR", "#888888");
+	colours[COLOUR_BRIGHT] = load_colour("X11_BRIGHT_COLOUR", "#ffffff");
+}
+
+static void unload_colours(void)
+{
+	for (int i=0; i<NUM_COLOURS; i++)
+		XftColorFree(display,
+			DefaultVisual(display, DefaultScreen(display)),
+			DefaultColormap(display, DefaultScreen(display)),
+			&colours[i]);
+}
+
+/* Returns a string describing all the settings which affect how glyphs look,
+ * so that changes to them can be spotted. The caller must free it. */
+
+static char* get_appearance(void)
+{
+	static const char* names[] =
+	{
+		"X11_FONT", "X11_BOLD_MODIFIER", "X11_ITALIC_MODIFIER",
+		"X11_BLACK_COLOUR", "X11_DIM_COLOUR", "X11_NORMAL_COLOUR",
+		"X11_BRIGHT_COLOUR"
+	};
+	const int count = sizeof(names)/sizeof(*names);
+
+	for (int i=0; i<count; i++)
+	{
+		lua_getglobal(L, names[i]);
+		if (!lua_isstring(L, -1))
+		{
+			lua_pop(L, 1);
+			lua_pushstring(L, "");
+		}
+		lua_pushstring(L, "\n");
+	}
+	lua_concat(L, count*2);
+	char* s = strdup(lua_tostring(L, -1));
+	lua_pop(L, 1);
+	return s;
+}
+
+static void resize_grid(void)
+{
+	int w = windowwidth / fontwidth;
+	int h = windowheight / fontheight;
+
+	if ((w != screenwidth) || (h != screenheight))
+	{
+		screenwidth = w;
+		screenheight = h;
+
+		if (frontbuffer)
+			free(frontbuffer);
+		frontbuffer = NULL;
+		destroy_backpixmap();
+		if (backbuffer)
+			free(backbuffer);
+		backbuffer = calloc(screenwidth * screenheight, sizeof(unsigned int));
+		keyqueue_push(-VK_RESIZE);
+	}
+}
+
+/* If the font or colour settings have been changed since they were last
+ * loaded, reload them; this throws away the glyph cache and forces a
+ * complete repaint. */
+
+static void check_appearance(void)
+{
+	char* newappearance = get_appearance();
+	if (strcmp(newappearance, appearance) == 0)
+	{
+		free(newappearance);
+		return;
+	}
+
+	free(appearance);
+	appearance = newappearance;
+
+	unload_colours();
+	load_colours();
+	glyphcache_reload();
+
+	destroy_backpixmap();
+	if (frontbuffer)
+		memset(frontbuffer, 0, screenwidth * screenheight * sizeof(unsigned int));
+	resize_grid();
+}
+
 void dpy_start(void)
 {
 	display = XOpenDisplay(NULL);
@@ -128,11 +211,8 @@ void dpy_start(void)
 	XMapWindow(display, window);
 
 	glyphcache_init();
-
-	colours[COLOUR_BLACK]  = load_colour("X11_BLACK_COLOUR",  "#000000");
-	colours[COLOUR_DIM]    = load_colour("X11_DIM_COLOUR",    "#555555");
-	colours[COLOUR_NORMAL] = load_colour("X11_NORMAL_COLOUR", "#888888");
-	colours[COLOUR_BRIGHT] = load_colour("X11_BRIGHT_COLOUR", "#ffffff");
+	load_colours();
+	appearance = get_appearance();
 
 	draw = XftDrawCreate(display, window,
 		DefaultVisual(display, DefaultScreen(display)),
@@ -164,6 +244,7 @@ void dpy_start(void)
 
 void dpy_shutdown(void)
 {
+	glyphcache_deinit();
 }
 
 void dpy_clearscreen(void)
@@ -179,6 +260,7 @@ void dpy_getscreensize(int* x, int* y)
 
 void dpy_sync(void)
 {
+	check_appearance();
 	if (!frontbuffer)
 		frontbuffer = calloc(screenwidth * screenheight, sizeof(unsigned int));
 	redraw();
@@ -199,18 +281,31 @@ void dpy_setcursor(int x, int y)
 
 void dpy_setattr(int andmask, int ormask)
 {
+	int oldattr = defaultattr;
 	defaultattr &= andmask;
 	defaultattr |= ormask;
+	if (defaultattr != oldattr)
+		dpy_stats.attrswitches++;
 }
 
 void dpy_writechar(int x, int y, uni_t c)
 {
 	unsigned int id = glyphcache_id(c, defaultattr);
+	dpy_stats.writes++;
 	sput(backbuffer, x, y, id);
 	if (emu_wcwidth(c) == 2)
 		sput(backbuffer, x+1, y, 0);
 }
 
+void dpy_writerun(int x, int y, const uni_t* run, int len)
+{
+	for (int i = 0; i < len; i++)
+	{
+		dpy_writechar(x, y, run[i]);
+		x += emu_wcwidth(run[i]);
+	}
+}
+
 void dpy_cleararea(int x1, int y1, int x2, int y2)
 {
 	for (int y=y1; y<=y2; y++)
@@ -221,34 +316,252 @@ void dpy_cleararea(int x1, int y1, int x2, int y2)
 	}
 }
 
+static void scrollbuffer(unsigned int* buffer, int y1, int y2, int delta,
+		unsigned int blank)
+{
+	int rows = y2 - y1 + 1;
+	int shift = abs(delta);
+	unsigned int* top = &buffer[y1 * screenwidth];
+	size_t bytes = (rows - shift) * screenwidth * sizeof(*buffer);
+	int exposed;
+	if (delta > 0)
+	{
+		memmove(top, top + shift*screenwidth, bytes);
+		exposed = y2 - shift + 1;
+	}
+	else
+	{
+		memmove(top + shift*screenwidth, top, bytes);
+		exposed = y1;
+	}
+
+	unsigned int* p = &buffer[exposed * screenwidth];
+	for (int i = 0; i < (shift * screenwidth); i++)
+		p[i] = blank;
+}
+
+/* Scrolling moves both the cells and the pixels which have already been
+ * drawn for them, so that the next frame only has to draw the rows which
+ * are scrolled in. The rows are moved within the back pixmap and then the
+ * whole area is copied to the window; this also removes the caret. */
+
+void dpy_scrollarea(int y1, int y2, int delta)
+{
+	if (!backbuffer || (y1 < 0) || (y2 >= screenheight) || (y1 >= y2) ||
+			(delta == 0))
+		return;
+
+	int rows = y2 - y1 + 1;
+	int shift = abs(delta);
+	if (shift >= rows)
+	{
+		dpy_cleararea(0, y1, screenwidth-1, y2);
+		return;
+	}
+
+	unsigned int blank = glyphcache_id(' ', 0);
+	scrollbuffer(backbuffer, y1, y2, delta, blank);
+	if (!frontbuffer || !backpixmap)
+		return;
+	scrollbuffer(frontbuffer, y1, y2, delta, blank);
+
+	int w = screenwidth*fontwidth;
+	int from = (delta > 0) ? (y1 + shift) : y1;
+	int to = (delta > 0) ? y1 : (y1 + shift);
+	int exposed = (delta > 0) ? (y2 - shift + 1) : y1;
+	XCopyArea(display, backpixmap, backpixmap, gc,
+		0, from*fontheight, w, (rows - shift)*fontheight,
+		0, to*fontheight);
+
+	XftColor* fg;
+	XftColor* bg;
+	glyphcache_getcolours(0, &fg, &bg);
+	XftDrawRect(backdraw, bg, 0, exposed*fontheight, w, shift*fontheight);
+
+	XCopyArea(display, backpixmap, window, gc,
+		0, y1*fontheight, w, rows*fontheight,
+		0, y1*fontheight);
+}
+
+/* Forces the cells covering a rectangle of the window, in pixels, to be
+ * redrawn on the next frame. */
+
+static void invalidate_area(int x, int y, int w, int h)
+{
+	if (!frontbuffer || (w <= 0) || (h <= 0))
+		return;
+
+	/* Also take the cell to the left, in case it holds a double-width
+	 * glyph which overhangs into the area. */
+
+	int x1 = MAX(0, x/fontwidth - 1);
+	int y1 = MAX(0, y/fontheight);
+	int x2 = MIN(screenwidth-1, (x+w-1)/fontwidth);
+	int y2 = MIN(screenheight-1, (y+h-1)/fontheight);
+
+	for (int yy=y1; yy<=y2; yy++)
+	{
+		unsigned int* p = &frontbuffer[yy * screenwidth];
+		for (int xx=x1; xx<=x2; xx++)
+			p[xx] = 0;
+	}
+}
+
+static void create_backpixmap(void)
+{
+	if (backpixmap || !screenwidth || !screenheight)
+		return;
+
+	backpixmap = XCreatePixmap(display, window,
+		screenwidth*fontwidth, screenheight*fontheight,
+		DefaultDepth(display, DefaultScreen(display)));
+	backdraw = XftDrawCreate(display, backpixmap,
+		DefaultVisual(display, DefaultScreen(display)),
+		DefaultColormap(display, DefaultScreen(display)));
+	XftDrawRect(backdraw, &colours[COLOUR_BLACK], 0, 0,
+		screenwidth*fontwidth, screenheight*fontheight);
+}
+
+static void destroy_backpixmap(void)
+{
+	if (backdraw)
+		XftDrawDestroy(backdraw);
+	backdraw = NULL;
+	if (backpixmap)
+		XFreePixmap(display, backpixmap);
+	backpixmap = 0;
+}
+
 static void render_glyph(unsigned int id, int x, int y)
 {
 	struct glyph* glyph = glyphcache_getglyph(id);
-	if (glyph && glyph->pixmap)
-		XCopyArea(display, glyph->pixmap, window, gc,
-			0, 0, glyph->width, fontheight,
+	if (glyph)
+		XCopyArea(display, glyphcache_getatlas(glyph->atlas), backpixmap, gc,
+			glyph->x, glyph->y, glyph->width, fontheight,
 			x*fontwidth, y*fontheight);
 }
 
+static bool is_plain(unsigned int id)
+{
+	uni_t c = id >> 8;
+	return (id != 0) && (emu_wcwidth(c) == 1) && !glyphcache_isspecial(c);
+}
+
+/* Renders the cells from x1 up to x2 of a row into the back pixmap.
+ * Spans of ordinary characters with the same attributes are drawn with a
+ * single background fill and a single string draw; anything unusual comes
+ * from the glyph cache. */
+
+static void render_run(const unsigned int* backp, int x1, int x2, int y)
+{
+	XftCharSpec specs[x2 - x1];
+	int x = x1;
+
+	while (x < x2)
+	{
+		unsigned int id = backp[x];
+		if (id == 0)
+		{
+			x++;
+			continue;
+		}
+		if (!is_plain(id))
+		{
+			render_glyph(id, x, y);
+			x++;
+			continue;
+		}
+
+		int attrs = id & 0xff;
+		int sx = x;
+		int n = 0;
+		while ((x < x2) && is_plain(backp[x]) && ((backp[x] & 0xff) == attrs))
+		{
+			uni_t c = backp[x] >> 8;
+			if ((c != ' ') && (c != 160))
+			{
+				specs[n].ucs4 = c;
+				specs[n].x = x*fontwidth;
+				specs[n].y = y*fontheight + fontascent;
+				n++;
+			}
+			x++;
+		}
+
+		XftColor* fg;
+		XftColor* bg;
+		glyphcache_getcolours(attrs, &fg, &bg);
+
+		/* Clip to the span, so that overhanging glyphs don't leave debris in
+		 * neighbouring cells which aren't being redrawn. */
+
+		XRectangle clip = { 0, 0, (x - sx)*fontwidth, fontheight };
+		XftDrawSetClipRectangles(backdraw, sx*fontwidth, y*fontheight,
+			&clip, 1);
+
+		XftDrawRect(backdraw, bg, sx*fontwidth, y*fontheight,
+			(x - sx)*fontwidth, fontheight);
+		if (n > 0)
+			XftDrawCharSpec(backdraw, fg, glyphcache_getfont(attrs), specs, n);
+		if (attrs & DPY_UNDERLINE)
+			XftDrawRect(backdraw, fg, sx*fontwidth, y*fontheight + fontascent + 2,
+				(x - sx)*fontwidth, 1);
+	}
+
+	XftDrawSetClip(backdraw, NULL);
+}
+
 static void redraw(void)
 {
 	if (!frontbuffer || !backbuffer)
 		return;
 
+	create_backpixmap();
+	unsigned long firstrequest = NextRequest(display);
+
+	/* Render runs of changed cells into the back pixmap, keeping track of
+	 * the bounding box of everything which changed. */
+
+	int minx = screenwidth;
+	int maxx = -1;
+	int miny = screenheight;
+	int maxy = -1;
 	for (int y = 0; y<screenheight; y++)
 	{
 		unsigned int* frontp = &frontbuffer[y * screenwidth];
 		unsigned int* backp = &backbuffer[y * screenwidth];
-		for (int x = 0; x<screenwidth; x++)
+		int x = 0;
+		while (x < screenwidth)
 		{
-			if (frontp[x] != backp[x])
+			if (frontp[x] == backp[x])
 			{
-				frontp[x] = backp[x];
-				render_glyph(frontp[x], x, y);
+				x++;
+				continue;
 			}
+
+			int x1 = x;
+			while ((x < screenwidth) && (frontp[x] != backp[x]))
+				x++;
+
+			render_run(backp, x1, x, y);
+			dpy_stats.cellschanged += x - x1;
+			memcpy(frontp + x1, backp + x1, (x - x1) * sizeof(*frontp));
+
+			/* The last cell may hold a double-width glyph. */
+
+			minx = MIN(minx, x1);
+			maxx = MAX(maxx, MIN(x, screenwidth-1));
+			miny = MIN(miny, y);
+			maxy = MAX(maxy, y);
 		}
 	}
 
+	if (maxy != -1)
+		XCopyArea(display, backpixmap, window, gc,
+			minx*fontwidth, miny*fontheight,
+			(maxx - minx + 1)*fontwidth, (maxy - miny + 1)*fontheight,
+			minx*fontwidth, miny*fontheight);
+
 	/* Draw a caret where the cursor should be. */
 
 	int x = cursorx*fontwidth - 1;
@@ -263,11 +576,95 @@ static void redraw(void)
 	//XftDrawRect(draw, c, x+1, y-1, 1, 1);
 	//XftDrawRect(draw, c, x-1, y+h, 1, 1);
 	//XftDrawRect(draw, c, x+1, y+h, 1, 1);
+
+	dpy_stats.frames++;
+	dpy_stats.requests += NextRequest(display) - firstrequest;
+}
+
+static void handle_event(XEvent* e)
+{
+	switch (e->type)
+	{
+		case MapNotify:
+			break;
+
+		case Expose:
+		{
+			/* Mark the exposed cells as needing redrawing. Expose events
+			 * come in batches; the last one has a count of zero, and
+			 * that's when the screen gets repainted. */
+
+			XExposeEvent* xee = &e->xexpose;
+			invalidate_area(xee->x, xee->y, xee->width, xee->height);
+			if (xee->count == 0)
+				redraw();
+			break;
+		}
+
+		case ConfigureNotify:
+		{
+			XConfigureEvent* xce = &e->xconfigure;
+			windowwidth = xce->width;
+			windowheight = xce->height;
+			resize_grid();
+			break;
+		}
+
+		case MappingNotify:
+		case KeymapNotify:
+			XRefreshKeyboardMapping(&e->xmapping);
+			break;
+
+		case KeyPress:
+		{
+			XKeyPressedEvent* xke = &e->xkey;
+			KeySym keysym;
+			char buffer[32];
+			Status status = 0;
+			int charcount = Xutf8LookupString(xic, xke,
+				buffer, sizeof(buffer)-1, &keysym, &status);
+
+			int mods = 0;
+			if (xke->state & ShiftMask)
+				mods |= VKM_SHIFT;
+			if (xke->state & ControlMask)
+				mods |= VKM_CTRL;
+
+			if ((keysym & 0xffffff00) == 0xff00)
+			{
+				/* Special function key. */
+				if (!IsModifierKey(keysym))
+					keyqueue_push(-(keysym | mods));
+			}
+			else
+			{
+				const char* p = buffer;
+
+				while ((p-buffer) < charcount)
+				{
+					uni_t c = readu8(&p);
+
+					if (c < 32)
+					{
+						/* Ctrl + letter key */
+						keyqueue_push(-(VKM_CTRLASCII | c | mods));
+					}
+					else
+					{
+						if (xke->state & Mod1Mask)
+							keyqueue_push(-XK_Escape);
+						keyqueue_push(c);
+					}
+				}
+			}
+			break;
+		}
+	}
 }
 
 uni_t dpy_getchar(int timeout)
 {
-	while (numqueued == 0)
+	while (keyqueue_count() == 0)
 	{
 		/* If a timeout was asked for, wait that long for an event. */
 
@@ -280,7 +677,7 @@ uni_t dpy_getchar(int timeout)
 				.revents = 0
 			};
 
-			poll(&pfd, 1, timeout*1000);
+			poll(&pfd, 1, timeout);
 			if (!pfd.revents)
 				return -VK_TIMEOUT;
 		}
@@ -291,104 +688,29 @@ uni_t dpy_getchar(int timeout)
 		if (XFilterEvent(&e, window))
 			continue;
 
-		switch (e.type)
-		{
-			case MapNotify:
-				break;
-
-			case Expose:
-			{
-				/* Mark some of the screen as needing redrawing. */
-
-				if (frontbuffer)
-				{
-					for (int y=0; y<screenheight; y++)
-					{
-						unsigned int* p = &frontbuffer[y * screenwidth];
-						for (int x=0; x<screenwidth; x++)
-							p[x] = 0;
-					}
-				}
-				redraw();
-				break;
-			}
-
-			case ConfigureNotify:
-			{
-				XConfigureEvent* xce = &e.xconfigure;
-				int w = xce->width / fontwidth;
-				int h = xce->height / fontheight;
+		handle_event(&e);
+	}
 
-				if ((w != screenwidth) || (h != screenheight))
-				{
-					screenwidth = w;
-					screenheight = h;
-
-					if (frontbuffer)
-						free(frontbuffer);
-					frontbuffer = NULL;
-					if (backbuffer)
-						free(backbuffer);
-					backbuffer = calloc(screenwidth * screenheight, sizeof(unsigned int));
-					push_key(-VK_RESIZE);
-				}
+	return keyqueue_pop();
+}
 
-				break;
-			}
+/* Processes every event which has already arrived, without waiting, so that
+ * any keystrokes end up in the type-ahead buffer. */
 
-			case MappingNotify:
-			case KeymapNotify:
-				XRefreshKeyboardMapping(&e.xmapping);
-				break;
+bool dpy_haspendinginput(void)
+{
+	while (XPending(display) && (keyqueue_count() < KEYQUEUE_SIZE))
+	{
+		XEvent e;
+		XNextEvent(display, &e);
 
-			case KeyPress:
-			{
-				XKeyPressedEvent* xke = &e.xkey;
-				KeySym keysym;
-				char buffer[32];
-				Status status = 0;
-                int charcount = Xutf8LookupString(xic, xke,
-					buffer, sizeof(buffer)-1, &keysym, &status);
-
-				int mods = 0;
-				if (xke->state & ShiftMask)
-					mods |= VKM_SHIFT;
-				if (xke->state & ControlMask)
-					mods |= VKM_CTRL;
-
-				if ((keysym & 0xffffff00) == 0xff00)
-				{
-					/* Special function key. */
-					if (!IsModifierKey(keysym))
-						push_key(-(keysym | mods));
-				}
-				else
-				{
-					const char* p = buffer;
+		if (XFilterEvent(&e, window))
+			continue;
 
-					while ((p-buffer) < charcount)
-					{
-						uni_t c = readu8(&p);
-
-						if (c < 32)
-						{
-							/* Ctrl + letter key */
-							push_key(-(VKM_CTRLASCII | c | mods));
-						}
-						else
-						{
-							if (xke->state & Mod1Mask)
-								push_key(-XK_Escape);
-							push_key(c);
-						}
-					}
-				}
-				break;
-			}
-		}
+		handle_event(&e);
 	}
 
-	return dequeue();
+	return keyqueue_count() > 0;
 }
 
 const char* dpy_getkeyname(uni_t k)
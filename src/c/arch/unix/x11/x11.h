@@ -35,7 +35,8 @@ enum
 struct glyph
 {
 	unsigned int id;              /* id of this glyph */
-	Pixmap pixmap;                /* glyph storage */
+	int atlas;                    /* atlas holding the glyph */
+	int x, y;                     /* position of the glyph in the atlas */
 	int width;                    /* width of this cell */
 	UT_hash_handle hh;
 };
@@ -45,9 +46,14 @@ struct glyph
 extern void glyphcache_init(void);
 extern void glyphcache_deinit(void);
 extern void glyphcache_getfontsize(int* w, int* h);
+extern void glyphcache_reload(void);
 
 extern void glyphcache_flush(void);
 extern struct glyph* glyphcache_getglyph(unsigned int id);
+extern Pixmap glyphcache_getatlas(int atlas);
+extern void glyphcache_getcolours(int attrs, XftColor** fg, XftColor** bg);
+extern XftFont* glyphcache_getfont(int attrs);
+extern bool glyphcache_isspecial(uni_t c);
 
 extern Display* display;
 extern Window window;
@@ -22,6 +22,7 @@
 #define REGISTRY_PATH "Software\\Cowlark Technologies\\WordGrinder"
 
 HWND window = INVALID_HANDLE_VALUE;
+const unsigned int dpy_trackedstats = DPY_STATS_CELLSCHANGED;
 static LOGFONT fontlf;
 static unsigned int* frontbuffer = NULL;
 static unsigned int* backbuffer = NULL;
@@ -593,8 +594,8 @@ static void invalidate_character_at(int x, int y)
 	glyphcache_getfontsize(&textwidth, &textheight);
 
 	RECT r;
-	r.left = cursorx * textwidth - 1;
-	r.top = cursory * textheight - 1;
+	r.left = x * textwidth - 1;
+	r.top = y * textheight - 1;
 	r.right = r.left + textwidth + 2;
 	r.bottom = r.top + textheight + 2;
 	InvalidateRect(window, &r, 0);
@@ -709,6 +710,7 @@ void dpy_sync(void)
 {
 	int textwidth, textheight;
 	glyphcache_getfontsize(&textwidth, &textheight);
+	dpy_stats.frames++;
 
 	for (int y=0; y<screenheight; y++)
 	{
@@ -716,6 +718,9 @@ void dpy_sync(void)
 		unsigned int* back = backbuffer + y*screenwidth;
 		if (memcmp(front, back, screenwidth * sizeof(*backbuffer)) != 0)
 		{
+			for (int x=0; x<screenwidth; x++)
+				if (front[x] != back[x])
+					dpy_stats.cellschanged++;
 			memcpy(front, back, screenwidth * sizeof(*backbuffer));
 
 			int sy = y*textheight;
@@ -741,8 +746,11 @@ void dpy_setcursor(int x, int y)
 
 void dpy_setattr(int andmask, int ormask)
 {
+	int oldattr = defaultattr;
 	defaultattr &= andmask;
 	defaultattr |= ormask;
+	if (defaultattr != oldattr)
+		dpy_stats.attrswitches++;
 }
 
 void dpy_writechar(int x, int y, uni_t c)
@@ -750,9 +758,19 @@ void dpy_writechar(int x, int y, uni_t c)
 	if ((x < 0) || (y < 0) || (x >= screenwidth) || (y >= screenheight))
 		return;
 
+	dpy_stats.writes++;
 	backbuffer[y*screenwidth + x] = (c<<8) | defaultattr;
 }
 
+void dpy_writerun(int x, int y, const uni_t* run, int len)
+{
+	for (int i = 0; i < len; i++)
+	{
+		dpy_writechar(x, y, run[i]);
+		x += emu_wcwidth(run[i]);
+	}
+}
+
 void dpy_cleararea(int x1, int y1, int x2, int y2)
 {
 	for (int y = y1; y <= y2; y++)
@@ -760,6 +778,65 @@ void dpy_cleararea(int x1, int y1, int x2, int y2)
 			backbuffer[y*screenwidth + x] = (' '<<8) | defaultattr;
 }
 
+static void scrollbuffer(unsigned int* buffer, int y1, int y2, int delta)
+{
+	int rows = y2 - y1 + 1;
+	int shift = abs(delta);
+	unsigned int* top = &buffer[y1 * screenwidth];
+	size_t bytes = (rows - shift) * screenwidth * sizeof(*buffer);
+	int exposed;
+	if (delta > 0)
+	{
+		memmove(top, top + shift*screenwidth, bytes);
+		exposed = y2 - shift + 1;
+	}
+	else
+	{
+		memmove(top + shift*screenwidth, top, bytes);
+		exposed = y1;
+	}
+
+	unsigned int* p = &buffer[exposed * screenwidth];
+	for (int i = 0; i < (shift * screenwidth); i++)
+		p[i] = DEFAULT_CHAR;
+}
+
+/* Scrolling moves both the cells and the pixels which have already been
+ * painted for them, so that the next frame only has to paint the rows which
+ * are scrolled in. ScrollWindowEx() invalidates those rows itself. Anything
+ * waiting to be painted is painted first, as the update region doesn't
+ * move with the pixels. */
+
+void dpy_scrollarea(int y1, int y2, int delta)
+{
+	if (!backbuffer || (y1 < 0) || (y2 >= screenheight) || (y1 >= y2) ||
+			(delta == 0))
+		return;
+
+	int rows = y2 - y1 + 1;
+	int shift = abs(delta);
+	if (shift >= rows)
+	{
+		dpy_cleararea(0, y1, screenwidth-1, y2);
+		return;
+	}
+
+	int textwidth, textheight;
+	glyphcache_getfontsize(&textwidth, &textheight);
+
+	UpdateWindow(window);
+	scrollbuffer(backbuffer, y1, y2, delta);
+	scrollbuffer(frontbuffer, y1, y2, delta);
+
+	RECT r = {0, y1*textheight, screenwidth*textwidth, (y2+1)*textheight};
+	ScrollWindowEx(window, 0, -delta*textheight, &r, &r, NULL, NULL,
+		SW_INVALIDATE);
+
+	/* The caret has moved along with everything else. */
+
+	invalidate_character_at(cursorx, cursory - delta);
+}
+
 const char* dpy_getkeyname(uni_t k)
 {
 	switch (-k)
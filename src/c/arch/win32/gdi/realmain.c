@@ -17,31 +17,15 @@ extern int appMain(int argc, const char* argv[]);
 
 static int realargc;
 static const char** realargv;
-static uni_t queued[4];
-static int numqueued = 0;
 static int timeout = -1;
 static uni_t currentkey;
 
 static LPVOID appfiber;
 static LPVOID uifiber;
 
-static uni_t dequeue(void)
-{
-	uni_t c = queued[0];
-	queued[0] = queued[1];
-	queued[1] = queued[2];
-	queued[2] = queued[3];
-	numqueued--;
-	return c;
-}
-
 void dpy_queuekey(uni_t c)
 {
-	if (numqueued >= (sizeof(queued)/sizeof(*queued)))
-		return;
-
-	queued[numqueued] = c;
-	numqueued++;
+	keyqueue_push(c);
 }
 
 uni_t dpy_getchar(int t)
@@ -51,13 +35,21 @@ uni_t dpy_getchar(int t)
 	return currentkey;
 }
 
+/* Keys are delivered to the application fiber one at a time by
+ * dpy_flushkeys(), so anything still in the queue is pending. */
+
+bool dpy_haspendinginput(void)
+{
+	return keyqueue_count() > 0;
+}
+
 void dpy_flushkeys(void)
 {
 	if (GetCurrentFiber() == uifiber)
 	{
-		while (numqueued)
+		while (keyqueue_count() > 0)
 		{
-			currentkey = dequeue();
+			currentkey = keyqueue_pop();
 			SwitchToFiber(appfiber);
 		}
 	}
@@ -107,7 +99,7 @@ int main(int argc, const char* argv[])
 			if (timeout == -1)
 				KillTimer(window, TIMEOUT_TIMER_ID);
 			else
-				SetTimer(window, TIMEOUT_TIMER_ID, timeout*1000, NULL);
+				SetTimer(window, TIMEOUT_TIMER_ID, timeout, NULL);
 			oldtimeout = timeout;
 		}
 
@@ -0,0 +1,275 @@
+/* © 2015 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <string.h>
+
+/* A growable byte buffer, used by the exporters and the file saver to
+ * accumulate output in C rather than in tables of small Lua strings.
+ * wg.compress() and the zip writer's append method accept buffers anywhere
+ * they accept strings, so the contents need never become a Lua string. */
+
+#define BUFFER_METATABLE "wg.buffer"
+
+typedef struct buffer
+{
+	char* data;
+	size_t len;
+	size_t size;
+} buffer_t;
+
+static buffer_t* checkbuffer(lua_State* L, int index)
+{
+	buffer_t* b = luaL_checkudata(L, index, BUFFER_METATABLE);
+	if (!b->data)
+		luaL_error(L, "attempt to use a freed buffer");
+	return b;
+}
+
+/* Makes room for len more bytes. Returns false if there's no memory. */
+
+static bool reserve(buffer_t* b, size_t len)
+{
+	if ((b->len + len) > b->size)
+	{
+		size_t size = b->size;
+		while ((b->len + len) > size)
+			size *= 2;
+
+		char* data = realloc(b->data, size);
+		if (!data)
+			return false;
+		b->data = data;
+		b->size = size;
+	}
+	return true;
+}
+
+/* s may point into the buffer itself (buf:append(buf)), in which case it
+ * has to be found again after reserve() has moved the data. */
+
+static void addbytes(lua_State* L, buffer_t* b, const char* s, size_t len)
+{
+	bool inside = (s >= b->data) && (s < (b->data + b->size));
+	size_t offset = inside ? (size_t)(s - b->data) : 0;
+	if (!reserve(b, len))
+	{
+		luaL_error(L, "out of memory");
+		return;
+	}
+	if (inside)
+		s = b->data + offset;
+
+	memcpy(b->data + b->len, s, len);
+	b->len += len;
+}
+
+/* Appends a UTF-8 encoded character and returns the new length, or 0 if the
+ * buffer has been freed or there's no memory. This doesn't touch the Lua
+ * state, so the LuaJIT build can call it through the FFI. */
+
+size_t buffer_appendu8(buffer_t* b, uni_t c)
+{
+	if (!b->data || !reserve(b, 6))
+		return 0;
+
+	char* p = b->data + b->len;
+	writeu8(&p, c);
+	b->len = p - b->data;
+	return b->len;
+}
+
+const char* buffer_tolstring(lua_State* L, int index, size_t* len)
+{
+	buffer_t* b = lua_touserdata(L, index);
+	if (!b || !lua_getmetatable(L, index))
+		return NULL;
+
+	luaL_getmetatable(L, BUFFER_METATABLE);
+	bool isbuffer = lua_rawequal(L, -1, -2);
+	lua_pop(L, 2);
+	if (!isbuffer || !b->data)
+		return NULL;
+
+	*len = b->len;
+	return b->data;
+}
+
+const char* buffer_checklstring(lua_State* L, int index, size_t* len)
+{
+	const char* s = buffer_tolstring(L, index, len);
+	if (s)
+		return s;
+	return luaL_checklstring(L, index, len);
+}
+
+static int createbuffer_cb(lua_State* L)
+{
+	size_t size = luaL_optinteger(L, 1, 4096);
+	if (size < 16)
+		size = 16;
+
+	buffer_t* b = lua_newuserdata(L, sizeof(buffer_t));
+	b->data = malloc(size);
+	b->len = 0;
+	b->size = size;
+	if (!b->data)
+		return luaL_error(L, "out of memory");
+
+	luaL_getmetatable(L, BUFFER_METATABLE);
+	lua_setmetatable(L, -2);
+	return 1;
+}
+
+/* buffer:append(...) appends each argument (strings, numbers or other
+ * buffers) and returns the new length, so callers can decide when to flush
+ * without a second call. */
+
+static int buffer_append_cb(lua_State* L)
+{
+	buffer_t* b = checkbuffer(L, 1);
+	int n = lua_gettop(L);
+
+	for (int a = 2; a <= n; a++)
+	{
+		size_t len;
+		const char* s = buffer_checklstring(L, a, &len);
+		addbytes(L, b, s, len);
+	}
+
+	lua_pushnumber(L, b->len);
+	return 1;
+}
+
+/* buffer:appendf(format, ...) appends string.format(format, ...). The
+ * formatter is the first upvalue. */
+
+static int buffer_appendf_cb(lua_State* L)
+{
+	buffer_t* b = checkbuffer(L, 1);
+	int n = lua_gettop(L);
+
+	lua_pushvalue(L, lua_upvalueindex(1));
+	lua_insert(L, 2);
+	lua_call(L, n-1, 1);
+
+	size_t len;
+	const char* s = buffer_checklstring(L, -1, &len);
+	addbytes(L, b, s, len);
+
+	lua_pushnumber(L, b->len);
+	return 1;
+}
+
+static int buffer_appendu8_cb(lua_State* L)
+{
+	buffer_t* b = checkbuffer(L, 1);
+	size_t len = buffer_appendu8(b, luaL_checkinteger(L, 2));
+	if (len == 0)
+		return luaL_error(L, "out of memory");
+
+	lua_pushnumber(L, len);
+	return 1;
+}
+
+static int buffer_len_cb(lua_State* L)
+{
+	buffer_t* b = checkbuffer(L, 1);
+	lua_pushnumber(L, b->len);
+	return 1;
+}
+
+static int buffer_tostring_cb(lua_State* L)
+{
+	buffer_t* b = checkbuffer(L, 1);
+	lua_pushlstring(L, b->data, b->len);
+	return 1;
+}
+
+static int buffer_clear_cb(lua_State* L)
+{
+	buffer_t* b = checkbuffer(L, 1);
+	b->len = 0;
+	return 0;
+}
+
+/* buffer:flushto(file) writes the contents to a Lua file handle and empties
+ * the buffer. Returns true, or nil and an error message. */
+
+static int buffer_flushto_cb(lua_State* L)
+{
+	buffer_t* b = checkbuffer(L, 1);
+#if LUA_VERSION_NUM >= 502
+	luaL_Stream* stream = luaL_checkudata(L, 2, LUA_FILEHANDLE);
+	FILE* fp = stream->closef ? stream->f : NULL;
+#else
+	FILE* fp = *(FILE**) luaL_checkudata(L, 2, LUA_FILEHANDLE);
+#endif
+	if (!fp)
+		return luaL_error(L, "attempt to use a closed file");
+
+	size_t len = b->len;
+	b->len = 0;
+	if (fwrite(b->data, 1, len, fp) != len)
+	{
+		lua_pushnil(L);
+		lua_pushstring(L, strerror(errno));
+		return 2;
+	}
+
+	lua_pushboolean(L, true);
+	return 1;
+}
+
+static int buffer_gc_cb(lua_State* L)
+{
+	buffer_t* b = luaL_checkudata(L, 1, BUFFER_METATABLE);
+	free(b->data);
+	b->data = NULL;
+	b->len = b->size = 0;
+	return 0;
+}
+
+void buffer_init(void)
+{
+	const static luaL_Reg funcs[] =
+	{
+		{ "createbuffer",              createbuffer_cb },
+		{ NULL,                        NULL }
+	};
+
+	const static luaL_Reg methods[] =
+	{
+		{ "append",                    buffer_append_cb },
+		{ "appendu8",                  buffer_appendu8_cb },
+		{ "len",                       buffer_len_cb },
+		{ "tostring",                  buffer_tostring_cb },
+		{ "clear",                     buffer_clear_cb },
+		{ "flushto",                   buffer_flushto_cb },
+		{ NULL,                        NULL }
+	};
+
+	luaL_newmetatable(L, BUFFER_METATABLE);
+	lua_newtable(L);
+	luaL_setfuncs(L, methods, 0);
+
+	lua_getglobal(L, "string");
+	lua_getfield(L, -1, "format");
+	lua_remove(L, -2);
+	lua_pushcclosure(L, buffer_appendf_cb, 1);
+	lua_setfield(L, -2, "appendf");
+
+	lua_setfield(L, -2, "__index");
+	lua_pushcfunction(L, buffer_gc_cb);
+	lua_setfield(L, -2, "__gc");
+	lua_pushcfunction(L, buffer_len_cb);
+	lua_setfield(L, -2, "__len");
+	lua_pushcfunction(L, buffer_tostring_cb);
+	lua_setfield(L, -2, "__tostring");
+	lua_pop(L, 1);
+
+	lua_getglobal(L, "wg");
+	luaL_setfuncs(L, funcs, 0);
+}
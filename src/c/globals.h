@@ -38,6 +38,9 @@ extern int main(int argc, const char* argv[]);
 #include <lua.h>
 #include <lualib.h>
 #include <lauxlib.h>
+#if defined USE_LUAJIT
+#include <luajit.h>
+#endif
 
 extern lua_State* L;
 
@@ -56,23 +59,65 @@ extern void script_load_from_table(const FileDescriptor* table);
 extern void script_run(const char* argv[]);
 
 #if !defined LUA_VERSION_NUM || LUA_VERSION_NUM==501
+#if !defined LUAJIT_VERSION_NUM || LUAJIT_VERSION_NUM < 20100
+#define NEED_LUAL_SETFUNCS /* LuaJIT 2.1 has its own */
 extern void luaL_setfuncs(lua_State *L, const luaL_Reg *l, int nup);
+#endif
 #define lua_pushglobaltable(L) lua_pushvalue(L, LUA_GLOBALSINDEX)
+#define luaL_len(L, i) ((int) lua_objlen(L, i))
 #endif
 
+/* --- Memory allocation ------------------------------------------------- */
+
+extern lua_State* alloc_newstate(void);
+extern void alloc_init(void);
+
 /* --- Screen management ------------------------------------------------- */
 
 extern void screen_init(const char* argv[]);
 extern void screen_deinit(void);
+extern unsigned int screen_drawcount;
+extern void screen_write(int x, int y, const char* s, size_t size);
+extern int screen_getstringwidth(const char* s, size_t size);
+
+/* Type-ahead buffer shared by the display backends. */
+
+#define KEYQUEUE_SIZE 4096
+
+extern bool keyqueue_push(uni_t c);
+extern uni_t keyqueue_pop(void);
+extern int keyqueue_count(void);
+
+/* A backend which receives a bracketed paste hands over its text with
+ * keyqueue_addpaste() and delivers a KEYQUEUE_PASTE key in its place. */
+
+#define KEYQUEUE_PASTE (-0x7fffffff)
+
+extern void keyqueue_addpaste(char* text);
 
 /* --- Word management --------------------------------------------------- */
 
 extern void word_init(void);
+extern int word_writestyled(int x, int y, const char* s, size_t size,
+	int oattr, int revon, int revoff, int sor);
 
 /* --- Zipfile management ------------------------------------------------ */
 
 extern void zip_init(void);
 
+/* --- Byte buffers ------------------------------------------------------ */
+
+struct buffer;
+
+extern void buffer_init(void);
+extern size_t buffer_appendu8(struct buffer* b, uni_t c);
+extern const char* buffer_tolstring(lua_State* L, int index, size_t* len);
+extern const char* buffer_checklstring(lua_State* L, int index, size_t* len);
+
+/* --- XML parsing ------------------------------------------------------- */
+
+extern void xml_init(void);
+
 /* --- General utilities ------------------------------------------------- */
 
 extern int getu8bytes(char c);
@@ -96,18 +141,46 @@ enum
 	DPY_DIM = (1<<5),
 };
 
+/* Rendering counters, filled in by whichever backend is running. These are
+ * running totals; screen.c works out the figures for each frame. */
+
+struct dpy_stats
+{
+	unsigned int frames;          /* number of frames drawn */
+	unsigned int writes;          /* characters passed to dpy_write* */
+	unsigned int cellschanged;    /* cells whose contents actually changed */
+	unsigned int attrswitches;    /* changes of the current attributes */
+	unsigned int requests;        /* requests sent to the display server */
+	double redrawtime;            /* seconds spent in RedrawScreen() */
+};
+
+/* Not every backend can count everything; each one sets dpy_trackedstats
+ * to say which of the optional counters it keeps. */
+
+enum
+{
+	DPY_STATS_CELLSCHANGED = (1<<0),
+	DPY_STATS_REQUESTS = (1<<1),
+};
+
+extern struct dpy_stats dpy_stats;
+extern const unsigned int dpy_trackedstats;
+
 extern void dpy_init(const char* argv[]);
 extern void dpy_start(void);
 extern void dpy_shutdown(void);
 
 extern void dpy_setattr(int andmask, int ormask);
 extern void dpy_writechar(int x, int y, uni_t c);
+extern void dpy_writerun(int x, int y, const uni_t* run, int len);
 extern void dpy_setcursor(int x, int y);
 extern void dpy_clearscreen(void);
 extern void dpy_sync(void);
 extern void dpy_cleararea(int x1, int y1, int x2, int y2);
+extern void dpy_scrollarea(int y1, int y2, int delta);
 extern void dpy_getscreensize(int* x, int* y);
-extern uni_t dpy_getchar(int timeout);
+extern uni_t dpy_getchar(int timeout); /* in milliseconds, or -1 */
+extern bool dpy_haspendinginput(void);
 extern const char* dpy_getkeyname(uni_t key);
 
 #endif
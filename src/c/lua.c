@@ -73,7 +73,7 @@ void script_deinit(void)
 
 void script_init(void)
 {
-	L = luaL_newstate();
+	L = alloc_newstate();
 	luaL_openlibs(L);
 
 #if defined BUILTIN_LFS
@@ -154,7 +154,7 @@ void script_run(const char* argv[])
 
 /* Lua fallback functions, used for compatibility with 5.1 */
 
-#if !defined LUA_VERSION_NUM || LUA_VERSION_NUM==501
+#if defined NEED_LUAL_SETFUNCS
 void luaL_setfuncs(lua_State *L, const luaL_Reg *l, int nup)
 {
 	luaL_checkstack(L, nup+1, "too many upvalues");
@@ -12,10 +12,13 @@ int main(int argc, const char* argv[])
 {
 	setlocale(LC_ALL, "C.UTF-8");
 	script_init();
+	alloc_init();
 	screen_init(argv);
 	word_init();
 	utils_init();
+	buffer_init();
 	zip_init();
+	xml_init();
 
 	script_load_from_table(script_table);
 	script_run(argv);
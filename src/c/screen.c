@@ -5,11 +5,88 @@
 
 #include "globals.h"
 #include <string.h>
+#include "utils/utlist.h"
 
 static bool running = false;
 static int cursorx = 0;
 static int cursory = 0;
 
+/* Incremented by every drawing operation, so that the Lua side can tell
+ * whether anything else has touched the screen since it last drew it. */
+
+unsigned int screen_drawcount = 0;
+
+struct dpy_stats dpy_stats;
+static struct dpy_stats lastsync;
+static struct dpy_stats framestats;
+
+/* Keystrokes which have arrived but not yet been read, as a ring buffer. */
+
+static uni_t keyqueue[KEYQUEUE_SIZE];
+static int keyqueue_head = 0;
+static int keyqueue_length = 0;
+
+bool keyqueue_push(uni_t c)
+{
+	if (keyqueue_length == KEYQUEUE_SIZE)
+		return false;
+
+	keyqueue[(keyqueue_head + keyqueue_length) % KEYQUEUE_SIZE] = c;
+	keyqueue_length++;
+	return true;
+}
+
+uni_t keyqueue_pop(void)
+{
+	uni_t c = keyqueue[keyqueue_head];
+	keyqueue_head = (keyqueue_head + 1) % KEYQUEUE_SIZE;
+	keyqueue_length--;
+	return c;
+}
+
+int keyqueue_count(void)
+{
+	return keyqueue_length;
+}
+
+/* The text of pastes which haven't been read yet, in order; and the one
+ * belonging to the last KEY_PASTE handed to Lua. */
+
+struct paste
+{
+	char* text;
+	struct paste* next;
+};
+
+static struct paste* pastes = NULL;
+static char* currentpaste = NULL;
+
+void keyqueue_addpaste(char* text)
+{
+	struct paste* paste = malloc(sizeof(struct paste));
+	if (!paste)
+	{
+		free(text);
+		return;
+	}
+	paste->text = text;
+	LL_APPEND(pastes, paste);
+}
+
+static void nextpaste(void)
+{
+	free(currentpaste);
+	currentpaste = NULL;
+
+	struct paste* paste = pastes;
+	if (paste)
+	{
+		LL_DELETE(pastes, paste);
+		currentpaste = paste->text;
+		free(paste);
+	}
+}
+
 void screen_deinit(void)
 {
 	if (running)
@@ -30,14 +107,30 @@ static int initscreen_cb(lua_State* L)
 
 static int clearscreen_cb(lua_State* L)
 {
+	screen_drawcount++;
 	dpy_clearscreen();
 	return 0;
 }
 
+/* Syncs the display, and works out what the frame just drawn cost. */
+
+static void sync(void)
+{
+	dpy_sync();
+
+	framestats.frames = dpy_stats.frames - lastsync.frames;
+	framestats.writes = dpy_stats.writes - lastsync.writes;
+	framestats.cellschanged = dpy_stats.cellschanged - lastsync.cellschanged;
+	framestats.attrswitches = dpy_stats.attrswitches - lastsync.attrswitches;
+	framestats.requests = dpy_stats.requests - lastsync.requests;
+	framestats.redrawtime = dpy_stats.redrawtime - lastsync.redrawtime;
+	lastsync = dpy_stats;
+}
+
 static int sync_cb(lua_State* L)
 {
 	dpy_setcursor(cursorx, cursory);
-	dpy_sync();
+	sync();
 	return 0;
 }
 
@@ -83,23 +176,50 @@ static int setnormal_cb(lua_State* L)
 	return 0;
 }
 
-static int write_cb(lua_State* L)
+/* Printable characters are handed to the backend in runs, which it can
+ * draw in one go; control characters still go one at a time. */
+
+void screen_write(int x, int y, const char* s, size_t size)
 {
-	int x = luaL_checkint(L, 1);
-	int y = luaL_checkint(L, 2);
-	size_t size;
-	const char* s = luaL_checklstring(L, 3, &size);
 	const char* send = s + size;
+	screen_drawcount++;
+
+	uni_t run[256];
+	int runlen = 0;
+	int runx = x;
 
 	while (s < send)
 	{
 		wchar_t c = readu8(&s);
 
-		dpy_writechar(x, y, c);
-		if (!iswcntrl(c))
+		if (iswcntrl(c) || (runlen == (sizeof(run)/sizeof(*run))))
+		{
+			if (runlen > 0)
+				dpy_writerun(runx, y, run, runlen);
+			runlen = 0;
+			runx = x;
+		}
+
+		if (iswcntrl(c))
+			dpy_writechar(x, y, c);
+		else
+		{
+			run[runlen++] = c;
 			x += emu_wcwidth(c);
+		}
 	}
 
+	if (runlen > 0)
+		dpy_writerun(runx, y, run, runlen);
+}
+
+static int write_cb(lua_State* L)
+{
+	int x = luaL_checkint(L, 1);
+	int y = luaL_checkint(L, 2);
+	size_t size;
+	const char* s = luaL_checklstring(L, 3, &size);
+	screen_write(x, y, s, size);
 	return 0;
 }
 
@@ -109,10 +229,72 @@ static int cleararea_cb(lua_State* L)
 	int y1 = luaL_checkint(L, 2);
 	int x2 = luaL_checkint(L, 3);
 	int y2 = luaL_checkint(L, 4);
+	screen_drawcount++;
 	dpy_cleararea(x1, y1, x2, y2);
 	return 0;
 }
 
+/* Moves the contents of rows y1 to y2 up by delta rows (or down, if delta
+ * is negative); the rows scrolled in are blank. */
+
+static int scrollarea_cb(lua_State* L)
+{
+	int y1 = luaL_checkint(L, 1);
+	int y2 = luaL_checkint(L, 2);
+	int delta = luaL_checkint(L, 3);
+	screen_drawcount++;
+	dpy_scrollarea(y1, y2, delta);
+	return 0;
+}
+
+static int getdrawcount_cb(lua_State* L)
+{
+	lua_pushnumber(L, screen_drawcount);
+	return 1;
+}
+
+static void pushstats(lua_State* L, const struct dpy_stats* stats)
+{
+	lua_newtable(L);
+	lua_pushnumber(L, stats->frames);
+	lua_setfield(L, -2, "frames");
+	lua_pushnumber(L, stats->writes);
+	lua_setfield(L, -2, "writes");
+	lua_pushnumber(L, stats->attrswitches);
+	lua_setfield(L, -2, "attrswitches");
+	lua_pushnumber(L, stats->redrawtime);
+	lua_setfield(L, -2, "redrawtime");
+
+	/* Counters the backend doesn't keep are left nil. */
+
+	if (dpy_trackedstats & DPY_STATS_CELLSCHANGED)
+	{
+		lua_pushnumber(L, stats->cellschanged);
+		lua_setfield(L, -2, "cellschanged");
+	}
+	if (dpy_trackedstats & DPY_STATS_REQUESTS)
+	{
+		lua_pushnumber(L, stats->requests);
+		lua_setfield(L, -2, "requests");
+	}
+}
+
+/* Returns the rendering counters: the totals so far, and the figures for
+ * the last frame which was synced to the display. */
+
+static int renderstats_cb(lua_State* L)
+{
+	pushstats(L, &dpy_stats);
+	pushstats(L, &framestats);
+	return 2;
+}
+
+static int addredrawtime_cb(lua_State* L)
+{
+	dpy_stats.redrawtime += luaL_checknumber(L, 1);
+	return 0;
+}
+
 static int gotoxy_cb(lua_State* L)
 {
 	cursorx = luaL_checkint(L, 1);
@@ -129,10 +311,8 @@ static int getscreensize_cb(lua_State* L)
 	return 2;
 }
 
-static int getstringwidth_cb(lua_State* L)
+int screen_getstringwidth(const char* s, size_t size)
 {
-	size_t size;
-	const char* s = luaL_checklstring(L, 1, &size);
 	const char* send = s + size;
 
 	int width = 0;
@@ -143,7 +323,14 @@ static int getstringwidth_cb(lua_State* L)
 			width += emu_wcwidth(c);
 	}
 
-	lua_pushnumber(L, width);
+	return width;
+}
+
+static int getstringwidth_cb(lua_State* L)
+{
+	size_t size;
+	const char* s = luaL_checklstring(L, 1, &size);
+	lua_pushnumber(L, screen_getstringwidth(s, size));
 	return 1;
 }
 
@@ -182,39 +369,100 @@ static int getbytesofcharacter_cb(lua_State* L)
 	return 1;
 }
 
+/* Pushes the name of a key onto the Lua stack. Returns false if the key
+ * isn't one which Lua should see. */
+
+static bool pushkey(lua_State* L, uni_t c)
+{
+	if (c == KEYQUEUE_PASTE)
+	{
+		nextpaste();
+		lua_pushstring(L, "KEY_PASTE");
+		return true;
+	}
+
+	if (c <= 0)
+	{
+		const char* s = dpy_getkeyname(c);
+		if (s)
+		{
+			lua_pushstring(L, s);
+			return true;
+		}
+	}
+
+	if (emu_wcwidth(c) > 0)
+	{
+		char buffer[8];
+		char* p = buffer;
+
+		writeu8(&p, c);
+		*p = '\0';
+
+		lua_pushstring(L, buffer);
+		return true;
+	}
+
+	return false;
+}
+
 static int getchar_cb(lua_State* L)
 {
+	/* The timeout is in seconds, but may be fractional. */
+
 	int t = -1;
 	if (!lua_isnone(L, 1))
-		t = luaL_checkinteger(L, 1);
+	{
+		double s = luaL_checknumber(L, 1);
+		t = (s < 0) ? -1 : (int)(s * 1000.0);
+	}
 
 	dpy_setcursor(cursorx, cursory);
-	dpy_sync();
+	sync();
 
-	for (;;)
-	{
-		uni_t c = dpy_getchar(t);
-		if (c <= 0)
-		{
-			const char* s = dpy_getkeyname(c);
-			if (s)
-			{
-				lua_pushstring(L, s);
-				break;
-			}
-		}
+	while (!pushkey(L, dpy_getchar(t)))
+		;
 
-		if (emu_wcwidth(c) > 0)
-		{
-			static char buffer[8];
-			char* p = buffer;
+	return 1;
+}
+
+/* Returns the text of the paste which the last KEY_PASTE stood for. */
 
-			writeu8(&p, c);
-			*p = '\0';
+static int getpastedtext_cb(lua_State* L)
+{
+	if (!currentpaste)
+		return 0;
 
-			lua_pushstring(L, buffer);
+	lua_pushstring(L, currentpaste);
+	return 1;
+}
+
+static int haspendinginput_cb(lua_State* L)
+{
+	lua_pushboolean(L, dpy_haspendinginput());
+	return 1;
+}
+
+/* Returns a table of the keys which have already been typed, without
+ * waiting or redrawing. The batch stops after the first key which isn't an
+ * ordinary character, as that may open a dialogue which wants to read the
+ * keys following it itself. */
+
+static int getchars_cb(lua_State* L)
+{
+	int max = luaL_optinteger(L, 1, KEYQUEUE_SIZE);
+
+	lua_newtable(L);
+	int count = 0;
+	while ((count < max) && dpy_haspendinginput())
+	{
+		uni_t c = dpy_getchar(-1);
+		if (!pushkey(L, c))
+			continue;
+
+		lua_rawseti(L, -2, ++count);
+		if (c <= 0)
 			break;
-		}
 	}
 
 	return 1;
@@ -238,12 +486,19 @@ void screen_init(const char* argv[])
 		{ "setnormal",                 setnormal_cb },
 		{ "write",                     write_cb },
 		{ "cleararea",                 cleararea_cb },
+		{ "scrollarea",                scrollarea_cb },
+		{ "getdrawcount",              getdrawcount_cb },
+		{ "renderstats",               renderstats_cb },
+		{ "addredrawtime",             addredrawtime_cb },
 		{ "gotoxy",                    gotoxy_cb },
 		{ "getscreensize",             getscreensize_cb },
 		{ "getstringwidth",            getstringwidth_cb },
 		{ "getboundedstring",          getboundedstring_cb },
 		{ "getbytesofcharacter",       getbytesofcharacter_cb },
 		{ "getchar",                   getchar_cb },
+		{ "getchars",                  getchars_cb },
+		{ "haspendinginput",           haspendinginput_cb },
+		{ "getpastedtext",             getpastedtext_cb },
 		{ NULL,                        NULL }
 	};
 
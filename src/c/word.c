@@ -5,6 +5,7 @@
 
 #include "globals.h"
 #include <ctype.h>
+#include <string.h>
 
 /* A 'word' is a string with embedded text style codes.
  *
@@ -79,34 +80,46 @@ static int parseword_cb(lua_State* L)
 	return 0;
 }
 
-/* Draw a styled word at a particular location. */
+static void flushrun(const uni_t* run, int* runlen, int* runx, int x, int y)
+{
+	if (*runlen > 0)
+		dpy_writerun(*runx, y, run, *runlen);
+	*runlen = 0;
+	*runx = x;
+}
 
-static int writestyled_cb(lua_State* L)
+/* Draw a styled word at a particular location. Characters are handed to the
+ * display in runs of the same attribute. revon and revoff are the one-based
+ * offsets where reverse video starts and stops, or 0. Returns the attributes
+ * in effect at the end of the word. */
+
+int word_writestyled(int x, int y, const char* s, size_t size, int oattr,
+		int revon, int revoff, int sor)
 {
-	int x = luaL_checkint(L, 1);
-	int y = luaL_checkint(L, 2);
-	size_t size;
-	const char* s = luaL_checklstring(L, 3, &size);
 	const char* send = s + size;
-	int oattr = luaL_checkint(L, 4);
-	const char* revon = s + lua_tointeger(L, 5) - 1;
-	const char* revoff = s + lua_tointeger(L, 6) - 1;
-	int sor = lua_tointeger(L, 7);
+	const char* revonp = s + revon - 1;
+	const char* revoffp = s + revoff - 1;
 
 	int attr = sor;
 	int mark = 0;
+	uni_t run[256];
+	int runlen = 0;
+	int runx = x;
 
+	screen_drawcount++;
 	dpy_setattr(0, sor);
 	bool first = true;
 	while (s < send)
 	{
-		if (s == revon)
+		if (s == revonp)
 		{
+			flushrun(run, &runlen, &runx, x, y);
 			mark = DPY_REVERSE;
 			dpy_setattr(0, attr | mark);
 		}
-		if (s == revoff)
+		if (s == revoffp)
 		{
+			flushrun(run, &runlen, &runx, x, y);
 			mark = 0;
 			dpy_setattr(0, attr | mark);
 		}
@@ -115,6 +128,7 @@ static int writestyled_cb(lua_State* L)
 
 		if (iswcntrl(c))
 		{
+			flushrun(run, &runlen, &runx, x, y);
 			c &= STYLE_ALL;
 			attr = c | sor;
 			dpy_setattr(0, attr | mark);
@@ -125,14 +139,31 @@ static int writestyled_cb(lua_State* L)
 				&& ((attr | mark) == oattr))
 				dpy_writechar(x-1, y, 160); /* non-breaking space */
 
-			dpy_writechar(x, y, c);
+			if (runlen == (sizeof(run)/sizeof(*run)))
+				flushrun(run, &runlen, &runx, x, y);
+			run[runlen++] = c;
 			x += emu_wcwidth(c);
 			first = false;
 		}
 	}
+	flushrun(run, &runlen, &runx, x, y);
 	dpy_setattr(0, 0);
 
-	lua_pushnumber(L, attr | mark);
+	return attr | mark;
+}
+
+static int writestyled_cb(lua_State* L)
+{
+	int x = luaL_checkint(L, 1);
+	int y = luaL_checkint(L, 2);
+	size_t size;
+	const char* s = luaL_checklstring(L, 3, &size);
+	int oattr = luaL_checkint(L, 4);
+	int revon = lua_tointeger(L, 5);
+	int revoff = lua_tointeger(L, 6);
+	int sor = lua_tointeger(L, 7);
+
+	lua_pushnumber(L, word_writestyled(x, y, s, size, oattr, revon, revoff, sor));
 	return 1;
 }
 
@@ -443,6 +474,339 @@ static int createstylebyte_cb(lua_State* L)
 	lua_pushlstring(L, &buffer, 1);
 	return 1;
 }
+
+/* Export formats. An export format is compiled from a Lua template table
+ * containing the strings to emit when styles turn on and off, a table of
+ * escapes for individual bytes of text, and optionally a pattern such as
+ * "\\[u%04X]" used for every character above ASCII. Once compiled, a format
+ * can render the words of a whole paragraph in a single pass, with no Lua
+ * callbacks.
+ */
+
+#define EXPORTFORMAT_METATABLE "wg.exportformat"
+
+enum
+{
+	ITALIC_ON, ITALIC_OFF,
+	UNDERLINE_ON, UNDERLINE_OFF,
+	BOLD_ON, BOLD_OFF,
+	NUM_STYLESTRINGS
+};
+
+static const char* stylenames[NUM_STYLESTRINGS] =
+{
+	"italic_on", "italic_off",
+	"underline_on", "underline_off",
+	"bold_on", "bold_off"
+};
+
+struct fragment
+{
+	char* data;
+	size_t len;
+};
+
+typedef struct
+{
+	bool valid;
+	struct fragment styles[NUM_STYLESTRINGS];
+	struct fragment escapes[256];
+	bool unicode;
+	struct fragment uniprefix;
+	struct fragment unisuffix;
+} exportformat_t;
+
+/* The output of a render is built here; it's reused between calls. */
+
+static char* outbuffer = NULL;
+static size_t outlen;
+static size_t outsize = 0;
+
+static void emit(const char* s, size_t len)
+{
+	if ((outlen + len) > outsize)
+	{
+		size_t size = outsize ? outsize : 4096;
+		while ((outlen + len) > size)
+			size *= 2;
+		char* p = realloc(outbuffer, size);
+		if (!p)
+		{
+			luaL_error(L, "out of memory");
+			return;
+		}
+		outbuffer = p;
+		outsize = size;
+	}
+
+	memcpy(outbuffer + outlen, s, len);
+	outlen += len;
+}
+
+static void emitfragment(const struct fragment* f)
+{
+	emit(f->data, f->len);
+}
+
+static void emitescaped(exportformat_t* ef, const char* s, size_t len)
+{
+	const char* send = s + len;
+	while (s < send)
+	{
+		unsigned char c = *s;
+		if (ef->unicode && (c >= 127))
+		{
+			if ((s + getu8bytes(c)) > send)
+				break;
+			uni_t u = readu8(&s);
+
+			char hex[16];
+			int hexlen = snprintf(hex, sizeof(hex), "%04X", u);
+			emitfragment(&ef->uniprefix);
+			emit(hex, hexlen);
+			emitfragment(&ef->unisuffix);
+			continue;
+		}
+
+		const struct fragment* f = &ef->escapes[c];
+		if (f->data)
+			emitfragment(f);
+		else
+			emit(s, 1);
+		s++;
+	}
+}
+
+static void setfragment(struct fragment* f, const char* s, size_t len)
+{
+	free(f->data);
+	f->data = malloc(len ? len : 1);
+	memcpy(f->data, s, len);
+	f->len = len;
+}
+
+static exportformat_t* checkexportformat(lua_State* L, int index)
+{
+	exportformat_t* ef = luaL_checkudata(L, index, EXPORTFORMAT_METATABLE);
+	if (!ef->valid)
+		luaL_error(L, "attempt to use a freed export format");
+	return ef;
+}
+
+static int createexportformat_cb(lua_State* L)
+{
+	luaL_checktype(L, 1, LUA_TTABLE);
+
+	exportformat_t* ef = lua_newuserdata(L, sizeof(exportformat_t));
+	memset(ef, 0, sizeof(*ef));
+	ef->valid = true;
+	luaL_getmetatable(L, EXPORTFORMAT_METATABLE);
+	lua_setmetatable(L, -2);
+
+	for (int i = 0; i < NUM_STYLESTRINGS; i++)
+	{
+		size_t len;
+		lua_getfield(L, 1, stylenames[i]);
+		const char* s = lua_tolstring(L, -1, &len);
+		if (!s)
+		{
+			s = "";
+			len = 0;
+		}
+		setfragment(&ef->styles[i], s, len);
+		lua_pop(L, 1);
+	}
+
+	lua_getfield(L, 1, "escapes");
+	if (lua_istable(L, -1))
+	{
+		lua_pushnil(L);
+		while (lua_next(L, -2))
+		{
+			size_t klen, vlen;
+			const char* k = lua_tolstring(L, -2, &klen);
+			const char* v = lua_tolstring(L, -1, &vlen);
+			if (!k || (klen != 1) || !v || (lua_type(L, -2) != LUA_TSTRING))
+				return luaL_error(L, "escapes must map single bytes to strings");
+
+			setfragment(&ef->escapes[(unsigned char)*k], v, vlen);
+			lua_pop(L, 1);
+		}
+	}
+	lua_pop(L, 1);
+
+	lua_getfield(L, 1, "unicode");
+	if (!lua_isnil(L, -1))
+	{
+		const char* s = luaL_checkstring(L, -1);
+		const char* p = strstr(s, "%04X");
+		if (!p)
+			return luaL_error(L, "the unicode pattern must contain %%04X");
+
+		ef->unicode = true;
+		setfragment(&ef->uniprefix, s, p - s);
+		setfragment(&ef->unisuffix, p + 4, strlen(p + 4));
+	}
+	lua_pop(L, 1);
+
+	return 1;
+}
+
+/* format:escape(s) returns s with the format's escapes applied. */
+
+static int exportformat_escape_cb(lua_State* L)
+{
+	exportformat_t* ef = checkexportformat(L, 1);
+	size_t len;
+	const char* s = luaL_checklstring(L, 2, &len);
+
+	outlen = 0;
+	emitescaped(ef, s, len);
+	lua_pushlstring(L, outbuffer, outlen);
+	return 1;
+}
+
+struct renderstate
+{
+	exportformat_t* ef;
+	bool raw;
+	bool wordbreak;
+	bool italic, underline, bold;
+	bool olditalic, oldunderline, oldbold;
+};
+
+static void emittext(struct renderstate* rs, const char* s, size_t len)
+{
+	if (rs->raw)
+		emit(s, len);
+	else
+		emitescaped(rs->ef, s, len);
+}
+
+/* Emits a single run of identically-styled text, turning styles off and on
+ * as required around it and inserting a word break if one is pending. */
+
+static void emitrun(struct renderstate* rs, int style, const char* s, size_t len)
+{
+	struct fragment* styles = rs->ef->styles;
+
+	rs->italic = style & DPY_ITALIC;
+	rs->underline = style & DPY_UNDERLINE;
+	rs->bold = style & DPY_BOLD;
+
+	if (!rs->italic && rs->olditalic)
+		emitfragment(&styles[ITALIC_OFF]);
+	if (!rs->underline && rs->oldunderline)
+		emitfragment(&styles[UNDERLINE_OFF]);
+	if (!rs->bold && rs->oldbold)
+		emitfragment(&styles[BOLD_OFF]);
+
+	if (rs->wordbreak)
+	{
+		emittext(rs, " ", 1);
+		rs->wordbreak = false;
+	}
+
+	if (rs->bold && !rs->oldbold)
+		emitfragment(&styles[BOLD_ON]);
+	if (rs->underline && !rs->oldunderline)
+		emitfragment(&styles[UNDERLINE_ON]);
+	if (rs->italic && !rs->olditalic)
+		emitfragment(&styles[ITALIC_ON]);
+
+	emittext(rs, s, len);
+
+	rs->olditalic = rs->italic;
+	rs->oldunderline = rs->underline;
+	rs->oldbold = rs->bold;
+}
+
+/* format:renderwords(paragraph, raw) renders all the words of a paragraph,
+ * separated by (escaped) spaces, and returns the result as a string. If raw
+ * is true the text is not escaped. */
+
+static int exportformat_renderwords_cb(lua_State* L)
+{
+	struct renderstate rs = {0};
+	rs.ef = checkexportformat(L, 1);
+	luaL_checkany(L, 2);
+	rs.raw = lua_toboolean(L, 3);
+
+	outlen = 0;
+	int words = luaL_len(L, 2);
+	for (int wn = 1; wn <= words; wn++)
+	{
+		/* The word stays referenced by the paragraph, so it's safe to use
+		 * after popping it. */
+
+		size_t size;
+		lua_pushnumber(L, wn);
+		lua_gettable(L, 2);
+		const char* s = lua_tolstring(L, -1, &size);
+		lua_pop(L, 1);
+		if (!s)
+			return luaL_error(L, "paragraph contains a non-string word");
+		const char* send = s + size;
+
+		rs.wordbreak = (wn != 1);
+		rs.italic = rs.underline = rs.bold = false;
+		bool emptyword = true;
+
+		/* This is the same parse as parseword_cb(). */
+
+		int attr = 0;
+		const char* w = s;
+		while (s < send)
+		{
+			const char* cs = s;
+			wchar_t c = readu8(&s);
+			if (iswcntrl(c))
+			{
+				if (cs != w)
+				{
+					emitrun(&rs, attr, w, cs - w);
+					emptyword = false;
+				}
+				attr = c & STYLE_ALL;
+				w = s;
+			}
+		}
+		if (w != send)
+		{
+			emitrun(&rs, attr, w, send - w);
+			emptyword = false;
+		}
+
+		if (emptyword)
+			emitrun(&rs, 0, "", 0);
+	}
+
+	if (rs.italic)
+		emitfragment(&rs.ef->styles[ITALIC_OFF]);
+	if (rs.underline)
+		emitfragment(&rs.ef->styles[UNDERLINE_OFF]);
+	if (rs.bold)
+		emitfragment(&rs.ef->styles[BOLD_OFF]);
+
+	lua_pushlstring(L, outbuffer, outlen);
+	return 1;
+}
+
+static int exportformat_gc_cb(lua_State* L)
+{
+	exportformat_t* ef = luaL_checkudata(L, 1, EXPORTFORMAT_METATABLE);
+	if (ef->valid)
+	{
+		for (int i = 0; i < NUM_STYLESTRINGS; i++)
+			free(ef->styles[i].data);
+		for (int i = 0; i < 256; i++)
+			free(ef->escapes[i].data);
+		free(ef->uniprefix.data);
+		free(ef->unisuffix.data);
+		ef->valid = false;
+	}
+	return 0;
+}
 	
 void word_init(void)
 {
@@ -458,9 +822,25 @@ void word_init(void)
 		{ "applystyletoword",          applystyletoword_cb },
 		{ "getstylefromword",          getstylefromword_cb },
 		{ "createstylebyte",           createstylebyte_cb },
+		{ "createexportformat",        createexportformat_cb },
+		{ NULL,                        NULL }
+	};
+
+	const static luaL_Reg formatmethods[] =
+	{
+		{ "escape",                    exportformat_escape_cb },
+		{ "renderwords",               exportformat_renderwords_cb },
 		{ NULL,                        NULL }
 	};
 
+	luaL_newmetatable(L, EXPORTFORMAT_METATABLE);
+	lua_newtable(L);
+	luaL_setfuncs(L, formatmethods, 0);
+	lua_setfield(L, -2, "__index");
+	lua_pushcfunction(L, exportformat_gc_cb);
+	lua_setfield(L, -2, "__gc");
+	lua_pop(L, 1);
+
 	lua_getglobal(L, "wg");
 	luaL_setfuncs(L, funcs, 0);
 
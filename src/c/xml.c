@@ -0,0 +1,941 @@
+/* © 2015 David Given.
+ * WordGrinder is licensed under the MIT open source license. See the COPYING
+ * file in this distribution for the full text.
+ */
+
+#include "globals.h"
+#include <string.h>
+
+/* --- XML tokeniser ----------------------------------------------------- */
+
+/* A streaming XML tokeniser. wg.tokenisexml(xml) returns an iterator which
+ * produces one event per call:
+ *
+ *   "opentag", namespace, name, attrs
+ *   "closetag", namespace, name
+ *   "text", text
+ *   "cdata", text
+ *   "processing", name, attrs
+ *   "error", context
+ *
+ * attrs is a table mapping "namespace name" (or just "name", for attributes
+ * with no namespace) to the decoded value. Namespaces are resolved to URIs;
+ * an undeclared prefix resolves to itself. Entities are decoded. Comments and
+ * DOCTYPE declarations are skipped.
+ *
+ * Whitespace in text is collapsed to single spaces, and whitespace which is
+ * adjacent to markup and contains a newline is removed entirely, as is text
+ * consisting only of whitespace. This means that indentation in the source
+ * disappears but significant spaces inside paragraphs survive.
+ */
+
+#define XMLSTATE_METATABLE "wg.xmlstate"
+
+struct binding
+{
+	size_t prefix, prefixlen;     /* offsets into the source */
+	size_t uri, urilen;
+};
+
+struct attribute
+{
+	const char* prefix;
+	size_t prefixlen;
+	const char* name;
+	size_t namelen;
+	const char* value;
+	const char* valueend;
+};
+
+typedef struct
+{
+	size_t offset;
+	bool finished;
+	bool pendingclose;            /* last opentag was self-closing */
+
+	struct binding* bindings;
+	int numbindings;
+	int maxbindings;
+
+	int* scopes;                  /* numbindings at each open element */
+	int depth;
+	int maxdepth;
+
+	struct attribute* attrs;      /* the tag currently being parsed */
+	int maxattrs;
+} xmlstate_t;
+
+static const char* xml;
+static const char* xmlend;
+
+static bool isxmlspace(char c)
+{
+	return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
+
+static bool isnamechar(char c)
+{
+	return ((c >= 'a') && (c <= 'z')) ||
+	       ((c >= 'A') && (c <= 'Z')) ||
+	       ((c >= '0') && (c <= '9')) ||
+	       (c == '_') || (c == '-') || (c == '.') ||
+	       ((unsigned char)c >= 0x80);
+}
+
+static const char* skipspace(const char* p)
+{
+	while ((p < xmlend) && isxmlspace(*p))
+		p++;
+	return p;
+}
+
+static const char* findstring(const char* p, const char* s)
+{
+	size_t len = strlen(s);
+	while ((p + len) <= xmlend)
+	{
+		if (memcmp(p, s, len) == 0)
+			return p;
+		p++;
+	}
+	return NULL;
+}
+
+/* Parses a possibly-prefixed name. On exit prefix is NULL if there was no
+ * prefix. Returns NULL if there was no name. */
+
+static const char* parsename(const char* p,
+		const char** prefix, size_t* prefixlen,
+		const char** name, size_t* namelen)
+{
+	const char* s = p;
+	while ((p < xmlend) && isnamechar(*p))
+		p++;
+	if (p == s)
+		return NULL;
+
+	if ((p < xmlend) && (*p == ':'))
+	{
+		*prefix = s;
+		*prefixlen = p - s;
+		p++;
+		s = p;
+		while ((p < xmlend) && isnamechar(*p))
+			p++;
+	}
+	else
+	{
+		*prefix = NULL;
+		*prefixlen = 0;
+	}
+
+	*name = s;
+	*namelen = p - s;
+	return p;
+}
+
+/* Decodes an entity starting at p (which points at the &) and adds it to the
+ * buffer. Returns the new position. Named entities are looked up in the
+ * table at stack index entities, keyed by "&name;", or in the built-in XML
+ * list if entities is 0. Unrecognised entities are copied verbatim. */
+
+static const char* decodeentity(lua_State* L, const char* p, luaL_Buffer* b,
+		int entities)
+{
+	static const struct
+	{
+		const char* name;
+		char value;
+	}
+	xmlentities[] =
+	{
+		{ "amp",  '&' },
+		{ "lt",   '<' },
+		{ "gt",   '>' },
+		{ "quot", '"' },
+		{ "apos", '\'' },
+		{ NULL,   0 }
+	};
+
+	const char* s = p + 1;
+	const char* e = s;
+	while ((e < xmlend) && (*e != ';') && (*e != '<') && (*e != '&')
+			&& !isxmlspace(*e) && ((e - s) < 32))
+		e++;
+	if ((e == xmlend) || (*e != ';'))
+	{
+		luaL_addchar(b, '&');
+		return p + 1;
+	}
+
+	size_t len = e - s;
+	if ((len > 1) && (*s == '#'))
+	{
+		char* endp;
+		char number[16];
+		if (len > (sizeof(number)-1))
+			goto verbatim;
+		memcpy(number, s+1, len-1);
+		number[len-1] = '\0';
+
+		long c;
+		if ((number[0] == 'x') || (number[0] == 'X'))
+			c = strtol(number+1, &endp, 16);
+		else
+			c = strtol(number, &endp, 10);
+		if ((*endp != '\0') || (endp == number) || (c <= 0) || (c > 0x10ffff))
+			goto verbatim;
+
+		char buffer[8];
+		char* bp = buffer;
+		writeu8(&bp, c);
+		luaL_addlstring(b, buffer, bp - buffer);
+		return e + 1;
+	}
+
+	if (entities)
+	{
+		lua_pushlstring(L, p, e + 1 - p);
+		lua_rawget(L, entities);
+		if (lua_isstring(L, -1))
+		{
+			luaL_addvalue(b);
+			return e + 1;
+		}
+		lua_pop(L, 1);
+	}
+	else
+	{
+		for (int i = 0; xmlentities[i].name; i++)
+		{
+			if ((strlen(xmlentities[i].name) == len) &&
+					(memcmp(xmlentities[i].name, s, len) == 0))
+			{
+				luaL_addchar(b, xmlentities[i].value);
+				return e + 1;
+			}
+		}
+	}
+
+verbatim:
+	luaL_addlstring(b, p, e + 1 - p);
+	return e + 1;
+}
+
+/* Pushes the text between p and pend, applying the whitespace rules and
+ * decoding entities. Returns false if nothing survived. */
+
+static bool pushtext(lua_State* L, const char* p, const char* pend)
+{
+	luaL_Buffer b;
+	luaL_buffinit(L, &b);
+
+	bool empty = true;
+	bool inspace = false;
+	bool newline = false;
+
+	while (p < pend)
+	{
+		char c = *p;
+		if (c == '\r')
+		{
+			p++;
+			continue;
+		}
+
+		if (isxmlspace(c))
+		{
+			inspace = true;
+			if (c == '\n')
+				newline = true;
+			p++;
+			continue;
+		}
+
+		if (inspace)
+		{
+			if (!empty || !newline)
+				luaL_addchar(&b, ' ');
+			inspace = newline = false;
+		}
+
+		if (c == '&')
+			p = decodeentity(L, p, &b, 0);
+		else
+			luaL_addchar(&b, *p++);
+		empty = false;
+	}
+
+	if (empty)
+	{
+		luaL_pushresult(&b);
+		lua_pop(L, 1);
+		return false;
+	}
+
+	if (inspace && !newline)
+		luaL_addchar(&b, ' ');
+	luaL_pushresult(&b);
+	return true;
+}
+
+/* Pushes an attribute value, collapsing whitespace and decoding entities. */
+
+static void pushvalue(lua_State* L, const char* p, const char* pend)
+{
+	luaL_Buffer b;
+	luaL_buffinit(L, &b);
+
+	while (p < pend)
+	{
+		char c = *p;
+		if (isxmlspace(c))
+		{
+			while ((p < pend) && isxmlspace(*p))
+				p++;
+			luaL_addchar(&b, ' ');
+		}
+		else if (c == '&')
+			p = decodeentity(L, p, &b, 0);
+		else
+			luaL_addchar(&b, *p++);
+	}
+
+	luaL_pushresult(&b);
+}
+
+static void addbinding(xmlstate_t* state,
+		const char* prefix, size_t prefixlen,
+		const char* uri, size_t urilen)
+{
+	if (state->numbindings == state->maxbindings)
+	{
+		state->maxbindings = state->maxbindings*2 + 8;
+		state->bindings = realloc(state->bindings,
+			state->maxbindings * sizeof(*state->bindings));
+	}
+
+	struct binding* bb = &state->bindings[state->numbindings++];
+	bb->prefix = prefix ? (prefix - xml) : 0;
+	bb->prefixlen = prefixlen;
+	bb->uri = uri - xml;
+	bb->urilen = urilen;
+}
+
+/* Pushes the namespace URI for a prefix. A NULL prefix means the default
+ * namespace. */
+
+static void pushnamespace(lua_State* L, xmlstate_t* state,
+		const char* prefix, size_t prefixlen)
+{
+	for (int i = state->numbindings-1; i >= 0; i--)
+	{
+		struct binding* bb = &state->bindings[i];
+		if ((bb->prefixlen == prefixlen) &&
+				(!prefix || (memcmp(xml + bb->prefix, prefix, prefixlen) == 0)))
+		{
+			lua_pushlstring(L, xml + bb->uri, bb->urilen);
+			return;
+		}
+	}
+
+	if (prefix)
+		lua_pushlstring(L, prefix, prefixlen);
+	else
+		lua_pushliteral(L, "");
+}
+
+/* Parses the attributes of a tag, up to (but not including) the closing
+ * > or /> or ?>. Namespace declarations are bound; the remaining attributes
+ * are pushed as a table. Returns NULL on a syntax error. */
+
+static const char* parseattributes(lua_State* L, xmlstate_t* state,
+		const char* p, bool bind)
+{
+	int numattrs = 0;
+
+	for (;;)
+	{
+		p = skipspace(p);
+		if ((p == xmlend) || (*p == '>') || (*p == '/') || (*p == '?'))
+			break;
+
+		struct attribute a;
+		p = parsename(p, &a.prefix, &a.prefixlen, &a.name, &a.namelen);
+		if (!p)
+			return NULL;
+
+		p = skipspace(p);
+		if ((p == xmlend) || (*p != '='))
+			return NULL;
+		p = skipspace(p+1);
+		if ((p == xmlend) || ((*p != '"') && (*p != '\'')))
+			return NULL;
+
+		char quote = *p++;
+		a.value = p;
+		while ((p < xmlend) && (*p != quote))
+			p++;
+		if (p == xmlend)
+			return NULL;
+		a.valueend = p++;
+
+		if (bind && a.prefix && (a.prefixlen == 5) &&
+				(memcmp(a.prefix, "xmlns", 5) == 0))
+			addbinding(state, a.name, a.namelen, a.value, a.valueend - a.value);
+		else if (bind && !a.prefix && (a.namelen == 5) &&
+				(memcmp(a.name, "xmlns", 5) == 0))
+			addbinding(state, NULL, 0, a.value, a.valueend - a.value);
+		else
+		{
+			if (numattrs == state->maxattrs)
+			{
+				state->maxattrs = state->maxattrs*2 + 16;
+				state->attrs = realloc(state->attrs,
+					state->maxattrs * sizeof(*state->attrs));
+			}
+			state->attrs[numattrs++] = a;
+		}
+	}
+
+	/* Now that all the namespace declarations on this tag are known, the
+	 * attributes themselves can be resolved. */
+
+	lua_createtable(L, 0, numattrs);
+	for (int i = 0; i < numattrs; i++)
+	{
+		struct attribute* a = &state->attrs[i];
+		if (a->prefix)
+		{
+			pushnamespace(L, state, a->prefix, a->prefixlen);
+			lua_pushliteral(L, " ");
+			lua_pushlstring(L, a->name, a->namelen);
+			lua_concat(L, 3);
+		}
+		else
+			lua_pushlstring(L, a->name, a->namelen);
+
+		pushvalue(L, a->value, a->valueend);
+		lua_settable(L, -3);
+	}
+
+	return p;
+}
+
+static int pusherror(lua_State* L, xmlstate_t* state, const char* p)
+{
+	size_t len = xmlend - p;
+	if (len > 100)
+		len = 100;
+
+	state->finished = true;
+	lua_pushliteral(L, "error");
+	lua_pushlstring(L, p, len);
+	return 2;
+}
+
+static int nexttoken_cb(lua_State* L)
+{
+	size_t len;
+	xml = lua_tolstring(L, lua_upvalueindex(1), &len);
+	xmlend = xml + len;
+	xmlstate_t* state = lua_touserdata(L, lua_upvalueindex(2));
+
+	if (state->pendingclose)
+	{
+		/* The namespace and name of the self-closing tag were stashed in
+		 * upvalues 3 and 4 when the opentag was returned. */
+
+		state->pendingclose = false;
+		state->depth--;
+		state->numbindings = state->scopes[state->depth];
+
+		lua_pushliteral(L, "closetag");
+		lua_pushvalue(L, lua_upvalueindex(3));
+		lua_pushvalue(L, lua_upvalueindex(4));
+		return 3;
+	}
+
+	for (;;)
+	{
+		if (state->finished)
+			return 0;
+
+		const char* p = xml + state->offset;
+		if (p == xmlend)
+		{
+			state->finished = true;
+			return 0;
+		}
+
+		if (*p != '<')
+		{
+			const char* s = p;
+			while ((p < xmlend) && (*p != '<'))
+				p++;
+			state->offset = p - xml;
+
+			if (pushtext(L, s, p))
+			{
+				lua_pushliteral(L, "text");
+				lua_insert(L, -2);
+				return 2;
+			}
+			continue;
+		}
+
+		if ((p+4 <= xmlend) && (memcmp(p, "<!--", 4) == 0))
+		{
+			const char* e = findstring(p+4, "-->");
+			if (!e)
+				return pusherror(L, state, p);
+			state->offset = e + 3 - xml;
+			continue;
+		}
+
+		if ((p+9 <= xmlend) && (memcmp(p, "<![CDATA[", 9) == 0))
+		{
+			const char* e = findstring(p+9, "]]>");
+			if (!e)
+				return pusherror(L, state, p);
+			state->offset = e + 3 - xml;
+
+			lua_pushliteral(L, "cdata");
+			lua_pushlstring(L, p+9, e - (p+9));
+			return 2;
+		}
+
+		if ((p+2 <= xmlend) && (p[1] == '!'))
+		{
+			/* DOCTYPE or similar; skip, allowing for an internal subset. */
+
+			int brackets = 0;
+			const char* e = p+2;
+			while ((e < xmlend) && ((*e != '>') || brackets))
+			{
+				if (*e == '[')
+					brackets++;
+				else if (*e == ']')
+					brackets--;
+				e++;
+			}
+			if (e == xmlend)
+				return pusherror(L, state, p);
+			state->offset = e + 1 - xml;
+			continue;
+		}
+
+		if ((p+2 <= xmlend) && (p[1] == '?'))
+		{
+			const char* prefix;
+			size_t prefixlen;
+			const char* name;
+			size_t namelen;
+			const char* e = parsename(p+2, &prefix, &prefixlen, &name, &namelen);
+			if (!e)
+				return pusherror(L, state, p);
+
+			lua_pushliteral(L, "processing");
+			if (prefix)
+				lua_pushlstring(L, prefix, e - prefix);
+			else
+				lua_pushlstring(L, name, namelen);
+			e = parseattributes(L, state, e, false);
+			if (!e || ((e+2) > xmlend) || (memcmp(e, "?>", 2) != 0))
+			{
+				lua_pop(L, 2 + (e ? 1 : 0));
+				return pusherror(L, state, p);
+			}
+
+			state->offset = e + 2 - xml;
+			return 3;
+		}
+
+		if ((p+2 <= xmlend) && (p[1] == '/'))
+		{
+			const char* prefix;
+			size_t prefixlen;
+			const char* name;
+			size_t namelen;
+			const char* e = parsename(skipspace(p+2),
+				&prefix, &prefixlen, &name, &namelen);
+			if (e)
+				e = skipspace(e);
+			if (!e || (e == xmlend) || (*e != '>'))
+				return pusherror(L, state, p);
+			state->offset = e + 1 - xml;
+
+			lua_pushliteral(L, "closetag");
+			pushnamespace(L, state, prefix, prefixlen);
+			lua_pushlstring(L, name, namelen);
+
+			if (state->depth > 0)
+			{
+				state->depth--;
+				state->numbindings = state->scopes[state->depth];
+			}
+			return 3;
+		}
+
+		{
+			const char* prefix;
+			size_t prefixlen;
+			const char* name;
+			size_t namelen;
+			const char* e = parsename(skipspace(p+1),
+				&prefix, &prefixlen, &name, &namelen);
+			if (!e)
+				return pusherror(L, state, p);
+
+			/* Open a new namespace scope. */
+
+			if (state->depth == state->maxdepth)
+			{
+				state->maxdepth = state->maxdepth*2 + 16;
+				state->scopes = realloc(state->scopes,
+					state->maxdepth * sizeof(*state->scopes));
+			}
+			state->scopes[state->depth++] = state->numbindings;
+
+			e = parseattributes(L, state, e, true);
+			if (!e || (e == xmlend))
+			{
+				if (e)
+					lua_pop(L, 1);
+				return pusherror(L, state, p);
+			}
+
+			bool selfclosing = false;
+			if (*e == '/')
+			{
+				selfclosing = true;
+				e++;
+			}
+			if ((e == xmlend) || (*e != '>'))
+			{
+				lua_pop(L, 1);
+				return pusherror(L, state, p);
+			}
+			state->offset = e + 1 - xml;
+
+			lua_pushliteral(L, "opentag");
+			pushnamespace(L, state, prefix, prefixlen);
+			lua_pushlstring(L, name, namelen);
+			lua_pushvalue(L, -4);
+			lua_remove(L, -5);
+
+			if (selfclosing)
+			{
+				state->pendingclose = true;
+				lua_pushvalue(L, -3);
+				lua_replace(L, lua_upvalueindex(3));
+				lua_pushvalue(L, -2);
+				lua_replace(L, lua_upvalueindex(4));
+			}
+			return 4;
+		}
+	}
+}
+
+static int xmlstate_gc(lua_State* L)
+{
+	xmlstate_t* state = luaL_checkudata(L, 1, XMLSTATE_METATABLE);
+	free(state->bindings);
+	free(state->scopes);
+	free(state->attrs);
+	state->bindings = NULL;
+	state->scopes = NULL;
+	state->attrs = NULL;
+	return 0;
+}
+
+static int tokenisexml_cb(lua_State* L)
+{
+	luaL_checkstring(L, 1);
+	lua_settop(L, 1);
+
+	xmlstate_t* state = lua_newuserdata(L, sizeof(xmlstate_t));
+	memset(state, 0, sizeof(*state));
+	luaL_getmetatable(L, XMLSTATE_METATABLE);
+	lua_setmetatable(L, -2);
+
+	lua_pushnil(L);
+	lua_pushnil(L);
+	lua_pushcclosure(L, nexttoken_cb, 4);
+	return 1;
+}
+
+/* --- HTML tokeniser ---------------------------------------------------- */
+
+/* wg.tokenisehtml(html, entities) returns an iterator producing:
+ *
+ *   "text", text
+ *   "space", count
+ *   "newline"
+ *   "opentag", name, selfclosing
+ *   "closetag", name
+ *
+ * Tag names are lowercased and attributes are discarded. Entities are
+ * decoded using the entities table, which maps "&name;" to a string.
+ * Rather than erroring, malformed markup is recovered from in the way
+ * browsers do: a < which doesn't start a tag is text, unterminated tags are
+ * text, comments and <!...> / <?...?> constructs are skipped, the contents
+ * of script and style elements are skipped, and control characters are
+ * dropped.
+ */
+
+typedef struct
+{
+	size_t offset;
+	const char* rawtext;          /* element whose contents are being skipped */
+} htmlstate_t;
+
+static bool isalphachar(char c)
+{
+	return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'));
+}
+
+static bool ishtmlspace(char c)
+{
+	return (c == ' ') || (c == '\t') || (c == '\f');
+}
+
+/* Pushes a lowercased tag name starting at p, and returns the end of it. */
+
+static const char* pushtagname(lua_State* L, const char* p)
+{
+	char buffer[32];
+	int len = 0;
+
+	while ((p < xmlend) && !isxmlspace(*p) && !ishtmlspace(*p)
+			&& (*p != '/') && (*p != '>'))
+	{
+		char c = *p++;
+		if ((c >= 'A') && (c <= 'Z'))
+			c += 'a' - 'A';
+		if (len < (int)sizeof(buffer))
+			buffer[len++] = c;
+	}
+
+	lua_pushlstring(L, buffer, len);
+	return p;
+}
+
+/* Finds the > which closes a tag, skipping over quoted attribute values.
+ * Returns NULL if there isn't one. */
+
+static const char* findtagend(const char* p, bool* selfclosing)
+{
+	char quote = 0;
+	char last = 0;
+
+	while (p < xmlend)
+	{
+		char c = *p;
+		if (quote)
+		{
+			if (c == quote)
+				quote = 0;
+		}
+		else if (((c == '"') || (c == '\'')) && (last == '='))
+			quote = c;
+		else if (c == '>')
+		{
+			*selfclosing = (last == '/');
+			return p;
+		}
+
+		if (!isxmlspace(c) && !ishtmlspace(c))
+			last = c;
+		p++;
+	}
+	return NULL;
+}
+
+static const char* findrawtextend(const char* p, const char* name)
+{
+	size_t len = strlen(name);
+	while ((p + len + 2) <= xmlend)
+	{
+		if ((p[0] == '<') && (p[1] == '/'))
+		{
+			size_t i = 0;
+			while ((i < len) && ((p[2+i] | 0x20) == name[i]))
+				i++;
+			if (i == len)
+				return p;
+		}
+		p++;
+	}
+	return xmlend;
+}
+
+static int nexthtmltoken_cb(lua_State* L)
+{
+	size_t len;
+	xml = lua_tolstring(L, lua_upvalueindex(1), &len);
+	xmlend = xml + len;
+	int entities = lua_upvalueindex(2);
+	htmlstate_t* state = lua_touserdata(L, lua_upvalueindex(3));
+
+	const char* p = xml + state->offset;
+	if (state->rawtext)
+	{
+		p = findrawtextend(p, state->rawtext);
+		state->rawtext = NULL;
+	}
+
+	for (;;)
+	{
+		if (p >= xmlend)
+		{
+			state->offset = len;
+			return 0;
+		}
+
+		char c = *p;
+		if (ishtmlspace(c))
+		{
+			const char* s = p;
+			while ((p < xmlend) && ishtmlspace(*p))
+				p++;
+			state->offset = p - xml;
+			lua_pushliteral(L, "space");
+			lua_pushnumber(L, p - s);
+			return 2;
+		}
+
+		if (c == '\n')
+		{
+			state->offset = p + 1 - xml;
+			lua_pushliteral(L, "newline");
+			return 1;
+		}
+
+		if ((c == '<') && ((p+1) < xmlend))
+		{
+			char c1 = p[1];
+			bool selfclosing = false;
+
+			if (isalphachar(c1))
+			{
+				const char* e = findtagend(p+1, &selfclosing);
+				if (e)
+				{
+					lua_pushliteral(L, "opentag");
+					pushtagname(L, p+1);
+					lua_pushboolean(L, selfclosing);
+					state->offset = e + 1 - xml;
+
+					if (!selfclosing)
+					{
+						const char* name = lua_tostring(L, -2);
+						if (strcmp(name, "script") == 0)
+							state->rawtext = "script";
+						else if (strcmp(name, "style") == 0)
+							state->rawtext = "style";
+					}
+					return 3;
+				}
+			}
+			else if ((c1 == '/') && ((p+2) < xmlend) && isalphachar(p[2]))
+			{
+				const char* e = findtagend(p+2, &selfclosing);
+				if (e)
+				{
+					lua_pushliteral(L, "closetag");
+					pushtagname(L, p+2);
+					state->offset = e + 1 - xml;
+					return 2;
+				}
+			}
+			else if (((p+4) <= xmlend) && (memcmp(p, "<!--", 4) == 0))
+			{
+				const char* e = findstring(p+4, "-->");
+				p = e ? (e + 3) : xmlend;
+				continue;
+			}
+			else if ((c1 == '!') || (c1 == '?') || (c1 == '/'))
+			{
+				const char* e = memchr(p, '>', xmlend - p);
+				p = e ? (e + 1) : xmlend;
+				continue;
+			}
+		}
+
+		/* Anything else is text, up to the next whitespace or markup. A < at
+		 * the start of the run is literal, as it didn't start a tag. */
+
+		luaL_Buffer b;
+		luaL_buffinit(L, &b);
+		bool empty = true;
+
+		if (*p == '<')
+		{
+			luaL_addchar(&b, '<');
+			p++;
+			empty = false;
+		}
+
+		while (p < xmlend)
+		{
+			c = *p;
+			if (ishtmlspace(c) || (c == '\n') || (c == '<'))
+				break;
+			else if (c == '&')
+			{
+				p = decodeentity(L, p, &b, entities);
+				empty = false;
+			}
+			else if (((unsigned char)c < 32) || (c == 127))
+				p++;
+			else
+			{
+				luaL_addchar(&b, c);
+				p++;
+				empty = false;
+			}
+		}
+
+		luaL_pushresult(&b);
+		if (!empty)
+		{
+			state->offset = p - xml;
+			lua_pushliteral(L, "text");
+			lua_insert(L, -2);
+			return 2;
+		}
+		lua_pop(L, 1);
+	}
+}
+
+static int tokenisehtml_cb(lua_State* L)
+{
+	luaL_checkstring(L, 1);
+	luaL_checktype(L, 2, LUA_TTABLE);
+	lua_settop(L, 2);
+
+	htmlstate_t* state = lua_newuserdata(L, sizeof(htmlstate_t));
+	memset(state, 0, sizeof(*state));
+
+	lua_pushcclosure(L, nexthtmltoken_cb, 3);
+	return 1;
+}
+
+void xml_init(void)
+{
+	const static luaL_Reg funcs[] =
+	{
+		{ "tokenisexml",               tokenisexml_cb },
+		{ "tokenisehtml",              tokenisehtml_cb },
+		{ NULL,                        NULL }
+	};
+
+	luaL_newmetatable(L, XMLSTATE_METATABLE);
+	lua_pushcfunction(L, xmlstate_gc);
+	lua_setfield(L, -2, "__gc");
+	lua_pop(L, 1);
+
+	lua_getglobal(L, "wg");
+	luaL_setfuncs(L, funcs, 0);
+}
@@ -4,6 +4,7 @@
  */
 
 #include "globals.h"
+#include <string.h>
 #include <zlib.h>
 #include "unzip.h"
 #include "zip.h"
@@ -65,7 +66,7 @@ static int decompress_cb(lua_State* L)
 static int compress_cb(lua_State* L)
 {
 	size_t srcsize;
-	const char* srcbuffer = luaL_checklstring(L, 1, &srcsize);
+	const char* srcbuffer = buffer_checklstring(L, 1, &srcsize);
 
 	int outputchunks = 0;
 	uint8_t outputbuffer[64*1024];
@@ -106,6 +107,172 @@ static int compress_cb(lua_State* L)
 	return 1;
 }
 
+/* --- Archive reader ---------------------------------------------------- */
+
+/* A zip archive which stays open across multiple member reads, so that the
+ * central directory is only parsed once per archive rather than once per
+ * member. */
+
+#define ZIPREADER_METATABLE "wg.zipreader"
+#define ZIPWRITER_METATABLE "wg.zipwriter"
+
+typedef struct
+{
+	unzFile zf;
+} zipreader_t;
+
+/* Small writes to a streamed member are staged here and handed to deflate
+ * in large blocks. */
+
+#define STAGESIZE (64*1024)
+
+typedef struct
+{
+	zipFile zf;
+	bool inmember;                /* a streamed member is open */
+	bool failed;                  /* a write to the streamed member failed */
+	size_t staged;                /* bytes waiting in stage */
+	char stage[STAGESIZE];
+} zipwriter_t;
+
+static zipreader_t* checkreader(lua_State* L, int index)
+{
+	zipreader_t* zr = luaL_checkudata(L, index, ZIPREADER_METATABLE);
+	if (!zr->zf)
+		luaL_error(L, "attempt to use a closed zip archive");
+	return zr;
+}
+
+/* Positions the archive on the named member and opens it for reading. */
+
+static bool openmember(unzFile zf, const char* subname)
+{
+	if (unzLocateFile(zf, subname, 0) != UNZ_OK)
+		return false;
+	return (unzOpenCurrentFile(zf) == UNZ_OK);
+}
+
+/* Reads the currently open member in fixed-size chunks, pushing each one and
+ * calling the function at funcindex with it; or, if funcindex is 0,
+ * accumulating the chunks into a single string on the stack. Returns false
+ * on a decompression error. */
+
+static bool readmember(lua_State* L, unzFile zf, int funcindex)
+{
+	char buffer[64*1024];
+	luaL_Buffer b;
+
+	if (!funcindex)
+		luaL_buffinit(L, &b);
+
+	for (;;)
+	{
+		int i = unzReadCurrentFile(zf, buffer, sizeof(buffer));
+		if (i < 0)
+		{
+			unzCloseCurrentFile(zf);
+			return false;
+		}
+		if (i == 0)
+			break;
+
+		if (funcindex)
+		{
+			lua_pushvalue(L, funcindex);
+			lua_pushlstring(L, buffer, i);
+			lua_call(L, 1, 0);
+		}
+		else
+			luaL_addlstring(&b, buffer, i);
+	}
+
+	if (unzCloseCurrentFile(zf) != UNZ_OK)
+		return false;
+
+	if (!funcindex)
+		luaL_pushresult(&b);
+	return true;
+}
+
+static int openzip_cb(lua_State* L)
+{
+	const char* zipname = luaL_checkstring(L, 1);
+
+	unzFile zf = unzOpen(zipname);
+	if (!zf)
+		return 0;
+
+	zipreader_t* zr = lua_newuserdata(L, sizeof(zipreader_t));
+	zr->zf = zf;
+	luaL_getmetatable(L, ZIPREADER_METATABLE);
+	lua_setmetatable(L, -2);
+	return 1;
+}
+
+static int zipreader_list_cb(lua_State* L)
+{
+	zipreader_t* zr = checkreader(L, 1);
+	char name[1024];
+	int n = 1;
+
+	lua_newtable(L);
+	int i = unzGoToFirstFile(zr->zf);
+	while (i == UNZ_OK)
+	{
+		unz_file_info fi;
+		if (unzGetCurrentFileInfo(zr->zf, &fi, name, sizeof(name),
+				NULL, 0, NULL, 0) != UNZ_OK)
+			break;
+
+		lua_pushstring(L, name);
+		lua_rawseti(L, -2, n++);
+
+		i = unzGoToNextFile(zr->zf);
+	}
+
+	return 1;
+}
+
+static int zipreader_read_cb(lua_State* L)
+{
+	zipreader_t* zr = checkreader(L, 1);
+	const char* subname = luaL_checkstring(L, 2);
+
+	if (!openmember(zr->zf, subname))
+		return 0;
+	if (!readmember(L, zr->zf, 0))
+		return 0;
+	return 1;
+}
+
+static int zipreader_stream_cb(lua_State* L)
+{
+	zipreader_t* zr = checkreader(L, 1);
+	const char* subname = luaL_checkstring(L, 2);
+	luaL_checktype(L, 3, LUA_TFUNCTION);
+
+	if (!openmember(zr->zf, subname))
+		return 0;
+	if (!readmember(L, zr->zf, 3))
+		return 0;
+
+	lua_pushboolean(L, true);
+	return 1;
+}
+
+static int zipreader_close_cb(lua_State* L)
+{
+	zipreader_t* zr = luaL_checkudata(L, 1, ZIPREADER_METATABLE);
+	if (zr->zf)
+	{
+		unzClose(zr->zf);
+		zr->zf = NULL;
+	}
+	return 0;
+}
+
+/* Compatibility interface: reads a single member from a zip file. */
+
 static int readfromzip_cb(lua_State* L)
 {
 	const char* zipname = luaL_checkstring(L, 1);
@@ -115,33 +282,194 @@ static int readfromzip_cb(lua_State* L)
 	unzFile zf = unzOpen(zipname);
 	if (zf)
 	{
-		int i = unzLocateFile(zf, subname, 0);
-		if (i == UNZ_OK)
+		if (openmember(zf, subname) && readmember(L, zf, 0))
+			result = 1;
+
+		unzClose(zf);
+	}
+
+	return result;
+}
+
+/* --- Archive writer ---------------------------------------------------- */
+
+static zipwriter_t* checkwriter(lua_State* L, int index)
+{
+	zipwriter_t* zw = luaL_checkudata(L, index, ZIPWRITER_METATABLE);
+	if (!zw->zf)
+		luaL_error(L, "attempt to use a closed zip archive");
+	return zw;
+}
+
+static bool writemember(zipFile zf, const char* key,
+		const char* value, size_t valuelen)
+{
+	int i = zipOpenNewFileInZip(zf, key, NULL,
+			NULL, 0,
+			NULL, 0,
+			NULL,
+			Z_DEFLATED,
+			Z_DEFAULT_COMPRESSION);
+	if (i != ZIP_OK)
+		return false;
+
+	i = zipWriteInFileInZip(zf, value, valuelen);
+	if (i != ZIP_OK)
+	{
+		zipCloseFileInZip(zf);
+		return false;
+	}
+
+	return (zipCloseFileInZip(zf) == ZIP_OK);
+}
+
+static int createzip_cb(lua_State* L)
+{
+	const char* zipname = luaL_checkstring(L, 1);
+
+	zipFile zf = zipOpen(zipname, APPEND_STATUS_CREATE);
+	if (!zf)
+		return 0;
+
+	zipwriter_t* zw = lua_newuserdata(L, sizeof(zipwriter_t));
+	zw->zf = zf;
+	zw->inmember = false;
+	zw->failed = false;
+	zw->staged = 0;
+	luaL_getmetatable(L, ZIPWRITER_METATABLE);
+	lua_setmetatable(L, -2);
+	return 1;
+}
+
+static int zipwriter_write_cb(lua_State* L)
+{
+	zipwriter_t* zw = checkwriter(L, 1);
+	const char* key = luaL_checkstring(L, 2);
+	size_t valuelen;
+	const char* value = buffer_checklstring(L, 3, &valuelen);
+
+	if (zw->inmember)
+		return luaL_error(L, "a streamed zip member is still open");
+	if (!writemember(zw->zf, key, value, valuelen))
+		return 0;
+
+	lua_pushboolean(L, true);
+	return 1;
+}
+
+/* Streamed members: open() starts a new member, append() feeds data into it
+ * and finish() closes it. Only one member may be open at a time, which is a
+ * minizip restriction. */
+
+static void flushstage(zipwriter_t* zw)
+{
+	if (zw->staged && !zw->failed)
+	{
+		if (zipWriteInFileInZip(zw->zf, zw->stage, zw->staged) != ZIP_OK)
+			zw->failed = true;
+	}
+	zw->staged = 0;
+}
+
+static bool finishmember(zipwriter_t* zw)
+{
+	if (!zw->inmember)
+		return true;
+
+	flushstage(zw);
+	zw->inmember = false;
+	if (zipCloseFileInZip(zw->zf) != ZIP_OK)
+		zw->failed = true;
+	return !zw->failed;
+}
+
+static int zipwriter_open_cb(lua_State* L)
+{
+	zipwriter_t* zw = checkwriter(L, 1);
+	const char* key = luaL_checkstring(L, 2);
+
+	if (zw->inmember)
+		return luaL_error(L, "a streamed zip member is still open");
+
+	int i = zipOpenNewFileInZip(zw->zf, key, NULL,
+			NULL, 0,
+			NULL, 0,
+			NULL,
+			Z_DEFLATED,
+			Z_DEFAULT_COMPRESSION);
+	if (i != ZIP_OK)
+		return 0;
+
+	zw->inmember = true;
+	zw->failed = false;
+	zw->staged = 0;
+	lua_pushboolean(L, true);
+	return 1;
+}
+
+static int zipwriter_append_cb(lua_State* L)
+{
+	zipwriter_t* zw = checkwriter(L, 1);
+	int n = lua_gettop(L);
+
+	if (!zw->inmember)
+		return luaL_error(L, "no streamed zip member is open");
+
+	for (int a = 2; a <= n; a++)
+	{
+		size_t len;
+		const char* s = buffer_checklstring(L, a, &len);
+
+		if (len >= STAGESIZE)
 		{
-			unz_file_info fi;
-			unzGetCurrentFileInfo(zf, &fi,
-				NULL, 0, NULL, 0, NULL, 0);
+			/* Too big to be worth staging; send it straight through. */
 
-			char* buffer = malloc(fi.uncompressed_size);
-			if (buffer)
-			{
-				unzOpenCurrentFile(zf);
-				i = unzReadCurrentFile(zf, buffer, fi.uncompressed_size);
-				if (i == fi.uncompressed_size)
-				{
-					lua_pushlstring(L, buffer, fi.uncompressed_size);
-					result = 1;
-				}
-				free(buffer);
-			}
+			flushstage(zw);
+			if (!zw->failed &&
+					(zipWriteInFileInZip(zw->zf, s, len) != ZIP_OK))
+				zw->failed = true;
+			continue;
 		}
 
-		unzClose(zf);
+		if ((zw->staged + len) > STAGESIZE)
+			flushstage(zw);
+		memcpy(zw->stage + zw->staged, s, len);
+		zw->staged += len;
 	}
 
-	return result;
+	return 0;
+}
+
+static int zipwriter_finish_cb(lua_State* L)
+{
+	zipwriter_t* zw = checkwriter(L, 1);
+
+	if (!finishmember(zw))
+		return 0;
+	lua_pushboolean(L, true);
+	return 1;
+}
+
+static int zipwriter_close_cb(lua_State* L)
+{
+	zipwriter_t* zw = luaL_checkudata(L, 1, ZIPWRITER_METATABLE);
+	int result = 0;
+
+	if (zw->zf)
+	{
+		result = finishmember(zw);
+		result = (zipClose(zw->zf, NULL) == ZIP_OK) && result;
+		zw->zf = NULL;
+	}
+
+	if (!result)
+		return 0;
+	lua_pushboolean(L, true);
+	return 1;
 }
 
+/* Compatibility interface: writes a table of members to a zip file. */
+
 static int writezip_cb(lua_State* L)
 {
 	const char* zipname = luaL_checkstring(L, 1);
@@ -160,27 +488,7 @@ static int writezip_cb(lua_State* L)
 			size_t valuelen;
 			const char* value = lua_tolstring(L, -1, &valuelen);
 
-			int i = zipOpenNewFileInZip(zf, key, NULL,
-					NULL, 0,
-					NULL, 0,
-					NULL,
-					Z_DEFLATED,
-					Z_DEFAULT_COMPRESSION);
-			if (i != ZIP_OK)
-			{
-				result = 0;
-				break;
-			}
-
-			i = zipWriteInFileInZip(zf, value, valuelen);
-			if (i != ZIP_OK)
-			{
-				result = 0;
-				break;
-			}
-
-			i = zipCloseFileInZip(zf);
-			if (i != ZIP_OK)
+			if (!writemember(zf, key, value, valuelen))
 			{
 				result = 0;
 				break;
@@ -198,6 +506,21 @@ static int writezip_cb(lua_State* L)
 	return 1;
 }
 
+static void createmetatable(lua_State* L, const char* name,
+		const luaL_Reg* methods, lua_CFunction gc)
+{
+	luaL_newmetatable(L, name);
+
+	lua_newtable(L);
+	luaL_setfuncs(L, methods, 0);
+	lua_setfield(L, -2, "__index");
+
+	lua_pushcfunction(L, gc);
+	lua_setfield(L, -2, "__gc");
+
+	lua_pop(L, 1);
+}
+
 void zip_init(void)
 {
 	const static luaL_Reg funcs[] =
@@ -206,9 +529,33 @@ void zip_init(void)
 		{ "decompress",                decompress_cb },
 		{ "readfromzip",               readfromzip_cb },
 		{ "writezip",                  writezip_cb },
+		{ "openzip",                   openzip_cb },
+		{ "createzip",                 createzip_cb },
+		{ NULL,                        NULL }
+	};
+
+	const static luaL_Reg readermethods[] =
+	{
+		{ "list",                      zipreader_list_cb },
+		{ "read",                      zipreader_read_cb },
+		{ "stream",                    zipreader_stream_cb },
+		{ "close",                     zipreader_close_cb },
 		{ NULL,                        NULL }
 	};
 
+	const static luaL_Reg writermethods[] =
+	{
+		{ "write",                     zipwriter_write_cb },
+		{ "open",                      zipwriter_open_cb },
+		{ "append",                    zipwriter_append_cb },
+		{ "finish",                    zipwriter_finish_cb },
+		{ "close",                     zipwriter_close_cb },
+		{ NULL,                        NULL }
+	};
+
+	createmetatable(L, ZIPREADER_METATABLE, readermethods, zipreader_close_cb);
+	createmetatable(L, ZIPWRITER_METATABLE, writermethods, zipwriter_close_cb);
+
 	lua_getglobal(L, "wg");
 	luaL_setfuncs(L, funcs, 0);
 }
@@ -43,6 +43,8 @@ if DEBUG then
 		X11_BRIGHT_COLOUR = true,
 		X11_DIM_COLOUR = true,
 		X11_FONT = true,
+		X11_GLYPH_CACHE_ENTRIES = true,
+		X11_GLYPH_CACHE_KB = true,
 		X11_ITALIC_MODIFIER = true,
 		X11_NORMAL_COLOUR = true,
 	}
@@ -3,6 +3,8 @@
 -- file in this distribution for the full text.
 
 local string_format = string.format
+local table_concat = table.concat
+local RenderStats = wg.renderstats
 
 -----------------------------------------------------------------------------
 -- Build the status bar.
@@ -18,18 +20,50 @@ do
 					value=string_format("%dkB", mem)
 				}
 		end
+
+		if settings.renderstats then
+			local _, frame = RenderStats()
+			local s = string_format("%dw", frame.writes)
+			if frame.cellschanged then
+				s = s .. string_format(" %dc", frame.cellschanged)
+			end
+			s = s .. string_format(" %da", frame.attrswitches)
+			if frame.requests then
+				s = s .. string_format(" %dr", frame.requests)
+			end
+			terms[#terms+1] =
+				{
+					priority=50,
+					value=s .. string_format(" %.1fms", frame.redrawtime*1000)
+				}
+		end
 	end
 	
 	AddEventListener(Event.BuildStatusBar, cb)
 end
 
+-----------------------------------------------------------------------------
+-- Idling no longer redraws the screen, so keep the memory readout up to date
+-- by hand.
+
+do
+	local function cb(event, token)
+		if GlobalSettings.debug.memory then
+			QueueRedraw()
+		end
+	end
+
+	AddEventListener(Event.Idle, cb)
+end
+
 -----------------------------------------------------------------------------
 -- Addon registration. Create the default settings in the DocumentSet.
 
 do
 	local function cb()
 		GlobalSettings.debug = GlobalSettings.debug or {
-			memory = false
+			memory = false,
+			renderstats = false
 		}
 	end
 	
@@ -50,11 +84,19 @@ function Cmd.ConfigureDebug()
 			value = settings.memory
 		}
 
+	local renderstats_checkbox =
+		Form.Checkbox {
+			x1 = 1, y1 = 5,
+			x2 = 40, y2 = 5,
+			label = "Show rendering statistics on status bar",
+			value = settings.renderstats
+		}
+
 	local dialogue =
 	{
 		title = "Configure Debugging Options",
 		width = Form.Large,
-		height = 5,
+		height = 7,
 		stretchy = false,
 
 		["KEY_^C"] = "cancel",
@@ -62,6 +104,7 @@ function Cmd.ConfigureDebug()
 		["KEY_ENTER"] = "confirm",
 		
 		memory_checkbox,
+		renderstats_checkbox,
 		
 		Form.Label {
 			x1 = 1, y1 = 1,
@@ -78,8 +121,38 @@ function Cmd.ConfigureDebug()
 	end
 	
 	settings.memory = memory_checkbox.value
+	settings.renderstats = renderstats_checkbox.value
 	SaveGlobalSettings()
 
 	return true
 end
 
+-----------------------------------------------------------------------------
+-- Shows the rendering statistics: the totals since startup, and the cost of
+-- the last frame drawn. Counters the display backend doesn't keep are nil,
+-- and are left out.
+
+function Cmd.DumpRenderStats()
+	local total, frame = RenderStats()
+
+	local function describe(s)
+		local t = {
+			string_format("%d frames", s.frames),
+			string_format("%d characters written", s.writes)
+		}
+		if s.cellschanged then
+			t[#t+1] = string_format("%d cells changed", s.cellschanged)
+		end
+		t[#t+1] = string_format("%d attribute switches", s.attrswitches)
+		if s.requests then
+			t[#t+1] = string_format("%d display requests", s.requests)
+		end
+		t[#t+1] = string_format("%.3fms in RedrawScreen", s.redrawtime*1000)
+		return table_concat(t, ", ").."."
+	end
+
+	ModalMessage("Rendering statistics",
+		"Total: "..describe(total).." Last frame: "..describe(frame))
+	return true
+end
+
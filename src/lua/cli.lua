@@ -51,12 +51,13 @@ function EngageCLI()
 	end
 end
 
---- Converts between two files.
+--- Converts between files. If more than one destination is given, the
+-- document is exported to all of them in a single pass.
 --
 -- @param file1                 Source filename
--- @param file2                 Destination filename
+-- @param ...                   Destination filenames
 
-function CliConvert(file1, file2)
+function CliConvert(file1, ...)
 	EngageCLI()
 	
 	local function decode_filename(f)
@@ -72,12 +73,6 @@ function CliConvert(file1, file2)
 	
 	local f1r, f1e, f1hs, f1s = decode_filename(file1)
 	local f1 = f1r.."."..f1e
-	local f2r, f2e, f2hs, f2s = decode_filename(file2)
-	local f2 = f2r.."."..f2e
-	
-	if (f2hs ~= "") then
-		CLIError("you cannot specify a document name for the output file")
-	end
 	
 	local function supported_extensions(t)
 		local s = {}
@@ -94,11 +89,35 @@ function CliConvert(file1, file2)
 			supported_extensions(import_table), ")")
 	end
 	
-	local exporter = export_table[f2e]
-	if not exporter then
-		CLIError("don't know how to export extension '", f2e, "' ",
-			"(supported extensions are: ",
-			supported_extensions(export_table), ")")
+	-- When there is more than one destination, files with a registered
+	-- exporter are all written together; anything else (i.e. .wg files)
+	-- is written separately.
+	
+	local outputs = {}
+	local multiples = {}
+	for _, file2 in ipairs({...}) do
+		local f2r, f2e, f2hs, f2s = decode_filename(file2)
+		local f2 = f2r.."."..f2e
+		
+		if (f2hs ~= "") then
+			CLIError("you cannot specify a document name for the output file")
+		end
+		
+		local exporter = export_table[f2e]
+		if not exporter then
+			CLIError("don't know how to export extension '", f2e, "' ",
+				"(supported extensions are: ",
+				supported_extensions(export_table), ")")
+		end
+		
+		outputs[#outputs+1] = {exporter, f2, GetExporter(f2e) ~= nil}
+		if outputs[#outputs][3] then
+			multiples[#multiples+1] = f2
+		end
+	end
+	
+	if (#multiples < 2) then
+		multiples = {}
 	end
 	
 	if not importer(f1) then
@@ -124,8 +143,20 @@ function CliConvert(file1, file2)
 		end
 	end
 	
-	if not exporter(f2) then
-		CLIError("failed")
+	for _, output in ipairs(outputs) do
+		if not output[3] or (#multiples == 0) then
+			if not output[1](output[2]) then
+				CLIError("failed")
+			end
+		end
+	end
+	
+	if (#multiples > 0) then
+		ImmediateMessage("Exporting...")
+		local r, e = ExportToMultipleFiles(Document, multiples)
+		if not r then
+			CLIError(e)
+		end
 	end
 	
 	os.exit(0)
@@ -12,12 +12,94 @@ local bitxor = bit32.bxor
 local bit = bit32.btest
 local string_lower = string.lower
 local time = wg.time
+local CreateBuffer = wg.createbuffer
 
--- Renders the document by calling the appropriate functions on the cb
--- table.
- 
-function ExportFileUsingCallbacks(document, cb)
-	cb.prologue()
+-- Output is accumulated in a buffer and written out in chunks of this size.
+
+local FLUSHSIZE = 64*1024
+
+-- Rendered paragraph text, cached per format and then per paragraph. Both
+-- levels are weak-keyed: paragraphs are immutable and are replaced when
+-- edited, so an edited paragraph simply misses the cache and the old entry
+-- goes away with the old paragraph.
+
+local fragmentcache = setmetatable({}, {__mode="k"})
+local fragmenthits = 0
+local fragmentmisses = 0
+
+local function renderfragment(format, paragraph, rawmode)
+	local cache = fragmentcache[format]
+	if not cache then
+		cache = setmetatable({}, {__mode="k"})
+		fragmentcache[format] = cache
+	end
+	
+	local s = cache[paragraph]
+	if s then
+		fragmenthits = fragmenthits + 1
+	else
+		fragmentmisses = fragmentmisses + 1
+		s = format:renderwords(paragraph, rawmode)
+		cache[paragraph] = s
+	end
+	return s
+end
+
+-- Returns the number of paragraph renderings which were satisfied from
+-- the cache, and the number which weren't.
+
+function GetExportFragmentCacheStats()
+	return fragmenthits, fragmentmisses
+end
+
+-- Renders the document by calling the appropriate functions on each of
+-- the callback tables in cbs, walking the document only once. Every sink
+-- sees exactly the same sequence of events as it would if it were exported
+-- on its own.
+--
+-- If a sink's format is set (to a format made by wg.createexportformat()),
+-- the words of each paragraph are rendered natively by the format in one
+-- go and passed to its rawtext; the text, rawtext-per-run and style
+-- callbacks are not used. Otherwise each style run is passed to the
+-- callbacks individually. Style runs are only decoded once, however many
+-- sinks want them. Rendered text is cached per (format, paragraph), so
+-- formats should be reused between exports where possible.
+
+function ExportFileUsingMultipleCallbacks(document, cbs)
+	local formatted = {}
+	local unformatted = {}
+	for _, sink in ipairs(cbs) do
+		if sink.format then
+			formatted[#formatted+1] = sink
+		else
+			unformatted[#unformatted+1] = sink
+		end
+	end
+	
+	local function broadcast(name, ...)
+		for i = 1, #cbs do
+			cbs[i][name](...)
+		end
+	end
+	
+	local function fanout(name)
+		if (#unformatted == 1) then
+			return unformatted[1][name]
+		end
+		return function(...)
+			for i = 1, #unformatted do
+				unformatted[i][name](...)
+			end
+		end
+	end
+	
+	local cb = {}
+	for _, name in ipairs({"text", "rawtext", "italic_on", "italic_off",
+			"underline_on", "underline_off", "bold_on", "bold_off"}) do
+		cb[name] = fanout(name)
+	end
+	
+	broadcast("prologue")
 	
 	local listmode = false
 	local rawmode = false
@@ -71,71 +153,186 @@ function ExportFileUsingCallbacks(document, cb)
 		oldbold = bold
 	end
 
-	for _, paragraph in ipairs(Document) do
+	for _, paragraph in ipairs(document) do
 		local style = paragraph.style
 		local name = style.name
 		
 		if (name == "L") or (name == "LB") then
 			if not listmode then
-				cb.list_start()
+				broadcast("list_start")
 				listmode = true
 			end
 		elseif listmode then
-			cb.list_end()
+			broadcast("list_end")
 			listmode = false
 		end
 		
 		rawmode = (name == "RAW")
 		
-		cb.paragraph_start(name)
+		broadcast("paragraph_start", name)
 	
 		if (#paragraph == 1) and (#paragraph[1] == 0) then
-			cb.notext()
+			broadcast("notext")
 		else
-			firstword = true
-			wordbreak = false	
-			olditalic = false
-			oldunderline = false
-			oldbold = false
-
-			for wn, word in ipairs(paragraph) do
-				if firstword then
-					firstword = false
-				else
-					wordbreak = true
+			for i = 1, #formatted do
+				local sink = formatted[i]
+				sink.rawtext(renderfragment(sink.format, paragraph, rawmode))
+			end
+			
+			if (#unformatted > 0) then
+				firstword = true
+				wordbreak = false	
+				olditalic = false
+				oldunderline = false
+				oldbold = false
+
+				for wn, word in ipairs(paragraph) do
+					if firstword then
+						firstword = false
+					else
+						wordbreak = true
+					end
+					
+					emptyword = true
+					italic = false
+					underline = false
+					bold = false
+					ParseWord(word, 0, wordwriter) -- FIXME
+					if emptyword then
+						wordwriter(0, "")
+					end
 				end
-				
-				emptyword = true
-				italic = false
-				underline = false
-				bold = false
-				ParseWord(word, 0, wordwriter) -- FIXME
-				if emptyword then
-					wordwriter(0, "")
+
+				if italic then
+					cb.italic_off()
+				end
+				if underline then
+					cb.underline_off()
+				end
+				if bold then
+					cb.bold_off()
 				end
 			end
+		end
+		
+		broadcast("paragraph_end", name)
+	end
+	if listmode then
+		broadcast("list_end")
+	end
+	broadcast("epilogue")
+end
 
-			if italic then
-				cb.italic_off()
-			end
-			if underline then
-				cb.underline_off()
+-- Renders the document by calling the appropriate functions on the cb
+-- table. See ExportFileUsingMultipleCallbacks.
+
+function ExportFileUsingCallbacks(document, cb)
+	return ExportFileUsingMultipleCallbacks(document, {cb})
+end
+
+-- Exporters register themselves here, keyed by file extension (without the
+-- dot), so that several of them can be driven at once. callback(writer,
+-- document) must return the exporter's callback table; open(filename), if
+-- given, returns a writer and a function which finishes the file off and
+-- returns true on success (or nil and an error message on failure).
+
+local exporters = {}
+
+-- Opens a plain file for export. Output is accumulated in a buffer and
+-- written out in FLUSHSIZE chunks. If a write fails, the rest of the output
+-- is thrown away and the error is returned when the file is closed.
+
+function OpenExportFile(filename)
+	local fp, e = io.open(filename, "w")
+	if not fp then
+		return nil, e
+	end
+	
+	local buffer = CreateBuffer()
+	local append = buffer.append
+	local flushto = buffer.flushto
+	local writeerror = nil
+	local writer = function(...)
+		if writeerror then
+			return
+		end
+		if (append(buffer, ...) > FLUSHSIZE) then
+			local r, e = flushto(buffer, fp)
+			if not r then
+				writeerror = e
 			end
-			if bold then
-				cb.bold_off()
+		end
+	end
+	
+	local close = function()
+		local r, e = nil, writeerror
+		if not writeerror then
+			r, e = flushto(buffer, fp)
+		end
+		local cr, ce = fp:close()
+		if r and not cr then
+			r, e = nil, ce
+		end
+		return r, e
+	end
+	
+	return writer, close
+end
+
+function RegisterExporter(extension, callback, open)
+	exporters[extension] = {
+		callback = callback,
+		open = open or OpenExportFile
+	}
+end
+
+function GetExporter(extension)
+	return exporters[extension]
+end
+
+-- Exports the document to several files at once, walking it only once.
+-- filenames is a list of filenames whose extensions select the exporter.
+-- Returns true on success, or nil and an error message.
+
+function ExportToMultipleFiles(document, filenames)
+	local closers = {}
+	local cbs = {}
+	local function finish()
+		local r, e = true, nil
+		for i = 1, #closers do
+			local cr, ce = closers[i]()
+			if not cr and r then
+				r, e = nil, ce
 			end
 		end
-		
-		cb.paragraph_end(name)
+		return r, e
 	end
-	if listmode then
-		cb.list_end()
+	
+	for _, filename in ipairs(filenames) do
+		local extension = string_lower(filename:match("%.(%w*)$") or "")
+		local exporter = exporters[extension]
+		if not exporter then
+			finish()
+			return nil, "don't know how to export '"..filename.."'"
+		end
+		
+		local writer, close = exporter.open(filename)
+		if not writer then
+			finish()
+			return nil, "unable to open the output file "..filename..
+				": "..tostring(close)
+		end
+		closers[#closers+1] = close
+		cbs[#cbs+1] = exporter.callback(writer, document)
 	end
-	cb.epilogue()
+	
+	ExportFileUsingMultipleCallbacks(document, cbs)
+	return finish()
 end
 
 -- Prompts the user to export a document, and then calls
--- exportcb(writer, document) to actually do the work.
+-- callback(writer, document) to get the exporter's callback table. (Older
+-- exporters do the work themselves and return nothing.)
 
 function ExportFileWithUI(filename, title, extension, callback)
 	if not filename then
@@ -161,20 +358,24 @@ function ExportFileWithUI(filename, title, extension, callback)
 	end
 	
 	ImmediateMessage("Exporting...")
-	local fp, e = io.open(filename, "w")
-	if not fp then
-		ModalMessage(nil, "Unable to open the output file "..e..".")
+	local writer, close = OpenExportFile(filename)
+	if not writer then
+		ModalMessage(nil, "Unable to open the output file "..close..".")
 		QueueRedraw()
 		return false
 	end
 	
-	local fpw = fp.write
-	local writer = function(...)
-		fpw(fp, ...)
+	local cb = callback(writer, Document)
+	if (type(cb) == "table") then
+		ExportFileUsingCallbacks(Document, cb)
+	end
+	local r, e = close()
+	if not r then
+		ModalMessage(nil, "Unable to write the output file "..filename..
+			": "..tostring(e)..".")
+		QueueRedraw()
+		return false
 	end
-	
-	callback(writer, Document)
-	fp:close()
 	
 	QueueRedraw()
 	return true
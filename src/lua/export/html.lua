@@ -2,15 +2,18 @@
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
+local CreateExportFormat = wg.createexportformat
+local table_concat = table.concat
+
 -----------------------------------------------------------------------------
 -- The exporter itself.
 
-local function unhtml(s)
-	s = s:gsub("&", "&amp;")
-	s = s:gsub("<", "&lt;")
-	s = s:gsub(">", "&gt;")
-	return s
-end
+local escapes =
+{
+	["&"] = "&amp;",
+	["<"] = "&lt;",
+	[">"] = "&gt;"
+}
 
 local style_tab =
 {
@@ -38,12 +41,37 @@ local style_tab =
 		on='<pre>', off='</pre>'}
 }
 
+-- The format is only rebuilt when the settings change, so that rendered
+-- paragraphs can be reused from the export cache.
+
+local format, formatkey
+
+local function getformat(settings)
+	local key = table_concat({settings.italic_on, settings.italic_off,
+		settings.underline_on, settings.underline_off,
+		settings.bold_on, settings.bold_off}, "\0")
+	if (key ~= formatkey) then
+		format = CreateExportFormat {
+			italic_on = settings.italic_on,
+			italic_off = settings.italic_off,
+			underline_on = settings.underline_on,
+			underline_off = settings.underline_off,
+			bold_on = settings.bold_on,
+			bold_off = settings.bold_off,
+			escapes = escapes
+		}
+		formatkey = key
+	end
+	return format
+end
+
 local function callback(writer, document)
 	local settings = DocumentSet.addons.htmlexport
 	local currentpara = nil
 	local islist = false
+	local format = getformat(settings)
 	
-	function changepara(newpara)
+	local function changepara(newpara)
 		local currentstyle = style_tab[currentpara]
 		local newstyle = style_tab[newpara]
 		
@@ -75,54 +103,27 @@ local function callback(writer, document)
 		end
 	end
 		
-	return ExportFileUsingCallbacks(document,
-	{
+	return {
 		prologue = function()
 			writer('<html xmlns="http://www.w3.org/1999/xhtml"><head>\n')
 			writer('<meta http-equiv="Content-Type" content="text/html;charset=utf-8"/>\n')
 			writer('<meta name="generator" content="WordGrinder '..VERSION..'"/>\n')
-			writer('<title>', unhtml(document.name), '</title>\n')
+			writer('<title>', format:escape(document.name), '</title>\n')
 			writer('</head><body>\n')
 		end,
 		
+		format = format,
+		
 		rawtext = function(s)
 			writer(s)
 		end,
 		
-		text = function(s)
-			writer(unhtml(s))
-		end,
-		
 		notext = function(s)
 			if (currentpara ~= "PRE") then
 				writer('<br/>')
 			end
 		end,
 		
-		italic_on = function()
-			writer(settings.italic_on)
-		end,
-		
-		italic_off = function()
-			writer(settings.italic_off)
-		end,
-		
-		underline_on = function()
-			writer(settings.underline_on)
-		end,
-		
-		underline_off = function()
-			writer(settings.underline_off)
-		end,
-		
-		bold_on = function()
-			writer(settings.bold_on)
-		end,
-		
-		bold_off = function()
-			writer(settings.bold_off)
-		end,
-		
 		list_start = function()
 		end,
 		
@@ -141,7 +142,7 @@ local function callback(writer, document)
 			writer('</body>\n')	
 			writer('</html>\n')
 		end
-	})
+	}
 end
 
 function Cmd.ExportHTMLFile(filename)
@@ -149,6 +150,8 @@ function Cmd.ExportHTMLFile(filename)
 		callback)
 end
 
+RegisterExporter("html", callback)
+
 -----------------------------------------------------------------------------
 -- Addon registration. Set the HTML export settings.
 
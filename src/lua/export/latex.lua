@@ -2,6 +2,8 @@
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
+local CreateExportFormat = wg.createexportformat
+
 local untextab = {
 	["#"] = "\\#",
 	["$"] = "\\$",
@@ -17,10 +19,15 @@ local untextab = {
 	["\\"] = "$\\backslash$"
 }
 
-local function untex(s)
-	s = s:gsub("[#$&{}\\_^~%%<>]", untextab)
-	return s
-end
+local format = CreateExportFormat {
+	italic_on = '\\textit{',
+	italic_off = '}',
+	bold_on = '\\textbf{',
+	bold_off = '}',
+	underline_on = '\\underline{',
+	underline_off = '}',
+	escapes = untextab
+}
 
 local style_tab =
 {
@@ -38,8 +45,7 @@ local style_tab =
 }
 
 local function callback(writer, document)
-	return ExportFileUsingCallbacks(document,
-	{
+	return {
 		prologue = function()
 			writer('%% This document automatically generated by '..
 				'WordGrinder '..VERSION..'.\n')
@@ -48,47 +54,21 @@ local function callback(writer, document)
 			writer('\\sloppy\n')
 			writer('\\onehalfspacing\n')
 			writer('\\begin{document}\n')
-			writer('\\title{', untex(Document.name), '}\n')
+			writer('\\title{', format:escape(Document.name), '}\n')
 			writer('\\author{(no author)}\n')
 			writer('\\maketitle\n')
 		end,
 		
+		format = format,
+		
 		rawtext = function(s)
 			writer(s)
 		end,
 		
-		text = function(s)
-			writer(untex(s))
-		end,
-		
 		notext = function(s)
 			writer('\\paragraph{}')
 		end,
 		
-		italic_on = function()
-			writer('\\textit{')
-		end,
-		
-		italic_off = function()
-			writer('}')
-		end,
-		
-		bold_on = function()
-			writer('\\textbf{')
-		end,
-		
-		bold_off = function()
-			writer('}')
-		end,
-		
-		underline_on = function()
-			writer('\\underline{')
-		end,
-		
-		underline_off = function()
-			writer('}')
-		end,
-		
 		list_start = function()
 			writer('\\begin{itemize}\n')
 		end,
@@ -109,10 +89,12 @@ local function callback(writer, document)
 		epilogue = function()
 			writer('\\end{document}\n')	
 		end
-	})
+	}
 end
 
 function Cmd.ExportLatexFile(filename)
 	return ExportFileWithUI(filename, "Export LaTeX File", ".tex",
 		callback)
 end
+
+RegisterExporter("tex", callback)
@@ -2,19 +2,36 @@
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
-local table_concat = table.concat
-local writezip = wg.writezip
+local CreateZip = wg.createzip
+local CreateBuffer = wg.createbuffer
+
+local FLUSHSIZE = 64*1024
 
 -----------------------------------------------------------------------------
 -- The exporter itself.
 
-local function unhtml(s)
-	s = s:gsub("&", "&amp;")
-	s = s:gsub("<", "&lt;")
-	s = s:gsub(">", "&gt;")
-	s = s:gsub("%s", "<text:s/>")
-	return s
-end
+local CreateExportFormat = wg.createexportformat
+
+local format = CreateExportFormat {
+	italic_on = '<text:span text:style-name="I">',
+	italic_off = "</text:span>",
+	bold_on = '<text:span text:style-name="B">',
+	bold_off = "</text:span>",
+	underline_on = '<text:span text:style-name="UL">',
+	underline_off = "</text:span>",
+	escapes =
+	{
+		["&"] = "&amp;",
+		["<"] = "&lt;",
+		[">"] = "&gt;",
+		[" "] = "<text:s/>",
+		["\t"] = "<text:s/>",
+		["\n"] = "<text:s/>",
+		["\r"] = "<text:s/>",
+		["\f"] = "<text:s/>",
+		["\v"] = "<text:s/>"
+	}
+}
 
 local style_tab =
 {
@@ -37,7 +54,7 @@ local function callback(writer, document)
 	local settings = DocumentSet.addons.htmlexport
 	local currentpara = nil
 	
-	function changepara(newpara)
+	local function changepara(newpara)
 		local currentstyle = style_tab[currentpara]
 		local newstyle = style_tab[newpara]
 		
@@ -59,8 +76,7 @@ local function callback(writer, document)
 		end
 	end
 		
-	return ExportFileUsingCallbacks(document,
-	{
+	return {
 		prologue = function()
 			writer(
 				[[<?xml version="1.0" encoding="UTF-8"?>
@@ -80,41 +96,15 @@ local function callback(writer, document)
 			writer('</office:text></office:body></office:document-content>\n')	
 		end,
 		
+		format = format,
+		
 		rawtext = function(s)
 			writer(s)
 		end,
 		
-		text = function(s)
-			writer(unhtml(s))
-		end,
-		
 		notext = function(s)
 		end,
 		
-		italic_on = function()
-			writer('<text:span text:style-name="I">')
-		end,
-		
-		italic_off = function()
-			writer("</text:span>")
-		end,
-		
-		bold_on = function()
-			writer('<text:span text:style-name="B">')
-		end,
-		
-		bold_off = function()
-			writer("</text:span>")
-		end,
-		
-		underline_on = function()
-			writer('<text:span text:style-name="UL">')
-		end,
-		
-		underline_off = function()
-			writer("</text:span>")
-		end,
-		
 		list_start = function()
 		end,
 		
@@ -128,41 +118,14 @@ local function callback(writer, document)
 		paragraph_end = function(style)
 		end,
 		
-	})
+	}
 end
 
-local function export_odt_with_ui(filename, title, extension)
-	if not filename then
-		filename = Document.name
-		if filename then
-			if not filename:find("%..-$") then
-				filename = filename .. extension
-			else
-				filename = filename:gsub("%..-$", extension)
-			end
-		else
-			filename = "(unnamed)"
-		end
-			
-		filename = FileBrowser(title, "Export as:", true,
-			filename)
-		if not filename then
-			return false
-		end
-		if filename:find("/[^.]*$") then
-			filename = filename .. extension
-		end
-	end
-	
-	ImmediateMessage("Exporting...")
-	
-	local content = {}
-	local writer = function(s)
-		content[#content+1] = s
-	end
-	callback(writer, Document)
-	content = table_concat(content)
-	
+-- Opens an ODT archive for export and writes all the fixed members.
+-- Returns a writer which streams into content.xml and a function which
+-- finishes the archive off, or nil and an error message.
+
+local function open_odt_file(filename)
 	local xml =
 	{
 		["mimetype"] = "application/vnd.oasis.opendocument.text",
@@ -324,12 +287,85 @@ local function export_odt_with_ui(filename, title, extension)
 			<office:document-meta office:version="1.0"
 				xmlns:office="urn:oasis:names:tc:opendocument:xmlns:office:1.0"/>
 		]],
-		
-		["content.xml"] = content
 	}
 	
-	if not writezip(filename, xml) then
-		ModalMessage(nil, "Unable to open the output file "..e..".")
+	-- Write all the members through a single archive handle. The mimetype
+	-- member goes first, as the ODF specification requires.
+	
+	local zip = CreateZip(filename)
+	local r = zip and zip:write("mimetype", xml["mimetype"])
+	for _, member in ipairs({"META-INF/manifest.xml", "styles.xml",
+			"settings.xml", "meta.xml"}) do
+		r = r and zip:write(member, xml[member])
+	end
+	
+	-- The content is streamed straight into the archive as it's generated,
+	-- so the complete XML is never held in memory.
+	
+	r = r and zip:open("content.xml")
+	if not r then
+		if zip then
+			zip:close()
+		end
+		return nil, filename
+	end
+	
+	local buffer = CreateBuffer()
+	local append = buffer.append
+	local writer = function(...)
+		if (append(buffer, ...) > FLUSHSIZE) then
+			zip:append(buffer)
+			buffer:clear()
+		end
+	end
+	
+	local close = function()
+		zip:append(buffer)
+		local r = zip:finish()
+		r = zip:close() and r
+		if not r then
+			return nil, filename
+		end
+		return true
+	end
+	
+	return writer, close
+end
+
+local function export_odt_with_ui(filename, title, extension)
+	if not filename then
+		filename = Document.name
+		if filename then
+			if not filename:find("%..-$") then
+				filename = filename .. extension
+			else
+				filename = filename:gsub("%..-$", extension)
+			end
+		else
+			filename = "(unnamed)"
+		end
+			
+		filename = FileBrowser(title, "Export as:", true,
+			filename)
+		if not filename then
+			return false
+		end
+		if filename:find("/[^.]*$") then
+			filename = filename .. extension
+		end
+	end
+	
+	ImmediateMessage("Exporting...")
+	
+	local writer, close = open_odt_file(filename)
+	local r = false
+	if writer then
+		ExportFileUsingCallbacks(Document, callback(writer, Document))
+		r = close()
+	end
+	
+	if not r then
+		ModalMessage(nil, "Unable to open the output file "..filename..".")
 		QueueRedraw()
 		return false
 	end
@@ -341,3 +377,5 @@ end
 function Cmd.ExportODTFile(filename)
 	return export_odt_with_ui(filename, "Export ODT File", ".odt")
 end
+
+RegisterExporter("odt", callback, open_odt_file)
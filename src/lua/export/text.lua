@@ -2,41 +2,22 @@
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
+local format = wg.createexportformat {}
+
 local function callback(writer, document)
-	return ExportFileUsingCallbacks(document,
-	{
+	return {
 		prologue = function()
 		end,
 		
-		rawtext = function(s)
-			writer(s)
-		end,
+		format = format,
 		
-		text = function(s)
+		rawtext = function(s)
 			writer(s)
 		end,
 		
 		notext = function(s)
 		end,
 		
-		italic_on = function()
-		end,
-		
-		italic_off = function()
-		end,
-		
-		underline_on = function()
-		end,
-		
-		underline_off = function()
-		end,
-		
-		bold_on = function()
-		end,
-		
-		bold_off = function()
-		end,
-		
 		list_start = function()
 		end,
 		
@@ -52,10 +33,12 @@ local function callback(writer, document)
 		
 		epilogue = function()
 		end
-	})
+	}
 end
 
 function Cmd.ExportTextFile(filename)
 	return ExportFileWithUI(filename, "Export Text File", ".txt",
 		callback)
 end
+
+RegisterExporter("txt", callback)
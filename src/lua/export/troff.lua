@@ -2,13 +2,24 @@
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
 
-local NextCharInWord = wg.nextcharinword
-local ReadU8 = wg.readu8
-local string_len = string.len
-local string_char = string.char
-local string_format = string.format
+local CreateExportFormat = wg.createexportformat
+local string_find = string.find
 local string_gsub = string.gsub
 
+-- Troff's line-start and .UL state can't be expressed as a template, so
+-- this exporter still uses callbacks; but the text escaping is native.
+-- Inside a .UL argument quotes need escaping too.
+
+local format = CreateExportFormat {
+	escapes = { ["\\"] = "\\\\" },
+	unicode = "\\[u%04X]"
+}
+
+local embeddedformat = CreateExportFormat {
+	escapes = { ["\\"] = "\\\\", ['"'] = '\\"' },
+	unicode = "\\[u%04X]"
+}
+
 local style_tab =
 {
 	["H1"] = '.NH 1',
@@ -40,29 +51,19 @@ local function callback(writer, document)
 	end
 
 	local function emit_text(s)
+		local prefix = ""
 		if linestart then
-			s = string_gsub(s, "^([.'])", '\\%1')
 			s = string_gsub(s, '^%s+', '')
+			if string_find(s, "^[.']") then
+				prefix = "\\&"
+			end
 			linestart = false
 		end
 		
 		if embedded then
-			s = string_gsub(s, '"', '\\"')
-		end
-
-		s = string_gsub(s, '\\', '\\\\')
-		
-		local o = 1
-		local n = string_len(s)
-		
-		while (o <= n) do
-			local c = ReadU8(s, o)
-			o = NextCharInWord(s, o)
-			if (c < 127) then
-				writer(string_char(c))
-			else
-				writer(string_format('\\[u%04X]', c))
-			end
+			writer(prefix, embeddedformat:escape(s))
+		else
+			writer(prefix, format:escape(s))
 		end
 	end
 	
@@ -99,8 +100,7 @@ local function callback(writer, document)
 		bf = newbf
 	end
 	
-	return ExportFileUsingCallbacks(document,
-	{
+	return {
 		prologue = function()
 			writer('.\\" This document automatically generated by '..
 				'WordGrinder '..VERSION..'.\n')
@@ -168,10 +168,12 @@ local function callback(writer, document)
 		
 		epilogue = function()
 		end
-	})
+	}
 end
 
 function Cmd.ExportTroffFile(filename)
 	return ExportFileWithUI(filename, "Export Troff File", ".tr",
 		callback)
 end
+
+RegisterExporter("tr", callback)
@@ -0,0 +1,60 @@
+-- © 2015 David Given.
+-- WordGrinder is licensed under the MIT open source license. See the COPYING
+-- file in this distribution for the full text.
+
+-- LuaJIT can't compile calls through the classic Lua C API into traces, so
+-- on LuaJIT the primitives used by the wrap, redraw and save loops are
+-- rebound to call their C kernels through the FFI instead. This has to
+-- happen before any other script takes a local copy of them.
+--
+-- The kernels are looked up in the executable itself, which the LuaJIT
+-- build links with -Wl,-E. If anything is missing, or WORDGRINDER_NO_FFI is
+-- set in the environment, the C API versions are left alone.
+
+if not rawget(_G, "jit") or os.getenv("WORDGRINDER_NO_FFI") then
+	return
+end
+
+local ok, ffi = pcall(require, "ffi")
+if not ok then
+	return
+end
+
+ffi.cdef [[
+	int screen_getstringwidth(const char* s, size_t size);
+	int word_writestyled(int x, int y, const char* s, size_t size,
+		int oattr, int revon, int revoff, int sor);
+	struct buffer;
+	size_t buffer_appendu8(struct buffer* b, int c);
+]]
+
+local C = ffi.C
+if not pcall(function() return C.buffer_appendu8 end) then
+	return
+end
+
+local cast = ffi.cast
+local GetStringWidth = C.screen_getstringwidth
+local WriteStyled = C.word_writestyled
+local AppendU8 = C.buffer_appendu8
+local BufferPtr = ffi.typeof("struct buffer*")
+
+wg.getstringwidth = function(s)
+	return GetStringWidth(s, #s)
+end
+
+wg.writestyled = function(x, y, s, oattr, revon, revoff, sor)
+	return WriteStyled(x, y, s, #s, oattr, revon or 0, revoff or 0, sor or 0)
+end
+
+-- The FFI sees a buffer userdata as a pointer to its payload, which is the
+-- C struct buffer.
+
+local buffermethods = getmetatable(wg.createbuffer(16)).__index
+buffermethods.appendu8 = function(b, c)
+	local len = AppendU8(cast(BufferPtr, b), c)
+	if (len == 0) then
+		error("out of memory")
+	end
+	return tonumber(len)
+end
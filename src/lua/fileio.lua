@@ -10,8 +10,10 @@ local bit = bit32.btest
 local time = wg.time
 local compress = wg.compress
 local decompress = wg.decompress
-local writeu8 = wg.writeu8
 local readu8 = wg.readu8
+local CreateBuffer = wg.createbuffer
+local BeginArena = wg.beginarena
+local EndArena = wg.endarena
 
 local MAGIC = "WordGrinder dumpfile v1: this is not a text file!"
 local ZMAGIC = "WordGrinder dumpfile v2: this is not a text file!"
@@ -138,23 +140,24 @@ function SaveToStream(filename, object)
 		return nil, e
 	end
 	
-	local fpw = fp.write
-	
-	local ss = {}
+	local buffer = CreateBuffer()
+	local append = buffer.append
+	local appendu8 = buffer.appendu8
 	local writes = function(s)
 		if (type(s) == "number") then
-			s = writeu8(s)
+			appendu8(buffer, s)
+		else
+			append(buffer, s)
 		end
-		ss[#ss+1] = s
 	end
 	
 	local writei = function(s)
-		s = writeu8(s)
-		ss[#ss+1] = s
+		appendu8(buffer, s)
 	end
 
 	local r = writetostream(object, writes, writei)
-	local s = compress(table.concat(ss))	
+	local s = compress(buffer)
+	buffer = nil
 
 	local e
 	if r then
@@ -499,8 +502,19 @@ function LoadFromStream(filename)
 		return nil, ("'"..filename.."' is not a valid WordGrinder file.")
 	end
 	
-	local d, e = loader(fp)
+	-- The document is built in an allocator arena of its own, so that it's
+	-- packed together in memory and can be released cleanly later. The
+	-- arena must be closed even if the loader fails, so errors are caught
+	-- (with their traceback, which is lost once the stack unwinds) and
+	-- rethrown afterwards.
+
+	BeginArena()
+	local ok, d, e = xpcall(loader, Traceback, fp)
+	EndArena()
 	fp:close()
+	if not ok then
+		error(d, 0)
+	end
 	
 	return d, e 
 end
@@ -6,6 +6,8 @@ local ITALIC = wg.ITALIC
 local UNDERLINE = wg.UNDERLINE
 local ParseWord = wg.parseword
 local WriteU8 = wg.writeu8
+local BeginArena = wg.beginarena
+local EndArena = wg.endarena
 local bitand = bit32.band
 local bitor = bit32.bor
 local bitxor = bit32.bxor
@@ -105,7 +107,15 @@ function ImportFileWithUI(filename, title, callback)
 		return nil
 	end
 	
-	local document = callback(fp)
+	-- As with loading, the new document gets an allocator arena of its own.
+
+	BeginArena()
+	local ok, document = xpcall(callback, Traceback, fp)
+	EndArena()
+	if not ok then
+		fp:close()
+		error(document, 0)
+	end
 	if not document then
 		ModalMessage(nil, "The import failed, probably because the file could not be found.")
 		QueueRedraw()
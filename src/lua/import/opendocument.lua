@@ -7,7 +7,8 @@ local UNDERLINE = wg.UNDERLINE
 local BOLD = wg.BOLD
 local ParseWord = wg.parseword
 local WriteU8 = wg.writeu8
-local ReadFromZip = wg.readfromzip
+local OpenZip = wg.openzip
+local TokeniseXMLNatively = wg.tokenisexml
 local bitand = bit32.band
 local bitor = bit32.bor
 local bitxor = bit32.bxor
@@ -26,44 +27,6 @@ local TEXT_NS = "urn:oasis:names:tc:opendocument:xmlns:text:1.0"
 -----------------------------------------------------------------------------
 -- The importer itself.
 
-local function parse_style(styles, xml)
-	local NAME = STYLE_NS .. " name"
-	local FAMILY = STYLE_NS .. " family"
-	local PARENT_NAME = STYLE_NS .. " parent-name"
-	local TEXT_PROPERTIES = STYLE_NS .. " text-properties"
-	local PARAGRAPH_PROPERTIES = STYLE_NS .. " paragraph-properties"
-	local FONT_STYLE = FO_NS .. " font-style"
-	local FONT_WEIGHT = FO_NS .. " font-weight"
-	local UNDERLINE_STYLE = STYLE_NS .. " text-underline-style"
-	local MARGIN_LEFT = FO_NS .. " margin-left"
-	
-	local name = xml[NAME]
-	local style =
-	{
-		parent = xml[PARENT_NAME]
-	}
-
-	for _, element in ipairs(xml) do
-		if (element._name == TEXT_PROPERTIES) then
-			if (element[FONT_STYLE] == "italic") then
-				style.italic = true
-			end
-			if (element[FONT_WEIGHT] == "bold") then
-				style.bold = true
-			end
-			if (element[UNDERLINE_STYLE] == "solid") then
-				style.underline = true
-			end
-		elseif (element._name == PARAGRAPH_PROPERTIES) then
-			if element[MARGIN_LEFT] then
-				style.indented = true
-			end
-		end
-	end
-
-	styles[name] = style
-end
-
 local function resolve_parent_styles(styles)
 	local function recursively_fetch(name, attr)
 		local style = styles[name]
@@ -84,108 +47,187 @@ local function resolve_parent_styles(styles)
 	end
 end
 
-local function collect_styles(styles, xml)
-	local STYLES = OFFICE_NS .. " styles"
-	local AUTOMATIC_STYLES = OFFICE_NS .. " automatic-styles"
-	local STYLE = STYLE_NS .. " style"
-
-	for _, element in ipairs(xml) do
-		if (element._name == STYLES) or (element._name == AUTOMATIC_STYLES) then
-			for _, element in ipairs(element) do
-				if (element._name == STYLE) then
-					parse_style(styles, element)
-				end
-			end
+local function add_words(importer, text)
+	local needsflush = false
+	if string_find(text, "^ ") then
+		needsflush = true
+	end
+	for word in string_gmatch(text, "%S+") do
+		if needsflush then
+			importer:flushword(false)
 		end
+		importer:text(word)
+		needsflush = true
+	end
+	if string_find(text, " $") then
+		importer:flushword(false)
 	end
 end
 
-local function add_text(styles, importer, xml)
+-- Streams through an ODT XML subdocument, collecting styles and feeding
+-- paragraphs to the importer as their elements close. No tree is built;
+-- the only state is a stack of what each open element means, and
+-- uninteresting subtrees are skipped by depth counting.
+
+local function import_stream(styles, importer, xml)
+	local BODY = OFFICE_NS .. " body"
+	local TEXT = OFFICE_NS .. " text"
+	local STYLES = OFFICE_NS .. " styles"
+	local AUTOMATIC_STYLES = OFFICE_NS .. " automatic-styles"
+	local STYLE = STYLE_NS .. " style"
+	local NAME = STYLE_NS .. " name"
+	local PARENT_NAME = STYLE_NS .. " parent-name"
+	local TEXT_PROPERTIES = STYLE_NS .. " text-properties"
+	local PARAGRAPH_PROPERTIES = STYLE_NS .. " paragraph-properties"
+	local FONT_STYLE = FO_NS .. " font-style"
+	local FONT_WEIGHT = FO_NS .. " font-weight"
+	local UNDERLINE_STYLE = STYLE_NS .. " text-underline-style"
+	local MARGIN_LEFT = FO_NS .. " margin-left"
+	local PARAGRAPH = TEXT_NS .. " p"
+	local HEADER = TEXT_NS .. " h"
+	local LIST = TEXT_NS .. " list"
+	local OUTLINELEVEL = TEXT_NS .. " outline-level"
+	local STYLENAME = TEXT_NS .. " style-name"
 	local SPACE = TEXT_NS .. " s"
 	local SPACECOUNT = TEXT_NS .. " c"
 	local SPAN = TEXT_NS .. " span"
-	local STYLENAME = TEXT_NS .. " style-name"
-	
-	for _, element in ipairs(xml) do
-		if (type(element) == "string") then
-			local needsflush = false
-			if string_find(element, "^ ") then
-				needsflush = true
+
+	-- modes[n] says what the nth open element is; data[n] holds whatever
+	-- that element needs when it closes.
+
+	local modes = {}
+	local data = {}
+	local depth = 0
+	local skipping = 0
+
+	for event, s1, s2, s3 in TokeniseXMLNatively(xml) do
+		if (skipping > 0) then
+			if (event == "opentag") then
+				skipping = skipping + 1
+			elseif (event == "closetag") then
+				skipping = skipping - 1
 			end
-			for word in string_gmatch(element, "%S+") do
-				if needsflush then
-					importer:flushword(false)
+		elseif (event == "opentag") then
+			local name = s1 .. " " .. s2
+			local attrs = s3
+			local parent = modes[depth]
+			local mode = "skip"
+			local d = nil
+
+			if not parent then
+				mode = "document"
+			elseif (parent == "document") then
+				if (name == BODY) then
+					mode = "body"
+					resolve_parent_styles(styles)
+				elseif (name == STYLES) or (name == AUTOMATIC_STYLES) then
+					mode = "styles"
+				end
+			elseif (parent == "body") then
+				if (name == TEXT) then
+					mode = "paragraphs"
+					d = "P"
+				end
+			elseif (parent == "styles") then
+				if (name == STYLE) then
+					mode = "style"
+					d = { parent = attrs[PARENT_NAME] }
+					local stylename = attrs[NAME]
+					if stylename then
+						styles[stylename] = d
+					end
+				end
+			elseif (parent == "style") then
+				local style = data[depth]
+				if (name == TEXT_PROPERTIES) then
+					if (attrs[FONT_STYLE] == "italic") then
+						style.italic = true
+					end
+					if (attrs[FONT_WEIGHT] == "bold") then
+						style.bold = true
+					end
+					if (attrs[UNDERLINE_STYLE] == "solid") then
+						style.underline = true
+					end
+				elseif (name == PARAGRAPH_PROPERTIES) then
+					if attrs[MARGIN_LEFT] then
+						style.indented = true
+					end
+				end
+			elseif (parent == "paragraphs") then
+				if (name == PARAGRAPH) then
+					local style = styles[attrs[STYLENAME] or ""] or {}
+					mode = "paragraph"
+					d = data[depth]
+					if style.indented then
+						d = "Q"
+					end
+				elseif (name == HEADER) then
+					local level = tonumber(attrs[OUTLINELEVEL] or 1)
+					if (level > 4) then
+						level = 4
+					end
+					mode = "paragraph"
+					d = "H"..level
+				elseif (name == LIST) then
+					mode = "list"
+				end
+			elseif (parent == "list") then
+				mode = "paragraphs"
+				d = "LB"
+			elseif (parent == "paragraph") or (parent == "inline") then
+				mode = "inline"
+				if (name == SPACE) then
+					local count = tonumber(attrs[SPACECOUNT] or 0) + 1
+					for i = 1, count do
+						importer:flushword(false)
+					end
+				elseif (name == SPAN) then
+					local style = styles[attrs[STYLENAME] or ""] or {}
+					if style.italic then
+						importer:style_on(ITALIC)
+					end
+					if style.bold then
+						importer:style_on(BOLD)
+					end
+					if style.underline then
+						importer:style_on(UNDERLINE)
+					end
+					d = style
 				end
-				importer:text(word)
-				needsflush = true
-			end
-			if string_find(element, " $") then
-				importer:flushword(false)
-			end
-		elseif (element._name == SPACE) then
-			local count = tonumber(element[SPACECOUNT] or 0) + 1
-			for i = 1, count do
-				importer:flushword(false)
-			end
-		elseif (element._name == SPAN) then
-			local stylename = element[STYLENAME] or ""
-			local style = styles[stylename] or {}
-			
-			if style.italic then
-				importer:style_on(ITALIC)
-			end
-			if style.bold then
-				importer:style_on(BOLD)
-			end
-			if style.underline then
-				importer:style_on(UNDERLINE)
-			end
-			add_text(styles, importer, element)
-			if style.underline then
-				importer:style_off(UNDERLINE)
-			end
-			if style.bold then
-				importer:style_off(BOLD)
-			end
-			if style.italic then
-				importer:style_off(ITALIC)
 			end
-		else
-			add_text(styles, importer, element)
-		end
-	end
-end
 
-local function import_paragraphs(styles, importer, xml, defaultstyle)
-	local PARAGRAPH = TEXT_NS .. " p"
-	local HEADER = TEXT_NS .. " h"
-	local LIST = TEXT_NS .. " list"
-	local OUTLINELEVEL = TEXT_NS .. " outline-level"
-	local STYLENAME = TEXT_NS .. " style-name"
-	
-	for _, element in ipairs(xml) do
-		if (element._name == PARAGRAPH) then
-			local stylename = element[STYLENAME] or ""
-			local style = styles[stylename] or {}
-			local wgstyle = defaultstyle
-			
-			if style.indented then
-				wgstyle = "Q"
+			if (mode == "skip") then
+				skipping = 1
+			else
+				depth = depth + 1
+				modes[depth] = mode
+				data[depth] = d
 			end
-			
-			add_text(styles, importer, element)
-			importer:flushparagraph(wgstyle)
-		elseif (element._name == HEADER) then
-			local level = tonumber(element[OUTLINELEVEL] or 1)
-			if (level > 4) then
-				level = 4
+		elseif (event == "closetag") then
+			local mode = modes[depth]
+			local d = data[depth]
+			if (mode == "paragraph") then
+				importer:flushparagraph(d)
+			elseif (mode == "inline") and d then
+				if d.underline then
+					importer:style_off(UNDERLINE)
+				end
+				if d.bold then
+					importer:style_off(BOLD)
+				end
+				if d.italic then
+					importer:style_off(ITALIC)
+				end
 			end
-			
-			add_text(styles, importer, element)
-			importer:flushparagraph("H"..level)
-		elseif (element._name == LIST) then
-			for _, element in ipairs(element) do
-				import_paragraphs(styles, importer, element, "LB")
+
+			modes[depth] = nil
+			data[depth] = nil
+			depth = depth - 1
+		elseif (event == "text") or (event == "cdata") then
+			local mode = modes[depth]
+			if (mode == "paragraph") or (mode == "inline") then
+				add_words(importer, s1)
 			end
 		end
 	end
@@ -201,44 +243,34 @@ function Cmd.ImportODTFile(filename)
 	
 	ImmediateMessage("Importing...")	
 
-	-- Load the styles and content subdocuments.
+	-- Load the styles and content subdocuments. The archive is opened once
+	-- and both members are read from the same handle.
 	
-	local stylesxml = ReadFromZip(filename, "styles.xml")
-	local contentxml = ReadFromZip(filename, "content.xml")
+	local zip = OpenZip(filename)
+	local stylesxml, contentxml
+	if zip then
+		stylesxml = zip:read("styles.xml")
+		contentxml = zip:read("content.xml")
+		zip:close()
+	end
 	if not stylesxml or not contentxml then
 		ModalMessage(nil, "The import failed, probably because the file could not be found.")
 		QueueRedraw()
 		return false
 	end
 		
-	stylesxml = ParseXML(stylesxml)
-	contentxml = ParseXML(contentxml)
+	-- Styles come first: styles.xml, then the automatic styles at the top
+	-- of content.xml, which are all seen before the body is reached.
 
-	-- Find out what text styles the document creates (so we can identify
-	-- italic and underlined text).
-	
 	local styles = {}
-	collect_styles(styles, stylesxml)
-	collect_styles(styles, contentxml)
-	resolve_parent_styles(styles)
-
-	-- Actually import the content.
-	
 	local document = CreateDocument()
 	local importer = CreateImporter(document)
 	importer:reset()
 
-	local BODY = OFFICE_NS .. " body"
-	local TEXT = OFFICE_NS .. " text"
-	for _, element in ipairs(contentxml) do
-		if (element._name == BODY) then
-			for _, element in ipairs(element) do
-				if (element._name == TEXT) then
-					import_paragraphs(styles, importer, element, "P")
-				end
-			end
-		end 
-	end
+	import_stream(styles, importer, stylesxml)
+	stylesxml = nil
+	import_stream(styles, importer, contentxml)
+	contentxml = nil
 
 	-- All the importers produce a blank line at the beginning of the
 	-- document (the default content made by CreateDocument()). Remove it.
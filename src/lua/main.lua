@@ -3,14 +3,36 @@
 -- file in this distribution for the full text.
 
 local int = math.floor
+local unpack = unpack or table.unpack
 local Write = wg.write
 local SetNormal = wg.setnormal
 local SetBold = wg.setbold
 local SetUnderline = wg.setunderline
 local SetReverse = wg.setreverse
 local GetStringWidth = wg.getstringwidth
+local HasPendingInput = wg.haspendinginput
+local GetChars = wg.getchars
+local GetPastedText = wg.getpastedtext
+local GetChar = wg.getchar
+local Time = wg.time
+
+-- Redraws are scheduled rather than done immediately: redrawpending records
+-- that the screen is out of date, and pendingsince when it first became so.
 
 local redrawpending = true
+local pendingsince = 0
+local lastframe = 0
+
+local redrawstats =
+{
+	requests = 0,       -- calls to QueueRedraw()
+	frames = 0,         -- frames actually drawn
+	deferredkeys = 0,   -- keys applied while a redraw was held back
+	lastframetime = 0,  -- seconds spent in the last RedrawScreen()
+	lastlatency = 0,    -- seconds from QueueRedraw() to the last frame
+	maxlatency = 0,
+	totallatency = 0
+}
 
 -- Determine the user's home directory.
 
@@ -22,7 +44,11 @@ local configfile = HOME .. "/.wordgrinder.lua"
 
 local oldcp, oldcw, oldco
 function QueueRedraw()
-	redrawpending = true
+	if not redrawpending then
+		redrawpending = true
+		pendingsince = Time()
+	end
+	redrawstats.requests = redrawstats.requests + 1
 	if Document then
 		if (oldcp ~= Document.cp) or (oldcw ~= Document.cw) or
 				(oldco ~= Document.co) then
@@ -38,6 +64,72 @@ function QueueRedraw()
 	end
 end
 
+-- Returns a snapshot of the redraw scheduler's statistics.
+
+function GetRedrawStats()
+	local s = {}
+	for k, v in pairs(redrawstats) do
+		s[k] = v
+	end
+	s.averagelatency = (s.frames > 0) and (s.totallatency / s.frames) or 0
+	return s
+end
+
+local function drawframe()
+	local start = Time()
+	RedrawScreen()
+	local now = Time()
+	
+	local latency = now - pendingsince
+	redrawstats.frames = redrawstats.frames + 1
+	redrawstats.lastframetime = now - start
+	redrawstats.lastlatency = latency
+	redrawstats.maxlatency = math.max(redrawstats.maxlatency, latency)
+	redrawstats.totallatency = redrawstats.totallatency + latency
+	
+	redrawpending = false
+	lastframe = now
+end
+
+-- Waits for the next key, drawing frames as needed. Frames are never drawn
+-- more often than the configured rate; a key which arrives while waiting
+-- for the next frame slot is returned straight away and simply folded into
+-- that frame. Once the input stops the pending frame is always drawn.
+
+local function waitforkey()
+	local settings = GlobalSettings.redraw
+	while true do
+		if redrawpending then
+			local wait = lastframe + 1/settings.maxfps - Time()
+			if (wait <= 0) then
+				drawframe()
+			else
+				local c = GetChar(wait)
+				if (c ~= "KEY_TIMEOUT") then
+					return c
+				end
+			end
+		else
+			local c = GetChar(DocumentSet.idletime)
+			if (c ~= "KEY_TIMEOUT") then
+				return c
+			end
+			FireEvent(Event.Idle)
+		end
+	end
+end
+
+do
+	local function cb()
+		GlobalSettings.redraw = GlobalSettings.redraw or {}
+		local s = GlobalSettings.redraw
+		s.maxfps = s.maxfps or 30
+		s.maxlatency = s.maxlatency or 0.25
+	end
+	
+	AddEventListener(Event.RegisterAddons, cb)
+end
+
 function ResetDocumentSet()
 	DocumentSet = CreateDocumentSet()
 	DocumentSet.menu = CreateMenu()
@@ -64,16 +156,53 @@ do
 	AddEventListener(Event.DocumentCreated, cb)
 end
 	
--- Kick the garbage collector whenever we're idle, just to keep
--- memory usage down.
+-- Run the garbage collector whenever we're idle, to keep memory usage down.
+-- A full collection of a big document takes long enough to be noticed, so
+-- it's done in incremental steps, for no more than gc.budget seconds per idle
+-- period, and abandoned as soon as a key is pressed; the next idle period
+-- carries on from where it left off. Once a cycle has finished nothing more
+-- is done until the heap grows again.
 
 do
+	local collected = nil -- heap size when the last cycle finished
+
+	local function applysettings()
+		local s = GlobalSettings.gc
+		collectgarbage("setpause", s.pause)
+		collectgarbage("setstepmul", s.stepmul)
+	end
+
 	local function cb(event)
-		collectgarbage("collect")
-		QueueRedraw()
+		local s = GlobalSettings.gc
+		applysettings()
+		if collected and (collectgarbage("count") <= collected) then
+			return
+		end
+
+		local deadline = Time() + s.budget
+		while not HasPendingInput() do
+			if collectgarbage("step", s.stepsize) then
+				collected = collectgarbage("count")
+				return
+			end
+			if (Time() >= deadline) then
+				return
+			end
+		end
+	end
+
+	local function registeraddons_cb()
+		GlobalSettings.gc = GlobalSettings.gc or {}
+		local s = GlobalSettings.gc
+		s.pause = s.pause or 200      -- see the Lua manual for these two
+		s.stepmul = s.stepmul or 200
+		s.stepsize = s.stepsize or 64 -- kB of allocation per step
+		s.budget = s.budget or 0.05   -- seconds per idle period
+		applysettings()
 	end
 
 	AddEventListener(Event.Idle, cb)
+	AddEventListener(Event.RegisterAddons, registeraddons_cb)
 end
 
 -- This function contains the word processor proper, including the main event
@@ -95,7 +224,8 @@ function WordProcessor(filename)
 
 	wg.initscreen()
 	ResizeScreen()
-	RedrawScreen()
+	pendingsince = Time()
+	drawframe()
 	
 	if filename then
 		Cmd.LoadDocumentSet(filename)
@@ -111,15 +241,50 @@ function WordProcessor(filename)
 			RedrawScreen()
 		end,
 		
-		["KEY_REDRAW"] = RedrawScreen,
+		["KEY_REDRAW"] = function()
+			InvalidateScreen()
+			RedrawScreen()
+		end,
 		
 		[" "] = { Cmd.Checkpoint, Cmd.TypeWhileSelected,
 			Cmd.SplitCurrentWord },
 		["KEY_RETURN"] = { Cmd.Checkpoint, Cmd.TypeWhileSelected,
 			Cmd.SplitCurrentParagraph },
 		["KEY_ESCAPE"] = Cmd.ActivateMenu,
+		
+		-- Pasted text arrives as a single event, and is inserted as one
+		-- undoable change.
+		["KEY_PASTE"] = function()
+			Cmd.Checkpoint()
+			Cmd.TypeWhileSelected()
+			return Cmd.InsertText(GetPastedText())
+		end,
 	}	
 		
+	local function handlekey(c)
+		-- Anything in masterkeymap overrides everything else.
+		local f = masterkeymap[c]
+		if f then
+			RunMenuAction(f)
+		else
+			-- It's not in masterkeymap. If it's printable, insert it; if it's
+			-- not, look it up in the menu hierarchy.
+			
+			if not c:match("^KEY_") then
+				Cmd.Checkpoint()
+				Cmd.TypeWhileSelected()
+				Cmd.InsertStringIntoWord(c)
+			else
+				f = DocumentSet.menu:lookupAccelerator(c)
+				if f then
+					RunMenuAction(f)
+				else
+					NonmodalMessage(c:gsub("^KEY_", "").." is not bound --- try ESCAPE for a menu")
+				end
+			end
+		end
+	end
+	
 	local function eventloop()
 		local nl = string.char(13)
 		while true do
@@ -130,39 +295,22 @@ function WordProcessor(filename)
 			
 			FlushAsyncEvents()
 			FireEvent(Event.WaitingForUser)
-			local c = "KEY_TIMEOUT"
-			while (c == "KEY_TIMEOUT") do
-				if redrawpending then
-					RedrawScreen()
-					redrawpending = false
-				end
-			
-				c = wg.getchar(DocumentSet.idletime)
-				if (c == "KEY_TIMEOUT") then
-					FireEvent(Event.Idle)
-				end
-			end
+			local c = waitforkey()
 			
 			ResetNonmodalMessages()
+			handlekey(c)
 			
-			-- Anything in masterkeymap overrides everything else.
-			local f = masterkeymap[c]
-			if f then
-				RunMenuAction(f)
-			else
-				-- It's not in masterkeymap. If it's printable, insert it; if it's
-				-- not, look it up in the menu hierarchy.
-				
-				if not c:match("^KEY_") then
-					Cmd.Checkpoint()
-					Cmd.TypeWhileSelected()
-					Cmd.InsertStringIntoWord(c)
-				else
-					f = DocumentSet.menu:lookupAccelerator(c)
-					if f then
-						RunMenuAction(f)
-					else
-						NonmodalMessage(c:gsub("^KEY_", "").." is not bound --- try ESCAPE for a menu")
+			-- Apply anything else which has already been typed before
+			-- redrawing, so that typing ahead doesn't cost a redraw per key;
+			-- but don't hold the screen back for longer than maxlatency.
+			
+			local maxlatency = GlobalSettings.redraw.maxlatency
+			while HasPendingInput() and
+					(not redrawpending or ((Time() - pendingsince) < maxlatency)) do
+				for _, c in ipairs(GetChars()) do
+					handlekey(c)
+					if redrawpending then
+						redrawstats.deferredkeys = redrawstats.deferredkeys + 1
 					end
 				end
 			end
@@ -206,7 +354,7 @@ Options:
    -h    --help                Displays this message.
          --lua file.lua        Loads and executes file.lua and then exits
 		                       (or file.lua can be some Lua statements)
-   -c    --convert src dest    Converts from one file format to another
+   -c    --convert src dest... Converts from one file format to others
          --config file.lua     Sets the name of the user config file
 
 Only one filename may be specified, which is the name of a WordGrinder
@@ -217,6 +365,11 @@ extension. To specify a document name, use :name as a suffix. e.g.:
 
     wordgrinder --convert filename.wg:"Chapter 1" chapter1.odt
 
+If several destinations are given, the document is read once and all the
+exported files are written in a single pass over it:
+
+    wordgrinder --convert filename.wg chapter1.odt chapter1.html chapter1.txt
+
 The user config file is a Lua file which is loaded and executed before
 the program starts up (but after any --lua files). It defaults to:
 
@@ -248,12 +401,23 @@ the program starts up (but after any --lua files). It defaults to:
 			os.exit(0)
 		end
 		
-		local function do_convert(opt1, opt2)
-			if not opt1 or not opt2 then
-				CLIError("--convert must have two arguments")
+		local function do_convert(opt1, ...)
+			-- Every following argument up to the next option is a
+			-- destination.
+			
+			local dests = {}
+			for _, o in ipairs({...}) do
+				if (o:byte(1) == 45) then
+					break
+				end
+				dests[#dests+1] = o
+			end
+			
+			if not opt1 or (#dests == 0) then
+				CLIError("--convert must have at least two arguments")
 			end
 			
-			CliConvert(opt1, opt2)
+			CliConvert(opt1, unpack(dests))
 		end
 		
 		local function do_config(opt1, opt2)
@@ -308,7 +472,7 @@ the program starts up (but after any --lua files). It defaults to:
 					if not fn then
 						unrecognisedarg("--"..o)
 					end
-					i = i + fn(arg[i+1], arg[i+2])
+					i = i + fn(unpack(arg, i+1))
 				else
 					-- ...without a -- prefix.
 					local od = o:sub(2, 2)
@@ -318,7 +482,7 @@ the program starts up (but after any --lua files). It defaults to:
 					end
 					op = o:sub(3)
 					if (op == "") then
-						i = i + fn(arg[i+1], arg[i+2])
+						i = i + fn(unpack(arg, i+1))
 					else
 						fn(op)
 					end
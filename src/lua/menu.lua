@@ -112,6 +112,7 @@ local GlobalSettingsMenu = addmenu("Global settings",
 	{"FSWidescreen", "W", "Widescreen mode...",      nil,         Cmd.ConfigureWidescreen},
 	"-",
 	{"FSDebug",    "D", "Debugging options...",      nil,         Cmd.ConfigureDebug},
+	{"FSRenderStats", "R", "Rendering statistics...", nil,        Cmd.DumpRenderStats},
 })
 
 local FileMenu = addmenu("File",
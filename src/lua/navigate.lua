@@ -808,18 +808,12 @@ function Cmd.Copy(keepselection)
 	end
 end
 
-function Cmd.Paste()
-	local buffer = DocumentSet:getClipboard()
-	if not buffer then
-		return false
-	end
-	if Document.mp then
-		if not Cmd.Delete() then
-			return false
-		end
-	end
-	
-	-- Insert the first paragraph of the clipboard into the current paragraph.
+-- Inserts a list of paragraphs at the cursor position. The first and last
+-- are merged into the paragraph being edited; any in between are added
+-- whole.
+
+local function insertparagraphs(buffer)
+	-- Insert the first paragraph of the buffer into the current paragraph.
 	
 	local cw = Document.cw
 	Cmd.SplitCurrentWord()
@@ -885,11 +879,62 @@ function Cmd.Paste()
 
 	-- Splice the last word of the section just pasted.
 	
-	NonmodalMessage("Clipboard copied to cursor position.")
 	return Cmd.GotoBeginningOfWord() and Cmd.GotoPreviousCharW()
 		and Cmd.JoinWithNextWord()
 end
 
+function Cmd.Paste()
+	local buffer = DocumentSet:getClipboard()
+	if not buffer then
+		return false
+	end
+	if Document.mp then
+		if not Cmd.Delete() then
+			return false
+		end
+	end
+	
+	NonmodalMessage("Clipboard copied to cursor position.")
+	return insertparagraphs(buffer)
+end
+
+-- Inserts a block of plain text at the cursor position, such as a paste
+-- from the terminal. Each line becomes a paragraph. The paragraphs are all
+-- built first and then inserted in one go.
+
+function Cmd.InsertText(text)
+	if not text then
+		return false
+	end
+	
+	local lines = {}
+	for l in (text.."\n"):gmatch("([^\n]*)\n") do
+		lines[#lines+1] = CanonicaliseString(l):gsub("\t", " "):gsub("%c+", "")
+	end
+	
+	-- The text is spliced onto the words either side of the cursor, so
+	-- whitespace at either end has to become an empty word to keep them
+	-- apart.
+	
+	local style = DocumentSet.styles["P"]
+	local buffer = {}
+	for i, l in ipairs(lines) do
+		local words = ParseStringIntoWords(l)
+		if (words[1] ~= "") then
+			if (i == 1) and l:find("^ ") then
+				table.insert(words, 1, "")
+			end
+			if (i == #lines) and l:find(" $") then
+				words[#words+1] = ""
+			end
+		end
+		buffer[i] = CreateParagraph(style, words)
+	end
+	
+	QueueRedraw()
+	return insertparagraphs(buffer)
+end
+
 function Cmd.Delete()
 	if not Document.mp then
 		return false
@@ -6,6 +6,7 @@ local int = math.floor
 local Write = wg.write
 local GotoXY = wg.gotoxy
 local ClearArea = wg.cleararea
+local ScrollArea = wg.scrollarea
 local SetNormal = wg.setnormal
 local SetBold = wg.setbold
 local SetBright = wg.setbright
@@ -13,6 +14,9 @@ local SetUnderline = wg.setunderline
 local SetReverse = wg.setreverse
 local SetDim = wg.setdim
 local GetStringWidth = wg.getstringwidth
+local GetDrawCount = wg.getdrawcount
+local Time = wg.time
+local AddRedrawTime = wg.addredrawtime
 
 local messages = {}
 local leftpadding = 0
@@ -34,16 +38,19 @@ function ResizeScreen()
 	Document:wrap(w - Document.margin - 1)
 end
 
-local function drawmargin(y, pn, p)
+local function getmargin(pn, p)
 	local controller = MarginControllers[Document.viewmode]
 	if controller.getcontent then
-		local s = controller:getcontent(pn, p)
+		return controller:getcontent(pn, p) or false
+	end
+	return false
+end
 
-		if s then
-			SetDim()
-			RAlignInField(leftpadding, y, Document.margin - 1, s)
-			SetNormal()
-		end
+local function drawmargin(y, s, p)
+	if s then
+		SetDim()
+		RAlignInField(leftpadding, y, Document.margin - 1, s)
+		SetNormal()
 	end
 	
 	local bullet = p.style.bullet
@@ -61,6 +68,17 @@ local changed_tab =
 	[true] = "CHANGED"
 }
 
+-- The status bar and messages occupy this many rows at the bottom of the
+-- screen.
+
+local function getstatusheight()
+	local h = #messages
+	if DocumentSet.statusbar then
+		h = h + 1
+	end
+	return h
+end
+
 local function redrawstatus()
 	local y = ScreenHeight - 1
 
@@ -149,11 +167,113 @@ local function drawbottommarker(y)
 	SetNormal()
 end
 
-function RedrawScreen()
-	wg.clearscreen()
+-- What was last drawn on each screen row: a paragraph and one of its
+-- wrapped lines (both immutable, so their identity stands for their
+-- contents), plus the margin text. Rows whose contents haven't changed
+-- since the last frame are left alone. Anything else drawing on the screen
+-- bumps the draw count, which forces the next frame to be drawn in full,
+-- as does a change in the screen geometry.
+
+local BLANK = {}
+local TOPMARKER = {}
+local BOTTOMMARKER = {}
+local OVERLAY = {}
+
+local rowparagraph = {}
+local rowline = {}
+local rowmargin = {}
+local lastdrawcount = nil
+local lastgeometry = nil
+local fullredraw = true
+
+-- What each row should show this frame. The margin is nil for all but the
+-- first line of a paragraph.
+
+local layoutparagraph = {}
+local layoutline = {}
+local layoutmargin = {}
+local layoutpn = {}
+local layoutframe = {}
+local frame = 0
+
+-- Forces the next redraw to repaint every row.
+
+function InvalidateScreen()
+	fullredraw = true
+end
+
+-- If the new layout is mostly the last frame shifted vertically, returns
+-- the number of rows to scroll up by (negative for down); otherwise 0.
+
+local function findscroll(height)
+	local shift
+	for y = 0, height-1 do
+		local p = layoutparagraph[y]
+		if (p ~= BLANK) then
+			local l = layoutline[y]
+			for oy = 0, height-1 do
+				if (rowparagraph[oy] == p) and (rowline[oy] == l) then
+					shift = oy - y
+					break
+				end
+			end
+			if shift then
+				break
+			end
+		end
+	end
+	if not shift or (shift == 0) then
+		return 0
+	end
+	
+	local matches = 0
+	for y = 0, height-1 do
+		local oy = y + shift
+		if (oy >= 0) and (oy < height) and
+				(rowparagraph[oy] == layoutparagraph[y]) and
+				(rowline[oy] == layoutline[y]) and
+				(rowmargin[oy] == layoutmargin[y]) then
+			matches = matches + 1
+		end
+	end
+	if (matches*2 <= height) then
+		return 0
+	end
+	return shift
+end
+
+local function redrawscreen()
 	local cp, cw, co = Document.cp, Document.cw, Document.co
 	local cy = int(ScreenHeight / 2)
 	local margin = Document.margin
+	local mp = Document.mp
+	
+	-- Work out whether anything can be reused from the last frame. (Marked
+	-- lines depend on the mark, too, so those frames are always drawn in
+	-- full.)
+	
+	local geometry = ScreenWidth.."x"..ScreenHeight.."+"..leftpadding.."+"..
+		margin.." "..tostring(Document.viewmode)
+	local full = fullredraw or mp or
+		(GetDrawCount() ~= lastdrawcount) or
+		(geometry ~= lastgeometry)
+	fullredraw = false
+	lastgeometry = geometry
+	frame = frame + 1
+	
+	-- Rows covered by the status bar are redrawn every time.
+	
+	local statustop = ScreenHeight - getstatusheight()
+	
+	local function place(y, paragraph, line, marginstring, pn)
+		if (y >= 0) and (y < statustop) then
+			layoutparagraph[y] = paragraph
+			layoutline[y] = line
+			layoutmargin[y] = marginstring
+			layoutpn[y] = pn
+			layoutframe[y] = frame
+		end
+	end
 	
 	-- Find out the offset of the current paragraph.
 	
@@ -174,13 +294,7 @@ function RedrawScreen()
 			(paragraph.style.indent or 0), cy - 1)	
 	end
 	
-	-- Cache values for mark drawing.
-	
-	local mp = Document.mp
-	local mw = Document.mw
-	local mo = Document.mo
-	
-	-- Draw backwards.
+	-- Lay out backwards.
 	
 	local pn = cp - 1
 	local y = cy - cl - 1 - Document:spaceAbove(cp)
@@ -194,20 +308,14 @@ function RedrawScreen()
 		end
 	
 		local lines = paragraph:wrap()
-		local x = paragraph.style.indent or 0 -- FIXME
+		local marginstring = getmargin(pn, paragraph)
 		for ln = #lines, 1, -1 do
 			local l = lines[ln]
 			
-			if not mp then
-				paragraph:renderLine(l,
-					leftpadding + margin + x, y)
-			else
-				paragraph:renderMarkedLine(l,
-					leftpadding + margin + x, y, nil, pn)
-			end
-			
 			if (ln == 1) then
-				drawmargin(y, pn, paragraph)
+				place(y, paragraph, l, marginstring, pn)
+			else
+				place(y, paragraph, l, nil, pn)
 			end
 			
 			Document.topp = pn
@@ -224,10 +332,10 @@ function RedrawScreen()
 	end
 	
 	if (y >= 0) then
-		drawtopmarker(y)
+		place(y, TOPMARKER, TOPMARKER, nil)
 	end
 	
-	-- Draw forwards.
+	-- Lay out forwards.
 	
 	y = cy - cl
 	pn = cp
@@ -237,16 +345,12 @@ function RedrawScreen()
 			break
 		end
 		
-		drawmargin(y, pn, paragraph)		
-
-		local x = paragraph.style.indent or 0 -- FIXME
+		local marginstring = getmargin(pn, paragraph)
 		for ln, l in ipairs(paragraph:wrap()) do
-			if not mp then
-				paragraph:renderLine(l,
-					leftpadding + margin + x, y)
+			if (ln == 1) then
+				place(y, paragraph, l, marginstring, pn)
 			else
-				paragraph:renderMarkedLine(l,
-					leftpadding + margin + x, y, nil, pn)
+				place(y, paragraph, l, nil, pn)
 			end
 	
 			-- If the top of the page hasn't already been set, then the
@@ -278,12 +382,101 @@ function RedrawScreen()
 	end
 	
 	if (y <= ScreenHeight) then
-		drawbottommarker(y)
+		place(y, BOTTOMMARKER, BOTTOMMARKER, nil)
+	end
+	
+	-- Anything not laid out this frame is blank.
+	
+	for y = 0, statustop-1 do
+		if (layoutframe[y] ~= frame) then
+			place(y, BLANK, BLANK, nil)
+		end
+	end
+	
+	-- If the text has just moved up or down, scroll what's already on the
+	-- screen to match, so only the newly exposed rows need drawing.
+	
+	if full then
+		wg.clearscreen()
+	else
+		local shift = findscroll(statustop)
+		if (shift ~= 0) then
+			ScrollArea(0, statustop-1, shift)
+			
+			local from, to, step = 0, statustop-1, 1
+			if (shift < 0) then
+				from, to, step = to, from, -1
+			end
+			for y = from, to, step do
+				local oy = y + shift
+				if (oy >= 0) and (oy < statustop) then
+					rowparagraph[y] = rowparagraph[oy]
+					rowline[y] = rowline[oy]
+					rowmargin[y] = rowmargin[oy]
+				else
+					rowparagraph[y] = BLANK
+					rowline[y] = BLANK
+					rowmargin[y] = nil
+				end
+			end
+		end
+	end
+	
+	-- Draw the rows which differ from what's already there.
+	
+	for y = 0, statustop-1 do
+		local paragraph = layoutparagraph[y]
+		local l = layoutline[y]
+		local marginstring = layoutmargin[y]
+		
+		if full or (rowparagraph[y] ~= paragraph) or
+				(rowline[y] ~= l) or (rowmargin[y] ~= marginstring) then
+			rowparagraph[y] = paragraph
+			rowline[y] = l
+			rowmargin[y] = marginstring
+			if not full then
+				ClearArea(0, y, ScreenWidth-1, y)
+			end
+			
+			if (paragraph == TOPMARKER) then
+				drawtopmarker(y)
+			elseif (paragraph == BOTTOMMARKER) then
+				drawbottommarker(y)
+			elseif (paragraph ~= BLANK) then
+				local x = paragraph.style.indent or 0 -- FIXME
+				if not mp then
+					paragraph:renderLine(l,
+						leftpadding + margin + x, y)
+				else
+					paragraph:renderMarkedLine(l,
+						leftpadding + margin + x, y, nil, layoutpn[y])
+				end
+				
+				if (marginstring ~= nil) then
+					drawmargin(y, marginstring, paragraph)
+				end
+			end
+		end
+	end
+	for y = statustop, ScreenHeight-1 do
+		rowparagraph[y] = OVERLAY
+		rowline[y] = OVERLAY
+		rowmargin[y] = nil
 	end
 	
 	redrawstatus()
 	
 	FireEvent(Event.Redraw)
+	lastdrawcount = GetDrawCount()
+end
+
+-- Wraps the real work so that the time spent can be added to the rendering
+-- statistics (see wg.renderstats()).
+
+function RedrawScreen()
+	local before = Time()
+	redrawscreen()
+	AddRedrawTime(Time() - before)
 end
 
 -----------------------------------------------------------------------------
@@ -132,12 +132,21 @@ function TableToString(t)
 end
 
 --- Return a partially immutable proxy for an object.
--- This only handles direct assignment to array members.
+-- This only handles direct assignment to array members. The proxy relies on
+-- the __len and __ipairs metamethods, which plain LuaJIT ignores on tables;
+-- there the object is returned unchanged and the check is lost.
 --
 -- @param o                  object
 -- @return                   the proxy
 
+local haslenmetamethod =
+	(#setmetatable({}, {__len = function() return 1 end}) == 1)
+
 function ImmutabliseArray(o)
+	if not haslenmetamethod then
+		return o
+	end
+
 	local p = {}
 	setmetatable(p,
 		{
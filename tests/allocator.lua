@@ -0,0 +1,38 @@
+require("tests/testsuite")
+
+local stats = wg.allocstats()
+AssertEquals(true, stats.requested > 0)
+AssertEquals(true, stats.highwater >= stats.total)
+if stats.pooling then
+	AssertEquals(true, stats.pooled <= stats.slabbytes)
+	AssertEquals(true, stats.fragmentation >= 0)
+	AssertEquals(true, stats.fragmentation < 1)
+end
+
+-- Everything allocated inside an arena is counted against it. Allocate
+-- enough to need more slabs than the allocator keeps spare.
+
+wg.beginarena()
+local t = {}
+for i = 1, 20000 do
+	t[i] = {tostring(i)}
+end
+wg.endarena()
+
+stats = wg.allocstats()
+if stats.pooling then
+	AssertEquals(true, stats.arenabytes >= 20000 * 32)
+	AssertEquals(true, stats.arenaslabs > 64)
+end
+
+-- Freeing the arena's contents empties its slabs, and the ones which won't
+-- fit in the spare list are given back.
+
+t = nil
+collectgarbage("collect")
+local after = wg.allocstats()
+if stats.pooling then
+	AssertEquals(true, (stats.pooled - after.pooled) >= 20000 * 32)
+	AssertEquals(true, after.slabsreleased > stats.slabsreleased)
+	AssertEquals(true, after.slabs < stats.slabs)
+end
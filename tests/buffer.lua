@@ -0,0 +1,58 @@
+require("tests/testsuite")
+
+local buffer = wg.createbuffer(16)
+AssertEquals(0, buffer:len())
+AssertEquals(5, buffer:append("one", 23))
+AssertEquals(10, buffer:appendf(" %s%03d", "x", 7))
+AssertEquals(10, #buffer)
+AssertEquals("one23 x007", buffer:tostring())
+AssertEquals("one23 x007", tostring(buffer))
+
+-- Growth past the initial size.
+
+local chunks = {}
+for i = 1, 10000 do
+	chunks[#chunks+1] = tostring(i)
+	buffer:append(chunks[#chunks])
+end
+AssertEquals("one23 x007"..table.concat(chunks), buffer:tostring())
+
+-- appendu8 encodes a character as UTF-8.
+
+local u8 = wg.createbuffer(16)
+AssertEquals(1, u8:appendu8(65))
+AssertEquals(3, u8:appendu8(0xe9))
+AssertEquals(6, u8:appendu8(0x65e5))
+AssertEquals("A"..wg.writeu8(0xe9)..wg.writeu8(0x65e5), u8:tostring())
+
+-- Buffers can be appended to buffers, and passed to wg.compress.
+
+local other = wg.createbuffer()
+other:append(buffer, "!")
+AssertEquals(buffer:tostring().."!", other:tostring())
+AssertEquals(other:tostring(), wg.decompress(wg.compress(other)))
+
+-- A buffer can be appended to itself, even when that makes it grow.
+
+local doubled = wg.createbuffer(16)
+doubled:append("0123456789abcdef")
+AssertEquals(32, doubled:append(doubled))
+AssertEquals(64, doubled:append(doubled))
+AssertEquals(string.rep("0123456789abcdef", 4), doubled:tostring())
+
+-- Flushing writes the contents to a file and empties the buffer.
+
+local filename = os.tmpname()
+local fp = io.open(filename, "wb")
+buffer:clear()
+buffer:append("hello ")
+AssertEquals(true, buffer:flushto(fp))
+AssertEquals(0, buffer:len())
+buffer:append("world")
+AssertEquals(true, buffer:flushto(fp))
+fp:close()
+
+fp = io.open(filename, "rb")
+AssertEquals("hello world", fp:read("*a"))
+fp:close()
+os.remove(filename)
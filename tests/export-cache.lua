@@ -0,0 +1,50 @@
+require("tests/testsuite")
+
+local function readfile(filename)
+	local fp = io.open(filename)
+	local s = fp:read("*a")
+	fp:close()
+	return s
+end
+
+Cmd.InsertStringIntoParagraph("one")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("two")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("three")
+
+local filename = os.tmpname()
+
+-- The first export renders every paragraph; the second renders none.
+
+local hits, misses = GetExportFragmentCacheStats()
+AssertEquals(true, Cmd.ExportHTMLFile(filename))
+local h, m = GetExportFragmentCacheStats()
+AssertEquals(0, h - hits)
+AssertEquals(3, m - misses)
+local first = readfile(filename)
+
+AssertEquals(true, Cmd.ExportHTMLFile(filename))
+hits, misses = GetExportFragmentCacheStats()
+AssertEquals(3, hits - h)
+AssertEquals(0, misses - m)
+AssertEquals(first, readfile(filename))
+
+-- Editing a paragraph replaces it, so only that one is rendered again.
+
+Cmd.InsertStringIntoParagraph("four")
+AssertEquals(true, Cmd.ExportHTMLFile(filename))
+h, m = GetExportFragmentCacheStats()
+AssertEquals(2, h - hits)
+AssertEquals(1, m - misses)
+AssertEquals(true, readfile(filename):find("<p>threefour</p>", 1, true) ~= nil)
+
+-- Changing the settings changes the format, so nothing is reused.
+
+DocumentSet.addons.htmlexport.bold_on = "<strong>"
+AssertEquals(true, Cmd.ExportHTMLFile(filename))
+hits, misses = GetExportFragmentCacheStats()
+AssertEquals(0, hits - h)
+AssertEquals(3, misses - m)
+
+os.remove(filename)
@@ -0,0 +1,41 @@
+require("tests/testsuite")
+
+local B = wg.createstylebyte(wg.BOLD)
+local I = wg.createstylebyte(wg.ITALIC)
+local N = wg.createstylebyte(0)
+
+local format = wg.createexportformat {
+	italic_on = "<i>",
+	italic_off = "</i>",
+	bold_on = "<b>",
+	bold_off = "</b>",
+	escapes = { ["&"] = "&amp;", [" "] = "_" },
+	unicode = "[%04X]"
+}
+
+AssertEquals("a&amp;b[00E9]", format:escape("a&bé"))
+AssertEquals("one_<b>two</b>_<i>thr</i>ee_<b>four</b>",
+	format:renderwords({"one", B.."two", I.."thr"..N.."ee"..N, B.."four"}))
+AssertEquals("x_<b>y_z</b>", format:renderwords({"x", B.."y", B.."z"}))
+AssertEquals("<b>&</b> ", format:renderwords({B.."&", ""}, true))
+AssertEquals(false, (pcall(wg.createexportformat, { unicode = "%d" })))
+
+-- The exporters render through formats; check the escaping survives.
+
+Cmd.InsertStringIntoParagraph("Fish & chips <now> 100%")
+local filename = os.tmpname()
+
+AssertEquals(true, Cmd.ExportHTMLFile(filename))
+local fp = io.open(filename)
+local s = fp:read("*a")
+fp:close()
+AssertEquals(true, s:find("<p>Fish &amp; chips &lt;now&gt; 100%</p>", 1, true) ~= nil)
+
+AssertEquals(true, Cmd.ExportLatexFile(filename))
+fp = io.open(filename)
+s = fp:read("*a")
+fp:close()
+AssertEquals(true, s:find("Fish \\& chips $\\langle$now$\\rangle$ 100\\%", 1, true) ~= nil)
+
+AssertEquals(true, Cmd.ExportTroffFile(filename))
+os.remove(filename)
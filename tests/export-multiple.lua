@@ -0,0 +1,70 @@
+require("tests/testsuite")
+
+local function readfile(filename)
+	local fp = io.open(filename)
+	local s = fp:read("*a")
+	fp:close()
+	return s
+end
+
+Cmd.InsertStringIntoParagraph("Fish & chips")
+Cmd.SplitCurrentParagraph()
+Cmd.ChangeParagraphStyle("LB")
+Cmd.InsertStringIntoParagraph(".first <item>")
+Cmd.SplitCurrentParagraph()
+Cmd.ChangeParagraphStyle("P")
+Cmd.InsertStringIntoParagraph("the end")
+
+-- Exporting to several files at once must produce exactly what exporting
+-- to each one individually does. Two troff files check that style runs
+-- are fanned out to more than one callback-driven exporter.
+
+local base = os.tmpname()
+local single = {}
+local multiple = {}
+for _, e in ipairs({"html", "txt", "tex", "tr"}) do
+	single[#single+1] = base.."-single."..e
+	multiple[#multiple+1] = base.."-multiple."..e
+end
+multiple[#multiple+1] = base.."-multiple2.tr"
+
+AssertEquals(true, Cmd.ExportHTMLFile(single[1]))
+AssertEquals(true, Cmd.ExportTextFile(single[2]))
+AssertEquals(true, Cmd.ExportLatexFile(single[3]))
+AssertEquals(true, Cmd.ExportTroffFile(single[4]))
+
+AssertEquals(true, ExportToMultipleFiles(Document, multiple))
+for i = 1, #single do
+	AssertEquals(readfile(single[i]), readfile(multiple[i]))
+end
+AssertEquals(readfile(single[4]), readfile(multiple[5]))
+
+AssertEquals("Fish & chips\n.first <item>\nthe end\n", readfile(multiple[2]))
+
+local r, e = ExportToMultipleFiles(Document, {base..".unknown"})
+AssertEquals(nil, r)
+
+-- Write errors, whether they happen while exporting or when the file is
+-- closed, are reported.
+
+if io.open("/dev/full") then
+	local writer, close = OpenExportFile("/dev/full")
+	writer(string.rep("x", 128*1024))
+	writer("more")
+	local r, e = close()
+	AssertEquals(nil, r)
+	AssertEquals("string", type(e))
+
+	writer, close = OpenExportFile("/dev/full")
+	writer("x")
+	r, e = close()
+	AssertEquals(nil, r)
+end
+
+for _, f in ipairs(single) do
+	os.remove(f)
+end
+for _, f in ipairs(multiple) do
+	os.remove(f)
+end
+os.remove(base)
@@ -0,0 +1,39 @@
+require("tests/testsuite")
+
+-- This runs the real event loop in the headless build. Keys are queued up
+-- front; once they've all been dealt with the editor goes idle, which is
+-- when the scheduler's statistics are checked.
+
+wg.queuekeys("one two three")
+
+local Time = wg.time
+local start = Time()
+AddEventListener(Event.Idle,
+	function()
+		local ok, e = pcall(
+			function()
+				local stats = GetRedrawStats()
+
+				-- The first frame, plus at least one for the typing.
+
+				AssertEquals(true, stats.frames >= 2)
+
+				-- The keys after the first arrived while a redraw was
+				-- pending, and were folded into it.
+
+				AssertEquals(true, stats.deferredkeys > 0)
+
+				-- No frame can have waited longer than the test has run.
+
+				AssertEquals(true, stats.maxlatency >= 0)
+				AssertEquals(true, stats.maxlatency <= (Time() - start))
+				AssertEquals(true, stats.averagelatency <= stats.maxlatency)
+			end)
+		if not ok then
+			print(e)
+			os.exit(1)
+		end
+		os.exit(0)
+	end)
+
+WordProcessor()
@@ -0,0 +1,38 @@
+require("tests/testsuite")
+
+-- This runs in the headless build, which counts the cells which change from
+-- frame to frame the same way the X11 and Windows backends do.
+
+wg.initscreen()
+ResizeScreen()
+-- Alternate long and short paragraphs, so that anything drawn a paragraph
+-- out of place shows up.
+
+for i = 1, 60 do
+	Cmd.InsertStringIntoParagraph(string.rep("x", (i % 2) * 50 + 1))
+	Cmd.SplitCurrentParagraph()
+end
+Cmd.GotoBeginningOfDocument()
+for i = 1, 20 do
+	Cmd.GotoNextParagraph()
+end
+
+local function cellschanged()
+	RedrawScreen()
+	wg.sync()
+	local _, frame = wg.renderstats()
+	return frame.cellschanged
+end
+
+cellschanged()
+AssertEquals(0, cellschanged())
+
+-- Moving down a paragraph scrolls the screen by two rows (the paragraph and
+-- the gap after it). Only the rows scrolled in, and the few cells whose
+-- contents really did change, are counted.
+
+Cmd.GotoNextParagraph()
+AssertEquals(true, cellschanged() <= (2 * ScreenWidth))
+
+Cmd.GotoPreviousParagraph()
+AssertEquals(true, cellschanged() <= (2 * ScreenWidth))
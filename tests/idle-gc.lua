@@ -0,0 +1,32 @@
+require("tests/testsuite")
+
+-- The collector settings are applied when idle.
+
+local s = GlobalSettings.gc
+s.pause = 150
+s.stepmul = 300
+s.budget = 10
+FireEvent(Event.Idle)
+AssertEquals(150, collectgarbage("setpause", 200))
+AssertEquals(300, collectgarbage("setstepmul", 200))
+s.pause = 200
+s.stepmul = 200
+
+-- Idling finishes a collection cycle (given enough time), which frees
+-- garbage.
+
+collectgarbage("collect")
+local base = collectgarbage("count")
+collectgarbage("stop")
+do
+	local t = {}
+	for i = 1, 100000 do
+		t[i] = {i}
+	end
+end
+local before = collectgarbage("count")
+AssertEquals(true, before > (base + 1000))
+
+FireEvent(Event.Idle)
+collectgarbage("restart")
+AssertEquals(true, collectgarbage("count") < (base + 1000))
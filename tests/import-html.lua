@@ -0,0 +1,48 @@
+require("tests/testsuite")
+
+local function tokens(html)
+	local t = {}
+	for event, s1, s2 in wg.tokenisehtml(html, HTMLEntities) do
+		t[#t+1] = event..":"..tostring(s1)..
+			((event == "opentag") and (":"..tostring(s2)) or "")
+	end
+	return t
+end
+
+AssertTableEquals(
+	{
+		"opentag:p:false", "text:a<b", "space:3", "text:R&D\194\160é&bogus;",
+		"opentag:br:true", "text:x", "newline:nil", "closetag:p",
+		"opentag:script:false", "closetag:script", "text:<", "space:1", "text:i"
+	},
+	tokens('<P CLASS="a>b">a&lt;b \t R&amp;D&nbsp;&#xe9;&bogus;<Br/>x\n'..
+		'<!-- gone --></p><!DOCTYPE x><script>if (a<b) x();</SCRIPT>< i\001'))
+
+local filename = os.tmpname()
+local fp = io.open(filename, "w")
+fp:write([[<html><head><title>Ignored</title></head>
+<BODY bgcolor="white">
+<H1 id="top">The heading</H1>
+<p>Some <b>bold</b> and <EM>italic</EM> text&mdash;with entities.
+<ul><li>One<li>Two</ul>
+<pre>line one
+line two</pre>
+<script type="text/javascript">document.write("<p>junk</p>");</script>
+</body></html>]])
+fp:close()
+
+AssertEquals(true, Cmd.ImportHTMLFile(filename))
+os.remove(filename)
+
+AssertEquals(6, #Document)
+AssertEquals("H1", Document[1].style.name)
+AssertTableEquals({"The", "heading"}, Document[1])
+AssertEquals("P", Document[2].style.name)
+AssertTableEquals({"Some", "\024bold", "and", "\017italic", "text—with",
+	"entities."}, Document[2])
+AssertEquals("LB", Document[3].style.name)
+AssertTableEquals({"One"}, Document[3])
+AssertTableEquals({"Two"}, Document[4])
+AssertEquals("PRE", Document[5].style.name)
+AssertTableEquals({"line", "one"}, Document[5])
+AssertTableEquals({"line", "two"}, Document[6])
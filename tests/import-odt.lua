@@ -0,0 +1,57 @@
+require("tests/testsuite")
+
+local filename = os.tmpname()
+
+local OFFICE = 'xmlns:office="urn:oasis:names:tc:opendocument:xmlns:office:1.0" '..
+	'xmlns:style="urn:oasis:names:tc:opendocument:xmlns:style:1.0" '..
+	'xmlns:fo="urn:oasis:names:tc:opendocument:xmlns:xsl-fo-compatible:1.0" '..
+	'xmlns:text="urn:oasis:names:tc:opendocument:xmlns:text:1.0"'
+
+local zip = wg.createzip(filename)
+zip:write("mimetype", "application/vnd.oasis.opendocument.text")
+zip:write("styles.xml", [[<?xml version="1.0" encoding="UTF-8"?>
+<office:document-styles ]]..OFFICE..[[>
+  <office:styles>
+    <style:style style:name="Emphasis" style:family="text">
+      <style:text-properties fo:font-style="italic"/>
+    </style:style>
+    <style:style style:name="Quotation" style:family="paragraph">
+      <style:paragraph-properties fo:margin-left="1cm"/>
+    </style:style>
+  </office:styles>
+</office:document-styles>]])
+zip:write("content.xml", [[<?xml version="1.0" encoding="UTF-8"?>
+<office:document-content ]]..OFFICE..[[>
+  <office:automatic-styles>
+    <style:style style:name="T1" style:parent-style-name="x" style:family="text">
+      <style:text-properties fo:font-weight="bold"/>
+    </style:style>
+    <style:style style:name="P1" style:parent-name="Quotation"/>
+  </office:automatic-styles>
+  <office:body>
+    <office:text>
+      <text:sequence-decls><text:p>ignored</text:p></text:sequence-decls>
+      <text:h text:outline-level="2">A heading</text:h>
+      <text:p>One <text:span text:style-name="T1">bold</text:span> and <text:span text:style-name="Emphasis">italic</text:span> word.<text:s/>Spaced &amp; done</text:p>
+      <text:p text:style-name="P1">Quoted</text:p>
+      <text:list>
+        <text:list-item><text:p>Item</text:p></text:list-item>
+      </text:list>
+    </office:text>
+  </office:body>
+</office:document-content>]])
+zip:close()
+
+AssertEquals(true, Cmd.ImportODTFile(filename))
+os.remove(filename)
+
+AssertEquals(4, #Document)
+AssertEquals("H2", Document[1].style.name)
+AssertTableEquals({"A", "heading"}, Document[1])
+AssertEquals("P", Document[2].style.name)
+AssertTableEquals({"One", "\024bold", "and", "\017italic",
+	"word.", "Spaced", "&", "done"}, Document[2])
+AssertEquals("Q", Document[3].style.name)
+AssertTableEquals({"Quoted"}, Document[3])
+AssertEquals("LB", Document[4].style.name)
+AssertTableEquals({"Item"}, Document[4])
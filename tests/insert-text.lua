@@ -0,0 +1,36 @@
+require("tests/testsuite")
+
+Cmd.InsertStringIntoParagraph("Hello")
+Cmd.SplitCurrentWord()
+Cmd.InsertStringIntoParagraph("world")
+Cmd.GotoBeginningOfWord()
+
+Cmd.Checkpoint()
+Cmd.InsertText("one two\r\nthree\tfour\n\nfive ")
+
+AssertEquals(4, #Document)
+AssertTableEquals({"Hello", "one", "two"}, Document[1])
+AssertEquals("P", Document[1].style.name)
+AssertTableEquals({"three", "four"}, Document[2])
+AssertTableEquals({""}, Document[3])
+AssertTableEquals({"five", "world"}, Document[4])
+AssertEquals(1, #Document._undostack)
+
+Cmd.Undo()
+
+AssertEquals(1, #Document)
+AssertTableEquals({"Hello", "world"}, Document[1])
+
+-- Text pasted into the middle of a word only splits it where the text has
+-- whitespace at its ends.
+
+Cmd.GotoEndOfDocument()
+Cmd.GotoPreviousCharW()
+Cmd.GotoPreviousCharW()
+Cmd.InsertText(" and ")
+
+AssertEquals(1, #Document)
+AssertTableEquals({"Hello", "wor", "and", "ld"}, Document[1])
+
+Cmd.InsertText("x")
+AssertTableEquals({"Hello", "wor", "and", "xld"}, Document[1])
@@ -6,3 +6,31 @@ local r = Cmd.LoadDocumentSet("testdocs/README-this file does not exist.wg")
 AssertEquals(false, r)
 
 
+
+-- A file which is cut short makes the loader itself fail. The error should
+-- still carry the loader's traceback, and the document's allocator arena
+-- must have been closed on the way out.
+
+local filename = os.tmpname()
+local fp = io.open(filename, "w")
+fp:write("WordGrinder dumpfile v1: this is not a text file!\nT\n")
+fp:close()
+
+local ok, e = pcall(LoadFromStream, filename)
+os.remove(filename)
+AssertEquals(false, ok)
+AssertEquals(true, e:find("^Exception: ") ~= nil)
+AssertEquals(true, e:find("\n[^\n]*fileio%.lua") ~= nil)
+
+collectgarbage("collect")
+collectgarbage("stop")
+local before = wg.allocstats()
+local t = {}
+for i = 1, 1000 do
+	t[i] = {}
+end
+local after = wg.allocstats()
+collectgarbage("restart")
+if before.pooling then
+	AssertEquals(before.arenabytes, after.arenabytes)
+end
@@ -0,0 +1,42 @@
+require("tests/testsuite")
+
+ScreenWidth, ScreenHeight = 80, 25
+Document:wrap(70)
+for i = 1, 30 do
+	Cmd.InsertStringIntoParagraph("paragraph "..i)
+	Cmd.SplitCurrentParagraph()
+end
+Cmd.GotoBeginningOfDocument()
+for i = 1, 5 do
+	Cmd.GotoNextParagraph()
+end
+
+local function drawops()
+	local c = wg.getdrawcount()
+	RedrawScreen()
+	return wg.getdrawcount() - c
+end
+
+-- The first frame draws everything; an identical frame only redraws the
+-- status bar.
+
+local full = drawops()
+local idle = drawops()
+AssertEquals(true, idle < 5)
+AssertEquals(true, full > (idle * 5))
+
+-- Editing a paragraph only redraws the rows it occupies.
+
+Cmd.InsertStringIntoParagraph("x")
+local edit = drawops()
+AssertEquals(true, edit > idle)
+AssertEquals(true, edit < (idle + 5))
+
+-- Anything else drawing on the screen forces a full redraw.
+
+wg.write(0, 0, "scribble")
+AssertEquals(full, drawops())
+AssertEquals(idle, drawops())
+
+InvalidateScreen()
+AssertEquals(full, drawops())
@@ -0,0 +1,37 @@
+require("tests/testsuite")
+
+ScreenWidth, ScreenHeight = 80, 25
+Document:wrap(70)
+for i = 1, 60 do
+	Cmd.InsertStringIntoParagraph("paragraph "..i)
+	Cmd.SplitCurrentParagraph()
+end
+Cmd.GotoBeginningOfDocument()
+for i = 1, 20 do
+	Cmd.GotoNextParagraph()
+end
+
+local function drawops()
+	local c = wg.getdrawcount()
+	RedrawScreen()
+	return wg.getdrawcount() - c
+end
+
+local full = drawops()
+local idle = drawops()
+
+-- Moving by a paragraph shifts the text; the screen is scrolled and only
+-- the rows scrolled in are drawn.
+
+Cmd.GotoNextParagraph()
+local down = drawops()
+AssertEquals(true, down < (idle + 6))
+
+Cmd.GotoPreviousParagraph()
+local up = drawops()
+AssertEquals(down, up)
+
+-- Jumping a long way can't reuse anything.
+
+Cmd.GotoEndOfDocument()
+AssertEquals(true, drawops() > (full / 2))
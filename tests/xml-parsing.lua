@@ -0,0 +1,108 @@
+require("tests/testsuite")
+
+local function tokens(xml)
+	local t = {}
+	for event, s1, s2, s3 in wg.tokenisexml(xml) do
+		local s = event
+		if (event == "opentag") or (event == "processing") then
+			local keys = {}
+			local attrs = (event == "opentag") and s3 or s2
+			for k, v in pairs(attrs) do
+				keys[#keys+1] = k.."="..v
+			end
+			table.sort(keys)
+			s = s..":"..s1..((event == "opentag") and ("|"..s2) or "")..
+				"["..table.concat(keys, ",").."]"
+		elseif (event == "closetag") then
+			s = s..":"..s1.."|"..s2
+		else
+			s = s..":"..s1
+		end
+		t[#t+1] = s
+	end
+	return t
+end
+
+-- Namespaces, self-closing tags, processing instructions and comments.
+
+AssertTableEquals(
+	{
+		"processing:xml[version=1.0]",
+		"opentag:urn:a|doc[]",
+		"opentag:urn:b|p[plain=y,urn:b style=x]",
+		"closetag:urn:b|p",
+		"opentag:urn:a|q[]",
+		"closetag:urn:a|q",
+		"closetag:urn:a|doc",
+	},
+	tokens('<?xml version="1.0"?>\n<!-- comment -->\n'..
+		'<doc xmlns="urn:a" xmlns:b="urn:b">\n'..
+		'  <b:p b:style="x" plain=\'y\'/>\n'..
+		'  <q></q>\n'..
+		'</doc>\n'))
+
+-- Entities, CDATA and whitespace collapse.
+
+AssertTableEquals(
+	{
+		"opentag:|p[a=1 < 2]",
+		"text: fish & chips \194\160café ",
+		"opentag:|b[]",
+		"text:and",
+		"closetag:|b",
+		"text: more words",
+		"cdata:  <raw>  ",
+		"closetag:|p",
+	},
+	tokens('<p a="1 &lt;   2"> fish &amp;\tchips\n  &#160;caf&#xe9; '..
+		'<b>\n  and\n</b> more\nwords<![CDATA[  <raw>  ]]></p>'))
+
+-- Errors stop the tokeniser.
+
+AssertTableEquals(
+	{ "opentag:|p[]", "text:x", "error:<  >" },
+	tokens('<p>x<  >'))
+
+-- ParseXML builds a tree.
+
+local tree = ParseXML('<d:doc xmlns:d="urn:d"><d:p d:n="1">Hello '..
+	'<d:b>world</d:b></d:p><d:p/></d:doc>')
+AssertEquals("urn:d doc", tree._name)
+AssertEquals(2, #tree)
+AssertEquals("urn:d p", tree[1]._name)
+AssertEquals("1", tree[1]["urn:d n"])
+AssertEquals("Hello ", tree[1][1])
+AssertEquals("world", tree[1][2][1])
+AssertEquals(0, #tree[2])
+
+-- The compatibility wrapper produces token tables.
+
+local next = TokeniseXML('<a x="1">t</a>')
+local t = next()
+AssertEquals("opentag", t.event)
+AssertEquals("a", t.name)
+AssertEquals("x", t.attrs[1].name)
+AssertEquals("1", t.attrs[1].value)
+AssertEquals("t", next().text)
+AssertEquals("closetag", next().event)
+AssertEquals(nil, next())
+
+-- Elements can have any number of attributes.
+
+do
+	local a = {}
+	for i = 1, 200 do
+		a[#a+1] = 'a'..i..'="'..i..'"'
+	end
+	local xml = "<x "..table.concat(a, " ").."/>"
+	local n = 0
+	for event, ns, name, attrs in wg.tokenisexml(xml) do
+		if (event == "opentag") then
+			for k, v in pairs(attrs) do
+				AssertEquals(k, "a"..v)
+				n = n + 1
+			end
+		end
+	end
+	AssertEquals(200, n)
+end
@@ -0,0 +1,63 @@
+require("tests/testsuite")
+
+local filename = os.tmpname()
+
+Cmd.InsertStringIntoParagraph("The quick brown fox")
+Cmd.SplitCurrentParagraph()
+Cmd.InsertStringIntoParagraph("jumps over the lazy dog.")
+AssertEquals(true, Cmd.ExportODTFile(filename))
+
+local zip = wg.openzip(filename)
+local members = zip:list()
+table.sort(members)
+AssertTableEquals({"META-INF/manifest.xml", "content.xml", "meta.xml",
+	"mimetype", "settings.xml", "styles.xml"}, members)
+AssertEquals("application/vnd.oasis.opendocument.text", zip:read("mimetype"))
+AssertEquals(nil, zip:read("nonexistent.xml"))
+
+local chunks = {}
+AssertEquals(true, zip:stream("content.xml", function(s)
+	chunks[#chunks+1] = s
+end))
+AssertEquals(zip:read("content.xml"), table.concat(chunks))
+zip:close()
+
+AssertEquals(false, (pcall(zip.read, zip, "mimetype")))
+
+AssertEquals("application/vnd.oasis.opendocument.text",
+	wg.readfromzip(filename, "mimetype"))
+AssertEquals(nil, wg.openzip(filename..".nonexistent"))
+
+AssertEquals(true, Cmd.ImportODTFile(filename))
+AssertEquals(2, #Document)
+AssertTableEquals({"The", "quick", "brown", "fox"}, Document[1])
+AssertTableEquals({"jumps", "over", "the", "lazy", "dog."}, Document[2])
+
+-- Streamed members.
+
+local zip = wg.createzip(filename)
+AssertEquals(true, zip:write("first", "one"))
+AssertEquals(true, zip:open("second"))
+AssertEquals(false, (pcall(zip.write, zip, "third", "three")))
+local chunks = {}
+for i = 1, 20000 do
+	local s = tostring(i)
+	chunks[#chunks+1] = s
+	zip:append(s, " ")
+	chunks[#chunks+1] = " "
+end
+local big = string.rep("x", 100000)
+zip:append(big)
+chunks[#chunks+1] = big
+AssertEquals(true, zip:finish())
+AssertEquals(true, zip:write("third", "three"))
+AssertEquals(true, zip:close())
+
+local zip = wg.openzip(filename)
+AssertTableEquals({"first", "second", "third"}, zip:list())
+AssertEquals("one", zip:read("first"))
+AssertEquals(table.concat(chunks), zip:read("second"))
+AssertEquals("three", zip:read("third"))
+zip:close()
+
+os.remove(filename)
@@ -1,34 +1,231 @@
 -- © 2008 David Given.
 -- WordGrinder is licensed under the MIT open source license. See the COPYING
 -- file in this distribution for the full text.
+--
+-- Usage: multibin2c.lua [-c <target>] <tablename> <files...>
+--
+-- With -c, each file is compiled as a Lua script and embedded as stripped
+-- bytecode rather than as source text. The bytecode is produced by whichever
+-- Lua is running this script, so it must be loadable by the one WordGrinder
+-- is linked against; that's described by <target>, which is either
+-- "luajit" or "lua5.2,<sizeof int>,<sizeof size_t>", and anything else is an
+-- error (rather than a binary which won't start).
 
 local function write(...)
 	io.stdout:write(...)
 end
 
-local function multibin2c(pattern, ...)
-	local files = {...}
+-- Lua 5.2's string.dump() can't strip debug information, so this does it by
+-- hand: it walks a dumped chunk and rewrites each function with an empty
+-- source name, line table, local variable list and upvalue name list. This
+-- is what luac -s does.
+
+local function strip52(data)
+	local pos = 1
+	local out = {}
+
+	local function fail(s)
+		error("can't strip bytecode: "..s)
+	end
+
+	local function take(n)
+		local s = data:sub(pos, pos+n-1)
+		if (#s ~= n) then
+			fail("truncated chunk")
+		end
+		pos = pos + n
+		return s
+	end
+
+	local function emit(s)
+		out[#out+1] = s
+	end
+
+	-- Check the header and work out the sizes of the primitive types.
+
+	local header = take(18)
+	if (header:sub(1, 5) ~= "\27Lua\82") or (header:byte(6) ~= 0) then
+		fail("not a Lua 5.2 chunk")
+	end
+	local littleendian = (header:byte(7) == 1)
+	local intsize = header:byte(8)
+	local sizetsize = header:byte(9)
+	local instructionsize = header:byte(10)
+	local numbersize = header:byte(11)
+	emit(header)
+
+	local function decode(s)
+		local n = 0
+		for i = #s, 1, -1 do
+			local b = littleendian and s:byte(i) or s:byte(#s - i + 1)
+			n = n*256 + b
+		end
+		return n
+	end
+
+	local function copyint()
+		local s = take(intsize)
+		emit(s)
+		return decode(s)
+	end
+
+	local function copystring()
+		local s = take(sizetsize)
+		emit(s)
+		local n = decode(s)
+		emit(take(n))
+	end
+
+	local function skip(n)
+		take(n)
+	end
+
+	local function skipstring()
+		skip(decode(take(sizetsize)))
+	end
+
+	local zeroint = string.rep("\0", intsize)
+	local zerosizet = string.rep("\0", sizetsize)
+
+	local function copyfunction()
+		copyint() -- linedefined
+		copyint() -- lastlinedefined
+		emit(take(3)) -- numparams, is_vararg, maxstacksize
+
+		-- Code.
+
+		emit(take(copyint() * instructionsize))
+
+		-- Constants.
+
+		for i = 1, copyint() do
+			local t = take(1)
+			emit(t)
+			t = t:byte()
+			if (t == 1) then -- LUA_TBOOLEAN
+				emit(take(1))
+			elseif (t == 3) then -- LUA_TNUMBER
+				emit(take(numbersize))
+			elseif (t == 4) then -- LUA_TSTRING
+				copystring()
+			elseif (t ~= 0) then -- LUA_TNIL
+				fail("bad constant type "..t)
+			end
+		end
+
+		-- Nested functions.
+
+		for i = 1, copyint() do
+			copyfunction()
+		end
+
+		-- Upvalues.
+
+		emit(take(copyint() * 2))
+
+		-- Debug information, which is skipped and replaced with nothing.
+
+		skipstring()
+		skip(decode(take(intsize)) * intsize)
+		for i = 1, decode(take(intsize)) do
+			skipstring()
+			skip(intsize*2)
+		end
+		for i = 1, decode(take(intsize)) do
+			skipstring()
+		end
+
+		emit(zerosizet)
+		emit(zeroint)
+		emit(zeroint)
+		emit(zeroint)
+	end
+
+	copyfunction()
+	if (pos ~= #data+1) then
+		fail("trailing garbage")
+	end
+	return table.concat(out)
+end
+
+local function checktarget(target)
+	local function fail(s)
+		io.stderr:write("multibin2c: can't generate bytecode for ", target,
+			": ", s, "\n")
+		os.exit(1)
+	end
+
+	if (target == "luajit") then
+		if not jit then
+			fail("this is ".._VERSION..", not LuaJIT")
+		end
+		return
+	end
+
+	local version, intsize, sizetsize =
+		target:match("^(lua5%.2),(%d+),(%d+)$")
+	if not version then
+		fail("unknown target")
+	end
+	if (_VERSION ~= "Lua 5.2") or jit then
+		fail("this is "..(jit and jit.version or _VERSION))
+	end
+
+	local header = string.dump(function() end)
+	if (header:byte(8) ~= tonumber(intsize)) or
+			(header:byte(9) ~= tonumber(sizetsize)) then
+		fail(string.format("this Lua has %d-byte ints and %d-byte size_ts",
+			header:byte(8), header:byte(9)))
+	end
+end
+
+local function compile(f, data)
+	local chunk, e = (loadstring or load)(data, "@"..f)
+	if not chunk then
+		error(e)
+	end
+
+	if (_VERSION == "Lua 5.2") and not jit then
+		return strip52(string.dump(chunk))
+	end
+	return string.dump(chunk, true)
+end
+
+local function multibin2c(...)
+	local args = {...}
+	local compiling = false
+	if (args[1] == "-c") then
+		compiling = true
+		table.remove(args, 1)
+		checktarget(table.remove(args, 1))
+	end
+	local pattern = table.remove(args, 1)
+	local files = args
 	local id = 1
-	
+
 	write('#include "globals.h"\n')
 	for _, f in ipairs(files) do
 		write("\n/* This is ", f, " */\n")
 		write("static const char file_", id, "[] = {\n")
-		
+
 		local fp = io.open(f, "rb")
 		local data = fp:read("*a")
+		fp:close()
+		if compiling then
+			data = compile(f, data)
+		end
+
 		for i = 1, data:len() do
 			write(data:byte(i), ", ")
 			if ((i % 16) == 0) then
 				write("\n")
 			end
 		end
-		fp:close()
-		
+
 		write("\n};\n")
 		id = id + 1
 	end
-	
+
 	write("const FileDescriptor ", pattern, "[] = {\n")
 	for i = 1, id-1 do
 		local id = "file_"..i